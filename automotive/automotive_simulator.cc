@@ -381,6 +381,72 @@ int AutomotiveSimulator<T>::AddIdmControlledPriusMaliputRailcar(
   return id;
 }
 
+template <typename T>
+std::vector<int>
+AutomotiveSimulator<T>::AddIdmControlledPriusMaliputRailcarFleet(
+    const std::string& name,
+    const std::vector<LaneDirection>& initial_lane_directions,
+    const MaliputRailcarParams<T>& params,
+    const std::vector<T>& initial_s,
+    const std::vector<T>& initial_speeds) {
+  DRAKE_DEMAND(!has_started());
+  DRAKE_DEMAND(aggregator_ != nullptr);
+  CheckNameUniqueness(name);
+  if (road_ == nullptr) {
+    throw std::runtime_error("AutomotiveSimulator::"
+        "AddIdmControlledPriusMaliputRailcarFleet(): RoadGeometry not set. "
+        "Please call SetRoadGeometry() first before calling this method.");
+  }
+  for (const LaneDirection& lane_direction : initial_lane_directions) {
+    if (lane_direction.lane == nullptr) {
+      throw std::runtime_error("AutomotiveSimulator::"
+          "AddIdmControlledPriusMaliputRailcarFleet(): A provided initial "
+          "lane is nullptr.");
+    }
+    if (lane_direction.lane->segment()->junction()->road_geometry() !=
+        road_.get()) {
+      throw std::runtime_error("AutomotiveSimulator::"
+          "AddIdmControlledPriusMaliputRailcarFleet(): A provided initial "
+          "lane is not within this simulation's RoadGeometry.");
+    }
+  }
+  for (const std::vector<T>* initial_values : {&initial_s, &initial_speeds}) {
+    if (!initial_values->empty() &&
+        initial_values->size() != initial_lane_directions.size()) {
+      throw std::runtime_error("AutomotiveSimulator::"
+          "AddIdmControlledPriusMaliputRailcarFleet(): The number of initial "
+          "states does not match the number of initial lanes.");
+    }
+  }
+
+  std::vector<int> ids;
+  for (size_t i = 0; i < initial_lane_directions.size(); ++i) {
+    ids.push_back(allocate_vehicle_number());
+  }
+  const int first_id = ids.empty() ? next_vehicle_number_ : ids.front();
+
+  auto fleet = builder_->template AddSystem<MaliputRailcarFleet<T>>(
+      initial_lane_directions, first_id);
+  fleet->set_name(name);
+  for (const int id : ids) {
+    vehicles_[id] = fleet;
+  }
+  RailcarFleetConfig& config = railcar_fleet_configs_[fleet];
+  config.params.set_value(params.get_value());
+  config.initial_s = initial_s;
+  config.initial_speeds = initial_speeds;
+
+  builder_->Connect(fleet->pose_output(),
+                    aggregator_->AddBundleInput(name, fleet->num_cars()));
+  if (lcm_) {
+    for (int i = 0; i < fleet->num_cars(); ++i) {
+      car_vis_applicator_->AddCarVis(std::make_unique<PriusVis<T>>(
+          ids[i], name + "::" + std::to_string(i)));
+    }
+  }
+  return ids;
+}
+
 template <typename T>
 void AutomotiveSimulator<T>::SetMaliputRailcarAccelerationCommand(int id,
     double acceleration) {
@@ -667,6 +733,25 @@ void AutomotiveSimulator<T>::InitializeMaliputRailcars() {
         car->get_mutable_parameters(&context);
     railcar_system_params.set_value(params.get_value());
   }
+
+  for (auto& pair : railcar_fleet_configs_) {
+    const MaliputRailcarFleet<T>* const fleet = pair.first;
+    const RailcarFleetConfig& config = pair.second;
+
+    systems::Context<T>& context = diagram_->GetMutableSubsystemContext(
+         *fleet, &simulator_->get_mutable_context());
+    MaliputRailcarState<T> car_state;
+    for (int i = 0; i < fleet->num_cars(); ++i) {
+      fleet->GetCarState(context, i, &car_state);
+      if (!config.initial_s.empty()) car_state.set_s(config.initial_s[i]);
+      if (!config.initial_speeds.empty()) {
+        car_state.set_speed(config.initial_speeds[i]);
+      }
+      fleet->SetCarState(&context, i, car_state);
+    }
+    fleet->get_mutable_railcar_parameters(&context).set_value(
+        config.params.get_value());
+  }
 }
 
 template <typename T>
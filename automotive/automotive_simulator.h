@@ -14,6 +14,7 @@
 #include "drake/automotive/lane_direction.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/automotive/maliput_railcar.h"
+#include "drake/automotive/maliput_railcar_fleet.h"
 #include "drake/automotive/mobil_planner.h"
 #include "drake/automotive/pure_pursuit_controller.h"
 #include "drake/automotive/simple_car.h"
@@ -242,6 +243,44 @@ class AutomotiveSimulator {
       const MaliputRailcarParams<T>& params = MaliputRailcarParams<T>(),
       const MaliputRailcarState<T>& initial_state = MaliputRailcarState<T>());
 
+  /// Adds a MaliputRailcarFleet to this simulation, with each of its vehicles
+  /// visualized as a Toyota Prius.  This is the scalable alternative to
+  /// calling AddIdmControlledPriusMaliputRailcar() once per vehicle, except
+  /// that the vehicles of the fleet only react to each other.
+  ///
+  /// @pre Start() has NOT been called.
+  ///
+  /// @pre SetRoadGeometry() was called. Otherwise, a std::runtime_error will be
+  /// thrown.
+  ///
+  /// @param name The fleet's name, which must be unique among all cars.
+  /// Otherwise a std::runtime_error will be thrown.  Vehicle `i` of the fleet
+  /// is named `name::i` in GetCurrentPoses().
+  ///
+  /// @param initial_lane_directions The initial lane and direction on the
+  /// lane of each vehicle. The lanes must be part of the
+  /// maliput::api::RoadGeometry that is added via SetRoadGeometry(). Otherwise
+  /// a std::runtime_error will be thrown.
+  ///
+  /// @param params The MaliputRailcarParams shared by the vehicles. This is an
+  /// optional parameter. Defaults are used if this parameter is not provided.
+  ///
+  /// @param initial_s The initial `s` coordinate of each vehicle, in the
+  /// layout of MaliputRailcarState. This is an optional parameter. Defaults
+  /// are used if it is empty; otherwise, it must have one element per vehicle.
+  ///
+  /// @param initial_speeds The initial speed of each vehicle. This is an
+  /// optional parameter, like @p initial_s.
+  ///
+  /// @return The IDs of the vehicles that were just added to the simulation,
+  /// which are consecutive.
+  std::vector<int> AddIdmControlledPriusMaliputRailcarFleet(
+      const std::string& name,
+      const std::vector<LaneDirection>& initial_lane_directions,
+      const MaliputRailcarParams<T>& params = MaliputRailcarParams<T>(),
+      const std::vector<T>& initial_s = {},
+      const std::vector<T>& initial_speeds = {});
+
   /// Sets the acceleration command of a particular MaliputRailcar.
   ///
   /// @param id The ID of the MaliputRailcar. This is the ID that was returned
@@ -398,6 +437,19 @@ class AutomotiveSimulator {
            std::pair<MaliputRailcarParams<T>, MaliputRailcarState<T>>>
       railcar_configs_;
 
+  // The parameters and the desired initial states of the vehicles of a
+  // MaliputRailcarFleet.
+  struct RailcarFleetConfig {
+    MaliputRailcarParams<T> params;
+    std::vector<T> initial_s;
+    std::vector<T> initial_speeds;
+  };
+
+  // Holds the configuration of each MaliputRailcarFleet. It is used to
+  // initialize the simulation's diagram's state.
+  std::map<const MaliputRailcarFleet<T>*, RailcarFleetConfig>
+      railcar_fleet_configs_;
+
   // The output port of the Diagram that contains pose bundle information.
   int pose_bundle_output_port_{};
 
@@ -98,9 +98,15 @@ void IdmController<T>::CalcAcceleration(
                                                     ego_velocity_index_);
   DRAKE_ASSERT(ego_velocity != nullptr);
 
-  const PoseBundle<T>* const traffic_poses =
-      this->template EvalInputValue<PoseBundle<T>>(context, traffic_index_);
-  DRAKE_ASSERT(traffic_poses != nullptr);
+  const systems::AbstractValue* const traffic =
+      this->EvalAbstractInput(context, traffic_index_);
+  DRAKE_ASSERT(traffic != nullptr);
+  const TrafficIndex<T>* const indexed_traffic =
+      traffic->template MaybeGetValue<TrafficIndex<T>>();
+  const PoseBundle<T>& traffic_poses =
+      (indexed_traffic != nullptr)
+          ? indexed_traffic->poses()
+          : traffic->template GetValue<PoseBundle<T>>();
 
   // Obtain the state if we've allocated it.
   RoadPosition ego_rp;
@@ -109,14 +115,15 @@ void IdmController<T>::CalcAcceleration(
     ego_rp = context.template get_abstract_state<RoadPosition>(0);
   }
 
-  ImplCalcAcceleration(*ego_pose, *ego_velocity, *traffic_poses, idm_params,
-                       ego_rp, accel_output);
+  ImplCalcAcceleration(*ego_pose, *ego_velocity, traffic_poses,
+                       indexed_traffic, idm_params, ego_rp, accel_output);
 }
 
 template <typename T>
 void IdmController<T>::ImplCalcAcceleration(
     const PoseVector<T>& ego_pose, const FrameVelocity<T>& ego_velocity,
     const PoseBundle<T>& traffic_poses,
+    const TrafficIndex<T>* indexed_traffic,
     const IdmPlannerParameters<T>& idm_params,
     const RoadPosition& ego_rp,
     systems::BasicVector<T>* command) const {
@@ -133,10 +140,16 @@ void IdmController<T>::ImplCalcAcceleration(
   }
 
   // Find the single closest car ahead.
-  const ClosestPose<T> lead_car_pose = PoseSelector<T>::FindSingleClosestPose(
-      ego_position.lane, ego_pose, traffic_poses,
-      idm_params.scan_ahead_distance(), AheadOrBehind::kAhead,
-      path_or_branches_);
+  const ClosestPose<T> lead_car_pose =
+      (indexed_traffic != nullptr)
+          ? PoseSelector<T>::FindSingleClosestPose(
+                ego_position.lane, ego_pose, *indexed_traffic,
+                idm_params.scan_ahead_distance(), AheadOrBehind::kAhead,
+                path_or_branches_)
+          : PoseSelector<T>::FindSingleClosestPose(
+                ego_position.lane, ego_pose, traffic_poses,
+                idm_params.scan_ahead_distance(), AheadOrBehind::kAhead,
+                path_or_branches_);
   const T headway_distance = lead_car_pose.distance;
 
   const LanePositionT<T> lane_position(T(ego_position.pos.s()),
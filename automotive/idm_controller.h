@@ -11,6 +11,7 @@
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/automotive/pose_selector.h"
+#include "drake/automotive/traffic_index.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/rendering/pose_bundle.h"
@@ -36,7 +37,8 @@ namespace automotive {
 ///   (InputPortDescriptor getter: ego_velocity_input())
 ///
 /// Input Port 2: PoseBundle for the traffic cars, possibly inclusive of the ego
-///   car's pose.
+///   car's pose, or a TrafficIndex of those poses over the same road (e.g. the
+///   output of a TrafficIndexer shared by several controllers).
 ///   (InputPortDescriptor getter: traffic_input())
 ///
 /// Output Port 0: A BasicVector containing the acceleration request.
@@ -98,6 +100,7 @@ class IdmController : public systems::LeafSystem<T> {
       const systems::rendering::PoseVector<T>& ego_pose,
       const systems::rendering::FrameVelocity<T>& ego_velocity,
       const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficIndex<T>* indexed_traffic,
       const IdmPlannerParameters<T>& idm_params,
       const maliput::api::RoadPosition& ego_rp,
       systems::BasicVector<T>* command) const;
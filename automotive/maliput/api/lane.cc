@@ -4,6 +4,13 @@ namespace drake {
 namespace maliput {
 namespace api {
 
+void Lane::DoToGeoPositions(const std::vector<LanePosition>& lane_positions,
+                            std::vector<GeoPosition>* geo_positions) const {
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    (*geo_positions)[i] = DoToGeoPosition(lane_positions[i]);
+  }
+}
+
 // These instantiations must match the API documentation in lane.h.
 template<>
 GeoPositionT<double> Lane::ToGeoPositionT<double>(
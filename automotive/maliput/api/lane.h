@@ -2,10 +2,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/type_specific_identifier.h"
 #include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/symbolic.h"
@@ -102,6 +104,21 @@ class Lane {
     return DoToGeoPosition(lane_pos);
   }
 
+  /// Computes the GeoPositions corresponding to many LanePositions at once, as
+  /// if by calling ToGeoPosition() on each of them, but through a single
+  /// virtual call, which lets backends hoist the work common to all of them.
+  ///
+  /// @param lane_positions The LanePositions to convert. Each of them must
+  ///        satisfy the preconditions of ToGeoPosition().
+  /// @param geo_positions The resulting GeoPositions, in the same order. It is
+  ///        resized to the size of @p lane_positions. It must not be nullptr.
+  void ToGeoPositions(const std::vector<LanePosition>& lane_positions,
+                      std::vector<GeoPosition>* geo_positions) const {
+    DRAKE_THROW_UNLESS(geo_positions != nullptr);
+    geo_positions->resize(lane_positions.size());
+    DoToGeoPositions(lane_positions, geo_positions);
+  }
+
   /// Generalization of ToGeoPosition to arbitrary scalar types, where the
   /// structures `LanePositionT<T>` and `GeoPositionT<T>` are used in place of
   /// `LanePosition` and `GeoPosition`, respectively.
@@ -263,6 +280,11 @@ class Lane {
 
   virtual GeoPosition DoToGeoPosition(const LanePosition& lane_pos) const = 0;
 
+  // The default implementation calls DoToGeoPosition() on each position.
+  // @p geo_positions has already been resized to match @p lane_positions.
+  virtual void DoToGeoPositions(const std::vector<LanePosition>& lane_positions,
+                                std::vector<GeoPosition>* geo_positions) const;
+
   virtual LanePosition DoToLanePosition(
       const GeoPosition& geo_pos,
       GeoPosition* nearest_point,
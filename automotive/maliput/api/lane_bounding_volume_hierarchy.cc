@@ -0,0 +1,210 @@
+#include "drake/automotive/maliput/api/lane_bounding_volume_hierarchy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+
+#include "drake/automotive/maliput/api/junction.h"
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/maliput/api/segment.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace maliput {
+namespace api {
+
+namespace {
+
+// The maximum number of pieces in a leaf.
+const int kLeafSize = 4;
+
+// The minimum length of a piece, so that very narrow Lanes are not cut into
+// a great many pieces.
+const double kMinPieceLength = 1.;
+
+// Returns the corners of the driveable volume of `lane` at `s`.
+std::vector<Eigen::Vector3d> Corners(const Lane& lane, double s) {
+  std::vector<Eigen::Vector3d> corners;
+  const RBounds r_bounds = lane.driveable_bounds(s);
+  for (const double r : {r_bounds.min(), r_bounds.max()}) {
+    const HBounds h_bounds = lane.elevation_bounds(s, r);
+    for (const double h : {h_bounds.min(), h_bounds.max()}) {
+      corners.push_back(lane.ToGeoPosition({s, r, h}).xyz());
+    }
+  }
+  return corners;
+}
+
+}  // namespace
+
+
+LaneBoundingVolumeHierarchy::LaneBoundingVolumeHierarchy(
+    const RoadGeometry& road_geometry) {
+  for (int i = 0; i < road_geometry.num_junctions(); ++i) {
+    const Junction* junction = road_geometry.junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lanes_.push_back(segment->lane(k));
+        AddPieces(static_cast<int>(lanes_.size()) - 1);
+      }
+    }
+  }
+  if (!pieces_.empty()) {
+    nodes_.reserve(2 * (pieces_.size() / kLeafSize + 1));
+    Build(0, static_cast<int>(pieces_.size()));
+  }
+}
+
+void LaneBoundingVolumeHierarchy::AddPieces(int lane_index) {
+  const Lane& lane = *lanes_[lane_index];
+  const double length = lane.length();
+  const RBounds r_bounds = lane.driveable_bounds(0.);
+  const double piece_length =
+      std::max(r_bounds.max() - r_bounds.min(), kMinPieceLength);
+  const int num_pieces =
+      std::max(1, static_cast<int>(std::ceil(length / piece_length)));
+
+  std::vector<Eigen::Vector3d> start_corners = Corners(lane, 0.);
+  for (int i = 0; i < num_pieces; ++i) {
+    const double s_start = length * i / num_pieces;
+    const double s_end = length * (i + 1) / num_pieces;
+    const std::vector<Eigen::Vector3d> middle_corners =
+        Corners(lane, 0.5 * (s_start + s_end));
+    std::vector<Eigen::Vector3d> end_corners = Corners(lane, s_end);
+
+    Piece piece;
+    piece.lane_index = lane_index;
+    double padding = 0.;
+    for (size_t c = 0; c < start_corners.size(); ++c) {
+      piece.box.extend(start_corners[c]);
+      piece.box.extend(middle_corners[c]);
+      piece.box.extend(end_corners[c]);
+      padding = std::max({padding,
+                          (middle_corners[c] - start_corners[c]).norm(),
+                          (end_corners[c] - middle_corners[c]).norm()});
+    }
+    piece.box.min().array() -= padding;
+    piece.box.max().array() += padding;
+    pieces_.push_back(piece);
+    start_corners = std::move(end_corners);
+  }
+}
+
+int LaneBoundingVolumeHierarchy::Build(int begin, int end) {
+  const int node_index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  Eigen::AlignedBox3d centers;
+  for (int i = begin; i < end; ++i) {
+    nodes_[node_index].box.extend(pieces_[i].box);
+    centers.extend(pieces_[i].box.center());
+  }
+  nodes_[node_index].begin = begin;
+  nodes_[node_index].end = end;
+  if (end - begin <= kLeafSize) return node_index;
+
+  int axis{};
+  centers.sizes().maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(pieces_.begin() + begin, pieces_.begin() + middle,
+                   pieces_.begin() + end,
+                   [axis](const Piece& a, const Piece& b) {
+                     return a.box.center()[axis] < b.box.center()[axis];
+                   });
+  Build(begin, middle);
+  const int second_child = Build(middle, end);
+  nodes_[node_index].second_child = second_child;
+  return node_index;
+}
+
+std::vector<const Lane*> LaneBoundingVolumeHierarchy::FindLanesWithin(
+    const GeoPosition& geo_position, double radius) const {
+  DRAKE_DEMAND(radius >= 0.);
+  std::vector<int> lane_indices;
+  if (!nodes_.empty()) {
+    const Eigen::Vector3d point = geo_position.xyz();
+    std::vector<int> stack{0};
+    while (!stack.empty()) {
+      const Node& node = nodes_[stack.back()];
+      const int node_index = stack.back();
+      stack.pop_back();
+      if (node.box.exteriorDistance(point) > radius) continue;
+      if (node.second_child < 0) {
+        for (int i = node.begin; i < node.end; ++i) {
+          if (pieces_[i].box.exteriorDistance(point) <= radius) {
+            lane_indices.push_back(pieces_[i].lane_index);
+          }
+        }
+      } else {
+        stack.push_back(node.second_child);
+        stack.push_back(node_index + 1);
+      }
+    }
+  }
+
+  // Lanes are indexed in RoadGeometry order, and may have several pieces.
+  std::sort(lane_indices.begin(), lane_indices.end());
+  lane_indices.erase(std::unique(lane_indices.begin(), lane_indices.end()),
+                     lane_indices.end());
+  std::vector<const Lane*> result;
+  result.reserve(lane_indices.size());
+  for (const int lane_index : lane_indices) {
+    result.push_back(lanes_[lane_index]);
+  }
+  return result;
+}
+
+const Lane* LaneBoundingVolumeHierarchy::FindNearestLane(
+    const GeoPosition& geo_position, double* distance) const {
+  DRAKE_DEMAND(distance != nullptr);
+  *distance = std::numeric_limits<double>::infinity();
+  const Lane* nearest_lane{};
+  if (nodes_.empty()) return nearest_lane;
+
+  // Visits the nodes and pieces by increasing distance of their boxes, until
+  // that distance exceeds the distance to the nearest Lane so far. A negative
+  // piece index marks a node.
+  const Eigen::Vector3d point = geo_position.xyz();
+  using Entry = std::pair<double, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  std::unordered_set<int> visited_lanes;
+  queue.emplace(nodes_[0].box.exteriorDistance(point), -1);
+  while (!queue.empty() && queue.top().first <= *distance) {
+    const int index = queue.top().second;
+    queue.pop();
+    if (index >= 0) {
+      const int lane_index = pieces_[index].lane_index;
+      if (!visited_lanes.insert(lane_index).second) continue;
+      double lane_distance{};
+      lanes_[lane_index]->ToLanePosition(geo_position, nullptr,
+                                         &lane_distance);
+      if (lane_distance < *distance) {
+        *distance = lane_distance;
+        nearest_lane = lanes_[lane_index];
+      }
+      continue;
+    }
+    const int node_index = -1 - index;
+    const Node& node = nodes_[node_index];
+    if (node.second_child < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        queue.emplace(pieces_[i].box.exteriorDistance(point), i);
+      }
+    } else {
+      for (const int child : {node_index + 1, node.second_child}) {
+        queue.emplace(nodes_[child].box.exteriorDistance(point), -1 - child);
+      }
+    }
+  }
+  return nearest_lane;
+}
+
+
+}  // namespace api
+}  // namespace maliput
+}  // namespace drake
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace maliput {
+namespace api {
+
+class Lane;
+class RoadGeometry;
+
+
+/// A bounding volume hierarchy over the Lanes of a RoadGeometry, which finds
+/// the Lanes near a GeoPosition without visiting every Lane.
+///
+/// Each Lane is cut along `s` into pieces about as long as the Lane is wide,
+/// and each piece is bounded by an axis-aligned box containing its driveable
+/// volume, which is sampled at the ends and the middle of the piece and then
+/// padded by the largest distance between consecutive samples, to cover the
+/// curvature in between. The boxes are organized in a binary tree, built by
+/// median splits on the longest axis of the box centers.
+///
+/// Only the Lane interface is used, so the hierarchy works with any
+/// implementation of it. Building it costs a few calls of
+/// Lane::ToGeoPosition() per piece, and O(n log n) in the number of pieces.
+class LaneBoundingVolumeHierarchy {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LaneBoundingVolumeHierarchy)
+
+  /// Builds the hierarchy over the Lanes of @p road_geometry, which must
+  /// outlive it and must not change afterwards.
+  explicit LaneBoundingVolumeHierarchy(const RoadGeometry& road_geometry);
+
+  /// Returns the number of Lanes in the hierarchy.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+  /// Returns the Lanes whose bounding volumes come within @p radius of
+  /// @p geo_position. Every Lane with a point within @p radius of
+  /// @p geo_position is returned, along with some Lanes that may be slightly
+  /// farther. The Lanes are in RoadGeometry order, i.e., sorted by Junction,
+  /// then Segment, then Lane index.
+  std::vector<const Lane*> FindLanesWithin(const GeoPosition& geo_position,
+                                           double radius) const;
+
+  /// Returns the Lane nearest to @p geo_position, as measured by
+  /// Lane::ToLanePosition(), and sets @p distance to its distance. Returns
+  /// nullptr, with an infinite @p distance, if there are no Lanes. When
+  /// several Lanes are equally near, any of them may be returned.
+  const Lane* FindNearestLane(const GeoPosition& geo_position,
+                              double* distance) const;
+
+ private:
+  // A box around a piece of a Lane.
+  struct Piece {
+    Eigen::AlignedBox3d box;
+    int lane_index{};
+  };
+
+  // A node of the tree. The nodes are stored in depth-first order, so the
+  // first child of an internal node immediately follows it.
+  struct Node {
+    Eigen::AlignedBox3d box;
+    // The range of the node's pieces in pieces_.
+    int begin{};
+    int end{};
+    // The index of the second child, or -1 for a leaf.
+    int second_child{-1};
+  };
+
+  void AddPieces(int lane_index);
+  int Build(int begin, int end);
+
+  std::vector<const Lane*> lanes_;
+  std::vector<Piece> pieces_;
+  std::vector<Node> nodes_;
+};
+
+
+}  // namespace api
+}  // namespace maliput
+}  // namespace drake
@@ -312,6 +312,15 @@ struct RoadPosition {
 };
 
 
+/// A RoadPosition found for a GeoPosition, along with the nearest point on
+/// the road to the GeoPosition and the distance between them.
+struct RoadPositionResult {
+  RoadPosition road_position;
+  GeoPosition nearest_position;
+  double distance{};
+};
+
+
 /// Bounds in the lateral dimension (r component) of a `Lane`-frame, consisting
 /// of a pair of minimum and maximum r value.  The bounds must straddle r = 0,
 /// i.e., the minimum must be <= 0 and the maximum must be >= 0.
@@ -1,5 +1,6 @@
 #include "drake/automotive/maliput/api/road_geometry.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -115,6 +116,40 @@ double Distance(const Rotation& a, const Rotation& b) {
 }  // namespace
 
 
+const LaneBoundingVolumeHierarchy&
+RoadGeometry::lane_bounding_volume_hierarchy() const {
+  std::call_once(lane_bounding_volume_hierarchy_flag_, [this]() {
+    lane_bounding_volume_hierarchy_ =
+        std::make_unique<LaneBoundingVolumeHierarchy>(*this);
+  });
+  return *lane_bounding_volume_hierarchy_;
+}
+
+
+std::vector<RoadPositionResult> RoadGeometry::DoFindRoadPositions(
+    const GeoPosition& geo_position, double radius) const {
+  DRAKE_DEMAND(radius >= 0.);
+  std::vector<RoadPositionResult> results;
+  for (const Lane* lane :
+       lane_bounding_volume_hierarchy().FindLanesWithin(geo_position,
+                                                        radius)) {
+    RoadPositionResult result;
+    const LanePosition lane_position = lane->ToLanePosition(
+        geo_position, &result.nearest_position, &result.distance);
+    if (result.distance <= radius) {
+      result.road_position = RoadPosition(lane, lane_position);
+      results.push_back(result);
+    }
+  }
+  std::stable_sort(results.begin(), results.end(),
+                   [](const RoadPositionResult& a,
+                      const RoadPositionResult& b) {
+                     return a.distance < b.distance;
+                   });
+  return results;
+}
+
+
 std::vector<std::string> RoadGeometry::CheckInvariants() const {
   std::vector<std::string> failures;
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "drake/automotive/maliput/api/lane_bounding_volume_hierarchy.h"
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/type_specific_identifier.h"
 #include "drake/common/drake_copyable.h"
@@ -106,6 +109,26 @@ class RoadGeometry {
     return DoToRoadPosition(geo_position, hint, nearest_position, distance);
   }
 
+  /// Finds every Lane which has a point within @p radius of @p geo_position,
+  /// and returns the RoadPosition on it nearest to @p geo_position, along
+  /// with that nearest GeoPosition and its distance, sorted by increasing
+  /// distance.
+  ///
+  /// The default implementation searches the lane_bounding_volume_hierarchy()
+  /// and calls Lane::ToLanePosition() on the nearby Lanes only.
+  ///
+  /// @pre @p radius must be non-negative.
+  std::vector<RoadPositionResult> FindRoadPositions(
+      const GeoPosition& geo_position, double radius) const {
+    return DoFindRoadPositions(geo_position, radius);
+  }
+
+  /// Returns a bounding volume hierarchy over the Lanes of this RoadGeometry,
+  /// which implementations may use to avoid visiting every Lane in queries.
+  /// It is built on the first call, so the RoadGeometry must be complete by
+  /// then; this method may be called concurrently.
+  const LaneBoundingVolumeHierarchy& lane_bounding_volume_hierarchy() const;
+
   /// Returns the tolerance guaranteed for linear measurements (positions).
   double linear_tolerance() const {
     return do_linear_tolerance();
@@ -145,10 +168,17 @@ class RoadGeometry {
                                         GeoPosition* nearest_position,
                                         double* distance) const = 0;
 
+  virtual std::vector<RoadPositionResult> DoFindRoadPositions(
+      const GeoPosition& geo_position, double radius) const;
+
   virtual double do_linear_tolerance() const = 0;
 
   virtual double do_angular_tolerance() const = 0;
   ///@}
+
+  mutable std::once_flag lane_bounding_volume_hierarchy_flag_;
+  mutable std::unique_ptr<LaneBoundingVolumeHierarchy>
+      lane_bounding_volume_hierarchy_;
 };
 
 
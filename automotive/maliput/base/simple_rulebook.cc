@@ -0,0 +1,188 @@
+#include "drake/automotive/maliput/base/simple_rulebook.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace maliput {
+
+using api::rules::LaneSRange;
+using api::rules::RightOfWayRule;
+using api::rules::SpeedLimitRule;
+using api::rules::SRange;
+
+namespace {
+
+// Returns the zones to which `rule` applies.
+std::vector<LaneSRange> ZonesOf(const RightOfWayRule& rule) {
+  return rule.controlled_zone().ranges();
+}
+
+std::vector<LaneSRange> ZonesOf(const SpeedLimitRule& rule) {
+  return {rule.zone()};
+}
+
+}  // namespace
+
+// The zones are sorted by their smallest s, and form an implicit balanced
+// binary tree: the root of the zones in [begin, end) is the zone at
+// mid = (begin + end) / 2, whose subtrees are [begin, mid) and [mid + 1, end).
+// Each root also records the largest s of the zones in its tree, so that
+// a search skips the trees that end before the query range begins.
+class SimpleRulebook::SRangeIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SRangeIndex)
+
+  SRangeIndex() = default;
+
+  // Adds the zone `s_range` of the rule at `rule_index`. Build() must be
+  // called after the last zone is added.
+  void Add(const SRange& s_range, int rule_index) {
+    zones_.push_back({std::min(s_range.s0(), s_range.s1()),
+                      std::max(s_range.s0(), s_range.s1()), rule_index});
+  }
+
+  void Build() {
+    std::sort(zones_.begin(), zones_.end(),
+              [](const Zone& a, const Zone& b) { return a.s_min < b.s_min; });
+    max_s_.resize(zones_.size());
+    BuildTree(0, static_cast<int>(zones_.size()));
+  }
+
+  // Appends the indices of the rules whose zones overlap `s_range` to
+  // `rule_indices`.
+  void Find(const SRange& s_range, std::vector<int>* rule_indices) const {
+    FindInTree(0, static_cast<int>(zones_.size()),
+               std::min(s_range.s0(), s_range.s1()),
+               std::max(s_range.s0(), s_range.s1()), rule_indices);
+  }
+
+ private:
+  struct Zone {
+    double s_min{};
+    double s_max{};
+    int rule_index{};
+  };
+
+  // Sets max_s_ of the root of the zones in [begin, end), and of the roots of
+  // its subtrees, and returns it.
+  double BuildTree(int begin, int end) {
+    if (begin >= end) {
+      return -std::numeric_limits<double>::infinity();
+    }
+    const int mid = (begin + end) / 2;
+    max_s_[mid] = std::max({zones_[mid].s_max, BuildTree(begin, mid),
+                            BuildTree(mid + 1, end)});
+    return max_s_[mid];
+  }
+
+  void FindInTree(int begin, int end, double s_min, double s_max,
+                  std::vector<int>* rule_indices) const {
+    if (begin >= end) {
+      return;
+    }
+    const int mid = (begin + end) / 2;
+    if (max_s_[mid] < s_min) {
+      return;
+    }
+    FindInTree(begin, mid, s_min, s_max, rule_indices);
+    // The zones from mid on begin after the query range ends.
+    if (zones_[mid].s_min > s_max) {
+      return;
+    }
+    if (zones_[mid].s_max >= s_min) {
+      rule_indices->push_back(zones_[mid].rule_index);
+    }
+    FindInTree(mid + 1, end, s_min, s_max, rule_indices);
+  }
+
+  std::vector<Zone> zones_;
+  std::vector<double> max_s_;
+};
+
+SimpleRulebook::SimpleRulebook(
+    const std::vector<RightOfWayRule>& right_of_way_rules,
+    const std::vector<SpeedLimitRule>& speed_limit_rules) {
+  Build(right_of_way_rules, &right_of_way_);
+  Build(speed_limit_rules, &speed_limit_);
+}
+
+SimpleRulebook::~SimpleRulebook() = default;
+
+template <class Rule>
+void SimpleRulebook::Build(const std::vector<Rule>& rules,
+                           RuleSet<Rule>* rule_set) {
+  DRAKE_DEMAND(rule_set != nullptr);
+  rule_set->rules = rules;
+  for (int i = 0; i < static_cast<int>(rules.size()); ++i) {
+    if (!rule_set->index_of_id.emplace(rules[i].id(), i).second) {
+      throw std::logic_error("Duplicate rule Id: " +
+                             rules[i].id().string());
+    }
+    for (const LaneSRange& zone : ZonesOf(rules[i])) {
+      std::unique_ptr<SRangeIndex>& lane_zones =
+          rule_set->zones[zone.lane_id()];
+      if (lane_zones == nullptr) {
+        lane_zones = std::make_unique<SRangeIndex>();
+      }
+      lane_zones->Add(zone.s_range(), i);
+    }
+  }
+  for (auto& lane_zones : rule_set->zones) {
+    lane_zones.second->Build();
+  }
+}
+
+template <class Rule>
+std::vector<Rule> SimpleRulebook::Find(const RuleSet<Rule>& rule_set,
+                                       const std::vector<LaneSRange>& ranges) {
+  std::vector<int> rule_indices;
+  for (const LaneSRange& range : ranges) {
+    const auto it = rule_set.zones.find(range.lane_id());
+    if (it != rule_set.zones.end()) {
+      it->second->Find(range.s_range(), &rule_indices);
+    }
+  }
+  // A rule may overlap several of the ranges, or have several zones that
+  // overlap a range. Each rule is reported once, in construction order.
+  std::sort(rule_indices.begin(), rule_indices.end());
+  rule_indices.erase(std::unique(rule_indices.begin(), rule_indices.end()),
+                     rule_indices.end());
+  std::vector<Rule> result;
+  result.reserve(rule_indices.size());
+  for (const int i : rule_indices) {
+    result.push_back(rule_set.rules[i]);
+  }
+  return result;
+}
+
+template <class Rule>
+Rule SimpleRulebook::Get(const RuleSet<Rule>& rule_set,
+                         const typename Rule::Id& id) {
+  // Throws std::out_of_range if `id` is unknown.
+  return rule_set.rules[rule_set.index_of_id.at(id)];
+}
+
+api::rules::RoadRulebook::QueryResults SimpleRulebook::DoFindRules(
+    const std::vector<LaneSRange>& ranges) const {
+  QueryResults results;
+  results.right_of_way = Find(right_of_way_, ranges);
+  results.speed_limit = Find(speed_limit_, ranges);
+  return results;
+}
+
+RightOfWayRule SimpleRulebook::DoGetRule(const RightOfWayRule::Id& id) const {
+  return Get(right_of_way_, id);
+}
+
+SpeedLimitRule SimpleRulebook::DoGetRule(const SpeedLimitRule::Id& id) const {
+  return Get(speed_limit_, id);
+}
+
+}  // namespace maliput
+}  // namespace drake
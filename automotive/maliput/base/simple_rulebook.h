@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/rules/regions.h"
+#include "drake/automotive/maliput/api/rules/right_of_way_rule.h"
+#include "drake/automotive/maliput/api/rules/road_rulebook.h"
+#include "drake/automotive/maliput/api/rules/speed_limit_rule.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace maliput {
+
+/// SimpleRulebook is a RoadRulebook that holds a fixed set of rules, given at
+/// construction.
+///
+/// The zones of the rules are indexed per Lane, by an interval tree over
+/// their s-ranges, so that FindRules() takes O(log n + k) time per query
+/// range, where n is the number of zones on the range's Lane and k the number
+/// of zones that overlap the range. A zone overlaps a query range if they are
+/// on the same Lane and their s-ranges, taken as closed intervals regardless
+/// of the order of s0 and s1, intersect.
+///
+/// The rulebook does not change after construction, so it may be queried
+/// concurrently from several threads.
+class SimpleRulebook : public api::rules::RoadRulebook {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SimpleRulebook)
+
+  /// Constructs a rulebook from @p right_of_way_rules and
+  /// @p speed_limit_rules.
+  ///
+  /// @throws std::logic_error if two rules of the same type have the same Id.
+  SimpleRulebook(
+      const std::vector<api::rules::RightOfWayRule>& right_of_way_rules,
+      const std::vector<api::rules::SpeedLimitRule>& speed_limit_rules);
+
+  ~SimpleRulebook() override;
+
+ private:
+  // An interval tree over the s-ranges of the zones on one Lane.
+  class SRangeIndex;
+
+  // The rules of one type, and the index of their zones.
+  template <class Rule>
+  struct RuleSet {
+    std::vector<Rule> rules;
+    std::unordered_map<typename Rule::Id, int> index_of_id;
+    // Maps each Lane to the index of the zones of `rules` on it.
+    std::unordered_map<api::LaneId, std::unique_ptr<SRangeIndex>> zones;
+  };
+
+  template <class Rule>
+  static void Build(const std::vector<Rule>& rules, RuleSet<Rule>* rule_set);
+
+  template <class Rule>
+  static std::vector<Rule> Find(
+      const RuleSet<Rule>& rule_set,
+      const std::vector<api::rules::LaneSRange>& ranges);
+
+  template <class Rule>
+  static Rule Get(const RuleSet<Rule>& rule_set, const typename Rule::Id& id);
+
+  QueryResults DoFindRules(
+      const std::vector<api::rules::LaneSRange>& ranges) const override;
+  api::rules::RightOfWayRule DoGetRule(
+      const api::rules::RightOfWayRule::Id& id) const override;
+  api::rules::SpeedLimitRule DoGetRule(
+      const api::rules::SpeedLimitRule::Id& id) const override;
+
+  RuleSet<api::rules::RightOfWayRule> right_of_way_;
+  RuleSet<api::rules::SpeedLimitRule> speed_limit_;
+};
+
+}  // namespace maliput
+}  // namespace drake
@@ -0,0 +1,143 @@
+#include "drake/automotive/maliput/base/simple_rulebook.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace maliput {
+namespace {
+
+using api::LaneId;
+using api::rules::LaneSRange;
+using api::rules::LaneSRoute;
+using api::rules::RightOfWayRule;
+using api::rules::RoadRulebook;
+using api::rules::SpeedLimitRule;
+using api::rules::SRange;
+
+SpeedLimitRule MakeSpeedLimit(const std::string& id, const LaneSRange& zone) {
+  return SpeedLimitRule(SpeedLimitRule::Id(id), zone,
+                        SpeedLimitRule::Severity::kStrict, 0., 44.);
+}
+
+RightOfWayRule MakeRightOfWay(const std::string& id,
+                              const std::vector<LaneSRange>& zones) {
+  return RightOfWayRule(RightOfWayRule::Id(id), LaneSRoute(zones),
+                        RightOfWayRule::Type::kStopThenGo);
+}
+
+template <class Rule>
+std::vector<std::string> IdsOf(const std::vector<Rule>& rules) {
+  std::vector<std::string> result;
+  for (const Rule& rule : rules) {
+    result.push_back(rule.id().string());
+  }
+  return result;
+}
+
+class SimpleRulebookTest : public ::testing::Test {
+ protected:
+  const LaneId kLaneA{"a"};
+  const LaneId kLaneB{"b"};
+  const SimpleRulebook dut_{
+      {MakeRightOfWay("row0", {LaneSRange(kLaneA, {0., 5.}),
+                               LaneSRange(kLaneB, {20., 30.})}),
+       MakeRightOfWay("row1", {LaneSRange(kLaneA, {40., 50.})})},
+      {MakeSpeedLimit("sl0", LaneSRange(kLaneA, {0., 10.})),
+       MakeSpeedLimit("sl1", LaneSRange(kLaneA, {20., 10.})),
+       MakeSpeedLimit("sl2", LaneSRange(kLaneB, {0., 100.}))}};
+};
+
+TEST_F(SimpleRulebookTest, FindRules) {
+  RoadRulebook::QueryResults results =
+      dut_.FindRules({LaneSRange(kLaneA, {8., 9.})});
+  EXPECT_EQ(IdsOf(results.right_of_way), std::vector<std::string>{});
+  EXPECT_EQ(IdsOf(results.speed_limit), std::vector<std::string>{"sl0"});
+
+  // The ranges are closed, and the order of s0 and s1 does not matter.
+  results = dut_.FindRules({LaneSRange(kLaneA, {10., 5.})});
+  EXPECT_EQ(IdsOf(results.right_of_way), std::vector<std::string>{"row0"});
+  EXPECT_EQ(IdsOf(results.speed_limit),
+            (std::vector<std::string>{"sl0", "sl1"}));
+
+  results = dut_.FindRules({LaneSRange(kLaneA, {31., 39.})});
+  EXPECT_TRUE(results.right_of_way.empty());
+  EXPECT_TRUE(results.speed_limit.empty());
+
+  results = dut_.FindRules({LaneSRange(LaneId("c"), {0., 100.})});
+  EXPECT_TRUE(results.right_of_way.empty());
+  EXPECT_TRUE(results.speed_limit.empty());
+
+  results = dut_.FindRules({});
+  EXPECT_TRUE(results.right_of_way.empty());
+  EXPECT_TRUE(results.speed_limit.empty());
+}
+
+TEST_F(SimpleRulebookTest, FindRulesReportsEachRuleOnce) {
+  // row0 has a zone on each lane, and sl2 overlaps both ranges on kLaneB.
+  const RoadRulebook::QueryResults results = dut_.FindRules(
+      {LaneSRange(kLaneB, {25., 26.}), LaneSRange(kLaneA, {0., 45.}),
+       LaneSRange(kLaneB, {50., 60.})});
+  EXPECT_EQ(IdsOf(results.right_of_way),
+            (std::vector<std::string>{"row0", "row1"}));
+  EXPECT_EQ(IdsOf(results.speed_limit),
+            (std::vector<std::string>{"sl0", "sl1", "sl2"}));
+}
+
+TEST_F(SimpleRulebookTest, GetRule) {
+  EXPECT_EQ(dut_.GetRule(RightOfWayRule::Id("row1")).id().string(), "row1");
+  EXPECT_THROW(dut_.GetRule(RightOfWayRule::Id("xxx")), std::out_of_range);
+  EXPECT_EQ(dut_.GetRule(SpeedLimitRule::Id("sl2")).zone().lane_id(), kLaneB);
+  EXPECT_THROW(dut_.GetRule(SpeedLimitRule::Id("row1")), std::out_of_range);
+}
+
+GTEST_TEST(SimpleRulebookConstructorTest, DuplicateId) {
+  const LaneSRange zone(LaneId("a"), {0., 1.});
+  EXPECT_THROW(SimpleRulebook({}, {MakeSpeedLimit("sl", zone),
+                                   MakeSpeedLimit("sl", zone)}),
+               std::logic_error);
+  EXPECT_THROW(SimpleRulebook({MakeRightOfWay("row", {zone}),
+                               MakeRightOfWay("row", {zone})}, {}),
+               std::logic_error);
+  // Rules of different types may share an Id.
+  EXPECT_NO_THROW(SimpleRulebook({MakeRightOfWay("x", {zone})},
+                                 {MakeSpeedLimit("x", zone)}));
+}
+
+// Compares FindRules() against a linear search over many random zones.
+GTEST_TEST(SimpleRulebookConstructorTest, MatchesLinearSearch) {
+  const LaneId lane("a");
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> s(0., 100.);
+  std::vector<SpeedLimitRule> rules;
+  for (int i = 0; i < 200; ++i) {
+    rules.push_back(MakeSpeedLimit("sl" + std::to_string(i),
+                                   LaneSRange(lane, {s(generator),
+                                                     s(generator)})));
+  }
+  const SimpleRulebook dut({}, rules);
+
+  for (int i = 0; i < 100; ++i) {
+    const SRange query(s(generator), s(generator));
+    const double query_min = std::min(query.s0(), query.s1());
+    const double query_max = std::max(query.s0(), query.s1());
+    std::vector<std::string> expected;
+    for (const SpeedLimitRule& rule : rules) {
+      const SRange& zone = rule.zone().s_range();
+      if (std::max(zone.s0(), zone.s1()) >= query_min &&
+          std::min(zone.s0(), zone.s1()) <= query_max) {
+        expected.push_back(rule.id().string());
+      }
+    }
+    EXPECT_EQ(IdsOf(dut.FindRules({LaneSRange(lane, query)}).speed_limit),
+              expected);
+  }
+}
+
+}  // namespace
+}  // namespace maliput
+}  // namespace drake
@@ -5,6 +5,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "drake/automotive/maliput/dragway/branch_point.h"
 #include "drake/automotive/maliput/dragway/road_geometry.h"
@@ -95,6 +96,16 @@ api::GeoPosition Lane::DoToGeoPosition(
   return {lane_pos.s(), lane_pos.r() + Lane::y_offset(), lane_pos.h()};
 }
 
+void Lane::DoToGeoPositions(
+    const std::vector<api::LanePosition>& lane_positions,
+    std::vector<api::GeoPosition>* geo_positions) const {
+  const double y_offset = Lane::y_offset();
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    const api::LanePosition& lane_pos = lane_positions[i];
+    (*geo_positions)[i] = {lane_pos.s(), lane_pos.r() + y_offset, lane_pos.h()};
+  }
+}
+
 api::GeoPositionT<AutoDiffXd> Lane::DoToGeoPositionAutoDiff(
     const api::LanePositionT<AutoDiffXd>& lane_pos) const {
   return {lane_pos.s(),
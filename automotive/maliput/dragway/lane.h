@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/automotive/maliput/api/branch_point.h"
 #include "drake/automotive/maliput/api/lane.h"
@@ -158,6 +159,10 @@ class Lane final : public api::Lane {
   api::GeoPosition DoToGeoPosition(const api::LanePosition& lane_pos) const
       final;
 
+  void DoToGeoPositions(const std::vector<api::LanePosition>& lane_positions,
+                        std::vector<api::GeoPosition>* geo_positions) const
+      final;
+
   api::GeoPositionT<AutoDiffXd> DoToGeoPositionAutoDiff(
       const api::LanePositionT<AutoDiffXd>& lane_pos) const final;
 
@@ -1,5 +1,6 @@
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -390,6 +391,24 @@ TEST_F(MaliputDragwayLaneTest, SingleLane) {
   VerifyBranches(lane_, road_geometry_.get());
 }
 
+// Tests that Lane::ToGeoPositions() agrees with Lane::ToGeoPosition().
+TEST_F(MaliputDragwayLaneTest, ToGeoPositions) {
+  const int kNumLanes = 2;
+  MakeDragway(kNumLanes);
+  const api::Lane* lane = segment_->lane(1);
+  const std::vector<api::LanePosition> lane_positions{
+      {0., 0., 0.}, {1., -1., 2.}, {length_, 1., 0.5}};
+  std::vector<api::GeoPosition> geo_positions;
+  lane->ToGeoPositions(lane_positions, &geo_positions);
+  ASSERT_EQ(geo_positions.size(), lane_positions.size());
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    EXPECT_TRUE(api::test::IsGeoPositionClose(
+        geo_positions[i], lane->ToGeoPosition(lane_positions[i]), 0.));
+  }
+  EXPECT_THROW(lane->ToGeoPositions(lane_positions, nullptr),
+               std::runtime_error);
+}
+
 /*
  Tests a dragway containing two lanes. The two lanes are arranged as shown below
  in the world frame:
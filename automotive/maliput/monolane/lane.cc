@@ -1,5 +1,7 @@
 #include "drake/automotive/maliput/monolane/lane.h"
 
+#include <limits>
+
 #include "drake/automotive/maliput/monolane/branch_point.h"
 #include "drake/common/drake_assert.h"
 
@@ -138,6 +140,31 @@ api::GeoPosition Lane::DoToGeoPosition(
 }
 
 
+void Lane::DoToGeoPositions(
+    const std::vector<api::LanePosition>& lane_positions,
+    std::vector<api::GeoPosition>* geo_positions) const {
+  // Batches of positions usually come in rows at a common s (e.g., across the
+  // width of the lane), so the reference curve point and its rotation are
+  // only recomputed when s changes.
+  double s = std::numeric_limits<double>::quiet_NaN();
+  V3 xyz_of_p;
+  Eigen::Matrix3d R;
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    const api::LanePosition& lane_pos = lane_positions[i];
+    if (lane_pos.s() != s) {
+      s = lane_pos.s();
+      const double p = p_from_s(s);
+      const V2 xy = xy_of_p(p);
+      xyz_of_p = V3(xy.x(), xy.y(), elevation().f_p(p) * p_scale_);
+      const Rot3 ypr = Rabg_of_p(p);
+      R = math::rpy2rotmat(V3(ypr.roll(), ypr.pitch(), ypr.yaw()));
+    }
+    const V3 xyz = R * V3(0., lane_pos.r(), lane_pos.h()) + xyz_of_p;
+    (*geo_positions)[i] = {xyz.x(), xyz.y(), xyz.z()};
+  }
+}
+
+
 api::Rotation Lane::DoGetOrientation(const api::LanePosition& lane_pos) const {
   // Recover linear parameter p from arc-length position s.
   const double p = p_from_s(lane_pos.s());
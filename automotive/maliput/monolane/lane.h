@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -250,6 +251,10 @@ class Lane : public api::Lane {
   api::GeoPosition DoToGeoPosition(
       const api::LanePosition& lane_pos) const override;
 
+  void DoToGeoPositions(const std::vector<api::LanePosition>& lane_positions,
+                        std::vector<api::GeoPosition>* geo_positions) const
+      override;
+
   api::Rotation DoGetOrientation(
       const api::LanePosition& lane_pos) const override;
 
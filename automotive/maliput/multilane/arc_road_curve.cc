@@ -120,18 +120,75 @@ Vector3<double> ArcRoadCurve::ToCurveFrame(
       (d_theta_nearest < 0.) ? d_theta_nearest + 2. * M_PI : d_theta_nearest;
   // Convert this angular displacement to arc length (s).
   const double p = d_theta_nearest_unwrapped / std::abs(d_theta_);
-  // Compute r (its direction depends on the direction of the +s-coordinate)
-  const double r_unsaturated = (d_theta_ >= 0.) ?
-                               radius_ - v.norm() : v.norm() - radius_;
-  // Saturate r within drivable bounds.
-  const double r = math::saturate(r_unsaturated, r_min, r_max);
-
-  // Calculate the (uniform) road elevation.
-  // N.B. h is the geo z-coordinate referenced against the lane elevation (whose
-  // `a` coefficient is normalized by lane length).
-  const double h_unsaturated = geo_coordinate.z() - elevation().a() * p_scale();
-  const double h = math::saturate(h_unsaturated, height_bounds.min(),
-                                  height_bounds.max());
+  if (elevation().b() == 0. && elevation().c() == 0. &&
+      elevation().d() == 0.) {
+    // The road is flat, so that the h unit vector is vertical and the above is
+    // exact.
+    // Compute r (its direction depends on the direction of the +s-coordinate)
+    const double r_unsaturated = (d_theta_ >= 0.) ?
+                                 radius_ - v.norm() : v.norm() - radius_;
+    // Saturate r within drivable bounds.
+    const double r = math::saturate(r_unsaturated, r_min, r_max);
+
+    // Calculate the (uniform) road elevation.
+    // N.B. h is the geo z-coordinate referenced against the lane elevation
+    // (whose `a` coefficient is normalized by lane length).
+    const double h_unsaturated =
+        geo_coordinate.z() - elevation().a() * p_scale();
+    const double h = math::saturate(h_unsaturated, height_bounds.min(),
+                                    height_bounds.max());
+    return Vector3<double>(p, r, h);
+  }
+  return RefineCurveFrame(geo_coordinate, p, r_min, r_max, height_bounds);
+}
+
+Vector3<double> ArcRoadCurve::RefineCurveFrame(
+    const Vector3<double>& geo_coordinate, double p_guess, double r_min,
+    double r_max, const api::HBounds& height_bounds) const {
+  // On an elevated arc the h unit vector leans along the curve, so `q` is off
+  // the vertical through the reference curve at its p. Newton's method finds
+  // the p at which `q` lies in the normal plane of the reference curve,
+  // starting from the flat road's p, which is off by the small angle that `q`
+  // leans along the curve.
+  const int kMaxIterations = 20;
+  const double kPTolerance = 1e-14;
+  double p = p_guess;
+  Vector3<double> curve_to_q;
+  Vector2<double> s_unit_vector;
+  double g{};
+  for (int i = 0; i < kMaxIterations; ++i) {
+    const double theta = theta_of_p(p);
+    const Vector2<double> radial(std::cos(theta), std::sin(theta));
+    s_unit_vector = std::copysign(1., d_theta_) *
+                    Vector2<double>(-radial.y(), radial.x());
+    const Vector2<double> xy = center_ + radius_ * radial;
+    curve_to_q = geo_coordinate - Vector3<double>(
+        xy.x(), xy.y(), elevation().f_p(p) * p_scale());
+    g = elevation().f_dot_p(p);
+    const double norm = std::sqrt(1. + g * g);
+    // The component of curve_to_q along the curve's tangent, and its
+    // derivative with respect to p (neglecting the change in slope).
+    const double residual =
+        (curve_to_q.head<2>().dot(s_unit_vector) + g * curve_to_q.z()) / norm;
+    const double d_residual =
+        -(p_scale() * norm +
+          std::abs(d_theta_) * curve_to_q.head<2>().dot(radial) / norm);
+    if (d_residual >= 0.) break;
+    const double p_next = math::saturate(p - residual / d_residual, 0., 1.);
+    const bool converged = std::abs(p_next - p) < kPTolerance;
+    p = p_next;
+    if (converged) break;
+  }
+  // Measures r and h from the reference curve at p, along the r and h unit
+  // vectors there.
+  const Vector3<double> r_unit_vector(-s_unit_vector.y(), s_unit_vector.x(),
+                                      0.);
+  const Vector3<double> h_unit_vector =
+      Vector3<double>(-g * s_unit_vector.x(), -g * s_unit_vector.y(), 1.) /
+      std::sqrt(1. + g * g);
+  const double r = math::saturate(curve_to_q.dot(r_unit_vector), r_min, r_max);
+  const double h = math::saturate(curve_to_q.dot(h_unit_vector),
+                                  height_bounds.min(), height_bounds.max());
   return Vector3<double>(p, r, h);
 }
 
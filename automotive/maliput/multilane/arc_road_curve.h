@@ -111,6 +111,12 @@ class ArcRoadCurve : public RoadCurve {
                const api::HBounds& height_bounds) const override;
 
  private:
+  // Completes ToCurveFrame() on a road with nonzero elevation slope, starting
+  // from @p p_guess, the p of @p geo_coordinate on the flat road.
+  Vector3<double> RefineCurveFrame(const Vector3<double>& geo_coordinate,
+                                   double p_guess, double r_min, double r_max,
+                                   const api::HBounds& height_bounds) const;
+
   // Computes the absolute position along reference arc as an angle in
   // range [theta0_, (theta0 + d_theta_)],
   // as a function of parameter @p p (in domain [0, 1]).
@@ -1,9 +1,11 @@
 #include "drake/automotive/maliput/multilane/lane.h"
 
 #include <cmath>
+#include <limits>
 
 #include "drake/automotive/maliput/multilane/branch_point.h"
 #include "drake/common/drake_assert.h"
+#include "drake/math/roll_pitch_yaw.h"
 
 namespace drake {
 namespace maliput {
@@ -48,6 +50,35 @@ api::GeoPosition Lane::DoToGeoPosition(
 }
 
 
+void Lane::DoToGeoPositions(
+    const std::vector<api::LanePosition>& lane_positions,
+    std::vector<api::GeoPosition>* geo_positions) const {
+  // Batches of positions usually come in rows at a common s (e.g., across the
+  // width of the lane), so the reference curve point and its rotation are
+  // only recomputed when s changes.
+  double s = std::numeric_limits<double>::quiet_NaN();
+  Vector3<double> xyz_of_p;
+  Matrix3<double> R;
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    const api::LanePosition& lane_pos = lane_positions[i];
+    if (lane_pos.s() != s) {
+      s = lane_pos.s();
+      const double p = road_curve_->p_from_s(s, r0_);
+      const Vector2<double> xy = road_curve_->xy_of_p(p);
+      xyz_of_p = Vector3<double>(
+          xy.x(), xy.y(),
+          road_curve_->elevation().f_p(p) * road_curve_->p_scale());
+      const Rot3 Rabg = road_curve_->Rabg_of_p(p);
+      R = math::rpy2rotmat(
+          Vector3<double>(Rabg.roll(), Rabg.pitch(), Rabg.yaw()));
+    }
+    const Vector3<double> xyz =
+        R * Vector3<double>(0., lane_pos.r() + r0_, lane_pos.h()) + xyz_of_p;
+    (*geo_positions)[i] = {xyz.x(), xyz.y(), xyz.z()};
+  }
+}
+
+
 api::Rotation Lane::DoGetOrientation(const api::LanePosition& lane_pos) const {
   const double p = road_curve_->p_from_s(lane_pos.s(), r0_);
   const Rot3 rotation =
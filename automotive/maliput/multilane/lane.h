@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/automotive/maliput/api/branch_point.h"
 #include "drake/automotive/maliput/api/lane.h"
@@ -138,6 +139,10 @@ class Lane : public api::Lane {
   api::GeoPosition DoToGeoPosition(
       const api::LanePosition& lane_pos) const override;
 
+  void DoToGeoPositions(const std::vector<api::LanePosition>& lane_positions,
+                        std::vector<api::GeoPosition>* geo_positions) const
+      override;
+
   api::Rotation DoGetOrientation(
       const api::LanePosition& lane_pos) const override;
 
@@ -33,22 +33,40 @@ Vector3<double> LineRoadCurve::ToCurveFrame(
     double r_min, double r_max,
     const api::HBounds& height_bounds) const {
   DRAKE_DEMAND(r_min <= r_max);
-  // TODO(jadecastro): Lift the zero superelevation and zero elevation gradient
-  // restriction.
+  // TODO(jadecastro): Lift the zero superelevation restriction.
   const Vector2<double> s_unit_vector = dp_ / dp_.norm();
-  const Vector2<double> r_unit_vector{-s_unit_vector(1), s_unit_vector(0)};
+  const Vector3<double> r_unit_vector{-s_unit_vector(1), s_unit_vector(0), 0.};
 
-  const Vector2<double> q(geo_coordinate.x(), geo_coordinate.y());
-  const Vector2<double> lane_origin_to_q = q - p0_;
-
-  // Compute the distance from `q` to the start of the lane.
-  const double p_unsaturated = lane_origin_to_q.dot(s_unit_vector) / p_scale();
+  // With at most linear elevation, the road surface is the plane through the
+  // start of the reference curve spanned by the s and r unit vectors, so that
+  // p follows in closed form from the projection of `q` onto the former. With
+  // higher order elevation, the plane through both ends of the reference
+  // curve is used instead.
+  const double slope = elevation().fake_gprime(0.);
+  const double slope_norm = std::sqrt(1. + slope * slope);
+  const Vector3<double> s_unit_vector_3d =
+      Vector3<double>(s_unit_vector(0), s_unit_vector(1), slope) / slope_norm;
+  const Vector3<double> lane_origin_to_q =
+      geo_coordinate - Vector3<double>(p0_.x(), p0_.y(),
+                                       elevation().a() * p_scale());
+  const double p_unsaturated =
+      lane_origin_to_q.dot(s_unit_vector_3d) / (p_scale() * slope_norm);
   const double p = math::saturate(p_unsaturated, 0., 1.);
-  const double r_unsaturated = lane_origin_to_q.dot(r_unit_vector);
+
+  // r and h are measured from the reference curve at p, along the r and h
+  // unit vectors there. N.B. the elevation's `a` coefficient is normalized by
+  // lane length.
+  const Vector2<double> xy = xy_of_p(p);
+  const Vector3<double> curve_to_q =
+      geo_coordinate - Vector3<double>(xy.x(), xy.y(),
+                                       elevation().f_p(p) * p_scale());
+  const double g = elevation().f_dot_p(p);
+  const Vector3<double> h_unit_vector =
+      Vector3<double>(-g * s_unit_vector(0), -g * s_unit_vector(1), 1.) /
+      std::sqrt(1. + g * g);
+  const double r_unsaturated = curve_to_q.dot(r_unit_vector);
   const double r = math::saturate(r_unsaturated, r_min, r_max);
-  // N.B. h is the geo z-coordinate referenced against the lane elevation (whose
-  // `a` coefficient is normalized by lane length).
-  const double h_unsaturated = geo_coordinate.z() - elevation().a() * p_scale();
+  const double h_unsaturated = curve_to_q.dot(h_unit_vector);
   const double h = math::saturate(h_unsaturated, height_bounds.min(),
                                   height_bounds.max());
   return Vector3<double>(p, r, h);
@@ -1,10 +1,22 @@
 #include "drake/automotive/maliput/multilane/loader.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "yaml-cpp/yaml.h"
 
@@ -236,6 +248,22 @@ const Connection* MaybeMakeConnection(
   }
 }
 
+// The Builder calls which a maliput_multilane_builder document resolves to,
+// along with the Builder which received them.
+struct BuilderCalls {
+  std::string id;
+  double lane_width{};
+  double elevation_min{};
+  double elevation_max{};
+  double linear_tolerance{};
+  double angular_tolerance{};
+  std::unique_ptr<Builder> builder;
+  // The Connections, in the order in which they were made.
+  std::vector<const Connection*> connections;
+  // The Groups, in the order in which they were made, with their Connections.
+  std::vector<std::pair<std::string, std::vector<const Connection*>>> groups;
+};
+
 // Parses a yaml `node` that represents a RoadGeometry.
 // `node` must be a map and contain a map node called
 // "maliput_multilane_builder". This last node must contain the complete
@@ -244,7 +272,7 @@ const Connection* MaybeMakeConnection(
 // "connections" node. "points" map node contains the description of reference
 // Endpoints and "connections" describes the Connections. If provided, "groups"
 // map node will contain sequences of Groups to join Connections.
-std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
+BuilderCalls ParseDocument(const YAML::Node& node) {
   DRAKE_DEMAND(node.IsMap());
   YAML::Node mmb = node["maliput_multilane_builder"];
   DRAKE_DEMAND(mmb.IsMap());
@@ -256,9 +284,18 @@ std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
   const double default_right_shoulder = mmb["right_shoulder"].as<double>();
   DRAKE_DEMAND(default_right_shoulder >= 0.);
 
-  Builder builder(lane_width, h_bounds(mmb["elevation_bounds"]),
-                  mmb["linear_tolerance"].as<double>(),
-                  deg_to_rad(mmb["angular_tolerance"].as<double>()));
+  BuilderCalls calls;
+  calls.id = mmb["id"].Scalar();
+  calls.lane_width = lane_width;
+  const api::HBounds elevation_bounds = h_bounds(mmb["elevation_bounds"]);
+  calls.elevation_min = elevation_bounds.min();
+  calls.elevation_max = elevation_bounds.max();
+  calls.linear_tolerance = mmb["linear_tolerance"].as<double>();
+  calls.angular_tolerance = deg_to_rad(mmb["angular_tolerance"].as<double>());
+  calls.builder = std::make_unique<Builder>(
+      calls.lane_width, elevation_bounds, calls.linear_tolerance,
+      calls.angular_tolerance);
+  Builder& builder = *calls.builder;
 
   drake::log()->debug("loading points !");
   YAML::Node points = mmb["points"];
@@ -304,6 +341,7 @@ std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
       }
       drake::log()->debug("...cooked '{}'", id);
       cooked_connections[id] = conn;
+      calls.connections.push_back(conn);
       // Adds reference curve start / end Endpoints as well as lanes start / end
       // Endpoints.
       xyz_catalog[endpoint_ref_curve_key(id, true)] = conn->start();
@@ -328,6 +366,7 @@ std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
       const std::string gid = g.first.as<std::string>();
       drake::log()->debug("   create group '{}'", gid);
       Group* group = builder.MakeGroup(gid);
+      calls.groups.emplace_back(gid, std::vector<const Connection*>());
 
       YAML::Node cids_node = g.second;
       DRAKE_DEMAND(cids_node.IsSequence());
@@ -335,13 +374,149 @@ std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
         const std::string cid = cid_node.as<std::string>();
         drake::log()->debug("      add cnx '{}'", cid);
         group->Add(cooked_connections[cid]);
+        calls.groups.back().second.push_back(cooked_connections[cid]);
       }
     }
   }
-  drake::log()->debug("building road geometry {}", mmb["id"].Scalar());
-  return builder.Build(api::RoadGeometryId{mmb["id"].Scalar()});
+  return calls;
+}
+
+// Parses a yaml `node` that represents a RoadGeometry, as ParseDocument()
+// does, and builds the RoadGeometry.
+std::unique_ptr<const api::RoadGeometry> BuildFrom(const YAML::Node& node) {
+  const BuilderCalls calls = ParseDocument(node);
+  drake::log()->debug("building road geometry {}", calls.id);
+  return calls.builder->Build(api::RoadGeometryId{calls.id});
+}
+
+// "DRKMLB01" when read as little-endian bytes.  The binary form is a cache
+// on the same machine, so it is written in native byte order.
+constexpr int64_t kBinaryMagic = 0x3130424c4d4b5244;
+
+// Appends the bytes of `value` to `output`.
+template <typename T>
+void WriteBinary(const T& value, std::string* output) {
+  output->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteBinary(const std::string& value, std::string* output) {
+  WriteBinary(static_cast<int64_t>(value.size()), output);
+  output->append(value);
+}
+
+void WriteBinary(const EndpointZ& value, std::string* output) {
+  WriteBinary(value.z(), output);
+  WriteBinary(value.z_dot(), output);
+  WriteBinary(value.theta(), output);
+  WriteBinary(value.theta_dot(), output);
+}
+
+void WriteBinary(const Endpoint& value, std::string* output) {
+  WriteBinary(value.xy().x(), output);
+  WriteBinary(value.xy().y(), output);
+  WriteBinary(value.xy().heading(), output);
+  WriteBinary(value.z(), output);
+}
+
+// Returns the binary form of `calls`.
+std::string ToBinary(const BuilderCalls& calls) {
+  std::string output;
+  WriteBinary(kBinaryMagic, &output);
+  WriteBinary(calls.id, &output);
+  WriteBinary(calls.lane_width, &output);
+  WriteBinary(calls.elevation_min, &output);
+  WriteBinary(calls.elevation_max, &output);
+  WriteBinary(calls.linear_tolerance, &output);
+  WriteBinary(calls.angular_tolerance, &output);
+
+  std::unordered_map<const Connection*, int64_t> connection_indices;
+  WriteBinary(static_cast<int64_t>(calls.connections.size()), &output);
+  for (const Connection* connection : calls.connections) {
+    connection_indices.emplace(connection, connection_indices.size());
+    WriteBinary(connection->id(), &output);
+    WriteBinary(static_cast<int32_t>(connection->type()), &output);
+    WriteBinary(static_cast<int32_t>(connection->num_lanes()), &output);
+    WriteBinary(connection->r0(), &output);
+    WriteBinary(connection->left_shoulder(), &output);
+    WriteBinary(connection->right_shoulder(), &output);
+    WriteBinary(connection->start(), &output);
+    if (connection->type() == Connection::kLine) {
+      WriteBinary(connection->line_length(), &output);
+    } else {
+      WriteBinary(connection->radius(), &output);
+      WriteBinary(connection->d_theta(), &output);
+    }
+    WriteBinary(connection->end().z(), &output);
+  }
+
+  WriteBinary(static_cast<int64_t>(calls.groups.size()), &output);
+  for (const auto& group : calls.groups) {
+    WriteBinary(group.first, &output);
+    WriteBinary(static_cast<int64_t>(group.second.size()), &output);
+    for (const Connection* connection : group.second) {
+      const auto it = connection_indices.find(connection);
+      DRAKE_DEMAND(it != connection_indices.end());
+      WriteBinary(it->second, &output);
+    }
+  }
+  return output;
 }
 
+// Reads values from the binary form, throwing if it is truncated.
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, size_t size)
+      : next_(data), end_(data + size) {}
+
+  template <typename T>
+  T Read() {
+    Require(sizeof(T));
+    T value;
+    std::memcpy(&value, next_, sizeof(T));
+    next_ += sizeof(T);
+    return value;
+  }
+
+  std::string ReadString() {
+    const int64_t size = Read<int64_t>();
+    if (size < 0) Fail();
+    Require(size);
+    const std::string value(next_, size);
+    next_ += size;
+    return value;
+  }
+
+  EndpointZ ReadEndpointZ() {
+    const double z = Read<double>();
+    const double z_dot = Read<double>();
+    const double theta = Read<double>();
+    const double theta_dot = Read<double>();
+    return EndpointZ(z, z_dot, theta, theta_dot);
+  }
+
+  Endpoint ReadEndpoint() {
+    const double x = Read<double>();
+    const double y = Read<double>();
+    const double heading = Read<double>();
+    return Endpoint(EndpointXy(x, y, heading), ReadEndpointZ());
+  }
+
+  bool at_end() const { return next_ == end_; }
+
+  [[noreturn]] static void Fail() {
+    throw std::runtime_error(
+        "multilane::LoadBinary(): truncated or corrupt binary road network.");
+  }
+
+ private:
+  void Require(uint64_t size) const {
+    if (size > static_cast<uint64_t>(end_ - next_)) Fail();
+  }
+
+  const char* next_{};
+  const char* end_{};
+};
+
 }  // namespace
 
 
@@ -354,6 +529,121 @@ std::unique_ptr<const api::RoadGeometry> LoadFile(const std::string& filename) {
   return BuildFrom(YAML::LoadFile(filename));
 }
 
+
+std::string ConvertToBinary(const std::string& input) {
+  return ToBinary(ParseDocument(YAML::Load(input)));
+}
+
+
+void ConvertFileToBinaryFile(const std::string& yaml_filename,
+                             const std::string& binary_filename) {
+  const std::string binary =
+      ToBinary(ParseDocument(YAML::LoadFile(yaml_filename)));
+  std::ofstream os(binary_filename, std::ios::binary);
+  os.write(binary.data(), binary.size());
+  os.close();
+  if (!os) {
+    throw std::runtime_error(
+        "multilane::ConvertFileToBinaryFile(): failed to write " +
+        binary_filename);
+  }
+}
+
+
+std::unique_ptr<const api::RoadGeometry> LoadBinary(const char* data,
+                                                    size_t size) {
+  BinaryReader reader(data, size);
+  if (reader.Read<int64_t>() != kBinaryMagic) {
+    throw std::runtime_error(
+        "multilane::LoadBinary(): not a binary road network, or one written "
+        "by an incompatible version.");
+  }
+  const std::string id = reader.ReadString();
+  const double lane_width = reader.Read<double>();
+  const double elevation_min = reader.Read<double>();
+  const double elevation_max = reader.Read<double>();
+  const double linear_tolerance = reader.Read<double>();
+  const double angular_tolerance = reader.Read<double>();
+  Builder builder(lane_width, api::HBounds(elevation_min, elevation_max),
+                  linear_tolerance, angular_tolerance);
+
+  const int64_t num_connections = reader.Read<int64_t>();
+  if (num_connections < 0) BinaryReader::Fail();
+  std::vector<const Connection*> connections;
+  for (int64_t i = 0; i < num_connections; ++i) {
+    const std::string cid = reader.ReadString();
+    const int32_t type = reader.Read<int32_t>();
+    const int32_t num_lanes = reader.Read<int32_t>();
+    const double r0 = reader.Read<double>();
+    const double left_shoulder = reader.Read<double>();
+    const double right_shoulder = reader.Read<double>();
+    const Endpoint start = reader.ReadEndpoint();
+    if (type == Connection::kLine) {
+      const double length = reader.Read<double>();
+      const EndpointZ end_z = reader.ReadEndpointZ();
+      connections.push_back(builder.Connect(cid, num_lanes, r0, left_shoulder,
+                                            right_shoulder, start, length,
+                                            end_z));
+    } else if (type == Connection::kArc) {
+      const double radius = reader.Read<double>();
+      const double d_theta = reader.Read<double>();
+      const EndpointZ end_z = reader.ReadEndpointZ();
+      connections.push_back(builder.Connect(
+          cid, num_lanes, r0, left_shoulder, right_shoulder, start,
+          ArcOffset(radius, d_theta), end_z));
+    } else {
+      BinaryReader::Fail();
+    }
+  }
+
+  const int64_t num_groups = reader.Read<int64_t>();
+  if (num_groups < 0) BinaryReader::Fail();
+  for (int64_t i = 0; i < num_groups; ++i) {
+    Group* group = builder.MakeGroup(reader.ReadString());
+    const int64_t num_group_connections = reader.Read<int64_t>();
+    if (num_group_connections < 0) BinaryReader::Fail();
+    for (int64_t j = 0; j < num_group_connections; ++j) {
+      const int64_t index = reader.Read<int64_t>();
+      if (index < 0 || index >= num_connections) BinaryReader::Fail();
+      group->Add(connections[index]);
+    }
+  }
+  if (!reader.at_end()) BinaryReader::Fail();
+
+  drake::log()->debug("building road geometry {}", id);
+  return builder.Build(api::RoadGeometryId{id});
+}
+
+
+std::unique_ptr<const api::RoadGeometry> LoadBinaryFile(
+    const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(
+        "multilane::LoadBinaryFile(): failed to open " + filename);
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error(
+        "multilane::LoadBinaryFile(): failed to open " + filename);
+  }
+  const size_t size = status.st_size;
+  void* mapping = nullptr;
+  if (size > 0) {
+    mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error(
+        "multilane::LoadBinaryFile(): failed to map " + filename);
+  }
+  // Unmaps the file however LoadBinary() returns.
+  const std::unique_ptr<void, std::function<void(void*)>> unmapper(
+      mapping, [size](void* address) { ::munmap(address, size); });
+  return LoadBinary(static_cast<const char*>(mapping), size);
+}
+
 }  // namespace multilane
 }  // namespace maliput
 }  // namespace drake
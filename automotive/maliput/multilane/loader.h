@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -41,6 +42,45 @@ std::unique_ptr<const api::RoadGeometry> Load(const std::string& input);
 /// Loads the named file as a maliput_multilane_builder document.
 std::unique_ptr<const api::RoadGeometry> LoadFile(const std::string& filename);
 
+/// @name Binary road networks
+///
+/// A maliput_multilane_builder document can be converted to a compact binary
+/// form, which records the Builder calls that the document resolves to:  the
+/// Builder parameters, then every Connection with its start Endpoint already
+/// resolved, then the Groups.  Loading the binary form replays those calls,
+/// skipping the YAML parsing and the iterative resolution of Endpoint
+/// references, which dominate the loading time of large documents.
+///
+/// The binary form is a cache of the document, written in the native byte
+/// order; it is not meant to be portable across machines.  Loading it
+/// throws std::runtime_error if it is truncated, or if it was written by an
+/// incompatible version of this format.
+//@{
+
+/// Converts the maliput_multilane_builder document @p input to the binary
+/// form, which is returned.
+std::string ConvertToBinary(const std::string& input);
+
+/// Converts the maliput_multilane_builder document in the file named
+/// @p yaml_filename to the binary form, which is written to the file named
+/// @p binary_filename.
+/// @throws std::runtime_error if @p binary_filename cannot be written.
+void ConvertFileToBinaryFile(const std::string& yaml_filename,
+                             const std::string& binary_filename);
+
+/// Loads the binary form of a maliput_multilane_builder document from the
+/// @p size bytes at @p data.
+std::unique_ptr<const api::RoadGeometry> LoadBinary(const char* data,
+                                                    size_t size);
+
+/// Loads the named file, which holds the binary form of a
+/// maliput_multilane_builder document.  The file is mapped into memory
+/// rather than read.
+std::unique_ptr<const api::RoadGeometry> LoadBinaryFile(
+    const std::string& filename);
+
+//@}
+
 }  // namespace multilane
 }  // namespace maliput
 }  // namespace drake
@@ -102,6 +102,17 @@ class RoadCurve {
   /// Computes the parametric position p along the reference curve corresponding
   /// to longitudinal position (in path-length) `s` along a parallel curve
   /// laterally offset by `r` from the reference curve.
+  ///
+  /// This and s_from_p() are evaluated for every Lane query (e.g., in
+  /// MaliputRailcar's derivatives), so implementations must compute them in
+  /// constant time. LineRoadCurve and ArcRoadCurve do so in closed form, as
+  /// their path length is linear in p.
+  // TODO(maddog-tri)  Once the path length accounts for the elevation
+  //                   profile exactly (see CubicPolynomial::s_p()), it will
+  //                   need numerical integration; then p_from_s() and
+  //                   s_from_p() should look up a table of s(p), built once
+  //                   per (curve, r) to within the road's linear tolerance,
+  //                   rather than integrate on each call.
   /// @return The parametric position p along an offset of the reference curve.
   virtual double p_from_s(double s, double r) const = 0;
 
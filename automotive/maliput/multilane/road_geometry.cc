@@ -136,25 +136,26 @@ api::RoadPosition RoadGeometry::DoToRoadPosition(
     }
 
   } else {
-    // No `hint` supplied.  Search exhaustively through all of the lanes to find
-    // the position associated with the first found containing lane or the
-    // distance-minimizing position.
-    DRAKE_DEMAND(num_junctions() > 0);
-    DRAKE_DEMAND(junction(0)->num_segments() > 0);
-    DRAKE_DEMAND(junction(0)->segment(0)->num_lanes() > 0);
-    const api::Lane* lane = this->junction(0)->segment(0)->lane(0);
-    road_position = {lane, lane->ToLanePosition(geo_position, nearest_position,
-                                                &min_distance)};
-    for (int i = 0; i < num_junctions(); ++i) {
-      const api::Junction* junction = this->junction(i);
-      for (int j = 0; j < junction->num_segments(); ++j) {
-        const api::Segment* segment = junction->segment(j);
-        for (int k = 0; k < segment->num_lanes(); ++k) {
-          GetPositionIfSmallerDistance(geo_position, linear_tolerance_,
-                                       segment->lane(k), &road_position,
-                                       &min_distance, nearest_position);
-        }
-      }
+    // No `hint` supplied.  Use the bounding volume hierarchy to find the
+    // distance to the nearest lane, then visit the lanes which may be about as
+    // near in RoadGeometry order, as an exhaustive search through all of the
+    // lanes would.
+    const api::LaneBoundingVolumeHierarchy& bvh =
+        lane_bounding_volume_hierarchy();
+    double nearest_distance{};
+    const api::Lane* nearest_lane =
+        bvh.FindNearestLane(geo_position, &nearest_distance);
+    DRAKE_DEMAND(nearest_lane != nullptr);
+    const std::vector<const api::Lane*> lanes = bvh.FindLanesWithin(
+        geo_position, nearest_distance + linear_tolerance_);
+    DRAKE_DEMAND(!lanes.empty());
+    road_position = {lanes[0], lanes[0]->ToLanePosition(
+                                   geo_position, nearest_position,
+                                   &min_distance)};
+    for (const api::Lane* lane : lanes) {
+      GetPositionIfSmallerDistance(geo_position, linear_tolerance_,
+                                   lane, &road_position, &min_distance,
+                                   nearest_position);
     }
   }
 
@@ -199,6 +199,27 @@ TEST_F(MultilaneArcRoadCurveTest, ToCurveFrameTest) {
       kVeryExact));
 }
 
+// Checks that ToCurveFrame() inverts W_of_prh() on a linearly elevated arc,
+// whose h unit vector is no longer vertical.
+TEST_F(MultilaneArcRoadCurveTest, ElevatedToCurveFrameTest) {
+  const double slope = 5. / (kRadius * kDTheta);
+  const CubicPolynomial linear_elevation(0.1, slope, 0., 0.);
+  for (double d_theta : {kDTheta, -kDTheta}) {
+    const ArcRoadCurve dut(kCenter, kRadius, kTheta0, d_theta,
+                           linear_elevation, zp);
+    for (double p : {0.1, 0.5, 0.9}) {
+      for (double r : {-2., 0., 2.}) {
+        for (double h : {0., 2.5}) {
+          EXPECT_TRUE(CompareMatrices(
+              dut.ToCurveFrame(dut.W_of_prh(p, r, h), kRMin, kRMax,
+                               height_bounds),
+              Vector3<double>(p, r, h), kVeryExact));
+        }
+      }
+    }
+  }
+}
+
 // Checks that p_scale(), p_from_s() and s_from_p() with constant superelevation
 // polynomial and up to linear elevation polynomial behave properly.
 TEST_F(MultilaneArcRoadCurveTest, OffsetTest) {
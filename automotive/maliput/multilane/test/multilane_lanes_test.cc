@@ -633,6 +633,18 @@ GTEST_TEST(MultilaneLanesTest, ArcLaneWithConstantSuperelevation) {
                        10. * std::sin(kTheta)),
       kLinearTolerance));
 
+  // ToGeoPositions() agrees with ToGeoPosition(), including when consecutive
+  // positions share s.
+  const std::vector<api::LanePosition> lane_positions{
+      {0., 0., 0.}, {0., 10., 0.}, {1., -3., 2.}, {1., 3., 2.}, {0., 4., 1.}};
+  std::vector<api::GeoPosition> geo_positions;
+  l2->ToGeoPositions(lane_positions, &geo_positions);
+  ASSERT_EQ(geo_positions.size(), lane_positions.size());
+  for (size_t i = 0; i < lane_positions.size(); ++i) {
+    EXPECT_TRUE(api::test::IsGeoPositionClose(
+        geo_positions[i], l2->ToGeoPosition(lane_positions[i]), kVeryExact));
+  }
+
   // TODO(maddog@tri.global) Test ToLanePosition().
 
   EXPECT_TRUE(api::test::IsRotationClose(
@@ -94,6 +94,24 @@ TEST_F(MultilaneLineRoadCurveTest, ToCurveFrameTest) {
       Vector3<double>(0.05, -0.707106781186547, 7.0), kVeryExact));
 }
 
+// Checks that ToCurveFrame() inverts W_of_prh() on a linearly elevated line,
+// whose h unit vector is no longer vertical.
+TEST_F(MultilaneLineRoadCurveTest, ElevatedToCurveFrameTest) {
+  const double slope = 10. / kDirection.norm();
+  const CubicPolynomial linear_elevation(1., slope, 0., 0.);
+  const LineRoadCurve dut(kOrigin, kDirection, linear_elevation, zp);
+  for (double p : {0., 0.1, 0.5, 0.9, 1.}) {
+    for (double r : {-5., 0., 5.}) {
+      for (double h : {0., 2.5}) {
+        EXPECT_TRUE(CompareMatrices(
+            dut.ToCurveFrame(dut.W_of_prh(p, r, h), kRMin, kRMax,
+                             elevation_bounds),
+            Vector3<double>(p, r, h), kVeryExact));
+      }
+    }
+  }
+}
+
 // Checks that p_scale(), p_from_s() and s_from_p() with constant superelevation
 // polynomial and up to linear elevation polynomial behave properly.
 TEST_F(MultilaneLineRoadCurveTest, OffsetTest) {
@@ -3,7 +3,10 @@
 /* clang-format on */
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 
@@ -16,6 +19,7 @@
 #include "drake/automotive/maliput/api/segment.h"
 #include "drake/automotive/maliput/api/test_utilities/maliput_types_compare.h"
 #include "drake/automotive/maliput/multilane/lane.h"
+#include "drake/common/temp_directory.h"
 
 namespace drake {
 namespace maliput {
@@ -460,6 +464,142 @@ TEST_F(MultilaneLoaderMultipleSegmentCircuitTest, LaneElevationPolynomials) {
   EXPECT_NEAR(complex_arc_dut->elevation().d(), 0.636619772367581, kVeryExact);
 }
 
+// Checks that the binary form of a document loads to the same RoadGeometry
+// as the document itself.
+TEST_F(MultilaneLoaderMultipleSegmentCircuitTest, BinaryRoundTrip) {
+  const double kVeryExact{1e-12};
+  std::unique_ptr<const api::RoadGeometry> expected =
+      Load(std::string(kMultilaneYaml));
+  const std::string binary = ConvertToBinary(kMultilaneYaml);
+  std::unique_ptr<const api::RoadGeometry> rg =
+      LoadBinary(binary.data(), binary.size());
+  ASSERT_NE(rg, nullptr);
+  EXPECT_EQ(rg->id(), expected->id());
+  EXPECT_EQ(rg->linear_tolerance(), expected->linear_tolerance());
+  EXPECT_EQ(rg->angular_tolerance(), expected->angular_tolerance());
+  EXPECT_EQ(rg->num_branch_points(), expected->num_branch_points());
+  ASSERT_EQ(rg->num_junctions(), expected->num_junctions());
+  for (int i = 0; i < rg->num_junctions(); ++i) {
+    const api::Segment* segment = rg->junction(i)->segment(0);
+    const api::Segment* expected_segment = expected->junction(i)->segment(0);
+    EXPECT_EQ(segment->id(), expected_segment->id());
+    ASSERT_EQ(segment->num_lanes(), expected_segment->num_lanes());
+    for (int j = 0; j < segment->num_lanes(); ++j) {
+      const api::Lane* lane = segment->lane(j);
+      const api::Lane* expected_lane = expected_segment->lane(j);
+      EXPECT_EQ(lane->id(), expected_lane->id());
+      EXPECT_NEAR(lane->length(), expected_lane->length(), kVeryExact);
+      EXPECT_TRUE(api::test::IsGeoPositionClose(
+          lane->ToGeoPosition({0., 0., 0.}),
+          expected_lane->ToGeoPosition({0., 0., 0.}), kVeryExact));
+      EXPECT_TRUE(api::test::IsGeoPositionClose(
+          lane->ToGeoPosition({lane->length(), 0., 0.}),
+          expected_lane->ToGeoPosition({expected_lane->length(), 0., 0.}),
+          kVeryExact));
+      const api::BranchPoint* bp = lane->GetBranchPoint(api::LaneEnd::kFinish);
+      const api::BranchPoint* expected_bp =
+          expected_lane->GetBranchPoint(api::LaneEnd::kFinish);
+      EXPECT_EQ(bp->id(), expected_bp->id());
+      EXPECT_EQ(bp->GetBSide()->size(), expected_bp->GetBSide()->size());
+    }
+  }
+}
+
+// Checks that groups survive the binary form, and that the binary form can be
+// written to and loaded from a file.
+GTEST_TEST(MultilaneLoaderTest, BinaryFile) {
+  const char* kMultilaneYaml = R"R(maliput_multilane_builder:
+  id: "grouped"
+  lane_width: 4
+  left_shoulder: 1
+  right_shoulder: 1
+  elevation_bounds: [0, 5]
+  linear_tolerance: 0.01
+  angular_tolerance: 0.5
+  points:
+    a:
+      xypoint: [0, 0, 0]
+      zpoint: [0, 0, 0, 0]
+    b:
+      xypoint: [0, 10, 0]
+      zpoint: [0, 0, 0, 0]
+  connections:
+    c0:
+      lanes: [2, 0, 0]
+      start: ["ref", "points.a.forward"]
+      length: 20
+      z_end: ["ref", [0, 0, 0, 0]]
+    c1:
+      lanes: [1, 0, 0]
+      start: ["ref", "points.b.forward"]
+      arc: [10, 90]
+      z_end: ["ref", [2, 0, 0, 0]]
+  groups:
+    g: [c0, c1]
+)R";
+  const std::string dir = temp_directory();
+  const std::string yaml_filename = dir + "/multilane_loader_test.yaml";
+  const std::string binary_filename = dir + "/multilane_loader_test.bin";
+  {
+    std::ofstream os(yaml_filename);
+    os << kMultilaneYaml;
+  }
+  ConvertFileToBinaryFile(yaml_filename, binary_filename);
+  std::unique_ptr<const api::RoadGeometry> rg = LoadBinaryFile(binary_filename);
+  ASSERT_NE(rg, nullptr);
+  EXPECT_EQ(rg->id().string(), "grouped");
+  ASSERT_EQ(rg->num_junctions(), 1);
+  EXPECT_EQ(rg->junction(0)->id().string(), "j:g");
+  EXPECT_EQ(rg->junction(0)->num_segments(), 2);
+  EXPECT_EQ(rg->junction(0)->segment(0)->num_lanes(), 2);
+  EXPECT_EQ(rg->junction(0)->segment(1)->num_lanes(), 1);
+  EXPECT_EQ(ConvertToBinary(kMultilaneYaml),
+            ConvertToBinary(kMultilaneYaml));
+  std::remove(yaml_filename.c_str());
+  std::remove(binary_filename.c_str());
+}
+
+// Checks that malformed binary forms are rejected.
+GTEST_TEST(MultilaneLoaderTest, BinaryRejectsMalformedInput) {
+  const char* kMultilaneYaml = R"R(maliput_multilane_builder:
+  id: "single"
+  lane_width: 4
+  left_shoulder: 1
+  right_shoulder: 1
+  elevation_bounds: [0, 5]
+  linear_tolerance: 0.01
+  angular_tolerance: 0.5
+  points:
+    a:
+      xypoint: [0, 0, 0]
+      zpoint: [0, 0, 0, 0]
+  connections:
+    c0:
+      lanes: [1, 0, 0]
+      start: ["ref", "points.a.forward"]
+      length: 20
+      z_end: ["ref", [0, 0, 0, 0]]
+  groups: {}
+)R";
+  const std::string binary = ConvertToBinary(kMultilaneYaml);
+  EXPECT_NE(LoadBinary(binary.data(), binary.size()), nullptr);
+  // Truncated.
+  EXPECT_THROW(LoadBinary(binary.data(), binary.size() - 1),
+               std::runtime_error);
+  EXPECT_THROW(LoadBinary(binary.data(), 0), std::runtime_error);
+  // Trailing bytes.
+  const std::string padded = binary + '\0';
+  EXPECT_THROW(LoadBinary(padded.data(), padded.size()), std::runtime_error);
+  // Wrong magic.
+  std::string corrupt = binary;
+  corrupt[0] ^= 0xff;
+  EXPECT_THROW(LoadBinary(corrupt.data(), corrupt.size()),
+               std::runtime_error);
+  // Missing file.
+  EXPECT_THROW(LoadBinaryFile(temp_directory() + "/no_such_road.bin"),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace multilane
 }  // namespace maliput
@@ -2,7 +2,9 @@
 #include "drake/automotive/maliput/multilane/road_geometry.h"
 /* clang-format on */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <tuple>
 #include <utility>
@@ -399,6 +401,78 @@ GTEST_TEST(MultilaneLanesTest, MultipleLineLaneSegmentWithoutHint) {
   }
 }
 
+// Tests FindRoadPositions() and the hint-less ToRoadPosition() against
+// exhaustive searches through all of the lanes, on a road with curves and
+// overlapping branches.
+GTEST_TEST(MultilaneLanesTest, FindRoadPositions) {
+  std::unique_ptr<multilane::Builder> rb(new multilane::Builder(
+      2. * kWidth, HBounds(0., kHeight), 0.01, /* linear tolerance */
+      0.01 * M_PI /* angular tolerance */));
+  const multilane::EndpointZ kFlatZ{0., 0., 0., 0.};
+  const multilane::Endpoint kRoadOrigin{{0., 0., 0.}, kFlatZ};
+  const double kArcRadius{50.};
+  const double kLength{50.};
+  const double kTwoLanes{2};
+  const double kZeroR0{0.};
+  const double kShoulder{1.};
+  const auto& lane0 =
+      rb->Connect("lane0", kTwoLanes, kZeroR0, kShoulder, kShoulder,
+                  kRoadOrigin, ArcOffset(kArcRadius, -M_PI / 2.), kFlatZ);
+  const auto& lane1 = rb->Connect("lane1", kTwoLanes, kZeroR0, kShoulder,
+                                  kShoulder, lane0->end(), kLength, kFlatZ);
+  rb->Connect("lane2a", kTwoLanes, kZeroR0, kShoulder, kShoulder,
+              lane1->end(), kLength, kFlatZ);
+  rb->Connect("lane2b", kTwoLanes, kZeroR0, kShoulder, kShoulder,
+              lane1->end(), ArcOffset(kArcRadius, M_PI / 2.), kFlatZ);
+  std::unique_ptr<const api::RoadGeometry> rg =
+      rb->Build(api::RoadGeometryId{"find_road_positions"});
+  EXPECT_EQ(rg->lane_bounding_volume_hierarchy().num_lanes(), 8);
+
+  const double kRadius{3.};
+  for (double x = -10.; x <= 110.; x += 7.5) {
+    for (double y = -160.; y <= 10.; y += 7.5) {
+      const api::GeoPosition geo_pos(x, y, 0.5 * (x + y) / 100.);
+
+      // Finds the distances to all of the lanes.
+      std::map<const api::Lane*, double> distances;
+      double min_distance = std::numeric_limits<double>::infinity();
+      for (int i = 0; i < rg->num_junctions(); ++i) {
+        const api::Junction* junction = rg->junction(i);
+        for (int j = 0; j < junction->num_segments(); ++j) {
+          const api::Segment* segment = junction->segment(j);
+          for (int k = 0; k < segment->num_lanes(); ++k) {
+            double distance{};
+            segment->lane(k)->ToLanePosition(geo_pos, nullptr, &distance);
+            distances[segment->lane(k)] = distance;
+            min_distance = std::min(min_distance, distance);
+          }
+        }
+      }
+
+      double distance{};
+      rg->ToRoadPosition(geo_pos, nullptr, nullptr, &distance);
+      EXPECT_NEAR(distance, min_distance, kVeryExact);
+
+      const std::vector<api::RoadPositionResult> results =
+          rg->FindRoadPositions(geo_pos, kRadius);
+      int num_expected{};
+      for (const auto& lane_distance : distances) {
+        if (lane_distance.second <= kRadius) ++num_expected;
+      }
+      ASSERT_EQ(static_cast<int>(results.size()), num_expected);
+      for (size_t i = 0; i < results.size(); ++i) {
+        const api::RoadPositionResult& result = results[i];
+        EXPECT_EQ(result.distance, distances.at(result.road_position.lane));
+        EXPECT_TRUE(api::test::IsGeoPositionClose(
+            result.nearest_position,
+            result.road_position.lane->ToGeoPosition(result.road_position.pos),
+            kVeryExact));
+        if (i > 0) EXPECT_LE(results[i - 1].distance, result.distance);
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace multilane
 }  // namespace maliput
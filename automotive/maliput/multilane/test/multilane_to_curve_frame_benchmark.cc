@@ -0,0 +1,160 @@
+// Measures the cost of RoadCurve::ToCurveFrame(), which does the bulk of the
+// work of Lane::ToLanePosition(), on flat and linearly elevated lines and arcs.
+// Run with --help for options.
+//
+// As a baseline, each curve is also projected onto by a generic bisection on
+// the p at which the query point lies in the normal plane of the reference
+// curve, which needs nothing but RoadCurve::W_of_prh(). The largest difference
+// in p between both is reported as well.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/multilane/arc_road_curve.h"
+#include "drake/automotive/maliput/multilane/line_road_curve.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/text_logging_gflags.h"
+
+DEFINE_int32(points, 1000, "Number of query points per curve.");
+DEFINE_int32(iterations, 100, "Number of timed passes over the query points.");
+
+namespace drake {
+namespace maliput {
+namespace multilane {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+const double kRMin{-5.};
+const double kRMax{5.};
+const api::HBounds kHBounds{0., 5.};
+
+// Finds the p of @p q by bisection over [0, 1], assuming that q projects onto
+// the interior of @p curve.
+double ReferenceP(const RoadCurve& curve, const Vector3<double>& q) {
+  const double kDp{1e-7};
+  auto residual = [&curve, &q](double p) {
+    const Vector3<double> tangent =
+        curve.W_of_prh(std::min(p + kDp, 1.), 0., 0.) -
+        curve.W_of_prh(std::max(p - kDp, 0.), 0., 0.);
+    return (q - curve.W_of_prh(p, 0., 0.)).dot(tangent);
+  };
+  double p_min{0.};
+  double p_max{1.};
+  for (int i = 0; i < 50; ++i) {
+    const double p = 0.5 * (p_min + p_max);
+    if (residual(p) > 0.) {
+      p_min = p;
+    } else {
+      p_max = p;
+    }
+  }
+  return 0.5 * (p_min + p_max);
+}
+
+void RunBenchmark(const std::string& name, const RoadCurve& curve,
+                  int num_points, int iterations) {
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> p_distribution(0.05, 0.95);
+  std::uniform_real_distribution<double> r_distribution(0.5 * kRMin,
+                                                        0.5 * kRMax);
+  std::uniform_real_distribution<double> h_distribution(kHBounds.min(),
+                                                        kHBounds.max());
+  std::vector<Vector3<double>> points;
+  for (int i = 0; i < num_points; ++i) {
+    points.push_back(curve.W_of_prh(p_distribution(generator),
+                                    r_distribution(generator),
+                                    h_distribution(generator)));
+  }
+
+  double sum{0.};
+  const Clock::time_point start = Clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    for (const Vector3<double>& q : points) {
+      sum += curve.ToCurveFrame(q, kRMin, kRMax, kHBounds).x();
+    }
+  }
+  const double seconds = SecondsSince(start);
+
+  double reference_sum{0.};
+  const Clock::time_point reference_start = Clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    for (const Vector3<double>& q : points) {
+      reference_sum += ReferenceP(curve, q);
+    }
+  }
+  const double reference_seconds = SecondsSince(reference_start);
+
+  double max_error{0.};
+  for (const Vector3<double>& q : points) {
+    max_error = std::max(
+        max_error, std::abs(curve.ToCurveFrame(q, kRMin, kRMax, kHBounds).x() -
+                            ReferenceP(curve, q)));
+  }
+
+  const int queries = num_points * iterations;
+  std::cout << name << "\n";
+  std::cout << "  ToCurveFrame:         " << seconds / queries * 1e9
+            << " ns per query\n";
+  std::cout << "  bisection reference:  " << reference_seconds / queries * 1e9
+            << " ns per query\n";
+  std::cout << "  max |p - p_ref|:      " << max_error << "\n";
+  // Keeps the timed loops from being optimized away.
+  std::cout << "  (checksum " << sum - reference_sum << ")\n";
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_points >= 1);
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+  const CubicPolynomial flat;
+  const Vector2<double> origin(0., 0.);
+  const Vector2<double> direction(100., 50.);
+  const double line_length = direction.norm();
+  const CubicPolynomial line_slope(0., 10. / line_length, 0., 0.);
+  const Vector2<double> center(0., 0.);
+  const double radius{50.};
+  const double d_theta{M_PI / 2.};
+  const double arc_length = radius * d_theta;
+  const CubicPolynomial arc_slope(0., 10. / arc_length, 0., 0.);
+
+  RunBenchmark("Flat line", LineRoadCurve(origin, direction, flat, flat),
+               FLAGS_points, FLAGS_iterations);
+  RunBenchmark("Sloped line",
+               LineRoadCurve(origin, direction, line_slope, flat),
+               FLAGS_points, FLAGS_iterations);
+  RunBenchmark("Flat arc",
+               ArcRoadCurve(center, radius, 0., d_theta, flat, flat),
+               FLAGS_points, FLAGS_iterations);
+  RunBenchmark("Sloped arc",
+               ArcRoadCurve(center, radius, 0., d_theta, arc_slope, flat),
+               FLAGS_points, FLAGS_iterations);
+  return 0;
+}
+
+}  // namespace
+}  // namespace multilane
+}  // namespace maliput
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Benchmarks the projection of points onto flat and sloped multilane "
+      "road curves against a generic bisection.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::maliput::multilane::do_main();
+}
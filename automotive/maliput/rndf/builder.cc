@@ -1,8 +1,10 @@
 #include "drake/automotive/maliput/rndf/builder.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "ignition/rndf/UniqueId.hh"
@@ -15,6 +17,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 
 namespace drake {
@@ -36,6 +39,7 @@ using std::string;
 using std::to_string;
 using std::tuple;
 using std::unique_ptr;
+using std::unordered_map;
 using std::vector;
 
 // Let p and q be the position of two RNDF waypoints w1 and w2 which belong
@@ -371,8 +375,9 @@ void AttachLaneEndToBranchPoint(const api::LaneEnd::Which end, Lane* lane,
 // @pre The given @p branch_point_map must not be a nullptr.
 // @pre The given @p road_geometry must not be a nullptr.
 // @warning This method will abort if preconditions are not met.
-void BuildOrUpdateBranchpoints(Connection* connection, Lane* lane,
-                               map<string, BranchPoint*>* branch_point_map,
+void BuildOrUpdateBranchpoints(
+    Connection* connection, Lane* lane,
+    unordered_map<string, BranchPoint*>* branch_point_map,
                                RoadGeometry* road_geometry) {
   DRAKE_DEMAND(connection != nullptr);
   DRAKE_DEMAND(lane != nullptr);
@@ -673,14 +678,18 @@ void Builder::CreateSegmentConnections(int segment_id,
 
 std::unique_ptr<const api::RoadGeometry> Builder::Build(
     const api::RoadGeometryId& id) {
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
   auto branch_point_map =
-      std::make_unique<std::map<std::string, BranchPoint*>>();
+      std::make_unique<std::unordered_map<std::string, BranchPoint*>>();
   auto road_geometry =
       std::make_unique<RoadGeometry>(id, linear_tolerance_, angular_tolerance_);
 
-  // Builds a lane per connection and creates their respective BranchPoints.
+  // Builds a junction and the segment for each group of related lanes.
+  std::vector<Segment*> segments;
+  std::vector<const std::vector<std::unique_ptr<Connection>>*>
+      segment_connections;
   for (const auto& it_connection : connections_) {
-    // Builds a junction and the segment for related lanes.
     Junction* junction =
         road_geometry->NewJunction(api::JunctionId{"j:" + it_connection.first});
     DRAKE_DEMAND(junction != nullptr);
@@ -688,18 +697,44 @@ std::unique_ptr<const api::RoadGeometry> Builder::Build(
     Segment* segment =
         junction->NewSegment(api::SegmentId{"s:" + it_connection.first});
     DRAKE_DEMAND(segment != nullptr);
+    segments.push_back(segment);
+    segment_connections.push_back(&it_connection.second);
+  }
 
-    for (const auto& connection : it_connection.second) {
-      // Creates a Lane.
-      rndf::Lane* lane = BuildConnection(*connection, segment);
+  // Builds a lane per connection. The lanes' splines are the bulk of the
+  // work, and each segment's lanes are built by a separate task since they
+  // only touch that segment.
+  const int num_segments = static_cast<int>(segments.size());
+  std::vector<std::vector<rndf::Lane*>> segment_lanes(num_segments);
+  ParallelFor(num_segments, num_threads_, [&](int i) {
+    for (const auto& connection : *segment_connections[i]) {
+      rndf::Lane* lane = BuildConnection(*connection, segments[i]);
       DRAKE_DEMAND(lane != nullptr);
-      // Builds the branch points for the lane if necessary.
-      BuildOrUpdateBranchpoints(connection.get(), lane, branch_point_map.get(),
-                                road_geometry.get());
+      segment_lanes[i].push_back(lane);
+    }
+  });
+  const auto lanes_end = Clock::now();
+
+  // Creates the lanes' respective BranchPoints, in the same order as the
+  // lanes so that their IDs do not depend on the number of threads.
+  for (int i = 0; i < num_segments; ++i) {
+    const auto& connections = *segment_connections[i];
+    for (size_t j = 0; j < connections.size(); ++j) {
+      BuildOrUpdateBranchpoints(connections[j].get(), segment_lanes[i][j],
+                                branch_point_map.get(), road_geometry.get());
     }
   }
+  const auto branch_points_end = Clock::now();
+
   // Checks there is no failure when checking RoadGeometry invariants.
   const std::vector<std::string> failures = road_geometry->CheckInvariants();
+  const auto invariants_end = Clock::now();
+  log()->debug(
+      "rndf::Builder::Build: lanes {} s, branch points {} s, invariants {} s",
+      std::chrono::duration<double>(lanes_end - start).count(),
+      std::chrono::duration<double>(branch_points_end - lanes_end).count(),
+      std::chrono::duration<double>(invariants_end - branch_points_end)
+          .count());
   for (const std::string& s : failures) {
     log()->error(s);
   }
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include "drake/automotive/maliput/rndf/directed_waypoint.h"
 #include "drake/automotive/maliput/rndf/road_geometry.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 
 namespace drake {
 namespace maliput {
@@ -148,6 +150,15 @@ class Builder {
     bounding_box_ = bounding_box;
   }
 
+  /// Sets the number of threads that Build() uses to build the lanes'
+  /// geometry, one segment at a time per thread. The built api::RoadGeometry
+  /// does not depend on it. The default is one.
+  /// @throw std::runtime_error When @p num_threads is not positive.
+  void set_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads > 0);
+    num_threads_ = num_threads;
+  }
+
   /// Populates the Builder's inner connection map with the given
   /// @p connections representing an RNDF segment.
   ///
@@ -198,6 +209,8 @@ class Builder {
   /// All the groups of connections are traversed. A Junction with a single
   /// Segment is created per group, and for each connection in that group,
   /// a Lane is added to the Segment. BranchPoints are updated as needed.
+  /// The time spent building the lanes, building the BranchPoints and
+  /// checking the invariants is logged at debug level.
   /// @param id ID of the api::RoadGeometry to be built.
   /// @return The built api::RoadGeometry.
   /// @throw std::runtime_error When the built RoadGeometry does not satisfy
@@ -218,10 +231,13 @@ class Builder {
   const double angular_tolerance_{};
   // A map to hold all the connections while they are created.
   std::map<std::string, std::vector<std::unique_ptr<Connection>>> connections_;
-  // A map to hold all the DirectedWaypoints that are used as Lane extents.
-  std::map<std::string, DirectedWaypoint> directed_waypoints_;
+  // A map to hold all the DirectedWaypoints that are used as Lane extents,
+  // hashed by their ID.
+  std::unordered_map<std::string, DirectedWaypoint> directed_waypoints_;
   // The coordinates of the bounding box that encloses RNDF's waypoints.
   std::pair<ignition::math::Vector3d, ignition::math::Vector3d> bounding_box_;
+  // The number of threads that build the lanes.
+  int num_threads_{1};
 };
 
 }  // namespace rndf
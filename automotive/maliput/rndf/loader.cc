@@ -251,6 +251,7 @@ std::unique_ptr<const api::RoadGeometry> LoadFile(
   const std::pair<ignition::math::Vector3d, ignition::math::Vector3d>
       bounding_box = BuildBoundingBox(segments, origin_location);
   builder.SetBoundingBox(bounding_box);
+  builder.set_num_threads(road_characteristics.num_threads);
 
   // Extracts all segments' lanes and creates the corresponding connections. All
   // segments are built first, followed by zones, so that all waypoints are
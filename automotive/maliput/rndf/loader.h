@@ -35,6 +35,8 @@ struct RoadCharacteristics {
   double linear_tolerance{0.01};
   /// Angular tolerance for RNDF RoadGeometry, in radians.
   double angular_tolerance{0.01 * M_PI};
+  /// Number of threads used to build the RoadGeometry's lanes.
+  int num_threads{1};
 };
 
 /// Loads a given RNDF at @p filepath and builds an equivalent
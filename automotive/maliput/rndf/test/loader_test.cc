@@ -389,6 +389,35 @@ GTEST_TEST(MultiLaneRNDFLoaderTest, LoadTest) {
   }
 }
 
+// Tests that building the lanes on several threads gives the same
+// RoadGeometry as building them on one.
+GTEST_TEST(MultiLaneRNDFLoaderTest, ThreadedLoadTest) {
+  const std::string file_path = FindResourceOrThrow(
+      "drake/automotive/maliput/rndf/test/maps/two_lane.rndf");
+  const auto road_geometry = LoadFile(file_path);
+  RoadCharacteristics road_characteristics{};
+  road_characteristics.num_threads = 3;
+  const auto threaded_road_geometry =
+      LoadFile(file_path, road_characteristics);
+
+  ASSERT_EQ(threaded_road_geometry->num_junctions(),
+            road_geometry->num_junctions());
+  ASSERT_EQ(threaded_road_geometry->num_branch_points(),
+            road_geometry->num_branch_points());
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Segment* segment = road_geometry->junction(i)->segment(0);
+    const api::Segment* threaded_segment =
+        threaded_road_geometry->junction(i)->segment(0);
+    EXPECT_EQ(threaded_segment->id(), segment->id());
+    ASSERT_EQ(threaded_segment->num_lanes(), segment->num_lanes());
+    for (int j = 0; j < segment->num_lanes(); ++j) {
+      EXPECT_EQ(threaded_segment->lane(j)->id(), segment->lane(j)->id());
+      EXPECT_EQ(threaded_segment->lane(j)->length(),
+                segment->lane(j)->length());
+    }
+  }
+}
+
 // Tests that the Loader throws upon loading a zones only RNDF.
 GTEST_TEST(RNDFLoaderFailureTests, ZonesOnlyRNDFTest) {
   static const char* const kZonesRNDFPath =
@@ -3,9 +3,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <initializer_list>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -19,6 +23,7 @@
 #include "drake/automotive/maliput/api/segment.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/hash.h"
+#include "drake/common/parallel_for.h"
 
 namespace drake {
 namespace maliput {
@@ -198,6 +203,20 @@ class GeoMesh {
     faces_.push_back(face);
   }
 
+  // Pushes the faces of @p other onto this mesh, in the order in which they
+  // were pushed onto @p other.  The resulting mesh is the same as if the
+  // faces had been pushed onto this mesh in the first place.
+  void PushFacesOf(const GeoMesh& other) {
+    for (const IndexFace& f : other.faces_) {
+      GeoFace geo_face;
+      for (const IndexFace::Vertex& ifv : f.vertices()) {
+        geo_face.push_vn(*other.vertices_.vector()[ifv.vertex_index],
+                         *other.normals_.vector()[ifv.normal_index]);
+      }
+      PushFace(geo_face);
+    }
+  }
+
   // Emits the mesh as Wavefront OBJ elements to @p os.  @p material is the
   // name of an MTL-defined material to describe visual properties of the mesh.
   // @p precision specifies the fixed-point precision (number of digits after
@@ -274,11 +293,12 @@ class SrhFace {
   // Given a @p lane, calculates the corresponding GeoFace.
   GeoFace ToGeoFace(const api::Lane* lane) const {
     GeoFace geo_face;
-    for (const api::LanePosition& srh : vertices_) {
-      api::GeoPosition xyz(lane->ToGeoPosition(srh));
+    std::vector<api::GeoPosition> xyzs;
+    lane->ToGeoPositions(vertices_, &xyzs);
+    for (size_t i = 0; i < vertices_.size(); ++i) {
       api::GeoPosition n = api::GeoPosition::FromXyz(
-          lane->GetOrientation(srh).quat() * normal_.srh());
-      geo_face.push_vn(GeoVertex(xyz), GeoNormal(n));
+          lane->GetOrientation(vertices_[i]).quat() * normal_.srh());
+      geo_face.push_vn(GeoVertex(xyzs[i]), GeoNormal(n));
     }
     return geo_face;
   }
@@ -767,6 +787,15 @@ void RenderSegment(const api::Segment* segment,
 }
 
 
+// The meshes which RenderSegment() draws a Segment into.
+struct SegmentMeshes {
+  GeoMesh asphalt;
+  GeoMesh lane;
+  GeoMesh marker;
+  GeoMesh h_bounds;
+};
+
+
 bool IsSegmentRenderedNormally(const api::SegmentId& id,
                                const std::vector<api::SegmentId>& highlights) {
   if (highlights.empty()) {
@@ -798,21 +827,39 @@ void GenerateObjFile(const api::RoadGeometry* rg,
   GeoMesh grayed_marker_mesh;
 
   // Walk the network.
+  std::vector<const api::Segment*> segments;
   for (int ji = 0; ji < rg->num_junctions(); ++ji) {
     const api::Junction* junction = rg->junction(ji);
     for (int si = 0; si < junction->num_segments(); ++si) {
-      const api::Segment* segment = junction->segment(si);
-      // TODO(maddog@tri.global)  Id's need well-defined comparison semantics.
-      if (IsSegmentRenderedNormally(segment->id(),
-                                    features.highlighted_segments)) {
-        RenderSegment(segment, features,
-                      &asphalt_mesh, &lane_mesh, &marker_mesh, &h_bounds_mesh);
-      } else {
-        RenderSegment(segment, features,
-                      &grayed_asphalt_mesh, &grayed_lane_mesh,
-                      &grayed_marker_mesh, &h_bounds_mesh);
-      }
+      segments.push_back(junction->segment(si));
+    }
+  }
+
+  // Tessellate the Segments concurrently, each into its own meshes, and then
+  // gather the meshes in network order, so that the result does not depend
+  // on the number of threads.
+  std::vector<SegmentMeshes> segment_meshes(segments.size());
+  ParallelFor(static_cast<int>(segments.size()), features.num_threads,
+              [&segments, &segment_meshes, &features](int i) {
+                SegmentMeshes& meshes = segment_meshes[i];
+                RenderSegment(segments[i], features,
+                              &meshes.asphalt, &meshes.lane, &meshes.marker,
+                              &meshes.h_bounds);
+              });
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const SegmentMeshes& meshes = segment_meshes[i];
+    // TODO(maddog@tri.global)  Id's need well-defined comparison semantics.
+    if (IsSegmentRenderedNormally(segments[i]->id(),
+                                  features.highlighted_segments)) {
+      asphalt_mesh.PushFacesOf(meshes.asphalt);
+      lane_mesh.PushFacesOf(meshes.lane);
+      marker_mesh.PushFacesOf(meshes.marker);
+    } else {
+      grayed_asphalt_mesh.PushFacesOf(meshes.asphalt);
+      grayed_lane_mesh.PushFacesOf(meshes.lane);
+      grayed_marker_mesh.PushFacesOf(meshes.marker);
     }
+    h_bounds_mesh.PushFacesOf(meshes.h_bounds);
   }
 
   if (features.draw_branch_points) {
@@ -988,6 +1035,68 @@ d 0.20
 }
 
 
+bool GenerateObjFileIfChanged(
+    const std::string& road_source,
+    const std::function<std::unique_ptr<const api::RoadGeometry>()>&
+        load_road_geometry,
+    const std::string& dirpath,
+    const std::string& fileroot,
+    const ObjFeatures& features) {
+  // Hash everything which affects the generated files.  Bump the version
+  // whenever GenerateObjFile() changes its output for the same inputs.
+  const std::string kVersion("GenerateObjFile 1");
+  DefaultHasher hasher;
+  hash_append(hasher, kVersion);
+  hash_append(hasher, road_source);
+  hash_append(hasher, features.max_grid_unit);
+  hash_append(hasher, features.min_grid_resolution);
+  hash_append(hasher, features.draw_stripes);
+  hash_append(hasher, features.draw_arrows);
+  hash_append(hasher, features.draw_lane_haze);
+  hash_append(hasher, features.draw_branch_points);
+  hash_append(hasher, features.draw_elevation_bounds);
+  hash_append(hasher, features.stripe_width);
+  hash_append(hasher, features.stripe_elevation);
+  hash_append(hasher, features.arrow_elevation);
+  hash_append(hasher, features.lane_haze_elevation);
+  hash_append(hasher, features.branch_point_elevation);
+  hash_append(hasher, features.branch_point_height);
+  hash_append(hasher, features.origin.x());
+  hash_append(hasher, features.origin.y());
+  hash_append(hasher, features.origin.z());
+  for (const api::SegmentId& id : features.highlighted_segments) {
+    hash_append(hasher, id.string());
+  }
+  hash_append(hasher, features.highlighted_segments.size());
+  const std::string key =
+      fmt::format("{:016x}\n", static_cast<size_t>(hasher));
+
+  const std::string obj_path = dirpath + "/" + fileroot + ".obj";
+  const std::string mtl_path = dirpath + "/" + fileroot + ".mtl";
+  const std::string key_path = obj_path + ".key";
+  {
+    std::ifstream key_is(key_path, std::ios::binary);
+    std::stringstream recorded_key;
+    recorded_key << key_is.rdbuf();
+    if (key_is && (recorded_key.str() == key) &&
+        std::ifstream(obj_path).good() && std::ifstream(mtl_path).good()) {
+      return false;
+    }
+  }
+
+  // Remove any stale key first, so that an interrupted generation is not
+  // mistaken for a complete one.
+  std::remove(key_path.c_str());
+  const std::unique_ptr<const api::RoadGeometry> road_geometry =
+      load_road_geometry();
+  DRAKE_DEMAND(road_geometry != nullptr);
+  GenerateObjFile(road_geometry.get(), dirpath, fileroot, features);
+  std::ofstream key_os(key_path, std::ios::binary);
+  key_os << key;
+  return true;
+}
+
+
 }  // namespace utility
 }  // namespace maliput
 }  // namespace drake
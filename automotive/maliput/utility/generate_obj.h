@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -46,6 +48,10 @@ struct ObjFeatures {
   /// ID's of specific segments to be highlighted.  (If non-empty, then the
   /// Segments *not* specified on this list will be rendered as grayed-out.)
   std::vector<api::SegmentId> highlighted_segments;
+  /// Maximum number of threads used to tessellate the Segments, which are
+  /// tessellated independently of each other.  The generated files do not
+  /// depend on the number of threads.
+  int num_threads{1};
 };
 
 /// Generates a Wavefront OBJ model of the road surface of an api::RoadGeometry.
@@ -68,6 +74,34 @@ void GenerateObjFile(const api::RoadGeometry* road_geometry,
                      const std::string& fileroot,
                      const ObjFeatures& features);
 
+/// Generates the same files as GenerateObjFile(), unless they have already
+/// been generated from the same inputs, in which case they are left as they
+/// are.  This lets tools skip loading and tessellating a road that has not
+/// changed since their previous run.
+///
+/// @param road_source  a complete description of the road, such as the
+///        contents of the file that it is loaded from
+/// @param load_road_geometry  a function that loads the api::RoadGeometry
+///        described by @p road_source; it is only called if the files need to
+///        be generated
+/// @param dirpath  directory component of the output pathnames
+/// @param fileroot  root of the filename component of the output pathnames
+/// @param features  parameters for constructing the mesh
+/// @return true if the files were generated, or false if they were left as
+///         they are
+///
+/// The inputs are identified by a hash of @p road_source and @p features
+/// (other than ObjFeatures::num_threads), which is recorded in a third file
+/// named [@p dirpath]/[@p fileroot].obj.key.  The files are generated again
+/// if any of them are missing, or if the recorded hash differs.
+bool GenerateObjFileIfChanged(
+    const std::string& road_source,
+    const std::function<std::unique_ptr<const api::RoadGeometry>()>&
+        load_road_geometry,
+    const std::string& dirpath,
+    const std::string& fileroot,
+    const ObjFeatures& features);
+
 }  // namespace utility
 }  // namespace maliput
 }  // namespace drake
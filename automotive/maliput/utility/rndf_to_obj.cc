@@ -1,9 +1,13 @@
 // Takes a RNDF file as input, builds the resulting RNDF road geometry and
 // renders the road surface, saved as a WaveFront OBJ output file.
+#include <fstream>
+#include <sstream>
+
 #include <gflags/gflags.h>
 
 #include "drake/automotive/maliput/rndf/loader.h"
 #include "drake/automotive/maliput/utility/generate_obj.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/text_logging_gflags.h"
 
@@ -19,6 +23,11 @@ DEFINE_double(max_grid_unit, utility::ObjFeatures().max_grid_unit,
 DEFINE_double(min_grid_resolution, utility::ObjFeatures().min_grid_resolution,
               "Minimum number of grid-units in either lateral or longitudinal"
               " direction in the rendered mesh covering the road surface");
+DEFINE_int32(num_threads, drake::GetDefaultNumThreads(),
+             "Maximum number of threads used to tessellate the road surface");
+DEFINE_bool(reuse_obj, false,
+            "Skip generating the OBJ and MTL files if they were already"
+            " generated from the same input file and options");
 
 int main(int argc, char* argv[]) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
@@ -33,12 +42,30 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  drake::log()->info("Loading road geometry.");
-  const auto road_geometry = rndf::LoadFile(FLAGS_rndf_file);
-
   utility::ObjFeatures features;
   features.max_grid_unit = FLAGS_max_grid_unit;
   features.min_grid_resolution = FLAGS_min_grid_resolution;
+  features.num_threads = FLAGS_num_threads;
+
+  if (FLAGS_reuse_obj) {
+    std::ifstream is(FLAGS_rndf_file);
+    std::stringstream rndf_contents;
+    rndf_contents << is.rdbuf();
+    drake::log()->info("Generating OBJ, unless it is up to date.");
+    if (!utility::GenerateObjFileIfChanged(
+            rndf_contents.str(),
+            []() {
+              drake::log()->info("Loading road geometry.");
+              return rndf::LoadFile(FLAGS_rndf_file);
+            },
+            FLAGS_obj_dir, FLAGS_obj_file, features)) {
+      drake::log()->info("OBJ is up to date.");
+    }
+    return 0;
+  }
+
+  drake::log()->info("Loading road geometry.");
+  const auto road_geometry = rndf::LoadFile(FLAGS_rndf_file);
 
   drake::log()->info("Generating OBJ.");
   utility::GenerateObjFile(road_geometry.get(), FLAGS_obj_dir, FLAGS_obj_file,
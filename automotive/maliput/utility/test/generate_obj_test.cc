@@ -332,6 +332,121 @@ TEST_F(GenerateObjBasicDutTest, HighlightedSegments) {
 }
 
 
+// Tests that tessellating the Segments concurrently gives the same result.
+TEST_F(GenerateObjBasicDutTest, HighlightedSegmentsMultithreaded) {
+  const std::string basename{"HighlightedSegments"};
+
+  {
+    mono::Builder b(kLaneBounds, kDriveableBounds, kElevationBounds,
+                    kLinearTolerance, kAngularTolerance);
+
+    const mono::EndpointZ kZeroZ{0., 0., 0., 0.};
+    const mono::Endpoint start0{{0., 0., 0.}, kZeroZ};
+    auto c0 = b.Connect("0", start0, 2., kZeroZ);
+    auto c1 = b.Connect("1", c0->end(), 2., kZeroZ);
+    b.Connect("2", c1->end(), 2., kZeroZ);
+    dut_ = b.Build(api::RoadGeometryId{"dut"});
+  }
+
+  ObjFeatures features;
+  features.highlighted_segments.push_back(dut_->junction(1)->segment(0)->id());
+  GenerateObjFile(dut_.get(), directory_.getStr(), basename, features);
+
+  spruce::path actual_obj_path(directory_);
+  actual_obj_path.append(basename + ".obj");
+  paths_to_cleanup_.push_back(actual_obj_path);
+  spruce::path actual_mtl_path(directory_);
+  actual_mtl_path.append(basename + ".mtl");
+  paths_to_cleanup_.push_back(actual_mtl_path);
+
+  std::string serial_obj_contents;
+  ReadAsString(actual_obj_path, &serial_obj_contents);
+
+  features.num_threads = 3;
+  GenerateObjFile(dut_.get(), directory_.getStr(), basename, features);
+
+  std::string parallel_obj_contents;
+  ReadAsString(actual_obj_path, &parallel_obj_contents);
+  EXPECT_EQ(serial_obj_contents, parallel_obj_contents);
+}
+
+
+TEST_F(GenerateObjTest, GenerateObjFileIfChanged) {
+  const std::string basename{"GenerateObjFileIfChanged"};
+  // Returns the YAML description of a road with one straight lane.
+  const auto make_yaml = [](double length) {
+    return R"R(maliput_monolane_builder:
+  id: one_lane
+  lane_bounds: [-2, 2]
+  driveable_bounds: [-4, 4]
+  elevation_bounds: [0, 5]
+  position_precision: .01
+  orientation_precision: 0.5
+  points:
+    start:
+      xypoint: [0, 0, 0]
+      zpoint: [0, 0, 0, 0]
+  connections:
+    0:
+      start: "points.start"
+      length: )R" + std::to_string(length) + R"R(
+      z_end: [0, 0, 0, 0]
+)R";
+  };
+  const std::string yaml = make_yaml(10.);
+  int num_loads{0};
+  const auto load = [&num_loads](const std::string& source) {
+    return [&num_loads, source]() {
+      ++num_loads;
+      return mono::Load(source);
+    };
+  };
+
+  ObjFeatures features;
+  EXPECT_TRUE(GenerateObjFileIfChanged(yaml, load(yaml), directory_.getStr(),
+                                       basename, features));
+  EXPECT_EQ(num_loads, 1);
+
+  spruce::path actual_obj_path(directory_);
+  actual_obj_path.append(basename + ".obj");
+  EXPECT_TRUE(actual_obj_path.isFile());
+  paths_to_cleanup_.push_back(actual_obj_path);
+  spruce::path actual_mtl_path(directory_);
+  actual_mtl_path.append(basename + ".mtl");
+  EXPECT_TRUE(actual_mtl_path.isFile());
+  paths_to_cleanup_.push_back(actual_mtl_path);
+  spruce::path actual_key_path(directory_);
+  actual_key_path.append(basename + ".obj.key");
+  EXPECT_TRUE(actual_key_path.isFile());
+  paths_to_cleanup_.push_back(actual_key_path);
+
+  // The same inputs do not generate the files again, whatever the number of
+  // threads.
+  features.num_threads = 2;
+  EXPECT_FALSE(GenerateObjFileIfChanged(yaml, load(yaml), directory_.getStr(),
+                                        basename, features));
+  EXPECT_EQ(num_loads, 1);
+
+  // Other features, or another road, do.
+  features.max_grid_unit = 0.5;
+  EXPECT_TRUE(GenerateObjFileIfChanged(yaml, load(yaml), directory_.getStr(),
+                                       basename, features));
+  EXPECT_EQ(num_loads, 2);
+  const std::string longer_yaml = make_yaml(20.);
+  EXPECT_TRUE(GenerateObjFileIfChanged(longer_yaml, load(longer_yaml),
+                                       directory_.getStr(), basename,
+                                       features));
+  EXPECT_EQ(num_loads, 3);
+
+  // So does a missing file.
+  EXPECT_TRUE(spruce::file::remove(actual_mtl_path));
+  EXPECT_TRUE(GenerateObjFileIfChanged(longer_yaml, load(longer_yaml),
+                                       directory_.getStr(), basename,
+                                       features));
+  EXPECT_EQ(num_loads, 4);
+}
+
+
 }  // namespace utility
 }  // namespace maliput
 }  // namespace drake
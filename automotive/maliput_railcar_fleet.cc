@@ -0,0 +1,498 @@
+#include "drake/automotive/maliput_railcar_fleet.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/automotive/maliput/api/branch_point.h"
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput_railcar.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_optional.h"
+#include "drake/math/roll_pitch_yaw_using_quaternion.h"
+#include "drake/multibody/multibody_tree/math/spatial_velocity.h"
+#include "drake/systems/framework/basic_vector.h"
+#include "drake/systems/framework/value.h"
+
+namespace drake {
+
+using maliput::api::GeoPosition;
+using maliput::api::IsoLaneVelocity;
+using maliput::api::Lane;
+using maliput::api::LaneEnd;
+using maliput::api::LaneEndSet;
+using maliput::api::LanePosition;
+using maliput::api::Rotation;
+using math::RollPitchYawToQuaternion;
+using systems::BasicVector;
+using systems::Context;
+using systems::ContinuousState;
+using systems::Event;
+using systems::OutputPort;
+using systems::State;
+using systems::UnrestrictedUpdateEvent;
+using systems::rendering::FrameVelocity;
+using systems::rendering::PoseBundle;
+
+namespace automotive {
+
+namespace {
+
+// Finds the lane directions in a context.
+template <typename T>
+const std::vector<LaneDirection>& get_lane_directions(
+    const Context<T>& context) {
+  return context.template get_abstract_state<std::vector<LaneDirection>>(0);
+}
+
+// Returns the default branch at the end of @p lane_direction that is reached
+// when traveling in its direction, or else the first ongoing branch, or else
+// nullopt.
+optional<LaneEnd> GetOngoingBranch(const LaneDirection& lane_direction) {
+  const LaneEnd::Which which =
+      lane_direction.with_s ? LaneEnd::kFinish : LaneEnd::kStart;
+  optional<LaneEnd> branch = lane_direction.lane->GetDefaultBranch(which);
+  if (!branch) {
+    const LaneEndSet* ongoing_lanes =
+        lane_direction.lane->GetOngoingBranches(which);
+    if (ongoing_lanes != nullptr && ongoing_lanes->size() > 0) {
+      branch = ongoing_lanes->get(0);
+    }
+  }
+  return branch;
+}
+
+}  // namespace
+
+template <typename T>
+MaliputRailcarFleet<T>::MaliputRailcarFleet(
+    const std::vector<LaneDirection>& initial_lane_directions,
+    int first_model_instance_id)
+    : initial_lane_directions_(initial_lane_directions),
+      first_model_instance_id_(first_model_instance_id) {
+  for (const LaneDirection& lane_direction : initial_lane_directions_) {
+    DRAKE_DEMAND(lane_direction.lane != nullptr);
+  }
+  pose_output_port_index_ =
+      this->DeclareAbstractOutputPort(&MaliputRailcarFleet::MakePoseBundle,
+                                      &MaliputRailcarFleet::CalcPoseBundle)
+          .get_index();
+
+  this->DeclareContinuousState(2 * num_cars());
+  this->DeclareAbstractState(
+      systems::AbstractValue::Make(initial_lane_directions_));
+  this->DeclareNumericParameter(MaliputRailcarParams<T>());
+  this->DeclareNumericParameter(IdmPlannerParameters<T>());
+}
+
+template <typename T>
+const OutputPort<T>& MaliputRailcarFleet<T>::pose_output() const {
+  return this->get_output_port(pose_output_port_index_);
+}
+
+template <typename T>
+MaliputRailcarParams<T>& MaliputRailcarFleet<T>::get_mutable_railcar_parameters(
+    Context<T>* context) const {
+  return this->template GetMutableNumericParameter<MaliputRailcarParams>(
+      context, 0);
+}
+
+template <typename T>
+IdmPlannerParameters<T>& MaliputRailcarFleet<T>::get_mutable_idm_parameters(
+    Context<T>* context) const {
+  return this->template GetMutableNumericParameter<IdmPlannerParameters>(
+      context, 1);
+}
+
+template <typename T>
+const MaliputRailcarParams<T>& MaliputRailcarFleet<T>::get_railcar_parameters(
+    const Context<T>& context) const {
+  return this->template GetNumericParameter<MaliputRailcarParams>(context, 0);
+}
+
+template <typename T>
+const IdmPlannerParameters<T>& MaliputRailcarFleet<T>::get_idm_parameters(
+    const Context<T>& context) const {
+  return this->template GetNumericParameter<IdmPlannerParameters>(context, 1);
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::GetCarState(
+    const Context<T>& context, int car,
+    MaliputRailcarState<T>* car_state) const {
+  DRAKE_DEMAND(car_state != nullptr);
+  DRAKE_DEMAND(car >= 0 && car < num_cars());
+  const systems::VectorBase<T>& state = context.get_continuous_state_vector();
+  car_state->set_s(state.GetAtIndex(car));
+  car_state->set_speed(state.GetAtIndex(num_cars() + car));
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::SetCarState(
+    Context<T>* context, int car,
+    const MaliputRailcarState<T>& car_state) const {
+  DRAKE_DEMAND(context != nullptr);
+  DRAKE_DEMAND(car >= 0 && car < num_cars());
+  systems::VectorBase<T>& state =
+      context->get_mutable_continuous_state_vector();
+  state.SetAtIndex(car, car_state.s());
+  state.SetAtIndex(num_cars() + car, car_state.speed());
+}
+
+template <typename T>
+const LaneDirection& MaliputRailcarFleet<T>::GetCarLaneDirection(
+    const Context<T>& context, int car) const {
+  return get_lane_directions(context).at(car);
+}
+
+template <typename T>
+T MaliputRailcarFleet<T>::CalcR(const MaliputRailcarParams<T>& params,
+                                int car,
+                                const LaneDirection& lane_direction) const {
+  if (lane_direction.with_s == initial_lane_directions_[car].with_s) {
+    return params.r();
+  } else {
+    return -params.r();
+  }
+}
+
+template <typename T>
+T MaliputRailcarFleet<T>::CalcSDot(const MaliputRailcarParams<T>& params,
+                                   int car,
+                                   const LaneDirection& lane_direction,
+                                   const T& s, const T& speed) const {
+  const T sigma_v = lane_direction.with_s ? speed : -speed;
+  return lane_direction.lane
+      ->EvalMotionDerivatives(
+          LanePosition(s, CalcR(params, car, lane_direction), params.h()),
+          IsoLaneVelocity(sigma_v, 0 /* rho_v */, 0 /* eta_v */))
+      .s();
+}
+
+template <typename T>
+PoseBundle<T> MaliputRailcarFleet<T>::MakePoseBundle() const {
+  PoseBundle<T> poses(num_cars());
+  for (int i = 0; i < num_cars(); ++i) {
+    poses.set_name(i, std::to_string(i));
+    poses.set_model_instance_id(i, first_model_instance_id_ + i);
+  }
+  return poses;
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::CalcPoseBundle(const Context<T>& context,
+                                            PoseBundle<T>* poses) const {
+  const MaliputRailcarParams<T>& params = get_railcar_parameters(context);
+  const VectorX<T> state = context.get_continuous_state_vector().CopyToVector();
+  const std::vector<LaneDirection>& lane_directions =
+      get_lane_directions(context);
+  DRAKE_DEMAND(poses->get_num_poses() == num_cars());
+
+  using std::atan2;
+  using std::cos;
+  using std::max;
+  using std::sin;
+
+  for (int i = 0; i < num_cars(); ++i) {
+    const LaneDirection& lane_direction = lane_directions[i];
+    const LanePosition lane_position(
+        state(i), CalcR(params, i, lane_direction), params.h());
+    const GeoPosition geo_position =
+        lane_direction.lane->ToGeoPosition(lane_position);
+    const Rotation rotation =
+        lane_direction.lane->GetOrientation(lane_position);
+
+    // Adjust the rotation based on whether the vehicle is traveling with s or
+    // against s, as MaliputRailcar does.
+    const Rotation adjusted_rotation =
+        (lane_direction.with_s ? rotation :
+         Rotation::FromRpy(-rotation.roll(),
+                           -rotation.pitch(),
+                           atan2(-sin(rotation.yaw()), -cos(rotation.yaw()))));
+    Isometry3<T> pose(RollPitchYawToQuaternion(
+        Vector3<T>(adjusted_rotation.roll(), adjusted_rotation.pitch(),
+                   adjusted_rotation.yaw())));
+    pose.translation() = geo_position.xyz();
+    poses->set_pose(i, pose);
+
+    // Don't allow small negative speed to escape our state.
+    const T speed = max(T(0), state(num_cars() + i));
+    const Vector3<T> v_LC_L(lane_direction.with_s ? speed : -speed,
+                            0 /* r_dot */, 0 /* h_dot */);
+    const Vector3<T> v_WC_W = rotation.matrix() * v_LC_L;
+    // TODO(liang.fok) Add support for non-zero rotational velocity. See #5751.
+    FrameVelocity<T> velocity;
+    velocity.set_velocity(
+        multibody::SpatialVelocity<T>(Vector3<T>::Zero(), v_WC_W));
+    poses->set_velocity(i, velocity);
+  }
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::CalcLeaders(
+    const Eigen::Ref<const VectorX<T>>& s,
+    const Eigen::Ref<const VectorX<T>>& speed,
+    const std::vector<LaneDirection>& lane_directions, const T& scan_distance,
+    VectorX<T>* headways, VectorX<T>* lead_speeds) const {
+  const int n = num_cars();
+  headways->setConstant(n, std::numeric_limits<T>::infinity());
+  lead_speeds->setZero(n);
+
+  // Sorts the vehicles by lane, then by `s`, and records the range of each
+  // lane in the sorted order.
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](int a, int b) {
+    if (lane_directions[a].lane != lane_directions[b].lane) {
+      return std::less<const Lane*>()(lane_directions[a].lane,
+                                      lane_directions[b].lane);
+    }
+    return (s(a) != s(b)) ? (s(a) < s(b)) : (a < b);
+  });
+  std::vector<int> rank(n);
+  std::unordered_map<const Lane*, std::pair<int, int>> lane_ranges;
+  for (int k = 0; k < n; ++k) {
+    rank[order[k]] = k;
+    const auto inserted =
+        lane_ranges.emplace(lane_directions[order[k]].lane,
+                            std::make_pair(k, k + 1));
+    if (!inserted.second) inserted.first->second.second = k + 1;
+  }
+
+  // Records vehicle `lead` as the leader of vehicle `i` at `headway`, if it is
+  // within the scan distance.  `with_s` is the direction of travel of `i`
+  // along the lane of `lead`.  A vehicle that reaches itself around a loop of
+  // lanes has no leader.
+  auto set_leader = [&](int i, int lead, const T& headway, bool with_s) {
+    if (lead == i || headway >= scan_distance) return;
+    (*headways)(i) = headway;
+    (*lead_speeds)(i) =
+        (lane_directions[lead].with_s == with_s) ? speed(lead) : -speed(lead);
+  };
+
+  for (int i = 0; i < n; ++i) {
+    const LaneDirection& ego_lane_direction = lane_directions[i];
+    const std::pair<int, int> ego_range =
+        lane_ranges.at(ego_lane_direction.lane);
+
+    // Looks for the nearest vehicle ahead in the same lane.  Vehicles at the
+    // same `s` are not ahead, as in PoseSelector.
+    int lead = -1;
+    if (ego_lane_direction.with_s) {
+      for (int k = rank[i] + 1; k < ego_range.second; ++k) {
+        if (s(order[k]) > s(i)) { lead = order[k]; break; }
+      }
+    } else {
+      for (int k = rank[i] - 1; k >= ego_range.first; --k) {
+        if (s(order[k]) < s(i)) { lead = order[k]; break; }
+      }
+    }
+    if (lead >= 0) {
+      using std::abs;
+      set_leader(i, lead, abs(s(lead) - s(i)), ego_lane_direction.with_s);
+      continue;
+    }
+
+    // Otherwise, follows the default path until a lane with vehicles in it is
+    // found, or the scan distance is exceeded.
+    LaneDirection lane_direction = ego_lane_direction;
+    T distance_scanned = lane_direction.with_s
+                             ? T(lane_direction.lane->length()) - s(i)
+                             : s(i);
+    while (distance_scanned < scan_distance) {
+      const optional<LaneEnd> branch = GetOngoingBranch(lane_direction);
+      if (!branch) break;
+      lane_direction.lane = branch->lane;
+      lane_direction.with_s = (branch->end == LaneEnd::kStart);
+      const auto it = lane_ranges.find(lane_direction.lane);
+      if (it != lane_ranges.end()) {
+        if (lane_direction.with_s) {
+          lead = order[it->second.first];
+          set_leader(i, lead, distance_scanned + s(lead), true);
+        } else {
+          lead = order[it->second.second - 1];
+          set_leader(i, lead,
+                     distance_scanned + T(lane_direction.lane->length()) -
+                         s(lead),
+                     false);
+        }
+        break;
+      }
+      distance_scanned += T(lane_direction.lane->length());
+    }
+  }
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::DoCalcTimeDerivatives(
+    const Context<T>& context, ContinuousState<T>* derivatives) const {
+  DRAKE_ASSERT(derivatives != nullptr);
+  const int n = num_cars();
+  if (n == 0) return;
+
+  const MaliputRailcarParams<T>& params = get_railcar_parameters(context);
+  const IdmPlannerParameters<T>& idm_params = get_idm_parameters(context);
+  DRAKE_DEMAND(idm_params.IsValid());
+  const std::vector<LaneDirection>& lane_directions =
+      get_lane_directions(context);
+  const VectorX<T> state = context.get_continuous_state_vector().CopyToVector();
+  const auto s = state.head(n);
+  const auto speed = state.tail(n);
+
+  VectorX<T> headways;
+  VectorX<T> lead_speeds;
+  CalcLeaders(s, speed, lane_directions, idm_params.scan_ahead_distance(),
+              &headways, &lead_speeds);
+
+  // Evaluates the IDM equation (see IdmPlanner) and IdmController's distance
+  // saturation for all vehicles at once.  A vehicle without a leader has an
+  // infinite net distance, and thus no interaction term.
+  using Array = Eigen::Array<T, Eigen::Dynamic, 1>;
+  const Array v = speed.array();
+  const T a = idm_params.a();
+  const T b = idm_params.b();
+  const Array net_distance =
+      (headways.array() - idm_params.bloat_diameter())
+          .max(idm_params.distance_lower_limit());
+  const Array closing_velocity = v - lead_speeds.array();
+  const Array accel_interaction =
+      ((idm_params.s_0() + v * idm_params.time_headway() +
+        v * closing_velocity / (2 * std::sqrt(a * b))) /
+       net_distance)
+          .square();
+  const Array accel_free_road =
+      (v.max(T(0)) / idm_params.v_ref()).pow(idm_params.delta());
+  const Array desired_acceleration =
+      a * (1. - accel_free_road - accel_interaction);
+
+  // Applies the speed limits of calc_smooth_acceleration() to all vehicles
+  // at once.
+  const T max_speed = params.max_speed();
+  const T kp = params.velocity_limit_kp();
+  const Array underspeed = -v;
+  const Array overspeed = v - max_speed;
+  const Array damped_acceleration = (underspeed > 0).select(
+      desired_acceleration.max(kp * underspeed),
+      (overspeed > 0).select(desired_acceleration.min(-kp * overspeed),
+                             desired_acceleration));
+  const Array relevant_limit =
+      (damped_acceleration >= 0).select(Array::Constant(n, max_speed),
+                                        Array::Zero(n));
+  const Array smoothing_factor = (20.0 * (v - relevant_limit)).tanh().square();
+
+  VectorX<T> rates(2 * n);
+  for (int i = 0; i < n; ++i) {
+    rates(i) = CalcSDot(params, i, lane_directions[i], s(i), speed(i));
+  }
+  rates.tail(n) = (damped_acceleration * smoothing_factor).matrix();
+  derivatives->SetFromVector(rates);
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::SetDefaultState(const Context<T>&,
+                                             State<T>* state) const {
+  VectorX<T> default_state(2 * num_cars());
+  default_state << VectorX<T>::Constant(num_cars(),
+                                        MaliputRailcar<T>::kDefaultInitialS),
+      VectorX<T>::Constant(num_cars(),
+                           MaliputRailcar<T>::kDefaultInitialSpeed);
+  state->get_mutable_continuous_state().SetFromVector(default_state);
+  state->template get_mutable_abstract_state<std::vector<LaneDirection>>(0) =
+      initial_lane_directions_;
+}
+
+// As in MaliputRailcar, the next update time is estimated from each vehicle's
+// current speed, and the update moves every vehicle that has reached the end
+// of its lane to the ongoing branch.
+template <typename T>
+void MaliputRailcarFleet<T>::DoCalcNextUpdateTime(
+    const Context<T>& context, systems::CompositeEventCollection<T>* events,
+    T* time) const {
+  const MaliputRailcarParams<T>& params = get_railcar_parameters(context);
+  const std::vector<LaneDirection>& lane_directions =
+      get_lane_directions(context);
+  const systems::VectorBase<T>& state = context.get_continuous_state_vector();
+
+  *time = T(std::numeric_limits<double>::infinity());
+  for (int i = 0; i < num_cars(); ++i) {
+    const T s = state.GetAtIndex(i);
+    const T speed = state.GetAtIndex(num_cars() + i);
+    // Vehicles that are stopped (or are drifting backwards) never reach the
+    // end of their lane.
+    if (speed <= 0) continue;
+    const LaneDirection& lane_direction = lane_directions[i];
+    const T s_dot = CalcSDot(params, i, lane_direction, s, speed);
+    const T distance = lane_direction.with_s
+                           ? T(lane_direction.lane->length()) - s
+                           : -s;
+    using std::min;
+    *time = min(*time, context.get_time() + distance / s_dot);
+  }
+
+  // The integrator requires that the next update time be strictly after the
+  // current time.
+  if (*time <= context.get_time()) {
+    *time = context.get_time() + MaliputRailcar<T>::kTimeEpsilon;
+  }
+  events->add_unrestricted_update_event(
+      std::make_unique<UnrestrictedUpdateEvent<T>>(
+          Event<T>::TriggerType::kTimed));
+}
+
+template <typename T>
+void MaliputRailcarFleet<T>::DoCalcUnrestrictedUpdate(
+    const Context<T>& context,
+    const std::vector<const UnrestrictedUpdateEvent<T>*>&,
+    State<T>* next_state) const {
+  const double kLaneEndEpsilon = MaliputRailcar<T>::kLaneEndEpsilon;
+
+  // Copies the present state into the new one.
+  next_state->CopyFrom(context.get_state());
+  systems::VectorBase<T>& next_railcar_states =
+      next_state->get_mutable_continuous_state().get_mutable_vector();
+  std::vector<LaneDirection>& next_lane_directions =
+      next_state->template get_mutable_abstract_state<
+          std::vector<LaneDirection>>(0);
+
+  for (int i = 0; i < num_cars(); ++i) {
+    LaneDirection& lane_direction = next_lane_directions[i];
+    const double s = next_railcar_states.GetAtIndex(i);
+    const double length = lane_direction.lane->length();
+
+    // No lane change is necessary when the vehicle is more than epsilon away
+    // from the next lane boundary.
+    if ((lane_direction.with_s && s < length - kLaneEndEpsilon) ||
+        (!lane_direction.with_s && s > kLaneEndEpsilon)) {
+      continue;
+    }
+
+    // Stops the vehicle at the end of the road, or else moves it to the
+    // ongoing branch.
+    const optional<LaneEnd> next_branch = GetOngoingBranch(lane_direction);
+    if (!next_branch) {
+      next_railcar_states.SetAtIndex(num_cars() + i, T(0));
+      continue;
+    }
+    if (next_railcar_states.GetAtIndex(num_cars() + i) == 0) continue;
+    lane_direction.lane = next_branch->lane;
+    if (next_branch->end == LaneEnd::kStart) {
+      lane_direction.with_s = true;
+      next_railcar_states.SetAtIndex(i, T(0));
+    } else {
+      lane_direction.with_s = false;
+      next_railcar_states.SetAtIndex(i, T(lane_direction.lane->length()));
+    }
+  }
+}
+
+// This section must match the API documentation in maliput_railcar_fleet.h.
+template class MaliputRailcarFleet<double>;
+
+}  // namespace automotive
+}  // namespace drake
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/automotive/gen/idm_planner_parameters.h"
+#include "drake/automotive/gen/maliput_railcar_params.h"
+#include "drake/automotive/gen/maliput_railcar_state.h"
+#include "drake/automotive/lane_direction.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/rendering/pose_bundle.h"
+
+namespace drake {
+namespace automotive {
+
+/// MaliputRailcarFleet models a fleet of vehicles that each follow a
+/// maliput::api::Lane as if on rails, like MaliputRailcar, with their
+/// accelerations given by the IDM (see IdmPlanner).  It is equivalent to one
+/// MaliputRailcar per vehicle, each commanded by an IdmController with
+/// ScanStrategy::kPath that sees the other vehicles of the fleet, but it is
+/// a single system, so large fleets are cheap to build and to simulate:
+///
+///  - The states of all vehicles live in one contiguous vector.
+///  - The lane positions of the vehicles are known exactly, so the leading
+///    vehicle of each one is found by sorting the vehicles by lane and `s`
+///    once per evaluation, rather than by projecting every vehicle into the
+///    lanes scanned by every other one.
+///  - The IDM and the speed limits are evaluated for all vehicles at once,
+///    as Eigen array expressions.
+///
+/// The vehicles only react to each other; vehicles outside the fleet are not
+/// seen.  All of the vehicles share the same MaliputRailcarParams and
+/// IdmPlannerParameters.
+///
+/// Parameters:
+///   * Index 0: See MaliputRailcarParams.
+///   * Index 1: See IdmPlannerParameters.
+///
+/// State vector:
+///   * The `s` coordinates of the vehicles, followed by their speeds; i.e.,
+///     the layout of MaliputRailcarState for vehicle `i` is entries `i` and
+///     `num_cars() + i`.
+///
+/// Abstract state:
+///   * A std::vector<LaneDirection> with the lane of each vehicle.
+///
+/// <B>Output Port Accessors:</B>
+///
+///   - pose_output(): Contains a PoseBundle with the pose `X_WC` and velocity
+///     `V_WC_W` of each vehicle, where `C` is the car frame and `W` is the
+///     world frame.  Vehicle `i` is named `std::to_string(i)`, and has the
+///     model instance ID `first_model_instance_id + i`.
+///
+/// Instantiated templates for the following ScalarTypes are provided:
+/// - double
+///
+/// They are already available to link against in the containing library.
+///
+/// @ingroup automotive_plants
+template <typename T>
+class MaliputRailcarFleet final : public systems::LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MaliputRailcarFleet)
+
+  /// The constructor.
+  ///
+  /// @param initial_lane_directions The initial lane and direction of travel
+  /// of each vehicle.  The lanes must not be nullptr.
+  ///
+  /// @param first_model_instance_id The model instance ID of the first
+  /// vehicle in pose_output().
+  explicit MaliputRailcarFleet(
+      const std::vector<LaneDirection>& initial_lane_directions,
+      int first_model_instance_id = 0);
+
+  /// Returns the number of vehicles.
+  int num_cars() const {
+    return static_cast<int>(initial_lane_directions_.size());
+  }
+
+  /// Returns a mutable reference to the MaliputRailcarParams in the given
+  /// @p context.
+  MaliputRailcarParams<T>& get_mutable_railcar_parameters(
+      systems::Context<T>* context) const;
+
+  /// Returns a mutable reference to the IdmPlannerParameters in the given
+  /// @p context.
+  IdmPlannerParameters<T>& get_mutable_idm_parameters(
+      systems::Context<T>* context) const;
+
+  /// Sets @p car_state to the state of vehicle @p car in @p context.
+  void GetCarState(const systems::Context<T>& context, int car,
+                   MaliputRailcarState<T>* car_state) const;
+
+  /// Sets the state of vehicle @p car in @p context to @p car_state.
+  void SetCarState(systems::Context<T>* context, int car,
+                   const MaliputRailcarState<T>& car_state) const;
+
+  /// Returns the lane direction of vehicle @p car in @p context.
+  const LaneDirection& GetCarLaneDirection(const systems::Context<T>& context,
+                                           int car) const;
+
+  const systems::OutputPort<T>& pose_output() const;
+
+ private:
+  // System<T> overrides.
+  void DoCalcTimeDerivatives(
+      const systems::Context<T>& context,
+      systems::ContinuousState<T>* derivatives) const override;
+
+  void SetDefaultState(const systems::Context<T>& context,
+                       systems::State<T>* state) const override;
+
+  // LeafSystem<T> overrides.
+  void DoCalcNextUpdateTime(const systems::Context<T>& context,
+                            systems::CompositeEventCollection<T>*,
+                            T* time) const override;
+  void DoCalcUnrestrictedUpdate(
+      const systems::Context<T>& context,
+      const std::vector<const systems::UnrestrictedUpdateEvent<T>*>&,
+      systems::State<T>* state) const override;
+
+  systems::rendering::PoseBundle<T> MakePoseBundle() const;
+
+  void CalcPoseBundle(const systems::Context<T>& context,
+                      systems::rendering::PoseBundle<T>* poses) const;
+
+  // Sets `headways` to the distance along `s` from each vehicle to the
+  // vehicle ahead of it on its default path, within `scan_distance`, and
+  // `lead_speeds` to the speed of that vehicle in the direction of travel.
+  // Vehicles with no leader get an infinite headway and a zero lead speed.
+  void CalcLeaders(const Eigen::Ref<const VectorX<T>>& s,
+                   const Eigen::Ref<const VectorX<T>>& speed,
+                   const std::vector<LaneDirection>& lane_directions,
+                   const T& scan_distance, VectorX<T>* headways,
+                   VectorX<T>* lead_speeds) const;
+
+  // Returns the `r` coordinate of vehicle `car` in `lane_direction`, which
+  // flips sign with the direction of travel relative to the initial lane.
+  T CalcR(const MaliputRailcarParams<T>& params, int car,
+          const LaneDirection& lane_direction) const;
+
+  // Returns the time derivative of `s` of vehicle `car`.
+  T CalcSDot(const MaliputRailcarParams<T>& params, int car,
+             const LaneDirection& lane_direction, const T& s,
+             const T& speed) const;
+
+  // Finds our parameters in a context.
+  const MaliputRailcarParams<T>& get_railcar_parameters(
+      const systems::Context<T>& context) const;
+  const IdmPlannerParameters<T>& get_idm_parameters(
+      const systems::Context<T>& context) const;
+
+  const std::vector<LaneDirection> initial_lane_directions_;
+  const int first_model_instance_id_{};
+  int pose_output_port_index_{};
+};
+
+}  // namespace automotive
+}  // namespace drake
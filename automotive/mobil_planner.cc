@@ -113,9 +113,15 @@ void MobilPlanner<T>::CalcLaneDirection(const systems::Context<T>& context,
                                                   ego_acceleration_index_);
   DRAKE_ASSERT(ego_accel_command != nullptr);
 
-  const PoseBundle<T>* const traffic_poses =
-      this->template EvalInputValue<PoseBundle<T>>(context, traffic_index_);
-  DRAKE_ASSERT(traffic_poses != nullptr);
+  const systems::AbstractValue* const traffic =
+      this->EvalAbstractInput(context, traffic_index_);
+  DRAKE_ASSERT(traffic != nullptr);
+  const TrafficIndex<T>* const indexed_traffic =
+      traffic->template MaybeGetValue<TrafficIndex<T>>();
+  const PoseBundle<T>& traffic_poses =
+      (indexed_traffic != nullptr)
+          ? indexed_traffic->poses()
+          : traffic->template GetValue<PoseBundle<T>>();
 
   // Obtain the state if we've allocated it.
   RoadPosition ego_rp;
@@ -124,15 +130,16 @@ void MobilPlanner<T>::CalcLaneDirection(const systems::Context<T>& context,
     ego_rp = context.template get_abstract_state<RoadPosition>(0);
   }
 
-  ImplCalcLaneDirection(*ego_pose, *ego_velocity, *traffic_poses,
-                        *ego_accel_command, idm_params, mobil_params,
-                        ego_rp, lane_direction);
+  ImplCalcLaneDirection(*ego_pose, *ego_velocity, traffic_poses,
+                        indexed_traffic, *ego_accel_command, idm_params,
+                        mobil_params, ego_rp, lane_direction);
 }
 
 template <typename T>
 void MobilPlanner<T>::ImplCalcLaneDirection(
     const PoseVector<T>& ego_pose, const FrameVelocity<T>& ego_velocity,
-    const PoseBundle<T>& traffic_poses, const BasicVector<T>& ego_accel_command,
+    const PoseBundle<T>& traffic_poses, const TrafficIndex<T>* indexed_traffic,
+    const BasicVector<T>& ego_accel_command,
     const IdmPlannerParameters<T>& idm_params,
     const MobilPlannerParameters<T>& mobil_params,
     const RoadPosition& ego_rp,
@@ -155,7 +162,8 @@ void MobilPlanner<T>::ImplCalcLaneDirection(
         RoadOdometry<T>(ego_position, ego_velocity), 0.);
     const std::pair<T, T> incentives =
         ComputeIncentives(lanes, idm_params, mobil_params, ego_closest_pose,
-                          ego_pose, traffic_poses, ego_accel_command[0]);
+                          ego_pose, traffic_poses, indexed_traffic,
+                          ego_accel_command[0]);
     // Switch to the lane with the highest incentive score greater than zero,
     // staying in the same lane if under the threshold.
     const T threshold = mobil_params.threshold();
@@ -175,15 +183,26 @@ const std::pair<T, T> MobilPlanner<T>::ComputeIncentives(
     const IdmPlannerParameters<T>& idm_params,
     const MobilPlannerParameters<T>& mobil_params,
     const ClosestPose<T>& ego_closest_pose, const PoseVector<T>& ego_pose,
-    const PoseBundle<T>& traffic_poses, const T& ego_acceleration) const {
+    const PoseBundle<T>& traffic_poses, const TrafficIndex<T>* indexed_traffic,
+    const T& ego_acceleration) const {
   // Initially disincentivize both neighboring lane options.  N.B. The first and
   // second elements correspond to the left and right lanes, respectively.
   std::pair<T, T> incentives(-kDefaultLargeAccel, -kDefaultLargeAccel);
 
+  // Finds the closest leading and trailing cars in `lane`.
+  auto find_closest_pair = [&](const Lane* lane) {
+    return (indexed_traffic != nullptr)
+               ? PoseSelector<T>::FindClosestPair(
+                     lane, ego_pose, *indexed_traffic,
+                     idm_params.scan_ahead_distance(), ScanStrategy::kPath)
+               : PoseSelector<T>::FindClosestPair(
+                     lane, ego_pose, traffic_poses,
+                     idm_params.scan_ahead_distance(), ScanStrategy::kPath);
+  };
+
   DRAKE_DEMAND(ego_closest_pose.odometry.lane != nullptr);
-  const ClosestPoses current_closest_poses = PoseSelector<T>::FindClosestPair(
-      ego_closest_pose.odometry.lane, ego_pose, traffic_poses,
-      idm_params.scan_ahead_distance(), ScanStrategy::kPath);
+  const ClosestPoses current_closest_poses =
+      find_closest_pair(ego_closest_pose.odometry.lane);
   // Construct ClosestPose containers for the leading, trailing, and ego car.
   const ClosestPose<T>& leading_closest_pose =
       current_closest_poses.at(AheadOrBehind::kAhead);
@@ -201,19 +220,14 @@ const std::pair<T, T> MobilPlanner<T>::ComputeIncentives(
       trailing_this_new_accel - trailing_this_old_accel;
   // Compute the incentive for the left lane.
   if (lanes.first != nullptr) {
-    const ClosestPoses left_closest_poses = PoseSelector<T>::FindClosestPair(
-        lanes.first, ego_pose, traffic_poses, idm_params.scan_ahead_distance(),
-        ScanStrategy::kPath);
+    const ClosestPoses left_closest_poses = find_closest_pair(lanes.first);
     ComputeIncentiveOutOfLane(idm_params, mobil_params, left_closest_poses,
                               ego_closest_pose, ego_acceleration,
                               trailing_delta_accel_this, &incentives.first);
   }
   // Compute the incentive for the right lane.
   if (lanes.second != nullptr) {
-    const ClosestPoses right_closest_poses =
-        PoseSelector<T>::FindClosestPair(lanes.second, ego_pose, traffic_poses,
-                                         idm_params.scan_ahead_distance(),
-                                         ScanStrategy::kPath);
+    const ClosestPoses right_closest_poses = find_closest_pair(lanes.second);
     ComputeIncentiveOutOfLane(idm_params, mobil_params, right_closest_poses,
                               ego_closest_pose, ego_acceleration,
                               trailing_delta_accel_this, &incentives.second);
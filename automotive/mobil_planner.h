@@ -16,6 +16,7 @@
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/automotive/pose_selector.h"
 #include "drake/automotive/road_odometry.h"
+#include "drake/automotive/traffic_index.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/rendering/pose_bundle.h"
@@ -66,7 +67,8 @@ namespace automotive {
 ///   (InputPortDescriptor getter: ego_acceleration_input())
 ///
 /// Input Port 3: A PoseBundle for the traffic cars, possibly including the ego
-///   car's pose.
+///   car's pose, or a TrafficIndex of those poses over the same road (e.g. the
+///   output of a TrafficIndexer shared by several planners).
 ///   (InputPortDescriptor getter: traffic_input())
 ///
 /// Output Port 0: A LaneDirection containing a lane that the ego vehicle must
@@ -139,6 +141,7 @@ class MobilPlanner : public systems::LeafSystem<T> {
       const systems::rendering::PoseVector<T>& ego_pose,
       const systems::rendering::FrameVelocity<T>& ego_velocity,
       const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficIndex<T>* indexed_traffic,
       const systems::BasicVector<T>& ego_accel_command,
       const IdmPlannerParameters<T>& idm_params,
       const MobilPlannerParameters<T>& mobil_params,
@@ -158,6 +161,7 @@ class MobilPlanner : public systems::LeafSystem<T> {
       const ClosestPose<T>& ego_closest_pose,
       const systems::rendering::PoseVector<T>& ego_pose,
       const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficIndex<T>* indexed_traffic,
       const T& ego_acceleration) const;
 
   // Computes a pair of incentive measures that consider the leading and
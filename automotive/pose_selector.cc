@@ -224,13 +224,15 @@ GeoPosition MakeGeoPosition(const Isometry3<T>& isometry) {
 
 // Returns the closest pose to the ego car along the default path given a
 // `lane`, the ego vehicle's pose `ego_pose`, a PoseBundle of `traffic_poses`,
-// the AheadOrBehind specifier `side`.  The return value is the same as
+// the AheadOrBehind specifier `side`.  If `traffic_index` is non-null, it must
+// index `traffic_poses`, and only the cars it places in each scanned lane are
+// visited.  The return value is the same as
 // PoseSelector<T>::FindSingleClosestPose().
 template <typename T>
 ClosestPose<T> FindSingleClosestInDefaultPath(
     const Lane* lane, const PoseVector<T>& ego_pose,
     const PoseBundle<T>& traffic_poses, const T& scan_distance,
-    const AheadOrBehind side) {
+    const AheadOrBehind side, const TrafficIndex<T>* traffic_index) {
   using std::abs;
 
   DRAKE_DEMAND(lane != nullptr);
@@ -260,17 +262,10 @@ ClosestPose<T> FindSingleClosestInDefaultPath(
   while (distance_scanned < scan_distance) {
     T distance_increment{0.};
 
-    for (int i = 0; i < traffic_poses.get_num_poses(); ++i) {
-      const Isometry3<T> traffic_isometry = traffic_poses.get_pose(i);
-      const GeoPositionT<T> traffic_geo_position =
-          GeoPositionT<T>::FromXyz(traffic_isometry.translation());
-
-      if (ego_geo_position == traffic_geo_position) continue;
-      if (!IsWithinLane(traffic_geo_position, lane_direction.lane)) continue;
-
-      const LanePositionT<T> traffic_lane_position =
-          lane_direction.lane->ToLanePositionT<T>(traffic_geo_position, nullptr,
-                                                  nullptr);
+    // Considers the car at index `i` of `traffic_poses`, located at
+    // `traffic_lane_position` in the current lane.
+    auto consider_car = [&](int i,
+                            const LanePositionT<T>& traffic_lane_position) {
       const T traffic_s =
           CalcLaneProgress<T>(lane_direction, traffic_lane_position);
 
@@ -281,8 +276,8 @@ ClosestPose<T> FindSingleClosestInDefaultPath(
       // treated as `kBehind` cars.  Note that this check is only needed when
       // the two share the same lane or, equivalently, `distance_scanned <= 0`.
       if (distance_scanned <= T(0.)) {
-        if (s_delta < 0.) continue;
-        if (side == AheadOrBehind::kAhead && s_delta == 0.) continue;
+        if (s_delta < 0.) return;
+        if (side == AheadOrBehind::kAhead && s_delta == 0.) return;
       }
 
       // Ignore positions at the desired direction (ahead or behind) of the ego
@@ -291,13 +286,35 @@ ClosestPose<T> FindSingleClosestInDefaultPath(
           result.odometry.pos.s() - traffic_lane_position.s();
       const T s_improvement =
           (ego_with_s) ? s_solution_difference : -s_solution_difference;
-      if (s_improvement < 0.) continue;
+      if (s_improvement < 0.) return;
 
       // Update the result and incremental distance with the new candidate.
       result.odometry =
           RoadOdometry<T>(lane_direction.lane, traffic_lane_position,
                           traffic_poses.get_velocity(i));
       distance_increment = traffic_s;
+    };
+
+    if (traffic_index != nullptr) {
+      for (const auto& car :
+           traffic_index->GetCarsInLane(lane_direction.lane)) {
+        const GeoPositionT<T> traffic_geo_position = GeoPositionT<T>::FromXyz(
+            traffic_poses.get_pose(car.index).translation());
+        if (ego_geo_position == traffic_geo_position) continue;
+        consider_car(car.index, car.lane_position);
+      }
+    } else {
+      for (int i = 0; i < traffic_poses.get_num_poses(); ++i) {
+        const Isometry3<T> traffic_isometry = traffic_poses.get_pose(i);
+        const GeoPositionT<T> traffic_geo_position =
+            GeoPositionT<T>::FromXyz(traffic_isometry.translation());
+
+        if (ego_geo_position == traffic_geo_position) continue;
+        if (!IsWithinLane(traffic_geo_position, lane_direction.lane)) continue;
+
+        consider_car(i, lane_direction.lane->ToLanePositionT<T>(
+                            traffic_geo_position, nullptr, nullptr));
+      }
     }
 
     if (abs(result.odometry.pos.s()) < std::numeric_limits<T>::infinity()) {
@@ -337,14 +354,16 @@ using LaneEndDistance = std::pair<const T, const maliput::api::LaneEnd>;
 
 // Returns the closest pose to the ego car given a `lane`, the ego vehicle's
 // pose `ego_pose`, a PoseBundle of `traffic_poses`, the AheadOrBehind specifier
-// `side`, and a set of `branches` to be checked.  The return value is the same
-// as PoseSelector<T>::FindSingleClosestPose().
+// `side`, and a set of `branches` to be checked.  If `traffic_index` is
+// non-null, it must index `traffic_poses`, and supplies the lane of each car.
+// The return value is the same as PoseSelector<T>::FindSingleClosestPose().
 template <typename T>
 ClosestPose<T> FindSingleClosestInBranches(
     const Lane* ego_lane, const PoseVector<T>& ego_pose,
     const PoseBundle<T>& traffic_poses, const T& scan_distance,
     const AheadOrBehind side,
-    const std::vector<LaneEndDistance<T>>& branches) {
+    const std::vector<LaneEndDistance<T>>& branches,
+    const TrafficIndex<T>* traffic_index) {
   using std::abs;
   using std::min;
 
@@ -364,9 +383,11 @@ ClosestPose<T> FindSingleClosestInBranches(
   for (int i = 0; i < traffic_poses.get_num_poses(); ++i) {
     const Isometry3<T> traffic_isometry = traffic_poses.get_pose(i);
     const Lane* const traffic_lane =
-        ego_lane->segment()->junction()->road_geometry()->ToRoadPosition(
-            MakeGeoPosition<T>(traffic_isometry), nullptr, nullptr,
-            nullptr).lane;
+        (traffic_index != nullptr)
+            ? traffic_index->GetRoadLane(i)
+            : ego_lane->segment()->junction()->road_geometry()->ToRoadPosition(
+                  MakeGeoPosition<T>(traffic_isometry), nullptr, nullptr,
+                  nullptr).lane;
     // TODO(jadecastro) Supply a valid hint.
     if (traffic_lane == nullptr) continue;
 
@@ -523,15 +544,49 @@ std::map<AheadOrBehind, const ClosestPose<T>> PoseSelector<T>::FindClosestPair(
   return result;
 }
 
+template <typename T>
+std::map<AheadOrBehind, const ClosestPose<T>> PoseSelector<T>::FindClosestPair(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const TrafficIndex<T>& traffic_index, const T& scan_distance,
+    ScanStrategy path_or_branches) {
+  std::map<AheadOrBehind, const ClosestPose<T>> result;
+  for (auto side : {AheadOrBehind::kAhead, AheadOrBehind::kBehind}) {
+    result.insert(std::make_pair(
+        side, FindSingleClosestPose(lane, ego_pose, traffic_index,
+                                    scan_distance, side, path_or_branches)));
+  }
+  return result;
+}
+
 template <typename T>
 ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
     const Lane* lane, const PoseVector<T>& ego_pose,
     const PoseBundle<T>& traffic_poses, const T& scan_distance,
     const AheadOrBehind side, ScanStrategy path_or_branches) {
+  return FindSingleClosestPose(lane, ego_pose, traffic_poses, nullptr,
+                               scan_distance, side, path_or_branches);
+}
+
+template <typename T>
+ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const TrafficIndex<T>& traffic_index, const T& scan_distance,
+    const AheadOrBehind side, ScanStrategy path_or_branches) {
+  return FindSingleClosestPose(lane, ego_pose, traffic_index.poses(),
+                               &traffic_index, scan_distance, side,
+                               path_or_branches);
+}
+
+template <typename T>
+ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const PoseBundle<T>& traffic_poses, const TrafficIndex<T>* traffic_index,
+    const T& scan_distance, const AheadOrBehind side,
+    ScanStrategy path_or_branches) {
   // Find any leading traffic cars along the same default path as the ego
   // vehicle.
   const ClosestPose<T> result_in_path = FindSingleClosestInDefaultPath(
-      lane, ego_pose, traffic_poses, scan_distance, side);
+      lane, ego_pose, traffic_poses, scan_distance, side, traffic_index);
   if (path_or_branches == ScanStrategy::kPath) return result_in_path;
 
   const std::vector<LaneEndDistance<T>> branches =
@@ -541,7 +596,8 @@ ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
   // Find any leading traffic cars in lanes leading into the ego vehicle's
   // default path.
   const ClosestPose<T> result_in_branch = FindSingleClosestInBranches(
-      lane, ego_pose, traffic_poses, scan_distance, side, branches);
+      lane, ego_pose, traffic_poses, scan_distance, side, branches,
+      traffic_index);
 
   if (result_in_path.distance <= result_in_branch.distance) {
     return result_in_path;
@@ -11,6 +11,7 @@
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/automotive/road_odometry.h"
+#include "drake/automotive/traffic_index.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/systems/rendering/pose_bundle.h"
@@ -118,6 +119,18 @@ class PoseSelector {
       const systems::rendering::PoseBundle<T>& traffic_poses,
       const T& scan_distance, ScanStrategy path_or_branches);
 
+  /// Same as the PoseBundle variant of PoseSelector::FindClosestPair(), but
+  /// the traffic poses are those of @p traffic_index, which must be built over
+  /// the RoadGeometry of @p lane.  Only the indexed cars in each lane scanned
+  /// are visited, so that one TrafficIndex amortizes the localization of all
+  /// traffic cars over the queries of many ego cars.  The result is the same
+  /// as for `traffic_index.poses()`.
+  static std::map<AheadOrBehind, const ClosestPose<T>> FindClosestPair(
+      const maliput::api::Lane* lane,
+      const systems::rendering::PoseVector<T>& ego_pose,
+      const TrafficIndex<T>& traffic_index, const T& scan_distance,
+      ScanStrategy path_or_branches);
+
   /// Same as PoseSelector::FindClosestPair() except that it returns a single
   /// ClosestPose for either the vehicle ahead (AheadOrBehind::kAhead) or behind
   /// (AheadOrBehind::kBehind).
@@ -138,6 +151,15 @@ class PoseSelector {
       const T& scan_distance, const AheadOrBehind side,
       ScanStrategy path_or_branches);
 
+  /// Same as the PoseBundle variant of PoseSelector::FindSingleClosestPose(),
+  /// but the traffic poses are those of @p traffic_index; see the
+  /// TrafficIndex variant of PoseSelector::FindClosestPair().
+  static ClosestPose<T> FindSingleClosestPose(
+      const maliput::api::Lane* lane,
+      const systems::rendering::PoseVector<T>& ego_pose,
+      const TrafficIndex<T>& traffic_index, const T& scan_distance,
+      const AheadOrBehind side, ScanStrategy path_or_branches);
+
   /// Extracts the vehicle's `s`-direction velocity based on its RoadOdometry @p
   /// road_odometry in the Lane coordinate frame.  Assumes the road has zero
   /// elevation and superelevation.  Throws if any element of
@@ -150,6 +172,16 @@ class PoseSelector {
   // TODO(jadecastro) Enable AutoDiffXd for
   // maliput::api::Lane::GetOrientation().
   static T GetSigmaVelocity(const RoadOdometry<T>& road_odometry);
+
+ private:
+  // Implements both variants of FindSingleClosestPose(); `traffic_index` is
+  // nullptr or indexes `traffic_poses`.
+  static ClosestPose<T> FindSingleClosestPose(
+      const maliput::api::Lane* lane,
+      const systems::rendering::PoseVector<T>& ego_pose,
+      const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficIndex<T>* traffic_index, const T& scan_distance,
+      const AheadOrBehind side, ScanStrategy path_or_branches);
 };
 
 }  // namespace automotive
@@ -1,5 +1,9 @@
 #include "drake/automotive/road_path.h"
 
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "drake/automotive/maliput/api/branch_point.h"
@@ -20,20 +24,80 @@ using maliput::api::LaneEndSet;
 using maliput::api::RoadGeometry;
 using trajectories::PiecewisePolynomial;
 
+template <typename T>
+RoadPathCache<T>::RoadPathCache() {}
+
+template <typename T>
+RoadPathCache<T>::~RoadPathCache() {}
+
+template <typename T>
+int RoadPathCache<T>::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(curves_.size());
+}
+
+template <typename T>
+void RoadPathCache<T>::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  curves_.clear();
+}
+
+template <typename T>
+template <typename MakeCurves>
+std::shared_ptr<const internal::RoadPathCurves<T>> RoadPathCache<T>::GetOrMake(
+    const Key& key, const MakeCurves& make) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = curves_.find(key);
+    if (it != curves_.end()) return it->second;
+  }
+  // The path is built without the lock held, so that threads building
+  // different paths do not wait on each other.  Should two threads build the
+  // same path, the first one stored wins.
+  std::shared_ptr<const internal::RoadPathCurves<T>> curves = make();
+  std::lock_guard<std::mutex> lock(mutex_);
+  return curves_.emplace(key, std::move(curves)).first->second;
+}
+
 template <typename T>
 RoadPath<T>::RoadPath(const LaneDirection& initial_lane_direction,
                       const T& step_size, int num_breaks)
-    : path_(MakePiecewisePolynomial(initial_lane_direction, step_size,
-                                    num_breaks)),
-      path_prime_(path_.derivative(1 /* 1st derivative */)),
-      path_double_prime_(path_.derivative(2 /* 2nd derivative */)) {}
+    : RoadPath(initial_lane_direction, step_size, num_breaks, nullptr) {}
+
+template <typename T>
+RoadPath<T>::RoadPath(const LaneDirection& initial_lane_direction,
+                      const T& step_size, int num_breaks,
+                      RoadPathCache<T>* cache) {
+  if (cache == nullptr) {
+    curves_ = MakeCurves(initial_lane_direction, step_size, num_breaks);
+  } else {
+    curves_ = cache->GetOrMake(
+        std::make_tuple(initial_lane_direction.lane,
+                        initial_lane_direction.with_s, step_size, num_breaks),
+        [&]() {
+          return MakeCurves(initial_lane_direction, step_size, num_breaks);
+        });
+  }
+}
 
 template <typename T>
 RoadPath<T>::~RoadPath() {}
 
 template <typename T>
 const PiecewisePolynomial<T>& RoadPath<T>::get_path() const {
-  return path_;
+  return curves_->path;
+}
+
+template <typename T>
+std::shared_ptr<const internal::RoadPathCurves<T>> RoadPath<T>::MakeCurves(
+    const LaneDirection& initial_lane_direction, const T& step_size,
+    int num_breaks) {
+  auto curves = std::make_shared<internal::RoadPathCurves<T>>();
+  curves->path = MakePiecewisePolynomial(initial_lane_direction, step_size,
+                                         num_breaks);
+  curves->path_prime = curves->path.derivative(1 /* 1st derivative */);
+  curves->path_double_prime = curves->path.derivative(2 /* 2nd derivative */);
+  return curves;
 }
 
 template <typename T>
@@ -46,7 +110,7 @@ const T RoadPath<T>::GetClosestPathPosition(const Vector3<T>& geo_pos,
 template <typename T>
 const PiecewisePolynomial<T> RoadPath<T>::MakePiecewisePolynomial(
     const LaneDirection& initial_lane_direction, const T& step_size,
-    int num_breaks) const {
+    int num_breaks) {
   std::vector<T> s_breaks{};
   std::vector<MatrixX<T>> geo_knots(num_breaks, MatrixX<T>::Zero(3, 1));
 
@@ -105,6 +169,7 @@ const PiecewisePolynomial<T> RoadPath<T>::MakePiecewisePolynomial(
   return PiecewisePolynomial<T>::Cubic(s_breaks, geo_knots);
 }
 
+template class RoadPathCache<double>;
 template class RoadPath<double>;
 
 }  // namespace automotive
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 #include "drake/automotive/lane_direction.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/common/drake_copyable.h"
@@ -9,6 +14,66 @@
 namespace drake {
 namespace automotive {
 
+template <typename T>
+class RoadPath;
+
+namespace internal {
+// The path of a RoadPath and its derivatives, which are immutable once built
+// and thus shared by all the RoadPaths of the same lanes and sampling.
+template <typename T>
+struct RoadPathCurves {
+  trajectories::PiecewisePolynomial<T> path;
+  trajectories::PiecewisePolynomial<T> path_prime;
+  trajectories::PiecewisePolynomial<T> path_double_prime;
+};
+}  // namespace internal
+
+/// RoadPathCache holds the paths built by the RoadPaths that are given it, so
+/// that RoadPaths starting from the same LaneDirection with the same step
+/// size and number of breaks share a single path rather than each sampling
+/// the lanes again.  This is worthwhile when many cars follow the same
+/// routes.
+///
+/// Paths are looked up by the address of their initial lane, so a cache must
+/// only be used with the lanes of a single RoadGeometry and must not outlive
+/// it.  A cache may be used from several threads at once.
+///
+/// This class is explicitly instantiated for the following scalar types. No
+/// other scalar types are supported.
+/// - double
+///
+/// @tparam T The vector element type, which must be a valid Eigen scalar.
+///           Only double is supported.
+template <typename T>
+class RoadPathCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RoadPathCache)
+
+  RoadPathCache();
+  ~RoadPathCache();
+
+  /// Returns the number of distinct paths held.
+  int size() const;
+
+  /// Discards all the paths held.  The RoadPaths that were given them keep
+  /// them.
+  void Clear();
+
+ private:
+  friend class RoadPath<T>;
+
+  using Key = std::tuple<const maliput::api::Lane*, bool, T, int>;
+
+  // Returns the curves held for @p key, first storing the result of
+  // @p make() if there are none.
+  template <typename MakeCurves>
+  std::shared_ptr<const internal::RoadPathCurves<T>> GetOrMake(
+      const Key& key, const MakeCurves& make);
+
+  mutable std::mutex mutex_;
+  std::map<Key, std::shared_ptr<const internal::RoadPathCurves<T>>> curves_;
+};
+
 /// RoadPath converts a sequence of Maliput Lanes into a PiecewisePolynomial for
 /// the purpose of generating a path for a car to follow.  The path is created
 /// from the start of a user-specified initial lane and direction of travel, and
@@ -40,6 +105,13 @@ class RoadPath {
   /// be evaluated.
   RoadPath(const LaneDirection& initial_lane_direction, const T& step_size,
            int num_breaks);
+
+  /// Constructs a RoadPath as above, taking its path from @p cache when a
+  /// RoadPath with the same parameters was already built through it, and
+  /// adding it to @p cache otherwise.  The path is then shared rather than
+  /// copied.  A null @p cache is ignored.
+  RoadPath(const LaneDirection& initial_lane_direction, const T& step_size,
+           int num_breaks, RoadPathCache<T>* cache);
   ~RoadPath();
 
   const trajectories::PiecewisePolynomial<T>& get_path() const;
@@ -58,18 +130,18 @@ class RoadPath {
   // If a BranchPoint is encountered in which there is more than one ongoing
   // lane, the zero-index lane is always selected.
   // TODO(jadecastro): Use Lane::GetDefaultBranch() to decide the ongoing Lane.
-  const trajectories::PiecewisePolynomial<T> MakePiecewisePolynomial(
+  static const trajectories::PiecewisePolynomial<T> MakePiecewisePolynomial(
       const LaneDirection& initial_lane_direction, const T& step_size,
-      int num_breaks) const;
-
-  // The path representing the mid-curve of the road.
-  trajectories::PiecewisePolynomial<T> path_;
+      int num_breaks);
 
-  // First derivative of path_.
-  trajectories::PiecewisePolynomial<T> path_prime_;
+  // Builds the path and its derivatives.
+  static std::shared_ptr<const internal::RoadPathCurves<T>> MakeCurves(
+      const LaneDirection& initial_lane_direction, const T& step_size,
+      int num_breaks);
 
-  // Second derivative of path_.
-  trajectories::PiecewisePolynomial<T> path_double_prime_;
+  // The path representing the mid-curve of the road, and its first and second
+  // derivatives; possibly shared with other RoadPaths through a RoadPathCache.
+  std::shared_ptr<const internal::RoadPathCurves<T>> curves_;
 };
 
 }  // namespace automotive
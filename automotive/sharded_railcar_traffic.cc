@@ -0,0 +1,380 @@
+#include "drake/automotive/sharded_railcar_traffic.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/automotive/gen/maliput_railcar_state.h"
+#include "drake/automotive/maliput/api/junction.h"
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/segment.h"
+#include "drake/automotive/maliput_railcar_fleet.h"
+#include "drake/common/drake_assert.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace automotive {
+
+using maliput::api::GeoPosition;
+using maliput::api::Lane;
+using maliput::api::LanePosition;
+using std::runtime_error;
+
+namespace {
+
+// The step size of the integration within a macro step, as in
+// AutomotiveSimulator.
+constexpr double kIntegrationStep = 0.01;
+
+bool ById(const ShardedRailcar& a, const ShardedRailcar& b) {
+  return a.id < b.id;
+}
+
+}  // namespace
+
+RoadShardPartition::RoadShardPartition(
+    std::vector<Eigen::AlignedBox2d> regions)
+    : regions_(std::move(regions)) {
+  if (regions_.empty()) {
+    throw runtime_error("RoadShardPartition: there are no regions.");
+  }
+  for (const Eigen::AlignedBox2d& region : regions_) {
+    if (region.isEmpty()) {
+      throw runtime_error("RoadShardPartition: a region is empty.");
+    }
+  }
+}
+
+RoadShardPartition RoadShardPartition::MakeStrips(
+    const Eigen::AlignedBox2d& bounds, int num_shards) {
+  if (bounds.isEmpty() || num_shards < 1) {
+    throw runtime_error(
+        "RoadShardPartition::MakeStrips: the bounds are empty or there are "
+        "no shards.");
+  }
+  int axis{};
+  bounds.sizes().maxCoeff(&axis);
+  const double width = bounds.sizes()(axis) / num_shards;
+  std::vector<Eigen::AlignedBox2d> regions;
+  for (int i = 0; i < num_shards; ++i) {
+    Eigen::AlignedBox2d region = bounds;
+    region.min()(axis) = bounds.min()(axis) + i * width;
+    if (i < num_shards - 1) {
+      region.max()(axis) = bounds.min()(axis) + (i + 1) * width;
+    }
+    regions.push_back(region);
+  }
+  return RoadShardPartition(std::move(regions));
+}
+
+const Eigen::AlignedBox2d& RoadShardPartition::region(int shard) const {
+  DRAKE_DEMAND(0 <= shard && shard < num_shards());
+  return regions_[shard];
+}
+
+int RoadShardPartition::FindShard(const GeoPosition& geo_position) const {
+  int nearest_shard{0};
+  double nearest_distance = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < num_shards(); ++i) {
+    const double distance = Distance(i, geo_position);
+    if (distance == 0.) {
+      return i;
+    }
+    if (distance < nearest_distance) {
+      nearest_shard = i;
+      nearest_distance = distance;
+    }
+  }
+  return nearest_shard;
+}
+
+double RoadShardPartition::Distance(int shard,
+                                    const GeoPosition& geo_position) const {
+  const Eigen::Vector2d xy(geo_position.x(), geo_position.y());
+  return region(shard).exteriorDistance(xy);
+}
+
+ShardedRailcarTraffic::ShardedRailcarTraffic(
+    const maliput::api::RoadGeometry* road,
+    const RoadShardPartition& partition, int shard, double macro_step,
+    double halo, lcm::DrakeLcmInterface* lcm, const std::string& channel)
+    : road_(road),
+      partition_(partition),
+      shard_(shard),
+      macro_step_(macro_step),
+      halo_(halo),
+      lcm_(lcm),
+      channel_(channel) {
+  if (road_ == nullptr || lcm_ == nullptr) {
+    throw runtime_error(
+        "ShardedRailcarTraffic: the road and the LCM must not be nullptr.");
+  }
+  if (shard_ < 0 || shard_ >= partition_.num_shards()) {
+    throw runtime_error("ShardedRailcarTraffic: the shard " +
+                        std::to_string(shard_) + " is not in the partition.");
+  }
+  if (!(macro_step_ > 0.) || !(halo_ >= 0.)) {
+    throw runtime_error(
+        "ShardedRailcarTraffic: the macro step must be positive and the halo "
+        "non-negative.");
+  }
+  for (int i = 0; i < road_->num_junctions(); ++i) {
+    const maliput::api::Junction* junction = road_->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const maliput::api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const Lane* lane = segment->lane(k);
+        lanes_.emplace(lane->id().string(), lane);
+      }
+    }
+  }
+  lcm_->Subscribe(channel_, [this](const void* message_bytes,
+                                   int message_size) {
+    this->HandleMessage(message_bytes, message_size);
+  });
+}
+
+bool ShardedRailcarTraffic::AddCar(const ShardedRailcar& car) {
+  DRAKE_DEMAND(macro_step_index_ == 0 && !published_);
+  const Lane* lane = car.lane_direction.lane;
+  if (lane == nullptr) {
+    throw runtime_error("ShardedRailcarTraffic::AddCar(): the lane of car " +
+                        std::to_string(car.id) + " is nullptr.");
+  }
+  const auto it = lanes_.find(lane->id().string());
+  if (it == lanes_.end() || it->second != lane) {
+    throw runtime_error("ShardedRailcarTraffic::AddCar(): the lane of car " +
+                        std::to_string(car.id) + " is not part of the road.");
+  }
+  const auto position =
+      std::lower_bound(cars_.begin(), cars_.end(), car, ById);
+  if (position != cars_.end() && position->id == car.id) {
+    throw runtime_error("ShardedRailcarTraffic::AddCar(): the car " +
+                        std::to_string(car.id) + " was already added.");
+  }
+  if (partition_.FindShard(CalcGeoPosition(car)) != shard_) {
+    return false;
+  }
+  cars_.insert(position, car);
+  return true;
+}
+
+void ShardedRailcarTraffic::Publish() {
+  DRAKE_DEMAND(!published_);
+  lcmt_railcar_shard_step message{};
+  message.timestamp = static_cast<int64_t>(time() * 1e3);
+  message.shard = shard_;
+  message.macro_step = macro_step_index_;
+  const auto add_car = [&message](const ShardedRailcar& car, int owner) {
+    lcmt_railcar_shard_car car_message{};
+    car_message.id = car.id;
+    car_message.owner = owner;
+    car_message.lane_id = car.lane_direction.lane->id().string();
+    car_message.with_s = car.lane_direction.with_s;
+    car_message.s = car.s;
+    car_message.speed = car.speed;
+    message.cars.push_back(car_message);
+  };
+  for (const auto& handoff : handoffs_) {
+    add_car(handoff.first, handoff.second);
+  }
+  for (const ShardedRailcar& car : cars_) {
+    const GeoPosition geo_position = CalcGeoPosition(car);
+    for (int i = 0; i < partition_.num_shards(); ++i) {
+      if (i != shard_ && partition_.Distance(i, geo_position) <= halo_) {
+        add_car(car, shard_);
+        break;
+      }
+    }
+  }
+  message.num_cars = static_cast<int32_t>(message.cars.size());
+  published_ = true;
+  lcm::Publish(lcm_, channel_, message, time());
+}
+
+bool ShardedRailcarTraffic::ReadyToAdvance() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ReadyToAdvanceLocked();
+}
+
+bool ShardedRailcarTraffic::ReadyToAdvanceLocked() const {
+  const int num_other_shards = partition_.num_shards() - 1;
+  if (num_other_shards == 0) {
+    return true;
+  }
+  const auto it = inbox_.find(macro_step_index_);
+  return it != inbox_.end() &&
+         static_cast<int>(it->second.size()) == num_other_shards;
+}
+
+void ShardedRailcarTraffic::Advance() {
+  if (!published_) {
+    throw runtime_error(
+        "ShardedRailcarTraffic::Advance(): Publish() was not called for this "
+        "macro step.");
+  }
+  std::map<int, lcmt_railcar_shard_step> messages;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ReadyToAdvanceLocked()) {
+      throw runtime_error(
+          "ShardedRailcarTraffic::Advance(): the messages of the other shards "
+          "have not all been received.");
+    }
+    const auto it = inbox_.find(macro_step_index_);
+    if (it != inbox_.end()) {
+      messages = std::move(it->second);
+      inbox_.erase(it);
+    }
+  }
+
+  // Adopt the cars handed off to this shard, and collect the ghosts. The
+  // messages are ordered by shard, and the cars by id, so that the result
+  // does not depend on the order of arrival.
+  std::vector<ShardedRailcar> ghosts;
+  for (const auto& shard_message : messages) {
+    for (const lcmt_railcar_shard_car& car_message :
+         shard_message.second.cars) {
+      const ShardedRailcar car = DecodeCar(car_message);
+      if (car_message.owner == shard_) {
+        cars_.push_back(car);
+      } else if (partition_.Distance(shard_, CalcGeoPosition(car)) <= halo_) {
+        ghosts.push_back(car);
+      }
+    }
+  }
+  // The cars that this shard just handed off are not shown by their new
+  // owners until the next macro step, so they remain ghosts here.
+  for (const auto& handoff : handoffs_) {
+    if (partition_.Distance(shard_, CalcGeoPosition(handoff.first)) <=
+        halo_) {
+      ghosts.push_back(handoff.first);
+    }
+  }
+  handoffs_.clear();
+  std::sort(cars_.begin(), cars_.end(), ById);
+  std::sort(ghosts.begin(), ghosts.end(), ById);
+
+  // Simulate the owned cars and the ghosts, in order of id, over the macro
+  // step.
+  std::vector<ShardedRailcar> simulated;
+  std::merge(cars_.begin(), cars_.end(), ghosts.begin(), ghosts.end(),
+             std::back_inserter(simulated), ById);
+  if (!simulated.empty()) {
+    std::vector<LaneDirection> lane_directions;
+    for (const ShardedRailcar& car : simulated) {
+      lane_directions.push_back(car.lane_direction);
+    }
+    const MaliputRailcarFleet<double> fleet(lane_directions);
+    auto context = fleet.CreateDefaultContext();
+    context->set_time(time());
+    fleet.get_mutable_railcar_parameters(context.get())
+        .set_value(railcar_params_.get_value());
+    fleet.get_mutable_idm_parameters(context.get())
+        .set_value(idm_params_.get_value());
+    MaliputRailcarState<double> car_state;
+    for (int i = 0; i < fleet.num_cars(); ++i) {
+      car_state.set_s(simulated[i].s);
+      car_state.set_speed(simulated[i].speed);
+      fleet.SetCarState(context.get(), i, car_state);
+    }
+
+    systems::Simulator<double> simulator(fleet, std::move(context));
+    simulator.reset_integrator<systems::RungeKutta2Integrator<double>>(
+        fleet, kIntegrationStep, &simulator.get_mutable_context());
+    simulator.get_mutable_integrator()->set_fixed_step_mode(true);
+    simulator.Initialize();
+    simulator.StepTo(time() + macro_step_);
+
+    // Keep the owned cars, which are a subsequence of the simulated ones.
+    const systems::Context<double>& final_context = simulator.get_context();
+    auto owned = cars_.begin();
+    for (int i = 0; i < fleet.num_cars() && owned != cars_.end(); ++i) {
+      if (simulated[i].id != owned->id) continue;
+      fleet.GetCarState(final_context, i, &car_state);
+      owned->lane_direction = fleet.GetCarLaneDirection(final_context, i);
+      owned->s = car_state.s();
+      owned->speed = car_state.speed();
+      ++owned;
+    }
+  }
+
+  // Hand off the cars that left this shard's region.
+  std::vector<ShardedRailcar> kept;
+  for (const ShardedRailcar& car : cars_) {
+    const int owner = partition_.FindShard(CalcGeoPosition(car));
+    if (owner == shard_) {
+      kept.push_back(car);
+    } else {
+      handoffs_.emplace_back(car, owner);
+    }
+  }
+  cars_ = std::move(kept);
+
+  ++macro_step_index_;
+  published_ = false;
+}
+
+void ShardedRailcarTraffic::Step(double timeout_sec) {
+  Publish();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const bool ready = received_.wait_for(
+        lock, std::chrono::duration<double>(timeout_sec),
+        [this]() { return this->ReadyToAdvanceLocked(); });
+    if (!ready) {
+      throw runtime_error(
+          "ShardedRailcarTraffic::Step(): timed out waiting for the other "
+          "shards at macro step " + std::to_string(macro_step_index_) + ".");
+    }
+  }
+  Advance();
+}
+
+void ShardedRailcarTraffic::HandleMessage(const void* message_bytes,
+                                          int message_size) {
+  lcmt_railcar_shard_step message;
+  const int status = message.decode(message_bytes, 0, message_size);
+  if (status < 0) {
+    throw runtime_error(
+        "ShardedRailcarTraffic: failed to decode an LCM message, the status "
+        "is " + std::to_string(status) + ".");
+  }
+  if (message.shard == shard_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    inbox_[message.macro_step][message.shard] = std::move(message);
+  }
+  received_.notify_all();
+}
+
+GeoPosition ShardedRailcarTraffic::CalcGeoPosition(
+    const ShardedRailcar& car) const {
+  return car.lane_direction.lane->ToGeoPosition(LanePosition(car.s, 0., 0.));
+}
+
+ShardedRailcar ShardedRailcarTraffic::DecodeCar(
+    const lcmt_railcar_shard_car& message) const {
+  const auto it = lanes_.find(message.lane_id);
+  if (it == lanes_.end()) {
+    throw runtime_error("ShardedRailcarTraffic: the lane " + message.lane_id +
+                        " of car " + std::to_string(message.id) +
+                        " is not part of the road.");
+  }
+  ShardedRailcar car;
+  car.id = message.id;
+  car.lane_direction = LaneDirection(it->second, message.with_s);
+  car.s = message.s;
+  car.speed = message.speed;
+  return car;
+}
+
+}  // namespace automotive
+}  // namespace drake
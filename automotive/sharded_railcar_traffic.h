@@ -0,0 +1,237 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include "drake/automotive/gen/idm_planner_parameters.h"
+#include "drake/automotive/gen/maliput_railcar_params.h"
+#include "drake/automotive/lane_direction.h"
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/lcm/drake_lcm_interface.h"
+#include "drake/lcmt_railcar_shard_step.hpp"
+
+namespace drake {
+namespace automotive {
+
+/// Partitions the world `x`-`y` plane into the regions owned by the shards of
+/// a ShardedRailcarTraffic simulation.  Each region is an axis-aligned box.  A
+/// point belongs to the first region that contains it or, outside of every
+/// region, to the nearest one, so that every car has exactly one owner.
+class RoadShardPartition {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RoadShardPartition)
+
+  /// Constructs a partition with one shard per box of @p regions.
+  ///
+  /// @throws std::runtime_error if @p regions is empty, or if one of its
+  /// boxes is empty.
+  explicit RoadShardPartition(std::vector<Eigen::AlignedBox2d> regions);
+
+  /// Returns a partition of @p bounds into @p num_shards strips of equal
+  /// width across its longest axis.
+  ///
+  /// @throws std::runtime_error if @p bounds is empty or if
+  /// `num_shards < 1`.
+  static RoadShardPartition MakeStrips(const Eigen::AlignedBox2d& bounds,
+                                       int num_shards);
+
+  /// Returns the number of shards.
+  int num_shards() const { return static_cast<int>(regions_.size()); }
+
+  /// Returns the region of @p shard.
+  const Eigen::AlignedBox2d& region(int shard) const;
+
+  /// Returns the shard that owns @p geo_position.
+  int FindShard(const maliput::api::GeoPosition& geo_position) const;
+
+  /// Returns the distance in the `x`-`y` plane from @p geo_position to the
+  /// region of @p shard, which is zero inside of it.
+  double Distance(int shard,
+                  const maliput::api::GeoPosition& geo_position) const;
+
+ private:
+  std::vector<Eigen::AlignedBox2d> regions_;
+};
+
+/// A vehicle of a ShardedRailcarTraffic simulation.
+struct ShardedRailcar {
+  /// The identifier of the vehicle, unique across the shards.
+  int id{};
+  LaneDirection lane_direction;
+  double s{};
+  double speed{};
+};
+
+/// ShardedRailcarTraffic runs one shard of a simulation of IDM-controlled
+/// railcars, like MaliputRailcarFleet, that is split across processes by
+/// region, so that traffic over a large road network can be spread over
+/// several nodes.
+///
+/// Each process constructs a %ShardedRailcarTraffic with the same
+/// RoadGeometry, RoadShardPartition, macro step, halo and LCM channel, and
+/// its own shard index.  A shard owns the vehicles whose lane position lies
+/// in its region.  The shards advance in lockstep, one macro step at a time:
+///
+///  1. Publish(): each shard publishes, for the start of the macro step, the
+///     vehicles that it hands off to another shard, and the vehicles that it
+///     owns within the halo distance of another shard's region.
+///  2. Once ReadyToAdvance(), i.e., once the messages of every other shard
+///     for the macro step have been received, Advance() adopts the vehicles
+///     that were handed off to this shard, and simulates the owned vehicles,
+///     along with the vehicles of the other shards within the halo as
+///     ghosts, up to the end of the macro step.  Ghosts are discarded
+///     afterwards, since their owners simulate them authoritatively.  The
+///     owned vehicles that ended up in another shard's region are handed off
+///     by the next Publish().
+///
+/// Step() does both, waiting for the other shards.  All of the vehicles that
+/// a shard simulates, and the received messages, are ordered by vehicle or
+/// shard, so the result of a run does not depend on the order in which the
+/// messages arrive.
+///
+/// For an owned vehicle to see its leader when the leader belongs to another
+/// shard, the halo should be at least the IdmPlannerParameters'
+/// `scan_ahead_distance` plus the distance that a vehicle travels in a macro
+/// step.  Within a macro step, a ghost's own leader may be missing from the
+/// shard, which is the approximation that sharding makes; a shorter macro
+/// step makes it smaller, at the cost of more messages.
+///
+/// Each macro step is integrated by a Simulator of a MaliputRailcarFleet
+/// built for the vehicles of the shard, with a fixed-step
+/// RungeKutta2Integrator, as in AutomotiveSimulator.
+class ShardedRailcarTraffic {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ShardedRailcarTraffic)
+
+  /// Constructs shard @p shard of a simulation of the vehicles on @p road.
+  ///
+  /// @param road The road, which must outlive this object.
+  /// @param partition The regions of the shards.
+  /// @param shard The index of this shard in @p partition.
+  /// @param macro_step The duration of a macro step, in seconds.
+  /// @param halo The distance from its region, in meters, within which a
+  /// shard simulates the vehicles of the other shards as ghosts.
+  /// @param lcm The LCM on which the shards exchange their vehicles, which
+  /// must outlive this object.  For Step() to receive the messages, it must
+  /// handle them on another thread, as DrakeLcm does after
+  /// DrakeLcm::StartReceiveThread().
+  /// @param channel The LCM channel shared by the shards.
+  ///
+  /// @throws std::runtime_error if @p road or @p lcm is nullptr, if
+  /// @p shard is not in @p partition, if @p macro_step is not positive, or
+  /// if @p halo is negative.
+  ShardedRailcarTraffic(const maliput::api::RoadGeometry* road,
+                        const RoadShardPartition& partition, int shard,
+                        double macro_step, double halo,
+                        lcm::DrakeLcmInterface* lcm,
+                        const std::string& channel = "RAILCAR_SHARD_STEP");
+
+  /// Returns the index of this shard.
+  int shard() const { return shard_; }
+
+  const RoadShardPartition& partition() const { return partition_; }
+
+  double macro_step() const { return macro_step_; }
+
+  /// Returns the number of macro steps taken so far.
+  int64_t macro_step_index() const { return macro_step_index_; }
+
+  /// Returns the simulated time, `macro_step() * macro_step_index()`.
+  double time() const { return macro_step_ * macro_step_index_; }
+
+  /// Returns a mutable reference to the MaliputRailcarParams shared by the
+  /// vehicles, which must be the same in every shard.
+  MaliputRailcarParams<double>& get_mutable_railcar_parameters() {
+    return railcar_params_;
+  }
+
+  /// Returns a mutable reference to the IdmPlannerParameters shared by the
+  /// vehicles, which must be the same in every shard.
+  IdmPlannerParameters<double>& get_mutable_idm_parameters() {
+    return idm_params_;
+  }
+
+  /// Adds @p car to this shard if it owns it, so that each process can be
+  /// given the whole initial traffic.  Returns true if the car was added.
+  ///
+  /// @pre Publish() has not been called.
+  /// @throws std::runtime_error if the lane of @p car is nullptr or not part
+  /// of the road, or if a car with the same id was already added.
+  bool AddCar(const ShardedRailcar& car);
+
+  /// Returns the vehicles owned by this shard, sorted by id.
+  const std::vector<ShardedRailcar>& cars() const { return cars_; }
+
+  /// Publishes the vehicles that this shard hands off or shows to the other
+  /// shards at the start of the current macro step.
+  ///
+  /// @pre Publish() has not been called since the last Advance().
+  void Publish();
+
+  /// Returns true once the messages of all of the other shards for the
+  /// current macro step have been received.
+  bool ReadyToAdvance() const;
+
+  /// Simulates the current macro step; see the class documentation.
+  ///
+  /// @throws std::runtime_error if Publish() has not been called for this
+  /// macro step or if not ReadyToAdvance().
+  void Advance();
+
+  /// Calls Publish(), waits until ReadyToAdvance(), then calls Advance().
+  ///
+  /// @throws std::runtime_error if the other shards' messages have not all
+  /// been received within @p timeout_sec seconds.
+  void Step(double timeout_sec);
+
+ private:
+  // Handles a message from the LCM; may run on another thread.
+  void HandleMessage(const void* message_bytes, int message_size);
+
+  // Returns the position in the world frame of `car`.
+  maliput::api::GeoPosition CalcGeoPosition(const ShardedRailcar& car) const;
+
+  // Returns the car that `message` describes.
+  ShardedRailcar DecodeCar(const lcmt_railcar_shard_car& message) const;
+
+  bool ReadyToAdvanceLocked() const;
+
+  const maliput::api::RoadGeometry* const road_;
+  const RoadShardPartition partition_;
+  const int shard_;
+  const double macro_step_;
+  const double halo_;
+  lcm::DrakeLcmInterface* const lcm_;
+  const std::string channel_;
+  MaliputRailcarParams<double> railcar_params_;
+  IdmPlannerParameters<double> idm_params_;
+
+  // The lanes of road_, by id.
+  std::unordered_map<std::string, const maliput::api::Lane*> lanes_;
+
+  int64_t macro_step_index_{0};
+  bool published_{false};
+  std::vector<ShardedRailcar> cars_;
+  // The cars that left this shard's region in the last macro step, and the
+  // shards that now own them.
+  std::vector<std::pair<ShardedRailcar, int>> handoffs_;
+
+  // The messages of the other shards, by macro step then shard, guarded by
+  // mutex_ since the LCM may handle them on another thread.
+  mutable std::mutex mutex_;
+  std::condition_variable received_;
+  std::map<int64_t, std::map<int, lcmt_railcar_shard_step>> inbox_;
+};
+
+}  // namespace automotive
+}  // namespace drake
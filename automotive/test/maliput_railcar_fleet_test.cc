@@ -0,0 +1,296 @@
+#include "drake/automotive/maliput_railcar_fleet.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/automotive/calc_smooth_acceleration.h"
+#include "drake/automotive/idm_planner.h"
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/maliput/dragway/road_geometry.h"
+#include "drake/automotive/maliput/monolane/builder.h"
+#include "drake/automotive/maliput_railcar.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/output_port_value.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+using maliput::monolane::Endpoint;
+using maliput::monolane::EndpointXy;
+using maliput::monolane::EndpointZ;
+using systems::rendering::PoseBundle;
+
+const double kLaneLength{50.};
+const double kTolerance{1e-12};
+
+class MaliputRailcarFleetTest : public ::testing::Test {
+ protected:
+  // Creates a one-lane dragway.
+  void InitializeDragway() {
+    road_ = std::make_unique<const maliput::dragway::RoadGeometry>(
+        maliput::api::RoadGeometryId("FleetTestDragway"), 1 /* num_lanes */,
+        kLaneLength, 4. /* lane_width */, 0. /* shoulder_width */,
+        5. /* maximum_height */,
+        std::numeric_limits<double>::epsilon() /* linear_tolerance */,
+        std::numeric_limits<double>::epsilon() /* angular_tolerance */);
+  }
+
+  // Creates a monolane road of two straight lanes along the x axis, one after
+  // the other.
+  void InitializeTwoLaneMonolane() {
+    maliput::monolane::Builder builder(
+        maliput::api::RBounds(-2, 2),   /* lane_bounds       */
+        maliput::api::RBounds(-4, 4),   /* driveable_bounds  */
+        maliput::api::HBounds(0, 5),    /* elevation bounds */
+        0.01,                           /* linear tolerance  */
+        0.5 * M_PI / 180.0);            /* angular_tolerance */
+    builder.Connect("first", Endpoint(EndpointXy(0, 0, 0),
+                                      EndpointZ(0, 0, 0, 0)),
+                    kLaneLength, EndpointZ(0, 0, 0, 0));
+    builder.Connect("second", Endpoint(EndpointXy(kLaneLength, 0, 0),
+                                       EndpointZ(0, 0, 0, 0)),
+                    kLaneLength, EndpointZ(0, 0, 0, 0));
+    road_ = builder.Build(maliput::api::RoadGeometryId("FleetTestMonolane"));
+  }
+
+  const maliput::api::Lane* lane(int junction) const {
+    return road_->junction(junction)->segment(0)->lane(0);
+  }
+
+  void InitializeFleet(const std::vector<LaneDirection>& lane_directions,
+                       const std::vector<double>& s,
+                       const std::vector<double>& speeds) {
+    dut_ = std::make_unique<MaliputRailcarFleet<double>>(lane_directions,
+                                                         kFirstId);
+    context_ = dut_->CreateDefaultContext();
+    output_ = dut_->AllocateOutput(*context_);
+    derivatives_ = dut_->AllocateTimeDerivatives();
+    MaliputRailcarState<double> car_state;
+    for (int i = 0; i < dut_->num_cars(); ++i) {
+      car_state.set_s(s[i]);
+      car_state.set_speed(speeds[i]);
+      dut_->SetCarState(context_.get(), i, car_state);
+    }
+  }
+
+  // Returns the acceleration of a MaliputRailcar commanded by an
+  // IdmController, given the headway to its leader.
+  double CalcExpectedAcceleration(double speed, double headway,
+                                  double lead_speed) const {
+    const IdmPlannerParameters<double>& idm_params =
+        dut_->get_mutable_idm_parameters(context_.get());
+    const MaliputRailcarParams<double>& params =
+        dut_->get_mutable_railcar_parameters(context_.get());
+    const double net_distance =
+        std::max(headway - idm_params.bloat_diameter(),
+                 idm_params.distance_lower_limit());
+    const double desired_acceleration = IdmPlanner<double>::Evaluate(
+        idm_params, speed, net_distance, speed - lead_speed);
+    return calc_smooth_acceleration(desired_acceleration, params.max_speed(),
+                                    params.velocity_limit_kp(), speed);
+  }
+
+  double GetS(int car) const {
+    MaliputRailcarState<double> car_state;
+    dut_->GetCarState(*context_, car, &car_state);
+    return car_state.s();
+  }
+
+  double GetSpeed(int car) const {
+    MaliputRailcarState<double> car_state;
+    dut_->GetCarState(*context_, car, &car_state);
+    return car_state.speed();
+  }
+
+  const PoseBundle<double>& GetPoses() {
+    dut_->CalcOutput(*context_, output_.get());
+    return output_->get_data(dut_->pose_output().get_index())
+        ->GetValue<PoseBundle<double>>();
+  }
+
+  static constexpr int kFirstId{5};
+  std::unique_ptr<const maliput::api::RoadGeometry> road_;
+  std::unique_ptr<MaliputRailcarFleet<double>> dut_;
+  std::unique_ptr<systems::Context<double>> context_;
+  std::unique_ptr<systems::SystemOutput<double>> output_;
+  std::unique_ptr<systems::ContinuousState<double>> derivatives_;
+};
+
+TEST_F(MaliputRailcarFleetTest, Topology) {
+  InitializeDragway();
+  InitializeFleet({LaneDirection(lane(0)), LaneDirection(lane(0))},
+                  {0., 10.}, {0., 0.});
+  EXPECT_EQ(dut_->num_cars(), 2);
+  EXPECT_EQ(dut_->get_num_input_ports(), 0);
+  ASSERT_EQ(dut_->get_num_output_ports(), 1);
+  EXPECT_EQ(dut_->pose_output().get_data_type(), systems::kAbstractValued);
+  EXPECT_EQ(context_->get_continuous_state_vector().size(), 4);
+}
+
+TEST_F(MaliputRailcarFleetTest, DefaultState) {
+  InitializeDragway();
+  dut_ = std::make_unique<MaliputRailcarFleet<double>>(
+      std::vector<LaneDirection>{LaneDirection(lane(0), false)});
+  context_ = dut_->CreateDefaultContext();
+  MaliputRailcarState<double> car_state;
+  dut_->GetCarState(*context_, 0, &car_state);
+  EXPECT_EQ(car_state.s(), MaliputRailcar<double>::kDefaultInitialS);
+  EXPECT_EQ(car_state.speed(), MaliputRailcar<double>::kDefaultInitialSpeed);
+  EXPECT_EQ(dut_->GetCarLaneDirection(*context_, 0).lane, lane(0));
+  EXPECT_FALSE(dut_->GetCarLaneDirection(*context_, 0).with_s);
+}
+
+// Tests that each vehicle accelerates as an IdmController would command it,
+// given the nearest vehicle ahead of it in its direction of travel.
+TEST_F(MaliputRailcarFleetTest, DerivativesDragway) {
+  InitializeDragway();
+  // Vehicles 0 and 2 travel with s; vehicle 1 travels against s, towards
+  // vehicle 0; vehicle 3 is at the same s as vehicle 2.
+  InitializeFleet({LaneDirection(lane(0), true),
+                   LaneDirection(lane(0), false),
+                   LaneDirection(lane(0), true),
+                   LaneDirection(lane(0), true)},
+                  {10., 30., 20., 20.}, {5., 3., 4., 6.});
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  const systems::VectorBase<double>& rates = derivatives_->get_vector();
+
+  // The s-rates follow the direction of travel.
+  EXPECT_NEAR(rates.GetAtIndex(0), 5., kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(1), -3., kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(2), 4., kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(3), 6., kTolerance);
+
+  // Of vehicles 2 and 3, which are at the same s, vehicle 0 follows the one
+  // with the lower index, and vehicle 1 the one with the higher index.
+  EXPECT_NEAR(rates.GetAtIndex(4), CalcExpectedAcceleration(5., 10., 4.),
+              kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(5), CalcExpectedAcceleration(3., 10., -6.),
+              kTolerance);
+  // Vehicles 2 and 3 follow vehicle 1, which approaches them.
+  EXPECT_NEAR(rates.GetAtIndex(6), CalcExpectedAcceleration(4., 10., -3.),
+              kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(7), CalcExpectedAcceleration(6., 10., -3.),
+              kTolerance);
+}
+
+// Tests that a vehicle that is too close to its leader has its net distance
+// saturated.  The dragway's lane is a loop, so the vehicle ahead follows the
+// other one around it, and a lone vehicle sees a free road.
+TEST_F(MaliputRailcarFleetTest, DerivativesSaturation) {
+  InitializeDragway();
+  InitializeFleet({LaneDirection(lane(0)), LaneDirection(lane(0))},
+                  {10., 10.5}, {5., 5.});
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  const systems::VectorBase<double>& rates = derivatives_->get_vector();
+  EXPECT_NEAR(rates.GetAtIndex(2), CalcExpectedAcceleration(5., 0.5, 5.),
+              kTolerance);
+  EXPECT_NEAR(rates.GetAtIndex(3),
+              CalcExpectedAcceleration(5., kLaneLength - 0.5, 5.),
+              kTolerance);
+
+  InitializeFleet({LaneDirection(lane(0))}, {10.}, {5.});
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  EXPECT_NEAR(derivatives_->get_vector().GetAtIndex(1),
+              CalcExpectedAcceleration(
+                  5., std::numeric_limits<double>::infinity(), 0.),
+              kTolerance);
+}
+
+// Tests that vehicles see their leaders in the lanes ahead of theirs.
+TEST_F(MaliputRailcarFleetTest, DerivativesAcrossLanes) {
+  InitializeTwoLaneMonolane();
+  InitializeFleet({LaneDirection(lane(0), true),
+                   LaneDirection(lane(1), true)},
+                  {40., 5.}, {5., 2.});
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  const systems::VectorBase<double>& rates = derivatives_->get_vector();
+  EXPECT_NEAR(rates.GetAtIndex(2), CalcExpectedAcceleration(5., 15., 2.),
+              1e-9);
+
+  // A leader beyond the scan distance is not seen.
+  dut_->get_mutable_idm_parameters(context_.get()).set_scan_ahead_distance(10.);
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  EXPECT_NEAR(derivatives_->get_vector().GetAtIndex(2),
+              CalcExpectedAcceleration(
+                  5., std::numeric_limits<double>::infinity(), 0.),
+              1e-9);
+}
+
+TEST_F(MaliputRailcarFleetTest, PoseOutput) {
+  InitializeDragway();
+  InitializeFleet({LaneDirection(lane(0), true),
+                   LaneDirection(lane(0), false)},
+                  {10., 30.}, {5., 3.});
+  const PoseBundle<double>& poses = GetPoses();
+  ASSERT_EQ(poses.get_num_poses(), 2);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(poses.get_name(i), std::to_string(i));
+    EXPECT_EQ(poses.get_model_instance_id(i), kFirstId + i);
+  }
+  const Vector3<double> xyz_0 =
+      lane(0)->ToGeoPosition({10., 0., 0.}).xyz();
+  const Vector3<double> xyz_1 =
+      lane(0)->ToGeoPosition({30., 0., 0.}).xyz();
+  EXPECT_TRUE(poses.get_pose(0).translation().isApprox(xyz_0));
+  EXPECT_TRUE(poses.get_pose(1).translation().isApprox(xyz_1));
+
+  // Vehicle 1 faces backwards, and moves backwards along the lane.
+  const Vector3<double> s_hat = lane(0)->GetOrientation({10., 0., 0.})
+                                    .matrix().col(0);
+  EXPECT_TRUE(poses.get_pose(0).linear().col(0).isApprox(s_hat));
+  EXPECT_TRUE(poses.get_pose(1).linear().col(0).isApprox(-s_hat));
+  EXPECT_TRUE(poses.get_velocity(0).get_value().tail<3>().isApprox(5. * s_hat));
+  EXPECT_TRUE(
+      poses.get_velocity(1).get_value().tail<3>().isApprox(-3. * s_hat));
+}
+
+// Tests that the update moves vehicles at the end of their lanes to the
+// ongoing lanes, and stops them at the end of the road.
+TEST_F(MaliputRailcarFleetTest, LaneEnds) {
+  InitializeTwoLaneMonolane();
+  InitializeFleet({LaneDirection(lane(0), true),
+                   LaneDirection(lane(1), true),
+                   LaneDirection(lane(1), false),
+                   LaneDirection(lane(0), true)},
+                  {kLaneLength, kLaneLength, 0., 20.}, {5., 5., 5., 5.});
+
+  // The vehicles at the lane ends are already due for an update.
+  auto events = dut_->AllocateCompositeEventCollection();
+  const double t = dut_->CalcNextUpdateTime(*context_, events.get());
+  EXPECT_EQ(t, MaliputRailcar<double>::kTimeEpsilon);
+
+  dut_->CalcUnrestrictedUpdate(*context_, &context_->get_mutable_state());
+  EXPECT_EQ(dut_->GetCarLaneDirection(*context_, 0).lane, lane(1));
+  EXPECT_TRUE(dut_->GetCarLaneDirection(*context_, 0).with_s);
+  EXPECT_EQ(GetS(0), 0.);
+  EXPECT_EQ(GetSpeed(0), 5.);
+  EXPECT_EQ(dut_->GetCarLaneDirection(*context_, 1).lane, lane(1));
+  EXPECT_EQ(GetSpeed(1), 0.);
+  EXPECT_EQ(dut_->GetCarLaneDirection(*context_, 2).lane, lane(0));
+  EXPECT_FALSE(dut_->GetCarLaneDirection(*context_, 2).with_s);
+  EXPECT_EQ(GetS(2), kLaneLength);
+  EXPECT_EQ(dut_->GetCarLaneDirection(*context_, 3).lane, lane(0));
+  EXPECT_EQ(GetS(3), 20.);
+
+  // Once no vehicle is at a lane end, the next update is when the nearest
+  // one reaches it.
+  MaliputRailcarState<double> car_state;
+  car_state.set_s(kLaneLength);
+  car_state.set_speed(0.);
+  dut_->SetCarState(context_.get(), 1, car_state);
+  car_state.set_s(40.);
+  car_state.set_speed(5.);
+  dut_->SetCarState(context_.get(), 0, car_state);
+  EXPECT_NEAR(dut_->CalcNextUpdateTime(*context_, events.get()), 2., 1e-9);
+}
+
+}  // namespace
+}  // namespace automotive
+}  // namespace drake
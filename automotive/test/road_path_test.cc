@@ -182,6 +182,36 @@ GTEST_TEST(IdmControllerTest, ConstructConfluentSegments) {
   EXPECT_TRUE(CompareMatrices(expected_value, actual_value, 1e-3));
 }
 
+// Tests that the RoadPaths built through a cache share the paths of the same
+// parameters, and only those.
+GTEST_TEST(IdmControllerTest, CachedPaths) {
+  const double kStepSize{0.5};
+  auto road = MakeTwoLaneRoad(true);
+  const LaneDirection initial_lane_dir =
+      LaneDirection(GetLaneById(*road, "j:0_fwd"), true);
+  const RoadPath<double> uncached(initial_lane_dir, kStepSize, 100);
+
+  RoadPathCache<double> cache;
+  const RoadPath<double> first(initial_lane_dir, kStepSize, 100, &cache);
+  const RoadPath<double> second(initial_lane_dir, kStepSize, 100, &cache);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(&first.get_path(), &second.get_path());
+  EXPECT_TRUE(first.get_path().isApprox(uncached.get_path(), 0.));
+
+  const RoadPath<double> other_step(initial_lane_dir, 2 * kStepSize, 100,
+                                    &cache);
+  const RoadPath<double> other_direction(
+      LaneDirection(initial_lane_dir.lane, false), kStepSize, 100, &cache);
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_NE(&other_step.get_path(), &first.get_path());
+  EXPECT_NE(&other_direction.get_path(), &first.get_path());
+
+  // The paths outlive the cache's entries.
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_TRUE(first.get_path().isApprox(uncached.get_path(), 0.));
+}
+
 }  // namespace
 }  // namespace automotive
 }  // namespace drake
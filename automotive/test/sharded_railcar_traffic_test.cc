@@ -0,0 +1,215 @@
+#include "drake/automotive/sharded_railcar_traffic.h"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/maliput/monolane/builder.h"
+#include "drake/lcm/drake_mock_lcm.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+using maliput::api::GeoPosition;
+using maliput::monolane::Endpoint;
+using maliput::monolane::EndpointXy;
+using maliput::monolane::EndpointZ;
+
+const double kLaneLength{50.};
+const double kMacroStep{0.5};
+
+GTEST_TEST(RoadShardPartitionTest, Regions) {
+  EXPECT_THROW(RoadShardPartition({}), std::runtime_error);
+  EXPECT_THROW(RoadShardPartition({Eigen::AlignedBox2d()}),
+               std::runtime_error);
+
+  const RoadShardPartition dut = RoadShardPartition::MakeStrips(
+      Eigen::AlignedBox2d(Eigen::Vector2d(0., -5.), Eigen::Vector2d(90., 5.)),
+      3);
+  ASSERT_EQ(dut.num_shards(), 3);
+  EXPECT_EQ(dut.region(1).min().x(), 30.);
+  EXPECT_EQ(dut.region(1).max().x(), 60.);
+  EXPECT_EQ(dut.region(1).min().y(), -5.);
+  EXPECT_EQ(dut.region(1).max().y(), 5.);
+
+  EXPECT_EQ(dut.FindShard(GeoPosition(10., 0., 0.)), 0);
+  EXPECT_EQ(dut.FindShard(GeoPosition(45., 2., 7.)), 1);
+  EXPECT_EQ(dut.FindShard(GeoPosition(80., 0., 0.)), 2);
+  // Outside of every region, the nearest one.
+  EXPECT_EQ(dut.FindShard(GeoPosition(100., 0., 0.)), 2);
+  EXPECT_EQ(dut.FindShard(GeoPosition(40., 20., 0.)), 1);
+
+  EXPECT_EQ(dut.Distance(1, GeoPosition(45., 0., 0.)), 0.);
+  EXPECT_NEAR(dut.Distance(1, GeoPosition(64., 3., 0.)), 4., 1e-12);
+  EXPECT_NEAR(dut.Distance(0, GeoPosition(33., 9., 0.)), 5., 1e-12);
+}
+
+class ShardedRailcarTrafficTest : public ::testing::Test {
+ protected:
+  // Creates a monolane road of two straight lanes along the x axis, one after
+  // the other, which two shards split at the end of the first lane.
+  void SetUp() override {
+    maliput::monolane::Builder builder(
+        maliput::api::RBounds(-2, 2),   /* lane_bounds       */
+        maliput::api::RBounds(-4, 4),   /* driveable_bounds  */
+        maliput::api::HBounds(0, 5),    /* elevation bounds */
+        0.01,                           /* linear tolerance  */
+        0.5 * M_PI / 180.0);            /* angular_tolerance */
+    builder.Connect("first", Endpoint(EndpointXy(0, 0, 0),
+                                      EndpointZ(0, 0, 0, 0)),
+                    kLaneLength, EndpointZ(0, 0, 0, 0));
+    builder.Connect("second", Endpoint(EndpointXy(kLaneLength, 0, 0),
+                                       EndpointZ(0, 0, 0, 0)),
+                    kLaneLength, EndpointZ(0, 0, 0, 0));
+    road_ = builder.Build(maliput::api::RoadGeometryId("ShardTestMonolane"));
+    lcm_.EnableLoopBack();
+  }
+
+  const maliput::api::Lane* lane(int junction) const {
+    return road_->junction(junction)->segment(0)->lane(0);
+  }
+
+  // A leader on the first lane, about to cross into the second, and a
+  // follower behind it.
+  std::vector<ShardedRailcar> MakeCars() const {
+    std::vector<ShardedRailcar> cars(2);
+    cars[0].id = 7;
+    cars[0].lane_direction = LaneDirection(lane(0), true);
+    cars[0].s = 40.;
+    cars[0].speed = 10.;
+    cars[1].id = 3;
+    cars[1].lane_direction = LaneDirection(lane(0), true);
+    cars[1].s = 15.;
+    cars[1].speed = 12.;
+    return cars;
+  }
+
+  RoadShardPartition MakePartition(int num_shards) const {
+    return RoadShardPartition::MakeStrips(
+        Eigen::AlignedBox2d(Eigen::Vector2d(0., -10.),
+                            Eigen::Vector2d(2 * kLaneLength, 10.)),
+        num_shards);
+  }
+
+  std::unique_ptr<const maliput::api::RoadGeometry> road_;
+  lcm::DrakeMockLcm lcm_;
+};
+
+TEST_F(ShardedRailcarTrafficTest, Construction) {
+  const RoadShardPartition partition = MakePartition(2);
+  EXPECT_THROW(ShardedRailcarTraffic(nullptr, partition, 0, kMacroStep, 10.,
+                                     &lcm_),
+               std::runtime_error);
+  EXPECT_THROW(ShardedRailcarTraffic(road_.get(), partition, 2, kMacroStep,
+                                     10., &lcm_),
+               std::runtime_error);
+  EXPECT_THROW(ShardedRailcarTraffic(road_.get(), partition, 0, 0., 10.,
+                                     &lcm_),
+               std::runtime_error);
+  EXPECT_THROW(ShardedRailcarTraffic(road_.get(), partition, 0, kMacroStep,
+                                     -1., &lcm_),
+               std::runtime_error);
+
+  // Each shard keeps the cars in its region.
+  ShardedRailcarTraffic shard0(road_.get(), partition, 0, kMacroStep, 10.,
+                               &lcm_);
+  ShardedRailcarTraffic shard1(road_.get(), partition, 1, kMacroStep, 10.,
+                               &lcm_);
+  ShardedRailcar car = MakeCars()[0];
+  EXPECT_TRUE(shard0.AddCar(car));
+  EXPECT_FALSE(shard1.AddCar(car));
+  EXPECT_THROW(shard0.AddCar(car), std::runtime_error);
+  car.id = 8;
+  car.lane_direction = LaneDirection(lane(1), true);
+  EXPECT_FALSE(shard0.AddCar(car));
+  EXPECT_TRUE(shard1.AddCar(car));
+  car.id = 9;
+  car.lane_direction.lane = nullptr;
+  EXPECT_THROW(shard0.AddCar(car), std::runtime_error);
+  ASSERT_EQ(shard0.cars().size(), 1);
+  EXPECT_EQ(shard0.cars()[0].id, 7);
+}
+
+// A shard only advances once the other shards have published the macro step.
+TEST_F(ShardedRailcarTrafficTest, Lockstep) {
+  const RoadShardPartition partition = MakePartition(2);
+  ShardedRailcarTraffic shard0(road_.get(), partition, 0, kMacroStep, 10.,
+                               &lcm_);
+  ShardedRailcarTraffic shard1(road_.get(), partition, 1, kMacroStep, 10.,
+                               &lcm_);
+  EXPECT_THROW(shard0.Advance(), std::runtime_error);
+  shard0.Publish();
+  EXPECT_FALSE(shard0.ReadyToAdvance());
+  EXPECT_THROW(shard0.Advance(), std::runtime_error);
+  EXPECT_TRUE(shard1.ReadyToAdvance());
+  shard1.Publish();
+  EXPECT_TRUE(shard0.ReadyToAdvance());
+  shard0.Advance();
+  shard1.Advance();
+  EXPECT_EQ(shard0.macro_step_index(), 1);
+  EXPECT_EQ(shard1.time(), kMacroStep);
+
+  // A single shard never waits.
+  ShardedRailcarTraffic alone(road_.get(), MakePartition(1), 0, kMacroStep,
+                              10., &lcm_, "ALONE");
+  alone.Step(0.);
+  EXPECT_EQ(alone.macro_step_index(), 1);
+}
+
+// The leader is handed off from the first shard to the second as it crosses
+// into the second lane, while the follower, in the first shard, keeps
+// following it through its ghost. With a halo that covers the scan distance,
+// the sharded run matches a run with a single shard.
+TEST_F(ShardedRailcarTrafficTest, Handoff) {
+  const double halo = 120.;
+  ShardedRailcarTraffic reference(road_.get(), MakePartition(1), 0,
+                                  kMacroStep, halo, &lcm_, "REFERENCE");
+  ShardedRailcarTraffic shard0(road_.get(), MakePartition(2), 0, kMacroStep,
+                               halo, &lcm_);
+  ShardedRailcarTraffic shard1(road_.get(), MakePartition(2), 1, kMacroStep,
+                               halo, &lcm_);
+  for (const ShardedRailcar& car : MakeCars()) {
+    reference.AddCar(car);
+    EXPECT_NE(shard0.AddCar(car), shard1.AddCar(car));
+  }
+  EXPECT_EQ(shard0.cars().size(), 2);
+  EXPECT_EQ(shard1.cars().size(), 0);
+
+  // The leader crosses into the second shard's region after about a second,
+  // and the second shard adopts it at the start of the next macro step.
+  const int num_macro_steps = 4;
+  for (int i = 0; i < num_macro_steps; ++i) {
+    reference.Step(0.);
+    shard0.Publish();
+    shard1.Publish();
+    shard0.Advance();
+    shard1.Advance();
+  }
+  ASSERT_EQ(shard0.cars().size(), 1);
+  ASSERT_EQ(shard1.cars().size(), 1);
+  const ShardedRailcar& follower = shard0.cars()[0];
+  const ShardedRailcar& leader = shard1.cars()[0];
+  EXPECT_EQ(follower.id, 3);
+  EXPECT_EQ(leader.id, 7);
+  EXPECT_EQ(leader.lane_direction.lane, lane(1));
+
+  ASSERT_EQ(reference.cars().size(), 2);
+  const double kTolerance = 1e-9;
+  for (const ShardedRailcar* car : {&follower, &leader}) {
+    const ShardedRailcar& expected = reference.cars()[car == &leader ? 1 : 0];
+    EXPECT_EQ(car->id, expected.id);
+    EXPECT_EQ(car->lane_direction.lane, expected.lane_direction.lane);
+    EXPECT_NEAR(car->s, expected.s, kTolerance);
+    EXPECT_NEAR(car->speed, expected.speed, kTolerance);
+  }
+}
+
+}  // namespace
+}  // namespace automotive
+}  // namespace drake
@@ -0,0 +1,174 @@
+#include "drake/automotive/traffic_index.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/automotive/maliput/api/junction.h"
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/segment.h"
+#include "drake/automotive/maliput/dragway/road_geometry.h"
+#include "drake/automotive/monolane_onramp_merge.h"
+#include "drake/automotive/pose_selector.h"
+#include "drake/automotive/traffic_indexer.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+using maliput::api::GeoPosition;
+using maliput::api::Lane;
+using maliput::api::LanePosition;
+using maliput::api::RoadGeometry;
+using systems::rendering::FrameVelocity;
+using systems::rendering::PoseBundle;
+using systems::rendering::PoseVector;
+
+// Returns every Lane of @p road.
+std::vector<const Lane*> GetLanes(const RoadGeometry& road) {
+  std::vector<const Lane*> lanes;
+  for (int i = 0; i < road.num_junctions(); ++i) {
+    for (int j = 0; j < road.junction(i)->num_segments(); ++j) {
+      const maliput::api::Segment* segment = road.junction(i)->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lanes.push_back(segment->lane(k));
+      }
+    }
+  }
+  return lanes;
+}
+
+// Returns the pose at @p lane_position in @p lane, facing along `s`.
+Isometry3<double> MakePose(const Lane* lane,
+                           const LanePosition& lane_position) {
+  Isometry3<double> pose(lane->GetOrientation(lane_position).quat());
+  pose.translation() = lane->ToGeoPosition(lane_position).xyz();
+  return pose;
+}
+
+// Puts cars at `fractions` of the length of each Lane of @p road, driving
+// along `s` at 10 m/s.
+PoseBundle<double> MakeTraffic(const RoadGeometry& road,
+                               const std::vector<double>& fractions) {
+  const std::vector<const Lane*> lanes = GetLanes(road);
+  PoseBundle<double> traffic(lanes.size() * fractions.size());
+  int index{0};
+  for (const Lane* lane : lanes) {
+    for (const double fraction : fractions) {
+      FrameVelocity<double> velocity;
+      velocity.get_mutable_value() << 0., 0., 0., 10., 0., 0.;
+      traffic.set_pose(index, MakePose(lane, {fraction * lane->length(),
+                                              0., 0.}));
+      traffic.set_velocity(index, velocity);
+      ++index;
+    }
+  }
+  return traffic;
+}
+
+void ExpectSame(const ClosestPose<double>& expected,
+                const ClosestPose<double>& actual) {
+  EXPECT_EQ(expected.odometry.lane, actual.odometry.lane);
+  EXPECT_EQ(expected.odometry.pos.srh(), actual.odometry.pos.srh());
+  EXPECT_EQ(expected.odometry.vel.get_value(), actual.odometry.vel.get_value());
+  EXPECT_EQ(expected.distance, actual.distance);
+}
+
+// Checks that every query of an ego car in each Lane of @p road, at
+// `s = length / 3`, gives the same result with a TrafficIndex of @p traffic
+// as with @p traffic itself.  Returns the number of queries that find a car.
+int CheckQueries(const RoadGeometry& road, const PoseBundle<double>& traffic,
+                  ScanStrategy path_or_branches) {
+  const TrafficIndex<double> index(road, traffic);
+  int num_found{0};
+  for (const Lane* lane : GetLanes(road)) {
+    PoseVector<double> ego_pose;
+    const Isometry3<double> pose =
+        MakePose(lane, {lane->length() / 3., 0., 0.});
+    ego_pose.set_translation(Translation3<double>(pose.translation()));
+    ego_pose.set_rotation(Eigen::Quaternion<double>(pose.rotation()));
+    for (const auto side : {AheadOrBehind::kAhead, AheadOrBehind::kBehind}) {
+      SCOPED_TRACE(lane->id().string());
+      const ClosestPose<double> expected =
+          PoseSelector<double>::FindSingleClosestPose(
+              lane, ego_pose, traffic, 50., side, path_or_branches);
+      ExpectSame(expected, PoseSelector<double>::FindSingleClosestPose(
+                               lane, ego_pose, index, 50., side,
+                               path_or_branches));
+      if (expected.distance < std::numeric_limits<double>::infinity()) {
+        ++num_found;
+      }
+    }
+  }
+  return num_found;
+}
+
+GTEST_TEST(TrafficIndexTest, Empty) {
+  const TrafficIndex<double> index;
+  EXPECT_EQ(0, index.poses().get_num_poses());
+  EXPECT_TRUE(index.GetCarsInLane(nullptr).empty());
+}
+
+GTEST_TEST(TrafficIndexTest, Dragway) {
+  const maliput::dragway::RoadGeometry road(
+      maliput::api::RoadGeometryId("Test Dragway"), 3 /* num_lanes */,
+      100. /* length */, 2. /* lane_width */, 0. /* shoulder_width */,
+      5. /* maximum_height */, 1e-6 /* linear_tolerance */,
+      1e-6 /* angular_tolerance */);
+  const PoseBundle<double> traffic = MakeTraffic(road, {0.2, 0.5, 0.9});
+
+  const TrafficIndex<double> index(road, traffic);
+  EXPECT_EQ(traffic.get_num_poses(), index.poses().get_num_poses());
+  const std::vector<const Lane*> lanes = GetLanes(road);
+  for (int i = 0; i < static_cast<int>(lanes.size()); ++i) {
+    const auto& cars = index.GetCarsInLane(lanes[i]);
+    ASSERT_EQ(3, static_cast<int>(cars.size()));
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(3 * i + j, cars[j].index);
+      EXPECT_EQ(lanes[i], index.GetRoadLane(cars[j].index));
+    }
+    EXPECT_NEAR(50., cars[1].lane_position.s(), 1e-9);
+  }
+
+  EXPECT_GT(CheckQueries(road, traffic, ScanStrategy::kPath), 0);
+  EXPECT_GT(CheckQueries(road, traffic, ScanStrategy::kBranches), 0);
+}
+
+GTEST_TEST(TrafficIndexTest, Onramp) {
+  const std::unique_ptr<const RoadGeometry> road =
+      MonolaneOnrampMerge().BuildOnramp();
+  const PoseBundle<double> traffic = MakeTraffic(*road, {0.1, 0.6});
+
+  EXPECT_GT(CheckQueries(*road, traffic, ScanStrategy::kPath), 0);
+  EXPECT_GT(CheckQueries(*road, traffic, ScanStrategy::kBranches), 0);
+}
+
+GTEST_TEST(TrafficIndexerTest, Output) {
+  const maliput::dragway::RoadGeometry road(
+      maliput::api::RoadGeometryId("Test Dragway"), 2 /* num_lanes */,
+      100. /* length */, 2. /* lane_width */, 0. /* shoulder_width */,
+      5. /* maximum_height */, 1e-6 /* linear_tolerance */,
+      1e-6 /* angular_tolerance */);
+  const PoseBundle<double> traffic = MakeTraffic(road, {0.5});
+
+  const TrafficIndexer<double> dut(road);
+  auto context = dut.CreateDefaultContext();
+  auto output = dut.AllocateOutput(*context);
+  context->FixInputPort(
+      dut.traffic_input().get_index(),
+      systems::AbstractValue::Make<PoseBundle<double>>(traffic));
+  dut.CalcOutput(*context, output.get());
+
+  const auto& index = output->get_data(dut.traffic_index_output().get_index())
+                          ->GetValue<TrafficIndex<double>>();
+  EXPECT_EQ(2, index.poses().get_num_poses());
+  for (const Lane* lane : GetLanes(road)) {
+    EXPECT_EQ(1, static_cast<int>(index.GetCarsInLane(lane).size()));
+  }
+}
+
+}  // namespace
+}  // namespace automotive
+}  // namespace drake
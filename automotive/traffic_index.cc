@@ -0,0 +1,64 @@
+#include "drake/automotive/traffic_index.h"
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace automotive {
+
+using maliput::api::GeoPosition;
+using maliput::api::GeoPositionT;
+using maliput::api::Lane;
+using maliput::api::LanePositionT;
+using maliput::api::RoadGeometry;
+using maliput::api::RoadPositionResult;
+using systems::rendering::PoseBundle;
+
+template <typename T>
+TrafficIndex<T>::TrafficIndex() : poses_(0) {}
+
+template <typename T>
+TrafficIndex<T>::TrafficIndex(const RoadGeometry& road,
+                              const PoseBundle<T>& poses)
+    : poses_(poses) {
+  const double tol = road.linear_tolerance();
+  road_lanes_.reserve(poses.get_num_poses());
+  for (int i = 0; i < poses.get_num_poses(); ++i) {
+    const GeoPositionT<T> geo_position =
+        GeoPositionT<T>::FromXyz(poses.get_pose(i).translation());
+    const GeoPosition geo_position_double = geo_position.MakeDouble();
+    road_lanes_.push_back(
+        road.ToRoadPosition(geo_position_double, nullptr, nullptr, nullptr)
+            .lane);
+
+    // This is the test PoseSelector applies to each car of a PoseBundle; the
+    // Lanes within `tol` are a superset of the Lanes that pass it.
+    for (const RoadPositionResult& result :
+         road.FindRoadPositions(geo_position_double, tol)) {
+      const Lane* const lane = result.road_position.lane;
+      T distance{};
+      const LanePositionT<T> lane_position =
+          lane->ToLanePositionT<T>(geo_position, nullptr, &distance);
+      const maliput::api::RBounds r_bounds =
+          lane->lane_bounds(ExtractDoubleOrThrow(lane_position.s()));
+      if (distance < tol && lane_position.r() >= r_bounds.min() - tol &&
+          lane_position.r() <= r_bounds.max() + tol) {
+        lane_cars_[lane].push_back({i, lane_position});
+      }
+    }
+  }
+}
+
+template <typename T>
+const std::vector<typename TrafficIndex<T>::Car>&
+TrafficIndex<T>::GetCarsInLane(const Lane* lane) const {
+  const auto it = lane_cars_.find(lane);
+  return (it == lane_cars_.end()) ? no_cars_ : it->second;
+}
+
+}  // namespace automotive
+}  // namespace drake
+
+// These instantiations must match the API documentation in traffic_index.h.
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::automotive::TrafficIndex)
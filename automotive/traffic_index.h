@@ -0,0 +1,72 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/rendering/pose_bundle.h"
+
+namespace drake {
+namespace automotive {
+
+/// TrafficIndex locates every car of a PoseBundle in a RoadGeometry once, so
+/// that PoseSelector queries for many ego cars only visit the cars in the
+/// lanes they scan, rather than the whole bundle for each lane.
+///
+/// Each car is bucketed into every lane that contains it, i.e., every lane
+/// within `linear_tolerance()` of its position whose lane bounds contain it;
+/// this is the same test PoseSelector applies when it scans a PoseBundle, so
+/// queries on the index give the same results. The buckets are found with
+/// RoadGeometry::FindRoadPositions(). Each car also records the lane that
+/// RoadGeometry::ToRoadPosition() assigns to it, which is used for
+/// ScanStrategy::kBranches queries.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+/// - double
+/// - AutoDiffXd
+///
+/// They are already available to link against in the containing library.
+template <typename T>
+class TrafficIndex {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TrafficIndex)
+
+  /// A car of the PoseBundle within a lane.
+  struct Car {
+    /// The index of the car in poses().
+    int index{};
+    /// The position of the car in the lane.
+    maliput::api::LanePositionT<T> lane_position;
+  };
+
+  /// Constructs an empty index.
+  TrafficIndex();
+
+  /// Indexes the cars of @p poses, which are copied, in @p road.
+  TrafficIndex(const maliput::api::RoadGeometry& road,
+               const systems::rendering::PoseBundle<T>& poses);
+
+  /// Returns the indexed cars.
+  const systems::rendering::PoseBundle<T>& poses() const { return poses_; }
+
+  /// Returns the cars within @p lane, in increasing order of index.
+  const std::vector<Car>& GetCarsInLane(const maliput::api::Lane* lane) const;
+
+  /// Returns the lane RoadGeometry::ToRoadPosition() assigns to the car at
+  /// @p index of poses().
+  const maliput::api::Lane* GetRoadLane(int index) const {
+    return road_lanes_.at(index);
+  }
+
+ private:
+  systems::rendering::PoseBundle<T> poses_;
+  std::vector<const maliput::api::Lane*> road_lanes_;
+  std::unordered_map<const maliput::api::Lane*, std::vector<Car>> lane_cars_;
+  std::vector<Car> no_cars_;
+};
+
+}  // namespace automotive
+}  // namespace drake
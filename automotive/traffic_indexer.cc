@@ -0,0 +1,46 @@
+#include "drake/automotive/traffic_indexer.h"
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace automotive {
+
+using maliput::api::RoadGeometry;
+using systems::rendering::PoseBundle;
+
+template <typename T>
+TrafficIndexer<T>::TrafficIndexer(const RoadGeometry& road)
+    : road_(road),
+      traffic_input_index_(this->DeclareAbstractInputPort().get_index()),
+      traffic_index_output_index_(
+          this->DeclareAbstractOutputPort(&TrafficIndexer::CalcTrafficIndex)
+              .get_index()) {}
+
+template <typename T>
+const systems::InputPortDescriptor<T>& TrafficIndexer<T>::traffic_input()
+    const {
+  return systems::System<T>::get_input_port(traffic_input_index_);
+}
+
+template <typename T>
+const systems::OutputPort<T>& TrafficIndexer<T>::traffic_index_output() const {
+  return systems::System<T>::get_output_port(traffic_index_output_index_);
+}
+
+template <typename T>
+void TrafficIndexer<T>::CalcTrafficIndex(const systems::Context<T>& context,
+                                         TrafficIndex<T>* traffic_index) const {
+  const PoseBundle<T>* const traffic_poses =
+      this->template EvalInputValue<PoseBundle<T>>(context,
+                                                   traffic_input_index_);
+  DRAKE_ASSERT(traffic_poses != nullptr);
+  *traffic_index = TrafficIndex<T>(road_, *traffic_poses);
+}
+
+}  // namespace automotive
+}  // namespace drake
+
+// These instantiations must match the API documentation in traffic_indexer.h.
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::automotive::TrafficIndexer)
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/traffic_index.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/rendering/pose_bundle.h"
+
+namespace drake {
+namespace automotive {
+
+/// TrafficIndexer builds a TrafficIndex of the traffic poses in a
+/// maliput::api::RoadGeometry, so that the traffic cars are located in the
+/// road once per evaluation, and not once for each IdmController and
+/// MobilPlanner that consumes them.  Those systems accept its output on their
+/// traffic input ports in place of the PoseBundle.
+///
+/// This system is stateless and is direct feed-through.
+///
+/// Input Port 0: PoseBundle for the traffic cars.
+///   (InputPortDescriptor getter: traffic_input())
+///
+/// Output Port 0: A TrafficIndex of the traffic cars.
+///   (OutputPort getter: traffic_index_output())
+///
+/// Instantiated templates for the following kinds of T's are provided:
+/// - double
+/// - AutoDiffXd
+///
+/// They are already available to link against in the containing library.
+template <typename T>
+class TrafficIndexer : public systems::LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TrafficIndexer)
+
+  /// Constructs a system indexing the traffic in @p road, which must outlive
+  /// it.
+  explicit TrafficIndexer(const maliput::api::RoadGeometry& road);
+
+  ~TrafficIndexer() override {}
+
+  /// See the class description for details on the following ports.
+  /// @{
+  const systems::InputPortDescriptor<T>& traffic_input() const;
+  const systems::OutputPort<T>& traffic_index_output() const;
+  /// @}
+
+ private:
+  void CalcTrafficIndex(const systems::Context<T>& context,
+                        TrafficIndex<T>* traffic_index) const;
+
+  const maliput::api::RoadGeometry& road_;
+
+  // Indices for the input / output ports.
+  const int traffic_input_index_{};
+  const int traffic_index_output_index_{};
+};
+
+}  // namespace automotive
+}  // namespace drake
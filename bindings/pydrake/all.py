@@ -27,6 +27,7 @@ from .automotive import *
 from .common import *
 from .forwarddiff import *
 from .math import *
+from .perception import *
 from .symbolic import *
 from .trajectories import *
 
@@ -1,12 +1,15 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
 #include "pybind11/eigen.h"
+#include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
 #include "drake/bindings/pydrake/autodiff_types_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
+#include "drake/common/parallel_for.h"
 #include "drake/multibody/parsers/package_map.h"
 #include "drake/multibody/parsers/sdf_parser.h"
 #include "drake/multibody/parsers/urdf_parser.h"
@@ -17,6 +20,57 @@ using std::make_unique;
 
 namespace drake {
 namespace pydrake {
+namespace {
+
+// A stack of configurations, one per row.
+using ConfigurationBatch =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// Calls `calc(k, cache)` for each row `k` of @p q, after computing the
+// kinematics of configuration `k` into `cache`. The rows are split into
+// contiguous runs, each evaluated on up to @p num_threads threads with a
+// single KinematicsCache, and the GIL is released meanwhile: `calc` must not
+// touch Python objects.
+template <typename Calc>
+void ForEachConfiguration(const RigidBodyTree<double>& tree,
+                          const Eigen::Ref<const ConfigurationBatch>& q,
+                          int num_threads, const Calc& calc) {
+  if (q.cols() != tree.get_num_positions()) {
+    throw std::runtime_error(
+        "q must have one row per configuration and one column per position");
+  }
+  if (num_threads < 1) {
+    throw std::runtime_error("num_threads must be positive");
+  }
+  const int size = static_cast<int>(q.rows());
+  const int num_runs = std::min(size, num_threads);
+  py::gil_scoped_release release;
+  ParallelFor(num_runs, num_threads, [&](int run) {
+    KinematicsCache<double> cache = tree.CreateKinematicsCache();
+    const int begin = run * size / num_runs;
+    const int end = (run + 1) * size / num_runs;
+    for (int k = begin; k < end; ++k) {
+      cache.initialize(q.row(k).transpose());
+      tree.doKinematics(cache);
+      calc(k, cache);
+    }
+  });
+}
+
+// Returns an uninitialized array of shape (num_samples, rows, cols).
+py::array_t<double> MakeStack(int num_samples, int rows, int cols) {
+  return py::array_t<double>(
+      std::vector<ssize_t>{num_samples, rows, cols});
+}
+
+// Returns a view of the matrix at index @p k of the data of an array returned
+// by MakeStack().
+Eigen::Map<ConfigurationBatch> SampleOf(double* data, int k, int rows,
+                                        int cols) {
+  return Eigen::Map<ConfigurationBatch>(data + k * rows * cols, rows, cols);
+}
+
+}  // namespace
 
 PYBIND11_MODULE(rigid_body_tree, m) {
   m.doc() = "Bindings for the RigidBodyTree class";
@@ -200,6 +254,57 @@ PYBIND11_MODULE(rigid_body_tree, m) {
           return pts;
         }, py::arg("body"), py::arg("group_name")="")
     .def("massMatrix", &RigidBodyTree<double>::massMatrix<double>)
+    .def("massMatrixBatch", [](
+        const RigidBodyTree<double>& tree,
+        const Eigen::Ref<const ConfigurationBatch>& q, int num_threads) {
+      const int nv = tree.get_num_velocities();
+      py::array_t<double> M = MakeStack(static_cast<int>(q.rows()), nv, nv);
+      double* const data = M.mutable_data();
+      ForEachConfiguration(tree, q, num_threads,
+                           [&](int k, KinematicsCache<double>& cache) {
+        SampleOf(data, k, nv, nv) = tree.massMatrix(cache);
+      });
+      return M;
+    }, py::arg("q"), py::arg("num_threads") = GetDefaultNumThreads(),
+    "Returns the mass matrices at the configurations in the rows of `q`, "
+    "an (N, nq) array, stacked in an (N, nv, nv) array.")
+    .def("transformPointsBatch", [](
+        const RigidBodyTree<double>& tree,
+        const Eigen::Ref<const ConfigurationBatch>& q,
+        const Eigen::Matrix3Xd& points, int from_body_or_frame_ind,
+        int to_body_or_frame_ind, int num_threads) {
+      const int num_points = static_cast<int>(points.cols());
+      py::array_t<double> result =
+          MakeStack(static_cast<int>(q.rows()), 3, num_points);
+      double* const data = result.mutable_data();
+      ForEachConfiguration(tree, q, num_threads,
+                           [&](int k, KinematicsCache<double>& cache) {
+        SampleOf(data, k, 3, num_points) = tree.transformPoints(
+            cache, points, from_body_or_frame_ind, to_body_or_frame_ind);
+      });
+      return result;
+    }, py::arg("q"), py::arg("points"), py::arg("from_body_or_frame_ind"),
+    py::arg("to_body_or_frame_ind"),
+    py::arg("num_threads") = GetDefaultNumThreads(),
+    "Returns transformPoints() at the configurations in the rows of `q`, an "
+    "(N, nq) array, stacked in an (N, 3, num_points) array.")
+    .def("relativeTransformBatch", [](
+        const RigidBodyTree<double>& tree,
+        const Eigen::Ref<const ConfigurationBatch>& q,
+        int base_or_frame_ind, int body_or_frame_ind, int num_threads) {
+      py::array_t<double> result = MakeStack(static_cast<int>(q.rows()), 4, 4);
+      double* const data = result.mutable_data();
+      ForEachConfiguration(tree, q, num_threads,
+                           [&](int k, KinematicsCache<double>& cache) {
+        SampleOf(data, k, 4, 4) = tree.relativeTransform(
+            cache, base_or_frame_ind, body_or_frame_ind).matrix();
+      });
+      return result;
+    }, py::arg("q"), py::arg("base_or_frame_ind"),
+    py::arg("body_or_frame_ind"),
+    py::arg("num_threads") = GetDefaultNumThreads(),
+    "Returns relativeTransform() at the configurations in the rows of `q`, an "
+    "(N, nq) array, stacked in an (N, 4, 4) array.")
     .def("dynamicsBiasTerm", &RigidBodyTree<double>::dynamicsBiasTerm<double>,
          py::arg("cache"), py::arg("external_wrenches"),
          py::arg("include_velocity_terms") = true)
@@ -109,6 +109,34 @@ class TestRigidBodyTree(unittest.TestCase):
         c = arm_com.get_center_of_mass()
         self.assertTrue(np.allclose(c, [0.0, 0.0, -0.5]))
 
+    def test_batch_api(self):
+        tree = RigidBodyTree(FindResourceOrThrow(
+            "drake/examples/pendulum/Pendulum.urdf"))
+        num_q = num_v = 7
+        num_samples = 5
+        q = np.random.RandomState(0).uniform(-1, 1, (num_samples, num_q))
+        points = np.array([[1., 0.], [0., 1.], [0.5, 2.]])
+        for num_threads in [1, 2]:
+            M = tree.massMatrixBatch(q, num_threads=num_threads)
+            p = tree.transformPointsBatch(
+                q, points, 2, 0, num_threads=num_threads)
+            T = tree.relativeTransformBatch(q, 0, 2, num_threads=num_threads)
+            self.assertEqual(M.shape, (num_samples, num_v, num_v))
+            self.assertEqual(p.shape, (num_samples, 3, 2))
+            self.assertEqual(T.shape, (num_samples, 4, 4))
+            for k in range(num_samples):
+                kinsol = tree.doKinematics(q[k])
+                self.assertTrue(np.allclose(M[k], tree.massMatrix(kinsol)))
+                self.assertTrue(np.allclose(
+                    p[k], tree.transformPoints(kinsol, points, 2, 0)))
+                self.assertTrue(np.allclose(
+                    T[k], tree.relativeTransform(kinsol, 0, 2)))
+        # The default uses all the hardware threads.
+        self.assertEqual(tree.massMatrixBatch(q).shape, M.shape)
+        # Configurations of the wrong size are rejected.
+        with self.assertRaises(RuntimeError):
+            tree.massMatrixBatch(q[:, 1:])
+
     def test_dynamics_api(self):
         urdf_path = FindResourceOrThrow(
             "drake/examples/pendulum/Pendulum.urdf")
@@ -0,0 +1,49 @@
+#include <memory>
+
+#include "pybind11/eigen.h"
+#include "pybind11/pybind11.h"
+
+#include "drake/bindings/pydrake/pydrake_pybind.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_flags.h"
+
+namespace drake {
+namespace pydrake {
+
+PYBIND11_MODULE(perception, m) {
+  // NOLINTNEXTLINE(build/namespaces): Emulate placement in namespace.
+  using namespace drake::perception;
+
+  m.doc() = "Bindings for //perception.";
+
+  // TODO(eric.cousineau): Bind descriptor fields.
+  py::enum_<pc_flags::BaseField>(m, "BaseField", py::arithmetic())
+      .value("kNone", pc_flags::kNone)
+      .value("kInherit", pc_flags::kInherit)
+      .value("kXYZs", pc_flags::kXYZs);
+
+  using T = PointCloud::T;
+
+  // N.B. The arrays returned by `xyzs` and `mutable_xyzs` share the memory of
+  // the point cloud (which they keep alive), and are invalidated by `resize`.
+  py::class_<PointCloud> point_cloud(m, "PointCloud");
+  point_cloud
+      .def(py::init([](int new_size, pc_flags::BaseFieldT fields) {
+            return std::make_unique<PointCloud>(new_size, fields);
+          }),
+          py::arg("new_size"),
+          py::arg("fields") = pc_flags::BaseFieldT{pc_flags::kXYZs})
+      .def("size", &PointCloud::size)
+      .def("resize", &PointCloud::resize, py::arg("new_size"),
+           py::arg("skip_initialize") = false)
+      .def("has_xyzs", &PointCloud::has_xyzs)
+      .def("xyzs", &PointCloud::xyzs, py_reference_internal)
+      .def("mutable_xyzs", &PointCloud::mutable_xyzs, py_reference_internal)
+      .def("xyz", &PointCloud::xyz, py::arg("i"))
+      .def("mutable_xyz", &PointCloud::mutable_xyz, py::arg("i"),
+           py_reference_internal);
+  point_cloud.attr("kDefaultValue") = T{PointCloud::kDefaultValue};
+}
+
+}  // namespace pydrake
+}  // namespace drake
@@ -209,6 +209,8 @@ PYBIND11_MODULE(_ik_py, m) {
     .def("getDebug", &IKoptions::getDebug)
     .def("setSequentialSeedFlag", &IKoptions::setSequentialSeedFlag)
     .def("getSequentialSeedFlag", &IKoptions::getSequentialSeedFlag)
+    .def("setNumThreads", &IKoptions::setNumThreads)
+    .def("getNumThreads", &IKoptions::getNumThreads)
     .def("setMajorOptimalityTolerance", &IKoptions::setMajorOptimalityTolerance)
     .def("getMajorOptimalityTolerance", &IKoptions::getMajorOptimalityTolerance)
     .def("setMajorFeasibilityTolerance",
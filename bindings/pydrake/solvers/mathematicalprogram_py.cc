@@ -90,6 +90,13 @@ auto RegisterBinding(py::handle* pscope,
       "EvalBindingAtSolution",
       static_cast<Eigen::VectorXd (MathematicalProgram::*)(const B&) const>(
           &MathematicalProgram::EvalBindingAtSolution));
+  prog_cls.def(
+      "EvalBindingAtPoints",
+      [](const MathematicalProgram& prog, const B& binding,
+         const Eigen::MatrixXd& prog_var_vals) {
+        return prog.EvalBindingAtPoints(binding, prog_var_vals);
+      },
+      py::arg("binding"), py::arg("prog_var_vals"));
   return binding_cls;
 }
 
@@ -177,6 +184,12 @@ PYBIND11_MODULE(_mathematicalprogram_py, m) {
 
   py::class_<SolverId>(m, "SolverId").def("name", &SolverId::name);
 
+  py::class_<SolverStatistics>(m, "SolverStatistics")
+      .def_readonly("setup_time", &SolverStatistics::setup_time)
+      .def_readonly("solve_time", &SolverStatistics::solve_time)
+      .def_readonly("num_iterations", &SolverStatistics::num_iterations)
+      .def_readonly("num_nonzeros", &SolverStatistics::num_nonzeros);
+
   py::enum_<SolverType>(m, "SolverType")
       .value("kDReal", SolverType::kDReal)
       .value("kEqualityConstrainedQP", SolverType::kEqualityConstrainedQP)
@@ -355,6 +368,8 @@ PYBIND11_MODULE(_mathematicalprogram_py, m) {
                &MathematicalProgram::AddSosConstraint))
       .def("Solve", &MathematicalProgram::Solve)
       .def("GetSolverId", &MathematicalProgram::GetSolverId)
+      .def("GetSolverStatistics", &MathematicalProgram::GetSolverStatistics,
+           py_reference_internal)
       .def("linear_constraints", &MathematicalProgram::linear_constraints)
       .def("linear_equality_constraints",
            &MathematicalProgram::linear_equality_constraints)
@@ -52,6 +52,10 @@ class TestMathematicalProgram(unittest.TestCase):
         result = prog.Solve()
         self.assertEqual(result, mp.SolutionResult.kSolutionFound)
         self.assertIsNotNone(prog.GetSolverId().name())
+        statistics = prog.GetSolverStatistics()
+        self.assertIsInstance(statistics, mp.SolverStatistics)
+        if statistics.solve_time is not None:
+            self.assertGreaterEqual(statistics.solve_time, 0)
 
         # Test that we got the right solution for all x
         x_expected = np.array([1.0, 0.0, 1.0])
@@ -184,6 +188,14 @@ class TestMathematicalProgram(unittest.TestCase):
             value = prog.EvalBindingAtSolution(cost)
             self.assertTrue(np.allclose(value, value_expected))
 
+        # Evaluate at several points at once, one point per column.
+        X = np.array([[1., 0., 2.], [1., 3., -1.]])
+        for binding in constraints + costs:
+            values = prog.EvalBindingAtPoints(binding, X)
+            self.assertEqual(values.shape[1], 3)
+            self.assertTrue(np.allclose(
+                values[:, 0], prog.EvalBindingAtSolution(binding)))
+
     def test_matrix_variables(self):
         prog = mp.MathematicalProgram()
         x = prog.NewContinuousVariables(2, 2, "x")
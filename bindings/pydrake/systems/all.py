@@ -1,4 +1,5 @@
 from .analysis import *
+from .batched import *
 from .controllers import *
 from .framework import *
 from .primitives import *
@@ -42,8 +42,13 @@ PYBIND11_MODULE(analysis, m) {
          py::keep_alive<1, 2>(),
          // Keep alive, ownership: `Context` keeps `self` alive.
          py::keep_alive<3, 1>())
-    .def("Initialize", &Simulator<T>::Initialize)
-    .def("StepTo", &Simulator<T>::StepTo)
+    // N.B. The GIL is released while simulating so that simulators may run
+    // concurrently in Python threads. Python overrides reacquire it on entry
+    // (see the trampolines in `framework_py.cc`).
+    .def("Initialize", &Simulator<T>::Initialize,
+         py::call_guard<py::gil_scoped_release>())
+    .def("StepTo", &Simulator<T>::StepTo,
+         py::call_guard<py::gil_scoped_release>())
     .def("get_context", &Simulator<T>::get_context, py_reference_internal)
     .def("get_integrator", &Simulator<T>::get_integrator, py_reference_internal)
     .def("get_mutable_integrator", &Simulator<T>::get_mutable_integrator,
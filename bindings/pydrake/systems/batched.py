@@ -0,0 +1,75 @@
+"""
+Provides a `VectorSystem` base class whose Python callbacks operate on a whole
+batch of independent copies of the same dynamics at once.
+"""
+
+from pydrake.systems.framework import VectorSystem
+
+
+class BatchedVectorSystem(VectorSystem):
+    """A `VectorSystem` composed of `batch_size` independent copies of the same
+    dynamics, stacked contiguously in its input, state, and output vectors.
+
+    Each evaluation from C++ costs a single Python call for the whole batch,
+    so the interpreter overhead is amortized over the batch rather than paid
+    per copy. Subclasses override any of the following methods, which receive
+    2D views with one row per copy (writing to the last argument writes
+    directly into the C++ storage):
+
+        _DoCalcBatchedVectorOutput(self, context, u, x, y)
+        _DoCalcBatchedVectorTimeDerivatives(self, context, u, x, xdot)
+        _DoCalcBatchedVectorDiscreteVariableUpdates(self, context, u, x, xn)
+
+    As with `VectorSystem`, `u` has zero columns when the system is not direct
+    feedthrough.
+    """
+    def __init__(self, batch_size, input_size, output_size):
+        assert batch_size > 0
+        VectorSystem.__init__(
+            self, batch_size * input_size, batch_size * output_size)
+        self._batch_size = batch_size
+
+    def get_batch_size(self):
+        return self._batch_size
+
+    def _DeclareBatchedContinuousState(self, num_state_variables):
+        """Declares `num_state_variables` continuous states per copy."""
+        self._DeclareContinuousState(self._batch_size * num_state_variables)
+
+    def _DeclareBatchedDiscreteState(self, num_state_variables):
+        """Declares `num_state_variables` discrete states per copy."""
+        self._DeclareDiscreteState(self._batch_size * num_state_variables)
+
+    def _batch(self, vector):
+        # Row-major reshape of a contiguous vector; this is a view, not a
+        # copy, so writes propagate back to C++.
+        return vector.reshape(
+            (self._batch_size, vector.size // self._batch_size))
+
+    def _DoCalcVectorOutput(self, context, u, x, y):
+        if y.size == 0:
+            return
+        self._DoCalcBatchedVectorOutput(
+            context, self._batch(u), self._batch(x), self._batch(y))
+
+    def _DoCalcVectorTimeDerivatives(self, context, u, x, xdot):
+        if xdot.size == 0:
+            return
+        self._DoCalcBatchedVectorTimeDerivatives(
+            context, self._batch(u), self._batch(x), self._batch(xdot))
+
+    def _DoCalcVectorDiscreteVariableUpdates(self, context, u, x, xn):
+        if xn.size == 0:
+            return
+        self._DoCalcBatchedVectorDiscreteVariableUpdates(
+            context, self._batch(u), self._batch(x), self._batch(xn))
+
+    def _DoCalcBatchedVectorOutput(self, context, u, x, y):
+        raise NotImplementedError("_DoCalcBatchedVectorOutput")
+
+    def _DoCalcBatchedVectorTimeDerivatives(self, context, u, x, xdot):
+        raise NotImplementedError("_DoCalcBatchedVectorTimeDerivatives")
+
+    def _DoCalcBatchedVectorDiscreteVariableUpdates(self, context, u, x, xn):
+        raise NotImplementedError(
+            "_DoCalcBatchedVectorDiscreteVariableUpdates")
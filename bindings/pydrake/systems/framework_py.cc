@@ -89,6 +89,10 @@ class LeafSystemPublic : public LeafSystem<T> {
   using Base::DoCalcDiscreteVariableUpdates;
 };
 
+// N.B. `PYBIND11_OVERLOAD_INT` acquires the GIL before looking up a Python
+// override, so the trampolines below are safe to call from C++ code that has
+// released it (e.g. `Simulator::StepTo`).
+
 // Provide flexible inheritance to leverage prior binding information, per
 // documentation:
 // http://pybind11.readthedocs.io/en/stable/advanced/classes.html#combining-virtual-functions-and-inheritance  // NOLINT
@@ -312,6 +316,8 @@ PYBIND11_MODULE(framework, m) {
   // to copy it?
   // TODO(eric.cousineau): Make a helper wrapper for this; file a bug in
   // pybind11 (since these are arguments).
+  // N.B. pybind11's `std::function` caster acquires the GIL when the wrapped
+  // Python callable is invoked.
   using CalcVectorPtrCallback =
       std::function<void(const Context<T>*, BasicVector<T>*)>;
 
@@ -561,12 +567,28 @@ PYBIND11_MODULE(framework, m) {
    public:
     using Base = Value<py::object>;
     using Base::Base;
+    // The held object may be copied or released from C++ code that does not
+    // hold the GIL (e.g. `Simulator::StepTo`), so reacquire it whenever we
+    // touch Python reference counts.
+    ~PyObjectValue() override {
+      py::gil_scoped_acquire guard;
+      get_mutable_value() = py::object();
+    }
     // Override `Value<py::object>::Clone()` to perform a deep copy on the
     // object.
     std::unique_ptr<AbstractValue> Clone() const override {
+      py::gil_scoped_acquire guard;
       py::object py_copy = py::module::import("copy").attr("deepcopy");
       return std::make_unique<PyObjectValue>(py_copy(get_value()));
     }
+    void SetFrom(const AbstractValue& other) override {
+      py::gil_scoped_acquire guard;
+      Base::SetFrom(other);
+    }
+    void SetFromOrThrow(const AbstractValue& other) override {
+      py::gil_scoped_acquire guard;
+      Base::SetFromOrThrow(other);
+    }
   };
   AddValueInstantiation<py::object, PyObjectValue>(m);
 
@@ -93,11 +93,14 @@ PYBIND11_MODULE(sensors, m) {
         return py::make_tuple(
             self->height(), self->width(), int{ImageTraitsT::kNumChannels});
       };
-      auto get_data = [=](const ImageT* self) {
-        return ToArray(self->at(0, 0), self->size(), get_shape(self));
+      // The arrays share the image's buffer, and keep the image alive.
+      auto get_data = [=](py::object py_self) {
+        const ImageT* self = py_self.cast<const ImageT*>();
+        return ToArray(self->at(0, 0), self->size(), get_shape(self), py_self);
       };
-      auto get_mutable_data = [=](ImageT* self) {
-        return ToArray(self->at(0, 0), self->size(), get_shape(self));
+      auto get_mutable_data = [=](py::object py_self) {
+        ImageT* self = py_self.cast<ImageT*>();
+        return ToArray(self->at(0, 0), self->size(), get_shape(self), py_self);
       };
       auto check_coord = [](const ImageT* self, int x, int y) {
         // Since Image<>::at(...) uses DRAKE_ASSERT for performance reasons,
@@ -123,9 +126,8 @@ PYBIND11_MODULE(sensors, m) {
               }, py::arg("x"), py::arg("y"), py_reference_internal)
           // Non-C++ properties. Make them Pythonic.
           .def_property_readonly("shape", get_shape)
-          .def_property_readonly("data", get_data, py_reference_internal)
-          .def_property_readonly(
-              "mutable_data", get_mutable_data, py_reference_internal);
+          .def_property_readonly("data", get_data)
+          .def_property_readonly("mutable_data", get_mutable_data);
       // Constants.
       image.attr("Traits") = traits;
       // - Do not duplicate aliases (e.g. `kNumChannels`) for now.
@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+
+from __future__ import print_function
+
+import threading
+import unittest
+import numpy as np
+
+from pydrake.systems.analysis import (
+    Simulator,
+    )
+from pydrake.systems.batched import (
+    BatchedVectorSystem,
+    )
+from pydrake.systems.framework import (
+    BasicVector,
+    )
+from pydrake.systems.test.test_util import (
+    call_vector_system_overrides,
+    )
+
+
+class BatchedDecay(BatchedVectorSystem):
+    # A batch of first-order systems, ẋᵢ = -aᵢ xᵢ + uᵢ, y = x, each with 2
+    # states.
+    def __init__(self, rates, is_discrete=False):
+        BatchedVectorSystem.__init__(self, len(rates), 2, 2)
+        self._rates = np.asarray(rates).reshape((-1, 1))
+        if is_discrete:
+            self._DeclareBatchedDiscreteState(2)
+        else:
+            self._DeclareBatchedContinuousState(2)
+        self.num_calls = 0
+
+    def _DoCalcBatchedVectorOutput(self, context, u, x, y):
+        y[:] = x
+
+    def _DoCalcBatchedVectorTimeDerivatives(self, context, u, x, xdot):
+        self.num_calls += 1
+        xdot[:] = -self._rates * x + u
+
+    def _DoCalcBatchedVectorDiscreteVariableUpdates(self, context, u, x, xn):
+        self.num_calls += 1
+        xn[:] = x + u
+
+    def _DoHasDirectFeedthrough(self, input_port, output_port):
+        return False
+
+
+class TestBatched(unittest.TestCase):
+    def _simulate(self, rates, t_final):
+        system = BatchedDecay(rates)
+        self.assertEqual(system.get_batch_size(), len(rates))
+        simulator = Simulator(system)
+        context = simulator.get_mutable_context()
+        context.FixInputPort(0, BasicVector(np.zeros(2 * len(rates))))
+        x0 = np.tile([1., 2.], len(rates))
+        context.get_mutable_continuous_state_vector().SetFromVector(x0)
+        simulator.get_mutable_integrator().set_target_accuracy(1e-8)
+        simulator.StepTo(t_final)
+        x = context.get_continuous_state_vector().CopyToVector()
+        return system, x0, x
+
+    def test_batched_continuous(self):
+        rates = [0.5, 1., 2.]
+        t_final = 1.
+        system, x0, x = self._simulate(rates, t_final)
+        x_expected = x0 * np.exp(-t_final * np.repeat(rates, 2))
+        self.assertTrue(np.allclose(x, x_expected, atol=1e-5))
+        # One Python call per derivative evaluation of the whole batch.
+        self.assertGreater(system.num_calls, 0)
+
+        context = system.CreateDefaultContext()
+        context.get_mutable_continuous_state_vector().SetFromVector(x)
+        output = system.AllocateOutput(context)
+        system.CalcOutput(context, output)
+        self.assertTrue(np.allclose(output.get_vector_data(0).get_value(), x))
+
+    def test_batched_discrete(self):
+        system = BatchedDecay([1., 1.], is_discrete=True)
+        context = system.CreateDefaultContext()
+        u = np.array([1., 2., 3., 4.])
+        context.FixInputPort(0, BasicVector(u))
+        output = call_vector_system_overrides(system, context, True, 0.)
+        self.assertEqual(system.num_calls, 1)
+        x = context.get_discrete_state_vector().get_value()
+        self.assertTrue(np.allclose(x, u))
+        self.assertTrue(np.allclose(output.get_vector_data(0).get_value(), u))
+
+    def test_threaded_simulation(self):
+        # `StepTo` releases the GIL, and the Python overrides reacquire it, so
+        # simulators may be stepped from several threads.
+        rates = [[0.5], [1.], [2.], [4.]]
+        results = [None] * len(rates)
+
+        def run(i):
+            results[i] = self._simulate(rates[i], 1.)[2]
+
+        threads = [
+            threading.Thread(target=run, args=(i,)) for i in range(len(rates))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for i, x in enumerate(results):
+            self.assertTrue(np.allclose(x, self._simulate(rates[i], 1.)[2]))
@@ -1,6 +1,7 @@
 import pydrake.systems.sensors as mut
 
 import numpy as np
+import sys
 import unittest
 
 from pydrake.common import FindResourceOrThrow
@@ -142,6 +143,16 @@ class TestSensors(unittest.TestCase):
                     self.assertTrue(
                         np.allclose(data[ih, iw, :], image.at(iw, ih)))
 
+            # The arrays share the memory of the image, which they keep alive.
+            self.assertFalse(image.data.flags.writeable)
+            self.assertTrue(image.mutable_data.flags.writeable)
+            ref_count = sys.getrefcount(image)
+            data_view = image.data
+            self.assertGreater(sys.getrefcount(image), ref_count)
+            expected = np.array(data_view)
+            del image, data
+            self.assertTrue(np.array_equal(data_view, expected))
+
     def test_constants(self):
         # Simply ensure we can access the constants.
         values = [
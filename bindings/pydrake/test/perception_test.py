@@ -0,0 +1,39 @@
+from __future__ import absolute_import, division, print_function
+
+import pydrake.perception as mut
+
+import sys
+import unittest
+import numpy as np
+
+
+class TestPerception(unittest.TestCase):
+    def test_point_cloud_api(self):
+        self.assertEqual(mut.BaseField.kXYZs, 2)
+        pc = mut.PointCloud(new_size=5, fields=mut.BaseField.kXYZs)
+        self.assertEqual(pc.size(), 5)
+        self.assertTrue(pc.has_xyzs())
+        # Points are initialized to the default value.
+        self.assertTrue(np.all(np.isnan(pc.xyzs())))
+        self.assertTrue(np.isnan(mut.PointCloud.kDefaultValue))
+        pc.resize(3)
+        self.assertEqual(pc.xyzs().shape, (3, 3))
+
+    def test_point_cloud_views(self):
+        pc = mut.PointCloud(new_size=4)
+        self.assertEqual(pc.mutable_xyzs().dtype, np.float32)
+        # The arrays share the memory of the point cloud.
+        xyzs = pc.mutable_xyzs()
+        xyzs[:] = np.arange(12).reshape((3, 4))
+        self.assertTrue(np.allclose(pc.xyzs(), xyzs))
+        self.assertTrue(np.allclose(pc.xyz(2), [2, 6, 10]))
+        pc.mutable_xyz(3)[:] = [-1, -2, -3]
+        self.assertTrue(np.allclose(xyzs[:, 3], [-1, -2, -3]))
+        # The read-only view cannot be written to.
+        self.assertFalse(pc.xyzs().flags.writeable)
+        # The arrays keep the point cloud alive.
+        ref_count = sys.getrefcount(pc)
+        xyzs_view = pc.xyzs()
+        self.assertGreater(sys.getrefcount(pc), ref_count)
+        del pc
+        self.assertTrue(np.allclose(xyzs_view[:, 0], [0, 4, 8]))
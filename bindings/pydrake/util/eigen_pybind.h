@@ -17,24 +17,30 @@ auto ToEigenRef(Eigen::VectorBlock<Derived>* derived) {
   return Eigen::Ref<Derived>(*derived);
 }
 
-/// Converts a raw array to a numpy array.
+/// Converts a raw array to a numpy array, without copying. The array refers
+/// to the memory of `ptr`, which must be owned by `parent`; the array keeps
+/// `parent` alive.
 template <typename T>
-py::object ToArray(T* ptr, int size, py::tuple shape) {
+py::object ToArray(T* ptr, int size, py::tuple shape, py::handle parent) {
   // Create flat array to be reshaped in numpy.
   using Vector = VectorX<T>;
   Eigen::Map<Vector> data(ptr, size);
   return py::cast(
-      Eigen::Ref<Vector>(data), py_reference).attr("reshape")(shape);
+      Eigen::Ref<Vector>(data), py_reference_internal, parent)
+      .attr("reshape")(shape);
 }
 
-/// Converts a raw array to a numpy array (`const` variant).
+/// Converts a raw array to a read-only numpy array, without copying
+/// (`const` variant).
 template <typename T>
-py::object ToArray(const T* ptr, int size, py::tuple shape) {
+py::object ToArray(const T* ptr, int size, py::tuple shape,
+                   py::handle parent) {
   // Create flat array to be reshaped in numpy.
   using Vector = const VectorX<T>;
   Eigen::Map<Vector> data(ptr, size);
   return py::cast(
-      Eigen::Ref<Vector>(data), py_reference).attr("reshape")(shape);
+      Eigen::Ref<Vector>(data), py_reference_internal, parent)
+      .attr("reshape")(shape);
 }
 
 }  // namespace pydrake
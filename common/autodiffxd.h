@@ -18,6 +18,7 @@
 
 #include <cmath>
 #include <ostream>
+#include <utility>
 
 #include <Eigen/Dense>
 
@@ -38,6 +39,13 @@ namespace Eigen {
 // We also provide overloading of math functions for AutoDiffScalar<VectorXd>
 // which return AutoDiffScalar<VectorXd> instead of an expression tree.
 //
+// Since every AutoDiffScalar<VectorXd> owns a heap-allocated derivatives
+// vector, this specialization also tries to keep the number of allocations
+// low: it is movable, the compound assignment operators work in place, and
+// the arithmetic operators reuse the derivatives of temporary operands when
+// they are given rvalues. For instance, `a * b + c * d` allocates twice
+// rather than six times.
+//
 // See https://github.com/RobotLocomotion/drake/issues/6944 for more
 // information. See also drake/common/autodiff_overloads.h.
 //
@@ -70,6 +78,15 @@ class AutoDiffScalar<VectorXd>
   AutoDiffScalar(const Scalar& value, const DerType& der)
       : m_value(value), m_derivatives(der) {}
 
+  AutoDiffScalar(const Scalar& value, DerType&& der)
+      : m_value(value), m_derivatives(std::move(der)) {}
+
+  // Evaluates the derivatives expression `der` directly into the derivatives
+  // of this AutoDiffScalar, without going through a temporary vector.
+  template <typename OtherDerived>
+  AutoDiffScalar(const Scalar& value, const MatrixBase<OtherDerived>& der)
+      : m_value(value), m_derivatives(der) {}
+
   template <typename OtherDerType>
   AutoDiffScalar(
       const AutoDiffScalar<OtherDerType>& other
@@ -92,6 +109,9 @@ class AutoDiffScalar<VectorXd>
   AutoDiffScalar(const AutoDiffScalar& other)
       : m_value(other.value()), m_derivatives(other.derivatives()) {}
 
+  AutoDiffScalar(AutoDiffScalar&& other) noexcept
+      : m_value(other.m_value), m_derivatives(std::move(other.m_derivatives)) {}
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator=(const AutoDiffScalar<OtherDerType>& other) {
     m_value = other.value();
@@ -105,6 +125,12 @@ class AutoDiffScalar<VectorXd>
     return *this;
   }
 
+  inline AutoDiffScalar& operator=(AutoDiffScalar&& other) noexcept {
+    m_value = other.m_value;
+    m_derivatives = std::move(other.m_derivatives);
+    return *this;
+  }
+
   inline AutoDiffScalar& operator=(const Scalar& other) {
     m_value = other;
     if (m_derivatives.size() > 0) m_derivatives.setZero();
@@ -168,11 +194,11 @@ class AutoDiffScalar<VectorXd>
     return m_value != b.value();
   }
 
-  inline const AutoDiffScalar<DerType> operator+(const Scalar& other) const {
+  inline AutoDiffScalar<DerType> operator+(const Scalar& other) const {
     return AutoDiffScalar<DerType>(m_value + other, m_derivatives);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator+(
+  friend inline AutoDiffScalar<DerType> operator+(
       const Scalar& a, const AutoDiffScalar& b) {
     return AutoDiffScalar<DerType>(a + b.value(), b.derivatives());
   }
@@ -183,7 +209,7 @@ class AutoDiffScalar<VectorXd>
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator+(
+  inline AutoDiffScalar<DerType> operator+(
       const AutoDiffScalar<OtherDerType>& other) const {
     internal::make_coherent(m_derivatives, other.derivatives());
     return AutoDiffScalar<DerType>(m_value + other.value(),
@@ -192,15 +218,17 @@ class AutoDiffScalar<VectorXd>
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator+=(const AutoDiffScalar<OtherDerType>& other) {
-    (*this) = (*this) + other;
+    internal::make_coherent(m_derivatives, other.derivatives());
+    m_value += other.value();
+    m_derivatives += other.derivatives();
     return *this;
   }
 
-  inline const AutoDiffScalar<DerType> operator-(const Scalar& b) const {
+  inline AutoDiffScalar<DerType> operator-(const Scalar& b) const {
     return AutoDiffScalar<DerType>(m_value - b, m_derivatives);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator-(
+  friend inline AutoDiffScalar<DerType> operator-(
       const Scalar& a, const AutoDiffScalar& b) {
     return AutoDiffScalar<DerType>(a - b.value(), -b.derivatives());
   }
@@ -211,7 +239,7 @@ class AutoDiffScalar<VectorXd>
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator-(
+  inline AutoDiffScalar<DerType> operator-(
       const AutoDiffScalar<OtherDerType>& other) const {
     internal::make_coherent(m_derivatives, other.derivatives());
     return AutoDiffScalar<DerType>(m_value - other.value(),
@@ -220,29 +248,31 @@ class AutoDiffScalar<VectorXd>
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator-=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this - other;
+    internal::make_coherent(m_derivatives, other.derivatives());
+    m_value -= other.value();
+    m_derivatives -= other.derivatives();
     return *this;
   }
 
-  inline const AutoDiffScalar<DerType> operator-() const {
+  inline AutoDiffScalar<DerType> operator-() const {
     return AutoDiffScalar<DerType>(-m_value, -m_derivatives);
   }
 
-  inline const AutoDiffScalar<DerType> operator*(const Scalar& other) const {
+  inline AutoDiffScalar<DerType> operator*(const Scalar& other) const {
     return MakeAutoDiffScalar(m_value * other, m_derivatives * other);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator*(
+  friend inline AutoDiffScalar<DerType> operator*(
       const Scalar& other, const AutoDiffScalar& a) {
     return MakeAutoDiffScalar(a.value() * other, a.derivatives() * other);
   }
 
-  inline const AutoDiffScalar<DerType> operator/(const Scalar& other) const {
+  inline AutoDiffScalar<DerType> operator/(const Scalar& other) const {
     return MakeAutoDiffScalar(m_value / other,
                               (m_derivatives * (Scalar(1) / other)));
   }
 
-  friend inline const AutoDiffScalar<DerType> operator/(
+  friend inline AutoDiffScalar<DerType> operator/(
       const Scalar& other, const AutoDiffScalar& a) {
     return MakeAutoDiffScalar(
         other / a.value(),
@@ -250,7 +280,7 @@ class AutoDiffScalar<VectorXd>
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator/(
+  inline AutoDiffScalar<DerType> operator/(
       const AutoDiffScalar<OtherDerType>& other) const {
     internal::make_coherent(m_derivatives, other.derivatives());
     return MakeAutoDiffScalar(
@@ -260,7 +290,7 @@ class AutoDiffScalar<VectorXd>
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator*(
+  inline AutoDiffScalar<DerType> operator*(
       const AutoDiffScalar<OtherDerType>& other) const {
     internal::make_coherent(m_derivatives, other.derivatives());
     return MakeAutoDiffScalar(
@@ -269,34 +299,158 @@ class AutoDiffScalar<VectorXd>
   }
 
   inline AutoDiffScalar& operator*=(const Scalar& other) {
-    *this = *this * other;
+    m_value *= other;
+    m_derivatives *= other;
     return *this;
   }
 
+  // The derivatives are updated before the value, since they depend on the
+  // value of both operands and `other` might alias `*this`.
   template <typename OtherDerType>
   inline AutoDiffScalar& operator*=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this * other;
+    internal::make_coherent(m_derivatives, other.derivatives());
+    m_derivatives =
+        m_derivatives * other.value() + other.derivatives() * m_value;
+    m_value *= other.value();
     return *this;
   }
 
   inline AutoDiffScalar& operator/=(const Scalar& other) {
-    *this = *this / other;
+    m_value /= other;
+    m_derivatives *= Scalar(1) / other;
     return *this;
   }
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator/=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this / other;
+    internal::make_coherent(m_derivatives, other.derivatives());
+    m_derivatives =
+        (m_derivatives * other.value() - other.derivatives() * m_value) *
+        (Scalar(1) / (other.value() * other.value()));
+    m_value /= other.value();
     return *this;
   }
 
+  // Overloads taking rvalues, which reuse the derivatives of a temporary
+  // operand to store the result instead of allocating new ones.
+
+  friend inline AutoDiffScalar operator+(AutoDiffScalar&& a,
+                                         const AutoDiffScalar& b) {
+    a += b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator+(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    b += a;
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator+(AutoDiffScalar&& a,
+                                         AutoDiffScalar&& b) {
+    a += b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator+(AutoDiffScalar&& a, const Scalar& b) {
+    a.value() += b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator+(const Scalar& a, AutoDiffScalar&& b) {
+    b.value() += a;
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator-(AutoDiffScalar&& a,
+                                         const AutoDiffScalar& b) {
+    a -= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator-(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    internal::make_coherent(a.derivatives(), b.derivatives());
+    b.value() = a.value() - b.value();
+    b.derivatives() = a.derivatives() - b.derivatives();
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator-(AutoDiffScalar&& a,
+                                         AutoDiffScalar&& b) {
+    a -= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator-(AutoDiffScalar&& a, const Scalar& b) {
+    a.value() -= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator-(const Scalar& a, AutoDiffScalar&& b) {
+    b.value() = a - b.value();
+    b.derivatives() = -b.derivatives();
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator-(AutoDiffScalar&& a) {
+    a.value() = -a.value();
+    a.derivatives() = -a.derivatives();
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator*(AutoDiffScalar&& a,
+                                         const AutoDiffScalar& b) {
+    a *= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator*(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    b *= a;
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator*(AutoDiffScalar&& a,
+                                         AutoDiffScalar&& b) {
+    a *= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator*(AutoDiffScalar&& a, const Scalar& b) {
+    a *= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator*(const Scalar& a, AutoDiffScalar&& b) {
+    b *= a;
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator/(AutoDiffScalar&& a,
+                                         const AutoDiffScalar& b) {
+    a /= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator/(AutoDiffScalar&& a,
+                                         AutoDiffScalar&& b) {
+    a /= b;
+    return std::move(a);
+  }
+
+  friend inline AutoDiffScalar operator/(AutoDiffScalar&& a, const Scalar& b) {
+    a /= b;
+    return std::move(a);
+  }
+
  protected:
   Scalar m_value;
   DerType m_derivatives;
 };
 
 #define DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(FUNC, CODE) \
-  inline const AutoDiffScalar<VectorXd> FUNC(                   \
+  inline AutoDiffScalar<VectorXd> FUNC(                         \
       const AutoDiffScalar<VectorXd>& x) {                      \
     EIGEN_UNUSED typedef double Scalar;                         \
     CODE;                                                       \
@@ -367,8 +521,8 @@ DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
 
 // We have this specialization here because the Eigen-3.3.3's atan2
 // implementation for AutoDiffScalar does not call `make_coherent` function.
-inline const AutoDiffScalar<VectorXd> atan2(const AutoDiffScalar<VectorXd>& a,
-                                            const AutoDiffScalar<VectorXd>& b) {
+inline AutoDiffScalar<VectorXd> atan2(const AutoDiffScalar<VectorXd>& a,
+                                      const AutoDiffScalar<VectorXd>& b) {
   using std::atan2;
   typedef double Scalar;
   typedef AutoDiffScalar<Matrix<Scalar, Dynamic, 1>> PlainADS;
@@ -412,8 +566,8 @@ inline AutoDiffScalar<VectorXd> max(const AutoDiffScalar<VectorXd>& x,
   return (x.value() >= y.value() ? x : y);
 }
 
-inline const AutoDiffScalar<VectorXd> pow(const AutoDiffScalar<VectorXd>& a,
-                                          double b) {
+inline AutoDiffScalar<VectorXd> pow(const AutoDiffScalar<VectorXd>& a,
+                                    double b) {
   using std::pow;
   return MakeAutoDiffScalar(pow(a.value(), b),
                             a.derivatives() * (b * pow(a.value(), b - 1)));
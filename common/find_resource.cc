@@ -1,6 +1,8 @@
 #include "drake/common/find_resource.h"
 
 #include <cstdlib>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -227,6 +229,62 @@ std::vector<string>& GetMutableResourceSearchPaths() {
   static never_destroyed<std::vector<string>> search_paths;
   return search_paths.access();
 }
+
+// The process-wide memory of the file system queries of FindResource() and
+// CachedPathExists(). All members are guarded by `mutex`.
+struct ResourceCache {
+  std::mutex mutex;
+  // The (priority-ordered) directories searched by FindResource(), or nullopt
+  // if they have not been located yet.
+  optional<std::vector<optional<string>>> candidate_dirs;
+  // The value of the environment variable when candidate_dirs was located.
+  optional<string> resource_root;
+  // The absolute path of each resource found in candidate_dirs, keyed by its
+  // path relative to them.
+  std::unordered_map<string, string> absolute_paths;
+  // Whether each path queried by CachedPathExists() exists.
+  std::unordered_map<string, bool> path_exists;
+};
+
+ResourceCache& GetResourceCache() {
+  static never_destroyed<ResourceCache> cache;
+  return cache.access();
+}
+
+// Locates the (priority-ordered) directories to check for resources, given
+// the value of the environment variable.  Candidate paths will already end
+// with "drake" as their final path element, or possibly a related name like
+// "drake2"; that is, they will contain files named like "common/foo.txt", not
+// "drake/common/foo.txt".
+std::vector<optional<string>> FindCandidateDirs(
+    const optional<string>& resource_root) {
+  std::vector<optional<string>> candidate_dirs;
+
+  // (1) Search the environment variable first; if it works, it should always
+  // win.  TODO(jwnimmer-tri) Should we split on colons, making this a PATH?
+  candidate_dirs.emplace_back(AppendDrakeTo(resource_root));
+
+  // (2) Add the list of paths given programmatically. Paths are added only
+  // if the sentinel file can be found.
+  for (const auto& search_path : GetMutableResourceSearchPaths()) {
+    spruce::path candidate_dir(*AppendDrakeTo(search_path));
+    candidate_dirs.emplace_back(CheckCandidateDir(candidate_dir));
+  }
+
+  // (3) Find where `librake.so` is, and add search path that corresponds to
+  // resource folder in install tree based on `libdrake.so` location.
+  candidate_dirs.emplace_back(GetCandidateDirFromLibdrake());
+
+  // (4) Find resources during `bazel test` execution.
+  candidate_dirs.emplace_back(GetTestRunfilesDir());
+
+  // (5) Search in cwd (and its parent, grandparent, etc.) to find Drake's
+  // resource-root sentinel file.
+  candidate_dirs.emplace_back(FindSentinelDir());
+
+  return candidate_dirs;
+}
+
 }  // namespace
 
 std::vector<string> GetResourceSearchPaths() {
@@ -235,6 +293,28 @@ std::vector<string> GetResourceSearchPaths() {
 
 void AddResourceSearchPath(string search_path) {
   GetMutableResourceSearchPaths().push_back(std::move(search_path));
+  ClearResourceCache();
+}
+
+bool CachedPathExists(const string& path) {
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  const auto iter = cache.path_exists.find(path);
+  if (iter != cache.path_exists.end()) {
+    return iter->second;
+  }
+  const bool exists = spruce::path(path).exists();
+  cache.path_exists.emplace(path, exists);
+  return exists;
+}
+
+void ClearResourceCache() {
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.candidate_dirs = nullopt;
+  cache.resource_root = nullopt;
+  cache.absolute_paths.clear();
+  cache.path_exists.clear();
 }
 
 Result FindResource(string resource_path) {
@@ -257,38 +337,29 @@ Result FindResource(string resource_path) {
   }
   const std::string resource_path_substr = resource_path.substr(prefix.size());
 
-  // Collect a list of (priority-ordered) directories to check.  Candidate
-  // paths will already end with "drake" as their final path element, or
-  // possibly a related name like "drake2"; that is, they will contain files
-  // named like "common/foo.txt", not "drake/common/foo.txt".
-  std::vector<optional<string>> candidate_dirs;
-
-  // (1) Search the environment variable first; if it works, it should always
-  // win.  TODO(jwnimmer-tri) Should we split on colons, making this a PATH?
-  candidate_dirs.emplace_back(AppendDrakeTo(getenv_optional(
-      kDrakeResourceRootEnvironmentVariableName)));
-
-  // (2) Add the list of paths given programmatically. Paths are added only
-  // if the sentinel file can be found.
-  for (const auto& search_path : GetMutableResourceSearchPaths()) {
-    spruce::path candidate_dir(*AppendDrakeTo(search_path));
-    candidate_dirs.emplace_back(CheckCandidateDir(candidate_dir));
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  // Locate the directories to check, unless they are already known for the
+  // current value of the environment variable.
+  const optional<string> resource_root =
+      getenv_optional(kDrakeResourceRootEnvironmentVariableName);
+  if (!cache.candidate_dirs || cache.resource_root != resource_root) {
+    cache.candidate_dirs = FindCandidateDirs(resource_root);
+    cache.resource_root = resource_root;
+    cache.absolute_paths.clear();
   }
 
-  // (3) Find where `librake.so` is, and add search path that corresponds to
-  // resource folder in install tree based on `libdrake.so` location.
-  candidate_dirs.emplace_back(GetCandidateDirFromLibdrake());
-
-  // (4) Find resources during `bazel test` execution.
-  candidate_dirs.emplace_back(GetTestRunfilesDir());
-
-  // (5) Search in cwd (and its parent, grandparent, etc.) to find Drake's
-  // resource-root sentinel file.
-  candidate_dirs.emplace_back(FindSentinelDir());
+  // Reuse the result of an earlier search for the same resource.
+  const auto iter = cache.absolute_paths.find(resource_path_substr);
+  if (iter != cache.absolute_paths.end()) {
+    return Result::make_success(std::move(resource_path), iter->second);
+  }
 
   // See which (if any) candidate contains the requested resource.
-  for (const auto& candidate_dir : candidate_dirs) {
+  for (const auto& candidate_dir : *cache.candidate_dirs) {
     if (auto absolute_path = FileExists(candidate_dir, resource_path_substr)) {
+      cache.absolute_paths.emplace(resource_path_substr, *absolute_path);
       return Result::make_success(
           std::move(resource_path), std::move(*absolute_path));
     }
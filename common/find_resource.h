@@ -94,12 +94,34 @@ std::vector<std::string> GetResourceSearchPaths();
 /// 2) in the directories specified by `AddResourceSearchPath()` and 3) in the
 /// drake source workspace. If all of these are unavailable, or do not have the
 /// resource, then it will return a failed result.
+///
+/// Successful results are cached process-wide; see ClearResourceCache().
 FindResourceResult FindResource(std::string resource_path);
 
 /// Convenient wrapper for querying FindResource(resource_path) followed by
 /// FindResourceResult::get_absolute_path_or_throw().
 std::string FindResourceOrThrow(std::string resource_path);
 
+/// Returns true iff a file or directory exists at @p path, like
+/// `spruce::path::exists()`. The answer for each path is remembered
+/// process-wide, so that repeated queries for the same path, such as those
+/// of the model parsers for the meshes and `package.xml` files of each model,
+/// make no system calls. Call ClearResourceCache() if files may have been
+/// created or removed since a path was first queried.
+bool CachedPathExists(const std::string& path);
+
+/// Clears the process-wide cache of FindResource() results, of the
+/// directories that it searches, and of CachedPathExists() answers.
+///
+/// FindResource() locates its search directories once, and remembers where
+/// it found each resource. The cache is cleared automatically when
+/// AddResourceSearchPath() is called or when the value of the
+/// kDrakeResourceRootEnvironmentVariableName environment variable changes.
+/// It must be cleared manually if resources move, or if the current
+/// directory changes such that a different Drake source tree should be
+/// searched.
+void ClearResourceCache();
+
 /// The name of the environment variable that provides the first place where
 /// FindResource attempts to look.  The environment variable is allowed to be
 /// unset or empty; in that case, FindResource will attempt to use other
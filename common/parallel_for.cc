@@ -0,0 +1,66 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace drake {
+
+int GetDefaultNumThreads() {
+  const unsigned int hardware = std::thread::hardware_concurrency();
+  return hardware == 0 ? 1 : static_cast<int>(hardware);
+}
+
+void ParallelFor(int num_tasks, int num_threads,
+                 const std::function<void(int)>& task) {
+  if (num_tasks < 0) {
+    throw std::logic_error("ParallelFor(): num_tasks must be non-negative.");
+  }
+  if (num_threads < 1) {
+    throw std::logic_error("ParallelFor(): num_threads must be positive.");
+  }
+
+  // Serial fast path; this avoids any thread or synchronization overhead.
+  if (num_threads == 1 || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; ++i) task(i);
+    return;
+  }
+
+  std::atomic<int> next_task{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr first_exception;
+  std::mutex exception_mutex;
+
+  auto worker = [&]() {
+    while (!failed.load()) {
+      const int i = next_task.fetch_add(1);
+      if (i >= num_tasks) return;
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!first_exception) first_exception = std::current_exception();
+        failed.store(true);
+      }
+    }
+  };
+
+  const int num_spawned = std::min(num_threads, num_tasks) - 1;
+  std::vector<std::thread> threads;
+  threads.reserve(num_spawned);
+  for (int t = 0; t < num_spawned; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (first_exception) std::rethrow_exception(first_exception);
+}
+
+}  // namespace drake
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+
+/// @file
+/// Provides drake::ParallelFor, a minimal helper for running independent
+/// tasks on a fixed number of worker threads.
+
+namespace drake {
+
+/// Returns the default number of threads to use for parallel work, which is
+/// the number of concurrent threads supported by the hardware (or 1 if that
+/// cannot be determined).
+int GetDefaultNumThreads();
+
+/// Invokes `task(i)` exactly once for each `i` in `[0, num_tasks)`, spreading
+/// the invocations across at most `num_threads` threads. The calling thread
+/// participates in the work, so `num_threads == 1` runs every task serially
+/// on the calling thread with no threads spawned. Tasks are handed out in
+/// increasing order of `i`, but may complete in any order; each task should
+/// write its result into storage indexed by `i` so that results do not depend
+/// on scheduling.
+///
+/// If any task throws, no further tasks are started, the remaining in-flight
+/// tasks are allowed to finish, and then the first exception thrown is
+/// rethrown on the calling thread.
+///
+/// @param num_tasks The number of tasks to run; must be non-negative.
+/// @param num_threads The maximum number of threads to use; must be positive.
+/// @param task The function to invoke. It must be safe to call concurrently
+///             from several threads with distinct arguments.
+/// @throws std::logic_error if `num_tasks` or `num_threads` is out of range.
+void ParallelFor(int num_tasks, int num_threads,
+                 const std::function<void(int)>& task);
+
+}  // namespace drake
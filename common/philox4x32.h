@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace drake {
+
+/// A counter-based pseudo-random number generator, implementing the
+/// Philox4x32-10 algorithm of Salmon et al., "Parallel random numbers: as easy
+/// as 1, 2, 3", SC 2011.
+///
+/// The n-th block of four outputs is a pure function of the key (the seed)
+/// and of the counter n, computed in ten rounds of multiplications and xors
+/// over four independent 32-bit lanes. The state is therefore just the key and
+/// the counter, generators with different seeds produce independent streams,
+/// and the output is the same on all platforms. This makes it suitable for
+/// Monte Carlo runs that must be reproducible regardless of the number of
+/// threads or the order in which their samples are drawn.
+///
+/// This class models the C++ UniformRandomBitGenerator concept, so it can be
+/// used with the distributions of `<random>`.
+class Philox4x32 {
+ public:
+  typedef uint32_t result_type;
+
+  static constexpr result_type default_seed = 20111115u;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Constructs a generator whose key is @p seed, with its counter at zero.
+  explicit Philox4x32(result_type seed = default_seed) : key_{{seed, 0}} {}
+
+  /// Returns the next output, and advances the counter after every fourth.
+  result_type operator()() {
+    if (next_ == kBlockSize) {
+      block_ = Generate(counter_, key_);
+      IncrementCounter();
+      next_ = 0;
+    }
+    return block_[next_++];
+  }
+
+  /// Writes the next @p count outputs to @p output. This is equivalent to
+  /// calling operator() @p count times, but generates the blocks in batches
+  /// whose independent lanes the compiler can vectorize.
+  void Fill(result_type* output, int count) {
+    int i = 0;
+    for (; i < count && next_ < kBlockSize; ++i) {
+      output[i] = block_[next_++];
+    }
+    for (; count - i >= kBatchSize * kBlockSize; i += kBatchSize * kBlockSize) {
+      GenerateBatch(output + i);
+    }
+    for (; i < count; ++i) {
+      output[i] = (*this)();
+    }
+  }
+
+  /// Returns the block of four outputs for the given @p counter and @p key.
+  static std::array<uint32_t, 4> Generate(std::array<uint32_t, 4> counter,
+                                          std::array<uint32_t, 2> key) {
+    for (int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      const uint64_t product0 = uint64_t{kMultiplier0} * counter[0];
+      const uint64_t product1 = uint64_t{kMultiplier1} * counter[2];
+      counter = {{static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                  static_cast<uint32_t>(product1),
+                  static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                  static_cast<uint32_t>(product0)}};
+    }
+    return counter;
+  }
+
+ private:
+  static constexpr int kBlockSize = 4;
+  static constexpr int kBatchSize = 8;
+  static constexpr uint32_t kMultiplier0 = 0xD2511F53;
+  static constexpr uint32_t kMultiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85;
+
+  // Writes the blocks for the next kBatchSize counters to `output`, and
+  // advances the counter past them. This is Generate() with the lanes stored
+  // as separate arrays, one element per counter.
+  void GenerateBatch(result_type* output) {
+    uint32_t x0[kBatchSize], x1[kBatchSize], x2[kBatchSize], x3[kBatchSize];
+    for (int j = 0; j < kBatchSize; ++j) {
+      x0[j] = counter_[0];
+      x1[j] = counter_[1];
+      x2[j] = counter_[2];
+      x3[j] = counter_[3];
+      IncrementCounter();
+    }
+    std::array<uint32_t, 2> key = key_;
+    for (int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      for (int j = 0; j < kBatchSize; ++j) {
+        const uint64_t product0 = uint64_t{kMultiplier0} * x0[j];
+        const uint64_t product1 = uint64_t{kMultiplier1} * x2[j];
+        x0[j] = static_cast<uint32_t>(product1 >> 32) ^ x1[j] ^ key[0];
+        x1[j] = static_cast<uint32_t>(product1);
+        x2[j] = static_cast<uint32_t>(product0 >> 32) ^ x3[j] ^ key[1];
+        x3[j] = static_cast<uint32_t>(product0);
+      }
+    }
+    for (int j = 0; j < kBatchSize; ++j) {
+      output[kBlockSize * j] = x0[j];
+      output[kBlockSize * j + 1] = x1[j];
+      output[kBlockSize * j + 2] = x2[j];
+      output[kBlockSize * j + 3] = x3[j];
+    }
+  }
+
+  void IncrementCounter() {
+    for (uint32_t& word : counter_) {
+      if (++word != 0) break;
+    }
+  }
+
+  std::array<uint32_t, 2> key_;
+  std::array<uint32_t, 4> counter_{};
+  std::array<uint32_t, 4> block_{};
+  int next_{kBlockSize};
+};
+
+}  // namespace drake
@@ -15,6 +15,44 @@ using std::runtime_error;
 using std::string;
 using std::vector;
 
+namespace {
+
+// Returns the power of a Monomial of a sorted univariate Polynomial (see
+// Polynomial::IsSortedUnivariate()).
+template <typename Monomial>
+int PowerOf(const Monomial& monomial) {
+  return monomial.terms.empty() ? 0 : monomial.terms[0].power;
+}
+
+// Returns the Monomials of a + sign * b, for the Monomials @p a and @p b of
+// sorted univariate Polynomials in the same variable, in increasing order of
+// power and without zero coefficients.
+template <typename Monomial, typename CoefficientType>
+vector<Monomial> MergeSortedUnivariate(const vector<Monomial>& a,
+                                       const vector<Monomial>& b,
+                                       const CoefficientType& sign) {
+  vector<Monomial> result;
+  result.reserve(a.size() + b.size());
+  auto a_iter = a.begin();
+  auto b_iter = b.begin();
+  while (a_iter != a.end() || b_iter != b.end()) {
+    if (b_iter == b.end() ||
+        (a_iter != a.end() && PowerOf(*a_iter) < PowerOf(*b_iter))) {
+      result.push_back(*a_iter++);
+    } else if (a_iter == a.end() || PowerOf(*b_iter) < PowerOf(*a_iter)) {
+      result.push_back(*b_iter++);
+      result.back().coefficient *= sign;
+    } else {
+      result.push_back(*a_iter++);
+      result.back().coefficient += sign * (b_iter++)->coefficient;
+    }
+    if (result.back().coefficient == 0) result.pop_back();
+  }
+  return result;
+}
+
+}  // namespace
+
 template <typename CoefficientType>
 bool Polynomial<CoefficientType>::Monomial::HasSameExponents(
     const Monomial& other) const {
@@ -261,6 +299,7 @@ Polynomial<CoefficientType> Polynomial<CoefficientType>::Derivative(
     return *this;
   }
   Polynomial<CoefficientType> ret;
+  ret.monomials_.reserve(monomials_.size());
 
   for (typename vector<Monomial>::const_iterator iter = monomials_.begin();
        iter != monomials_.end(); iter++) {
@@ -286,6 +325,29 @@ Polynomial<CoefficientType> Polynomial<CoefficientType>::Integral(
   if (!is_univariate_)
     throw runtime_error(
         "Integral is only defined for univariate polynomials");
+  VarType var{};
+  if (IsSortedUnivariate(&var) && var != 0) {
+    // Keeps the result sorted, with the integration constant first.
+    Polynomial<CoefficientType> ret;
+    ret.monomials_.reserve(monomials_.size() + 1);
+    Monomial constant;
+    constant.coefficient = integration_constant;
+    ret.monomials_.push_back(constant);
+    for (const Monomial& monomial : monomials_) {
+      Monomial m;
+      if (monomial.terms.empty()) {
+        m.coefficient = monomial.coefficient;
+        m.terms.push_back(Term{var, 1});
+      } else {
+        m = monomial;
+        m.coefficient /= static_cast<RealScalar>(m.terms[0].power + 1);
+        m.terms[0].power += PowerType{1};
+      }
+      ret.monomials_.push_back(m);
+    }
+    ret.is_univariate_ = true;
+    return ret;
+  }
   Polynomial<CoefficientType> ret = *this;
 
   for (typename vector<Monomial>::iterator iter = ret.monomials_.begin();
@@ -331,6 +393,12 @@ bool Polynomial<CoefficientType>::operator==(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator+=(
     const Polynomial<CoefficientType>& other) {
+  VarType var{}, other_var{};
+  if (IsSortedUnivariate(&var) && other.IsSortedUnivariate(&other_var) &&
+      (var == other_var || var == 0 || other_var == 0)) {
+    monomials_ = MergeSortedUnivariate(monomials_, other.monomials_, CoefficientType{1});
+    return *this;
+  }
   for (const auto& iter : other.monomials_) {
     monomials_.push_back(iter);
   }
@@ -341,6 +409,12 @@ Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator+=(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator-=(
     const Polynomial<CoefficientType>& other) {
+  VarType var{}, other_var{};
+  if (IsSortedUnivariate(&var) && other.IsSortedUnivariate(&other_var) &&
+      (var == other_var || var == 0 || other_var == 0)) {
+    monomials_ = MergeSortedUnivariate(monomials_, other.monomials_, CoefficientType{-1});
+    return *this;
+  }
   for (const auto& iter : other.monomials_) {
     monomials_.push_back(iter);
     monomials_.back().coefficient *= CoefficientType{-1};
@@ -352,6 +426,35 @@ Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator-=(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator*=(
     const Polynomial<CoefficientType>& other) {
+  VarType var{}, other_var{};
+  if (IsSortedUnivariate(&var) && other.IsSortedUnivariate(&other_var) &&
+      (var == other_var || var == 0 || other_var == 0)) {
+    if (monomials_.empty() || other.monomials_.empty()) {
+      monomials_.clear();
+      return *this;
+    }
+    // Convolves the coefficients densely, then keeps the nonzero ones in
+    // increasing order of power.
+    if (var == 0) var = other_var;
+    vector<CoefficientType> product(
+        PowerOf(monomials_.back()) + PowerOf(other.monomials_.back()) + 1,
+        CoefficientType{0});
+    for (const Monomial& m : monomials_) {
+      for (const Monomial& other_m : other.monomials_) {
+        product[PowerOf(m) + PowerOf(other_m)] +=
+            m.coefficient * other_m.coefficient;
+      }
+    }
+    monomials_.clear();
+    for (int power = 0; power < static_cast<int>(product.size()); power++) {
+      if (product[power] == 0) continue;
+      Monomial m;
+      m.coefficient = product[power];
+      if (power > 0) m.terms.push_back(Term{var, power});
+      monomials_.push_back(m);
+    }
+    return *this;
+  }
   vector<Monomial> new_monomials;
 
   for (const auto& iter : monomials_) {
@@ -579,6 +682,29 @@ string Polynomial<CoefficientType>::IdToVariableName(const VarType id) {
   return string(name) + std::to_string((m + 1));
 }
 
+template <typename CoefficientType>
+bool Polynomial<CoefficientType>::IsSortedUnivariate(VarType* var) const {
+  VarType unique_var = 0;
+  PowerType previous_power = -1;
+  for (const Monomial& monomial : monomials_) {
+    PowerType power = 0;
+    if (!monomial.terms.empty()) {
+      const Term& term = monomial.terms[0];
+      if (monomial.terms.size() > 1 || term.power < 1) return false;
+      if (unique_var == 0) {
+        unique_var = term.var;
+      } else if (term.var != unique_var) {
+        return false;
+      }
+      power = term.power;
+    }
+    if (power <= previous_power) return false;
+    previous_power = power;
+  }
+  if (var != nullptr) *var = unique_var;
+  return true;
+}
+
 template <typename CoefficientType>
 void Polynomial<CoefficientType>::MakeMonomialsUnique(void) {
   VarType unique_var = 0;  // also update the univariate flag
@@ -190,6 +190,20 @@ class Polynomial {
       throw std::runtime_error(
           "this method can only be used for univariate polynomials");
     ProductType value = 0;
+    if (IsSortedUnivariate(nullptr)) {
+      // Horner's method, from the highest power down.
+      const ProductType x_value = static_cast<ProductType>(x);
+      PowerType power = 0;
+      for (auto iter = monomials_.rbegin(); iter != monomials_.rend(); ++iter) {
+        const PowerType next_power =
+            iter->terms.empty() ? 0 : iter->terms[0].power;
+        for (PowerType k = next_power; k < power; ++k) value *= x_value;
+        value += iter->coefficient;
+        power = next_power;
+      }
+      for (PowerType k = 0; k < power; ++k) value *= x_value;
+      return value;
+    }
     using std::pow;
     for (typename std::vector<Monomial>::const_iterator iter =
              monomials_.begin();
@@ -442,6 +456,14 @@ class Polynomial {
  private:
   /// Sorts through Monomial list and merges any that have the same powers.
   void MakeMonomialsUnique(void);
+
+  /// Returns true iff every Monomial is either a constant or a positive power
+  /// of one same variable, in strictly increasing order of power, as for a
+  /// Polynomial built from a vector of coefficients.  Univariate evaluation
+  /// and arithmetic take allocation-light paths on such Polynomials, which
+  /// preserve that order.  If @p var is non-null, it is set to the variable,
+  /// or to 0 if there is none.
+  bool IsSortedUnivariate(VarType* var) const;
 };
 
 /** Provides power function for Polynomial. */
@@ -0,0 +1,619 @@
+#include "drake/common/symbolic_compiled_expression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::ostringstream;
+using std::runtime_error;
+using std::string;
+
+// Flattens expressions into the tape of a CompiledExpression. Every
+// expression and formula is compiled into the register holding its value,
+// and the registers of the expressions and formulas compiled so far are
+// memoized so that common subexpressions are only compiled once.
+class CompiledExpression::Compiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Compiler)
+
+  // Binds the variables of `compiled` to their registers.
+  explicit Compiler(CompiledExpression* compiled) : compiled_(compiled) {
+    const VectorX<Variable>& variables = compiled_->variables_;
+    compiled_->initial_registers_.assign(variables.size(), 0.0);
+    for (int i = 0; i < variables.size(); ++i) {
+      if (!variable_registers_.emplace(variables(i), i).second) {
+        ostringstream oss;
+        oss << "CompiledExpression: the variable " << variables(i)
+            << " is repeated in the list of variables.";
+        throw runtime_error(oss.str());
+      }
+    }
+  }
+
+  // Returns the register holding the value of `e`.
+  int Compile(const Expression& e) {
+    const auto it = expression_registers_.find(e);
+    if (it != expression_registers_.end()) {
+      return it->second;
+    }
+    const int result = VisitExpression<int>(this, e);
+    expression_registers_.emplace(e, result);
+    return result;
+  }
+
+ private:
+  // Makes VisitExpression a friend of this class so that it can use private
+  // methods.
+  friend int drake::symbolic::VisitExpression<int>(Compiler*,
+                                                  const Expression&);
+
+  // Returns a register holding the constant `c`.
+  int Constant(const double c) {
+    // Constants are identified by their bits, so that 0.0 and -0.0 are told
+    // apart.
+    std::uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(c), "Unexpected size of double.");
+    std::memcpy(&bits, &c, sizeof(c));
+    const auto it = constant_registers_.find(bits);
+    if (it != constant_registers_.end()) {
+      return it->second;
+    }
+    const int result = static_cast<int>(compiled_->initial_registers_.size());
+    compiled_->initial_registers_.push_back(c);
+    constant_registers_.emplace(bits, result);
+    return result;
+  }
+
+  // Appends an instruction writing to a new register, and returns that
+  // register.
+  int Emit(const Opcode op, const int in1, const int in2 = -1,
+           const int in3 = -1, const double c = 0.0) {
+    const int out = static_cast<int>(compiled_->initial_registers_.size());
+    compiled_->initial_registers_.push_back(0.0);
+    compiled_->instructions_.push_back({op, out, in1, in2, in3, c});
+    return out;
+  }
+
+  int Unary(const Opcode op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)));
+  }
+
+  int Binary(const Opcode op, const Expression& e) {
+    return Emit(op, Compile(get_first_argument(e)),
+                Compile(get_second_argument(e)));
+  }
+
+  int CompilePow(const Expression& base, const Expression& exponent) {
+    const int base_register = Compile(base);
+    if (!is_constant(exponent)) {
+      return Emit(Opcode::kPow, base_register, Compile(exponent));
+    }
+    const double v = get_constant_value(exponent);
+    if (v == 1.0) {
+      return base_register;
+    }
+    if (v == 2.0) {
+      return Emit(Opcode::kMul, base_register, base_register);
+    }
+    return Emit(Opcode::kPowConstant, base_register, -1, -1, v);
+  }
+
+  // Returns the register holding the value of `f`, which is 1 if `f` is true
+  // and 0 if it is false.
+  int CompileFormula(const Formula& f) {
+    const auto it = formula_registers_.find(f);
+    if (it != formula_registers_.end()) {
+      return it->second;
+    }
+    const int result = DoCompileFormula(f);
+    formula_registers_.emplace(f, result);
+    return result;
+  }
+
+  int DoCompileFormula(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::False:
+        return Constant(0.0);
+      case FormulaKind::True:
+        return Constant(1.0);
+      case FormulaKind::Var:
+        return VariableRegister(get_variable(f));
+      case FormulaKind::Eq:
+        return Relational(Opcode::kEq, f);
+      case FormulaKind::Neq:
+        return Relational(Opcode::kNeq, f);
+      case FormulaKind::Gt:
+        return Relational(Opcode::kGt, f);
+      case FormulaKind::Geq:
+        return Relational(Opcode::kGeq, f);
+      case FormulaKind::Lt:
+        return Relational(Opcode::kLt, f);
+      case FormulaKind::Leq:
+        return Relational(Opcode::kLeq, f);
+      case FormulaKind::And:
+        return Nary(Opcode::kAnd, f);
+      case FormulaKind::Or:
+        return Nary(Opcode::kOr, f);
+      case FormulaKind::Not:
+        return Emit(Opcode::kNot, CompileFormula(get_operand(f)));
+      case FormulaKind::Forall:
+      case FormulaKind::Isnan:
+      case FormulaKind::PositiveSemidefinite:
+        break;
+    }
+    ostringstream oss;
+    oss << "CompiledExpression: the formula " << f << " is not supported.";
+    throw runtime_error(oss.str());
+  }
+
+  int Relational(const Opcode op, const Formula& f) {
+    return Emit(op, Compile(get_lhs_expression(f)),
+                Compile(get_rhs_expression(f)));
+  }
+
+  int Nary(const Opcode op, const Formula& f) {
+    const std::set<Formula>& operands = get_operands(f);
+    DRAKE_DEMAND(!operands.empty());
+    auto it = operands.begin();
+    int result = CompileFormula(*it);
+    for (++it; it != operands.end(); ++it) {
+      result = Emit(op, result, CompileFormula(*it));
+    }
+    return result;
+  }
+
+  int VariableRegister(const Variable& var) const {
+    const auto it = variable_registers_.find(var);
+    if (it == variable_registers_.end()) {
+      ostringstream oss;
+      oss << "CompiledExpression: the variable " << var
+          << " is not in the list of variables.";
+      throw runtime_error(oss.str());
+    }
+    return it->second;
+  }
+
+  int VisitConstant(const Expression& e) {
+    return Constant(get_constant_value(e));
+  }
+
+  int VisitVariable(const Expression& e) {
+    return VariableRegister(get_variable(e));
+  }
+
+  int VisitAddition(const Expression& e) {
+    // e = c₀ + ∑ᵢ cᵢ * eᵢ.
+    int result = -1;
+    for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+      const int term = Compile(p.first);
+      const double coeff = p.second;
+      if (result < 0) {
+        result = coeff == 1.0 ? term
+                              : Emit(Opcode::kScale, term, -1, -1, coeff);
+      } else if (coeff == 1.0) {
+        result = Emit(Opcode::kAdd, result, term);
+      } else {
+        result = Emit(Opcode::kAddScaled, result, term, -1, coeff);
+      }
+    }
+    DRAKE_DEMAND(result >= 0);
+    const double c0 = get_constant_in_addition(e);
+    if (c0 != 0.0) {
+      result = Emit(Opcode::kAddConstant, result, -1, -1, c0);
+    }
+    return result;
+  }
+
+  int VisitMultiplication(const Expression& e) {
+    // e = c₀ * ∏ᵢ pow(bᵢ, eᵢ).
+    int result = -1;
+    for (const auto& p : get_base_to_exponent_map_in_multiplication(e)) {
+      const int factor = CompilePow(p.first, p.second);
+      result = result < 0 ? factor : Emit(Opcode::kMul, result, factor);
+    }
+    DRAKE_DEMAND(result >= 0);
+    const double c0 = get_constant_in_multiplication(e);
+    if (c0 != 1.0) {
+      result = Emit(Opcode::kScale, result, -1, -1, c0);
+    }
+    return result;
+  }
+
+  int VisitDivision(const Expression& e) { return Binary(Opcode::kDiv, e); }
+  int VisitLog(const Expression& e) { return Unary(Opcode::kLog, e); }
+  int VisitAbs(const Expression& e) { return Unary(Opcode::kAbs, e); }
+  int VisitExp(const Expression& e) { return Unary(Opcode::kExp, e); }
+  int VisitSqrt(const Expression& e) { return Unary(Opcode::kSqrt, e); }
+  int VisitPow(const Expression& e) {
+    return CompilePow(get_first_argument(e), get_second_argument(e));
+  }
+  int VisitSin(const Expression& e) { return Unary(Opcode::kSin, e); }
+  int VisitCos(const Expression& e) { return Unary(Opcode::kCos, e); }
+  int VisitTan(const Expression& e) { return Unary(Opcode::kTan, e); }
+  int VisitAsin(const Expression& e) { return Unary(Opcode::kAsin, e); }
+  int VisitAcos(const Expression& e) { return Unary(Opcode::kAcos, e); }
+  int VisitAtan(const Expression& e) { return Unary(Opcode::kAtan, e); }
+  int VisitAtan2(const Expression& e) { return Binary(Opcode::kAtan2, e); }
+  int VisitSinh(const Expression& e) { return Unary(Opcode::kSinh, e); }
+  int VisitCosh(const Expression& e) { return Unary(Opcode::kCosh, e); }
+  int VisitTanh(const Expression& e) { return Unary(Opcode::kTanh, e); }
+  int VisitMin(const Expression& e) { return Binary(Opcode::kMin, e); }
+  int VisitMax(const Expression& e) { return Binary(Opcode::kMax, e); }
+  int VisitCeil(const Expression& e) { return Unary(Opcode::kCeil, e); }
+  int VisitFloor(const Expression& e) { return Unary(Opcode::kFloor, e); }
+
+  int VisitIfThenElse(const Expression& e) {
+    return Emit(Opcode::kSelect, CompileFormula(get_conditional_formula(e)),
+                Compile(get_then_expression(e)),
+                Compile(get_else_expression(e)));
+  }
+
+  int VisitUninterpretedFunction(const Expression& e) {
+    ostringstream oss;
+    oss << "CompiledExpression: the uninterpreted function " << e
+        << " cannot be compiled.";
+    throw runtime_error(oss.str());
+  }
+
+  CompiledExpression* const compiled_;
+  std::unordered_map<Variable, int> variable_registers_;
+  std::unordered_map<std::uint64_t, int> constant_registers_;
+  std::unordered_map<Expression, int> expression_registers_;
+  std::unordered_map<Formula, int> formula_registers_;
+};
+
+CompiledExpression::CompiledExpression(
+    const Eigen::Ref<const MatrixX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& variables)
+    : rows_(expressions.rows()),
+      cols_(expressions.cols()),
+      variables_(variables) {
+  Compiler compiler(this);
+  output_registers_.reserve(size());
+  for (int j = 0; j < cols_; ++j) {
+    for (int i = 0; i < rows_; ++i) {
+      output_registers_.push_back(compiler.Compile(expressions(i, j)));
+    }
+  }
+}
+
+CompiledExpression::CompiledExpression(
+    const Expression& e, const Eigen::Ref<const VectorX<Variable>>& variables)
+    : CompiledExpression(Vector1<Expression>(e), variables) {}
+
+void CompiledExpression::RunTape(double* const r) const {
+  for (const Instruction& instruction : instructions_) {
+    const double a = r[instruction.in1];
+    double& out = r[instruction.out];
+    switch (instruction.op) {
+      case Opcode::kAdd:
+        out = a + r[instruction.in2];
+        break;
+      case Opcode::kAddScaled:
+        out = a + instruction.c * r[instruction.in2];
+        break;
+      case Opcode::kAddConstant:
+        out = a + instruction.c;
+        break;
+      case Opcode::kScale:
+        out = instruction.c * a;
+        break;
+      case Opcode::kMul:
+        out = a * r[instruction.in2];
+        break;
+      case Opcode::kDiv:
+        out = a / r[instruction.in2];
+        break;
+      case Opcode::kPow:
+        out = std::pow(a, r[instruction.in2]);
+        break;
+      case Opcode::kPowConstant:
+        out = std::pow(a, instruction.c);
+        break;
+      case Opcode::kLog:
+        out = std::log(a);
+        break;
+      case Opcode::kAbs:
+        out = std::fabs(a);
+        break;
+      case Opcode::kExp:
+        out = std::exp(a);
+        break;
+      case Opcode::kSqrt:
+        out = std::sqrt(a);
+        break;
+      case Opcode::kSin:
+        out = std::sin(a);
+        break;
+      case Opcode::kCos:
+        out = std::cos(a);
+        break;
+      case Opcode::kTan:
+        out = std::tan(a);
+        break;
+      case Opcode::kAsin:
+        out = std::asin(a);
+        break;
+      case Opcode::kAcos:
+        out = std::acos(a);
+        break;
+      case Opcode::kAtan:
+        out = std::atan(a);
+        break;
+      case Opcode::kAtan2:
+        out = std::atan2(a, r[instruction.in2]);
+        break;
+      case Opcode::kSinh:
+        out = std::sinh(a);
+        break;
+      case Opcode::kCosh:
+        out = std::cosh(a);
+        break;
+      case Opcode::kTanh:
+        out = std::tanh(a);
+        break;
+      case Opcode::kMin:
+        out = std::min(a, r[instruction.in2]);
+        break;
+      case Opcode::kMax:
+        out = std::max(a, r[instruction.in2]);
+        break;
+      case Opcode::kCeil:
+        out = std::ceil(a);
+        break;
+      case Opcode::kFloor:
+        out = std::floor(a);
+        break;
+      case Opcode::kEq:
+        out = a == r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kNeq:
+        out = a != r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kGt:
+        out = a > r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kGeq:
+        out = a >= r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kLt:
+        out = a < r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kLeq:
+        out = a <= r[instruction.in2] ? 1.0 : 0.0;
+        break;
+      case Opcode::kAnd:
+        out = (a != 0.0 && r[instruction.in2] != 0.0) ? 1.0 : 0.0;
+        break;
+      case Opcode::kOr:
+        out = (a != 0.0 || r[instruction.in2] != 0.0) ? 1.0 : 0.0;
+        break;
+      case Opcode::kNot:
+        out = a == 0.0 ? 1.0 : 0.0;
+        break;
+      case Opcode::kSelect:
+        out = a != 0.0 ? r[instruction.in2] : r[instruction.in3];
+        break;
+    }
+  }
+}
+
+Eigen::MatrixXd CompiledExpression::Evaluate(
+    const Eigen::MatrixXd& points) const {
+  if (points.rows() != num_variables()) {
+    ostringstream oss;
+    oss << "CompiledExpression::Evaluate(): the points have " << points.rows()
+        << " rows but there are " << num_variables() << " variables.";
+    throw runtime_error(oss.str());
+  }
+  const int nv = num_variables();
+  Eigen::MatrixXd values(size(), points.cols());
+  std::vector<double> registers = initial_registers_;
+  for (int j = 0; j < points.cols(); ++j) {
+    std::copy(points.col(j).data(), points.col(j).data() + nv,
+              registers.begin());
+    RunTape(registers.data());
+    for (int k = 0; k < size(); ++k) {
+      values(k, j) = registers[output_registers_[k]];
+    }
+  }
+  return values;
+}
+
+Eigen::MatrixXd CompiledExpression::Evaluate(const Environment& env) const {
+  Eigen::VectorXd point(num_variables());
+  for (int i = 0; i < num_variables(); ++i) {
+    const Environment::const_iterator it = env.find(variables_(i));
+    if (it == env.cend()) {
+      ostringstream oss;
+      oss << "CompiledExpression::Evaluate(): the environment does not have "
+             "an entry for the variable " << variables_(i) << ".";
+      throw runtime_error(oss.str());
+    }
+    point(i) = it->second;
+  }
+  const Eigen::MatrixXd values = Evaluate(Eigen::MatrixXd(point));
+  return Eigen::Map<const Eigen::MatrixXd>(values.data(), rows_, cols_);
+}
+
+namespace {
+
+// Formats `c` as a C literal of type double, which reads back exactly.
+string FormatConstant(const double c) {
+  if (std::isinf(c)) {
+    return c > 0 ? "HUGE_VAL" : "(-HUGE_VAL)";
+  }
+  ostringstream oss;
+  oss.precision(std::numeric_limits<double>::max_digits10);
+  oss << c;
+  string result = oss.str();
+  if (result.find_first_of(".e") == string::npos) {
+    result += ".0";
+  }
+  return std::signbit(c) ? "(" + result + ")" : result;
+}
+
+}  // namespace
+
+void CompiledExpression::GenerateCode(const string& function_name,
+                                      std::ostream* const os) const {
+  DRAKE_DEMAND(os != nullptr);
+  std::vector<bool> is_instruction_output(initial_registers_.size(), false);
+  for (const Instruction& instruction : instructions_) {
+    is_instruction_output[instruction.out] = true;
+  }
+  // Returns the C expression for the value of the register `k`.
+  auto reg = [&](const int k) -> string {
+    if (k < num_variables()) {
+      return "x[" + std::to_string(k) + "]";
+    }
+    if (is_instruction_output[k]) {
+      return "r" + std::to_string(k);
+    }
+    return FormatConstant(initial_registers_[k]);
+  };
+  // Returns the C expression for a comparison or a logical operation.
+  auto boolean = [](const string& condition) {
+    return "(" + condition + ") ? 1.0 : 0.0";
+  };
+
+  std::ostream& out = *os;
+  out << "void " << function_name << "(const double* x, double* y) {\n";
+  for (const Instruction& instruction : instructions_) {
+    const string a = reg(instruction.in1);
+    const string b = instruction.in2 >= 0 ? reg(instruction.in2) : "";
+    const string c = FormatConstant(instruction.c);
+    string value;
+    switch (instruction.op) {
+      case Opcode::kAdd:
+        value = a + " + " + b;
+        break;
+      case Opcode::kAddScaled:
+        value = a + " + " + c + " * " + b;
+        break;
+      case Opcode::kAddConstant:
+        value = a + " + " + c;
+        break;
+      case Opcode::kScale:
+        value = c + " * " + a;
+        break;
+      case Opcode::kMul:
+        value = a + " * " + b;
+        break;
+      case Opcode::kDiv:
+        value = a + " / " + b;
+        break;
+      case Opcode::kPow:
+        value = "pow(" + a + ", " + b + ")";
+        break;
+      case Opcode::kPowConstant:
+        value = "pow(" + a + ", " + c + ")";
+        break;
+      case Opcode::kLog:
+        value = "log(" + a + ")";
+        break;
+      case Opcode::kAbs:
+        value = "fabs(" + a + ")";
+        break;
+      case Opcode::kExp:
+        value = "exp(" + a + ")";
+        break;
+      case Opcode::kSqrt:
+        value = "sqrt(" + a + ")";
+        break;
+      case Opcode::kSin:
+        value = "sin(" + a + ")";
+        break;
+      case Opcode::kCos:
+        value = "cos(" + a + ")";
+        break;
+      case Opcode::kTan:
+        value = "tan(" + a + ")";
+        break;
+      case Opcode::kAsin:
+        value = "asin(" + a + ")";
+        break;
+      case Opcode::kAcos:
+        value = "acos(" + a + ")";
+        break;
+      case Opcode::kAtan:
+        value = "atan(" + a + ")";
+        break;
+      case Opcode::kAtan2:
+        value = "atan2(" + a + ", " + b + ")";
+        break;
+      case Opcode::kSinh:
+        value = "sinh(" + a + ")";
+        break;
+      case Opcode::kCosh:
+        value = "cosh(" + a + ")";
+        break;
+      case Opcode::kTanh:
+        value = "tanh(" + a + ")";
+        break;
+      case Opcode::kMin:
+        // Matches std::min, rather than fmin, for NaN arguments.
+        value = "(" + b + " < " + a + ") ? " + b + " : " + a;
+        break;
+      case Opcode::kMax:
+        // Matches std::max, rather than fmax, for NaN arguments.
+        value = "(" + a + " < " + b + ") ? " + b + " : " + a;
+        break;
+      case Opcode::kCeil:
+        value = "ceil(" + a + ")";
+        break;
+      case Opcode::kFloor:
+        value = "floor(" + a + ")";
+        break;
+      case Opcode::kEq:
+        value = boolean(a + " == " + b);
+        break;
+      case Opcode::kNeq:
+        value = boolean(a + " != " + b);
+        break;
+      case Opcode::kGt:
+        value = boolean(a + " > " + b);
+        break;
+      case Opcode::kGeq:
+        value = boolean(a + " >= " + b);
+        break;
+      case Opcode::kLt:
+        value = boolean(a + " < " + b);
+        break;
+      case Opcode::kLeq:
+        value = boolean(a + " <= " + b);
+        break;
+      case Opcode::kAnd:
+        value = boolean(a + " != 0.0 && " + b + " != 0.0");
+        break;
+      case Opcode::kOr:
+        value = boolean(a + " != 0.0 || " + b + " != 0.0");
+        break;
+      case Opcode::kNot:
+        value = boolean(a + " == 0.0");
+        break;
+      case Opcode::kSelect:
+        value = "(" + a + " != 0.0) ? " + b + " : " + reg(instruction.in3);
+        break;
+    }
+    out << "  const double " << reg(instruction.out) << " = " << value
+        << ";\n";
+  }
+  for (int k = 0; k < size(); ++k) {
+    out << "  y[" << k << "] = " << reg(output_registers_[k]) << ";\n";
+  }
+  out << "}\n";
+}
+
+}  // namespace symbolic
+}  // namespace drake
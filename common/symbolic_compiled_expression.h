@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Represents a matrix of symbolic expressions compiled into a flat sequence
+/// of instructions, for fast numerical evaluation at many points.
+///
+/// Evaluating an Expression with Expression::Evaluate() walks its tree of
+/// cells through virtual calls and looks up each variable in an Environment.
+/// When the same expressions are evaluated repeatedly, for example at the
+/// thousands of sample points used when extracting or checking polynomials, it
+/// is much faster to compile them once. At construction, the expressions are
+/// flattened into a _tape_ of instructions operating on an array of
+/// registers, where each variable is bound to a fixed register and each
+/// constant is loaded into a register once and for all. Common subexpressions
+/// are compiled only once, including across the entries of the matrix.
+///
+/// Usage:
+/// @code
+///   const Variable x{"x"};
+///   const Variable y{"y"};
+///   const CompiledExpression compiled(sin(x) * y + x * x,
+///                                     Vector2<Variable>(x, y));
+///   // Each column of points is a value of (x, y).
+///   const Eigen::MatrixXd points = Eigen::MatrixXd::Random(2, 1000);
+///   // values is a 1 x 1000 matrix.
+///   const Eigen::MatrixXd values = compiled.Evaluate(points);
+/// @endcode
+///
+/// The compiled expressions can also be emitted as a C function with
+/// GenerateCode(), to be compiled ahead of time or at runtime.
+///
+/// Unlike Expression::Evaluate(), the evaluation of a CompiledExpression does
+/// not check the domain of its operations for speed. Operations out of their
+/// domain, such as `log(-1)`, `sqrt(-1)` or a division by zero, follow the
+/// IEEE 754 rules and produce NaN or infinite values instead of throwing. In
+/// addition, both branches of an if-then-else expression are evaluated,
+/// though only the selected one contributes to the result.
+class CompiledExpression {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledExpression)
+
+  /// Compiles the matrix of expressions @p expressions, whose variables take
+  /// their values, in order, from the entries of @p variables.
+  ///
+  /// @throws std::runtime_error if @p variables has repeated entries, if
+  /// @p expressions includes a variable not in @p variables, or if
+  /// @p expressions includes a NaN, an uninterpreted function, or a formula
+  /// other than a relational formula, a Boolean variable, a conjunction, a
+  /// disjunction or a negation.
+  CompiledExpression(const Eigen::Ref<const MatrixX<Expression>>& expressions,
+                     const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Compiles the expression @p e, as a 1 x 1 matrix. See above.
+  CompiledExpression(const Expression& e,
+                     const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Returns the number of rows of the compiled matrix of expressions.
+  int rows() const { return rows_; }
+
+  /// Returns the number of columns of the compiled matrix of expressions.
+  int cols() const { return cols_; }
+
+  /// Returns the number of compiled expressions, `rows() * cols()`.
+  int size() const { return rows_ * cols_; }
+
+  /// Returns the variables, in the order in which their values are expected
+  /// by Evaluate().
+  const VectorX<Variable>& variables() const { return variables_; }
+
+  /// Returns the number of variables.
+  int num_variables() const { return static_cast<int>(variables_.size()); }
+
+  /// Returns the number of instructions in the tape.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Evaluates the compiled expressions at each column of @p points, which
+  /// holds the values of variables(), in order. Returns a matrix with size()
+  /// rows and as many columns as @p points, where each column holds the
+  /// compiled matrix of expressions evaluated at the corresponding point,
+  /// flattened in column-major order.
+  ///
+  /// @throws std::runtime_error if `points.rows() != num_variables()`.
+  Eigen::MatrixXd Evaluate(const Eigen::MatrixXd& points) const;
+
+  /// Evaluates the compiled expressions using the values of the variables in
+  /// @p env. Returns a matrix of size rows() x cols().
+  ///
+  /// @throws std::runtime_error if a variable in variables() does not have
+  /// an entry in @p env.
+  Eigen::MatrixXd Evaluate(const Environment& env) const;
+
+  /// Writes to @p os the definition of a C function named @p function_name,
+  /// with the signature `void function_name(const double* x, double* y)`,
+  /// which computes the compiled expressions. `x` must point to the values of
+  /// variables(), in order, and `y` to an array of size() doubles, which is
+  /// filled with the values of the expressions in column-major order. The
+  /// generated code only depends on `<math.h>`.
+  void GenerateCode(const std::string& function_name, std::ostream* os) const;
+
+ private:
+  // The operations of the instructions. In the comments below, `r` denotes
+  // the registers, and `out`, `in1`, `in2`, `in3` and `c` the fields of an
+  // Instruction.
+  enum class Opcode : std::uint8_t {
+    kAdd,          // r[out] = r[in1] + r[in2]
+    kAddScaled,    // r[out] = r[in1] + c * r[in2]
+    kAddConstant,  // r[out] = r[in1] + c
+    kScale,        // r[out] = c * r[in1]
+    kMul,          // r[out] = r[in1] * r[in2]
+    kDiv,          // r[out] = r[in1] / r[in2]
+    kPow,          // r[out] = pow(r[in1], r[in2])
+    kPowConstant,  // r[out] = pow(r[in1], c)
+    kLog,
+    kAbs,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,  // r[out] = atan2(r[in1], r[in2])
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,  // r[out] = min(r[in1], r[in2])
+    kMax,  // r[out] = max(r[in1], r[in2])
+    kCeil,
+    kFloor,
+    // The comparisons and logical operations store true as 1 and false as 0.
+    // A register holding any non-zero value is considered true.
+    kEq,      // r[out] = r[in1] == r[in2]
+    kNeq,     // r[out] = r[in1] != r[in2]
+    kGt,      // r[out] = r[in1] > r[in2]
+    kGeq,     // r[out] = r[in1] >= r[in2]
+    kLt,      // r[out] = r[in1] < r[in2]
+    kLeq,     // r[out] = r[in1] <= r[in2]
+    kAnd,     // r[out] = r[in1] && r[in2]
+    kOr,      // r[out] = r[in1] || r[in2]
+    kNot,     // r[out] = !r[in1]
+    kSelect,  // r[out] = r[in1] ? r[in2] : r[in3]
+  };
+
+  // Unary functions, such as kSin, read r[in1] and write r[out].
+  struct Instruction {
+    Opcode op;
+    int out;
+    int in1;
+    int in2;
+    int in3;
+    double c;
+  };
+
+  // Helpers for the construction, defined in the translation unit.
+  class Compiler;
+
+  // Runs the tape on `registers`, whose first num_variables() entries hold
+  // the values of the variables.
+  void RunTape(double* registers) const;
+
+  int rows_{};
+  int cols_{};
+  VectorX<Variable> variables_;
+  std::vector<Instruction> instructions_;
+  // The initial values of the registers. The first num_variables() entries
+  // are placeholders for the values of the variables, followed by the
+  // constants and the results of the instructions.
+  std::vector<double> initial_registers_;
+  // The register holding each expression, in column-major order.
+  std::vector<int> output_registers_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
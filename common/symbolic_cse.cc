@@ -0,0 +1,233 @@
+#include "drake/common/symbolic_cse.h"
+
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using std::pair;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+// Calls `func` on each subexpression which is a direct child of `e`, except
+// for those in the condition of an if-then-else expression.
+template <typename Func>
+void ForEachChild(const Expression& e, const Func& func) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+    case ExpressionKind::UninterpretedFunction:
+      return;
+    case ExpressionKind::NaN:
+      throw std::runtime_error("NaN is detected while eliminating common "
+                               "subexpressions.");
+    case ExpressionKind::Add:
+      for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+        func(p.first);
+      }
+      return;
+    case ExpressionKind::Mul:
+      for (const auto& p : get_base_to_exponent_map_in_multiplication(e)) {
+        func(p.first);
+        func(p.second);
+      }
+      return;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      func(get_first_argument(e));
+      func(get_second_argument(e));
+      return;
+    case ExpressionKind::IfThenElse:
+      func(get_then_expression(e));
+      func(get_else_expression(e));
+      return;
+    case ExpressionKind::Log:
+    case ExpressionKind::Abs:
+    case ExpressionKind::Exp:
+    case ExpressionKind::Sqrt:
+    case ExpressionKind::Sin:
+    case ExpressionKind::Cos:
+    case ExpressionKind::Tan:
+    case ExpressionKind::Asin:
+    case ExpressionKind::Acos:
+    case ExpressionKind::Atan:
+    case ExpressionKind::Sinh:
+    case ExpressionKind::Cosh:
+    case ExpressionKind::Tanh:
+    case ExpressionKind::Ceil:
+    case ExpressionKind::Floor:
+      func(get_argument(e));
+      return;
+  }
+  DRAKE_ABORT();
+}
+
+// Rebuilds expressions bottom-up, replacing the subexpressions which occur
+// more than once with temporaries.
+class CseVisitor {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CseVisitor)
+
+  CseVisitor(vector<pair<Variable, Expression>>* temporaries, string prefix)
+      : temporaries_{temporaries}, prefix_{std::move(prefix)} {}
+
+  // Counts the occurrences of `e` and of its subexpressions. The
+  // subexpressions of `e` are only counted the first time `e` is found, since
+  // `e` itself is replaced by a temporary if it is found again.
+  void Count(const Expression& e) {
+    if (++counts_[e] == 1) {
+      ForEachChild(e, [this](const Expression& child) { Count(child); });
+    }
+  }
+
+  Expression Rebuild(const Expression& e) {
+    const auto it = rebuilt_.find(e);
+    if (it != rebuilt_.end()) {
+      return it->second;
+    }
+    Expression result = VisitExpression<Expression>(this, e);
+    if (counts_.at(e) > 1 && !is_constant(e) && !is_variable(e)) {
+      const Variable t{prefix_ + std::to_string(temporaries_->size())};
+      temporaries_->emplace_back(t, result);
+      result = t;
+    }
+    rebuilt_.emplace(e, result);
+    return result;
+  }
+
+ private:
+  // Makes VisitExpression a friend of this class so that VisitExpression can
+  // use its private methods.
+  friend Expression drake::symbolic::VisitExpression<Expression>(
+      CseVisitor*, const Expression&);
+
+  Expression VisitConstant(const Expression& e) { return e; }
+  Expression VisitVariable(const Expression& e) { return e; }
+
+  Expression VisitAddition(const Expression& e) {
+    Expression result{get_constant_in_addition(e)};
+    for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+      result += p.second * Rebuild(p.first);
+    }
+    return result;
+  }
+
+  Expression VisitMultiplication(const Expression& e) {
+    Expression result{get_constant_in_multiplication(e)};
+    for (const auto& p : get_base_to_exponent_map_in_multiplication(e)) {
+      result *= pow(Rebuild(p.first), Rebuild(p.second));
+    }
+    return result;
+  }
+
+  Expression VisitDivision(const Expression& e) {
+    return Rebuild(get_first_argument(e)) / Rebuild(get_second_argument(e));
+  }
+  Expression VisitLog(const Expression& e) {
+    return log(Rebuild(get_argument(e)));
+  }
+  Expression VisitAbs(const Expression& e) {
+    return abs(Rebuild(get_argument(e)));
+  }
+  Expression VisitExp(const Expression& e) {
+    return exp(Rebuild(get_argument(e)));
+  }
+  Expression VisitSqrt(const Expression& e) {
+    return sqrt(Rebuild(get_argument(e)));
+  }
+  Expression VisitPow(const Expression& e) {
+    return pow(Rebuild(get_first_argument(e)),
+               Rebuild(get_second_argument(e)));
+  }
+  Expression VisitSin(const Expression& e) {
+    return sin(Rebuild(get_argument(e)));
+  }
+  Expression VisitCos(const Expression& e) {
+    return cos(Rebuild(get_argument(e)));
+  }
+  Expression VisitTan(const Expression& e) {
+    return tan(Rebuild(get_argument(e)));
+  }
+  Expression VisitAsin(const Expression& e) {
+    return asin(Rebuild(get_argument(e)));
+  }
+  Expression VisitAcos(const Expression& e) {
+    return acos(Rebuild(get_argument(e)));
+  }
+  Expression VisitAtan(const Expression& e) {
+    return atan(Rebuild(get_argument(e)));
+  }
+  Expression VisitAtan2(const Expression& e) {
+    return atan2(Rebuild(get_first_argument(e)),
+                 Rebuild(get_second_argument(e)));
+  }
+  Expression VisitSinh(const Expression& e) {
+    return sinh(Rebuild(get_argument(e)));
+  }
+  Expression VisitCosh(const Expression& e) {
+    return cosh(Rebuild(get_argument(e)));
+  }
+  Expression VisitTanh(const Expression& e) {
+    return tanh(Rebuild(get_argument(e)));
+  }
+  Expression VisitMin(const Expression& e) {
+    return min(Rebuild(get_first_argument(e)),
+               Rebuild(get_second_argument(e)));
+  }
+  Expression VisitMax(const Expression& e) {
+    return max(Rebuild(get_first_argument(e)),
+               Rebuild(get_second_argument(e)));
+  }
+  Expression VisitCeil(const Expression& e) {
+    return ceil(Rebuild(get_argument(e)));
+  }
+  Expression VisitFloor(const Expression& e) {
+    return floor(Rebuild(get_argument(e)));
+  }
+  Expression VisitIfThenElse(const Expression& e) {
+    return if_then_else(get_conditional_formula(e),
+                        Rebuild(get_then_expression(e)),
+                        Rebuild(get_else_expression(e)));
+  }
+  Expression VisitUninterpretedFunction(const Expression& e) { return e; }
+
+  vector<pair<Variable, Expression>>* const temporaries_;
+  const string prefix_;
+  unordered_map<Expression, int> counts_;
+  unordered_map<Expression, Expression> rebuilt_;
+};
+
+}  // namespace
+
+MatrixX<Expression> Cse(
+    const Eigen::Ref<const MatrixX<Expression>>& expressions,
+    vector<pair<Variable, Expression>>* const temporaries,
+    const string& prefix) {
+  DRAKE_DEMAND(temporaries != nullptr);
+  temporaries->clear();
+  CseVisitor visitor(temporaries, prefix);
+  for (int j = 0; j < expressions.cols(); ++j) {
+    for (int i = 0; i < expressions.rows(); ++i) {
+      visitor.Count(expressions(i, j));
+    }
+  }
+  MatrixX<Expression> result(expressions.rows(), expressions.cols());
+  for (int j = 0; j < expressions.cols(); ++j) {
+    for (int i = 0; i < expressions.rows(); ++i) {
+      result(i, j) = visitor.Rebuild(expressions(i, j));
+    }
+  }
+  return result;
+}
+
+}  // namespace symbolic
+}  // namespace drake
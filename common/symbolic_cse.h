@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Eliminates the common subexpressions of @p expressions.
+///
+/// Every subexpression which is neither a constant nor a variable, and which
+/// occurs more than once in @p expressions, is replaced by a new temporary
+/// variable. Returns a matrix of the same size as @p expressions in terms of
+/// the original variables and of the temporaries, and sets @p temporaries to
+/// the list of pairs `(t, e)` of a temporary `t` and its definition `e`. The
+/// definition of each temporary only depends on the original variables and on
+/// the temporaries before it in the list. Substituting the temporaries into
+/// the result, from the last one to the first one, gives back expressions
+/// equivalent to @p expressions.
+///
+/// This makes explicit the structure of the directed acyclic graph of
+/// expressions in which equal subexpressions are shared, as obtained for
+/// instance with ExpressionHashConsingScope, and is meant for code generation
+/// or for evaluating each shared subexpression only once.
+///
+/// The temporaries are named @p prefix followed by their index in
+/// @p temporaries. The conditions of if-then-else expressions are kept as
+/// they are.
+///
+/// @throws std::runtime_error if @p expressions includes a NaN.
+/// @pre @p temporaries is not null.
+MatrixX<Expression> Cse(
+    const Eigen::Ref<const MatrixX<Expression>>& expressions,
+    std::vector<std::pair<Variable, Expression>>* temporaries,
+    const std::string& prefix = "cse");
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,116 @@
+#include "drake/common/symbolic_dense_environment.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/symbolic_compiled_expression.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::ostringstream;
+using std::runtime_error;
+
+namespace {
+
+// Returns true if the Boolean structure of `f`, that is `f` and, through its
+// conjunctions, disjunctions and negations, its operands, can be compiled by
+// CompiledExpression.
+bool IsCompilable(const Formula& f) {
+  if (is_forall(f) || is_isnan(f) || is_positive_semidefinite(f)) {
+    return false;
+  }
+  if (is_conjunction(f) || is_disjunction(f)) {
+    for (const Formula& operand : get_operands(f)) {
+      if (!IsCompilable(operand)) {
+        return false;
+      }
+    }
+  }
+  if (is_negation(f)) {
+    return IsCompilable(get_operand(f));
+  }
+  return true;
+}
+
+}  // namespace
+
+DenseEnvironment::DenseEnvironment(
+    const Eigen::Ref<const VectorX<Variable>>& variables,
+    const Eigen::Ref<const Eigen::MatrixXd>& points)
+    : variables_(variables), points_(points) {
+  if (points_.rows() != variables_.size()) {
+    ostringstream oss;
+    oss << "DenseEnvironment: the points have " << points_.rows()
+        << " rows, but there are " << variables_.size() << " variables.";
+    throw runtime_error(oss.str());
+  }
+  std::unordered_set<Variable> seen;
+  for (int i = 0; i < variables_.size(); ++i) {
+    if (variables_(i).is_dummy()) {
+      throw runtime_error(
+          "DenseEnvironment: the list of variables includes a dummy "
+          "variable.");
+    }
+    if (!seen.insert(variables_(i)).second) {
+      ostringstream oss;
+      oss << "DenseEnvironment: the variable " << variables_(i)
+          << " is repeated in the list of variables.";
+      throw runtime_error(oss.str());
+    }
+  }
+}
+
+Environment DenseEnvironment::point_environment(const int i) const {
+  DRAKE_DEMAND(0 <= i && i < num_points());
+  Environment env;
+  for (int j = 0; j < variables_.size(); ++j) {
+    env.insert(variables_(j), points_(j, i));
+  }
+  return env;
+}
+
+Eigen::RowVectorXd DenseEnvironment::Evaluate(const Expression& e) const {
+  return CompiledExpression(e, variables_).Evaluate(points_);
+}
+
+Eigen::MatrixXd DenseEnvironment::Evaluate(
+    const Eigen::Ref<const MatrixX<Expression>>& m) const {
+  return CompiledExpression(m, variables_).Evaluate(points_);
+}
+
+RowVectorX<bool> DenseEnvironment::Evaluate(const Formula& f) const {
+  if (IsCompilable(f)) {
+    const Eigen::RowVectorXd values =
+        Evaluate(if_then_else(f, Expression::One(), Expression::Zero()));
+    return (values.array() != 0.0).matrix();
+  }
+
+  // Evaluate the Boolean structure of f point-wise, down to the formulas that
+  // cannot be compiled, which are evaluated at each point separately.
+  RowVectorX<bool> result(num_points());
+  if (is_conjunction(f) || is_disjunction(f)) {
+    const bool conjunction = is_conjunction(f);
+    result.setConstant(conjunction);
+    for (const Formula& operand : get_operands(f)) {
+      const RowVectorX<bool> operand_result = Evaluate(operand);
+      if (conjunction) {
+        result = (result.array() && operand_result.array()).matrix();
+      } else {
+        result = (result.array() || operand_result.array()).matrix();
+      }
+    }
+  } else if (is_negation(f)) {
+    result = (!Evaluate(get_operand(f)).array()).matrix();
+  } else {
+    for (int i = 0; i < num_points(); ++i) {
+      result(i) = f.Evaluate(point_environment(i));
+    }
+  }
+  return result;
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Represents a batch of environments, given by the values of an ordered list
+/// of variables at many points, and evaluates expressions and formulas at all
+/// of them at once.
+///
+/// Checking a formula on a grid of points with Formula::Evaluate() requires
+/// filling an Environment for each point and walking the formula's tree once
+/// per point. A %DenseEnvironment instead compiles each expression or formula
+/// once into a CompiledExpression and runs the resulting tape on every column
+/// of a matrix of points.
+///
+/// Usage:
+/// @code
+///   const Variable x{"x"};
+///   const Variable y{"y"};
+///   // Each column of points is a value of (x, y).
+///   const DenseEnvironment env(Vector2<Variable>(x, y),
+///                              Eigen::MatrixXd::Random(2, 1000));
+///   // values is a 1 x 1000 matrix.
+///   const Eigen::RowVectorXd values = env.Evaluate(x * x + y);
+///   // inside(i) is true iff the point i is in the unit disk.
+///   const RowVectorX<bool> inside = env.Evaluate(x * x + y * y <= 1);
+/// @endcode
+///
+/// Like CompiledExpression, and unlike Expression::Evaluate(), the evaluation
+/// of expressions does not check the domain of their operations; see
+/// CompiledExpression for details. Formulas whose Boolean structure includes
+/// a universal quantification, an isnan formula or a positive-semidefinite
+/// formula are evaluated at each point with Formula::Evaluate(), which also
+/// checks domains.
+class DenseEnvironment {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DenseEnvironment)
+
+  /// Binds @p variables to the rows of @p points, so that each column of
+  /// @p points gives the values of @p variables, in order, at one point.
+  ///
+  /// @throws std::runtime_error if @p variables has repeated entries, if it
+  /// includes a dummy variable, or if `points.rows() != variables.size()`.
+  DenseEnvironment(const Eigen::Ref<const VectorX<Variable>>& variables,
+                   const Eigen::Ref<const Eigen::MatrixXd>& points);
+
+  /// Returns the variables, in the order of the rows of points().
+  const VectorX<Variable>& variables() const { return variables_; }
+
+  /// Returns the points, one per column.
+  const Eigen::MatrixXd& points() const { return points_; }
+
+  /// Returns the number of points.
+  int num_points() const { return static_cast<int>(points_.cols()); }
+
+  /// Returns the Environment of the point @p i.
+  /// @pre 0 <= i < num_points().
+  Environment point_environment(int i) const;
+
+  /// Evaluates @p e at each point. Returns a row vector with num_points()
+  /// entries.
+  ///
+  /// @throws std::runtime_error if @p e includes a variable not in
+  /// variables(), or an expression not supported by CompiledExpression.
+  Eigen::RowVectorXd Evaluate(const Expression& e) const;
+
+  /// Evaluates the matrix of expressions @p m at each point, compiling its
+  /// common subexpressions once. Returns a matrix with `m.size()` rows and
+  /// num_points() columns, where each column holds @p m evaluated at the
+  /// corresponding point, flattened in column-major order.
+  ///
+  /// @throws std::runtime_error under the conditions of Evaluate(const
+  /// Expression&).
+  Eigen::MatrixXd Evaluate(
+      const Eigen::Ref<const MatrixX<Expression>>& m) const;
+
+  /// Evaluates @p f at each point. Returns a row vector with num_points()
+  /// entries.
+  ///
+  /// @throws std::runtime_error if @p f includes a free variable not in
+  /// variables(), or if its evaluation at some point throws.
+  RowVectorX<bool> Evaluate(const Formula& f) const;
+
+ private:
+  VectorX<Variable> variables_;
+  Eigen::MatrixXd points_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
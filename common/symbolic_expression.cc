@@ -9,6 +9,8 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -31,10 +33,44 @@ using std::ostringstream;
 using std::pair;
 using std::runtime_error;
 using std::shared_ptr;
+using std::make_pair;
 using std::streamsize;
 using std::string;
 using std::vector;
 
+namespace {
+// The innermost ExpressionHashConsingScope of this thread, if any.
+thread_local ExpressionHashConsingScope* hash_consing_scope{nullptr};
+}  // namespace
+
+ExpressionHashConsingScope::ExpressionHashConsingScope()
+    : outer_{hash_consing_scope} {
+  hash_consing_scope = this;
+}
+
+ExpressionHashConsingScope::~ExpressionHashConsingScope() {
+  DRAKE_DEMAND(hash_consing_scope == this);
+  hash_consing_scope = outer_;
+}
+
+shared_ptr<ExpressionCell> ExpressionHashConsingScope::Intern(
+    shared_ptr<ExpressionCell> cell) {
+  ExpressionHashConsingScope* const scope{hash_consing_scope};
+  if (scope == nullptr) {
+    return cell;
+  }
+  const size_t hash{cell->get_hash()};
+  const auto range = scope->cells_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const ExpressionCell& existing{*it->second};
+    if (existing.get_kind() == cell->get_kind() && existing.EqualTo(*cell)) {
+      return it->second;
+    }
+  }
+  scope->cells_.emplace(hash, cell);
+  return cell;
+}
+
 bool operator<(ExpressionKind k1, ExpressionKind k2) {
   return static_cast<int>(k1) < static_cast<int>(k2);
 }
@@ -69,9 +105,12 @@ Expression NegateMultiplication(const Expression& e) {
 }  // namespace
 
 Expression::Expression(const Variable& var)
-    : ptr_{make_shared<ExpressionVar>(var)} {}
-Expression::Expression(const double d) : ptr_{make_cell(d)} {}
-Expression::Expression(shared_ptr<ExpressionCell> ptr) : ptr_{std::move(ptr)} {}
+    : ptr_{ExpressionHashConsingScope::Intern(make_shared<ExpressionVar>(var))} {
+}
+Expression::Expression(const double d)
+    : ptr_{ExpressionHashConsingScope::Intern(make_cell(d))} {}
+Expression::Expression(shared_ptr<ExpressionCell> ptr)
+    : ptr_{ExpressionHashConsingScope::Intern(std::move(ptr))} {}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -80,8 +119,8 @@ ExpressionKind Expression::get_kind() const {
 
 void Expression::HashAppend(DelegatingHasher* hasher) const {
   using drake::hash_append;
-  hash_append(*hasher, get_kind());
-  ptr_->HashAppendDetail(hasher);
+  // The hash of the cell is cached, and includes its kind.
+  hash_append(*hasher, ptr_->get_hash());
 }
 
 Expression Expression::Zero() {
@@ -191,8 +230,46 @@ Expression Expression::Substitute(const Substitution& s) const {
   return *this;
 }
 
+namespace {
+// Memoizes the derivatives computed during a call to
+// Expression::Differentiate(), so that the derivative of a subexpression
+// shared by several parents is only computed once. The cells are keyed by
+// address, and kept alive by the memo so that their addresses are not reused
+// during the call.
+struct DifferentiationMemo {
+  const Variable* var{};
+  std::unordered_map<const ExpressionCell*,
+                     pair<shared_ptr<ExpressionCell>, Expression>>
+      derivatives;
+};
+
+// The memo of the call to Expression::Differentiate() in progress on this
+// thread, if any.
+thread_local DifferentiationMemo* differentiation_memo{nullptr};
+}  // namespace
+
 Expression Expression::Differentiate(const Variable& x) const {
   DRAKE_ASSERT(ptr_ != nullptr);
+  DifferentiationMemo* const memo{differentiation_memo};
+  if (memo != nullptr && memo->var->equal_to(x)) {
+    const auto it = memo->derivatives.find(ptr_.get());
+    if (it != memo->derivatives.end()) {
+      return it->second.second;
+    }
+    Expression result{ptr_->Differentiate(x)};
+    memo->derivatives.emplace(ptr_.get(), make_pair(ptr_, result));
+    return result;
+  }
+  // This is the outermost call, or a differentiation with respect to another
+  // variable nested within one.
+  DifferentiationMemo new_memo;
+  new_memo.var = &x;
+  differentiation_memo = &new_memo;
+  // Restores the memo of the enclosing call, if any, even on exceptions.
+  struct MemoRestorer {
+    DifferentiationMemo* const memo;
+    ~MemoRestorer() { differentiation_memo = memo; }
+  } restorer{memo};
   return ptr_->Differentiate(x);
 }
 
@@ -505,7 +582,7 @@ Expression& operator/=(Expression& lhs, const Expression& rhs) {
     lhs = Expression::One();
     return lhs;
   }
-  lhs.ptr_ = make_shared<ExpressionDiv>(lhs, rhs);
+  lhs = Expression{make_shared<ExpressionDiv>(lhs, rhs)};
   return lhs;
 }
 
@@ -920,6 +920,63 @@ CheckStructuralEquality(const DerivedA& m1, const DerivedB& m2) {
   return m1.binaryExpr(m2, std::equal_to<Expression>{}).all();
 }
 
+/// Enables the hash-consing of symbolic expressions on the current thread
+/// while an instance of this class is alive.
+///
+/// Expressions share their subexpressions when they are copied, but two
+/// expressions built separately are stored separately even if they are
+/// structurally equal. Expressions built by evaluating a
+/// `System<symbolic::Expression>` or a `RigidBodyTree<symbolic::Expression>`
+/// often contain many such structurally equal subexpressions, whose number can
+/// grow exponentially with the depth of the computation. While a scope is
+/// active, every new expression built on the current thread is looked up in a
+/// table of the expressions built so far within the scope, and replaced by the
+/// existing one if they are structurally equal. This turns expression trees
+/// into directed acyclic graphs without duplicated nodes, which reduces their
+/// memory use and makes the algorithms which take advantage of shared
+/// subexpressions, such as Expression::Differentiate(), Jacobian() and
+/// CompiledExpression, much faster.
+///
+/// The table keeps the expressions built within the scope alive until the
+/// scope is destroyed. Scopes can be nested, in which case the innermost one
+/// is used. A scope must be destroyed on the thread which created it.
+///
+/// Usage:
+/// @code
+///   MatrixX<Expression> J;
+///   {
+///     ExpressionHashConsingScope scope;
+///     const VectorX<Expression> f = ...;  // e.g. symbolic system dynamics.
+///     J = Jacobian(f, x);
+///   }
+/// @endcode
+class ExpressionHashConsingScope {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionHashConsingScope)
+
+  /// Enables the hash-consing of expressions on the current thread.
+  ExpressionHashConsingScope();
+
+  /// Restores the previous scope of the current thread, if any.
+  ~ExpressionHashConsingScope();
+
+  /// Returns the number of distinct expression cells in this scope's table.
+  int size() const { return static_cast<int>(cells_.size()); }
+
+ private:
+  friend class Expression;
+
+  // If a scope is active on the current thread, returns a cell structurally
+  // equal to `cell` from the table of that scope, inserting `cell` there if
+  // there is none. Otherwise, returns `cell`.
+  static std::shared_ptr<ExpressionCell> Intern(
+      std::shared_ptr<ExpressionCell> cell);
+
+  ExpressionHashConsingScope* const outer_;
+  // The cells built within this scope, keyed by their hash.
+  std::unordered_multimap<size_t, std::shared_ptr<ExpressionCell>> cells_;
+};
+
 }  // namespace symbolic
 
 /*
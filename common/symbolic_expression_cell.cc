@@ -197,6 +197,35 @@ ExpressionCell::ExpressionCell(const ExpressionKind k, const bool is_poly)
     : kind_{k},
       is_polynomial_{is_poly} {}
 
+ExpressionCell::ExpressionCell(ExpressionCell&& e) noexcept
+    : ExpressionCell{static_cast<const ExpressionCell&>(e)} {}
+
+ExpressionCell::ExpressionCell(const ExpressionCell& e) noexcept
+    : kind_{e.kind_},
+      is_polynomial_{e.is_polynomial_},
+      hash_{e.hash_.load(std::memory_order_relaxed)} {}
+
+size_t ExpressionCell::get_hash() const {
+  size_t result{hash_.load(std::memory_order_relaxed)};
+  if (result == 0) {
+    DefaultHasher hasher;
+    DelegatingHasher delegating_hasher(
+        [&hasher](const void* data, const size_t length) {
+          return hasher(data, length);
+        });
+    using drake::hash_append;
+    hash_append(delegating_hasher, kind_);
+    HashAppendDetail(&delegating_hasher);
+    result = static_cast<size_t>(hasher);
+    // Zero is reserved to mark the cache as empty.
+    if (result == 0) {
+      result = 1;
+    }
+    hash_.store(result, std::memory_order_relaxed);
+  }
+  return result;
+}
+
 UnaryExpressionCell::UnaryExpressionCell(const ExpressionKind k,
                                          const Expression& e,
                                          const bool is_poly)
@@ -10,6 +10,7 @@
 #endif
 
 #include <algorithm>  // for cpplint only
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -51,6 +52,13 @@ class ExpressionCell {
    */
   virtual void HashAppendDetail(DelegatingHasher*) const = 0;
 
+  /** Returns the hash value of this ExpressionCell, including its kind. It is
+   * computed on the first call and cached, so that hashing an expression
+   * costs O(1) after the first time, and O(n) the first time for an
+   * expression with n distinct cells rather than O(size of its tree).
+   */
+  size_t get_hash() const;
+
   /** Collects variables in expression. */
   virtual Variables GetVariables() const = 0;
 
@@ -99,9 +107,9 @@ class ExpressionCell {
   /** Default constructor. */
   ExpressionCell() = default;
   /** Move-constructs an ExpressionCell from an rvalue. */
-  ExpressionCell(ExpressionCell&& e) = default;
+  ExpressionCell(ExpressionCell&& e) noexcept;
   /** Copy-constructs an ExpressionCell from an lvalue. */
-  ExpressionCell(const ExpressionCell& e) = default;
+  ExpressionCell(const ExpressionCell& e) noexcept;
   /** Move-assigns (DELETED). */
   ExpressionCell& operator=(ExpressionCell&& e) = delete;
   /** Copy-assigns (DELETED). */
@@ -114,6 +122,11 @@ class ExpressionCell {
  private:
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
+  // The cached value of get_hash(), or zero if it has not been computed yet.
+  // Since cells are immutable and shared between expressions, possibly from
+  // different threads, the cache is atomic. Concurrent first calls may compute
+  // the same value more than once, which is harmless.
+  mutable std::atomic<size_t> hash_{0};
 };
 
 /** Represents the base class for unary expressions.  */
@@ -116,8 +116,9 @@ int Monomial::degree(const Variable& v) const {
 
 Variables Monomial::GetVariables() const {
   Variables vars{};
-  for (const pair<Variable, int> p : powers_) {
-    vars += p.first;
+  // powers_ is sorted, so each insertion appends to vars.
+  for (const pair<const Variable, int>& p : powers_) {
+    vars.insert(p.first);
   }
   return vars;
 }
@@ -179,14 +180,18 @@ Expression Monomial::ToExpression() const {
 }
 
 Monomial& Monomial::operator*=(const Monomial& m) {
+  // Both maps are sorted, so this merges them in a single pass.
+  auto it = powers_.begin();
   for (const auto& p : m.get_powers()) {
     const Variable& var{p.first};
     const int exponent{p.second};
-    auto it = powers_.find(var);
-    if (it == powers_.end()) {
-      powers_.insert(p);
-    } else {
+    while (it != powers_.end() && it->first.less(var)) {
+      ++it;
+    }
+    if (it != powers_.end() && it->first.equal_to(var)) {
       it->second += exponent;
+    } else {
+      it = powers_.emplace_hint(it, p);
     }
     total_degree_ += exponent;
   }
@@ -4,7 +4,9 @@
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/symbolic.h"
 #define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
@@ -35,6 +37,18 @@ void DoAddProduct(const Expression& coeff, const Monomial& m,
   if (it != map->end()) {
     // m ∈ dom(map)
     Expression& existing_coeff = it->second;
+    if (is_constant(existing_coeff) && is_constant(coeff)) {
+      // Fast path for numeric coefficients, which does not need to expand
+      // them.
+      const double sum{get_constant_value(existing_coeff) +
+                       get_constant_value(coeff)};
+      if (sum == 0.0) {
+        map->erase(it);
+      } else {
+        existing_coeff = sum;
+      }
+      return;
+    }
     // Note that `.Expand()` is needed in the following line. For example,
     // consider the following case:
     //     c1 := (a + b)²
@@ -541,7 +555,125 @@ Polynomial& Polynomial::operator-=(const double c) {
   return AddProduct(-c, Monomial{});
 }
 
+namespace {
+// Returns true if all the coefficients in `map` are constants.
+bool HasConstantCoefficients(const Polynomial::MapType& map) {
+  return std::all_of(map.begin(), map.end(),
+                     [](const pair<const Monomial, Expression>& p) {
+                       return is_constant(p.second);
+                     });
+}
+
+// Multiplies two polynomials whose coefficients are all constants. This is a
+// fast path for Polynomial::operator*=, which does not build a Monomial and an
+// Expression for each of the n₁ * n₂ products of terms.
+//
+// Each monomial is represented by its exponents with respect to the union of
+// the indeterminates of the two polynomials, and the monomials are stored
+// contiguously in a flat vector so that the product of two monomials is the
+// element-wise sum of two rows of exponents. The products are sorted by their
+// exponents and the coefficients of the equal monomials are summed up, so
+// that only the distinct monomials of the result are constructed.
+Polynomial::MapType MultiplyConstantCoefficients(
+    const Polynomial::MapType& map1, const Polynomial::MapType& map2) {
+  std::vector<Variable> vars;
+  std::unordered_map<Variable::Id, int> var_to_index;
+  for (const Polynomial::MapType* map : {&map1, &map2}) {
+    for (const pair<const Monomial, Expression>& p : *map) {
+      for (const pair<const Variable, int>& power : p.first.get_powers()) {
+        if (var_to_index.emplace(power.first.get_id(), vars.size()).second) {
+          vars.push_back(power.first);
+        }
+      }
+    }
+  }
+  const int n = vars.size();
+
+  // Flattens `map` into a matrix of exponents, one row of size n per term,
+  // and a vector of coefficients.
+  const auto flatten = [&var_to_index, n](const Polynomial::MapType& map,
+                                          std::vector<int>* exponents,
+                                          std::vector<double>* coeffs) {
+    exponents->assign(map.size() * n, 0);
+    coeffs->reserve(map.size());
+    int* row = exponents->data();
+    for (const pair<const Monomial, Expression>& p : map) {
+      for (const pair<const Variable, int>& power : p.first.get_powers()) {
+        row[var_to_index.at(power.first.get_id())] = power.second;
+      }
+      coeffs->push_back(get_constant_value(p.second));
+      row += n;
+    }
+  };
+  std::vector<int> exponents1;
+  std::vector<int> exponents2;
+  std::vector<double> coeffs1;
+  std::vector<double> coeffs2;
+  flatten(map1, &exponents1, &coeffs1);
+  flatten(map2, &exponents2, &coeffs2);
+
+  // Computes all the products of terms.
+  const int n1 = coeffs1.size();
+  const int n2 = coeffs2.size();
+  std::vector<int> exponents(static_cast<size_t>(n1) * n2 * n);
+  std::vector<double> coeffs(static_cast<size_t>(n1) * n2);
+  for (int i = 0; i < n1; ++i) {
+    const int* const row1 = exponents1.data() + i * n;
+    for (int j = 0; j < n2; ++j) {
+      const int k = i * n2 + j;
+      const int* const row2 = exponents2.data() + j * n;
+      int* const row = exponents.data() + static_cast<size_t>(k) * n;
+      for (int l = 0; l < n; ++l) {
+        row[l] = row1[l] + row2[l];
+      }
+      coeffs[k] = coeffs1[i] * coeffs2[j];
+    }
+  }
+
+  // Sorts the products by their exponents, and merges the equal monomials.
+  const auto row = [&exponents, n](const int k) {
+    return exponents.data() + static_cast<size_t>(k) * n;
+  };
+  std::vector<int> order(coeffs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&row, n](const int a, const int b) {
+    return std::lexicographical_compare(row(a), row(a) + n, row(b),
+                                        row(b) + n);
+  });
+  Polynomial::MapType new_map;
+  for (size_t begin = 0; begin < order.size();) {
+    const int* const exponents_begin = row(order[begin]);
+    double coeff{coeffs[order[begin]]};
+    size_t end = begin + 1;
+    for (; end < order.size() &&
+           std::equal(exponents_begin, exponents_begin + n, row(order[end]));
+         ++end) {
+      coeff += coeffs[order[end]];
+    }
+    if (coeff != 0.0) {
+      map<Variable, int> powers;
+      for (int l = 0; l < n; ++l) {
+        if (exponents_begin[l] > 0) {
+          powers.emplace(vars[l], exponents_begin[l]);
+        }
+      }
+      new_map.emplace(Monomial{powers}, coeff);
+    }
+    begin = end;
+  }
+  return new_map;
+}
+}  // namespace
+
 Polynomial& Polynomial::operator*=(const Polynomial& p) {
+  if (HasConstantCoefficients(monomial_to_coefficient_map_) &&
+      HasConstantCoefficients(p.monomial_to_coefficient_map_)) {
+    monomial_to_coefficient_map_ = MultiplyConstantCoefficients(
+        monomial_to_coefficient_map_, p.monomial_to_coefficient_map_);
+    // No need to call CheckInvariant() since the result has no decision
+    // variables.
+    return *this;
+  }
   // (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * (c₂₁ * m₂₁ + ... + c₂ₘ * m₂ₘ)
   // = (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂₁ * m₂₁ + ... +
   //   (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂ₘ * m₂ₘ
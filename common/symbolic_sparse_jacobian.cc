@@ -0,0 +1,76 @@
+#include "drake/common/symbolic_sparse_jacobian.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace symbolic {
+
+JacobianSparsityPattern::JacobianSparsityPattern(
+    const Eigen::Ref<const VectorX<Expression>>& f,
+    const Eigen::Ref<const VectorX<Variable>>& vars)
+    : rows_(f.size()), cols_(vars.size()) {
+  std::unordered_map<Variable::Id, int> var_to_col;
+  for (int j = 0; j < cols_; ++j) {
+    if (!var_to_col.emplace(vars(j).get_id(), j).second) {
+      std::ostringstream oss;
+      oss << "JacobianSparsityPattern: the variable " << vars(j)
+          << " is repeated in the list of variables.";
+      throw std::runtime_error(oss.str());
+    }
+  }
+  // The (column, row) pairs of the structurally nonzero entries.
+  std::vector<std::pair<int, int>> entries;
+  for (int i = 0; i < rows_; ++i) {
+    for (const Variable& var : f(i).GetVariables()) {
+      const auto it = var_to_col.find(var.get_id());
+      if (it != var_to_col.end()) {
+        entries.emplace_back(it->second, i);
+      }
+    }
+  }
+  std::sort(entries.begin(), entries.end());
+  row_indices_.reserve(entries.size());
+  col_indices_.reserve(entries.size());
+  for (const auto& entry : entries) {
+    col_indices_.push_back(entry.first);
+    row_indices_.push_back(entry.second);
+  }
+}
+
+Eigen::SparseMatrix<Expression> SparseJacobian(
+    const Eigen::Ref<const VectorX<Expression>>& f,
+    const Eigen::Ref<const VectorX<Variable>>& vars,
+    const JacobianSparsityPattern& pattern) {
+  DRAKE_DEMAND(pattern.rows() == f.size());
+  DRAKE_DEMAND(pattern.cols() == vars.size());
+  Eigen::SparseMatrix<Expression> J(pattern.rows(), pattern.cols());
+  Eigen::VectorXi nonzeros_per_col = Eigen::VectorXi::Zero(pattern.cols());
+  for (const int j : pattern.col_indices()) {
+    ++nonzeros_per_col(j);
+  }
+  J.reserve(nonzeros_per_col);
+  // The entries are sorted by column and then by row, so that each insertion
+  // appends to the end of its column.
+  for (int k = 0; k < pattern.nonzeros(); ++k) {
+    const int i = pattern.row_indices()[k];
+    const int j = pattern.col_indices()[k];
+    J.insert(i, j) = f(i).Differentiate(vars(j));
+  }
+  J.makeCompressed();
+  return J;
+}
+
+Eigen::SparseMatrix<Expression> SparseJacobian(
+    const Eigen::Ref<const VectorX<Expression>>& f,
+    const Eigen::Ref<const VectorX<Variable>>& vars) {
+  return SparseJacobian(f, vars, JacobianSparsityPattern(f, vars));
+}
+
+}  // namespace symbolic
+}  // namespace drake
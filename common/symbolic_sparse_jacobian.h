@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Represents the sparsity pattern of the Jacobian matrix J of a vector
+/// function f with respect to a vector of variables, where the entry `J(i,
+/// j)` is _structurally nonzero_ if `f(i)` depends on the j-th variable, that
+/// is, if the j-th variable is in `f(i).GetVariables()`. Every other entry of
+/// J is zero for all values of the variables.
+///
+/// The pattern only depends on the structure of f, and can therefore be
+/// computed once and reused, for instance by solvers which need the
+/// sparsity pattern of the gradients of their constraints up front, or to
+/// differentiate several functions with the same structure.
+class JacobianSparsityPattern {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(JacobianSparsityPattern)
+
+  /// Computes the sparsity pattern of the Jacobian of @p f with respect to
+  /// @p vars.
+  /// @throws std::runtime_error if @p vars has repeated entries.
+  JacobianSparsityPattern(const Eigen::Ref<const VectorX<Expression>>& f,
+                          const Eigen::Ref<const VectorX<Variable>>& vars);
+
+  /// Returns the number of rows of the Jacobian, the size of f.
+  int rows() const { return rows_; }
+
+  /// Returns the number of columns of the Jacobian, the number of variables.
+  int cols() const { return cols_; }
+
+  /// Returns the number of structurally nonzero entries.
+  int nonzeros() const { return static_cast<int>(row_indices_.size()); }
+
+  /// Returns the row indices of the structurally nonzero entries, ordered by
+  /// column and then by row, which is the order in which they are stored in
+  /// a compressed column-major Eigen::SparseMatrix.
+  const std::vector<int>& row_indices() const { return row_indices_; }
+
+  /// Returns the column indices of the structurally nonzero entries, in the
+  /// same order as row_indices().
+  const std::vector<int>& col_indices() const { return col_indices_; }
+
+ private:
+  int rows_{};
+  int cols_{};
+  std::vector<int> row_indices_;
+  std::vector<int> col_indices_;
+};
+
+/// Computes the Jacobian matrix J of the vector function @p f with respect to
+/// @p vars, as a sparse matrix. Only the structurally nonzero entries in
+/// @p pattern are differentiated, and each of them is stored in the result
+/// even if its derivative simplifies to zero, so that the result always has
+/// the sparsity pattern @p pattern. This is much faster than Jacobian() when
+/// each function only depends on a few of the variables.
+///
+/// @pre @p pattern is the sparsity pattern of the Jacobian of @p f with
+/// respect to @p vars, or of a function with the same structure.
+Eigen::SparseMatrix<Expression> SparseJacobian(
+    const Eigen::Ref<const VectorX<Expression>>& f,
+    const Eigen::Ref<const VectorX<Variable>>& vars,
+    const JacobianSparsityPattern& pattern);
+
+/// Computes the Jacobian matrix J of the vector function @p f with respect to
+/// @p vars, as a sparse matrix. This is the same as calling the function
+/// above with `JacobianSparsityPattern(f, vars)`.
+Eigen::SparseMatrix<Expression> SparseJacobian(
+    const Eigen::Ref<const VectorX<Expression>>& f,
+    const Eigen::Ref<const VectorX<Variable>>& vars);
+
+}  // namespace symbolic
+}  // namespace drake
@@ -12,25 +12,40 @@
 #include "drake/common/symbolic.h"
 
 using std::accumulate;
+using std::back_inserter;
+using std::equal_to;
 using std::includes;
 using std::initializer_list;
-using std::inserter;
 using std::less;
 using std::move;
 using std::ostream;
 using std::ostream_iterator;
 using std::ostringstream;
-using std::set;
+using std::set_difference;
 using std::set_intersection;
+using std::set_union;
 using std::string;
+using std::vector;
 
 namespace drake {
 namespace symbolic {
 
-Variables::Variables(initializer_list<Variable> init) : vars_(init) {}
+Variables::Variables(initializer_list<Variable> init) : vars_(init) {
+  MergeSortedPrefix(0);
+}
 
 Variables::Variables(const Eigen::Ref<const VectorX<Variable>>& init)
-    : vars_{init.data(), init.data() + init.size()} {}
+    : vars_{init.data(), init.data() + init.size()} {
+  MergeSortedPrefix(0);
+}
+
+void Variables::MergeSortedPrefix(const size_type sorted_size) {
+  const auto middle = vars_.begin() + sorted_size;
+  std::sort(middle, vars_.end(), less<Variable>{});
+  std::inplace_merge(vars_.begin(), middle, vars_.end(), less<Variable>{});
+  vars_.erase(std::unique(vars_.begin(), vars_.end(), equal_to<Variable>{}),
+              vars_.end());
+}
 
 string Variables::to_string() const {
   ostringstream oss;
@@ -38,12 +53,58 @@ string Variables::to_string() const {
   return oss.str();
 }
 
+void Variables::insert(const Variable& var) {
+  const auto it = std::lower_bound(vars_.begin(), vars_.end(), var,
+                                   less<Variable>{});
+  if (it == vars_.end() || !it->equal_to(var)) {
+    vars_.insert(it, var);
+  }
+}
+
+void Variables::insert(const Variables& vars) {
+  if (vars.empty()) {
+    return;
+  }
+  if (empty() || vars_.back().less(vars.vars_.front())) {
+    vars_.insert(vars_.end(), vars.vars_.begin(), vars.vars_.end());
+    return;
+  }
+  vector<Variable> result;
+  result.reserve(size() + vars.size());
+  set_union(vars_.begin(), vars_.end(), vars.vars_.begin(), vars.vars_.end(),
+            back_inserter(result), less<Variable>{});
+  vars_ = move(result);
+}
+
+Variables::size_type Variables::erase(const Variable& key) {
+  const auto it = find(key);
+  if (it == vars_.cend()) {
+    return 0;
+  }
+  vars_.erase(it);
+  return 1;
+}
+
 Variables::size_type Variables::erase(const Variables& vars) {
-  size_type num_of_erased_elements{0};
-  for (const Variable& var : vars) {
-    num_of_erased_elements += erase(var);
+  const size_type old_size{size()};
+  if (empty() || vars.empty()) {
+    return 0;
+  }
+  vector<Variable> result;
+  result.reserve(old_size);
+  set_difference(vars_.begin(), vars_.end(), vars.vars_.begin(),
+                 vars.vars_.end(), back_inserter(result), less<Variable>{});
+  vars_ = move(result);
+  return old_size - size();
+}
+
+Variables::const_iterator Variables::find(const Variable& key) const {
+  const auto it = std::lower_bound(vars_.cbegin(), vars_.cend(), key,
+                                   less<Variable>{});
+  if (it != vars_.cend() && it->equal_to(key)) {
+    return it;
   }
-  return num_of_erased_elements;
+  return vars_.cend();
 }
 
 bool Variables::IsSubsetOf(const Variables& vars) const {
@@ -81,13 +142,13 @@ bool operator<(const Variables& vars1, const Variables& vars2) {
 }
 
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator+=(Variables& vars1, const Variables& vars2) {
+Variables& operator+=(Variables& vars1, const Variables& vars2) {
   vars1.insert(vars2);
   return vars1;
 }
 
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator+=(Variables& vars, const Variable& var) {
+Variables& operator+=(Variables& vars, const Variable& var) {
   vars.insert(var);
   return vars;
 }
@@ -108,12 +169,12 @@ Variables operator+(const Variable& var, Variables vars) {
 }
 
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator-=(Variables& vars1, const Variables& vars2) {
+Variables& operator-=(Variables& vars1, const Variables& vars2) {
   vars1.erase(vars2);
   return vars1;
 }
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator-=(Variables& vars, const Variable& var) {
+Variables& operator-=(Variables& vars, const Variable& var) {
   vars.erase(var);
   return vars;
 }
@@ -127,13 +188,12 @@ Variables operator-(Variables vars, const Variable& var) {
   return vars;
 }
 
-Variables::Variables(set<Variable> vars) : vars_{move(vars)} {}
+Variables::Variables(vector<Variable> vars) : vars_{move(vars)} {}
 
 Variables intersect(const Variables& vars1, const Variables& vars2) {
-  set<Variable> intersection;
+  vector<Variable> intersection;
   set_intersection(vars1.vars_.begin(), vars1.vars_.end(), vars2.vars_.begin(),
-                   vars2.vars_.end(),
-                   inserter(intersection, intersection.begin()),
+                   vars2.vars_.end(), back_inserter(intersection),
                    less<Variable>{});
   return Variables{move(intersection)};
 }
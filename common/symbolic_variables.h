@@ -9,8 +9,8 @@
 #include <functional>
 #include <initializer_list>
 #include <ostream>
-#include <set>
 #include <string>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/hash.h"
@@ -21,22 +21,30 @@ namespace symbolic {
 
 /** Represents a set of variables.
  *
- * This class is based on std::set<Variable>. The intent is to add things that
- * we need including set-union (Variables::insert, operator+, operator+=),
- * set-minus (Variables::erase, operator-, operator-=), and subset/superset
- * checking functions (Variables::IsSubsetOf, Variables::IsSupersetOf,
- * Variables::IsStrictSubsetOf, Variables::IsStrictSupersetOf).
+ * This class provides the interface of std::set<Variable>. The intent is to
+ * add things that we need including set-union (Variables::insert, operator+,
+ * operator+=), set-minus (Variables::erase, operator-, operator-=), and
+ * subset/superset checking functions (Variables::IsSubsetOf,
+ * Variables::IsSupersetOf, Variables::IsStrictSubsetOf,
+ * Variables::IsStrictSupersetOf).
+ *
+ * The variables are stored in a sorted std::vector<Variable> rather than in a
+ * tree, since most sets of variables are small. As with std::set, iteration
+ * visits the variables in increasing order and the iterators are read-only.
+ * Unlike std::set, inserting or erasing a variable invalidates all iterators,
+ * and takes time linear in size().
  */
 
 class Variables {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Variables)
 
-  typedef typename std::set<Variable>::size_type size_type;
-  typedef typename std::set<Variable>::iterator iterator;
-  typedef typename std::set<Variable>::const_iterator const_iterator;
-  typedef typename std::set<Variable>::reverse_iterator reverse_iterator;
-  typedef typename std::set<Variable>::const_reverse_iterator
+  typedef typename std::vector<Variable>::size_type size_type;
+  typedef typename std::vector<Variable>::const_iterator iterator;
+  typedef typename std::vector<Variable>::const_iterator const_iterator;
+  typedef typename std::vector<Variable>::const_reverse_iterator
+      reverse_iterator;
+  typedef typename std::vector<Variable>::const_reverse_iterator
       const_reverse_iterator;
 
   /** Default constructor. */
@@ -61,14 +69,13 @@ class Variables {
   template <class HashAlgorithm>
   friend void hash_append(
       HashAlgorithm& hasher, const Variables& item) noexcept {
-    using drake::hash_append;
-    hash_append(hasher, item.vars_);
+    drake::hash_append_range(hasher, item.vars_.begin(), item.vars_.end());
   }
 
   /** Returns an iterator to the beginning. */
-  iterator begin() { return vars_.begin(); }
+  iterator begin() { return vars_.cbegin(); }
   /** Returns an iterator to the end. */
-  iterator end() { return vars_.end(); }
+  iterator end() { return vars_.cend(); }
   /** Returns an iterator to the beginning. */
   const_iterator begin() const { return vars_.cbegin(); }
   /** Returns an iterator to the end. */
@@ -78,9 +85,9 @@ class Variables {
   /** Returns a const iterator to the end. */
   const_iterator cend() const { return vars_.cend(); }
   /** Returns a reverse iterator to the beginning. */
-  reverse_iterator rbegin() { return vars_.rbegin(); }
+  reverse_iterator rbegin() { return vars_.crbegin(); }
   /** Returns a reverse iterator to the end. */
-  reverse_iterator rend() { return vars_.rend(); }
+  reverse_iterator rend() { return vars_.crend(); }
   /** Returns a reverse iterator to the beginning. */
   const_reverse_iterator rbegin() const { return vars_.crbegin(); }
   /** Returns a reverse iterator to the end. */
@@ -91,25 +98,29 @@ class Variables {
   const_reverse_iterator crend() const { return vars_.crend(); }
 
   /** Inserts a variable @p var into a set. */
-  void insert(const Variable& var) { vars_.insert(var); }
+  void insert(const Variable& var);
   /** Inserts variables in [@p first, @p last) into a set. */
   template <class InputIt>
   void insert(InputIt first, InputIt last) {
-    vars_.insert(first, last);
+    const size_type old_size{vars_.size()};
+    vars_.insert(vars_.end(), first, last);
+    MergeSortedPrefix(old_size);
   }
   /** Inserts variables in @p vars into a set. */
-  void insert(const Variables& vars) { vars_.insert(vars.begin(), vars.end()); }
+  void insert(const Variables& vars);
 
   /** Erases @p key from a set. Return number of erased elements (0 or 1). */
-  size_type erase(const Variable& key) { return vars_.erase(key); }
+  size_type erase(const Variable& key);
 
   /** Erases variables in @p vars from a set. Return number of erased
       elements ([0, vars.size()]). */
   size_type erase(const Variables& vars);
 
   /** Finds element with specific key. */
-  iterator find(const Variable& key) { return vars_.find(key); }
-  const_iterator find(const Variable& key) const { return vars_.find(key); }
+  iterator find(const Variable& key) {
+    return static_cast<const Variables&>(*this).find(key);
+  }
+  const_iterator find(const Variable& key) const;
 
   /** Return true if @p key is included in the Variables. */
   bool include(const Variable& key) const { return find(key) != end(); }
@@ -132,18 +143,23 @@ class Variables {
   friend Variables intersect(const Variables& vars1, const Variables& vars2);
 
  private:
-  /* Constructs from std::set<Variable>. */
-  explicit Variables(std::set<Variable> vars);
+  /* Constructs from a sorted std::vector<Variable> without duplicates. */
+  explicit Variables(std::vector<Variable> vars);
+
+  /* Sorts vars_[sorted_size:], merges it into the sorted vars_[:sorted_size],
+   * and removes the duplicates. */
+  void MergeSortedPrefix(size_type sorted_size);
 
-  std::set<Variable> vars_;
+  // Sorted by std::less<Variable>, without duplicates.
+  std::vector<Variable> vars_;
 };
 
 /** Updates @p var1 with the result of set-union(@p var1, @p var2). */
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator+=(Variables& vars1, const Variables& vars2);
+Variables& operator+=(Variables& vars1, const Variables& vars2);
 /** Updates @p vars with the result of set-union(@p vars, { @p var }). */
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator+=(Variables& vars, const Variable& var);
+Variables& operator+=(Variables& vars, const Variable& var);
 /** Returns set-union of @p var1 and @p var2. */
 Variables operator+(Variables vars1, const Variables& vars2);
 /** Returns set-union of @p vars and {@p var}. */
@@ -153,10 +169,10 @@ Variables operator+(const Variable& var, Variables vars);
 
 /** Updates @p var1 with the result of set-minus(@p var1, @p var2). */
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator-=(Variables& vars1, const Variables& vars2);
+Variables& operator-=(Variables& vars1, const Variables& vars2);
 /** Updates @p vars with the result of set-minus(@p vars, {@p var}). */
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
-Variables operator-=(Variables& vars, const Variable& var);
+Variables& operator-=(Variables& vars, const Variable& var);
 /** Returns set-minus(@p var1, @p vars2). */
 Variables operator-(Variables vars1, const Variables& vars2);
 /** Returns set-minus(@p vars, { @p var }). */
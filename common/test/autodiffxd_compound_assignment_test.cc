@@ -0,0 +1,84 @@
+#include "drake/common/autodiff.h"
+#include "drake/common/test/autodiffxd_test.h"
+
+namespace drake {
+namespace test {
+namespace {
+
+// Applies the compound assignment `op` to a copy of its first argument.
+#define COMPOUND_ASSIGNMENT(op)                \
+  [](auto lhs, const auto& rhs) {              \
+    lhs op rhs;                                \
+    return lhs;                                \
+  }
+
+// Applies the compound assignment `op` to a copy of its argument, using the
+// copy itself as the right-hand side.
+#define SELF_COMPOUND_ASSIGNMENT(op)           \
+  [](auto lhs) {                               \
+    lhs op lhs;                                \
+    return lhs;                                \
+  }
+
+#define CHECK_COMPOUND_ASSIGNMENT(op, x, y, c)                      \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(x, y));                        \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(y, x));                        \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(x, x));                        \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(y, y));                        \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(x, c));                        \
+  CHECK_EXPR(COMPOUND_ASSIGNMENT(op)(y, c));                        \
+  CHECK_EXPR(SELF_COMPOUND_ASSIGNMENT(op)(x));                      \
+  CHECK_EXPR(SELF_COMPOUND_ASSIGNMENT(op)(y));
+
+TEST_F(AutoDiffXdTest, CompoundAddition) {
+  CHECK_COMPOUND_ASSIGNMENT(+=, x, y, 2.0);
+}
+
+TEST_F(AutoDiffXdTest, CompoundSubtraction) {
+  CHECK_COMPOUND_ASSIGNMENT(-=, x, y, 2.0);
+}
+
+TEST_F(AutoDiffXdTest, CompoundMultiplication) {
+  CHECK_COMPOUND_ASSIGNMENT(*=, x, y, 2.0);
+}
+
+TEST_F(AutoDiffXdTest, CompoundDivision) {
+  CHECK_COMPOUND_ASSIGNMENT(/=, x, y, 2.0);
+}
+
+// The operators taking rvalues reuse the derivatives of their temporary
+// operands, but must leave the other operands unchanged.
+TEST_F(AutoDiffXdTest, RvalueOperandsLeaveOtherOperandsUnchanged) {
+  const AutoDiffXd a{0.5, Eigen::VectorXd::LinSpaced(3, 1.0, 3.0)};
+  const AutoDiffXd b{-2.0, Eigen::VectorXd::LinSpaced(3, -1.0, 4.0)};
+  const AutoDiffXd a_copy{a};
+  const AutoDiffXd b_copy{b};
+
+  const AutoDiffXd sum = (a * b) + b;
+  const AutoDiffXd difference = a - (a * b);
+  const AutoDiffXd product = a * (a + b);
+  const AutoDiffXd quotient = (a + b) / b;
+  const AutoDiffXd negation = -(a * b);
+
+  EXPECT_EQ(a.value(), a_copy.value());
+  EXPECT_EQ(a.derivatives(), a_copy.derivatives());
+  EXPECT_EQ(b.value(), b_copy.value());
+  EXPECT_EQ(b.derivatives(), b_copy.derivatives());
+
+  const AutoDiffXd ab = a * b;
+  EXPECT_EQ(sum.value(), ab.value() + b.value());
+  EXPECT_EQ(sum.derivatives(), ab.derivatives() + b.derivatives());
+  EXPECT_EQ(difference.value(), a.value() - ab.value());
+  EXPECT_EQ(difference.derivatives(), a.derivatives() - ab.derivatives());
+  const AutoDiffXd a_plus_b = a + b;
+  EXPECT_EQ(product.value(), (a * a_plus_b).value());
+  EXPECT_EQ(product.derivatives(), (a * a_plus_b).derivatives());
+  EXPECT_EQ(quotient.value(), (a_plus_b / b).value());
+  EXPECT_EQ(quotient.derivatives(), (a_plus_b / b).derivatives());
+  EXPECT_EQ(negation.value(), -ab.value());
+  EXPECT_EQ(negation.derivatives(), -ab.derivatives());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace drake
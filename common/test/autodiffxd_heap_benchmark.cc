@@ -0,0 +1,147 @@
+// Measures the heap traffic and run time of typical AutoDiffXd arithmetic.
+// Run with --help for options.
+//
+// Each kernel is evaluated repeatedly and the number of calls to malloc()
+// per evaluation is reported, along with the time per evaluation. Counting
+// calls to malloc() relies on interposing it, which is only supported with
+// glibc; elsewhere, only timings are reported.
+//
+// The kernels are:
+//  - A dense matrix-vector product with a constant matrix, as found in the
+//    dynamics of linear systems.
+//  - A chain of planar rotations, as found in forward kinematics.
+//  - A weighted sum accumulated with compound assignments, as found in costs
+//    and in dot products.
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/text_logging_gflags.h"
+
+DEFINE_int32(num_derivatives, 20, "Size of the derivatives of the inputs.");
+DEFINE_int32(size, 10, "Size of the vectors and matrices of each kernel.");
+DEFINE_int32(iterations, 1000, "Number of timed evaluations of each kernel.");
+
+#ifdef __GLIBC__
+namespace {
+std::atomic<bool> g_count_mallocs{false};
+std::atomic<long> g_num_mallocs{0};
+}  // namespace
+
+extern "C" void* __libc_malloc(size_t size);
+
+// Counts the calls to malloc(), including those from operator new and from
+// Eigen's aligned allocations, while counting is enabled.
+extern "C" void* malloc(size_t size) {
+  if (g_count_mallocs.load(std::memory_order_relaxed)) {
+    g_num_mallocs.fetch_add(1, std::memory_order_relaxed);
+  }
+  return __libc_malloc(size);
+}
+#endif
+
+namespace drake {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Evaluates `kernel` FLAGS_iterations times and prints the number of calls to
+// malloc() and the time per evaluation.
+void RunKernel(const std::string& name, const std::function<double()>& kernel) {
+  // Warm up, and keep the results alive so that nothing is optimized away.
+  double sink = kernel();
+#ifdef __GLIBC__
+  g_num_mallocs = 0;
+  g_count_mallocs = true;
+#endif
+  const Clock::time_point start = Clock::now();
+  for (int i = 0; i < FLAGS_iterations; ++i) {
+    sink += kernel();
+  }
+  const double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+#ifdef __GLIBC__
+  g_count_mallocs = false;
+  const double mallocs =
+      static_cast<double>(g_num_mallocs) / FLAGS_iterations;
+#endif
+  std::cout << "  " << name << ": ";
+#ifdef __GLIBC__
+  std::cout << mallocs << " mallocs/eval, ";
+#endif
+  std::cout << seconds / FLAGS_iterations * 1e6 << " us/eval"
+            << (std::isnan(sink) ? " (nan)" : "") << "\n";
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_num_derivatives >= 1);
+  DRAKE_DEMAND(FLAGS_size >= 1);
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+  const int n = FLAGS_size;
+
+  AutoDiffVecXd x(n);
+  for (int i = 0; i < n; ++i) {
+    x(i) = AutoDiffXd(std::sin(1.0 + i), FLAGS_num_derivatives,
+                      i % FLAGS_num_derivatives);
+  }
+
+  MatrixX<AutoDiffXd> A(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) A(i, j) = std::cos(1.0 + i + 2.0 * j);
+  }
+
+  std::cout << "AutoDiffXd kernels: size " << n << ", "
+            << FLAGS_num_derivatives << " derivatives\n";
+
+  AutoDiffVecXd y(n);
+  RunKernel("matrix-vector product", [&]() {
+    y = A * x;
+    return y(0).value();
+  });
+
+  RunKernel("rotation chain       ", [&]() {
+    AutoDiffXd px = 1.0;
+    AutoDiffXd py = 0.0;
+    for (int i = 0; i < n; ++i) {
+      const AutoDiffXd c = cos(x(i));
+      const AutoDiffXd s = sin(x(i));
+      const AutoDiffXd rotated_px = c * px - s * py;
+      py = s * px + c * py;
+      px = rotated_px;
+    }
+    return px.value() + py.value();
+  });
+
+  RunKernel("weighted sum         ", [&]() {
+    AutoDiffXd sum = 0.0;
+    for (int i = 0; i < n; ++i) {
+      sum += x(i) * x(i) * (1.0 + i);
+    }
+    sum *= 0.5;
+    return sum.value();
+  });
+
+  return 0;
+}
+
+}  // namespace
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Measures the calls to malloc() and the run time of typical AutoDiffXd "
+      "arithmetic kernels.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::do_main();
+}
@@ -108,6 +108,30 @@ void Touch(const std::string& filename) {
   std::ofstream(filename.c_str(), std::ios::out).close();
 }
 
+// Repeated searches give the same result, whether it was cached or not.
+GTEST_TEST(FindResourceTest, RepeatedSearch) {
+  const string relpath = "drake/common/test/find_resource_test_data.txt";
+  const string absolute_path = FindResourceOrThrow(relpath);
+  EXPECT_EQ(FindResourceOrThrow(relpath), absolute_path);
+  ClearResourceCache();
+  EXPECT_EQ(FindResourceOrThrow(relpath), absolute_path);
+  EXPECT_THROW(FindResourceOrThrow("drake/this_file_does_not_exist"),
+               std::runtime_error);
+}
+
+GTEST_TEST(FindResourceTest, CachedPathExists) {
+  const string filename = "cached_path_exists_test_file";
+  EXPECT_FALSE(CachedPathExists(filename));
+
+  // The answer is remembered until the cache is cleared.
+  Touch(filename);
+  EXPECT_FALSE(CachedPathExists(filename));
+  ClearResourceCache();
+  EXPECT_TRUE(CachedPathExists(filename));
+  EXPECT_TRUE(CachedPathExists(
+      FindResourceOrThrow("drake/common/test/find_resource_test_data.txt")));
+}
+
 // NOTE: This test modifies the result of calls to GetDrakePath() and variants.
 // However, it does *not* clean up the modifications. As such, it must run
 // *last*. Relying on execution order being alphabetical, we make sure it is
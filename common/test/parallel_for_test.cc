@@ -0,0 +1,53 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace {
+
+GTEST_TEST(ParallelForTest, DefaultNumThreads) {
+  EXPECT_GE(GetDefaultNumThreads(), 1);
+}
+
+// Every task runs exactly once, regardless of the thread count.
+GTEST_TEST(ParallelForTest, EachTaskRunsOnce) {
+  const int num_tasks = 1000;
+  for (int num_threads : {1, 2, 7, 64}) {
+    std::vector<std::atomic<int>> counts(num_tasks);
+    for (auto& count : counts) count = 0;
+    ParallelFor(num_tasks, num_threads, [&counts](int i) { ++counts[i]; });
+    for (int i = 0; i < num_tasks; ++i) {
+      EXPECT_EQ(counts[i], 1) << "task " << i << ", threads " << num_threads;
+    }
+  }
+}
+
+GTEST_TEST(ParallelForTest, ZeroTasks) {
+  int calls = 0;
+  ParallelFor(0, 4, [&calls](int) { ++calls; });
+  EXPECT_EQ(calls, 0);
+}
+
+GTEST_TEST(ParallelForTest, BadArguments) {
+  auto noop = [](int) {};
+  EXPECT_THROW(ParallelFor(-1, 1, noop), std::logic_error);
+  EXPECT_THROW(ParallelFor(1, 0, noop), std::logic_error);
+}
+
+// An exception thrown by a task is propagated to the caller.
+GTEST_TEST(ParallelForTest, ExceptionPropagates) {
+  for (int num_threads : {1, 4}) {
+    EXPECT_THROW(ParallelFor(100, num_threads,
+                             [](int i) {
+                               if (i == 17) throw std::runtime_error("boom");
+                             }),
+                 std::runtime_error);
+  }
+}
+
+}  // namespace
+}  // namespace drake
@@ -0,0 +1,75 @@
+#include "drake/common/philox4x32.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace {
+
+// Known-answer tests from the Random123 library.
+GTEST_TEST(Philox4x32Test, KnownAnswers) {
+  EXPECT_EQ(Philox4x32::Generate({{0, 0, 0, 0}}, {{0, 0}}),
+            (std::array<uint32_t, 4>{
+                {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}}));
+  EXPECT_EQ(Philox4x32::Generate(
+                {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+                {{0xffffffff, 0xffffffff}}),
+            (std::array<uint32_t, 4>{
+                {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}}));
+  EXPECT_EQ(Philox4x32::Generate(
+                {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+                {{0xa4093822, 0x299f31d0}}),
+            (std::array<uint32_t, 4>{
+                {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}));
+}
+
+// The generator returns the blocks for counters 0, 1, 2, ... in order.
+GTEST_TEST(Philox4x32Test, Stream) {
+  const uint32_t seed = 42;
+  Philox4x32 generator(seed);
+  for (uint32_t counter = 0; counter < 3; ++counter) {
+    const std::array<uint32_t, 4> block =
+        Philox4x32::Generate({{counter, 0, 0, 0}}, {{seed, 0}});
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(generator(), block[i]);
+    }
+  }
+
+  // Different seeds give different streams.
+  EXPECT_NE(Philox4x32(1)(), Philox4x32(2)());
+}
+
+// Fill() gives the same outputs as operator(), including when it starts and
+// ends in the middle of a block or of a batch.
+GTEST_TEST(Philox4x32Test, Fill) {
+  Philox4x32 expected_generator(7);
+  Philox4x32 generator(7);
+  for (int count : {3, 100, 0, 64, 1, 37}) {
+    std::vector<uint32_t> values(count);
+    generator.Fill(values.data(), count);
+    for (int i = 0; i < count; ++i) {
+      EXPECT_EQ(values[i], expected_generator());
+    }
+  }
+}
+
+GTEST_TEST(Philox4x32Test, Distribution) {
+  Philox4x32 generator;
+  std::uniform_real_distribution<double> distribution;
+  double sum = 0;
+  const int kNumSamples = 10000;
+  for (int i = 0; i < kNumSamples; ++i) {
+    const double value = distribution(generator);
+    EXPECT_GE(value, 0.0);
+    EXPECT_LT(value, 1.0);
+    sum += value;
+  }
+  EXPECT_NEAR(sum / kNumSamples, 0.5, 0.01);
+}
+
+}  // namespace
+}  // namespace drake
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <map>
 #include <sstream>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
@@ -211,6 +212,44 @@ GTEST_TEST(PolynomialTest, Roots) { testRoots<double>(); }
 
 GTEST_TEST(PolynomialTest, EvalType) { testEvalType(); }
 
+// Univariate polynomials whose monomials are sorted by power take faster
+// paths for evaluation and arithmetic; checks them against the same
+// polynomials with their monomials out of order.
+GTEST_TEST(PolynomialTest, SortedUnivariate) {
+  const Polynomiald sorted_a(Eigen::Vector3d(1., -2., 3.));
+  const Polynomiald sorted_b(Eigen::Vector4d(0.5, 0.25, 4., -1.));
+  // The same as above, but with the monomials from the highest power down.
+  auto reversed = [](const Polynomiald& p) {
+    const std::vector<Polynomiald::Monomial>& monomials = p.GetMonomials();
+    const std::vector<Polynomiald::Monomial> reversed_monomials(
+        monomials.rbegin(), monomials.rend());
+    return Polynomiald(reversed_monomials.begin(), reversed_monomials.end());
+  };
+  const Polynomiald unsorted_a = reversed(sorted_a);
+  const Polynomiald unsorted_b = reversed(sorted_b);
+  ASSERT_EQ(sorted_a, unsorted_a);
+  ASSERT_EQ(sorted_b, unsorted_b);
+
+  for (double x : {-1.5, 0., 0.3, 2.}) {
+    EXPECT_NEAR(sorted_a.EvaluateUnivariate(x),
+                unsorted_a.EvaluateUnivariate(x), 1e-14);
+    EXPECT_NEAR((sorted_a + sorted_b).EvaluateUnivariate(x),
+                (unsorted_a + unsorted_b).EvaluateUnivariate(x), 1e-14);
+    EXPECT_NEAR((sorted_a - sorted_b).EvaluateUnivariate(x),
+                (unsorted_a - unsorted_b).EvaluateUnivariate(x), 1e-14);
+    EXPECT_NEAR((sorted_a * sorted_b).EvaluateUnivariate(x),
+                (unsorted_a * unsorted_b).EvaluateUnivariate(x), 1e-13);
+    EXPECT_NEAR(sorted_b.Integral(2.).EvaluateUnivariate(x),
+                unsorted_b.Integral(2.).EvaluateUnivariate(x), 1e-14);
+  }
+  EXPECT_EQ(sorted_a + sorted_b, unsorted_a + unsorted_b);
+  EXPECT_EQ(sorted_a * sorted_b, unsorted_a * unsorted_b);
+  EXPECT_EQ(sorted_b.Integral(2.), unsorted_b.Integral(2.));
+  // Cancelled terms are dropped.
+  EXPECT_EQ((sorted_a - sorted_a).GetNumberOfCoefficients(), 0);
+  EXPECT_EQ((sorted_b + sorted_b).GetNumberOfCoefficients(), 4);
+}
+
 GTEST_TEST(PolynomialTest, IsAffine) {
   Polynomiald x("x");
   Polynomiald y("y");
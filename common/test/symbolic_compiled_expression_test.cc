@@ -0,0 +1,177 @@
+#include "drake/common/symbolic_compiled_expression.h"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using std::runtime_error;
+
+class SymbolicCompiledExpressionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    vars_ << x_, y_, z_;
+    // clang-format off
+    points_ << 0.3, -1.2,  2.5, 0.7,
+               1.1,  0.4, -0.8, 2.0,
+              -0.6,  1.9,  0.2, 0.5;
+    // clang-format on
+  }
+
+  // Checks that the compiled `e` agrees with Expression::Evaluate() at each
+  // of points_.
+  void CheckAgainstEvaluate(const Expression& e) const {
+    Vector1<Expression> m;
+    m << e;
+    CheckAgainstEvaluate(m);
+  }
+
+  void CheckAgainstEvaluate(const MatrixX<Expression>& m) const {
+    const CompiledExpression compiled(m, vars_);
+    EXPECT_EQ(compiled.rows(), m.rows());
+    EXPECT_EQ(compiled.cols(), m.cols());
+    const Eigen::MatrixXd values = compiled.Evaluate(points_);
+    ASSERT_EQ(values.rows(), m.size());
+    ASSERT_EQ(values.cols(), points_.cols());
+    for (int j = 0; j < points_.cols(); ++j) {
+      const Environment env{{x_, points_(0, j)},
+                            {y_, points_(1, j)},
+                            {z_, points_(2, j)}};
+      const Eigen::MatrixXd expected = m.unaryExpr(
+          [&env](const Expression& e) { return e.Evaluate(env); });
+      const Eigen::MatrixXd actual = Eigen::Map<const Eigen::MatrixXd>(
+          values.col(j).data(), m.rows(), m.cols());
+      EXPECT_TRUE(CompareMatrices(actual, expected, 1e-14,
+                                  MatrixCompareType::relative))
+          << m;
+      EXPECT_TRUE(CompareMatrices(compiled.Evaluate(env), actual));
+    }
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  Vector3<Variable> vars_;
+  Eigen::Matrix<double, 3, 4> points_;
+};
+
+TEST_F(SymbolicCompiledExpressionTest, Arithmetic) {
+  CheckAgainstEvaluate(Expression(3.0));
+  CheckAgainstEvaluate(x_);
+  CheckAgainstEvaluate(x_ + y_);
+  CheckAgainstEvaluate(2 + 3 * x_ - 4 * y_ * z_);
+  CheckAgainstEvaluate(-x_);
+  CheckAgainstEvaluate(-2 * x_ * x_ * y_);
+  CheckAgainstEvaluate(x_ / y_ + 1 / z_);
+  CheckAgainstEvaluate(pow(x_, 3) * pow(y_, -2) + pow(abs(z_), x_));
+  CheckAgainstEvaluate(pow(x_ + y_, 2) * 0.5);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Functions) {
+  CheckAgainstEvaluate(log(abs(x_) + 1) + exp(y_) + sqrt(z_ * z_ + 1));
+  CheckAgainstEvaluate(sin(x_) * cos(y_) + tan(z_));
+  CheckAgainstEvaluate(asin(x_ / 3) + acos(y_ / 3) + atan(z_));
+  CheckAgainstEvaluate(atan2(x_, y_) + atan2(-z_, x_));
+  CheckAgainstEvaluate(sinh(x_) + cosh(y_) - tanh(z_));
+  CheckAgainstEvaluate(min(x_, y_) * max(y_, z_));
+  CheckAgainstEvaluate(ceil(x_) + floor(y_ * z_));
+}
+
+TEST_F(SymbolicCompiledExpressionTest, IfThenElse) {
+  CheckAgainstEvaluate(if_then_else(x_ > y_, x_, y_ * z_));
+  CheckAgainstEvaluate(if_then_else(x_ >= 0.7 && y_ < 1, 1.0, -z_));
+  CheckAgainstEvaluate(if_then_else(x_ == 0.3 || !(z_ <= 0.2), x_, y_));
+  CheckAgainstEvaluate(if_then_else(x_ != y_, sin(x_), 2.0));
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Matrix) {
+  Eigen::Matrix<Expression, 2, 3> m;
+  // clang-format off
+  m << x_ * y_, sin(x_ * y_), 1.0,
+       z_,      x_ + z_,      cos(x_ * y_) * z_;
+  // clang-format on
+  CheckAgainstEvaluate(m);
+}
+
+// Common subexpressions are only compiled once.
+TEST_F(SymbolicCompiledExpressionTest, CommonSubexpressions) {
+  const Expression e = sin(x_ * y_ + z_);
+  const CompiledExpression single(e, vars_);
+  const CompiledExpression repeated(Vector2<Expression>(e * e, e + 1.0),
+                                    vars_);
+  // The second one only adds two instructions: e * e and e + 1.
+  EXPECT_EQ(repeated.num_instructions(), single.num_instructions() + 2);
+}
+
+// The variables may be given in any order, and may include variables which
+// do not appear in the expressions.
+TEST_F(SymbolicCompiledExpressionTest, VariableOrder) {
+  const Variable w{"w"};
+  const CompiledExpression compiled(x_ - 2 * y_,
+                                    Vector3<Variable>(y_, w, x_));
+  EXPECT_EQ(compiled.num_variables(), 3);
+  EXPECT_EQ(compiled.variables()(1), w);
+  const Eigen::MatrixXd values =
+      compiled.Evaluate(Eigen::Vector3d(1.0, 100.0, 5.0));
+  EXPECT_EQ(values(0, 0), 3.0);
+}
+
+// No domain checks are performed.
+TEST_F(SymbolicCompiledExpressionTest, OutOfDomain) {
+  const CompiledExpression compiled(
+      Vector2<Expression>(log(x_), x_ / y_), vars_);
+  const Eigen::MatrixXd values =
+      compiled.Evaluate(Eigen::Vector3d(-1.0, 0.0, 0.0));
+  EXPECT_TRUE(std::isnan(values(0, 0)));
+  EXPECT_TRUE(std::isinf(values(1, 0)));
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Errors) {
+  const Variable w{"w"};
+  // Missing variable.
+  EXPECT_THROW(CompiledExpression(x_ + w, vars_), runtime_error);
+  // Repeated variable.
+  EXPECT_THROW(CompiledExpression(x_, Vector2<Variable>(x_, x_)),
+               runtime_error);
+  // Uninterpreted function.
+  EXPECT_THROW(
+      CompiledExpression(uninterpreted_function("uf", {x_}), vars_),
+      runtime_error);
+  // Unsupported formula.
+  EXPECT_THROW(
+      CompiledExpression(if_then_else(isnan(x_), 1.0, 0.0), vars_),
+      runtime_error);
+
+  const CompiledExpression compiled(x_ + y_, vars_);
+  // Wrong number of values.
+  EXPECT_THROW(compiled.Evaluate(Eigen::Vector2d(1.0, 2.0)), runtime_error);
+  // Missing entry in the environment.
+  const Environment env{{x_, 1.0}, {y_, 2.0}};
+  EXPECT_THROW(compiled.Evaluate(env), runtime_error);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, GenerateCode) {
+  const CompiledExpression compiled(
+      Vector2<Expression>(2 * x_ + y_, if_then_else(x_ < -z_, x_, 0.5)),
+      vars_);
+  std::ostringstream oss;
+  compiled.GenerateCode("f", &oss);
+  const std::string code = oss.str();
+  EXPECT_EQ(code.find("void f(const double* x, double* y) {\n"), 0);
+  EXPECT_NE(code.find("y[1] = "), std::string::npos);
+  EXPECT_NE(code.find("0.5"), std::string::npos);
+  EXPECT_EQ(code.back(), '\n');
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,112 @@
+#include "drake/common/symbolic_cse.h"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using std::pair;
+using std::vector;
+
+using test::ExprEqual;
+
+class SymbolicCseTest : public ::testing::Test {
+ protected:
+  // Substitutes the temporaries back into `e`, from the last one to the
+  // first one.
+  static Expression Inline(const Expression& e,
+                           const vector<pair<Variable, Expression>>& temps) {
+    Expression result{e};
+    for (auto it = temps.rbegin(); it != temps.rend(); ++it) {
+      result = result.Substitute(it->first, it->second);
+    }
+    return result;
+  }
+
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Expression x_{var_x_};
+  const Expression y_{var_y_};
+  const Environment env_{{var_x_, 0.4}, {var_y_, 1.3}};
+};
+
+TEST_F(SymbolicCseTest, NoCommonSubexpressions) {
+  const Expression e{sin(x_) + cos(y_)};
+  vector<pair<Variable, Expression>> temps;
+  const MatrixX<Expression> result = Cse(Vector1<Expression>(e), &temps);
+  EXPECT_TRUE(temps.empty());
+  EXPECT_PRED2(ExprEqual, result(0, 0), e);
+}
+
+TEST_F(SymbolicCseTest, Scalar) {
+  const Expression s{sin(x_ + y_)};
+  const Expression e{s * exp(s) + pow(s, x_ + y_)};
+  vector<pair<Variable, Expression>> temps;
+  const MatrixX<Expression> result = Cse(Vector1<Expression>(e), &temps);
+
+  // Both x + y and sin(x + y) are repeated, and x + y is defined first.
+  ASSERT_EQ(temps.size(), 2);
+  EXPECT_EQ(temps[0].first.get_name(), "cse0");
+  EXPECT_EQ(temps[1].first.get_name(), "cse1");
+  EXPECT_PRED2(ExprEqual, temps[0].second, x_ + y_);
+  EXPECT_PRED2(ExprEqual, temps[1].second, sin(temps[0].first));
+  const Expression t1{temps[1].first};
+  EXPECT_PRED2(ExprEqual, result(0, 0),
+               t1 * exp(t1) + pow(t1, temps[0].first));
+
+  EXPECT_NEAR(Inline(result(0, 0), temps).Evaluate(env_), e.Evaluate(env_),
+              1e-14);
+}
+
+TEST_F(SymbolicCseTest, Matrix) {
+  const Expression c{cos(x_ * y_)};
+  const Expression s{sin(x_ * y_)};
+  Eigen::Matrix<Expression, 2, 2> m;
+  // clang-format off
+  m << c, -s,
+       s,  c;
+  // clang-format on
+  vector<pair<Variable, Expression>> temps;
+  const MatrixX<Expression> result = Cse(m, &temps, "t");
+
+  // x * y, cos(x * y) and sin(x * y) are shared between the entries.
+  ASSERT_EQ(temps.size(), 3);
+  EXPECT_EQ(temps[0].first.get_name(), "t0");
+  EXPECT_PRED2(ExprEqual, temps[0].second, x_ * y_);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      EXPECT_NEAR(Inline(result(i, j), temps).Evaluate(env_),
+                  m(i, j).Evaluate(env_), 1e-14);
+    }
+  }
+  EXPECT_PRED2(ExprEqual, result(0, 0), result(1, 1));
+}
+
+TEST_F(SymbolicCseTest, IfThenElse) {
+  const Expression s{sqrt(x_ * x_ + y_ * y_)};
+  const Expression e{if_then_else(x_ > y_, s, 2 * s)};
+  vector<pair<Variable, Expression>> temps;
+  const MatrixX<Expression> result = Cse(Vector1<Expression>(e), &temps);
+  ASSERT_EQ(temps.size(), 1);
+  EXPECT_PRED2(ExprEqual, temps[0].second, s);
+  EXPECT_NEAR(Inline(result(0, 0), temps).Evaluate(env_), e.Evaluate(env_),
+              1e-14);
+}
+
+TEST_F(SymbolicCseTest, NaN) {
+  vector<pair<Variable, Expression>> temps;
+  EXPECT_THROW(Cse(Vector1<Expression>(Expression::NaN()), &temps),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
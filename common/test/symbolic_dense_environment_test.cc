@@ -0,0 +1,122 @@
+#include "drake/common/symbolic_dense_environment.h"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using std::runtime_error;
+
+class SymbolicDenseEnvironmentTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    vars_ << x_, y_, z_;
+    // clang-format off
+    points_ << 0.3, -1.2,  2.5, 0.7, 0.0,
+               1.1,  0.4, -0.8, 2.0, 0.0,
+              -0.6,  1.9,  0.2, 0.5, 0.0;
+    // clang-format on
+  }
+
+  // Checks that env.Evaluate(f) agrees with Formula::Evaluate() at each of
+  // points_.
+  void CheckAgainstEvaluate(const DenseEnvironment& env,
+                            const Formula& f) const {
+    const RowVectorX<bool> values = env.Evaluate(f);
+    ASSERT_EQ(values.size(), points_.cols());
+    for (int i = 0; i < points_.cols(); ++i) {
+      EXPECT_EQ(values(i), f.Evaluate(env.point_environment(i)))
+          << f << " at point " << i;
+    }
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  Vector3<Variable> vars_;
+  Eigen::Matrix<double, 3, 5> points_;
+};
+
+TEST_F(SymbolicDenseEnvironmentTest, Construction) {
+  const DenseEnvironment env(vars_, points_);
+  EXPECT_EQ(env.num_points(), 5);
+  EXPECT_TRUE(CompareMatrices(env.points(), points_));
+  EXPECT_EQ(env.variables().size(), 3);
+
+  const Environment point = env.point_environment(1);
+  EXPECT_EQ(point.size(), 3);
+  EXPECT_EQ(point[x_], -1.2);
+  EXPECT_EQ(point[y_], 0.4);
+  EXPECT_EQ(point[z_], 1.9);
+
+  EXPECT_THROW(DenseEnvironment(vars_, points_.topRows<2>()), runtime_error);
+  EXPECT_THROW(DenseEnvironment(Vector3<Variable>(x_, y_, x_), points_),
+               runtime_error);
+  EXPECT_THROW(DenseEnvironment(Vector3<Variable>(x_, y_, Variable()),
+                                points_),
+               runtime_error);
+}
+
+TEST_F(SymbolicDenseEnvironmentTest, EvaluateExpression) {
+  const DenseEnvironment env(vars_, points_);
+  const Expression e = sin(x_) * y_ + x_ * z_ - 3;
+  const Eigen::RowVectorXd values = env.Evaluate(e);
+  ASSERT_EQ(values.size(), points_.cols());
+  for (int i = 0; i < points_.cols(); ++i) {
+    EXPECT_NEAR(values(i), e.Evaluate(env.point_environment(i)), 1e-14);
+  }
+
+  // A variable missing from the environment.
+  const Variable w{"w"};
+  EXPECT_THROW(env.Evaluate(x_ + w), runtime_error);
+}
+
+TEST_F(SymbolicDenseEnvironmentTest, EvaluateMatrix) {
+  const DenseEnvironment env(vars_, points_);
+  Eigen::Matrix<Expression, 2, 2> m;
+  // clang-format off
+  m << x_ * y_, cos(z_),
+       x_ * y_ + 1, 2.0;
+  // clang-format on
+  const Eigen::MatrixXd values = env.Evaluate(m);
+  ASSERT_EQ(values.rows(), 4);
+  ASSERT_EQ(values.cols(), points_.cols());
+  for (int i = 0; i < points_.cols(); ++i) {
+    const Environment point = env.point_environment(i);
+    const Eigen::MatrixXd expected = m.unaryExpr(
+        [&point](const Expression& e) { return e.Evaluate(point); });
+    EXPECT_TRUE(CompareMatrices(
+        Eigen::Map<const Eigen::MatrixXd>(values.col(i).data(), 2, 2),
+        expected, 1e-14));
+  }
+}
+
+TEST_F(SymbolicDenseEnvironmentTest, EvaluateFormula) {
+  const DenseEnvironment env(vars_, points_);
+  CheckAgainstEvaluate(env, x_ < y_);
+  CheckAgainstEvaluate(env, x_ * x_ + y_ * y_ <= 1);
+  CheckAgainstEvaluate(env, x_ == 0.0 && y_ != z_);
+  CheckAgainstEvaluate(env, x_ > z_ || !(y_ >= 0));
+  CheckAgainstEvaluate(env, Formula::True());
+  CheckAgainstEvaluate(env, Formula::False());
+}
+
+// Formulas that cannot be compiled are evaluated at each point, while the
+// rest of their Boolean structure is still evaluated in batch.
+TEST_F(SymbolicDenseEnvironmentTest, EvaluateFormulaFallback) {
+  const DenseEnvironment env(vars_, points_);
+  const Formula f_isnan = isnan(x_ + y_);
+  CheckAgainstEvaluate(env, f_isnan);
+  CheckAgainstEvaluate(env, x_ < y_ && !f_isnan);
+  CheckAgainstEvaluate(env, f_isnan || (x_ > 0 && y_ > 0));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
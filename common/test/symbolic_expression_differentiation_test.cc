@@ -331,6 +331,31 @@ TEST_F(SymbolicDifferentiationTest, NumericalTests2) {
   }
 }
 
+// Differentiating an expression whose tree is exponentially larger than its
+// graph of shared subexpressions only takes time linear in the size of the
+// graph, since the derivatives of the shared subexpressions are only computed
+// once.
+TEST_F(SymbolicDifferentiationTest, SharedSubexpressions) {
+  // e₀ = x, eₖ₊₁ = sin(eₖ) * y + cos(eₖ).
+  Expression e{var_x_};
+  Expression e_small;
+  for (int k = 0; k < 100; ++k) {
+    e = sin(e) * var_y_ + cos(e);
+    if (k == 4) {
+      e_small = e;
+    }
+  }
+  // Without memoization, this would take O(2¹⁰⁰) time.
+  const Expression de{e.Differentiate(var_x_)};
+  EXPECT_FALSE(is_zero(de));
+
+  // Checks the result on the smaller expression, whose tree is small enough
+  // to be evaluated.
+  const Environment env{{var_x_, 0.3}, {var_y_, 0.7}};
+  EXPECT_NEAR(e_small.Differentiate(var_x_).Evaluate(env),
+              DifferenceQuotient(e_small, var_x_, env).Evaluate(env), 1e-5);
+}
+
 TEST_F(SymbolicDifferentiationTest, UninterpretedFunction) {
   const Expression uf{uninterpreted_function("uf", {var_x_, var_y_})};
   EXPECT_THROW(uf.Differentiate(var_x_), std::runtime_error);
@@ -901,6 +901,53 @@ TEST_F(SymbolicExpressionTest, HashUnary) {
   EXPECT_EQ(hash_set.size(), exprs.size());
 }
 
+// Builds sin(e) + cos(e), with e built recursively in the same way, starting
+// from x. Each call builds a new copy of each subexpression, and therefore the
+// resulting tree has O(2ᵈ) nodes for a given depth d.
+Expression BuildWithoutSharing(const Variable& x, const int depth) {
+  if (depth == 0) {
+    return x;
+  }
+  return sin(BuildWithoutSharing(x, depth - 1)) +
+         cos(BuildWithoutSharing(x, depth - 1));
+}
+
+TEST_F(SymbolicExpressionTest, HashConsing) {
+  const Expression e1{BuildWithoutSharing(var_x_, 10)};
+  ExpressionHashConsingScope scope;
+  EXPECT_EQ(scope.size(), 0);
+
+  const Expression e2{BuildWithoutSharing(var_x_, 10)};
+  // Each level adds a sine, a cosine and an addition. The variable is only
+  // stored once.
+  EXPECT_EQ(scope.size(), 1 + 3 * 10);
+  EXPECT_PRED2(ExprEqual, e1, e2);
+  EXPECT_EQ(get_std_hash(e1), get_std_hash(e2));
+
+  // Building it again does not add any cell.
+  const Expression e3{BuildWithoutSharing(var_x_, 10)};
+  EXPECT_EQ(scope.size(), 1 + 3 * 10);
+  EXPECT_PRED2(ExprEqual, e2, e3);
+
+  {
+    // A nested scope takes over, and does not know about the outer cells.
+    ExpressionHashConsingScope nested;
+    const Expression e4{BuildWithoutSharing(var_x_, 2)};
+    EXPECT_EQ(nested.size(), 1 + 3 * 2);
+  }
+  // The outer scope is used again.
+  const Expression e5{BuildWithoutSharing(var_x_, 11)};
+  EXPECT_EQ(scope.size(), 1 + 3 * 11);
+
+  // Structurally different expressions are not merged, even if they have
+  // the same value.
+  const Expression e6{x_ + y_};
+  const Expression e7{y_ + x_};
+  const Expression e8{x_ * y_};
+  EXPECT_PRED2(ExprEqual, e6, e7);
+  EXPECT_PRED2(ExprNotEqual, e6, e8);
+}
+
 TEST_F(SymbolicExpressionTest, UnaryPlus) {
   EXPECT_PRED2(ExprEqual, c3_, +c3_);
   EXPECT_PRED2(ExprEqual, Expression(var_x_), +var_x_);
@@ -465,6 +465,30 @@ TEST_F(SymbolicPolynomialTest, MultiplicationPolynomialPolynomial2) {
   EXPECT_EQ(product_map_expected, (p1 * p2).monomial_to_coefficient_map());
 }
 
+TEST_F(SymbolicPolynomialTest, MultiplicationPolynomialPolynomial3) {
+  // Evaluates (x² + 2xy + 3) * (y² - 2xy + z) whose coefficients are all
+  // constants, and (a * x + 1) * (x - b) whose coefficients are not.
+  const Polynomial p1{x_ * x_ + 2 * x_ * y_ + 3};
+  const Polynomial p2{y_ * y_ - 2 * x_ * y_ + z_};
+  EXPECT_PRED2(ExprEqual, (p1 * p2).ToExpression(),
+               (p1.ToExpression() * p2.ToExpression()).Expand());
+
+  // The cross terms of (x + y) * (x - y) cancel out.
+  Polynomial::MapType product_map_expected{};
+  product_map_expected.emplace(Monomial(var_x_, 2), 1);
+  product_map_expected.emplace(Monomial(var_y_, 2), -1);
+  EXPECT_EQ(product_map_expected,
+            (Polynomial(x_ + y_) * Polynomial(x_ - y_))
+                .monomial_to_coefficient_map());
+
+  const Polynomial p3{a_ * x_ + 1, {var_x_}};
+  const Polynomial p4{x_ - b_, {var_x_}};
+  const Polynomial p3_times_p4{p3 * p4};
+  EXPECT_EQ(p3_times_p4.indeterminates(), Variables({var_x_}));
+  EXPECT_PRED2(ExprEqual, p3_times_p4.ToExpression().Expand(),
+               ((a_ * x_ + 1) * (x_ - b_)).Expand());
+}
+
 TEST_F(SymbolicPolynomialTest, Pow) {
   for (int n = 2; n <= 5; ++n) {
     for (const Expression& e : exprs_) {
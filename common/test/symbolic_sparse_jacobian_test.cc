@@ -0,0 +1,102 @@
+#include "drake/common/symbolic_sparse_jacobian.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using test::ExprEqual;
+
+class SymbolicSparseJacobianTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    vars_ << x_, y_, z_, w_;
+    // clang-format off
+    f_ << x_ * y_,
+          sin(z_),
+          3.0,
+          x_ * x_ + w_ * z_;
+    // clang-format on
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const Variable w_{"w"};
+  Vector4<Variable> vars_;
+  Vector4<Expression> f_;
+};
+
+TEST_F(SymbolicSparseJacobianTest, Pattern) {
+  const JacobianSparsityPattern pattern(f_, vars_);
+  EXPECT_EQ(pattern.rows(), 4);
+  EXPECT_EQ(pattern.cols(), 4);
+  EXPECT_EQ(pattern.nonzeros(), 6);
+  // Ordered by column, then by row.
+  const std::vector<int> expected_rows{0, 3, 0, 1, 3, 3};
+  const std::vector<int> expected_cols{0, 0, 1, 2, 2, 3};
+  EXPECT_EQ(pattern.row_indices(), expected_rows);
+  EXPECT_EQ(pattern.col_indices(), expected_cols);
+}
+
+// The variables which do not appear in the list of variables are treated as
+// constants.
+TEST_F(SymbolicSparseJacobianTest, SubsetOfVariables) {
+  const JacobianSparsityPattern pattern(f_, Vector2<Variable>(z_, x_));
+  EXPECT_EQ(pattern.cols(), 2);
+  const std::vector<int> expected_rows{1, 3, 0, 3};
+  const std::vector<int> expected_cols{0, 0, 1, 1};
+  EXPECT_EQ(pattern.row_indices(), expected_rows);
+  EXPECT_EQ(pattern.col_indices(), expected_cols);
+}
+
+TEST_F(SymbolicSparseJacobianTest, MatchesDenseJacobian) {
+  const Eigen::SparseMatrix<Expression> J = SparseJacobian(f_, vars_);
+  EXPECT_EQ(J.nonZeros(), 6);
+  const MatrixX<Expression> J_dense = Jacobian(f_, vars_);
+  for (int i = 0; i < J_dense.rows(); ++i) {
+    for (int j = 0; j < J_dense.cols(); ++j) {
+      EXPECT_PRED2(ExprEqual, J.coeff(i, j), J_dense(i, j));
+    }
+  }
+}
+
+// The pattern can be reused for a function with the same structure, and the
+// structurally nonzero entries are kept even if their derivative is zero.
+TEST_F(SymbolicSparseJacobianTest, ReusePattern) {
+  const JacobianSparsityPattern pattern(f_, vars_);
+  Vector4<Expression> g;
+  // clang-format off
+  g << 2 * x_ * y_,
+       cos(z_),
+       -1.0,
+       x_ + w_ * z_;
+  // clang-format on
+  const Eigen::SparseMatrix<Expression> J = SparseJacobian(g, vars_, pattern);
+  EXPECT_EQ(J.nonZeros(), 6);
+  EXPECT_PRED2(ExprEqual, J.coeff(0, 1), 2 * x_);
+  EXPECT_PRED2(ExprEqual, J.coeff(3, 0), 1.0);
+
+  // Here, the entry (1, 2) is in the pattern but the derivative is zero.
+  Vector4<Expression> h;
+  h << y_ * x_, 0.0, 1.0, w_ * z_;
+  const Eigen::SparseMatrix<Expression> K = SparseJacobian(h, vars_, pattern);
+  EXPECT_EQ(K.nonZeros(), 6);
+  EXPECT_PRED2(ExprEqual, K.coeff(1, 2), 0.0);
+}
+
+TEST_F(SymbolicSparseJacobianTest, RepeatedVariables) {
+  EXPECT_THROW(JacobianSparsityPattern(f_, Vector2<Variable>(x_, x_)),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
@@ -56,6 +59,27 @@ TEST_F(VariablesTest, InsertSize) {
   EXPECT_EQ(vars1.size(), 3u);
 }
 
+// Variables are visited in increasing order and without duplicates, however
+// they are inserted.
+TEST_F(VariablesTest, InsertOrder) {
+  const std::vector<Variable> ordered{x_, y_, z_, w_, v_};
+  Variables vars1{v_, x_, w_, x_};
+  const std::vector<Variable> inserted{z_, y_, v_, y_};
+  vars1.insert(inserted.begin(), inserted.end());
+  vars1.insert(Variables{w_, z_});
+  vars1 += Variables{x_};
+  ASSERT_EQ(vars1.size(), 5u);
+  EXPECT_TRUE(std::equal(vars1.begin(), vars1.end(), ordered.begin(),
+                         std::equal_to<Variable>{}));
+
+  EXPECT_EQ(vars1.erase(Variables{y_, w_, Variable{"u"}}), 2u);
+  EXPECT_EQ(vars1, (Variables{x_, z_, v_}));
+  EXPECT_EQ(vars1.erase(x_), 1u);
+  EXPECT_EQ(vars1.erase(x_), 0u);
+  EXPECT_TRUE(vars1.find(x_) == vars1.end());
+  EXPECT_TRUE(vars1.find(v_)->equal_to(v_));
+}
+
 TEST_F(VariablesTest, Plus) {
   Variables vars1{x_, y_, z_};
   EXPECT_EQ(vars1.size(), 3u);
@@ -0,0 +1,114 @@
+#include "drake/common/trace.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace trace {
+namespace {
+
+class TraceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Disable();
+    Clear();
+  }
+
+  void TearDown() override {
+    Disable();
+    Clear();
+  }
+
+  static std::string WriteToString() {
+    std::ostringstream out;
+    WriteChromeTrace(&out);
+    return out.str();
+  }
+};
+
+TEST_F(TraceTest, DisabledRecordsNothing) {
+  int num_evaluations = 0;
+  {
+    DRAKE_TRACE_SCOPE("scope");
+    DRAKE_TRACE_COUNTER("counter", ++num_evaluations);
+    DRAKE_TRACE_EVENT("event");
+  }
+  EXPECT_EQ(GetNumEvents(), 0);
+  // The counter's value is not evaluated.
+  EXPECT_EQ(num_evaluations, 0);
+  EXPECT_EQ(WriteToString(),
+            "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+TEST_F(TraceTest, EnabledRecordsEvents) {
+  Enable();
+  EXPECT_TRUE(is_enabled());
+  {
+    DRAKE_TRACE_SCOPE("outer \"scope\"");
+    DRAKE_TRACE_COUNTER("counter", 2.5);
+    DRAKE_TRACE_EVENT("event");
+  }
+  EXPECT_EQ(GetNumEvents(), 3);
+
+  const std::string trace = WriteToString();
+  EXPECT_NE(trace.find("\"name\":\"outer \\\"scope\\\"\",\"ph\":\"X\""),
+            std::string::npos);
+  EXPECT_NE(trace.find("\"dur\":"), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"counter\",\"ph\":\"C\""), std::string::npos);
+  EXPECT_NE(trace.find("\"args\":{\"value\":2.5}"), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"event\",\"ph\":\"i\""), std::string::npos);
+
+  Clear();
+  EXPECT_EQ(GetNumEvents(), 0);
+}
+
+// A scope is recorded iff tracing was enabled when it began.
+TEST_F(TraceTest, ScopeSpanningEnable) {
+  {
+    DRAKE_TRACE_SCOPE("before");
+    Enable();
+  }
+  EXPECT_EQ(GetNumEvents(), 0);
+  {
+    DRAKE_TRACE_SCOPE("after");
+    Disable();
+  }
+  EXPECT_EQ(GetNumEvents(), 1);
+}
+
+// Each thread records into its own buffer, which outlives the thread.
+TEST_F(TraceTest, Threads) {
+  Enable();
+  DRAKE_TRACE_EVENT("main");
+  std::thread thread([]() { DRAKE_TRACE_EVENT("worker"); });
+  thread.join();
+  EXPECT_EQ(GetNumEvents(), 2);
+
+  const std::string trace = WriteToString();
+  const size_t main_index = trace.find("\"name\":\"main\"");
+  const size_t worker_index = trace.find("\"name\":\"worker\"");
+  ASSERT_NE(main_index, std::string::npos);
+  ASSERT_NE(worker_index, std::string::npos);
+  const std::string tid = "\"tid\":";
+  EXPECT_NE(trace.substr(trace.find(tid, main_index), tid.size() + 2),
+            trace.substr(trace.find(tid, worker_index), tid.size() + 2));
+}
+
+// When a thread's buffer is full, its oldest events are overwritten.
+TEST_F(TraceTest, RingBuffer) {
+  Enable();
+  for (int i = 0; i < kEventsPerThread + 10; ++i) {
+    DRAKE_TRACE_COUNTER("counter", i);
+  }
+  EXPECT_EQ(GetNumEvents(), kEventsPerThread);
+  const std::string trace = WriteToString();
+  EXPECT_EQ(trace.find("\"value\":9}"), std::string::npos);
+  EXPECT_NE(trace.find("\"value\":10}"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace trace
+}  // namespace drake
@@ -0,0 +1,275 @@
+#include "drake/common/trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace trace {
+
+const char* const kTraceEnvironmentVariableName = "DRAKE_TRACE";
+
+namespace internal {
+std::atomic<bool> g_enabled{false};
+}  // namespace internal
+
+namespace {
+
+// One recorded event. Its phase is that of the Chrome trace event format:
+// 'X' for a complete scope, 'C' for a counter and 'i' for an instant.
+struct Event {
+  const char* name{};
+  char phase{};
+  int64_t timestamp_ns{};
+  int64_t duration_ns{};
+  double value{};
+};
+
+// The ring buffer of the events of one thread. Only its thread records into
+// it, so recording needs no lock.
+class ThreadBuffer {
+ public:
+  explicit ThreadBuffer(int thread_id)
+      : thread_id_(thread_id), events_(kEventsPerThread) {}
+
+  int thread_id() const { return thread_id_; }
+
+  void Record(const Event& event) {
+    const int64_t num_recorded =
+        num_recorded_.load(std::memory_order_relaxed);
+    events_[num_recorded % kEventsPerThread] = event;
+    num_recorded_.store(num_recorded + 1, std::memory_order_release);
+  }
+
+  // Returns the number of events held, which is at most kEventsPerThread.
+  int64_t size() const {
+    return std::min<int64_t>(num_recorded_.load(std::memory_order_acquire),
+                             kEventsPerThread);
+  }
+
+  // Calls `visit` on each held event, from the oldest to the newest.
+  template <typename Visitor>
+  void ForEach(Visitor visit) const {
+    const int64_t num_recorded = num_recorded_.load(std::memory_order_acquire);
+    const int64_t first = std::max<int64_t>(0, num_recorded - kEventsPerThread);
+    for (int64_t i = first; i < num_recorded; ++i) {
+      visit(events_[i % kEventsPerThread]);
+    }
+  }
+
+  void Clear() { num_recorded_.store(0, std::memory_order_release); }
+
+ private:
+  const int thread_id_;
+  std::vector<Event> events_;
+  std::atomic<int64_t> num_recorded_{0};
+};
+
+// The buffers of all threads that have recorded events. Buffers outlive their
+// threads, so that the events of finished threads can still be written.
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& GetRegistry() {
+  static never_destroyed<Registry> registry;
+  return registry.access();
+}
+
+std::shared_ptr<ThreadBuffer> RegisterThreadBuffer() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.buffers.push_back(std::make_shared<ThreadBuffer>(
+      static_cast<int>(registry.buffers.size()) + 1));
+  return registry.buffers.back();
+}
+
+ThreadBuffer& GetThreadBuffer() {
+  thread_local const std::shared_ptr<ThreadBuffer> buffer =
+      RegisterThreadBuffer();
+  return *buffer;
+}
+
+void WriteJsonString(const char* value, std::ostream* out) {
+  *out << '"';
+  for (const char* c = value; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      *out << '\\' << *c;
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      *out << ' ';
+    } else {
+      *out << *c;
+    }
+  }
+  *out << '"';
+}
+
+// Writes a duration or a timestamp, given in nanoseconds, in microseconds.
+void WriteMicroseconds(int64_t nanoseconds, std::ostream* out) {
+  *out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0')
+       << nanoseconds % 1000;
+}
+
+// Enables tracing at startup iff the environment variable is set, and writes
+// the trace to the file it names at exit.
+class EnvironmentTrace {
+ public:
+  EnvironmentTrace() {
+    const char* const filename = std::getenv(kTraceEnvironmentVariableName);
+    if (filename != nullptr && filename[0] != '\0') {
+      filename_ = filename;
+      Enable();
+      std::atexit(&EnvironmentTrace::WriteAtExit);
+    }
+  }
+
+  static void WriteAtExit() {
+    Disable();
+    try {
+      WriteChromeTrace(get_instance().filename_);
+    } catch (const std::exception& e) {
+      drake::log()->error("Could not write the trace: {}", e.what());
+    }
+  }
+
+  static EnvironmentTrace& get_instance() {
+    static never_destroyed<EnvironmentTrace> instance;
+    return instance.access();
+  }
+
+ private:
+  std::string filename_;
+};
+
+// Checks the environment variable when the library is loaded.
+struct EnvironmentTraceInitializer {
+  EnvironmentTraceInitializer() { EnvironmentTrace::get_instance(); }
+} g_environment_trace_initializer;
+
+}  // namespace
+
+void Enable() {
+  internal::g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Disable() {
+  internal::g_enabled.store(false, std::memory_order_relaxed);
+}
+
+void Clear() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    buffer->Clear();
+  }
+}
+
+int64_t NowNanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void RecordScope(const char* name, int64_t start_ns, int64_t end_ns) {
+  GetThreadBuffer().Record(Event{name, 'X', start_ns, end_ns - start_ns, 0});
+}
+
+void RecordCounter(const char* name, double value) {
+  GetThreadBuffer().Record(Event{name, 'C', NowNanoseconds(), 0, value});
+}
+
+void RecordInstant(const char* name) {
+  GetThreadBuffer().Record(Event{name, 'i', NowNanoseconds(), 0, 0});
+}
+
+int64_t GetNumEvents() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  int64_t result = 0;
+  for (const auto& buffer : registry.buffers) {
+    result += buffer->size();
+  }
+  return result;
+}
+
+void WriteChromeTrace(std::ostream* out) {
+  DRAKE_DEMAND(out != nullptr);
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  // Timestamps are written relative to the earliest event.
+  int64_t origin_ns = std::numeric_limits<int64_t>::max();
+  for (const auto& buffer : registry.buffers) {
+    buffer->ForEach([&origin_ns](const Event& event) {
+      origin_ns = std::min(origin_ns, event.timestamp_ns);
+    });
+  }
+
+  const auto flags = out->flags();
+  const auto precision = out->precision();
+  const char fill = out->fill();
+  *out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  *out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& buffer : registry.buffers) {
+    const int thread_id = buffer->thread_id();
+    buffer->ForEach([&](const Event& event) {
+      *out << (first ? "\n" : ",\n") << "{\"name\":";
+      first = false;
+      WriteJsonString(event.name, out);
+      *out << ",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":"
+           << thread_id << ",\"ts\":";
+      WriteMicroseconds(event.timestamp_ns - origin_ns, out);
+      switch (event.phase) {
+        case 'X':
+          *out << ",\"dur\":";
+          WriteMicroseconds(event.duration_ns, out);
+          break;
+        case 'C':
+          *out << ",\"args\":{\"value\":";
+          if (std::isfinite(event.value)) {
+            *out << event.value;
+          } else {
+            *out << "null";
+          }
+          *out << "}";
+          break;
+        case 'i':
+          *out << ",\"s\":\"t\"";
+          break;
+      }
+      *out << "}";
+    });
+  }
+  *out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  out->flags(flags);
+  out->precision(precision);
+  out->fill(fill);
+}
+
+void WriteChromeTrace(const std::string& filename) {
+  std::ofstream out(filename);
+  if (!out) {
+    throw std::runtime_error("Could not open '" + filename + "' for writing.");
+  }
+  WriteChromeTrace(&out);
+  if (!out) {
+    throw std::runtime_error("Could not write to '" + filename + "'.");
+  }
+}
+
+}  // namespace trace
+}  // namespace drake
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+
+/**
+@file
+Provides a lightweight tracing facility for profiling hot code paths. Traced
+code is instrumented with these macros:
+<pre>
+  void Foo() {
+    DRAKE_TRACE_SCOPE("Foo");         // Times the rest of the enclosing scope.
+    ...
+    DRAKE_TRACE_COUNTER("num_contacts", num_contacts);  // Samples a value.
+    DRAKE_TRACE_EVENT("restarted");   // Marks an instant.
+  }
+</pre>
+The names must be string literals (or otherwise outlive the process), since
+only their addresses are recorded.
+
+Tracing is disabled by default, in which case each macro costs a single
+relaxed atomic load. It is enabled at runtime with drake::trace::Enable(), or
+by setting the environment variable named by
+drake::trace::kTraceEnvironmentVariableName to the path of a file, to which
+the trace is then written when the process exits. Defining
+`DRAKE_DISABLE_TRACING` when compiling removes the macros altogether.
+
+Each thread records its events into its own fixed-size ring buffer, without
+locks; when a buffer is full, the oldest events are overwritten. The events
+of all threads can be written in the Chrome trace event format with
+drake::trace::WriteChromeTrace(), and viewed with `chrome://tracing` or
+Perfetto.
+*/
+
+namespace drake {
+namespace trace {
+
+/// The name of the environment variable that, when set to a file path,
+/// enables tracing when the process starts and writes the Chrome trace to
+/// that file when it exits. The value is guaranteed to be "DRAKE_TRACE".
+extern const char* const kTraceEnvironmentVariableName;
+
+/// The number of events kept per thread.
+constexpr int kEventsPerThread = 1 << 16;
+
+namespace internal {
+// Whether events are recorded. Read by the macros on every call.
+extern std::atomic<bool> g_enabled;
+}  // namespace internal
+
+/// Returns whether events are currently recorded.
+inline bool is_enabled() {
+  return internal::g_enabled.load(std::memory_order_relaxed);
+}
+
+/// Starts recording events.
+void Enable();
+
+/// Stops recording events. Recorded events are kept.
+void Disable();
+
+/// Discards the recorded events of all threads. This must not be called while
+/// other threads may be recording events.
+void Clear();
+
+/// Returns a monotonic timestamp, in nanoseconds.
+int64_t NowNanoseconds();
+
+/// Records that the scope named @p name ran from @p start_ns to @p end_ns, as
+/// returned by NowNanoseconds(). Prefer DRAKE_TRACE_SCOPE.
+void RecordScope(const char* name, int64_t start_ns, int64_t end_ns);
+
+/// Records the value of the counter named @p name. Prefer DRAKE_TRACE_COUNTER.
+void RecordCounter(const char* name, double value);
+
+/// Records an instant event named @p name. Prefer DRAKE_TRACE_EVENT.
+void RecordInstant(const char* name);
+
+/// Returns the number of events currently held by all threads' buffers.
+int64_t GetNumEvents();
+
+/// Writes the recorded events of all threads to @p out, as a JSON object in
+/// the Chrome trace event format. Timestamps are in microseconds since an
+/// arbitrary origin, and each recording thread appears as a separate `tid`.
+/// This must not be called while other threads may be recording events, e.g.,
+/// call it after joining them, or after calling Disable() and letting their
+/// current scopes finish.
+void WriteChromeTrace(std::ostream* out);
+
+/// Writes the Chrome trace to the file @p filename.
+/// @throws std::runtime_error if the file cannot be written.
+void WriteChromeTrace(const std::string& filename);
+
+/// Records the time spent between its construction and its destruction as a
+/// scope, if tracing was enabled when it was constructed. Prefer
+/// DRAKE_TRACE_SCOPE.
+class ScopedTrace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedTrace)
+
+  explicit ScopedTrace(const char* name)
+      : name_(is_enabled() ? name : nullptr),
+        start_ns_(name_ ? NowNanoseconds() : 0) {}
+
+  ~ScopedTrace() {
+    if (name_) RecordScope(name_, start_ns_, NowNanoseconds());
+  }
+
+ private:
+  const char* const name_;
+  const int64_t start_ns_;
+};
+
+}  // namespace trace
+}  // namespace drake
+
+#ifndef DRAKE_DISABLE_TRACING
+
+#define DRAKE_TRACE_CONCAT_IMPL(a, b) a##b
+#define DRAKE_TRACE_CONCAT(a, b) DRAKE_TRACE_CONCAT_IMPL(a, b)
+
+/// Records the time spent in the rest of the enclosing scope under @p name.
+#define DRAKE_TRACE_SCOPE(name)                   \
+  ::drake::trace::ScopedTrace DRAKE_TRACE_CONCAT( \
+      drake_trace_scope_, __LINE__)(name)
+
+/// Records the current @p value of the counter named @p name. The value is
+/// only evaluated when tracing is enabled.
+#define DRAKE_TRACE_COUNTER(name, value)                                   \
+  do {                                                                     \
+    if (::drake::trace::is_enabled()) {                                    \
+      ::drake::trace::RecordCounter(name, static_cast<double>(value));     \
+    }                                                                      \
+  } while (0)
+
+/// Records an instant event named @p name.
+#define DRAKE_TRACE_EVENT(name)                                            \
+  do {                                                                     \
+    if (::drake::trace::is_enabled()) ::drake::trace::RecordInstant(name); \
+  } while (0)
+
+#else  // DRAKE_DISABLE_TRACING
+
+#define DRAKE_TRACE_SCOPE(name)
+#define DRAKE_TRACE_COUNTER(name, value) do {} while (0)
+#define DRAKE_TRACE_EVENT(name) do {} while (0)
+
+#endif  // DRAKE_DISABLE_TRACING
@@ -1,7 +1,10 @@
 #include "drake/common/trajectories/exponential_plus_piecewise_polynomial.h"
 
+#include <algorithm>
 #include <memory>
 
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
 #include <unsupported/Eigen/MatrixFunctions>
 
 namespace drake {
@@ -19,6 +22,7 @@ ExponentialPlusPiecewisePolynomial<T>::
           1, piecewise_polynomial_part.get_number_of_segments())),
       piecewise_polynomial_part_(piecewise_polynomial_part) {
   DRAKE_ASSERT(piecewise_polynomial_part.cols() == 1);
+  CacheEigendecomposition();
 }
 
 template <typename T>
@@ -27,13 +31,65 @@ std::unique_ptr<Trajectory<T>> ExponentialPlusPiecewisePolynomial<T>::Clone()
   return std::make_unique<ExponentialPlusPiecewisePolynomial<T>>(*this);
 }
 
+template <typename T>
+void ExponentialPlusPiecewisePolynomial<T>::CacheEigendecomposition() {
+  eigenvalues_.resize(0);
+  K_V_.resize(0, 0);
+  V_inv_alpha_.resize(0, 0);
+  if (A_.size() == 0) return;
+  Eigen::EigenSolver<MatrixX<T>> solver(A_);
+  if (solver.info() != Eigen::Success) return;
+  const MatrixX<std::complex<T>> V = solver.eigenvectors();
+  const Eigen::PartialPivLU<MatrixX<std::complex<T>>> V_lu(V);
+  // A defective A has (nearly) parallel eigenvectors; only use the
+  // decomposition if it reproduces A.
+  const MatrixX<std::complex<T>> A_reconstructed =
+      V * solver.eigenvalues().asDiagonal() * V_lu.inverse();
+  const T kTolerance = 1e-10;
+  if ((A_reconstructed - A_.template cast<std::complex<T>>()).norm() >
+      kTolerance * std::max(T(1), A_.norm())) {
+    return;
+  }
+  eigenvalues_ = solver.eigenvalues();
+  K_V_ = K_.template cast<std::complex<T>>() * V;
+  V_inv_alpha_ = V_lu.solve(alpha_.template cast<std::complex<T>>());
+}
+
+template <typename T>
+void ExponentialPlusPiecewisePolynomial<T>::AddExponentialPart(
+    double t, int segment_index, double t_j,
+    Eigen::Ref<MatrixX<T>> value) const {
+  if (eigenvalues_.size() == 0) {
+    auto exponential = (A_ * (t - t_j)).eval().exp().eval();
+    value.noalias() += K_ * exponential * alpha_.col(segment_index);
+    return;
+  }
+  const VectorX<std::complex<T>> modes =
+      ((eigenvalues_ * (t - t_j)).array().exp() *
+       V_inv_alpha_.col(segment_index).array()).matrix();
+  value += (K_V_ * modes).real();
+}
+
 template <typename T>
 MatrixX<T> ExponentialPlusPiecewisePolynomial<T>::value(double t) const {
   int segment_index = this->get_segment_index(t);
   MatrixX<T> ret = piecewise_polynomial_part_.value(t);
   double tj = this->start_time(segment_index);
-  auto exponential = (A_ * (t - tj)).eval().exp().eval();
-  ret.noalias() += K_ * exponential * alpha_.col(segment_index);
+  AddExponentialPart(t, segment_index, tj, ret);
+  return ret;
+}
+
+template <typename T>
+MatrixX<T> ExponentialPlusPiecewisePolynomial<T>::vector_values(
+    const std::vector<double>& times) const {
+  MatrixX<T> ret(rows(), times.size());
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    const double t = times[i];
+    const int segment_index = this->get_segment_index(t);
+    ret.col(i) = piecewise_polynomial_part_.value(t);
+    AddExponentialPart(t, segment_index, this->start_time(segment_index),
+                       ret.col(i));
+  }
   return ret;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <complex>
 #include <memory>
 #include <vector>
 
@@ -44,6 +45,7 @@ class ExponentialPlusPiecewisePolynomial final
                  piecewise_polynomial_part.get_number_of_segments());
     DRAKE_ASSERT(piecewise_polynomial_part.rows() == rows());
     DRAKE_ASSERT(piecewise_polynomial_part.cols() == 1);
+    CacheEigendecomposition();
   }
 
   // from PiecewisePolynomial
@@ -56,6 +58,10 @@ class ExponentialPlusPiecewisePolynomial final
 
   MatrixX<T> value(double t) const override;
 
+  /// Evaluates the trajectory at each of the given times, which need not be
+  /// sorted.  Returns a matrix whose column i is value(times[i]).
+  MatrixX<T> vector_values(const std::vector<double>& times) const;
+
   ExponentialPlusPiecewisePolynomial derivative(int derivative_order = 1) const;
 
   std::unique_ptr<Trajectory<T>> MakeDerivative(
@@ -70,10 +76,25 @@ class ExponentialPlusPiecewisePolynomial final
   void shiftRight(double offset);
 
  private:
+  // Diagonalizes A = V diag(λ) V⁻¹ and caches K V and V⁻¹ alpha, so that
+  // value() needs only a scalar exponential per eigenvalue.  Leaves the cache
+  // empty if A is not diagonalizable to within roundoff, in which case
+  // value() computes the general matrix exponential.
+  void CacheEigendecomposition();
+
+  // Adds K exp(A (t - t_j)) alpha.col(j) to @p value, where j is the index of
+  // the segment that starts at @p t_j.
+  void AddExponentialPart(double t, int segment_index, double t_j,
+                          Eigen::Ref<MatrixX<T>> value) const;
+
   MatrixX<T> K_;
   MatrixX<T> A_;
   MatrixX<T> alpha_;
   PiecewisePolynomial<T> piecewise_polynomial_part_;
+  // The eigenvalues of A, K V and V⁻¹ alpha; empty if not diagonalizable.
+  VectorX<std::complex<T>> eigenvalues_;
+  MatrixX<std::complex<T>> K_V_;
+  MatrixX<std::complex<T>> V_inv_alpha_;
 };
 
 }  // namespace trajectories
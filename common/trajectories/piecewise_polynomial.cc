@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <memory>
 
+#include <Eigen/SparseLU>
+
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 
 using std::runtime_error;
 using std::vector;
@@ -112,17 +115,23 @@ double PiecewisePolynomial<T>::scalarValue(double t,
 template <typename T>
 MatrixX<T>
 PiecewisePolynomial<T>::value(double t) const {
+  MatrixX<T> ret(rows(), cols());
+  EvalInto(t, ret);
+  return ret;
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::EvalInto(double t,
+                                      Eigen::Ref<MatrixX<T>> value) const {
+  DRAKE_THROW_UNLESS(value.rows() == rows() && value.cols() == cols());
   int segment_index = this->get_segment_index(t);
   t = std::min(std::max(t, this->start_time()), this->end_time());
-  Eigen::Matrix<double, PolynomialMatrix::RowsAtCompileTime,
-                PolynomialMatrix::ColsAtCompileTime>
-      ret(rows(), cols());
   for (Eigen::Index row = 0; row < rows(); row++) {
     for (Eigen::Index col = 0; col < cols(); col++) {
-      ret(row, col) = segmentValueAtGlobalAbscissa(segment_index, t, row, col);
+      value(row, col) =
+          segmentValueAtGlobalAbscissa(segment_index, t, row, col);
     }
   }
-  return ret;
 }
 
 template <typename T>
@@ -599,64 +608,105 @@ int PiecewisePolynomial<T>::
     SetupCubicSplineInteriorCoeffsLinearSystem(
         const std::vector<double>& breaks,
         const std::vector<CoefficientMatrix>& knots,
-        int row, int col,
-        MatrixX<T>* A,
-        VectorX<T>* b) {
+        std::vector<Eigen::Triplet<T>>* A,
+        MatrixX<T>* b) {
   const std::vector<double>& times = breaks;
   const std::vector<CoefficientMatrix>& Y = knots;
   int N = static_cast<int>(times.size());
+  const int num_entries = static_cast<int>(Y.front().size());
 
   DRAKE_DEMAND(A != nullptr);
   DRAKE_DEMAND(b != nullptr);
-  DRAKE_DEMAND(A->rows() == 4 * (N - 1));
-  DRAKE_DEMAND(A->cols() == 4 * (N - 1));
   DRAKE_DEMAND(b->rows() == 4 * (N - 1));
+  DRAKE_DEMAND(b->cols() == num_entries);
 
   int row_idx = 0;
-  MatrixX<T>& Aref = *A;
-  VectorX<T>& bref = *b;
-
+  std::vector<Eigen::Triplet<T>>& Aref = *A;
+  MatrixX<T>& bref = *b;
+  // Each row of b holds the right hand side for all entries of the knots, in
+  // column-major order.
+  auto set_b = [&bref](int row, const CoefficientMatrix& value) {
+    bref.row(row) = Eigen::Map<const VectorX<T>>(value.data(), value.size());
+  };
+
+  Aref.reserve(Aref.size() + 12 * (N - 1));
   for (int i = 0; i < N - 1; ++i) {
     double dt = times[i + 1] - times[i];
 
     // y_i(x_i) = a0i = Y[i]
-    Aref(row_idx, 4 * i) = 1;
-    bref(row_idx++) = Y[i](row, col);
+    Aref.emplace_back(row_idx, 4 * i, 1);
+    set_b(row_idx++, Y[i]);
 
     // y_i(x_{i+1}) = y_{i+1}(x_{i}) =>
     // a0i + a1i*(x_{i+1} - x_i) + a2i(x_{i+1} - x_i)^2 + a3i(x_{i+1} -
     // x_i)^3 = a0{i+1}
-    Aref(row_idx, 4 * i + 0) = 1;
-    Aref(row_idx, 4 * i + 1) = dt;
-    Aref(row_idx, 4 * i + 2) = dt * dt;
-    Aref(row_idx, 4 * i + 3) = dt * dt * dt;
+    Aref.emplace_back(row_idx, 4 * i + 0, 1);
+    Aref.emplace_back(row_idx, 4 * i + 1, dt);
+    Aref.emplace_back(row_idx, 4 * i + 2, dt * dt);
+    Aref.emplace_back(row_idx, 4 * i + 3, dt * dt * dt);
     if (i != N - 2) {
-      Aref(row_idx++, 4 * (i + 1)) = -1;
+      Aref.emplace_back(row_idx++, 4 * (i + 1), -1);
     } else {
-      bref(row_idx++) = Y[N - 1](row, col);
+      set_b(row_idx++, Y[N - 1]);
     }
 
     // y_i'(x_{i+1}) = y_{i+1}'(x_{i}) =>
     // a1i + 2*a2i(x_{i+1} - x_i) + 3*a3i(x_{i+1} - x_i)^2 = a1{i+1}
     if (i != N - 2) {
-      Aref(row_idx, 4 * i + 1) = 1;
-      Aref(row_idx, 4 * i + 2) = 2 * dt;
-      Aref(row_idx, 4 * i + 3) = 3 * dt * dt;
-      Aref(row_idx++, 4 * (i + 1) + 1) = -1;
+      Aref.emplace_back(row_idx, 4 * i + 1, 1);
+      Aref.emplace_back(row_idx, 4 * i + 2, 2 * dt);
+      Aref.emplace_back(row_idx, 4 * i + 3, 3 * dt * dt);
+      Aref.emplace_back(row_idx++, 4 * (i + 1) + 1, -1);
     }
 
     if (i != N - 2) {
       // y_i''(x_{i+1}) = y_{i+1}''(x_{i}) =>
       // 2*a2i + 6*a3i(x_{i+1} - x_i) = 2*a2{i+1}
-      Aref(row_idx, 4 * i + 2) = 2;
-      Aref(row_idx, 4 * i + 3) = 6 * dt;
-      Aref(row_idx++, 4 * (i + 1) + 2) = -2;
+      Aref.emplace_back(row_idx, 4 * i + 2, 2);
+      Aref.emplace_back(row_idx, 4 * i + 3, 6 * dt);
+      Aref.emplace_back(row_idx++, 4 * (i + 1) + 2, -2);
     }
   }
   DRAKE_DEMAND(row_idx == 4 * (N - 1) - 2);
   return row_idx;
 }
 
+// Solves the banded linear system of a cubic spline, whose triplets are in
+// `A` and whose right hand side for each entry of the knots is in the columns
+// of `b`, and returns the polynomials of each segment.
+template <typename T>
+std::vector<typename PiecewisePolynomial<T>::PolynomialMatrix>
+PiecewisePolynomial<T>::SolveCubicSplineCoeffsLinearSystem(
+    const std::vector<Eigen::Triplet<T>>& A, const MatrixX<T>& b, int rows,
+    int cols) {
+  const Eigen::Index num_unknowns = b.rows();
+  const int num_segments = static_cast<int>(num_unknowns / 4);
+  Eigen::SparseMatrix<T> A_sparse(num_unknowns, num_unknowns);
+  A_sparse.setFromTriplets(A.begin(), A.end());
+
+  // The matrix has 4 (N - 1) rows but only a dozen non-zeros per segment, and
+  // is the same for all entries of the knots. A single sparse factorization
+  // therefore solves for all entries in time linear in N.
+  Eigen::SparseLU<Eigen::SparseMatrix<T>> solver;
+  solver.compute(A_sparse);
+  if (solver.info() != Eigen::Success) {
+    throw std::runtime_error("Cubic spline linear system is singular.");
+  }
+  const MatrixX<T> solution = solver.solve(b);
+
+  std::vector<PolynomialMatrix> polynomials(num_segments);
+  for (int i = 0; i < num_segments; ++i) {
+    polynomials[i].resize(rows, cols);
+    for (int k = 0; k < cols; ++k) {
+      for (int j = 0; j < rows; ++j) {
+        polynomials[i](j, k) = Polynomial<T>(
+            solution.template block<4, 1>(4 * i, k * rows + j));
+      }
+    }
+  }
+  return polynomials;
+}
+
 // Makes a cubic piecewise polynomial.
 // Internal knot points have continuous values, first and second derivatives,
 // and first derivatives at both end points are set to `knot_dot_at_start`
@@ -687,45 +737,26 @@ PiecewisePolynomial<T>::Cubic(
     throw std::runtime_error("Ydot_end and Y dimension mismatch");
   }
 
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
-  }
-
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
+  std::vector<Eigen::Triplet<T>> A;
+  MatrixX<T> b = MatrixX<T>::Zero(4 * (N - 1), rows * cols);
 
   // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
+  int row_idx = SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, &A, &b);
 
-      // Endpoints' velocity matches the given ones.
-      A(row_idx, 1) = 1;
-      b(row_idx++) = Ydot_start(j, k);
+  // Endpoints' velocity matches the given ones.
+  A.emplace_back(row_idx, 1, 1);
+  b.row(row_idx++) =
+      Eigen::Map<const VectorX<T>>(Ydot_start.data(), Ydot_start.size());
 
-      A(row_idx, 4 * (N - 2) + 1) = 1;
-      A(row_idx, 4 * (N - 2) + 2) = 2 * (times[N - 1] - times[N - 2]);
-      A(row_idx, 4 * (N - 2) + 3) =
-          3 * (times[N - 1] - times[N - 2]) * (times[N - 1] - times[N - 2]);
-      b(row_idx++) = Ydot_end(j, k);
+  const double dt_end = times[N - 1] - times[N - 2];
+  A.emplace_back(row_idx, 4 * (N - 2) + 1, 1);
+  A.emplace_back(row_idx, 4 * (N - 2) + 2, 2 * dt_end);
+  A.emplace_back(row_idx, 4 * (N - 2) + 3, 3 * dt_end * dt_end);
+  b.row(row_idx++) =
+      Eigen::Map<const VectorX<T>>(Ydot_end.data(), Ydot_end.size());
 
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
-
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
-    }
-  }
-
-  return PiecewisePolynomial<T>(polynomials, times);
+  return PiecewisePolynomial<T>(
+      SolveCubicSplineCoeffsLinearSystem(A, b, rows, cols), times);
 }
 
 // Makes a cubic piecewise polynomial.
@@ -745,54 +776,28 @@ PiecewisePolynomial<T>::Cubic(
   int rows = Y.front().rows();
   int cols = Y.front().cols();
 
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
-  }
-
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
+  std::vector<Eigen::Triplet<T>> A;
+  MatrixX<T> b = MatrixX<T>::Zero(4 * (N - 1), rows * cols);
 
   // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
-
-      if (N > 3) {
-        // Ydddot(times[1]) is continuous.
-        A(row_idx, 3) = 1;
-        A(row_idx, 4 + 3) = -1;
-        b(row_idx++) = 0;
-
-        // Ydddot(times[N-2]) is continuous.
-        A(row_idx, 4 * (N - 3) + 3) = 1;
-        A(row_idx, 4 * (N - 2) + 3) = -1;
-        b(row_idx++) = 0;
-      } else {
-        // Set Jerk to zero if only have 3 points, becomes a quadratic.
-        A(row_idx, 3) = 1;
-        b(row_idx++) = 0;
-
-        A(row_idx, 4 + 3) = 1;
-        b(row_idx++) = 0;
-      }
+  int row_idx = SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, &A, &b);
 
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
+  if (N > 3) {
+    // Ydddot(times[1]) is continuous.
+    A.emplace_back(row_idx, 3, 1);
+    A.emplace_back(row_idx++, 4 + 3, -1);
 
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
-    }
+    // Ydddot(times[N-2]) is continuous.
+    A.emplace_back(row_idx, 4 * (N - 3) + 3, 1);
+    A.emplace_back(row_idx++, 4 * (N - 2) + 3, -1);
+  } else {
+    // Set Jerk to zero if only have 3 points, becomes a quadratic.
+    A.emplace_back(row_idx++, 3, 1);
+    A.emplace_back(row_idx++, 4 + 3, 1);
   }
 
-  return PiecewisePolynomial<T>(polynomials, times);
+  return PiecewisePolynomial<T>(
+      SolveCubicSplineCoeffsLinearSystem(A, b, rows, cols), times);
 }
 
 namespace {
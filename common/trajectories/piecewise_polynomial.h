@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -339,6 +340,13 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
    */
   MatrixX<T> value(double t) const override;
 
+  /**
+   * Evaluates the PiecewisePolynomial at the given time \p t into \p value,
+   * which must already have rows() rows and cols() columns. Unlike value(),
+   * this does not allocate memory.
+   */
+  void EvalInto(double t, Eigen::Ref<MatrixX<T>> value) const override;
+
   const PolynomialMatrix& getPolynomialMatrix(int segment_index) const;
 
   const PolynomialType& getPolynomial(int segment_index, Eigen::Index row = 0,
@@ -449,10 +457,23 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   // constraints. There are still 2 constraints missing, which can be resolved
   // by various end point conditions (velocity at the end points /
   // "not-a-knot" / etc). These will be specified by the callers.
+  //
+  // The non-zeros of the matrix, which is the same for all entries of the
+  // knots, are appended to `A`. Column `k * rows + j` of `b` is the right hand
+  // side for entry (j, k) of the knots.
   static int SetupCubicSplineInteriorCoeffsLinearSystem(
       const std::vector<double>& breaks,
-      const std::vector<CoefficientMatrix>& knots, int row, int col,
-      MatrixX<T>* A, VectorX<T>* b);
+      const std::vector<CoefficientMatrix>& knots,
+      std::vector<Eigen::Triplet<T>>* A, MatrixX<T>* b);
+
+  // Solves the linear system set up by
+  // SetupCubicSplineInteriorCoeffsLinearSystem and the end point conditions
+  // for all entries of the knots at once, and returns each segment's
+  // polynomials, which have `rows` rows and `cols` columns.
+  // Throws std::runtime_error if the system is singular.
+  static std::vector<PolynomialMatrix> SolveCubicSplineCoeffsLinearSystem(
+      const std::vector<Eigen::Triplet<T>>& A, const MatrixX<T>& b, int rows,
+      int cols);
 
   // Computes the first derivative at the end point using a non-centered,
   // shape-preserving three-point formulae.
@@ -0,0 +1,129 @@
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
+
+#include <algorithm>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace trajectories {
+
+PiecewisePolynomialEvaluator::PiecewisePolynomialEvaluator(
+    const PiecewisePolynomial<double>& pp)
+    : rows_(pp.rows()), cols_(pp.cols()), breaks_(pp.get_segment_times()) {
+  DRAKE_THROW_UNLESS(!pp.empty());
+  const int num_segments = pp.get_number_of_segments();
+  for (int i = 0; i < num_segments; ++i) {
+    for (Eigen::Index col = 0; col < cols_; ++col) {
+      for (Eigen::Index row = 0; row < rows_; ++row) {
+        degree_ = std::max(degree_, pp.getSegmentPolynomialDegree(i, row, col));
+      }
+    }
+  }
+
+  const Eigen::Index num_entries = rows_ * cols_;
+  coefficients_.assign(num_segments * (degree_ + 1) * num_entries, 0.0);
+  for (int i = 0; i < num_segments; ++i) {
+    for (Eigen::Index col = 0; col < cols_; ++col) {
+      for (Eigen::Index row = 0; row < rows_; ++row) {
+        const VectorX<double> entry_coefficients =
+            pp.getPolynomial(i, row, col).GetCoefficients();
+        const Eigen::Index entry = col * rows_ + row;
+        for (int power = 0; power < entry_coefficients.size(); ++power) {
+          coefficients_[(i * (degree_ + 1) + power) * num_entries + entry] =
+              entry_coefficients(power);
+        }
+      }
+    }
+  }
+}
+
+PiecewisePolynomialEvaluator::PiecewisePolynomialEvaluator(
+    const PiecewisePolynomialEvaluator& other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      degree_(other.degree_),
+      breaks_(other.breaks_),
+      coefficients_(other.coefficients_),
+      segment_hint_(other.segment_hint_.load(std::memory_order_relaxed)) {}
+
+PiecewisePolynomialEvaluator& PiecewisePolynomialEvaluator::operator=(
+    const PiecewisePolynomialEvaluator& other) {
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  degree_ = other.degree_;
+  breaks_ = other.breaks_;
+  coefficients_ = other.coefficients_;
+  segment_hint_.store(other.segment_hint_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  return *this;
+}
+
+int PiecewisePolynomialEvaluator::get_segment_index(double t) const {
+  const int num_segments = get_number_of_segments();
+  t = std::min(std::max(t, start_time()), end_time());
+  // Segment i holds [breaks_[i], breaks_[i + 1]), except for the last one,
+  // which also holds the end time.
+  auto holds = [&](int i) {
+    return i >= 0 && i < num_segments && breaks_[i] <= t &&
+           (t < breaks_[i + 1] || i == num_segments - 1);
+  };
+  int index = segment_hint_.load(std::memory_order_relaxed);
+  if (!holds(index)) {
+    if (holds(index + 1)) {
+      ++index;
+    } else {
+      // The last break that is not after t, among the starts of segments.
+      index = static_cast<int>(std::upper_bound(breaks_.begin(),
+                                                breaks_.end() - 1, t) -
+                               breaks_.begin()) - 1;
+      index = std::max(index, 0);
+    }
+    segment_hint_.store(index, std::memory_order_relaxed);
+  }
+  return index;
+}
+
+void PiecewisePolynomialEvaluator::EvalInto(
+    double t, int derivative_order, Eigen::Ref<VectorX<double>> value) const {
+  DRAKE_THROW_UNLESS(derivative_order >= 0);
+  DRAKE_THROW_UNLESS(value.size() == rows_ * cols_);
+  const int segment_index = get_segment_index(t);
+  t = std::min(std::max(t, start_time()), end_time());
+  const double x = t - breaks_[segment_index];
+
+  const Eigen::Index num_entries = rows_ * cols_;
+  value.setZero();
+  // Horner's scheme on the derivative, whose power k - d coefficient is
+  // c_k * k! / (k - d)!, for the original power k coefficient c_k.
+  for (int power = degree_; power >= derivative_order; --power) {
+    double factor = 1;
+    for (int j = power - derivative_order + 1; j <= power; ++j) {
+      factor *= j;
+    }
+    const Eigen::Map<const Eigen::ArrayXd> c(
+        coefficients(segment_index, power), num_entries);
+    value.array() = value.array() * x + factor * c;
+  }
+}
+
+MatrixX<double> PiecewisePolynomialEvaluator::value(
+    double t, int derivative_order) const {
+  MatrixX<double> result(rows_, cols_);
+  EvalInto(t, derivative_order,
+           Eigen::Map<VectorX<double>>(result.data(), rows_ * cols_));
+  return result;
+}
+
+MatrixX<double> PiecewisePolynomialEvaluator::value(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    int derivative_order) const {
+  MatrixX<double> result(rows_ * cols_, times.size());
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    EvalInto(times(i), derivative_order, result.col(i));
+  }
+  return result;
+}
+
+}  // namespace trajectories
+}  // namespace drake
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
+
+namespace drake {
+namespace trajectories {
+
+/// A read-only copy of a PiecewisePolynomial<double> that is packed for fast
+/// evaluation of the polynomial and its derivatives.
+///
+/// A PiecewisePolynomial stores each entry of each segment as a Polynomial,
+/// which holds its monomials on the heap. This class copies all of the
+/// coefficients into a single contiguous array, indexed as
+/// [segment][power][entry], where the entries of a segment's matrix are in
+/// column-major order and every entry is padded to the highest degree of the
+/// polynomial. Evaluation runs Horner's scheme over all entries of a segment
+/// at once, so that the innermost loop is a vectorizable operation on
+/// contiguous coefficients.
+///
+/// The segment containing the queried time is looked up from the segment
+/// found by the previous query first, and then from the one after it, before
+/// falling back to a binary search. Queries at increasing times, such as those
+/// of a simulation or a control loop, therefore find their segment in
+/// constant time. The hint is only an optimization: the results do not depend
+/// on it, and concurrent queries from several threads are safe.
+///
+/// Like PiecewisePolynomial::value(), queries outside of
+/// [start_time(), end_time()] are evaluated at the nearest end.
+///
+/// Changing the PiecewisePolynomial after construction does not change this
+/// copy.
+class PiecewisePolynomialEvaluator {
+ public:
+  /// Packs the coefficients of @p pp.
+  /// @throws std::runtime_error if any entry of @p pp is not univariate.
+  explicit PiecewisePolynomialEvaluator(const PiecewisePolynomial<double>& pp);
+
+  PiecewisePolynomialEvaluator(const PiecewisePolynomialEvaluator& other);
+  PiecewisePolynomialEvaluator& operator=(
+      const PiecewisePolynomialEvaluator& other);
+
+  Eigen::Index rows() const { return rows_; }
+
+  Eigen::Index cols() const { return cols_; }
+
+  int get_number_of_segments() const {
+    return static_cast<int>(breaks_.size()) - 1;
+  }
+
+  double start_time() const { return breaks_.front(); }
+
+  double end_time() const { return breaks_.back(); }
+
+  /// Returns the highest degree among all entries of all segments.
+  int degree() const { return degree_; }
+
+  /// Returns the same segment index as PiecewiseTrajectory::get_segment_index.
+  int get_segment_index(double t) const;
+
+  /// Returns the value of the @p derivative_order'th time derivative at time
+  /// @p t. The 0'th derivative is the value itself.
+  MatrixX<double> value(double t, int derivative_order = 0) const;
+
+  /// Writes the value of the @p derivative_order'th time derivative at time
+  /// @p t to @p value, which must be rows() * cols() long, in column-major
+  /// order. This does not allocate memory.
+  void EvalInto(double t, int derivative_order,
+                Eigen::Ref<VectorX<double>> value) const;
+
+  /// Evaluates the @p derivative_order'th time derivative at each of the
+  /// @p times. Column i of the result is the value at `times(i)`, flattened
+  /// in column-major order, i.e., it has rows() * cols() rows.
+  MatrixX<double> value(const Eigen::Ref<const Eigen::VectorXd>& times,
+                        int derivative_order = 0) const;
+
+ private:
+  // Returns the coefficient of power @p power of the entries of segment
+  // @p segment_index.
+  const double* coefficients(int segment_index, int power) const {
+    return coefficients_.data() +
+           (segment_index * (degree_ + 1) + power) * rows_ * cols_;
+  }
+
+  Eigen::Index rows_{};
+  Eigen::Index cols_{};
+  int degree_{};
+  std::vector<double> breaks_;
+  std::vector<double> coefficients_;
+  mutable std::atomic<int> segment_hint_{0};
+};
+
+}  // namespace trajectories
+}  // namespace drake
@@ -0,0 +1,117 @@
+#include "drake/common/trajectories/piecewise_quaternion_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace trajectories {
+
+PiecewiseQuaternionEvaluator::PiecewiseQuaternionEvaluator(
+    const PiecewiseQuaternionSlerp<double>& slerp)
+    : breaks_(slerp.get_segment_times()) {
+  DRAKE_THROW_UNLESS(slerp.get_number_of_segments() > 0);
+  const std::vector<Eigen::Quaterniond>& knots =
+      slerp.get_quaternion_knots();
+  const int num_segments = slerp.get_number_of_segments();
+  segments_.resize(num_segments);
+  angular_velocities_.resize(num_segments);
+  for (int i = 0; i < num_segments; ++i) {
+    Segment& segment = segments_[i];
+    segment.q0 = knots[i].coeffs();
+    segment.q1 = knots[i + 1].coeffs();
+    // The knots are the closest to each other, so their dot product is not
+    // negative. This is the same threshold as Eigen's slerp().
+    const double dot = std::abs(segment.q0.dot(segment.q1));
+    if (dot < 1 - std::numeric_limits<double>::epsilon()) {
+      segment.angle = std::acos(dot);
+      segment.inverse_sin_angle = 1 / std::sin(segment.angle);
+    }
+    angular_velocities_[i] = slerp.angular_velocity(breaks_[i]);
+  }
+}
+
+PiecewiseQuaternionEvaluator::PiecewiseQuaternionEvaluator(
+    const PiecewiseQuaternionEvaluator& other)
+    : breaks_(other.breaks_),
+      segments_(other.segments_),
+      angular_velocities_(other.angular_velocities_),
+      segment_hint_(other.segment_hint_.load(std::memory_order_relaxed)) {}
+
+PiecewiseQuaternionEvaluator& PiecewiseQuaternionEvaluator::operator=(
+    const PiecewiseQuaternionEvaluator& other) {
+  breaks_ = other.breaks_;
+  segments_ = other.segments_;
+  angular_velocities_ = other.angular_velocities_;
+  segment_hint_.store(other.segment_hint_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  return *this;
+}
+
+int PiecewiseQuaternionEvaluator::get_segment_index(double t) const {
+  const int num_segments = get_number_of_segments();
+  t = std::min(std::max(t, start_time()), end_time());
+  // Segment i holds [breaks_[i], breaks_[i + 1]), except for the last one,
+  // which also holds the end time.
+  auto holds = [&](int i) {
+    return i >= 0 && i < num_segments && breaks_[i] <= t &&
+           (t < breaks_[i + 1] || i == num_segments - 1);
+  };
+  int index = segment_hint_.load(std::memory_order_relaxed);
+  if (!holds(index)) {
+    if (holds(index + 1)) {
+      ++index;
+    } else {
+      // The last break that is not after t, among the starts of segments.
+      index = static_cast<int>(std::upper_bound(breaks_.begin(),
+                                                breaks_.end() - 1, t) -
+                               breaks_.begin()) - 1;
+      index = std::max(index, 0);
+    }
+    segment_hint_.store(index, std::memory_order_relaxed);
+  }
+  return index;
+}
+
+Eigen::Quaterniond PiecewiseQuaternionEvaluator::orientation(double t) const {
+  const int segment_index = get_segment_index(t);
+  const Segment& segment = segments_[segment_index];
+  const double start = breaks_[segment_index];
+  const double s = std::min(
+      std::max((t - start) / (breaks_[segment_index + 1] - start), 0.0), 1.0);
+
+  double scale0 = 1 - s;
+  double scale1 = s;
+  if (segment.angle != 0) {
+    scale0 = std::sin((1 - s) * segment.angle) * segment.inverse_sin_angle;
+    scale1 = std::sin(s * segment.angle) * segment.inverse_sin_angle;
+  }
+  Eigen::Quaterniond result;
+  result.coeffs() = scale0 * segment.q0 + scale1 * segment.q1;
+  result.normalize();
+  return result;
+}
+
+Eigen::Matrix4Xd PiecewiseQuaternionEvaluator::orientations(
+    const Eigen::Ref<const Eigen::VectorXd>& times) const {
+  Eigen::Matrix4Xd result(4, times.size());
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    const Eigen::Quaterniond q = orientation(times(i));
+    result.col(i) << q.w(), q.x(), q.y(), q.z();
+  }
+  return result;
+}
+
+Eigen::Matrix3Xd PiecewiseQuaternionEvaluator::angular_velocities(
+    const Eigen::Ref<const Eigen::VectorXd>& times) const {
+  Eigen::Matrix3Xd result(3, times.size());
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    result.col(i) = angular_velocity(times(i));
+  }
+  return result;
+}
+
+}  // namespace trajectories
+}  // namespace drake
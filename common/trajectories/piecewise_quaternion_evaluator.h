@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/eigen_stl_types.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/trajectories/piecewise_quaternion.h"
+
+namespace drake {
+namespace trajectories {
+
+/// A read-only copy of a PiecewiseQuaternionSlerp<double> that is prepared
+/// for fast evaluation of the orientation and angular velocity.
+///
+/// PiecewiseQuaternionSlerp::orientation() finds the segment with a binary
+/// search and recomputes the angle between the segment's knots on every
+/// query. This class stores, for each segment, the knots and the angle and
+/// the reciprocal of its sine, so that the slerp only needs two sines, and
+/// returns fixed-size results.
+///
+/// The segment containing the queried time is looked up from the segment
+/// found by the previous query first, and then from the one after it, before
+/// falling back to a binary search. Queries at increasing times, such as those
+/// of a simulation or a control loop, therefore find their segment in
+/// constant time. The hint is only an optimization: the results do not depend
+/// on it, and concurrent queries from several threads are safe.
+///
+/// Like PiecewiseQuaternionSlerp, queries outside of
+/// [start_time(), end_time()] are evaluated at the nearest end.
+class PiecewiseQuaternionEvaluator {
+ public:
+  /// Copies the knots of @p slerp and precomputes its segments.
+  /// @throws std::runtime_error if @p slerp is empty.
+  explicit PiecewiseQuaternionEvaluator(
+      const PiecewiseQuaternionSlerp<double>& slerp);
+
+  PiecewiseQuaternionEvaluator(const PiecewiseQuaternionEvaluator& other);
+  PiecewiseQuaternionEvaluator& operator=(
+      const PiecewiseQuaternionEvaluator& other);
+
+  int get_number_of_segments() const {
+    return static_cast<int>(breaks_.size()) - 1;
+  }
+
+  double start_time() const { return breaks_.front(); }
+
+  double end_time() const { return breaks_.back(); }
+
+  /// Returns the same segment index as PiecewiseTrajectory::get_segment_index.
+  int get_segment_index(double t) const;
+
+  /// Returns the same orientation as PiecewiseQuaternionSlerp::orientation(),
+  /// up to rounding.
+  Eigen::Quaterniond orientation(double t) const;
+
+  /// Returns the same angular velocity as
+  /// PiecewiseQuaternionSlerp::angular_velocity().
+  Eigen::Vector3d angular_velocity(double t) const {
+    return angular_velocities_[get_segment_index(t)];
+  }
+
+  /// Evaluates the orientation at each of the @p times. Column i of the result
+  /// is the quaternion at `times(i)`, in (w, x, y, z) order.
+  Eigen::Matrix4Xd orientations(
+      const Eigen::Ref<const Eigen::VectorXd>& times) const;
+
+  /// Evaluates the angular velocity at each of the @p times. Column i of the
+  /// result is the angular velocity at `times(i)`.
+  Eigen::Matrix3Xd angular_velocities(
+      const Eigen::Ref<const Eigen::VectorXd>& times) const;
+
+ private:
+  // The precomputed terms of the slerp over one segment.
+  struct Segment {
+    Eigen::Vector4d q0;
+    Eigen::Vector4d q1;
+    // The angle between q0 and q1 as 4-vectors, and 1 / sin(angle). If q0 and
+    // q1 are too close for the sine to be accurate, angle is zero and the
+    // segment is interpolated linearly.
+    double angle{};
+    double inverse_sin_angle{};
+  };
+
+  std::vector<double> breaks_;
+  eigen_aligned_std_vector<Segment> segments_;
+  std::vector<Eigen::Vector3d> angular_velocities_;
+  mutable std::atomic<int> segment_hint_{0};
+};
+
+}  // namespace trajectories
+}  // namespace drake
@@ -2,10 +2,13 @@
 
 #include <cmath>
 #include <random>
+#include <vector>
 
 #include <Eigen/Core>
 #include <gtest/gtest.h>
+#include <unsupported/Eigen/MatrixFunctions>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/trajectories/test/random_piecewise_polynomial.h"
 
 using std::default_random_engine;
@@ -54,6 +57,50 @@ GTEST_TEST(testExponentialPlusPiecewisePolynomial, BasicTest) {
   testSimpleCase<double>();
 }
 
+// Checks value() and vector_values() against the matrix exponential, for a
+// diagonalizable A such as the ZMP planner's, and for a defective one.
+GTEST_TEST(testExponentialPlusPiecewisePolynomial, MatrixExponential) {
+  const double kOmega2 = 9.81 / 1.;
+  Eigen::Matrix4d A_zmp = Eigen::Matrix4d::Zero();
+  A_zmp.topRightCorner<2, 2>().setIdentity();
+  A_zmp.bottomLeftCorner<2, 2>() = kOmega2 * Eigen::Matrix2d::Identity();
+  Eigen::Matrix4d A_defective = Eigen::Matrix4d::Zero();
+  A_defective.topRightCorner<2, 2>().setIdentity();
+
+  const int kNumSegments = 3;
+  default_random_engine generator;
+  const auto segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(kNumSegments, generator);
+  const auto polynomial_part = test::MakeRandomPiecewisePolynomial<double>(
+      2, 1, 4, segment_times);
+  const Eigen::MatrixXd K = Eigen::MatrixXd::Random(2, 4);
+  const Eigen::MatrixXd alpha = Eigen::MatrixXd::Random(4, kNumSegments);
+
+  for (const Eigen::Matrix4d& A : {A_zmp, A_defective}) {
+    const ExponentialPlusPiecewisePolynomial<double> dut(K, A, alpha,
+                                                         polynomial_part);
+    uniform_real_distribution<double> uniform(dut.start_time(),
+                                              dut.end_time());
+    std::vector<double> times;
+    for (int i = 0; i < 10; ++i) {
+      times.push_back(uniform(generator));
+    }
+    const Eigen::MatrixXd values = dut.vector_values(times);
+    ASSERT_EQ(values.rows(), 2);
+    ASSERT_EQ(values.cols(), static_cast<int>(times.size()));
+    for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+      const double t = times[i];
+      const int j = dut.get_segment_index(t);
+      const Eigen::Matrix4d exponential =
+          (A * (t - dut.start_time(j))).exp();
+      const Eigen::VectorXd expected =
+          K * exponential * alpha.col(j) + polynomial_part.value(t);
+      EXPECT_TRUE(CompareMatrices(dut.value(t), expected, 1e-9));
+      EXPECT_TRUE(CompareMatrices(values.col(i), expected, 1e-9));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace trajectories
 }  // namespace drake
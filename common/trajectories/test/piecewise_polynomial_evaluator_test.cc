@@ -0,0 +1,130 @@
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/trajectories/test/random_piecewise_polynomial.h"
+
+namespace drake {
+namespace trajectories {
+namespace {
+
+const double kTolerance = 1e-10;
+
+class PiecewisePolynomialEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::vector<double> breaks = {0, 0.5, 1.25, 2, 3.5};
+    pp_ = test::MakeRandomPiecewisePolynomial<double>(3, 2, 5, breaks);
+  }
+
+  // Returns a set of times that covers each break, the inside of each segment
+  // and the outside of the trajectory.
+  std::vector<double> MakeTimes() const {
+    std::vector<double> times = {-1, 5};
+    std::default_random_engine generator(123);
+    std::uniform_real_distribution<double> uniform(pp_.start_time(),
+                                                   pp_.end_time());
+    for (double t : pp_.get_segment_times()) {
+      times.push_back(t);
+    }
+    for (int i = 0; i < 20; ++i) {
+      times.push_back(uniform(generator));
+    }
+    return times;
+  }
+
+  PiecewisePolynomial<double> pp_;
+};
+
+TEST_F(PiecewisePolynomialEvaluatorTest, Properties) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  EXPECT_EQ(evaluator.rows(), pp_.rows());
+  EXPECT_EQ(evaluator.cols(), pp_.cols());
+  EXPECT_EQ(evaluator.get_number_of_segments(),
+            pp_.get_number_of_segments());
+  EXPECT_EQ(evaluator.start_time(), pp_.start_time());
+  EXPECT_EQ(evaluator.end_time(), pp_.end_time());
+  EXPECT_EQ(evaluator.degree(), 4);
+}
+
+// The results match those of the PiecewisePolynomial, whatever the order of
+// the queries.
+TEST_F(PiecewisePolynomialEvaluatorTest, MatchesPiecewisePolynomial) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  const std::vector<PiecewisePolynomial<double>> derivatives = {
+      pp_, pp_.derivative(1), pp_.derivative(2), pp_.derivative(5)};
+  const std::vector<int> orders = {0, 1, 2, 5};
+  for (double t : MakeTimes()) {
+    EXPECT_EQ(evaluator.get_segment_index(t), pp_.get_segment_index(t));
+    for (int i = 0; i < static_cast<int>(orders.size()); ++i) {
+      EXPECT_TRUE(CompareMatrices(evaluator.value(t, orders[i]),
+                                  derivatives[i].value(t), kTolerance));
+    }
+  }
+}
+
+// Increasing times, which use the segment hint, give the same results.
+TEST_F(PiecewisePolynomialEvaluatorTest, IncreasingTimes) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  for (double t = -0.1; t <= 3.6; t += 0.01) {
+    EXPECT_EQ(evaluator.get_segment_index(t), pp_.get_segment_index(t));
+    EXPECT_TRUE(CompareMatrices(evaluator.value(t), pp_.value(t),
+                                kTolerance));
+  }
+}
+
+TEST_F(PiecewisePolynomialEvaluatorTest, EvalInto) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  const PiecewisePolynomial<double> derivative = pp_.derivative(1);
+  VectorX<double> value(pp_.rows() * pp_.cols());
+  for (double t : MakeTimes()) {
+    evaluator.EvalInto(t, 1, value);
+    const MatrixX<double> expected = derivative.value(t);
+    EXPECT_TRUE(CompareMatrices(
+        value, Eigen::Map<const VectorX<double>>(expected.data(),
+                                                 expected.size()),
+        kTolerance));
+  }
+  VectorX<double> wrong_size(1);
+  EXPECT_THROW(evaluator.EvalInto(0, 0, wrong_size), std::exception);
+  EXPECT_THROW(evaluator.EvalInto(0, -1, value), std::exception);
+}
+
+TEST_F(PiecewisePolynomialEvaluatorTest, Batch) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  const std::vector<double> times = MakeTimes();
+  const Eigen::Map<const Eigen::VectorXd> times_vector(times.data(),
+                                                       times.size());
+  const MatrixX<double> values = evaluator.value(times_vector, 2);
+  ASSERT_EQ(values.rows(), pp_.rows() * pp_.cols());
+  ASSERT_EQ(values.cols(), static_cast<int>(times.size()));
+  const PiecewisePolynomial<double> derivative = pp_.derivative(2);
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    const MatrixX<double> expected = derivative.value(times[i]);
+    EXPECT_TRUE(CompareMatrices(
+        values.col(i), Eigen::Map<const VectorX<double>>(expected.data(),
+                                                         expected.size()),
+        kTolerance));
+  }
+}
+
+// The evaluator is a copy: it does not follow later changes to the
+// PiecewisePolynomial, and can be copied itself.
+TEST_F(PiecewisePolynomialEvaluatorTest, Copy) {
+  const PiecewisePolynomialEvaluator evaluator(pp_);
+  const MatrixX<double> expected = pp_.value(1);
+  pp_.shiftRight(0.25);
+  const PiecewisePolynomialEvaluator copy(evaluator);
+  EXPECT_TRUE(CompareMatrices(copy.value(1), expected, kTolerance));
+  PiecewisePolynomialEvaluator assigned(pp_);
+  assigned = evaluator;
+  EXPECT_TRUE(CompareMatrices(assigned.value(1), expected, kTolerance));
+}
+
+}  // namespace
+}  // namespace trajectories
+}  // namespace drake
@@ -157,6 +157,30 @@ void testValueOutsideOfRange() {
                               1e-10, MatrixCompareType::absolute));
 }
 
+// EvalInto() gives the same values as value(), including into the block of a
+// larger matrix, and through the Trajectory interface.
+GTEST_TEST(testPiecewisePolynomial, EvalInto) {
+  default_random_engine generator;
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(4, generator);
+  const PiecewisePolynomial<double> piecewise =
+      test::MakeRandomPiecewisePolynomial<double>(2, 3, 4, segment_times);
+  const Trajectory<double>& trajectory = piecewise;
+
+  Eigen::MatrixXd larger = Eigen::MatrixXd::Zero(4, 5);
+  for (double t : {piecewise.start_time() - 1, piecewise.start_time(),
+                   0.5 * (piecewise.start_time() + piecewise.end_time()),
+                   piecewise.end_time(), piecewise.end_time() + 1}) {
+    trajectory.EvalInto(t, larger.block(1, 2, 2, 3));
+    EXPECT_TRUE(CompareMatrices(larger.block(1, 2, 2, 3), piecewise.value(t),
+                                0));
+  }
+  EXPECT_TRUE(CompareMatrices(larger.leftCols(2), Eigen::MatrixXd::Zero(4, 2)));
+
+  Eigen::MatrixXd wrong_size(3, 3);
+  EXPECT_THROW(piecewise.EvalInto(0, wrong_size), std::exception);
+}
+
 GTEST_TEST(testPiecewisePolynomial, AllTests
 ) {
 testIntegralAndDerivative<double>();
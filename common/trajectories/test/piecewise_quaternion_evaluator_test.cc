@@ -0,0 +1,116 @@
+#include "drake/common/trajectories/piecewise_quaternion_evaluator.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace trajectories {
+namespace {
+
+const double kTolerance = 1e-12;
+
+class PiecewiseQuaternionEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::vector<double> breaks = {0, 0.5, 1.25, 2, 3.5};
+    std::vector<AngleAxis<double>> knots = {
+        AngleAxis<double>(0.1, Vector3<double>::UnitX()),
+        AngleAxis<double>(1.2, Vector3<double>(1, 2, 3).normalized()),
+        AngleAxis<double>(-2.5, Vector3<double>::UnitZ()),
+        // Same as the previous knot, so that the segment has no rotation.
+        AngleAxis<double>(-2.5, Vector3<double>::UnitZ()),
+        AngleAxis<double>(3, Vector3<double>(-1, 0, 1).normalized())};
+    slerp_ = PiecewiseQuaternionSlerp<double>(breaks, knots);
+  }
+
+  // Returns a set of times that covers each break, the inside of each segment
+  // and the outside of the trajectory.
+  std::vector<double> MakeTimes() const {
+    std::vector<double> times = {-1, 5};
+    std::default_random_engine generator(123);
+    std::uniform_real_distribution<double> uniform(slerp_.start_time(),
+                                                   slerp_.end_time());
+    for (double t : slerp_.get_segment_times()) {
+      times.push_back(t);
+    }
+    for (int i = 0; i < 20; ++i) {
+      times.push_back(uniform(generator));
+    }
+    return times;
+  }
+
+  PiecewiseQuaternionSlerp<double> slerp_;
+};
+
+// The results match those of the PiecewiseQuaternionSlerp, whatever the order
+// of the queries.
+TEST_F(PiecewiseQuaternionEvaluatorTest, MatchesSlerp) {
+  const PiecewiseQuaternionEvaluator evaluator(slerp_);
+  EXPECT_EQ(evaluator.get_number_of_segments(),
+            slerp_.get_number_of_segments());
+  EXPECT_EQ(evaluator.start_time(), slerp_.start_time());
+  EXPECT_EQ(evaluator.end_time(), slerp_.end_time());
+  for (double t : MakeTimes()) {
+    EXPECT_EQ(evaluator.get_segment_index(t), slerp_.get_segment_index(t));
+    EXPECT_TRUE(CompareMatrices(evaluator.orientation(t).coeffs(),
+                                slerp_.orientation(t).coeffs(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(evaluator.angular_velocity(t),
+                                slerp_.angular_velocity(t), kTolerance));
+  }
+}
+
+// Increasing times, which use the segment hint, give the same results.
+TEST_F(PiecewiseQuaternionEvaluatorTest, IncreasingTimes) {
+  const PiecewiseQuaternionEvaluator evaluator(slerp_);
+  for (double t = -0.1; t <= 3.6; t += 0.01) {
+    EXPECT_EQ(evaluator.get_segment_index(t), slerp_.get_segment_index(t));
+    EXPECT_TRUE(CompareMatrices(evaluator.orientation(t).coeffs(),
+                                slerp_.orientation(t).coeffs(), kTolerance));
+  }
+}
+
+TEST_F(PiecewiseQuaternionEvaluatorTest, Batch) {
+  const PiecewiseQuaternionEvaluator evaluator(slerp_);
+  const std::vector<double> times = MakeTimes();
+  const Eigen::Map<const Eigen::VectorXd> times_vector(times.data(),
+                                                       times.size());
+  const Eigen::Matrix4Xd orientations = evaluator.orientations(times_vector);
+  const Eigen::Matrix3Xd angular_velocities =
+      evaluator.angular_velocities(times_vector);
+  ASSERT_EQ(orientations.cols(), static_cast<int>(times.size()));
+  ASSERT_EQ(angular_velocities.cols(), static_cast<int>(times.size()));
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    const Quaternion<double> expected = slerp_.orientation(times[i]);
+    EXPECT_TRUE(CompareMatrices(
+        orientations.col(i),
+        Eigen::Vector4d(expected.w(), expected.x(), expected.y(), expected.z()),
+        kTolerance));
+    EXPECT_TRUE(CompareMatrices(angular_velocities.col(i),
+                                slerp_.angular_velocity(times[i]),
+                                kTolerance));
+  }
+}
+
+TEST_F(PiecewiseQuaternionEvaluatorTest, Copy) {
+  const PiecewiseQuaternionEvaluator evaluator(slerp_);
+  const PiecewiseQuaternionEvaluator copy(evaluator);
+  EXPECT_TRUE(CompareMatrices(copy.orientation(1).coeffs(),
+                              slerp_.orientation(1).coeffs(), kTolerance));
+  PiecewiseQuaternionEvaluator assigned(PiecewiseQuaternionSlerp<double>(
+      {0, 1}, std::vector<Quaternion<double>>(2, Quaternion<double>(1, 0, 0,
+                                                                    0))));
+  assigned = evaluator;
+  EXPECT_TRUE(CompareMatrices(assigned.orientation(1).coeffs(),
+                              slerp_.orientation(1).coeffs(), kTolerance));
+
+  EXPECT_THROW(PiecewiseQuaternionEvaluator(PiecewiseQuaternionSlerp<double>()),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace trajectories
+}  // namespace drake
@@ -5,6 +5,7 @@
 #include <Eigen/Core>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
 
 namespace drake {
@@ -33,6 +34,19 @@ class Trajectory {
    */
   virtual MatrixX<T> value(double t) const = 0;
 
+  /**
+   * Evaluates the trajectory at the given time \p t into \p value, which
+   * must already have rows() rows and cols() columns. Subclasses override
+   * this to avoid the allocation of the result of value(); the default
+   * implementation copies the result of value().
+   * @param t The time at which to evaluate the trajectory.
+   * @param value The matrix of evaluated values.
+   */
+  virtual void EvalInto(double t, Eigen::Ref<MatrixX<T>> value) const {
+    DRAKE_THROW_UNLESS(value.rows() == rows() && value.cols() == cols());
+    value = this->value(t);
+  }
+
   /**
    * Takes the derivative of this Trajectory.
    * @param derivative_order The number of times to take the derivative before
@@ -41,17 +41,18 @@ void HumanoidManipulationPlan<T>::InitializeGenericPlanDerived(
   // Makes a zmp planner that stays still.
   zmp_planner_.Plan(zmp_d, xcom, zmp_height_);
 
+  ResolveBodyGroups(alias_groups);
+
   // Assumes double support with both feet.
   ContactState double_support;
-  double_support.insert(alias_groups.get_body("left_foot"));
-  double_support.insert(alias_groups.get_body("right_foot"));
+  double_support.insert(alias_groups.get_body(left_foot_group_));
+  double_support.insert(alias_groups.get_body(right_foot_group_));
   this->UpdateContactState(double_support);
 
   // Sets body tracking trajectories for pelvis and torso.
-  const std::vector<std::string> tracked_body_names = {"pelvis", "torso"};
   MatrixX<T> position;
-  for (const auto& name : tracked_body_names) {
-    const RigidBody<T>* body = alias_groups.get_body(name);
+  for (const int group : {pelvis_group_, torso_group_}) {
+    const RigidBody<T>* body = alias_groups.get_body(group);
     Isometry3<T> body_pose = robot_status.get_robot().CalcBodyPoseInWorldFrame(
         robot_status.get_cache(), *body);
     position = body_pose.translation();
@@ -122,8 +123,10 @@ void HumanoidManipulationPlan<T>::HandlePlanGenericPlanDerived(
   std::vector<T> times(1, time_now);
   std::vector<MatrixX<T>> dof_knots(1, q);
   std::unordered_map<const RigidBody<T>*, std::vector<Isometry3<T>>> body_knots;
+  ResolveBodyGroups(alias_groups);
   std::vector<const RigidBody<T>*> tracked_bodies = {
-      alias_groups.get_body("pelvis"), alias_groups.get_body("torso")};
+      alias_groups.get_body(pelvis_group_),
+      alias_groups.get_body(torso_group_)};
   for (const RigidBody<T>* body : tracked_bodies) {
     body_knots[body] = std::vector<Isometry3<T>>(
         1, this->get_body_trajectory(body).get_pose(time_now));
@@ -215,6 +218,16 @@ bool HumanoidManipulationPlan<T>::IsRigidBodyTreeCompatible(
 template <typename T>
 bool HumanoidManipulationPlan<T>::IsRigidBodyTreeAliasGroupsCompatible(
     const RigidBodyTreeAliasGroups<T>& alias_groups) const {
+  if (&alias_groups == resolved_alias_groups_) {
+    // The groups still exist, but members may have been added to them.
+    for (const int group :
+         {pelvis_group_, torso_group_, left_foot_group_, right_foot_group_}) {
+      if (alias_groups.get_body_group(group).size() != 1) {
+        return false;
+      }
+    }
+    return true;
+  }
   if (VerifyRigidBodyTreeAliasGroups(alias_groups, "pelvis") &&
       VerifyRigidBodyTreeAliasGroups(alias_groups, "torso") &&
       VerifyRigidBodyTreeAliasGroups(alias_groups, "left_foot") &&
@@ -225,6 +238,17 @@ bool HumanoidManipulationPlan<T>::IsRigidBodyTreeAliasGroupsCompatible(
   }
 }
 
+template <typename T>
+void HumanoidManipulationPlan<T>::ResolveBodyGroups(
+    const RigidBodyTreeAliasGroups<T>& alias_groups) {
+  if (&alias_groups == resolved_alias_groups_) return;
+  pelvis_group_ = alias_groups.get_body_group_index("pelvis");
+  torso_group_ = alias_groups.get_body_group_index("torso");
+  left_foot_group_ = alias_groups.get_body_group_index("left_foot");
+  right_foot_group_ = alias_groups.get_body_group_index("right_foot");
+  resolved_alias_groups_ = &alias_groups;
+}
+
 template class HumanoidManipulationPlan<double>;
 
 }  // namespace humanoid_controller
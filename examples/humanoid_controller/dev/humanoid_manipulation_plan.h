@@ -148,6 +148,10 @@ class HumanoidManipulationPlan
     }
   }
 
+  // Sets the body group handles below to those of @p alias_groups, unless
+  // they already are. @p alias_groups must be compatible.
+  void ResolveBodyGroups(const RigidBodyTreeAliasGroups<T>& alias_groups);
+
   systems::controllers::plan_eval::GenericPlan<T>* CloneGenericPlanDerived()
       const override {
     return new HumanoidManipulationPlan<T>(*this);
@@ -161,6 +165,16 @@ class HumanoidManipulationPlan
   systems::controllers::ZMPPlanner zmp_planner_;
   double zmp_height_{1.0};
   int64_t last_handle_plan_time_{-1};
+
+  // The alias groups given to the last call to Initialize() or HandlePlan(),
+  // and the handles of the body groups used by this plan in them. Checking
+  // and looking up these groups in the same alias groups, which happens on
+  // every control tick, uses the handles rather than the group names.
+  const RigidBodyTreeAliasGroups<T>* resolved_alias_groups_{nullptr};
+  int pelvis_group_{-1};
+  int torso_group_{-1};
+  int left_foot_group_{-1};
+  int right_foot_group_{-1};
 };
 
 }  // namespace humanoid_controller
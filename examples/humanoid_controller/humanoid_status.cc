@@ -93,7 +93,7 @@ void HumanoidStatus::Update(
 
   // body parts
   for (auto& body_of_interest_pair : bodies_of_interest_)
-    body_of_interest_pair.second.Update(get_robot(), get_cache());
+    body_of_interest_pair.second.Update(*this);
 
   // Computes CoP only when we have foot sensors.
   if (bodies_of_interest_.find("left_foot_sensor") !=
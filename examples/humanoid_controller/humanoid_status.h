@@ -34,13 +34,24 @@ class BodyOfInterest {
       : name_(name), body_(&body), offset_(Eigen::Translation3d(off)) {}
 
   /**
-   * Updates pose, velocity, Jacobian, Jacobian_dot_times_v based on @p robot
-   * and @p cache.
-   * @param robot is the robot model.
-   * @param cache is the kinematics cache. It needs to be initialized first
+   * Updates pose, velocity, Jacobian, Jacobian_dot_times_v based on
+   * @p robot_status. If this object is at the origin of its body, these are
+   * taken from (and shared with the other users of) @p robot_status's per
+   * body kinematics.
+   * @param robot_status holds the robot model and its kinematics cache,
+   * which needs to be updated first.
    */
-  void Update(const RigidBodyTree<double>& robot,
-              const KinematicsCache<double>& cache) {
+  void Update(const systems::controllers::qp_inverse_dynamics::
+                  RobotKinematicState<double>& robot_status) {
+    if (offset_.translation().isZero(0)) {
+      pose_ = robot_status.get_body_pose(*body_);
+      vel_ = robot_status.get_body_velocity(*body_);
+      J_ = robot_status.get_body_J(*body_);
+      Jdot_times_v_ = robot_status.get_body_Jdot_times_v(*body_);
+      return;
+    }
+    const RigidBodyTree<double>& robot = robot_status.get_robot();
+    const KinematicsCache<double>& cache = robot_status.get_cache();
     pose_ = robot.CalcFramePoseInWorldFrame(cache, *body_, offset_);
     vel_ = robot.CalcFrameSpatialVelocityInWorldFrame(cache, *body_, offset_);
     J_ = robot.CalcFrameSpatialVelocityJacobianInWorldFrame(cache, *body_,
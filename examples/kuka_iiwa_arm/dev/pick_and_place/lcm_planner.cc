@@ -1,5 +1,7 @@
 #include "drake/examples/kuka_iiwa_arm/dev/pick_and_place/lcm_planner.h"
 
+#include <vector>
+
 #include "optitrack/optitrack_frame_t.hpp"
 
 #include "drake/manipulation/perception/optitrack_pose_extractor.h"
@@ -55,68 +57,61 @@ LcmPlanner::LcmPlanner(
   input_port_wsg_status_ =
       builder.ExportInput(state_machine_->get_input_port_wsg_status());
 
-  // The Optitrack message needs to be passed to multiple OptitrackPoseExtractor
-  // blocks, this pass-through block allows that.
+  const Isometry3<double>& X_WO{Isometry3<double>::Identity()};
+  const double kOptitrackLcmStatusPeriod{1.0 / 120.0};
+
+  // A single extractor scans each Optitrack message for the target, the
+  // tables and the IIWA base, in that order.
+  const int num_tables =
+      static_cast<int>(optitrack_configuration.table_optitrack_info.size());
+  std::vector<int> object_ids;
+  object_ids.push_back(
+      optitrack_configuration
+          .object_optitrack_info[planner_configuration.target_index]
+          .id);
+  for (int i = 0; i < num_tables; ++i) {
+    object_ids.push_back(optitrack_configuration.table_optitrack_info[i].id);
+  }
+  object_ids.push_back(
+      optitrack_configuration
+          .robot_base_optitrack_info[planner_configuration.robot_index]
+          .id);
+  auto optitrack_pose_extractor = builder.AddSystem<OptitrackPoseExtractor>(
+      object_ids, X_WO, kOptitrackLcmStatusPeriod);
+  optitrack_pose_extractor->set_name("Optitrack pose extractor");
+
+  // This pass-through block provides the model value of the Optitrack message
+  // input port.
   auto optitrack_message_passthrough = builder.AddSystem<PassThrough<double>>(
       Value<optitrack::optitrack_frame_t>());
 
   // Export input port for the Optitrack message.
   input_port_optitrack_message_ =
       builder.ExportInput(optitrack_message_passthrough->get_input_port());
-
-  const Isometry3<double>& X_WO{Isometry3<double>::Identity()};
-  const double kOptitrackLcmStatusPeriod{1.0 / 120.0};
+  builder.Connect(optitrack_message_passthrough->get_output_port(),
+                  optitrack_pose_extractor->get_input_port(0));
 
   // Connect blocks for target.
-  auto optitrack_target_pose_extractor =
-      builder.AddSystem<OptitrackPoseExtractor>(
-          optitrack_configuration
-              .object_optitrack_info[planner_configuration.target_index]
-              .id,
-          X_WO, kOptitrackLcmStatusPeriod);
-  optitrack_target_pose_extractor->set_name("Optitrack target pose extractor");
-
   auto optitrack_target_translator =
       builder.AddSystem<OptitrackTranslatorSystem>();
   optitrack_target_translator->set_name("Optitrack target translator");
 
-  builder.Connect(optitrack_message_passthrough->get_output_port(),
-                  optitrack_target_pose_extractor->get_input_port(0));
-  builder.Connect(optitrack_target_pose_extractor->get_output_port(0),
+  builder.Connect(optitrack_pose_extractor->get_measured_pose_output_port(0),
                   optitrack_target_translator->get_input_port(0));
   builder.Connect(optitrack_target_translator->get_output_port(0),
                   state_machine_->get_input_port_box_state());
 
   // Connect Optitrack blocks for tables.
-  for (int i = 0; i < static_cast<int>(
-                          optitrack_configuration.table_optitrack_info.size());
-       ++i) {
-    auto optitrack_table_pose_extractor =
-        builder.AddSystem<manipulation::perception::OptitrackPoseExtractor>(
-            optitrack_configuration.table_optitrack_info[i].id, X_WO,
-            kOptitrackLcmStatusPeriod);
-    optitrack_table_pose_extractor->set_name(
-        "Optitrack table " + std::to_string(i) + "  pose extractor");
-    builder.Connect(optitrack_message_passthrough->get_output_port(),
-                    optitrack_table_pose_extractor->get_input_port(0));
-    builder.Connect(optitrack_table_pose_extractor->get_output_port(0),
-                    state_machine_->get_input_port_table_state(i));
+  for (int i = 0; i < num_tables; ++i) {
+    builder.Connect(
+        optitrack_pose_extractor->get_measured_pose_output_port(1 + i),
+        state_machine_->get_input_port_table_state(i));
   }
 
   // Connect Optitrack blocks for IIWA base.
-  auto optitrack_iiwa_base_pose_extractor =
-      builder.AddSystem<OptitrackPoseExtractor>(
-          optitrack_configuration
-              .robot_base_optitrack_info[planner_configuration.robot_index]
-              .id,
-          X_WO, kOptitrackLcmStatusPeriod);
-  optitrack_iiwa_base_pose_extractor->set_name(
-      "Optitrack IIWA base pose extractor");
-
-  builder.Connect(optitrack_message_passthrough->get_output_port(),
-                  optitrack_iiwa_base_pose_extractor->get_input_port(0));
-  builder.Connect(optitrack_iiwa_base_pose_extractor->get_output_port(0),
-                  state_machine_->get_input_port_iiwa_base_pose());
+  builder.Connect(
+      optitrack_pose_extractor->get_measured_pose_output_port(1 + num_tables),
+      state_machine_->get_input_port_iiwa_base_pose());
 
   // Export input port for IIWA status message.
   input_port_iiwa_status_ =
@@ -10,14 +10,26 @@
 ///
 /// If a stop message is received, it will immediately discard the
 /// current plan and wait until a new plan is received.
+///
+/// Plans are decoded and interpolated on a background thread, which hands
+/// each finished plan over to the status loop without locking, so that a
+/// long plan does not make the runner miss iiwa status messages. Each
+/// command is computed from the current plan without allocating memory.
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "lcm/lcm-cpp.hpp"
 #include "robotlocomotion/robot_plan_t.hpp"
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/find_resource.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/examples/kuka_iiwa_arm/iiwa_common.h"
@@ -27,13 +39,6 @@
 #include "drake/multibody/parsers/urdf_parser.h"
 #include "drake/multibody/rigid_body_tree.h"
 
-using Eigen::MatrixXd;
-using Eigen::VectorXd;
-using Eigen::VectorXi;
-using drake::Vector1d;
-using Eigen::Vector2d;
-using Eigen::Vector3d;
-
 namespace drake {
 namespace examples {
 namespace kuka_iiwa_arm {
@@ -46,66 +51,123 @@ const char* const kLcmStopChannel = "STOP";
 const int kNumJoints = 7;
 
 using trajectories::PiecewisePolynomial;
-typedef PiecewisePolynomial<double> PPType;
-typedef PPType::PolynomialType PPPoly;
-typedef PPType::PolynomialMatrix PPMatrix;
 
-class RobotPlanRunner {
+// A piecewise cubic joint trajectory, stored as the coefficients of each
+// segment so that it can be evaluated without allocating memory. An empty
+// plan (without segments) stands for a stop command.
+class CubicPlan {
  public:
-  /// tree is aliased
-  explicit RobotPlanRunner(const RigidBodyTree<double>& tree)
-      : tree_(tree), plan_number_(0) {
-    VerifyIiwaTree(tree);
-    lcm_.subscribe(kLcmStatusChannel,
-                    &RobotPlanRunner::HandleStatus, this);
-    lcm_.subscribe(kLcmPlanChannel,
-                    &RobotPlanRunner::HandlePlan, this);
-    lcm_.subscribe(kLcmStopChannel,
-                    &RobotPlanRunner::HandleStop, this);
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CubicPlan)
+
+  // Column k of a segment holds the coefficients of (t - t_start)^k.
+  typedef Eigen::Matrix<double, kNumJoints, 4> Coefficients;
+
+  // Makes a stop command.
+  CubicPlan() = default;
+
+  explicit CubicPlan(const PiecewisePolynomial<double>& trajectory)
+      : breaks_(trajectory.get_segment_times()),
+        coefficients_(trajectory.get_number_of_segments(),
+                      Coefficients::Zero()) {
+    DRAKE_DEMAND(trajectory.rows() == kNumJoints);
+    DRAKE_DEMAND(trajectory.cols() == 1);
+    for (int i = 0; i < trajectory.get_number_of_segments(); ++i) {
+      for (int joint = 0; joint < kNumJoints; ++joint) {
+        const Eigen::VectorXd c =
+            trajectory.getPolynomial(i, joint).GetCoefficients();
+        DRAKE_DEMAND(c.size() <= 4);
+        coefficients_[i].row(joint).head(c.size()) = c.transpose();
+      }
+    }
   }
 
-  void Run() {
-    int cur_plan_number = plan_number_;
-    int64_t cur_time_us = -1;
-    int64_t start_time_us = -1;
+  bool empty() const { return coefficients_.empty(); }
 
-    // Initialize the timestamp to an invalid number so we can detect
-    // the first message.
-    iiwa_status_.utime = cur_time_us;
+  // Evaluates the plan at time @p t, clamped to the span of the plan, into
+  // @p q. @p segment caches the segment of the previous call; since time
+  // moves forward, finding the segment usually takes a single comparison.
+  void Eval(double t, int* segment, double* q) const {
+    DRAKE_ASSERT(!empty());
+    const int last = static_cast<int>(coefficients_.size()) - 1;
+    t = std::min(std::max(t, breaks_.front()), breaks_.back());
+    int i = std::min(std::max(*segment, 0), last);
+    while (i > 0 && t < breaks_[i]) --i;
+    while (i < last && t >= breaks_[i + 1]) ++i;
+    *segment = i;
+    const double s = t - breaks_[i];
+    const Coefficients& c = coefficients_[i];
+    for (int joint = 0; joint < kNumJoints; ++joint) {
+      q[joint] = ((c(joint, 3) * s + c(joint, 2)) * s + c(joint, 1)) * s +
+                 c(joint, 0);
+    }
+  }
 
-    lcmt_iiwa_command iiwa_command;
-    iiwa_command.num_joints = kNumJoints;
-    iiwa_command.joint_position.resize(kNumJoints, 0.);
-    iiwa_command.num_torques = 0;
-    iiwa_command.joint_torque.resize(kNumJoints, 0.);
+ private:
+  const std::vector<double> breaks_;
+  std::vector<Coefficients> coefficients_;
+};
 
-    while (true) {
-      // Call lcm handle until at least one status message is
-      // processed.
-      while (0 == lcm_.handleTimeout(10) || iiwa_status_.utime == -1) { }
+// Hands plans over from a single producer thread to a single consumer thread
+// without locking. Plans the consumer is done with are handed back, so that
+// they are destroyed by the producer rather than in the consumer's loop.
+class PlanMailbox {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PlanMailbox)
 
-      cur_time_us = iiwa_status_.utime;
+  PlanMailbox() = default;
 
-      if (plan_) {
-        if (plan_number_ != cur_plan_number) {
-          std::cout << "Starting new plan." << std::endl;
-          start_time_us = cur_time_us;
-          cur_plan_number = plan_number_;
-        }
+  ~PlanMailbox() {
+    delete pending_.load();
+    delete retired_.load();
+  }
 
-        const double cur_traj_time_s =
-            static_cast<double>(cur_time_us - start_time_us) / 1e6;
-        const auto desired_next = plan_->value(cur_traj_time_s);
+  // Producer: replaces any plan that was not taken yet with @p plan.
+  void Post(std::unique_ptr<CubicPlan> plan) {
+    std::unique_ptr<CubicPlan> unread(pending_.exchange(plan.release()));
+    std::unique_ptr<CubicPlan> retired(retired_.exchange(nullptr));
+  }
 
-        iiwa_command.utime = iiwa_status_.utime;
+  // Consumer: returns the latest posted plan, or nullptr if there is none.
+  const CubicPlan* Take() { return pending_.exchange(nullptr); }
 
-        for (int joint = 0; joint < kNumJoints; joint++) {
-          iiwa_command.joint_position[joint] = desired_next(joint);
-        }
+  // Consumer: gives back a plan returned by Take().
+  void Retire(const CubicPlan* plan) {
+    // Only if the producer has not collected the previous plan yet, which
+    // takes two plans in between two status messages, is one destroyed here.
+    delete retired_.exchange(const_cast<CubicPlan*>(plan));
+  }
 
-        lcm_.publish(kLcmCommandChannel, &iiwa_command);
+ private:
+  std::atomic<CubicPlan*> pending_{nullptr};
+  std::atomic<CubicPlan*> retired_{nullptr};
+};
+
+// Receives plans and stop commands on its own thread and LCM instance, and
+// posts the corresponding CubicPlan to a mailbox.
+class PlanReceiver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PlanReceiver)
+
+  /// mailbox is aliased
+  PlanReceiver(const RigidBodyTree<double>& tree, PlanMailbox* mailbox)
+      : name_to_idx_(tree.computePositionNameToIndexMap()),
+        mailbox_(mailbox) {
+    // Initialize the timestamp to an invalid number so we can detect
+    // the first message.
+    iiwa_status_.utime = -1;
+    lcm_.subscribe(kLcmStatusChannel, &PlanReceiver::HandleStatus, this);
+    lcm_.subscribe(kLcmPlanChannel, &PlanReceiver::HandlePlan, this);
+    lcm_.subscribe(kLcmStopChannel, &PlanReceiver::HandleStop, this);
+    thread_ = std::thread([this]() {
+      while (!stop_) {
+        lcm_.handleTimeout(100);
       }
-    }
+    });
+  }
+
+  ~PlanReceiver() {
+    stop_ = true;
+    thread_.join();
   }
 
  private:
@@ -128,24 +190,20 @@ class RobotPlanRunner {
 
     std::vector<Eigen::MatrixXd> knots(plan->num_states,
                                        Eigen::MatrixXd::Zero(kNumJoints, 1));
-    std::map<std::string, int> name_to_idx =
-        tree_.computePositionNameToIndexMap();
     for (int i = 0; i < plan->num_states; ++i) {
       const auto& state = plan->plan[i];
       for (int j = 0; j < state.num_joints; ++j) {
-        if (name_to_idx.count(state.joint_name[j]) == 0) {
+        const auto idx = name_to_idx_.find(state.joint_name[j]);
+        if (idx == name_to_idx_.end()) {
           continue;
         }
         // Treat the matrix at knots[i] as a column vector.
         if (i == 0) {
           // Always start moving from the position which we're
           // currently commanding.
-          DRAKE_DEMAND(iiwa_status_.utime != -1);
-          knots[0](name_to_idx[state.joint_name[j]], 0) =
-              iiwa_status_.joint_position_commanded[j];
+          knots[0](idx->second, 0) = iiwa_status_.joint_position_commanded[j];
         } else {
-          knots[i](name_to_idx[state.joint_name[j]], 0) =
-              state.joint_position[j];
+          knots[i](idx->second, 0) = state.joint_position[j];
         }
       }
     }
@@ -159,22 +217,95 @@ class RobotPlanRunner {
       input_time.push_back(plan->plan[k].utime / 1e6);
     }
     const Eigen::MatrixXd knot_dot = Eigen::MatrixXd::Zero(kNumJoints, 1);
-    plan_.reset(new PiecewisePolynomial<double>(
-        PiecewisePolynomial<double>::Cubic(input_time, knots,
-                                           knot_dot, knot_dot)));
-    ++plan_number_;
+    mailbox_->Post(std::make_unique<CubicPlan>(
+        PiecewisePolynomial<double>::Cubic(input_time, knots, knot_dot,
+                                           knot_dot)));
   }
 
   void HandleStop(const lcm::ReceiveBuffer*, const std::string&,
-                    const robotlocomotion::robot_plan_t*) {
+                  const robotlocomotion::robot_plan_t*) {
     std::cout << "Received stop command. Discarding plan." << std::endl;
-    plan_.reset();
+    mailbox_->Post(std::make_unique<CubicPlan>());
+  }
+
+  lcm::LCM lcm_;
+  const std::map<std::string, int> name_to_idx_;
+  PlanMailbox* const mailbox_;
+  lcmt_iiwa_status iiwa_status_;
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+};
+
+class RobotPlanRunner {
+ public:
+  /// tree is aliased
+  explicit RobotPlanRunner(const RigidBodyTree<double>& tree)
+      : plan_receiver_(tree, &mailbox_) {
+    VerifyIiwaTree(tree);
+    lcm_.subscribe(kLcmStatusChannel,
+                    &RobotPlanRunner::HandleStatus, this);
+  }
+
+  void Run() {
+    const CubicPlan* plan = nullptr;
+    int segment = 0;
+    int64_t cur_time_us = -1;
+    int64_t start_time_us = -1;
+
+    // Initialize the timestamp to an invalid number so we can detect
+    // the first message.
+    iiwa_status_.utime = cur_time_us;
+
+    lcmt_iiwa_command iiwa_command;
+    iiwa_command.num_joints = kNumJoints;
+    iiwa_command.joint_position.resize(kNumJoints, 0.);
+    iiwa_command.num_torques = 0;
+    iiwa_command.joint_torque.resize(kNumJoints, 0.);
+
+    while (true) {
+      // Call lcm handle until at least one status message is
+      // processed.
+      while (0 == lcm_.handleTimeout(10) || iiwa_status_.utime == -1) { }
+
+      cur_time_us = iiwa_status_.utime;
+
+      if (const CubicPlan* new_plan = mailbox_.Take()) {
+        if (plan) {
+          mailbox_.Retire(plan);
+        }
+        plan = new_plan;
+        if (plan->empty()) {
+          mailbox_.Retire(plan);
+          plan = nullptr;
+        } else {
+          std::cout << "Starting new plan." << std::endl;
+          start_time_us = cur_time_us;
+          segment = 0;
+        }
+      }
+
+      if (plan) {
+        const double cur_traj_time_s =
+            static_cast<double>(cur_time_us - start_time_us) / 1e6;
+        plan->Eval(cur_traj_time_s, &segment,
+                   iiwa_command.joint_position.data());
+
+        iiwa_command.utime = iiwa_status_.utime;
+
+        lcm_.publish(kLcmCommandChannel, &iiwa_command);
+      }
+    }
+  }
+
+ private:
+  void HandleStatus(const lcm::ReceiveBuffer*, const std::string&,
+                    const lcmt_iiwa_status* status) {
+    iiwa_status_ = *status;
   }
 
   lcm::LCM lcm_;
-  const RigidBodyTree<double>& tree_;
-  int plan_number_{};
-  std::unique_ptr<PiecewisePolynomial<double>> plan_;
+  PlanMailbox mailbox_;
+  PlanReceiver plan_receiver_;
   lcmt_iiwa_status iiwa_status_;
 };
 
@@ -0,0 +1,476 @@
+#pragma once
+
+// @file
+// Template method implementations for multi_rod2d.h.
+// Most users should only include that file, not this one.
+// For background, see http://drake.mit.edu/cxx_inl.html.
+
+/* clang-format off to disable clang-format-includes */
+#include "drake/examples/rod2d/multi_rod2d.h"
+/* clang-format on */
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/systems/framework/basic_vector.h"
+
+namespace drake {
+namespace examples {
+namespace rod2d {
+
+template <typename T>
+MultiRod2D<T>::MultiRod2D(const Rod2D<T>& rod, int num_rods)
+    : num_rods_(num_rods),
+      simulation_type_(rod.get_simulation_type()),
+      dt_(rod.get_integration_step_size()),
+      mass_(rod.get_rod_mass()),
+      half_length_(rod.get_rod_half_length()),
+      J_(rod.get_rod_moment_of_inertia()),
+      mu_(rod.get_mu_coulomb()),
+      mu_s_(rod.get_mu_static()),
+      g_(rod.get_gravitational_acceleration()),
+      stiffness_(rod.get_stiffness()),
+      dissipation_(rod.get_dissipation()),
+      v_stick_tol_(rod.get_stiction_speed_tolerance()),
+      erp_(rod.get_erp()),
+      cfm_(rod.get_cfm()) {
+  if (num_rods <= 0)
+    throw std::logic_error("MultiRod2D requires at least one rod.");
+
+  const int nq = 3 * num_rods;
+  if (simulation_type_ == SimulationType::kTimeStepping) {
+    this->DeclarePeriodicDiscreteUpdate(dt_);
+    this->DeclareDiscreteState(2 * nq);
+  } else {
+    this->DeclareContinuousState(nq, nq, 0);  // q, v, z
+  }
+
+  this->DeclareInputPort(systems::kVectorValued, nq);
+  state_output_port_ = &this->DeclareVectorOutputPort(
+      systems::BasicVector<T>(2 * nq), &MultiRod2D::CopyStateOut);
+}
+
+template <typename T>
+VectorX<T> MultiRod2D<T>::RodJacobian::Multiply(const VectorX<T>& w) const {
+  const int num_rows = static_cast<int>(rod.size());
+  VectorX<T> result(num_rows);
+  for (int c = 0; c < num_rows; ++c)
+    result[c] = rows.col(c).dot(w.template segment<3>(3 * rod[c]));
+  return result;
+}
+
+template <typename T>
+VectorX<T> MultiRod2D<T>::RodJacobian::TransposeMultiply(
+    const VectorX<T>& f, int num_velocities) const {
+  const int num_rows = static_cast<int>(rod.size());
+  DRAKE_ASSERT(f.size() == num_rows);
+  VectorX<T> result = VectorX<T>::Zero(num_velocities);
+  for (int c = 0; c < num_rows; ++c)
+    result.template segment<3>(3 * rod[c]) += rows.col(c) * f[c];
+  return result;
+}
+
+// Computes the locations and Jacobian rows of the endpoints of all rods,
+// using the endpoint formulas of Rod2D::CalcRodEndpoint().
+template <typename T>
+typename MultiRod2D<T>::Endpoints MultiRod2D<T>::CalcEndpoints(
+    const Eigen::Ref<const VectorX<T>>& q,
+    const Eigen::Ref<const VectorX<T>>& v) const {
+  using std::cos;
+  using std::sin;
+
+  const int n = num_rods_;
+  DRAKE_ASSERT(q.size() == 3 * n && v.size() == 3 * n);
+
+  // Evaluate the trigonometric functions of all rods in one pass.
+  VectorX<T> ctheta(n), stheta(n);
+  for (int i = 0; i < n; ++i) {
+    ctheta[i] = cos(q[3 * i + 2]);
+    stheta[i] = sin(q[3 * i + 2]);
+  }
+
+  Endpoints endpoints;
+  endpoints.height.resize(2 * n);
+  endpoints.normal_arm.resize(2 * n);
+  endpoints.tangent_arm.resize(2 * n);
+  endpoints.tangent_velocity.resize(2 * n);
+  endpoints.normal_bias.resize(2 * n);
+  endpoints.tangent_bias.resize(2 * n);
+  for (int i = 0; i < n; ++i) {
+    const T& y = q[3 * i + 1];
+    const T& xdot = v[3 * i];
+    const T& thetadot = v[3 * i + 2];
+    for (int k : {-1, 1}) {
+      const int e = 2 * i + (k + 1) / 2;
+
+      // The endpoint, measured from the center of mass of the rod.
+      const T rx = k * ctheta[i] * half_length_;
+      const T ry = k * stheta[i] * half_length_;
+
+      endpoints.height[e] = y + ry;
+      endpoints.normal_arm[e] = rx;
+      endpoints.tangent_arm[e] = -ry;
+      endpoints.tangent_velocity[e] = xdot - ry * thetadot;
+      endpoints.normal_bias[e] = -ry * thetadot * thetadot;
+      endpoints.tangent_bias[e] = -rx * thetadot * thetadot;
+    }
+  }
+  return endpoints;
+}
+
+// Forms the rows of the contact Jacobian along the normal (@p axis = 1) or the
+// tangent (@p axis = 0) for the endpoints with indices @p contacts.
+template <typename T>
+typename MultiRod2D<T>::RodJacobian MultiRod2D<T>::MakeJacobian(
+    const Endpoints& endpoints, const std::vector<int>& contacts,
+    int axis) const {
+  DRAKE_ASSERT(axis == 0 || axis == 1);
+  const int num_rows = static_cast<int>(contacts.size());
+  const VectorX<T>& arm =
+      (axis == 1) ? endpoints.normal_arm : endpoints.tangent_arm;
+
+  RodJacobian jacobian;
+  jacobian.rod.resize(num_rows);
+  jacobian.rows.resize(3, num_rows);
+  for (int c = 0; c < num_rows; ++c) {
+    const int e = contacts[c];
+    jacobian.rod[c] = e / 2;
+    jacobian.rows(0, c) = (axis == 0) ? 1 : 0;
+    jacobian.rows(1, c) = (axis == 1) ? 1 : 0;
+    jacobian.rows(2, c) = arm[e];
+  }
+  return jacobian;
+}
+
+// Computes the external forces on all rods: the applied forces plus gravity.
+template <typename T>
+VectorX<T> MultiRod2D<T>::ComputeExternalForces(
+    const systems::Context<T>& context) const {
+  VectorX<T> f = this->EvalEigenVectorInput(context, 0);
+  for (int i = 0; i < num_rods_; ++i)
+    f[3 * i + 1] += mass_ * g_;
+  return f;
+}
+
+// The generalized inertia matrix is diagonal, so it is inverted row by row.
+template <typename T>
+MatrixX<T> MultiRod2D<T>::SolveInertia(const MatrixX<T>& B) const {
+  DRAKE_ASSERT(B.rows() == 3 * num_rods_);
+  MatrixX<T> X(B.rows(), B.cols());
+  for (int i = 0; i < num_rods_; ++i) {
+    X.row(3 * i) = B.row(3 * i) / mass_;
+    X.row(3 * i + 1) = B.row(3 * i + 1) / mass_;
+    X.row(3 * i + 2) = B.row(3 * i + 2) / J_;
+  }
+  return X;
+}
+
+template <typename T>
+VectorX<T> MultiRod2D<T>::CopyState(const systems::Context<T>& context) const {
+  return (simulation_type_ == SimulationType::kTimeStepping)
+             ? context.get_discrete_state(0).CopyToVector()
+             : context.get_continuous_state().CopyToVector();
+}
+
+template <typename T>
+void MultiRod2D<T>::CopyStateOut(const systems::Context<T>& context,
+                                 systems::BasicVector<T>* output) const {
+  output->SetFromVector(CopyState(context));
+}
+
+template <typename T>
+Vector6<T> MultiRod2D<T>::GetRodState(const systems::Context<T>& context,
+                                      int rod) const {
+  DRAKE_DEMAND(rod >= 0 && rod < num_rods_);
+  const systems::VectorBase<T>& state =
+      (simulation_type_ == SimulationType::kTimeStepping)
+          ? static_cast<const systems::VectorBase<T>&>(
+                context.get_discrete_state(0))
+          : context.get_continuous_state_vector();
+  const int nq = 3 * num_rods_;
+  Vector6<T> rod_state;
+  for (int k = 0; k < 3; ++k) {
+    rod_state[k] = state.GetAtIndex(3 * rod + k);
+    rod_state[3 + k] = state.GetAtIndex(nq + 3 * rod + k);
+  }
+  return rod_state;
+}
+
+template <typename T>
+void MultiRod2D<T>::SetRodState(int rod, const Vector6<T>& rod_state,
+                                systems::Context<T>* context) const {
+  DRAKE_DEMAND(context != nullptr);
+  DRAKE_DEMAND(rod >= 0 && rod < num_rods_);
+  systems::VectorBase<T>& state =
+      (simulation_type_ == SimulationType::kTimeStepping)
+          ? static_cast<systems::VectorBase<T>&>(
+                context->get_mutable_discrete_state(0))
+          : context->get_mutable_continuous_state_vector();
+  const int nq = 3 * num_rods_;
+  for (int k = 0; k < 3; ++k) {
+    state.SetAtIndex(3 * rod + k, rod_state[k]);
+    state.SetAtIndex(nq + 3 * rod + k, rod_state[3 + k]);
+  }
+}
+
+// Solves the rigid contact problem at the acceleration level for the
+// endpoints that touch or lie within the half-space, as Rod2D sets up its
+// rigid contact problem data.
+template <typename T>
+void MultiRod2D<T>::CalcRigidContactAccelerations(
+    const systems::Context<T>& context, const VectorX<T>& q,
+    const VectorX<T>& v, VectorX<T>* vdot) const {
+  using std::abs;
+
+  const int nv = 3 * num_rods_;
+  const Endpoints endpoints = CalcEndpoints(q, v);
+  const VectorX<T> tau = ComputeExternalForces(context);
+
+  // Find the contacts, and split them into sliding and non-sliding ones.
+  const T sliding_vel_tol = 100 * std::numeric_limits<double>::epsilon();
+  std::vector<int> contacts;
+  std::vector<int> sliding_contacts, non_sliding_contacts;
+  for (int e = 0; e < 2 * num_rods_; ++e) {
+    if (endpoints.height[e] > 0) continue;
+    const int c = static_cast<int>(contacts.size());
+    contacts.push_back(e);
+    if (abs(endpoints.tangent_velocity[e]) < sliding_vel_tol) {
+      non_sliding_contacts.push_back(c);
+    } else {
+      sliding_contacts.push_back(c);
+    }
+  }
+  if (contacts.empty()) {
+    *vdot = SolveInertia(tau);
+    return;
+  }
+
+  const int nc = static_cast<int>(contacts.size());
+  const int num_sliding = static_cast<int>(sliding_contacts.size());
+  const int num_non_sliding = static_cast<int>(non_sliding_contacts.size());
+
+  multibody::constraint::ConstraintAccelProblemData<T> problem_data(nv);
+  problem_data.sliding_contacts = sliding_contacts;
+  problem_data.non_sliding_contacts = non_sliding_contacts;
+  problem_data.mu_sliding.setOnes(num_sliding) *= mu_;
+  problem_data.mu_non_sliding.setOnes(num_non_sliding) *= mu_s_;
+  problem_data.r.assign(num_non_sliding, 1);
+
+  // Form the normal contact Jacobian (N) and Ndot * v.
+  const RodJacobian N = MakeJacobian(endpoints, contacts, 1);
+  problem_data.N_mult = [N](const VectorX<T>& w) -> VectorX<T> {
+    return N.Multiply(w);
+  };
+  problem_data.kN.resize(nc);
+  for (int c = 0; c < nc; ++c)
+    problem_data.kN[c] = endpoints.normal_bias[contacts[c]];
+  problem_data.gammaN.setZero(nc);
+
+  // Form the tangent contact Jacobian (F) and Fdot * v, for the non-sliding
+  // contacts only.
+  std::vector<int> non_sliding_endpoints(num_non_sliding);
+  for (int i = 0; i < num_non_sliding; ++i)
+    non_sliding_endpoints[i] = contacts[non_sliding_contacts[i]];
+  const RodJacobian F = MakeJacobian(endpoints, non_sliding_endpoints, 0);
+  problem_data.F_mult = [F](const VectorX<T>& w) -> VectorX<T> {
+    return F.Multiply(w);
+  };
+  problem_data.F_transpose_mult = [F, nv](const VectorX<T>& f) -> VectorX<T> {
+    return F.TransposeMultiply(f, nv);
+  };
+  problem_data.kF.resize(num_non_sliding);
+  for (int i = 0; i < num_non_sliding; ++i)
+    problem_data.kF[i] = endpoints.tangent_bias[non_sliding_endpoints[i]];
+  problem_data.gammaF.setZero(num_non_sliding);
+  problem_data.gammaE.setZero(num_non_sliding);
+
+  // Form N - mu*Q, where the rows of Q for the sliding contacts are the
+  // tangent rows along the direction of sliding.
+  RodJacobian N_minus_mu_Q = N;
+  for (int i = 0; i < num_sliding; ++i) {
+    const int c = sliding_contacts[i];
+    const int e = contacts[c];
+    const T mu_sign = (endpoints.tangent_velocity[e] < 0) ? -mu_ : mu_;
+    N_minus_mu_Q.rows(0, c) -= mu_sign;
+    N_minus_mu_Q.rows(2, c) -= mu_sign * endpoints.tangent_arm[e];
+  }
+  problem_data.N_minus_muQ_transpose_mult =
+      [N_minus_mu_Q, nv](const VectorX<T>& f) -> VectorX<T> {
+    return N_minus_mu_Q.TransposeMultiply(f, nv);
+  };
+
+  problem_data.kL.resize(0);
+  problem_data.gammaL.resize(0);
+  problem_data.tau = tau;
+  problem_data.solve_inertia = [this](const MatrixX<T>& B) -> MatrixX<T> {
+    return SolveInertia(B);
+  };
+
+  VectorX<T> cf;
+  solver_.SolveConstraintProblem(problem_data, &cf);
+  solver_.ComputeGeneralizedAcceleration(problem_data, cf, vdot);
+}
+
+// Computes the accelerations of all rods under the compliant contact model of
+// Rod2D::CalcCompliantContactForces().
+template <typename T>
+void MultiRod2D<T>::CalcCompliantContactAccelerations(
+    const systems::Context<T>& context, const VectorX<T>& q,
+    const VectorX<T>& v, VectorX<T>* vdot) const {
+  using std::abs;
+  using std::max;
+
+  const Endpoints endpoints = CalcEndpoints(q, v);
+  VectorX<T> f = ComputeExternalForces(context);
+  for (int e = 0; e < 2 * num_rods_; ++e) {
+    // Calculate penetration depth h along -y; negative means separated.
+    const T h = -endpoints.height[e];
+    if (h > 0) {
+      const int i = e / 2;
+      const T& normal_arm = endpoints.normal_arm[e];
+      const T& tangent_arm = endpoints.tangent_arm[e];
+      const T hdot = -(v[3 * i + 1] + v[3 * i + 2] * normal_arm);
+      const T& slip = endpoints.tangent_velocity[e];
+      const int sign_v = slip < 0 ? -1 : 1;
+      const T fK = stiffness_ * h;
+      const T fD = fK * dissipation_ * hdot;
+      const T fN = max(fK + fD, T(0));
+      const T mu = Rod2D<T>::CalcMuStribeck(mu_s_, mu_,
+                                            abs(slip) / v_stick_tol_);
+      const T fF = -mu * fN * T(sign_v);
+      f[3 * i] += fF;
+      f[3 * i + 1] += fN;
+      f[3 * i + 2] += normal_arm * fN + tangent_arm * fF;
+    }
+  }
+  *vdot = SolveInertia(f);
+}
+
+template <typename T>
+void MultiRod2D<T>::DoCalcTimeDerivatives(
+    const systems::Context<T>& context,
+    systems::ContinuousState<T>* derivatives) const {
+  // Don't compute any derivatives if this is the time stepping system.
+  if (simulation_type_ == SimulationType::kTimeStepping) {
+    DRAKE_ASSERT(derivatives->size() == 0);
+    return;
+  }
+
+  const int nq = 3 * num_rods_;
+  const VectorX<T> state = context.get_continuous_state().CopyToVector();
+  const VectorX<T> q = state.head(nq);
+  const VectorX<T> v = state.tail(nq);
+
+  VectorX<T> vdot;
+  if (simulation_type_ == SimulationType::kCompliant) {
+    CalcCompliantContactAccelerations(context, q, v, &vdot);
+  } else {
+    CalcRigidContactAccelerations(context, q, v, &vdot);
+  }
+
+  VectorX<T> xdot(2 * nq);
+  xdot << v, vdot;
+  derivatives->SetFromVector(xdot);
+}
+
+// Advances all rods with the time stepping scheme of
+// Rod2D::DoCalcDiscreteVariableUpdates(), with both endpoints of every rod
+// treated as contacts.
+template <typename T>
+void MultiRod2D<T>::DoCalcDiscreteVariableUpdates(
+    const systems::Context<T>& context,
+    const std::vector<const systems::DiscreteUpdateEvent<T>*>&,
+    systems::DiscreteValues<T>* discrete_state) const {
+  const int nv = 3 * num_rods_;
+  const int nc = 2 * num_rods_;
+
+  const VectorX<T> state = context.get_discrete_state(0).CopyToVector();
+  const VectorX<T> q = state.head(nv);
+  VectorX<T> v = state.tail(nv);
+
+  // Form the contact Jacobians of all endpoints in a single pass.
+  const Endpoints endpoints = CalcEndpoints(q, v);
+  std::vector<int> contacts(nc);
+  std::iota(contacts.begin(), contacts.end(), 0);
+  const RodJacobian N = MakeJacobian(endpoints, contacts, 1);
+  const RodJacobian F = MakeJacobian(endpoints, contacts, 0);
+
+  multibody::constraint::ConstraintVelProblemData<T> problem_data(nv);
+  problem_data.r.assign(nc, 1);
+  problem_data.mu.setOnes(nc) *= mu_;
+  problem_data.N_mult = [&N](const VectorX<T>& w) -> VectorX<T> {
+    return N.Multiply(w);
+  };
+  problem_data.N_transpose_mult = [&N, nv](const VectorX<T>& f) -> VectorX<T> {
+    return N.TransposeMultiply(f, nv);
+  };
+  problem_data.F_mult = [&F](const VectorX<T>& w) -> VectorX<T> {
+    return F.Multiply(w);
+  };
+  problem_data.F_transpose_mult = [&F, nv](const VectorX<T>& f) -> VectorX<T> {
+    return F.TransposeMultiply(f, nv);
+  };
+  problem_data.solve_inertia = [this](const MatrixX<T>& B) -> MatrixX<T> {
+    return SolveInertia(B);
+  };
+
+  // Update the generalized velocity vector with discretized external forces.
+  v += dt_ * SolveInertia(ComputeExternalForces(context));
+  problem_data.Mv.resize(nv);
+  for (int i = 0; i < num_rods_; ++i) {
+    problem_data.Mv.template segment<2>(3 * i) =
+        mass_ * v.template segment<2>(3 * i);
+    problem_data.Mv[3 * i + 2] = J_ * v[3 * i + 2];
+  }
+
+  // Set stabilization and regularization parameters.
+  problem_data.kN = erp_ * endpoints.height / dt_;
+  problem_data.kF.setZero(nc);
+  problem_data.gammaN.setOnes(nc) *= cfm_;
+  problem_data.gammaF.setOnes(nc) *= cfm_;
+  problem_data.gammaE.setOnes(nc) *= cfm_;
+  problem_data.kL.resize(0);
+  problem_data.gammaL.resize(0);
+
+  VectorX<T> cf;
+  solver_.SolveImpactProblem(problem_data, &cf);
+  VectorX<T> delta_v;
+  solver_.ComputeGeneralizedVelocityChange(problem_data, cf, &delta_v);
+
+  const VectorX<T> vplus = v + delta_v;
+  systems::BasicVector<T>& new_state = discrete_state->get_mutable_vector(0);
+  new_state.get_mutable_value().head(nv) = q + vplus * dt_;
+  new_state.get_mutable_value().tail(nv) = vplus;
+}
+
+/// Sets every rod to the default state of Rod2D, with the rods spaced apart
+/// along x.
+template <typename T>
+void MultiRod2D<T>::SetDefaultState(const systems::Context<T>&,
+                                    systems::State<T>* state) const {
+  using std::sqrt;
+
+  const int nq = 3 * num_rods_;
+  const double r22 = sqrt(2) / 2;
+  VectorX<T> x0(2 * nq);
+  for (int i = 0; i < num_rods_; ++i) {
+    x0.template segment<3>(3 * i) = Vector3<T>(
+        half_length_ * r22 + 4 * half_length_ * i, half_length_ * r22,
+        M_PI / 4.0);
+    x0.template segment<3>(nq + 3 * i) = Vector3<T>(-1, 0, 0);
+  }
+  if (simulation_type_ == SimulationType::kTimeStepping) {
+    state->get_mutable_discrete_state().get_mutable_vector(0)
+        .SetFromVector(x0);
+  } else {
+    state->get_mutable_continuous_state().SetFromVector(x0);
+  }
+}
+
+}  // namespace rod2d
+}  // namespace examples
+}  // namespace drake
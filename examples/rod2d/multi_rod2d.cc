@@ -0,0 +1,12 @@
+// NOLINTNEXTLINE(build/include) False positive on inl file.
+#include "drake/examples/rod2d/multi_rod2d-inl.h"
+
+namespace drake {
+namespace examples {
+namespace rod2d {
+
+template class MultiRod2D<double>;
+
+}  // namespace rod2d
+}  // namespace examples
+}  // namespace drake
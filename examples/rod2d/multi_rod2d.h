@@ -0,0 +1,176 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/examples/rod2d/rod2d.h"
+#include "drake/multibody/constraint/constraint_problem_data.h"
+#include "drake/multibody/constraint/constraint_solver.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace examples {
+namespace rod2d {
+
+/** Dynamical system representation of `N` rods contacting a half-space in two
+dimensions, for developing and benchmarking contact solvers on problems of
+growing size.
+
+Each rod is a copy of the rod of Rod2D, with the same parameters and the same
+three simulation approaches; see Rod2D for the model and the notation. The rods
+only contact the half-space, not each other, but the constraints of all of them
+form a single problem for the ConstraintSolver, just as the constraints of the
+bodies of a multibody system would. The contact Jacobians of all rods are
+computed in a single pass over the packed state, and only ever applied as
+sparse operators.
+
+The approaches differ from those of Rod2D as follows:
+- kTimeStepping is the same half-explicit scheme, with both endpoints of every
+  rod treated as contacts at every step.
+- kCompliant is the same compliant model.
+- kPiecewiseDAE, which Rod2D does not implement yet, solves the rigid contact
+  problem at the acceleration level for the endpoints that touch or lie within
+  the half-space in the current state. There are no witness functions and no
+  impacts, so it is only suitable for evaluating the time derivatives of
+  states that are consistent with the contact constraints, e.g., for timing
+  them.
+
+This class uses Drake's `-inl.h` pattern.  When seeing linker errors from
+this class, please refer to http://drake.mit.edu/cxx_inl.html.
+
+@tparam T The vector element type, which must be a valid Eigen scalar.
+
+Instantiated templates for the following scalar types @p T are provided:
+- double
+
+They are already available to link against in the containing library.
+
+Inputs: the planar forces and torques applied to the center-of-mass of each
+        rod, as in Rod2D, stacked into a vector of size `3N`.
+
+States: the generalized positions (x, y, θ) of each rod, stacked into a
+        vector of size `3N`, followed by the generalized velocities of each
+        rod, likewise stacked. The state is continuous for kPiecewiseDAE and
+        kCompliant, and discrete for kTimeStepping.
+
+Outputs: Output Port 0 corresponds to the state vector. **/
+template <typename T>
+class MultiRod2D : public systems::LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultiRod2D)
+
+  using SimulationType = typename Rod2D<T>::SimulationType;
+
+  /// Constructs a system of @p num_rods rods, each with the simulation type,
+  /// integration step size, and parameters of @p rod. Later changes to the
+  /// parameters of @p rod do not affect this system.
+  /// @throws std::logic_error if @p num_rods is not positive.
+  MultiRod2D(const Rod2D<T>& rod, int num_rods);
+
+  /// Gets the number of rods.
+  int num_rods() const { return num_rods_; }
+
+  /// Gets the model and simulation type for this system.
+  SimulationType get_simulation_type() const { return simulation_type_; }
+
+  /// Gets the integration step size for the time stepping system.
+  /// @returns 0 if this is not a time stepping system.
+  double get_integration_step_size() const { return dt_; }
+
+  /// Gets the state (x, y, θ, ẋ, ẏ, θ̇) of rod @p rod from @p context.
+  Vector6<T> GetRodState(const systems::Context<T>& context, int rod) const;
+
+  /// Sets the state (x, y, θ, ẋ, ẏ, θ̇) of rod @p rod in @p context.
+  void SetRodState(int rod, const Vector6<T>& rod_state,
+                   systems::Context<T>* context) const;
+
+  /// Returns the output port of the state vector.
+  const systems::OutputPort<T>& state_output() const {
+    return *state_output_port_;
+  }
+
+ private:
+  // A contact Jacobian, or a related operator, of the rods. Row c of the
+  // operator has the three nonzeros `rows.col(c)`, which multiply the
+  // generalized velocities (ẋ, ẏ, θ̇) of rod `rod[c]`.
+  struct RodJacobian {
+    std::vector<int> rod;
+    Matrix3X<T> rows;
+
+    VectorX<T> Multiply(const VectorX<T>& w) const;
+    VectorX<T> TransposeMultiply(const VectorX<T>& f, int num_velocities)
+        const;
+  };
+
+  // The endpoints of all rods, computed in a single pass. Endpoint 2i is the
+  // left endpoint (k = -1) of rod i and endpoint 2i + 1 its right endpoint
+  // (k = +1).
+  struct Endpoints {
+    // The heights of the endpoints above the half-space.
+    VectorX<T> height;
+    // The rows of the contact Jacobians along the normal (+y) and the tangent
+    // (+x) at each endpoint, without their constant translational entries:
+    // the moment arms p_x − x and −(p_y − y).
+    VectorX<T> normal_arm;
+    VectorX<T> tangent_arm;
+    // The velocities of the endpoints along the tangent (+x).
+    VectorX<T> tangent_velocity;
+    // The time derivatives of the normal and tangent Jacobians, times the
+    // generalized velocity.
+    VectorX<T> normal_bias;
+    VectorX<T> tangent_bias;
+  };
+
+  Endpoints CalcEndpoints(const Eigen::Ref<const VectorX<T>>& q,
+                          const Eigen::Ref<const VectorX<T>>& v) const;
+  RodJacobian MakeJacobian(const Endpoints& endpoints,
+                           const std::vector<int>& contacts, int axis) const;
+  VectorX<T> ComputeExternalForces(const systems::Context<T>& context) const;
+  MatrixX<T> SolveInertia(const MatrixX<T>& B) const;
+  VectorX<T> CopyState(const systems::Context<T>& context) const;
+  void CopyStateOut(const systems::Context<T>& context,
+                    systems::BasicVector<T>* output) const;
+  void CalcRigidContactAccelerations(const systems::Context<T>& context,
+                                     const VectorX<T>& q, const VectorX<T>& v,
+                                     VectorX<T>* vdot) const;
+  void CalcCompliantContactAccelerations(const systems::Context<T>& context,
+                                         const VectorX<T>& q,
+                                         const VectorX<T>& v,
+                                         VectorX<T>* vdot) const;
+  void DoCalcTimeDerivatives(const systems::Context<T>& context,
+                             systems::ContinuousState<T>* derivatives)
+                               const override;
+  void DoCalcDiscreteVariableUpdates(
+      const systems::Context<T>& context,
+      const std::vector<const systems::DiscreteUpdateEvent<T>*>& events,
+      systems::DiscreteValues<T>* discrete_state) const override;
+  void SetDefaultState(const systems::Context<T>& context,
+                       systems::State<T>* state) const override;
+
+  // The constraint solver, for both rigid approaches.
+  multibody::constraint::ConstraintSolver<T> solver_;
+
+  const int num_rods_;
+  const SimulationType simulation_type_;
+  const double dt_;
+
+  // The parameters of each rod, copied from the Rod2D given to the
+  // constructor.
+  const double mass_;
+  const double half_length_;
+  const double J_;
+  const double mu_;
+  const double mu_s_;
+  const double g_;
+  const double stiffness_;
+  const double dissipation_;
+  const double v_stick_tol_;
+  const double erp_;
+  const double cfm_;
+
+  const systems::OutputPort<T>* state_output_port_{nullptr};
+};
+
+}  // namespace rod2d
+}  // namespace examples
+}  // namespace drake
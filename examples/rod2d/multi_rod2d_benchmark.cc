@@ -0,0 +1,122 @@
+// Measures how the cost of the contact problems of MultiRod2D grows with the
+// number of rods, for each of its three simulation approaches. Run with
+// --help for options.
+//
+// Every rod rests horizontally on the half-space, so that both of its
+// endpoints are in contact and the state is consistent with the rigid contact
+// constraints. The time stepping approach times one discrete update, which
+// solves an LCP over all 2N contacts; the piecewise DAE approach times one
+// evaluation of the time derivatives, which solves the acceleration-level LCP
+// over the same contacts; the compliant approach, which solves no LCP, times
+// the same evaluation as a baseline.
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/examples/rod2d/multi_rod2d.h"
+#include "drake/examples/rod2d/rod2d.h"
+
+DEFINE_string(num_rods, "1,10,100,1000",
+              "Comma-separated list of the numbers of rods to time.");
+DEFINE_int32(iterations, 10, "Number of timed repetitions of each test.");
+DEFINE_double(max_seconds, 10.0,
+              "Stop sweeping an approach once a single evaluation takes "
+              "longer than this many seconds.");
+
+namespace drake {
+namespace examples {
+namespace rod2d {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using SimulationType = Rod2D<double>::SimulationType;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<int> ParseNumRods(const std::string& list) {
+  std::vector<int> result;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    result.push_back(std::stoi(item));
+    DRAKE_DEMAND(result.back() >= 1);
+  }
+  DRAKE_DEMAND(!result.empty());
+  return result;
+}
+
+// Returns the average number of seconds taken by one evaluation of the
+// dynamics of @p num_rods rods of type @p type.
+double TimeDynamics(SimulationType type, int num_rods) {
+  const double dt = (type == SimulationType::kTimeStepping) ? 1e-3 : 0.0;
+  const Rod2D<double> rod(type, dt);
+  const MultiRod2D<double> rods(rod, num_rods);
+  auto context = rods.CreateDefaultContext();
+  context->FixInputPort(0, Eigen::VectorXd::Zero(3 * num_rods));
+  const double spacing = 4 * rod.get_rod_half_length();
+  for (int i = 0; i < num_rods; ++i) {
+    Vector6<double> rod_state;
+    rod_state << spacing * i, 0, 0, 0, 0, 0;
+    rods.SetRodState(i, rod_state, context.get());
+  }
+
+  auto discrete_state = rods.AllocateDiscreteVariables();
+  auto derivatives = rods.AllocateTimeDerivatives();
+  const Clock::time_point start = Clock::now();
+  for (int k = 0; k < FLAGS_iterations; ++k) {
+    if (type == SimulationType::kTimeStepping) {
+      rods.CalcDiscreteVariableUpdates(*context, discrete_state.get());
+    } else {
+      rods.CalcTimeDerivatives(*context, derivatives.get());
+    }
+  }
+  return SecondsSince(start) / FLAGS_iterations;
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+  const std::vector<int> num_rods = ParseNumRods(FLAGS_num_rods);
+
+  const std::vector<std::pair<SimulationType, std::string>> types = {
+      {SimulationType::kTimeStepping, "time stepping"},
+      {SimulationType::kPiecewiseDAE, "piecewise DAE"},
+      {SimulationType::kCompliant, "compliant"}};
+  for (const auto& type : types) {
+    std::cout << "MultiRod2D, " << type.second << ":\n";
+    for (const int n : num_rods) {
+      const double seconds = TimeDynamics(type.first, n);
+      std::cout << "  " << n << " rods, " << 2 * n
+                << " contacts: " << seconds * 1e3 << " ms\n";
+      if (seconds > FLAGS_max_seconds) {
+        std::cout << "  (skipping larger problems)\n";
+        break;
+      }
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace rod2d
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Benchmarks the contact problems of MultiRod2D for a sweep over the "
+      "number of rods, for each simulation approach.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::examples::rod2d::do_main();
+}
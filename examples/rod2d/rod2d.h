@@ -483,6 +483,8 @@ class Rod2D : public systems::LeafSystem<T> {
  private:
   friend class Rod2DDAETest;
   friend class Rod2DDAETest_RigidContactProblemDataBallistic_Test;
+  // Reuses CalcMuStribeck() for its compliant contact model.
+  template <typename> friend class MultiRod2D;
 
   Vector3<T> GetJacobianRow(const systems::Context<T>& context,
                             const Vector2<T>& p,
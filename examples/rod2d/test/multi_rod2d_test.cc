@@ -0,0 +1,148 @@
+#include "drake/examples/rod2d/multi_rod2d.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/examples/rod2d/rod2d.h"
+
+using drake::systems::Context;
+
+namespace drake {
+namespace examples {
+namespace rod2d {
+namespace {
+
+using SimulationType = Rod2D<double>::SimulationType;
+
+// Distinct states of three rods: one resting at an angle on the half-space,
+// one penetrating it while sliding, and one in flight.
+std::vector<Vector6<double>> MakeRodStates() {
+  std::vector<Vector6<double>> states(3, Vector6<double>());
+  states[0] << 0.0, 0.35, 0.8, 0.0, 0.0, 0.0;
+  states[1] << 3.0, -0.01, -0.2, 0.5, -0.1, 0.3;
+  states[2] << 6.0, 2.0, 1.3, -1.0, 0.2, -0.4;
+  return states;
+}
+
+// Sets up @p rods with the states of MakeRodStates() and a per-rod input.
+std::unique_ptr<Context<double>> MakeContext(const MultiRod2D<double>& rods) {
+  auto context = rods.CreateDefaultContext();
+  const std::vector<Vector6<double>> states = MakeRodStates();
+  for (int i = 0; i < rods.num_rods(); ++i)
+    rods.SetRodState(i, states[i], context.get());
+  Eigen::VectorXd input(3 * rods.num_rods());
+  for (int i = 0; i < rods.num_rods(); ++i)
+    input.segment<3>(3 * i) = Eigen::Vector3d(0.1 * i, -0.2, 0.05 * i);
+  context->FixInputPort(0, input);
+  return context;
+}
+
+// Sets up @p rod as rod @p i of MakeContext().
+std::unique_ptr<Context<double>> MakeSingleRodContext(
+    const Rod2D<double>& rod, int i) {
+  auto context = rod.CreateDefaultContext();
+  const Vector6<double> state = MakeRodStates()[i];
+  if (rod.get_simulation_type() == SimulationType::kTimeStepping) {
+    context->get_mutable_discrete_state(0).SetFromVector(state);
+  } else {
+    context->get_mutable_continuous_state_vector().SetFromVector(state);
+  }
+  context->FixInputPort(0, Eigen::Vector3d(0.1 * i, -0.2, 0.05 * i));
+  return context;
+}
+
+GTEST_TEST(MultiRod2DTest, Construction) {
+  const Rod2D<double> rod(SimulationType::kTimeStepping, 1e-3);
+  EXPECT_THROW(MultiRod2D<double>(rod, 0), std::logic_error);
+
+  const MultiRod2D<double> rods(rod, 4);
+  EXPECT_EQ(rods.num_rods(), 4);
+  EXPECT_EQ(rods.get_simulation_type(), SimulationType::kTimeStepping);
+  EXPECT_EQ(rods.get_integration_step_size(), 1e-3);
+  EXPECT_EQ(rods.get_input_port(0).size(), 12);
+  EXPECT_EQ(rods.state_output().size(), 24);
+
+  // The default state places a copy of the default state of Rod2D at each of
+  // several locations along x.
+  auto context = rods.CreateDefaultContext();
+  auto rod_context = rod.CreateDefaultContext();
+  const Eigen::VectorXd rod_state =
+      rod_context->get_discrete_state(0).CopyToVector();
+  for (int i = 0; i < rods.num_rods(); ++i) {
+    const Vector6<double> state = rods.GetRodState(*context, i);
+    EXPECT_GT(state[0], rod_state[0] + 3 * i * rod.get_rod_half_length());
+    EXPECT_TRUE(CompareMatrices(state.tail<5>(), rod_state.tail<5>()));
+  }
+}
+
+// A time stepping update of several rods equals those of each rod alone.
+GTEST_TEST(MultiRod2DTest, TimeSteppingMatchesRod2D) {
+  const Rod2D<double> rod(SimulationType::kTimeStepping, 1e-3);
+  const MultiRod2D<double> rods(rod, 3);
+  auto context = MakeContext(rods);
+  auto update = rods.AllocateDiscreteVariables();
+  rods.CalcDiscreteVariableUpdates(*context, update.get());
+  context->get_mutable_discrete_state().CopyFrom(*update);
+
+  for (int i = 0; i < rods.num_rods(); ++i) {
+    auto rod_context = MakeSingleRodContext(rod, i);
+    auto rod_update = rod.AllocateDiscreteVariables();
+    rod.CalcDiscreteVariableUpdates(*rod_context, rod_update.get());
+    EXPECT_TRUE(CompareMatrices(rods.GetRodState(*context, i),
+                                rod_update->get_vector(0).CopyToVector(),
+                                1e-8));
+  }
+}
+
+// The compliant time derivatives of several rods equal those of each rod
+// alone.
+GTEST_TEST(MultiRod2DTest, CompliantMatchesRod2D) {
+  const Rod2D<double> rod(SimulationType::kCompliant, 0.0);
+  const MultiRod2D<double> rods(rod, 3);
+  auto context = MakeContext(rods);
+  auto derivatives = rods.AllocateTimeDerivatives();
+  rods.CalcTimeDerivatives(*context, derivatives.get());
+  const Eigen::VectorXd xdot = derivatives->CopyToVector();
+
+  for (int i = 0; i < rods.num_rods(); ++i) {
+    auto rod_context = MakeSingleRodContext(rod, i);
+    auto rod_derivatives = rod.AllocateTimeDerivatives();
+    rod.CalcTimeDerivatives(*rod_context, rod_derivatives.get());
+    const Eigen::VectorXd rod_xdot = rod_derivatives->CopyToVector();
+    EXPECT_TRUE(CompareMatrices(xdot.segment<3>(3 * i), rod_xdot.head<3>(),
+                                1e-12));
+    EXPECT_TRUE(CompareMatrices(xdot.segment<3>(9 + 3 * i),
+                                rod_xdot.tail<3>(), 1e-12));
+  }
+}
+
+// A rod resting horizontally on the half-space does not accelerate, while a
+// rod in flight accelerates with gravity only.
+GTEST_TEST(MultiRod2DTest, PiecewiseDAE) {
+  const Rod2D<double> rod(SimulationType::kPiecewiseDAE, 0.0);
+  const MultiRod2D<double> rods(rod, 2);
+  auto context = rods.CreateDefaultContext();
+  context->FixInputPort(0, Eigen::VectorXd::Zero(6));
+  Vector6<double> resting, flying;
+  resting << 0.0, 0.0, 0.0, 0.0, 0.0, 0.0;
+  flying << 4.0, 1.0, 0.3, 1.0, 0.0, 0.5;
+  rods.SetRodState(0, resting, context.get());
+  rods.SetRodState(1, flying, context.get());
+
+  auto derivatives = rods.AllocateTimeDerivatives();
+  rods.CalcTimeDerivatives(*context, derivatives.get());
+  const Eigen::VectorXd vdot = derivatives->CopyToVector().tail(6);
+  EXPECT_TRUE(CompareMatrices(vdot.head<3>(), Eigen::Vector3d::Zero(), 1e-10));
+  EXPECT_TRUE(CompareMatrices(
+      vdot.tail<3>(),
+      Eigen::Vector3d(0, rod.get_gravitational_acceleration(), 0), 1e-14));
+}
+
+}  // namespace
+}  // namespace rod2d
+}  // namespace examples
+}  // namespace drake
@@ -30,6 +30,11 @@ namespace geometry {
  registered frame id is considered an error (and will cause an exception
  when GeometrySystem evaluates the data.
 
+ Listing the ids in the order in which the frames were registered with
+ GeometrySystem is the fastest choice: GeometrySystem then maps each pose to its
+ frame by position. Any other order requires an id lookup per frame on each
+ pose update.
+
  @internal In future iterations, this will be relaxed to allow only
  communicating kinematics for frames that have _changed_. But in the initial
  version, this requirement is in place for pedagogical purposes to help users
@@ -8,6 +8,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/geometry/proximity_engine.h"
@@ -188,6 +189,8 @@ SourceId GeometryState<T>::RegisterNewSource(const std::string& name) {
 
   source_frame_id_map_[source_id];
   source_root_frame_map_[source_id];
+  source_frame_order_map_[source_id];
+  source_frame_updates_[source_id];
   source_anchored_geometry_map_[source_id];
   source_names_[source_id] = final_name;
   return source_id;
@@ -211,12 +214,15 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   }
 
   FrameIdSet& f_set = GetMutableValueOrThrow(source_id, &source_frame_id_map_);
+  int parent_pose_index = -1;
   if (parent_id != InternalFrame::get_world_frame_id()) {
     FindOrThrow(parent_id, f_set, [parent_id, source_id]() {
       return "Indicated parent id " + to_string(parent_id) + " does not belong "
           "to the indicated source id " + to_string(source_id) + ".";
     });
-    frames_[parent_id].add_child(frame_id);
+    InternalFrame& parent_frame = frames_[parent_id];
+    parent_frame.add_child(frame_id);
+    parent_pose_index = parent_frame.get_pose_index();
   } else {
     // The parent is the world frame; register it as a root frame.
     source_root_frame_map_[source_id].insert(frame_id);
@@ -226,7 +232,11 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   X_WF_.emplace_back(Isometry3<double>::Identity());
   DRAKE_ASSERT(pose_index == static_cast<int>(pose_index_to_frame_map_.size()));
   pose_index_to_frame_map_.push_back(frame_id);
+  frame_geometry_indices_.emplace_back();
   f_set.insert(frame_id);
+  source_frame_order_map_[source_id].push_back(frame_id);
+  source_frame_updates_[source_id].push_back(
+      internal::FramePoseUpdate{pose_index, parent_pose_index});
   frames_.emplace(
       frame_id, InternalFrame(source_id, frame_id, frame.name(),
                               frame.frame_group(), pose_index, parent_id));
@@ -263,7 +273,9 @@ GeometryId GeometryState<T>::RegisterGeometry(
       geometry_engine_->AddDynamicGeometry(geometry->shape());
 
   // Configure topology.
-  frames_[frame_id].add_child(geometry_id);
+  InternalFrame& frame = frames_[frame_id];
+  frame.add_child(geometry_id);
+  frame_geometry_indices_[frame.get_pose_index()].push_back(engine_index);
   // TODO(SeanCurtis-TRI): Get name from geometry instance (when available).
   geometries_.emplace(
       geometry_id,
@@ -359,6 +371,24 @@ GeometryId GeometryState<T>::RegisterAnchoredGeometry(
   return geometry_id;
 }
 
+template <typename T>
+void GeometryState<T>::RemoveGeometry(SourceId source_id,
+                                      GeometryId geometry_id) {
+  if (anchored_geometries_.count(geometry_id) > 0) {
+    throw std::logic_error(
+        "Trying to remove anchored geometry " + to_string(geometry_id) +
+            "; only dynamic geometry can be removed.");
+  }
+  // This throws if the source or the geometry is not registered.
+  if (!BelongsToSource(geometry_id, source_id)) {
+    throw std::logic_error(
+        "Trying to remove geometry " + to_string(geometry_id) +
+            " from source " + to_string(source_id) +
+            ", but the geometry doesn't belong to that source.");
+  }
+  RemoveGeometryUnchecked(geometry_id);
+}
+
 template <typename T>
 bool GeometryState<T>::BelongsToSource(FrameId frame_id,
                                        SourceId source_id) const {
@@ -397,6 +427,57 @@ const FrameIdSet& GeometryState<T>::GetFramesForSource(
   return GetValueOrThrow(source_id, source_frame_id_map_);
 }
 
+template <typename T>
+const std::vector<FrameId>& GeometryState<T>::GetFramesInRegistrationOrder(
+    SourceId source_id) const {
+  return GetValueOrThrow(source_id, source_frame_order_map_);
+}
+
+template <typename T>
+void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id) {
+  // The children are removed first; the set is copied because removing a
+  // child modifies it.
+  const std::unordered_set<GeometryId> child_ids =
+      geometries_.at(geometry_id).get_child_geometry_ids();
+  for (GeometryId child_id : child_ids) {
+    RemoveGeometryUnchecked(child_id);
+  }
+
+  const InternalGeometry& geometry = geometries_.at(geometry_id);
+  if (geometry.get_parent_id()) {
+    geometries_.at(*geometry.get_parent_id()).remove_child(geometry_id);
+  }
+  InternalFrame& frame = frames_.at(geometry.get_frame_id());
+  frame.remove_child(geometry_id);
+  const GeometryIndex index = geometry.get_engine_index();
+  std::vector<GeometryIndex>& frame_indices =
+      frame_geometry_indices_[frame.get_pose_index()];
+  frame_indices.erase(
+      std::find(frame_indices.begin(), frame_indices.end(), index));
+
+  // The engine moves the geometry with the last index into the vacated index;
+  // the state's index-keyed data follows.
+  const optional<GeometryIndex> moved_from =
+      geometry_engine_->RemoveDynamicGeometry(index);
+  if (moved_from) {
+    const GeometryId moved_id = geometry_index_id_map_[*moved_from];
+    InternalGeometry& moved = geometries_.at(moved_id);
+    moved.set_engine_index(index);
+    std::vector<GeometryIndex>& moved_frame_indices =
+        frame_geometry_indices_[frames_.at(moved.get_frame_id())
+                                    .get_pose_index()];
+    *std::find(moved_frame_indices.begin(), moved_frame_indices.end(),
+               *moved_from) = index;
+    geometry_index_id_map_[index] = moved_id;
+    X_FG_[index] = X_FG_[*moved_from];
+    X_WG_[index] = X_WG_[*moved_from];
+  }
+  geometry_index_id_map_.pop_back();
+  X_FG_.pop_back();
+  X_WG_.pop_back();
+  geometries_.erase(geometry_id);
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
@@ -407,14 +488,65 @@ template <typename T>
 void GeometryState<T>::SetFramePoses(const FrameIdVector& ids,
                                      const FramePoseVector<T>& poses) {
   ValidateFramePoses(ids, poses);
-  const Isometry3<T> world_pose = Isometry3<T>::Identity();
-  for (auto frame_id : source_root_frame_map_[ids.get_source_id()]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, ids, poses);
+  const std::vector<internal::FramePoseUpdate>& updates =
+      GetValueOrThrow(ids.get_source_id(), source_frame_updates_);
+  const std::vector<FrameId>& frame_order =
+      GetValueOrThrow(ids.get_source_id(), source_frame_order_map_);
+  // Sources that report their frames in registration order (the common case)
+  // have the iᵗʰ pose belong to the iᵗʰ update; others pay one lookup per
+  // frame.
+  const bool in_order = IsInRegistrationOrder(ids);
+  const std::vector<Isometry3<T>>& X_PFs = poses.vector();
+  for (size_t i = 0; i < updates.size(); ++i) {
+    const internal::FramePoseUpdate& update = updates[i];
+    const int pose_slot =
+        in_order ? static_cast<int>(i) : ids.GetIndex(frame_order[i]);
+    const Isometry3<T>& X_PF = X_PFs[pose_slot];
+    // Cache this transform for later use.
+    X_PF_[update.pose_index] = X_PF;
+    Isometry3<T>& X_WF = X_WF_[update.pose_index];
+    if (update.parent_pose_index < 0) {
+      X_WF = X_PF;
+    } else {
+      X_WF = X_WF_[update.parent_pose_index] * X_PF;
+    }
+    // TODO(SeanCurtis-TRI): Replace this when we have a transform object that
+    // allows proper multiplication between an AutoDiff type and a double type.
+    // For now, it allows me to perform the multiplication by multiplying the
+    // fully-defined transformation (with [0 0 0 1] on the bottom row).
+    X_WF.makeAffine();
+
+    // Update the geometry which belong to *this* frame.
+    for (GeometryIndex child_index :
+         frame_geometry_indices_[update.pose_index]) {
+      // TODO(SeanCurtis-TRI): See note above about replacing this when we have
+      // a transform that supports autodiff * double.
+      X_FG_[child_index].makeAffine();
+      // TODO(SeanCurtis-TRI): These matrix() shennigans are here because I
+      // can't assign a an Isometry3<double> to an Isometry3<AutoDiffXd>.
+      // Replace this when I can.
+      X_WG_[child_index].matrix() =
+          X_WF.matrix() * X_FG_[child_index].matrix();
+    }
+  }
+}
+
+template <typename T>
+bool GeometryState<T>::IsInRegistrationOrder(const FrameIdVector& ids) const {
+  const auto iter = source_frame_order_map_.find(ids.get_source_id());
+  if (iter == source_frame_order_map_.end()) return false;
+  const std::vector<FrameId>& frame_order = iter->second;
+  if (ids.size() != static_cast<int>(frame_order.size())) return false;
+  for (int i = 0; i < ids.size(); ++i) {
+    if (ids.get_frame_id(i) != frame_order[i]) return false;
   }
+  return true;
 }
 
 template <typename T>
 void GeometryState<T>::ValidateFrameIds(const FrameIdVector& ids) const {
+  // The registration order is a valid ordering; it needs no set lookups.
+  if (IsInRegistrationOrder(ids)) return;
   SourceId source_id = ids.get_source_id();
   auto& frames = GetFramesForSource(source_id);
   const int ref_frame_count = static_cast<int>(frames.size());
@@ -459,40 +591,37 @@ SourceId GeometryState<T>::get_source_id(FrameId frame_id) const {
 }
 
 template <typename T>
-void GeometryState<T>::UpdatePosesRecursively(
-    const internal::InternalFrame& frame, const Isometry3<T>& X_WP,
-    const FrameIdVector& ids, const FramePoseVector<T>& poses) {
-  const auto frame_id = frame.get_id();
-  int index = ids.GetIndex(frame_id);
-  const auto& X_PF = poses.vector().at(index);
-  // Cache this transform for later use.
-  X_PF_[frame.get_pose_index()] = X_PF;
-  Isometry3<T> X_WF = X_WP * X_PF;
-  // TODO(SeanCurtis-TRI): Replace this when we have a transform object that
-  // allows proper multiplication between an AutoDiff type and a double type.
-  // For now, it allows me to perform the multiplication by multiplying the
-  // fully-defined transformation (with [0 0 0 1] on the bottom row).
-  X_WF.makeAffine();
-  X_WF_[frame.get_pose_index()] = X_WF;
-
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.get_child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    auto child_index = child_geometry.get_engine_index();
-    // TODO(SeanCurtis-TRI): See note above about replacing this when we have a
-    // transform that supports autodiff * double.
-    X_FG_[child_index].makeAffine();
-    // TODO(SeanCurtis-TRI): These matrix() shennigans are here because I can't
-    // assign a an Isometry3<double> to an Isometry3<AutoDiffXd>. Replace this
-    // when I can.
-    X_WG_[child_index].matrix() = X_WF.matrix() * X_FG_[child_index].matrix();
+std::vector<TimeOfImpact<double>> GeometryState<T>::ComputeTimesOfImpact(
+    const std::unordered_map<FrameId, Isometry3<double>>& X_WF_end,
+    int num_samples) const {
+  if (num_samples < 2) {
+    throw std::logic_error(
+        "Continuous collision requires at least two samples; given " +
+        to_string(num_samples));
   }
-
-  // Update each child frame.
-  for (auto child_id : frame.get_child_frames()) {
-    auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, ids, poses);
+  for (const auto& pair : X_WF_end) {
+    GetValueOrThrow(pair.first, frames_);
+  }
+  std::vector<Isometry3<double>> X_WG_end(X_WG_.size());
+  for (size_t i = 0; i < X_WG_end.size(); ++i) {
+    const FrameId frame_id =
+        geometries_.at(geometry_index_id_map_[i]).get_frame_id();
+    auto iter = X_WF_end.find(frame_id);
+    if (iter != X_WF_end.end()) {
+      X_WG_end[i] = iter->second * X_FG_[i];
+    } else {
+      // Geometry on frames without an end pose stays where it is.
+      for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+          X_WG_end[i].matrix()(r, c) =
+              ExtractDoubleOrThrow(X_WG_[i].matrix()(r, c));
+        }
+      }
+    }
   }
+  return geometry_engine_->ComputeTimesOfImpact(
+      geometry_index_id_map_, anchored_geometry_index_id_map_, X_WG_end,
+      num_samples);
 }
 
 }  // namespace geometry
@@ -62,6 +62,16 @@ class MapKeyRange {
   const std::unordered_map<K, V>* map_;
 };
 
+// The pose indices GeometryState needs to update the pose of one frame
+// without looking up the frame, or its parent, by id.
+struct FramePoseUpdate {
+  // The frame's index in the pose vectors.
+  PoseIndex pose_index;
+  // The parent frame's index in the pose vectors, or -1 if the parent is the
+  // world frame.
+  int parent_pose_index{-1};
+};
+
 }  // namespace internal
 #endif
 
@@ -320,6 +330,20 @@ class GeometryState {
       SourceId source_id,
       std::unique_ptr<GeometryInstance> geometry);
 
+  /** Removes the identified dynamic geometry from the state, along with all
+   of the geometries hung on it (recursively). The geometry engine is updated
+   in place; its cost does not grow with the number of geometries in the
+   state, beyond the logarithmic cost of updating the broadphase. Removal
+   changes the order of get_geometry_ids().
+   @param source_id    The id of the source to which the geometry belongs.
+   @param geometry_id  The id of the geometry to remove.
+   @throws std::logic_error  1. If the `source_id` does _not_ map to a
+                             registered source,
+                             2. the `geometry_id` does not map to a registered
+                             geometry, or maps to _anchored_ geometry, or
+                             3. the geometry does not belong to the source. */
+  void RemoveGeometry(SourceId source_id, GeometryId geometry_id);
+
   //@}
 
   /** @name       Relationship queries
@@ -360,6 +384,16 @@ class GeometryState {
                             source. */
   const FrameIdSet& GetFramesForSource(SourceId source_id) const;
 
+  /** Returns the frames registered to the given source, in the order in which
+   they were registered. A parent frame always precedes its children. A
+   FrameIdVector that lists the source's frames in this order lets the state
+   map each pose to its frame by position, without any id lookup.
+   @param source_id     The identifier of the source to query.
+   @throws std::logic_error If the `source_id` does _not_ map to a registered
+                            source. */
+  const std::vector<FrameId>& GetFramesInRegistrationOrder(
+      SourceId source_id) const;
+
   //@}
 
   //----------------------------------------------------------------------------
@@ -379,6 +413,20 @@ class GeometryState {
         geometry_index_id_map_, anchored_geometry_index_id_map_);
   }
 
+  /** See QueryObject::ComputeSignedDistancePairwiseClosestPoints() for
+   documentation. */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(double max_distance) const {
+    return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
+        geometry_index_id_map_, anchored_geometry_index_id_map_,
+        max_distance);
+  }
+
+  /** See QueryObject::ComputeTimesOfImpact() for documentation. */
+  std::vector<TimeOfImpact<double>> ComputeTimesOfImpact(
+      const std::unordered_map<FrameId, Isometry3<double>>& X_WF_end,
+      int num_samples) const;
+
   //@}
 
   /** @name Scalar conversion */
@@ -403,6 +451,8 @@ class GeometryState {
   GeometryState(const GeometryState<U>& source)
       : source_frame_id_map_(source.source_frame_id_map_),
         source_root_frame_map_(source.source_root_frame_map_),
+        source_frame_order_map_(source.source_frame_order_map_),
+        source_frame_updates_(source.source_frame_updates_),
         source_names_(source.source_names_),
         source_anchored_geometry_map_(source.source_anchored_geometry_map_),
         frames_(source.frames_),
@@ -412,6 +462,7 @@ class GeometryState {
         anchored_geometry_index_id_map_(source.anchored_geometry_index_id_map_),
         X_FG_(source.X_FG_),
         pose_index_to_frame_map_(source.pose_index_to_frame_map_),
+        frame_geometry_indices_(source.frame_geometry_indices_),
         geometry_engine_(std::move(source.geometry_engine_->ToAutoDiffXd())) {
     // NOTE: Can't assign Isometry3<double> to Isometry3<AutoDiff>. But we *can*
     // assign Matrix<double> to Matrix<AutoDiff>, so that's what we're doing.
@@ -453,6 +504,10 @@ class GeometryState {
   // @throws std::logic_error if the set is inconsistent with known topology.
   void ValidateFrameIds(const FrameIdVector& ids) const;
 
+  // Reports true if `ids` lists the frames of its source in registration
+  // order, i.e., the iᵗʰ id is the iᵗʰ frame registered on the source.
+  bool IsInRegistrationOrder(const FrameIdVector& ids) const;
+
   // Confirms that the pose data is consistent with the set of ids.
   // @param ids       The id set to test against.
   // @param poses     The poses to test.
@@ -469,13 +524,12 @@ class GeometryState {
   // frame belongs to no registered source.
   SourceId get_source_id(FrameId frame_id) const;
 
-  // Recursively updates the frame and geometry _pose_ information for the tree
-  // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
-  void UpdatePosesRecursively(const internal::InternalFrame& frame,
-                              const Isometry3<T>& X_WP,
-                              const FrameIdVector& ids,
-                              const FramePoseVector<T>& poses);
+  // Removes the dynamic geometry with the given id, and its descendants,
+  // without validating the id. The geometry's engine index is taken over by
+  // the geometry with the last engine index (see
+  // ProximityEngine::RemoveDynamicGeometry()).
+  void RemoveGeometryUnchecked(GeometryId geometry_id);
+
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
@@ -499,6 +553,15 @@ class GeometryState {
   // same values as the corresponding entry in source_frame_id_map_.
   std::unordered_map<SourceId, FrameIdSet> source_root_frame_map_;
 
+  // The frames registered on each source, in registration order; this is the
+  // order in which SetFramePoses() updates them. Because a parent frame must
+  // be registered before its children, each frame's parent pose has been
+  // updated by the time the frame itself is. The two maps are parallel: the
+  // iᵗʰ update belongs to the iᵗʰ frame.
+  std::unordered_map<SourceId, std::vector<FrameId>> source_frame_order_map_;
+  std::unordered_map<SourceId, std::vector<internal::FramePoseUpdate>>
+      source_frame_updates_;
+
   // The registered geometry source names. Each name is unique and the keys in
   // this map should be identical to those in source_frame_id_map_ and
   // source_root_frame_map_.
@@ -553,6 +616,10 @@ class GeometryState {
   //      index of this vector.
   std::vector<FrameId> pose_index_to_frame_map_;
 
+  // The engine indices of the dynamic geometries rigidly affixed to each frame,
+  // indexed by the frame's pose index.
+  std::vector<std::vector<GeometryIndex>> frame_geometry_indices_;
+
   // ---------------------------------------------------------------------
   // These values depend on time-dependent input values (e.g., current frame
   // poses).
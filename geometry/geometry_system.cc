@@ -199,6 +199,28 @@ GeometryId GeometrySystem<T>::RegisterAnchoredGeometry(
                                                   std::move(geometry));
 }
 
+template <typename T>
+void GeometrySystem<T>::RemoveGeometry(SourceId source_id,
+                                       GeometryId geometry_id) {
+  GS_THROW_IF_CONTEXT_ALLOCATED
+  initial_state_->RemoveGeometry(source_id, geometry_id);
+}
+
+template <typename T>
+GeometryId GeometrySystem<T>::RegisterGeometry(
+    Context<T>* context, SourceId source_id, FrameId frame_id,
+    std::unique_ptr<GeometryInstance> geometry) {
+  return get_mutable_geometry_state(context).RegisterGeometry(
+      source_id, frame_id, std::move(geometry));
+}
+
+template <typename T>
+void GeometrySystem<T>::RemoveGeometry(Context<T>* context,
+                                       SourceId source_id,
+                                       GeometryId geometry_id) {
+  get_mutable_geometry_state(context).RemoveGeometry(source_id, geometry_id);
+}
+
 template <typename T>
 void GeometrySystem<T>::MakeSourcePorts(SourceId source_id) {
   // This will fail only if the source generator starts recycling source ids.
@@ -361,6 +383,15 @@ void GeometrySystem<T>::ThrowUnlessRegistered(SourceId source_id,
   }
 }
 
+template <typename T>
+GeometryState<T>& GeometrySystem<T>::get_mutable_geometry_state(
+    Context<T>* context) const {
+  DRAKE_DEMAND(context != nullptr);
+  auto* g_context = dynamic_cast<GeometryContext<T>*>(context);
+  DRAKE_DEMAND(g_context != nullptr);
+  return g_context->get_mutable_geometry_state();
+}
+
 // Explicitly instantiates on the most common scalar types.
 template class GeometrySystem<double>;
 template class GeometrySystem<AutoDiffXd>;
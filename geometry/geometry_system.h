@@ -278,9 +278,13 @@ class GeometrySystem final : public systems::LeafSystem<T> {
    This includes registering a new geometry source, adding or
    removing frames, and adding or removing geometries.
 
-   Currently, the topology can only be manipulated during initialization.
-   Eventually, the API will expand to include modifications of the topology
-   during discrete updates.
+   Sources, frames and anchored geometry can only be registered during
+   initialization. Dynamic geometry can also be added to and removed from an
+   allocated context, e.g., to spawn and despawn objects during a simulation,
+   through the overloads that take a context. Those modify the context's
+   geometry state in place: the cost of a change does not grow with the
+   number of geometries in the context, beyond the logarithmic cost of
+   updating the broadphase, and no copy of the state is made.
 
    The initialization phase begins with the instantiation of a %GeometrySystem
    and ends when a context is allocated by the %GeometrySystem instance. This is
@@ -379,6 +383,56 @@ class GeometrySystem final : public systems::LeafSystem<T> {
       SourceId source_id,
       std::unique_ptr<GeometryInstance> geometry);
 
+  /** Removes the given geometry G (and all of the geometries hung on it) from
+   the indicated source's geometries.
+   @param source_id   The identifier for the owner geometry source.
+   @param geometry_id The identifier of the dynamic geometry to remove.
+   @throws std::logic_error  1. the `source_id` does _not_ map to a registered
+                             source,
+                             2. the `geometry_id` does not map to a valid
+                             dynamic geometry,
+                             3. the `geometry_id` maps to a geometry that does
+                             not belong to the indicated source, or
+                             4. a context has been allocated. */
+  void RemoveGeometry(SourceId source_id, GeometryId geometry_id);
+
+  /** Registers a new geometry G for this source in the given `context`. This
+   is the same as RegisterGeometry(SourceId, FrameId,
+   std::unique_ptr<GeometryInstance>), except that it applies to the state of
+   an allocated context (e.g., in an unrestricted update) instead of the
+   default state, which is unchanged.
+   @param context     The context whose geometry state is modified; it must
+                      have been allocated by this system.
+   @param source_id   The id for the source registering the geometry.
+   @param frame_id    The id for the frame F to hang the geometry on.
+   @param geometry    The geometry G to affix to frame F.
+   @return A unique identifier for the added geometry.
+   @throws std::logic_error  1. the `source_id` does _not_ map to a registered
+                             source,
+                             2. the `frame_id` doesn't belong to the source,
+                             or
+                             3. the `geometry` is equal to `nullptr`. */
+  GeometryId RegisterGeometry(systems::Context<T>* context,
+                              SourceId source_id, FrameId frame_id,
+                              std::unique_ptr<GeometryInstance> geometry);
+
+  /** Removes the given geometry G (and all of the geometries hung on it) from
+   the given `context`. This is the same as RemoveGeometry(SourceId,
+   GeometryId), except that it applies to the state of an allocated context
+   instead of the default state, which is unchanged.
+   @param context     The context whose geometry state is modified; it must
+                      have been allocated by this system.
+   @param source_id   The identifier for the owner geometry source.
+   @param geometry_id The identifier of the dynamic geometry to remove.
+   @throws std::logic_error  1. the `source_id` does _not_ map to a registered
+                             source,
+                             2. the `geometry_id` does not map to a valid
+                             dynamic geometry, or
+                             3. the `geometry_id` maps to a geometry that does
+                             not belong to the indicated source. */
+  void RemoveGeometry(systems::Context<T>* context, SourceId source_id,
+                      GeometryId geometry_id);
+
   //@}
 
  private:
@@ -444,6 +498,11 @@ class GeometrySystem final : public systems::LeafSystem<T> {
   // message is the given message with the source_id appended if not.
   void ThrowUnlessRegistered(SourceId source_id, const char *message) const;
 
+  // Returns the mutable geometry state of the given context, which must be a
+  // GeometryContext.
+  GeometryState<T>& get_mutable_geometry_state(
+      systems::Context<T>* context) const;
+
   // A struct that stores the port indices for a given source.
   // TODO(SeanCurtis-TRI): Consider making these TypeSafeIndex values.
   struct SourcePorts {
@@ -97,6 +97,15 @@ class ShapeToLcm : public ShapeReifier {
     geometry_data_.string_data = mesh.filename();
   }
 
+  void ImplementGeometry(const Convex& convex, void*) override {
+    geometry_data_.type = geometry_data_.MESH;
+    geometry_data_.num_float_data = 3;
+    geometry_data_.float_data.push_back(static_cast<float>(convex.scale()));
+    geometry_data_.float_data.push_back(static_cast<float>(convex.scale()));
+    geometry_data_.float_data.push_back(static_cast<float>(convex.scale()));
+    geometry_data_.string_data = convex.filename();
+  }
+
  private:
   lcmt_viewer_geometry_data geometry_data_{};
   // The transform from the geometry frame to its parent frame.
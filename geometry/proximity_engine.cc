@@ -1,12 +1,20 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
 #include <fcl/fcl.h>
+#include <tiny_obj_loader.h>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/never_destroyed.h"
 
 namespace drake {
 namespace geometry {
@@ -54,6 +62,13 @@ class EncodedData {
   explicit EncodedData(const fcl::CollisionObject<double>& fcl_object)
       : data_(reinterpret_cast<uintptr_t>(fcl_object.getUserData())) {}
 
+  // Reconstructs the encoding from the raw user data value of an object.
+  static EncodedData FromUserData(uintptr_t data) {
+    EncodedData encoding(0, false);
+    encoding.data_ = data;
+    return encoding;
+  }
+
   // Sets the encoded data to be dynamic.
   void set_dynamic() { data_ |= kIsDynamicMask; }
 
@@ -120,6 +135,58 @@ struct CollisionData {
   std::vector<PenetrationAsPointPair<double>>* contacts{};
 };
 
+// Performs the narrowphase penetration test between the two given objects
+// and, if they are penetrating, appends the characterizing point pair to the
+// collision data's contacts.
+void ComputeNarrowPhasePenetration(const fcl::CollisionObjectd& fcl_object_A,
+                                   const fcl::CollisionObjectd& fcl_object_B,
+                                   CollisionData* collision_data) {
+  const fcl::CollisionRequestd& request = collision_data->request;
+  const std::vector<GeometryId>& dynamic_map = collision_data->dynamic_map;
+  const std::vector<GeometryId>& anchored_map = collision_data->anchored_map;
+
+  // This function only works for a single contact, this confirms a request
+  // hasn't been made for more contacts.
+  DRAKE_ASSERT(request.num_max_contacts == 1);
+  fcl::CollisionResultd result;
+
+  // Perform nearphase collision detection
+  fcl::collide(&fcl_object_A, &fcl_object_B, request, result);
+
+  // Process the contact points
+  if (result.isCollision()) {
+    // NOTE: This assumes that the request is configured to use a single
+    // contact.
+    const fcl::Contactd& contact = result.getContact(0);
+    //  By convention, Drake requires the contact normal to point out of B and
+    //  into A. FCL uses the opposite convention.
+    Vector3d drake_normal = -contact.normal;
+
+    // Signed distance is negative when penetration depth is positive.
+    double depth = contact.penetration_depth;
+
+    // FCL returns a single contact point, but PenetrationAsPointPair expects
+    // two, one on the surface of body A (Ac) and one on the surface of body B
+    // (Bc). Choose points along the line defined by the contact point and
+    // normal, equidistant to the contact point. Recall that signed_distance
+    // is strictly non-positive, so signed_distance * drake_normal points out
+    // of A and into B.
+    const Vector3d p_WAc{contact.pos - 0.5 * depth * drake_normal};
+    const Vector3d p_WBc{contact.pos + 0.5 * depth * drake_normal};
+
+    PenetrationAsPointPair<double> penetration;
+    penetration.depth = depth;
+    // The engine doesn't know geometry ids; it returns engine indices. The
+    // caller must map engine indices to geometry ids.
+    penetration.id_A = EncodedData(fcl_object_A).id(dynamic_map, anchored_map);
+    penetration.id_B = EncodedData(fcl_object_B).id(dynamic_map, anchored_map);
+    penetration.p_WCa = p_WAc;
+    penetration.p_WCb = p_WBc;
+    penetration.nhat_BA_W = drake_normal;
+    collision_data->contacts->emplace_back(std::move(penetration));
+  }
+}
+
 // Callback function for FCL's collide() function for retrieving a *single*
 // contact.
 bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
@@ -136,54 +203,8 @@ bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   const bool is_filtered = false;
 
   if (!is_filtered) {
-    // Unpack the callback data
-    auto& collision_data = *static_cast<CollisionData*>(callback_data);
-    const fcl::CollisionRequestd& request = collision_data.request;
-    const std::vector<GeometryId> dynamic_map = collision_data.dynamic_map;
-    const std::vector<GeometryId> anchored_map = collision_data.anchored_map;
-
-    // This callback only works for a single contact, this confirms a request
-    // hasn't been made for more contacts.
-    DRAKE_ASSERT(request.num_max_contacts == 1);
-    fcl::CollisionResultd result;
-
-    // Perform nearphase collision detection
-    fcl::collide(&fcl_object_A, &fcl_object_B, request, result);
-
-    // Process the contact points
-    if (result.isCollision()) {
-      // NOTE: This assumes that the request is configured to use a single
-      // contact.
-      const fcl::Contactd& contact = result.getContact(0);
-      //  By convention, Drake requires the contact normal to point out of B and
-      //  into A. FCL uses the opposite convention.
-      Vector3d drake_normal = -contact.normal;
-
-      // Signed distance is negative when penetration depth is positive.
-      double depth = contact.penetration_depth;
-
-      // FCL returns a single contact point, but PenetrationAsPointPair expects
-      // two, one on the surface of body A (Ac) and one on the surface of body B
-      // (Bc). Choose points along the line defined by the contact point and
-      // normal, equidistant to the contact point. Recall that signed_distance
-      // is strictly non-positive, so signed_distance * drake_normal points out
-      // of A and into B.
-      const Vector3d p_WAc{contact.pos - 0.5 * depth * drake_normal};
-      const Vector3d p_WBc{contact.pos + 0.5 * depth * drake_normal};
-
-      PenetrationAsPointPair<double> penetration;
-      penetration.depth = depth;
-      // The engine doesn't know geometry ids; it returns engine indices. The
-      // caller must map engine indices to geometry ids.
-      penetration.id_A =
-          EncodedData(fcl_object_A).id(dynamic_map, anchored_map);
-      penetration.id_B =
-          EncodedData(fcl_object_B).id(dynamic_map, anchored_map);
-      penetration.p_WCa = p_WAc;
-      penetration.p_WCb = p_WBc;
-      penetration.nhat_BA_W = drake_normal;
-      collision_data.contacts->emplace_back(std::move(penetration));
-    }
+    ComputeNarrowPhasePenetration(fcl_object_A, fcl_object_B,
+                                  static_cast<CollisionData*>(callback_data));
   }
 
   // Returning true would tell the broadphase manager to terminate early. Since
@@ -192,31 +213,340 @@ bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   return false;
 }
 
+// A broadphase candidate: a pair of collision objects whose bounding volumes
+// overlap, identified by their encoded user data (rather than by pointer) so
+// that the list remains valid when the engine is copied.
+using CandidatePair = std::pair<uintptr_t, uintptr_t>;
+
+// Returns the canonical (ordered) candidate pair for the two objects.
+CandidatePair MakeCandidatePair(const fcl::CollisionObjectd& a,
+                                const fcl::CollisionObjectd& b) {
+  const uintptr_t data_a = reinterpret_cast<uintptr_t>(a.getUserData());
+  const uintptr_t data_b = reinterpret_cast<uintptr_t>(b.getUserData());
+  return data_a < data_b ? CandidatePair(data_a, data_b)
+                         : CandidatePair(data_b, data_a);
+}
+
+// Callback function for FCL's collide() function that records broadphase
+// candidate pairs without performing any narrowphase work.
+bool CandidateCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                       fcl::CollisionObjectd* fcl_object_B_ptr,
+                       void* callback_data) {
+  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
+  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
+  // Querying a single object against the tree that contains it reports the
+  // object against itself.
+  if (&fcl_object_A == &fcl_object_B) return false;
+
+  // TODO(SeanCurtis-TRI): Introduce collision filtering here.
+  auto& candidates = *static_cast<std::vector<CandidatePair>*>(callback_data);
+  candidates.push_back(MakeCandidatePair(fcl_object_A, fcl_object_B));
+  return false;
+}
+
+// Struct for use in SignedDistanceCallback(). Contains the distance threshold
+// and accumulates results in a SignedDistancePair vector.
+struct DistanceData {
+  DistanceData(const std::vector<GeometryId>* dynamic_map_in,
+               const std::vector<GeometryId>* anchored_map_in,
+               double max_distance_in)
+      : dynamic_map(*dynamic_map_in),
+        anchored_map(*anchored_map_in),
+        max_distance(max_distance_in) {}
+  // Maps so the distance call back can map from engine index to geometry id.
+  const std::vector<GeometryId>& dynamic_map;
+  const std::vector<GeometryId>& anchored_map;
+
+  // Pairs farther apart than this distance are not reported.
+  const double max_distance;
+
+  // Vector of distance results
+  std::vector<SignedDistancePair<double>>* distances{};
+};
+
+// Performs the narrowphase signed distance computation between the two given
+// objects and, if their signed distance does not exceed the threshold, appends
+// the result to the distance data's results.
+void ComputeNarrowPhaseSignedDistance(const fcl::CollisionObjectd& fcl_object_A,
+                                      const fcl::CollisionObjectd& fcl_object_B,
+                                      DistanceData* distance_data) {
+  // TODO(SeanCurtis-TRI): The version of FCL in use doesn't compute distance
+  // to half spaces; remove this when it does.
+  if (fcl_object_A.getNodeType() == fcl::GEOM_HALFSPACE ||
+      fcl_object_B.getNodeType() == fcl::GEOM_HALFSPACE) {
+    throw std::logic_error(
+        "Signed distance queries involving half spaces are not supported");
+  }
+
+  SignedDistancePair<double> pair;
+  fcl::DistanceRequestd request;
+  request.enable_nearest_points = true;
+  fcl::DistanceResultd result;
+  fcl::distance(&fcl_object_A, &fcl_object_B, request, result);
+
+  if (result.min_distance > 0) {
+    if (result.min_distance > distance_data->max_distance) return;
+    pair.distance = result.min_distance;
+    pair.p_WCa = result.nearest_points[0];
+    pair.p_WCb = result.nearest_points[1];
+  } else {
+    // FCL doesn't report a meaningful distance for intersecting objects; the
+    // signed distance is the negative penetration depth, characterized the
+    // same way as in ComputeNarrowPhasePenetration().
+    fcl::CollisionRequestd collision_request;
+    collision_request.num_max_contacts = 1;
+    collision_request.enable_contact = true;
+    fcl::CollisionResultd collision_result;
+    fcl::collide(&fcl_object_A, &fcl_object_B, collision_request,
+                 collision_result);
+    if (collision_result.isCollision()) {
+      const fcl::Contactd& contact = collision_result.getContact(0);
+      const Vector3d drake_normal = -contact.normal;
+      const double depth = contact.penetration_depth;
+      pair.distance = -depth;
+      pair.p_WCa = contact.pos - 0.5 * depth * drake_normal;
+      pair.p_WCb = contact.pos + 0.5 * depth * drake_normal;
+    } else {
+      // The objects are touching.
+      pair.distance = 0;
+      pair.p_WCa = result.nearest_points[0];
+      pair.p_WCb = result.nearest_points[1];
+    }
+  }
+  pair.id_A =
+      EncodedData(fcl_object_A).id(distance_data->dynamic_map,
+                                   distance_data->anchored_map);
+  pair.id_B =
+      EncodedData(fcl_object_B).id(distance_data->dynamic_map,
+                                   distance_data->anchored_map);
+  distance_data->distances->emplace_back(std::move(pair));
+}
+
+// Callback function for FCL's distance() function for computing the signed
+// distance of every pair of objects closer than the threshold.
+bool SignedDistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                            fcl::CollisionObjectd* fcl_object_B_ptr,
+                            void* callback_data, double& dist) {
+  auto& distance_data = *static_cast<DistanceData*>(callback_data);
+  // The broadphase manager skips all subtrees whose bounding volumes are
+  // farther apart than `dist`. Ordinarily, that is the smallest distance found
+  // so far; fixing it at the threshold instead visits every pair that could
+  // possibly be within the threshold.
+  dist = distance_data.max_distance;
+
+  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
+  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
+  if (&fcl_object_A == &fcl_object_B) return false;
+
+  // TODO(SeanCurtis-TRI): Introduce collision filtering here; this must share
+  // the filter with SingleCollisionCallback().
+
+  // The manager doesn't test the bounding volumes of leaf pairs before
+  // invoking the callback.
+  if (fcl_object_A.getAABB().distance(fcl_object_B.getAABB()) >
+      distance_data.max_distance) {
+    return false;
+  }
+
+  ComputeNarrowPhaseSignedDistance(fcl_object_A, fcl_object_B, &distance_data);
+
+  // Returning true would tell the broadphase manager to terminate early.
+  return false;
+}
+
+// The region swept by a collision object over a motion, for the broadphase of
+// the continuous collision queries.
+struct SweptObject {
+  // The bounding box of the swept region.
+  Vector3d min;
+  Vector3d max;
+  const fcl::CollisionObjectd* object{};
+  // The poses at the start and the end of the motion.
+  Isometry3<double> X_WG_begin;
+  Isometry3<double> X_WG_end;
+};
+
+// Returns the swept region of the given object as it moves from its current
+// pose to `X_WG_end`. The object stays within a sphere about its origin,
+// whose radius is the farthest corner of its current bounding box, so the
+// region is bounded by that sphere swept along the straight path of the
+// origin.
+SweptObject MakeSweptObject(const fcl::CollisionObjectd& object,
+                            const Isometry3<double>& X_WG_end) {
+  SweptObject swept;
+  swept.object = &object;
+  swept.X_WG_begin = object.getTransform();
+  swept.X_WG_end = X_WG_end;
+  const fcl::AABBd& aabb = object.getAABB();
+  const Vector3d p_WGo = swept.X_WG_begin.translation();
+  const double radius =
+      (aabb.min_ - p_WGo).cwiseAbs().cwiseMax((aabb.max_ - p_WGo).cwiseAbs())
+          .norm();
+  const Vector3d p_WGo_end = X_WG_end.translation();
+  swept.min = (p_WGo.cwiseMin(p_WGo_end).array() - radius).matrix();
+  swept.max = (p_WGo.cwiseMax(p_WGo_end).array() + radius).matrix();
+  return swept;
+}
+
+// Returns the region of an object that doesn't move.
+SweptObject MakeStationaryObject(const fcl::CollisionObjectd& object) {
+  SweptObject swept;
+  swept.object = &object;
+  swept.X_WG_begin = object.getTransform();
+  swept.X_WG_end = swept.X_WG_begin;
+  swept.min = object.getAABB().min_;
+  swept.max = object.getAABB().max_;
+  return swept;
+}
+
+// Reads the vertices (scaled by `scale`) and the polygonal faces of the named
+// Wavefront OBJ file; all of the objects in the file are merged.
+void ReadObjFile(const std::string& filename, double scale,
+                 std::vector<Vector3d>* vertices,
+                 std::vector<std::vector<int>>* faces) {
+  tinyobj::attrib_t attrib;
+  std::vector<tinyobj::shape_t> shapes;
+  std::vector<tinyobj::material_t> materials;
+  std::string err;
+  const bool triangulate = false;
+  if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &err, filename.c_str(),
+                        nullptr, triangulate) ||
+      attrib.vertices.empty()) {
+    throw std::runtime_error("Error parsing collision mesh \"" + filename +
+                             "\": " + err);
+  }
+  for (size_t i = 0; i < attrib.vertices.size(); i += 3) {
+    vertices->emplace_back(scale * attrib.vertices[i],
+                           scale * attrib.vertices[i + 1],
+                           scale * attrib.vertices[i + 2]);
+  }
+  for (const tinyobj::shape_t& shape : shapes) {
+    size_t index_offset = 0;
+    for (const unsigned char face_size : shape.mesh.num_face_vertices) {
+      std::vector<int> face;
+      for (size_t i = index_offset; i < index_offset + face_size; ++i) {
+        face.push_back(shape.mesh.indices[i].vertex_index);
+      }
+      index_offset += face_size;
+      faces->push_back(move(face));
+    }
+  }
+}
+
+// Returns a bounding volume hierarchy of the triangles of the named OBJ file.
+// Polygonal faces are assumed to be convex, and are triangulated as fans.
+shared_ptr<fcl::CollisionGeometryd> MakeFclMesh(const std::string& filename,
+                                                double scale) {
+  std::vector<Vector3d> vertices;
+  std::vector<std::vector<int>> faces;
+  ReadObjFile(filename, scale, &vertices, &faces);
+  std::vector<fcl::Triangle> triangles;
+  for (const std::vector<int>& face : faces) {
+    for (size_t i = 2; i < face.size(); ++i) {
+      triangles.emplace_back(face[0], face[i - 1], face[i]);
+    }
+  }
+  auto mesh = make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
+  mesh->beginModel(static_cast<int>(triangles.size()),
+                   static_cast<int>(vertices.size()));
+  mesh->addSubModel(vertices, triangles);
+  mesh->endModel();
+  mesh->computeLocalAABB();
+  return mesh;
+}
+
+// An fcl::Convexd together with the arrays that it refers to (but doesn't
+// own).
+struct ConvexData {
+  std::vector<Vector3d> vertices;
+  std::vector<Vector3d> plane_normals;
+  std::vector<double> plane_offsets;
+  // Each face as its vertex count followed by its vertex indices.
+  std::vector<int> polygons;
+  unique_ptr<fcl::Convexd> convex;
+};
+
+// Returns the convex polyhedron of the named OBJ file, whose faces are assumed
+// to be wound counter-clockwise when viewed from outside.
+shared_ptr<fcl::CollisionGeometryd> MakeFclConvex(const std::string& filename,
+                                                  double scale) {
+  auto data = make_shared<ConvexData>();
+  std::vector<std::vector<int>> faces;
+  ReadObjFile(filename, scale, &data->vertices, &faces);
+  for (const std::vector<int>& face : faces) {
+    if (face.size() < 3) {
+      throw std::runtime_error("Convex collision mesh \"" + filename +
+                               "\" has a degenerate face");
+    }
+    const Vector3d& p0 = data->vertices.at(face[0]);
+    const Vector3d normal = (data->vertices.at(face[1]) - p0)
+                                .cross(data->vertices.at(face[2]) - p0)
+                                .normalized();
+    data->plane_normals.push_back(normal);
+    data->plane_offsets.push_back(normal.dot(p0));
+    data->polygons.push_back(static_cast<int>(face.size()));
+    data->polygons.insert(data->polygons.end(), face.begin(), face.end());
+  }
+  data->convex = make_unique<fcl::Convexd>(
+      data->plane_normals.data(), data->plane_offsets.data(),
+      static_cast<int>(faces.size()), data->vertices.data(),
+      static_cast<int>(data->vertices.size()), data->polygons.data());
+  data->convex->computeLocalAABB();
+  // The returned pointer keeps the arrays alive along with the convex shape.
+  return shared_ptr<fcl::CollisionGeometryd>(data, data->convex.get());
+}
+
+// Returns the collision geometry of the named OBJ file, as a mesh or as a
+// convex shape. Each file is loaded once per process (for each scale); the
+// geometry is shared by every collision object that refers to the file, and is
+// never modified once it has been created.
+shared_ptr<fcl::CollisionGeometryd> GetMeshGeometry(const std::string& filename,
+                                                    double scale,
+                                                    bool is_convex) {
+  using Key = std::tuple<std::string, double, bool>;
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<std::map<Key, shared_ptr<fcl::CollisionGeometryd>>>
+      cache;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  const Key key(filename, scale, is_convex);
+  auto iter = cache.access().find(key);
+  if (iter == cache.access().end()) {
+    shared_ptr<fcl::CollisionGeometryd> geometry =
+        is_convex ? MakeFclConvex(filename, scale)
+                  : MakeFclMesh(filename, scale);
+    iter = cache.access().emplace(key, move(geometry)).first;
+  }
+  return iter->second;
+}
+
 // Returns a copy of the given fcl collision geometry; throws an exception for
 // unsupported collision geometry types. This supplements the *missing* cloning
 // functionality in FCL. Issue has been submitted to FCL:
 // https://github.com/flexible-collision-library/fcl/issues/246
-shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
-    const fcl::CollisionGeometryd& geometry) {
+// Geometry loaded from mesh files is immutable and shared, so it isn't copied.
+shared_ptr<fcl::CollisionGeometryd> CopyShapeOrThrow(
+    const shared_ptr<fcl::CollisionGeometryd>& geometry) {
   // NOTE: Returns a shared pointer because of the FCL API in assigning
   // collision geometry to collision objects.
-  switch (geometry.getNodeType()) {
+  switch (geometry->getNodeType()) {
     case fcl::GEOM_SPHERE: {
-      const auto& sphere = dynamic_cast<const fcl::Sphered&>(geometry);
+      const auto& sphere = dynamic_cast<const fcl::Sphered&>(*geometry);
       return make_shared<fcl::Sphered>(sphere.radius);
     }
     case fcl::GEOM_CYLINDER: {
-      const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
+      const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(*geometry);
       return make_shared<fcl::Cylinderd>(cylinder.radius, cylinder.lz);
     }
     case fcl::GEOM_HALFSPACE:
       // All half spaces are defined exactly the same.
       return make_shared<fcl::Halfspaced>(0, 0, 1, 0);
+    case fcl::GEOM_CONVEX:
+    case fcl::BV_OBBRSS:
+      return geometry;
     case fcl::GEOM_BOX:
     case fcl::GEOM_ELLIPSOID:
     case fcl::GEOM_CAPSULE:
     case fcl::GEOM_CONE:
-    case fcl::GEOM_CONVEX:
     case fcl::GEOM_PLANE:
     case fcl::GEOM_TRIANGLE:
       throw std::logic_error(
@@ -230,8 +560,8 @@ shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
 // Helper function that creates a *deep* copy of the given collision object.
 unique_ptr<fcl::CollisionObjectd> CopyFclObjectOrThrow(
     const fcl::CollisionObjectd& object) {
-  shared_ptr<fcl::ShapeBased> geometry_copy =
-      CopyShapeOrThrow(*object.collisionGeometry());
+  shared_ptr<fcl::CollisionGeometryd> geometry_copy =
+      CopyShapeOrThrow(object.collisionGeometry());
   auto copy = make_unique<fcl::CollisionObjectd>(geometry_copy);
   copy->setUserData(object.getUserData());
   copy->setTransform(object.getTransform());
@@ -272,6 +602,74 @@ void BuildTreeFromReference(
   }
 }
 
+// Returns the position in the world frame W, on scalar type T, of the point C
+// that is at `p_WC` when its geometry G is at the pose `X_WG_value` and that
+// moves rigidly with G, whose pose on T is `X_WG`.
+template <typename T>
+Vector3<T> MoveWithGeometry(const Vector3d& p_WC,
+                            const Isometry3<double>& X_WG_value,
+                            const Isometry3<T>& X_WG) {
+  const Vector3d p_GC = X_WG_value.inverse() * p_WC;
+  return X_WG * p_GC.cast<T>();
+}
+
+// Returns the penetration computed on double values, with the derivatives of
+// the poses X_WA and X_WB of the two geometries (whose values are X_WA_value
+// and X_WB_value). See ComputePointPairPenetrationWithDerivatives().
+template <typename T>
+PenetrationAsPointPair<T> AddPoseDerivatives(
+    const PenetrationAsPointPair<double>& penetration,
+    const Isometry3<double>& X_WA_value, const Isometry3<T>& X_WA,
+    const Isometry3<double>& X_WB_value, const Isometry3<T>& X_WB) {
+  PenetrationAsPointPair<T> result;
+  result.id_A = penetration.id_A;
+  result.id_B = penetration.id_B;
+  result.p_WCa = MoveWithGeometry(penetration.p_WCa, X_WA_value, X_WA);
+  result.p_WCb = MoveWithGeometry(penetration.p_WCb, X_WB_value, X_WB);
+  const Vector3d nhat_BA_B =
+      X_WB_value.linear().transpose() * penetration.nhat_BA_W;
+  result.nhat_BA_W = X_WB.linear() * nhat_BA_B.cast<T>();
+  result.depth = (result.p_WCb - result.p_WCa).dot(result.nhat_BA_W);
+  return result;
+}
+
+// Returns the signed distance computed on double values, with the derivatives
+// of the poses of the two geometries. See
+// ComputeSignedDistancePairwiseClosestPointsWithDerivatives().
+template <typename T>
+SignedDistancePair<T> AddPoseDerivatives(
+    const SignedDistancePair<double>& pair,
+    const Isometry3<double>& X_WA_value, const Isometry3<T>& X_WA,
+    const Isometry3<double>& X_WB_value, const Isometry3<T>& X_WB) {
+  SignedDistancePair<T> result;
+  result.id_A = pair.id_A;
+  result.id_B = pair.id_B;
+  result.p_WCa = MoveWithGeometry(pair.p_WCa, X_WA_value, X_WA);
+  result.p_WCb = MoveWithGeometry(pair.p_WCb, X_WB_value, X_WB);
+  if (pair.distance == 0) {
+    result.distance = T(0);
+  } else {
+    const T norm = (result.p_WCb - result.p_WCa).norm();
+    result.distance = pair.distance > 0 ? norm : T(-norm);
+  }
+  return result;
+}
+
+// On double, the results of the queries are already final.
+PenetrationAsPointPair<double> AddPoseDerivatives(
+    const PenetrationAsPointPair<double>& penetration,
+    const Isometry3<double>&, const Isometry3<double>&,
+    const Isometry3<double>&, const Isometry3<double>&) {
+  return penetration;
+}
+
+SignedDistancePair<double> AddPoseDerivatives(
+    const SignedDistancePair<double>& pair, const Isometry3<double>&,
+    const Isometry3<double>&, const Isometry3<double>&,
+    const Isometry3<double>&) {
+  return pair;
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -300,6 +698,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
+
+    X_WG_ = other.X_WG_;
+
+    // The candidate pairs are stored by encoded index, so they remain valid.
+    incremental_broadphase_ = other.incremental_broadphase_;
+    candidates_are_valid_ = other.candidates_are_valid_;
+    candidates_ = other.candidates_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -327,6 +732,17 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
 
+    // The poses of the new engine have no derivatives.
+    engine->X_WG_.reserve(dynamic_objects_.size());
+    for (const auto& object : dynamic_objects_) {
+      engine->X_WG_.push_back(
+          Isometry3<double>(object->getTransform()).cast<AutoDiffXd>());
+    }
+
+    engine->incremental_broadphase_ = incremental_broadphase_;
+    engine->candidates_are_valid_ = candidates_are_valid_;
+    engine->candidates_ = candidates_;
+
     return engine;
   }
 
@@ -339,6 +755,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     GeometryIndex index(static_cast<int>(dynamic_objects_.size()));
     EncodedData(index, true /* is dynamic */).store_in(fcl_object.get());
     dynamic_objects_.emplace_back(std::move(fcl_object));
+    X_WG_.push_back(Isometry3<T>::Identity());
+    if (candidates_are_valid_) AddCandidatesOf(dynamic_objects_.back().get());
 
     return index;
   }
@@ -354,10 +772,33 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     AnchoredGeometryIndex index(static_cast<int>(anchored_objects_.size()));
     EncodedData(index, false /* is dynamic */).store_in(fcl_object.get());
     anchored_objects_.emplace_back(std::move(fcl_object));
+    candidates_are_valid_ = false;
 
     return index;
   }
 
+  optional<GeometryIndex> RemoveDynamicGeometry(GeometryIndex index) {
+    DRAKE_DEMAND(0 <= index && index < num_dynamic());
+    const int last = num_dynamic() - 1;
+    dynamic_tree_.unregisterObject(dynamic_objects_[index].get());
+    if (candidates_are_valid_) {
+      RemoveCandidatesOf(*dynamic_objects_[index], *dynamic_objects_[last]);
+    }
+    optional<GeometryIndex> moved_from;
+    if (index != last) {
+      // The last object takes over the removed object's index; its position
+      // in the tree does not depend on its index.
+      dynamic_objects_[index] = std::move(dynamic_objects_[last]);
+      EncodedData(index, true /* is dynamic */)
+          .store_in(dynamic_objects_[index].get());
+      X_WG_[index] = X_WG_[last];
+      moved_from = GeometryIndex(last);
+    }
+    dynamic_objects_.pop_back();
+    X_WG_.pop_back();
+    return moved_from;
+  }
+
   int num_geometries() const {
     return static_cast<int>(dynamic_objects_.size() + anchored_objects_.size());
   }
@@ -374,10 +815,46 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG) {
     DRAKE_DEMAND(X_WG.size() == dynamic_objects_.size());
+    // Only the objects whose poses actually changed have their bounding
+    // volumes recomputed and refit in the tree. The bookkeeping reuses the
+    // scratch buffers so that a pose update allocates nothing.
+    std::vector<fcl::CollisionObjectd*>& moved_objects = moved_objects_;
+    std::vector<bool>& moved = moved_;
+    moved_objects.clear();
+    moved.assign(X_WG.size(), false);
     for (size_t i = 0; i < X_WG.size(); ++i) {
-      dynamic_objects_[i]->setTransform(convert(X_WG[i]));
+      const Isometry3<double> X_WG_i = convert(X_WG[i]);
+      fcl::CollisionObjectd& object = *dynamic_objects_[i];
+      if (object.getTransform().matrix() != X_WG_i.matrix()) {
+        object.setTransform(X_WG_i);
+        object.computeAABB();
+        moved_objects.push_back(&object);
+        moved[i] = true;
+      }
+    }
+    if (!moved_objects.empty()) dynamic_tree_.update(moved_objects);
+    X_WG_ = X_WG;
+
+    if (incremental_broadphase_) {
+      if (candidates_are_valid_) {
+        UpdateCandidates(moved, moved_objects);
+      } else {
+        ComputeAllCandidates();
+      }
     }
-    dynamic_tree_.update();
+  }
+
+  void set_incremental_broadphase(bool enabled) {
+    incremental_broadphase_ = enabled;
+    candidates_are_valid_ = false;
+    candidates_.clear();
+    if (enabled) ComputeAllCandidates();
+  }
+
+  bool incremental_broadphase() const { return incremental_broadphase_; }
+
+  int num_broadphase_candidates() const {
+    return static_cast<int>(candidates_.size());
   }
 
   // Implementation of ShapeReifier interface
@@ -402,12 +879,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_half_space, user_data);
   }
 
-  void ImplementGeometry(const Mesh&, void* user_data) override {
-    // TODO(SeanCurtis-TRI): Replace this with a legitimate fcl mesh. This
-    // assumes that a zero-radius sphere has no interesting interactions with
-    // other meshes. However, it *does* increase the collision space. :(
-    auto fcl_sphere = make_shared<fcl::Sphered>(0.0);
-    TakeShapeOwnership(fcl_sphere, user_data);
+  void ImplementGeometry(const Mesh& mesh, void* user_data) override {
+    TakeShapeOwnership(
+        GetMeshGeometry(mesh.filename(), mesh.scale(), false /* is_convex */),
+        user_data);
+  }
+
+  void ImplementGeometry(const Convex& convex, void* user_data) override {
+    TakeShapeOwnership(
+        GetMeshGeometry(convex.filename(), convex.scale(), true /* is_convex */),
+        user_data);
   }
 
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration(
@@ -418,6 +899,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     collision_data.contacts = &contacts;
     collision_data.request.num_max_contacts = 1;
     collision_data.request.enable_contact = true;
+    if (incremental_broadphase_ && candidates_are_valid_) {
+      // The broadphase has already been done by UpdateWorldPoses(); only the
+      // narrowphase remains.
+      for (const CandidatePair& candidate : candidates_) {
+        ComputeNarrowPhasePenetration(object_for(candidate.first),
+                                      object_for(candidate.second),
+                                      &collision_data);
+      }
+      return contacts;
+    }
     dynamic_tree_.collide(&collision_data, SingleCollisionCallback);
     // NOTE: The interface to DynamicAABBTreeCollisionManager::collide
     // requires the input collision manager pointer to be *non* const.
@@ -432,6 +923,118 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return contacts;
   }
 
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const {
+    std::vector<SignedDistancePair<double>> distances;
+    DistanceData distance_data{&dynamic_map, &anchored_map, max_distance};
+    distance_data.distances = &distances;
+    dynamic_tree_.distance(&distance_data, SignedDistanceCallback);
+    // NOTE: As with collide(), DynamicAABBTreeCollisionManager::distance
+    // requires the input collision manager pointer to be *non* const; the
+    // callback doesn't modify it.
+    dynamic_tree_.distance(
+        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+            &anchored_tree_),
+        &distance_data, SignedDistanceCallback);
+    return distances;
+  }
+
+  std::vector<PenetrationAsPointPair<T>>
+  ComputePointPairPenetrationWithDerivatives(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map) const {
+    return AddPoseDerivativesToAll(
+        ComputePointPairPenetration(dynamic_map, anchored_map), dynamic_map,
+        anchored_map);
+  }
+
+  std::vector<SignedDistancePair<T>>
+  ComputeSignedDistancePairwiseClosestPointsWithDerivatives(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const {
+    return AddPoseDerivativesToAll(
+        ComputeSignedDistancePairwiseClosestPoints(dynamic_map, anchored_map,
+                                                   max_distance),
+        dynamic_map, anchored_map);
+  }
+
+  std::vector<TimeOfImpact<double>> ComputeTimesOfImpact(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      const std::vector<Isometry3<double>>& X_WG_end, int num_samples) const {
+    DRAKE_DEMAND(X_WG_end.size() == dynamic_objects_.size());
+    DRAKE_DEMAND(num_samples >= 2);
+
+    // Broadphase: sort and sweep the swept regions along x.
+    std::vector<SweptObject> swept;
+    swept.reserve(dynamic_objects_.size() + anchored_objects_.size());
+    for (size_t i = 0; i < dynamic_objects_.size(); ++i) {
+      swept.push_back(MakeSweptObject(*dynamic_objects_[i], X_WG_end[i]));
+    }
+    for (const auto& object : anchored_objects_) {
+      swept.push_back(MakeStationaryObject(*object));
+    }
+    std::sort(swept.begin(), swept.end(),
+              [](const SweptObject& a, const SweptObject& b) {
+                return a.min.x() < b.min.x();
+              });
+    std::vector<std::pair<CandidatePair, std::pair<size_t, size_t>>> candidates;
+    for (size_t i = 0; i < swept.size(); ++i) {
+      const SweptObject& a = swept[i];
+      for (size_t j = i + 1; j < swept.size() && swept[j].min.x() <= a.max.x();
+           ++j) {
+        const SweptObject& b = swept[j];
+        // TODO(SeanCurtis-TRI): Introduce collision filtering here.
+        if (!EncodedData(*a.object).is_dynamic() &&
+            !EncodedData(*b.object).is_dynamic()) {
+          continue;
+        }
+        if ((a.min.array() <= b.max.array()).all() &&
+            (b.min.array() <= a.max.array()).all()) {
+          const CandidatePair pair = MakeCandidatePair(*a.object, *b.object);
+          const bool a_first =
+              reinterpret_cast<uintptr_t>(a.object->getUserData()) ==
+              pair.first;
+          candidates.emplace_back(pair, a_first ? std::make_pair(i, j)
+                                                : std::make_pair(j, i));
+        }
+      }
+    }
+    // Reports the results in a canonical order, as the other queries do.
+    std::sort(candidates.begin(), candidates.end());
+
+    // Narrowphase: FCL's sampling continuous collision, with each object
+    // interpolated linearly between its poses.
+    fcl::ContinuousCollisionRequestd request;
+    request.num_max_iterations = num_samples;
+    // The number of samples is also capped at ceil(1 / toc_err).
+    request.toc_err = 1.0 / num_samples;
+    request.ccd_motion_type = fcl::CCDM_LINEAR;
+    request.ccd_solver_type = fcl::CCDC_NAIVE;
+    std::vector<TimeOfImpact<double>> impacts;
+    for (const auto& candidate : candidates) {
+      const SweptObject& a = swept[candidate.second.first];
+      const SweptObject& b = swept[candidate.second.second];
+      fcl::ContinuousCollisionResultd result;
+      fcl::continuousCollide(a.object->collisionGeometry().get(),
+                             a.X_WG_begin, a.X_WG_end,
+                             b.object->collisionGeometry().get(),
+                             b.X_WG_begin, b.X_WG_end, request, result);
+      if (result.is_collide) {
+        TimeOfImpact<double> impact;
+        impact.id_A = EncodedData(*a.object).id(dynamic_map, anchored_map);
+        impact.id_B = EncodedData(*b.object).id(dynamic_map, anchored_map);
+        impact.time = result.time_of_contact;
+        impacts.push_back(impact);
+      }
+    }
+    return impacts;
+  }
+
   // Testing utilities
 
   bool IsDeepCopy(const Impl& other) const {
@@ -487,12 +1090,147 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // transmogrify them. Otherwise, while the engine can be transmogrified, the
   // results on an <AutoDiffXd> type will still be double.
 
+  // Applies AddPoseDerivatives() to each of the double-valued `results` of a
+  // query, whose geometry ids are mapped back to engine geometries with the
+  // given maps.
+  template <template <typename> class Result>
+  std::vector<Result<T>> AddPoseDerivativesToAll(
+      const std::vector<Result<double>>& results,
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map) const {
+    std::vector<Result<T>> differentiated;
+    if (results.empty()) return differentiated;
+    differentiated.reserve(results.size());
+    std::unordered_map<GeometryId, EncodedData> encodings;
+    for (int i = 0; i < static_cast<int>(dynamic_map.size()); ++i) {
+      encodings.emplace(dynamic_map[i], EncodedData(i, true /* dynamic */));
+    }
+    for (int i = 0; i < static_cast<int>(anchored_map.size()); ++i) {
+      encodings.emplace(anchored_map[i], EncodedData(i, false /* dynamic */));
+    }
+    for (const Result<double>& result : results) {
+      const EncodedData A = encodings.at(result.id_A);
+      const EncodedData B = encodings.at(result.id_B);
+      differentiated.push_back(AddPoseDerivatives(
+          result, pose_value_for(A), pose_for(A), pose_value_for(B),
+          pose_for(B)));
+    }
+    return differentiated;
+  }
+
+  // Returns the pose, with derivatives, of the geometry with the given
+  // encoding. Anchored geometry has constant poses.
+  Isometry3<T> pose_for(const EncodedData& encoding) const {
+    if (encoding.is_dynamic()) return X_WG_[encoding.index()];
+    return pose_value_for(encoding).template cast<T>();
+  }
+
+  // Returns the value of the pose of the geometry with the given encoding, as
+  // used by the queries.
+  Isometry3<double> pose_value_for(const EncodedData& encoding) const {
+    const fcl::CollisionObjectd& object =
+        encoding.is_dynamic() ? *dynamic_objects_[encoding.index()]
+                              : *anchored_objects_[encoding.index()];
+    return Isometry3<double>(object.getTransform());
+  }
+
+  // Returns the collision object whose encoded user data is `data`.
+  const fcl::CollisionObjectd& object_for(uintptr_t data) const {
+    const EncodedData encoding = EncodedData::FromUserData(data);
+    return encoding.is_dynamic() ? *dynamic_objects_[encoding.index()]
+                                 : *anchored_objects_[encoding.index()];
+  }
+
+  // Rebuilds the full list of broadphase candidate pairs from scratch.
+  void ComputeAllCandidates() {
+    candidates_.clear();
+    dynamic_tree_.collide(&candidates_, CandidateCallback);
+    dynamic_tree_.collide(&anchored_tree_, &candidates_, CandidateCallback);
+    SortAndRemoveDuplicateCandidates();
+    candidates_are_valid_ = true;
+  }
+
+  // Updates the list of broadphase candidate pairs given the dynamic objects
+  // that moved since it was last computed. Pairs in which neither object
+  // moved are still valid and are retained (the warm start); pairs involving
+  // a moved object are recomputed by querying each moved object against both
+  // trees.
+  void UpdateCandidates(
+      const std::vector<bool>& moved,
+      const std::vector<fcl::CollisionObjectd*>& moved_objects) {
+    if (moved_objects.empty()) return;
+    auto involves_moved = [&moved](const CandidatePair& candidate) {
+      for (uintptr_t data : {candidate.first, candidate.second}) {
+        const EncodedData encoding = EncodedData::FromUserData(data);
+        if (encoding.is_dynamic() && moved[encoding.index()]) return true;
+      }
+      return false;
+    };
+    candidates_.erase(std::remove_if(candidates_.begin(), candidates_.end(),
+                                     involves_moved),
+                      candidates_.end());
+    for (fcl::CollisionObjectd* object : moved_objects) {
+      dynamic_tree_.collide(object, &candidates_, CandidateCallback);
+      anchored_tree_.collide(object, &candidates_, CandidateCallback);
+    }
+    // A pair of two moved objects is reported once per object.
+    SortAndRemoveDuplicateCandidates();
+  }
+
+  // Adds the candidate pairs of the newly added dynamic `object` to the list,
+  // which is otherwise still valid. Only the object is queried against the
+  // trees, and its pairs are merged into the sorted list.
+  void AddCandidatesOf(fcl::CollisionObjectd* object) {
+    const int num_old = static_cast<int>(candidates_.size());
+    dynamic_tree_.collide(object, &candidates_, CandidateCallback);
+    anchored_tree_.collide(object, &candidates_, CandidateCallback);
+    std::sort(candidates_.begin() + num_old, candidates_.end());
+    std::inplace_merge(candidates_.begin(), candidates_.begin() + num_old,
+                       candidates_.end());
+  }
+
+  // Removes the candidate pairs of the dynamic object `removed` from the list,
+  // and renames the pairs of the dynamic object `renamed`, which takes over
+  // the index of `removed` (the two may be the same object).
+  void RemoveCandidatesOf(const fcl::CollisionObjectd& removed,
+                          const fcl::CollisionObjectd& renamed) {
+    const uintptr_t removed_data =
+        reinterpret_cast<uintptr_t>(removed.getUserData());
+    const uintptr_t renamed_data =
+        reinterpret_cast<uintptr_t>(renamed.getUserData());
+    candidates_.erase(
+        std::remove_if(candidates_.begin(), candidates_.end(),
+                       [removed_data](const CandidatePair& candidate) {
+                         return candidate.first == removed_data ||
+                                candidate.second == removed_data;
+                       }),
+        candidates_.end());
+    if (renamed_data == removed_data) return;
+    for (CandidatePair& candidate : candidates_) {
+      if (candidate.first == renamed_data) candidate.first = removed_data;
+      if (candidate.second == renamed_data) candidate.second = removed_data;
+      if (candidate.second < candidate.first) {
+        std::swap(candidate.first, candidate.second);
+      }
+    }
+    std::sort(candidates_.begin(), candidates_.end());
+  }
+
+  // Puts the candidates in a canonical order (which makes the reported
+  // results independent of the order of the broadphase traversal) and
+  // removes repeated pairs.
+  void SortAndRemoveDuplicateCandidates() {
+    std::sort(candidates_.begin(), candidates_.end());
+    candidates_.erase(std::unique(candidates_.begin(), candidates_.end()),
+                      candidates_.end());
+  }
+
   // Helper method called by the various ImplementGeometry overrides to
   // facilitate the logistics of creating shapes from specifications. `data`
   // is a unique_ptr of an fcl CollisionObject that should be instantiated
   // with the given shape.
-  void TakeShapeOwnership(const std::shared_ptr<fcl::ShapeBased>& shape,
-                          void* data) {
+  void TakeShapeOwnership(
+      const std::shared_ptr<fcl::CollisionGeometryd>& shape, void* data) {
     DRAKE_ASSERT(data != nullptr);
     std::unique_ptr<fcl::CollisionObject<double>>& fcl_object_ptr =
         *reinterpret_cast<std::unique_ptr<fcl::CollisionObject<double>>*>(data);
@@ -509,12 +1247,36 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // source owns a _contiguous_ block of engine indices.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> dynamic_objects_;
 
+  // The poses of the dynamic geometries given to UpdateWorldPoses(), indexed
+  // as dynamic_objects_. The FCL objects only hold their values; these keep
+  // the derivatives for the ...WithDerivatives() queries.
+  std::vector<Isometry3<T>> X_WG_;
+
   // The tree containing all of the anchored geometry.
   fcl::DynamicAABBTreeCollisionManager<double> anchored_tree_;
 
   // All of the *anchored* collision elements (spanning *all* sources). Their
   // AnchoredGeometryIndex maps to their position in *this* vector.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> anchored_objects_;
+
+  // When true, UpdateWorldPoses() maintains the list of broadphase candidate
+  // pairs incrementally and queries only perform narrowphase on that list.
+  bool incremental_broadphase_{false};
+
+  // True if candidates_ reflects the current geometry and poses. Adding
+  // anchored geometry invalidates the list; dynamic geometry is added to and
+  // removed from it in place.
+  bool candidates_are_valid_{false};
+
+  // The pairs of objects whose bounding volumes overlapped as of the last
+  // pose update (only maintained in incremental broadphase mode).
+  std::vector<CandidatePair> candidates_;
+
+  // Scratch buffers for UpdateWorldPoses(), kept to avoid reallocating them
+  // on every pose update. They carry no state between calls and are not
+  // copied.
+  std::vector<fcl::CollisionObjectd*> moved_objects_;
+  std::vector<bool> moved_;
 };
 
 template <typename T>
@@ -567,6 +1329,12 @@ AnchoredGeometryIndex ProximityEngine<T>::AddAnchoredGeometry(
   return impl_->AddAnchoredGeometry(shape, X_WG);
 }
 
+template <typename T>
+optional<GeometryIndex> ProximityEngine<T>::RemoveDynamicGeometry(
+    GeometryIndex index) {
+  return impl_->RemoveDynamicGeometry(index);
+}
+
 template <typename T>
 int ProximityEngine<T>::num_geometries() const {
   return impl_->num_geometries();
@@ -595,6 +1363,16 @@ void ProximityEngine<T>::UpdateWorldPoses(
   impl_->UpdateWorldPoses(X_WG);
 }
 
+template <typename T>
+void ProximityEngine<T>::set_incremental_broadphase(bool enabled) {
+  impl_->set_incremental_broadphase(enabled);
+}
+
+template <typename T>
+bool ProximityEngine<T>::incremental_broadphase() const {
+  return impl_->incremental_broadphase();
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 ProximityEngine<T>::ComputePointPairPenetration(
@@ -603,6 +1381,42 @@ ProximityEngine<T>::ComputePointPairPenetration(
   return impl_->ComputePointPairPenetration(dynamic_map, anchored_map);
 }
 
+template <typename T>
+std::vector<SignedDistancePair<double>>
+ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map, double max_distance) const {
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(
+      dynamic_map, anchored_map, max_distance);
+}
+
+template <typename T>
+std::vector<PenetrationAsPointPair<T>>
+ProximityEngine<T>::ComputePointPairPenetrationWithDerivatives(
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map) const {
+  return impl_->ComputePointPairPenetrationWithDerivatives(dynamic_map,
+                                                           anchored_map);
+}
+
+template <typename T>
+std::vector<SignedDistancePair<T>>
+ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPointsWithDerivatives(
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map, double max_distance) const {
+  return impl_->ComputeSignedDistancePairwiseClosestPointsWithDerivatives(
+      dynamic_map, anchored_map, max_distance);
+}
+
+template <typename T>
+std::vector<TimeOfImpact<double>> ProximityEngine<T>::ComputeTimesOfImpact(
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map,
+    const std::vector<Isometry3<double>>& X_WG_end, int num_samples) const {
+  return impl_->ComputeTimesOfImpact(dynamic_map, anchored_map, X_WG_end,
+                                     num_samples);
+}
+
 // Testing utilities
 
 template <typename T>
@@ -610,6 +1424,11 @@ bool ProximityEngine<T>::IsDeepCopy(const ProximityEngine<T>& other) const {
   return impl_->IsDeepCopy(*other.impl_);
 }
 
+template <typename T>
+int ProximityEngine<T>::num_broadphase_candidates() const {
+  return impl_->num_broadphase_candidates();
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -8,6 +8,8 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_index.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/signed_distance_pair.h"
+#include "drake/geometry/query_results/time_of_impact.h"
 #include "drake/geometry/shape_specification.h"
 
 namespace drake {
@@ -67,14 +69,35 @@ class ProximityEngine {
   /** @name Topology management */
   //@{
 
-  /** Adds the given `shape` to the engine's dynamic geometry.  */
+  /** Adds the given `shape` to the engine's dynamic geometry.
+   @throws std::runtime_error if `shape` is a Mesh or Convex whose file can't
+                              be loaded.  */
   GeometryIndex AddDynamicGeometry(const Shape& shape);
 
   /** Adds the given `shape` to the engine's anchored geometry at the fixed
-   pose given by `X_WG` (in the world frame W).  */
+   pose given by `X_WG` (in the world frame W).
+   @throws std::runtime_error if `shape` is a Mesh or Convex whose file can't
+                              be loaded.  */
   AnchoredGeometryIndex AddAnchoredGeometry(const Shape& shape,
                                             const Isometry3<double>& X_WG);
 
+  /** Removes the dynamic geometry with the given `index` from the engine.
+   The dynamic geometry indices remain contiguous: unless the removed geometry
+   had the largest index, the geometry with the largest index takes over
+   `index`, and its former index is returned so that the caller can update
+   any data it keeps by index.
+
+   Adding or removing a dynamic geometry only inserts or removes one leaf of
+   the broadphase tree, which takes time logarithmic in the number of dynamic
+   geometries for a balanced tree; nothing else in the engine is rebuilt. In
+   incremental broadphase mode, the candidate pairs of the geometry are added
+   to or removed from the list, which remains valid.
+   @param index   The index of the dynamic geometry to remove; it must lie in
+                  the range [0, num_dynamic() - 1].
+   @returns The former index of the geometry that now has `index`, or nullopt
+            if no geometry was moved.  */
+  optional<GeometryIndex> RemoveDynamicGeometry(GeometryIndex index);
+
   /** Reports the _total_ number of geometries in the engine -- dynamic and
    anchored (spanning all sources).  */
   int num_geometries() const;
@@ -101,6 +124,22 @@ class ProximityEngine {
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG);
 
+  /** Enables or disables the _incremental broadphase_ mode (disabled by
+   default). In either mode, UpdateWorldPoses() only recomputes and refits the
+   bounding volumes of the dynamic geometries whose poses actually changed.
+   In incremental mode, the engine additionally keeps the list of broadphase
+   candidate pairs (pairs of geometries whose bounding volumes overlap) from
+   the previous pose update: pairs between geometries that did not move are
+   retained and only the moved geometries are re-queried against the trees.
+   Penetration queries then perform only the narrowphase on that list. This
+   pays off for scenes with many anchored or stationary geometries and few
+   moving ones. Query results are the same in both modes, up to the ordering
+   of the results and of the geometries within each result.  */
+  void set_incremental_broadphase(bool enabled);
+
+  /** Reports whether the incremental broadphase mode is enabled. */
+  bool incremental_broadphase() const;
+
 
   //----------------------------------------------------------------------------
   /** @name                Collision Queries
@@ -141,6 +180,131 @@ class ProximityEngine {
       const std::vector<GeometryId>& dynamic_map,
       const std::vector<GeometryId>& anchored_map) const;
 
+  /** Computes the same penetrations as ComputePointPairPenetration(), on the
+   scalar type T. For T = AutoDiffXd, the points, normal and depth carry the
+   derivatives of the poses last given to UpdateWorldPoses() (anchored
+   geometry has none).
+
+   The broadphase and narrowphase are performed on double values, exactly as
+   in ComputePointPairPenetration(); only the results are then differentiated.
+   To first order, each witness point moves rigidly with its geometry (`Ca`
+   with A, `Cb` with B) and the normal rotates with geometry B, and the depth
+   is recomputed from them as `(p_WCb - p_WCa) ⋅ nhat_BA_W`. This yields the
+   derivatives of the depth with respect to the poses wherever the contact
+   is unique, without running the collision pipeline on AutoDiffXd.
+
+   For T = double, the results are those of ComputePointPairPenetration().  */
+  std::vector<PenetrationAsPointPair<T>>
+  ComputePointPairPenetrationWithDerivatives(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map) const;
+
+  //@}
+
+  //----------------------------------------------------------------------------
+  /** @name                Signed Distance Queries
+
+   These queries compute the signed distance between pairs of geometries:
+   positive for separated geometries, negative (the penetration depth) for
+   penetrating geometries.  */
+  //@{
+
+  /** Computes the signed distance, together with the witness points, for
+   every pair of geometries in the world whose signed distance is no greater
+   than `max_distance`. Pairs of _anchored_ geometry are not reported. The
+   broadphase prunes geometry pairs whose bounding volumes are farther apart
+   than `max_distance`, so a small threshold makes the query cheap in large,
+   sparse scenes.
+
+   @cond
+   // TODO(SeanCurtis-TRI): Once collision filtering is supported, pull this
+   // *out* of the cond tag.
+   This method is affected by collision filtering; geometry pairs that
+   have been filtered are never evaluated.
+   @endcond
+
+   @param[in]   dynamic_map   A map from geometry _index_ to the corresponding
+                              global geometry identifier for dynamic geometries.
+   @param[in]   anchored_map  A map from geometry _index_ to the corresponding
+                              global geometry identifier for anchored
+                              geometries.
+   @param[in]   max_distance  The distance threshold; pairs farther apart are
+                              not reported.
+   @returns The signed distance pairs for all qualifying geometry pairs.
+   @throws std::logic_error if a qualifying pair includes a HalfSpace. */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const;
+
+  /** Computes the same signed distances as
+   ComputeSignedDistancePairwiseClosestPoints(), on the scalar type T. For
+   T = AutoDiffXd, the witness points carry the derivatives of the poses last
+   given to UpdateWorldPoses(), treating each of them as fixed on its
+   geometry, and the distance is recomputed from them as
+   `±‖p_WCb - p_WCa‖`, which gives its derivatives with respect to the poses
+   wherever the witness points are unique. Touching geometries (whose
+   distance is exactly zero) report a distance without derivatives.
+
+   As in ComputePointPairPenetrationWithDerivatives(), the queries themselves
+   are performed on double values. For T = double, the results are those of
+   ComputeSignedDistancePairwiseClosestPoints().
+   @throws std::logic_error if a qualifying pair includes a HalfSpace. */
+  std::vector<SignedDistancePair<T>>
+  ComputeSignedDistancePairwiseClosestPointsWithDerivatives(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const;
+
+  //@}
+
+  //----------------------------------------------------------------------------
+  /** @name                Continuous Collision Queries
+
+   These queries consider the _motion_ of the dynamic geometries over an
+   interval, rather than a single configuration, so that contacts which would
+   begin and end between two discrete configurations (i.e., tunneling) are
+   detected.  */
+  //@{
+
+  /** Computes the time of impact of every pair of geometries that come into
+   contact as the dynamic geometries move from their current poses (as set by
+   UpdateWorldPoses()) to the given end poses. Each geometry moves with
+   constant linear and angular velocity over the normalized interval [0, 1];
+   anchored geometries don't move. Pairs of _anchored_ geometry are not
+   reported.
+
+   Candidate pairs are found by the overlap of bounding boxes that enclose the
+   whole motion of each geometry. The time of impact of each candidate is then
+   found by FCL's continuous collision, which tests `num_samples` evenly spaced
+   configurations; so the reported times are resolved to
+   1 / (`num_samples` - 1), and only contacts that last at least that long
+   are certain to be found.
+
+   @cond
+   // TODO(SeanCurtis-TRI): Once collision filtering is supported, pull this
+   // *out* of the cond tag.
+   This method is affected by collision filtering; geometry pairs that
+   have been filtered are never evaluated.
+   @endcond
+
+   @param[in]   dynamic_map   A map from geometry _index_ to the corresponding
+                              global geometry identifier for dynamic geometries.
+   @param[in]   anchored_map  A map from geometry _index_ to the corresponding
+                              global geometry identifier for anchored
+                              geometries.
+   @param[in]   X_WG_end      The poses of the dynamic geometries at the end of
+                              the motion, indexed as in UpdateWorldPoses().
+   @param[in]   num_samples   The number of configurations tested per pair;
+                              must be at least 2.
+   @returns The time of impact of each pair that comes into contact, ordered
+            by pair.  */
+  std::vector<TimeOfImpact<double>> ComputeTimesOfImpact(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      const std::vector<Isometry3<double>>& X_WG_end, int num_samples) const;
+
   //@}
 
  private:
@@ -154,6 +318,10 @@ class ProximityEngine {
   // Reports true if other is detectably a deep copy of this engine.
   bool IsDeepCopy(const ProximityEngine<T>& other) const;
 
+  // Reports the number of broadphase candidate pairs currently stored by the
+  // incremental broadphase mode (zero if that mode is disabled).
+  int num_broadphase_candidates() const;
+
   ////////////////////////////////////////////////////////////////////////////
 
   // TODO(SeanCurtis-TRI): Pimpl + template implementation has proven
@@ -42,6 +42,30 @@ QueryObject<T>::ComputePointPairPenetration() const {
   return state.ComputePointPairPenetration();
 }
 
+template <typename T>
+std::vector<SignedDistancePair<double>>
+QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    double max_distance) const {
+  ThrowIfDefault();
+
+  // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
+  system_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
+}
+
+template <typename T>
+std::vector<TimeOfImpact<double>> QueryObject<T>::ComputeTimesOfImpact(
+    const std::unordered_map<FrameId, Isometry3<double>>& X_WF_end,
+    int num_samples) const {
+  ThrowIfDefault();
+
+  // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
+  system_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeTimesOfImpact(X_WF_end, num_samples);
+}
+
 }  // namespace geometry
 }  // namespace drake
 
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "drake/geometry/geometry_context.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/signed_distance_pair.h"
+#include "drake/geometry/query_results/time_of_impact.h"
 
 namespace drake {
 namespace geometry {
@@ -118,6 +122,83 @@ class QueryObject {
 
   //@}
 
+  //----------------------------------------------------------------------------
+  /** @name                Signed Distance Queries
+
+   These queries compute the signed distance between geometries: the distance
+   between the closest points of separated geometries, or the negative
+   penetration depth of penetrating geometries.  */
+  //@{
+
+  /** Computes the signed distance and the witness points for all pairs of
+   geometries in the world whose signed distance is no greater than
+   `max_distance`. Pairs of _anchored_ geometry are not reported. Pairs whose
+   bounding volumes are farther apart than `max_distance` are pruned in the
+   broadphase without computing their distance, so queries that only care
+   about nearby geometry (e.g., for collision avoidance) should provide a
+   finite threshold. Each result is characterized as a SignedDistancePair.
+
+   <!--
+   This method is affected by collision filtering; geometry pairs that have
+   been filtered are never evaluated.
+   TODO(SeanCurtis-TRI): This isn't true yet.
+
+   NOTE: This is currently declared as double because we haven't exposed FCL's
+   templated functionality yet. When that happens, double -> T.
+   -->
+
+   @param max_distance  The maximum signed distance to report. Defaults to
+                        infinity (all pairs are reported).
+   @returns The signed distance pairs for all qualifying geometry pairs.
+   @throws std::logic_error if a qualifying pair includes a HalfSpace.  */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  //@}
+
+  //----------------------------------------------------------------------------
+  /** @name                Continuous Collision Queries
+
+   These queries detect collisions over a _motion_ of the geometry, rather than
+   in a single configuration. A thin or fast-moving geometry can pass through
+   another between two discrete configurations (i.e., tunnel), without either
+   configuration being in collision; these queries report such contacts, so
+   that a simulator can, e.g., shorten its step to resolve them.  */
+  //@{
+
+  /** Computes the time of impact of all pairs of geometries that come into
+   contact as the frames move from their current poses to the given end poses.
+   Each frame moves with constant linear and angular velocity over the
+   normalized interval [0, 1]; frames missing from `X_WF_end`, and anchored
+   geometry, don't move. Pairs of _anchored_ geometry are not reported. Pairs
+   which are already in contact are reported with a time of zero.
+
+   Each pair is tested at `num_samples` evenly spaced configurations, so the
+   reported times are resolved to 1 / (`num_samples` - 1); a contact that
+   begins and ends between two samples may be missed.
+
+   <!--
+   This method is affected by collision filtering; geometry pairs that have
+   been filtered are never evaluated.
+   TODO(SeanCurtis-TRI): This isn't true yet.
+
+   NOTE: This is currently declared as double because we haven't exposed FCL's
+   templated functionality yet. When that happens, double -> T.
+   -->
+
+   @param X_WF_end     The poses of the moving frames, in the world frame, at
+                       the end of the motion.
+   @param num_samples  The number of configurations tested per pair.
+   @returns The time of impact of every pair which comes into contact.
+   @throws std::logic_error if `X_WF_end` names an unregistered frame, or if
+                            `num_samples` is less than two.  */
+  std::vector<TimeOfImpact<double>> ComputeTimesOfImpact(
+      const std::unordered_map<FrameId, Isometry3<double>>& X_WF_end,
+      int num_samples = 20) const;
+
+  //@}
+
  private:
   // GeometrySystem is the only class that can instantiate QueryObjects.
   friend class GeometrySystem<T>;
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The data for reporting the signed distance between two geometries, A and
+ B. It provides the id's of the two geometries, the witness points Ca and Cb
+ on the surfaces of A and B, and the signed distance between them. For
+ separated geometries, Ca and Cb are the closest points between A and B and
+ `distance` is strictly positive. For penetrating geometries, `distance` is
+ the negative of the penetration depth and Ca and Cb are the points on A and
+ B that most deeply penetrate the other geometry (see PenetrationAsPointPair).
+ In both cases:
+
+     |distance| = ‖p_WCb - p_WCa‖
+
+ @tparam T The underlying scalar type. Must be a valid Eigen scalar. */
+template <typename T>
+struct SignedDistancePair {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistancePair)
+  SignedDistancePair() = default;
+
+  /** The id of the first geometry in the pair. */
+  GeometryId id_A;
+  /** The id of the second geometry in the pair. */
+  GeometryId id_B;
+  /** The witness point on A, measured and expressed in the world frame. */
+  Vector3<T> p_WCa;
+  /** The witness point on B, measured and expressed in the world frame. */
+  Vector3<T> p_WCb;
+  /** The signed distance between A and B. */
+  T distance{};
+};
+
+}  // namespace geometry
+}  // namespace drake
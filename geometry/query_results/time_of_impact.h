@@ -0,0 +1,30 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The data for reporting the first contact between two geometries, A and B,
+ as they move from their current poses to prescribed end poses. The time of
+ impact is _normalized_ over the motion: 0 at the current poses and 1 at the
+ end poses. A time of 0 means that A and B already touch at their current
+ poses.
+
+ @tparam T The underlying scalar type. Must be a valid Eigen scalar. */
+template <typename T>
+struct TimeOfImpact {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TimeOfImpact)
+  TimeOfImpact() = default;
+
+  /** The id of the first geometry in the pair. */
+  GeometryId id_A;
+  /** The id of the second geometry in the pair. */
+  GeometryId id_B;
+  /** The normalized time, in [0, 1], at which A and B first touch. */
+  T time{};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -1,7 +1,5 @@
 #include "drake/geometry/shape_specification.h"
 
-#include "drake/common/text_logging.h"
-
 namespace drake {
 namespace geometry {
 
@@ -61,11 +59,10 @@ Isometry3<double> HalfSpace::MakePose(const Vector3<double>& Cz_F,
 }
 
 Mesh::Mesh(const std::string& absolute_filename, double scale)
-    : Shape(ShapeTag<Mesh>()), filename_(absolute_filename), scale_(scale) {
-  // TODO(SeanCurtis-TRI): Remove this when meshes are properly supported.
-  drake::log()->warn("Meshes are only supported for drake_visualizer ({})",
-                     filename_);
-}
+    : Shape(ShapeTag<Mesh>()), filename_(absolute_filename), scale_(scale) {}
+
+Convex::Convex(const std::string& absolute_filename, double scale)
+    : Shape(ShapeTag<Convex>()), filename_(absolute_filename), scale_(scale) {}
 
 }  // namespace geometry
 }  // namespace drake
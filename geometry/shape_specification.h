@@ -141,11 +141,18 @@ class HalfSpace final : public Shape {
 };
 
 // TODO(SeanCurtis-TRI): Update documentation when the level of support for
-// meshes extends to collision/rendering.
-/** Limited support for meshes. Meshes declared as such will _not_ serve in
- proximity queries or rendering queries. However, they _will_ be propagated
- to drake_visualizer. The mesh is dispatched to drake visualizer via the
- filename. The mesh is _not_ parsed/loaded by Drake. */
+// meshes extends to rendering.
+/** Support for triangle meshes. Meshes serve in proximity queries, but not in
+ rendering queries. They are propagated to drake_visualizer via the filename.
+ For proximity queries the file must be a Wavefront OBJ file; its faces are
+ triangulated and placed in a bounding volume hierarchy. Each file is loaded
+ once per process, and shared by all geometries that name it with the same
+ scale.
+
+ A mesh can have any shape, but queries against a mesh are much more expensive
+ than queries against a Convex shape. Where the object can be approximated by a
+ union of convex pieces (e.g., by an offline convex decomposition), prefer to
+ register each piece as a Convex.  */
 class Mesh final : public Shape {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Mesh)
@@ -164,6 +171,31 @@ class Mesh final : public Shape {
   double scale_;
 };
 
+/** Support for convex shapes. The shape is the convex polyhedron given by the
+ vertices and faces of a Wavefront OBJ file; the file is _assumed_ to describe
+ a convex polyhedron whose faces are wound counter-clockwise when viewed from
+ outside. This is, e.g., the form of each piece of an offline convex
+ decomposition of a complex mesh. Convex shapes serve in proximity queries, but
+ not in rendering queries; they are propagated to drake_visualizer as meshes.
+ As with Mesh, each file is loaded once per process.  */
+class Convex final : public Shape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Convex)
+
+  /** Constructs a convex shape specification from the OBJ file located at the
+   given _absolute_ file path. Optionally uniformly scaled by the given scale
+   factor.  */
+  explicit Convex(const std::string& absolute_filename, double scale = 1.0);
+
+  const std::string& filename() const { return filename_; }
+  double scale() const { return scale_; }
+
+ private:
+  // NOTE: Cannot be const to support default copy/move semantics.
+  std::string filename_;
+  double scale_;
+};
+
 /** The interface for converting shape descriptions to real shapes. Any entity
  that consumes shape descriptions _must_ implement this interface.
 
@@ -221,6 +253,7 @@ class ShapeReifier {
   virtual void ImplementGeometry(const HalfSpace& half_space,
                                  void* user_data) = 0;
   virtual void ImplementGeometry(const Mesh& mesh, void* user_data) = 0;
+  virtual void ImplementGeometry(const Convex& convex, void* user_data) = 0;
 };
 
 template <typename S>
@@ -0,0 +1,125 @@
+// Measures the cost of spawning and despawning dynamic geometry in a scene of
+// growing size, as in pick-and-place simulations that add and remove objects
+// at runtime. Run with --help for options.
+//
+// The scene is a cubic grid of N dynamic spheres, separated from each other,
+// in a ProximityEngine in incremental broadphase mode. Each spawn is timed
+// two ways:
+//  - "in place": the sphere is added to the engine and later removed from it,
+//    which inserts and removes one leaf of the broadphase tree and updates
+//    the candidate pairs in place.
+//  - "copy": the engine is copied and the sphere is added to the copy, which
+//    is what changing the topology of a copy of the geometry state costs
+//    (e.g., a GeometryContext cloned for an unrestricted update).
+// The in-place cost should grow logarithmically with N, the copy cost
+// linearly.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/geometry/proximity_engine.h"
+#include "drake/geometry/shape_specification.h"
+
+DEFINE_string(num_geometries, "100,1000,10000",
+              "Comma-separated list of the numbers of geometries in the "
+              "scene.");
+DEFINE_int32(spawns, 100, "Number of timed spawns for each scene size.");
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<int> ParseNumGeometries(const std::string& list) {
+  std::vector<int> result;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    result.push_back(std::stoi(item));
+    DRAKE_DEMAND(result.back() >= 1);
+  }
+  DRAKE_DEMAND(!result.empty());
+  return result;
+}
+
+// Spheres of radius 0.3 on a unit grid don't overlap each other.
+const Sphere kSphere{0.3};
+
+// Returns an engine with @p num_geometries spheres posed on a cubic grid.
+ProximityEngine<double> MakeScene(int num_geometries) {
+  ProximityEngine<double> engine;
+  const int side = static_cast<int>(std::ceil(std::cbrt(num_geometries)));
+  std::vector<Isometry3<double>> X_WG;
+  for (int i = 0; i < num_geometries; ++i) {
+    engine.AddDynamicGeometry(kSphere);
+    Isometry3<double> pose = Isometry3<double>::Identity();
+    pose.translation() << i % side, (i / side) % side, i / (side * side);
+    X_WG.push_back(pose);
+  }
+  engine.UpdateWorldPoses(X_WG);
+  engine.set_incremental_broadphase(true);
+  return engine;
+}
+
+void RunBenchmark(int num_geometries) {
+  ProximityEngine<double> engine = MakeScene(num_geometries);
+
+  Clock::time_point start = Clock::now();
+  for (int k = 0; k < FLAGS_spawns; ++k) {
+    const GeometryIndex index = engine.AddDynamicGeometry(kSphere);
+    // The spawned sphere has the last index; nothing else moves.
+    DRAKE_DEMAND(!engine.RemoveDynamicGeometry(index));
+  }
+  const double in_place_seconds = SecondsSince(start);
+  DRAKE_DEMAND(engine.num_dynamic() == num_geometries);
+
+  start = Clock::now();
+  for (int k = 0; k < FLAGS_spawns; ++k) {
+    ProximityEngine<double> copy(engine);
+    copy.AddDynamicGeometry(kSphere);
+  }
+  const double copy_seconds = SecondsSince(start);
+
+  std::cout << num_geometries << " geometries:\n";
+  std::cout << "  in place: " << in_place_seconds / FLAGS_spawns * 1e6
+            << " us/spawn (add and remove)\n";
+  std::cout << "  copy:     " << copy_seconds / FLAGS_spawns * 1e6
+            << " us/spawn (copy and add)\n";
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_spawns >= 1);
+  for (int num_geometries : ParseNumGeometries(FLAGS_num_geometries)) {
+    RunBenchmark(num_geometries);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Benchmarks spawning dynamic geometry in a ProximityEngine in place, "
+      "against copying the engine to add the geometry.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::geometry::internal::do_main();
+}
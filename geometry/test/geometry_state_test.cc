@@ -749,6 +749,86 @@ TEST_F(GeometryStateTest, RegisterNullGeometryonGeometry) {
       "Registering null geometry to geometry \\d+, on source \\d+.");
 }
 
+// Tests the removal of dynamic geometry: the geometry and its descendants are
+// removed, and the remaining geometries keep compact engine indices and are
+// still posed by their frames.
+TEST_F(GeometryStateTest, RemoveGeometry) {
+  SourceId s_id = SetUpSingleSourceTree();
+  // Hang a child on g0; removing g0 removes it too.
+  const GeometryId child_id = geometry_state_.RegisterGeometryWithParent(
+      s_id, geometries_[0],
+      make_unique<GeometryInstance>(Isometry3<double>::Identity(),
+                                    unique_ptr<Shape>(new Sphere(1))));
+  EXPECT_EQ(geometry_state_.get_num_geometries(),
+            single_tree_geometry_count() + 1);
+
+  geometry_state_.RemoveGeometry(s_id, geometries_[0]);
+  EXPECT_EQ(geometry_state_.get_num_geometries(),
+            single_tree_geometry_count() - 1);
+  for (GeometryId removed_id : {geometries_[0], child_id}) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        geometry_state_.GetFrameId(removed_id), std::logic_error,
+        "Referenced geometry \\d+ has not been registered.");
+    EXPECT_FALSE(gs_tester_.get_frames().at(frames_[0]).has_child(removed_id));
+  }
+
+  // The engine indices remain compact and consistent.
+  const vector<GeometryId>& ids = geometry_state_.get_geometry_ids();
+  ASSERT_EQ(static_cast<int>(ids.size()), single_tree_geometry_count() - 1);
+  EXPECT_EQ(gs_tester_.get_geometry_frame_poses().size(), ids.size());
+  EXPECT_EQ(gs_tester_.get_geometry_world_poses().size(), ids.size());
+  for (int i = 0; i < static_cast<int>(ids.size()); ++i) {
+    EXPECT_EQ(gs_tester_.get_geometries().at(ids[i]).get_engine_index(), i);
+  }
+
+  // With all frames at the identity, each remaining geometry is posed in the
+  // world as in its frame.
+  FrameIdVector frame_ids(s_id, frames_);
+  FramePoseVector<double> poses(
+      s_id, vector<Isometry3<double>>(kFrameCount,
+                                      Isometry3<double>::Identity()));
+  gs_tester_.SetFramePoses(frame_ids, poses);
+  for (int g = 1; g < single_tree_geometry_count(); ++g) {
+    EXPECT_TRUE(CompareMatrices(
+        geometry_state_.get_pose_in_world(geometries_[g]).matrix(),
+        X_FG_[g].matrix()));
+  }
+
+  // Geometry can be registered again after a removal.
+  const GeometryId new_id = geometry_state_.RegisterGeometry(
+      s_id, frames_[0], move(instance_));
+  EXPECT_EQ(gs_tester_.get_geometries().at(new_id).get_engine_index(),
+            single_tree_geometry_count() - 1);
+}
+
+// Tests the errors in removing geometry.
+TEST_F(GeometryStateTest, RemoveGeometryErrors) {
+  SourceId s_id = SetUpSingleSourceTree();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RemoveGeometry(SourceId::get_new_id(), geometries_[0]),
+      std::logic_error,
+      "Referenced geometry source \\d+ is not registered.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RemoveGeometry(s_id, GeometryId::get_new_id()),
+      std::logic_error, "Referenced geometry \\d+ has not been registered.");
+
+  SourceId other_id = NewSource("other");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RemoveGeometry(other_id, geometries_[0]),
+      std::logic_error,
+      "Trying to remove geometry \\d+ from source \\d+, but the geometry "
+      "doesn't belong to that source.");
+
+  const GeometryId anchored_id =
+      geometry_state_.RegisterAnchoredGeometry(s_id, move(instance_));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RemoveGeometry(s_id, anchored_id), std::logic_error,
+      "Trying to remove anchored geometry \\d+; only dynamic geometry can be "
+      "removed.");
+  EXPECT_EQ(geometry_state_.get_num_geometries(),
+            single_tree_geometry_count());
+}
+
 // Tests the registration of anchored geometry.
 TEST_F(GeometryStateTest, RegisterAnchoredGeometry) {
   SourceId s_id = NewSource("new source");
@@ -1014,6 +1094,44 @@ TEST_F(GeometryStateTest, SetFramePoses) {
   }
 }
 
+// Tests that the frames are reported in registration order, and that poses
+// reported in any other order produce the same world poses as poses reported
+// in registration order.
+TEST_F(GeometryStateTest, SetFramePosesOutOfOrder) {
+  SourceId s_id = SetUpSingleSourceTree();
+  EXPECT_EQ(geometry_state_.GetFramesInRegistrationOrder(s_id), frames_);
+
+  vector<Isometry3<double>> frame_poses;
+  for (int i = 0; i < kFrameCount; ++i) {
+    Isometry3<double> pose = Isometry3<double>::Identity();
+    pose.translation() << i + 1, 2 * i, 0;
+    frame_poses.push_back(pose);
+  }
+  gs_tester_.SetFramePoses(FrameIdVector(s_id, frames_),
+                           FramePoseVector<double>(s_id, frame_poses));
+  const vector<Isometry3<double>> expected_poses =
+      gs_tester_.get_geometry_world_poses();
+
+  vector<FrameId> reversed_ids(frames_.rbegin(), frames_.rend());
+  vector<Isometry3<double>> reversed_poses(frame_poses.rbegin(),
+                                           frame_poses.rend());
+  FrameIdVector ids(s_id, reversed_ids);
+  EXPECT_NO_THROW(gs_tester_.ValidateFrameIds(ids));
+  // Reset the world poses so the comparison is meaningful.
+  gs_tester_.SetFramePoses(
+      FrameIdVector(s_id, frames_),
+      FramePoseVector<double>(
+          s_id, vector<Isometry3<double>>(kFrameCount,
+                                          Isometry3<double>::Identity())));
+  gs_tester_.SetFramePoses(ids, FramePoseVector<double>(s_id, reversed_poses));
+  const auto& world_poses = gs_tester_.get_geometry_world_poses();
+  ASSERT_EQ(world_poses.size(), expected_poses.size());
+  for (size_t i = 0; i < world_poses.size(); ++i) {
+    EXPECT_TRUE(CompareMatrices(world_poses[i].matrix(),
+                                expected_poses[i].matrix()));
+  }
+}
+
 // Test various frame property queries.
 TEST_F(GeometryStateTest, QueryFrameProperties) {
   SourceId s_id = SetUpSingleSourceTree();
@@ -244,6 +244,45 @@ TEST_F(GeometrySystemTest, TopologyAfterAllocation) {
       std::logic_error,
       "The call to RegisterAnchoredGeometry is invalid; a context has already "
       "been allocated.");
+
+  // Remove geometry.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      system_.RemoveGeometry(id, GeometryId::get_new_id()),
+      std::logic_error,
+      "The call to RemoveGeometry is invalid; a context has already been "
+      "allocated.");
+}
+
+// Tests that dynamic geometry can be added to and removed from an allocated
+// context, which leaves the default state unchanged.
+TEST_F(GeometrySystemTest, TopologyChangesInContext) {
+  SourceId s_id = system_.RegisterSource();
+  FrameId f_id = system_.RegisterFrame(
+      s_id, GeometryFrame("frame", Isometry3<double>::Identity()));
+  GeometryId g_id = system_.RegisterGeometry(s_id, f_id,
+                                             make_sphere_instance());
+  AllocateContext();
+  const GeometryState<double>& state = geom_context_->get_geometry_state();
+
+  GeometryId spawned_id = system_.RegisterGeometry(context_.get(), s_id, f_id,
+                                                   make_sphere_instance());
+  EXPECT_EQ(state.get_num_geometries(), 2);
+  EXPECT_TRUE(state.BelongsToSource(spawned_id, s_id));
+
+  system_.RemoveGeometry(context_.get(), s_id, g_id);
+  EXPECT_EQ(state.get_num_geometries(), 1);
+  EXPECT_EQ(state.get_geometry_ids()[0], spawned_id);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      system_.RemoveGeometry(context_.get(), s_id, g_id), std::logic_error,
+      "Referenced geometry \\d+ has not been registered.");
+
+  // A newly allocated context has the default topology.
+  unique_ptr<Context<double>> other_context = system_.AllocateContext();
+  const GeometryState<double>& other_state =
+      dynamic_cast<GeometryContext<double>&>(*other_context)
+          .get_geometry_state();
+  EXPECT_EQ(other_state.get_num_geometries(), 1);
+  EXPECT_EQ(other_state.get_geometry_ids()[0], g_id);
 }
 
 // Confirms that the direct feedthrough logic is correct -- there is total
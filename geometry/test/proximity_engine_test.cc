@@ -1,9 +1,14 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <limits>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 
 namespace drake {
@@ -19,6 +24,11 @@ class ProximityEngineTester {
                          const ProximityEngine<T>& ref_engine) {
     return ref_engine.IsDeepCopy(test_engine);
   }
+
+  template <typename T>
+  static int num_broadphase_candidates(const ProximityEngine<T>& engine) {
+    return engine.num_broadphase_candidates();
+  }
 };
 
 namespace {
@@ -112,6 +122,32 @@ GTEST_TEST(ProximityEngineTests, MoveSemantics) {
 }
 
 
+// Tests the removal of dynamic geometry; the last geometry takes over the
+// removed geometry's index.
+GTEST_TEST(ProximityEngineTests, RemoveDynamicGeometry) {
+  ProximityEngine<double> engine;
+  Sphere sphere{0.5};
+  engine.AddAnchoredGeometry(sphere, Isometry3<double>::Identity());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(engine.AddDynamicGeometry(sphere), i);
+  }
+
+  optional<GeometryIndex> moved_from =
+      engine.RemoveDynamicGeometry(GeometryIndex(0));
+  ASSERT_TRUE(moved_from);
+  EXPECT_EQ(*moved_from, 2);
+  EXPECT_EQ(engine.num_dynamic(), 2);
+  EXPECT_EQ(engine.num_anchored(), 1);
+
+  // Removing the last geometry moves nothing.
+  EXPECT_FALSE(engine.RemoveDynamicGeometry(GeometryIndex(1)));
+  EXPECT_EQ(engine.num_dynamic(), 1);
+
+  // Geometry can be added after a removal, at the next index.
+  EXPECT_EQ(engine.AddDynamicGeometry(sphere), 1);
+  EXPECT_EQ(engine.num_geometries(), 3);
+}
+
 // Penetration tests
 
 // A scene with no geometry reports no penetrations.
@@ -346,6 +382,398 @@ TEST_F(SimplePenetrationTest, PenetrationDynamicAndDynamicSingleSource) {
   ExpectPenetration(origin_id, collide_id, ad_engine.get());
 }
 
+// Repeats the dynamic-anchored and dynamic-dynamic penetration tests with the
+// incremental broadphase enabled; the results must be unchanged.
+TEST_F(SimplePenetrationTest, IncrementalBroadphase) {
+  EXPECT_FALSE(engine_.incremental_broadphase());
+  engine_.set_incremental_broadphase(true);
+  EXPECT_TRUE(engine_.incremental_broadphase());
+
+  AnchoredGeometryIndex anchored_index =
+      engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+  GeometryId anchored_id = GeometryId::get_new_id();
+  anchored_map_.push_back(anchored_id);
+  EXPECT_EQ(anchored_index, 0);
+
+  GeometryIndex dynamic_index = engine_.AddDynamicGeometry(sphere_);
+  GeometryId dynamic_id = GeometryId::get_new_id();
+  dynamic_map_.push_back(dynamic_id);
+  EXPECT_EQ(dynamic_index, 0);
+
+  MoveDynamicSphere(dynamic_index, false /* not colliding */);
+  ExpectNoPenetration();
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 0);
+
+  MoveDynamicSphere(dynamic_index, true /* colliding */);
+  ExpectPenetration(anchored_id, dynamic_id, &engine_);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 1);
+
+  // Re-applying the same poses moves nothing; the candidate list persists.
+  MoveDynamicSphere(dynamic_index, true /* colliding */);
+  ExpectPenetration(anchored_id, dynamic_id, &engine_);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 1);
+
+  // The mode and the candidates survive copying.
+  ProximityEngine<double> copy_engine(engine_);
+  EXPECT_TRUE(copy_engine.incremental_broadphase());
+  ExpectPenetration(anchored_id, dynamic_id, &copy_engine);
+  MoveDynamicSphere(dynamic_index, false /* not colliding */, &copy_engine);
+  ExpectNoPenetration(&copy_engine);
+
+  // Adding a second dynamic sphere (at the origin) adds its candidate pairs
+  // in place. After the pose update, the second sphere penetrates the
+  // anchored sphere; its bounding box overlaps that of the first dynamic
+  // sphere, but the spheres themselves don't touch.
+  GeometryIndex second_index = engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 3);
+  std::vector<Isometry3<double>> poses(engine_.num_dynamic(),
+                                       Isometry3<double>::Identity());
+  poses[dynamic_index] = Isometry3<double>(Translation3d{colliding_x_, 0, 0});
+  poses[second_index] = Isometry3<double>(Translation3d{0, colliding_x_, 0});
+  engine_.UpdateWorldPoses(poses);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 3);
+  EXPECT_EQ(
+      engine_.ComputePointPairPenetration(dynamic_map_, anchored_map_).size(),
+      2);
+
+  // Moving only the second sphere far away drops exactly its pairs.
+  poses[second_index] = Isometry3<double>(Translation3d{0, 10, 0});
+  engine_.UpdateWorldPoses(poses);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 1);
+  ExpectPenetration(anchored_id, dynamic_id, &engine_);
+
+  // Disabling the mode discards the candidates but not the results.
+  engine_.set_incremental_broadphase(false);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 0);
+  ExpectPenetration(anchored_id, dynamic_id, &engine_);
+}
+
+// Tests that removing dynamic geometry keeps the incremental broadphase
+// candidates valid, with the moved geometry's pairs renamed to its new index.
+TEST_F(SimplePenetrationTest, RemoveDynamicGeometryIncremental) {
+  engine_.set_incremental_broadphase(true);
+  engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  anchored_map_.push_back(anchored_id);
+  // Sphere a penetrates the anchored sphere along x, b is far away, and c
+  // penetrates the anchored sphere along y. The bounding boxes of a and c
+  // overlap, but the spheres don't touch.
+  std::vector<Isometry3<double>> poses{
+      Isometry3<double>(Translation3d{colliding_x_, 0, 0}),
+      Isometry3<double>(Translation3d{0, 10, 0}),
+      Isometry3<double>(Translation3d{0, colliding_x_, 0})};
+  for (int i = 0; i < 3; ++i) {
+    engine_.AddDynamicGeometry(sphere_);
+    dynamic_map_.push_back(GeometryId::get_new_id());
+  }
+  const GeometryId c_id = dynamic_map_[2];
+  engine_.UpdateWorldPoses(poses);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 3);
+  EXPECT_EQ(
+      engine_.ComputePointPairPenetration(dynamic_map_, anchored_map_).size(),
+      2);
+
+  // Removing a drops its pairs; c takes over index 0.
+  const optional<GeometryIndex> moved_from =
+      engine_.RemoveDynamicGeometry(GeometryIndex(0));
+  ASSERT_TRUE(moved_from);
+  EXPECT_EQ(*moved_from, 2);
+  dynamic_map_[0] = dynamic_map_[*moved_from];
+  dynamic_map_.pop_back();
+  poses[0] = poses[*moved_from];
+  poses.pop_back();
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 1);
+  auto expect_c_penetrates = [this, anchored_id, c_id]() {
+    const std::vector<PenetrationAsPointPair<double>> results =
+        engine_.ComputePointPairPenetration(dynamic_map_, anchored_map_);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_TRUE((results[0].id_A == c_id && results[0].id_B == anchored_id) ||
+                (results[0].id_A == anchored_id && results[0].id_B == c_id));
+  };
+  expect_c_penetrates();
+
+  // A pose update with the same poses keeps the list.
+  engine_.UpdateWorldPoses(poses);
+  EXPECT_EQ(ProximityEngineTester::num_broadphase_candidates(engine_), 1);
+  expect_c_penetrates();
+
+  // The results match those of a full broadphase.
+  engine_.set_incremental_broadphase(false);
+  expect_c_penetrates();
+}
+
+// Tests the signed distance between a dynamic and an anchored sphere, both
+// separated and penetrating, and confirms the threshold prunes far pairs.
+TEST_F(SimplePenetrationTest, SignedDistanceDynamicAndAnchored) {
+  engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  anchored_map_.push_back(anchored_id);
+  const GeometryIndex dynamic_index = engine_.AddDynamicGeometry(sphere_);
+  const GeometryId dynamic_id = GeometryId::get_new_id();
+  dynamic_map_.push_back(dynamic_id);
+
+  // Confirms there's a single result with the given signed distance whose
+  // witness points lie on the x-axis at the given positions.
+  auto expect_distance = [&](double distance, double x_anchored,
+                             double x_dynamic, double max_distance) {
+    const std::vector<SignedDistancePair<double>> results =
+        engine_.ComputeSignedDistancePairwiseClosestPoints(
+            dynamic_map_, anchored_map_, max_distance);
+    ASSERT_EQ(results.size(), 1);
+    SignedDistancePair<double> result = results[0];
+    ASSERT_TRUE(
+        (result.id_A == anchored_id && result.id_B == dynamic_id) ||
+        (result.id_A == dynamic_id && result.id_B == anchored_id));
+    // Put the anchored sphere in the A position for the comparisons.
+    if (result.id_A == dynamic_id) {
+      std::swap(result.id_A, result.id_B);
+      std::swap(result.p_WCa, result.p_WCb);
+    }
+    EXPECT_NEAR(result.distance, distance, 1e-6);
+    EXPECT_TRUE(CompareMatrices(result.p_WCa,
+                                Vector3<double>{x_anchored, 0, 0}, 1e-6,
+                                MatrixCompareType::absolute));
+    EXPECT_TRUE(CompareMatrices(result.p_WCb,
+                                Vector3<double>{x_dynamic, 0, 0}, 1e-6,
+                                MatrixCompareType::absolute));
+  };
+
+  // Separated case.
+  MoveDynamicSphere(dynamic_index, false /* not colliding */);
+  const double gap = free_x_ - 2 * radius_;
+  expect_distance(gap, radius_, free_x_ - radius_,
+                  std::numeric_limits<double>::infinity());
+  expect_distance(gap, radius_, free_x_ - radius_, 2 * gap);
+  // A threshold smaller than the gap excludes the pair.
+  EXPECT_EQ(engine_
+                .ComputeSignedDistancePairwiseClosestPoints(
+                    dynamic_map_, anchored_map_, 0.5 * gap)
+                .size(),
+            0);
+
+  // Penetrating case; the pair is reported for any non-negative threshold.
+  MoveDynamicSphere(dynamic_index, true /* colliding */);
+  expect_distance(colliding_x_ - 2 * radius_, radius_, colliding_x_ - radius_,
+                  0.0);
+}
+
+// Tests that the penetration and signed distance queries on AutoDiffXd carry
+// the derivatives of the poses of the dynamic geometry.
+TEST_F(SimplePenetrationTest, QueriesWithDerivatives) {
+  engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+  anchored_map_.push_back(GeometryId::get_new_id());
+  const GeometryIndex dynamic_index = engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+
+  // On double, the results are those of the plain queries.
+  MoveDynamicSphere(dynamic_index, true /* colliding */);
+  const auto penetrations = engine_.ComputePointPairPenetrationWithDerivatives(
+      dynamic_map_, anchored_map_);
+  ASSERT_EQ(penetrations.size(), 1);
+  EXPECT_EQ(penetrations[0].depth,
+            engine_.ComputePointPairPenetration(dynamic_map_, anchored_map_)[0]
+                .depth);
+
+  // Places the dynamic sphere at x, differentiated with respect to x.
+  std::unique_ptr<ProximityEngine<AutoDiffXd>> ad_engine =
+      engine_.ToAutoDiffXd();
+  auto move_to = [&ad_engine](double x) {
+    Isometry3<AutoDiffXd> X_WG = Isometry3<AutoDiffXd>::Identity();
+    X_WG.translation()(0) = AutoDiffXd(x, Eigen::VectorXd::Ones(1));
+    ad_engine->UpdateWorldPoses({X_WG});
+  };
+
+  // Moving the dynamic sphere away from the anchored one reduces the depth at
+  // the same rate, and moves the witness point on the dynamic sphere with it.
+  move_to(colliding_x_);
+  const std::vector<PenetrationAsPointPair<AutoDiffXd>> ad_penetrations =
+      ad_engine->ComputePointPairPenetrationWithDerivatives(dynamic_map_,
+                                                            anchored_map_);
+  ASSERT_EQ(ad_penetrations.size(), 1);
+  const PenetrationAsPointPair<AutoDiffXd>& penetration = ad_penetrations[0];
+  EXPECT_NEAR(penetration.depth.value(), 2 * radius_ - colliding_x_, 1e-13);
+  ASSERT_EQ(penetration.depth.derivatives().size(), 1);
+  EXPECT_NEAR(penetration.depth.derivatives()(0), -1, 1e-13);
+  const Vector3<AutoDiffXd>& p_WC_dynamic =
+      penetration.id_A == dynamic_map_[0] ? penetration.p_WCa
+                                          : penetration.p_WCb;
+  EXPECT_NEAR(p_WC_dynamic(0).derivatives()(0), 1, 1e-13);
+
+  // The signed distance grows at the same rate, whether separated or not.
+  for (const double x : {free_x_, colliding_x_}) {
+    move_to(x);
+    const std::vector<SignedDistancePair<AutoDiffXd>> distances =
+        ad_engine->ComputeSignedDistancePairwiseClosestPointsWithDerivatives(
+            dynamic_map_, anchored_map_,
+            std::numeric_limits<double>::infinity());
+    ASSERT_EQ(distances.size(), 1);
+    EXPECT_NEAR(distances[0].distance.value(), x - 2 * radius_, 1e-6);
+    ASSERT_EQ(distances[0].distance.derivatives().size(), 1);
+    EXPECT_NEAR(distances[0].distance.derivatives()(0), 1, 1e-6);
+  }
+}
+
+// Tests that distance queries involving half spaces are rejected.
+TEST_F(SimplePenetrationTest, SignedDistanceHalfSpaceThrows) {
+  engine_.AddAnchoredGeometry(HalfSpace(), Isometry3<double>::Identity());
+  anchored_map_.push_back(GeometryId::get_new_id());
+  const GeometryIndex dynamic_index = engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+  MoveDynamicSphere(dynamic_index, false /* not colliding */);
+  EXPECT_THROW(engine_.ComputeSignedDistancePairwiseClosestPoints(
+                   dynamic_map_, anchored_map_,
+                   std::numeric_limits<double>::infinity()),
+               std::logic_error);
+}
+
+// Mesh tests
+
+// Tests penetration and signed distance between a dynamic sphere and an
+// anchored cube, loaded from an OBJ file as both a mesh and a convex shape.
+TEST_F(SimplePenetrationTest, MeshAndConvexQueries) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  // The file's cube has edges of length 2; scaled, they match the sphere's
+  // diameter.
+  const double scale = radius_;
+  const Mesh mesh(filename, scale);
+  const Convex convex(filename, scale);
+  for (const Shape* cube : std::vector<const Shape*>{&mesh, &convex}) {
+    ProximityEngine<double> engine;
+    std::vector<GeometryId> dynamic_map;
+    std::vector<GeometryId> anchored_map;
+    engine.AddAnchoredGeometry(*cube, Isometry3<double>::Identity());
+    anchored_map.push_back(GeometryId::get_new_id());
+    const GeometryIndex dynamic_index = engine.AddDynamicGeometry(sphere_);
+    dynamic_map.push_back(GeometryId::get_new_id());
+
+    // The faces of the cube are where the surface of the sphere at the origin
+    // would be, so the configurations match those of two spheres.
+    MoveDynamicSphere(dynamic_index, true /* colliding */, &engine);
+    std::vector<PenetrationAsPointPair<double>> penetrations =
+        engine.ComputePointPairPenetration(dynamic_map, anchored_map);
+    ASSERT_EQ(penetrations.size(), 1);
+    EXPECT_NEAR(penetrations[0].depth, 2 * radius_ - colliding_x_, 1e-6);
+
+    MoveDynamicSphere(dynamic_index, false /* not colliding */, &engine);
+    EXPECT_EQ(
+        engine.ComputePointPairPenetration(dynamic_map, anchored_map).size(),
+        0);
+    std::vector<SignedDistancePair<double>> distances =
+        engine.ComputeSignedDistancePairwiseClosestPoints(
+            dynamic_map, anchored_map,
+            std::numeric_limits<double>::infinity());
+    ASSERT_EQ(distances.size(), 1);
+    EXPECT_NEAR(distances[0].distance, free_x_ - 2 * radius_, 1e-6);
+
+    // Copies of the engine share the loaded geometry, but are still deep
+    // copies of the engine's collision objects.
+    ProximityEngine<double> copy(engine);
+    EXPECT_TRUE(ProximityEngineTester::IsDeepCopy(copy, engine));
+    EXPECT_EQ(
+        copy.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map, anchored_map,
+                std::numeric_limits<double>::infinity())
+            .size(),
+        1);
+  }
+}
+
+// Tests that a mesh file that can't be loaded is reported.
+GTEST_TEST(ProximityEngineTests, MeshMissingFileThrows) {
+  ProximityEngine<double> engine;
+  EXPECT_THROW(engine.AddDynamicGeometry(Mesh("/no/such/file.obj")),
+               std::runtime_error);
+  EXPECT_THROW(engine.AddDynamicGeometry(Convex("/no/such/file.obj")),
+               std::runtime_error);
+}
+
+// Continuous collision tests
+
+// Tests that a sphere which passes through an anchored sphere between the
+// start and end of its motion is reported, even though neither end pose is in
+// contact.
+TEST_F(SimplePenetrationTest, TimeOfImpactTunneling) {
+  engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  anchored_map_.push_back(anchored_id);
+  const GeometryIndex dynamic_index = engine_.AddDynamicGeometry(sphere_);
+  const GeometryId dynamic_id = GeometryId::get_new_id();
+  dynamic_map_.push_back(dynamic_id);
+
+  // The sphere moves from x = -5.2 to x = 4.8; it first touches the anchored
+  // sphere at x = -1, i.e., at t = 0.42.
+  std::vector<Isometry3<double>> X_WG{
+      Isometry3<double>(Translation3d{-5.2, 0, 0})};
+  engine_.UpdateWorldPoses(X_WG);
+  std::vector<Isometry3<double>> X_WG_end{
+      Isometry3<double>(Translation3d{4.8, 0, 0})};
+  ExpectNoPenetration();
+
+  const int num_samples = 21;
+  const std::vector<TimeOfImpact<double>> results =
+      engine_.ComputeTimesOfImpact(dynamic_map_, anchored_map_, X_WG_end,
+                                   num_samples);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_TRUE((results[0].id_A == anchored_id &&
+               results[0].id_B == dynamic_id) ||
+              (results[0].id_A == dynamic_id &&
+               results[0].id_B == anchored_id));
+  // The time is that of the first sample in contact.
+  EXPECT_GE(results[0].time, 0.42);
+  EXPECT_LE(results[0].time, 0.42 + 1.0 / (num_samples - 1));
+
+  // Geometry that is already in contact has a time of impact of zero.
+  MoveDynamicSphere(dynamic_index, true /* colliding */);
+  X_WG_end[0] = Isometry3<double>(Translation3d{colliding_x_, 0, 0});
+  const std::vector<TimeOfImpact<double>> touching =
+      engine_.ComputeTimesOfImpact(dynamic_map_, anchored_map_, X_WG_end,
+                                   num_samples);
+  ASSERT_EQ(touching.size(), 1);
+  EXPECT_EQ(touching[0].time, 0.0);
+}
+
+// Tests that motions which pass each other by, or which never get close, are
+// not reported; and that two moving spheres are each considered in motion.
+TEST_F(SimplePenetrationTest, TimeOfImpactDynamicAndDynamic) {
+  engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+  engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+
+  // The spheres swap places along parallel lines two radii apart (plus a
+  // margin), so they never touch, although their swept bounds overlap.
+  std::vector<Isometry3<double>> X_WG{
+      Isometry3<double>(Translation3d{-5, 0, 0}),
+      Isometry3<double>(Translation3d{5, 2.1 * radius_, 0})};
+  engine_.UpdateWorldPoses(X_WG);
+  std::vector<Isometry3<double>> X_WG_end{
+      Isometry3<double>(Translation3d{5, 0, 0}),
+      Isometry3<double>(Translation3d{-5, 2.1 * radius_, 0})};
+  EXPECT_EQ(
+      engine_.ComputeTimesOfImpact(dynamic_map_, anchored_map_, X_WG_end, 21)
+          .size(),
+      0);
+
+  // The spheres move along the same line; they meet halfway, one diameter
+  // apart, at t = 0.45.
+  X_WG[1].translation() << 5, 0, 0;
+  X_WG_end[1].translation() << -5, 0, 0;
+  engine_.UpdateWorldPoses(X_WG);
+  const std::vector<TimeOfImpact<double>> results =
+      engine_.ComputeTimesOfImpact(dynamic_map_, anchored_map_, X_WG_end, 21);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_GE(results[0].time, 0.45);
+  EXPECT_LE(results[0].time, 0.5);
+
+  // Neither sphere moving reports nothing.
+  EXPECT_EQ(
+      engine_.ComputeTimesOfImpact(dynamic_map_, anchored_map_, X_WG, 21)
+          .size(),
+      0);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -29,15 +29,20 @@ class ReifierTest : public ShapeReifier, public ::testing::Test {
     received_user_data_ = data;
     half_space_made_ = true;
   }
-  void ImplementGeometry(const Mesh&, void*) override {
-    // TODO(SeanCurtis-TRI): Provide body when meshes are meaningfully
-    // supported.
-    EXPECT_TRUE(false) << "Don't test Meshes until they are fully supported";
+  void ImplementGeometry(const Mesh& mesh, void* data) override {
+    received_user_data_ = data;
+    mesh_made_ = true;
+  }
+  void ImplementGeometry(const Convex& convex, void* data) override {
+    received_user_data_ = data;
+    convex_made_ = true;
   }
   void Reset() {
     sphere_made_ = false;
     half_space_made_ = false;
     cylinder_made_ = false;
+    mesh_made_ = false;
+    convex_made_ = false;
     received_user_data_ = nullptr;
   }
 
@@ -45,6 +50,8 @@ class ReifierTest : public ShapeReifier, public ::testing::Test {
   bool sphere_made_{false};
   bool cylinder_made_{false};
   bool half_space_made_{false};
+  bool mesh_made_{false};
+  bool convex_made_{false};
   void* received_user_data_{nullptr};
 };
 
@@ -73,6 +80,20 @@ TEST_F(ReifierTest, ReificationDifferentiation) {
   ASSERT_TRUE(half_space_made_);
   ASSERT_FALSE(cylinder_made_);
 
+  Reset();
+
+  Mesh mesh{"/path/to/mesh.obj"};
+  mesh.Reify(this);
+  ASSERT_TRUE(mesh_made_);
+  ASSERT_FALSE(convex_made_);
+
+  Reset();
+
+  Convex convex{"/path/to/convex.obj"};
+  convex.Reify(this);
+  ASSERT_FALSE(mesh_made_);
+  ASSERT_TRUE(convex_made_);
+
   // NOTE: Because of the implementation of the Shape class, as long as new
   // shape specifications inherit from Shape, this test does *not* need to
   // be extended. The template functionality has already been sufficiently
@@ -87,6 +108,12 @@ TEST_F(ReifierTest, CloningShapes) {
   ASSERT_TRUE(is_dynamic_castable<HalfSpace>(h.Clone().get()));
   Cylinder c(0.5, 2.0);
   ASSERT_TRUE(is_dynamic_castable<Cylinder>(c.Clone().get()));
+  Convex convex("/path/to/convex.obj", 2.0);
+  unique_ptr<Shape> convex_clone = convex.Clone();
+  ASSERT_TRUE(is_dynamic_castable<Convex>(convex_clone.get()));
+  EXPECT_EQ(static_cast<Convex*>(convex_clone.get())->filename(),
+            convex.filename());
+  EXPECT_EQ(static_cast<Convex*>(convex_clone.get())->scale(), 2.0);
 
   // Confirms clone independence. The idea that a clone can outlive its
   // source and there aren't any unintentional bindings between the two.
@@ -1,5 +1,6 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <limits>
@@ -17,12 +18,12 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
           overwrite_publish_time_with_system_clock) {
   if (is_write_) {
     log_ = std::make_unique<::lcm::LogFile>(file_name, "w");
+    if (!log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
   } else {
-    log_ = std::make_unique<::lcm::LogFile>(file_name, "r");
-    next_event_ = log_->readNextEvent();
-  }
-  if (!log_->good()) {
-    throw std::runtime_error("Failed to open log file: " + file_name);
+    index_ = std::make_unique<LcmLogIndex>(file_name);
+    index_->ReadAhead(0);
   }
 }
 
@@ -70,6 +71,17 @@ void DrakeLcmLog::Subscribe(const std::string& channel,
   std::lock_guard<std::mutex> lock(mutex_);
 
   subscriptions_.emplace(channel, std::move(handler));
+  const int channel_index = index_->FindChannel(channel);
+  if (channel_index >= 0 &&
+      std::find(subscribed_channels_.begin(), subscribed_channels_.end(),
+                channel_index) == subscribed_channels_.end()) {
+    subscribed_channels_.push_back(channel_index);
+  }
+}
+
+int DrakeLcmLog::FindNextEvent() const {
+  if (!skip_unsubscribed_channels_) return cursor_;
+  return index_->FindNextEvent(cursor_, subscribed_channels_);
 }
 
 double DrakeLcmLog::GetNextMessageTime() const {
@@ -79,10 +91,11 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  if (next_event_ == nullptr) {
+  const int next_event = FindNextEvent();
+  if (next_event == index_->num_events()) {
     return std::numeric_limits<double>::infinity();
   }
-  return timestamp_to_second(next_event_->timestamp);
+  return timestamp_to_second(index_->event(next_event).timestamp);
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -92,23 +105,49 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  const int next_event = FindNextEvent();
   // End of log, do nothing.
-  if (next_event_ == nullptr) return;
+  if (next_event == index_->num_events()) return;
 
   // Do nothing if the call time does not match the event's time.
-  if (current_time != timestamp_to_second(next_event_->timestamp)) {
+  const LcmLogIndex::Event& event = index_->event(next_event);
+  if (current_time != timestamp_to_second(event.timestamp)) {
     return;
   }
 
   // Dispatch message if necessary.
-  const auto& range = subscriptions_.equal_range(next_event_->channel);
+  const auto& range =
+      subscriptions_.equal_range(index_->channel_name(event.channel));
   for (auto iter = range.first; iter != range.second; ++iter) {
     const HandlerFunction& handler = iter->second;
-    handler(next_event_->data, next_event_->datalen);
+    handler(index_->data(next_event), event.data_size);
   }
 
   // Advance log.
-  next_event_ = log_->readNextEvent();
+  cursor_ = next_event + 1;
+  index_->ReadAhead(cursor_);
+}
+
+void DrakeLcmLog::SeekToTime(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("SeekToTime is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  cursor_ = (time_sec > 0)
+                ? index_->LowerBound(second_to_timestamp(time_sec))
+                : 0;
+  index_->ReadAhead(cursor_);
+}
+
+void DrakeLcmLog::set_skip_unsubscribed_channels(bool skip) {
+  if (is_write_) {
+    throw std::logic_error(
+        "set_skip_unsubscribed_channels is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  skip_unsubscribed_channels_ = skip;
 }
 
 }  // namespace lcm
@@ -12,6 +12,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/lcm/drake_lcm_interface.h"
 #include "drake/lcm/drake_lcm_message_handler_interface.h"
+#include "drake/lcm/lcm_log_index.h"
 
 namespace drake {
 namespace lcm {
@@ -23,6 +24,13 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * For playback, the log is memory-mapped and indexed by LcmLogIndex (which
+ * keeps the index in a sidecar file next to the log), so that playback can
+ * start anywhere in the log via SeekToTime(), and can skip the events that no
+ * one subscribes to without reading them. The part of the log just ahead of
+ * playback is read into memory in the background (see
+ * LcmLogIndex::ReadAhead()).
  */
 class DrakeLcmLog : public DrakeLcmInterface {
  public:
@@ -100,6 +108,27 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the log's cursor to the first message whose timestamp is not
+   * earlier than @p time_sec, which may be before or after the current
+   * message. This takes O(log n) time in the number of messages.
+   *
+   * @throws std::logic_error if this instance is not constructed in read-only
+   * mode.
+   */
+  void SeekToTime(double time_sec);
+
+  /**
+   * If @p skip is true, messages on channels that have no subscriber are
+   * skipped over: GetNextMessageTime() and DispatchMessageAndAdvanceLog() only
+   * consider messages on subscribed channels. Defaults to false, in which
+   * case every message is visited in turn, whether or not it is dispatched.
+   *
+   * @throws std::logic_error if this instance is not constructed in read-only
+   * mode.
+   */
+  void set_skip_unsubscribed_channels(bool skip);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -122,6 +151,9 @@ class DrakeLcmLog : public DrakeLcmInterface {
   }
 
  private:
+  // Returns the index of the next event to visit, at or after cursor_.
+  int FindNextEvent() const;
+
   const bool is_write_;
   const bool overwrite_publish_time_with_system_clock_;
 
@@ -132,8 +164,15 @@ class DrakeLcmLog : public DrakeLcmInterface {
   // This mutes guards access to all of the below member fields.
   mutable std::mutex mutex_;
   std::multimap<std::string, DrakeLcmInterface::HandlerFunction> subscriptions_;
+  // Only used in write-only mode.
   std::unique_ptr<::lcm::LogFile> log_;
-  const ::lcm::LogEvent* next_event_{nullptr};
+
+  // Only used in read-only mode.
+  std::unique_ptr<LcmLogIndex> index_;
+  int cursor_{0};
+  bool skip_unsubscribed_channels_{false};
+  // The index_ channels that have at least one subscriber.
+  std::vector<int> subscribed_channels_;
 };
 
 }  // namespace lcm
@@ -0,0 +1,245 @@
+#include "drake/lcm/lcm_log_index.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace lcm {
+
+namespace {
+
+// The LCM log format: each event is a big-endian header of sync word, event
+// number, timestamp, channel length and data length, followed by the channel
+// name and the message bytes.
+constexpr uint32_t kSyncWord = 0xEDA1DA01;
+constexpr size_t kEventHeaderSize = 4 + 8 + 8 + 4 + 4;
+
+// A generous bound on channel name lengths (LCM itself allows 63 bytes), so
+// that a corrupt header is not mistaken for an event.
+constexpr int32_t kMaxChannelLength = 1024;
+
+// "DRKLIX01" when read as little-endian bytes. The sidecar is a cache on the
+// same machine, so it is written in native byte order.
+constexpr int64_t kIndexFileMagic = 0x313058494c4b5244;
+
+template <typename T>
+T ReadBigEndian(const uint8_t* bytes) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    value = (value << 8) | bytes[i];
+  }
+  return static_cast<T>(value);
+}
+
+struct IndexFileHeader {
+  int64_t magic{};
+  int64_t log_size{};
+  int64_t log_mtime{};
+  int64_t num_channels{};
+  int64_t num_events{};
+};
+
+}  // namespace
+
+LcmLogIndex::LcmLogIndex(const std::string& file_name) {
+  const int fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open log file: " + file_name);
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Failed to open log file: " + file_name);
+  }
+  mapping_size_ = status.st_size;
+  log_mtime_ = static_cast<int64_t>(status.st_mtim.tv_sec) * 1000000000 +
+               status.st_mtim.tv_nsec;
+  if (mapping_size_ > 0) {
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    throw std::runtime_error("Failed to map log file: " + file_name);
+  }
+
+  const std::string index_file_name = GetIndexFileName(file_name);
+  if (!LoadIndex(index_file_name)) {
+    BuildIndex();
+    SaveIndex(index_file_name);
+  }
+
+  channel_events_.resize(channel_names_.size());
+  for (int i = 0; i < num_events(); ++i) {
+    channel_events_[events_[i].channel].push_back(i);
+  }
+}
+
+LcmLogIndex::~LcmLogIndex() {
+  if (mapping_ != nullptr) ::munmap(mapping_, mapping_size_);
+}
+
+std::string LcmLogIndex::GetIndexFileName(const std::string& file_name) {
+  return file_name + ".idx";
+}
+
+int LcmLogIndex::FindChannel(const std::string& name) const {
+  const auto iter = channel_indices_.find(name);
+  return (iter == channel_indices_.end()) ? -1 : iter->second;
+}
+
+int LcmLogIndex::LowerBound(int64_t timestamp) const {
+  const auto iter = std::partition_point(
+      events_.begin(), events_.end(),
+      [timestamp](const Event& e) { return e.timestamp < timestamp; });
+  return static_cast<int>(iter - events_.begin());
+}
+
+int LcmLogIndex::FindNextEvent(int index,
+                               const std::vector<int>& channels) const {
+  int result = num_events();
+  for (int channel : channels) {
+    DRAKE_DEMAND(channel >= 0 && channel < num_channels());
+    const std::vector<int>& indices = channel_events_[channel];
+    const auto iter = std::lower_bound(indices.begin(), indices.end(), index);
+    if (iter != indices.end()) result = std::min(result, *iter);
+  }
+  return result;
+}
+
+int LcmLogIndex::AddChannel(const std::string& name) {
+  const auto inserted = channel_indices_.emplace(
+      name, static_cast<int>(channel_names_.size()));
+  if (inserted.second) channel_names_.push_back(name);
+  return inserted.first->second;
+}
+
+void LcmLogIndex::BuildIndex() {
+  built_from_log_ = true;
+  const uint8_t* const bytes = static_cast<const uint8_t*>(mapping_);
+  size_t pos = 0;
+  while (mapping_size_ - pos >= kEventHeaderSize) {
+    const uint8_t* const header = bytes + pos;
+    const int32_t channel_length = ReadBigEndian<int32_t>(header + 20);
+    const int32_t data_size = ReadBigEndian<int32_t>(header + 24);
+    if (ReadBigEndian<uint32_t>(header) != kSyncWord || channel_length <= 0 ||
+        channel_length > kMaxChannelLength || data_size < 0) {
+      // Not an event; resynchronize on the next sync word.
+      ++pos;
+      continue;
+    }
+    const size_t channel_pos = pos + kEventHeaderSize;
+    const size_t event_end =
+        channel_pos + static_cast<size_t>(channel_length) + data_size;
+    if (event_end > mapping_size_) break;
+
+    Event event;
+    event.timestamp = ReadBigEndian<int64_t>(header + 12);
+    event.data_offset = channel_pos + channel_length;
+    event.data_size = data_size;
+    event.channel = AddChannel(std::string(
+        reinterpret_cast<const char*>(bytes + channel_pos), channel_length));
+    events_.push_back(event);
+    pos = event_end;
+  }
+}
+
+bool LcmLogIndex::LoadIndex(const std::string& index_file_name) {
+  std::FILE* file = std::fopen(index_file_name.c_str(), "rb");
+  if (file == nullptr) return false;
+
+  IndexFileHeader header;
+  bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+            header.magic == kIndexFileMagic &&
+            header.log_size == static_cast<int64_t>(mapping_size_) &&
+            header.log_mtime == log_mtime_ && header.num_channels >= 0 &&
+            header.num_events >= 0 &&
+            header.num_events <= static_cast<int64_t>(
+                mapping_size_ / kEventHeaderSize);
+  for (int64_t i = 0; ok && i < header.num_channels; ++i) {
+    int64_t length = 0;
+    ok = std::fread(&length, sizeof(length), 1, file) == 1 && length > 0 &&
+         length <= kMaxChannelLength;
+    if (!ok) break;
+    std::string name(length, '\0');
+    ok = std::fread(&name[0], 1, length, file) == static_cast<size_t>(length);
+    if (ok) AddChannel(name);
+  }
+  if (ok) {
+    events_.resize(header.num_events);
+    ok = std::fread(events_.data(), sizeof(Event), events_.size(), file) ==
+         events_.size();
+  }
+  for (const Event& event : events_) {
+    if (!ok) break;
+    ok = event.channel >= 0 && event.channel < num_channels() &&
+         event.data_size >= 0 && event.data_offset <= mapping_size_ &&
+         static_cast<uint64_t>(event.data_size) <=
+             mapping_size_ - event.data_offset;
+  }
+  std::fclose(file);
+
+  if (!ok) {
+    events_.clear();
+    channel_names_.clear();
+    channel_indices_.clear();
+  }
+  return ok;
+}
+
+void LcmLogIndex::ReadAhead(int index) {
+  if (index < 0 || index >= num_events()) return;
+  const uint64_t offset = events_[index].data_offset;
+  if (offset >= read_ahead_begin_ &&
+      (offset + kReadAheadBytes / 2 < read_ahead_end_ ||
+       read_ahead_end_ == mapping_size_)) {
+    return;
+  }
+  static const uint64_t page_size = ::sysconf(_SC_PAGESIZE);
+  read_ahead_begin_ = offset - offset % page_size;
+  read_ahead_end_ = std::min<uint64_t>(offset + kReadAheadBytes, mapping_size_);
+  // This is only advice, so failure is harmless.
+  ::madvise(static_cast<uint8_t*>(mapping_) + read_ahead_begin_,
+            read_ahead_end_ - read_ahead_begin_, MADV_WILLNEED);
+}
+
+void LcmLogIndex::SaveIndex(const std::string& index_file_name) const {
+  // Writes to a temporary file that is renamed into place, so that a reader
+  // never sees a partial index, even when several processes open the same
+  // log at once.
+  const std::string temp_file_name =
+      index_file_name + ".tmp" + std::to_string(::getpid());
+  std::FILE* file = std::fopen(temp_file_name.c_str(), "wb");
+  if (file == nullptr) return;
+
+  IndexFileHeader header;
+  header.magic = kIndexFileMagic;
+  header.log_size = static_cast<int64_t>(mapping_size_);
+  header.log_mtime = log_mtime_;
+  header.num_channels = static_cast<int64_t>(channel_names_.size());
+  header.num_events = static_cast<int64_t>(events_.size());
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+  for (const std::string& name : channel_names_) {
+    const int64_t length = static_cast<int64_t>(name.size());
+    ok = ok && std::fwrite(&length, sizeof(length), 1, file) == 1 &&
+         std::fwrite(name.data(), 1, name.size(), file) == name.size();
+  }
+  ok = ok && std::fwrite(events_.data(), sizeof(Event), events_.size(),
+                         file) == events_.size();
+  ok = (std::fclose(file) == 0) && ok;
+
+  if (!ok || std::rename(temp_file_name.c_str(), index_file_name.c_str())) {
+    std::remove(temp_file_name.c_str());
+  }
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * A memory-mapped LCM log file together with an index of its events, so that
+ * events can be found by time or by channel without reading the log from the
+ * start.
+ *
+ * The index is kept in a sidecar file next to the log (see
+ * GetIndexFileName()). It is built by scanning the log the first time the
+ * log is opened, or whenever the log has changed since, and is loaded from
+ * the sidecar otherwise. A sidecar that cannot be written, e.g., because the
+ * log is in a read-only directory, only means that the next open scans the
+ * log again.
+ *
+ * As with lcm::LogFile, corrupt bytes between events are skipped, and an
+ * event that is cut short at the end of the file is ignored.
+ */
+class LcmLogIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmLogIndex)
+
+  /// The location of one event in the log.
+  struct Event {
+    /// The event's timestamp, in microseconds.
+    int64_t timestamp{};
+    /// The offset of the message bytes from the start of the log.
+    uint64_t data_offset{};
+    int32_t data_size{};
+    /// The index of the event's channel; see channel_name().
+    int32_t channel{};
+  };
+
+  /**
+   * Maps the log @p file_name into memory and loads or builds its index.
+   * @throws std::runtime_error if the log cannot be opened.
+   */
+  explicit LcmLogIndex(const std::string& file_name);
+
+  ~LcmLogIndex();
+
+  /// Returns the name of the sidecar index file for the log @p file_name.
+  static std::string GetIndexFileName(const std::string& file_name);
+
+  /// Returns true if the index was built by scanning the log, or false if it
+  /// was loaded from the sidecar file.
+  bool built_from_log() const { return built_from_log_; }
+
+  /// Returns the number of events in the log.
+  int num_events() const { return static_cast<int>(events_.size()); }
+
+  /// Returns the event with index @p index, in log order.
+  const Event& event(int index) const { return events_[index]; }
+
+  /// Returns the message bytes of the event with index @p index, in place.
+  const void* data(int index) const {
+    return static_cast<const uint8_t*>(mapping_) + events_[index].data_offset;
+  }
+
+  /// Returns the number of distinct channels in the log.
+  int num_channels() const { return static_cast<int>(channel_names_.size()); }
+
+  /// Returns the name of the channel with index @p channel.
+  const std::string& channel_name(int channel) const {
+    return channel_names_[channel];
+  }
+
+  /// Returns the index of the channel named @p name, or -1 if no event in the
+  /// log is on that channel.
+  int FindChannel(const std::string& name) const;
+
+  /// Returns the indices of the events on the channel with index @p channel,
+  /// in log order.
+  const std::vector<int>& channel_events(int channel) const {
+    return channel_events_[channel];
+  }
+
+  /**
+   * Returns the index of the first event whose timestamp is not less than
+   * @p timestamp (in microseconds), or num_events() if there is none. This is
+   * a binary search, so it assumes that the log's timestamps do not decrease,
+   * as is the case for logs written by lcm-logger or DrakeLcmLog.
+   */
+  int LowerBound(int64_t timestamp) const;
+
+  /**
+   * Returns the index of the first event at or after @p index whose channel
+   * is one of @p channels, or num_events() if there is none. Events on the
+   * other channels are skipped without being looked at.
+   */
+  int FindNextEvent(int index, const std::vector<int>& channels) const;
+
+  /**
+   * Asks the operating system to start reading the part of the log that
+   * follows event @p index into memory in the background, so that playback
+   * does not stall on disk reads when it gets there. Cheap enough to call
+   * after every event: the request is only renewed once playback has used
+   * up half of the previously requested window, or moved outside it.
+   */
+  void ReadAhead(int index);
+
+  /// The number of bytes of the log that ReadAhead() requests at a time.
+  static constexpr size_t kReadAheadBytes = 8 << 20;
+
+ private:
+  void BuildIndex();
+  bool LoadIndex(const std::string& index_file_name);
+  void SaveIndex(const std::string& index_file_name) const;
+  int AddChannel(const std::string& name);
+
+  void* mapping_{nullptr};
+  size_t mapping_size_{0};
+  int64_t log_mtime_{0};
+  bool built_from_log_{false};
+  uint64_t read_ahead_begin_{0};
+  uint64_t read_ahead_end_{0};
+  std::vector<Event> events_;
+  std::vector<std::string> channel_names_;
+  std::unordered_map<std::string, int> channel_indices_;
+  std::vector<std::vector<int>> channel_events_;
+};
+
+}  // namespace lcm
+}  // namespace drake
@@ -1,7 +1,9 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <cmath>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -79,6 +81,43 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   }
 }
 
+// Plays back part of a log, starting in the middle and skipping a channel
+// that has no subscriber.
+GTEST_TEST(LcmLogTest, LcmLogTestSeekAndSkip) {
+  auto w_log = std::make_unique<DrakeLcmLog>("seek_test.log", true);
+  drake::lcmt_drake_signal msg{};
+  for (int i = 0; i < 10; ++i) {
+    msg.timestamp = i;
+    Publish(w_log.get(), (i % 2 == 0) ? "EVEN" : "ODD", msg, i);
+  }
+  w_log.reset();
+
+  DrakeLcmLog r_log("seek_test.log", false);
+  std::vector<int64_t> received;
+  r_log.Subscribe("ODD", [&received](const void* buffer, int size) {
+    drake::lcmt_drake_signal decoded{};
+    decoded.decode(buffer, 0, size);
+    received.push_back(decoded.timestamp);
+  });
+
+  // Without skipping, the next message is on either channel.
+  r_log.SeekToTime(3.5);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 4);
+
+  // With skipping, only the subscribed channel is visited.
+  r_log.set_skip_unsubscribed_channels(true);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 5);
+  double time{};
+  while (!std::isinf(time = r_log.GetNextMessageTime())) {
+    r_log.DispatchMessageAndAdvanceLog(time);
+  }
+  EXPECT_EQ(received, std::vector<int64_t>({5, 7, 9}));
+
+  // Seeking backwards rewinds the log.
+  r_log.SeekToTime(0);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 1);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -0,0 +1,151 @@
+#include "drake/lcm/lcm_log_index.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+void AppendBigEndian(uint64_t value, int num_bytes, std::string* out) {
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+// Appends an event in the LCM log format.
+void AppendEvent(int64_t event_number, int64_t timestamp,
+                 const std::string& channel, const std::string& data,
+                 std::string* out) {
+  AppendBigEndian(0xEDA1DA01, 4, out);
+  AppendBigEndian(event_number, 8, out);
+  AppendBigEndian(timestamp, 8, out);
+  AppendBigEndian(channel.size(), 4, out);
+  AppendBigEndian(data.size(), 4, out);
+  *out += channel;
+  *out += data;
+}
+
+void WriteFile(const std::string& file_name, const std::string& contents) {
+  std::ofstream file(file_name, std::ios::binary);
+  file << contents;
+}
+
+std::string GetData(const LcmLogIndex& dut, int index) {
+  return std::string(static_cast<const char*>(dut.data(index)),
+                     dut.event(index).data_size);
+}
+
+class LcmLogIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    file_name_ = temp_directory() + "/lcm_log_index_test.log";
+    std::remove(LcmLogIndex::GetIndexFileName(file_name_).c_str());
+
+    // Events alternate between two channels, with some garbage in between
+    // and an event cut short at the end.
+    std::string contents;
+    for (int i = 0; i < 10; ++i) {
+      AppendEvent(i, 1000 * i, (i % 2 == 0) ? "EVEN" : "ODD",
+                  "message" + std::to_string(i), &contents);
+      if (i == 4) contents += "garbage";
+    }
+    std::string truncated;
+    AppendEvent(10, 10000, "EVEN", "message10", &truncated);
+    contents += truncated.substr(0, truncated.size() - 3);
+    WriteFile(file_name_, contents);
+  }
+
+  void TearDown() override {
+    std::remove(LcmLogIndex::GetIndexFileName(file_name_).c_str());
+    std::remove(file_name_.c_str());
+  }
+
+  void CheckIndex(const LcmLogIndex& dut) {
+    ASSERT_EQ(dut.num_events(), 10);
+    ASSERT_EQ(dut.num_channels(), 2);
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(dut.event(i).timestamp, 1000 * i);
+      EXPECT_EQ(dut.channel_name(dut.event(i).channel),
+                (i % 2 == 0) ? "EVEN" : "ODD");
+      EXPECT_EQ(GetData(dut, i), "message" + std::to_string(i));
+    }
+    EXPECT_EQ(dut.channel_events(dut.FindChannel("ODD")),
+              std::vector<int>({1, 3, 5, 7, 9}));
+  }
+
+  std::string file_name_;
+};
+
+TEST_F(LcmLogIndexTest, BuildAndReload) {
+  {
+    const LcmLogIndex dut(file_name_);
+    EXPECT_TRUE(dut.built_from_log());
+    CheckIndex(dut);
+  }
+
+  // The second time around, the index comes from the sidecar.
+  const LcmLogIndex dut(file_name_);
+  EXPECT_FALSE(dut.built_from_log());
+  CheckIndex(dut);
+}
+
+TEST_F(LcmLogIndexTest, StaleSidecar) {
+  { const LcmLogIndex dut(file_name_); }
+
+  // Changing the log invalidates the sidecar.
+  std::string contents;
+  AppendEvent(0, 5, "OTHER", "other", &contents);
+  WriteFile(file_name_, contents);
+  const LcmLogIndex dut(file_name_);
+  EXPECT_TRUE(dut.built_from_log());
+  ASSERT_EQ(dut.num_events(), 1);
+  EXPECT_EQ(dut.channel_name(0), "OTHER");
+  EXPECT_EQ(GetData(dut, 0), "other");
+  EXPECT_EQ(dut.FindChannel("EVEN"), -1);
+
+  // So does corrupting the sidecar.
+  WriteFile(LcmLogIndex::GetIndexFileName(file_name_), "not an index");
+  EXPECT_TRUE(LcmLogIndex(file_name_).built_from_log());
+}
+
+TEST_F(LcmLogIndexTest, Search) {
+  const LcmLogIndex dut(file_name_);
+  EXPECT_EQ(dut.LowerBound(-1), 0);
+  EXPECT_EQ(dut.LowerBound(0), 0);
+  EXPECT_EQ(dut.LowerBound(4500), 5);
+  EXPECT_EQ(dut.LowerBound(5000), 5);
+  EXPECT_EQ(dut.LowerBound(9001), 10);
+
+  const int even = dut.FindChannel("EVEN");
+  const int odd = dut.FindChannel("ODD");
+  EXPECT_EQ(dut.FindNextEvent(3, {even}), 4);
+  EXPECT_EQ(dut.FindNextEvent(4, {even}), 4);
+  EXPECT_EQ(dut.FindNextEvent(4, {odd}), 5);
+  EXPECT_EQ(dut.FindNextEvent(4, {odd, even}), 4);
+  EXPECT_EQ(dut.FindNextEvent(9, {even}), 10);
+  EXPECT_EQ(dut.FindNextEvent(0, {}), 10);
+}
+
+TEST_F(LcmLogIndexTest, EmptyLog) {
+  WriteFile(file_name_, "");
+  const LcmLogIndex dut(file_name_);
+  EXPECT_EQ(dut.num_events(), 0);
+  EXPECT_EQ(dut.num_channels(), 0);
+  EXPECT_EQ(dut.LowerBound(0), 0);
+}
+
+TEST_F(LcmLogIndexTest, MissingLog) {
+  EXPECT_THROW(LcmLogIndex(file_name_ + ".missing"), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
@@ -13,7 +13,6 @@ namespace manipulation {
 
 using Eigen::Matrix3Xd;
 using Eigen::MatrixXd;
-using Eigen::RowVectorXd;
 using Eigen::VectorXd;
 using Eigen::VectorXi;
 using drake::MatrixX;
@@ -193,6 +192,7 @@ void QuasistaticSystem<Scalar>::Initialize() {
   }
 
   // initialize initial guess and intended penetration vectors
+  delta_q_start_.resize(n1_);
   lambda_n_start_.resize(nc_);
   lambda_f_start_.resize(nd_);
   gamma_start_.resize(nc_);
@@ -201,6 +201,7 @@ void QuasistaticSystem<Scalar>::Initialize() {
   z_gamma_start_.resize(nc_);
   phi_bar_.resize(nc_);
 
+  delta_q_start_.setZero();
   lambda_n_start_.setZero();
   lambda_f_start_.setZero();
   gamma_start_.setZero();
@@ -321,6 +322,48 @@ void QuasistaticSystem<Scalar>::Initialize() {
 
   // set solver options.
   prog_->SetSolverOption(solvers::GurobiSolver::id(), "OutputFlag", 0);
+
+  // The kinetic energy minimizing QP is also built once, with the constraints
+  // of every contact mode; MinimizeKineticEnergy() updates their coefficients
+  // and bounds in place.
+  if (is_using_kinetic_energy_minimizing_QP_) {
+    prog_QP_.reset(new solvers::MathematicalProgram());
+    delta_qu_QP_ = prog_QP_->NewContinuousVariables(nu_, "delta_qu_QP");
+    // Jnu * delta_qu >= -phi - Jna * delta_qa, or == if λn > 0.
+    non_penetration_QP_ =
+        prog_QP_
+            ->AddLinearConstraint(MatrixXd::Zero(nc_, nu_),
+                                  -VectorXd::Constant(nc_, kInfinity),
+                                  VectorXd::Constant(nc_, kInfinity),
+                                  delta_qu_QP_)
+            .evaluator()
+            .get();
+    // sliding velocities of the contacts along each tangent vector.
+    friction_QP_ =
+        prog_QP_
+            ->AddLinearConstraint(MatrixXd::Zero(nd_, nu_),
+                                  -VectorXd::Constant(nd_, kInfinity),
+                                  VectorXd::Constant(nd_, kInfinity),
+                                  delta_qu_QP_)
+            .evaluator()
+            .get();
+    // up to two constraints per contact relating the sliding velocities along
+    // adjacent tangent vectors.
+    sliding_direction_QP_ =
+        prog_QP_
+            ->AddLinearConstraint(MatrixXd::Zero(2 * nc_, nu_),
+                                  -VectorXd::Constant(2 * nc_, kInfinity),
+                                  VectorXd::Constant(2 * nc_, kInfinity),
+                                  delta_qu_QP_)
+            .evaluator()
+            .get();
+    objective_QP_ = prog_QP_
+                        ->AddQuadraticCost(MatrixXd::Zero(nu_, nu_),
+                                           VectorXd::Zero(nu_), delta_qu_QP_)
+                        .evaluator()
+                        .get();
+    prog_QP_->SetSolverOption(solvers::GurobiSolver::id(), "OutputFlag", 0);
+  }
 }
 
 template <class Scalar>
@@ -598,73 +641,57 @@ void QuasistaticSystem<Scalar>::MinimizeKineticEnergy(
     const Eigen::Ref<const Eigen::VectorXd>& phi,
     KinematicsCache<double>* const cache) const {
   VectorXd& delta_q_value = *delta_q_value_ptr;
-  solvers::MathematicalProgram prog_QP;
-  auto delta_qu_QP = prog_QP.NewContinuousVariables(nu_, "delta_qu_QP");
   VectorXd Jna_times_delta_qa = VectorXd::Zero(nc_);
   VectorXd Jfa_times_delta_qa = VectorXd::Zero(nd_);
-  VectorXd delta_phi_f_value = VectorXd::Zero(nd_);
   for (int i = 0; i < na_; i++) {
     int idx = idx_qa_in_q_[i];
     Jna_times_delta_qa += Jn.col(idx_qa_[i]) * delta_q_value(idx);
     Jfa_times_delta_qa += Jf.col(idx_qa_[i]) * delta_q_value(idx);
   }
-  for (int i = 0; i < n1_; i++) {
-    delta_phi_f_value += Jf.col(idx_q_[i]) * delta_q_value(i);
-  }
+  // columns of Jn and Jf corresponding to qu.
+  MatrixXd Jnu(nc_, nu_);
+  MatrixXd Jfu(nd_, nu_);
+  for (int j = 0; j < nu_; j++) {
+    Jnu.col(j) = Jn.col(idx_qu_[j]);
+    Jfu.col(j) = Jf.col(idx_qu_[j]);
+  }
+
+  // The QP holds the constraints for every contact mode; the rows that do not
+  // apply to the contact mode found by the MIQP are left unbounded.
+  VectorXd lb_n = -phi - Jna_times_delta_qa;
+  VectorXd ub_n = VectorXd::Constant(nc_, kInfinity);
+  VectorXd lb_f = VectorXd::Constant(nd_, -kInfinity);
+  VectorXd ub_f = VectorXd::Constant(nd_, kInfinity);
+  MatrixXd A_s = MatrixXd::Zero(2 * nc_, nu_);
+  VectorXd lb_s = VectorXd::Constant(2 * nc_, -kInfinity);
+  VectorXd ub_s = VectorXd::Constant(2 * nc_, kInfinity);
   // index of first row of Jf_i (corresponding to contact i) in Jf.
   int idx_fi0 = 0;
   for (int i = 0; i < nc_; i++) {
-    // row of Jn corresponding to contact i
-    MatrixXd Jnu_row;
-    Jnu_row.resize(1, nu_);
-    for (int j = 0; j < nu_; j++) {
-      Jnu_row(0, j) = Jn(i, idx_qu_[j]);
-    }
-    // if contact force == 0
-    if (z_n_value(i) > 0.5) {
-      prog_QP.AddLinearConstraint(Jnu_row * delta_qu_QP +
-                                      Jna_times_delta_qa.segment(i, 1) >=
-                                  -phi.segment(i, 1));
-    } else {
-      // z_n_value(i) == 0 --> phi_n(i) == 0
-      prog_QP.AddLinearConstraint(Jnu_row * delta_qu_QP +
-                                      Jna_times_delta_qa.segment(i, 1) ==
-                                  -phi.segment(i, 1));
+    // if contact force != 0, i.e. z_n_value(i) == 0 --> phi_n(i) == 0
+    if (z_n_value(i) < 0.5) {
+      ub_n(i) = lb_n(i);
       const int tangent_vector_half_count = nf_(i) / 2;
-      MatrixXd Jfu_half(tangent_vector_half_count, nu_);
-      MatrixXd Jfu(nf_(i), nu_);
-      for (int j = 0; j < nu_; j++) {
-        Jfu_half.col(j) =
-            Jf.block(idx_fi0, idx_qu_[j], tangent_vector_half_count, 1);
-        Jfu.col(j) = Jf.block(idx_fi0, idx_qu_[j], nf_(i), 1);
-      }
-      VectorXd Jfa_times_delta_qa_i =
+      const VectorXd Jfa_times_delta_qa_i =
           Jfa_times_delta_qa.segment(idx_fi0, nf_(i));
       // if contact i is not sliding.
       if (z_gamma_value(i) > 0.5) {
-        prog_QP.AddLinearConstraint(
-            Jfu_half * delta_qu_QP ==
-            -Jfa_times_delta_qa_i.segment(0, tangent_vector_half_count));
-
+        lb_f.segment(idx_fi0, tangent_vector_half_count) =
+            -Jfa_times_delta_qa_i.head(tangent_vector_half_count);
+        ub_f.segment(idx_fi0, tangent_vector_half_count) =
+            -Jfa_times_delta_qa_i.head(tangent_vector_half_count);
       } else {
         // if contact i is sliding:
         // 1. if lambda_f_ij <= M, the sliding velocity opposite to d_ij
         // must be positive.
-
         std::vector<int> non_zero_friction_idx;
-        int non_zero_friction_count = 0;
-
         for (int j = 0; j < nf_(i); j++) {
-          RowVectorXd Jfu_row(nu_);
-          Jfu_row = Jfu.row(j);
           if (z_f_value(idx_fi0 + j) < 0.5) {  // lambda_f_ij <= M
-            prog_QP.AddLinearConstraint(Jfu_row * delta_qu_QP <=
-                                        -Jfa_times_delta_qa_i.segment(j, 1));
-
-            non_zero_friction_count++;
+            ub_f(idx_fi0 + j) = -Jfa_times_delta_qa_i(j);
             non_zero_friction_idx.push_back(j);
           }
         }
+        const int non_zero_friction_count = non_zero_friction_idx.size();
         // 2. if there are friction forces in two adjacent directions, the
         // corresponding sliding velocities in those directions must be
         // equal.
@@ -674,70 +701,55 @@ void QuasistaticSystem<Scalar>::MinimizeKineticEnergy(
                 (non_zero_friction_idx[0] + tangent_vector_half_count) % nf_(i);
             const int j_opposite_next = (j_opposite + 1) % nf_(i);
             const int j_opposite_previous = (j_opposite - 1 + nf_(i)) % nf_(i);
-            RowVectorXd Jfu_opposite_next(nu_);
-            RowVectorXd Jfu_opposite_previous(nu_);
-            RowVectorXd Jfu_opposite(nu_);
-            Jfu_opposite_next = Jfu.row(j_opposite_next);
-            Jfu_opposite_previous = Jfu.row(j_opposite_previous);
-            Jfu_opposite = Jfu.row(j_opposite);
-
-            const symbolic::Expression delta_phi_f_ij_opposite =
-                Jfu_opposite.transpose().dot(delta_qu_QP) +
-                Jfa_times_delta_qa_i(j_opposite);
-            const symbolic::Expression delta_phi_f_ij_opposite_next =
-                Jfu_opposite_next.transpose().dot(delta_qu_QP) +
-                Jfa_times_delta_qa_i(j_opposite_next);
-            const symbolic::Expression delta_phi_f_ij_opposite_previous =
-                Jfu_opposite_previous.transpose().dot(delta_qu_QP) +
-                Jfa_times_delta_qa_i(j_opposite_previous);
-            prog_QP.AddLinearConstraint(delta_phi_f_ij_opposite_next <=
-                                        delta_phi_f_ij_opposite);
-            prog_QP.AddLinearConstraint(delta_phi_f_ij_opposite_previous <=
-                                        delta_phi_f_ij_opposite);
-
+            // delta_phi_f_ij_opposite_next <= delta_phi_f_ij_opposite
+            A_s.row(2 * i) = Jfu.row(idx_fi0 + j_opposite_next) -
+                             Jfu.row(idx_fi0 + j_opposite);
+            ub_s(2 * i) = Jfa_times_delta_qa_i(j_opposite) -
+                          Jfa_times_delta_qa_i(j_opposite_next);
+            // delta_phi_f_ij_opposite_previous <= delta_phi_f_ij_opposite
+            A_s.row(2 * i + 1) = Jfu.row(idx_fi0 + j_opposite_previous) -
+                                 Jfu.row(idx_fi0 + j_opposite);
+            ub_s(2 * i + 1) = Jfa_times_delta_qa_i(j_opposite) -
+                              Jfa_times_delta_qa_i(j_opposite_previous);
           } else if (non_zero_friction_count == 2) {
-            DRAKE_DEMAND(non_zero_friction_count == 2);
-            int j1 = non_zero_friction_idx[0];
-            int j2 = non_zero_friction_idx[1];
-            RowVectorXd Jfu_row1(nu_);
-            RowVectorXd Jfu_row2(nu_);
-            Jfu_row1 = Jfu.row(j1);
-            Jfu_row2 = Jfu.row(j2);
-            const symbolic::Expression lhs =
-                Jfa_times_delta_qa(idx_fi0 + j1) +
-                Jfu_row1.transpose().dot(delta_qu_QP);
-            const symbolic::Expression rhs =
-                Jfa_times_delta_qa(idx_fi0 + j2) +
-                Jfu_row2.transpose().dot(delta_qu_QP);
-            prog_QP.AddLinearConstraint(lhs == rhs);
+            const int j1 = non_zero_friction_idx[0];
+            const int j2 = non_zero_friction_idx[1];
+            A_s.row(2 * i) = Jfu.row(idx_fi0 + j1) - Jfu.row(idx_fi0 + j2);
+            lb_s(2 * i) = Jfa_times_delta_qa_i(j2) - Jfa_times_delta_qa_i(j1);
+            ub_s(2 * i) = lb_s(2 * i);
           }
         }
       }
     }
     idx_fi0 += nf_(i);
   }
+  non_penetration_QP_->UpdateCoefficients(Jnu, lb_n, ub_n);
+  friction_QP_->UpdateCoefficients(Jfu, lb_f, ub_f);
+  sliding_direction_QP_->UpdateCoefficients(A_s, lb_s, ub_s);
+
   // cost = Δq_u' * H * Δq_u
   MatrixXd H(nu_, nu_);
-
-  H.setZero();
   MatrixXd H_all = tree_->massMatrix(*cache);
   for (int i = 0; i < nu_; i++) {
     for (int j = 0; j < nu_; j++) {
       H(i, j) = H_all(idx_qu_[i], idx_qu_[j]);
     }
   }
+  objective_QP_->UpdateCoefficients(H, VectorXd::Zero(nu_));
 
-  prog_QP.AddQuadraticCost(H, VectorXd::Zero(nu_), delta_qu_QP);
+  // The MIQP solution satisfies these constraints, so it is a good start.
+  VectorXd delta_qu_start(nu_);
+  for (int i = 0; i < nu_; i++) {
+    delta_qu_start(i) = delta_q_value(idx_qu_in_q_[i]);
+  }
+  prog_QP_->SetInitialGuess(delta_qu_QP_, delta_qu_start);
 
   // solve QP
-  prog_QP.SetSolverOption(solvers::GurobiSolver::id(), "OutputFlag", 0);
-  const auto result_QP = solver_.Solve(prog_QP);
-
-  // get QP solution
-  auto delta_qu_QP_value = prog_QP.GetSolution(delta_qu_QP);
+  const auto result_QP = solver_.Solve(*prog_QP_);
 
   // replace qu in the MIQP solution with the QP solution
   if (result_QP == drake::solvers::kSolutionFound) {
+    const VectorXd delta_qu_QP_value = prog_QP_->GetSolution(delta_qu_QP_);
     for (int i = 0; i < nu_; i++) {
       delta_q_value(idx_qu_in_q_[i]) = delta_qu_QP_value(i);
     }
@@ -867,7 +879,7 @@ void QuasistaticSystem<Scalar>::StepForward(
   objective_->UpdateCoefficients(Q, b);
 
   // initial guesses
-  prog_->SetInitialGuess(delta_q_, VectorXd::Constant(n1_, 0));
+  prog_->SetInitialGuess(delta_q_, delta_q_start_);
   prog_->SetInitialGuess(lambda_n_, lambda_n_start_);
   prog_->SetInitialGuess(lambda_f_, lambda_f_start_);
   prog_->SetInitialGuess(gamma_, gamma_start_);
@@ -946,6 +958,7 @@ void QuasistaticSystem<Scalar>::DoCalcDiscreteVariableUpdates(
   ql1 += delta_q_value;
 
   // update initial guesses
+  delta_q_start_ = delta_q_value;
   lambda_n_start_ = lambda_n_value;
   gamma_start_ = gamma_value;
   z_n_start_ = z_n_value;
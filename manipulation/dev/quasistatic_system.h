@@ -223,6 +223,7 @@ class QuasistaticSystem : public systems::LeafSystem<Scalar> {
   // By solving a QP that minimizes the kinetic energy of the systemn, this
   // function finds the delta_q that results in a motion consistent with the
   // MIQP solution, and at the same time minimizes the KE of the system.
+  // The QP is warm-started from the MIQP solution.
   void MinimizeKineticEnergy(
       Eigen::VectorXd* const delta_q_value_ptr,
       const Eigen::Ref<const Eigen::MatrixXd>& Jn,
@@ -249,7 +250,8 @@ class QuasistaticSystem : public systems::LeafSystem<Scalar> {
                    const Eigen::Ref<const Eigen::VectorXd>& f,
                    const Eigen::Ref<const Eigen::VectorXd>& qa_dot_d) const;
 
-  // initial guesses
+  // initial guesses, i.e. the solution of the previous time step.
+  mutable Eigen::VectorXd delta_q_start_;
   mutable Eigen::VectorXd lambda_n_start_;
   mutable Eigen::VectorXd lambda_f_start_;
   mutable Eigen::VectorXd gamma_start_;
@@ -285,6 +287,15 @@ class QuasistaticSystem : public systems::LeafSystem<Scalar> {
   solvers::LinearConstraint* coulomb_friction2_complementary_{nullptr};
   solvers::LinearConstraint* decision_variables_complementary_{nullptr};
   solvers::QuadraticCost* objective_{nullptr};
+
+  // kinetic energy minimizing QP, built only if
+  // is_using_kinetic_energy_minimizing_QP_ is true.
+  std::unique_ptr<solvers::MathematicalProgram> prog_QP_;
+  solvers::VectorXDecisionVariable delta_qu_QP_;
+  solvers::LinearConstraint* non_penetration_QP_{nullptr};
+  solvers::LinearConstraint* friction_QP_{nullptr};
+  solvers::LinearConstraint* sliding_direction_QP_{nullptr};
+  solvers::QuadraticCost* objective_QP_{nullptr};
 };
 
 }  // namespace manipulation
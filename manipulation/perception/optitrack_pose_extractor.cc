@@ -1,10 +1,12 @@
 #include "drake/manipulation/perception/optitrack_pose_extractor.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/quaternion.h"
 #include "drake/math/rotation_matrix.h"
@@ -62,17 +64,36 @@ optional<int> FindOptitrackObjectId(
 OptitrackPoseExtractor::OptitrackPoseExtractor(
     int object_id, const Isometry3<double>& X_WO,
     double optitrack_lcm_status_period)
-    : object_id_(object_id),
-      measured_pose_output_port_{
-          this->DeclareAbstractOutputPort(
-                  &OptitrackPoseExtractor::OutputMeasuredPose)
-              .get_index()},
-      X_WO_(X_WO) {
-  DeclareAbstractState(
-      systems::AbstractValue::Make<Isometry3<double>>(
-          Isometry3<double>::Identity()));
+    : OptitrackPoseExtractor(std::vector<int>{object_id}, X_WO,
+                             optitrack_lcm_status_period) {}
+
+OptitrackPoseExtractor::OptitrackPoseExtractor(
+    const std::vector<int>& object_ids, const Isometry3<double>& X_WO,
+    double optitrack_lcm_status_period)
+    : object_ids_(object_ids), X_WO_(X_WO) {
+  DRAKE_THROW_UNLESS(!object_ids_.empty());
+  for (int i = 0; i < num_objects(); ++i) {
+    sorted_object_ids_.emplace_back(object_ids_[i], i);
+    // Internal state i is the Isometry3d of object i.
+    DeclareAbstractState(
+        systems::AbstractValue::Make<Isometry3<double>>(
+            Isometry3<double>::Identity()));
+    measured_pose_output_ports_.push_back(
+        this->DeclareAbstractOutputPort(
+                [](const Context<double>&) {
+                  return systems::AbstractValue::Make<Isometry3<double>>(
+                      Isometry3<double>::Identity());
+                },
+                [this, i](const Context<double>& context,
+                          systems::AbstractValue* output) {
+                  this->OutputMeasuredPose(
+                      i, context,
+                      &output->GetMutableValue<Isometry3<double>>());
+                })
+            .get_index());
+  }
+  std::sort(sorted_object_ids_.begin(), sorted_object_ids_.end());
   this->DeclareAbstractInputPort();
-  // Internal state is an Isometry3d.
   this->DeclarePeriodicUnrestrictedUpdate(optitrack_lcm_status_period, 0);
 }
 
@@ -80,26 +101,46 @@ void OptitrackPoseExtractor::DoCalcUnrestrictedUpdate(
     const systems::Context<double>& context,
     const std::vector<const systems::UnrestrictedUpdateEvent<double>*>&,
     systems::State<double>* state) const {
-  // Extract Internal state.
-  Isometry3<double>& internal_state =
-      state->get_mutable_abstract_state<Isometry3<double>>(0);
-
   // Update world state from inputs.
   const systems::AbstractValue* input = this->EvalAbstractInput(context, 0);
   DRAKE_ASSERT(input != nullptr);
   auto& message = input->GetValue<optitrack::optitrack_frame_t>();
-  auto body = FindOptitrackBody(message, object_id_);
-  if (!body.has_value()) {
-    throw std::runtime_error(fmt::format(
-        "optitrack: id {} not found", object_id_));
+
+  // Scan the message once, looking up each body among the tracked objects.
+  // As in FindOptitrackBody(), the first body with a given ID wins.
+  int num_found = 0;
+  std::vector<bool> found(object_ids_.size(), false);
+  for (const auto& body : message.rigid_bodies) {
+    auto range = std::equal_range(
+        sorted_object_ids_.begin(), sorted_object_ids_.end(),
+        std::make_pair(body.id, 0),
+        [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+          return a.first < b.first;
+        });
+    if (range.first == range.second || found[range.first->second]) {
+      continue;
+    }
+    const Isometry3<double> X_WB = X_WO_ * ExtractOptitrackPose(body);
+    for (auto it = range.first; it != range.second; ++it) {
+      found[it->second] = true;
+      ++num_found;
+      state->get_mutable_abstract_state<Isometry3<double>>(it->second) = X_WB;
+    }
+  }
+  if (num_found < num_objects()) {
+    for (int i = 0; i < num_objects(); ++i) {
+      if (!found[i]) {
+        throw std::runtime_error(fmt::format(
+            "optitrack: id {} not found", object_ids_[i]));
+      }
+    }
   }
-  internal_state = X_WO_ * ExtractOptitrackPose(*body);
 }
 
 void OptitrackPoseExtractor::OutputMeasuredPose(
-    const Context<double>& context, Isometry3<double>* output) const {
-  const auto state_value = context.get_abstract_state<Isometry3<double>>(0);
-  *output = state_value;
+    int index, const Context<double>& context,
+    Isometry3<double>* output) const {
+  *output = context.get_abstract_state<Isometry3<double>>(index);
 }
 
 }  // namespace perception
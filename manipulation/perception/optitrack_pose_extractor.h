@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "optitrack/optitrack_data_descriptions_t.hpp"
@@ -49,9 +50,14 @@ optional<int> FindOptitrackObjectId(
     const std::string& object_name);
 
 /**
- * Extracts and provides an output of the pose of a desired object as an
- * Eigen::Isometry3d from an Optitrack LCM OPTITRACK_FRAME_T message, the
- * pose transformed to a desired coordinate frame.
+ * Extracts and provides an output of the pose of each of a set of desired
+ * objects as an Eigen::Isometry3d from an Optitrack LCM OPTITRACK_FRAME_T
+ * message, the pose transformed to a desired coordinate frame.
+ *
+ * The message is scanned once per update for all of the objects, so a single
+ * extractor for many objects is much cheaper than one extractor per object.
+ * There is one output port per object, in the order in which the objects are
+ * given at construction.
  */
 class OptitrackPoseExtractor : public systems::LeafSystem<double> {
  public:
@@ -69,8 +75,27 @@ class OptitrackPoseExtractor : public systems::LeafSystem<double> {
   OptitrackPoseExtractor(int object_id, const Isometry3<double>& X_WO,
                          double optitrack_lcm_status_period);
 
-  const systems::OutputPort<double>& get_measured_pose_output_port() const {
-    return this->get_output_port(measured_pose_output_port_);
+  /**
+   * Constructs an OptitrackPoseExtractor for several objects.
+   * @param object_ids The IDs of the objects being tracked, which must all
+   * be present within the OPTITRACK_FRAME_T message or else a runtime
+   * exception is thrown. It must not be empty.
+   * @param X_WO The pose of the optitrack frame O in the World frame W.
+   * @param optitrack_lcm_status_period The discrete update period of the
+   * OptitrackPoseExtractor.
+   */
+  OptitrackPoseExtractor(const std::vector<int>& object_ids,
+                         const Isometry3<double>& X_WO,
+                         double optitrack_lcm_status_period);
+
+  /// Returns the number of objects being tracked.
+  int num_objects() const { return static_cast<int>(object_ids_.size()); }
+
+  /// Returns the output port for the pose of the object at @p index in the
+  /// list of objects given at construction.
+  const systems::OutputPort<double>& get_measured_pose_output_port(
+      int index = 0) const {
+    return this->get_output_port(measured_pose_output_ports_.at(index));
   }
 
  private:
@@ -79,12 +104,15 @@ class OptitrackPoseExtractor : public systems::LeafSystem<double> {
       const std::vector<const systems::UnrestrictedUpdateEvent<double>*>& event,
       systems::State<double>* state) const override;
 
-  // The Calc() method for the measured_pose_output_port.
-  void OutputMeasuredPose(const systems::Context<double>& context,
+  // The Calc() method for the measured_pose_output_port of the object at
+  // index.
+  void OutputMeasuredPose(int index, const systems::Context<double>& context,
                           Isometry3<double>* output) const;
 
-  const int object_id_{0};
-  const int measured_pose_output_port_{-1};
+  const std::vector<int> object_ids_;
+  // The pairs (object ID, index) for all the objects, sorted by ID.
+  std::vector<std::pair<int, int>> sorted_object_ids_;
+  std::vector<int> measured_pose_output_ports_;
   // Pose of the optitrack frame O in the world frame W.
   const Isometry3<double> X_WO_;
 };
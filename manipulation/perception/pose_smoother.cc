@@ -1,12 +1,12 @@
 #include "drake/manipulation/perception/pose_smoother.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/text_logging.h"
-#include "drake/manipulation/util/moving_average_filter.h"
 #include "drake/math/quaternion.h"
 #include "drake/systems/framework/context.h"
 
@@ -15,34 +15,73 @@ namespace drake {
 using Eigen::Quaterniond;
 using Eigen::Isometry3d;
 namespace manipulation {
-
-using util::MovingAverageFilter;
 namespace perception {
 namespace {
-struct InternalState {
-  explicit InternalState(int filter_window_size = 0) :
-      filter(filter_window_size > 1?
-             std::make_unique<MovingAverageFilter<VectorX<double>>>(
-                 filter_window_size) : nullptr) {}
+// A pose as positions in the first 3 dimensions and orientation in quaternions
+// in the next 4.
+typedef Eigen::Matrix<double, 7, 1> PoseVector;
 
+struct BodyState {
   Isometry3<double> pose{Isometry3d::Identity()};
   Vector6<double> velocity{Vector6<double>::Zero()};
   double time_at_last_accepted_pose{0.0};
   bool is_first_time{true};
-  copyable_unique_ptr<util::MovingAverageFilter<VectorX<double>>> filter;
+  // The number of samples in the moving average window of this body, and the
+  // slot of the window that the next sample goes to.
+  int window_count{0};
+  int window_next{0};
+};
+
+struct InternalState {
+  explicit InternalState(int num_poses = 0, int filter_window_size = 0)
+      : bodies(num_poses),
+        window_size(std::max(filter_window_size, 1)),
+        window(PoseVector::RowsAtCompileTime, num_poses * window_size),
+        window_sum(PoseVector::RowsAtCompileTime, num_poses) {}
+
+  // Adds @p sample to the moving average window of body @p index, and returns
+  // the average of the window. This matches util::MovingAverageFilter.
+  PoseVector UpdateAverage(int index, const PoseVector& sample) {
+    BodyState& body = bodies[index];
+    auto sum = window_sum.col(index);
+    auto slots = window.middleCols(index * window_size, window_size);
+    if (body.window_count == 0) {
+      sum = sample;
+    } else {
+      sum += sample;
+    }
+    if (body.window_count == window_size) {
+      // The window is full, and the oldest sample is in the next slot.
+      sum -= slots.col(body.window_next);
+    } else {
+      ++body.window_count;
+    }
+    slots.col(body.window_next) = sample;
+    body.window_next = (body.window_next + 1) % window_size;
+    return (1.0 / body.window_count) * sum;
+  }
+
+  std::vector<BodyState> bodies;
+  int window_size{1};
+  // The moving average windows of all the bodies, where the samples of body i
+  // are the columns [i * window_size, (i + 1) * window_size).
+  Eigen::Matrix<double, PoseVector::RowsAtCompileTime, Eigen::Dynamic> window;
+  // The sum of the samples in each window, one column per body.
+  Eigen::Matrix<double, PoseVector::RowsAtCompileTime, Eigen::Dynamic>
+      window_sum;
 };
 
 /*
  * Computes velocity of the motion from pose_2 to pose_1 taking place in
  * delta_t seconds.
  */
-VectorX<double> ComputeVelocities(const Isometry3d& pose_1,
+Vector6<double> ComputeVelocities(const Isometry3d& pose_1,
                                   const Isometry3d& pose_2, double delta_t) {
-  VectorX<double> velocities = VectorX<double>::Zero(6);
+  Vector6<double> velocities = Vector6<double>::Zero();
 
   // Since the condition delta_t = 0 can only occur at the first instance of
   // calling DoCalcUnrestrictedUpdate, it is sufficient to simply return a
-  // velocity of VectorX<double>::Zero(6) under this condition. Otherwise,
+  // velocity of Vector6<double>::Zero() under this condition. Otherwise,
   // compute the actual velocities from the poses.
   if (delta_t > 0) {
     Eigen::Vector3d translation_diff =
@@ -61,11 +100,9 @@ VectorX<double> ComputeVelocities(const Isometry3d& pose_1,
 // TODO(naveenoid) : Replace the usage of these methods eventually with
 // PoseVector or a similar future variant.
 /*
- * Converts a 7 dimensional VectorX<double> describing a pose (composed by
- * positions in the first 3 dimensions and orientation in quaternions in the
- * next 4) into an Eigen::Isometry3d object.
+ * Converts a PoseVector into an Eigen::Isometry3d object.
  */
-Isometry3<double> VectorToIsometry3d(const VectorX<double>& pose_vector) {
+Isometry3<double> VectorToIsometry3d(const PoseVector& pose_vector) {
   Isometry3<double> pose = Isometry3<double>::Identity();
   pose.linear() = Quaterniond(pose_vector(3), pose_vector(4), pose_vector(5),
                               pose_vector(6))
@@ -76,19 +113,16 @@ Isometry3<double> VectorToIsometry3d(const VectorX<double>& pose_vector) {
 }
 
 /*
- * Converts a pose specified as an Eigen::Isometry3d into a 7 dimensional
- * VectorX<double> (composed by positions in the first 3 dimensions and
- * orientation in quaternions in the next 4).
+ * Converts a pose specified as an Eigen::Isometry3d into a PoseVector.
  */
-VectorX<double> Isometry3dToVector(const Isometry3<double>& pose) {
-  VectorX<double> pose_vector = VectorX<double>::Zero(7);
+PoseVector Isometry3dToVector(const Isometry3<double>& pose) {
+  PoseVector pose_vector;
   pose_vector.head<3>() = pose.translation();
   Quaterniond return_quat = Quaterniond(pose.linear());
   return_quat = math::QuaternionToCanonicalForm(return_quat);
 
-  pose_vector.tail<4>() = (VectorX<double>(4) << return_quat.w(),
-      return_quat.x(), return_quat.y(), return_quat.z())
-      .finished();
+  pose_vector.tail<4>() << return_quat.w(), return_quat.x(), return_quat.y(),
+      return_quat.z();
 
   return pose_vector;
 }
@@ -97,20 +131,42 @@ VectorX<double> Isometry3dToVector(const Isometry3<double>& pose) {
 
 PoseSmoother::PoseSmoother(double desired_max_linear_velocity,
                            double desired_max_angular_velocity,
-                           double period_sec, int filter_window_size)
-    : smoothed_pose_output_port_(
-          this->DeclareAbstractOutputPort(&PoseSmoother::OutputSmoothedPose)
-              .get_index()),
-      smoothed_velocity_output_port_(
-          this->DeclareAbstractOutputPort(&PoseSmoother::OutputSmoothedVelocity)
-              .get_index()),
-      max_linear_velocity_(desired_max_linear_velocity),
+                           double period_sec, int filter_window_size,
+                           int num_poses)
+    : max_linear_velocity_(desired_max_linear_velocity),
       max_angular_velocity_(desired_max_angular_velocity),
       is_filter_enabled_(filter_window_size > 1) {
+  DRAKE_THROW_UNLESS(num_poses >= 1);
+  for (int i = 0; i < num_poses; ++i) {
+    smoothed_pose_output_ports_.push_back(
+        this->DeclareAbstractOutputPort(
+                [](const systems::Context<double>&) {
+                  return systems::AbstractValue::Make<Isometry3d>(
+                      Isometry3d::Identity());
+                },
+                [this, i](const systems::Context<double>& context,
+                          systems::AbstractValue* output) {
+                  this->OutputSmoothedPose(
+                      i, context, &output->GetMutableValue<Isometry3d>());
+                })
+            .get_index());
+    smoothed_velocity_output_ports_.push_back(
+        this->DeclareAbstractOutputPort(
+                [](const systems::Context<double>&) {
+                  return systems::AbstractValue::Make<Vector6<double>>(
+                      Vector6<double>::Zero());
+                },
+                [this, i](const systems::Context<double>& context,
+                          systems::AbstractValue* output) {
+                  this->OutputSmoothedVelocity(
+                      i, context, &output->GetMutableValue<Vector6<double>>());
+                })
+            .get_index());
+    this->DeclareAbstractInputPort();
+  }
   this->DeclareAbstractState(
       systems::AbstractValue::Make<InternalState>(
-          InternalState(filter_window_size)));
-  this->DeclareAbstractInputPort();
+          InternalState(num_poses, filter_window_size)));
   this->DeclarePeriodicUnrestrictedUpdate(period_sec, 0);
 }
 
@@ -122,75 +178,80 @@ void PoseSmoother::DoCalcUnrestrictedUpdate(
   InternalState& internal_state =
       state->get_mutable_abstract_state<InternalState>(0);
 
-  // Update world state from inputs.
-  const systems::AbstractValue* input = this->EvalAbstractInput(context, 0);
-  DRAKE_ASSERT(input != nullptr);
-  const auto& input_pose = input->GetValue<Isometry3d>();
-
   double current_time = context.get_time();
 
-  // Set the initial state of the smoother.
-  if (internal_state.is_first_time) {
-    internal_state.is_first_time = false;
-    internal_state.pose = input_pose;
-    internal_state.time_at_last_accepted_pose = current_time;
-    drake::log()->debug("PoseSmoother initial state set.");
-  }
+  for (int index = 0; index < num_poses(); ++index) {
+    BodyState& body = internal_state.bodies[index];
+
+    // Update world state from inputs.
+    const systems::AbstractValue* input =
+        this->EvalAbstractInput(context, index);
+    DRAKE_ASSERT(input != nullptr);
+    const auto& input_pose = input->GetValue<Isometry3d>();
 
-  Isometry3d& current_pose = internal_state.pose;
-  double& time_at_last_accepted_pose =
-      internal_state.time_at_last_accepted_pose;
-  Vector6<double>& current_velocity = internal_state.velocity;
+    // Set the initial state of the smoother.
+    if (body.is_first_time) {
+      body.is_first_time = false;
+      body.pose = input_pose;
+      body.time_at_last_accepted_pose = current_time;
+      drake::log()->debug("PoseSmoother initial state set.");
+    }
+
+    Isometry3d& current_pose = body.pose;
+    double& time_at_last_accepted_pose = body.time_at_last_accepted_pose;
+    Vector6<double>& current_velocity = body.velocity;
 
-  Vector6<double> new_velocity = ComputeVelocities(
-      input_pose, current_pose, current_time - time_at_last_accepted_pose);
+    Vector6<double> new_velocity = ComputeVelocities(
+        input_pose, current_pose, current_time - time_at_last_accepted_pose);
 
-  bool accept_data_point = true;
-  for (int i = 0; i < 3; ++i) {
-    if (new_velocity(i) >= max_linear_velocity_ ||
-        new_velocity(3 + i) >= max_angular_velocity_) {
-      accept_data_point = false;
-      break;
+    bool accept_data_point = true;
+    for (int i = 0; i < 3; ++i) {
+      if (new_velocity(i) >= max_linear_velocity_ ||
+          new_velocity(3 + i) >= max_angular_velocity_) {
+        accept_data_point = false;
+        break;
+      }
     }
-  }
-  // If data is below threshold it can be added to the filter.
-  if (accept_data_point) {
-    Quaterniond input_quaternion = Quaterniond(input_pose.linear());
-
-    input_quaternion = math::QuaternionToCanonicalForm(input_quaternion);
-    Isometry3d corrected_input = input_pose;
-    corrected_input.linear() = input_quaternion.toRotationMatrix();
-
-    Isometry3d accepted_pose = Isometry3d::Identity();
-    // If the smoother is enabled.
-    if (is_filter_enabled_) {
-      VectorX<double> temp =
-          internal_state.filter->Update(Isometry3dToVector(corrected_input));
-      accepted_pose = VectorToIsometry3d(temp);
+    // If data is below threshold it can be added to the filter.
+    if (accept_data_point) {
+      Quaterniond input_quaternion = Quaterniond(input_pose.linear());
+
+      input_quaternion = math::QuaternionToCanonicalForm(input_quaternion);
+      Isometry3d corrected_input = input_pose;
+      corrected_input.linear() = input_quaternion.toRotationMatrix();
+
+      Isometry3d accepted_pose = Isometry3d::Identity();
+      // If the smoother is enabled.
+      if (is_filter_enabled_) {
+        accepted_pose = VectorToIsometry3d(internal_state.UpdateAverage(
+            index, Isometry3dToVector(corrected_input)));
+      } else {
+        accepted_pose = corrected_input;
+      }
+      current_velocity = ComputeVelocities(
+          accepted_pose, current_pose, current_time -
+              time_at_last_accepted_pose);
+      time_at_last_accepted_pose = current_time;
+      current_pose = accepted_pose;
     } else {
-      accepted_pose = corrected_input;
+      drake::log()->debug("Data point rejected");
     }
-    current_velocity = ComputeVelocities(
-        accepted_pose, current_pose, current_time -
-            time_at_last_accepted_pose);
-    time_at_last_accepted_pose = current_time;
-    current_pose = accepted_pose;
-  } else {
-    drake::log()->debug("Data point rejected");
   }
 }
 
-void PoseSmoother::OutputSmoothedPose(const systems::Context<double>& context,
+void PoseSmoother::OutputSmoothedPose(int index,
+                                      const systems::Context<double>& context,
                                       Isometry3d* output) const {
-  const auto internal_state = context.get_abstract_state<InternalState>(0);
-  *output = internal_state.pose;
+  const auto& internal_state = context.get_abstract_state<InternalState>(0);
+  *output = internal_state.bodies[index].pose;
   output->makeAffine();
 }
 
 void PoseSmoother::OutputSmoothedVelocity(
-    const systems::Context<double>& context, Vector6<double>* output) const {
-  const auto internal_state = context.get_abstract_state<InternalState>(0);
-  *output = internal_state.velocity;
+    int index, const systems::Context<double>& context,
+    Vector6<double>* output) const {
+  const auto& internal_state = context.get_abstract_state<InternalState>(0);
+  *output = internal_state.bodies[index].velocity;
 }
 }  // namespace perception
 }  // namespace manipulation
@@ -3,7 +3,6 @@
 #include <memory>
 #include <vector>
 
-#include "drake/manipulation/util/moving_average_filter.h"
 #include "drake/systems/framework/event.h"
 #include "drake/systems/framework/leaf_system.h"
 
@@ -29,6 +28,11 @@ namespace perception {
  * Averaging",
  *  NASA Technical note, available to download at
  *  https://ntrs.nasa.gov/archive/nasa/casi.ntrs.nasa.gov/20070017872.pdf
+ *
+ * A single PoseSmoother can smooth the poses of several rigid bodies, with one
+ * input port and a pair of output ports per body. The bodies are filtered
+ * independently, but their moving average windows share one contiguous ring
+ * buffer, so that smoothing many bodies does not allocate memory per sample.
  */
 class PoseSmoother : public systems::LeafSystem<double> {
  public:
@@ -45,17 +49,32 @@ class PoseSmoother : public systems::LeafSystem<double> {
    * This must be set to a value greater than 0.
    * @param filter_window_size Window size for the moving average smoothing. Must
    * be set to a value greater than 1 to enable averaging (smoothing).
+   * @param num_poses The number of rigid bodies whose poses are smoothed. Must
+   * be at least 1.
    */
   PoseSmoother(double desired_max_linear_velocity,
                double desired_max_angular_velocity,
-               double period_sec, int filter_window_size);
+               double period_sec, int filter_window_size, int num_poses = 1);
 
-  const systems::OutputPort<double>& get_smoothed_pose_output_port() const {
-    return this->get_output_port(smoothed_pose_output_port_);
+  /// Returns the number of rigid bodies whose poses are smoothed.
+  int num_poses() const {
+    return static_cast<int>(smoothed_pose_output_ports_.size());
   }
 
-  const systems::OutputPort<double>& get_smoothed_velocity_output_port() const {
-    return this->get_output_port(smoothed_velocity_output_port_);
+  /// Returns the input port for the pose of body @p index.
+  const systems::InputPortDescriptor<double>& get_pose_input_port(
+      int index = 0) const {
+    return this->get_input_port(index);
+  }
+
+  const systems::OutputPort<double>& get_smoothed_pose_output_port(
+      int index = 0) const {
+    return this->get_output_port(smoothed_pose_output_ports_.at(index));
+  }
+
+  const systems::OutputPort<double>& get_smoothed_velocity_output_port(
+      int index = 0) const {
+    return this->get_output_port(smoothed_velocity_output_ports_.at(index));
   }
 
  private:
@@ -64,15 +83,16 @@ class PoseSmoother : public systems::LeafSystem<double> {
       const std::vector<const systems::UnrestrictedUpdateEvent<double>*>& event,
       systems::State<double>* state) const override;
 
-  void OutputSmoothedPose(const systems::Context<double>& context,
+  void OutputSmoothedPose(int index, const systems::Context<double>& context,
                           Eigen::Isometry3d* output) const;
 
-  void OutputSmoothedVelocity(const systems::Context<double>& context,
+  void OutputSmoothedVelocity(int index,
+                              const systems::Context<double>& context,
                               Vector6<double>* output) const;
 
  private:
-  const int smoothed_pose_output_port_{0};
-  const int smoothed_velocity_output_port_{0};
+  std::vector<int> smoothed_pose_output_ports_;
+  std::vector<int> smoothed_velocity_output_ports_;
   const double max_linear_velocity_{0.0};
   const double max_angular_velocity_{0.0};
   const bool is_filter_enabled_{false};
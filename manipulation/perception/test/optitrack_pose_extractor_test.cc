@@ -1,6 +1,7 @@
 #include "drake/manipulation/perception/optitrack_pose_extractor.h"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include "optitrack/optitrack_frame_t.hpp"
@@ -167,6 +168,57 @@ TEST_F(OptitrackPoseTest, FindObject) {
   EXPECT_FALSE(FindOptitrackObjectId(message, "blergh").has_value());
 }
 
+// One extractor for several objects, one of which is requested twice, gives
+// the same poses as one extractor per object.
+GTEST_TEST(OptitrackMultiplePoseTest, ExtractsAllObjects) {
+  const std::vector<int> object_ids{7, 3, 7, 5};
+  Isometry3<double> X_WO = Isometry3<double>::Identity();
+  X_WO.translation() << 1, 2, 3;
+  OptitrackPoseExtractor dut(object_ids, X_WO, 0.01);
+  EXPECT_EQ(dut.num_objects(), 4);
+  EXPECT_EQ(dut.get_num_input_ports(), 1);
+  EXPECT_EQ(dut.get_num_output_ports(), 4);
+  auto context = dut.CreateDefaultContext();
+  auto output = dut.AllocateOutput(*context);
+
+  optitrack::optitrack_frame_t test_frame{};
+  for (int id = 0; id < 10; ++id) {
+    optitrack::optitrack_rigid_body_t body{};
+    body.id = id;
+    body.xyz[0] = 0.1 * id;
+    const Eigen::Quaterniond quat(
+        Eigen::AngleAxisd(0.1 * id, Eigen::Vector3d::UnitZ()));
+    body.quat[0] = quat.x();
+    body.quat[1] = quat.y();
+    body.quat[2] = quat.z();
+    body.quat[3] = quat.w();
+    test_frame.rigid_bodies.push_back(body);
+  }
+  context->FixInputPort(
+      0, systems::AbstractValue::Make<optitrack::optitrack_frame_t>(
+             test_frame));
+  dut.CalcUnrestrictedUpdate(*context, &context->get_mutable_state());
+  dut.CalcOutput(*context, output.get());
+  for (int i = 0; i < dut.num_objects(); ++i) {
+    const Isometry3<double> X_WB_expected =
+        X_WO * ExtractOptitrackPose(*FindOptitrackBody(test_frame,
+                                                       object_ids[i]));
+    const Isometry3<double>& X_WB =
+        output->get_data(dut.get_measured_pose_output_port(i).get_index())
+            ->GetValue<Isometry3<double>>();
+    EXPECT_TRUE(CompareMatrices(X_WB.matrix(), X_WB_expected.matrix(),
+                                kTolerance, MatrixCompareType::absolute));
+  }
+
+  // Any missing object is an error.
+  test_frame.rigid_bodies.erase(test_frame.rigid_bodies.begin() + 5);
+  context->FixInputPort(
+      0, systems::AbstractValue::Make<optitrack::optitrack_frame_t>(
+             test_frame));
+  EXPECT_ANY_THROW(
+      dut.CalcUnrestrictedUpdate(*context, &context->get_mutable_state()));
+}
+
 }  // namespace perception
 }  // namespace manipulation
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/manipulation/perception/pose_smoother.h"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -270,6 +271,79 @@ TEST_F(PoseSmootherTest, SmootherTest) {
                               MatrixCompareType::absolute));
 }
 
+// Smoothing several poses with one PoseSmoother gives the same results as one
+// PoseSmoother per pose, even when the poses are rejected at different times.
+GTEST_TEST(PoseSmootherMultiplePosesTest, MatchesSinglePoseSmoothers) {
+  const int kNumPoses = 3;
+  const double kMaxLinearVelocity = 1.0;
+  const double kMaxAngularVelocity = 0.5 * M_PI;
+  PoseSmoother dut(kMaxLinearVelocity, kMaxAngularVelocity,
+                   kPoseSmootherPeriod, kMovingAverageWindowSize, kNumPoses);
+  EXPECT_EQ(dut.num_poses(), kNumPoses);
+  EXPECT_EQ(dut.get_num_input_ports(), kNumPoses);
+  EXPECT_EQ(dut.get_num_output_ports(), 2 * kNumPoses);
+  auto context = dut.CreateDefaultContext();
+  auto output = dut.AllocateOutput(*context);
+
+  std::vector<std::unique_ptr<PoseSmoother>> singles;
+  std::vector<std::unique_ptr<systems::Context<double>>> single_contexts;
+  std::vector<std::unique_ptr<systems::SystemOutput<double>>> single_outputs;
+  for (int i = 0; i < kNumPoses; ++i) {
+    singles.push_back(std::make_unique<PoseSmoother>(
+        kMaxLinearVelocity, kMaxAngularVelocity, kPoseSmootherPeriod,
+        kMovingAverageWindowSize));
+    single_contexts.push_back(singles.back()->CreateDefaultContext());
+    single_outputs.push_back(
+        singles.back()->AllocateOutput(*single_contexts.back()));
+  }
+
+  double test_time = kPoseSmootherPeriod;
+  for (int step = 0; step < 8; ++step) {
+    context->set_time(test_time);
+    for (int i = 0; i < kNumPoses; ++i) {
+      Isometry3d input_pose = Isometry3d::Identity();
+      input_pose.linear() =
+          AngleAxisd((0.2 + 0.001 * step * (i + 1)) * M_PI,
+                     Eigen::Vector3d::UnitX()).matrix();
+      input_pose.translation() << 0.001 * step * i, -5.0, 10.10;
+      // Every pose gets an outlier, at a different step.
+      if (step == 2 + i) {
+        input_pose.translation().x() += 0.5;
+      }
+      context->FixInputPort(dut.get_pose_input_port(i).get_index(),
+                            systems::AbstractValue::Make(input_pose));
+      single_contexts[i]->set_time(test_time);
+      single_contexts[i]->FixInputPort(
+          0, systems::AbstractValue::Make(input_pose));
+    }
+    dut.CalcUnrestrictedUpdate(*context, &context->get_mutable_state());
+    dut.CalcOutput(*context, output.get());
+    for (int i = 0; i < kNumPoses; ++i) {
+      PoseSmoother& single = *singles[i];
+      single.CalcUnrestrictedUpdate(*single_contexts[i],
+                                    &single_contexts[i]->get_mutable_state());
+      single.CalcOutput(*single_contexts[i], single_outputs[i].get());
+      EXPECT_TRUE(CompareMatrices(
+          output->get_data(dut.get_smoothed_pose_output_port(i).get_index())
+              ->GetValue<Isometry3d>().matrix(),
+          single_outputs[i]
+              ->get_data(single.get_smoothed_pose_output_port().get_index())
+              ->GetValue<Isometry3d>().matrix(),
+          1e-15));
+      EXPECT_TRUE(CompareMatrices(
+          output->get_data(
+                    dut.get_smoothed_velocity_output_port(i).get_index())
+              ->GetValue<Vector6<double>>(),
+          single_outputs[i]
+              ->get_data(
+                  single.get_smoothed_velocity_output_port().get_index())
+              ->GetValue<Vector6<double>>(),
+          1e-15));
+    }
+    test_time += kPoseSmootherPeriod;
+  }
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace manipulation
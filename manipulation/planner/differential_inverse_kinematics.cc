@@ -10,13 +10,14 @@ namespace manipulation {
 namespace planner {
 
 namespace {
-DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
-    const Eigen::Ref<const VectorX<double>>& q_current,
-    const Eigen::Ref<const VectorX<double>>& v_current,
+// Expresses the desired spatial velocity and the Jacobian of frame E in E,
+// and keeps the rows with a nonzero gain, scaled by that gain.
+void CalcScaledVelocityAndJacobian(
     const Isometry3<double>& X_WE,
     const Eigen::Ref<const MatrixX<double>>& J_WE,
     const Vector6<double>& V_WE_desired,
-    const DifferentialInverseKinematicsParameters& parameters) {
+    const DifferentialInverseKinematicsParameters& parameters,
+    VectorX<double>* V, MatrixX<double>* J) {
   Matrix6<double> R_EW = Matrix6<double>::Zero();
   R_EW.block<3, 3>(0, 0) = X_WE.linear().transpose();
   R_EW.block<3, 3>(3, 3) = R_EW.block<3, 3>(0, 0);
@@ -36,11 +37,29 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
       num_cart_constraints++;
     }
   }
+  *V = V_WE_E_scaled.head(num_cart_constraints);
+  *J = J_WE_E_scaled.topRows(num_cart_constraints);
+}
 
-  return DoDifferentialInverseKinematics(
-      q_current, v_current, V_WE_E_scaled.head(num_cart_constraints),
-      J_WE_E_scaled.topRows(num_cart_constraints), parameters);
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Isometry3<double>& X_WE,
+    const Eigen::Ref<const MatrixX<double>>& J_WE,
+    const Vector6<double>& V_WE_desired,
+    const DifferentialInverseKinematicsParameters& parameters) {
+  VectorX<double> V;
+  MatrixX<double> J;
+  CalcScaledVelocityAndJacobian(X_WE, J_WE, V_WE_desired, parameters, &V, &J);
+  return DoDifferentialInverseKinematics(q_current, v_current, V, J,
+                                         parameters);
 }
+
+// The weight of the end effector speed tracking cost, and the thresholds
+// below which the solution is deemed stuck.
+const double kCartesianTrackingWeight = 100;
+const double kMaxTrackingError = 5;
+const double kMinEndEffectorVel = 1e-2;
 }  // namespace
 
 std::ostream& operator<<(std::ostream& os,
@@ -114,7 +133,6 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     A.rightCols(1) = -V_dir;
     prog.AddLinearEqualityConstraint(
         A, VectorX<double>::Zero(num_cart_constraints), {v_next, alpha});
-    const double kCartesianTrackingWeight = 100;
     cart_cost =
         prog.AddQuadraticErrorCost(Vector1<double>(kCartesianTrackingWeight),
                                    Vector1<double>(V_mag), alpha)
@@ -180,8 +198,6 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
   if (num_cart_constraints) {
     VectorX<double> cost(1);
     cart_cost->Eval(prog.GetSolution(alpha), cost);
-    const double kMaxTrackingError = 5;
-    const double kMinEndEffectorVel = 1e-2;
     if (cost(0) > kMaxTrackingError &&
         prog.GetSolution(alpha)[0] <= kMinEndEffectorVel) {
       // Not tracking the desired vel norm (large tracking error) and the
@@ -256,6 +272,297 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
                                          parameters);
 }
 
+struct DifferentialInverseKinematicsSolver::Program {
+  // Builds the program of DoDifferentialInverseKinematics() for
+  // @p num_cart_constraints tracked velocity components, with placeholder
+  // data that Update() overwrites.
+  Program(const DifferentialInverseKinematicsParameters& parameters,
+          int num_cart_constraints_in)
+      : num_cart_constraints(num_cart_constraints_in) {
+    const int num_positions = parameters.get_num_positions();
+    const int num_velocities = parameters.get_num_velocities();
+    v_next = prog.NewContinuousVariables(num_velocities, "v_next");
+    alpha = prog.NewContinuousVariables<1>("alpha");
+    const auto identity_num_positions =
+        MatrixX<double>::Identity(num_positions, num_positions);
+
+    if (num_cart_constraints > 0) {
+      direction = prog.AddLinearEqualityConstraint(
+                          MatrixX<double>::Zero(num_cart_constraints,
+                                                num_velocities + 1),
+                          VectorX<double>::Zero(num_cart_constraints),
+                          {v_next, alpha})
+                      .evaluator();
+      cart_cost =
+          prog.AddQuadraticErrorCost(Vector1<double>(kCartesianTrackingWeight),
+                                     Vector1<double>::Zero(), alpha)
+              .evaluator();
+      const int num_unconstrained = num_velocities - num_cart_constraints;
+      if (parameters.get_unconstrained_degrees_of_freedom_velocity_limit() &&
+          num_unconstrained > 0) {
+        const double uncon_v =
+            parameters.get_unconstrained_degrees_of_freedom_velocity_limit()
+                .value();
+        unconstrained_limits =
+            prog.AddLinearConstraint(
+                    MatrixX<double>::Zero(num_unconstrained, num_velocities),
+                    VectorX<double>::Constant(num_unconstrained, -uncon_v),
+                    VectorX<double>::Constant(num_unconstrained, uncon_v),
+                    v_next)
+                .evaluator();
+      }
+    }
+
+    if (num_cart_constraints < num_velocities) {
+      nominal_cost = prog.AddQuadraticErrorCost(
+                             identity_num_positions,
+                             VectorX<double>::Zero(num_positions), v_next)
+                         .evaluator();
+    }
+
+    if (parameters.get_joint_position_limits()) {
+      position_limits = prog.AddBoundingBoxConstraint(
+                                parameters.get_joint_position_limits()->first,
+                                parameters.get_joint_position_limits()->second,
+                                v_next)
+                            .evaluator();
+    }
+
+    // The velocity limits do not depend on the state.
+    if (parameters.get_joint_velocity_limits()) {
+      velocity_limits = prog.AddBoundingBoxConstraint(
+                                parameters.get_joint_velocity_limits()->first,
+                                parameters.get_joint_velocity_limits()->second,
+                                v_next)
+                            .evaluator();
+    }
+
+    if (parameters.get_joint_acceleration_limits()) {
+      acceleration_limits =
+          prog.AddLinearConstraint(
+                  identity_num_positions,
+                  parameters.get_joint_acceleration_limits()->first,
+                  parameters.get_joint_acceleration_limits()->second, v_next)
+              .evaluator();
+    }
+  }
+
+  // Sets the data of the program for the given state and target, as
+  // DoDifferentialInverseKinematics() does when it builds its program.
+  void Update(const DifferentialInverseKinematicsParameters& parameters,
+              const Eigen::Ref<const VectorX<double>>& q_current,
+              const Eigen::Ref<const VectorX<double>>& v_current,
+              const Eigen::Ref<const VectorX<double>>& V,
+              const Eigen::Ref<const MatrixX<double>>& J) {
+    const int num_velocities = parameters.get_num_velocities();
+    const double dt{parameters.get_timestep()};
+
+    V_mag = V.norm();
+    if (num_cart_constraints > 0) {
+      MatrixX<double> A(num_cart_constraints, num_velocities + 1);
+      A.leftCols(num_velocities) = J;
+      A.rightCols(1) = -V.normalized();
+      direction->UpdateCoefficients(
+          A, VectorX<double>::Zero(num_cart_constraints));
+      cart_cost->UpdateCoefficients(
+          Vector1<double>(2 * kCartesianTrackingWeight),
+          Vector1<double>(-2 * kCartesianTrackingWeight * V_mag),
+          kCartesianTrackingWeight * V_mag * V_mag);
+      if (unconstrained_limits) {
+        Eigen::JacobiSVD<MatrixX<double>> svd(J, Eigen::ComputeFullV);
+        unconstrained_limits->UpdateCoefficients(
+            svd.matrixV()
+                .rightCols(num_velocities - num_cart_constraints)
+                .transpose(),
+            unconstrained_limits->lower_bound(),
+            unconstrained_limits->upper_bound());
+      }
+    }
+
+    if (nominal_cost) {
+      // The cost is |v_next - x_desired|² weighted by dt², expanded as in
+      // MakeQuadraticErrorCost().
+      const int num_positions = parameters.get_num_positions();
+      const MatrixX<double> Q =
+          MatrixX<double>::Identity(num_positions, num_positions) * dt * dt;
+      const VectorX<double> x_desired =
+          (parameters.get_nominal_joint_position() - q_current) / dt;
+      nominal_cost->UpdateCoefficients(2 * Q, -2 * Q * x_desired,
+                                       x_desired.dot(Q * x_desired));
+    }
+
+    if (position_limits) {
+      position_limits->set_bounds(
+          (parameters.get_joint_position_limits()->first - q_current) / dt,
+          (parameters.get_joint_position_limits()->second - q_current) / dt);
+    }
+
+    if (acceleration_limits) {
+      acceleration_limits->set_bounds(
+          parameters.get_joint_acceleration_limits()->first * dt + v_current,
+          parameters.get_joint_acceleration_limits()->second * dt + v_current);
+    }
+  }
+
+  // Returns the optimum of the program without its inequality constraints,
+  // i.e., the solution of its KKT system, or nullopt if that system is
+  // singular.
+  optional<VectorX<double>> SolveEqualityConstrained() const {
+    const int num_velocities = v_next.size();
+    const int num_vars = num_velocities + (num_cart_constraints > 0 ? 1 : 0);
+    const int num_kkt = num_vars + num_cart_constraints;
+    MatrixX<double> kkt = MatrixX<double>::Zero(num_kkt, num_kkt);
+    VectorX<double> rhs = VectorX<double>::Zero(num_kkt);
+    if (nominal_cost) {
+      kkt.topLeftCorner(num_velocities, num_velocities) = nominal_cost->Q();
+      rhs.head(num_velocities) = -nominal_cost->b();
+    }
+    if (num_cart_constraints > 0) {
+      kkt(num_velocities, num_velocities) = cart_cost->Q()(0, 0);
+      rhs(num_velocities) = -cart_cost->b()(0);
+      kkt.bottomLeftCorner(num_cart_constraints, num_vars) = direction->A();
+      kkt.topRightCorner(num_vars, num_cart_constraints) =
+          direction->A().transpose();
+    }
+    const Eigen::FullPivLU<MatrixX<double>> lu(kkt);
+    if (!lu.isInvertible()) {
+      return nullopt;
+    }
+    VectorX<double> x = VectorX<double>::Zero(num_velocities + 1);
+    x.head(num_vars) = lu.solve(rhs).head(num_vars);
+    return x;
+  }
+
+  // Returns true if @p v_next_value satisfies the inequality constraints of
+  // the program.
+  bool SatisfiesLimits(const VectorX<double>& v_next_value) const {
+    auto within = [](const VectorX<double>& value,
+                     const solvers::Constraint& constraint) {
+      return (value.array() >= constraint.lower_bound().array()).all() &&
+             (value.array() <= constraint.upper_bound().array()).all();
+    };
+    return (!unconstrained_limits ||
+            within(unconstrained_limits->A() * v_next_value,
+                   *unconstrained_limits)) &&
+           (!position_limits || within(v_next_value, *position_limits)) &&
+           (!velocity_limits || within(v_next_value, *velocity_limits)) &&
+           (!acceleration_limits ||
+            within(acceleration_limits->A() * v_next_value,
+                   *acceleration_limits));
+  }
+
+  int num_cart_constraints{};
+  solvers::MathematicalProgram prog;
+  solvers::VectorXDecisionVariable v_next;
+  solvers::VectorDecisionVariable<1> alpha;
+  std::shared_ptr<solvers::LinearEqualityConstraint> direction;
+  std::shared_ptr<solvers::QuadraticCost> cart_cost;
+  std::shared_ptr<solvers::LinearConstraint> unconstrained_limits;
+  std::shared_ptr<solvers::QuadraticCost> nominal_cost;
+  std::shared_ptr<solvers::BoundingBoxConstraint> position_limits;
+  std::shared_ptr<solvers::BoundingBoxConstraint> velocity_limits;
+  std::shared_ptr<solvers::LinearConstraint> acceleration_limits;
+  double V_mag{};
+  // The previous solution [v_next; alpha], used as the initial guess.
+  optional<VectorX<double>> last_solution;
+};
+
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters)
+    : parameters_(parameters) {
+  solver_.set_persistent_workspace(true);
+}
+
+DifferentialInverseKinematicsSolver::~DifferentialInverseKinematicsSolver() =
+    default;
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Eigen::Ref<const VectorX<double>>& V,
+    const Eigen::Ref<const MatrixX<double>>& J) {
+  const int num_velocities = parameters_.get_num_velocities();
+  const int num_cart_constraints = V.size();
+  DRAKE_DEMAND(q_current.size() == parameters_.get_num_positions());
+  DRAKE_DEMAND(v_current.size() == num_velocities);
+  DRAKE_DEMAND(J.rows() == num_cart_constraints);
+  DRAKE_DEMAND(J.cols() == num_velocities);
+
+  if (!program_ || program_->num_cart_constraints != num_cart_constraints) {
+    program_ = std::make_unique<Program>(parameters_, num_cart_constraints);
+  }
+  Program& program = *program_;
+  program.Update(parameters_, q_current, v_current, V, J);
+
+  VectorX<double> solution;
+  const optional<VectorX<double>> closed_form =
+      program.SolveEqualityConstrained();
+  if (closed_form &&
+      program.SatisfiesLimits(closed_form->head(num_velocities))) {
+    solution = *closed_form;
+    ++num_closed_form_solutions_;
+  } else {
+    if (program.last_solution) {
+      program.prog.SetInitialGuess(program.v_next,
+                                   program.last_solution->head(num_velocities));
+      program.prog.SetInitialGuess(program.alpha,
+                                   program.last_solution->tail(1));
+    }
+    DRAKE_THROW_UNLESS(solver_.available());
+    const solvers::SolutionResult result = solver_.Solve(program.prog);
+    if (result != solvers::SolutionResult::kSolutionFound) {
+      return {nullopt, DifferentialInverseKinematicsStatus::kNoSolutionFound};
+    }
+    solution.resize(num_velocities + 1);
+    solution << program.prog.GetSolution(program.v_next),
+        program.prog.GetSolution(program.alpha);
+  }
+  program.last_solution = solution;
+
+  if (num_cart_constraints) {
+    const double alpha = solution(num_velocities);
+    const double cost = kCartesianTrackingWeight * (alpha - program.V_mag) *
+                        (alpha - program.V_mag);
+    if (cost > kMaxTrackingError && alpha <= kMinEndEffectorVel) {
+      // Not tracking the desired vel norm (large tracking error) and the
+      // computed vel is small.
+      log()->info("v_next = {}", solution.head(num_velocities).transpose());
+      log()->info("alpha = {}", alpha);
+      return {nullopt, DifferentialInverseKinematicsStatus::kStuck};
+    }
+  }
+
+  return {VectorX<double>(solution.head(num_velocities)),
+          DifferentialInverseKinematicsStatus::kSolutionFound};
+}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const RigidBodyTree<double>& robot, const KinematicsCache<double>& cache,
+    const Vector6<double>& V_WE_desired,
+    const RigidBodyFrame<double>& frame_E) {
+  const Isometry3<double> X_WE =
+      robot.CalcFramePoseInWorldFrame(cache, frame_E);
+  const MatrixX<double> J_WE =
+      robot.CalcFrameSpatialVelocityJacobianInWorldFrame(cache, frame_E);
+  VectorX<double> V;
+  MatrixX<double> J;
+  CalcScaledVelocityAndJacobian(X_WE, J_WE, V_WE_desired, parameters_, &V,
+                                &J);
+  return Solve(cache.getQ(), cache.getV(), V, J);
+}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const RigidBodyTree<double>& robot, const KinematicsCache<double>& cache,
+    const Isometry3<double>& X_WE_desired,
+    const RigidBodyFrame<double>& frame_E) {
+  const Isometry3<double> X_WE =
+      robot.CalcFramePoseInWorldFrame(cache, frame_E);
+  const Vector6<double> V_WE_desired =
+      ComputePoseDiffInCommonFrame(X_WE, X_WE_desired) /
+      parameters_.get_timestep();
+  return Solve(robot, cache, V_WE_desired, frame_E);
+}
+
 }  // namespace planner
 }  // namespace manipulation
 }  // namespace drake
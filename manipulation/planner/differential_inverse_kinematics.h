@@ -13,6 +13,7 @@
 #include "drake/multibody/multibody_tree/multibody_tree.h"
 #include "drake/multibody/rigid_body_tree.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
 
 namespace drake {
 namespace manipulation {
@@ -323,6 +324,93 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const multibody::Frame<double>& frame_E,
     const DifferentialInverseKinematicsParameters& parameters);
 
+/**
+ * Solves the problem of DoDifferentialInverseKinematics() repeatedly for a
+ * fixed set of parameters, e.g., once per tick of a control loop.
+ *
+ * The quadratic program is built on the first call to Solve(). After that,
+ * only its data change: the Jacobian, the desired velocity, and the bounds
+ * that depend on the current state. The program is rebuilt only if the
+ * number of tracked end effector velocity components changes. The OSQP
+ * workspace is kept between calls, so its factorization is reused while the
+ * sparsity of the data is unchanged. Each solve is warm-started from the
+ * previous solution.
+ *
+ * The end effector direction constraint alone may give an optimum that lies
+ * within every limit in the parameters. That point is then also the optimum
+ * of the full problem. In that case it is computed in closed form from the
+ * KKT conditions, and no QP is solved.
+ *
+ * The results match those of DoDifferentialInverseKinematics() up to the
+ * accuracy of the QP solver.
+ */
+class DifferentialInverseKinematicsSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DifferentialInverseKinematicsSolver)
+
+  /**
+   * Constructs a solver for the given @p parameters, which are copied.
+   */
+  explicit DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters);
+
+  ~DifferentialInverseKinematicsSolver();
+
+  const DifferentialInverseKinematicsParameters& get_parameters() const {
+    return parameters_;
+  }
+
+  /**
+   * Same as DoDifferentialInverseKinematics(q_current, v_current, V, J,
+   * parameters), with the parameters given at construction.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const Eigen::Ref<const VectorX<double>>& q_current,
+      const Eigen::Ref<const VectorX<double>>& v_current,
+      const Eigen::Ref<const VectorX<double>>& V,
+      const Eigen::Ref<const MatrixX<double>>& J);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(robot, cache, V_WE_desired,
+   * frame_E, parameters), with the parameters given at construction.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const RigidBodyTree<double>& robot, const KinematicsCache<double>& cache,
+      const Vector6<double>& V_WE_desired,
+      const RigidBodyFrame<double>& frame_E);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(robot, cache, X_WE_desired,
+   * frame_E, parameters), with the parameters given at construction.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const RigidBodyTree<double>& robot, const KinematicsCache<double>& cache,
+      const Isometry3<double>& X_WE_desired,
+      const RigidBodyFrame<double>& frame_E);
+
+  /**
+   * Returns the number of calls to Solve() that were answered in closed form,
+   * without solving the QP.
+   */
+  int num_closed_form_solutions() const { return num_closed_form_solutions_; }
+
+  /**
+   * Returns the number of times an OSQP workspace was set up, i.e., the
+   * number of QP solves that could not reuse the previous factorization.
+   */
+  int num_qp_setups() const { return solver_.num_workspace_setups(); }
+
+ private:
+  // The quadratic program and the handles on its costs and constraints.
+  // Defined in the translation unit.
+  struct Program;
+
+  const DifferentialInverseKinematicsParameters parameters_;
+  std::unique_ptr<Program> program_;
+  solvers::OsqpSolver solver_;
+  int num_closed_form_solutions_{0};
+};
+
 }  // namespace planner
 }  // namespace manipulation
 }  // namespace drake
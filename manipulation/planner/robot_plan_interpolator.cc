@@ -9,8 +9,10 @@
 
 #include "robotlocomotion/robot_plan_t.hpp"
 
+#include "drake/common/drake_optional.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
 #include "drake/multibody/joints/floating_base_types.h"
 #include "drake/multibody/parsers/urdf_parser.h"
 
@@ -21,6 +23,7 @@ namespace manipulation {
 namespace planner {
 
 using trajectories::PiecewisePolynomial;
+using trajectories::PiecewisePolynomialEvaluator;
 
 namespace {
 
@@ -34,17 +37,14 @@ constexpr int kAbsStateIdxInitFlag = 1;
 
 constexpr double RobotPlanInterpolator::kDefaultPlanUpdateInterval;
 
-// TODO(sam.creasey) If we had version of Trajectory which supported
-// outputting the derivatives in value(), we could avoid keeping track
-// of multiple polynomials below.
 struct RobotPlanInterpolator::PlanData {
   PlanData() {}
 
   double start_time{0};
   std::vector<char> encoded_msg;
-  PiecewisePolynomial<double> pp;
-  PiecewisePolynomial<double> pp_deriv;
-  PiecewisePolynomial<double> pp_double_deriv;
+  // Evaluates the positions of the plan, and their first and second
+  // derivatives.
+  optional<PiecewisePolynomialEvaluator> pp;
 };
 
 RobotPlanInterpolator::RobotPlanInterpolator(
@@ -112,10 +112,10 @@ void RobotPlanInterpolator::OutputState(const systems::Context<double>& context,
       output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_vec.head(tree_.get_num_positions()) =
-      plan.pp.value(current_plan_time);
-  output_vec.tail(tree_.get_num_velocities()) =
-      plan.pp_deriv.value(current_plan_time);
+  plan.pp->EvalInto(current_plan_time, 0,
+                    output_vec.head(tree_.get_num_positions()));
+  plan.pp->EvalInto(current_plan_time, 1,
+                    output_vec.tail(tree_.get_num_velocities()));
 }
 
 void RobotPlanInterpolator::OutputAccel(
@@ -129,10 +129,10 @@ void RobotPlanInterpolator::OutputAccel(
       output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_acceleration_vec = plan.pp_double_deriv.value(current_plan_time);
+  plan.pp->EvalInto(current_plan_time, 2, output_acceleration_vec);
 
   // Stop outputting accelerations at the end of the plan.
-  if (current_plan_time > plan.pp_double_deriv.end_time()) {
+  if (current_plan_time > plan.pp->end_time()) {
     output_acceleration_vec.fill(0);
   }
 }
@@ -148,9 +148,8 @@ void RobotPlanInterpolator::MakeFixedPlan(
   std::vector<Eigen::MatrixXd> knots(2, q0);
   std::vector<double> times{0., 1.};
   plan.start_time = plan_start_time;
-  plan.pp = PiecewisePolynomial<double>::ZeroOrderHold(times, knots);
-  plan.pp_deriv = plan.pp.derivative();
-  plan.pp_double_deriv = plan.pp_deriv.derivative();
+  plan.pp = PiecewisePolynomialEvaluator(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, knots));
   drake::log()->info("Generated fixed plan at {}", q0.transpose());
 }
 
@@ -188,7 +187,7 @@ void RobotPlanInterpolator::DoCalcUnrestrictedUpdate(
 
       const double current_plan_time = context.get_time() - plan.start_time;
       MakeFixedPlan(context.get_time(),
-                    plan.pp.value(current_plan_time),
+                    plan.pp->value(current_plan_time),
                     state);
     } else if (plan_input.num_states == 1) {
       drake::log()->info("Ignoring plan with only one knot point.");
@@ -217,26 +216,26 @@ void RobotPlanInterpolator::DoCalcUnrestrictedUpdate(
 
       const Eigen::MatrixXd knot_dot =
           Eigen::MatrixXd::Zero(tree_.get_num_velocities(), 1);
+      PiecewisePolynomial<double> pp;
       switch (interp_type_) {
         case InterpolatorType::ZeroOrderHold :
-          plan.pp = PiecewisePolynomial<double>::ZeroOrderHold(
+          pp = PiecewisePolynomial<double>::ZeroOrderHold(
               input_time, knots);
           break;
         case InterpolatorType::FirstOrderHold :
-          plan.pp = PiecewisePolynomial<double>::FirstOrderHold(
+          pp = PiecewisePolynomial<double>::FirstOrderHold(
               input_time, knots);
           break;
         case InterpolatorType::Pchip :
-          plan.pp = PiecewisePolynomial<double>::Pchip(
+          pp = PiecewisePolynomial<double>::Pchip(
               input_time, knots, true);
           break;
         case InterpolatorType::Cubic :
-          plan.pp = PiecewisePolynomial<double>::Cubic(
+          pp = PiecewisePolynomial<double>::Cubic(
               input_time, knots, knot_dot, knot_dot);
           break;
       }
-      plan.pp_deriv = plan.pp.derivative();
-      plan.pp_double_deriv = plan.pp_deriv.derivative();
+      plan.pp = PiecewisePolynomialEvaluator(pp);
     }
   }
 }
@@ -259,6 +259,73 @@ TEST_F(DifferentialInverseKinematicsTest, SimpleTracker) {
                               MatrixCompareType::absolute));
 }
 
+// The stateful solver tracks a fixed end effector pose as the function does,
+// reusing its program across the iterations.
+TEST_F(DifferentialInverseKinematicsTest, SolverSimpleTracker) {
+  DifferentialInverseKinematicsSolver dut(*params_);
+  Isometry3<double> X_WE = tree_->CalcFramePoseInWorldFrame(*cache_, *frame_E_);
+  const Isometry3<double> X_WE_desired =
+      Eigen::Translation3d(Vector3<double>(-0.02, -0.01, -0.03)) * X_WE;
+
+  // The first solution matches that of the function.
+  const DifferentialInverseKinematicsResult function_result =
+      DoDifferentialInverseKinematics(*tree_, *cache_, X_WE_desired,
+                                      *frame_E_, *params_);
+  DifferentialInverseKinematicsResult solver_result =
+      dut.Solve(*tree_, *cache_, X_WE_desired, *frame_E_);
+  ASSERT_EQ(solver_result.status,
+            DifferentialInverseKinematicsStatus::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(solver_result.joint_velocities.value(),
+                              function_result.joint_velocities.value(), 1e-6,
+                              MatrixCompareType::absolute));
+
+  VectorX<double> q, v;
+  const double dt = params_->get_timestep();
+  for (int iteration = 0; iteration < 900; iteration++) {
+    solver_result = dut.Solve(*tree_, *cache_, X_WE_desired, *frame_E_);
+    EXPECT_EQ(solver_result.status,
+              DifferentialInverseKinematicsStatus::kSolutionFound);
+    v = solver_result.joint_velocities.value();
+    q = cache_->getQ() + v * dt;
+    *cache_ = tree_->doKinematics(q, v);
+  }
+  X_WE = tree_->CalcFramePoseInWorldFrame(*cache_, *frame_E_);
+  EXPECT_TRUE(CompareMatrices(X_WE.matrix(), X_WE_desired.matrix(), 1e-5,
+                              MatrixCompareType::absolute));
+}
+
+// When no limit is active, the solver answers in closed form, with the
+// solution of the QP.
+TEST_F(DifferentialInverseKinematicsTest, SolverClosedForm) {
+  // Without a pull towards the nominal position, a slow end effector motion
+  // stays well within every limit.
+  params_->set_nominal_joint_position(cache_->getQ());
+  const Vector6<double> V_WE =
+      (Vector6<double>() << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0).finished() * 1e-3;
+
+  DifferentialInverseKinematicsSolver dut(*params_);
+  const DifferentialInverseKinematicsResult solver_result =
+      dut.Solve(*tree_, *cache_, V_WE, *frame_E_);
+  EXPECT_EQ(dut.num_closed_form_solutions(), 1);
+  EXPECT_EQ(dut.num_qp_setups(), 0);
+  ASSERT_EQ(solver_result.status,
+            DifferentialInverseKinematicsStatus::kSolutionFound);
+
+  const DifferentialInverseKinematicsResult function_result =
+      DoDifferentialInverseKinematics(*tree_, *cache_, V_WE, *frame_E_,
+                                      *params_);
+  EXPECT_TRUE(CompareMatrices(solver_result.joint_velocities.value(),
+                              function_result.joint_velocities.value(), 1e-6,
+                              MatrixCompareType::absolute));
+
+  // The tracked velocity is reached.
+  const KinematicsCache<double> cache1 = tree_->doKinematics(
+      cache_->getQ(), solver_result.joint_velocities.value());
+  EXPECT_TRUE(CompareMatrices(
+      tree_->CalcFrameSpatialVelocityInWorldFrame(cache1, *frame_E_), V_WE,
+      1e-6, MatrixCompareType::absolute));
+}
+
 // Test various throw conditions.
 GTEST_TEST(DifferentialInverseKinematicsParametersTest, TestSetter) {
   DifferentialInverseKinematicsParameters dut(1, 1);
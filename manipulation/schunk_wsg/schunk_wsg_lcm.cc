@@ -1,12 +1,13 @@
 #include "drake/manipulation/schunk_wsg/schunk_wsg_lcm.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
-#include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/lcmt_schunk_wsg_command.hpp"
 #include "drake/lcmt_schunk_wsg_status.hpp"
 
@@ -18,6 +19,64 @@ using systems::BasicVector;
 using systems::Context;
 using systems::DiscreteValues;
 
+namespace {
+
+// The acceleration and velocity limits correspond to the maximum
+// values available for manual control through the gripper's web
+// interface.
+const double kMaxVelocity = 0.42;  // m/s
+const double kMaxAccel = 5.;       // m/s^2
+
+// Returns the position and velocity, at time @p t since the start, of
+// a trapezoidal velocity profile which moves from rest at @p
+// start_position to rest at @p target_position.  If the distance is
+// too short to reach the maximum velocity, the profile is triangular.
+//
+// TODO(sam.creasey) this should probably consider current speed
+// if the gripper is already moving.  The profile is also based only
+// on the configurable constants for the WSG 50, not on analysis of
+// the actual motion of the gripper.
+Eigen::Vector2d EvalTrapezoidalProfile(
+    double start_position, double target_position, double t) {
+  const double direction = (start_position < target_position) ? 1 : -1;
+  const double delta = std::abs(target_position - start_position);
+
+  // The peak velocity, and the duration of the acceleration (and
+  // deceleration) and of the constant velocity phases.
+  const double peak_velocity =
+      std::min(kMaxVelocity, std::sqrt(kMaxAccel * delta));
+  const double accel_time = peak_velocity / kMaxAccel;
+  const double accel_distance = 0.5 * peak_velocity * accel_time;
+  const double cruise_time =
+      (peak_velocity > 0) ?
+      (delta - 2 * accel_distance) / peak_velocity : 0;
+  const double total_time = 2 * accel_time + cruise_time;
+
+  double distance{};
+  double velocity{};
+  if (t <= 0) {
+    distance = 0;
+    velocity = 0;
+  } else if (t < accel_time) {
+    distance = 0.5 * kMaxAccel * t * t;
+    velocity = kMaxAccel * t;
+  } else if (t < accel_time + cruise_time) {
+    distance = accel_distance + peak_velocity * (t - accel_time);
+    velocity = peak_velocity;
+  } else if (t < total_time) {
+    const double time_to_go = total_time - t;
+    distance = delta - 0.5 * kMaxAccel * time_to_go * time_to_go;
+    velocity = kMaxAccel * time_to_go;
+  } else {
+    distance = delta;
+    velocity = 0;
+  }
+  return Eigen::Vector2d(start_position + distance * direction,
+                         velocity * direction);
+}
+
+}  // namespace
+
 SchunkWsgTrajectoryGenerator::SchunkWsgTrajectoryGenerator(int input_size,
                                                            int position_index)
     : position_index_(position_index),
@@ -42,8 +101,10 @@ void SchunkWsgTrajectoryGenerator::OutputTarget(
       dynamic_cast<const SchunkWsgTrajectoryGeneratorStateVector<double>*>(
           &context.get_discrete_state(0));
 
-  if (trajectory_) {
-    output->get_mutable_value() = trajectory_->value(
+  if (traj_state->has_trajectory() != 0) {
+    output->get_mutable_value() = EvalTrapezoidalProfile(
+        traj_state->trajectory_start_position(),
+        traj_state->last_target_position(),
         context.get_time() - traj_state->trajectory_start_time());
   } else {
     output->get_mutable_value() =
@@ -95,14 +156,18 @@ void SchunkWsgTrajectoryGenerator::DoCalcDiscreteVariableUpdates(
 
   if (std::abs(last_traj_state->last_target_position() - target_position) >
       kTargetEpsilon) {
-    UpdateTrajectory(cur_position, target_position);
     new_traj_state->set_last_target_position(target_position);
     new_traj_state->set_trajectory_start_time(context.get_time());
+    new_traj_state->set_trajectory_start_position(cur_position);
+    new_traj_state->set_has_trajectory(1);
   } else {
     new_traj_state->set_last_target_position(
         last_traj_state->last_target_position());
     new_traj_state->set_trajectory_start_time(
         last_traj_state->trajectory_start_time());
+    new_traj_state->set_trajectory_start_position(
+        last_traj_state->trajectory_start_position());
+    new_traj_state->set_has_trajectory(last_traj_state->has_trajectory());
   }
 }
 
@@ -112,66 +177,6 @@ SchunkWsgTrajectoryGenerator::AllocateDiscreteState() const {
       std::make_unique<SchunkWsgTrajectoryGeneratorStateVector<double>>());
 }
 
-void SchunkWsgTrajectoryGenerator::UpdateTrajectory(
-    double cur_position, double target_position) const {
-  // The acceleration and velocity limits correspond to the maximum
-  // values available for manual control through the gripper's web
-  // interface.
-  const double kMaxVelocity = 0.42;  // m/s
-  const double kMaxAccel = 5.;       // m/s^2
-  const double kTimeToMaxVelocity = kMaxVelocity / kMaxAccel;
-  // TODO(sam.creasey) this should probably consider current speed
-  // if the gripper is already moving.
-  const double kDistanceToMaxVelocity =
-      0.5 * kMaxAccel * kTimeToMaxVelocity * kTimeToMaxVelocity;
-
-  std::vector<Eigen::MatrixXd> knots;
-  std::vector<double> times;
-  knots.push_back(Eigen::Vector2d(cur_position, 0));
-  times.push_back(0);
-
-  const double direction = (cur_position < target_position) ? 1 : -1;
-  const double delta = std::abs(target_position - cur_position);
-
-  // The trajectory creation code below is, to say the best, a bit
-  // primitive.  I (sam.creasey) would not be surprised if it could
-  // be significantly improved.  It's also based only on the
-  // configurable constants for the WSG 50, not on analysis of the
-  // actual motion of the gripper.
-  if (delta < kDistanceToMaxVelocity * 2) {
-    // If we can't accelerate to our maximum (and decelerate again)
-    // within the target travel distance, calculate the peak velocity
-    // we will reach and create a trajectory which ramps to that
-    // velocity and back down.
-    const double mid_distance = delta / 2;
-    const double mid_velocity =
-        kMaxVelocity * (mid_distance / kDistanceToMaxVelocity);
-    const double mid_time = mid_velocity / kMaxAccel;
-    knots.push_back(Eigen::Vector2d(cur_position + mid_distance * direction,
-                                    mid_velocity * direction));
-    times.push_back(mid_time);
-    knots.push_back(Eigen::Vector2d(target_position, 0));
-    times.push_back(mid_time * 2);
-  } else {
-    knots.push_back(
-        Eigen::Vector2d(cur_position + (kDistanceToMaxVelocity * direction),
-                        kMaxVelocity * direction));
-    times.push_back(kTimeToMaxVelocity);
-
-    const double time_at_max =
-        (delta - 2 * kDistanceToMaxVelocity) / kMaxVelocity;
-    knots.push_back(
-        Eigen::Vector2d(target_position - (kDistanceToMaxVelocity * direction),
-                        kMaxVelocity * direction));
-    times.push_back(kTimeToMaxVelocity + time_at_max);
-
-    knots.push_back(Eigen::Vector2d(target_position, 0));
-    times.push_back(kTimeToMaxVelocity + time_at_max + kTimeToMaxVelocity);
-  }
-  trajectory_.reset(new trajectories::PiecewisePolynomial<double>(
-      trajectories::PiecewisePolynomial<double>::FirstOrderHold(times, knots)));
-}
-
 SchunkWsgStatusSender::SchunkWsgStatusSender(int input_state_size,
                                              int input_torque_size,
                                              int position_index,
@@ -6,7 +6,6 @@
 #include <memory>
 #include <vector>
 
-#include "drake/common/trajectories/trajectory.h"
 #include "drake/lcmt_schunk_wsg_status.hpp"
 #include "drake/manipulation/schunk_wsg/gen/schunk_wsg_trajectory_generator_state_vector.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -25,6 +24,12 @@ namespace schunk_wsg {
 /// reach the commanded target.  The force portion of the command
 /// message is passed through this system, but does not affect the
 /// generated trajectory.
+///
+/// Each new target starts a trapezoidal velocity profile from the
+/// current position, limited by the maximum velocity and acceleration
+/// of the gripper. The profile is stored in the discrete state by its
+/// start time, start position and target, and the output is evaluated
+/// from those in closed form.
 class SchunkWsgTrajectoryGenerator : public systems::LeafSystem<double> {
  public:
   /// @param input_size The size of the state input port to create
@@ -67,8 +72,6 @@ class SchunkWsgTrajectoryGenerator : public systems::LeafSystem<double> {
   std::unique_ptr<systems::DiscreteValues<double>> AllocateDiscreteState()
       const override;
 
-  void UpdateTrajectory(double cur_position, double target_position) const;
-
   /// The minimum change between the last received command and the
   /// current command to trigger a trajectory update.  Based on
   /// manually driving the actual gripper using the web interface, it
@@ -79,11 +82,6 @@ class SchunkWsgTrajectoryGenerator : public systems::LeafSystem<double> {
   const int position_index_{};
   const int target_output_port_{};
   const int max_force_output_port_{};
-
-  // TODO(sam.creasey) I'd prefer to store the trajectory as
-  // discrete state, but unfortunately that's not currently possible
-  // as DiscreteValues may only contain BasicVector.
-  mutable std::unique_ptr<trajectories::Trajectory<double>> trajectory_;
 };
 
 /// Sends lcmt_schunk_wsg_status messages for a Schunk WSG.  This
@@ -43,6 +43,54 @@ GTEST_TEST(SchunkWsgLcmTest, SchunkWsgTrajectoryGeneratorTest) {
   simulator.StepTo(2.0);
   dut.CalcOutput(simulator.get_context(), output.get());
   EXPECT_FLOAT_EQ(output->get_vector_data(0)->GetAtIndex(0), expected_target);
+  EXPECT_EQ(output->get_vector_data(0)->GetAtIndex(1), 0);
+}
+
+// The trajectory is stored in the context, so contexts which have received
+// different commands are independent, and the profile is evaluated in
+// closed form at any time.
+GTEST_TEST(SchunkWsgLcmTest, SchunkWsgTrajectoryGeneratorProfileTest) {
+  SchunkWsgTrajectoryGenerator dut(1, 0);
+  std::unique_ptr<systems::Context<double>> context =
+      dut.CreateDefaultContext();
+  std::unique_ptr<systems::SystemOutput<double>> output =
+      dut.AllocateOutput(*context);
+
+  lcmt_schunk_wsg_command command{};
+  command.target_position_mm = 100;
+  command.force = 40;
+  context->FixInputPort(0,
+      systems::AbstractValue::Make<lcmt_schunk_wsg_command>(command));
+  context->FixInputPort(1, Eigen::VectorXd::Constant(1, 0.01));
+  std::unique_ptr<systems::Context<double>> idle_context = context->Clone();
+
+  // Start the trajectory at t = 1 in one of the contexts only.
+  context->set_time(1.);
+  std::unique_ptr<systems::DiscreteValues<double>> update =
+      dut.AllocateDiscreteVariables();
+  dut.CalcDiscreteVariableUpdates(*context, update.get());
+  context->get_mutable_discrete_state().CopyFrom(*update);
+
+  // The move is 60mm long, so the gripper cruises at the maximum velocity
+  // after accelerating for 84ms.
+  context->set_time(1. + 0.1);
+  dut.CalcOutput(*context, output.get());
+  const double position = output->get_vector_data(0)->GetAtIndex(0);
+  EXPECT_LT(position, 0.01);
+  EXPECT_GT(position, -0.05);
+  EXPECT_DOUBLE_EQ(output->get_vector_data(0)->GetAtIndex(1), -0.42);
+  EXPECT_EQ(output->get_vector_data(1)->GetAtIndex(0), 40);
+
+  context->set_time(1. + 10.);
+  dut.CalcOutput(*context, output.get());
+  EXPECT_DOUBLE_EQ(output->get_vector_data(0)->GetAtIndex(0), -0.05);
+  EXPECT_EQ(output->get_vector_data(0)->GetAtIndex(1), 0);
+
+  // The other context still holds the initial (zero) position.
+  idle_context->set_time(1. + 10.);
+  dut.CalcOutput(*idle_context, output.get());
+  EXPECT_EQ(output->get_vector_data(0)->GetAtIndex(0), 0);
+  EXPECT_EQ(output->get_vector_data(0)->GetAtIndex(1), 0);
 }
 
 }  // namespace
@@ -1,5 +1,7 @@
 #include "drake/manipulation/util/moving_average_filter.h"
 
+#include <algorithm>
+
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
 
@@ -10,36 +12,89 @@ namespace {
 
 int get_dimensions(double) { return 1; }
 
-int get_dimensions(VectorX<double> data) { return data.size(); }
+int get_dimensions(const VectorX<double>& data) { return data.size(); }
 }  // namespace
 
 template <typename T>
 MovingAverageFilter<T>::MovingAverageFilter(int window_size)
     : window_size_(window_size) {
   DRAKE_THROW_UNLESS(window_size_ > 0);
+  window_.resize(window_size_);
 }
 
 template <typename T>
 T MovingAverageFilter<T>::Update(const T& new_data) {
   // First intialize sum (needed when type is not a scalar)
 
-  if (window_.size() == 0) {
+  if (window_count_ == 0) {
     sum_ = new_data;
   } else {
     // Check if new_data has the same dimension as the pre-existing data in the
     // window.
     DRAKE_THROW_UNLESS(get_dimensions(new_data) ==
-                       get_dimensions(window_.front()));
+                       get_dimensions(window_[0]));
     sum_ += new_data;
   }
 
-  window_.push(new_data);
+  if (window_count_ == window_size_) {
+    // The window is full, and the oldest sample is replaced.
+    sum_ -= window_[window_next_];
+  } else {
+    ++window_count_;
+  }
+  window_[window_next_] = new_data;
+  window_next_ = (window_next_ + 1) % window_size_;
+
+  if (++updates_since_resum_ >= std::max(kResumPeriod, window_size_)) {
+    updates_since_resum_ = 0;
+    sum_ = window_[0];
+    for (int i = 1; i < window_count_; ++i) {
+      sum_ += window_[i];
+    }
+  }
+  return (1.0 / window_count_) * sum_;
+}
+
+template <typename T>
+constexpr int MovingAverageFilter<T>::kResumPeriod;
+
+BatchedMovingAverageFilter::BatchedMovingAverageFilter(int window_size,
+                                                       int rows, int cols)
+    : window_size_(window_size) {
+  DRAKE_THROW_UNLESS(window_size_ > 0);
+  DRAKE_THROW_UNLESS(rows >= 0 && cols >= 0);
+  window_.resize(rows * cols, window_size_);
+  sum_ = VectorX<double>::Zero(rows * cols);
+  average_ = MatrixX<double>::Zero(rows, cols);
+}
+
+const MatrixX<double>& BatchedMovingAverageFilter::Update(
+    const Eigen::Ref<const MatrixX<double>>& new_data) {
+  DRAKE_THROW_UNLESS(new_data.rows() == average_.rows() &&
+                     new_data.cols() == average_.cols());
+  const Eigen::Index size = sum_.size();
+  // Views of the sample and the average as a column of all their elements.
+  // new_data may have an outer stride, so it is copied column by column.
+  auto new_column = window_.col(window_next_);
+  if (window_count_ == window_size_) {
+    sum_ -= new_column;
+  } else {
+    ++window_count_;
+  }
+  for (Eigen::Index j = 0; j < new_data.cols(); ++j) {
+    new_column.segment(j * new_data.rows(), new_data.rows()) = new_data.col(j);
+  }
+  sum_ += new_column;
+  window_next_ = (window_next_ + 1) % window_size_;
 
-  if (window_.size() > static_cast<size_t>(window_size_)) {
-    sum_ -= window_.front();
-    window_.pop();
+  if (++updates_since_resum_ >=
+      std::max(MovingAverageFilter<double>::kResumPeriod, window_size_)) {
+    updates_since_resum_ = 0;
+    sum_ = window_.leftCols(window_count_).rowwise().sum();
   }
-  return (1.0 / window_.size()) * sum_;
+  Eigen::Map<VectorX<double>>(average_.data(), size) =
+      (1.0 / window_count_) * sum_;
+  return average_;
 }
 
 template class MovingAverageFilter<double>;
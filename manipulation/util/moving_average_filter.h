@@ -1,10 +1,9 @@
 #pragma once
 
-#include <stddef.h>
-
-#include <queue>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 
 namespace drake {
 namespace manipulation {
@@ -23,6 +22,11 @@ namespace util {
  * a filter of this form in a more `drake::systems` flavour can be generated
  * from a `systems::AffineSystem` since this is a LTI filter.
  *
+ * The window is a circular buffer allocated once, and the sum of its
+ * elements is updated in O(1) per sample. To keep the rounding errors of the
+ * running sum from accumulating, the sum is recomputed from the window once
+ * every kResumPeriod samples, or once every window if the window is larger.
+ *
  * @tparam T The element type.
  * Instantiated templates for the following kinds of T's are provided:
  *  - double
@@ -49,12 +53,66 @@ class MovingAverageFilter {
    */
   T Update(const T& new_data);
 
+  /// The minimum number of samples between two recomputations of the sum.
+  static constexpr int kResumPeriod = 1024;
+
  private:
-  std::queue<T> window_;
+  // Holds the window_count_ most recent samples, the oldest of which is at
+  // index window_next_ if the window is full.
+  std::vector<T> window_;
   int window_size_{0};
+  int window_count_{0};
+  int window_next_{0};
+  int updates_since_resum_{0};
   T sum_;
 };
 
+/**
+ * A moving average filter, as MovingAverageFilter, of a fixed number of
+ * signals at once. Each sample is a matrix whose elements are the current
+ * values of the signals, and the output is the matrix of their moving
+ * averages. Samples are stored in a single preallocated matrix, and an update
+ * does not allocate memory.
+ */
+class BatchedMovingAverageFilter {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BatchedMovingAverageFilter)
+
+  /**
+   * Constructs the filter.
+   * @param window_size The size of the window.
+   * @param rows The number of rows of each sample.
+   * @param cols The number of columns of each sample.
+   * @throws a std::runtime_error when window_size <= 0, or rows or cols are
+   * negative.
+   */
+  BatchedMovingAverageFilter(int window_size, int rows, int cols = 1);
+
+  /**
+   * Adds @p new_data to the window and returns the average of the samples in
+   * the window. The returned reference is valid until the next call.
+   * @throws a std::runtime_error when @p new_data does not have the size
+   * given at construction.
+   */
+  const MatrixX<double>& Update(
+      const Eigen::Ref<const MatrixX<double>>& new_data);
+
+  /// Returns the average computed by the most recent call to Update(), or
+  /// zero if there was none.
+  const MatrixX<double>& average() const { return average_; }
+
+ private:
+  int window_size_{0};
+  int window_count_{0};
+  int window_next_{0};
+  int updates_since_resum_{0};
+  // Column j is sample j of the window, with the elements of the sample in
+  // column-major order.
+  MatrixX<double> window_;
+  VectorX<double> sum_;
+  MatrixX<double> average_;
+};
+
 }  // namespace util
 }  // namespace manipulation
 }  // namespace drake
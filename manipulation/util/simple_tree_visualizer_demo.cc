@@ -29,6 +29,8 @@ int DoMain() {
       "iiwa14_polytope_collision.urdf";
 
   auto tree = std::make_unique<RigidBodyTree<double>>();
+  // The tree is only visualized, so its collision geometry is not needed.
+  tree->set_collision_elements_enabled(false);
 
   auto weld_to_frame = std::allocate_shared<RigidBodyFrame<double>>(
       Eigen::aligned_allocator<RigidBodyFrame<double>>(), "world", nullptr,
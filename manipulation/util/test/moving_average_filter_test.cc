@@ -1,6 +1,9 @@
 #include "drake/manipulation/util/moving_average_filter.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -67,6 +70,66 @@ GTEST_TEST(MovingAverageVectorTest, UpdateVectorTest) {
   EXPECT_ANY_THROW(filter.Update((VectorX<double>(2) << -5.6, 9.0).finished()));
 }
 
+// Compares the filter with the average of the samples in the window, over many
+// windows and past the periodic recomputation of the running sum.
+GTEST_TEST(MovingAverageDoubleTest, LongSequenceTest) {
+  const int window_size = 7;
+  MovingAverageFilter<double> filter(window_size);
+  std::vector<double> samples;
+  const int num_samples =
+      3 * MovingAverageFilter<double>::kResumPeriod + 5;
+  for (int k = 0; k < num_samples; ++k) {
+    // Values of very different magnitudes, which the running sum loses
+    // precision on.
+    samples.push_back(((k % 5 == 0) ? 1e8 : 1.0) * std::sin(0.37 * k));
+    double sum = 0;
+    const int first = std::max(0, k - window_size + 1);
+    for (int j = first; j <= k; ++j) {
+      sum += samples[j];
+    }
+    EXPECT_NEAR(filter.Update(samples.back()), sum / (k - first + 1), 1e-6);
+  }
+}
+
+GTEST_TEST(BatchedMovingAverageFilterTest, InstantiationTest) {
+  EXPECT_NO_THROW(BatchedMovingAverageFilter(2, 3, 4));
+  EXPECT_ANY_THROW(BatchedMovingAverageFilter(0, 3, 4));
+  EXPECT_ANY_THROW(BatchedMovingAverageFilter(2, -1, 4));
+}
+
+// Filtering a matrix of signals at once matches filtering each signal on its
+// own.
+GTEST_TEST(BatchedMovingAverageFilterTest, UpdateTest) {
+  const int rows = 3;
+  const int cols = 2;
+  BatchedMovingAverageFilter filter(kWindowSize, rows, cols);
+  EXPECT_TRUE(CompareMatrices(filter.average(), MatrixX<double>::Zero(3, 2)));
+  std::vector<MovingAverageFilter<double>> single(
+      rows * cols, MovingAverageFilter<double>(kWindowSize));
+
+  MatrixX<double> expected(rows, cols);
+  for (int k = 0; k < 10; ++k) {
+    MatrixX<double> sample(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        sample(i, j) = std::cos(1.3 * k + i - 2.1 * j) * (1 + i + j);
+        expected(i, j) = single[i * cols + j].Update(sample(i, j));
+      }
+    }
+    const MatrixX<double>& average = filter.Update(sample);
+    EXPECT_TRUE(CompareMatrices(average, expected, 1e-12,
+                                drake::MatrixCompareType::absolute));
+    EXPECT_EQ(&average, &filter.average());
+  }
+
+  // A block of a larger matrix is accepted.
+  const MatrixX<double> larger = MatrixX<double>::Ones(5, 5);
+  EXPECT_NO_THROW(filter.Update(larger.block(1, 1, rows, cols)));
+
+  // Check for death on wrong sized data.
+  EXPECT_ANY_THROW(filter.Update(MatrixX<double>::Zero(cols, rows)));
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace util
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
 #include "drake/common/trajectories/piecewise_quaternion.h"
+#include "drake/common/trajectories/piecewise_quaternion_evaluator.h"
 
 namespace drake {
 namespace manipulation {
@@ -17,6 +20,12 @@ namespace manipulation {
  * the interpolated velocity and acceleration will be set to zero, and the
  * interpolated position will peg at the terminal values. All dimensions are
  * assumed to be independent of each other.
+ *
+ * For T = double, the position trajectory is also packed into a
+ * trajectories::PiecewisePolynomialEvaluator at construction, which evaluates
+ * the position and its derivatives without allocating a Polynomial per entry,
+ * and finds the segment of increasing query times in constant time. Copies
+ * share the packed trajectory.
  */
 template <typename T>
 class PiecewiseCubicTrajectory {
@@ -35,19 +44,22 @@ class PiecewiseCubicTrajectory {
     q_ = position_traj;
     qd_ = q_.derivative();
     qdd_ = qd_.derivative();
+    packed_q_ = Pack(q_);
   }
 
   /**
    * Returns the interpolated position at @p time.
    */
-  MatrixX<T> get_position(double time) const { return q_.value(time); }
+  MatrixX<T> get_position(double time) const {
+    return Evaluate(packed_q_.get(), q_, time, 0);
+  }
 
   /**
    * Returns the interpolated velocity at @p time or zero if @p time is out of
    * the time bounds.
    */
   MatrixX<T> get_velocity(double time) const {
-    MatrixX<T> ret = qd_.value(time);
+    MatrixX<T> ret = Evaluate(packed_q_.get(), qd_, time, 1);
     if (!q_.is_time_in_range(time)) ret.setZero();
     return ret;
   }
@@ -57,7 +69,7 @@ class PiecewiseCubicTrajectory {
    * of the time bounds.
    */
   MatrixX<T> get_acceleration(double time) const {
-    MatrixX<T> ret = qdd_.value(time);
+    MatrixX<T> ret = Evaluate(packed_q_.get(), qdd_, time, 2);
     if (!q_.is_time_in_range(time)) ret.setZero();
     return ret;
   }
@@ -106,15 +118,52 @@ class PiecewiseCubicTrajectory {
   }
 
  private:
+  // Only PiecewisePolynomial<double> can be packed.
+  static std::shared_ptr<const trajectories::PiecewisePolynomialEvaluator> Pack(
+      const trajectories::PiecewisePolynomial<double>& traj) {
+    return std::make_shared<const trajectories::PiecewisePolynomialEvaluator>(
+        traj);
+  }
+
+  template <typename U>
+  static std::shared_ptr<const trajectories::PiecewisePolynomialEvaluator> Pack(
+      const trajectories::PiecewisePolynomial<U>&) {
+    return nullptr;
+  }
+
+  // Returns the `derivative_order`'th derivative of q_ at `time`, from
+  // `packed` if it is not null, and otherwise from `derivative`, which is
+  // that derivative of q_.
+  static MatrixX<double> Evaluate(
+      const trajectories::PiecewisePolynomialEvaluator* packed,
+      const trajectories::PiecewisePolynomial<double>& derivative, double time,
+      int derivative_order) {
+    if (packed == nullptr) return derivative.value(time);
+    return packed->value(time, derivative_order);
+  }
+
+  template <typename U>
+  static MatrixX<U> Evaluate(
+      const trajectories::PiecewisePolynomialEvaluator*,
+      const trajectories::PiecewisePolynomial<U>& derivative, double time,
+      int) {
+    return derivative.value(time);
+  }
+
   trajectories::PiecewisePolynomial<T> q_;
   trajectories::PiecewisePolynomial<T> qd_;
   trajectories::PiecewisePolynomial<T> qdd_;
+  std::shared_ptr<const trajectories::PiecewisePolynomialEvaluator> packed_q_;
 };
 
 /**
  * A wrapper class that represents a Cartesian trajectory, whose position part
  * is a PiecewiseCubicTrajectory, and the rotation part is a
  * PiecewiseQuaternionSlerp.
+ *
+ * For T = double, the rotation part is also prepared as a
+ * trajectories::PiecewiseQuaternionEvaluator at construction, which finds the
+ * segment of increasing query times in constant time. Copies share it.
  */
 template <typename T>
 class PiecewiseCartesianTrajectory {
@@ -172,6 +221,7 @@ class PiecewiseCartesianTrajectory {
     DRAKE_DEMAND(pos_traj.get_position_trajectory().cols() == 1);
     position_ = pos_traj;
     orientation_ = rot_traj;
+    packed_orientation_ = Pack(orientation_);
   }
 
   /**
@@ -181,7 +231,8 @@ class PiecewiseCartesianTrajectory {
     Isometry3<T> pose;
     pose.fromPositionOrientationScale(
         position_.get_position(time),
-        orientation_.orientation(time).toRotationMatrix(),
+        GetOrientation(packed_orientation_.get(), orientation_, time)
+            .toRotationMatrix(),
         Vector3<double>::Ones());
     return pose;
   }
@@ -193,7 +244,8 @@ class PiecewiseCartesianTrajectory {
   Vector6<T> get_velocity(double time) const {
     Vector6<T> velocity;
     if (orientation_.is_time_in_range(time)) {
-      velocity.template head<3>() = orientation_.angular_velocity(time);
+      velocity.template head<3>() = GetAngularVelocity(
+          packed_orientation_.get(), orientation_, time);
     } else {
       velocity.template head<3>().setZero();
     }
@@ -243,8 +295,57 @@ class PiecewiseCartesianTrajectory {
   }
 
  private:
+  // Only PiecewiseQuaternionSlerp<double> can be packed.
+  static std::shared_ptr<const trajectories::PiecewiseQuaternionEvaluator>
+  Pack(const trajectories::PiecewiseQuaternionSlerp<double>& traj) {
+    return std::make_shared<const trajectories::PiecewiseQuaternionEvaluator>(
+        traj);
+  }
+
+  template <typename U>
+  static std::shared_ptr<const trajectories::PiecewiseQuaternionEvaluator>
+  Pack(const trajectories::PiecewiseQuaternionSlerp<U>&) {
+    return nullptr;
+  }
+
+  // Returns the orientation of `traj` at `time`, from `packed` if it is not
+  // null.
+  static Quaternion<double> GetOrientation(
+      const trajectories::PiecewiseQuaternionEvaluator* packed,
+      const trajectories::PiecewiseQuaternionSlerp<double>& traj,
+      double time) {
+    if (packed == nullptr) return traj.orientation(time);
+    return packed->orientation(time);
+  }
+
+  template <typename U>
+  static Quaternion<U> GetOrientation(
+      const trajectories::PiecewiseQuaternionEvaluator*,
+      const trajectories::PiecewiseQuaternionSlerp<U>& traj, double time) {
+    return traj.orientation(time);
+  }
+
+  // Returns the angular velocity of `traj` at `time`, from `packed` if it is
+  // not null.
+  static Vector3<double> GetAngularVelocity(
+      const trajectories::PiecewiseQuaternionEvaluator* packed,
+      const trajectories::PiecewiseQuaternionSlerp<double>& traj,
+      double time) {
+    if (packed == nullptr) return traj.angular_velocity(time);
+    return packed->angular_velocity(time);
+  }
+
+  template <typename U>
+  static Vector3<U> GetAngularVelocity(
+      const trajectories::PiecewiseQuaternionEvaluator*,
+      const trajectories::PiecewiseQuaternionSlerp<U>& traj, double time) {
+    return traj.angular_velocity(time);
+  }
+
   PiecewiseCubicTrajectory<T> position_;
   trajectories::PiecewiseQuaternionSlerp<T> orientation_;
+  std::shared_ptr<const trajectories::PiecewiseQuaternionEvaluator>
+      packed_orientation_;
 };
 
 }  // namespace manipulation
@@ -3,11 +3,14 @@
 #include <algorithm>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include <spruce.hh>
 
 #include "drake/common/find_resource.h"
+#include "drake/multibody/joints/fixed_joint.h"
 #include "drake/multibody/parsers/model_instance_id_table.h"
+#include "drake/multibody/parsers/parser_common.h"
 #include "drake/multibody/parsers/sdf_parser.h"
 #include "drake/multibody/parsers/urdf_parser.h"
 #include "drake/multibody/rigid_body_frame.h"
@@ -16,6 +19,7 @@
 
 using Eigen::aligned_allocator;
 using Eigen::Vector3d;
+using drake::multibody::joints::kFixed;
 using drake::multibody::joints::kQuaternion;
 using std::allocate_shared;
 using std::string;
@@ -50,6 +54,37 @@ WorldSimTreeBuilder<T>::WorldSimTreeBuilder() {
 template <typename T>
 WorldSimTreeBuilder<T>::~WorldSimTreeBuilder() {}
 
+namespace {
+
+template <typename T>
+parsers::ModelInstanceIdTable AddModelFile(
+    const string& filename,
+    const drake::multibody::joints::FloatingBaseType floating_base_type,
+    std::shared_ptr<RigidBodyFrame<T>> weld_to_frame, bool do_compile,
+    RigidBodyTree<T>* tree) {
+  spruce::path p(filename);
+
+  // Converts the file extension to be lower case.
+  auto extension = p.extension();
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+                 ::tolower);
+
+  parsers::ModelInstanceIdTable table;
+
+  DRAKE_DEMAND(extension == ".urdf" || extension == ".sdf");
+  if (extension == ".urdf") {
+    table = drake::parsers::urdf::AddModelInstanceFromUrdfFile(
+        filename, floating_base_type, weld_to_frame, do_compile, tree);
+
+  } else if (extension == ".sdf") {
+    table = drake::parsers::sdf::AddModelInstancesFromSdfFile(
+        filename, floating_base_type, weld_to_frame, do_compile, tree);
+  }
+  return table;
+}
+
+}  // namespace
+
 template <typename T>
 int WorldSimTreeBuilder<T>::AddFixedModelInstance(const string& model_name,
                                                   const Vector3d& xyz,
@@ -95,27 +130,21 @@ int WorldSimTreeBuilder<T>::AddModelInstanceToFrame(
     const drake::multibody::joints::FloatingBaseType floating_base_type) {
   DRAKE_DEMAND(!built_);
 
-  spruce::path p(model_map_[model_name]);
-
-  // Converts the file extension to be lower case.
-  auto extension = p.extension();
-  std::transform(extension.begin(), extension.end(), extension.begin(),
-                 ::tolower);
-
-  parsers::ModelInstanceIdTable table;
-
-  DRAKE_DEMAND(extension == ".urdf" || extension == ".sdf");
-  if (extension == ".urdf") {
-    table = drake::parsers::urdf::AddModelInstanceFromUrdfFile(
+  int model_instance_id{};
+  const Prototype& prototype = GetPrototype(model_name);
+  if (prototype.tree != nullptr) {
+    std::vector<int> body_indices;
+    model_instance_id = rigid_body_tree_->AddModelInstanceCopy(
+        *prototype.tree, prototype.model_instance_id, &body_indices);
+    parsers::AddFloatingJoint(floating_base_type, body_indices, weld_to_frame,
+                              nullptr /* pose_map */, rigid_body_tree_.get());
+    rigid_body_tree_->compile();
+  } else {
+    const parsers::ModelInstanceIdTable table = AddModelFile(
         model_map_[model_name], floating_base_type, weld_to_frame,
-        rigid_body_tree_.get());
-
-  } else if (extension == ".sdf") {
-    table = drake::parsers::sdf::AddModelInstancesFromSdfFile(
-        model_map_[model_name], floating_base_type, weld_to_frame,
-        rigid_body_tree_.get());
+        true /* do_compile */, rigid_body_tree_.get());
+    model_instance_id = table.begin()->second;
   }
-  const int model_instance_id = table.begin()->second;
 
   ModelInstanceInfo<T> info;
   info.absolute_model_path = model_map_[model_name];
@@ -125,6 +154,44 @@ int WorldSimTreeBuilder<T>::AddModelInstanceToFrame(
   return model_instance_id;
 }
 
+template <typename T>
+const typename WorldSimTreeBuilder<T>::Prototype&
+WorldSimTreeBuilder<T>::GetPrototype(const string& model_name) {
+  auto iter = prototypes_.find(model_name);
+  if (iter != prototypes_.end()) {
+    return iter->second;
+  }
+  Prototype& prototype = prototypes_[model_name];
+
+  // The model is parsed against a frame with a distinctive offset, which
+  // reveals whether the model file overrides the pose at which the model is
+  // added (e.g., with a URDF world joint or an SDF model pose). The instances
+  // of such models, and of files with several models, are parsed one by one.
+  const Eigen::Isometry3d X_WF(Eigen::Translation3d(1, 2, 3));
+  auto weld_to_frame = allocate_shared<RigidBodyFrame<T>>(
+      aligned_allocator<RigidBodyFrame<T>>(), "world", nullptr, X_WF);
+  auto tree = std::make_unique<RigidBodyTree<T>>();
+  const parsers::ModelInstanceIdTable table =
+      AddModelFile(model_map_.at(model_name), kFixed, weld_to_frame,
+                   false /* do_compile */, tree.get());
+  if (table.size() != 1) {
+    return prototype;
+  }
+  for (const auto& body : tree->get_bodies()) {
+    if (body->get_parent() != &tree->world()) {
+      continue;
+    }
+    const auto* joint = dynamic_cast<const FixedJoint*>(&body->getJoint());
+    if (joint == nullptr ||
+        joint->get_transform_to_parent_body().matrix() != X_WF.matrix()) {
+      return prototype;
+    }
+  }
+  prototype.tree = std::move(tree);
+  prototype.model_instance_id = table.begin()->second;
+  return prototype;
+}
+
 template <typename T>
 void WorldSimTreeBuilder<T>::AddGround() {
   DRAKE_DEMAND(!built_);
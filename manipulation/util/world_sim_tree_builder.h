@@ -166,6 +166,20 @@ class WorldSimTreeBuilder {
 
   std::map<int, ModelInstanceInfo<T>> instance_id_to_model_info_;
 
+  // A model parsed once, whose instances are added as copies of it.
+  struct Prototype {
+    // The tree holding the parsed model, or nullptr if each instance of the
+    // model must be parsed.
+    std::unique_ptr<RigidBodyTree<T>> tree;
+    int model_instance_id{};
+  };
+
+  // Returns the prototype of @p model_name, parsing the model if needed.
+  const Prototype& GetPrototype(const std::string& model_name);
+
+  // Maps model names to their prototypes.
+  std::map<std::string, Prototype> prototypes_;
+
   // The default parameters for evaluating contact: the parameters for the
   // model as well as the contact materials of the collision elements.
   systems::CompliantContactModelParameters contact_model_parameters_;
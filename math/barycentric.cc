@@ -27,6 +27,8 @@ BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
     if (input_grid_[i].size() > 1) num_interpolants_++;
 
     stride_[i] = (i == 0) ? 1 : input_grid_[i - 1].size() * stride_[i - 1];
+
+    coordinates_.emplace_back(input_grid_[i].begin(), input_grid_[i].end());
   }
 }
 
@@ -73,15 +75,82 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
     EigenPtr<VectorX<T>> weights) const {
   DRAKE_DEMAND(input.size() == static_cast<int>(input_grid_.size()));
 
-  // std::pair of fractional position [0,1] and dimension index (position first,
-  // so that std::pair's default operator< works for us).
+  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
+  mesh_indices->resize(num_interpolants_);
+  weights->resize(num_interpolants_);
+  EvalWeightsOfPoint(input.data(), mesh_indices->data(), weights->data(),
+                     relative_position.data());
+}
+
+template <typename T>
+void BarycentricMesh<T>::EvalBarycentricWeights(
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    Eigen::SparseMatrix<T>* weights) const {
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(weights != nullptr);
+  const int num_inputs = inputs.cols();
+  const int num_mesh_points = get_num_mesh_points();
+
+  // Scratch space for one input, allocated once for all of them.
+  const int k = num_interpolants_;
+  std::vector<std::pair<T, int>> relative_position(k - 1);
+  std::vector<std::pair<int, T>> column(k);
+  Eigen::VectorXi mesh_indices(k);
+  VectorX<T> input_weights(k);
+
+  if (weights->rows() != num_mesh_points || weights->cols() != num_inputs) {
+    weights->resize(num_mesh_points, num_inputs);
+  }
+  weights->makeCompressed();
+  // Sizes the storage for the most non-zeros, which only allocates when it
+  // exceeds the capacity.
+  weights->resizeNonZeros(num_inputs * k);
+  int* outer = weights->outerIndexPtr();
+  int* inner = weights->innerIndexPtr();
+  T* values = weights->valuePtr();
+
+  int num_nonzeros = 0;
+  for (int j = 0; j < num_inputs; j++) {
+    // The columns of inputs are contiguous.
+    EvalWeightsOfPoint(inputs.col(j).data(), mesh_indices.data(),
+                       input_weights.data(), relative_position.data());
+
+    // Sorts the entries by mesh index, and sums the weights of the indices
+    // that appear more than once (on the faces of the mesh).
+    for (int i = 0; i < k; i++) {
+      column[i] = std::make_pair(mesh_indices[i], input_weights[i]);
+    }
+    std::sort(column.begin(), column.end(),
+              [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+                return a.first < b.first;
+              });
+    outer[j] = num_nonzeros;
+    for (int i = 0; i < k; i++) {
+      if (i > 0 && column[i].first == column[i - 1].first) {
+        values[num_nonzeros - 1] += column[i].second;
+      } else {
+        inner[num_nonzeros] = column[i].first;
+        values[num_nonzeros] = column[i].second;
+        num_nonzeros++;
+      }
+    }
+  }
+  outer[num_inputs] = num_nonzeros;
+  weights->resizeNonZeros(num_nonzeros);
+}
+
+template <typename T>
+void BarycentricMesh<T>::EvalWeightsOfPoint(
+    const T* input, int* mesh_indices, T* weights,
+    std::pair<T, int>* relative_position) const {
+  // relative_position holds std::pairs of fractional position [0,1] and
+  // dimension index (position first, so that std::pair's default operator<
+  // works for us).  The dimension index is doubled, plus one when the input
+  // is inside of the bounding box of the input grid in that dimension.
   // There is one relative position for every non-singleton input dimension.  In
   // the case of triangular meshes, there is one interpolant for every
   // non-singular dimension + one additional, so num_interpolants-1 is the size
   // we need.
-  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
-  // Bounding box on the input grid containing the sample input.
-  std::vector<bool> has_volume(get_input_size());
 
   int current_index = 0;
 
@@ -89,41 +158,40 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // indices.  Set current_index to the "top right" corner index.
   int count = 0;
   for (int i = 0; i < get_input_size(); i++) {
-    const auto& coords = input_grid_[i];
+    const std::vector<double>& coords = coordinates_[i];
 
     // Skip over singleton dimensions.
     if (coords.size() == 1) continue;
 
-    // Tag the positions with the dimension index.
-    relative_position[count].second = i;
-
     // Find the right side of the bounding box.
     // Recall that lower_bound returns the first grid element that is NOT less
     // than the sample.
-    auto right_iter = coords.lower_bound(input[i]);
+    const auto right_iter =
+        std::lower_bound(coords.begin(), coords.end(), input[i]);
     int right_index = 0;
+    bool has_volume = false;
 
     if (right_iter == coords.end()) {
       // ... then input is off the right end of the grid;
       // move it to the right boundary.
-      has_volume[i] = false;
       right_index = coords.size() - 1;
       relative_position[count].first = T(1.);
     } else if (right_iter == coords.begin()) {
       // ... then input is at the first element or left of it;
       // move it to the left boundary.
-      has_volume[i] = false;
       right_index = 0;
       relative_position[count].first = T(1.);
     } else {
       // ... then input is inside the grid.
-      has_volume[i] = true;
-      right_index = std::distance(coords.begin(), right_iter);
+      has_volume = true;
+      right_index = right_iter - coords.begin();
       const T& right_value = *(right_iter);
       const T& left_value = *(std::prev(right_iter));
       relative_position[count].first =
           (input[i] - left_value) / (right_value - left_value);
     }
+    // Tag the positions with the dimension index.
+    relative_position[count].second = 2 * i + (has_volume ? 1 : 0);
 
     current_index += stride_[i] * right_index;
     count++;
@@ -133,24 +201,21 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // Sort the dimensions by their relative position.  We identify which triangle
   // of the mesh we are in by moving along the faces in order of their relative
   // position.
-  std::sort(relative_position.begin(), relative_position.end());
+  std::sort(relative_position, relative_position + count);
 
-  mesh_indices->resize(num_interpolants_);
-  weights->resize(num_interpolants_);
-  (*mesh_indices)[0] = current_index;
-  (*weights)[0] = relative_position[0].first;
+  mesh_indices[0] = current_index;
+  weights[0] = (count > 0) ? relative_position[0].first : T(1.);
 
   for (int i = 1; i < num_interpolants_; i++) {
-    int dim = relative_position[i - 1].second;
-    if (has_volume[dim]) {
-      current_index -= stride_[dim];
+    const int tag = relative_position[i - 1].second;
+    if (tag % 2 == 1) {
+      current_index -= stride_[tag / 2];
     }
-    (*mesh_indices)[i] = current_index;
+    mesh_indices[i] = current_index;
     if (i == (num_interpolants_ - 1)) {
-      (*weights)[i] = 1.0 - relative_position[i - 1].first;
+      weights[i] = 1.0 - relative_position[i - 1].first;
     } else {
-      (*weights)[i] =
-          relative_position[i].first - relative_position[i - 1].first;
+      weights[i] = relative_position[i].first - relative_position[i - 1].first;
     }
   }
 }
@@ -3,9 +3,11 @@
 #include <iterator>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
+#include <Eigen/SparseCore>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
@@ -99,6 +101,24 @@ class BarycentricMesh {
                               EigenPtr<Eigen::VectorXi> mesh_indices,
                               EigenPtr<VectorX<T>> weights) const;
 
+  /// Writes the interpolating coefficients of each column of @p inputs to the
+  /// same column of @p weights, so that the function values at all of the
+  /// @p inputs are `mesh_values * weights` (see Eval()).  Inputs that are
+  /// outside the bounding box of the input_grid are interpolated as though
+  /// they were projected (elementwise) to the closest face of the defined
+  /// mesh.
+  ///
+  /// Each column of @p weights has at most get_num_interpolants() non-zeros,
+  /// in increasing row order.  If @p weights already has the right size and
+  /// enough capacity, e.g. from a previous call with as many inputs, it is
+  /// reused without allocating memory.
+  ///
+  /// @param inputs is a get_input_size() by num_inputs matrix, with one input
+  /// per column.
+  /// @param weights is resized to get_num_mesh_points() by num_inputs.
+  void EvalBarycentricWeights(const Eigen::Ref<const MatrixX<T>>& inputs,
+                              Eigen::SparseMatrix<T>* weights) const;
+
   /// Evaluates the function at the @p input values, by interpolating between
   /// the values at @p mesh_values.  Inputs that are outside the
   /// bounding box of the input_grid are interpolated as though they were
@@ -170,8 +190,17 @@ class BarycentricMesh {
           vector_func) const;
 
  private:
+  // Writes the get_num_interpolants() mesh indices and coefficients of
+  // @p input to @p mesh_indices and @p weights, using the
+  // get_num_interpolants() - 1 elements of @p relative_position as scratch
+  // space.
+  void EvalWeightsOfPoint(const T* input, int* mesh_indices, T* weights,
+                          std::pair<T, int>* relative_position) const;
+
   MeshGrid input_grid_;      // Specifies the location of the mesh points in
                              // the input space.
+  std::vector<std::vector<double>> coordinates_;  // The sorted coordinates of
+                                                  // input_grid_, by index.
   std::vector<int> stride_;  // The number of elements to skip to arrive at the
                              // next value (per input dimension)
   int num_interpolants_{1};  // The number of points used in any interpolation.
@@ -0,0 +1,144 @@
+#include "drake/math/batch_rotation_conversion.h"
+
+#include <algorithm>
+
+#include "drake/common/drake_assert.h"
+#include "drake/math/quaternion.h"
+#include "drake/math/rotation_matrix.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+// The number of columns that are converted together.
+constexpr int kBlockSize = 64;
+
+// Up to kBlockSize SpaceXYZ angles, one angle per column, stored on the stack.
+using AngleBlock =
+    Eigen::Array<double, Eigen::Dynamic, 3, Eigen::ColMajor, kBlockSize, 3>;
+
+// Up to kBlockSize values, stored on the stack.
+using RowBlock =
+    Eigen::Array<double, 1, Eigen::Dynamic, Eigen::RowMajor, 1, kBlockSize>;
+
+}  // namespace
+
+void RollPitchYawsToQuaternions(const Eigen::Ref<const Eigen::Matrix3Xd>& rpy,
+                                Eigen::Matrix4Xd* quaternions) {
+  DRAKE_DEMAND(quaternions != nullptr);
+  const int num_rotations = rpy.cols();
+  quaternions->resize(4, num_rotations);
+  for (int start = 0; start < num_rotations; start += kBlockSize) {
+    const int size = std::min(kBlockSize, num_rotations - start);
+    const AngleBlock half =
+        0.5 * rpy.middleCols(start, size).transpose().array();
+    const AngleBlock c = half.cos();
+    const AngleBlock s = half.sin();
+    auto q = quaternions->middleCols(start, size);
+    q.row(0) = (c.col(0) * c.col(1) * c.col(2) + s.col(0) * s.col(1) * s.col(2))
+                   .transpose().matrix();
+    q.row(1) = (s.col(0) * c.col(1) * c.col(2) - c.col(0) * s.col(1) * s.col(2))
+                   .transpose().matrix();
+    q.row(2) = (c.col(0) * s.col(1) * c.col(2) + s.col(0) * c.col(1) * s.col(2))
+                   .transpose().matrix();
+    q.row(3) = (c.col(0) * c.col(1) * s.col(2) - s.col(0) * s.col(1) * c.col(2))
+                   .transpose().matrix();
+  }
+}
+
+void RollPitchYawsToRotationMatrices(
+    const Eigen::Ref<const Eigen::Matrix3Xd>& rpy,
+    Eigen::Matrix<double, 9, Eigen::Dynamic>* rotation_matrices) {
+  DRAKE_DEMAND(rotation_matrices != nullptr);
+  const int num_rotations = rpy.cols();
+  rotation_matrices->resize(9, num_rotations);
+  for (int start = 0; start < num_rotations; start += kBlockSize) {
+    const int size = std::min(kBlockSize, num_rotations - start);
+    const AngleBlock angles = rpy.middleCols(start, size).transpose().array();
+    const AngleBlock c = angles.cos();
+    const AngleBlock s = angles.sin();
+    auto R = rotation_matrices->middleCols(start, size);
+    // Row r + 3 c of R holds the (r, c) entries of the rotation matrices.
+    R.row(0) = (c.col(2) * c.col(1)).transpose().matrix();
+    R.row(1) = (s.col(2) * c.col(1)).transpose().matrix();
+    R.row(2) = -s.col(1).transpose().matrix();
+    R.row(3) = (c.col(2) * s.col(1) * s.col(0) - s.col(2) * c.col(0))
+                   .transpose().matrix();
+    R.row(4) = (s.col(2) * s.col(1) * s.col(0) + c.col(2) * c.col(0))
+                   .transpose().matrix();
+    R.row(5) = (c.col(1) * s.col(0)).transpose().matrix();
+    R.row(6) = (c.col(2) * s.col(1) * c.col(0) + s.col(2) * s.col(0))
+                   .transpose().matrix();
+    R.row(7) = (s.col(2) * s.col(1) * c.col(0) - c.col(2) * s.col(0))
+                   .transpose().matrix();
+    R.row(8) = (c.col(1) * c.col(0)).transpose().matrix();
+  }
+}
+
+void QuaternionsToRotationMatrices(
+    const Eigen::Ref<const Eigen::Matrix4Xd>& quaternions,
+    Eigen::Matrix<double, 9, Eigen::Dynamic>* rotation_matrices) {
+  DRAKE_DEMAND(rotation_matrices != nullptr);
+  const int num_rotations = quaternions.cols();
+  rotation_matrices->resize(9, num_rotations);
+  for (int start = 0; start < num_rotations; start += kBlockSize) {
+    const int size = std::min(kBlockSize, num_rotations - start);
+    const auto q = quaternions.middleCols(start, size);
+    const auto w = q.row(0).array();
+    const auto x = q.row(1).array();
+    const auto y = q.row(2).array();
+    const auto z = q.row(3).array();
+    // Scaling by 2 / |q|² normalizes q without a square root; see
+    // RotationMatrix::QuaternionToRotationMatrix().
+    const RowBlock two_over_norm_squared =
+        2.0 / q.colwise().squaredNorm().array();
+    const RowBlock sx = two_over_norm_squared * x;
+    const RowBlock sy = two_over_norm_squared * y;
+    const RowBlock sz = two_over_norm_squared * z;
+    const RowBlock swx = sx * w, swy = sy * w, swz = sz * w;
+    const RowBlock sxx = sx * x, sxy = sy * x, sxz = sz * x;
+    const RowBlock syy = sy * y, syz = sz * y, szz = sz * z;
+    auto R = rotation_matrices->middleCols(start, size);
+    // Row r + 3 c of R holds the (r, c) entries of the rotation matrices.
+    R.row(0) = (1.0 - syy - szz).matrix();
+    R.row(1) = (sxy + swz).matrix();
+    R.row(2) = (sxz - swy).matrix();
+    R.row(3) = (sxy - swz).matrix();
+    R.row(4) = (1.0 - sxx - szz).matrix();
+    R.row(5) = (syz + swx).matrix();
+    R.row(6) = (sxz + swy).matrix();
+    R.row(7) = (syz - swx).matrix();
+    R.row(8) = (1.0 - sxx - syy).matrix();
+  }
+}
+
+void RotationMatricesToQuaternions(
+    const Eigen::Ref<const Eigen::Matrix<double, 9, Eigen::Dynamic>>&
+        rotation_matrices,
+    Eigen::Matrix4Xd* quaternions) {
+  DRAKE_DEMAND(quaternions != nullptr);
+  const int num_rotations = rotation_matrices.cols();
+  quaternions->resize(4, num_rotations);
+  // The conversion chooses among four formulas for each rotation, so it does
+  // not vectorize across rotations.
+  for (int i = 0; i < num_rotations; ++i) {
+    const Eigen::Map<const Eigen::Matrix3d> R(rotation_matrices.col(i).data());
+    const Eigen::Quaterniond q = RotationMatrix<double>(R).ToQuaternion();
+    quaternions->col(i) << q.w(), q.x(), q.y(), q.z();
+  }
+}
+
+void QuaternionsToRollPitchYaws(
+    const Eigen::Ref<const Eigen::Matrix4Xd>& quaternions,
+    Eigen::Matrix3Xd* rpy) {
+  DRAKE_DEMAND(rpy != nullptr);
+  const int num_rotations = quaternions.cols();
+  rpy->resize(3, num_rotations);
+  // The conversion uses atan2, which Eigen does not vectorize.
+  for (int i = 0; i < num_rotations; ++i) {
+    rpy->col(i) = QuaternionToSpaceXYZ(quaternions.col(i));
+  }
+}
+
+}  // namespace math
+}  // namespace drake
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+namespace drake {
+namespace math {
+
+/// @name Batched rotation conversions
+/// These functions convert many rotations at once, one rotation per column.
+/// They are equivalent to calling the single-rotation conversions on each
+/// column, but the trigonometric functions are evaluated on blocks of columns
+/// at once, so that Eigen can vectorize them. None of these functions check
+/// that their inputs are valid rotations, and none of them allocate memory
+/// when the output already has the right number of columns.
+///
+/// The conventions are those of the single-rotation conversions:
+/// - Roll-pitch-yaw angles are SpaceXYZ angles [roll; pitch; yaw], as in
+///   rpy2rotmat() and QuaternionToSpaceXYZ().
+/// - Quaternions are stored as [w; x; y; z], as in rpy2quat().
+/// - Rotation matrices are stored column-major, i.e., column i of the output is
+///   Eigen::Map<Eigen::Matrix3d>(rotation_matrices->col(i).data()).
+//@{
+
+/// Converts each column of @p rpy to a unit quaternion, as rpy2quat() does.
+void RollPitchYawsToQuaternions(const Eigen::Ref<const Eigen::Matrix3Xd>& rpy,
+                                Eigen::Matrix4Xd* quaternions);
+
+/// Converts each column of @p rpy to a rotation matrix, as rpy2rotmat() does.
+void RollPitchYawsToRotationMatrices(
+    const Eigen::Ref<const Eigen::Matrix3Xd>& rpy,
+    Eigen::Matrix<double, 9, Eigen::Dynamic>* rotation_matrices);
+
+/// Converts each column of @p quaternions to a rotation matrix, as
+/// RotationMatrix(const Eigen::Quaternion<T>&) does; that is, the quaternions
+/// need not be normalized.
+void QuaternionsToRotationMatrices(
+    const Eigen::Ref<const Eigen::Matrix4Xd>& quaternions,
+    Eigen::Matrix<double, 9, Eigen::Dynamic>* rotation_matrices);
+
+/// Converts each column of @p rotation_matrices to a unit quaternion with a
+/// non-negative w, as RotationMatrix::ToQuaternion() does.
+void RotationMatricesToQuaternions(
+    const Eigen::Ref<const Eigen::Matrix<double, 9, Eigen::Dynamic>>&
+        rotation_matrices,
+    Eigen::Matrix4Xd* quaternions);
+
+/// Converts each column of @p quaternions to roll-pitch-yaw angles, as
+/// QuaternionToSpaceXYZ() does.
+void QuaternionsToRollPitchYaws(
+    const Eigen::Ref<const Eigen::Matrix4Xd>& quaternions,
+    Eigen::Matrix3Xd* rpy);
+
+//@}
+
+}  // namespace math
+}  // namespace drake
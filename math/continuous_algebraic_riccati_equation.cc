@@ -1,10 +1,62 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/common/parallel_for.h"
+#include "drake/math/lyapunov_equation.h"
 
 namespace drake {
 namespace math {
+namespace {
+
+// Runs the Newton-Kleinman iteration from S_guess. Returns false if the gain
+// of S_guess is not stabilizing, or if the iteration does not converge.
+bool SolveByNewtonKleinman(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                           const Eigen::Ref<const Eigen::MatrixXd>& B,
+                           const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                           const Eigen::LLT<Eigen::MatrixXd>& R_cholesky,
+                           const Eigen::Ref<const Eigen::MatrixXd>& S_guess,
+                           Eigen::MatrixXd* S) {
+  const Eigen::Index n = B.rows();
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(S_guess.rows() == n && S_guess.cols() == n);
+
+  // these could be options
+  const double tolerance = 1e-12;
+  const int max_iterations = 50;
+
+  *S = S_guess;
+  Eigen::MatrixXd SB = *S * B;
+  Eigen::MatrixXd A_closed_loop = A - B * R_cholesky.solve(SB.transpose());
+  // Every iterate stays stabilizing once the first one is.
+  const Eigen::VectorXcd eigenvalues = A_closed_loop.eigenvalues();
+  if ((eigenvalues.real().array() >= 0).any()) return false;
+
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    // K' R K = S B inv(R) B' S.
+    Eigen::MatrixXd S_next;
+    try {
+      S_next = RealContinuousLyapunovEquation(
+          A_closed_loop, Q + SB * R_cholesky.solve(SB.transpose()));
+    } catch (const std::runtime_error&) {
+      return false;
+    }
+    const double change = (S_next - *S).norm();
+    *S = std::move(S_next);
+    if (change <= tolerance * std::max(1.0, S->norm())) return true;
+    SB = *S * B;
+    A_closed_loop = A - B * R_cholesky.solve(SB.transpose());
+  }
+  return false;
+}
+
+}  // namespace
 
 Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
@@ -78,5 +130,52 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
   return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
 }
 
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_guess) {
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+  Eigen::MatrixXd S;
+  if (SolveByNewtonKleinman(A, B, Q, R_cholesky, S_guess, &S)) return S;
+  return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
+}
+
+std::vector<Eigen::MatrixXd> ContinuousAlgebraicRiccatiEquations(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, int num_threads) {
+  DRAKE_THROW_UNLESS(A.size() == B.size());
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+
+  const Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+
+  // Each run only reads the shared Q and R_cholesky, and writes its own
+  // elements of S.
+  const int size = static_cast<int>(A.size());
+  const int num_runs = std::min(size, num_threads);
+  std::vector<Eigen::MatrixXd> S(size);
+  ParallelFor(num_runs, num_threads, [&](int run) {
+    const int begin = run * size / num_runs;
+    const int end = (run + 1) * size / num_runs;
+    for (int i = begin; i < end; ++i) {
+      if (i == begin || !SolveByNewtonKleinman(A[i], B[i], Q, R_cholesky,
+                                               S[i - 1], &S[i])) {
+        S[i] = ContinuousAlgebraicRiccatiEquation(A[i], B[i], Q, R_cholesky);
+      }
+    }
+  });
+  return S;
+}
+
 }  // namespace math
 }  // namespace drake
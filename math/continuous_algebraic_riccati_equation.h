@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <Eigen/Dense>
 
 namespace drake {
@@ -32,5 +34,43 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::LLT<Eigen::MatrixXd>& R_cholesky);
 
+/// This is functionally the same as
+/// ContinuousAlgebraicRiccatiEquation(A, B, Q, R), but starts from the guess
+/// @p S_guess, e.g., the solution for a nearby (A, B) in a gain-scheduled
+/// controller. It runs the Newton-Kleinman iteration
+///
+/// @verbatim
+///  K = inv(R) B' S
+///  (A - B K)' S + S (A - B K) + Q + K' R K = 0
+/// @endverbatim
+///
+/// which solves one Lyapunov equation per step, and converges quadratically
+/// from any S_guess whose gain K stabilizes A - B K. Otherwise, or if the
+/// iteration does not converge, it falls back to the solve from scratch.
+///
+/// @throws std::runtime_error if R is not positive definite.
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_guess);
+
+/// Solves ContinuousAlgebraicRiccatiEquation(A[i], B[i], Q, R) for each i,
+/// e.g., for the linearizations of a system along the knots of a trajectory.
+/// R is factored once for all the solves. The sequence is split into up to
+/// @p num_threads contiguous runs, solved on separate threads; within a run,
+/// each solve is warm-started from the solution of the previous one, so that
+/// a slowly varying sequence costs a few Lyapunov solves per element.
+///
+/// @throws std::runtime_error if R is not positive definite.
+/// @throws std::runtime_error if A and B differ in size, or if num_threads is
+/// not positive.
+std::vector<Eigen::MatrixXd> ContinuousAlgebraicRiccatiEquations(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, int num_threads = 1);
+
 }  // namespace math
 }  // namespace drake
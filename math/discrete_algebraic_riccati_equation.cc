@@ -1,8 +1,14 @@
 #include "drake/math/discrete_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/common/parallel_for.h"
+#include "drake/math/lyapunov_equation.h"
 
 namespace drake {
 namespace math {
@@ -344,6 +350,50 @@ void reorder_eigen(Eigen::Ref<Eigen::MatrixXd> S, Eigen::Ref<Eigen::MatrixXd> T,
   if (p < n && q >= n2)
     throw std::runtime_error("fail to find enough stable eigenvalues");
 }
+
+// Runs Hewer's iteration from X_guess. Returns false if the gain of X_guess
+// is not stabilizing, or if the iteration does not converge.
+bool SolveByHewer(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                  const Eigen::Ref<const Eigen::MatrixXd>& B,
+                  const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                  const Eigen::Ref<const Eigen::MatrixXd>& R,
+                  const Eigen::Ref<const Eigen::MatrixXd>& X_guess,
+                  Eigen::MatrixXd* X) {
+  const int n = B.rows(), m = B.cols();
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
+  DRAKE_DEMAND(X_guess.rows() == n && X_guess.cols() == n);
+
+  const double tolerance = 1e-12;
+  const int max_iterations = 50;
+
+  *X = X_guess;
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    const Eigen::MatrixXd BX = B.transpose() * *X;
+    const Eigen::LLT<Eigen::MatrixXd> BXB_plus_R(BX * B + R);
+    if (BXB_plus_R.info() != Eigen::Success) return false;
+    const Eigen::MatrixXd K = BXB_plus_R.solve(BX * A);
+    const Eigen::MatrixXd A_closed_loop = A - B * K;
+    // Every iterate stays stabilizing once the first one is.
+    if (iteration == 0) {
+      const Eigen::VectorXcd eigenvalues = A_closed_loop.eigenvalues();
+      if ((eigenvalues.cwiseAbs().array() >= 1).any()) return false;
+    }
+    Eigen::MatrixXd X_next;
+    try {
+      X_next = RealDiscreteLyapunovEquation(A_closed_loop,
+                                            Q + K.transpose() * R * K);
+    } catch (const std::runtime_error&) {
+      return false;
+    }
+    const double change = (X_next - *X).norm();
+    *X = std::move(X_next);
+    if (change <= tolerance * std::max(1.0, X->norm())) return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 /**
@@ -424,5 +474,44 @@ Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
   return X;
 }
 
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_guess) {
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  DRAKE_THROW_UNLESS(Eigen::LLT<Eigen::MatrixXd>(R).info() == Eigen::Success);
+  Eigen::MatrixXd X;
+  if (SolveByHewer(A, B, Q, R, X_guess, &X)) return X;
+  return DiscreteAlgebraicRiccatiEquation(A, B, Q, R);
+}
+
+std::vector<Eigen::MatrixXd> DiscreteAlgebraicRiccatiEquations(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, int num_threads) {
+  DRAKE_THROW_UNLESS(A.size() == B.size());
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  DRAKE_THROW_UNLESS(Eigen::LLT<Eigen::MatrixXd>(R).info() == Eigen::Success);
+
+  // Each run only reads the shared Q and R, and writes its own elements of X.
+  const int size = static_cast<int>(A.size());
+  const int num_runs = std::min(size, num_threads);
+  std::vector<Eigen::MatrixXd> X(size);
+  ParallelFor(num_runs, num_threads, [&](int run) {
+    const int begin = run * size / num_runs;
+    const int end = (run + 1) * size / num_runs;
+    for (int i = begin; i < end; ++i) {
+      if (i == begin || !SolveByHewer(A[i], B[i], Q, R, X[i - 1], &X[i])) {
+        X[i] = DiscreteAlgebraicRiccatiEquation(A[i], B[i], Q, R);
+      }
+    }
+  });
+  return X;
+}
+
 }  // namespace math
 }  // namespace drake
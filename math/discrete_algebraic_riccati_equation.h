@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -27,6 +28,46 @@ Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& B,
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::Ref<const Eigen::MatrixXd>& R);
+
+/// This is functionally the same as
+/// DiscreteAlgebraicRiccatiEquation(A, B, Q, R), but starts from the guess
+/// @p X_guess, e.g., the solution for a nearby (A, B) in a gain-scheduled
+/// controller. It runs Hewer's (Newton's) iteration
+///
+/// \f[
+/// K = (B'XB+R)^{-1}B'XA, \quad
+/// (A-BK)'X(A-BK) - X + Q + K'RK = 0
+/// \f]
+///
+/// which solves one Lyapunov equation per step, and converges quadratically
+/// from any X_guess whose gain K places the eigenvalues of A - BK inside the
+/// unit circle. Otherwise, or if the iteration does not converge, it falls
+/// back to the solve from scratch.
+///
+/// @throws std::runtime_error if Q is not positive semi-definite.
+/// @throws std::runtime_error if R is not positive definite.
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_guess);
+
+/// Solves DiscreteAlgebraicRiccatiEquation(A[i], B[i], Q, R) for each i. The
+/// sequence is split into up to @p num_threads contiguous runs, solved on
+/// separate threads; within a run, each solve is warm-started from the
+/// solution of the previous one.
+///
+/// @throws std::runtime_error if Q is not positive semi-definite.
+/// @throws std::runtime_error if R is not positive definite.
+/// @throws std::runtime_error if A and B differ in size, or if num_threads is
+/// not positive.
+std::vector<Eigen::MatrixXd> DiscreteAlgebraicRiccatiEquations(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, int num_threads = 1);
+
 }  // namespace math
 }  // namespace drake
 
@@ -0,0 +1,108 @@
+#include "drake/math/lyapunov_equation.h"
+
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/is_approx_equal_abstol.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+// Diagonal entries smaller than this, relative to the norm of A, make the
+// Lyapunov operator numerically singular.
+const double kSingularTolerance = 1e-12;
+
+void ThrowIfSingular(const Eigen::MatrixXcd& M, double tolerance) {
+  if (M.diagonal().cwiseAbs().minCoeff() <= tolerance) {
+    throw std::runtime_error(
+        "The Lyapunov equation does not have a unique solution.");
+  }
+}
+
+// Computes the complex Schur decomposition A = U T U*, and returns -U* Q U.
+Eigen::MatrixXcd TransformToSchurBasis(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    Eigen::ComplexSchur<Eigen::MatrixXd>* schur) {
+  const Eigen::Index n = A.rows();
+  DRAKE_DEMAND(A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(is_approx_equal_abstol(Q, Q.transpose(), 1e-10));
+  schur->compute(A);
+  if (schur->info() != Eigen::Success) {
+    throw std::runtime_error("The Schur decomposition of A did not converge.");
+  }
+  const Eigen::MatrixXcd& U = schur->matrixU();
+  return -(U.adjoint() * Q.cast<std::complex<double>>() * U);
+}
+
+// Returns the real, symmetric X = U Y U*.
+Eigen::MatrixXd TransformFromSchurBasis(
+    const Eigen::ComplexSchur<Eigen::MatrixXd>& schur,
+    const Eigen::MatrixXcd& Y) {
+  const Eigen::MatrixXcd& U = schur.matrixU();
+  const Eigen::MatrixXd X = (U * Y * U.adjoint()).real();
+  return 0.5 * (X + X.transpose());
+}
+
+}  // namespace
+
+Eigen::MatrixXd RealContinuousLyapunovEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q) {
+  // With A = U T U*, the equation becomes T* Y + Y T = -U* Q U for
+  // Y = U* X U. Since T* is lower triangular, column j of Y solves
+  //   (T* + T(j, j) I) Y(:, j) = -(U* Q U)(:, j) - Σₖ₍ₖ<ⱼ₎ Y(:, k) T(k, j)
+  // by forward substitution.
+  Eigen::ComplexSchur<Eigen::MatrixXd> schur;
+  const Eigen::MatrixXcd C = TransformToSchurBasis(A, Q, &schur);
+  const Eigen::MatrixXcd& T = schur.matrixT();
+  const Eigen::MatrixXcd T_adjoint = T.adjoint();
+  const Eigen::Index n = A.rows();
+  const double tolerance = kSingularTolerance * std::max(1.0, T.norm());
+
+  Eigen::MatrixXcd Y(n, n);
+  Eigen::MatrixXcd M(n, n);
+  for (Eigen::Index j = 0; j < n; ++j) {
+    M = T_adjoint;
+    M.diagonal().array() += T(j, j);
+    ThrowIfSingular(M, tolerance);
+    const Eigen::VectorXcd rhs =
+        C.col(j) - Y.leftCols(j) * T.col(j).head(j);
+    Y.col(j) = M.triangularView<Eigen::Lower>().solve(rhs);
+  }
+  return TransformFromSchurBasis(schur, Y);
+}
+
+Eigen::MatrixXd RealDiscreteLyapunovEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q) {
+  // With A = U T U*, the equation becomes T* Y T - Y = -U* Q U for
+  // Y = U* X U. Since T* is lower triangular, column j of Y solves
+  //   (T(j, j) T* - I) Y(:, j) = -(U* Q U)(:, j) - T* Σₖ₍ₖ<ⱼ₎ Y(:, k) T(k, j)
+  // by forward substitution.
+  Eigen::ComplexSchur<Eigen::MatrixXd> schur;
+  const Eigen::MatrixXcd C = TransformToSchurBasis(A, Q, &schur);
+  const Eigen::MatrixXcd& T = schur.matrixT();
+  const Eigen::MatrixXcd T_adjoint = T.adjoint();
+  const Eigen::Index n = A.rows();
+  const double tolerance = kSingularTolerance * std::max(1.0, T.norm());
+
+  Eigen::MatrixXcd Y(n, n);
+  Eigen::MatrixXcd M(n, n);
+  for (Eigen::Index j = 0; j < n; ++j) {
+    M = T(j, j) * T_adjoint;
+    M.diagonal().array() -= 1.0;
+    ThrowIfSingular(M, tolerance);
+    const Eigen::VectorXcd rhs =
+        C.col(j) - T_adjoint * (Y.leftCols(j) * T.col(j).head(j));
+    Y.col(j) = M.triangularView<Eigen::Lower>().solve(rhs);
+  }
+  return TransformFromSchurBasis(schur, Y);
+}
+
+}  // namespace math
+}  // namespace drake
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+namespace drake {
+namespace math {
+
+/// Computes the unique solution X to the continuous-time Lyapunov equation:
+///
+/// @verbatim
+///  A' X + X A + Q = 0
+/// @endverbatim
+///
+/// where Q is symmetric. The solution is unique if and only if no two
+/// eigenvalues λᵢ, λⱼ of A satisfy λᵢ + λⱼ = 0; in particular, it is unique
+/// when A is Hurwitz, in which case X is positive semi-definite whenever Q is.
+///
+/// @throws std::runtime_error if the solution is not unique.
+///
+/// Based on the Bartels-Stewart algorithm, applied to the complex Schur form
+/// of A, which costs O(n³) for A of size n x n.
+Eigen::MatrixXd RealContinuousLyapunovEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q);
+
+/// Computes the unique solution X to the discrete-time Lyapunov equation:
+///
+/// @verbatim
+///  A' X A - X + Q = 0
+/// @endverbatim
+///
+/// where Q is symmetric. The solution is unique if and only if no two
+/// eigenvalues λᵢ, λⱼ of A satisfy λᵢλⱼ = 1; in particular, it is unique when
+/// all the eigenvalues of A lie inside the unit circle, in which case X is
+/// positive semi-definite whenever Q is.
+///
+/// @throws std::runtime_error if the solution is not unique.
+///
+/// Based on the Bartels-Stewart algorithm, applied to the complex Schur form
+/// of A, which costs O(n³) for A of size n x n.
+Eigen::MatrixXd RealDiscreteLyapunovEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q);
+
+}  // namespace math
+}  // namespace drake
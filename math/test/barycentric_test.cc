@@ -99,6 +99,47 @@ GTEST_TEST(BarycentricTest, EvalWeights) {
   EXPECT_TRUE(CompareMatrices(weights, Vector3d{.5, 0, .5}, 1e-8));
 }
 
+// The batched weights give the same interpolation as the weights of each
+// input, including on the faces of the mesh and outside of it.
+GTEST_TEST(BarycentricTest, EvalWeightsBatch) {
+  BarycentricMesh<double> bary{{{0.0, 1.0, 3.0},
+                                {2.0},
+                                {3.0, 4.0, 4.5, 6.0}}};
+  const int num_interpolants = bary.get_num_interpolants();
+
+  MatrixXd inputs(3, 7);
+  inputs << 1., 1., 1.5, 0., -1.5, .5, 2.,
+            2., 3., 2., 2., 2., 2., 2.,
+            3.1, 3.1, 3.1, 3.4, 3.4, 3.5, 7.;
+  const MatrixXd mesh_values =
+      MatrixXd::Random(2, bary.get_num_mesh_points());
+
+  Eigen::SparseMatrix<double> weights;
+  for (int trial = 0; trial < 2; trial++) {
+    bary.EvalBarycentricWeights(inputs, &weights);
+    ASSERT_EQ(weights.rows(), bary.get_num_mesh_points());
+    ASSERT_EQ(weights.cols(), inputs.cols());
+    const MatrixXd values = mesh_values * weights;
+    for (int j = 0; j < inputs.cols(); j++) {
+      EXPECT_TRUE(CompareMatrices(
+          values.col(j), bary.Eval(mesh_values, inputs.col(j)), 1e-12));
+
+      // The rows of each column are increasing, without repetition.
+      int num_nonzeros = 0;
+      int previous_row = -1;
+      for (Eigen::SparseMatrix<double>::InnerIterator it(weights, j); it;
+           ++it) {
+        EXPECT_GT(it.row(), previous_row);
+        previous_row = it.row();
+        num_nonzeros++;
+      }
+      EXPECT_LE(num_nonzeros, num_interpolants);
+    }
+    // The second trial reuses the weights with other inputs.
+    inputs.row(0).array() += .25;
+  }
+}
+
 GTEST_TEST(BarycentricTest, EvalTest) {
   BarycentricMesh<double> bary{{{0.0, 1.0},  // BR
                                 {0.0, 1.0}}};
@@ -0,0 +1,85 @@
+#include "drake/math/batch_rotation_conversion.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/quaternion.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/math/rotation_matrix.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+const double kTolerance = 1e-14;
+
+// More than one block of columns, with a partial block at the end.
+const int kNumRotations = 150;
+
+Eigen::Matrix3Xd MakeRollPitchYaws() {
+  std::mt19937 generator(41);
+  std::uniform_real_distribution<double> angle(-M_PI / 2 + 0.1, M_PI / 2 - 0.1);
+  Eigen::Matrix3Xd rpy(3, kNumRotations);
+  for (int i = 0; i < kNumRotations; ++i) {
+    rpy.col(i) << 2 * angle(generator), angle(generator), 2 * angle(generator);
+  }
+  return rpy;
+}
+
+GTEST_TEST(BatchRotationConversionTest, RollPitchYaw) {
+  const Eigen::Matrix3Xd rpy = MakeRollPitchYaws();
+  Eigen::Matrix4Xd quaternions;
+  RollPitchYawsToQuaternions(rpy, &quaternions);
+  Eigen::Matrix<double, 9, Eigen::Dynamic> rotation_matrices;
+  RollPitchYawsToRotationMatrices(rpy, &rotation_matrices);
+  ASSERT_EQ(quaternions.cols(), kNumRotations);
+  ASSERT_EQ(rotation_matrices.cols(), kNumRotations);
+  for (int i = 0; i < kNumRotations; ++i) {
+    EXPECT_TRUE(CompareMatrices(quaternions.col(i), rpy2quat(rpy.col(i)),
+                                kTolerance));
+    const Eigen::Map<const Eigen::Matrix3d> R(rotation_matrices.col(i).data());
+    EXPECT_TRUE(CompareMatrices(R, rpy2rotmat(rpy.col(i)), kTolerance));
+  }
+
+  Eigen::Matrix3Xd rpy_round_trip;
+  QuaternionsToRollPitchYaws(quaternions, &rpy_round_trip);
+  EXPECT_TRUE(CompareMatrices(rpy_round_trip, rpy, 1e-12));
+}
+
+GTEST_TEST(BatchRotationConversionTest, Quaternion) {
+  Eigen::Matrix4Xd quaternions;
+  RollPitchYawsToQuaternions(MakeRollPitchYaws(), &quaternions);
+  // Scaled quaternions represent the same rotations.
+  quaternions.rightCols(kNumRotations / 2) *= 3.0;
+
+  Eigen::Matrix<double, 9, Eigen::Dynamic> rotation_matrices;
+  QuaternionsToRotationMatrices(quaternions, &rotation_matrices);
+  Eigen::Matrix4Xd quaternions_round_trip;
+  RotationMatricesToQuaternions(rotation_matrices, &quaternions_round_trip);
+  for (int i = 0; i < kNumRotations; ++i) {
+    const Eigen::Quaterniond q(quaternions(0, i), quaternions(1, i),
+                               quaternions(2, i), quaternions(3, i));
+    const RotationMatrix<double> expected(q);
+    const Eigen::Map<const Eigen::Matrix3d> R(rotation_matrices.col(i).data());
+    EXPECT_TRUE(CompareMatrices(R, expected.matrix(), kTolerance));
+
+    const Eigen::Quaterniond expected_q = expected.ToQuaternion();
+    EXPECT_TRUE(CompareMatrices(
+        quaternions_round_trip.col(i),
+        Eigen::Vector4d(expected_q.w(), expected_q.x(), expected_q.y(),
+                        expected_q.z()),
+        kTolerance));
+  }
+}
+
+GTEST_TEST(BatchRotationConversionTest, Empty) {
+  Eigen::Matrix4Xd quaternions(4, 3);
+  RollPitchYawsToQuaternions(Eigen::Matrix3Xd(3, 0), &quaternions);
+  EXPECT_EQ(quaternions.cols(), 0);
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
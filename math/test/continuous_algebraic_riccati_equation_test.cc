@@ -1,5 +1,7 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -60,6 +62,57 @@ GTEST_TEST(CARE, TestCare2) {
   SolveCAREandVerify(A1, B1, Q, R1);
 }
 
+// Tests that warm starts converge to the same solution, whether or not the
+// guess is stabilizing.
+GTEST_TEST(CARE, TestWarmStart) {
+  MatrixXd A(2, 2), B(2, 1), Q(2, 2), R(1, 1);
+  A << 0, 1, 10, 0;
+  B << 0, 1;
+  Q << 1, 0, 0, 1;
+  R << 1;
+  const MatrixXd S = ContinuousAlgebraicRiccatiEquation(A, B, Q, R);
+
+  MatrixXd A_nearby = A;
+  A_nearby(1, 0) = 10.5;
+  const MatrixXd S_nearby =
+      ContinuousAlgebraicRiccatiEquation(A_nearby, B, Q, R);
+  EXPECT_TRUE(CompareMatrices(
+      ContinuousAlgebraicRiccatiEquation(A_nearby, B, Q, R, S), S_nearby,
+      1e-10, MatrixCompareType::absolute));
+  // The zero guess does not stabilize the upright pendulum.
+  EXPECT_TRUE(CompareMatrices(
+      ContinuousAlgebraicRiccatiEquation(A_nearby, B, Q, R,
+                                         MatrixXd::Zero(2, 2)),
+      S_nearby, 1e-10, MatrixCompareType::absolute));
+}
+
+// Tests that the batched solves match the individual ones.
+GTEST_TEST(CARE, TestBatch) {
+  MatrixXd Q(2, 2), R(1, 1);
+  Q << 1, 0, 0, 1;
+  R << 1;
+  std::vector<MatrixXd> A, B;
+  for (int i = 0; i < 5; ++i) {
+    MatrixXd A_i(2, 2), B_i(2, 1);
+    A_i << 0, 1, 10 - i, -0.1 * i;
+    B_i << 0, 1 + i;
+    A.push_back(A_i);
+    B.push_back(B_i);
+  }
+  for (int num_threads : {1, 2}) {
+    const std::vector<MatrixXd> S =
+        ContinuousAlgebraicRiccatiEquations(A, B, Q, R, num_threads);
+    ASSERT_EQ(S.size(), A.size());
+    for (size_t i = 0; i < A.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          S[i], ContinuousAlgebraicRiccatiEquation(A[i], B[i], Q, R), 1e-12,
+          MatrixCompareType::absolute));
+    }
+  }
+  EXPECT_THROW(ContinuousAlgebraicRiccatiEquations(A, {}, Q, R),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/math/discrete_algebraic_riccati_equation.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -52,6 +54,54 @@ GTEST_TEST(DARE, SolveDAREandVerify) {
   R2 << 0.3;
   SolveDAREandVerify(A2, B2, Q2, R2);
 }
+
+// Tests that warm starts converge to the same solution, whether or not the
+// guess is stabilizing.
+GTEST_TEST(DARE, WarmStart) {
+  MatrixXd A(2, 2), B(2, 1), Q(2, 2), R(1, 1);
+  A << 1, 0.1, 0.5, 1;
+  B << 0, 0.1;
+  Q << 1, 0, 0, 1;
+  R << 1;
+  const MatrixXd X = DiscreteAlgebraicRiccatiEquation(A, B, Q, R);
+
+  MatrixXd A_nearby = A;
+  A_nearby(1, 0) = 0.55;
+  const MatrixXd X_nearby = DiscreteAlgebraicRiccatiEquation(A_nearby, B, Q, R);
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquation(A_nearby, B, Q, R, X), X_nearby, 1e-8,
+      MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquation(A_nearby, B, Q, R, MatrixXd::Zero(2, 2)),
+      X_nearby, 1e-8, MatrixCompareType::relative));
+}
+
+// Tests that the batched solves match the individual ones.
+GTEST_TEST(DARE, Batch) {
+  MatrixXd Q(2, 2), R(1, 1);
+  Q << 1, 0, 0, 1;
+  R << 1;
+  std::vector<MatrixXd> A, B;
+  for (int i = 0; i < 5; ++i) {
+    MatrixXd A_i(2, 2), B_i(2, 1);
+    A_i << 1, 0.1, 0.5 + 0.05 * i, 1;
+    B_i << 0, 0.1 + 0.01 * i;
+    A.push_back(A_i);
+    B.push_back(B_i);
+  }
+  for (int num_threads : {1, 2}) {
+    const std::vector<MatrixXd> X =
+        DiscreteAlgebraicRiccatiEquations(A, B, Q, R, num_threads);
+    ASSERT_EQ(X.size(), A.size());
+    for (size_t i = 0; i < A.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          X[i], DiscreteAlgebraicRiccatiEquation(A[i], B[i], Q, R), 1e-8,
+          MatrixCompareType::relative));
+    }
+  }
+  EXPECT_THROW(DiscreteAlgebraicRiccatiEquations(A, {}, Q, R),
+               std::runtime_error);
+}
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -0,0 +1,86 @@
+#include "drake/math/lyapunov_equation.h"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+using Eigen::MatrixXd;
+
+namespace drake {
+namespace math {
+namespace {
+
+const double kTolerance = 1e-10;
+
+void SolveContinuousAndVerify(const MatrixXd& A, const MatrixXd& Q) {
+  const MatrixXd X = RealContinuousLyapunovEquation(A, Q);
+  EXPECT_TRUE(CompareMatrices(X, X.transpose(), kTolerance,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(A.transpose() * X + X * A + Q,
+                              MatrixXd::Zero(A.rows(), A.cols()), kTolerance,
+                              MatrixCompareType::absolute));
+}
+
+void SolveDiscreteAndVerify(const MatrixXd& A, const MatrixXd& Q) {
+  const MatrixXd X = RealDiscreteLyapunovEquation(A, Q);
+  EXPECT_TRUE(CompareMatrices(X, X.transpose(), kTolerance,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(A.transpose() * X * A - X + Q,
+                              MatrixXd::Zero(A.rows(), A.cols()), kTolerance,
+                              MatrixCompareType::absolute));
+}
+
+GTEST_TEST(LyapunovEquation, Continuous) {
+  // A scalar, with the closed-form solution X = -Q / 2A.
+  MatrixXd A1(1, 1), Q1(1, 1);
+  A1 << -2;
+  Q1 << 3;
+  EXPECT_NEAR(RealContinuousLyapunovEquation(A1, Q1)(0, 0), 0.75, kTolerance);
+
+  // A damped oscillator, with complex eigenvalues.
+  MatrixXd A2(2, 2), Q2(2, 2);
+  A2 << 0, 1, -4, -0.5;
+  Q2 << 1, 0, 0, 2;
+  SolveContinuousAndVerify(A2, Q2);
+
+  // An unstable, non-normal A also has a unique solution.
+  MatrixXd A3(3, 3), Q3(3, 3);
+  A3 << 1, 2, 0, 0, -3, 1, 0, 0, 2;
+  Q3 << 2, 1, 0, 1, 2, 1, 0, 1, 2;
+  SolveContinuousAndVerify(A3, Q3);
+
+  // λ = ±1 sum to zero.
+  MatrixXd A4(2, 2);
+  A4 << 1, 0, 0, -1;
+  EXPECT_THROW(RealContinuousLyapunovEquation(A4, Q2), std::runtime_error);
+}
+
+GTEST_TEST(LyapunovEquation, Discrete) {
+  // A scalar, with the closed-form solution X = Q / (1 - A²).
+  MatrixXd A1(1, 1), Q1(1, 1);
+  A1 << 0.5;
+  Q1 << 3;
+  EXPECT_NEAR(RealDiscreteLyapunovEquation(A1, Q1)(0, 0), 4, kTolerance);
+
+  // A rotation, scaled into the unit circle.
+  MatrixXd A2(2, 2), Q2(2, 2);
+  A2 << 0.6, -0.7, 0.7, 0.6;
+  Q2 << 1, 0, 0, 2;
+  SolveDiscreteAndVerify(A2, Q2);
+
+  MatrixXd A3(3, 3), Q3(3, 3);
+  A3 << 0.5, 2, 0, 0, -0.3, 1, 0, 0, 1.5;
+  Q3 << 2, 1, 0, 1, 2, 1, 0, 1, 2;
+  SolveDiscreteAndVerify(A3, Q3);
+
+  // λ = 2 and λ = 0.5 multiply to one.
+  MatrixXd A4(2, 2);
+  A4 << 2, 1, 0, 0.5;
+  EXPECT_THROW(RealDiscreteLyapunovEquation(A4, Q2), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
@@ -0,0 +1,85 @@
+#include "drake/multibody/batch_kinematics_cache.h"
+
+#include "drake/common/drake_assert.h"
+
+template <typename T>
+constexpr int BatchKinematicsCache<T>::kPoseSize;
+
+template <typename T>
+BatchKinematicsCache<T>::BatchKinematicsCache(int num_bodies, int num_samples)
+    : num_samples_(num_samples), X_WB_(num_bodies) {
+  DRAKE_DEMAND(num_bodies >= 0);
+  DRAKE_DEMAND(num_samples >= 0);
+  for (PoseBatch& poses : X_WB_) poses.resize(num_samples, kPoseSize);
+}
+
+template <typename T>
+const typename BatchKinematicsCache<T>::PoseBatch&
+BatchKinematicsCache<T>::get_poses_in_world(int body_index) const {
+  DRAKE_DEMAND(body_index >= 0 && body_index < get_num_bodies());
+  return X_WB_[body_index];
+}
+
+template <typename T>
+drake::Isometry3<T> BatchKinematicsCache<T>::GetPose(const PoseBatch& poses,
+                                                     int sample) {
+  DRAKE_ASSERT(sample >= 0 && sample < poses.rows());
+  drake::Isometry3<T> X;
+  X.makeAffine();
+  for (int c = 0; c < 3; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      X.linear()(r, c) = poses(sample, 3 * c + r);
+    }
+  }
+  for (int r = 0; r < 3; ++r) {
+    X.translation()(r) = poses(sample, 9 + r);
+  }
+  return X;
+}
+
+template <typename T>
+void BatchKinematicsCache<T>::SetPose(const drake::Isometry3<T>& X,
+                                      int sample, PoseBatch* poses) {
+  DRAKE_ASSERT(poses != nullptr);
+  DRAKE_ASSERT(sample >= 0 && sample < poses->rows());
+  for (int c = 0; c < 3; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      (*poses)(sample, 3 * c + r) = X.linear()(r, c);
+    }
+  }
+  for (int r = 0; r < 3; ++r) {
+    (*poses)(sample, 9 + r) = X.translation()(r);
+  }
+}
+
+template <typename T>
+void BatchKinematicsCache<T>::ComposePoses(const PoseBatch& X_AB,
+                                           const PoseBatch& X_BC,
+                                           PoseBatch* X_AC) {
+  DRAKE_DEMAND(X_AC != nullptr && X_AC != &X_AB && X_AC != &X_BC);
+  DRAKE_DEMAND(X_AB.rows() == X_BC.rows());
+  X_AC->resize(X_AB.rows(), kPoseSize);
+  // Each column is a single pose component for all samples; R(r, c) is stored
+  // in column 3 * c + r. Every statement below is an element-wise operation
+  // over the samples.
+  auto R_AB = [&X_AB](int r, int c) { return X_AB.col(3 * c + r).array(); };
+  auto R_BC = [&X_BC](int r, int c) { return X_BC.col(3 * c + r).array(); };
+  // R_AC = R_AB * R_BC.
+  for (int c = 0; c < 3; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      X_AC->col(3 * c + r) = (R_AB(r, 0) * R_BC(0, c) +
+                              R_AB(r, 1) * R_BC(1, c) +
+                              R_AB(r, 2) * R_BC(2, c)).matrix();
+    }
+  }
+  // p_AC = p_AB + R_AB * p_BC.
+  for (int r = 0; r < 3; ++r) {
+    X_AC->col(9 + r) = (X_AB.col(9 + r).array() +
+                        R_AB(r, 0) * X_BC.col(9).array() +
+                        R_AB(r, 1) * X_BC.col(10).array() +
+                        R_AB(r, 2) * X_BC.col(11).array()).matrix();
+  }
+}
+
+// Explicitly instantiates on the supported scalar types.
+template class BatchKinematicsCache<double>;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+template <typename T>
+class RigidBodyTree;
+
+/// Stores the world poses of the bodies of a RigidBodyTree for a batch of N
+/// configurations, as computed by RigidBodyTree::doBatchKinematics().
+///
+/// The poses are stored as a structure of arrays. The poses of one body B for
+/// all N configurations are held in an N x 12 column-major matrix (a
+/// PoseBatch), so that each pose _component_ is stored contiguously across the
+/// samples: columns 0-8 hold the rotation matrix `R_WB` in column-major order
+/// and columns 9-11 hold the position `p_WB`. Row `k` is the pose for the
+/// configuration in column `k` of the batch's `q` matrix. With this layout,
+/// composing the poses of all samples reduces to element-wise operations on
+/// length-N columns, which Eigen vectorizes across the samples.
+///
+/// Only position kinematics are stored; there are no velocities, motion
+/// subspaces or Jacobians. Use a KinematicsCache for those.
+///
+/// @tparam T The scalar type. Only `double` is currently instantiated.
+template <typename T>
+class BatchKinematicsCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BatchKinematicsCache)
+
+  /// The number of pose components stored per sample.
+  static constexpr int kPoseSize = 12;
+
+  /// The poses of a single frame for all the samples of the batch.
+  using PoseBatch = Eigen::Matrix<T, Eigen::Dynamic, kPoseSize>;
+
+  /// Creates a cache for the given number of bodies and samples. Prefer
+  /// RigidBodyTree::CreateBatchKinematicsCache().
+  BatchKinematicsCache(int num_bodies, int num_samples);
+
+  int get_num_bodies() const { return static_cast<int>(X_WB_.size()); }
+
+  int get_num_samples() const { return num_samples_; }
+
+  /// Returns the poses `X_WB` in the world frame W of the body with index
+  /// @p body_index for all samples.
+  const PoseBatch& get_poses_in_world(int body_index) const;
+
+  /// Returns the pose `X_WB` in the world frame W of the body with index
+  /// @p body_index for the given @p sample.
+  drake::Isometry3<T> get_pose_in_world(int body_index, int sample) const {
+    return GetPose(get_poses_in_world(body_index), sample);
+  }
+
+  /// Returns the pose stored in row @p sample of @p poses.
+  static drake::Isometry3<T> GetPose(const PoseBatch& poses, int sample);
+
+  /// Stores @p X in row @p sample of @p poses.
+  static void SetPose(const drake::Isometry3<T>& X, int sample,
+                      PoseBatch* poses);
+
+  /// Computes `X_AC = X_AB * X_BC` for all the samples of the batches.
+  /// @p X_AC must not alias either input.
+  static void ComposePoses(const PoseBatch& X_AB, const PoseBatch& X_BC,
+                           PoseBatch* X_AC);
+
+ private:
+  // RigidBodyTree fills the poses.
+  friend class RigidBodyTree<T>;
+
+  int num_samples_{};
+  std::vector<PoseBatch> X_WB_;
+};
@@ -0,0 +1,611 @@
+// Times the multibody dynamics kernels of RigidBodyTree and MultibodyTree, so
+// that their run time can be tracked between releases. Run with --help for
+// options.
+//
+// Both trees model the 7-DOF KUKA iiwa arm of multibody/benchmarks/
+// kuka_iiwa_robot, and each kernel is timed with T = double and with
+// T = AutoDiffXd, whose derivatives are taken with respect to the state.
+// The kernels are:
+//  - kinematics: the position and velocity kinematics of all bodies.
+//  - mass_matrix: the mass matrix M(q).
+//  - inverse_dynamics: M(q) v̇ + C(q, v), without applied forces.
+//  - jacobian: the Jacobian of a point on the end effector, in the world.
+// MultibodyTree additionally times:
+//  - velocity_kinematics: the velocity kinematics alone.
+//  - inverse_dynamics_derivatives: the derivatives of inverse dynamics with
+//    respect to q, v and v̇.
+// The spatial algebra kernels time, over arrays of operands, the operators
+// that dominate the MultibodyTree recursions: the rigid shift of spatial
+// velocities and forces, the product of a spatial inertia with a spatial
+// velocity, and the composition of spatial accelerations.
+// The contact kernels only exist for RigidBodyTree with T = double (the
+// collision engine does not support AutoDiffXd, and MultibodyTree has no
+// collision queries of its own). They time, on a grid of floating spheres
+// that each overlap their neighbors:
+//  - collision_points: ComputeMaximumDepthCollisionPoints().
+//  - compliant_contact_force: CompliantContactModel::ComputeContactForce().
+// The generated code kernels compare both trees, with T = double, to the
+// closed-form dynamics of the arm that MotionGenesis generated (see
+// multibody/benchmarks/kuka_iiwa_robot/MG), on the same --num_states random
+// states, which each kernel cycles through. Every kernel starts from (q, v,
+// v̇) alone, so the kinematics of the trees are part of the time. They are:
+//  - inverse_dynamics: M(q) v̇ + C(q, v) − τ_g(q), i.e. with gravity.
+//  - mass_matrix: M(q). The generated code has no mass matrix of its own, so
+//    it computes M(q) column by column from its inverse dynamics without
+//    gravity, at v = 0.
+// Before timing, the results of the trees are checked against those of the
+// generated code on every state, and the ratio of the time of each tree to
+// that of the generated code is printed.
+//
+// With --json_output, the results are also written to the given file in the
+// JSON format of Google Benchmark, so that its comparison tools can be used
+// on the results of two releases.
+
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_stl_types.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/math/autodiff.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/MG/MG_kuka_iiwa_robot.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/joints/quaternion_floating_joint.h"
+#include "drake/multibody/multibody_tree/math/spatial_algebra.h"
+#include "drake/multibody/multibody_tree/multibody_tree.h"
+#include "drake/multibody/multibody_tree/spatial_inertia.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+#include "drake/multibody/rigid_body_plant/compliant_contact_model.h"
+#include "drake/multibody/rigid_body_tree.h"
+#include "drake/multibody/shapes/geometry.h"
+
+DEFINE_int32(iterations, 1000, "Number of timed evaluations of each kernel.");
+DEFINE_int32(num_spheres, 216, "Number of spheres of the contact scene.");
+DEFINE_int32(num_states, 64,
+             "Number of random arm states of the generated code kernels.");
+DEFINE_string(json_output, "",
+              "If not empty, the file to write the results to, as JSON.");
+
+namespace drake {
+namespace multibody {
+namespace benchmarks {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The timing of one kernel.
+struct Result {
+  std::string name;
+  int iterations{};
+  // Per evaluation, in nanoseconds.
+  double real_time{};
+  double cpu_time{};
+};
+
+// Evaluates `kernel` FLAGS_iterations times, prints the time per evaluation,
+// and appends it to `results`.
+void RunKernel(const std::string& name, const std::function<double()>& kernel,
+               std::vector<Result>* results) {
+  // Warm up, and keep the results alive so that nothing is optimized away.
+  double sink = kernel();
+  const std::clock_t cpu_start = std::clock();
+  const Clock::time_point start = Clock::now();
+  for (int i = 0; i < FLAGS_iterations; ++i) {
+    sink += kernel();
+  }
+  const double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  const double cpu_seconds =
+      static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+  Result result;
+  result.name = name;
+  result.iterations = FLAGS_iterations;
+  result.real_time = seconds / FLAGS_iterations * 1e9;
+  result.cpu_time = cpu_seconds / FLAGS_iterations * 1e9;
+  results->push_back(result);
+  std::cout << "  " << name << ": " << result.real_time / 1e3 << " us/eval"
+            << (std::isnan(sink) ? " (nan)" : "") << "\n";
+}
+
+// Writes `results` to `filename` in the JSON format of Google Benchmark.
+void WriteJson(const std::string& filename, const char* executable,
+               const std::vector<Result>& results) {
+  std::ofstream out(filename);
+  if (!out) {
+    throw std::runtime_error("Could not open " + filename);
+  }
+  out << "{\n"
+      << "  \"context\": {\n"
+      << "    \"executable\": \"" << executable << "\",\n"
+#ifdef NDEBUG
+      << "    \"library_build_type\": \"release\"\n"
+#else
+      << "    \"library_build_type\": \"debug\"\n"
+#endif
+      << "  },\n"
+      << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    out << (i == 0 ? "\n" : ",\n")
+        << "    {\n"
+        << "      \"name\": \"" << result.name << "\",\n"
+        << "      \"run_name\": \"" << result.name << "\",\n"
+        << "      \"run_type\": \"iteration\",\n"
+        << "      \"iterations\": " << result.iterations << ",\n"
+        << "      \"real_time\": " << result.real_time << ",\n"
+        << "      \"cpu_time\": " << result.cpu_time << ",\n"
+        << "      \"time_unit\": \"ns\"\n"
+        << "    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+// Returns `x` as a vector of T; for AutoDiffXd, the derivatives are the
+// identity, i.e., they are taken with respect to `x` itself.
+template <typename T>
+VectorX<T> MakeVariables(const Eigen::VectorXd& x);
+
+template <>
+VectorX<double> MakeVariables<double>(const Eigen::VectorXd& x) {
+  return x;
+}
+
+template <>
+VectorX<AutoDiffXd> MakeVariables<AutoDiffXd>(const Eigen::VectorXd& x) {
+  return math::initializeAutoDiff(x);
+}
+
+// The number of revolute joints of the arm.
+const int kNumJoints = 7;
+
+// An arbitrary, non-singular state [q; v] and acceleration v̇ of the arm.
+Eigen::VectorXd MakeArmState() {
+  Eigen::VectorXd x(2 * kNumJoints);
+  for (int i = 0; i < 2 * kNumJoints; ++i) {
+    x(i) = std::sin(1.0 + i);
+  }
+  return x;
+}
+
+Eigen::VectorXd MakeArmAcceleration() {
+  Eigen::VectorXd vdot(kNumJoints);
+  for (int i = 0; i < kNumJoints; ++i) {
+    vdot(i) = std::cos(1.0 + i);
+  }
+  return vdot;
+}
+
+// The point on the end effector whose Jacobian is timed, in the end effector
+// frame.
+const Eigen::Vector3d kEndEffectorPoint(0.1, 0.05, 0.2);
+
+template <typename T>
+void RunRigidBodyTreeKernels(const std::string& scalar,
+                             std::vector<Result>* results) {
+  RigidBodyTree<double> tree;
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      FindResourceOrThrow(
+          "drake/multibody/benchmarks/kuka_iiwa_robot/kuka_iiwa_robot.urdf"),
+      joints::kFixed, &tree);
+  DRAKE_DEMAND(tree.get_num_positions() == kNumJoints);
+  DRAKE_DEMAND(tree.get_num_velocities() == kNumJoints);
+  const int end_effector = tree.FindBody("iiwa_link_7")->get_body_index();
+
+  const VectorX<T> x = MakeVariables<T>(MakeArmState());
+  const VectorX<T> q = x.head(kNumJoints);
+  const VectorX<T> v = x.tail(kNumJoints);
+  const VectorX<T> vdot = MakeArmAcceleration().cast<T>();
+  const Vector3<T> p_EP = kEndEffectorPoint.cast<T>();
+  const eigen_aligned_std_unordered_map<const ::RigidBody<double>*,
+                                        WrenchVector<T>>
+      no_external_wrenches;
+
+  const std::string prefix = "RigidBodyTree/" + scalar + "/";
+  std::cout << "RigidBodyTree<double>, KinematicsCache<" << scalar << ">\n";
+
+  RunKernel(prefix + "kinematics", [&]() {
+    const KinematicsCache<T> cache = tree.doKinematics(q, v);
+    return ExtractDoubleOrThrow(
+        cache.get_element(end_effector).transform_to_world(0, 3));
+  }, results);
+
+  KinematicsCache<T> cache = tree.doKinematics(q, v);
+
+  RunKernel(prefix + "mass_matrix", [&]() {
+    return ExtractDoubleOrThrow(tree.massMatrix(cache)(0, 0));
+  }, results);
+
+  RunKernel(prefix + "inverse_dynamics", [&]() {
+    return ExtractDoubleOrThrow(
+        tree.inverseDynamics(cache, no_external_wrenches, vdot)(0));
+  }, results);
+
+  RunKernel(prefix + "jacobian", [&]() {
+    return ExtractDoubleOrThrow(
+        tree.transformPointsJacobian(cache, p_EP, end_effector, 0, false)(
+            0, 0));
+  }, results);
+}
+
+template <typename T>
+void RunMultibodyTreeKernels(const std::string& scalar,
+                             std::vector<Result>* results) {
+  const std::unique_ptr<MultibodyTree<T>> model =
+      kuka_iiwa_robot::MakeKukaIiwaModel<T>();
+  DRAKE_DEMAND(model->num_positions() == kNumJoints);
+  DRAKE_DEMAND(model->num_velocities() == kNumJoints);
+  const Body<T>& end_effector = model->GetBodyByName("iiwa_link_7");
+
+  std::unique_ptr<systems::Context<T>> context = model->CreateDefaultContext();
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      MakeVariables<T>(MakeArmState()));
+  const VectorX<T> vdot = MakeArmAcceleration().cast<T>();
+  const MatrixX<T> p_EP = kEndEffectorPoint.cast<T>();
+
+  const std::string prefix = "MultibodyTree/" + scalar + "/";
+  std::cout << "MultibodyTree<" << scalar << ">\n";
+
+  PositionKinematicsCache<T> pc(model->get_topology());
+  VelocityKinematicsCache<T> vc(model->get_topology());
+  RunKernel(prefix + "kinematics", [&]() {
+    model->CalcPositionKinematicsCache(*context, &pc);
+    model->CalcVelocityKinematicsCache(*context, pc, &vc);
+    return ExtractDoubleOrThrow(
+        pc.get_X_WB(end_effector.node_index()).translation()(0));
+  }, results);
+
+  RunKernel(prefix + "velocity_kinematics", [&]() {
+    model->CalcVelocityKinematicsCache(*context, pc, &vc);
+    return ExtractDoubleOrThrow(
+        vc.get_V_WB(end_effector.node_index()).translational()(0));
+  }, results);
+
+  MatrixX<T> M(kNumJoints, kNumJoints);
+  RunKernel(prefix + "mass_matrix", [&]() {
+    model->CalcMassMatrixViaInverseDynamics(*context, &M);
+    return ExtractDoubleOrThrow(M(0, 0));
+  }, results);
+
+  const int num_bodies = model->num_bodies();
+  const std::vector<SpatialForce<T>> F_applied(
+      num_bodies, SpatialForce<T>::Zero());
+  const VectorX<T> tau_applied = VectorX<T>::Zero(kNumJoints);
+  std::vector<SpatialAcceleration<T>> A_WB(num_bodies);
+  std::vector<SpatialForce<T>> F_BMo_W(num_bodies);
+  VectorX<T> tau(kNumJoints);
+  RunKernel(prefix + "inverse_dynamics", [&]() {
+    model->CalcInverseDynamics(*context, pc, vc, vdot, F_applied, tau_applied,
+                               &A_WB, &F_BMo_W, &tau);
+    return ExtractDoubleOrThrow(tau(0));
+  }, results);
+
+  MatrixX<T> dtau_dq(kNumJoints, kNumJoints);
+  MatrixX<T> dtau_dv(kNumJoints, kNumJoints);
+  RunKernel(prefix + "inverse_dynamics_derivatives", [&]() {
+    model->CalcInverseDynamicsDerivatives(*context, pc, vc, vdot,
+                                          &dtau_dq, &dtau_dv, &M);
+    return ExtractDoubleOrThrow(dtau_dq(0, 0));
+  }, results);
+
+  MatrixX<T> p_WP(3, 1);
+  MatrixX<T> J_WP(3, kNumJoints);
+  RunKernel(prefix + "jacobian", [&]() {
+    model->CalcPointsGeometricJacobianExpressedInWorld(
+        *context, end_effector.body_frame(), p_EP, &p_WP, &J_WP);
+    return ExtractDoubleOrThrow(J_WP(0, 0));
+  }, results);
+}
+
+template <typename T>
+void RunSpatialAlgebraKernels(const std::string& scalar,
+                              std::vector<Result>* results) {
+  // Arbitrary operands, with the magnitudes of a robot arm.
+  const int kNumOperands = 64;
+  std::vector<Vector3<T>> p(kNumOperands);
+  std::vector<Vector3<T>> w(kNumOperands);
+  std::vector<SpatialVelocity<T>> V(kNumOperands);
+  std::vector<SpatialForce<T>> F(kNumOperands);
+  std::vector<SpatialAcceleration<T>> A(kNumOperands);
+  std::vector<SpatialInertia<T>> M;
+  for (int i = 0; i < kNumOperands; ++i) {
+    p[i] = Vector3<T>(0.1 * i, -0.2, 0.05 * (i % 7));
+    w[i] = Vector3<T>(1.0, -0.5 * (i % 3), 0.3);
+    V[i] = SpatialVelocity<T>(w[i], Vector3<T>(0.2, 0.1 * i, -0.4));
+    F[i] = SpatialForce<T>(Vector3<T>(0.5, 0.3, -0.1 * i), w[i]);
+    A[i] = SpatialAcceleration<T>(Vector3<T>(-0.3, 0.2, 0.1 * (i % 5)), w[i]);
+    M.push_back(SpatialInertia<T>::MakeFromCentralInertia(
+        1.0 + 0.1 * i, p[i], RotationalInertia<T>(0.2, 0.3, 0.4)));
+  }
+
+  const std::string prefix = "SpatialAlgebra/" + scalar + "/";
+  std::cout << "SpatialAlgebra<" << scalar << ">\n";
+
+  RunKernel(prefix + "velocity_shift", [&]() {
+    T sum(0.0);
+    for (int i = 0; i < kNumOperands; ++i) sum += V[i].Shift(p[i])[3];
+    return ExtractDoubleOrThrow(sum);
+  }, results);
+
+  RunKernel(prefix + "force_shift", [&]() {
+    T sum(0.0);
+    for (int i = 0; i < kNumOperands; ++i) sum += F[i].Shift(p[i])[0];
+    return ExtractDoubleOrThrow(sum);
+  }, results);
+
+  RunKernel(prefix + "inertia_times_velocity", [&]() {
+    T sum(0.0);
+    for (int i = 0; i < kNumOperands; ++i) sum += (M[i] * V[i])[0];
+    return ExtractDoubleOrThrow(sum);
+  }, results);
+
+  RunKernel(prefix + "compose_acceleration", [&]() {
+    T sum(0.0);
+    for (int i = 0; i < kNumOperands; ++i) {
+      const int j = (i + 1) % kNumOperands;
+      sum += A[i].ComposeWithMovingFrameAcceleration(
+          p[i], w[i], V[j], A[j])[3];
+    }
+    return ExtractDoubleOrThrow(sum);
+  }, results);
+}
+
+// Returns a tree of FLAGS_num_spheres floating spheres on a cubic grid, each
+// of which overlaps its six neighbors, like parts piled in a bin.
+std::unique_ptr<RigidBodyTree<double>> MakeSphereGrid() {
+  auto tree = std::make_unique<RigidBodyTree<double>>();
+  const int side =
+      static_cast<int>(std::ceil(std::cbrt(FLAGS_num_spheres)));
+  // Spheres of radius 0.6 on a unit grid overlap only their face neighbors.
+  const DrakeShapes::Sphere sphere(0.6);
+  for (int i = 0; i < FLAGS_num_spheres; ++i) {
+    auto body = std::make_unique<::RigidBody<double>>();
+    body->set_name("sphere" + std::to_string(i));
+    body->set_mass(1.0);
+    body->set_spatial_inertia(Matrix6<double>::Identity());
+    Eigen::Isometry3d X_WB = Eigen::Isometry3d::Identity();
+    X_WB.translation() << i % side, (i / side) % side, i / (side * side);
+    body->add_joint(&tree->world(),
+                    std::make_unique<QuaternionFloatingJoint>("base", X_WB));
+    ::RigidBody<double>* added = tree->add_rigid_body(std::move(body));
+    collision::Element element(sphere);
+    element.set_body(added);
+    tree->addCollisionElement(element, *added, "spheres");
+  }
+  tree->compile();
+  return tree;
+}
+
+void RunContactKernels(std::vector<Result>* results) {
+  std::unique_ptr<RigidBodyTree<double>> tree = MakeSphereGrid();
+  const Eigen::VectorXd q = tree->getZeroConfiguration();
+  const Eigen::VectorXd v = Eigen::VectorXd::Zero(tree->get_num_velocities());
+  const KinematicsCache<double> cache = tree->doKinematics(q, v);
+  const systems::CompliantContactModel<double> contact_model;
+
+  const int num_contacts = static_cast<int>(
+      tree->ComputeMaximumDepthCollisionPoints(cache, true, false).size());
+  std::cout << "RigidBodyTree<double>, " << FLAGS_num_spheres << " spheres, "
+            << num_contacts << " contacts\n";
+
+  RunKernel("RigidBodyTree/double/collision_points", [&]() {
+    return static_cast<double>(
+        tree->ComputeMaximumDepthCollisionPoints(cache, true, false).size());
+  }, results);
+
+  RunKernel("RigidBodyTree/double/compliant_contact_force", [&]() {
+    return contact_model.ComputeContactForce(*tree, cache)(0);
+  }, results);
+}
+
+// An implementation of the dynamics of the arm, as functions of the state
+// [q; v; v̇] that is stacked in `x`.
+struct ArmDynamics {
+  std::string name;
+  std::function<Eigen::VectorXd(const Eigen::VectorXd& x)> inverse_dynamics;
+  std::function<Eigen::MatrixXd(const Eigen::VectorXd& x)> mass_matrix;
+};
+
+// Returns FLAGS_num_states random states [q; v; v̇] of the arm, the same on
+// every run.
+std::vector<Eigen::VectorXd> MakeRandomArmStates() {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-M_PI, M_PI);
+  std::vector<Eigen::VectorXd> states(FLAGS_num_states);
+  for (Eigen::VectorXd& x : states) {
+    x.resize(3 * kNumJoints);
+    for (int i = 0; i < x.size(); ++i) {
+      x(i) = distribution(generator);
+    }
+  }
+  return states;
+}
+
+void RunGeneratedCodeKernels(std::vector<Result>* results) {
+  const double kGravity = 9.81;
+  const std::vector<Eigen::VectorXd> states = MakeRandomArmStates();
+  auto q_of = [](const Eigen::VectorXd& x) { return x.head(kNumJoints); };
+  auto v_of = [](const Eigen::VectorXd& x) {
+    return x.segment(kNumJoints, kNumJoints);
+  };
+  auto vdot_of = [](const Eigen::VectorXd& x) { return x.tail(kNumJoints); };
+
+  const kuka_iiwa_robot::MG::MGKukaIIwaRobot<double> generated(kGravity);
+  const kuka_iiwa_robot::MG::MGKukaIIwaRobot<double> generated_no_gravity(0.0);
+  const Eigen::VectorXd zero = Eigen::VectorXd::Zero(kNumJoints);
+  const Eigen::MatrixXd identity =
+      Eigen::MatrixXd::Identity(kNumJoints, kNumJoints);
+  ArmDynamics generated_dynamics{
+      "MotionGenesis",
+      [&](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+        return generated.CalcRevoluteMotorZTorques(q_of(x), v_of(x),
+                                                   vdot_of(x));
+      },
+      [&](const Eigen::VectorXd& x) {
+        Eigen::MatrixXd M(kNumJoints, kNumJoints);
+        for (int i = 0; i < kNumJoints; ++i) {
+          M.col(i) = generated_no_gravity.CalcRevoluteMotorZTorques(
+              q_of(x), zero, identity.col(i));
+        }
+        return M;
+      }};
+
+  RigidBodyTree<double> tree;
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      FindResourceOrThrow(
+          "drake/multibody/benchmarks/kuka_iiwa_robot/kuka_iiwa_robot.urdf"),
+      joints::kFixed, &tree);
+  DRAKE_DEMAND(tree.get_num_positions() == kNumJoints);
+  DRAKE_DEMAND(tree.a_grav(5) == -kGravity);
+  const RigidBodyTree<double>::BodyToWrenchMap no_external_wrenches;
+  ArmDynamics rigid_body_tree_dynamics{
+      "RigidBodyTree",
+      [&](const Eigen::VectorXd& x) {
+        KinematicsCache<double> cache =
+            tree.doKinematics(Eigen::VectorXd(q_of(x)),
+                              Eigen::VectorXd(v_of(x)));
+        return tree.inverseDynamics(cache, no_external_wrenches,
+                                    Eigen::VectorXd(vdot_of(x)));
+      },
+      [&](const Eigen::VectorXd& x) {
+        KinematicsCache<double> cache =
+            tree.doKinematics(Eigen::VectorXd(q_of(x)));
+        return tree.massMatrix(cache);
+      }};
+
+  const std::unique_ptr<MultibodyTree<double>> model =
+      kuka_iiwa_robot::MakeKukaIiwaModel<double>(true, kGravity);
+  DRAKE_DEMAND(model->num_positions() == kNumJoints);
+  std::unique_ptr<systems::Context<double>> context =
+      model->CreateDefaultContext();
+  PositionKinematicsCache<double> pc(model->get_topology());
+  VelocityKinematicsCache<double> vc(model->get_topology());
+  MultibodyForces<double> forces(*model);
+  std::vector<SpatialAcceleration<double>> A_WB(model->num_bodies());
+  std::vector<SpatialForce<double>> F_BMo_W(model->num_bodies());
+  ArmDynamics multibody_tree_dynamics{
+      "MultibodyTree",
+      [&](const Eigen::VectorXd& x) {
+        context->get_mutable_continuous_state_vector().SetFromVector(
+            x.head(2 * kNumJoints));
+        model->CalcPositionKinematicsCache(*context, &pc);
+        model->CalcVelocityKinematicsCache(*context, pc, &vc);
+        model->CalcForceElementsContribution(*context, pc, vc, &forces);
+        Eigen::VectorXd tau(kNumJoints);
+        model->CalcInverseDynamics(*context, pc, vc, vdot_of(x),
+                                   forces.body_forces(),
+                                   forces.generalized_forces(), &A_WB,
+                                   &F_BMo_W, &tau);
+        return tau;
+      },
+      [&](const Eigen::VectorXd& x) {
+        context->get_mutable_continuous_state_vector().SetFromVector(
+            x.head(2 * kNumJoints));
+        Eigen::MatrixXd M(kNumJoints, kNumJoints);
+        model->CalcMassMatrixViaInverseDynamics(*context, &M);
+        return M;
+      }};
+
+  std::cout << "Generated code, " << states.size() << " random states\n";
+
+  // Checks that the trees agree with the generated code on every state.
+  const double kTolerance = 1e-10;
+  for (const ArmDynamics* dynamics :
+       {&rigid_body_tree_dynamics, &multibody_tree_dynamics}) {
+    double tau_error = 0;
+    double M_error = 0;
+    for (const Eigen::VectorXd& x : states) {
+      const Eigen::VectorXd tau = generated_dynamics.inverse_dynamics(x);
+      const Eigen::MatrixXd M = generated_dynamics.mass_matrix(x);
+      tau_error = std::max(
+          tau_error,
+          (dynamics->inverse_dynamics(x) - tau).lpNorm<Eigen::Infinity>() /
+              std::max(1.0, tau.lpNorm<Eigen::Infinity>()));
+      M_error = std::max(
+          M_error, (dynamics->mass_matrix(x) - M).lpNorm<Eigen::Infinity>() /
+                       std::max(1.0, M.lpNorm<Eigen::Infinity>()));
+    }
+    std::cout << "  " << dynamics->name
+              << " relative error: inverse_dynamics " << tau_error
+              << ", mass_matrix " << M_error << "\n";
+    DRAKE_DEMAND(tau_error < kTolerance);
+    DRAKE_DEMAND(M_error < kTolerance);
+  }
+
+  // Times each kernel, and reports its time relative to the generated code.
+  for (const bool mass_matrix : {false, true}) {
+    const std::string kernel =
+        mass_matrix ? "mass_matrix" : "inverse_dynamics";
+    double generated_time{};
+    for (const ArmDynamics* dynamics :
+         {&generated_dynamics, &rigid_body_tree_dynamics,
+          &multibody_tree_dynamics}) {
+      size_t k = 0;
+      RunKernel("Generated/" + dynamics->name + "/" + kernel, [&]() {
+        const Eigen::VectorXd& x = states[k++ % states.size()];
+        return mass_matrix ? dynamics->mass_matrix(x)(0, 0)
+                           : dynamics->inverse_dynamics(x)(0);
+      }, results);
+      if (dynamics == &generated_dynamics) {
+        generated_time = results->back().real_time;
+      } else {
+        std::cout << "    " << results->back().real_time / generated_time
+                  << "x the generated code\n";
+      }
+    }
+  }
+}
+
+int do_main(const char* executable) {
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+  DRAKE_DEMAND(FLAGS_num_spheres >= 1);
+  DRAKE_DEMAND(FLAGS_num_states >= 1);
+
+  std::vector<Result> results;
+  RunRigidBodyTreeKernels<double>("double", &results);
+  RunRigidBodyTreeKernels<AutoDiffXd>("AutoDiffXd", &results);
+  RunMultibodyTreeKernels<double>("double", &results);
+  RunMultibodyTreeKernels<AutoDiffXd>("AutoDiffXd", &results);
+  RunSpatialAlgebraKernels<double>("double", &results);
+  RunSpatialAlgebraKernels<AutoDiffXd>("AutoDiffXd", &results);
+  RunContactKernels(&results);
+  RunGeneratedCodeKernels(&results);
+
+  if (!FLAGS_json_output.empty()) {
+    WriteJson(FLAGS_json_output, executable, results);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the kinematics, mass matrix, inverse dynamics, Jacobian and "
+      "contact kernels of RigidBodyTree and MultibodyTree, and the spatial "
+      "algebra operators of MultibodyTree, and compares the trees to "
+      "generated closed-form dynamics of the KUKA iiwa arm.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::multibody::benchmarks::do_main(argv[0]);
+}
@@ -1,12 +1,15 @@
 #include "drake/multibody/collision/bullet_model.h"
 
+#include <exception>
 #include <iostream>
 #include <limits>
 #include <utility>
 
+#include "BulletCollision/BroadphaseCollision/btCollisionAlgorithm.h"
 #include "BulletCollision/NarrowPhaseCollision/btRaycastCallback.h"
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
 #include "drake/multibody/collision/drake_collision.h"
@@ -93,14 +96,88 @@ bool OverlapFilterCallback::needBroadphaseCollision(
   return collides;
 }
 
+ContactReuseDispatcher::ContactReuseDispatcher(
+    btCollisionConfiguration* configuration)
+    : btCollisionDispatcher(configuration) {
+  setNearCallback(&ContactReuseDispatcher::NearCallback);
+}
+
+void ContactReuseDispatcher::NearCallback(btBroadphasePair& pair,
+                                          btCollisionDispatcher& dispatcher,
+                                          const btDispatcherInfo& info) {
+  ContactReuseDispatcher& self =
+      static_cast<ContactReuseDispatcher&>(dispatcher);
+  const auto bt_obj0 =
+      static_cast<const btCollisionObject*>(pair.m_pProxy0->m_clientObject);
+  const auto bt_obj1 =
+      static_cast<const btCollisionObject*>(pair.m_pProxy1->m_clientObject);
+  const auto element0 = static_cast<const Element*>(bt_obj0->getUserPointer());
+  const auto element1 = static_cast<const Element*>(bt_obj1->getUserPointer());
+  if (self.tolerance_ == 0 || element0 == nullptr || element1 == nullptr) {
+    defaultNearCallback(pair, dispatcher, info);
+    return;
+  }
+  const Element* element_a =
+      (element0->getId() < element1->getId()) ? element0 : element1;
+  const Element* element_b = (element_a == element0) ? element1 : element0;
+  const ElementIdPair key(element_a->getId(), element_b->getId());
+
+  // The algorithm of a pair, and with it its manifolds, only exist once the
+  // pair has been dispatched.
+  btManifoldArray manifolds;
+  if (pair.m_algorithm != nullptr) {
+    pair.m_algorithm->getAllContactManifolds(manifolds);
+  }
+
+  // Reuse the contact points if there are any and each of them has moved by
+  // no more than the tolerance with its element.
+  const auto reference = self.reference_poses_.find(key);
+  if (reference != self.reference_poses_.end()) {
+    const Isometry3d X_AoldAnew =
+        element_a->getWorldTransform() * reference->second.X_WA.inverse();
+    const Isometry3d X_BoldBnew =
+        element_b->getWorldTransform() * reference->second.X_WB.inverse();
+    const auto moved_by = [](const Isometry3d& X, const btVector3& p_W) {
+      const Vector3d p = toVector3d(p_W);
+      return (X * p - p).norm();
+    };
+    int num_points = 0;
+    bool reusable = true;
+    for (int i = 0; i < manifolds.size() && reusable; ++i) {
+      const btPersistentManifold* manifold = manifolds[i];
+      const bool body0_is_a = (manifold->getBody0()->getUserPointer() ==
+                               static_cast<const void*>(element_a));
+      const Isometry3d& X_0 = body0_is_a ? X_AoldAnew : X_BoldBnew;
+      const Isometry3d& X_1 = body0_is_a ? X_BoldBnew : X_AoldAnew;
+      for (int j = 0; j < manifold->getNumContacts() && reusable; ++j) {
+        const btManifoldPoint& point = manifold->getContactPoint(j);
+        reusable =
+            moved_by(X_0, point.getPositionWorldOnA()) <= self.tolerance_ &&
+            moved_by(X_1, point.getPositionWorldOnB()) <= self.tolerance_;
+        ++num_points;
+      }
+    }
+    if (reusable && num_points > 0) return;
+  }
+
+  // Otherwise compute the contact points from scratch, as
+  // BulletModel::ClearCachedResults() would have.
+  for (int i = 0; i < manifolds.size(); ++i) {
+    manifolds[i]->clearManifold();
+  }
+  defaultNearCallback(pair, dispatcher, info);
+  self.reference_poses_[key] = ReferencePoses{element_a->getWorldTransform(),
+                                              element_b->getWorldTransform()};
+}
+
 BulletCollisionWorldWrapper::BulletCollisionWorldWrapper()
     : bt_collision_configuration(),
       bt_collision_broadphase(),
       filter_callback() {
   bt_collision_configuration.setConvexConvexMultipointIterations(0, 0);
   bt_collision_configuration.setPlaneConvexMultipointIterations(0, 0);
-  bt_collision_dispatcher = std::unique_ptr<btCollisionDispatcher>(
-      new btCollisionDispatcher(&bt_collision_configuration));
+  bt_collision_dispatcher = std::unique_ptr<ContactReuseDispatcher>(
+      new ContactReuseDispatcher(&bt_collision_configuration));
   bt_collision_world = std::unique_ptr<btCollisionWorld>(new btCollisionWorld(
       bt_collision_dispatcher.get(), &bt_collision_broadphase,
       &bt_collision_configuration));
@@ -399,6 +476,7 @@ void BulletModel::DoRemoveElement(ElementId id) {
       world->bt_collision_world->removeCollisionObject(itr->second.get());
       world->bt_collision_objects.erase(itr);
     }
+    world->bt_collision_dispatcher->Reset();
   }
 }
 
@@ -497,28 +575,33 @@ void BulletModel::UpdateModel() {
 
 PointPair<double> BulletModel::findClosestPointsBetweenElements(
     ElementId idA, ElementId idB, bool use_margins) {
+  // Only const lookups are made, so that ClosestPointsPairwise() can process
+  // several pairs concurrently.
+  const Element& element_A = *elements.at(idA);
+  const Element& element_B = *elements.at(idB);
+
   // special case: two spheres (because we need to handle the zero-radius sphere
   // case)
-  if (elements[idA]->getShape() == DrakeShapes::SPHERE &&
-      elements[idB]->getShape() == DrakeShapes::SPHERE) {
-    const Isometry3d& TA_world = elements[idA]->getWorldTransform();
-    const Isometry3d& TB_world = elements[idB]->getWorldTransform();
+  if (element_A.getShape() == DrakeShapes::SPHERE &&
+      element_B.getShape() == DrakeShapes::SPHERE) {
+    const Isometry3d& TA_world = element_A.getWorldTransform();
+    const Isometry3d& TB_world = element_B.getWorldTransform();
     auto xA_world = TA_world.translation();
     auto xB_world = TB_world.translation();
     double radiusA =
-        dynamic_cast<const DrakeShapes::Sphere&>(elements[idA]->getGeometry())
+        dynamic_cast<const DrakeShapes::Sphere&>(element_A.getGeometry())
             .radius;
     double radiusB =
-        dynamic_cast<const DrakeShapes::Sphere&>(elements[idB]->getGeometry())
+        dynamic_cast<const DrakeShapes::Sphere&>(element_B.getGeometry())
             .radius;
     double distance = (xA_world - xB_world).norm();
     return PointPair<double>(
-        elements[idA].get(), elements[idB].get(),
-        elements[idA]->getLocalTransform() * TA_world.inverse() *
+        &element_A, &element_B,
+        element_A.getLocalTransform() * TA_world.inverse() *
             (xA_world +
              (xB_world - xA_world) * radiusA /
                  distance),  // ptA (in body A coords)
-        elements[idB]->getLocalTransform() * TB_world.inverse() *
+        element_B.getLocalTransform() * TB_world.inverse() *
             (xB_world +
              (xA_world - xB_world) * radiusB /
                  distance),  // ptB (in body B coords)
@@ -568,9 +651,9 @@ PointPair<double> BulletModel::findClosestPointsBetweenElements(
 
   btVector3 pointOnAinWorld;
   btVector3 pointOnBinWorld;
-  if (elements[idA]->getShape() == DrakeShapes::MESH ||
-      elements[idA]->getShape() == DrakeShapes::MESH_POINTS ||
-      elements[idA]->getShape() == DrakeShapes::BOX) {
+  if (element_A.getShape() == DrakeShapes::MESH ||
+      element_A.getShape() == DrakeShapes::MESH_POINTS ||
+      element_A.getShape() == DrakeShapes::BOX) {
     pointOnAinWorld = gjkOutput.m_pointInWorld +
                       gjkOutput.m_normalOnBInWorld *
                           (gjkOutput.m_distance + shapeA->getMargin());
@@ -578,9 +661,9 @@ PointPair<double> BulletModel::findClosestPointsBetweenElements(
     pointOnAinWorld = gjkOutput.m_pointInWorld +
                       gjkOutput.m_normalOnBInWorld * gjkOutput.m_distance;
   }
-  if (elements[idB]->getShape() == DrakeShapes::MESH ||
-      elements[idB]->getShape() == DrakeShapes::MESH_POINTS ||
-      elements[idB]->getShape() == DrakeShapes::BOX) {
+  if (element_B.getShape() == DrakeShapes::MESH ||
+      element_B.getShape() == DrakeShapes::MESH_POINTS ||
+      element_B.getShape() == DrakeShapes::BOX) {
     pointOnBinWorld = gjkOutput.m_pointInWorld -
                       gjkOutput.m_normalOnBInWorld * shapeB->getMargin();
   } else {
@@ -591,15 +674,15 @@ PointPair<double> BulletModel::findClosestPointsBetweenElements(
   btVector3 point_on_elemB = input.m_transformB.invXform(pointOnBinWorld);
 
   auto point_on_A =
-      elements[idA]->getLocalTransform() * toVector3d(point_on_elemA);
+      element_A.getLocalTransform() * toVector3d(point_on_elemA);
   auto point_on_B =
-      elements[idB]->getLocalTransform() * toVector3d(point_on_elemB);
+      element_B.getLocalTransform() * toVector3d(point_on_elemB);
 
   btScalar distance =
       gjkOutput.m_normalOnBInWorld.dot(pointOnAinWorld - pointOnBinWorld);
 
   if (gjkOutput.m_hasResult) {
-    return PointPair<double>(elements[idA].get(), elements[idB].get(),
+    return PointPair<double>(&element_A, &element_B,
                      point_on_A, point_on_B,
                      toVector3d(gjkOutput.m_normalOnBInWorld),
                      static_cast<double>(distance));
@@ -618,15 +701,17 @@ void BulletModel::CollisionDetectFromPoints(
   closest_points->resize(points.cols());
   VectorXd phi(points.cols());
 
-  btSphereShape shapeA(0.0);
-  btConvexShape* shapeB;
-  btGjkPairDetector::ClosestPointInput input;
-
   BulletCollisionWorldWrapper& bt_world = getBulletWorld(use_margins);
 
-  // do collision check against all bodies for each point using bullet's
-  // internal getclosestpoints solver
-  for (int i = 0; i < points.cols(); i++) {
+  // Each point is queried independently, into its own slot, so the points are
+  // divided among the threads.
+  ParallelFor(static_cast<int>(points.cols()), num_threads(), [&](int i) {
+    btSphereShape shapeA(0.0);
+    btConvexShape* shapeB;
+    btGjkPairDetector::ClosestPointInput input;
+
+    // do collision check against all bodies for each point using bullet's
+    // internal getclosestpoints solver
     bool got_one = false;
     for (auto bt_objB_iter = bt_world.bt_collision_objects.begin();
          bt_objB_iter != bt_world.bt_collision_objects.end(); bt_objB_iter++) {
@@ -692,7 +777,7 @@ void BulletModel::CollisionDetectFromPoints(
       closest_points->at(i).ptA = inf_vector;
       closest_points->at(i).ptB = inf_vector;
     }
-  }
+  });
 }
 
 bool BulletModel::CollisionRaycast(const Matrix3Xd& origins,
@@ -807,12 +892,29 @@ bool BulletModel::ClosestPointsPairwise(
     std::vector<PointPair<double>>* closest_points) {
   DRAKE_DEMAND(closest_points != nullptr);
   closest_points->clear();
-  for (const ElementIdPair& pair : id_pairs) {
+  // Each pair is processed independently, into its own slot; the slots are
+  // then merged in the order of the pairs, so that the results (and any
+  // warnings or exceptions) do not depend on the number of threads.
+  const int num_pairs = static_cast<int>(id_pairs.size());
+  std::vector<PointPair<double>> pair_results(num_pairs);
+  std::vector<std::exception_ptr> pair_errors(num_pairs);
+  ParallelFor(num_pairs, num_threads(), [&](int i) {
     try {
-      closest_points->push_back(findClosestPointsBetweenElements(
-          pair.first, pair.second, use_margins));
-    } catch (std::logic_error& e) {
-      drake::log()->warn(e.what());
+      pair_results[i] = findClosestPointsBetweenElements(
+          id_pairs[i].first, id_pairs[i].second, use_margins);
+    } catch (...) {
+      pair_errors[i] = std::current_exception();
+    }
+  });
+  for (int i = 0; i < num_pairs; ++i) {
+    if (pair_errors[i]) {
+      try {
+        std::rethrow_exception(pair_errors[i]);
+      } catch (std::logic_error& e) {
+        drake::log()->warn(e.what());
+      }
+    } else {
+      closest_points->push_back(pair_results[i]);
     }
   }
   return closest_points->size() > 0;
@@ -829,9 +931,14 @@ bool BulletModel::ComputeMaximumDepthCollisionPoints(
   std::vector<double> distance;
   BulletCollisionWorldWrapper& bt_world = getBulletWorld(use_margins);
 
-  // This removes the "persistent" behavior of Bullet's manifolds allowing to
-  // perform a clean, from scratch, collision dispatch.
-  ClearCachedResults(use_margins);
+  // Unless contact points may be reused, this removes the "persistent"
+  // behavior of Bullet's manifolds allowing to perform a clean, from scratch,
+  // collision dispatch. Otherwise the dispatcher clears the manifolds of the
+  // pairs that it recomputes.
+  bt_world.bt_collision_dispatcher->set_tolerance(contact_reuse_tolerance());
+  if (contact_reuse_tolerance() == 0) {
+    ClearCachedResults(use_margins);
+  }
 
   // Internally updates AABB's calling btCollisionWorld::updateAabbs();
   // TODO(amcastro-tri): analyze if the call to BulletModel::updateModel() is
@@ -879,6 +986,7 @@ bool BulletModel::ComputeMaximumDepthCollisionPoints(
 
 void BulletModel::ClearCachedResults(bool use_margins) {
   BulletCollisionWorldWrapper& bt_world = getBulletWorld(use_margins);
+  bt_world.bt_collision_dispatcher->Reset();
 
   int numManifolds =
       bt_world.bt_collision_world->getDispatcher()->getNumManifolds();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -31,6 +32,43 @@ struct OverlapFilterCallback : public btOverlapFilterCallback {
   BulletModel* parent_model;
 };
 
+// A collision dispatcher that can skip the narrowphase of pairs of elements
+// that are in contact and have barely moved since their contact points were
+// last computed, keeping the contact points in their persistent manifolds
+// instead. See Model::set_contact_reuse_tolerance().
+class ContactReuseDispatcher : public btCollisionDispatcher {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContactReuseDispatcher)
+
+  explicit ContactReuseDispatcher(btCollisionConfiguration* configuration);
+
+  // Sets the tolerance; zero dispatches every pair as btCollisionDispatcher
+  // does.
+  void set_tolerance(double tolerance) { tolerance_ = tolerance; }
+
+  // Forgets the poses at which the contact points of each pair were
+  // computed, so that the next dispatch recomputes every pair.
+  void Reset() { reference_poses_.clear(); }
+
+ private:
+  // The world poses of the elements of a pair, ordered as in its
+  // ElementIdPair, when its contact points were last computed.
+  struct ReferencePoses {
+    Eigen::Isometry3d X_WA;
+    Eigen::Isometry3d X_WB;
+  };
+
+  // Bullet's btNearCallback signature takes non-const references.
+  static void NearCallback(
+      // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
+      btBroadphasePair& pair,
+      // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
+      btCollisionDispatcher& dispatcher, const btDispatcherInfo& info);
+
+  double tolerance_{0};
+  std::map<ElementIdPair, ReferencePoses> reference_poses_;
+};
+
 struct BulletCollisionWorldWrapper {
   BulletCollisionWorldWrapper();
   ElementToBtObjMap bt_collision_objects;
@@ -39,7 +77,7 @@ struct BulletCollisionWorldWrapper {
   btDbvtBroadphase bt_collision_broadphase;
   OverlapFilterCallback filter_callback;
 
-  std::unique_ptr<btCollisionDispatcher> bt_collision_dispatcher;
+  std::unique_ptr<ContactReuseDispatcher> bt_collision_dispatcher;
   std::unique_ptr<btCollisionWorld> bt_collision_world;
 };
 
@@ -81,6 +81,10 @@ class CollisionFilterGroup {
 
   std::vector<const RigidBody<T>*>& get_bodies() { return bodies_; }
 
+  const std::vector<const RigidBody<T>*>& get_bodies() const {
+    return bodies_;
+  }
+
   const std::vector<std::string>& get_ignore_groups() const {
     return ignore_groups_;
   }
@@ -227,6 +231,15 @@ class CollisionFilterGroupManager {
   void SetBodyCollisionFilters(const RigidBody<T>& body, const bitmask& group,
                                const bitmask& ignores);
 
+  /**
+   Returns the collision filter groups defined in the current session, keyed by
+   their names.
+   */
+  const std::unordered_map<std::string, CollisionFilterGroup<T>>& get_groups()
+      const {
+    return collision_filter_groups_;
+  }
+
   /**
    Clears the cached collision filter group specification data from the current
    session.  It does *not* reset the counter for available collision filter
@@ -153,6 +153,7 @@ bool FclModel::ClosestPointsAllToAll(
 
 bool FclModel::ComputeMaximumDepthCollisionPoints(
     bool, std::vector<PointPair<double>>* points) {
+  points->clear();
   CollisionData collision_data;
   collision_data.closest_points = points;
   collision_data.request.enable_contact = true;
@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 
 using Eigen::Isometry3d;
 using std::move;
@@ -28,6 +29,16 @@ Element* Model::AddElement(std::unique_ptr<Element> element) {
       std::to_string(id));
 }
 
+void Model::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_threads_ = num_threads;
+}
+
+void Model::set_contact_reuse_tolerance(double tolerance) {
+  DRAKE_THROW_UNLESS(tolerance >= 0);
+  contact_reuse_tolerance_ = tolerance;
+}
+
 bool Model::RemoveElement(ElementId id) {
   DoRemoveElement(id);
   return elements.erase(id) > 0;
@@ -110,6 +110,10 @@ class Model {
   /** Computes the point of closest approach between collision elements that
    are in contact.
 
+   Pairs of elements that may not collide (see Element::CanCollideWith()) are
+   rejected in the broadphase, before any narrowphase work is done on them,
+   so every reported pair satisfies Element::CanCollideWith().
+
    @param[in] use_margins If `true` the model uses the representation with
    margins. If `false`, the representation without margins is used instead.
 
@@ -138,6 +142,38 @@ class Model {
       const std::vector<ElementIdPair>& id_pairs, bool use_margins,
       std::vector<PointPair<double>>* closest_points) = 0;
 
+  /** Sets the maximum number of threads that ClosestPointsAllToAll() and
+   ClosestPointsPairwise() may use to process their pairs of elements, and that
+   CollisionDetectFromPoints() may use to process its points; the default is 1.
+   The results do not depend on the number of threads. Models that process
+   pairs serially ignore it.
+
+   @throws std::runtime_error if @p num_threads is not positive. **/
+  void set_num_threads(int num_threads);
+
+  /** Returns the number of threads set by set_num_threads(). **/
+  int num_threads() const { return num_threads_; }
+
+  /** Sets how far, in meters, the contact points between a pair of elements
+   may move before ComputeMaximumDepthCollisionPoints() recomputes them; the
+   default is 0, which recomputes every pair on every call.
+
+   With a positive @p tolerance, a pair of elements that was found in contact
+   by the previous call, and whose previous contact points have each moved by
+   no more than @p tolerance with their elements since then, skips the
+   narrowphase and reports its previous contact points again. This saves the
+   narrowphase of objects resting on each other, at the cost of contact
+   points, normals and depths that may be stale by up to @p tolerance. Pairs
+   that were not in contact are always recomputed. ClearCachedResults()
+   forces every pair to be recomputed by the next call. Models that do not
+   keep contact points between calls ignore it.
+
+   @throws std::runtime_error if @p tolerance is negative. **/
+  void set_contact_reuse_tolerance(double tolerance);
+
+  /** Returns the tolerance set by set_contact_reuse_tolerance(). **/
+  double contact_reuse_tolerance() const { return contact_reuse_tolerance_; }
+
   /** Clears possibly cached results so that a fresh computation can be
   performed.
 
@@ -275,6 +311,10 @@ class Model {
   // Please do not add new references to this member.  Instead, use
   // the accessors.
   std::unordered_map<ElementId, std::unique_ptr<Element>> elements;
+
+ private:
+  int num_threads_{1};
+  double contact_reuse_tolerance_{0};
 };
 
 }  // namespace collision
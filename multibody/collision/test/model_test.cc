@@ -617,6 +617,53 @@ GTEST_TEST(ModelTest, ClosestPointsAllToAll) {
   EXPECT_TRUE(points[2].ptB.isApprox(Vector3d(-0.5, 0, 0)));
 }
 
+// Checks that ClosestPointsAllToAll gives the same results, in the same
+// order, whatever the number of threads.
+GTEST_TEST(ModelTest, ClosestPointsAllToAllMultithreaded) {
+  const DrakeShapes::Box box(Vector3d(0.5, 0.4, 0.3));
+  const DrakeShapes::Sphere sphere(0.3);
+  const DrakeShapes::Cylinder cylinder(0.2, 0.6);
+
+  const std::vector<const DrakeShapes::Geometry*> geometries{
+      &box, &sphere, &cylinder};
+
+  // A grid of elements that are close to, but do not touch, their neighbors.
+  unique_ptr<Model> model = newModel();
+  std::vector<ElementId> ids_to_check;
+  for (int i = 0; i < 24; ++i) {
+    Element* element =
+        model->AddElement(make_unique<Element>(*geometries[i % 3]));
+    Isometry3d X_WL = Isometry3d::Identity();
+    X_WL.translation() << 1.0 * (i % 4), 1.1 * (i / 4 % 3), 1.2 * (i / 12);
+    X_WL.linear() = AngleAxisd(0.3 * i, Vector3d(1, 2, 3).normalized())
+                        .toRotationMatrix();
+    model->UpdateElementWorldTransform(element->getId(), X_WL);
+    ids_to_check.push_back(element->getId());
+  }
+
+  std::vector<PointPair<double>> expected;
+  model->ClosestPointsAllToAll(ids_to_check, true, &expected);
+  EXPECT_EQ(expected.size(), 24u * 23u / 2u);
+
+  for (int num_threads : {2, 3, 8}) {
+    model->set_num_threads(num_threads);
+    EXPECT_EQ(model->num_threads(), num_threads);
+    std::vector<PointPair<double>> points;
+    model->ClosestPointsAllToAll(ids_to_check, true, &points);
+    ASSERT_EQ(points.size(), expected.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(points[i].idA, expected[i].idA);
+      EXPECT_EQ(points[i].idB, expected[i].idB);
+      EXPECT_EQ(points[i].distance, expected[i].distance);
+      EXPECT_EQ(points[i].normal, expected[i].normal);
+      EXPECT_EQ(points[i].ptA, expected[i].ptA);
+      EXPECT_EQ(points[i].ptB, expected[i].ptB);
+    }
+  }
+
+  EXPECT_THROW(model->set_num_threads(0), std::runtime_error);
+}
+
 GTEST_TEST(ModelTest, CollisionCliques) {
   Element element_1, element_2, element_3;
 
@@ -1059,6 +1106,48 @@ TEST_F(SmallBoxSittingOnLargeBox, ClearCachedResults) {
   }
 }
 
+// Tests that, with a contact reuse tolerance, the contact points of boxes that
+// barely moved are reported again, and those of boxes that moved further are
+// recomputed as a fresh query would.
+TEST_F(SmallBoxSittingOnLargeBox, ReusesContactPoints) {
+  EXPECT_THROW(model_->set_contact_reuse_tolerance(-1.0), std::runtime_error);
+  model_->set_contact_reuse_tolerance(1.0e-3);
+
+  std::vector<PointPair<double>> first;
+  model_->ComputeMaximumDepthCollisionPoints(false, &first);
+  ASSERT_EQ(1u, first.size());
+
+  // A small displacement reuses the previous contact point.
+  Isometry3d small_box_pose;
+  small_box_pose.setIdentity();
+  small_box_pose.translation() = Vector3d(1.0e-4, 5.4, 0.0);
+  model_->UpdateElementWorldTransform(small_box_->getId(), small_box_pose);
+  std::vector<PointPair<double>> reused;
+  model_->ComputeMaximumDepthCollisionPoints(false, &reused);
+  ASSERT_EQ(1u, reused.size());
+  EXPECT_EQ(reused[0].elementA, first[0].elementA);
+  EXPECT_EQ(reused[0].elementB, first[0].elementB);
+  EXPECT_EQ(reused[0].ptA, first[0].ptA);
+  EXPECT_EQ(reused[0].ptB, first[0].ptB);
+  EXPECT_EQ(reused[0].distance, first[0].distance);
+
+  // A larger displacement, which also deepens the contact, recomputes it.
+  small_box_pose.translation() = Vector3d(1.0e-2, 5.38, 0.0);
+  model_->UpdateElementWorldTransform(small_box_->getId(), small_box_pose);
+  std::vector<PointPair<double>> recomputed;
+  model_->ComputeMaximumDepthCollisionPoints(false, &recomputed);
+  ASSERT_EQ(1u, recomputed.size());
+  EXPECT_NEAR(-0.12, recomputed[0].distance, 2.0e-9);
+
+  model_->ClearCachedResults(false);
+  std::vector<PointPair<double>> fresh;
+  model_->ComputeMaximumDepthCollisionPoints(false, &fresh);
+  ASSERT_EQ(1u, fresh.size());
+  EXPECT_TRUE(CompareMatrices(recomputed[0].ptA, fresh[0].ptA));
+  EXPECT_TRUE(CompareMatrices(recomputed[0].ptB, fresh[0].ptB));
+  EXPECT_EQ(recomputed[0].distance, fresh[0].distance);
+}
+
 // Tests that anchored collision elements do not collide with other anchored
 // collision elements.
 // This test sets four spheres in a box arrangement so that they collide with
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+
+/// A spatial Jacobian restricted to the generalized velocities (or
+/// generalized position time derivatives) that contribute to it, such as
+/// those of the joints along a kinematic path. The full 6 x n Jacobian has
+/// column `J.col(k)` at column `indices[k]`, and zeros in all other columns.
+///
+/// The operations below touch only the contributing columns, so they cost
+/// O(indices.size()) rather than O(n).
+///
+/// @tparam T The scalar type.
+template <typename T>
+struct CompactJacobian {
+  /// The contributing columns of the Jacobian.
+  drake::Matrix6X<T> J;
+
+  /// The column of the full Jacobian that each column of #J belongs to.
+  std::vector<int> indices;
+
+  /// Returns the full 6 x @p num_columns Jacobian.
+  drake::Matrix6X<T> ToDense(int num_columns) const {
+    CheckInvariants();
+    drake::Matrix6X<T> dense = drake::Matrix6X<T>::Zero(6, num_columns);
+    for (int k = 0; k < static_cast<int>(indices.size()); ++k) {
+      DRAKE_ASSERT(indices[k] < num_columns);
+      dense.col(indices[k]) = J.col(k);
+    }
+    return dense;
+  }
+
+  /// Returns `J_full * v`, for the generalized velocity @p v.
+  drake::Vector6<T> Multiply(const Eigen::Ref<const drake::VectorX<T>>& v)
+      const {
+    CheckInvariants();
+    drake::Vector6<T> result = drake::Vector6<T>::Zero();
+    for (int k = 0; k < static_cast<int>(indices.size()); ++k) {
+      DRAKE_ASSERT(indices[k] < v.size());
+      result += J.col(k) * v(indices[k]);
+    }
+    return result;
+  }
+
+  /// Adds `J_fullᵀ * F` to @p generalized_force, for the spatial force @p F.
+  void AddTransposeMultiply(const drake::Vector6<T>& F,
+                            drake::VectorX<T>* generalized_force) const {
+    CheckInvariants();
+    DRAKE_DEMAND(generalized_force != nullptr);
+    for (int k = 0; k < static_cast<int>(indices.size()); ++k) {
+      DRAKE_ASSERT(indices[k] < generalized_force->size());
+      (*generalized_force)(indices[k]) += J.col(k).dot(F);
+    }
+  }
+
+  /// Adds `J_fullᵀ * W * J_full` to the square matrix @p H, for the 6 x 6
+  /// weight @p W. Only the rows and columns of @p H in #indices are changed.
+  void AddTransposeWeightedProduct(const drake::Matrix6<T>& W,
+                                   drake::MatrixX<T>* H) const {
+    CheckInvariants();
+    DRAKE_DEMAND(H != nullptr);
+    DRAKE_DEMAND(H->rows() == H->cols());
+    const drake::MatrixX<T> JtWJ = J.transpose() * W * J;
+    for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+      DRAKE_ASSERT(indices[j] < H->cols());
+      for (int i = 0; i < static_cast<int>(indices.size()); ++i) {
+        (*H)(indices[i], indices[j]) += JtWJ(i, j);
+      }
+    }
+  }
+
+ private:
+  void CheckInvariants() const {
+    DRAKE_DEMAND(J.cols() == static_cast<int>(indices.size()));
+  }
+};
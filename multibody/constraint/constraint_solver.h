@@ -15,6 +15,22 @@ namespace drake {
 namespace multibody {
 namespace constraint {
 
+/// Parameters of ConstraintSolver::SolveImpactProblemWithPgs().
+struct PgsParameters {
+  /// The maximum number of sweeps over the constraints. Each sweep costs
+  /// O(m⋅n) for m constraints and n generalized velocities, so this bounds
+  /// the cost of a solve.
+  int max_iterations{100};
+
+  /// The successive over-relaxation factor ω ∈ (0, 2). ω = 1 yields
+  /// projected Gauss-Seidel; ω > 1 often converges in fewer sweeps.
+  double relaxation{1.0};
+
+  /// The iterations stop early once no impulse changes by more than this
+  /// value in a sweep.
+  double tolerance{0.0};
+};
+
 /// Solves constraint problems for constraint forces. Specifically, given
 /// problem data corresponding to a rigid or multi-body system constrained
 /// bilaterally and/or unilaterally and acted upon by friction, this class
@@ -101,6 +117,43 @@ class ConstraintSolver {
   void SolveConstraintProblem(const ConstraintAccelProblemData<T>& problem_data,
                               VectorX<T>* cf) const;
 
+  /// Solves the constraint problem, as in SolveConstraintProblem() above, but
+  /// starting the LCP solver from the given basis (i.e., the given guess of
+  /// the active set). Simulations solve a sequence of closely related
+  /// constraint problems, and the basis at the solution of one step is
+  /// typically a very good starting basis for the next step, saving most of
+  /// the pivoting operations.
+  ///
+  /// The LCP variables are, in order: the `nc` normal forces; the `k`
+  /// frictional forces along the spanning directions at the non-sliding
+  /// contacts; the `k` frictional forces along the negated spanning
+  /// directions; the friction cone slack variables of the non-sliding
+  /// contacts; and the `ℓ` unilateral constraint forces. The basis is only
+  /// used if `problem_data.use_complementarity_problem_solver` is `true`.
+  /// @param problem_data The data used to compute the constraint forces.
+  /// @param initial_basis The indices of the LCP variables that are basic at
+  ///            the start. An empty basis yields the standard (cold) start.
+  /// @param cf The computed constraint forces, on return, in the packed
+  ///           storage format described in SolveConstraintProblem() above.
+  /// @param[out] final_basis If non-null, the indices of the LCP variables
+  ///             that are basic at the solution, on return. Set to the empty
+  ///             basis if no LCP was solved.
+  /// @throws a std::runtime_error under the conditions given for
+  ///         SolveConstraintProblem() above.
+  /// @throws a std::logic_error if `cf` is null, or if `initial_basis`
+  ///         contains an index that is out of range or repeated.
+  void SolveConstraintProblem(const ConstraintAccelProblemData<T>& problem_data,
+                              const std::vector<int>& initial_basis,
+                              VectorX<T>* cf,
+                              std::vector<int>* final_basis) const;
+
+  /// Returns the number of pivoting operations made by the LCP solver in the
+  /// last call to SolveConstraintProblem(), or zero if that call did not need
+  /// to solve an LCP.
+  int get_num_constraint_lcp_pivots() const {
+    return num_constraint_lcp_pivots_;
+  }
+
   /// Solves the appropriate impact problem at the velocity level.
   /// @param problem_data The data used to compute the impulsive constraint
   ///            forces.
@@ -129,6 +182,104 @@ class ConstraintSolver {
   void SolveImpactProblem(const ConstraintVelProblemData<T>& problem_data,
                           VectorX<T>* cf) const;
 
+  /// Solves the impact problem, as in SolveImpactProblem() above, but starting
+  /// the LCP solver from the given basis. Time-stepping simulations solve a
+  /// sequence of closely related impact problems; the basis at the solution of
+  /// one step (mapped onto the next step's constraints with
+  /// MapImpactProblemBasis()) is typically a very good starting basis for the
+  /// next step, saving most of the pivoting operations.
+  ///
+  /// The LCP variables are, in order: the `nc` normal impulses; the `k`
+  /// frictional impulses along the spanning directions; the `k` frictional
+  /// impulses along the negated spanning directions; the `nc` friction cone
+  /// slack variables; and the `ℓ` unilateral constraint impulses.
+  /// @param problem_data The data used to compute the impulsive constraint
+  ///            forces.
+  /// @param initial_basis The indices of the LCP variables that are basic at
+  ///            the start. An empty basis yields the standard (cold) start.
+  /// @param cf The computed impulsive forces, on return, in the packed
+  ///           storage format described in SolveImpactProblem() above.
+  /// @param[out] final_basis If non-null, the indices of the LCP variables
+  ///             that are basic at the solution, on return. Set to the empty
+  ///             basis if no LCP was solved (no constraint is impacting) or
+  ///             if its solution required regularization.
+  /// @throws a std::runtime_error under the conditions given for
+  ///         SolveImpactProblem() above.
+  /// @throws a std::logic_error if `cf` is null, or if `initial_basis`
+  ///         contains an index that is out of range or repeated.
+  void SolveImpactProblem(const ConstraintVelProblemData<T>& problem_data,
+                          const std::vector<int>& initial_basis,
+                          VectorX<T>* cf,
+                          std::vector<int>* final_basis) const;
+
+  /// Returns the number of pivoting operations made by the LCP solver in the
+  /// last call to SolveImpactProblem(), or zero if that call did not need to
+  /// solve an LCP.
+  int get_num_impact_lcp_pivots() const { return num_impact_lcp_pivots_; }
+
+  /// Solves the impact problem approximately, by projected Gauss-Seidel with
+  /// successive over-relaxation (PGS-SOR), as an alternative to the pivoting
+  /// method of SolveImpactProblem(). Pivoting methods find an exact solution,
+  /// at a cost that grows cubically with the number of constraints; PGS
+  /// instead sweeps over the constraints a bounded number of times, trading
+  /// exact complementarity for a predictable cost per solve, which is
+  /// preferable for scenes with many contacts.
+  ///
+  /// Each friction cone spanning direction is treated independently, with
+  /// its frictional impulse bounded by μ times the normal impulse at its
+  /// contact (i.e., a box rather than a pyramid). The bilateral constraints
+  /// are solved in the same sweeps as the unilateral ones. The Jacobian
+  /// operators of `problem_data` are only applied to unit vectors, to form
+  /// the transposed Jacobians; M⁻¹ is applied to all of their columns in a
+  /// single call to `problem_data.solve_inertia`, and the constraint space
+  /// compliance matrix is never formed.
+  /// @param problem_data The data used to compute the impulsive constraint
+  ///            forces.
+  /// @param parameters The iteration limits and relaxation.
+  /// @param initial_cf The impulses to start from, in the packed storage
+  ///            format described in SolveImpactProblem(); e.g., those of the
+  ///            previous time step. An empty vector starts from zero.
+  /// @param cf The computed impulsive forces, on return, in the packed
+  ///           storage format described in SolveImpactProblem().
+  /// @throws a std::logic_error if `cf` is null, if `initial_cf` is neither
+  ///         empty nor of the size of `cf`, or if `parameters` are invalid.
+  void SolveImpactProblemWithPgs(
+      const ConstraintVelProblemData<T>& problem_data,
+      const PgsParameters& parameters, const VectorX<T>& initial_cf,
+      VectorX<T>* cf) const;
+
+  /// Returns the number of sweeps made in the last call to
+  /// SolveImpactProblemWithPgs().
+  int get_num_pgs_iterations() const { return num_pgs_iterations_; }
+
+  /// Maps a basis of the LCP of one impact problem onto the LCP of another
+  /// impact problem whose constraints partly correspond, for warm starting
+  /// SolveImpactProblem(). Variables of constraints without a counterpart in
+  /// the new problem are dropped; the frictional variables of a contact are
+  /// only kept if the contact has the same number of spanning directions in
+  /// both problems.
+  /// @param basis A basis of the old problem's LCP, e.g., the final basis
+  ///              reported by SolveImpactProblem().
+  /// @param old_r The number of spanning directions of each contact of the
+  ///              old problem (see ConstraintVelProblemData::r).
+  /// @param old_num_limits The number of unilateral constraints of the old
+  ///              problem.
+  /// @param new_r The number of spanning directions of each contact of the
+  ///              new problem.
+  /// @param contact_map For each contact of the new problem, the index of the
+  ///              same contact in the old problem, or -1 if it is new.
+  /// @param limit_map For each unilateral constraint of the new problem, the
+  ///              index of the same constraint in the old problem, or -1 if
+  ///              it is new.
+  /// @returns The mapped basis, in increasing order.
+  /// @throws std::logic_error if the sizes of `new_r` and `contact_map`
+  ///         differ, or if an index in `basis`, `contact_map`, or `limit_map`
+  ///         is out of range.
+  static std::vector<int> MapImpactProblemBasis(
+      const std::vector<int>& basis, const std::vector<int>& old_r,
+      int old_num_limits, const std::vector<int>& new_r,
+      const std::vector<int>& contact_map, const std::vector<int>& limit_map);
+
   /// Computes the generalized force on the system from the constraint forces
   /// given in packed storage.
   /// @param problem_data The data used to compute the contact forces.
@@ -245,7 +396,9 @@ class ConstraintSolver {
   void FormAndSolveConstraintLCP(
       const ConstraintAccelProblemData<T>& problem_data,
       const VectorX<T>& trunc_neg_invA_a,
-      VectorX<T>* cf) const;
+      const std::vector<int>& initial_basis,
+      VectorX<T>* cf,
+      std::vector<int>* final_basis) const;
   void FormAndSolveConstraintLinearSystem(
       const ConstraintAccelProblemData<T>& problem_data,
       const VectorX<T>& trunc_neg_invA_a,
@@ -270,7 +423,8 @@ class ConstraintSolver {
 
   // Computes the matrix M⁻¹⋅Gᵀ, G ∈ ℝᵐˣⁿ is a constraint Jacobian matrix
   // (realized here using an operator) and M⁻¹ ∈ ℝⁿˣⁿ is the inverse of the
-  // generalized inertia matrix. Resizes iM_GT as necessary.
+  // generalized inertia matrix. iM_GT must have n rows and m columns on entry.
+  // M⁻¹ is applied to all m columns of Gᵀ in a single call to M_inv_mult.
   static void ComputeInverseInertiaTimesGT(
       std::function<MatrixX<T>(const MatrixX<T>&)> M_inv_mult,
       std::function<VectorX<T>(const VectorX<T>&)> G_transpose_mult,
@@ -311,6 +465,15 @@ class ConstraintSolver {
       ProblemData* modified_problem_data) const;
 
   drake::solvers::MobyLCPSolver<T> lcp_;
+
+  // The number of pivots made in the last call to SolveConstraintProblem().
+  mutable int num_constraint_lcp_pivots_{0};
+
+  // The number of pivots made in the last call to SolveImpactProblem().
+  mutable int num_impact_lcp_pivots_{0};
+
+  // The number of sweeps made in the last call to SolveImpactProblemWithPgs().
+  mutable int num_pgs_iterations_{0};
 };
 
 // Given a matrix A of blocks consisting of generalized inertia (M) and the
@@ -573,11 +736,15 @@ void ConstraintSolver<T>::FormAndSolveConstraintLinearSystem(
 // active constraints to be known a priori. Significantly more computation is
 // required, however.
 // @sa FormAndSolveConstraintLinearSystem for descriptions of parameters.
+// @sa SolveConstraintProblem for descriptions of `initial_basis` and
+//     `final_basis`.
 template <typename T>
 void ConstraintSolver<T>::FormAndSolveConstraintLCP(
     const ConstraintAccelProblemData<T>& problem_data,
     const VectorX<T>& trunc_neg_invA_a,
-    VectorX<T>* cf) const {
+    const std::vector<int>& initial_basis,
+    VectorX<T>* cf,
+    std::vector<int>* final_basis) const {
   using std::max;
   using std::abs;
 
@@ -685,7 +852,15 @@ void ConstraintSolver<T>::FormAndSolveConstraintLCP(
 
   // Solve the LCP and compute the values of the slack variables.
   VectorX<T> zz;
-  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, -1, zero_tol);
+  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, initial_basis, final_basis,
+                                    -1, zero_tol);
+  num_constraint_lcp_pivots_ = lcp_.get_num_pivots();
+  if (!success && !initial_basis.empty()) {
+    // The starting basis led to a failing pivoting sequence; try again from
+    // the standard start.
+    success = lcp_.SolveLcpLemke(MM, qq, &zz, {}, final_basis, -1, zero_tol);
+    num_constraint_lcp_pivots_ += lcp_.get_num_pivots();
+  }
   VectorX<T> ww = MM * zz + qq;
   const double max_dot = (zz.size() > 0) ?
                          (zz.array() * ww.array()).abs().maxCoeff() : 0.0;
@@ -724,12 +899,25 @@ template <typename T>
 void ConstraintSolver<T>::SolveConstraintProblem(
     const ConstraintAccelProblemData<T>& problem_data,
     VectorX<T>* cf) const {
+  SolveConstraintProblem(problem_data, {}, cf, nullptr);
+}
+
+template <typename T>
+void ConstraintSolver<T>::SolveConstraintProblem(
+    const ConstraintAccelProblemData<T>& problem_data,
+    const std::vector<int>& initial_basis,
+    VectorX<T>* cf,
+    std::vector<int>* final_basis) const {
   using std::max;
   using std::abs;
 
   if (!cf)
     throw std::logic_error("cf (output parameter) is null.");
 
+  // No LCP has been solved yet.
+  num_constraint_lcp_pivots_ = 0;
+  if (final_basis) final_basis->clear();
+
   // Alias problem data.
   const std::vector<int>& sliding_contacts = problem_data.sliding_contacts;
   const std::vector<int>& non_sliding_contacts =
@@ -826,7 +1014,8 @@ void ConstraintSolver<T>::SolveConstraintProblem(
 
   // Determine which problem formulation to use.
   if (problem_data.use_complementarity_problem_solver) {
-    FormAndSolveConstraintLCP(*data_ptr, trunc_neg_invA_a, cf);
+    FormAndSolveConstraintLCP(*data_ptr, trunc_neg_invA_a, initial_basis, cf,
+                              final_basis);
   } else {
     FormAndSolveConstraintLinearSystem(*data_ptr, trunc_neg_invA_a, cf);
   }
@@ -867,11 +1056,92 @@ template <typename T>
 void ConstraintSolver<T>::SolveImpactProblem(
     const ConstraintVelProblemData<T>& problem_data,
     VectorX<T>* cf) const {
+  SolveImpactProblem(problem_data, {}, cf, nullptr);
+}
+
+template <typename T>
+std::vector<int> ConstraintSolver<T>::MapImpactProblemBasis(
+    const std::vector<int>& basis, const std::vector<int>& old_r,
+    int old_num_limits, const std::vector<int>& new_r,
+    const std::vector<int>& contact_map, const std::vector<int>& limit_map) {
+  if (new_r.size() != contact_map.size()) {
+    throw std::logic_error("Number of elements in 'contact_map' does not "
+                               "match number of elements in 'new_r'");
+  }
+  const int old_nc = old_r.size();
+  const int new_nc = new_r.size();
+
+  // The index of the first spanning direction of each contact, and the total.
+  auto edge_starts = [](const std::vector<int>& r) {
+    std::vector<int> starts(r.size() + 1, 0);
+    std::partial_sum(r.begin(), r.end(), starts.begin() + 1);
+    return starts;
+  };
+  const std::vector<int> old_edge_start = edge_starts(old_r);
+  const std::vector<int> new_edge_start = edge_starts(new_r);
+  const int old_nk = old_edge_start.back();
+  const int new_nk = new_edge_start.back();
+
+  // Invert the maps.
+  auto invert = [](const std::vector<int>& map, int old_size) {
+    std::vector<int> inverse(old_size, -1);
+    for (int i = 0; i < static_cast<int>(map.size()); ++i) {
+      if (map[i] < -1 || map[i] >= old_size)
+        throw std::logic_error("Constraint map index is out of range.");
+      if (map[i] >= 0) inverse[map[i]] = i;
+    }
+    return inverse;
+  };
+  const std::vector<int> old_to_new_contact = invert(contact_map, old_nc);
+  const std::vector<int> old_to_new_limit = invert(limit_map, old_num_limits);
+
+  std::vector<int> new_basis;
+  for (const int i : basis) {
+    if (i < 0 || i >= 2 * old_nc + 2 * old_nk + old_num_limits)
+      throw std::logic_error("Basis index is out of range.");
+    if (i < old_nc) {
+      // Normal impulse.
+      const int j = old_to_new_contact[i];
+      if (j >= 0) new_basis.push_back(j);
+    } else if (i < old_nc + 2 * old_nk) {
+      // Frictional impulse, along a spanning direction or its negation.
+      const int negated = (i - old_nc) / old_nk;
+      const int edge = (i - old_nc) % old_nk;
+      const int contact = std::upper_bound(old_edge_start.begin(),
+                                           old_edge_start.end(), edge) -
+                          old_edge_start.begin() - 1;
+      const int j = old_to_new_contact[contact];
+      if (j >= 0 && new_r[j] == old_r[contact]) {
+        new_basis.push_back(new_nc + negated * new_nk + new_edge_start[j] +
+                            edge - old_edge_start[contact]);
+      }
+    } else if (i < 2 * old_nc + 2 * old_nk) {
+      // Friction cone slack.
+      const int j = old_to_new_contact[i - old_nc - 2 * old_nk];
+      if (j >= 0) new_basis.push_back(new_nc + 2 * new_nk + j);
+    } else {
+      // Unilateral constraint impulse.
+      const int j = old_to_new_limit[i - 2 * old_nc - 2 * old_nk];
+      if (j >= 0) new_basis.push_back(2 * new_nc + 2 * new_nk + j);
+    }
+  }
+  std::sort(new_basis.begin(), new_basis.end());
+  return new_basis;
+}
+
+template <typename T>
+void ConstraintSolver<T>::SolveImpactProblem(
+    const ConstraintVelProblemData<T>& problem_data,
+    const std::vector<int>& initial_basis,
+    VectorX<T>* cf,
+    std::vector<int>* final_basis) const {
   using std::max;
   using std::abs;
 
   if (!cf)
     throw std::logic_error("cf (output parameter) is null.");
+  if (final_basis) final_basis->clear();
+  num_impact_lcp_pivots_ = 0;
 
   // Get number of contacts and limits.
   const int num_contacts = problem_data.mu.size();
@@ -1052,7 +1322,15 @@ void ConstraintSolver<T>::SolveImpactProblem(
 
   // Solve the LCP and compute the values of the slack variables.
   VectorX<T> zz;
-  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, -1, zero_tol);
+  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, initial_basis, final_basis,
+                                    -1, zero_tol);
+  num_impact_lcp_pivots_ = lcp_.get_num_pivots();
+  if (!success && !initial_basis.empty()) {
+    // The starting basis led to a failing pivoting sequence; try again from
+    // the standard start before resorting to regularization.
+    success = lcp_.SolveLcpLemke(MM, qq, &zz, {}, final_basis, -1, zero_tol);
+    num_impact_lcp_pivots_ += lcp_.get_num_pivots();
+  }
   VectorX<T> ww = MM * zz + qq;
   const T max_dot = (zz.size() > 0) ?
                          (zz.array() * ww.array()).abs().maxCoeff() : 0.0;
@@ -1091,10 +1369,12 @@ void ConstraintSolver<T>::SolveImpactProblem(
                                   // factor of ten.
     const int max_exp = 1;        // Maximum regularization: 1e1.
     const double piv_tol = -1;    // Make solver compute the pivot tolerance.
+    if (final_basis) final_basis->clear();
     if (!lcp_.SolveLcpLemkeRegularized(
         MM, qq, &zz, min_exp, step_exp, max_exp, piv_tol, zero_tol)) {
       throw std::runtime_error("Progressively regularized LCP solve failed.");
     } else {
+      num_impact_lcp_pivots_ += lcp_.get_num_pivots();
       ww = MM * zz + qq;
       SPDLOG_DEBUG(drake::log(), "minimum z: {}", zz.minCoeff());
       SPDLOG_DEBUG(drake::log(), "minimum w: {}", ww.minCoeff());
@@ -1151,6 +1431,133 @@ void ConstraintSolver<T>::SolveImpactProblem(
   }
 }
 
+template <typename T>
+void ConstraintSolver<T>::SolveImpactProblemWithPgs(
+    const ConstraintVelProblemData<T>& problem_data,
+    const PgsParameters& parameters, const VectorX<T>& initial_cf,
+    VectorX<T>* cf) const {
+  using std::abs;
+  using std::max;
+  using std::min;
+
+  if (!cf)
+    throw std::logic_error("cf (output parameter) is null.");
+  if (parameters.max_iterations < 0 || parameters.relaxation <= 0 ||
+      parameters.relaxation >= 2 || parameters.tolerance < 0) {
+    throw std::logic_error("Invalid projected Gauss-Seidel parameters.");
+  }
+
+  // Get the numbers of constraints.
+  const int num_contacts = problem_data.mu.size();
+  const int num_spanning_vectors = std::accumulate(problem_data.r.begin(),
+                                                   problem_data.r.end(), 0);
+  const int num_limits = problem_data.kL.size();
+  const int num_eq_constraints = problem_data.kG.size();
+  const int num_vars = num_contacts + num_spanning_vectors + num_limits +
+      num_eq_constraints;
+  const int ngv = problem_data.Mv.size();
+  if (initial_cf.size() != 0 && initial_cf.size() != num_vars) {
+    throw std::logic_error("Unexpected packed constraint impulse vector"
+                               " dimension.");
+  }
+
+  // The offsets of the constraint types in the packed storage format.
+  const int friction_start = num_contacts;
+  const int limit_start = friction_start + num_spanning_vectors;
+  const int eq_start = limit_start + num_limits;
+
+  // Form Jᵀ and M⁻¹Jᵀ, where J stacks N, F, L, and G.
+  MatrixX<T> JT(ngv, num_vars);
+  auto form_transposed_jacobian = [&JT, ngv](
+      const std::function<VectorX<T>(const VectorX<T>&)>& transpose_mult,
+      int start, int m) {
+    VectorX<T> basis = VectorX<T>::Zero(m);
+    for (int i = 0; i < m; ++i) {
+      basis[i] = 1;
+      JT.col(start + i) = transpose_mult(basis);
+      basis[i] = 0;
+    }
+  };
+  form_transposed_jacobian(problem_data.N_transpose_mult, 0, num_contacts);
+  form_transposed_jacobian(problem_data.F_transpose_mult, friction_start,
+                           num_spanning_vectors);
+  form_transposed_jacobian(problem_data.L_transpose_mult, limit_start,
+                           num_limits);
+  form_transposed_jacobian(problem_data.G_transpose_mult, eq_start,
+                           num_eq_constraints);
+  const MatrixX<T> iM_JT = problem_data.solve_inertia(JT);
+
+  // The constraint stabilization and regularization terms.
+  VectorX<T> k(num_vars), gamma = VectorX<T>::Zero(num_vars);
+  k << problem_data.kN, problem_data.kF, problem_data.kL, problem_data.kG;
+  gamma.head(num_contacts) = problem_data.gammaN;
+  gamma.segment(friction_start, num_spanning_vectors) = problem_data.gammaF;
+  gamma.segment(limit_start, num_limits) = problem_data.gammaL;
+
+  // The diagonal of the regularized constraint space compliance matrix.
+  VectorX<T> diagonal(num_vars);
+  for (int i = 0; i < num_vars; ++i)
+    diagonal[i] = JT.col(i).dot(iM_JT.col(i)) + gamma[i];
+
+  // The contact of each frictional impulse, for bounding it.
+  std::vector<int> contact_of(num_spanning_vectors);
+  for (int i = 0, j = 0; i < num_contacts; ++i) {
+    for (int edge = 0; edge < problem_data.r[i]; ++edge)
+      contact_of[j++] = i;
+  }
+
+  // Projects the iᵗʰ impulse onto its feasible set.
+  auto project = [&](int i, const VectorX<T>& lambda) -> T {
+    if (i < friction_start || (i >= limit_start && i < eq_start))
+      return max(lambda[i], T(0));
+    if (i < limit_start) {
+      const int c = contact_of[i - friction_start];
+      const T bound = problem_data.mu[c] * lambda[c];
+      return min(max(lambda[i], -bound), bound);
+    }
+    return lambda[i];
+  };
+
+  // Start from the given impulses, made feasible, and the velocity they
+  // yield.
+  VectorX<T> lambda = VectorX<T>::Zero(num_vars);
+  if (initial_cf.size() != 0) {
+    lambda = initial_cf;
+    for (int i = 0; i < num_vars; ++i)
+      lambda[i] = project(i, lambda);
+  }
+  VectorX<T> v = problem_data.solve_inertia(problem_data.Mv);
+  v += iM_JT * lambda;
+
+  // Sweep over the constraints, solving for each impulse in turn with the
+  // others held fixed, and projecting it onto its feasible set. The velocity
+  // is updated with each change, so that each impulse sees the latest values
+  // of the others.
+  num_pgs_iterations_ = 0;
+  while (num_pgs_iterations_ < parameters.max_iterations) {
+    ++num_pgs_iterations_;
+    T max_change(0);
+    for (int i = 0; i < num_vars; ++i) {
+      // A constraint without effect on the velocities gets no impulse.
+      if (diagonal[i] <= 0)
+        continue;
+      const T w = JT.col(i).dot(v) + k[i] + gamma[i] * lambda[i];
+      const T old_lambda = lambda[i];
+      lambda[i] -= parameters.relaxation * w / diagonal[i];
+      lambda[i] = project(i, lambda);
+      const T change = lambda[i] - old_lambda;
+      if (change != 0) {
+        v += iM_JT.col(i) * change;
+        max_change = max(max_change, abs(change));
+      }
+    }
+    if (max_change <= parameters.tolerance)
+      break;
+  }
+
+  *cf = lambda;
+}
+
 template <class T>
 void ConstraintSolver<T>::ComputeConstraintSpaceComplianceMatrix(
     std::function<VectorX<T>(const VectorX<T>&)> A_mult,
@@ -1181,20 +1588,23 @@ void ConstraintSolver<T>::ComputeInverseInertiaTimesGT(
   DRAKE_DEMAND(iM_GT);
   DRAKE_DEMAND(iM_GT->cols() == m);
 
-  VectorX<T> basis(m);  // Basis vector.
-  VectorX<T> gT;        // Intermediate result vector.
-
   // Look for fast exit.
   if (m == 0)
     return;
 
+  // Form Gᵀ one column at a time.
+  VectorX<T> basis = VectorX<T>::Zero(m);  // Basis vector.
+  MatrixX<T> GT(iM_GT->rows(), m);
   for (int i = 0; i < m; ++i) {
-    // Get the i'th column of G.
-    basis.setZero();
     basis[i] = 1;
-    gT = G_transpose_mult(basis);
-    iM_GT->col(i) = M_inv_mult(gT);
+    GT.col(i) = G_transpose_mult(basis);
+    basis[i] = 0;
   }
+
+  // Apply M⁻¹ to all columns at once, so that a factorization of M (and, with
+  // bilateral constraints, of the Delassus matrix) is applied to a single
+  // multi-column right hand side.
+  *iM_GT = M_inv_mult(GT);
 }
 
 // Checks the validity of the constraint matrix. This operation is relatively
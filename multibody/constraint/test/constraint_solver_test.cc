@@ -2,6 +2,8 @@
 
 #include <cmath>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -1943,12 +1945,242 @@ TEST_P(Constraint2DSolverTest, TwoPointImpactAsLimit) {
   EXPECT_NEAR(cf[0], mv*2, lcp_eps_);
 }
 
+// Verifies that warm starting the impact problem from the basis at its
+// solution reproduces the solution, with no more pivots than a cold start.
+TEST_P(Constraint2DSolverTest, ImpactWarmStart) {
+  SetRodToSlidingImpactingHorizontalConfig(true /* sliding to the right */);
+  CalcConstraintVelProblemData(vel_data_.get());
+
+  VectorX<double> cf_cold;
+  std::vector<int> basis;
+  solver_.SolveImpactProblem(*vel_data_, {}, &cf_cold, &basis);
+  const int cold_pivots = solver_.get_num_impact_lcp_pivots();
+  EXPECT_GT(cold_pivots, 0);
+  ASSERT_FALSE(basis.empty());
+
+  // The same constraints, in the same order, map the basis onto itself.
+  const int num_contacts = vel_data_->mu.size();
+  std::vector<int> contact_map(num_contacts);
+  std::iota(contact_map.begin(), contact_map.end(), 0);
+  const std::vector<int> mapped_basis =
+      ConstraintSolver<double>::MapImpactProblemBasis(
+          basis, vel_data_->r, vel_data_->kL.size(), vel_data_->r,
+          contact_map, {});
+  EXPECT_EQ(mapped_basis, basis);
+
+  VectorX<double> cf_warm;
+  std::vector<int> warm_basis;
+  solver_.SolveImpactProblem(*vel_data_, mapped_basis, &cf_warm, &warm_basis);
+  EXPECT_LE(solver_.get_num_impact_lcp_pivots(), cold_pivots);
+  EXPECT_EQ(warm_basis, basis);
+  ASSERT_EQ(cf_warm.size(), cf_cold.size());
+  EXPECT_LT((cf_warm - cf_cold).norm(), lcp_eps_ * (1 + cf_cold.norm()));
+}
+
+// Verifies that warm starting the constraint problem from the basis at its
+// solution reproduces the solution, with no more pivots than a cold start.
+TEST_P(Constraint2DSolverTest, ConstraintWarmStart) {
+  SetRodToRestingHorizontalConfig();
+  CalcConstraintAccelProblemData(accel_data_.get());
+  accel_data_->use_complementarity_problem_solver = true;
+
+  // Pull the rod horizontally, so that frictional forces are needed.
+  accel_data_->tau[0] += 100;
+
+  VectorX<double> cf_cold;
+  std::vector<int> basis;
+  solver_.SolveConstraintProblem(*accel_data_, {}, &cf_cold, &basis);
+  const int cold_pivots = solver_.get_num_constraint_lcp_pivots();
+  EXPECT_GT(cold_pivots, 0);
+  ASSERT_FALSE(basis.empty());
+
+  VectorX<double> cf_warm;
+  std::vector<int> warm_basis;
+  solver_.SolveConstraintProblem(*accel_data_, basis, &cf_warm, &warm_basis);
+  EXPECT_LE(solver_.get_num_constraint_lcp_pivots(), cold_pivots);
+  EXPECT_EQ(warm_basis, basis);
+  ASSERT_EQ(cf_warm.size(), cf_cold.size());
+  EXPECT_LT((cf_warm - cf_cold).norm(), lcp_eps_ * (1 + cf_cold.norm()));
+
+  // The linear system formulation solves no LCP.
+  accel_data_->use_complementarity_problem_solver = false;
+  solver_.SolveConstraintProblem(*accel_data_, basis, &cf_warm, &warm_basis);
+  EXPECT_EQ(solver_.get_num_constraint_lcp_pivots(), 0);
+  EXPECT_TRUE(warm_basis.empty());
+}
+
 // Instantiate the value-parameterized tests to run with a range of CFM values
 // (i.e., constraint softening applied uniformly over all mathematical
 // programming variables).
 INSTANTIATE_TEST_CASE_P(Blank, Constraint2DSolverTest,
                         testing::Values(0, 1e-15, 1e-11, 1e-7, 1e-3));
 
+// Tests mapping an impact problem LCP basis between problems whose contacts
+// and limits partly correspond.
+GTEST_TEST(ConstraintSolverTest, MapImpactProblemBasis) {
+  // The old problem has two contacts, with one and two spanning directions,
+  // and one limit. Its LCP variables are: fN = {0, 1}, fD⁺ = {2 | 3, 4},
+  // fD⁻ = {5 | 6, 7}, λ = {8, 9}, fL = {10}.
+  const std::vector<int> old_r{1, 2};
+  const int old_num_limits = 1;
+  // In the new problem, the first contact is the old second one; the second
+  // contact and the limit are new. Its LCP variables are: fN = {0, 1},
+  // fD⁺ = {2, 3 | 4}, fD⁻ = {5, 6 | 7}, λ = {8, 9}, fL = {10}.
+  const std::vector<int> new_r{2, 1};
+  const std::vector<int> contact_map{1, -1};
+  const std::vector<int> limit_map{-1};
+
+  const std::vector<int> basis{0, 1, 3, 4, 5, 7, 9, 10};
+  EXPECT_EQ(ConstraintSolver<double>::MapImpactProblemBasis(
+                basis, old_r, old_num_limits, new_r, contact_map, limit_map),
+            (std::vector<int>{0, 2, 3, 6, 8}));
+
+  // The frictional variables of a contact whose number of spanning directions
+  // changed are dropped.
+  EXPECT_EQ(ConstraintSolver<double>::MapImpactProblemBasis(
+                basis, old_r, old_num_limits, {1, 1}, contact_map, limit_map),
+            (std::vector<int>{0, 6}));
+
+  // The limit is kept when it is matched.
+  EXPECT_EQ(ConstraintSolver<double>::MapImpactProblemBasis(
+                {10}, old_r, old_num_limits, new_r, contact_map, {0}),
+            (std::vector<int>{10}));
+
+  // Out-of-range indices are rejected.
+  EXPECT_THROW(ConstraintSolver<double>::MapImpactProblemBasis(
+                   {11}, old_r, old_num_limits, new_r, contact_map, limit_map),
+               std::logic_error);
+  EXPECT_THROW(ConstraintSolver<double>::MapImpactProblemBasis(
+                   basis, old_r, old_num_limits, new_r, {2, -1}, limit_map),
+               std::logic_error);
+  EXPECT_THROW(ConstraintSolver<double>::MapImpactProblemBasis(
+                   basis, old_r, old_num_limits, new_r, {1}, limit_map),
+               std::logic_error);
+}
+
+// Builds impact problem data from explicit matrices for a system with
+// inertia matrix M, with the given contact normal and tangent Jacobians and
+// velocity v.
+ConstraintVelProblemData<double> MakeImpactProblemData(
+    const MatrixX<double>& M, const MatrixX<double>& N,
+    const MatrixX<double>& F, const std::vector<int>& r, double mu,
+    const VectorX<double>& v) {
+  ConstraintVelProblemData<double> data(M.rows());
+  data.N_mult = [N](const VectorX<double>& w) -> VectorX<double> {
+    return N * w;
+  };
+  data.N_transpose_mult = [N](const VectorX<double>& f) -> VectorX<double> {
+    return N.transpose() * f;
+  };
+  data.F_mult = [F](const VectorX<double>& w) -> VectorX<double> {
+    return F * w;
+  };
+  data.F_transpose_mult = [F](const VectorX<double>& f) -> VectorX<double> {
+    return F.transpose() * f;
+  };
+  data.r = r;
+  data.mu.setConstant(N.rows(), mu);
+  data.kN.setZero(N.rows());
+  data.gammaN.setZero(N.rows());
+  data.kF.setZero(F.rows());
+  data.gammaF.setZero(F.rows());
+  data.gammaE.setZero(N.rows());
+  data.kL.setZero(0);
+  data.gammaL.setZero(0);
+  data.kG.setZero(0);
+  data.Mv = M * v;
+  const Eigen::LLT<MatrixX<double>> M_chol(M);
+  data.solve_inertia = [M_chol](const MatrixX<double>& B) -> MatrixX<double> {
+    return M_chol.solve(B);
+  };
+  return data;
+}
+
+// Tests that projected Gauss-Seidel matches Lemke's method on a frictionless
+// problem, whose solution is unique, and that warm starting from the
+// solution converges immediately.
+GTEST_TEST(ConstraintSolverTest, PgsFrictionless) {
+  const int ngv = 6;
+  const int nc = 4;
+  const MatrixX<double> A = MatrixX<double>::Random(ngv, ngv);
+  const MatrixX<double> M =
+      A * A.transpose() + MatrixX<double>::Identity(ngv, ngv);
+  const MatrixX<double> N = MatrixX<double>::Random(nc, ngv);
+  const VectorX<double> v = -N.transpose() * VectorX<double>::Ones(nc);
+  const ConstraintVelProblemData<double> data = MakeImpactProblemData(
+      M, N, MatrixX<double>(0, ngv), std::vector<int>(nc, 0), 0.0, v);
+
+  ConstraintSolver<double> solver;
+  VectorX<double> cf_lemke;
+  solver.SolveImpactProblem(data, &cf_lemke);
+
+  PgsParameters parameters;
+  parameters.max_iterations = 10000;
+  parameters.tolerance = 1e-14;
+  VectorX<double> cf;
+  solver.SolveImpactProblemWithPgs(data, parameters, {}, &cf);
+  EXPECT_LT(solver.get_num_pgs_iterations(), parameters.max_iterations);
+  ASSERT_EQ(cf.size(), cf_lemke.size());
+  EXPECT_LT((cf - cf_lemke).lpNorm<Eigen::Infinity>(), 1e-8);
+
+  const VectorX<double> solution = cf;
+  solver.SolveImpactProblemWithPgs(data, parameters, solution, &cf);
+  EXPECT_EQ(solver.get_num_pgs_iterations(), 1);
+
+  // The iteration budget is respected.
+  parameters.max_iterations = 2;
+  solver.SolveImpactProblemWithPgs(data, parameters, {}, &cf);
+  EXPECT_EQ(solver.get_num_pgs_iterations(), 2);
+
+  parameters.relaxation = 2.0;
+  EXPECT_THROW(solver.SolveImpactProblemWithPgs(data, parameters, {}, &cf),
+               std::logic_error);
+  parameters.relaxation = 1.0;
+  EXPECT_THROW(solver.SolveImpactProblemWithPgs(data, parameters,
+                                                VectorX<double>(1), &cf),
+               std::logic_error);
+}
+
+// Tests that projected Gauss-Seidel with over-relaxation satisfies the
+// non-penetration and friction constraints on a frictional problem.
+GTEST_TEST(ConstraintSolverTest, PgsFrictional) {
+  const int ngv = 6;
+  const int nc = 3;
+  const std::vector<int> r{2, 2, 2};
+  const double mu = 0.5;
+  const MatrixX<double> A = MatrixX<double>::Random(ngv, ngv);
+  const MatrixX<double> M =
+      A * A.transpose() + MatrixX<double>::Identity(ngv, ngv);
+  const MatrixX<double> N = MatrixX<double>::Random(nc, ngv);
+  const MatrixX<double> F = MatrixX<double>::Random(6, ngv);
+  const VectorX<double> v = VectorX<double>::Random(ngv) -
+                            N.transpose() * VectorX<double>::Ones(nc);
+  const ConstraintVelProblemData<double> data =
+      MakeImpactProblemData(M, N, F, r, mu, v);
+
+  ConstraintSolver<double> solver;
+  PgsParameters parameters;
+  parameters.max_iterations = 10000;
+  parameters.relaxation = 1.3;
+  parameters.tolerance = 1e-14;
+  VectorX<double> cf;
+  solver.SolveImpactProblemWithPgs(data, parameters, {}, &cf);
+  ASSERT_EQ(cf.size(), nc + 6);
+
+  VectorX<double> delta_v;
+  ConstraintSolver<double>::ComputeGeneralizedVelocityChange(data, cf,
+                                                             &delta_v);
+  const VectorX<double> normal_velocity = N * (v + delta_v);
+  const double tol = 1e-8;
+  for (int i = 0; i < nc; ++i) {
+    EXPECT_GE(cf[i], 0);
+    EXPECT_GE(normal_velocity[i], -tol);
+    EXPECT_LT(std::abs(cf[i] * normal_velocity[i]), tol);
+    for (int j = 0; j < 2; ++j)
+      EXPECT_LE(std::abs(cf[nc + 2 * i + j]), mu * cf[i] + tol);
+  }
+}
+
 }  // namespace
 }  // namespace constraint
 }  // namespace multibody
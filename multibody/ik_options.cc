@@ -26,6 +26,7 @@ IKoptions::IKoptions(const IKoptions &rhs) {
   Qv_ = rhs.Qv_;
   debug_mode_ = rhs.debug_mode_;
   sequentialSeedFlag_ = rhs.sequentialSeedFlag_;
+  num_threads_ = rhs.num_threads_;
   SNOPT_MajorFeasibilityTolerance_ = rhs.SNOPT_MajorFeasibilityTolerance_;
   SNOPT_MajorIterationsLimit_ = rhs.SNOPT_MajorIterationsLimit_;
   SNOPT_IterationsLimit_ = rhs.SNOPT_IterationsLimit_;
@@ -39,6 +40,8 @@ IKoptions::IKoptions(const IKoptions &rhs) {
   qd0_ub_ = rhs.qd0_ub_;
   qdf_lb_ = rhs.qdf_lb_;
   qdf_ub_ = rhs.qdf_ub_;
+  qd0_seed_ = rhs.qd0_seed_;
+  qdf_seed_ = rhs.qdf_seed_;
 }
 IKoptions::~IKoptions() {}
 
@@ -50,6 +53,7 @@ void IKoptions::setDefaultParams(RigidBodyTree<double> *robot) {
   Qv_ = MatrixXd::Zero(nq_, nq_);
   debug_mode_ = true;
   sequentialSeedFlag_ = false;
+  num_threads_ = 1;
   SNOPT_MajorFeasibilityTolerance_ = 1E-6;
   SNOPT_MajorIterationsLimit_ = 200;
   SNOPT_IterationsLimit_ = 10000;
@@ -63,6 +67,8 @@ void IKoptions::setDefaultParams(RigidBodyTree<double> *robot) {
   qd0_lb_ = VectorXd::Zero(nq_);
   qdf_ub_ = VectorXd::Zero(nq_);
   qdf_lb_ = VectorXd::Zero(nq_);
+  qd0_seed_.resize(0);
+  qdf_seed_.resize(0);
 }
 
 RigidBodyTree<double> *IKoptions::getRobotPtr() const { return robot_; }
@@ -126,6 +132,15 @@ bool IKoptions::getSequentialSeedFlag() const {
   return sequentialSeedFlag_;
 }
 
+void IKoptions::setNumThreads(int num_threads) {
+  if (num_threads <= 0) {
+    cerr << "Number of threads must be positive" << endl;
+  }
+  num_threads_ = num_threads;
+}
+
+int IKoptions::getNumThreads() const { return num_threads_; }
+
 void IKoptions::setMajorOptimalityTolerance(double tol) {
   if (tol <= 0) {
     cerr << "Major Optimality Tolerance must be positive" << endl;
@@ -245,6 +260,24 @@ void IKoptions::getqdf(VectorXd &lb, VectorXd &ub) const {
   ub = qdf_ub_;
 }
 
+void IKoptions::setqdSeed(const VectorXd &qd0_seed, const VectorXd &qdf_seed) {
+  if (qd0_seed.rows() != nq_ || qdf_seed.rows() != nq_) {
+    cerr << "qd0_seed and qdf_seed must be nq x 1 column vector" << endl;
+  }
+  qd0_seed_ = qd0_seed;
+  qdf_seed_ = qdf_seed;
+}
+
+void IKoptions::getqdSeed(VectorXd &qd0_seed, VectorXd &qdf_seed) const {
+  if (qd0_seed_.size() > 0) {
+    qd0_seed = qd0_seed_;
+    qdf_seed = qdf_seed_;
+  } else {
+    qd0_seed = (qd0_lb_ + qd0_ub_) / 2;
+    qdf_seed = (qdf_lb_ + qdf_ub_) / 2;
+  }
+}
+
 void IKoptions::setAdditionaltSamples(const RowVectorXd &t_samples) {
   if (t_samples.size() > 0) {
     set<double> unique_sort_t(t_samples.data(),
@@ -14,6 +14,7 @@ class IKoptions {
   Eigen::MatrixXd Qv_;
   bool debug_mode_;
   bool sequentialSeedFlag_;
+  int num_threads_;
   double SNOPT_MajorFeasibilityTolerance_;
   int SNOPT_MajorIterationsLimit_;
   int SNOPT_IterationsLimit_;
@@ -27,6 +28,9 @@ class IKoptions {
   Eigen::VectorXd qd0_ub_;
   Eigen::VectorXd qdf_lb_;
   Eigen::VectorXd qdf_ub_;
+  // Empty unless set by setqdSeed().
+  Eigen::VectorXd qd0_seed_;
+  Eigen::VectorXd qdf_seed_;
 
  protected:
   void setDefaultParams(RigidBodyTree<double> *robot);
@@ -41,6 +45,14 @@ class IKoptions {
   void setQv(const Eigen::MatrixXd &Qv);
   void setDebug(bool flag);
   void setSequentialSeedFlag(bool flag);
+  /**
+   * Sets the number of threads over which inverseKinPointwise() spreads its
+   * time samples. The samples are solved serially, so that each may be
+   * seeded from the previous solution, when the sequential seed flag is set.
+   * inverseKinTraj() also spreads the kinematic constraints at its inbetween
+   * time samples over this many threads. The default is 1.
+   */
+  void setNumThreads(int num_threads);
   void setMajorOptimalityTolerance(double tol);
   void setMajorFeasibilityTolerance(double tol);
   void setSuperbasicsLimit(int limit);
@@ -50,6 +62,15 @@ class IKoptions {
   void setq0(const Eigen::VectorXd &lb, const Eigen::VectorXd &ub);
   void setqd0(const Eigen::VectorXd &lb, const Eigen::VectorXd &ub);
   void setqdf(const Eigen::VectorXd &lb, const Eigen::VectorXd &ub);
+  /**
+   * Sets the initial guesses of qdot at the first and last time samples of
+   * inverseKinTraj(), e.g. to warm start it from a previously solved
+   * trajectory along with its q_seed. Unless they are set, the guesses are the
+   * midpoints of the qd0 and qdf bounds. When the initial state is fixed, the
+   * guess of qdot at the first sample is ignored.
+   */
+  void setqdSeed(const Eigen::VectorXd &qd0_seed,
+                 const Eigen::VectorXd &qdf_seed);
   void setAdditionaltSamples(const Eigen::RowVectorXd &t_samples);
   void updateRobot(RigidBodyTree<double> *new_robot);
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
@@ -60,6 +81,7 @@ class IKoptions {
   void getQv(Eigen::MatrixXd &Qv) const;
   bool getDebug() const;
   bool getSequentialSeedFlag() const;
+  int getNumThreads() const;
   double getMajorOptimalityTolerance() const;
   double getMajorFeasibilityTolerance() const;
   int getSuperbasicsLimit() const;
@@ -74,4 +96,6 @@ class IKoptions {
   void getqd0(Eigen::VectorXd &lb, Eigen::VectorXd &ub) const;
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
   void getqdf(Eigen::VectorXd &lb, Eigen::VectorXd &ub) const;
+  // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
+  void getqdSeed(Eigen::VectorXd &qd0_seed, Eigen::VectorXd &qdf_seed) const;
 };
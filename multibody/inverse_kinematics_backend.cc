@@ -1,5 +1,7 @@
 #include "drake/multibody/inverse_kinematics_backend.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -9,6 +11,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -26,6 +29,7 @@ using Eigen::MatrixXd;
 using Eigen::VectorXd;
 using Eigen::VectorXi;
 
+using drake::ParallelFor;
 using drake::math::autoDiffToGradientMatrix;
 using drake::math::autoDiffToValueMatrix;
 using drake::solvers::Constraint;
@@ -125,6 +129,30 @@ void AddSingleTimeLinearPostureConstraint(
   prog->AddLinearConstraint(MatrixXd(A_sparse), lb, ub, vars);
 }
 
+namespace {
+
+// Adds the already wrapped quasi-static constraint @p qsc to @p prog, along
+// with the contact weights it acts on.
+void AddQuasiStaticConstraintWrapper(
+    const QuasiStaticConstraint* qsc,
+    std::shared_ptr<QuasiStaticConstraintWrapper> wrapper,
+    const drake::solvers::MatrixXDecisionVariable& vars,
+    drake::solvers::MathematicalProgram* prog) {
+  int num_vars = qsc->getNumWeights();
+  drake::solvers::VectorXDecisionVariable qsc_vars =
+      prog->NewContinuousVariables(num_vars, "qsc");
+  prog->AddConstraint(wrapper, {vars, qsc_vars});
+  prog->AddBoundingBoxConstraint(VectorXd::Constant(num_vars, 0.),
+                                 VectorXd::Constant(num_vars, 1.), qsc_vars);
+  VectorXd constraint_eq(num_vars);
+  constraint_eq.fill(1.);
+  prog->AddLinearEqualityConstraint(constraint_eq.transpose(),
+                                    Vector1d::Constant(1.), qsc_vars);
+  prog->SetInitialGuess(qsc_vars, VectorXd::Constant(num_vars, 1.0 / num_vars));
+}
+
+}  // anonymous namespace
+
 /// Add a single time linear posture constraint to @p prog at time @p
 /// t covering @p vars.  @p nq is the KinematicsCacheHelper for the
 /// underlying model.
@@ -141,19 +169,9 @@ void AddQuasiStaticConstraint(
   if (!qsc->isTimeValid(t)) {
     return;
   }
-  int num_vars = qsc->getNumWeights();
-  drake::solvers::VectorXDecisionVariable qsc_vars =
-      prog->NewContinuousVariables(num_vars, "qsc");
-  auto wrapper =
-      std::make_shared<QuasiStaticConstraintWrapper>(qsc, kin_helper);
-  prog->AddConstraint(wrapper, {vars, qsc_vars});
-  prog->AddBoundingBoxConstraint(VectorXd::Constant(num_vars, 0.),
-                                 VectorXd::Constant(num_vars, 1.), qsc_vars);
-  VectorXd constraint_eq(num_vars);
-  constraint_eq.fill(1.);
-  prog->AddLinearEqualityConstraint(constraint_eq.transpose(),
-                                    Vector1d::Constant(1.), qsc_vars);
-  prog->SetInitialGuess(qsc_vars, VectorXd::Constant(num_vars, 1.0 / num_vars));
+  AddQuasiStaticConstraintWrapper(
+      qsc, std::make_shared<QuasiStaticConstraintWrapper>(qsc, kin_helper),
+      vars, prog);
 }
 
 namespace {
@@ -213,90 +231,129 @@ void inverseKinBackend(RigidBodyTree<double>* model, const int nT,
         "nq x nT");
   }
 
-  KinematicsCacheHelper<double> kin_helper(*model);
-
-  // TODO(sam.creasey) I really don't like rebuilding the
-  // MathematicalProgram for every timestep, but it's not possible to
-  // enable/disable (or even remove) a constraint from an
-  // MathematicalProgram between calls to Solve() currently, so
-  // there's not actually another way.
-  for (int t_index = 0; t_index < nT; t_index++) {
-    MathematicalProgram prog;
-    SetIKSolverOptions(ikoptions, &prog);
-
-    drake::solvers::VectorXDecisionVariable vars =
-        prog.NewContinuousVariables(model->get_num_positions());
-
-    MatrixXd Q;
-    ikoptions.getQ(Q);
-    auto objective = std::make_shared<InverseKinObjective>(Q);
-    prog.AddCost(objective, vars);
-
+  // The samples are shared out among the threads, unless each sample is
+  // seeded from the solution of the previous one.
+  const int num_threads =
+      ikoptions.getSequentialSeedFlag()
+          ? 1
+          : std::max(1, std::min(ikoptions.getNumThreads(), nT));
+  std::atomic<int> next_t_index(0);
+  ParallelFor(num_threads, num_threads, [&](int) {
+    // The constraint wrappers and the objective do not depend on the time
+    // sample, so each thread builds them once, around a KinematicsCache of
+    // its own, and adds them to the program of every sample it solves.
+    KinematicsCacheHelper<double> kin_helper(*model);
+    std::vector<std::shared_ptr<SingleTimeKinematicConstraintWrapper>>
+        kinematic_wrappers(num_constraints);
+    std::vector<std::shared_ptr<QuasiStaticConstraintWrapper>>
+        quasi_static_wrappers(num_constraints);
     for (int i = 0; i < num_constraints; i++) {
       const RigidBodyConstraint* constraint = constraint_array[i];
       const int constraint_category = constraint->getCategory();
       if (constraint_category ==
           RigidBodyConstraint::SingleTimeKinematicConstraintCategory) {
-        const SingleTimeKinematicConstraint* stc =
-            static_cast<const SingleTimeKinematicConstraint*>(constraint);
-        if (!stc->isTimeValid(&t[t_index])) {
-          continue;
-        }
-        auto wrapper = std::make_shared<SingleTimeKinematicConstraintWrapper>(
-            stc, &kin_helper);
-        prog.AddConstraint(wrapper, vars);
-      } else if (constraint_category ==
-                 RigidBodyConstraint::PostureConstraintCategory) {
-        const PostureConstraint* pc =
-            static_cast<const PostureConstraint*>(constraint);
-        if (!pc->isTimeValid(&t[t_index])) {
-          continue;
-        }
-        VectorXd lb;
-        VectorXd ub;
-        pc->bounds(&t[t_index], lb, ub);
-        prog.AddBoundingBoxConstraint(lb, ub, vars);
-      } else if (constraint_category ==
-                 RigidBodyConstraint::
-                     SingleTimeLinearPostureConstraintCategory) {
-        AddSingleTimeLinearPostureConstraint(
-            &t[t_index], constraint, model->get_num_positions(), vars, &prog);
+        kinematic_wrappers[i] =
+            std::make_shared<SingleTimeKinematicConstraintWrapper>(
+                static_cast<const SingleTimeKinematicConstraint*>(constraint),
+                &kin_helper);
       } else if (constraint_category ==
                  RigidBodyConstraint::QuasiStaticConstraintCategory) {
-        AddQuasiStaticConstraint(&t[t_index], constraint, &kin_helper, vars,
-                                 &prog);
-      } else if (constraint_category ==
-                 RigidBodyConstraint::MultipleTimeKinematicConstraintCategory) {
-        throw std::runtime_error(
-            "MultipleTimeKinematicConstraint is not supported"
-            " in pointwise mode.");
-      } else if (constraint_category ==
-                 RigidBodyConstraint::
-                     MultipleTimeLinearPostureConstraintCategory) {
-        throw std::runtime_error(
-            "MultipleTimeLinearPostureConstraint is not supported"
-            " in pointwise mode.");
+        quasi_static_wrappers[i] =
+            std::make_shared<QuasiStaticConstraintWrapper>(
+                static_cast<const QuasiStaticConstraint*>(constraint),
+                &kin_helper);
       }
     }
+    MatrixXd Q;
+    ikoptions.getQ(Q);
+    auto objective = std::make_shared<InverseKinObjective>(Q);
 
-    // Add a bounding box constraint from the model.
-    prog.AddBoundingBoxConstraint(model->joint_limit_min,
-                                  model->joint_limit_max, vars);
-
-    // TODO(sam.creasey) would this be faster if we stored the view
-    // instead of copying into a VectorXd?
-    objective->set_q_nom(q_nom.col(t_index));
-    if (!ikoptions.getSequentialSeedFlag() || (t_index == 0)) {
-      prog.SetInitialGuess(vars, q_seed.col(t_index));
-    } else {
-      prog.SetInitialGuess(vars, q_sol->col(t_index - 1));
-    }
+    // TODO(sam.creasey) I really don't like rebuilding the
+    // MathematicalProgram for every timestep, but it's not possible to
+    // enable/disable (or even remove) a constraint from an
+    // MathematicalProgram between calls to Solve() currently, so
+    // there's not actually another way.
+    for (int t_index = next_t_index++; t_index < nT;
+         t_index = next_t_index++) {
+      MathematicalProgram prog;
+      SetIKSolverOptions(ikoptions, &prog);
+
+      drake::solvers::VectorXDecisionVariable vars =
+          prog.NewContinuousVariables(model->get_num_positions());
+
+      prog.AddCost(objective, vars);
+
+      for (int i = 0; i < num_constraints; i++) {
+        const RigidBodyConstraint* constraint = constraint_array[i];
+        const int constraint_category = constraint->getCategory();
+        if (constraint_category ==
+            RigidBodyConstraint::SingleTimeKinematicConstraintCategory) {
+          const SingleTimeKinematicConstraint* stc =
+              static_cast<const SingleTimeKinematicConstraint*>(constraint);
+          if (!stc->isTimeValid(&t[t_index])) {
+            continue;
+          }
+          prog.AddConstraint(kinematic_wrappers[i], vars);
+        } else if (constraint_category ==
+                   RigidBodyConstraint::PostureConstraintCategory) {
+          const PostureConstraint* pc =
+              static_cast<const PostureConstraint*>(constraint);
+          if (!pc->isTimeValid(&t[t_index])) {
+            continue;
+          }
+          VectorXd lb;
+          VectorXd ub;
+          pc->bounds(&t[t_index], lb, ub);
+          prog.AddBoundingBoxConstraint(lb, ub, vars);
+        } else if (constraint_category ==
+                   RigidBodyConstraint::
+                       SingleTimeLinearPostureConstraintCategory) {
+          AddSingleTimeLinearPostureConstraint(
+              &t[t_index], constraint, model->get_num_positions(), vars,
+              &prog);
+        } else if (constraint_category ==
+                   RigidBodyConstraint::QuasiStaticConstraintCategory) {
+          const QuasiStaticConstraint* qsc =
+              static_cast<const QuasiStaticConstraint*>(constraint);
+          if (!qsc->isTimeValid(&t[t_index])) {
+            continue;
+          }
+          AddQuasiStaticConstraintWrapper(qsc, quasi_static_wrappers[i], vars,
+                                          &prog);
+        } else if (constraint_category ==
+                   RigidBodyConstraint::
+                       MultipleTimeKinematicConstraintCategory) {
+          throw std::runtime_error(
+              "MultipleTimeKinematicConstraint is not supported"
+              " in pointwise mode.");
+        } else if (constraint_category ==
+                   RigidBodyConstraint::
+                       MultipleTimeLinearPostureConstraintCategory) {
+          throw std::runtime_error(
+              "MultipleTimeLinearPostureConstraint is not supported"
+              " in pointwise mode.");
+        }
+      }
 
-    SolutionResult result = prog.Solve();
-    const VectorXd& vars_value = prog.GetSolution(vars);
-    q_sol->col(t_index) = vars_value;
-    info[t_index] = GetIKSolverInfo(result);
-  }
+      // Add a bounding box constraint from the model.
+      prog.AddBoundingBoxConstraint(model->joint_limit_min,
+                                    model->joint_limit_max, vars);
+
+      // TODO(sam.creasey) would this be faster if we stored the view
+      // instead of copying into a VectorXd?
+      objective->set_q_nom(q_nom.col(t_index));
+      if (!ikoptions.getSequentialSeedFlag() || (t_index == 0)) {
+        prog.SetInitialGuess(vars, q_seed.col(t_index));
+      } else {
+        prog.SetInitialGuess(vars, q_sol->col(t_index - 1));
+      }
+
+      SolutionResult result = prog.Solve();
+      const VectorXd& vars_value = prog.GetSolution(vars);
+      q_sol->col(t_index) = vars_value;
+      info[t_index] = GetIKSolverInfo(result);
+    }
+  });
 }
 
 template void inverseKinBackend(
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "drake/common/parallel_for.h"
+#include "drake/multibody/inverse_kinematics_backend.h"
+#include "drake/multibody/rigid_body_ik.h"
+#include "drake/multibody/rigid_body_tree.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using drake::ParallelFor;
+using drake::systems::plants::inverseKinBackend;
+
+namespace {
+
+// Per rigid_body_ik.h, the info codes below 10 are successes.
+bool IsSuccessful(int info) { return info < 10; }
+
+}  // namespace
+
+IKMultiStartResults inverseKinMultiStart(
+    RigidBodyTree<double>* model, const MatrixXd& q_seeds,
+    const VectorXd& q_nom,
+    const std::vector<const RigidBodyConstraint*>& constraint_array,
+    const IKoptions& ikoptions, int num_threads, double max_seconds) {
+  const int num_seeds = static_cast<int>(q_seeds.cols());
+  if (num_seeds < 1) {
+    throw std::runtime_error(
+        "Drake::inverseKinMultiStart: q_seeds must have at least one column");
+  }
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+
+  std::vector<VectorXd> q_sol(num_seeds);
+  std::vector<int> info(num_seeds, 0);
+  std::vector<char> solved(num_seeds, false);
+  // The lowest index of a successful seed found so far, or num_seeds.
+  std::atomic<int> first_success(num_seeds);
+
+  ParallelFor(num_seeds, num_threads, [&](int i) {
+    // Seeds are started in increasing order, so every seed before a
+    // successful one is solved, which is what makes the result deterministic.
+    if (i > first_success.load()) {
+      return;
+    }
+    if (i > 0 && std::chrono::duration<double>(Clock::now() - start).count() >
+                     max_seconds) {
+      return;
+    }
+    const VectorXd q_seed = q_seeds.col(i);
+    q_sol[i].resize(model->get_num_positions());
+    std::vector<std::string> infeasible_constraint;
+    inverseKinBackend(model, 1, nullptr, q_seed, q_nom,
+                      static_cast<int>(constraint_array.size()),
+                      constraint_array.data(), ikoptions, &q_sol[i], &info[i],
+                      &infeasible_constraint);
+    solved[i] = true;
+    if (IsSuccessful(info[i])) {
+      int current = first_success.load();
+      while (i < current && !first_success.compare_exchange_weak(current, i)) {
+      }
+    }
+  });
+
+  IKMultiStartResults results;
+  results.seed_index = first_success.load() < num_seeds ? first_success.load()
+                                                        : 0;
+  results.q_sol = q_sol[results.seed_index];
+  results.info = info[results.seed_index];
+  for (int i = 0; i < num_seeds; ++i) {
+    results.num_seeds_solved += solved[i];
+  }
+  return results;
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,6 +6,7 @@
 #include <Eigen/Core>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/gradient.h"
@@ -79,9 +81,12 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
  public:
   /// All pointers/references are aliased, and must remain valid for
   /// the life of this class.
+  /// The single time constraints at the inbetween samples are evaluated on
+  /// up to @p num_threads threads.
   IKInbetweenConstraint(const RigidBodyTree<double>* model,
                         const IKTrajectoryHelper& helper, int num_constraints,
-                        const RigidBodyConstraint* const* constraint_array)
+                        const RigidBodyConstraint* const* constraint_array,
+                        int num_threads)
       : Constraint(0, helper.nq() * (helper.nT() +
                                      helper.num_qdotfree())),  // Update bounds
                                                                // later in
@@ -89,7 +94,9 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
         model_(model),
         helper_(helper),
         num_constraints_(num_constraints),
-        constraint_array_(constraint_array) {
+        constraint_array_(constraint_array),
+        num_threads_(num_threads) {
+    const int nq = helper.nq();
     const int nT = helper.nT();
     const double* t = helper.t();
 
@@ -102,9 +109,30 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
     // the KinematicsCache when calculating the constraint values
     // later.  After all bounds/values are determined for the single
     // time versions, we append all MultipleTimeKinematicConstraints.
+    int sample_idx = 0;
     for (int i = 0; i < nT - 1; i++) {
       for (int j = 0; j < helper.t_inbetween()[i].size(); j++) {
         double t_j = helper.t_inbetween()[i](j) + t[i];
+        // Each joint is interpolated by a spline of its own, so the rows of
+        // dq_inbetween_dqknot, dq_inbetween_dqd0 and dq_inbetween_dqdf for
+        // this sample are made of diagonal nq x nq blocks.  Only the
+        // diagonals are kept.
+        InbetweenSample sample;
+        sample.t = t_j;
+        sample.q_samples_col = sample_idx + i + 1;
+        sample.first_row = this->num_constraints();
+        sample.dq_dqknot.resize(nq, nT);
+        for (int m = 0; m < nT; m++) {
+          sample.dq_dqknot.col(m) = helper.dq_inbetween_dqknot()[i]
+                                        .block(nq * j, nq * m, nq, nq)
+                                        .diagonal();
+        }
+        sample.dq_dqd0 =
+            helper.dq_inbetween_dqd0()[i].block(nq * j, 0, nq, nq).diagonal();
+        sample.dq_dqdf =
+            helper.dq_inbetween_dqdf()[i].block(nq * j, 0, nq, nq).diagonal();
+        samples_.push_back(sample);
+        sample_idx++;
         for (int k = 0; k < num_constraints; k++) {
           const RigidBodyConstraint* constraint = constraint_array_[k];
           const int constraint_category = constraint->getCategory();
@@ -127,6 +155,8 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
       }
     }
 
+    num_single_time_rows_ = this->num_constraints();
+
     for (int k = 0; k < num_constraints; k++) {
       const RigidBodyConstraint* constraint = constraint_array_[k];
       const int constraint_category = constraint->getCategory();
@@ -168,9 +198,7 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
 
     const VectorXd x_scalar = drake::math::autoDiffToValueMatrix(x);
 
-    // Make a local copy of the q portion of the X input values so
-    // that we can resize it for convenience later.
-    MatrixXd q = x_scalar.head(nq * nT);
+    const auto q = x_scalar.head(nq * nT);
 
     const auto qdot0 = x_scalar.segment(nq * nT, nq);
     const auto qdotf = x_scalar.segment(nq * (nT + 1), nq);
@@ -181,78 +209,70 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
     VectorXd y_scalar(num_constraints());
     MatrixXd dy_scalar(num_constraints(), x.size());
 
-    // Index into y_scalar/dy_scalar where the next constraint should
-    // be stored.
-    int y_idx = 0;
-
     const int num_inbetween_tsamples = helper_.t_samples().size() - nT;
-    // q data for only the times inbetween the steps
-    MatrixXd q_inbetween = MatrixXd::Zero(nq, num_inbetween_tsamples);
+    DRAKE_ASSERT(static_cast<int>(samples_.size()) == num_inbetween_tsamples);
     // q data for all timesteps (original and inbetween)
     MatrixXd q_samples = MatrixXd::Zero(nq, num_inbetween_tsamples + nT);
     int inbetween_idx = 0;
+    for (int i = 0; i < nT; i++) {
+      q_samples.col(inbetween_idx + i) = q.segment(nq * i, nq);
+      if (i != nT - 1) {
+        inbetween_idx += static_cast<int>(t_inbetween[i].size());
+      }
+    }
 
-    const double* t = helper_.t();
-
-    // Evaluate all of our single time constraints while building up
-    // the q_inbetween and q_samples data for use later.
-    for (int i = 0; i < nT - 1; i++) {
-      q.resize(nq * nT, 1);
-      MatrixXd q_inbetween_block_tmp = helper_.dq_inbetween_dqknot()[i] * q +
-                                       helper_.dq_inbetween_dqd0()[i] * qdot0 +
-                                       helper_.dq_inbetween_dqdf()[i] * qdotf;
-      q_inbetween_block_tmp.resize(nq, t_inbetween[i].size());
-      q_inbetween.block(0, inbetween_idx, nq, t_inbetween[i].size()) =
-          q_inbetween_block_tmp;
-      q.resize(nq, nT);
-      for (int j = 0; j < t_inbetween[i].size(); j++) {
-        double t_j = t_inbetween[i](j) + t[i];
-        double* qi = q_inbetween.data() + (inbetween_idx + j) * nq;
-        Eigen::Map<VectorXd> qvec(qi, nq);
-        KinematicsCache<double> cache = model_->doKinematics(qvec);
-        for (int k = 0; k < num_constraints_; k++) {
-          const RigidBodyConstraint* constraint = constraint_array_[k];
-          const int constraint_category = constraint->getCategory();
-          if (constraint_category !=
-              RigidBodyConstraint::SingleTimeKinematicConstraintCategory) {
-            continue;
+    // Evaluate all of our single time constraints, one inbetween
+    // sample per task.  Each task interpolates its own column of
+    // q_samples, and writes the disjoint rows of y_scalar and
+    // dy_scalar starting at the sample's first_row.
+    ParallelFor(
+        static_cast<int>(samples_.size()), num_threads_, [&](int s) {
+          const InbetweenSample& sample = samples_[s];
+          VectorXd q_sample = sample.dq_dqd0.cwiseProduct(qdot0) +
+                              sample.dq_dqdf.cwiseProduct(qdotf);
+          for (int m = 0; m < nT; m++) {
+            q_sample += sample.dq_dqknot.col(m).cwiseProduct(
+                q.segment(nq * m, nq));
           }
-
-          const SingleTimeKinematicConstraint* stc =
-              static_cast<const SingleTimeKinematicConstraint*>(constraint);
-          if (stc->isTimeValid(&t_j)) {
-            int nc = stc->getNumConstraint(&t_j);
-            VectorXd c_k(nc);
-            MatrixXd dc_k(nc, nq);
-            stc->eval(&t_j, cache, c_k, dc_k);
-            y_scalar.segment(y_idx, nc) = c_k;
-
-            MatrixXd dc_kdx =
-                MatrixXd::Zero(nc, nq * (num_qfree + num_qdotfree));
-            dc_kdx.block(0, 0, nc, nq * num_qfree) =
-                dc_k *
-                helper_.dq_inbetween_dqknot()[i].block(nq * j, 0, nq,
-                                                       nq * num_qfree);
-
-            dc_kdx.block(0, nq * num_qfree, nc, nq) =
-                dc_k * helper_.dq_inbetween_dqd0()[i].block(nq * j, 0, nq, nq);
-            dc_kdx.block(0, nq * num_qfree + nq, nc, nq) =
-                dc_k * helper_.dq_inbetween_dqdf()[i].block(nq * j, 0, nq, nq);
-
-            dy_scalar.block(y_idx, 0, nc, x.size()) = dc_kdx;
-            y_idx += nc;
+          q_samples.col(sample.q_samples_col) = q_sample;
+          KinematicsCache<double> cache = model_->doKinematics(q_sample);
+          int y_idx = sample.first_row;
+          for (int k = 0; k < num_constraints_; k++) {
+            const RigidBodyConstraint* constraint = constraint_array_[k];
+            const int constraint_category = constraint->getCategory();
+            if (constraint_category !=
+                RigidBodyConstraint::SingleTimeKinematicConstraintCategory) {
+              continue;
+            }
+
+            const SingleTimeKinematicConstraint* stc =
+                static_cast<const SingleTimeKinematicConstraint*>(
+                    constraint);
+            if (stc->isTimeValid(&sample.t)) {
+              int nc = stc->getNumConstraint(&sample.t);
+              VectorXd c_k(nc);
+              MatrixXd dc_k(nc, nq);
+              stc->eval(&sample.t, cache, c_k, dc_k);
+              y_scalar.segment(y_idx, nc) = c_k;
+
+              // Right-multiplying by a diagonal block only scales the
+              // columns of dc_k.
+              for (int m = 0; m < nT; m++) {
+                dy_scalar.block(y_idx, nq * m, nc, nq) =
+                    dc_k * sample.dq_dqknot.col(m).asDiagonal();
+              }
+              dy_scalar.block(y_idx, nq * num_qfree, nc, nq) =
+                  dc_k * sample.dq_dqd0.asDiagonal();
+              dy_scalar.block(y_idx, nq * num_qfree + nq, nc, nq) =
+                  dc_k * sample.dq_dqdf.asDiagonal();
+              y_idx += nc;
+            }
           }
-        }
-      }
+        });
 
-      // We've evaluated all single time constraints for this
-      // timestep.  Build up more of q_samples.
-      q_samples.col(inbetween_idx + i) = q.col(i);
-      q_samples.block(0, inbetween_idx + i + 1, nq, t_inbetween[i].size()) =
-          q_inbetween.block(0, inbetween_idx, nq, t_inbetween[i].size());
-      inbetween_idx += static_cast<int>(t_inbetween[i].size());
-    }
-    q_samples.col(nT + num_inbetween_tsamples - 1) = q.col(nT - 1);
+    // Index into y_scalar/dy_scalar where the next constraint should
+    // be stored.
+    int y_idx = num_single_time_rows_;
 
     // Using the q_samples assembled above which includes the
     // inbetween data, evaluate any multiple time kinematic
@@ -337,6 +357,25 @@ class IKInbetweenConstraint : public drake::solvers::Constraint {
   const IKTrajectoryHelper& helper_;
   const int num_constraints_;
   const RigidBodyConstraint* const* constraint_array_;
+  const int num_threads_;
+
+  // An inbetween sample, at which the single time constraints are evaluated.
+  struct InbetweenSample {
+    double t{};
+    // The column of the sample in q_samples.
+    int q_samples_col{};
+    // The first row of the sample's constraints in the output.
+    int first_row{};
+    // The diagonals of the derivatives of the sample's q with respect to the
+    // q at each knot (one column per knot), qdot0 and qdotf.
+    Eigen::MatrixXd dq_dqknot;
+    Eigen::VectorXd dq_dqd0;
+    Eigen::VectorXd dq_dqdf;
+  };
+  std::vector<InbetweenSample> samples_;
+  // The number of rows of the single time constraints, which precede the
+  // multiple time constraints in the output.
+  int num_single_time_rows_{};
 };
 
 }  // anonymous namespace
@@ -411,14 +450,20 @@ void inverseKinTrajBackend(RigidBodyTree<double>* model, const int nT,
   q_initial_guess.resize(nq * nT, 1);
   prog.SetInitialGuess(q, q_initial_guess);
 
+  // The initial guesses of qdot0 and qdotf, which warm start the
+  // solver when they come from a previously solved trajectory.
+  VectorXd qd0_seed(nq);
+  VectorXd qdf_seed(nq);
+  ikoptions.getqdSeed(qd0_seed, qdf_seed);
+
   // Apply the appropriate bounding box to qdot0.  If the initial
-  // state is fixed, set the bounding box to be the same as the
-  // initial guess.
+  // state is fixed, set the bounding box (and the initial guess) to
+  // the midpoint of the qd0 bounds.
   VectorXd qd0_lb(nq);
   VectorXd qd0_ub(nq);
   ikoptions.getqd0(qd0_lb, qd0_ub);
-  VectorXd qd0_seed = (qd0_lb + qd0_ub) / 2;
   if (fix_initial_state) {
+    qd0_seed = (qd0_lb + qd0_ub) / 2;
     prog.AddBoundingBoxConstraint(qd0_seed, qd0_seed, qdot0);
   } else {
     prog.AddBoundingBoxConstraint(qd0_lb, qd0_ub, qdot0);
@@ -429,7 +474,6 @@ void inverseKinTrajBackend(RigidBodyTree<double>* model, const int nT,
   VectorXd qdf_lb(nq);
   VectorXd qdf_ub(nq);
   ikoptions.getqdf(qdf_lb, qdf_ub);
-  VectorXd qdf_seed = (qdf_lb + qdf_ub) / 2;
   prog.AddBoundingBoxConstraint(qdf_lb, qdf_ub, qdotf);
   prog.SetInitialGuess(qdotf, qdf_seed);
 
@@ -525,8 +569,9 @@ void inverseKinTrajBackend(RigidBodyTree<double>* model, const int nT,
   // Build an additional constraint to handle the "inbetween" samples
   // (if present).
   std::shared_ptr<drake::solvers::Constraint> inbetween_constraint =
-      std::make_shared<IKInbetweenConstraint>(model, helper, num_constraints,
-                                              constraint_array);
+      std::make_shared<IKInbetweenConstraint>(
+          model, helper, num_constraints, constraint_array,
+          std::max(1, ikoptions.getNumThreads()));
   if (inbetween_constraint->num_constraints() > 0) {
     prog.AddConstraint(inbetween_constraint, {q, qdot0, qdotf});
   }
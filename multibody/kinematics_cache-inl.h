@@ -39,6 +39,9 @@ KinematicsCache<T>::KinematicsCache(
       v(Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(num_velocities_)),
       velocity_vector_valid(false) {
   DRAKE_DEMAND(num_joint_positions.size() == num_joint_velocities.size());
+  // The elements have fixed-capacity storage, so reserving them up front makes
+  // this the only allocation of the per-body kinematics.
+  elements_.reserve(num_joint_positions.size());
   for (int body_id = 0;
        body_id < static_cast<int>(num_joint_positions.size()); ++body_id) {
     elements_.emplace_back(num_joint_positions[body_id],
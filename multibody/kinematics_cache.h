@@ -18,6 +18,12 @@
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/joints/drake_joint.h"
 
+/// The kinematics of a single body, as stored in a KinematicsCache.
+///
+/// All matrices have fixed-capacity storage, sized for the largest joint
+/// (DrakeJoint::MAX_NUM_POSITIONS and DrakeJoint::MAX_NUM_VELOCITIES), so that
+/// an element is a single block of memory with no heap allocations of its own
+/// (for scalar types that don't allocate).
 template <typename T>
 class KinematicsCacheElement {
  public:
@@ -73,6 +79,7 @@ class KinematicsCacheElement {
 template <typename T>
 class KinematicsCache {
  private:
+  // The elements of all bodies, stored contiguously in body index order.
   std::vector<KinematicsCacheElement<T>,
               Eigen::aligned_allocator<KinematicsCacheElement<T>>> elements_;
   int num_positions_;
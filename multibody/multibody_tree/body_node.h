@@ -1038,6 +1038,189 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     const Matrix6<T> Pplus_PB_W_mat = P_B_W.CopyToFullMatrix6() - g_PB_W * HTxP;
     get_mutable_Pplus_PB_W(abc) = ArticulatedBodyInertia<T>(
         0.5 * (Pplus_PB_W_mat + Pplus_PB_W_mat.transpose()));
+
+    // Store the quantities needed by the velocity dependent passes of the
+    // articulated body algorithm.
+    abc->get_mutable_P_B_W(topology_.index) = P_B_W;
+    abc->get_mutable_ldlt_D_B(topology_.index) = ldlt_D_B;
+    abc->get_mutable_g_PB_W(topology_.index) = g_PB_W;
+  }
+
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// the velocity dependent quantities of the articulated body algorithm for
+  /// this node. Given the articulated body inertias already stored in `abc`,
+  /// it computes the _articulated body force bias_ `zplus_PB_W` for this node,
+  /// that is, the force bias of this node's articulated body about Bo,
+  /// expressed in W, once projected across its inboard mobilizer (see
+  /// Section 7.1 of [Jain 2010]).
+  ///
+  /// @param[in] context
+  ///   The context with the state of the MultibodyTree model.
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with `context`.
+  /// @param[in] vc
+  ///   An already updated velocity kinematics cache in sync with `context`.
+  /// @param[in] abc
+  ///   An articulated body inertia cache already updated with
+  ///   MultibodyTree::CalcArticulatedBodyInertiaCache().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix of this node's mobilizer, see
+  ///   CalcArticulatedBodyInertiaCache_TipToBase().
+  /// @param[in] A0_WB_array
+  ///   The spatial accelerations `A_WB` of all bodies, ordered by
+  ///   BodyNodeIndex, for a zero vector of generalized accelerations. These
+  ///   are the velocity dependent (Coriolis and centrifugal) contributions.
+  /// @param[in] Fapplied_Bo_W
+  ///   The spatial force applied on this node's body B, at Bo and expressed in
+  ///   W. It can be zero.
+  /// @param[in] tau_applied
+  ///   The generalized forces applied on this node's mobilizer. It can have
+  ///   size zero, meaning no generalized forces are applied.
+  /// @param[out] Ab_WB_array
+  ///   On output, the entry for this node contains the spatial acceleration
+  ///   bias `Ab_WB`, defined so that `A_WB = Φᵀ(p_PB) A_WP + H_PB_W v̇_B +
+  ///   Ab_WB`. Entries for the children of this node must already be updated.
+  /// @param[out] zplus_PB_W_array
+  ///   On output, the entry for this node contains `zplus_PB_W`. Entries for
+  ///   the children of this node must already be updated.
+  /// @param[out] nu_array
+  ///   On output, the entries for this node's mobilities contain
+  ///   `nu_B = D_B⁻¹ e_B`, with `e_B` the articulated body hinge force bias.
+  ///
+  /// @pre This method must have already been called for all the child nodes
+  /// of `this` node.
+  /// @throws when called on the _root_ node or if an output is nullptr.
+  void CalcArticulatedBodyForceBias_TipToBase(
+      const MultibodyTreeContext<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      const std::vector<SpatialAcceleration<T>>& A0_WB_array,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      std::vector<SpatialAcceleration<T>>* Ab_WB_array,
+      std::vector<SpatialForce<T>>* zplus_PB_W_array,
+      EigenPtr<VectorX<T>> nu_array) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(Ab_WB_array != nullptr);
+    DRAKE_THROW_UNLESS(zplus_PB_W_array != nullptr);
+    DRAKE_THROW_UNLESS(nu_array != nullptr);
+    DRAKE_DEMAND(
+        tau_applied.size() == get_num_mobilizer_velocites() ||
+        tau_applied.size() == 0);
+
+    // Notation as in CalcArticulatedBodyInertiaCache_TipToBase(), and:
+    //  - b_Bo_W the gyroscopic spatial force on B, about Bo and expressed in W.
+    //  - z_B_W the articulated body force bias of B, such that the spatial
+    //    force on B through its inboard mobilizer, at Bo and expressed in W,
+    //    is F_B_W = P_B_W A_WB + z_B_W.
+    //
+    // The force bias accumulates the contributions from all children:
+    //   z_B_W = b_Bo_W - Fapplied_Bo_W
+    //         + Σᵢ Φ(p_BCᵢ_W) (zplus_BCᵢ_W + Pplus_BCᵢ_W Ab_WCᵢ)           (1)
+    // The articulated body hinge force bias and its mobility-space
+    // counterpart are:
+    //   e_B = tau_applied - H_PB_Wᵀ z_B_W                                  (2)
+    //   nu_B = D_B⁻¹ e_B                                                   (3)
+    // and the force bias projected across the mobilizer is:
+    //   zplus_PB_W = z_B_W + g_PB_W e_B                                    (4)
+
+    // Compute the acceleration bias Ab_WB = A0_WB - Φᵀ(p_PB) A0_WP.
+    const Vector3<T> p_PoBo_W =
+        get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const SpatialAcceleration<T>& A0_WB = get_A_WB_from_array(A0_WB_array);
+    const SpatialAcceleration<T>& A0_WP = get_A_WP_from_array(A0_WB_array);
+    get_mutable_A_WB_from_array(Ab_WB_array) = SpatialAcceleration<T>(
+        A0_WB.get_coeffs() - RigidlyShift(A0_WP, p_PoBo_W).get_coeffs());
+
+    // Gyroscopic force, computed as the total force when A_WB = 0.
+    SpatialForce<T> z_B_W;
+    CalcBodySpatialForceGivenItsSpatialAcceleration(
+        context, pc, vc, SpatialAcceleration<T>::Zero(), &z_B_W);
+    z_B_W -= Fapplied_Bo_W;
+
+    // Add the contributions from all children using (1).
+    const Matrix3<T>& R_WB = get_X_WB(pc).linear();
+    for (const BodyNode<T>* child : children_) {
+      const Vector3<T> p_CoBo_W = -(R_WB * child->get_X_PB(pc).translation());
+      const ArticulatedBodyInertia<T>& Pplus_BC_W = child->get_Pplus_PB_W(abc);
+      const SpatialAcceleration<T>& Ab_WC =
+          child->get_A_WB_from_array(*Ab_WB_array);
+      const SpatialForce<T>& zplus_BC_W =
+          (*zplus_PB_W_array)[child->index()];
+      const SpatialForce<T> zplus_BC_W_total(
+          zplus_BC_W.get_coeffs() + Pplus_BC_W * Ab_WC.get_coeffs());
+      z_B_W += zplus_BC_W_total.Shift(p_CoBo_W);
+    }
+
+    // Compute e_B and nu_B using (2) and (3).
+    VectorUpTo6<T> e_B = -H_PB_W.transpose() * z_B_W.get_coeffs();
+    if (tau_applied.size() != 0) e_B += tau_applied;
+    get_mutable_velocities_from_array(nu_array) =
+        abc.get_ldlt_D_B(topology_.index).solve(e_B);
+
+    // Compute zplus_PB_W using (4).
+    const MatrixUpTo6<T>& g_PB_W = abc.get_g_PB_W(topology_.index);
+    (*zplus_PB_W_array)[topology_.index] =
+        SpatialForce<T>(z_B_W.get_coeffs() + g_PB_W * e_B);
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop to compute
+  /// the generalized accelerations of this node's mobilizer in the final pass
+  /// of the articulated body algorithm, as well as the spatial acceleration
+  /// `A_WB` of this node's body B.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache.
+  /// @param[in] abc
+  ///   An articulated body inertia cache already updated with
+  ///   MultibodyTree::CalcArticulatedBodyInertiaCache().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix of this node's mobilizer.
+  /// @param[in] Ab_WB_array
+  ///   The spatial acceleration biases computed by
+  ///   CalcArticulatedBodyForceBias_TipToBase().
+  /// @param[in] nu_array
+  ///   The mobility-space biases computed by
+  ///   CalcArticulatedBodyForceBias_TipToBase().
+  /// @param[out] A_WB_array
+  ///   On output, the entry for this node contains `A_WB`. The entry for the
+  ///   parent node must already be updated.
+  /// @param[out] vdot
+  ///   On output, the entries for this node's mobilities contain the
+  ///   generalized accelerations `v̇_B`.
+  ///
+  /// @throws when called on the _root_ node or if an output is nullptr.
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      const std::vector<SpatialAcceleration<T>>& Ab_WB_array,
+      const VectorX<T>& nu_array,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(A_WB_array != nullptr);
+    DRAKE_THROW_UNLESS(vdot != nullptr);
+
+    // The acceleration of B with zero mobilizer accelerations is:
+    //   Aplus_WB = Φᵀ(p_PB) A_WP + Ab_WB
+    // Then, from H_PB_Wᵀ F_B_W = tau_applied with F_B_W = P_B_W A_WB + z_B_W,
+    //   v̇_B = nu_B - g_PB_Wᵀ Aplus_WB
+    //   A_WB = Aplus_WB + H_PB_W v̇_B
+    const Vector3<T> p_PoBo_W =
+        get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const SpatialAcceleration<T> Aplus_WB(
+        RigidlyShift(get_A_WP_from_array(*A_WB_array), p_PoBo_W).get_coeffs() +
+        get_A_WB_from_array(Ab_WB_array).get_coeffs());
+
+    auto vdot_B = get_mutable_velocities_from_array(vdot);
+    vdot_B = get_velocities_from_array(nu_array) -
+        abc.get_g_PB_W(topology_.index).transpose() * Aplus_WB.get_coeffs();
+
+    get_mutable_A_WB_from_array(A_WB_array) =
+        SpatialAcceleration<T>(Aplus_WB.get_coeffs() + H_PB_W * vdot_B);
   }
 
  protected:
@@ -1435,6 +1618,19 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     Ftot_BBo_W = M_B_W * A_WB + b_Bo_W;
   }
 
+  // Returns the spatial acceleration A_WQ = Φᵀ(p_PoQ_W) A_WP of a point Q
+  // rigidly attached to a frame P with spatial acceleration A_WP, ignoring the
+  // velocity dependent (centripetal) term. That is, the angular acceleration
+  // is unchanged and the translational acceleration is a_WQ = a_WP +
+  // alpha_WP x p_PoQ_W. This is the linear operator of the articulated body
+  // recursions; velocity dependent terms are accounted for separately.
+  static SpatialAcceleration<T> RigidlyShift(
+      const SpatialAcceleration<T>& A_WP, const Vector3<T>& p_PoQ_W) {
+    return SpatialAcceleration<T>(
+        A_WP.rotational(),
+        A_WP.translational() + A_WP.rotational().cross(p_PoQ_W));
+  }
+
   // Implementation for MultibodyTreeElement::DoSetTopology().
   // At MultibodyTree::Finalize() time, each body retrieves its topology
   // from the parent MultibodyTree.
@@ -0,0 +1,150 @@
+#include "drake/multibody/multibody_tree/mass_matrix_factorization.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(
+    const MultibodyTreeTopology& topology) {
+  DRAKE_DEMAND(topology.is_valid());
+  const int nv = topology.num_velocities();
+  parent_velocity_.resize(nv, -1);
+
+  // For each node, the index of the last generalized velocity in the path
+  // from the world to that node, inclusive, or -1 if there is none.
+  // Nodes are ordered in BFT order and therefore parents are visited before
+  // their children.
+  std::vector<int> last_velocity_in_path(topology.get_num_body_nodes(), -1);
+  for (BodyNodeIndex node_index(1);
+       node_index < topology.get_num_body_nodes(); ++node_index) {
+    const BodyNodeTopology& node = topology.get_body_node(node_index);
+    int parent = last_velocity_in_path[node.parent_body_node];
+    const int start = node.mobilizer_velocities_start_in_v;
+    for (int i = start; i < start + node.num_mobilizer_velocities; ++i) {
+      DRAKE_DEMAND(parent < i);
+      parent_velocity_[i] = parent;
+      parent = i;
+    }
+    last_velocity_in_path[node_index] = parent;
+  }
+
+  LD_.setZero(nv, nv);
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::Factorize(
+    const Eigen::Ref<const MatrixX<T>>& M) {
+  const int n = size();
+  if (M.rows() != n || M.cols() != n) {
+    throw std::runtime_error(
+        "The mass matrix has size " + std::to_string(M.rows()) + "x" +
+        std::to_string(M.cols()) + " but this factorization expects a " +
+        std::to_string(n) + "x" + std::to_string(n) + " matrix.");
+  }
+  is_factorized_ = false;
+
+  // Only copy the entries in the sparsity pattern.
+  LD_.setZero();
+  for (int k = 0; k < n; ++k) {
+    for (int i = k; i >= 0; i = parent_velocity_[i]) LD_(k, i) = M(k, i);
+  }
+
+  // LTDL algorithm in Table 6.3 of [Featherstone 2008]. Notice the outer loop
+  // runs from the tips to the base so that each step only modifies entries
+  // for generalized velocities closer to the base.
+  for (int k = n - 1; k >= 0; --k) {
+    if (!(LD_(k, k) > 0)) {
+      throw std::runtime_error(
+          "The mass matrix is not positive definite. Failure at generalized "
+          "velocity " + std::to_string(k) + ".");
+    }
+    for (int i = parent_velocity_[k]; i >= 0; i = parent_velocity_[i]) {
+      const T a = LD_(k, i) / LD_(k, k);
+      for (int j = i; j >= 0; j = parent_velocity_[j]) {
+        LD_(i, j) -= a * LD_(k, j);
+      }
+      LD_(k, i) = a;
+    }
+  }
+  is_factorized_ = true;
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveWithLowerFactorTransposeInPlace(
+    EigenPtr<MatrixX<T>> B) const {
+  // Solves Lᵀ Y = B, with Lᵀ upper triangular, by backward substitution.
+  for (int i = size() - 1; i >= 0; --i) {
+    for (int j = parent_velocity_[i]; j >= 0; j = parent_velocity_[j]) {
+      B->row(j) -= LD_(i, j) * B->row(i);
+    }
+  }
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveWithLowerFactorInPlace(
+    EigenPtr<MatrixX<T>> B) const {
+  // Solves L Y = B, with L lower triangular, by forward substitution.
+  for (int i = 0; i < size(); ++i) {
+    for (int j = parent_velocity_[i]; j >= 0; j = parent_velocity_[j]) {
+      B->row(i) -= LD_(i, j) * B->row(j);
+    }
+  }
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> B) const {
+  DRAKE_DEMAND(is_factorized());
+  DRAKE_DEMAND(B != nullptr);
+  DRAKE_DEMAND(B->rows() == size());
+  SolveWithLowerFactorTransposeInPlace(B);
+  for (int i = 0; i < size(); ++i) B->row(i) /= LD_(i, i);
+  SolveWithLowerFactorInPlace(B);
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const MatrixX<T>>& B) const {
+  MatrixX<T> X = B;
+  SolveInPlace(&X);
+  return X;
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::CalcInverseTimesJacobianTranspose(
+    const Eigen::Ref<const MatrixX<T>>& J) const {
+  DRAKE_DEMAND(J.cols() == size());
+  return Solve(J.transpose());
+}
+
+template <typename T>
+MatrixX<T>
+MassMatrixFactorization<T>::CalcJacobianTimesInverseTimesJacobianTranspose(
+    const Eigen::Ref<const MatrixX<T>>& J) const {
+  DRAKE_DEMAND(is_factorized());
+  DRAKE_DEMAND(J.cols() == size());
+  // Y = L⁻ᵀJᵀ, so that JM⁻¹Jᵀ = YᵀD⁻¹Y.
+  MatrixX<T> Y = J.transpose();
+  SolveWithLowerFactorTransposeInPlace(&Y);
+  const VectorX<T> Dinv = LD_.diagonal().cwiseInverse();
+  return Y.transpose() * Dinv.asDiagonal() * Y;
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::MakeLowerFactor() const {
+  DRAKE_DEMAND(is_factorized());
+  MatrixX<T> L = LD_.template triangularView<Eigen::StrictlyLower>();
+  L.diagonal().setOnes();
+  return L;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class drake::multibody::MassMatrixFactorization)
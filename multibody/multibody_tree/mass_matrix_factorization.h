@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/multibody_tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+
+/// This class stores the sparse `LᵀDL` factorization of the mass matrix `M(q)`
+/// of a MultibodyTree model, with L a unit lower triangular matrix and D a
+/// diagonal matrix, as described in Section 6.5 of [Featherstone 2008].
+///
+/// The factorization exploits the branch-induced sparsity of the mass matrix.
+/// Entry `M(i, j)` of the mass matrix, with `i > j`, can only be non-zero if
+/// the generalized velocity `j` belongs to the mobilizer of a body B or of one
+/// of B's ancestors, with B the body whose mobilizer contains the generalized
+/// velocity `i`. The factorization preserves this sparsity pattern, and
+/// therefore L has the same sparsity pattern as the lower triangle of
+/// `M(q)`. This pattern is fully described by the _parent velocities array_
+/// `λ`, where `λ(i)` is the index of the generalized velocity that precedes
+/// `i` in the path from the world to the body whose mobilizer contains `i`,
+/// or -1 if there is no such generalized velocity.
+///
+/// For a model with n generalized velocities and depth d, measured in number
+/// of generalized velocities, the factorization costs `O(nd²)` operations and
+/// each solve costs `O(nd)` operations, compared to the `O(n³)` and `O(n²)`
+/// operations of a dense factorization. For a serial chain `d = n` and the
+/// costs match those of a dense factorization, though branched models such as
+/// hands or humanoids benefit significantly.
+///
+/// Usage:
+/// @code
+///   MassMatrixFactorization<double> factorization(model.get_topology());
+///   model.CalcMassMatrixFactorization(context, &factorization);
+///   // Computes M⁻¹Jᵀ.
+///   MatrixX<double> MinvJt = factorization.Solve(J.transpose());
+/// @endcode
+///
+/// - [Featherstone 2008] Featherstone, R., 2008.
+///     Rigid body dynamics algorithms. Springer.
+///
+/// @tparam T The scalar type. Must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+/// - double
+/// - AutoDiffXd
+///
+/// They are already available to link against in the containing library.
+template <typename T>
+class MassMatrixFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MassMatrixFactorization)
+
+  /// Constructs a factorization for the mass matrix of a MultibodyTree model
+  /// with the given MultibodyTreeTopology. The sparsity pattern is computed
+  /// from `topology`, though no factorization is performed until Factorize()
+  /// is called.
+  /// @pre `topology` must be valid, see MultibodyTreeTopology::is_valid().
+  explicit MassMatrixFactorization(const MultibodyTreeTopology& topology);
+
+  /// Returns the size n of the mass matrix, which equals the number of
+  /// generalized velocities of the model.
+  int size() const { return static_cast<int>(parent_velocity_.size()); }
+
+  /// Returns the parent velocities array `λ` describing the sparsity pattern
+  /// of the mass matrix. See this class's documentation for details.
+  const std::vector<int>& get_parent_velocities() const {
+    return parent_velocity_;
+  }
+
+  /// Returns `true` if Factorize() has been successfully called.
+  bool is_factorized() const { return is_factorized_; }
+
+  /// Computes the `LᵀDL` factorization of the mass matrix `M`, of size
+  /// size() x size(). Only the entries of the lower triangle of `M` in the
+  /// sparsity pattern described by get_parent_velocities() are accessed.
+  /// @throws std::runtime_error if `M` does not have the right size or if it
+  /// is not positive definite.
+  void Factorize(const Eigen::Ref<const MatrixX<T>>& M);
+
+  /// Returns `X = M⁻¹B`. The number of rows in `B` must equal size().
+  /// Typical uses include computing generalized accelerations `v̇ = M⁻¹tau`, or
+  /// the product `M⁻¹Jᵀ` for a Jacobian J, with `B = Jᵀ`.
+  /// @pre Factorize() has been successfully called.
+  MatrixX<T> Solve(const Eigen::Ref<const MatrixX<T>>& B) const;
+
+  /// Computes `M⁻¹B` in place, overwriting `B`.
+  /// @pre Factorize() has been successfully called.
+  void SolveInPlace(EigenPtr<MatrixX<T>> B) const;
+
+  /// Returns the product `M⁻¹Jᵀ` for the Jacobian `J`, with as many columns as
+  /// size(). This is equivalent to `Solve(J.transpose())`.
+  /// @pre Factorize() has been successfully called.
+  MatrixX<T> CalcInverseTimesJacobianTranspose(
+      const Eigen::Ref<const MatrixX<T>>& J) const;
+
+  /// Returns the product `JM⁻¹Jᵀ` for the Jacobian `J`, with as many columns
+  /// as size(). When J is the Jacobian of a frame's spatial velocity, this is
+  /// the inverse of the operational space inertia of that frame. This method
+  /// computes `Y = L⁻ᵀJᵀ` and takes advantage of the symmetry of the result,
+  /// `JM⁻¹Jᵀ = YᵀD⁻¹Y`.
+  /// @pre Factorize() has been successfully called.
+  MatrixX<T> CalcJacobianTimesInverseTimesJacobianTranspose(
+      const Eigen::Ref<const MatrixX<T>>& J) const;
+
+  /// Returns the unit lower triangular factor L as a dense matrix.
+  /// @pre Factorize() has been successfully called.
+  MatrixX<T> MakeLowerFactor() const;
+
+  /// Returns the diagonal of the factor D.
+  /// @pre Factorize() has been successfully called.
+  VectorX<T> get_diagonal() const { return LD_.diagonal(); }
+
+ private:
+  // Computes B ← L⁻ᵀB in place.
+  void SolveWithLowerFactorTransposeInPlace(EigenPtr<MatrixX<T>> B) const;
+
+  // Computes B ← L⁻¹B in place.
+  void SolveWithLowerFactorInPlace(EigenPtr<MatrixX<T>> B) const;
+
+  // Parent velocities array λ, of size n.
+  std::vector<int> parent_velocity_;
+
+  // In-place factorization: the strictly lower triangle stores L, within the
+  // sparsity pattern given by λ, and the diagonal stores D. Entries outside
+  // the sparsity pattern are zero.
+  MatrixX<T> LD_;
+
+  bool is_factorized_{false};
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -378,16 +378,17 @@ class SpatialAcceleration : public SpatialVector<SpatialAcceleration, T> {
     const Vector3<T>& w_PB_E = V_PB_E.rotational();
     const Vector3<T>& v_PBo_E = V_PB_E.translational();
 
-    // Compute all the terms within curly brackets in the derivation above which
-    // correspond to the Shift() operation:
-    SpatialAcceleration<T> A_WB_E = this->Shift(p_PoBo_E, w_WP_E);
-    // Adds non-linear coupling of angular velocities:
-    A_WB_E.rotational() += (A_PB_E.rotational() + w_WP_E.cross(w_PB_E));
+    const Vector3<T>& alpha_WP_E = this->rotational();
+    const Vector3<T>& a_WPo_E = this->translational();
 
-    // Adds Coriolis and translational acceleration of Bo in P.
-    A_WB_E.translational() +=
-        (A_PB_E.translational() + 2.0 * w_WP_E.cross(v_PBo_E));
-    return A_WB_E;
+    // Eq. (13) evaluated in a single pass. The centrifugal and Coriolis terms
+    // share the cross product with w_WP:
+    //   w_WP x w_WP x p_PoBo + 2 w_WP x v_PB = w_WP x (w_WP x p_PoBo + 2 v_PB)
+    // which saves the temporaries of composing Shift() with the additions.
+    return SpatialAcceleration<T>(
+        alpha_WP_E + A_PB_E.rotational() + w_WP_E.cross(w_PB_E),
+        a_WPo_E + A_PB_E.translational() + alpha_WP_E.cross(p_PoBo_E) +
+            w_WP_E.cross(w_WP_E.cross(p_PoBo_E) + 2.0 * v_PBo_E));
   }
 };
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_throw.h"
 #include "drake/geometry/frame_id_vector.h"
@@ -14,6 +15,37 @@ namespace drake {
 namespace multibody {
 namespace multibody_plant {
 
+namespace {
+
+// Returns `true` if the states `a` and `b` hold exactly the same values, in
+// which case kinematics computed for one are valid for the other. For
+// AutoDiffXd, the derivatives must be the same as well.
+bool IsSameState(const VectorX<double>& a,
+                 const Eigen::Ref<const VectorX<double>>& b) {
+  return a.size() == b.size() && (a.array() == b.array()).all();
+}
+
+bool IsSameState(const VectorX<AutoDiffXd>& a,
+                 const Eigen::Ref<const VectorX<AutoDiffXd>>& b) {
+  if (a.size() != b.size()) return false;
+  for (int i = 0; i < a.size(); ++i) {
+    // N.B. A Ref to const returns its coefficients by value, therefore they
+    // are read in place to avoid both copies and dangling references.
+    const AutoDiffXd& a_i = a.data()[i];
+    const AutoDiffXd& b_i = b.data()[i];
+    const Eigen::VectorXd& a_derivatives = a_i.derivatives();
+    const Eigen::VectorXd& b_derivatives = b_i.derivatives();
+    if (a_i.value() != b_i.value() ||
+        a_derivatives.size() != b_derivatives.size() ||
+        !(a_derivatives.array() == b_derivatives.array()).all()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
 #define DRAKE_MBP_THROW_IF_FINALIZED() ThrowIfFinalized(__func__)
@@ -60,6 +92,7 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other) {
   body_index_to_frame_id_ = other.body_index_to_frame_id_;
   geometry_id_to_body_index_ = other.geometry_id_to_body_index_;
   geometry_id_to_visual_index_ = other.geometry_id_to_visual_index_;
+  use_articulated_body_algorithm_ = other.use_articulated_body_algorithm_;
   // MultibodyTree::CloneToScalar() already called MultibodyTree::Finalize() on
   // the new MultibodyTree on U. Therefore we only Finilize the plant's
   // internals (and not the MultibodyTree).
@@ -212,27 +245,35 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
     }
   }
 
-  model_->CalcMassMatrixViaInverseDynamics(context, &M);
-
-  // WARNING: to reduce memory foot-print, we use the input applied arrays also
-  // as output arrays. This means that both the array of applied body forces and
-  // the array of applied generalized forces get overwritten on output. This is
-  // not important in this case since we don't need their values anymore.
-  // Please see the documentation for CalcInverseDynamics() for details.
-
-  // With vdot = 0, this computes:
-  //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
-  std::vector<SpatialForce<T>>& F_BBo_W_array = forces.mutable_body_forces();
-  VectorX<T>& tau_array = forces.mutable_generalized_forces();
-
-  model_->CalcInverseDynamics(
-      context, pc, vc, vdot,
-      F_BBo_W_array, tau_array,
-      &A_WB_array,
-      &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
-      &tau_array);
-
-  vdot = M.ldlt().solve(-tau_array);
+  if (use_articulated_body_algorithm_) {
+    model_->CalcForwardDynamics(
+        context, pc, vc,
+        forces.body_forces(), forces.generalized_forces(), &vdot);
+  } else {
+    model_->CalcMassMatrixViaInverseDynamics(context, pc, &M);
+
+    // WARNING: to reduce memory foot-print, we use the input applied arrays
+    // also as output arrays. This means that both the array of applied body
+    // forces and the array of applied generalized forces get overwritten on
+    // output. This is not important in this case since we don't need their
+    // values anymore. Please see the documentation for CalcInverseDynamics()
+    // for details.
+
+    // With vdot = 0, this computes:
+    //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
+    std::vector<SpatialForce<T>>& F_BBo_W_array =
+        forces.mutable_body_forces();
+    VectorX<T>& tau_array = forces.mutable_generalized_forces();
+
+    model_->CalcInverseDynamics(
+        context, pc, vc, vdot,
+        F_BBo_W_array, tau_array,
+        &A_WB_array,
+        &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
+        &tau_array);
+
+    vdot = M.ldlt().solve(-tau_array);
+  }
 
   auto v = x.bottomRows(nv);
   VectorX<T> xdot(this->num_multibody_states());
@@ -378,8 +419,10 @@ void MultibodyPlant<T>::CalcFramePoseOutput(
   DRAKE_MBP_THROW_IF_NOT_FINALIZED();
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
-  FramePoseVector<T> new_poses(get_source_id().value());
-  std::vector<Isometry3<T>>& pose_data = new_poses.mutable_vector();
+  // The poses are written in place; the output was sized by
+  // AllocateFramePoseOutput() and its source id never changes.
+  DRAKE_ASSERT(poses->get_source_id() == get_source_id().value());
+  std::vector<Isometry3<T>>& pose_data = poses->mutable_vector();
   pose_data.resize(body_index_to_frame_id_.size());
   // TODO(amcastro-tri): Make use of Body::EvalPoseInWorld(context) once caching
   // lands.
@@ -389,7 +432,6 @@ void MultibodyPlant<T>::CalcFramePoseOutput(
     const Body<T>& body = model_->get_body(body_index);
     pose_data[pose_index++] = pc.get_X_WB(body.node_index());
   }
-  *poses = new_poses;
 }
 
 template <typename T>
@@ -412,22 +454,37 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
   // declare cache entries when that lands.
   pc_ = std::make_unique<PositionKinematicsCache<T>>(model_->get_topology());
   vc_ = std::make_unique<VelocityKinematicsCache<T>>(model_->get_topology());
+  pc_q_ = nullopt;
+  vc_x_ = nullopt;
 }
 
 template<typename T>
 const PositionKinematicsCache<T>& MultibodyPlant<T>::EvalPositionKinematics(
     const systems::Context<T>& context) const {
-  // TODO(amcastro-tri): Replace Calc() for an actual Eval() when caching lands.
-  model_->CalcPositionKinematicsCache(context, pc_.get());
+  // TODO(amcastro-tri): Replace by an actual Eval() when caching lands.
+  const auto x = dynamic_cast<const systems::BasicVector<T>&>(
+      context.get_continuous_state_vector()).get_value();
+  const auto q = x.head(num_positions());
+  if (!pc_q_ || !IsSameState(*pc_q_, q)) {
+    model_->CalcPositionKinematicsCache(context, pc_.get());
+    pc_q_ = VectorX<T>(q);
+    ++num_position_kinematics_updates_;
+  }
   return *pc_;
 }
 
 template<typename T>
 const VelocityKinematicsCache<T>& MultibodyPlant<T>::EvalVelocityKinematics(
     const systems::Context<T>& context) const {
-  // TODO(amcastro-tri): Replace Calc() for an actual Eval() when caching lands.
+  // TODO(amcastro-tri): Replace by an actual Eval() when caching lands.
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
-  model_->CalcVelocityKinematicsCache(context, pc, vc_.get());
+  const auto x = dynamic_cast<const systems::BasicVector<T>&>(
+      context.get_continuous_state_vector()).get_value();
+  if (!vc_x_ || !IsSameState(*vc_x_, x)) {
+    model_->CalcVelocityKinematicsCache(context, pc, vc_.get());
+    vc_x_ = VectorX<T>(x);
+    ++num_velocity_kinematics_updates_;
+  }
   return *vc_;
 }
 
@@ -553,6 +553,23 @@ class MultibodyPlant : public systems::LeafSystem<T> {
     return *model_;
   }
 
+  /// Sets whether `this` plant computes the generalized accelerations for its
+  /// time derivatives with the O(n) articulated body algorithm, see
+  /// MultibodyTree::CalcForwardDynamics(), instead of forming and factorizing
+  /// the mass matrix, an O(n³) operation. Both approaches produce the same
+  /// results up to round-off errors. The articulated body algorithm pays off
+  /// for models with many degrees of freedom. Defaults to `false`.
+  void set_use_articulated_body_algorithm(bool use_articulated_body_algorithm) {
+    use_articulated_body_algorithm_ = use_articulated_body_algorithm;
+  }
+
+  /// Returns `true` if `this` plant uses the articulated body algorithm to
+  /// compute its time derivatives.
+  /// @see set_use_articulated_body_algorithm().
+  bool use_articulated_body_algorithm() const {
+    return use_articulated_body_algorithm_;
+  }
+
   /// Returns `true` if this %MultibodyPlant was finalized with a call to
   /// Finalize().
   /// @see Finalize().
@@ -596,6 +613,9 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   // scalar conversion.
   template <typename U> friend class MultibodyPlant;
 
+  // Friend class to facilitate testing.
+  friend class MultibodyPlantTester;
+
   // Helper method for throwing an exception within public methods that should
   // not be called post-finalize. The invoking method should pass its name so
   // that the error message can include that detail.
@@ -641,11 +661,14 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   // Helper method to declare cache entries to be allocated in the context.
   void DeclareCacheEntries();
 
-  // Helper method to Eval() position kinematics cached in the context.
+  // Helper method to Eval() position kinematics. They are only recomputed
+  // when the generalized positions in `context` differ from those of the last
+  // evaluation.
   const PositionKinematicsCache<T>& EvalPositionKinematics(
       const systems::Context<T>& context) const;
 
-  // Helper method to Eval() velocity kinematics cached in the context.
+  // Helper method to Eval() velocity kinematics. They are only recomputed
+  // when the state in `context` differs from that of the last evaluation.
   const VelocityKinematicsCache<T>& EvalVelocityKinematics(
       const systems::Context<T>& context) const;
 
@@ -741,14 +764,28 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   // calls are performed on the same instance of GS.
   const geometry::GeometrySystem<T>* geometry_system_{nullptr};
 
+  // Whether to compute time derivatives with the articulated body algorithm.
+  bool use_articulated_body_algorithm_{false};
+
   // Input/Output port indexes:
   int actuation_port_{-1};
   int continuous_state_output_port_{-1};
 
   // Temporary solution for fake cache entries to help statbilize the API.
+  // Until the framework invalidates cache entries on state changes, each entry
+  // is tagged with the state it was computed from, so that the time
+  // derivatives and the geometry poses output computed for one state share a
+  // single kinematics pass.
   // TODO(amcastro-tri): Remove these when caching lands.
   std::unique_ptr<PositionKinematicsCache<T>> pc_;
   std::unique_ptr<VelocityKinematicsCache<T>> vc_;
+  // The generalized positions pc_ was computed for, and the state [q; v] vc_
+  // was computed for. Empty if pc_ or vc_ were never computed.
+  mutable optional<VectorX<T>> pc_q_;
+  mutable optional<VectorX<T>> vc_x_;
+  // The number of times pc_ and vc_ were computed, for testing.
+  mutable int num_position_kinematics_updates_{0};
+  mutable int num_velocity_kinematics_updates_{0};
 };
 
 /// @cond
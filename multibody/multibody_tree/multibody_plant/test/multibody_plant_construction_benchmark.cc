@@ -0,0 +1,100 @@
+// Measures the time to construct and finalize a MultibodyPlant with many
+// bodies. Run with --help for options.
+//
+// The plant is a tree in which body i (counting from one) is connected by a
+// revolute joint to body (i - 1) / fan_out, where body zero is the world.
+// Every free_body_stride-th body gets no joint, so that Finalize() connects
+// it to the world with a free mobilizer.
+//
+// The times to add the bodies and joints, to Finalize(), and to create the
+// default context are reported separately. Each of them should grow linearly
+// with the number of bodies.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/multibody/multibody_tree/joints/revolute_joint.h"
+#include "drake/multibody/multibody_tree/multibody_plant/multibody_plant.h"
+#include "drake/multibody/multibody_tree/rigid_body.h"
+#include "drake/multibody/multibody_tree/spatial_inertia.h"
+#include "drake/multibody/multibody_tree/unit_inertia.h"
+
+DEFINE_int32(num_bodies, 10000, "Number of bodies, not counting the world.");
+DEFINE_int32(fan_out, 2,
+             "Number of children of each body in the tree. One makes a chain.");
+DEFINE_int32(free_body_stride, 10,
+             "Every free_body_stride-th body is a free body. Zero disables "
+             "free bodies.");
+
+namespace drake {
+namespace multibody {
+namespace multibody_plant {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_num_bodies >= 1);
+  DRAKE_DEMAND(FLAGS_fan_out >= 1);
+  DRAKE_DEMAND(FLAGS_free_body_stride >= 0);
+
+  const SpatialInertia<double> M_Bo(1.0, Vector3<double>::Zero(),
+                                    UnitInertia<double>::SolidSphere(0.1));
+  MultibodyPlant<double> plant;
+
+  Clock::time_point start = Clock::now();
+  std::vector<const Body<double>*> bodies{&plant.world_body()};
+  bodies.reserve(FLAGS_num_bodies + 1);
+  for (int i = 1; i <= FLAGS_num_bodies; ++i) {
+    bodies.push_back(
+        &plant.AddRigidBody("body" + std::to_string(i), M_Bo));
+    if (FLAGS_free_body_stride > 0 && i % FLAGS_free_body_stride == 0) {
+      continue;
+    }
+    const Body<double>& parent = *bodies[(i - 1) / FLAGS_fan_out];
+    plant.AddJoint<RevoluteJoint>(
+        "joint" + std::to_string(i), parent, Isometry3<double>::Identity(),
+        *bodies.back(), {}, Vector3<double>::UnitZ());
+  }
+  const double add_seconds = SecondsSince(start);
+
+  start = Clock::now();
+  plant.Finalize();
+  const double finalize_seconds = SecondsSince(start);
+
+  start = Clock::now();
+  const auto context = plant.CreateDefaultContext();
+  const double context_seconds = SecondsSince(start);
+
+  std::cout << plant.num_bodies() - 1 << " bodies, "
+            << plant.num_positions() << " positions:\n"
+            << "  add bodies and joints:  " << add_seconds << " s\n"
+            << "  Finalize():             " << finalize_seconds << " s\n"
+            << "  CreateDefaultContext(): " << context_seconds << " s\n";
+  return 0;
+}
+
+}  // namespace
+}  // namespace multibody_plant
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Measures the time to construct and finalize a MultibodyPlant with many "
+      "bodies.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::multibody::multibody_plant::do_main();
+}
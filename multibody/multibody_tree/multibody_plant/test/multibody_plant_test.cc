@@ -48,6 +48,23 @@ using systems::VectorBase;
 
 namespace multibody {
 namespace multibody_plant {
+
+// Friend class to access the number of kinematics computations of a plant.
+class MultibodyPlantTester {
+ public:
+  MultibodyPlantTester() = delete;
+
+  static int num_position_kinematics_updates(
+      const MultibodyPlant<double>& plant) {
+    return plant.num_position_kinematics_updates_;
+  }
+
+  static int num_velocity_kinematics_updates(
+      const MultibodyPlant<double>& plant) {
+    return plant.num_velocity_kinematics_updates_;
+  }
+};
+
 namespace {
 
 // This test creates a simple model for an acrobot using MultibodyPlant and
@@ -205,10 +222,11 @@ class AcrobotPlantTests : public ::testing::Test {
   // Verifies the computation performed by MultibodyPlant::CalcTimeDerivatives()
   // for the acrobot model. The comparison is carried out against a benchmark
   // with hand written dynamics.
-  void VerifyCalcTimeDerivatives(double theta1, double theta2,
-                                 double theta1dot, double theta2dot,
-                                 double input_torque) {
-    const double kTolerance = 5 * std::numeric_limits<double>::epsilon();
+  void VerifyCalcTimeDerivatives(
+      double theta1, double theta2,
+      double theta1dot, double theta2dot,
+      double input_torque,
+      double tolerance = 5 * std::numeric_limits<double>::epsilon()) {
 
     // Set the state:
     shoulder_->set_angle(context_.get(), theta1);
@@ -235,7 +253,7 @@ class AcrobotPlantTests : public ::testing::Test {
     xdot_expected << Vector2d(theta1dot, theta2dot), vdot_expected;
 
     EXPECT_TRUE(CompareMatrices(
-        xdot, xdot_expected, kTolerance, MatrixCompareType::relative));
+        xdot, xdot_expected, tolerance, MatrixCompareType::relative));
   }
 
  protected:
@@ -291,6 +309,26 @@ TEST_F(AcrobotPlantTests, CalcTimeDerivatives) {
       2.0);                     /* Actuation torque */
 }
 
+// Verifies that MultibodyPlant::CalcTimeDerivatives() produces the same
+// results when using the articulated body algorithm.
+TEST_F(AcrobotPlantTests, CalcTimeDerivativesWithArticulatedBodyAlgorithm) {
+  EXPECT_FALSE(plant_->use_articulated_body_algorithm());
+  plant_->set_use_articulated_body_algorithm(true);
+  EXPECT_TRUE(plant_->use_articulated_body_algorithm());
+  // Round-off errors accumulate differently than with the mass matrix.
+  const double kTolerance = 50 * std::numeric_limits<double>::epsilon();
+  VerifyCalcTimeDerivatives(
+      -M_PI / 5.0, M_PI / 2.0,  /* joint's angles */
+      0.5, 1.0,                 /* joint's angular rates */
+      -1.0,                     /* Actuation torque */
+      kTolerance);
+  VerifyCalcTimeDerivatives(
+      -M_PI, -M_PI / 2.0,       /* joint's angles */
+      -1.5, -2.5,               /* joint's angular rates */
+      2.0,                      /* Actuation torque */
+      kTolerance);
+}
+
 // Verifies the process of geometry registration with a GeometrySystem for the
 // acrobot model.
 TEST_F(AcrobotPlantTests, GeometryRegistration) {
@@ -426,6 +464,60 @@ TEST_F(AcrobotPlantTests, EvalContinuousStateOutputPort) {
   EXPECT_EQ(state_out.CopyToVector(), state.CopyToVector());
 }
 
+// Verifies that the geometry poses output and the time derivatives share the
+// kinematics computed for one state, and that kinematics are recomputed once
+// the state changes.
+TEST_F(AcrobotPlantTests, KinematicsAreComputedOncePerState) {
+  auto num_position_updates = [this]() {
+    return MultibodyPlantTester::num_position_kinematics_updates(*plant_);
+  };
+  auto num_velocity_updates = [this]() {
+    return MultibodyPlantTester::num_velocity_kinematics_updates(*plant_);
+  };
+
+  shoulder_->set_angle(context_.get(), M_PI / 3.0);
+  elbow_->set_angle(context_.get(), -0.2);
+  shoulder_->set_angular_rate(context_.get(), -0.5);
+  elbow_->set_angular_rate(context_.get(), 2.5);
+  std::unique_ptr<AbstractValue> poses_value =
+      plant_->get_geometry_poses_output_port().Allocate(*context_);
+
+  const int num_position_updates0 = num_position_updates();
+  const int num_velocity_updates0 = num_velocity_updates();
+  plant_->get_geometry_poses_output_port().Calc(*context_, poses_value.get());
+  plant_->CalcTimeDerivatives(*context_, derivatives_.get());
+  plant_->CalcTimeDerivatives(*context_, derivatives_.get());
+  plant_->get_geometry_poses_output_port().Calc(*context_, poses_value.get());
+  EXPECT_EQ(num_position_updates(), num_position_updates0 + 1);
+  EXPECT_EQ(num_velocity_updates(), num_velocity_updates0 + 1);
+
+  // A change in v invalidates the velocity kinematics only.
+  elbow_->set_angular_rate(context_.get(), 1.5);
+  plant_->CalcTimeDerivatives(*context_, derivatives_.get());
+  plant_->get_geometry_poses_output_port().Calc(*context_, poses_value.get());
+  EXPECT_EQ(num_position_updates(), num_position_updates0 + 1);
+  EXPECT_EQ(num_velocity_updates(), num_velocity_updates0 + 2);
+
+  // A change in q invalidates both.
+  shoulder_->set_angle(context_.get(), M_PI / 4.0);
+  plant_->get_geometry_poses_output_port().Calc(*context_, poses_value.get());
+  plant_->CalcTimeDerivatives(*context_, derivatives_.get());
+  EXPECT_EQ(num_position_updates(), num_position_updates0 + 2);
+  EXPECT_EQ(num_velocity_updates(), num_velocity_updates0 + 3);
+
+  // Kinematics are keyed on the state values, not on the context, and
+  // therefore are shared with a copy of the context.
+  std::unique_ptr<Context<double>> context_copy = context_->Clone();
+  plant_->CalcTimeDerivatives(*context_copy, derivatives_.get());
+  EXPECT_EQ(num_position_updates(), num_position_updates0 + 2);
+  EXPECT_EQ(num_velocity_updates(), num_velocity_updates0 + 3);
+
+  // The time derivatives computed from the shared kinematics are still
+  // correct.
+  VerifyCalcTimeDerivatives(M_PI / 4.0, -0.2, -0.5, 1.5, 0.0);
+  EXPECT_EQ(num_position_updates(), num_position_updates0 + 2);
+}
+
 GTEST_TEST(MultibodyPlantTest, MapVelocityToQdotAndBack) {
   MultibodyPlant<double> plant;
   // This test is purely kinematic. Therefore we leave the spatial inertia
@@ -3,6 +3,7 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
@@ -12,6 +13,7 @@
 #include "drake/multibody/multibody_tree/quaternion_floating_mobilizer.h"
 #include "drake/multibody/multibody_tree/rigid_body.h"
 #include "drake/multibody/multibody_tree/spatial_inertia.h"
+#include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
 
 namespace drake {
 namespace multibody {
@@ -580,6 +582,27 @@ void MultibodyTree<T>::CalcMassMatrixViaInverseDynamics(
   DoCalcMassMatrixViaInverseDynamics(context, pc, H);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixViaInverseDynamics(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc, EigenPtr<MatrixX<T>> H) const {
+  DRAKE_DEMAND(H != nullptr);
+  DRAKE_DEMAND(H->rows() == num_velocities());
+  DRAKE_DEMAND(H->cols() == num_velocities());
+  DoCalcMassMatrixViaInverseDynamics(context, pc, H);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context,
+    MassMatrixFactorization<T>* factorization) const {
+  DRAKE_DEMAND(factorization != nullptr);
+  DRAKE_DEMAND(factorization->size() == num_velocities());
+  MatrixX<T> M(num_velocities(), num_velocities());
+  CalcMassMatrixViaInverseDynamics(context, &M);
+  factorization->Factorize(M);
+}
+
 template <typename T>
 void MultibodyTree<T>::DoCalcMassMatrixViaInverseDynamics(
     const systems::Context<T>& context,
@@ -974,6 +997,358 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamics(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array,
+    const Eigen::Ref<const VectorX<T>>& tau_applied_array,
+    EigenPtr<VectorX<T>> vdot) const {
+  DRAKE_DEMAND(vdot != nullptr);
+  DRAKE_DEMAND(vdot->size() == num_velocities());
+  const int Fapplied_size = static_cast<int>(Fapplied_Bo_W_array.size());
+  DRAKE_DEMAND(Fapplied_size == num_bodies() || Fapplied_size == 0);
+  const int tau_applied_size = tau_applied_array.size();
+  DRAKE_DEMAND(
+      tau_applied_size == num_velocities() || tau_applied_size == 0);
+
+  const auto& mbt_context =
+      dynamic_cast<const MultibodyTreeContext<T>&>(context);
+
+  // TODO(bobbyluig): Eval the articulated body inertias from the cache.
+  ArticulatedBodyInertiaCache<T> abc(get_topology());
+  CalcArticulatedBodyInertiaCache(context, pc, &abc);
+
+  std::vector<Vector6<T>> H_PB_W_cache(num_velocities());
+  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+
+  // Velocity dependent spatial accelerations, i.e. A_WB for v̇ = 0.
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  CalcSpatialAccelerationsFromVdot(
+      context, pc, vc, VectorX<T>::Zero(num_velocities()), &A_WB_array);
+
+  // Per node acceleration biases, articulated body force biases and
+  // mobility-space biases.
+  std::vector<SpatialAcceleration<T>> Ab_WB_array(num_bodies());
+  std::vector<SpatialForce<T>> zplus_PB_W_array(num_bodies());
+  VectorX<T> nu_array(num_velocities());
+
+  // Vector of generalized forces per mobilizer.
+  // It has zero size if no forces are applied.
+  VectorUpTo6<T> tau_applied_mobilizer(0);
+
+  // Spatial force applied on B at Bo.
+  // It is left initialized to zero if no forces are applied.
+  SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+
+  // Tip-to-base recursion for the force biases, skipping the world.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      if (tau_applied_size != 0) {
+        tau_applied_mobilizer =
+            node.get_mobilizer().get_generalized_forces_from_array(
+                tau_applied_array);
+      }
+      if (Fapplied_size != 0) {
+        Fapplied_Bo_W = Fapplied_Bo_W_array[body_node_index];
+      }
+
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      node.CalcArticulatedBodyForceBias_TipToBase(
+          mbt_context, pc, vc, abc, H_PB_W, A_WB_array,
+          Fapplied_Bo_W, tau_applied_mobilizer,
+          &Ab_WB_array, &zplus_PB_W_array, &nu_array);
+    }
+  }
+
+  // Base-to-tip recursion for the accelerations. The world does not move, so
+  // its spatial acceleration is zero. A_WB_array is reused to store the
+  // spatial accelerations of the solution.
+  A_WB_array[world_index()] = SpatialAcceleration<T>::Zero();
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          pc, abc, H_PB_W, Ab_WB_array, nu_array, &A_WB_array, vdot);
+    }
+  }
+}
+
+namespace {
+// Spatial cross products for spatial vectors stored as Vector6 objects with
+// the rotational component first. Given a spatial motion vector m = [w; v],
+// CrossMotion() computes m ×ₘ y for a motion vector y and CrossForce()
+// computes m ×f f for a force vector f.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& m, const Vector6<T>& y) {
+  Vector6<T> m_cross_y;
+  m_cross_y.template head<3>() =
+      m.template head<3>().cross(y.template head<3>());
+  m_cross_y.template tail<3>() =
+      m.template head<3>().cross(y.template tail<3>()) +
+      m.template tail<3>().cross(y.template head<3>());
+  return m_cross_y;
+}
+
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  Vector6<T> m_cross_f;
+  m_cross_f.template head<3>() =
+      m.template head<3>().cross(f.template head<3>()) +
+      m.template tail<3>().cross(f.template tail<3>());
+  m_cross_f.template tail<3>() =
+      m.template head<3>().cross(f.template tail<3>());
+  return m_cross_f;
+}
+}  // namespace
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv,
+    EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  const int nq = num_positions();
+  const int nv = num_velocities();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  DRAKE_DEMAND(dtau_dq != nullptr);
+  DRAKE_DEMAND(dtau_dq->rows() == nv && dtau_dq->cols() == nq);
+  DRAKE_DEMAND(dtau_dv != nullptr);
+  DRAKE_DEMAND(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+  DRAKE_DEMAND(dtau_dvdot != nullptr);
+  DRAKE_DEMAND(dtau_dvdot->rows() == nv && dtau_dvdot->cols() == nv);
+
+  const auto& mbt_context =
+      dynamic_cast<const MultibodyTreeContext<T>&>(context);
+  const auto v = mbt_context.get_velocities();
+
+  // Gravity is the only force element with an analytical derivative. It is
+  // accounted for as a fictitious acceleration -g_W of the world body.
+  Vector3<T> g_W = Vector3<T>::Zero();
+  for (const auto& force_element : owned_force_elements_) {
+    const auto* gravity = dynamic_cast<const UniformGravityFieldElement<T>*>(
+        force_element.get());
+    if (gravity == nullptr) {
+      throw std::logic_error(
+          "CalcInverseDynamicsDerivatives(): only UniformGravityFieldElement "
+          "force elements are supported.");
+    }
+    g_W += gravity->gravity_vector().template cast<T>();
+  }
+
+  // ∂tau/∂v̇ is the mass matrix.
+  DoCalcMassMatrixViaInverseDynamics(context, pc, dtau_dvdot);
+
+  std::vector<Vector6<T>> H_PB_W_cache(nv);
+  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+
+  // All spatial vectors below are expressed in the world frame W and taken
+  // about the world origin Wo. Contrary to spatial vectors taken about each
+  // body origin, they do not need to be shifted when propagated between
+  // bodies and their derivatives follow from spatial cross products only.
+  // Per generalized velocity: the column S of the across node Jacobian and the
+  // velocity t_Mo in the inboard frame F of the outboard frame origin Mo.
+  std::vector<Vector6<T>> S(nv);
+  std::vector<Vector3<T>> t_Mo(nv);
+  std::vector<BodyNodeIndex> velocity_node(nv);
+  // Per body node: spatial inertia, spatial velocity, spatial momentum,
+  // spatial acceleration (including the fictitious gravity acceleration) and
+  // total spatial force on the subtree outboard of the node, including its own
+  // body.
+  const int num_nodes = num_bodies();
+  std::vector<Matrix6<T>> I(num_nodes);
+  std::vector<Vector6<T>> V(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> h(num_nodes);
+  std::vector<Vector6<T>> A(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> F(num_nodes, Vector6<T>::Zero());
+  A[world_index()].template tail<3>() = -g_W;
+
+  // Base-to-tip recursion for the nominal accelerations and body forces.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const BodyNodeTopology& node_topology = node.get_topology();
+      const BodyNodeIndex parent_index = node_topology.parent_body_node;
+      const int v_start = node_topology.mobilizer_velocities_start_in_v;
+      const int nm = node_topology.num_mobilizer_velocities;
+
+      const Isometry3<T>& X_WB = pc.get_X_WB(node_index);
+      const Matrix3<T> R_WB = X_WB.linear();
+      const Vector3<T> p_WBo = X_WB.translation();
+      const Vector3<T> p_BoMo_W =
+          R_WB * node.get_mobilizer().outboard_frame().CalcPoseInBodyFrame(
+              context).translation();
+
+      Vector6<T> S_v = Vector6<T>::Zero();
+      Vector6<T> S_vdot = Vector6<T>::Zero();
+      Vector3<T> v_Mo = Vector3<T>::Zero();
+      for (int k = 0; k < nm; ++k) {
+        const int iv = v_start + k;
+        const Vector6<T>& H_PB_W = H_PB_W_cache[iv];
+        const Vector3<T> w = H_PB_W.template head<3>();
+        S[iv] << w, H_PB_W.template tail<3>() + p_WBo.cross(w);
+        t_Mo[iv] = H_PB_W.template tail<3>() + w.cross(p_BoMo_W);
+        velocity_node[iv] = node_index;
+        S_v += S[iv] * v(iv);
+        S_vdot += S[iv] * known_vdot(iv);
+        v_Mo += t_Mo[iv] * v(iv);
+      }
+
+      const SpatialVelocity<T>& V_WB = vc.get_V_WB(node_index);
+      V[node_index] << V_WB.rotational(),
+          V_WB.translational() + p_WBo.cross(V_WB.rotational());
+
+      // Since H_FM is constant in F, the time derivative of S⋅v is
+      // V_WP ×ₘ S⋅v plus the change due to the motion of Mo in F.
+      A[node_index] = A[parent_index] + S_vdot +
+          CrossMotion(V[parent_index], S_v);
+      A[node_index].template tail<3>() += v_Mo.cross(S_v.template head<3>());
+
+      I[node_index] = node.body().CalcSpatialInertiaInBodyFrame(mbt_context).
+          ReExpress(R_WB).Shift(-p_WBo).CopyToFullMatrix6();
+      h[node_index] = I[node_index] * V[node_index];
+      F[node_index] = I[node_index] * A[node_index] +
+          CrossForce(V[node_index], h[node_index]);
+    }
+  }
+
+  // Tip-to-base recursion for the nominal subtree forces.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNodeIndex parent_index =
+          body_nodes_[node_index]->get_topology().parent_body_node;
+      F[parent_index] += F[node_index];
+    }
+  }
+
+  // Directional derivatives of tau along each generalized velocity, either as
+  // a change of the velocity itself or as the infinitesimal motion of the
+  // positions along the generalized velocity direction. In the latter case
+  // the subtree outboard of the mobilizer moves rigidly with the spatial
+  // velocity sigma = S[j], which moves all the spatial quantities attached to
+  // it. Local names prefixed with "d" denote directional derivatives.
+  MatrixX<T> dtau_dq_tangent(nv, nv);
+  std::vector<Vector6<T>> dS(nv);
+  std::vector<Vector6<T>> dV(num_nodes), dA(num_nodes), dF(num_nodes);
+  std::vector<bool> moved(num_nodes);
+  for (const bool along_positions : {true, false}) {
+    for (int j = 0; j < nv; ++j) {
+      const BodyNodeIndex moving_node = velocity_node[j];
+      const Vector6<T>& sigma = S[j];
+      dV[world_index()].setZero();
+      dA[world_index()].setZero();
+      dF[world_index()].setZero();
+      moved[world_index()] = false;
+
+      for (int depth = 1; depth < tree_height(); ++depth) {
+        for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+          const BodyNodeTopology& node_topology =
+              body_nodes_[node_index]->get_topology();
+          const BodyNodeIndex parent_index = node_topology.parent_body_node;
+          const int v_start = node_topology.mobilizer_velocities_start_in_v;
+          const int nm = node_topology.num_mobilizer_velocities;
+          const bool moves_with_parent = moved[parent_index];
+          moved[node_index] = along_positions &&
+              (node_index == moving_node || moves_with_parent);
+
+          Vector6<T> S_v = Vector6<T>::Zero();
+          Vector6<T> dS_v = Vector6<T>::Zero();
+          Vector6<T> dS_vdot = Vector6<T>::Zero();
+          Vector3<T> v_Mo = Vector3<T>::Zero();
+          Vector3<T> dv_Mo = Vector3<T>::Zero();
+          for (int k = 0; k < nm; ++k) {
+            const int iv = v_start + k;
+            dS[iv].setZero();
+            if (moves_with_parent) {
+              // H_FM moves rigidly with its inboard frame F.
+              dS[iv] = CrossMotion(sigma, S[iv]);
+              dv_Mo += sigma.template head<3>().cross(t_Mo[iv]) * v(iv);
+            } else if (moved[node_index]) {
+              // Frame F stays still while Mo moves with velocity t_Mo[j].
+              dS[iv].template tail<3>() =
+                  t_Mo[j].cross(S[iv].template head<3>());
+            }
+            S_v += S[iv] * v(iv);
+            dS_v += dS[iv] * v(iv);
+            dS_vdot += dS[iv] * known_vdot(iv);
+            v_Mo += t_Mo[iv] * v(iv);
+          }
+          if (!along_positions && moving_node == node_index) {
+            dS_v += S[j];
+            dv_Mo += t_Mo[j];
+          }
+
+          const Vector6<T>& V_WP = V[parent_index];
+          dV[node_index] = dV[parent_index] + dS_v;
+          dA[node_index] = dA[parent_index] + dS_vdot +
+              CrossMotion(dV[parent_index], S_v) + CrossMotion(V_WP, dS_v);
+          dA[node_index].template tail<3>() +=
+              dv_Mo.cross(S_v.template head<3>()) +
+              v_Mo.cross(dS_v.template head<3>());
+
+          const Matrix6<T>& I_B = I[node_index];
+          const Vector6<T>& V_WB = V[node_index];
+          Vector6<T> dh = I_B * dV[node_index];
+          dF[node_index] = I_B * dA[node_index] +
+              CrossForce(dV[node_index], h[node_index]);
+          if (moved[node_index]) {
+            // The inertia moves with sigma so that for any motion vector y,
+            // dI⋅y = sigma ×f (I⋅y) - I⋅(sigma ×ₘ y).
+            const Vector6<T> I_A = I_B * A[node_index];
+            dF[node_index] += CrossForce(sigma, I_A) -
+                I_B * CrossMotion(sigma, A[node_index]);
+            dh += CrossForce(sigma, h[node_index]) -
+                I_B * CrossMotion(sigma, V_WB);
+          }
+          dF[node_index] += CrossForce(V_WB, dh);
+        }
+      }
+
+      for (int depth = tree_height() - 1; depth > 0; --depth) {
+        for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+          const BodyNodeTopology& node_topology =
+              body_nodes_[node_index]->get_topology();
+          const int v_start = node_topology.mobilizer_velocities_start_in_v;
+          const int nm = node_topology.num_mobilizer_velocities;
+          for (int k = 0; k < nm; ++k) {
+            const int iv = v_start + k;
+            const T dtau = dS[iv].dot(F[node_index]) +
+                S[iv].dot(dF[node_index]);
+            if (along_positions) {
+              dtau_dq_tangent(iv, j) = dtau;
+            } else {
+              (*dtau_dv)(iv, j) = dtau;
+            }
+          }
+          dF[node_topology.parent_body_node] += dF[node_index];
+        }
+      }
+    }
+  }
+
+  // Map the derivatives along the generalized velocities to derivatives with
+  // respect to the generalized positions.
+  VectorX<T> qdot(nq);
+  VectorX<T> N_plus_column(nv);
+  MatrixX<T> N_plus(nv, nq);
+  for (int l = 0; l < nq; ++l) {
+    qdot = VectorX<T>::Unit(nq, l);
+    MapQDotToVelocity(context, qdot, &N_plus_column);
+    N_plus.col(l) = N_plus_column;
+  }
+  *dtau_dq = dtau_dq_tangent * N_plus;
+}
+
 // Explicitly instantiates on the most common scalar types.
 template class MultibodyTree<double>;
 template class MultibodyTree<AutoDiffXd>;
@@ -18,6 +18,7 @@
 #include "drake/multibody/multibody_tree/frame.h"
 #include "drake/multibody/multibody_tree/joint_actuator.h"
 #include "drake/multibody/multibody_tree/joints/joint.h"
+#include "drake/multibody/multibody_tree/mass_matrix_factorization.h"
 #include "drake/multibody/multibody_tree/mobilizer.h"
 #include "drake/multibody/multibody_tree/multibody_forces.h"
 #include "drake/multibody/multibody_tree/multibody_tree_context.h"
@@ -1473,6 +1474,32 @@ class MultibodyTree {
   void CalcMassMatrixViaInverseDynamics(
       const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
 
+  /// An overload of CalcMassMatrixViaInverseDynamics() for callers that
+  /// already hold the position kinematics `pc` of the model for the state
+  /// stored in `context`, so that they are not computed a second time.
+  void CalcMassMatrixViaInverseDynamics(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc, EigenPtr<MatrixX<T>> H) const;
+
+  /// Computes the sparse `LᵀDL` factorization of the mass matrix `M(q)` of the
+  /// model, where the generalized positions q are stored in `context`. The
+  /// factorization exploits the sparsity induced by the topology of the model
+  /// and allows computing products such as `M⁻¹tau` and `M⁻¹Jᵀ` without a
+  /// dense factorization. See MassMatrixFactorization for details.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[out] factorization
+  ///   A valid (non-null) pointer to a factorization created with the topology
+  ///   of `this` model, see get_topology(). This method aborts if
+  ///   `factorization` is nullptr or if it does not have the proper size.
+  ///
+  /// @note The mass matrix is computed with
+  /// CalcMassMatrixViaInverseDynamics(), an O(n²) operation.
+  void CalcMassMatrixFactorization(
+      const systems::Context<T>& context,
+      MassMatrixFactorization<T>* factorization) const;
+
   /// Computes the bias term `C(q, v)v` containing Coriolis and gyroscopic
   /// effects of the multibody equations of motion: <pre>
   ///   M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W
@@ -1572,6 +1599,117 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       ArticulatedBodyInertiaCache<T>* abc) const;
 
+  /// Computes the generalized accelerations `v̇` of the model given the state
+  /// stored in `context` and a set of applied forces, by solving the forward
+  /// dynamics problem: <pre>
+  ///   M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// </pre>
+  /// using the articulated body algorithm. That is, this method performs the
+  /// tip-to-base pass of CalcArticulatedBodyInertiaCache() followed by a
+  /// second tip-to-base pass to compute the velocity dependent articulated
+  /// body force biases and a final base-to-tip pass computing `v̇`, without
+  /// ever forming the mass matrix `M(q)`. See Section 7.1 of [Jain 2010].
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] vc
+  ///   A velocity kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] Fapplied_Bo_W_array
+  ///   A vector containing the spatial force `Fapplied_Bo_W` applied on each
+  ///   body at the body's frame origin `Bo` and expressed in the world frame W.
+  ///   It must be of size num_bodies() and ordered by BodyNodeIndex, or of size
+  ///   zero if no spatial forces are applied.
+  /// @param[in] tau_applied_array
+  ///   An array of applied generalized forces for the entire model. It must be
+  ///   of size num_velocities(), or of size zero if no generalized forces are
+  ///   applied.
+  /// @param[out] vdot
+  ///   A valid (non-null) pointer to a vector of size num_velocities(). On
+  ///   output it contains the generalized accelerations of the model.
+  ///
+  /// @warning The computational cost of this method is O(n) with n the number
+  /// of bodies, compared to the O(n³) cost of building and factorizing the
+  /// mass matrix. However, the intermediate results are stored in local
+  /// temporaries and therefore each call performs dynamic memory
+  /// allocations.
+  ///
+  /// @pre The position kinematics `pc` must have been previously updated with a
+  /// call to CalcPositionKinematicsCache().
+  /// @pre The velocity kinematics `vc` must have been previously updated with a
+  /// call to CalcVelocityKinematicsCache().
+  void CalcForwardDynamics(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array,
+      const Eigen::Ref<const VectorX<T>>& tau_applied_array,
+      EigenPtr<VectorX<T>> vdot) const;
+
+  /// Computes the partial derivatives of the generalized forces <pre>
+  ///   tau(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_g(q)
+  /// </pre>
+  /// returned by inverse dynamics, where `tau_g(q)` are the generalized
+  /// forces due to the UniformGravityFieldElement in `this` model, if any.
+  /// The derivatives are computed analytically with a forward propagation of
+  /// the recursive Newton-Euler algorithm along one direction per generalized
+  /// velocity, without instantiating a %MultibodyTree on AutoDiffXd. The
+  /// computational cost is O(n⋅nv) with n the number of bodies and nv the
+  /// number of generalized velocities.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] vc
+  ///   A velocity kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] known_vdot
+  ///   A vector with the generalized accelerations `v̇` for the full model.
+  ///   It must be of size num_velocities().
+  /// @param[out] dtau_dq
+  ///   A valid (non-null) pointer to a matrix of size num_velocities() x
+  ///   num_positions(). On output it contains `∂tau/∂q`.
+  /// @param[out] dtau_dv
+  ///   A valid (non-null) pointer to a squared matrix of size
+  ///   num_velocities(). On output it contains `∂tau/∂v`.
+  /// @param[out] dtau_dvdot
+  ///   A valid (non-null) pointer to a squared matrix of size
+  ///   num_velocities(). On output it contains `∂tau/∂v̇ = M(q)`.
+  ///
+  /// @note `∂tau/∂q` is computed as `D⋅N⁺(q)` where `D` is the derivative of
+  /// `tau` along the directions of the generalized velocities and `N⁺(q)` is
+  /// the mapping from time derivatives of the generalized positions to
+  /// generalized velocities, see MapQDotToVelocity(). Therefore
+  /// `∂tau/∂q⋅N(q) = D` holds exactly while, for mobilizers with more positions
+  /// than velocities such as the QuaternionFloatingMobilizer, derivatives
+  /// along directions that leave the unit quaternions manifold are not
+  /// meaningful.
+  ///
+  /// @throws std::logic_error if `this` model contains a force element other
+  /// than a UniformGravityFieldElement.
+  ///
+  /// @warning The implementation assumes that the across-mobilizer Jacobian
+  /// `H_FM` of every mobilizer is constant when expressed in its inboard
+  /// frame F, as it is the case for all the mobilizers in this library.
+  ///
+  /// @pre The position kinematics `pc` must have been previously updated with a
+  /// call to CalcPositionKinematicsCache().
+  /// @pre The velocity kinematics `vc` must have been previously updated with a
+  /// call to CalcVelocityKinematicsCache().
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv,
+      EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
   /// @}
   // Closes "Computational methods" Doxygen section.
 
@@ -21,6 +21,7 @@
 ///    topology can be validated against the stored topology in debug builds.
 
 #include <algorithm>
+#include <initializer_list>
 #include <queue>
 #include <string>
 #include <utility>
@@ -874,8 +875,16 @@ class MultibodyTreeTopology {
   // connecting the frames with indexes `frame` and `frame2`.
   bool IsThereAMobilizerBetweenFrames(
       FrameIndex frame1, FrameIndex frame2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_frames(frame1, frame2)) return true;
+    // Such a mobilizer is the inboard mobilizer of the body of one of the two
+    // frames, so that only those two need to be checked instead of scanning
+    // all mobilizers, which would make building the tree quadratic.
+    for (const FrameIndex frame : {frame1, frame2}) {
+      const MobilizerIndex mobilizer =
+          bodies_[frames_[frame].body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_frames(frame1, frame2)) {
+        return true;
+      }
     }
     return false;
   }
@@ -884,8 +893,13 @@ class MultibodyTreeTopology {
   // connecting the bodies with indexes `body2` and `body2`.
   bool IsThereAMobilizerBetweenBodies(
       BodyIndex body1, BodyIndex body2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_bodies(body1, body2)) return true;
+    // Such a mobilizer is the inboard mobilizer of one of the two bodies.
+    for (const BodyIndex body : {body1, body2}) {
+      const MobilizerIndex mobilizer = bodies_[body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_bodies(body1, body2)) {
+        return true;
+      }
     }
     return false;
   }
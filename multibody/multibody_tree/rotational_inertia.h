@@ -330,9 +330,15 @@ class RotationalInertia {
   ///       inertia as an inertia dyadic and dot-multiplying it by w_E.
   /// @param w_E Vector to post-multiply with `this` rotational inertia.
   /// @return The Vector that results from multiplying `this` by `w_E`.
-  // TODO(Mitiguy) Issue #6145, add direct unit test for this method.
   Vector3<T> operator*(const Vector3<T>& w_E) const {
-    return Vector3<T>(get_symmetric_matrix_view() * w_E);
+    // Written out in terms of the lower-triangular part of I_SP_E_, since the
+    // product with a self-adjoint view goes through Eigen's generic kernel,
+    // which is slow for a 3x3 matrix.
+    const Matrix3<T>& I = I_SP_E_;
+    return Vector3<T>(
+        I(0, 0) * w_E(0) + I(1, 0) * w_E(1) + I(2, 0) * w_E(2),
+        I(1, 0) * w_E(0) + I(1, 1) * w_E(1) + I(2, 1) * w_E(2),
+        I(2, 0) * w_E(0) + I(2, 1) * w_E(1) + I(2, 2) * w_E(2));
   }
 
   /// Divides `this` rotational inertia by a positive scalar (> 0).
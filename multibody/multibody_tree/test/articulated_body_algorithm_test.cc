@@ -355,6 +355,98 @@ GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ModifiedFeatherstoneExample) {
       P_WB_W_actual.CopyToFullMatrix6(), kEpsilon));
 }
 
+// Verifies the generalized accelerations computed with the articulated body
+// algorithm against those obtained with the mass matrix for a model with
+// multi-dof mobilizers and multiple branches. The model consists of the box
+// and cylinder from FeatherstoneExample, plus a second cylinder also attached
+// to the box with a Featherstone mobilizer.
+GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ForwardDynamics) {
+  // Create box (B).
+  const double Lx = 0.5, Ly = 1.2, Lz = 1.6;
+  const UnitInertia<double> G_Bcm = UnitInertia<double>::SolidBox(Lx, Ly, Lz);
+  const double mass_box = 2.4;
+  const SpatialInertia<double> M_Bcm(mass_box, Vector3d::Zero(), G_Bcm);
+
+  // Create cylinders (C and D), with their centers of mass offset from their
+  // body frame origins.
+  const double r = 0.3, L = 0.3;
+  const UnitInertia<double> G_Ccm =
+      UnitInertia<double>::SolidCylinder(r, L, Vector3d::UnitX());
+  const double mass_cylinder = 0.6;
+  const Vector3d p_CoCcm(0.1, 0.2, -0.1);
+  const SpatialInertia<double> M_Co(
+      mass_cylinder, p_CoCcm, G_Ccm.ShiftFromCenterOfMass(-p_CoCcm));
+  const Vector3d p_DoDcm(-0.2, 0.1, 0.3);
+  const SpatialInertia<double> M_Do(
+      2.0 * mass_cylinder, p_DoDcm, G_Ccm.ShiftFromCenterOfMass(-p_DoDcm));
+
+  // Create model.
+  MultibodyTree<double> model;
+
+  const RigidBody<double>& box_link = model.AddBody<RigidBody>(M_Bcm);
+  const Frame<double>& box_frame = box_link.body_frame();
+  model.AddMobilizer<SpaceXYZMobilizer>(model.world_frame(), box_frame);
+
+  const RigidBody<double>& cylinder_link = model.AddBody<RigidBody>(M_Co);
+  model.AddMobilizer<FeatherstoneMobilizer>(
+      box_frame, cylinder_link.body_frame());
+
+  const RigidBody<double>& cylinder2_link = model.AddBody<RigidBody>(M_Do);
+  model.AddMobilizer<FeatherstoneMobilizer>(
+      box_frame, cylinder2_link.body_frame());
+
+  model.Finalize();
+  std::unique_ptr<Context<double>> context = model.CreateDefaultContext();
+
+  // Set an arbitrary non-zero state.
+  const int nv = model.num_velocities();
+  ASSERT_EQ(nv, 7);
+  VectorXd x(model.num_states());
+  x << 0.3, -0.5, 0.8, M_PI_4, 0.2, -M_PI / 3, -0.1,
+       0.4, -0.2, 0.7, 1.5, -0.3, 0.9, 0.6;
+  context->get_mutable_continuous_state_vector().SetFromVector(x);
+
+  PositionKinematicsCache<double> pc(model.get_topology());
+  model.CalcPositionKinematicsCache(*context, &pc);
+  VelocityKinematicsCache<double> vc(model.get_topology());
+  model.CalcVelocityKinematicsCache(*context, pc, &vc);
+
+  // Arbitrary applied forces.
+  std::vector<SpatialForce<double>> Fapplied_Bo_W_array(
+      model.num_bodies(), SpatialForce<double>::Zero());
+  Fapplied_Bo_W_array[cylinder_link.node_index()] =
+      SpatialForce<double>(Vector3d(0.1, -0.4, 0.2), Vector3d(1.0, 0.5, -2.0));
+  Fapplied_Bo_W_array[box_link.node_index()] =
+      SpatialForce<double>(Vector3d(-0.3, 0.2, 0.6), Vector3d(0.0, -9.8, 0.0));
+  VectorXd tau_applied(nv);
+  tau_applied << 0.5, -0.1, 0.2, 1.0, -0.7, 0.3, 0.4;
+
+  VectorXd vdot(nv);
+  model.CalcForwardDynamics(
+      *context, pc, vc, Fapplied_Bo_W_array, tau_applied, &vdot);
+
+  // Solve M(q)v̇ = -tau_id, with tau_id the generalized forces computed with
+  // inverse dynamics for v̇ = 0.
+  MatrixX<double> M(nv, nv);
+  model.CalcMassMatrixViaInverseDynamics(*context, &M);
+  std::vector<SpatialAcceleration<double>> A_WB_array(model.num_bodies());
+  std::vector<SpatialForce<double>> F_BMo_W_array(model.num_bodies());
+  VectorXd tau_id(nv);
+  model.CalcInverseDynamics(
+      *context, pc, vc, VectorXd::Zero(nv), Fapplied_Bo_W_array, tau_applied,
+      &A_WB_array, &F_BMo_W_array, &tau_id);
+  const VectorXd vdot_expected = M.ldlt().solve(-tau_id);
+
+  EXPECT_TRUE(vdot.isApprox(vdot_expected, 50 * kEpsilon));
+
+  // Inverse dynamics on the solution must return the applied generalized
+  // forces.
+  model.CalcInverseDynamics(
+      *context, pc, vc, vdot, Fapplied_Bo_W_array, VectorXd(),
+      &A_WB_array, &F_BMo_W_array, &tau_id);
+  EXPECT_TRUE(tau_id.isApprox(tau_applied, 50 * kEpsilon));
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -0,0 +1,191 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/multibody/multibody_tree/joints/revolute_joint.h"
+#include "drake/multibody/multibody_tree/fixed_offset_frame.h"
+#include "drake/multibody/multibody_tree/multibody_tree.h"
+#include "drake/multibody/multibody_tree/rigid_body.h"
+#include "drake/multibody/multibody_tree/space_xyz_mobilizer.h"
+#include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using benchmarks::kuka_iiwa_robot::MakeKukaIiwaModel;
+using Eigen::Isometry3d;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-12;
+
+// Computes tau = M(q)v̇ + C(q, v)v - tau_app(q, v) with the applied forces
+// given by the force elements in `model`.
+template <typename T>
+VectorX<T> CalcTau(const MultibodyTree<T>& model, const Context<T>& context,
+                   const VectorX<T>& vdot) {
+  PositionKinematicsCache<T> pc(model.get_topology());
+  model.CalcPositionKinematicsCache(context, &pc);
+  VelocityKinematicsCache<T> vc(model.get_topology());
+  model.CalcVelocityKinematicsCache(context, pc, &vc);
+  MultibodyForces<T> forces(model);
+  model.CalcForceElementsContribution(context, pc, vc, &forces);
+  std::vector<SpatialAcceleration<T>> A_WB_array(model.num_bodies());
+  std::vector<SpatialForce<T>> F_BMo_W_array(model.num_bodies());
+  VectorX<T> tau(model.num_velocities());
+  model.CalcInverseDynamics(
+      context, pc, vc, vdot, forces.body_forces(), forces.generalized_forces(),
+      &A_WB_array, &F_BMo_W_array, &tau);
+  return tau;
+}
+
+// Verifies the analytic derivatives of inverse dynamics for `model` at the
+// state x and generalized accelerations vdot against the derivatives obtained
+// with automatic differentiation.
+void VerifyDerivatives(const MultibodyTree<double>& model,
+                       const VectorXd& x, const VectorXd& vdot) {
+  const int nq = model.num_positions();
+  const int nv = model.num_velocities();
+  std::unique_ptr<Context<double>> context = model.CreateDefaultContext();
+  context->get_mutable_continuous_state_vector().SetFromVector(x);
+
+  PositionKinematicsCache<double> pc(model.get_topology());
+  model.CalcPositionKinematicsCache(*context, &pc);
+  VelocityKinematicsCache<double> vc(model.get_topology());
+  model.CalcVelocityKinematicsCache(*context, pc, &vc);
+
+  MatrixXd dtau_dq(nv, nq);
+  MatrixXd dtau_dv(nv, nv);
+  MatrixXd dtau_dvdot(nv, nv);
+  model.CalcInverseDynamicsDerivatives(
+      *context, pc, vc, vdot, &dtau_dq, &dtau_dv, &dtau_dvdot);
+
+  // Reference derivatives with respect to [q; v; v̇].
+  std::unique_ptr<MultibodyTree<AutoDiffXd>> model_autodiff =
+      model.ToAutoDiffXd();
+  std::unique_ptr<Context<AutoDiffXd>> context_autodiff =
+      model_autodiff->CreateDefaultContext();
+  VectorXd x_vdot(nq + 2 * nv);
+  x_vdot << x, vdot;
+  VectorX<AutoDiffXd> x_vdot_autodiff(nq + 2 * nv);
+  math::initializeAutoDiff(x_vdot, x_vdot_autodiff);
+  context_autodiff->get_mutable_continuous_state_vector().SetFromVector(
+      x_vdot_autodiff.head(nq + nv));
+  const VectorX<AutoDiffXd> tau_autodiff = CalcTau(
+      *model_autodiff, *context_autodiff,
+      VectorX<AutoDiffXd>(x_vdot_autodiff.tail(nv)));
+  const MatrixXd tau_gradient = math::autoDiffToGradientMatrix(tau_autodiff);
+
+  // Derivatives with respect to q are only defined along the tangent
+  // directions q̇ = N(q)v.
+  MatrixXd N(nq, nv);
+  VectorXd qdot(nq);
+  for (int j = 0; j < nv; ++j) {
+    model.MapVelocityToQDot(*context, VectorXd::Unit(nv, j), &qdot);
+    N.col(j) = qdot;
+  }
+  EXPECT_TRUE(CompareMatrices(dtau_dq * N, tau_gradient.leftCols(nq) * N,
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, tau_gradient.middleCols(nq, nv),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dvdot, tau_gradient.rightCols(nv),
+                              kTolerance, MatrixCompareType::relative));
+}
+
+GTEST_TEST(InverseDynamicsDerivatives, KukaIiwaArm) {
+  std::unique_ptr<MultibodyTree<double>> model =
+      MakeKukaIiwaModel<double>(true /* Finalize model */, 9.81 /* gravity */);
+
+  VectorXd x(14);
+  x << M_PI / 3, M_PI / 6, M_PI / 3, M_PI / 6, M_PI / 3, M_PI / 6, M_PI / 3,
+       0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7;
+  VectorXd vdot(7);
+  vdot << 0.7, -0.6, 0.5, -0.4, 0.3, -0.2, 0.1;
+  VerifyDerivatives(*model, x, vdot);
+}
+
+// A floating torso T, connected to the world by a quaternion mobilizer, with
+// a left arm of two links, L1 and L2, connected with revolute joints and a
+// right arm R1 connected to the torso with a SpaceXYZ mobilizer.
+GTEST_TEST(InverseDynamicsDerivatives, FloatingBranchedModel) {
+  MultibodyTree<double> model;
+  const SpatialInertia<double> M_Bo(
+      1.5, Vector3d(0.1, -0.2, 0.3),
+      UnitInertia<double>::SolidBox(0.2, 0.3, 0.4).ShiftFromCenterOfMass(
+          Vector3d(-0.1, 0.2, -0.3)));
+
+  const RigidBody<double>& torso = model.AddBody<RigidBody>(M_Bo);
+  const RigidBody<double>& left1 = model.AddBody<RigidBody>(M_Bo);
+  const RigidBody<double>& right1 = model.AddBody<RigidBody>(M_Bo);
+  const RigidBody<double>& left2 = model.AddBody<RigidBody>(M_Bo);
+
+  Isometry3d X_TL = Isometry3d::Identity();
+  X_TL.translation() = Vector3d(0.0, 0.5, 0.2);
+  Isometry3d X_L1L2 = Isometry3d::Identity();
+  X_L1L2.translation() = Vector3d(0.3, 0.0, 0.0);
+  Isometry3d X_L2M = Isometry3d::Identity();
+  X_L2M.translation() = Vector3d(-0.1, 0.05, 0.2);
+  const RevoluteJoint<double>& shoulder = model.AddJoint<RevoluteJoint>(
+      "left_shoulder", torso, X_TL, left1, {}, Vector3d::UnitY());
+  const RevoluteJoint<double>& elbow = model.AddJoint<RevoluteJoint>(
+      "left_elbow", left1, X_L1L2, left2, X_L2M, Vector3d(1.0, 0.0, 1.0));
+  const FixedOffsetFrame<double>& frame_R = model.AddFrame<FixedOffsetFrame>(
+      torso.body_frame(), Isometry3d(Eigen::Translation3d(0.0, -0.5, 0.2)));
+  const SpaceXYZMobilizer<double>& right_shoulder =
+      model.AddMobilizer<SpaceXYZMobilizer>(frame_R, right1.body_frame());
+  model.AddForceElement<UniformGravityFieldElement>(Vector3d(0.0, 0.0, -9.81));
+  // The torso is connected to the world with a QuaternionFloatingMobilizer.
+  model.Finalize();
+  ASSERT_EQ(model.num_positions(), 12);
+  ASSERT_EQ(model.num_velocities(), 11);
+
+  std::unique_ptr<Context<double>> context = model.CreateDefaultContext();
+  model.SetFreeBodyPoseOrThrow(
+      torso,
+      Isometry3d(Eigen::Translation3d(0.3, -0.2, 1.1) *
+                 Eigen::AngleAxisd(0.8, Vector3d(1.0, 2.0, 3.0).normalized())),
+      context.get());
+  model.SetFreeBodySpatialVelocityOrThrow(
+      torso,
+      SpatialVelocity<double>(Vector3d(0.4, -0.7, 1.2),
+                              Vector3d(-0.5, 0.9, 0.3)),
+      context.get());
+  shoulder.set_angle(context.get(), 0.5);
+  shoulder.set_angular_rate(context.get(), -1.1);
+  elbow.set_angle(context.get(), -0.7);
+  elbow.set_angular_rate(context.get(), 0.8);
+  right_shoulder.set_angles(context.get(), Vector3d(0.2, -0.4, 0.9));
+  right_shoulder.set_angular_velocity(context.get(), Vector3d(1.3, 0.6, -0.2));
+  const VectorXd x = context->get_continuous_state_vector().CopyToVector();
+
+  VectorXd vdot(11);
+  for (int i = 0; i < 11; ++i) vdot(i) = std::cos(3.0 * i);
+  VerifyDerivatives(model, x, vdot);
+}
+
+// Several gravity fields add up.
+GTEST_TEST(InverseDynamicsDerivatives, MultipleGravityFields) {
+  std::unique_ptr<MultibodyTree<double>> model =
+      MakeKukaIiwaModel<double>(false /* Do not finalize */, 9.81);
+  model->AddForceElement<UniformGravityFieldElement>(Vector3d(1.0, 0.0, 0.0));
+  model->Finalize();
+  VectorXd x(14);
+  x << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7,
+       -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1;
+  VerifyDerivatives(*model, x, VectorXd::Zero(7));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,185 @@
+#include "drake/multibody/multibody_tree/mass_matrix_factorization.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/multibody/multibody_tree/joints/revolute_joint.h"
+#include "drake/multibody/multibody_tree/multibody_tree.h"
+#include "drake/multibody/multibody_tree/rigid_body.h"
+#include "drake/multibody/multibody_tree/space_xyz_mobilizer.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using benchmarks::kuka_iiwa_robot::MakeKukaIiwaModel;
+using Eigen::Isometry3d;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using systems::Context;
+
+constexpr double kTolerance = 100 * std::numeric_limits<double>::epsilon();
+
+// Verifies the factorization of the mass matrix of `model` for the state x,
+// comparing against results obtained with the dense mass matrix.
+void VerifyFactorization(const MultibodyTree<double>& model,
+                         const VectorXd& x) {
+  std::unique_ptr<Context<double>> context = model.CreateDefaultContext();
+  context->get_mutable_continuous_state_vector().SetFromVector(x);
+
+  const int nv = model.num_velocities();
+  MatrixXd M(nv, nv);
+  model.CalcMassMatrixViaInverseDynamics(*context, &M);
+
+  MassMatrixFactorization<double> factorization(model.get_topology());
+  EXPECT_FALSE(factorization.is_factorized());
+  model.CalcMassMatrixFactorization(*context, &factorization);
+  ASSERT_TRUE(factorization.is_factorized());
+
+  // Verify M = LᵀDL.
+  const MatrixXd L = factorization.MakeLowerFactor();
+  const VectorXd D = factorization.get_diagonal();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * D.asDiagonal() * L, M,
+                              kTolerance, MatrixCompareType::relative));
+
+  // The factor L preserves the sparsity pattern of M.
+  const std::vector<int>& lambda = factorization.get_parent_velocities();
+  for (int i = 0; i < nv; ++i) {
+    for (int j = 0; j < i; ++j) {
+      bool is_ancestor = false;
+      for (int k = lambda[i]; k >= 0; k = lambda[k]) {
+        if (k == j) is_ancestor = true;
+      }
+      if (!is_ancestor) {
+        EXPECT_EQ(M(i, j), 0.0);
+        EXPECT_EQ(L(i, j), 0.0);
+      }
+    }
+  }
+
+  // An arbitrary Jacobian-like matrix and right hand side.
+  MatrixXd J(6, nv);
+  for (int i = 0; i < J.rows(); ++i) {
+    for (int j = 0; j < nv; ++j) J(i, j) = std::sin(1.0 + i + 2.0 * j);
+  }
+  const VectorXd b = J.row(1).transpose();
+
+  const Eigen::LDLT<MatrixXd> dense_ldlt = M.ldlt();
+  const VectorXd x_solve = factorization.Solve(b);
+  EXPECT_TRUE(CompareMatrices(x_solve, dense_ldlt.solve(b),
+                              kTolerance, MatrixCompareType::relative));
+
+  const MatrixXd MinvJt = factorization.CalcInverseTimesJacobianTranspose(J);
+  EXPECT_TRUE(CompareMatrices(MinvJt, dense_ldlt.solve(J.transpose()),
+                              kTolerance, MatrixCompareType::relative));
+
+  MatrixXd B = J.transpose();
+  factorization.SolveInPlace(&B);
+  EXPECT_TRUE(CompareMatrices(B, MinvJt,
+                              kTolerance, MatrixCompareType::relative));
+
+  const MatrixXd JMinvJt =
+      factorization.CalcJacobianTimesInverseTimesJacobianTranspose(J);
+  EXPECT_TRUE(CompareMatrices(JMinvJt, J * MinvJt,
+                              kTolerance, MatrixCompareType::relative));
+}
+
+// For a serial chain every generalized velocity has the previous one as
+// parent and the factorization must match the dense factorization.
+GTEST_TEST(MassMatrixFactorization, KukaIiwaArm) {
+  std::unique_ptr<MultibodyTree<double>> model =
+      MakeKukaIiwaModel<double>(true /* Finalize model */);
+
+  MassMatrixFactorization<double> factorization(model->get_topology());
+  EXPECT_EQ(factorization.size(), 7);
+  const std::vector<int> expected_lambda = {-1, 0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(factorization.get_parent_velocities(), expected_lambda);
+
+  VectorXd x(14);
+  x << M_PI / 3, M_PI / 6, M_PI / 3, M_PI / 6, M_PI / 3, M_PI / 6, M_PI / 3,
+       0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7;
+  VerifyFactorization(*model, x);
+}
+
+// A branched model with a multi-dof mobilizer. A torso T is connected to the
+// world with a SpaceXYZ mobilizer. A left arm with two links, L1 and L2, and a
+// right arm with a single link R1 are connected to the torso with revolute
+// joints.
+GTEST_TEST(MassMatrixFactorization, BranchedModel) {
+  MultibodyTree<double> model;
+  const SpatialInertia<double> M_Bo(
+      1.5, Vector3d(0.1, -0.2, 0.3),
+      UnitInertia<double>::SolidBox(0.2, 0.3, 0.4).ShiftFromCenterOfMass(
+          Vector3d(-0.1, 0.2, -0.3)));
+
+  const RigidBody<double>& torso = model.AddBody<RigidBody>(M_Bo);
+  model.AddMobilizer<SpaceXYZMobilizer>(model.world_frame(),
+                                        torso.body_frame());
+
+  const RigidBody<double>& left1 = model.AddBody<RigidBody>(M_Bo);
+  const RigidBody<double>& right1 = model.AddBody<RigidBody>(M_Bo);
+  const RigidBody<double>& left2 = model.AddBody<RigidBody>(M_Bo);
+
+  Isometry3d X_TL = Isometry3d::Identity();
+  X_TL.translation() = Vector3d(0.0, 0.5, 0.2);
+  Isometry3d X_TR = Isometry3d::Identity();
+  X_TR.translation() = Vector3d(0.0, -0.5, 0.2);
+  Isometry3d X_L1L2 = Isometry3d::Identity();
+  X_L1L2.translation() = Vector3d(0.3, 0.0, 0.0);
+  model.AddJoint<RevoluteJoint>(
+      "left_shoulder", torso, X_TL, left1, {}, Vector3d::UnitY());
+  model.AddJoint<RevoluteJoint>(
+      "right_shoulder", torso, X_TR, right1, {}, Vector3d::UnitX());
+  model.AddJoint<RevoluteJoint>(
+      "left_elbow", left1, X_L1L2, left2, {}, Vector3d::UnitZ());
+  model.Finalize();
+
+  // Velocities are ordered base to tip: torso (0, 1, 2), left1 (3),
+  // right1 (4), left2 (5).
+  MassMatrixFactorization<double> factorization(model.get_topology());
+  EXPECT_EQ(factorization.size(), 6);
+  const std::vector<int> expected_lambda = {-1, 0, 1, 2, 2, 3};
+  EXPECT_EQ(factorization.get_parent_velocities(), expected_lambda);
+
+  VectorXd x(12);
+  x << 0.3, -0.5, 0.8, 0.7, -0.4, 1.1,
+       0.4, -0.2, 0.7, 1.5, -0.3, 0.9;
+  VerifyFactorization(model, x);
+}
+
+GTEST_TEST(MassMatrixFactorization, BadInputs) {
+  std::unique_ptr<MultibodyTree<double>> model =
+      MakeKukaIiwaModel<double>(true /* Finalize model */);
+  MassMatrixFactorization<double> factorization(model->get_topology());
+
+  // Wrong size.
+  EXPECT_THROW(factorization.Factorize(MatrixXd::Identity(3, 3)),
+               std::runtime_error);
+
+  // Not positive definite.
+  MatrixXd M = MatrixXd::Identity(7, 7);
+  M(6, 6) = -1.0;
+  EXPECT_THROW(factorization.Factorize(M), std::runtime_error);
+  EXPECT_FALSE(factorization.is_factorized());
+
+  // A diagonal matrix is trivially factorized.
+  M(6, 6) = 2.0;
+  factorization.Factorize(M);
+  EXPECT_TRUE(factorization.is_factorized());
+  EXPECT_TRUE(CompareMatrices(factorization.MakeLowerFactor(),
+                              MatrixXd::Identity(7, 7)));
+  EXPECT_TRUE(CompareMatrices(factorization.get_diagonal(), M.diagonal()));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
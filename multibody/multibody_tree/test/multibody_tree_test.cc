@@ -622,6 +622,69 @@ TEST_F(KukaIiwaModelTests, CalcFrameGeometricJacobianExpressedInWorld) {
   EXPECT_TRUE(Jv_WF_times_v.IsApprox(V_WEf, kTolerance));
 }
 
+// Verifies that the generalized accelerations computed with the articulated
+// body algorithm match those obtained by solving the equations of motion with
+// the mass matrix, for a set of applied spatial and generalized forces.
+TEST_F(KukaIiwaModelTests, CalcForwardDynamics) {
+  // Numerical tolerance used to verify numerical results. Both solutions
+  // accumulate round-off errors differently.
+  const double kTolerance = 500 * std::numeric_limits<double>::epsilon();
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+
+  // Set joint angles and rates.
+  int angle_index = 0;
+  for (const RevoluteJoint<double>* joint : joints_) {
+    joint->set_angle(context_.get(), q[angle_index]);
+    joint->set_angular_rate(context_.get(), v[angle_index]);
+    angle_index++;
+  }
+
+  PositionKinematicsCache<double> pc(model_->get_topology());
+  model_->CalcPositionKinematicsCache(*context_, &pc);
+  VelocityKinematicsCache<double> vc(model_->get_topology());
+  model_->CalcVelocityKinematicsCache(*context_, pc, &vc);
+
+  // Gravity from the force elements, plus arbitrary applied forces.
+  MultibodyForces<double> forces(*model_);
+  model_->CalcForceElementsContribution(*context_, pc, vc, &forces);
+  forces.mutable_body_forces()[end_effector_link_->node_index()] +=
+      SpatialForce<double>(Vector3d(0.3, -0.2, 0.1), Vector3d(1.0, 2.0, -3.0));
+  for (int i = 0; i < model_->num_velocities(); ++i) {
+    forces.mutable_generalized_forces()[i] += 0.1 * (i + 1);
+  }
+
+  const int nv = model_->num_velocities();
+  VectorX<double> vdot(nv);
+  model_->CalcForwardDynamics(
+      *context_, pc, vc, forces.body_forces(), forces.generalized_forces(),
+      &vdot);
+
+  // Reference solution using the mass matrix. Inverse dynamics with v̇ = 0
+  // computes C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
+  MatrixX<double> M(nv, nv);
+  model_->CalcMassMatrixViaInverseDynamics(*context_, &M);
+  std::vector<SpatialAcceleration<double>> A_WB_array(model_->num_bodies());
+  std::vector<SpatialForce<double>> F_BMo_W_array(model_->num_bodies());
+  VectorX<double> minus_tau(nv);
+  model_->CalcInverseDynamics(
+      *context_, pc, vc, VectorX<double>::Zero(nv), forces.body_forces(),
+      forces.generalized_forces(), &A_WB_array, &F_BMo_W_array, &minus_tau);
+  const VectorX<double> vdot_expected = M.ldlt().solve(-minus_tau);
+
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // With no applied forces, the arm is only affected by velocity dependent
+  // terms.
+  model_->CalcForwardDynamics(*context_, pc, vc, {}, VectorX<double>(), &vdot);
+  VectorX<double> Cv(nv);
+  model_->CalcBiasTerm(*context_, &Cv);
+  EXPECT_TRUE(CompareMatrices(vdot, M.ldlt().solve(-Cv), kTolerance,
+                              MatrixCompareType::relative));
+}
+
 }  // namespace
 }  // namespace multibody_model
 }  // namespace multibody
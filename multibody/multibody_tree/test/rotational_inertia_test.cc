@@ -477,6 +477,18 @@ GTEST_TEST(RotationalInertia, MultiplicationWithScalarFromTheLeft) {
   EXPECT_EQ(Ixs.get_products(), sxI.get_products());
 }
 
+// Test the multiplication of a rotational inertia by a vector against the
+// product with the full symmetric matrix.
+GTEST_TEST(RotationalInertia, MultiplicationWithVector) {
+  const Vector3d m(2.0,  2.3, 2.4);  // m for moments.
+  const Vector3d p(0.1, -0.1, 0.2);  // p for products.
+  const RotationalInertia<double> I(m(0), m(1), m(2),  /* moments of inertia */
+                                    p(0), p(1), p(2)); /* products of inertia */
+  const Vector3d w(1.5, -0.7, 0.3);
+  const Vector3d Iw_expected = I.CopyToFullMatrix3() * w;
+  EXPECT_TRUE((I * w).isApprox(Iw_expected, 4 * kEpsilon));
+}
+
 // Test the correctness of:
 //  - operator+=(const RotationalInertia<T>&)
 //  - operator*=(const T&)
@@ -396,6 +396,30 @@ GTEST_TEST(SpatialInertia, KineticEnergy) {
   EXPECT_NEAR(ke_WB, ke_WB_expected, 50 * kEpsilon);
 }
 
+// Verifies the products of a spatial inertia with a spatial velocity and with
+// a spatial acceleration against the product with the full 6x6 matrix.
+GTEST_TEST(SpatialInertia, ProductWithSpatialVectors) {
+  const double mass = 2.5;
+  const Vector3d com(0.1, -0.2, 0.3);
+  const UnitInertia<double> G_Bcm =
+      UnitInertia<double>::SolidBox(0.2, 0.3, 0.4);
+  const SpatialInertia<double> M_BP(
+      mass, com, G_Bcm.ShiftFromCenterOfMass(-com));
+  const Matrix6<double> M_BP_matrix = M_BP.CopyToFullMatrix6();
+
+  const SpatialVelocity<double> V(Vector3d(1.0, -2.0, 0.5),
+                                  Vector3d(0.3, 0.7, -1.1));
+  const SpatialMomentum<double> L = M_BP * V;
+  EXPECT_TRUE(L.get_coeffs().isApprox(
+      M_BP_matrix * V.get_coeffs(), 10 * kEpsilon));
+
+  const SpatialAcceleration<double> A(Vector3d(-0.4, 1.2, 2.0),
+                                      Vector3d(0.9, -0.6, 0.2));
+  const SpatialForce<double> F = M_BP * A;
+  EXPECT_TRUE(F.get_coeffs().isApprox(
+      M_BP_matrix * A.get_coeffs(), 10 * kEpsilon));
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
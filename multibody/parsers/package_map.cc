@@ -13,6 +13,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_path.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/find_resource.h"
 #include "drake/common/text_logging.h"
 
 using std::cerr;
@@ -68,12 +69,14 @@ void PackageMap::PopulateFromEnvironment(const string& environment_variable) {
 
 namespace {
 
-// Returns true if @p directory has a package.xml file.
+// Returns true if @p directory has a package.xml file. Every model parsed
+// from the same directory probes the same ancestors, so the answers are
+// cached.
 bool HasPackageXmlFile(const string& directory) {
   DRAKE_DEMAND(!directory.empty());
   spruce::path spruce_path(directory);
   spruce_path.append("package.xml");
-  return spruce_path.exists();
+  return CachedPathExists(spruce_path.getStr());
 }
 
 // Returns the parent directory of @p directory.
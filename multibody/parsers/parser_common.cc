@@ -6,6 +6,7 @@
 #include <spruce.hh>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/find_resource.h"
 #include "drake/common/text_logging.h"
 #include "drake/multibody/joints/drake_joint.h"
 #include "drake/multibody/joints/fixed_joint.h"
@@ -136,7 +137,9 @@ string ResolveFilename(const string& filename, const PackageMap& package_map,
 
     mesh_filename_spruce.append(filename);
   }
-  if (!mesh_filename_spruce.exists()) {
+  // Models often share meshes, so the existence of each one is only checked
+  // once per process.
+  if (!CachedPathExists(mesh_filename_spruce.getStr())) {
     drake::log()->warn("File '{}' could not be found.",
                        mesh_filename_spruce.getStr());
     drake::log()->warn("Mesh '{}' could not be resolved and will be ignored by "
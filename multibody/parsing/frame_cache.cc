@@ -1,6 +1,7 @@
 #include "drake/multibody/parsing/frame_cache.h"
 
 #include <algorithm>
+#include <vector>
 
 namespace drake {
 namespace multibody {
@@ -37,6 +38,9 @@ void FrameCache<T>::Update(
       DRAKE_THROW_UNLESS(entry.frame != source_frame);
       frame = entry.frame;
     }
+    // Moving the source frame moves all the frames defined relative to it.
+    // A new frame, on the other hand, has no such frames yet.
+    X_RF_cache_.clear();
   }
   // Update map with source frame's (S) pose in the
   // the target frame (T).
@@ -58,23 +62,32 @@ Isometry3<T> FrameCache<T>::Transform(
   // Compute source frame's (S) pose in the target frame (T)
   // using both frames's poses in the root frame (R).
   // That is, X_TS = X_RT^-1 * X_RS.
-  Isometry3<T> X_RT = RootTransform(target_frame);
-  Isometry3<T> X_RS = RootTransform(source_frame);
+  const Isometry3<T> X_RT = RootTransform(target_frame);
+  const Isometry3<T> X_RS = RootTransform(source_frame);
   return X_RT.inverse() * X_RS;
 }
 
 template <typename T>
-Isometry3<T> FrameCache<T>::RootTransform(std::string frame) const {
-  // Compute root frame's (R) pose in the given frame (F)
-  // as it's easier given the cache structure, and then invert
-  // it. That is, X_RF = X_FR^-1
-  Isometry3<T> X_FR = Isometry3<T>::Identity();
-  while (frame != root_frame_) {
-    const FramedIsometry3<T>& entry = X_TS_cache_.at(frame);
-    X_FR = X_FR * entry.isometry.inverse();
-    frame = entry.frame;
+Isometry3<T> FrameCache<T>::RootTransform(const std::string& frame) const {
+  // Walk up from the given frame (F) to the first frame (A) whose pose in
+  // the root frame (R) is known, then compose the poses back down, memoizing
+  // them along the way. That is, X_RF = X_RA * X_AF.
+  std::vector<const std::string*> chain;
+  const std::string* ancestor = &frame;
+  while (*ancestor != root_frame_ &&
+         X_RF_cache_.find(*ancestor) == X_RF_cache_.end()) {
+    chain.push_back(ancestor);
+    ancestor = &X_TS_cache_.at(*ancestor).frame;
   }
-  return X_FR.inverse();
+  Isometry3<T> X_RF = Isometry3<T>::Identity();
+  if (*ancestor != root_frame_) {
+    X_RF = X_RF_cache_.at(*ancestor);
+  }
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    X_RF = X_RF * X_TS_cache_.at(**it).isometry;
+    X_RF_cache_[**it] = X_RF;
+  }
+  return X_RF;
 }
 
 template class FrameCache<double>;
@@ -35,6 +35,11 @@ struct FramedIsometry3 {
 /// Keeps a set of frames and the transforms that relate them, using
 /// a root or fixed frame to conjoin them all.
 ///
+/// The pose of each frame in the root frame is memoized the first time it
+/// is needed, so that repeated queries do not walk the chain of frames back
+/// to the root again. Since Transform() updates the memoized poses, a
+/// %FrameCache must not be queried concurrently from several threads.
+///
 /// @note
 /// Instantiated templates for the following scalar types
 /// @p T are provided:
@@ -74,13 +79,17 @@ class FrameCache {
  private:
   // Returns `X_RF`, that is the pose of given @p frame `F` in
   // the root frame `R`.
-  Isometry3<T> RootTransform(std::string frame) const;
+  Isometry3<T> RootTransform(const std::string& frame) const;
 
   // Name of the root frame of this cache.
   std::string root_frame_;
 
   // Map to keep all known frames' transforms.
   std::map<std::string, FramedIsometry3<T>> X_TS_cache_;
+
+  // Map of the poses `X_RF` of frames in the root frame that have been
+  // computed since the last update to an existing frame.
+  mutable std::map<std::string, Isometry3<T>> X_RF_cache_;
 };
 
 }  // namespace parsing
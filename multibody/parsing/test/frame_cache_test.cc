@@ -1,5 +1,7 @@
 #include "drake/multibody/parsing/frame_cache.h"
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
@@ -92,6 +94,41 @@ GTEST_TEST(FrameCacheTest, NonExistentFramesTest) {
     }, std::runtime_error);
 }
 
+// Makes sure that the poses memoized along a chain of frames are updated
+// when a frame in the middle of the chain moves.
+GTEST_TEST(FrameCacheTest, ChainTest) {
+  FrameCache<double> frame_cache("root");
+  const Isometry3<double> X_PC(
+      Isometry3<double>::TranslationType(1.0, 0.0, 0.0));
+  const int kNumFrames = 50;
+  std::string parent = "root";
+  for (int i = 0; i < kNumFrames; ++i) {
+    const std::string child = "frame" + std::to_string(i);
+    frame_cache.Update(parent, child, X_PC);
+    parent = child;
+  }
+  EXPECT_TRUE(frame_cache.Transform("root", "frame19").translation().isApprox(
+      Vector3<double>(20.0, 0.0, 0.0)));
+  EXPECT_TRUE(frame_cache.Transform("frame9", "frame49").translation()
+              .isApprox(Vector3<double>(40.0, 0.0, 0.0)));
+
+  // A new frame does not move the others.
+  frame_cache.Update("frame19", "leaf", X_PC);
+  EXPECT_TRUE(frame_cache.Transform("root", "leaf").translation().isApprox(
+      Vector3<double>(21.0, 0.0, 0.0)));
+
+  // Moving a frame moves the frames defined relative to it.
+  frame_cache.Update("frame9", "frame10",
+                     Isometry3<double>(Isometry3<double>::TranslationType(
+                         0.0, 1.0, 0.0)));
+  EXPECT_TRUE(frame_cache.Transform("root", "frame49").translation().isApprox(
+      Vector3<double>(49.0, 1.0, 0.0)));
+  EXPECT_TRUE(frame_cache.Transform("root", "leaf").translation().isApprox(
+      Vector3<double>(20.0, 1.0, 0.0)));
+  EXPECT_TRUE(frame_cache.Transform("root", "frame9").translation().isApprox(
+      Vector3<double>(10.0, 0.0, 0.0)));
+}
+
 }  // namespace
 }  // namespace parsing
 }  // namespace multibody
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,57 @@ IKResults inverseKinSimple(
     const std::vector<RigidBodyConstraint*>& constraint_array,
     const IKoptions& ikoptions);
 
+/**
+ * Return type for inverseKinMultiStart.
+ */
+struct IKMultiStartResults {
+  /// The solution found from the seed at #seed_index.
+  Eigen::VectorXd q_sol;
+  /// The info of that solution, as explained in inverseKin.
+  int info{};
+  /// The column of q_seeds that #q_sol was found from.
+  int seed_index{};
+  /// The number of seeds that were solved; the others were skipped.
+  int num_seeds_solved{};
+};
+
+/**
+ * inverseKinMultiStart solves the same problem as inverseKin once from each
+ * of the seeds in the columns of @p q_seeds, on up to @p num_threads threads,
+ * to make it more likely that a solution is found when the problem is
+ * nonconvex. Random restarts can be had by filling the columns of @p q_seeds
+ * with RigidBodyTree::getRandomConfiguration().
+ *
+ * The solution returned is that of the first seed, in column order, whose
+ * info is below 10 (i.e., the optimization is successful), or else that of
+ * the first seed if none is. Once a seed is successful, the seeds after it are
+ * skipped, so the result is the same as that of trying the seeds one at a
+ * time until one succeeds, whatever the number of threads. No seed after the
+ * first is started once @p max_seconds have elapsed; in that case, only the
+ * seeds that were solved are considered.
+ *
+ * Each seed is solved with a MathematicalProgram and KinematicsCache of its
+ * own, but with the same @p model and constraints, which must be safe to
+ * evaluate concurrently when @p num_threads is more than one. That excludes
+ * the constraints that run collision queries on the model, such as
+ * MinDistanceConstraint. Note that the solves proper only overlap if the
+ * solver is reentrant; SnoptSolver is not.
+ *
+ * @param q_seeds     an nq x K double matrix, with K >= 1. The seeds to try.
+ * @param q_nom       Same as in inverseKin
+ * @param constraint_array  Same as in inverseKin
+ * @param ikoptions   Same as in inverseKin
+ * @param num_threads The maximum number of threads to use; must be positive.
+ * @param max_seconds The wall time after which no more seeds are started.
+ * @throws std::runtime_error if q_seeds has no columns.
+ */
+IKMultiStartResults inverseKinMultiStart(
+    RigidBodyTree<double>* model, const Eigen::MatrixXd& q_seeds,
+    const Eigen::VectorXd& q_nom,
+    const std::vector<const RigidBodyConstraint*>& constraint_array,
+    const IKoptions& ikoptions, int num_threads,
+    double max_seconds = std::numeric_limits<double>::infinity());
+
 
 /**
  * approximateIK solves the same problem as inverseKin. But for speed reason, it
@@ -1,10 +1,12 @@
 #include "drake/multibody/rigid_body_plant/compliant_contact_model.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/orthonormal_basis.h"
 #include "drake/multibody/collision/element.h"
@@ -34,8 +36,10 @@ void CompliantContactModel<T>::set_model_parameters(
     const CompliantContactModelParameters& values) {
   DRAKE_DEMAND(values.v_stiction_tolerance > 0 &&
       values.characteristic_radius > 0);
+  DRAKE_DEMAND(values.num_threads > 0);
   inv_v_stiction_tolerance_ = 1.0 / values.v_stiction_tolerance;
   characteristic_radius_ = values.characteristic_radius;
+  num_threads_ = values.num_threads;
 }
 
 template <typename T>
@@ -53,154 +57,228 @@ VectorX<T> CompliantContactModel<T>::ComputeContactForce(
       const_cast<RigidBodyTree<double>*>(&tree)
           ->ComputeMaximumDepthCollisionPoints(kinsol, true, false);
 
-  VectorX<T> contact_force(kinsol.getV().rows(), 1);
-  contact_force.setZero();
+  // Keeps the penetrating pairs only.
   // TODO(SeanCurtis-TRI): Determine if a distance of zero should be reported
   //  as a zero-force contact.
+  pairs.erase(std::remove_if(pairs.begin(), pairs.end(),
+                             [](const auto& pair) {
+                               return !(pair.distance < 0.0);
+                             }),
+              pairs.end());
+  if (!pairs.empty() && !std::is_same<T, double>::value) {
+    // TODO(russt): Consider handling some important special
+    // cases.  For instance, if a point contact on a robot is
+    // colliding with a static object in the world, then there
+    // should be no lost gradient information (the gradients with
+    // respect to the point on the robot are zero, and the forces
+    // on the static object will have no effect).
+    throw std::runtime_error(
+        "Contact occurred.  Gradient information "
+        "would have been inaccurate.");
+  }
+  const int num_contacts = static_cast<int>(pairs.size());
+
+  // The spatial velocity Jacobian, in the world frame, of each body in
+  // contact, computed once however many contacts the body has.  It only has
+  // the columns of the velocities on the kinematic path from the world to the
+  // body, whose indices are stored alongside.
+  struct BodyJacobian {
+    int body_index{};
+    TwistMatrix<T> J_WB;
+    std::vector<int> v_indices;
+  };
+  std::vector<int> body_jacobian_index(tree.get_num_bodies(), -1);
+  std::vector<BodyJacobian> body_jacobians;
   for (const auto& pair : pairs) {
-    if (pair.distance < 0.0) {  // There is contact.
-      if (!std::is_same<T, double>::value) {
-        // TODO(russt): Consider handling some important special
-        // cases.  For instance, if a point contact on a robot is
-        // colliding with a static object in the world, then there
-        // should be no lost gradient information (the gradients with
-        // respect to the point on the robot are zero, and the forces
-        // on the static object will have no effect).
-        throw std::runtime_error(
-            "Contact occurred.  Gradient information "
-            "would have been inaccurate.");
+    for (const auto* element : {pair.elementA, pair.elementB}) {
+      const int body_index = element->get_body()->get_body_index();
+      if (body_jacobian_index[body_index] < 0) {
+        body_jacobian_index[body_index] =
+            static_cast<int>(body_jacobians.size());
+        body_jacobians.push_back(BodyJacobian{body_index, {}, {}});
       }
+    }
+  }
+  ParallelFor(static_cast<int>(body_jacobians.size()), num_threads_,
+              [&](int i) {
+    BodyJacobian& body = body_jacobians[i];
+    body.J_WB = tree.geometricJacobian(kinsol, 0, body.body_index, 0, false,
+                                       &body.v_indices);
+  });
+
+  // The velocity, in the world frame, of the point at p_WP that moves with
+  // the body.
+  auto calc_point_velocity = [&kinsol](const BodyJacobian& body,
+                                       const Vector3<T>& p_WP) {
+    Vector3<T> v_WP = Vector3<T>::Zero();
+    for (int col = 0; col < static_cast<int>(body.v_indices.size()); ++col) {
+      const T& v = kinsol.getV()(body.v_indices[col]);
+      v_WP += (body.J_WB.template bottomRows<3>().col(col) +
+               body.J_WB.template topRows<3>().col(col).cross(p_WP)) * v;
+    }
+    return v_WP;
+  };
 
-      CompliantMaterial parameters;
-      const double s_a =
-          CalcContactParameters(*pair.elementA, *pair.elementB, &parameters);
-
-      // Define the contact point: the pair contains points on the *surfaces* of
-      // bodies A and B, given as location vectors measured and expressed in the
-      // respective body frames.  For penetration, these points will *not* be
-      // coincident. We must define a common contact point at which relative
-      // velocity is defined and the force is applied.
-
-      const int body_a_index = pair.elementA->get_body()->get_body_index();
-      const int body_b_index = pair.elementB->get_body()->get_body_index();
-      // The reported point on A's surface (As) in the world frame (W).
-      const Vector3<T> p_WAs =
-          kinsol.get_element(body_a_index).transform_to_world * pair.ptA;
-      // The reported point on B's surface (Bs) in the world frame (W).
-      const Vector3<T> p_WBs =
-          kinsol.get_element(body_b_index).transform_to_world * pair.ptB;
-      // The point of contact in the world frame.  Interpolate between the two
-      // surface points based on relative "squish" (see doxygen for
-      // CalcContactParameters() for details). For equal squish
-      // this becomes the mean point. But as one element gets all of the squish,
-      // the contact point converges to the point on the surface of the _other_
-      // object. The use of s_a *may* seem counter-intuitive. I.e., if *all*
-      // compression is on element A, we are fully taking the position on
-      // element B. The point *on* B is in fact the deepest penetrating point on
-      // A, which represents the desired contact point. So, the apparent
-      // backwardness is, in fact, correct.
-      const Vector3<T> p_WC = (1.0 - s_a) * p_WAs + s_a * p_WBs;
-
-      // The contact point in A's frame.
-      const auto X_AW = kinsol.get_element(body_a_index)
-                            .transform_to_world.inverse(Eigen::Isometry);
-      const Vector3<T> p_AAc = X_AW * p_WC;
-      // The contact point in B's frame.
-      const auto X_BW = kinsol.get_element(body_b_index)
-                            .transform_to_world.inverse(Eigen::Isometry);
-      const Vector3<T> p_BBc = X_BW * p_WC;
-
-      const auto JA =
-          tree.transformPointsJacobian(kinsol, p_AAc, body_a_index, 0, false);
-      const auto JB =
-          tree.transformPointsJacobian(kinsol, p_BBc, body_b_index, 0, false);
-      // This normal points *from* element B *to* element A.
-      const Vector3<T> this_normal = pair.normal;
-
-      // R_WC is a left-multiplied rotation matrix to transform a vector from
-      // contact frame (C) to world (W), e.g., v_W = R_WC * v_C.
-      const int z_axis = 2;
-      const Matrix3<T> R_WC = math::ComputeBasisFromAxis(z_axis, this_normal);
-      const auto J = R_WC.transpose() * (JA - JB);  // J = [ D1; D2; n ]
-
-      // TODO(SeanCurtis-TRI): Coordinate with Paul Mitiguy to standardize this
-      // notation.
-      // The *relative* velocity of the contact point in A relative to that in
-      // B, expressed in the contact frame, C.
-      const auto v_CBcAc_C = J * kinsol.getV();
-
-      // TODO(SeanCurtis-TRI): Move this documentation to the larger doxygen
-      // discussion and simply reference it here.
-
-      // See contact_model_doxygen.h for the details of this contact model.
-      // Normal force fN = kx(1 + dẋ). We map the equation to the local
-      // variables as follows:
-      //  x = -pair.distance -- penetration depth.
-      //  ̇ẋ = -v_CBcAc_C(2)  -- change of penetration (in normal direction).
-      //  fK = kx -- force due to stiffness (aka elasticity).
-      //  fD = fk dẋ -- force due to dissipation.
-      //  fN = max(0, fK + fD ) -- total normal force; (skipped if fN < 0).
-      //  fF = mu(v) * fN  - friction force magnitude.
-
-      const T x = T(-pair.distance);
-      const T x_dot = -v_CBcAc_C(2);
-
-      const T fK = parameters.youngs_modulus() * x * characteristic_radius_;
-      const T fD = fK * parameters.dissipation() * x_dot;
-      const T fN = fK + fD;
-      if (fN <= 0) continue;
-
-      Vector3<T> fA;
-      fA(2) = fN;
-      // Friction force
-      const auto slip_vector = v_CBcAc_C.template head<2>();
-      T slip_speed_squared = slip_vector.squaredNorm();
-      // Consider a value indistinguishable from zero if it is smaller
-      // then 1e-14 and test against that value squared.
-      const T kNonZeroSqd = T(1e-14 * 1e-14);
-      if (slip_speed_squared > kNonZeroSqd) {
-        const T slip_speed = sqrt(slip_speed_squared);
-        const T friction_coefficient =
-            ComputeFrictionCoefficient(slip_speed, parameters);
-        const T fF = friction_coefficient * fN;
-        fA.template head<2>() = -(fF / slip_speed) * slip_vector;
-      } else {
-        fA.template head<2>() << 0, 0;
-      }
+  // The force on A of each contact, and where and in which frame it acts.
+  // Contacts that are pulling, rather than pushing, are flagged as inactive.
+  struct ContactEvaluation {
+    bool active{false};
+    Vector3<T> p_WC;
+    Matrix3<T> R_WC;
+    Vector3<T> fA;
+  };
+  std::vector<ContactEvaluation> contact_forces(num_contacts);
+  ParallelFor(num_contacts, num_threads_, [&](int i) {
+    const auto& pair = pairs[i];
+    ContactEvaluation& result = contact_forces[i];
+
+    CompliantMaterial parameters;
+    const double s_a =
+        CalcContactParameters(*pair.elementA, *pair.elementB, &parameters);
+
+    // Define the contact point: the pair contains points on the *surfaces* of
+    // bodies A and B, given as location vectors measured and expressed in the
+    // respective body frames.  For penetration, these points will *not* be
+    // coincident. We must define a common contact point at which relative
+    // velocity is defined and the force is applied.
+
+    const int body_a_index = pair.elementA->get_body()->get_body_index();
+    const int body_b_index = pair.elementB->get_body()->get_body_index();
+    // The reported point on A's surface (As) in the world frame (W).
+    const Vector3<T> p_WAs =
+        kinsol.get_element(body_a_index).transform_to_world * pair.ptA;
+    // The reported point on B's surface (Bs) in the world frame (W).
+    const Vector3<T> p_WBs =
+        kinsol.get_element(body_b_index).transform_to_world * pair.ptB;
+    // The point of contact in the world frame.  Interpolate between the two
+    // surface points based on relative "squish" (see doxygen for
+    // CalcContactParameters() for details). For equal squish
+    // this becomes the mean point. But as one element gets all of the squish,
+    // the contact point converges to the point on the surface of the _other_
+    // object. The use of s_a *may* seem counter-intuitive. I.e., if *all*
+    // compression is on element A, we are fully taking the position on
+    // element B. The point *on* B is in fact the deepest penetrating point on
+    // A, which represents the desired contact point. So, the apparent
+    // backwardness is, in fact, correct.
+    result.p_WC = (1.0 - s_a) * p_WAs + s_a * p_WBs;
+
+    // This normal points *from* element B *to* element A.
+    const Vector3<T> this_normal = pair.normal;
+
+    // R_WC is a left-multiplied rotation matrix to transform a vector from
+    // contact frame (C) to world (W), e.g., v_W = R_WC * v_C.
+    const int z_axis = 2;
+    result.R_WC = math::ComputeBasisFromAxis(z_axis, this_normal);
+
+    // TODO(SeanCurtis-TRI): Coordinate with Paul Mitiguy to standardize this
+    // notation.
+    // The *relative* velocity of the contact point in A relative to that in
+    // B, expressed in the contact frame, C.
+    const Vector3<T> v_CBcAc_C =
+        result.R_WC.transpose() *
+        (calc_point_velocity(
+             body_jacobians[body_jacobian_index[body_a_index]], result.p_WC) -
+         calc_point_velocity(
+             body_jacobians[body_jacobian_index[body_b_index]], result.p_WC));
+
+    // TODO(SeanCurtis-TRI): Move this documentation to the larger doxygen
+    // discussion and simply reference it here.
+
+    // See contact_model_doxygen.h for the details of this contact model.
+    // Normal force fN = kx(1 + dẋ). We map the equation to the local
+    // variables as follows:
+    //  x = -pair.distance -- penetration depth.
+    //  ̇ẋ = -v_CBcAc_C(2)  -- change of penetration (in normal direction).
+    //  fK = kx -- force due to stiffness (aka elasticity).
+    //  fD = fk dẋ -- force due to dissipation.
+    //  fN = max(0, fK + fD ) -- total normal force; (skipped if fN < 0).
+    //  fF = mu(v) * fN  - friction force magnitude.
+
+    const T x = T(-pair.distance);
+    const T x_dot = -v_CBcAc_C(2);
+
+    const T fK = parameters.youngs_modulus() * x * characteristic_radius_;
+    const T fD = fK * parameters.dissipation() * x_dot;
+    const T fN = fK + fD;
+    if (fN <= 0) return;
+
+    Vector3<T>& fA = result.fA;
+    fA(2) = fN;
+    // Friction force
+    const auto slip_vector = v_CBcAc_C.template head<2>();
+    T slip_speed_squared = slip_vector.squaredNorm();
+    // Consider a value indistinguishable from zero if it is smaller
+    // then 1e-14 and test against that value squared.
+    const T kNonZeroSqd = T(1e-14 * 1e-14);
+    if (slip_speed_squared > kNonZeroSqd) {
+      const T slip_speed = sqrt(slip_speed_squared);
+      const T friction_coefficient =
+          ComputeFrictionCoefficient(slip_speed, parameters);
+      const T fF = friction_coefficient * fN;
+      fA.template head<2>() = -(fF / slip_speed) * slip_vector;
+    } else {
+      fA.template head<2>() << 0, 0;
+    }
+    result.active = true;
+  });
 
-      // fB is equal and opposite to fA: fB = -fA.
-      // Therefore the generalized forces tau_c due to contact are:
-      // tau_c = (R_CW * JA)^T * fA + (R_CW * JB)^T * fB = J^T * fA.
-      // With J computed as above: J = R_CW * (JA - JB).
-      // Since right_hand_side has a negative sign when on the RHS of the
-      // system of equations ([H,-J^T] * [vdot;f] + right_hand_side = 0),
-      // this term needs to be subtracted.
-      contact_force += J.transpose() * fA;
-      if (contacts != nullptr) {
-        ContactInfo<T>& contact_info = contacts->AddContact(
-            pair.elementA->getId(), pair.elementB->getId());
-
-        // TODO(SeanCurtis-TRI): Future feature: test against user-set flag
-        // for whether the details should generally be captured or not and
-        // make this function dependent.
-        std::vector<std::unique_ptr<ContactDetail<T>>> details;
-        ContactResultantForceCalculator<T> calculator(&details);
-
-        // This contact model produces responses that only have a force
-        // component (i.e., the torque portion of the wrench is zero.)
-        // In contrast, other models (e.g., torsional friction model) can
-        // also introduce a "pure torque" component to the wrench.
-        const Vector3<T> force = R_WC * fA;
-        const Vector3<T> normal = R_WC.template block<3, 1>(0, 2);
-
-        calculator.AddForce(p_WC, normal, force);
-
-        contact_info.set_resultant_force(calculator.ComputeResultant());
-        // TODO(SeanCurtis-TRI): As with previous note, this line depends
-        // on the eventual instantiation of the user-set flag for accumulating
-        // contact details.
-        contact_info.set_contact_details(move(details));
+  // The forces are accumulated serially, in the order of the contacts, so
+  // that the result does not depend on the number of threads.
+  VectorX<T> contact_force(kinsol.getV().rows(), 1);
+  contact_force.setZero();
+  for (int i = 0; i < num_contacts; ++i) {
+    const ContactEvaluation& result = contact_forces[i];
+    if (!result.active) continue;
+    const auto& pair = pairs[i];
+    const Vector3<T> fA_W = result.R_WC * result.fA;
+
+    // fB is equal and opposite to fA: fB = -fA.
+    // Therefore the generalized forces tau_c due to contact are:
+    // tau_c = JA^T * fA_W + JB^T * fB_W = JA^T * fA_W - JB^T * fA_W,
+    // where JA and JB are the Jacobians of the contact point moving with A and
+    // B, which are only non-zero on the kinematic paths of the bodies.
+    // Since right_hand_side has a negative sign when on the RHS of the
+    // system of equations ([H,-J^T] * [vdot;f] + right_hand_side = 0),
+    // this term needs to be subtracted.
+    const auto add_point_force = [&](int body_index, const Vector3<T>& f_W) {
+      const BodyJacobian& body =
+          body_jacobians[body_jacobian_index[body_index]];
+      // The moment of f_W about the world origin, which the angular velocity
+      // columns of the spatial Jacobian map to.
+      const Vector3<T> m_W = result.p_WC.cross(f_W);
+      for (int col = 0; col < static_cast<int>(body.v_indices.size());
+           ++col) {
+        contact_force(body.v_indices[col]) +=
+            body.J_WB.template topRows<3>().col(col).dot(m_W) +
+            body.J_WB.template bottomRows<3>().col(col).dot(f_W);
       }
+    };
+    add_point_force(pair.elementA->get_body()->get_body_index(), fA_W);
+    add_point_force(pair.elementB->get_body()->get_body_index(), -fA_W);
+
+    if (contacts != nullptr) {
+      ContactInfo<T>& contact_info = contacts->AddContact(
+          pair.elementA->getId(), pair.elementB->getId());
+
+      // TODO(SeanCurtis-TRI): Future feature: test against user-set flag
+      // for whether the details should generally be captured or not and
+      // make this function dependent.
+      std::vector<std::unique_ptr<ContactDetail<T>>> details;
+      ContactResultantForceCalculator<T> calculator(&details);
+
+      // This contact model produces responses that only have a force
+      // component (i.e., the torque portion of the wrench is zero.)
+      // In contrast, other models (e.g., torsional friction model) can
+      // also introduce a "pure torque" component to the wrench.
+      const Vector3<T> normal = result.R_WC.template block<3, 1>(0, 2);
+
+      calculator.AddForce(result.p_WC, normal, fA_W);
+
+      contact_info.set_resultant_force(calculator.ComputeResultant());
+      // TODO(SeanCurtis-TRI): As with previous note, this line depends
+      // on the eventual instantiation of the user-set flag for accumulating
+      // contact details.
+      contact_info.set_contact_details(move(details));
     }
   }
   if (contacts != nullptr) {
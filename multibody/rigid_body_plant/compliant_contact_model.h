@@ -18,6 +18,9 @@ struct CompliantContactModelParameters {
   /// Characteristic radius (in m).
   static const double kDefaultCharacteristicRadius;
   double characteristic_radius{kDefaultCharacteristicRadius};
+  /// The number of threads on which the contacts are evaluated. The
+  /// generalized contact force does not depend on it.
+  int num_threads{1};
 };
 
 /// This class encapsulates the compliant contact model force computations as
@@ -45,6 +48,7 @@ class CompliantContactModel {
   explicit CompliantContactModel(const CompliantContactModel<U>& other)
       : inv_v_stiction_tolerance_(other.inv_v_stiction_tolerance_),
         characteristic_radius_(other.characteristic_radius_),
+        num_threads_(other.num_threads_),
         default_material_(other.default_material()) {}
 
   /// Computes the generalized forces on all bodies due to contact.
@@ -57,6 +61,11 @@ class CompliantContactModel {
   ///                       port.
   /// @returns              The generalized forces across all the bodies due to
   ///                       contact response.
+  ///
+  /// The spatial Jacobian of each body in contact is computed once, over the
+  /// velocities on its kinematic path only, and shared by all of its
+  /// contacts. The contacts are evaluated on
+  /// CompliantContactModelParameters::num_threads threads.
   /// @throws std::runtime_error if T is non-double and potential gradient
   ///                       information would have been lost (currently this is
   ///                       happens precisely when penetration is detected).
@@ -115,6 +124,7 @@ class CompliantContactModel {
       1.0 / CompliantContactModelParameters().v_stiction_tolerance};
   double characteristic_radius_{
       CompliantContactModelParameters().characteristic_radius};
+  int num_threads_{CompliantContactModelParameters().num_threads};
 
   // The default compliant material properties for *this* model instance.
   // By default, it uses all hard-coded values.
@@ -13,6 +13,10 @@
 namespace drake {
 namespace systems {
 
+// Forward declaration
+template <typename T>
+class ContactResults;
+
 /**
  A class containing information regarding contact response between two bodies
  including:
@@ -92,6 +96,18 @@ class ContactInfo {
   }
 
  private:
+  friend class ContactResults<T>;
+
+  // Re-initializes this instance for a new pair of elements, while keeping
+  // the storage of the contact details for reuse.
+  void Reset(drake::multibody::collision::ElementId element1,
+             drake::multibody::collision::ElementId element2) {
+    element1_ = element1;
+    element2_ = element2;
+    resultant_force_ = ContactForce<T>();
+    contact_details_.clear();
+  }
+
   drake::multibody::collision::ElementId element1_{};
   drake::multibody::collision::ElementId element2_{};
   ContactForce<T> resultant_force_;
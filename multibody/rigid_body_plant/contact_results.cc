@@ -8,29 +8,55 @@ namespace systems {
 
 template <typename T>
 int ContactResults<T>::get_num_contacts() const {
-  return static_cast<int>(contacts_.size());
+  return num_contacts_;
 }
 
 template <typename T>
 const ContactInfo<T>& ContactResults<T>::get_contact_info(int i) const {
-  DRAKE_ASSERT(i >= 0 && i < static_cast<int>(contacts_.size()));
+  DRAKE_ASSERT(i >= 0 && i < num_contacts_);
   return contacts_[i];
 }
 
 template <typename T>
 ContactResults<T>::ContactResults() : contacts_() {}
 
+template <typename T>
+ContactResults<T>::ContactResults(const ContactResults& other)
+    : contacts_(other.contacts_.begin(),
+                other.contacts_.begin() + other.num_contacts_),
+      num_contacts_(other.num_contacts_),
+      generalized_contact_force_(other.generalized_contact_force_) {}
+
+template <typename T>
+ContactResults<T>& ContactResults<T>::operator=(const ContactResults& other) {
+  if (this != &other) {
+    // Assigns over the existing ContactInfo instances, whose storage of the
+    // contact details is reused.
+    contacts_.assign(other.contacts_.begin(),
+                     other.contacts_.begin() + other.num_contacts_);
+    num_contacts_ = other.num_contacts_;
+    generalized_contact_force_ = other.generalized_contact_force_;
+  }
+  return *this;
+}
+
 template <typename T>
 void ContactResults<T>::Clear() {
-  contacts_.clear();
+  num_contacts_ = 0;
 }
 
 template <typename T>
 ContactInfo<T>& ContactResults<T>::AddContact(
     drake::multibody::collision::ElementId element_a,
     drake::multibody::collision::ElementId element_b) {
-  contacts_.emplace_back(element_a, element_b);
-  return contacts_.back();
+  const int i = num_contacts_;
+  if (i < static_cast<int>(contacts_.size())) {
+    contacts_[i].Reset(element_a, element_b);
+  } else {
+    contacts_.emplace_back(element_a, element_b);
+  }
+  num_contacts_ = i + 1;
+  return contacts_[i];
 }
 
 }  // namespace systems
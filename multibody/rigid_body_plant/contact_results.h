@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/reset_after_move.h"
 #include "drake/multibody/collision/element.h"
 #include "drake/multibody/rigid_body_plant/contact_info.h"
 
@@ -19,6 +20,10 @@ class RigidBodyPlant;
  all JᵀF for all contact, where J is the contact point Jacobian, and F is
  the contact force.
 
+ The ContactInfo instances are stored by value, in one contiguous buffer that
+ Clear() keeps, so that results which are recomputed in place (e.g., as the
+ value of an output port) reuse the storage of the previous results.
+
  @tparam T      The scalar type. It must be a valid Eigen scalar.
 
  Instantiated templates for the following ScalarTypes are provided:
@@ -28,10 +33,18 @@ class RigidBodyPlant;
 template <typename T>
 class ContactResults {
  public:
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContactResults)
-
   ContactResults();
 
+  /** Copies only the contacts reported since the last Clear() of @p other. */
+  ContactResults(const ContactResults& other);
+
+  /** Copies only the contacts reported since the last Clear() of @p other,
+   assigning them over this instance's existing ContactInfo instances. */
+  ContactResults& operator=(const ContactResults& other);
+
+  ContactResults(ContactResults&&) = default;
+  ContactResults& operator=(ContactResults&&) = default;
+
   /** Returns the number of unique collision element pairs in contact. */
   int get_num_contacts() const;
 
@@ -67,7 +80,10 @@ class ContactResults {
   }
 
  private:
+  // Only the first num_contacts_ entries are valid; the rest are kept from
+  // before the last Clear(), for reuse.
   std::vector<ContactInfo<T>> contacts_;
+  reset_after_move<int> num_contacts_;
   VectorX<T> generalized_contact_force_;
 };
 
@@ -1,6 +1,7 @@
 #include "drake/multibody/rigid_body_plant/contact_results_to_lcm.h"
 
 #include <memory>
+#include <stdexcept>
 
 #include "drake/lcmt_contact_results_for_viz.hpp"
 #include "drake/util/drakeUtil.h"
@@ -10,13 +11,29 @@ namespace systems {
 
 template <typename T>
 ContactResultsToLcmSystem<T>::ContactResultsToLcmSystem(
-    const RigidBodyTree<T>& tree)
-    : tree_(tree) {
+    const RigidBodyTree<T>& tree, double force_threshold)
+    : tree_(tree), force_threshold_(force_threshold) {
   set_name("ContactResultsToLcmSystem");
+  for (const auto& body : tree_.get_bodies()) {
+    for (const auto id : body->get_collision_element_ids()) {
+      body_names_[id] = &body->get_name();
+    }
+  }
   DeclareAbstractInputPort(Value<ContactResults<T>>());
   DeclareAbstractOutputPort(&ContactResultsToLcmSystem::CalcLcmContactOutput);
 }
 
+template <typename T>
+const std::string& ContactResultsToLcmSystem<T>::GetBodyName(
+    drake::multibody::collision::ElementId id) const {
+  const auto iter = body_names_.find(id);
+  if (iter == body_names_.end()) {
+    // The element was added to the tree after this system was constructed.
+    return tree_.FindBody(id)->get_name();
+  }
+  return *iter->second;
+}
+
 template <typename T>
 void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
     const Context<T>& context, lcmt_contact_results_for_viz* output) const {
@@ -25,28 +42,32 @@ void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
       EvalAbstractInput(context, 0)->template GetValue<ContactResults<T>>();
   auto& msg = *output;
 
-  msg.timestamp = static_cast<int64_t>(context.get_time() * 1e6);
-  msg.num_contacts = contact_results.get_num_contacts();
-  msg.contact_info.resize(msg.num_contacts);
-
+  const int64_t timestamp = static_cast<int64_t>(context.get_time() * 1e6);
+  msg.timestamp = timestamp;
+  // The existing entries of the message are overwritten in place, which
+  // reuses the storage of their names.
+  const double threshold_squared = force_threshold_ * force_threshold_;
+  int num_published = 0;
   for (int i = 0; i < contact_results.get_num_contacts(); ++i) {
-    lcmt_contact_info_for_viz& info_msg = msg.contact_info[i];
-    info_msg.timestamp = static_cast<int64_t>(context.get_time() * 1e6);
-
     const ContactInfo<T>& contact_info = contact_results.get_contact_info(i);
-    const RigidBody<T>* b1 = tree_.FindBody(contact_info.get_element_id_1());
-    const RigidBody<T>* b2 = tree_.FindBody(contact_info.get_element_id_2());
-
     const ContactForce<T>& contact_force = contact_info.get_resultant_force();
+    if (contact_force.get_force().squaredNorm() < threshold_squared) continue;
 
-    info_msg.body1_name = b1->get_name();
-    info_msg.body2_name = b2->get_name();
+    if (num_published == static_cast<int>(msg.contact_info.size())) {
+      msg.contact_info.emplace_back();
+    }
+    lcmt_contact_info_for_viz& info_msg = msg.contact_info[num_published++];
+    info_msg.timestamp = timestamp;
+    info_msg.body1_name = GetBodyName(contact_info.get_element_id_1());
+    info_msg.body2_name = GetBodyName(contact_info.get_element_id_2());
 
     eigenVectorToCArray(contact_force.get_application_point(),
                         info_msg.contact_point);
     eigenVectorToCArray(contact_force.get_force(), info_msg.contact_force);
     eigenVectorToCArray(contact_force.get_normal(), info_msg.normal);
   }
+  msg.num_contacts = num_published;
+  msg.contact_info.resize(num_published);
 }
 
 template class ContactResultsToLcmSystem<double>;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/lcmt_contact_results_for_viz.hpp"
@@ -15,6 +17,11 @@ namespace systems {
  * A System that encodes ContactResults into a lcmt_contact_results_for_viz
  * message. It has a single input port with type ContactResults<T> and a
  * single output port with lcmt_contact_results_for_viz.
+ *
+ * The names of the bodies of all collision elements are looked up once, at
+ * construction, and the output message is updated in place, so that
+ * publishing many contacts does not allocate once the message has grown to
+ * size.
  */
 template <typename T>
 class ContactResultsToLcmSystem : public LeafSystem<double> {
@@ -26,14 +33,26 @@ class ContactResultsToLcmSystem : public LeafSystem<double> {
    * @param tree, The RigidBodyTree that the ContactResults are generated with,
    * which should be returned by RigidBodyPlant's get_rigid_body_tree(). The
    * life span of @p tree needs to be longer than this instance.
+   * @param force_threshold Contacts whose resultant force has a magnitude
+   * below this value are left out of the message. The default of zero
+   * includes all contacts.
    */
-  explicit ContactResultsToLcmSystem(const RigidBodyTree<T>& tree);
+  explicit ContactResultsToLcmSystem(const RigidBodyTree<T>& tree,
+                                     double force_threshold = 0);
 
  private:
   void CalcLcmContactOutput(const Context<T>& context,
                             lcmt_contact_results_for_viz* output) const;
 
+  // Returns the name of the body that owns the collision element @p id.
+  const std::string& GetBodyName(
+      drake::multibody::collision::ElementId id) const;
+
   const RigidBodyTree<T>& tree_;
+  const double force_threshold_{};
+  // The names of the bodies, by the ids of their collision elements.
+  std::unordered_map<drake::multibody::collision::ElementId,
+                     const std::string*> body_names_;
 };
 
 }  // namespace systems
@@ -1,6 +1,9 @@
 #include "drake/multibody/rigid_body_plant/drake_visualizer.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 
@@ -14,6 +17,38 @@ namespace systems {
 namespace {
 // Defines the index of the port that the DrakeVisualizer uses.
 const int kPortIndex = 0;
+
+// Returns true if the pose of link i of @p a differs from the pose of link j
+// of @p b by more than the given tolerances.
+bool HasMoved(const lcmt_viewer_draw& a, int i, const lcmt_viewer_draw& b,
+              int j, double position_tolerance, double orientation_tolerance) {
+  double squared_distance = 0;
+  for (int k = 0; k < 3; ++k) {
+    const double delta = a.position[i][k] - b.position[j][k];
+    squared_distance += delta * delta;
+  }
+  if (squared_distance > position_tolerance * position_tolerance) {
+    return true;
+  }
+  // The angle θ of the rotation between two unit quaternions q₁ and q₂
+  // satisfies cos(θ / 2) = |q₁ ⋅ q₂|.
+  double dot = 0;
+  for (int k = 0; k < 4; ++k) {
+    dot += a.quaternion[i][k] * b.quaternion[j][k];
+  }
+  const double angle = 2 * std::acos(std::min(std::abs(dot), 1.0));
+  return angle > orientation_tolerance;
+}
+
+// Copies the pose of link i of @p from into link j of @p to, without
+// allocating memory.
+void CopyPose(const lcmt_viewer_draw& from, int i, lcmt_viewer_draw* to,
+              int j) {
+  std::copy(from.position[i].begin(), from.position[i].end(),
+            to->position[j].begin());
+  std::copy(from.quaternion[i].begin(), from.quaternion[i].end(),
+            to->quaternion[j].begin());
+}
 }  // namespace
 
 DrakeVisualizer::DrakeVisualizer(const RigidBodyTree<double>& tree,
@@ -21,7 +56,8 @@ DrakeVisualizer::DrakeVisualizer(const RigidBodyTree<double>& tree,
                                  bool enable_playback)
     : lcm_(lcm),
       load_message_(multibody::CreateLoadRobotMessage<double>(tree)),
-      draw_message_translator_(tree) {
+      draw_message_translator_(tree),
+      draw_state_(std::make_unique<DrawMessageState>()) {
   set_name("drake_visualizer");
   const int vector_size = tree.get_num_positions() + tree.get_num_velocities();
   DeclareInputPort(kVectorValued, vector_size);
@@ -36,6 +72,44 @@ void DrakeVisualizer::set_publish_period(double period) {
   LeafSystem<double>::DeclarePeriodicPublish(period);
 }
 
+void DrakeVisualizer::EnableDeltaEncoding(double position_tolerance,
+                                          double orientation_tolerance) {
+  if (position_tolerance < 0 || orientation_tolerance < 0) {
+    throw std::logic_error(
+        "DrakeVisualizer::EnableDeltaEncoding(): the tolerances must be "
+        "nonnegative.");
+  }
+  draw_state_->delta_encoding = true;
+  draw_state_->position_tolerance = position_tolerance;
+  draw_state_->orientation_tolerance = orientation_tolerance;
+}
+
+void DrakeVisualizer::set_max_wall_clock_publish_rate(double max_rate) {
+  draw_state_->min_wall_clock_period = max_rate > 0 ? 1.0 / max_rate : 0.0;
+}
+
+void DrakeVisualizer::RecordPoseStream(const std::string& filename,
+                                       double position_resolution) {
+  // The draw messages list the same links as the load message.
+  lcmt_viewer_draw links;
+  links.num_links = load_message_.num_links;
+  for (const auto& link : load_message_.link) {
+    links.link_name.push_back(link.name);
+    links.robot_num.push_back(link.robot_num);
+  }
+  pose_stream_.reset();
+  pose_stream_ = std::make_unique<PoseStreamWriter>(filename, links,
+                                                    position_resolution);
+}
+
+void DrakeVisualizer::FlushPoseStream() const {
+  if (pose_stream_ == nullptr) {
+    throw std::runtime_error(
+        "DrakeVisualizer::FlushPoseStream(): no pose stream is recorded.");
+  }
+  pose_stream_->Flush();
+}
+
 void DrakeVisualizer::ReplayCachedSimulation() const {
   if (log_ != nullptr) {
     // Build piecewise polynomial
@@ -132,19 +206,72 @@ void DrakeVisualizer::DoPublish(
     log_->AddData(context.get_time(), input_vector->get_value());
   }
 
+  // Skips this message if the last one was sent too recently.
+  DrawMessageState& draw = *draw_state_;
+  const auto now = std::chrono::steady_clock::now();
+  const bool too_soon =
+      draw.min_wall_clock_period > 0 && draw.last_publish_time &&
+      std::chrono::duration<double>(now - *draw.last_publish_time).count() <
+          draw.min_wall_clock_period;
+  if (too_soon && pose_stream_ == nullptr) {
+    return;
+  }
+
   // Translates the input vector into an array of bytes representing an LCM
-  // message.
-  std::vector<uint8_t> message_bytes;
-  draw_message_translator_.Serialize(context.get_time(), *input_vector,
-                                     &message_bytes);
+  // message. The buffers are reused from one publish to the next.
+  draw_message_translator_.PopulateDrawMessage(
+      context.get_time(), *input_vector, &draw.full_message);
+  if (pose_stream_ != nullptr) {
+    pose_stream_->Append(context.get_time(), draw.full_message);
+  }
+  if (too_soon) {
+    return;
+  }
+  draw.last_publish_time = now;
+  const lcmt_viewer_draw& message =
+      draw.delta_encoding ? SelectMovedBodies() : draw.full_message;
+  const int message_length = message.getEncodedSize();
+  draw.message_bytes.resize(message_length);
+  message.encode(draw.message_bytes.data(), 0, message_length);
 
   // Publishes onto the specified LCM channel.
-  lcm_->Publish("DRAKE_VIEWER_DRAW", message_bytes.data(),
-                message_bytes.size(), context.get_time());
+  lcm_->Publish("DRAKE_VIEWER_DRAW", draw.message_bytes.data(),
+                draw.message_bytes.size(), context.get_time());
+}
+
+const lcmt_viewer_draw& DrakeVisualizer::SelectMovedBodies() const {
+  DrawMessageState& draw = *draw_state_;
+  const lcmt_viewer_draw& full = draw.full_message;
+  if (!draw.all_bodies_sent) {
+    draw.sent_message = full;
+    draw.delta_message = full;
+    draw.all_bodies_sent = true;
+    return full;
+  }
+  // The LCM encoding only reads the first num_links entries of each array, so
+  // the arrays of delta_message keep the size of the full message and their
+  // storage is reused.
+  lcmt_viewer_draw& delta = draw.delta_message;
+  delta.timestamp = full.timestamp;
+  delta.num_links = 0;
+  for (int i = 0; i < full.num_links; ++i) {
+    if (HasMoved(full, i, draw.sent_message, i, draw.position_tolerance,
+                 draw.orientation_tolerance)) {
+      CopyPose(full, i, &draw.sent_message, i);
+      const int j = delta.num_links++;
+      delta.link_name[j] = full.link_name[i];
+      delta.robot_num[j] = full.robot_num[i];
+      CopyPose(full, i, &delta, j);
+    }
+  }
+  return delta;
 }
 
 void DrakeVisualizer::PublishLoadRobot() const {
   drake::lcm::Publish(lcm_, "DRAKE_VIEWER_LOAD_ROBOT", load_message_);
+  // A (re)loaded robot is drawn at its default pose until it receives the
+  // pose of every body.
+  draw_state_->all_bodies_sent = false;
 }
 
 }  // namespace systems
@@ -1,13 +1,17 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/lcm/drake_lcm_interface.h"
 #include "drake/lcmt_viewer_draw.hpp"
 #include "drake/lcmt_viewer_load_robot.hpp"
+#include "drake/multibody/rigid_body_plant/pose_stream.h"
 #include "drake/multibody/rigid_body_plant/viewer_draw_translator.h"
 #include "drake/multibody/rigid_body_tree.h"
 #include "drake/systems/framework/context.h"
@@ -50,6 +54,14 @@ namespace systems {
  * out of scale with wall clock time, enabling intuitive understanding of the
  * simulation results.  See ReplayCachedSimulation().
  *
+ * For long simulations, the poses can instead be recorded to a compact file,
+ * which is replayed from disk without a RigidBodyTree. See RecordPoseStream().
+ *
+ * To reduce the LCM traffic of large scenes, the draw messages can be delta
+ * encoded, so that they only contain the bodies that moved (see
+ * EnableDeltaEncoding()), and their rate can be capped in wall clock time (see
+ * set_max_wall_clock_publish_rate()).
+ *
  * @ingroup rigid_body_systems
  */
 class DrakeVisualizer : public LeafSystem<double> {
@@ -84,6 +96,56 @@ class DrakeVisualizer : public LeafSystem<double> {
    */
   void set_publish_period(double period);
 
+  /**
+   * Enables the delta encoding of the `lcmt_viewer_draw` messages published
+   * by DoPublish(). Each draw message then only contains the bodies whose
+   * pose changed, since it was last sent, by more than @p position_tolerance
+   * (in meters) in translation or by more than @p orientation_tolerance (in
+   * radians) in rotation. The first draw message, and the first one after each
+   * PublishLoadRobot(), contains all the bodies. Bodies are identified by their
+   * robot number and link name, so a receiver merges the messages by updating
+   * only the links they list, see MergeViewerDrawMessage(). The messages sent
+   * by ReplayCachedSimulation() and PlaybackTrajectory() are not affected.
+   *
+   * @throws std::logic_error if a tolerance is negative.
+   */
+  void EnableDeltaEncoding(double position_tolerance,
+                           double orientation_tolerance);
+
+  /**
+   * Caps the rate of the `lcmt_viewer_draw` messages published by DoPublish()
+   * to @p max_rate messages per second of wall clock time, independently of
+   * the simulation time. A publish event occurring less than `1 / max_rate`
+   * seconds after the last draw message is skipped, although its input is
+   * still recorded for playback. A non-positive @p max_rate removes the cap,
+   * which is the default.
+   */
+  void set_max_wall_clock_publish_rate(double max_rate);
+
+  /**
+   * Records the poses of all the bodies, at each draw event of DoPublish(), to
+   * the file @p filename, replacing any previous recording. Unlike the cache
+   * enabled by the constructor's `enable_playback`, this recording holds
+   * poses rather than states, is written to disk as it goes, and is replayed
+   * with ReplayPoseStream() without this visualizer or its RigidBodyTree. See
+   * PoseStreamWriter for the file format. The draw events skipped by
+   * set_max_wall_clock_publish_rate() are still recorded.
+   *
+   * @param position_resolution The quantization step of the recorded
+   * positions, in meters.
+   * @throws std::runtime_error if the file cannot be opened.
+   */
+  void RecordPoseStream(const std::string& filename,
+                        double position_resolution = 1E-4);
+
+  /**
+   * Writes the frames of the pose stream recording that are still buffered to
+   * the file, so that it can be read while the recording goes on. The file is
+   * also completed when this visualizer is destroyed.
+   * @throws std::runtime_error if there is no recording, or if a write fails.
+   */
+  void FlushPoseStream() const;
+
   // TODO(SeanCurtis-TRI): Optional features:
   //    1. Specify number of loops (<= 0 --> infinite looping)
   //    2. Specify range of playback [start, end] for cached data from times
@@ -117,6 +179,31 @@ class DrakeVisualizer : public LeafSystem<double> {
   void PublishLoadRobot() const;
 
  private:
+  // The settings and the reused buffers of the draw messages. As with log_,
+  // this is owned through a pointer since DoPublish() updates it.
+  struct DrawMessageState {
+    bool delta_encoding{false};
+    double position_tolerance{0};
+    double orientation_tolerance{0};
+    // Zero if the publish rate is not capped.
+    double min_wall_clock_period{0};
+    // False until a draw message with all the bodies is sent, and again after
+    // each PublishLoadRobot().
+    bool all_bodies_sent{false};
+    optional<std::chrono::steady_clock::time_point> last_publish_time;
+    // The poses of all the bodies at the last publish.
+    lcmt_viewer_draw full_message;
+    // The poses of all the bodies as last sent to the receivers.
+    lcmt_viewer_draw sent_message;
+    // The bodies that moved. Only its first num_links entries are sent.
+    lcmt_viewer_draw delta_message;
+    std::vector<uint8_t> message_bytes;
+  };
+
+  // Returns the draw message to send for draw_state_->full_message, and
+  // updates draw_state_->sent_message accordingly.
+  const lcmt_viewer_draw& SelectMovedBodies() const;
+
   // TODO(siyuan): Split DoPublish into individual callbacks for different
   // events. Since the desired behaviors for different triggers are exclusive.
 
@@ -139,6 +226,11 @@ class DrakeVisualizer : public LeafSystem<double> {
 
   // The (optional) log used for recording and playback.
   std::unique_ptr<SignalLog<double>> log_{nullptr};
+
+  std::unique_ptr<DrawMessageState> draw_state_;
+
+  // The (optional) recording of the poses to a file.
+  std::unique_ptr<PoseStreamWriter> pose_stream_;
 };
 
 }  // namespace systems
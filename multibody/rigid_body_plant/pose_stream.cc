@@ -0,0 +1,351 @@
+#include "drake/multibody/rigid_body_plant/pose_stream.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// "DRKPOSE1" when read as little-endian bytes.
+constexpr int64_t kPoseStreamMagic = 0x3145534f504b5244;
+constexpr double kQuaternionScale = 32767;
+
+// Returns the number of bytes of a block of @p num_frames frames of
+// @p num_links links.
+size_t BlockSize(int64_t num_frames, int64_t num_links) {
+  return sizeof(int64_t) + num_frames * sizeof(double) +
+         3 * num_links * sizeof(int32_t) +
+         3 * (num_frames - 1) * num_links * sizeof(int16_t) +
+         4 * num_frames * num_links * sizeof(int16_t);
+}
+
+// Reads a T at @p data, which need not be aligned.
+template <typename T>
+T Load(const uint8_t* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+template <typename T>
+bool WriteArray(const T* data, size_t size, std::FILE* file) {
+  return size == 0 || std::fwrite(data, sizeof(T), size, file) == size;
+}
+
+}  // namespace
+
+PoseStreamWriter::PoseStreamWriter(const std::string& filename,
+                                   const drake::lcmt_viewer_draw& links,
+                                   double position_resolution,
+                                   int max_frames_per_block)
+    : num_links_(links.num_links),
+      position_resolution_(position_resolution),
+      max_frames_per_block_(max_frames_per_block) {
+  DRAKE_DEMAND(position_resolution > 0);
+  DRAKE_DEMAND(max_frames_per_block > 0);
+  file_ = std::fopen(filename.c_str(), "wb");
+  if (file_ == nullptr) {
+    throw std::runtime_error("PoseStreamWriter: unable to open " + filename +
+                             ".");
+  }
+  const int64_t header[2] = {kPoseStreamMagic, num_links_};
+  bool ok = WriteArray(header, 2, file_) &&
+            WriteArray(&position_resolution_, 1, file_);
+  for (int i = 0; i < num_links_ && ok; ++i) {
+    const int32_t link_header[2] = {
+        links.robot_num[i], static_cast<int32_t>(links.link_name[i].size())};
+    ok = WriteArray(link_header, 2, file_) &&
+         WriteArray(links.link_name[i].data(), links.link_name[i].size(),
+                    file_);
+  }
+  if (!ok) {
+    std::fclose(file_);
+    throw std::runtime_error("PoseStreamWriter: unable to write " + filename +
+                             ".");
+  }
+  last_positions_.resize(3 * num_links_);
+}
+
+PoseStreamWriter::~PoseStreamWriter() {
+  try {
+    WriteBlock();
+  } catch (const std::runtime_error&) {
+  }
+  std::fclose(file_);
+}
+
+void PoseStreamWriter::Append(double time,
+                              const drake::lcmt_viewer_draw& poses) {
+  DRAKE_DEMAND(poses.num_links == num_links_);
+  DRAKE_DEMAND(times_.empty() || time >= times_.back());
+  if (static_cast<int>(times_.size()) == max_frames_per_block_) {
+    WriteBlock();
+  }
+
+  // Quantizes the positions, and checks whether the changes since the last
+  // frame fit in the deltas.
+  bool fits_in_deltas = !times_.empty();
+  const size_t num_deltas_before = position_deltas_.size();
+  for (int i = 0; i < num_links_; ++i) {
+    for (int k = 0; k < 3; ++k) {
+      const double scaled = poses.position[i][k] / position_resolution_;
+      if (!(std::abs(scaled) < std::numeric_limits<int32_t>::max())) {
+        throw std::runtime_error(
+            "PoseStreamWriter: a position is out of the range of the "
+            "quantization.");
+      }
+      const int64_t quantized = std::llround(scaled);
+      int64_t& last = last_positions_[3 * i + k];
+      const int64_t delta = quantized - last;
+      if (fits_in_deltas) {
+        if (std::abs(delta) > std::numeric_limits<int16_t>::max()) {
+          fits_in_deltas = false;
+        } else {
+          position_deltas_.push_back(static_cast<int16_t>(delta));
+        }
+      }
+      last = quantized;
+    }
+  }
+  if (!fits_in_deltas) {
+    // Starts a new block at this frame, with absolute positions.
+    position_deltas_.resize(num_deltas_before);
+    WriteBlock();
+    first_positions_.assign(last_positions_.begin(), last_positions_.end());
+  }
+
+  times_.push_back(time);
+  for (int i = 0; i < num_links_; ++i) {
+    for (int k = 0; k < 4; ++k) {
+      quaternions_.push_back(static_cast<int16_t>(std::lround(
+          std::max(-1.0, std::min(1.0, static_cast<double>(
+                                           poses.quaternion[i][k]))) *
+          kQuaternionScale)));
+    }
+  }
+}
+
+void PoseStreamWriter::Flush() {
+  WriteBlock();
+  if (std::fflush(file_) != 0) {
+    throw std::runtime_error("PoseStreamWriter: unable to flush the file.");
+  }
+}
+
+void PoseStreamWriter::WriteBlock() {
+  if (times_.empty()) return;
+  const int64_t num_frames = times_.size();
+  const bool ok = WriteArray(&num_frames, 1, file_) &&
+                  WriteArray(times_.data(), times_.size(), file_) &&
+                  WriteArray(first_positions_.data(), first_positions_.size(),
+                             file_) &&
+                  WriteArray(position_deltas_.data(), position_deltas_.size(),
+                             file_) &&
+                  WriteArray(quaternions_.data(), quaternions_.size(), file_);
+  times_.clear();
+  first_positions_.clear();
+  position_deltas_.clear();
+  quaternions_.clear();
+  if (!ok) {
+    throw std::runtime_error("PoseStreamWriter: unable to write to the file.");
+  }
+}
+
+PoseStreamReader::PoseStreamReader(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("PoseStreamReader: unable to open " + filename +
+                             ".");
+  }
+  const std::string not_a_pose_stream =
+      "PoseStreamReader: " + filename + " is not a pose stream file.";
+  const size_t header_size = 2 * sizeof(int64_t) + sizeof(double);
+  struct stat status;
+  if (::fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < header_size) {
+    ::close(fd);
+    throw std::runtime_error(not_a_pose_stream);
+  }
+  mapping_size_ = status.st_size;
+  mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    throw std::runtime_error("PoseStreamReader: unable to map " + filename +
+                             ".");
+  }
+
+  const auto* data = static_cast<const uint8_t*>(mapping_);
+  const uint8_t* const end = data + mapping_size_;
+  const int64_t num_links = Load<int64_t>(data + sizeof(int64_t));
+  if (Load<int64_t>(data) != kPoseStreamMagic || num_links < 0) {
+    ::munmap(mapping_, mapping_size_);
+    throw std::runtime_error(not_a_pose_stream);
+  }
+  position_resolution_ = Load<double>(data + 2 * sizeof(int64_t));
+  data += header_size;
+  for (int64_t i = 0; i < num_links; ++i) {
+    const int32_t name_size =
+        end - data >= 2 * static_cast<int>(sizeof(int32_t))
+            ? Load<int32_t>(data + sizeof(int32_t))
+            : -1;
+    if (name_size < 0 ||
+        end - data - 2 * sizeof(int32_t) < static_cast<size_t>(name_size)) {
+      ::munmap(mapping_, mapping_size_);
+      throw std::runtime_error(not_a_pose_stream);
+    }
+    robot_nums_.push_back(Load<int32_t>(data));
+    data += 2 * sizeof(int32_t);
+    link_names_.emplace_back(reinterpret_cast<const char*>(data), name_size);
+    data += name_size;
+  }
+
+  // Index the blocks. A trailing block that was cut short, e.g., because the
+  // writing process died, is ignored.
+  while (static_cast<size_t>(end - data) >= sizeof(int64_t)) {
+    const int64_t num_frames = Load<int64_t>(data);
+    if (num_frames <= 0 ||
+        BlockSize(num_frames, num_links) > static_cast<size_t>(end - data)) {
+      break;
+    }
+    blocks_.push_back(Block{num_frames_, num_frames, data});
+    num_frames_ += num_frames;
+    data += BlockSize(num_frames, num_links);
+  }
+}
+
+PoseStreamReader::~PoseStreamReader() { ::munmap(mapping_, mapping_size_); }
+
+int PoseStreamReader::FindBlock(int64_t frame) const {
+  DRAKE_DEMAND(frame >= 0 && frame < num_frames_);
+  const auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), frame,
+      [](int64_t f, const Block& block) { return f < block.first_frame; });
+  return static_cast<int>(it - blocks_.begin()) - 1;
+}
+
+double PoseStreamReader::frame_time(int64_t frame) const {
+  const Block& block = blocks_[FindBlock(frame)];
+  return Load<double>(block.data + sizeof(int64_t) +
+                      (frame - block.first_frame) * sizeof(double));
+}
+
+int64_t PoseStreamReader::FindFrame(double time) const {
+  DRAKE_DEMAND(num_frames_ > 0);
+  // Binary search on the frames, each probe being a single read.
+  int64_t low = 0;
+  int64_t high = num_frames_;
+  while (high - low > 1) {
+    const int64_t middle = low + (high - low) / 2;
+    if (frame_time(middle) <= time) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+void PoseStreamReader::ReadFrame(int64_t frame,
+                                 drake::lcmt_viewer_draw* message) const {
+  DRAKE_DEMAND(message != nullptr);
+  const Block& block = blocks_[FindBlock(frame)];
+  const int L = num_links();
+  const int64_t n = block.num_frames;
+  const int64_t f = frame - block.first_frame;
+  const uint8_t* times = block.data + sizeof(int64_t);
+  const uint8_t* first_positions = times + n * sizeof(double);
+  const uint8_t* deltas = first_positions + 3 * L * sizeof(int32_t);
+  const uint8_t* quaternions = deltas + 3 * (n - 1) * L * sizeof(int16_t);
+
+  if (message->num_links != L ||
+      static_cast<int>(message->link_name.size()) != L) {
+    message->num_links = L;
+    message->link_name = link_names_;
+    message->robot_num = robot_nums_;
+    message->position.assign(L, std::vector<float>(3));
+    message->quaternion.assign(L, std::vector<float>(4));
+  }
+  message->timestamp =
+      static_cast<int64_t>(Load<double>(times + f * sizeof(double)) * 1000);
+
+  for (int i = 0; i < L; ++i) {
+    for (int k = 0; k < 3; ++k) {
+      int64_t quantized =
+          Load<int32_t>(first_positions + (3 * i + k) * sizeof(int32_t));
+      for (int64_t j = 0; j < f; ++j) {
+        quantized += Load<int16_t>(
+            deltas + (3 * (j * L + i) + k) * sizeof(int16_t));
+      }
+      message->position[i][k] =
+          static_cast<float>(quantized * position_resolution_);
+    }
+    double q[4];
+    double norm = 0;
+    for (int k = 0; k < 4; ++k) {
+      q[k] = Load<int16_t>(quaternions + (4 * (f * L + i) + k) *
+                                             sizeof(int16_t)) /
+             kQuaternionScale;
+      norm += q[k] * q[k];
+    }
+    norm = std::sqrt(norm);
+    for (int k = 0; k < 4; ++k) {
+      message->quaternion[i][k] = static_cast<float>(q[k] / norm);
+    }
+  }
+}
+
+void ReplayPoseStream(const PoseStreamReader& reader,
+                      drake::lcm::DrakeLcmInterface* lcm, double start_time) {
+  DRAKE_DEMAND(lcm != nullptr);
+  if (reader.num_frames() == 0) return;
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::duration<double>;
+  using TimePoint = std::chrono::time_point<Clock, Duration>;
+
+  // Target frame length at 60 Hz playback rate.
+  const double kFrameLength = 1 / 60.0;
+  const int64_t last_frame = reader.num_frames() - 1;
+  const double end_time = reader.frame_time(last_frame);
+  double sim_time = std::max(start_time, reader.frame_time(0));
+  TimePoint prev_time = Clock::now();
+  drake::lcmt_viewer_draw message;
+  std::vector<uint8_t> message_bytes;
+  auto publish = [&](int64_t frame) {
+    reader.ReadFrame(frame, &message);
+    const int message_length = message.getEncodedSize();
+    message_bytes.resize(message_length);
+    message.encode(message_bytes.data(), 0, message_length);
+    lcm->Publish("DRAKE_VIEWER_DRAW", message_bytes.data(),
+                 message_bytes.size(), reader.frame_time(frame));
+  };
+  while (sim_time < end_time) {
+    publish(reader.FindFrame(sim_time));
+
+    const TimePoint earliest_next_frame = prev_time + Duration(kFrameLength);
+    std::this_thread::sleep_until(earliest_next_frame);
+    TimePoint curr_time = Clock::now();
+    sim_time += (curr_time - prev_time).count();
+    prev_time = curr_time;
+  }
+
+  // The last frame is always published, so the final state is visualized.
+  publish(last_frame);
+}
+
+}  // namespace systems
+}  // namespace drake
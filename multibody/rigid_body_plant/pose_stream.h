@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/lcm/drake_lcm_interface.h"
+#include "drake/lcmt_viewer_draw.hpp"
+
+namespace drake {
+namespace systems {
+
+/**
+ Writes the poses of the links of a `drake::lcmt_viewer_draw` message, one
+ frame at a time, to a compact binary file. A file written by this class is
+ read by PoseStreamReader, and replayed by ReplayPoseStream(), without the
+ RigidBodyTree or any kinematics.
+
+ The file holds a header with the robot number and name of each link, followed
+ by a sequence of blocks of consecutive frames. Each block stores:
+  - the time of each frame;
+  - the positions of the first frame, quantized to a multiple of the
+    position resolution;
+  - for each following frame, the change of each quantized position since the
+    previous frame, as a 16-bit integer;
+  - the quaternions of every frame, each component quantized to a 16-bit
+    integer.
+ A block ends when it holds `max_frames_per_block` frames, or when a position
+ moves by more than 32767 resolution steps in one frame. A frame thus takes 8
+ bytes for its time and 14 bytes per link, instead of a full state vector.
+ Seeking a frame only decodes the start of its block.
+ */
+class PoseStreamWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PoseStreamWriter)
+
+  /** Creates (or truncates) @p filename and writes the header.
+   @param links  The links to record, as listed by a draw message. Only the
+   link names and robot numbers are used.
+   @param position_resolution  The quantization step of the positions, in
+   meters.
+   @param max_frames_per_block  The number of frames after which a new block,
+   which starts with absolute positions, is begun.
+   @throws std::runtime_error if the file cannot be opened. */
+  PoseStreamWriter(const std::string& filename,
+                   const drake::lcmt_viewer_draw& links,
+                   double position_resolution = 1E-4,
+                   int max_frames_per_block = 64);
+
+  /** Writes the pending frames and closes the file. Errors are ignored; call
+   Flush() first to have them reported. */
+  ~PoseStreamWriter();
+
+  /** Appends a frame at @p time with the poses of @p poses, which must list
+   the same links as the message passed to the constructor. The frames must
+   be appended in nondecreasing time order.
+   @throws std::runtime_error if a write fails, or if a position exceeds the
+   range of the quantization. */
+  void Append(double time, const drake::lcmt_viewer_draw& poses);
+
+  /** Writes the frames not written yet to the file.
+   @throws std::runtime_error if a write fails. */
+  void Flush();
+
+  int num_links() const { return num_links_; }
+
+ private:
+  void WriteBlock();
+
+  const int num_links_;
+  const double position_resolution_;
+  const int max_frames_per_block_;
+  std::FILE* file_{nullptr};
+
+  // The frames of the current block, in the layout of the file.
+  std::vector<double> times_;
+  std::vector<int32_t> first_positions_;
+  std::vector<int16_t> position_deltas_;
+  std::vector<int16_t> quaternions_;
+  // The quantized positions of the last frame.
+  std::vector<int64_t> last_positions_;
+};
+
+/**
+ Reads a file written by PoseStreamWriter. The file is memory mapped, so
+ opening it is cheap regardless of its size, and only the blocks that are
+ accessed are read from disk.
+ */
+class PoseStreamReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PoseStreamReader)
+
+  /** Maps @p filename into memory.
+   @throws std::runtime_error if the file cannot be mapped or is not a pose
+   stream file. */
+  explicit PoseStreamReader(const std::string& filename);
+
+  ~PoseStreamReader();
+
+  int num_links() const { return static_cast<int>(link_names_.size()); }
+
+  const std::vector<std::string>& link_names() const { return link_names_; }
+
+  const std::vector<int32_t>& robot_nums() const { return robot_nums_; }
+
+  /** Returns the total number of frames in the file. */
+  int64_t num_frames() const { return num_frames_; }
+
+  /** Returns the time of frame @p frame. */
+  double frame_time(int64_t frame) const;
+
+  /** Returns the last frame whose time is not after @p time, or the first
+   frame if @p time precedes every frame. There must be at least one frame. */
+  int64_t FindFrame(double time) const;
+
+  /** Writes the poses of frame @p frame into @p message, along with the link
+   names and robot numbers. The storage of @p message is reused when it
+   already lists the links of the file. */
+  void ReadFrame(int64_t frame, drake::lcmt_viewer_draw* message) const;
+
+ private:
+  struct Block {
+    int64_t first_frame{};
+    int64_t num_frames{};
+    const uint8_t* data{};
+  };
+
+  // Returns the index in blocks_ of the block holding @p frame.
+  int FindBlock(int64_t frame) const;
+
+  void* mapping_{nullptr};
+  size_t mapping_size_{0};
+  double position_resolution_{0};
+  std::vector<std::string> link_names_;
+  std::vector<int32_t> robot_nums_;
+  int64_t num_frames_{0};
+  std::vector<Block> blocks_;
+};
+
+/**
+ Publishes the frames of @p reader as `lcmt_viewer_draw` messages on the
+ "DRAKE_VIEWER_DRAW" channel of @p lcm, at real time starting from
+ @p start_time, with at most 60 messages per second. The last frame is always
+ published. Since the poses are read from the file, this neither needs the
+ RigidBodyTree nor computes any kinematics.
+ */
+void ReplayPoseStream(const PoseStreamReader& reader,
+                      drake::lcm::DrakeLcmInterface* lcm,
+                      double start_time = 0);
+
+}  // namespace systems
+}  // namespace drake
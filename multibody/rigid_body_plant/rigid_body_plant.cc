@@ -1,7 +1,9 @@
 #include "drake/multibody/rigid_body_plant/rigid_body_plant.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <vector>
 
@@ -29,6 +31,23 @@ namespace {
 // Constant used to indicate that a model instance doesn't have an
 // input/output port associated with it.
 const int kInvalidPortIdentifier = -1;
+
+// Returns true if @p a and @p b are identical, including any derivatives.
+bool IsIdentical(const VectorX<double>& a, const VectorX<double>& b) {
+  return a.size() == b.size() && a == b;
+}
+
+bool IsIdentical(const VectorX<AutoDiffXd>& a, const VectorX<AutoDiffXd>& b) {
+  if (a.size() != b.size()) return false;
+  for (int i = 0; i < a.size(); ++i) {
+    if (a(i).value() != b(i).value() ||
+        a(i).derivatives().size() != b(i).derivatives().size() ||
+        a(i).derivatives() != b(i).derivatives()) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
 template <typename T>
@@ -57,7 +76,10 @@ template <typename U>
 RigidBodyPlant<T>::RigidBodyPlant(const RigidBodyPlant<U>& other)
     : LeafSystem<T>(SystemTypeTag<drake::systems::RigidBodyPlant>{}),
       tree_(other.get_rigid_body_tree().Clone()),
+      lcp_warm_start_enabled_(other.lcp_warm_start_enabled_),
+      pgs_parameters_(other.pgs_parameters_),
       timestep_(other.get_time_step()),
+      sleep_parameters_(other.sleep_parameters_),
       compliant_contact_model_(std::make_unique<CompliantContactModel<T>>(
           *other.compliant_contact_model_)) {
   initialize();
@@ -66,6 +88,7 @@ RigidBodyPlant<T>::RigidBodyPlant(const RigidBodyPlant<U>& other)
 template <typename T>
 void RigidBodyPlant<T>::initialize() {
   DRAKE_DEMAND(tree_ != nullptr);
+  InitializeSleepIslands();
   state_output_port_index_ =
       this->DeclareVectorOutputPort(BasicVector<T>(get_num_states()),
                                     &RigidBodyPlant::CopyStateToOutput)
@@ -92,11 +115,46 @@ void RigidBodyPlant<T>::initialize() {
   // Declares an abstract valued output port for contact information.
   contact_output_port_index_ = DeclareContactResultsOutputPort();
 
+  if (is_state_discrete()) {
+    sleep_status_output_port_index_ =
+        this->DeclareVectorOutputPort(BasicVector<T>(2),
+                                      &RigidBodyPlant::CalcSleepStatusOutput)
+            .get_index();
+  }
+
   // Schedule time stepping update.
   if (timestep_ > 0.0)
     this->DeclarePeriodicDiscreteUpdate(timestep_);
 }
 
+template <typename T>
+const KinematicsCache<T>& RigidBodyPlant<T>::EvalKinematicsCache(
+    const VectorX<T>& q, const VectorX<T>& v) const {
+  if (kinematics_ == nullptr || !IsIdentical(q, kinematics_q_) ||
+      !IsIdentical(v, kinematics_v_)) {
+    kinematics_ =
+        std::make_unique<KinematicsCache<T>>(tree_->doKinematics(q, v));
+    kinematics_q_ = q;
+    kinematics_v_ = v;
+  }
+  return *kinematics_;
+}
+
+template <typename T>
+const typename RigidBodyPlant<T>::MassMatrixFactorization&
+RigidBodyPlant<T>::EvalMassMatrix(const VectorX<T>& q) const {
+  if (mass_matrix_ == nullptr || !IsIdentical(q, mass_matrix_q_)) {
+    // The mass matrix needs only the position kinematics.
+    auto kinsol = tree_->doKinematics(q);
+    auto mass_matrix = std::make_unique<MassMatrixFactorization>();
+    mass_matrix->M = tree_->massMatrix(kinsol);
+    mass_matrix->ldlt.compute(mass_matrix->M);
+    mass_matrix_ = std::move(mass_matrix);
+    mass_matrix_q_ = q;
+  }
+  return *mass_matrix_;
+}
+
 template <class T>
 OutputPortIndex RigidBodyPlant<T>::DeclareContactResultsOutputPort() {
   return this->DeclareAbstractOutputPort(
@@ -104,6 +162,40 @@ OutputPortIndex RigidBodyPlant<T>::DeclareContactResultsOutputPort() {
       &RigidBodyPlant::CalcContactResultsOutput).get_index();
 }
 
+template <typename T>
+void RigidBodyPlant<T>::InitializeSleepIslands() {
+  // Group the bodies by the subtree attached to the world that they belong
+  // to, in order of the root bodies of those subtrees.
+  std::map<int, SleepIsland> root_islands;
+  std::vector<int> body_root(tree_->get_num_bodies(), -1);
+  for (const auto& body : tree_->get_bodies()) {
+    if (!body->has_parent_body()) continue;
+    const RigidBody<double>* root = body.get();
+    while (root->get_parent()->has_parent_body()) root = root->get_parent();
+    body_root[body->get_body_index()] = root->get_body_index();
+    SleepIsland& island = root_islands[root->get_body_index()];
+    ++island.num_bodies;
+    const int num_joint_velocities = body->getJoint().get_num_velocities();
+    for (int i = 0; i < num_joint_velocities; ++i)
+      island.velocity_indices.push_back(body->get_velocity_start_index() + i);
+  }
+
+  // Subtrees without velocities, e.g. bodies welded to the world, cannot
+  // move, and form no island.
+  std::map<int, int> root_island_index;
+  sleep_islands_.clear();
+  for (auto& root_island : root_islands) {
+    if (root_island.second.velocity_indices.empty()) continue;
+    root_island_index[root_island.first] = sleep_islands_.size();
+    sleep_islands_.push_back(std::move(root_island.second));
+  }
+  body_island_.assign(tree_->get_num_bodies(), -1);
+  for (int i = 0; i < tree_->get_num_bodies(); ++i) {
+    const auto iter = root_island_index.find(body_root[i]);
+    if (iter != root_island_index.end()) body_island_[i] = iter->second;
+  }
+}
+
 template <class T>
 Eigen::VectorBlock<const VectorX<T>> RigidBodyPlant<T>::GetStateVector(
     const Context<T>& context) const {
@@ -221,6 +313,12 @@ void RigidBodyPlant<T>::set_contact_model_parameters(
   compliant_contact_model_->set_model_parameters(parameters);
 }
 
+template <typename T>
+void RigidBodyPlant<T>::set_lcp_warm_start(bool enabled) {
+  lcp_warm_start_enabled_ = enabled;
+  lcp_warm_start_ = LcpWarmStart();
+}
+
 template <typename T>
 void RigidBodyPlant<T>::set_default_compliant_material(
     const CompliantMaterial& material) {
@@ -440,6 +538,10 @@ std::unique_ptr<DiscreteValues<T>> RigidBodyPlant<T>::AllocateDiscreteState()
   discrete_state_vector.push_back(
       make_unique<BasicVector<T>>(1));
 
+  // The sleep state; see SleepIsland.
+  discrete_state_vector.push_back(
+      make_unique<BasicVector<T>>(2 * sleep_islands_.size() + 1));
+
   return make_unique<DiscreteValues<T>>(std::move(discrete_state_vector));
 }
 
@@ -897,11 +999,9 @@ void RigidBodyPlant<T>::DoCalcTimeDerivatives(
   // is not instantiated in drakeRBM.
   VectorX<T> q = x.topRows(nq);
   VectorX<T> v = x.bottomRows(nv);
-  // TODO(amcastro-tri): place kinematics cache in the context so it can be
-  // reused.
-  auto kinsol = tree_->doKinematics(q, v);
-
-  const MatrixX<T> M = tree_->massMatrix(kinsol);
+  const KinematicsCache<T>& kinsol = EvalKinematicsCache(q, v);
+  const MassMatrixFactorization& mass_matrix = EvalMassMatrix(q);
+  const MatrixX<T>& M = mass_matrix.M;
 
   // There are no external wrenches, but it is a required argument in
   // dynamicsBiasTerm.
@@ -911,8 +1011,11 @@ void RigidBodyPlant<T>::DoCalcTimeDerivatives(
   const typename RigidBodyTree<T>::BodyToWrenchMap no_external_wrenches;
   // right_hand_side is the right hand side of the system's equations:
   // M*vdot -J^T*f = right_hand_side.
-  VectorX<T> right_hand_side =
-      -tree_->dynamicsBiasTerm(kinsol, no_external_wrenches);
+  // TODO(#2274) dynamicsBiasTerm() takes a mutable KinematicsCache, but only
+  // to fill in the composite inertias, which are a function of the cached
+  // kinematics; the cached value is therefore unchanged.
+  VectorX<T> right_hand_side = -tree_->dynamicsBiasTerm(
+      const_cast<KinematicsCache<T>&>(kinsol), no_external_wrenches);
   if (num_actuators > 0) right_hand_side += tree_->B * u;
 
   // Applies joint limit forces.
@@ -965,7 +1068,7 @@ void RigidBodyPlant<T>::DoCalcTimeDerivatives(
     vdot = vdot_f.head(get_num_velocities());
   } else {
     // Solve M*vdot = right_hand_side.
-    vdot = M.llt().solve(right_hand_side);
+    vdot = mass_matrix.ldlt.solve(right_hand_side);
   }
 
   VectorX<T> xdot(get_num_states());
@@ -1006,13 +1109,14 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
   auto x = context.get_discrete_state(0).get_value();
   VectorX<T> q = x.topRows(nq);
   VectorX<T> v = x.bottomRows(nv);
-  auto kinematics_cache = tree.doKinematics(q, v);
-
-  // Get the generalized inertia matrix and set up the inertia solve function.
-  auto H = tree.massMatrix(kinematics_cache);
-
-  // Compute the LDLT factorizations, which will be used by the solver.
-  Eigen::LDLT<MatrixX<T>> ldlt(H);
+  const KinematicsCache<T>& kinematics_cache =
+      this->EvalKinematicsCache(q, v);
+
+  // Get the LDLT factorization of the generalized inertia matrix, which will
+  // be used by the solver.
+  const MassMatrixFactorization& mass_matrix = this->EvalMassMatrix(q);
+  const MatrixX<T>& H = mass_matrix.M;
+  const Eigen::LDLT<MatrixX<T>>& ldlt = mass_matrix.ldlt;
   DRAKE_DEMAND(ldlt.info() == Eigen::Success);
 
   // Set the inertia matrix solver.
@@ -1026,8 +1130,9 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
 
   // right_hand_side is the right hand side of the system's equations:
   //   right_hand_side = B*u - C(q,v)
-  VectorX<T> right_hand_side =
-      -tree.dynamicsBiasTerm(kinematics_cache, no_external_wrenches);
+  // TODO(#2274) See DoCalcTimeDerivatives() for why the const_cast is safe.
+  VectorX<T> right_hand_side = -tree.dynamicsBiasTerm(
+      const_cast<KinematicsCache<T>&>(kinematics_cache), no_external_wrenches);
   if (num_actuators > 0) right_hand_side += tree.B * u;
 
   // Determine the set of contact points corresponding to the current q.
@@ -1035,6 +1140,149 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
       const_cast<RigidBodyTree<double>*>(&tree)
           ->ComputeMaximumDepthCollisionPoints(kinematics_cache, true);
 
+  // Determine which islands sleep through this step: those that were asleep
+  // and are neither actuated nor touching an awake island, directly or
+  // through other islands. Islands in contact form one group, which sleeps
+  // or wakes as a whole.
+  const int num_islands = sleep_islands_.size();
+  const bool sleep_enabled =
+      sleep_parameters_ && tree.getNumPositionConstraints() == 0;
+  const VectorX<T>& sleep_state = context.get_discrete_state(2).get_value();
+  std::vector<int> island_group(num_islands);
+  std::iota(island_group.begin(), island_group.end(), 0);
+  const auto find_group = [&island_group](int k) {
+    while (island_group[k] != k) {
+      island_group[k] = island_group[island_group[k]];
+      k = island_group[k];
+    }
+    return k;
+  };
+  const auto body_island = [this](
+      const drake::multibody::collision::Element* element) {
+    return body_island_[element->get_body()->get_body_index()];
+  };
+  std::vector<bool> asleep(num_islands, false);
+  std::vector<bool> asleep_velocity(nv, false);
+  bool any_asleep = false;
+  if (sleep_enabled) {
+    for (const auto& contact : contacts) {
+      const int island_A = body_island(contact.elementA);
+      const int island_B = body_island(contact.elementB);
+      if (island_A >= 0 && island_B >= 0)
+        island_group[find_group(island_A)] = find_group(island_B);
+    }
+    const VectorX<T> actuation =
+        (num_actuators > 0) ? VectorX<T>(tree.B * u) : VectorX<T>::Zero(nv);
+    std::vector<bool> group_awake(num_islands, false);
+    for (int k = 0; k < num_islands; ++k) {
+      bool awake = (sleep_state[num_islands + k] == 0);
+      for (int i : sleep_islands_[k].velocity_indices)
+        awake = awake || (actuation[i] != 0);
+      if (awake) group_awake[find_group(k)] = true;
+    }
+    for (int k = 0; k < num_islands; ++k) {
+      asleep[k] = !group_awake[find_group(k)];
+      if (!asleep[k]) continue;
+      any_asleep = true;
+      for (int i : sleep_islands_[k].velocity_indices)
+        asleep_velocity[i] = true;
+    }
+
+    // Drop the contacts of sleeping islands, with each other and with bodies
+    // that cannot move.
+    const auto is_awake = [&body_island, &asleep](
+        const drake::multibody::collision::Element* element) {
+      const int island = body_island(element);
+      return island >= 0 && !asleep[island];
+    };
+    contacts.erase(
+        std::remove_if(contacts.begin(), contacts.end(),
+                       [&is_awake](
+                           const drake::multibody::collision::PointPair<T>& c) {
+                         return !is_awake(c.elementA) &&
+                                !is_awake(c.elementB);
+                       }),
+        contacts.end());
+  }
+
+  // Returns the sleep state after this step, given the new velocities of the
+  // islands that are awake; puts to sleep, by zeroing their velocities, the
+  // groups whose islands have all been at rest for long enough.
+  const auto update_sleep_state = [&](VectorX<T>* new_velocity) {
+    VectorX<T> new_sleep_state = VectorX<T>::Zero(2 * num_islands + 1);
+    if (!sleep_enabled) return new_sleep_state;
+    std::vector<bool> group_rested(num_islands, true);
+    int num_woken_bodies = 0;
+    for (int k = 0; k < num_islands; ++k) {
+      new_sleep_state[k] = sleep_state[k];
+      if (asleep[k]) continue;
+      // An island that just woke up starts resting anew.
+      const bool woken = (sleep_state[num_islands + k] != 0);
+      if (woken) num_woken_bodies += sleep_islands_[k].num_bodies;
+      T max_speed = 0;
+      for (int i : sleep_islands_[k].velocity_indices)
+        max_speed = std::max(max_speed, T(abs((*new_velocity)[i])));
+      if (max_speed <= sleep_parameters_->velocity_threshold)
+        new_sleep_state[k] = (woken ? T(0) : sleep_state[k]) + dt;
+      else
+        new_sleep_state[k] = 0;
+      if (new_sleep_state[k] < sleep_parameters_->time_to_sleep)
+        group_rested[find_group(k)] = false;
+    }
+    for (int k = 0; k < num_islands; ++k) {
+      if (!asleep[k] && !group_rested[find_group(k)]) continue;
+      new_sleep_state[num_islands + k] = 1;
+      for (int i : sleep_islands_[k].velocity_indices) (*new_velocity)[i] = 0;
+    }
+    new_sleep_state[2 * num_islands] = num_woken_bodies;
+    return new_sleep_state;
+  };
+
+  // With every island asleep, nothing moves.
+  if (any_asleep &&
+      std::find(asleep_velocity.begin(), asleep_velocity.end(), false) ==
+          asleep_velocity.end()) {
+    VectorX<T> new_velocity = VectorX<T>::Zero(nv);
+    updates->get_mutable_vector(2).SetFromVector(
+        update_sleep_state(&new_velocity));
+    VectorX<T> xn(this->get_num_states());
+    xn << q, new_velocity;
+    updates->get_mutable_vector(0).SetFromVector(xn);
+    updates->get_mutable_vector(1)[0] = t + dt;
+    return;
+  }
+
+  // Otherwise, solve for the velocities of the awake islands only. M(q) is
+  // block diagonal over the islands, so this restricts it to the block of
+  // the awake ones.
+  std::vector<int> awake_velocities;
+  Eigen::LDLT<MatrixX<T>> awake_ldlt;
+  if (any_asleep) {
+    for (int i = 0; i < nv; ++i) {
+      if (!asleep_velocity[i]) awake_velocities.push_back(i);
+    }
+    const int num_awake = awake_velocities.size();
+    MatrixX<T> H_awake(num_awake, num_awake);
+    for (int i = 0; i < num_awake; ++i) {
+      for (int j = 0; j < num_awake; ++j)
+        H_awake(i, j) = H(awake_velocities[i], awake_velocities[j]);
+    }
+    awake_ldlt.compute(H_awake);
+    DRAKE_DEMAND(awake_ldlt.info() == Eigen::Success);
+    data.solve_inertia = [&awake_ldlt, &awake_velocities, nv](
+        const MatrixX<T>& m) {
+      const int num_awake_velocities = awake_velocities.size();
+      MatrixX<T> m_awake(num_awake_velocities, m.cols());
+      for (int i = 0; i < num_awake_velocities; ++i)
+        m_awake.row(i) = m.row(awake_velocities[i]);
+      const MatrixX<T> x_awake = awake_ldlt.solve(m_awake);
+      MatrixX<T> x = MatrixX<T>::Zero(nv, m.cols());
+      for (int i = 0; i < num_awake_velocities; ++i)
+        x.row(awake_velocities[i]) = x_awake.row(i);
+      return x;
+    };
+  }
+
   // Set the stabilization term for contact normal direction (kN). Also,
   // determine the friction coefficients and (half) the number of friction cone
   // edges.
@@ -1062,6 +1310,8 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
   std::vector<JointLimit> limits;
   for (auto const& b : tree.get_bodies()) {
     if (!b->has_parent_body()) continue;
+    const int island = body_island_[b->get_body_index()];
+    if (island >= 0 && asleep[island]) continue;
     auto const& joint = b->getJoint();
 
     // Joint limit forces are only implemented for single-axis joints.
@@ -1195,9 +1445,96 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
   // Integrate the forces into the momentum.
   data.Mv = H * v + right_hand_side * dt;
 
+  // Record this step's constraints, matching them to those of the previous
+  // step to carry over its LCP basis (or, with projected Gauss-Seidel, its
+  // impulses).
+  std::vector<int> initial_basis;
+  VectorX<T> initial_impulses;
+  LcpWarmStart warm_start;
+  if (lcp_warm_start_enabled_) {
+    using ElementId = drake::multibody::collision::ElementId;
+    std::map<std::pair<ElementId, ElementId>, int> previous_contacts;
+    for (int i = 0; i < static_cast<int>(lcp_warm_start_.contacts.size());
+         ++i) {
+      previous_contacts[lcp_warm_start_.contacts[i]] = i;
+    }
+    std::map<std::pair<int, bool>, int> previous_limits;
+    for (int i = 0; i < static_cast<int>(lcp_warm_start_.limits.size()); ++i)
+      previous_limits[lcp_warm_start_.limits[i]] = i;
+
+    std::vector<int> contact_map, limit_map;
+    for (const auto& contact : contacts) {
+      const ElementId id_A = contact.elementA->getId();
+      const ElementId id_B = contact.elementB->getId();
+      warm_start.contacts.emplace_back(std::min(id_A, id_B),
+                                       std::max(id_A, id_B));
+      auto iter = previous_contacts.find(warm_start.contacts.back());
+      contact_map.push_back(iter == previous_contacts.end() ? -1
+                                                            : iter->second);
+    }
+    warm_start.half_cone_edges = data.r;
+    for (const JointLimit& limit : limits) {
+      warm_start.limits.emplace_back(limit.v_index, limit.lower_limit);
+      auto iter = previous_limits.find(warm_start.limits.back());
+      limit_map.push_back(iter == previous_limits.end() ? -1 : iter->second);
+    }
+    if (!pgs_parameters_) {
+      initial_basis =
+          drake::multibody::constraint::ConstraintSolver<double>::
+              MapImpactProblemBasis(lcp_warm_start_.basis,
+                                    lcp_warm_start_.half_cone_edges,
+                                    lcp_warm_start_.limits.size(), data.r,
+                                    contact_map, limit_map);
+    } else if (lcp_warm_start_.impulses.size() > 0) {
+      // Carry over the normal and frictional impulses of the matched
+      // contacts (the latter only if the number of spanning directions is
+      // unchanged), the impulses of the matched limits, and the bilateral
+      // constraint impulses if their number is unchanged.
+      const std::vector<int>& old_r = lcp_warm_start_.half_cone_edges;
+      const int old_nc = old_r.size();
+      const int old_nr = std::accumulate(old_r.begin(), old_r.end(), 0);
+      const int old_nl = lcp_warm_start_.limits.size();
+      const int nc = contacts.size();
+      const int nl = limits.size();
+      const int nb = data.kG.size();
+      std::vector<int> old_edge_start(old_nc, old_nc);
+      for (int i = 1; i < old_nc; ++i)
+        old_edge_start[i] = old_edge_start[i - 1] + old_r[i - 1];
+      initial_impulses.setZero(nc + total_friction_cone_edges + nl + nb);
+      for (int i = 0, edge = nc; i < nc; edge += data.r[i++]) {
+        const int j = contact_map[i];
+        if (j < 0) continue;
+        initial_impulses[i] = lcp_warm_start_.impulses[j];
+        if (data.r[i] == old_r[j]) {
+          initial_impulses.segment(edge, data.r[i]) =
+              lcp_warm_start_.impulses.segment(old_edge_start[j], old_r[j]);
+        }
+      }
+      for (int i = 0; i < nl; ++i) {
+        if (limit_map[i] >= 0) {
+          initial_impulses[nc + total_friction_cone_edges + i] =
+              lcp_warm_start_.impulses[old_nc + old_nr + limit_map[i]];
+        }
+      }
+      if (lcp_warm_start_.impulses.size() == old_nc + old_nr + old_nl + nb) {
+        initial_impulses.tail(nb) = lcp_warm_start_.impulses.tail(nb);
+      }
+    }
+  }
+
   // Solve the rigid impact problem.
   VectorX<T> new_velocity, contact_force;
-  constraint_solver_.SolveImpactProblem(data, &contact_force);
+  if (pgs_parameters_) {
+    constraint_solver_.SolveImpactProblemWithPgs(
+        data, *pgs_parameters_, initial_impulses, &contact_force);
+    if (lcp_warm_start_enabled_) warm_start.impulses = contact_force;
+  } else {
+    constraint_solver_.SolveImpactProblem(
+        data, initial_basis, &contact_force,
+        lcp_warm_start_enabled_ ? &warm_start.basis : nullptr);
+    num_lcp_pivots_ += constraint_solver_.get_num_impact_lcp_pivots();
+  }
+  if (lcp_warm_start_enabled_) lcp_warm_start_ = std::move(warm_start);
   constraint_solver_.ComputeGeneralizedVelocityChange(data, contact_force,
       &new_velocity);
   SPDLOG_DEBUG(drake::log(), "Actuator forces: {} ", u.transpose());
@@ -1226,6 +1563,9 @@ RigidBodyPlant<T>::DoCalcDiscreteVariableUpdatesImpl(
   SPDLOG_DEBUG(drake::log(), "g(): {}",
       tree.positionConstraints(kinematics_cache).transpose());
 
+  updates->get_mutable_vector(2).SetFromVector(
+      update_sleep_state(&new_velocity));
+
   // qn = q + dt*qdot.
   VectorX<T> xn(this->get_num_states());
   xn << q + dt * tree.transformVelocityToQDot(kinematics_cache, new_velocity),
@@ -1373,20 +1713,30 @@ void RigidBodyPlant<T>::CalcContactResultsOutput(
   if (is_state_discrete())
     return;
 
-  // TODO(SeanCurtis-TRI): This is horribly redundant code that only exists
-  // because the data is not properly accessible in the cache.  This is
-  // boilerplate drawn from EvalDerivatives.  See that code for further
-  // comments
+  // TODO(SeanCurtis-TRI): The contact forces are computed again here, because
+  // the ones computed by DoCalcTimeDerivatives() are not cached.
   auto x = GetStateVector(context);
-  const int nq = get_num_positions();
-  const int nv = get_num_velocities();
-  VectorX<T> q = x.topRows(nq);
-  VectorX<T> v = x.bottomRows(nv);
-  auto kinsol = tree_->doKinematics(q, v);
+  const VectorX<T> q = x.topRows(get_num_positions());
+  const VectorX<T> v = x.bottomRows(get_num_velocities());
+  const KinematicsCache<T>& kinsol = EvalKinematicsCache(q, v);
 
   compliant_contact_model_->ComputeContactForce(*tree_.get(), kinsol, contacts);
 }
 
+template <typename T>
+void RigidBodyPlant<T>::CalcSleepStatusOutput(
+    const Context<T>& context, BasicVector<T>* output) const {
+  const VectorX<T>& sleep_state = context.get_discrete_state(2).get_value();
+  const int num_islands = sleep_islands_.size();
+  int num_asleep = 0;
+  for (int k = 0; k < num_islands; ++k) {
+    if (sleep_state[num_islands + k] != 0)
+      num_asleep += sleep_islands_[k].num_bodies;
+  }
+  output->SetAtIndex(0, T(num_asleep));
+  output->SetAtIndex(1, sleep_state[2 * num_islands]);
+}
+
 template <typename T>
 VectorX<T> RigidBodyPlant<T>::EvaluateActuatorInputs(
     const Context<T>& context) const {
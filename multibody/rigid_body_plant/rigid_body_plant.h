@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/Cholesky>
 #include <Eigen/Geometry>
 
 #include "drake/common/drake_copyable.h"
@@ -18,6 +19,16 @@
 namespace drake {
 namespace systems {
 
+/// Parameters of the sleeping of resting bodies in a time-stepping
+/// RigidBodyPlant; see RigidBodyPlant::set_sleep_parameters().
+struct RigidBodySleepParameters {
+  /// The largest magnitude of a generalized velocity of a body at rest.
+  double velocity_threshold{1e-3};
+
+  /// How long, in seconds, bodies must stay at rest before they fall asleep.
+  double time_to_sleep{0.5};
+};
+
 /// This class provides a System interface around a multibody dynamics model
 /// of the world represented by a RigidBodyTree.
 ///
@@ -69,6 +80,11 @@ namespace systems {
 ///   ContactsResults object allowing access to the results from contact
 ///   computations.
 ///
+/// - sleep_status_output_port(): A vector-valued port containing the number
+///   of bodies that are asleep and the number of bodies woken by the most
+///   recent update; see set_sleep_parameters(). Only time-stepping plants
+///   have this port.
+///
 /// <B>Model-Instance-Centric Port Accessors:</B>
 ///
 /// - model_instance_actuator_command_input_port(): Contains the command vector
@@ -91,7 +107,8 @@ namespace systems {
 /// constraints are not yet supported. For %RigidBodyPlant systems
 /// simulated using time stepping algorithms, an additional (discrete)
 /// scalar state variable stores the last time that the system's state was
-/// updated.
+/// updated, and a third group of discrete state variables stores which bodies
+/// are asleep (see set_sleep_parameters()).
 ///
 /// The system dynamics is given by the set of multibody equations written in
 /// generalized coordinates including loop joints as a set of holonomic
@@ -258,6 +275,9 @@ class RigidBodyPlant : public LeafSystem<T> {
 
       // Set the initial time.
       state->get_mutable_discrete_state().get_mutable_vector(1)[0] = 0;
+
+      // All bodies start awake.
+      state->get_mutable_discrete_state().get_mutable_vector(2).SetZero();
     } else {
       // Extract a reference to continuous state from the context.
       ContinuousState<T>& xc = state->get_mutable_continuous_state();
@@ -380,6 +400,16 @@ class RigidBodyPlant : public LeafSystem<T> {
   const OutputPort<T>& contact_results_output_port() const {
     return System<T>::get_output_port(contact_output_port_index_);
   }
+
+  /// Returns the sleep status output port, a vector of size two containing
+  /// the number of bodies that are asleep and the number of bodies that were
+  /// woken by the most recent update. Both are zero unless sleeping is enabled
+  /// with set_sleep_parameters().
+  /// @pre This %RigidBodyPlant is using discrete-time dynamics.
+  const OutputPort<T>& sleep_status_output_port() const {
+    DRAKE_DEMAND(sleep_status_output_port_index_.has_value());
+    return System<T>::get_output_port(*sleep_status_output_port_index_);
+  }
   ///@}
 
   // Gets a constant reference to the state vector, irrespective of whether
@@ -395,6 +425,73 @@ class RigidBodyPlant : public LeafSystem<T> {
   /// (seconds per update).
   double get_time_step() const { return timestep_; }
 
+  /// Sets whether the impact LCP solved by each time step is warm started
+  /// from the previous time step's solution. Contacts are matched across
+  /// steps by their pair of collision elements, and joint limits by their
+  /// joint and side; the basis of the previous LCP solution is carried over
+  /// to the matched constraints. In resting contact, successive steps have
+  /// nearly the same contacts, and warm starting saves most of the LCP
+  /// solver's pivoting operations (see get_num_lcp_pivots()).
+  ///
+  /// The previous solution is kept by the plant rather than by the Context,
+  /// so warm starting only helps when a single Context is advanced one step
+  /// at a time (e.g., by a Simulator); stepping several Contexts with the same
+  /// plant is still correct, but gains nothing. Where the LCP has more than
+  /// one solution, warm starting may find a different one than a cold start.
+  /// Has no effect if the plant is continuous. Warm starting is disabled by
+  /// default.
+  void set_lcp_warm_start(bool enabled);
+
+  /// Sets the time-stepping impact problem to be solved approximately by
+  /// projected Gauss-Seidel, with the given @p parameters, rather than exactly
+  /// by Lemke's method; see
+  /// multibody::constraint::ConstraintSolver::SolveImpactProblemWithPgs().
+  /// Lemke's method costs time cubic in the number of contacts, whereas the
+  /// cost of projected Gauss-Seidel is bounded by its iteration budget, which
+  /// suits scenes with many contacts. If warm starting is enabled (see
+  /// set_lcp_warm_start()), each step starts from the impulses of the matched
+  /// constraints of the previous step. Pass `nullopt` to return to Lemke's
+  /// method, which is the default. Has no effect if the plant is continuous.
+  void set_pgs_parameters(
+      const optional<multibody::constraint::PgsParameters>& parameters) {
+    pgs_parameters_ = parameters;
+  }
+
+  /// Returns the total number of pivoting operations made by the impact LCP
+  /// solver over all time steps since the plant was constructed or
+  /// reset_num_lcp_pivots() was last called.
+  int get_num_lcp_pivots() const { return num_lcp_pivots_; }
+
+  /// Resets the count returned by get_num_lcp_pivots() to zero.
+  void reset_num_lcp_pivots() { num_lcp_pivots_ = 0; }
+
+  /// Enables the sleeping of resting bodies in time stepping, with the given
+  /// @p parameters, so that a scene where most bodies have settled costs
+  /// little more per step than its moving bodies alone. Pass `nullopt` to
+  /// disable sleeping, which is the default. Has no effect if the plant is
+  /// continuous or if the tree has loop constraints.
+  ///
+  /// Bodies sleep in islands. Each subtree of the tree that is attached to the
+  /// world, e.g., a free body or a robot, is an island, and islands that touch
+  /// each other are merged for the step. An island falls asleep once all of
+  /// its generalized velocities have stayed within
+  /// RigidBodySleepParameters::velocity_threshold of zero for
+  /// RigidBodySleepParameters::time_to_sleep seconds: its velocities are set
+  /// to zero, and while it sleeps, its positions are frozen and it is left out
+  /// of the factorization of the mass matrix, the joint limits and the impact
+  /// problem. Collision detection still includes sleeping bodies; see
+  /// RigidBodyTree::set_collision_contact_reuse_tolerance() to make resting
+  /// contacts cheaper to detect. A sleeping island wakes when it touches an
+  /// awake island or when its actuators receive a nonzero input; a body
+  /// removed from under a sleeping island does not wake it.
+  ///
+  /// Which islands are asleep is part of the discrete state, so the plant
+  /// can step several Contexts. See sleep_status_output_port().
+  void set_sleep_parameters(
+      const optional<RigidBodySleepParameters>& parameters) {
+    sleep_parameters_ = parameters;
+  }
+
  protected:
   // Constructor for derived classes to support system scalar conversion, as
   // mandated in the doxygen `system_scalar_conversion` documentation.
@@ -462,6 +559,26 @@ class RigidBodyPlant : public LeafSystem<T> {
   // Common logic only intended to be called from the (multiple) constructors.
   void initialize(void);
 
+  // Partitions the bodies into the islands that sleep together, in
+  // sleep_islands_ and body_island_.
+  void InitializeSleepIslands();
+
+  // The generalized inertia matrix M(q) and its factorization.
+  struct MassMatrixFactorization {
+    MatrixX<T> M;
+    Eigen::LDLT<MatrixX<T>> ldlt;
+  };
+
+  // Returns the kinematics at configuration @p q and velocity @p v, reusing
+  // those of the previous call if neither has changed.
+  const KinematicsCache<T>& EvalKinematicsCache(const VectorX<T>& q,
+                                                const VectorX<T>& v) const;
+
+  // Returns M(q) and its factorization at configuration @p q, reusing those
+  // of the previous call if it has not changed. In particular, evaluations
+  // that change only v reuse them.
+  const MassMatrixFactorization& EvalMassMatrix(const VectorX<T>& q) const;
+
   template <typename U = T>
   std::enable_if_t<std::is_same<U, double>::value, void>
   DoCalcDiscreteVariableUpdatesImpl(
@@ -478,7 +595,7 @@ class RigidBodyPlant : public LeafSystem<T> {
 
   OutputPortIndex DeclareContactResultsOutputPort();
 
-  // These five are the output port calculator methods.
+  // These are the output port calculator methods.
   void CopyStateToOutput(const Context<T>& context,
                          BasicVector<T>* state_output_vector) const;
 
@@ -500,6 +617,9 @@ class RigidBodyPlant : public LeafSystem<T> {
   void CalcContactResultsOutput(const Context<T>& context,
                                 ContactResults<T>* output) const;
 
+  void CalcSleepStatusOutput(const Context<T>& context,
+                             BasicVector<T>* output) const;
+
   void ExportModelInstanceCentricPorts();
 
   void CalcContactStiffnessDampingMuAndNumHalfConeEdges(
@@ -542,10 +662,43 @@ class RigidBodyPlant : public LeafSystem<T> {
   // Object that performs all constraint computations.
   multibody::constraint::ConstraintSolver<double> constraint_solver_;
 
+  // The constraints and the LCP basis at the solution of the previous time
+  // step, for warm starting the next step's LCP. Empty if warm starting is
+  // disabled.
+  struct LcpWarmStart {
+    // The (ordered) pair of collision elements of each contact.
+    std::vector<std::pair<multibody::collision::ElementId,
+                          multibody::collision::ElementId>> contacts;
+    // The number of friction cone spanning directions of each contact.
+    std::vector<int> half_cone_edges;
+    // The velocity index and side (true if lower) of each joint limit.
+    std::vector<std::pair<int, bool>> limits;
+    std::vector<int> basis;
+    // The impulses at the solution, in the packed storage format of
+    // ConstraintSolver::SolveImpactProblem(), if projected Gauss-Seidel is
+    // used.
+    VectorX<T> impulses;
+  };
+  bool lcp_warm_start_enabled_{false};
+  optional<multibody::constraint::PgsParameters> pgs_parameters_;
+  mutable LcpWarmStart lcp_warm_start_;
+  mutable int num_lcp_pivots_{0};
+
+  // The kinematics and the mass matrix of the most recent evaluation, with
+  // the state they were computed from; see EvalKinematicsCache() and
+  // EvalMassMatrix(). Like lcp_warm_start_, these are kept by the plant
+  // rather than by the Context.
+  mutable VectorX<T> kinematics_q_;
+  mutable VectorX<T> kinematics_v_;
+  mutable std::unique_ptr<KinematicsCache<T>> kinematics_;
+  mutable VectorX<T> mass_matrix_q_;
+  mutable std::unique_ptr<MassMatrixFactorization> mass_matrix_;
+
   OutputPortIndex state_output_port_index_{};
   optional<OutputPortIndex> state_derivative_output_port_index_;
   OutputPortIndex kinematics_output_port_index_{};
   OutputPortIndex contact_output_port_index_{};
+  optional<OutputPortIndex> sleep_status_output_port_index_;
 
   // timestep == 0.0 implies continuous-time dynamics,
   // timestep > 0.0 implies a discrete-time dynamics approximation.
@@ -579,6 +732,20 @@ class RigidBodyPlant : public LeafSystem<T> {
   // pair of (index, count).
   std::vector<std::pair<int, int>> velocity_map_;
 
+  // A subtree of the tree attached to the world, whose bodies fall asleep
+  // and wake together; see set_sleep_parameters(). The sleep state, discrete
+  // state group 2, holds the rest time of each island, then whether each
+  // island is asleep (1) or not (0), then the number of bodies woken by the
+  // last update.
+  struct SleepIsland {
+    int num_bodies{0};
+    std::vector<int> velocity_indices;
+  };
+  optional<RigidBodySleepParameters> sleep_parameters_;
+  std::vector<SleepIsland> sleep_islands_;
+  // The island of each body, or -1 for bodies that cannot move.
+  std::vector<int> body_island_;
+
   // Pointer to the class that encapsulates all the contact computations.
   const std::unique_ptr<CompliantContactModel<T>> compliant_contact_model_;
 
@@ -49,6 +49,7 @@ template <typename T>
 class CompliantContactModelTest : public ContactResultTestCommon<T> {
  protected:
   const ContactResults<T>& RunTest(double distance) override {
+    this->contact_results_.Clear();
     unique_tree_ = this->GenerateTestTree(distance);
     // Populate the CompliantContactModel.
     compliant_contact_model_ = make_unique<CompliantContactModel<T>>();
@@ -57,6 +58,7 @@ class CompliantContactModelTest : public ContactResultTestCommon<T> {
     CompliantContactModelParameters contact_parameters;
     contact_parameters.v_stiction_tolerance = this->kVStictionTolerance;
     contact_parameters.characteristic_radius = this->kContactRadius;
+    contact_parameters.num_threads = num_threads_;
     compliant_contact_model_->set_model_parameters(contact_parameters);
 
     // The state to test is the default state of the tree (0 velocities
@@ -74,6 +76,8 @@ class CompliantContactModelTest : public ContactResultTestCommon<T> {
     return this->contact_results_;
   }
 
+  // The number of threads the contacts are evaluated on.
+  int num_threads_{1};
   // Instances owned by the test class.
   unique_ptr<CompliantContactModel<T>> compliant_contact_model_{};
   // Holds the unique pointer to the tree.
@@ -151,6 +155,43 @@ TEST_F(CompliantContactModelTestDouble, ModelSingleCollision) {
       CompareMatrices(detail_force.get_application_point(), expected_point));
 }
 
+// Confirms that the generalized contact force, accumulated over the kinematic
+// paths of the bodies only, is the transpose of the full contact point
+// Jacobians times the contact force, with any number of threads.
+TEST_F(CompliantContactModelTestDouble, GeneralizedContactForce) {
+  for (int num_threads : {1, 3}) {
+    num_threads_ = num_threads;
+    const auto& contact_results = RunTest(-0.1);
+    ASSERT_EQ(contact_results.get_num_contacts(), 1);
+    const auto& info = contact_results.get_contact_info(0);
+    const RigidBody<double>* b1 =
+        unique_tree_->FindBody(info.get_element_id_1());
+    const RigidBody<double>* b2 =
+        unique_tree_->FindBody(info.get_element_id_2());
+    const auto& details = info.get_contact_details();
+    ASSERT_EQ(details.size(), 1u);
+    const ContactForce<double> force = details[0]->ComputeContactForce();
+
+    VectorXd q0 = unique_tree_->getZeroConfiguration();
+    VectorXd v0 = VectorXd::Zero(unique_tree_->get_num_velocities());
+    auto kinsol = unique_tree_->doKinematics(q0, v0);
+    const Vector3d p_WC = force.get_application_point();
+    const Vector3d p_1C = unique_tree_->transformPoints(
+        kinsol, p_WC, 0, b1->get_body_index());
+    const Vector3d p_2C = unique_tree_->transformPoints(
+        kinsol, p_WC, 0, b2->get_body_index());
+    const Eigen::MatrixXd J1 = unique_tree_->transformPointsJacobian(
+        kinsol, p_1C, b1->get_body_index(), 0, false);
+    const Eigen::MatrixXd J2 = unique_tree_->transformPointsJacobian(
+        kinsol, p_2C, b2->get_body_index(), 0, false);
+    const VectorXd expected = (J1 - J2).transpose() * force.get_force();
+
+    EXPECT_TRUE(CompareMatrices(contact_results.get_generalized_contact_force(),
+                                expected, 1e-12));
+    EXPECT_GT(expected.norm(), 0.);
+  }
+}
+
 // Test that the autodiff module throws when collision information is discarded
 // (due to the collision model not supporting AutoDiffXd yet).
 TEST_F(CompliantContactModelTestAutoDiffXd, AutoDiffTest) {
@@ -6,6 +6,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/multibody/rigid_body_plant/contact_force.h"
+#include "drake/multibody/rigid_body_plant/contact_results.h"
 #include "drake/multibody/rigid_body_plant/point_contact_detail.h"
 
 // Tests the ContactInfo class .
@@ -144,6 +145,43 @@ GTEST_TEST(ContactInfoTests, SetDetailsCopyableUniquePtr) {
   TestSetDetails<copyable_unique_ptr>();
 }
 
+// Tests that ContactResults reuses its ContactInfo instances after Clear(), and
+// that copies only include the contacts reported since then.
+GTEST_TEST(ContactResultsTests, ClearReusesContacts) {
+  ContactResults<double> results;
+  for (int i = 0; i < 3; ++i) {
+    std::vector<unique_ptr<ContactDetail<double>>> details;
+    details.emplace_back(MakeDetail(i));
+    results.AddContact(i, i + 10).set_contact_details(move(details));
+  }
+  ASSERT_EQ(results.get_num_contacts(), 3);
+  const ContactInfo<double>* const first = &results.get_contact_info(0);
+
+  results.Clear();
+  EXPECT_EQ(results.get_num_contacts(), 0);
+  const ContactInfo<double>& info = results.AddContact(20, 30);
+  EXPECT_EQ(&info, first);
+  EXPECT_EQ(info.get_element_id_1(), 20);
+  EXPECT_EQ(info.get_element_id_2(), 30);
+  EXPECT_EQ(info.get_contact_details().size(), 0);
+  EXPECT_EQ(results.get_num_contacts(), 1);
+
+  const ContactResults<double> copy(results);
+  EXPECT_EQ(copy.get_num_contacts(), 1);
+  AssertValidCopy(copy.get_contact_info(0), info);
+
+  ContactResults<double> assigned;
+  assigned.AddContact(1, 2);
+  assigned.AddContact(3, 4);
+  assigned = results;
+  EXPECT_EQ(assigned.get_num_contacts(), 1);
+  AssertValidCopy(assigned.get_contact_info(0), info);
+
+  ContactResults<double> moved(std::move(assigned));
+  EXPECT_EQ(moved.get_num_contacts(), 1);
+  EXPECT_EQ(assigned.get_num_contacts(), 0);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -1,12 +1,15 @@
 #include "drake/multibody/rigid_body_plant/drake_visualizer.h"
 
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/lcm/drake_mock_lcm.h"
 #include "drake/lcmt_viewer_draw.hpp"
 #include "drake/math/roll_pitch_yaw.h"
@@ -523,6 +526,122 @@ GTEST_TEST(DrakeVisualizerTests, TestPublishPeriod) {
   }
 }
 
+// Tests that the delta encoded draw messages only contain the bodies that
+// moved, and that merging them rebuilds the full draw message.
+GTEST_TEST(DrakeVisualizerTests, DeltaEncoding) {
+  unique_ptr<RigidBodyTree<double>> tree = CreateRigidBodyTree();
+  drake::lcm::DrakeMockLcm lcm;
+  DrakeVisualizer dut(*tree, &lcm);
+  EXPECT_THROW(dut.EnableDeltaEncoding(-1, 0), std::logic_error);
+  dut.EnableDeltaEncoding(1E-3, 1E-3);
+  auto context = dut.CreateDefaultContext();
+
+  const int vector_size =
+      tree->get_num_positions() + tree->get_num_velocities();
+  Eigen::VectorXd state = Eigen::VectorXd::Zero(vector_size);
+  context->FixInputPort(0, state);
+  PublishLoadRobotModelMessageHelper(dut, *context);
+
+  // The first draw message contains all the bodies.
+  dut.Publish(*context);
+  VerifyDrawMessage(lcm.get_last_published_message("DRAKE_VIEWER_DRAW"));
+  lcmt_viewer_draw merged =
+      lcm.DecodeLastPublishedMessageAs<lcmt_viewer_draw>("DRAKE_VIEWER_DRAW");
+
+  // Moves the box body by more than the tolerance, and the capsule body by
+  // less than the tolerance. Only the box body is sent.
+  state(0) = 0.5;
+  state(6) = 1E-4;
+  context->FixInputPort(0, state);
+  dut.Publish(*context);
+  const auto delta =
+      lcm.DecodeLastPublishedMessageAs<lcmt_viewer_draw>("DRAKE_VIEWER_DRAW");
+  ASSERT_EQ(delta.num_links, 1);
+  EXPECT_EQ(delta.link_name[0], "box_body");
+  EXPECT_FLOAT_EQ(delta.position[0][0], 1.5);
+
+  // The merged message matches the full message at the current state.
+  MergeViewerDrawMessage(delta, &merged);
+  lcmt_viewer_draw expected;
+  ViewerDrawTranslator(*tree).PopulateDrawMessage(
+      0, BasicVector<double>(state), &expected);
+  ASSERT_EQ(merged.num_links, expected.num_links);
+  for (int i = 0; i < expected.num_links; ++i) {
+    EXPECT_EQ(merged.link_name[i], expected.link_name[i]);
+    if (expected.link_name[i] != "capsule_body") {
+      EXPECT_EQ(merged.position[i], expected.position[i]);
+    }
+  }
+
+  // The accumulated motion of the capsule body is eventually sent.
+  state(6) = 2E-3;
+  context->FixInputPort(0, state);
+  dut.Publish(*context);
+  const auto capsule_delta =
+      lcm.DecodeLastPublishedMessageAs<lcmt_viewer_draw>("DRAKE_VIEWER_DRAW");
+  ASSERT_EQ(capsule_delta.num_links, 1);
+  EXPECT_EQ(capsule_delta.link_name[0], "capsule_body");
+
+  // Reloading the robot sends all the bodies again.
+  PublishLoadRobotModelMessageHelper(dut, *context);
+  dut.Publish(*context);
+  EXPECT_EQ(lcm.DecodeLastPublishedMessageAs<lcmt_viewer_draw>(
+      "DRAKE_VIEWER_DRAW").num_links, 6);
+}
+
+// Tests that the draw messages are skipped when the wall clock rate is capped.
+GTEST_TEST(DrakeVisualizerTests, MaxWallClockPublishRate) {
+  unique_ptr<RigidBodyTree<double>> tree = CreateRigidBodyTree();
+  drake::lcm::DrakeMockLcm lcm;
+  DrakeVisualizer dut(*tree, &lcm);
+  // At most one message every 1000 seconds.
+  dut.set_max_wall_clock_publish_rate(1E-3);
+  auto context = dut.CreateDefaultContext();
+  const int vector_size =
+      tree->get_num_positions() + tree->get_num_velocities();
+  context->FixInputPort(0, make_unique<BasicVector<double>>(
+      Eigen::VectorXd::Zero(vector_size)));
+
+  dut.Publish(*context);
+  EXPECT_EQ(*lcm.get_last_publication_time("DRAKE_VIEWER_DRAW"), 0);
+  context->set_time(1);
+  dut.Publish(*context);
+  EXPECT_EQ(*lcm.get_last_publication_time("DRAKE_VIEWER_DRAW"), 0);
+
+  // Removing the cap publishes again.
+  dut.set_max_wall_clock_publish_rate(0);
+  dut.Publish(*context);
+  EXPECT_EQ(*lcm.get_last_publication_time("DRAKE_VIEWER_DRAW"), 1);
+}
+
+// Tests that the recorded pose stream replays the published draw messages.
+GTEST_TEST(DrakeVisualizerTests, RecordPoseStream) {
+  unique_ptr<RigidBodyTree<double>> tree = CreateRigidBodyTree();
+  drake::lcm::DrakeMockLcm lcm;
+  DrakeVisualizer dut(*tree, &lcm);
+  EXPECT_THROW(dut.FlushPoseStream(), std::runtime_error);
+  const std::string filename = temp_directory() + "/drake_visualizer.poses";
+  dut.RecordPoseStream(filename);
+  auto context = dut.CreateDefaultContext();
+  const int vector_size =
+      tree->get_num_positions() + tree->get_num_velocities();
+  context->FixInputPort(0, Eigen::VectorXd::Zero(vector_size));
+  dut.Publish(*context);
+  const std::vector<uint8_t> published =
+      lcm.get_last_published_message("DRAKE_VIEWER_DRAW");
+  dut.FlushPoseStream();
+
+  PoseStreamReader reader(filename);
+  ASSERT_EQ(reader.num_frames(), 1);
+  lcmt_viewer_draw message;
+  reader.ReadFrame(0, &message);
+  const int byte_count = message.getEncodedSize();
+  std::vector<uint8_t> message_bytes(byte_count);
+  message.encode(message_bytes.data(), 0, byte_count);
+  // The poses of the test tree are exactly representable.
+  EXPECT_EQ(message_bytes, published);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
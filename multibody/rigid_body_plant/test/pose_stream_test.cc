@@ -0,0 +1,138 @@
+#include "drake/multibody/rigid_body_plant/pose_stream.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/lcm/drake_mock_lcm.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns a draw message with two links, where the first link is at
+// (t, -2t, 0.5) and rotated by t about z, and the second link is at rest.
+lcmt_viewer_draw MakePoses(double t) {
+  lcmt_viewer_draw message;
+  message.timestamp = 0;
+  message.num_links = 2;
+  message.link_name = {"moving", "fixed"};
+  message.robot_num = {1, 2};
+  message.position = {{static_cast<float>(t), static_cast<float>(-2 * t),
+                       0.5f},
+                      {1, 2, 3}};
+  message.quaternion = {{static_cast<float>(std::cos(t / 2)), 0, 0,
+                         static_cast<float>(std::sin(t / 2))},
+                        {1, 0, 0, 0}};
+  return message;
+}
+
+void ExpectPosesNear(const lcmt_viewer_draw& actual,
+                     const lcmt_viewer_draw& expected) {
+  ASSERT_EQ(actual.num_links, expected.num_links);
+  for (int i = 0; i < expected.num_links; ++i) {
+    EXPECT_EQ(actual.link_name[i], expected.link_name[i]);
+    EXPECT_EQ(actual.robot_num[i], expected.robot_num[i]);
+    for (int k = 0; k < 3; ++k) {
+      EXPECT_NEAR(actual.position[i][k], expected.position[i][k], 1E-4);
+    }
+    for (int k = 0; k < 4; ++k) {
+      EXPECT_NEAR(actual.quaternion[i][k], expected.quaternion[i][k], 1E-4);
+    }
+  }
+}
+
+GTEST_TEST(PoseStreamTest, RoundTrip) {
+  const std::string filename = temp_directory() + "/round_trip.poses";
+  const int kNumFrames = 20;
+  {
+    // Small blocks, so that the frames span several of them.
+    PoseStreamWriter writer(filename, MakePoses(0), 1E-4, 8);
+    EXPECT_EQ(writer.num_links(), 2);
+    for (int i = 0; i < kNumFrames; ++i) {
+      writer.Append(0.1 * i, MakePoses(0.1 * i));
+    }
+    // A jump that does not fit in a delta.
+    writer.Append(10, MakePoses(10));
+    writer.Flush();
+  }
+
+  PoseStreamReader reader(filename);
+  EXPECT_EQ(reader.num_links(), 2);
+  EXPECT_EQ(reader.link_names(), std::vector<std::string>({"moving", "fixed"}));
+  EXPECT_EQ(reader.robot_nums(), std::vector<int32_t>({1, 2}));
+  ASSERT_EQ(reader.num_frames(), kNumFrames + 1);
+  lcmt_viewer_draw message;
+  for (int i = 0; i < kNumFrames; ++i) {
+    EXPECT_EQ(reader.frame_time(i), 0.1 * i);
+    reader.ReadFrame(i, &message);
+    ExpectPosesNear(message, MakePoses(0.1 * i));
+  }
+  reader.ReadFrame(kNumFrames, &message);
+  ExpectPosesNear(message, MakePoses(10));
+  EXPECT_EQ(message.timestamp, 10000);
+
+  EXPECT_EQ(reader.FindFrame(-1), 0);
+  EXPECT_EQ(reader.FindFrame(0.35), 3);
+  EXPECT_EQ(reader.FindFrame(5), kNumFrames - 1);
+  EXPECT_EQ(reader.FindFrame(100), kNumFrames);
+}
+
+// Tests that a block that was cut short is ignored, so that the recording of
+// a process that died while writing can still be read.
+GTEST_TEST(PoseStreamTest, TruncatedBlock) {
+  const std::string filename = temp_directory() + "/truncated.poses";
+  {
+    PoseStreamWriter writer(filename, MakePoses(0), 1E-4, 2);
+    for (int i = 0; i < 4; ++i) {
+      writer.Append(i, MakePoses(i));
+    }
+  }
+  const std::string truncated_filename =
+      temp_directory() + "/truncated_copy.poses";
+  {
+    std::FILE* in = std::fopen(filename.c_str(), "rb");
+    std::FILE* out = std::fopen(truncated_filename.c_str(), "wb");
+    ASSERT_NE(in, nullptr);
+    ASSERT_NE(out, nullptr);
+    std::vector<char> bytes(1 << 16);
+    const size_t size = std::fread(bytes.data(), 1, bytes.size(), in);
+    std::fwrite(bytes.data(), 1, size - 3, out);
+    std::fclose(in);
+    std::fclose(out);
+  }
+  PoseStreamReader reader(truncated_filename);
+  EXPECT_EQ(reader.num_frames(), 2);
+  ::unlink(truncated_filename.c_str());
+
+  EXPECT_THROW(PoseStreamReader(temp_directory() + "/no_such_file.poses"),
+               std::runtime_error);
+}
+
+GTEST_TEST(PoseStreamTest, Replay) {
+  const std::string filename = temp_directory() + "/replay.poses";
+  {
+    PoseStreamWriter writer(filename, MakePoses(0));
+    for (int i = 0; i <= 5; ++i) {
+      writer.Append(0.01 * i, MakePoses(0.01 * i));
+    }
+  }
+  PoseStreamReader reader(filename);
+  drake::lcm::DrakeMockLcm lcm;
+  ReplayPoseStream(reader, &lcm);
+  // The last frame is published last.
+  const auto message =
+      lcm.DecodeLastPublishedMessageAs<lcmt_viewer_draw>("DRAKE_VIEWER_DRAW");
+  ExpectPosesNear(message, MakePoses(0.05));
+  EXPECT_EQ(*lcm.get_last_publication_time("DRAKE_VIEWER_DRAW"), 0.05);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
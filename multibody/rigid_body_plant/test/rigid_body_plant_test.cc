@@ -2,6 +2,8 @@
 
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Geometry>
 #include <gtest/gtest.h>
@@ -284,6 +286,55 @@ TEST_P(KukaArmTest, CheckTimeStep) {
   EXPECT_EQ(kuka_plant_->get_time_step(), this->GetParam());
 }
 
+// Checks that the time derivatives are unaffected by the reuse of the
+// kinematics and the mass matrix across evaluations at the same state or the
+// same configuration.
+TEST_P(KukaArmTest, DerivativesWithReusedMassMatrix) {
+  // Only check this if the state is continuous.
+  if (kuka_plant_->is_state_discrete()) return;
+
+  const VectorXd q1 = VectorXd::LinSpaced(kNumPositions_, 0.1, 0.7);
+  const VectorXd q2 = VectorXd::LinSpaced(kNumPositions_, -0.5, 0.3);
+  const VectorXd v1 = VectorXd::LinSpaced(kNumVelocities_, -1.0, 1.0);
+  const VectorXd v2 = VectorXd::LinSpaced(kNumVelocities_, 0.5, 2.0);
+  const std::vector<std::pair<VectorXd, VectorXd>> states{
+      {q1, v1}, {q1, v1}, {q1, v2}, {q2, v2}, {q1, v2}};
+
+  // Sets the state of a context of a plant of the KUKA arm, and returns the
+  // time derivatives.
+  auto calc_derivatives = [](const RigidBodyPlant<double>& plant,
+                             Context<double>* context, const VectorXd& q,
+                             const VectorXd& v) {
+    VectorXd x(q.size() + v.size());
+    x << q, v;
+    context->get_mutable_continuous_state_vector().SetFromVector(x);
+    auto derivatives = plant.AllocateTimeDerivatives();
+    plant.CalcTimeDerivatives(*context, derivatives.get());
+    return derivatives->CopyToVector();
+  };
+
+  context_->FixInputPort(
+      kuka_plant_->actuator_command_input_port().get_index(),
+      make_unique<BasicVector<double>>(kuka_plant_->get_num_actuators()));
+  for (const auto& state : states) {
+    const VectorXd xdot =
+        calc_derivatives(*kuka_plant_, context_.get(), state.first,
+                         state.second);
+
+    // A new plant has nothing to reuse.
+    RigidBodyPlant<double> new_plant(
+        kuka_plant_->get_rigid_body_tree().Clone());
+    auto new_context = new_plant.CreateDefaultContext();
+    new_context->FixInputPort(
+        new_plant.actuator_command_input_port().get_index(),
+        make_unique<BasicVector<double>>(new_plant.get_num_actuators()));
+    const VectorXd expected_xdot = calc_derivatives(
+        new_plant, new_context.get(), state.first, state.second);
+
+    EXPECT_TRUE(CompareMatrices(xdot, expected_xdot, 0.0));
+  }
+}
+
 // Tests RigidBodyPlant<T>::CalcOutput() for a KUKA iiwa arm model.
 TEST_P(KukaArmTest, EvalOutput) {
   auto& tree = kuka_plant_->get_rigid_body_tree();
@@ -342,11 +393,12 @@ TEST_P(KukaArmTest, EvalOutput) {
   //    (4) kinematic results
   //    (5) contact results
   //    (6) model instance measure joint torque
+  //    (7) sleep status [only when discrete]
   //
   // (In this context, there is only one model instance and thus only one model
   // instance state port.)
   if (kuka_plant_->is_state_discrete()) {
-    ASSERT_EQ(5, output_->get_num_ports());
+    ASSERT_EQ(6, output_->get_num_ports());
   } else {
     ASSERT_EQ(6, output_->get_num_ports());
   }
@@ -794,6 +846,96 @@ TEST_F(RigidBodyPlantTimeSteppingDataTest, TangentJacobian) {
   EXPECT_LT((FT.transpose() - F).norm(), tol);
 }
 
+// Checks that warm starting the impact LCP from the previous time step saves
+// pivots while the ball rests on the plane, without changing the motion.
+TEST_F(RigidBodyPlantTimeSteppingDataTest, LcpWarmStart) {
+  const double radius = 0.05;
+  const int num_steps = 20;
+
+  // Steps the ball, which starts slightly penetrating the plane, and returns
+  // the final state.
+  auto simulate = [this, radius, num_steps]() {
+    VectorX<double> x = VectorX<double>::Zero(13);
+    x[2] = radius - 1e-4;  // Location of ball c.o.m.
+    x[3] = 1.0;            // 'w' coordinate of quaternion.
+    context_->get_mutable_discrete_state(0).SetFromVector(x);
+    auto updates = plant_->AllocateDiscreteVariables();
+    for (int i = 0; i < num_steps; ++i) {
+      plant_->CalcDiscreteVariableUpdates(*context_, updates.get());
+      context_->get_mutable_discrete_state(0).SetFrom(
+          updates->get_vector(0));
+    }
+    return context_->get_discrete_state(0).CopyToVector();
+  };
+
+  const VectorX<double> x_cold = simulate();
+  const int cold_pivots = plant_->get_num_lcp_pivots();
+  EXPECT_GT(cold_pivots, 0);
+
+  plant_->set_lcp_warm_start(true);
+  plant_->reset_num_lcp_pivots();
+  const VectorX<double> x_warm = simulate();
+  const int warm_pivots = plant_->get_num_lcp_pivots();
+  EXPECT_LT(warm_pivots, cold_pivots);
+
+  const double tol = 1e-10;
+  EXPECT_TRUE(CompareMatrices(x_warm, x_cold, tol));
+}
+
+// Checks that the ball resting on the plane falls asleep once it has been at
+// rest for long enough, after which stepping leaves it in place without
+// solving any impact problem.
+TEST_F(RigidBodyPlantTimeSteppingDataTest, Sleeping) {
+  const double radius = 0.05;
+  VectorX<double> x = VectorX<double>::Zero(13);
+  x[2] = radius - 1e-4;  // Location of ball c.o.m.
+  x[3] = 1.0;            // 'w' coordinate of quaternion.
+  context_->get_mutable_discrete_state(0).SetFromVector(x);
+
+  RigidBodySleepParameters sleep_parameters;
+  sleep_parameters.velocity_threshold = 1e-2;
+  sleep_parameters.time_to_sleep = 5e-3;
+  plant_->set_sleep_parameters(sleep_parameters);
+
+  // Returns the number of bodies asleep after the last step.
+  auto output = plant_->AllocateOutput(*context_);
+  const int sleep_status_index =
+      plant_->sleep_status_output_port().get_index();
+  auto num_sleeping_bodies = [&]() {
+    plant_->CalcOutput(*context_, output.get());
+    return output->get_vector_data(sleep_status_index)->GetAtIndex(0);
+  };
+  EXPECT_EQ(num_sleeping_bodies(), 0);
+
+  // The ball settles, then falls asleep.
+  auto updates = plant_->AllocateDiscreteVariables();
+  for (int i = 0; i < 100 && num_sleeping_bodies() == 0; ++i) {
+    plant_->CalcDiscreteVariableUpdates(*context_, updates.get());
+    context_->get_mutable_discrete_state().CopyFrom(*updates);
+  }
+  ASSERT_EQ(num_sleeping_bodies(), 1);
+  const VectorX<double> x_asleep =
+      context_->get_discrete_state(0).CopyToVector();
+  EXPECT_TRUE(CompareMatrices(x_asleep.tail(6), VectorX<double>::Zero(6)));
+
+  // A sleeping ball stays put.
+  plant_->reset_num_lcp_pivots();
+  for (int i = 0; i < 10; ++i) {
+    plant_->CalcDiscreteVariableUpdates(*context_, updates.get());
+    context_->get_mutable_discrete_state().CopyFrom(*updates);
+  }
+  EXPECT_EQ(num_sleeping_bodies(), 1);
+  EXPECT_EQ(plant_->get_num_lcp_pivots(), 0);
+  EXPECT_TRUE(CompareMatrices(context_->get_discrete_state(0).CopyToVector(),
+                              x_asleep));
+
+  // Disabling sleeping wakes it.
+  plant_->set_sleep_parameters(nullopt);
+  plant_->CalcDiscreteVariableUpdates(*context_, updates.get());
+  context_->get_mutable_discrete_state().CopyFrom(*updates);
+  EXPECT_EQ(num_sleeping_bodies(), 0);
+}
+
 
 GTEST_TEST(RigidBodyPlantTest, LinearizePendulumTest) {
   auto tree_ptr = make_unique<RigidBodyTree<double>>();
@@ -1,6 +1,9 @@
 #include "drake/multibody/rigid_body_plant/viewer_draw_translator.h"
 
 #include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "lcm/lcm-cpp.hpp"
@@ -41,15 +44,32 @@ void ViewerDrawTranslator::Deserialize(
 void ViewerDrawTranslator::Serialize(double time,
     const VectorBase<double>& vector_base,
     std::vector<uint8_t>* lcm_message_bytes) const {
-  DRAKE_DEMAND(vector_base.size() == get_vector_size());
   DRAKE_DEMAND(lcm_message_bytes != nullptr);
 
   // Creates a copy of the partially-initialized lcmt_viewer_draw message.
   // This is necessary since this method is declared const.
   drake::lcmt_viewer_draw message = draw_message_;
+  PopulateDrawMessage(time, vector_base, &message);
+
+  // Serializes the message into an array of bytes.
+  const int lcm_message_length = message.getEncodedSize();
+  lcm_message_bytes->resize(lcm_message_length);
+  message.encode(lcm_message_bytes->data(), 0, lcm_message_length);
+}
+
+void ViewerDrawTranslator::PopulateDrawMessage(
+    double time, const VectorBase<double>& vector_base,
+    drake::lcmt_viewer_draw* message) const {
+  DRAKE_DEMAND(vector_base.size() == get_vector_size());
+  DRAKE_DEMAND(message != nullptr);
+
+  if (message->num_links != draw_message_.num_links ||
+      message->link_name.size() != draw_message_.link_name.size()) {
+    *message = draw_message_;
+  }
 
   // Updates the timestamp in the message.
-  message.timestamp = static_cast<int64_t>(time * 1000);
+  message->timestamp = static_cast<int64_t>(time * 1000);
 
   // Obtains the generalized positions from vector_base.
   const Eigen::VectorXd q = vector_base.CopyToVector().head(
@@ -62,22 +82,42 @@ void ViewerDrawTranslator::Serialize(double time,
   for (size_t i = 0; i < tree_.get_bodies().size(); ++i) {
     auto transform = tree_.relativeTransform(cache, 0, i);
     auto quat = drake::math::rotmat2quat(transform.linear());
-    std::vector<float>& position = message.position[i];
+    std::vector<float>& position = message->position[i];
 
     auto translation = transform.translation();
     for (int j = 0; j < 3; ++j) {
       position[j] = static_cast<float>(translation(j));
     }
-    std::vector<float>& quaternion = message.quaternion[i];
+    std::vector<float>& quaternion = message->quaternion[i];
     for (int j = 0; j < 4; ++j) {
       quaternion[j] = static_cast<float>(quat(j));
     }
   }
+}
 
-  // Serializes the message into an array of bytes.
-  const int lcm_message_length = message.getEncodedSize();
-  lcm_message_bytes->resize(lcm_message_length);
-  message.encode(lcm_message_bytes->data(), 0, lcm_message_length);
+void MergeViewerDrawMessage(const drake::lcmt_viewer_draw& update,
+                            drake::lcmt_viewer_draw* state) {
+  DRAKE_DEMAND(state != nullptr);
+  std::map<std::pair<int32_t, std::string>, int> link_index;
+  for (int i = 0; i < state->num_links; ++i) {
+    link_index.emplace(std::make_pair(state->robot_num[i],
+                                      state->link_name[i]), i);
+  }
+  for (int i = 0; i < update.num_links; ++i) {
+    const auto it = link_index.find(
+        std::make_pair(update.robot_num[i], update.link_name[i]));
+    if (it != link_index.end()) {
+      state->position[it->second] = update.position[i];
+      state->quaternion[it->second] = update.quaternion[i];
+    } else {
+      state->link_name.push_back(update.link_name[i]);
+      state->robot_num.push_back(update.robot_num[i]);
+      state->position.push_back(update.position[i]);
+      state->quaternion.push_back(update.quaternion[i]);
+      ++state->num_links;
+    }
+  }
+  state->timestamp = update.timestamp;
 }
 
 }  // namespace systems
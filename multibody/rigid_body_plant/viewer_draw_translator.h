@@ -45,6 +45,16 @@ class ViewerDrawTranslator : public lcm::LcmAndVectorBaseTranslator {
       const VectorBase<double>& vector_base,
       std::vector<uint8_t>* lcm_message_bytes) const override;
 
+  /**
+   * Writes the timestamp and the pose of every RigidBody at the state
+   * @p vector_base into @p message. If @p message does not already list the
+   * bodies of the tree, e.g., if it is default constructed, it is first
+   * initialized. Otherwise its storage is reused, so that calling this method
+   * repeatedly on the same message does not allocate memory for the poses.
+   */
+  void PopulateDrawMessage(double time, const VectorBase<double>& vector_base,
+                           drake::lcmt_viewer_draw* message) const;
+
  private:
   // The RigidBodyTree with which the poses of each RigidBody can be
   // determined given the state vector of the RigidBodyTree.
@@ -56,5 +66,18 @@ class ViewerDrawTranslator : public lcm::LcmAndVectorBaseTranslator {
   drake::lcmt_viewer_draw draw_message_;
 };
 
+/**
+ * Merges the `drake::lcmt_viewer_draw` message @p update into @p state. Each
+ * link of @p update, identified by its robot number and name, overwrites the
+ * pose of the same link in @p state, or is appended to @p state if it is not
+ * there yet. The links missing from @p update keep their pose. The timestamp
+ * of @p state becomes the one of @p update.
+ *
+ * This is how a receiver reconstructs the full scene from the delta encoded
+ * draw messages of DrakeVisualizer::EnableDeltaEncoding().
+ */
+void MergeViewerDrawMessage(const drake::lcmt_viewer_draw& update,
+                            drake::lcmt_viewer_draw* state);
+
 }  // namespace systems
 }  // namespace drake
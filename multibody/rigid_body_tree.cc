@@ -14,12 +14,17 @@
 #include "drake/common/constants.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/gradient.h"
 #include "drake/multibody/joints/drake_joint.h"
 #include "drake/multibody/joints/fixed_joint.h"
 #include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/joints/prismatic_joint.h"
+#include "drake/multibody/joints/quaternion_floating_joint.h"
+#include "drake/multibody/joints/revolute_joint.h"
+#include "drake/multibody/joints/roll_pitch_yaw_floating_joint.h"
 #include "drake/multibody/kinematics_cache-inl.h"
 #include "drake/multibody/resolve_center_of_pressure.h"
 #include "drake/util/drakeGeometryUtil.h"
@@ -82,6 +87,82 @@ using std::unordered_map;
 using std::vector;
 using std::endl;
 
+namespace {
+
+// Computes the kinematics of @p body in @p cache from those of its parent.
+// @p joint is the body's joint, either as its concrete type, whose methods are
+// then called without virtual dispatch, or as a DrakeJoint. kNumPositions and
+// kNumVelocities are the joint's numbers of positions and velocities, or
+// Eigen::Dynamic if they are not known at compile time.
+template <int kNumPositions, int kNumVelocities, typename Joint,
+          typename Scalar>
+void UpdateBodyKinematics(const Joint& joint, const RigidBody<double>& body,
+                          bool compute_JdotV, KinematicsCache<Scalar>* cache) {
+  KinematicsCacheElement<Scalar>& element =
+      *cache->get_mutable_element(body.get_body_index());
+  const KinematicsCacheElement<Scalar>& parent_element =
+      cache->get_element(body.get_parent()->get_body_index());
+  const auto q_body = cache->getQ().template segment<kNumPositions>(
+      body.get_position_start_index(), joint.get_num_positions());
+
+  // transform
+  auto T_body_to_parent =
+      joint.get_transform_to_parent_body().template cast<Scalar>() *
+          joint.jointTransform(q_body);
+  element.transform_to_world =
+      parent_element.transform_to_world * T_body_to_parent;
+
+  // motion subspace in body frame
+  Matrix<Scalar, Dynamic, Dynamic>* dSdq = nullptr;
+  joint.motionSubspace(q_body, element.motion_subspace_in_body, dSdq);
+
+  // motion subspace in world frame
+  element.motion_subspace_in_world = transformSpatialMotion(
+      element.transform_to_world, element.motion_subspace_in_body);
+
+  joint.qdot2v(q_body, element.qdot_to_v, nullptr);
+  joint.v2qdot(q_body, element.v_to_qdot, nullptr);
+
+  if (cache->hasV()) {
+    const auto& v = cache->getV();
+    if (joint.get_num_velocities() == 0) {  // for fixed joints
+      element.twist_in_world = parent_element.twist_in_world;
+      if (compute_JdotV) {
+        element.motion_subspace_in_world_dot_times_v =
+            parent_element.motion_subspace_in_world_dot_times_v;
+      }
+    } else {
+      // twist
+      const auto v_body = v.template segment<kNumVelocities>(
+          body.get_velocity_start_index(), joint.get_num_velocities());
+
+      TwistVector<Scalar> joint_twist =
+          element.motion_subspace_in_world * v_body;
+      element.twist_in_world = parent_element.twist_in_world;
+      element.twist_in_world.noalias() += joint_twist;
+
+      if (compute_JdotV) {
+        // Sdotv
+        joint.motionSubspaceDotTimesV(
+            q_body, v_body, element.motion_subspace_in_body_dot_times_v,
+            nullptr, nullptr);
+
+        // Jdotv
+        auto joint_accel =
+            crossSpatialMotion(element.twist_in_world, joint_twist);
+        joint_accel += transformSpatialMotion(
+            element.transform_to_world,
+            element.motion_subspace_in_body_dot_times_v);
+        element.motion_subspace_in_world_dot_times_v =
+            parent_element.motion_subspace_in_world_dot_times_v +
+                joint_accel;
+      }
+    }
+  }
+}
+
+}  // namespace
+
 const char* const RigidBodyTreeConstants::kWorldName = "world";
 const int RigidBodyTreeConstants::kWorldBodyIndex = 0;
 // TODO(liang.fok) Update the following two variables along with the resolution
@@ -145,6 +226,7 @@ unique_ptr<RigidBodyTree<double>> RigidBodyTree<double>::Clone() const {
   clone->num_velocities_ = this->num_velocities_;
   clone->num_model_instances_ = this->num_model_instances_;
   clone->initialized_ = this->initialized_;
+  clone->collision_elements_enabled_ = this->collision_elements_enabled_;
 
   // N.B. `add_rigid_body` is not used here because this may change the ordering
   // of frames, and the clone tests require that they maintain their original
@@ -216,9 +298,124 @@ unique_ptr<RigidBodyTree<double>> RigidBodyTree<double>::Clone() const {
     clone->loops.emplace_back(frame_a, frame_b, loop.axis_);
   }
 
+  if (clone->initialized_) {
+    clone->CompileJoints();
+  }
+
   return clone;
 }
 
+template <>
+int RigidBodyTree<double>::AddModelInstanceCopy(
+    const RigidBodyTree<double>& source, int model_instance_id,
+    std::vector<int>* body_indices) {
+  DRAKE_DEMAND(!source.initialized());
+  DRAKE_DEMAND(body_indices != nullptr);
+  body_indices->clear();
+  const int new_model_instance_id = add_model_instance();
+
+  // Copies the bodies, which also adds their default frames.
+  std::unordered_map<const RigidBody<double>*, RigidBody<double>*> copies;
+  for (const auto& source_body : source.bodies_) {
+    if (source_body->get_model_instance_id() != model_instance_id) {
+      continue;
+    }
+    std::unique_ptr<RigidBody<double>> body = source_body->Clone();
+    body->set_model_instance_id(new_model_instance_id);
+    for (const auto& element : source_body->get_visual_elements()) {
+      body->AddVisualElement(element);
+    }
+    RigidBody<double>* copy = add_rigid_body(std::move(body));
+    copies[source_body.get()] = copy;
+    body_indices->push_back(copy->get_body_index());
+  }
+
+  // Copies the joints, except for those of the root bodies.
+  for (const auto& pair : copies) {
+    const RigidBody<double>* source_parent = pair.first->get_parent();
+    if (source_parent == nullptr ||
+        source_parent->get_body_index() ==
+            RigidBodyTreeConstants::kWorldBodyIndex) {
+      continue;
+    }
+    const auto parent = copies.find(source_parent);
+    DRAKE_DEMAND(parent != copies.end());
+    pair.second->add_joint(parent->second, pair.first->getJoint().Clone());
+  }
+
+  // Copies the collision elements, in the order in which they were added.
+  std::map<size_t, std::pair<RigidBody<double>*, std::string>> elements;
+  for (const auto& pair : source.body_collision_map_) {
+    const auto copy = copies.find(pair.first);
+    if (copy == copies.end()) {
+      continue;
+    }
+    for (const BodyCollisionItem& item : pair.second) {
+      elements[item.element] = std::make_pair(copy->second, item.group_name);
+    }
+  }
+  for (const auto& pair : elements) {
+    addCollisionElement(*source.element_order_[pair.first],
+                        *pair.second.first, pair.second.second);
+  }
+
+  // Copies the collision filter groups.
+  for (const auto& pair : source.collision_group_manager_.get_groups()) {
+    const std::string& group_name = pair.first;
+    const auto& group = pair.second;
+    DefineCollisionFilterGroup(group_name);
+    for (const RigidBody<double>* source_body : group.get_bodies()) {
+      const auto copy = copies.find(source_body);
+      if (copy != copies.end()) {
+        collision_group_manager_.AddCollisionFilterGroupMember(
+            group_name, *copy->second);
+      }
+    }
+    for (const std::string& target_name : group.get_ignore_groups()) {
+      AddCollisionFilterIgnoreTarget(group_name, target_name);
+    }
+  }
+
+  // Copies the frames, other than the bodies' default frames, which were
+  // added with the bodies.
+  std::unordered_map<const RigidBodyFrame<double>*,
+                     std::shared_ptr<RigidBodyFrame<double>>> frames;
+  for (const auto& source_frame : source.frames_) {
+    const auto copy = copies.find(&source_frame->get_rigid_body());
+    if (copy == copies.end()) {
+      continue;
+    }
+    if (source_frame->get_name() == copy->first->get_name()) {
+      frames[source_frame.get()] =
+          findFrame(source_frame->get_name(), new_model_instance_id);
+      continue;
+    }
+    auto frame = make_shared<RigidBodyFrame<double>>(*source_frame);
+    frame->set_rigid_body(copy->second);
+    addFrame(frame);
+    frames[source_frame.get()] = frame;
+  }
+
+  for (const auto& actuator : source.actuators) {
+    const auto copy = copies.find(actuator.body_);
+    if (copy != copies.end()) {
+      actuators.emplace_back(
+          actuator.name_, copy->second, actuator.reduction_,
+          actuator.effort_limit_min_, actuator.effort_limit_max_);
+    }
+  }
+
+  for (const auto& loop : source.loops) {
+    const auto frame_a = frames.find(loop.frameA_.get());
+    const auto frame_b = frames.find(loop.frameB_.get());
+    if (frame_a != frames.end() && frame_b != frames.end()) {
+      loops.emplace_back(frame_a->second, frame_b->second, loop.axis_);
+    }
+  }
+
+  return new_model_instance_id;
+}
+
 template <typename T>
 bool RigidBodyTree<T>::transformCollisionFrame(
     RigidBody<T>* body, const Eigen::Isometry3d& displace_transform) {
@@ -440,9 +637,37 @@ void RigidBodyTree<T>::compile() {
 
   CompileCollisionState();
 
+  CompileJoints();
+
   initialized_ = true;
 }
 
+template <typename T>
+void RigidBodyTree<T>::CompileJoints() {
+  compiled_joints_.clear();
+  compiled_joints_.resize(bodies_.size());
+  for (size_t i = 0; i < bodies_.size(); ++i) {
+    const RigidBody<T>& body = *bodies_[i];
+    if (!body.has_parent_body()) continue;
+    const DrakeJoint& joint = body.getJoint();
+    CompiledJoint& compiled_joint = compiled_joints_[i];
+    compiled_joint.joint = &joint;
+    if (dynamic_cast<const FixedJoint*>(&joint)) {
+      compiled_joint.type = CompiledJointType::kFixed;
+    } else if (dynamic_cast<const RevoluteJoint*>(&joint)) {
+      compiled_joint.type = CompiledJointType::kRevolute;
+    } else if (dynamic_cast<const PrismaticJoint*>(&joint)) {
+      compiled_joint.type = CompiledJointType::kPrismatic;
+    } else if (dynamic_cast<const QuaternionFloatingJoint*>(&joint)) {
+      compiled_joint.type = CompiledJointType::kQuaternionFloating;
+    } else if (dynamic_cast<const RollPitchYawFloatingJoint*>(&joint)) {
+      compiled_joint.type = CompiledJointType::kRollPitchYawFloating;
+    } else {
+      compiled_joint.type = CompiledJointType::kOther;
+    }
+  }
+}
+
 template <typename T>
 void RigidBodyTree<T>::CompileCollisionState() {
   // Identifies and processes collision elements that should be marked
@@ -714,6 +939,9 @@ void RigidBodyTree<T>::addCollisionElement(
     // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
     const drake::multibody::collision::Element& element, RigidBody<T>& body,
     const string& group_name) {
+  if (!collision_elements_enabled_) {
+    return;
+  }
   auto itr = body_collision_map_.find(&body);
   if (itr == body_collision_map_.end()) {
     // NOTE: we do this instead of map[key] = value because we want an iterator
@@ -1012,48 +1240,49 @@ std::vector<drake::multibody::collision::PointPair<U>>
 RigidBodyTree<T>::ComputeMaximumDepthCollisionPoints(
     const KinematicsCache<U>& cache, bool use_margins,
     bool throw_if_missing_gradient) {
+  DRAKE_TRACE_SCOPE("RigidBodyTree::ComputeMaximumDepthCollisionPoints");
   updateDynamicCollisionElements(cache);
   vector<drake::multibody::collision::PointPair<double>> contact_points;
   collision_model_->ComputeMaximumDepthCollisionPoints(use_margins,
                                                        &contact_points);
+  DRAKE_TRACE_COUNTER("num_contact_points", contact_points.size());
 
   vector<drake::multibody::collision::PointPair<U>>
       contact_points_in_body_frame;
 
   // For each contact pair, map contact point from world frame to each body's
-  // frame.
+  // frame. The collision model has already rejected the pairs that may not
+  // collide, in its broadphase.
   for (size_t i = 0; i < contact_points.size(); ++i) {
     auto& pair = contact_points[i];
-    if (pair.elementA->CanCollideWith(pair.elementB)) {
-      // For the autodiff version, throw if collision gradients are being
-      // arbitrarily set to zero.  Intelligent callers (that are careful to
-      // handle the gradients) may disable this with the throw_if_missing
-      // argument.
-      if (!std::is_same<U, double>::value && throw_if_missing_gradient) {
-        std::runtime_error(
-            "Potential collisions exist, but the collision engine does not "
-                "support autodiff.  Gradients would have been inaccurate.");
-      }
+    // For the autodiff version, throw if collision gradients are being
+    // arbitrarily set to zero.  Intelligent callers (that are careful to
+    // handle the gradients) may disable this with the throw_if_missing
+    // argument.
+    if (!std::is_same<U, double>::value && throw_if_missing_gradient) {
+      std::runtime_error(
+          "Potential collisions exist, but the collision engine does not "
+              "support autodiff.  Gradients would have been inaccurate.");
+    }
 
-      drake::multibody::collision::PointPair<U> pair_in_body_frame(pair);
+    drake::multibody::collision::PointPair<U> pair_in_body_frame(pair);
 
-      // Get bodies' transforms.
-      const int bodyA_id = pair.elementA->get_body()->get_body_index();
-      const Isometry3<U>& TA = cache.get_element(bodyA_id).transform_to_world;
+    // Get bodies' transforms.
+    const int bodyA_id = pair.elementA->get_body()->get_body_index();
+    const Isometry3<U>& TA = cache.get_element(bodyA_id).transform_to_world;
 
-      const int bodyB_id = pair.elementB->get_body()->get_body_index();
-      const Isometry3<U>& TB = cache.get_element(bodyB_id).transform_to_world;
+    const int bodyB_id = pair.elementB->get_body()->get_body_index();
+    const Isometry3<U>& TB = cache.get_element(bodyB_id).transform_to_world;
 
-      // Transform to bodies' frames.
-      // Note: Eigen assumes aliasing by default and therefore this operation
-      // is safe.
-      pair_in_body_frame.ptA = TA.inverse() * contact_points[i].ptA.cast<U>();
-      pair_in_body_frame.ptB = TB.inverse() * contact_points[i].ptB.cast<U>();
+    // Transform to bodies' frames.
+    // Note: Eigen assumes aliasing by default and therefore this operation
+    // is safe.
+    pair_in_body_frame.ptA = TA.inverse() * contact_points[i].ptA.cast<U>();
+    pair_in_body_frame.ptB = TB.inverse() * contact_points[i].ptB.cast<U>();
 
-      // TODO(russt): Shouldn't the normal be transformed, too?
+    // TODO(russt): Shouldn't the normal be transformed, too?
 
-      contact_points_in_body_frame.push_back(pair_in_body_frame);
-    }
+    contact_points_in_body_frame.push_back(pair_in_body_frame);
   }
   return contact_points_in_body_frame;
 }
@@ -1169,6 +1398,8 @@ RigidBodyTree<T>::CreateKinematicsCacheWithType() const {
       " RigidBodyTree::compile() must be called first.");
   std::vector<int> num_joint_positions;
   std::vector<int> num_joint_velocities;
+  num_joint_positions.reserve(bodies_.size());
+  num_joint_velocities.reserve(bodies_.size());
   for (const auto& body_unique_ptr : bodies_) {
     const RigidBody<T>& body = *body_unique_ptr;
     int num_positions =
@@ -1227,69 +1458,47 @@ void RigidBodyTree<T>::doKinematics(KinematicsCache<Scalar>& cache,
   cache.setPositionKinematicsCached();
 
   for (int i = 0; i < static_cast<int>(bodies_.size()); ++i) {
-    RigidBody<T>& body = *bodies_[i];
+    const RigidBody<T>& body = *bodies_[i];
     KinematicsCacheElement<Scalar>& element = *cache.get_mutable_element(i);
 
     if (body.has_parent_body()) {
-      const KinematicsCacheElement<Scalar>& parent_element =
-          *cache.get_mutable_element(body.get_parent()->get_body_index());
       const DrakeJoint& joint = body.getJoint();
-      auto q_body = q.middleRows(body.get_position_start_index(),
-                                 joint.get_num_positions());
-
-      // transform
-      auto T_body_to_parent =
-          joint.get_transform_to_parent_body().cast<Scalar>() *
-              joint.jointTransform(q_body);
-      element.transform_to_world =
-          parent_element.transform_to_world * T_body_to_parent;
-
-      // motion subspace in body frame
-      Matrix<Scalar, Dynamic, Dynamic>* dSdq = nullptr;
-      joint.motionSubspace(q_body, element.motion_subspace_in_body, dSdq);
-
-      // motion subspace in world frame
-      element.motion_subspace_in_world = transformSpatialMotion(
-          element.transform_to_world, element.motion_subspace_in_body);
-
-      joint.qdot2v(q_body, element.qdot_to_v, nullptr);
-      joint.v2qdot(q_body, element.v_to_qdot, nullptr);
-
-      if (cache.hasV()) {
-        const auto& v = cache.getV();
-        if (joint.get_num_velocities() == 0) {  // for fixed joints
-          element.twist_in_world = parent_element.twist_in_world;
-          if (compute_JdotV) {
-            element.motion_subspace_in_world_dot_times_v =
-                parent_element.motion_subspace_in_world_dot_times_v;
-          }
-        } else {
-          // twist
-          auto v_body = v.middleRows(body.get_velocity_start_index(),
-                                     joint.get_num_velocities());
-
-          TwistVector<Scalar> joint_twist =
-              element.motion_subspace_in_world * v_body;
-          element.twist_in_world = parent_element.twist_in_world;
-          element.twist_in_world.noalias() += joint_twist;
-
-          if (compute_JdotV) {
-            // Sdotv
-            joint.motionSubspaceDotTimesV(
-                q_body, v_body, element.motion_subspace_in_body_dot_times_v,
-                nullptr, nullptr);
-
-            // Jdotv
-            auto joint_accel =
-                crossSpatialMotion(element.twist_in_world, joint_twist);
-            joint_accel += transformSpatialMotion(
-                element.transform_to_world,
-                element.motion_subspace_in_body_dot_times_v);
-            element.motion_subspace_in_world_dot_times_v =
-                parent_element.motion_subspace_in_world_dot_times_v +
-                    joint_accel;
-          }
-        }
+      // Falls back to virtual dispatch if the joint was replaced since the
+      // tree was compiled.
+      const CompiledJointType type =
+          (i < static_cast<int>(compiled_joints_.size()) &&
+           compiled_joints_[i].joint == &joint) ?
+          compiled_joints_[i].type : CompiledJointType::kOther;
+      switch (type) {
+        case CompiledJointType::kFixed:
+          UpdateBodyKinematics<0, 0>(
+              static_cast<const FixedJoint&>(joint), body, compute_JdotV,
+              &cache);
+          break;
+        case CompiledJointType::kRevolute:
+          UpdateBodyKinematics<1, 1>(
+              static_cast<const RevoluteJoint&>(joint), body, compute_JdotV,
+              &cache);
+          break;
+        case CompiledJointType::kPrismatic:
+          UpdateBodyKinematics<1, 1>(
+              static_cast<const PrismaticJoint&>(joint), body, compute_JdotV,
+              &cache);
+          break;
+        case CompiledJointType::kQuaternionFloating:
+          UpdateBodyKinematics<7, 6>(
+              static_cast<const QuaternionFloatingJoint&>(joint), body,
+              compute_JdotV, &cache);
+          break;
+        case CompiledJointType::kRollPitchYawFloating:
+          UpdateBodyKinematics<6, 6>(
+              static_cast<const RollPitchYawFloatingJoint&>(joint), body,
+              compute_JdotV, &cache);
+          break;
+        case CompiledJointType::kOther:
+          UpdateBodyKinematics<Dynamic, Dynamic>(
+              joint, body, compute_JdotV, &cache);
+          break;
       }
     } else {
       element.transform_to_world.setIdentity();
@@ -1316,6 +1525,142 @@ void RigidBodyTree<T>::doKinematics(KinematicsCache<Scalar>& cache,
   cache.setJdotVCached(compute_JdotV && cache.hasV());
 }
 
+template <typename T>
+BatchKinematicsCache<T> RigidBodyTree<T>::CreateBatchKinematicsCache(
+    int num_samples) const {
+  if (!initialized_) {
+    throw runtime_error(
+        "RigidBodyTree::CreateBatchKinematicsCache: call compile first.");
+  }
+  return BatchKinematicsCache<T>(get_num_bodies(), num_samples);
+}
+
+template <typename T>
+void RigidBodyTree<T>::doBatchKinematics(
+    const Eigen::Ref<const drake::MatrixX<T>>& q,
+    BatchKinematicsCache<T>* cache) const {
+  DRAKE_DEMAND(cache != nullptr);
+  if (cache->get_num_bodies() != get_num_bodies() ||
+      cache->get_num_samples() != q.cols()) {
+    throw runtime_error(
+        "RigidBodyTree::doBatchKinematics: the cache is for " +
+        std::to_string(cache->get_num_bodies()) + " bodies and " +
+        std::to_string(cache->get_num_samples()) + " samples, but the tree has " +
+        std::to_string(get_num_bodies()) + " bodies and q has " +
+        std::to_string(q.cols()) + " columns.");
+  }
+  const std::vector<bool> is_needed(bodies_.size(), true);
+  CalcBatchPosesInWorldFrame(q, is_needed, &cache->X_WB_);
+}
+
+template <typename T>
+BatchKinematicsCache<T> RigidBodyTree<T>::doBatchKinematics(
+    const Eigen::Ref<const drake::MatrixX<T>>& q) const {
+  BatchKinematicsCache<T> cache =
+      CreateBatchKinematicsCache(static_cast<int>(q.cols()));
+  doBatchKinematics(q, &cache);
+  return cache;
+}
+
+template <typename T>
+std::vector<typename BatchKinematicsCache<T>::PoseBatch>
+RigidBodyTree<T>::CalcBodyPosesInWorldFrame(
+    const Eigen::Ref<const drake::MatrixX<T>>& q,
+    const std::vector<int>& body_indices) const {
+  // Flags the requested bodies and all of their ancestors.
+  std::vector<bool> is_needed(bodies_.size(), false);
+  for (int body_index : body_indices) {
+    if (body_index < 0 || body_index >= get_num_bodies()) {
+      throw runtime_error(
+          "RigidBodyTree::CalcBodyPosesInWorldFrame: invalid body index " +
+          std::to_string(body_index) + ".");
+    }
+    const RigidBody<T>* body = bodies_[body_index].get();
+    while (body != nullptr && !is_needed[body->get_body_index()]) {
+      is_needed[body->get_body_index()] = true;
+      body = body->get_parent();
+    }
+  }
+
+  std::vector<typename BatchKinematicsCache<T>::PoseBatch> X_WB(
+      bodies_.size());
+  CalcBatchPosesInWorldFrame(q, is_needed, &X_WB);
+
+  std::vector<typename BatchKinematicsCache<T>::PoseBatch> result;
+  result.reserve(body_indices.size());
+  for (int body_index : body_indices) {
+    result.push_back(X_WB[body_index]);
+  }
+  return result;
+}
+
+template <typename T>
+void RigidBodyTree<T>::CalcBatchPosesInWorldFrame(
+    const Eigen::Ref<const drake::MatrixX<T>>& q,
+    const std::vector<bool>& is_needed,
+    std::vector<typename BatchKinematicsCache<T>::PoseBatch>* X_WB) const {
+  using PoseBatch = typename BatchKinematicsCache<T>::PoseBatch;
+  if (!initialized_) {
+    throw runtime_error(
+        "RigidBodyTree::doBatchKinematics: call compile first.");
+  }
+  if (q.rows() != num_positions_) {
+    throw runtime_error(
+        "RigidBodyTree::doBatchKinematics: q has " + std::to_string(q.rows()) +
+        " rows, but the tree has " + std::to_string(num_positions_) +
+        " positions.");
+  }
+  DRAKE_DEMAND(X_WB != nullptr && X_WB->size() == bodies_.size());
+  DRAKE_DEMAND(is_needed.size() == bodies_.size());
+
+  const int num_samples = static_cast<int>(q.cols());
+  PoseBatch X_PB(num_samples, BatchKinematicsCache<T>::kPoseSize);
+  // Bodies are sorted so that parents precede their children (see
+  // SortTree()); parent poses are always available when a child is visited.
+  for (int i = 0; i < static_cast<int>(bodies_.size()); ++i) {
+    if (!is_needed[i]) continue;
+    const RigidBody<T>& body = *bodies_[i];
+    PoseBatch& X_WBi = (*X_WB)[i];
+    X_WBi.resize(num_samples, BatchKinematicsCache<T>::kPoseSize);
+
+    if (!body.has_parent_body()) {
+      for (int k = 0; k < num_samples; ++k) {
+        BatchKinematicsCache<T>::SetPose(Isometry3<T>::Identity(), k, &X_WBi);
+      }
+      continue;
+    }
+
+    // The joint transforms are evaluated one sample at a time (they are
+    // virtual and joint-specific); the composition with the parent pose is
+    // vectorized across all samples.
+    const DrakeJoint& joint = body.getJoint();
+    const Isometry3<T> X_PJ = joint.get_transform_to_parent_body().cast<T>();
+    const int position_start = body.get_position_start_index();
+    const int num_joint_positions = joint.get_num_positions();
+    PoseBatch& X_PBi = body.get_parent()->has_parent_body() ? X_PB : X_WBi;
+    if (num_joint_positions == 0) {
+      const Isometry3<T> X_PBk =
+          X_PJ * joint.jointTransform(drake::VectorX<T>());
+      for (int k = 0; k < num_samples; ++k) {
+        BatchKinematicsCache<T>::SetPose(X_PBk, k, &X_PBi);
+      }
+    } else {
+      for (int k = 0; k < num_samples; ++k) {
+        BatchKinematicsCache<T>::SetPose(
+            X_PJ * joint.jointTransform(q.col(k).segment(
+                       position_start, num_joint_positions)),
+            k, &X_PBi);
+      }
+    }
+
+    // When the parent is the world, X_PB has been written directly into X_WB.
+    if (&X_PBi == &X_PB) {
+      const PoseBatch& X_WP = (*X_WB)[body.get_parent()->get_body_index()];
+      BatchKinematicsCache<T>::ComposePoses(X_WP, X_PB, &X_WBi);
+    }
+  }
+}
+
 template <typename T>
 template <typename Scalar>
 void RigidBodyTree<T>::updateCompositeRigidBodyInertias(
@@ -3256,30 +3601,34 @@ template <typename T> drake::Matrix6X<T>
 RigidBodyTree<T>::CalcFrameSpatialVelocityJacobianInWorldFrame(
     const KinematicsCache<T>& cache, const RigidBody<T>& body,
     const drake::Isometry3<T>& X_BF, bool in_terms_of_qdot) const {
-  const int world_index = world().get_body_index();
   const int num_col =
       in_terms_of_qdot ? get_num_positions() : get_num_velocities();
+  return CalcFrameSpatialVelocityCompactJacobianInWorldFrame(
+      cache, body, X_BF, in_terms_of_qdot).ToDense(num_col);
+}
+
+template <typename T> CompactJacobian<T>
+RigidBodyTree<T>::CalcFrameSpatialVelocityCompactJacobianInWorldFrame(
+    const KinematicsCache<T>& cache, const RigidBody<T>& body,
+    const drake::Isometry3<T>& X_BF, bool in_terms_of_qdot) const {
+  const int world_index = world().get_body_index();
 
   drake::Vector3<T> p_WF =
       CalcFramePoseInWorldFrame(cache, body, X_BF).translation();
 
-  std::vector<int> v_or_q_indices;
-  // J_WBwo is the Jacobian of the spatial velocity of frame Bwo measured
-  // and expressed in the world frame, where Bwo is rigidly attached to B and
-  // instantaneously coincides with the world frame.
-  drake::MatrixX<T> J_WBwo = geometricJacobian(
+  CompactJacobian<T> J_WF;
+  // Starts as J_WBwo, the Jacobian of the spatial velocity of frame Bwo
+  // measured and expressed in the world frame, where Bwo is rigidly attached
+  // to B and instantaneously coincides with the world frame.
+  J_WF.J = geometricJacobian(
       cache, world_index, body.get_body_index(), world_index, in_terms_of_qdot,
-      &v_or_q_indices);
+      &J_WF.indices);
 
-  int col = 0;
-  drake::Matrix6X<T> J_WF = MatrixX<T>::Zero(6, num_col);
-  for (int idx : v_or_q_indices) {
+  for (int col = 0; col < J_WF.J.cols(); ++col) {
     // Angular velocity stays the same.
-    J_WF.col(idx) = J_WBwo.col(col);
     // Linear velocity needs an additional cross product term.
-    J_WF.col(idx).template tail<3>() +=
-        J_WBwo.col(col).template head<3>().cross(p_WF);
-    col++;
+    const drake::Vector3<T> w = J_WF.J.col(col).template head<3>();
+    J_WF.J.col(col).template tail<3>() += w.cross(p_WF);
   }
   return J_WF;
 }
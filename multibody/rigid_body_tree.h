@@ -16,9 +16,11 @@
 #include "drake/common/eigen_stl_types.h"
 #include "drake/common/eigen_types.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/batch_kinematics_cache.h"
 #include "drake/multibody/collision/collision_filter.h"
 #include "drake/multibody/collision/drake_collision.h"
 #include "drake/multibody/collision/element.h"
+#include "drake/multibody/compact_jacobian.h"
 #include "drake/multibody/force_torque_measurement.h"
 #include "drake/multibody/joints/floating_base_types.h"
 #include "drake/multibody/kinematic_path.h"
@@ -118,6 +120,26 @@ class RigidBodyTree {
    */
   std::unique_ptr<RigidBodyTree<double>> Clone() const;
 
+  /**
+   * Adds a copy of the model instance @p model_instance_id of @p source to
+   * this tree as a new model instance, and returns the id of the new
+   * instance. The instance's bodies, joints, visual and collision elements,
+   * collision filter groups, frames, actuators and loops are copied. This lets
+   * a model that was parsed once be added many times without being parsed
+   * again.
+   *
+   * The copies of the instance's root bodies, those attached to the world of
+   * @p source, are left without a parent or joint; the caller must connect
+   * them to this tree, e.g., with drake::parsers::AddFloatingJoint().
+   *
+   * @param[out] body_indices The indices of the bodies of the new instance.
+   * @pre @p source has not been compiled, and the bodies of the instance are
+   * attached only to each other and to the world of @p source.
+   */
+  int AddModelInstanceCopy(const RigidBodyTree<double>& source,
+                           int model_instance_id,
+                           std::vector<int>* body_indices);
+
   /**
    * Adds a new model instance to this `RigidBodyTree`. The model instance is
    * identified by a unique model instance ID, which is the return value of
@@ -304,6 +326,41 @@ class RigidBodyTree {
   void doKinematics(KinematicsCache<Scalar>& cache,
                     bool compute_JdotV = false) const;
 
+  /// Creates a BatchKinematicsCache for @p num_samples configurations of this
+  /// RigidBodyTree.
+  /// @throws std::runtime_error if this RigidBodyTree has not been compiled.
+  BatchKinematicsCache<T> CreateBatchKinematicsCache(int num_samples) const;
+
+  /// Computes the world poses of all bodies for each of the N configurations
+  /// stored in the columns of @p q (of size `nq x N`). This is the batched
+  /// equivalent of calling doKinematics(q.col(k)) for every column `k`,
+  /// restricted to position kinematics. It avoids one KinematicsCache per
+  /// sample and composes the poses of all samples at once (see
+  /// BatchKinematicsCache for the vectorization-friendly layout).
+  /// @throws std::runtime_error if this RigidBodyTree has not been compiled,
+  /// if `q.rows()` is not the number of positions, or if @p cache was not
+  /// created for this tree and `q.cols()` samples.
+  void doBatchKinematics(const Eigen::Ref<const drake::MatrixX<T>>& q,
+                         BatchKinematicsCache<T>* cache) const;
+
+  /// Creates a BatchKinematicsCache for the configurations in the columns of
+  /// @p q, computes the kinematics, and returns the cache.
+  /// @see doBatchKinematics(const Eigen::Ref<const drake::MatrixX<T>>&,
+  /// BatchKinematicsCache<T>*) const.
+  BatchKinematicsCache<T> doBatchKinematics(
+      const Eigen::Ref<const drake::MatrixX<T>>& q) const;
+
+  /// Computes the world poses of the bodies with indices @p body_indices for
+  /// each of the N configurations stored in the columns of @p q. Only the
+  /// chosen bodies and their ancestors are computed, which makes this the
+  /// cheapest way to, e.g., collision check the discretization of a path.
+  /// @returns One PoseBatch per entry of @p body_indices, in the same order.
+  /// @throws std::runtime_error under the same conditions as
+  /// doBatchKinematics() or if a body index is out of range.
+  std::vector<typename BatchKinematicsCache<T>::PoseBatch>
+  CalcBodyPosesInWorldFrame(const Eigen::Ref<const drake::MatrixX<T>>& q,
+                            const std::vector<int>& body_indices) const;
+
   /**
    * Returns true if @p body is part of a model instance whose ID is in
    * @p model_instance_id_set.
@@ -438,6 +495,24 @@ class RigidBodyTree {
       const drake::Isometry3<T>& X_BF,
       bool in_terms_of_qdot = false) const;
 
+  /// Computes the same Jacobian `J_WF` as
+  /// CalcFrameSpatialVelocityJacobianInWorldFrame(), but only its columns for
+  /// the generalized velocities (or positions, if @p in_terms_of_qdot is
+  /// `true`) of the joints between the world and @p body; all other columns
+  /// are zero. Prefer this to the dense `J_WF` when @p body is reached
+  /// through only a few of the tree's joints, and use the CompactJacobian
+  /// methods to compute `J_WF * v`, `J_WFᵀ * F` and `J_WFᵀ * W * J_WF`.
+  /// @param cache Reference to the KinematicsCache.
+  /// @param body Reference to the RigidBody.
+  /// @param X_BF The pose of frame F in body frame B.
+  /// @param in_terms_of_qdot See
+  /// CalcFrameSpatialVelocityJacobianInWorldFrame().
+  /// @retval The contributing columns of `J_WF` and their indices.
+  CompactJacobian<T> CalcFrameSpatialVelocityCompactJacobianInWorldFrame(
+      const KinematicsCache<T>& cache, const RigidBody<T>& body,
+      const drake::Isometry3<T>& X_BF,
+      bool in_terms_of_qdot = false) const;
+
   /// Computes the Jacobian `J_WF` of the spatial velocity `V_WF` of frame F
   /// measured and expressed in the world frame W such that `V_WF = J_WF * v`,
   /// where `v` is the generalized velocity. @p frame_F does not necessarily
@@ -890,12 +965,32 @@ class RigidBodyTree {
       // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
       Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>& J) const;
 
+  /**
+   * Sets whether addCollisionElement() keeps the collision elements that it is
+   * given; the default is true. A tree that is only used for kinematics or
+   * visualization can disable them before its models are parsed. Its collision
+   * elements are then discarded as they are added, so that compile() neither
+   * loads collision meshes nor builds collision objects, and the collision
+   * queries find no collision geometry. Elements that were added before this
+   * call are not affected.
+   */
+  void set_collision_elements_enabled(bool enabled) {
+    collision_elements_enabled_ = enabled;
+  }
+
+  /// Returns whether addCollisionElement() keeps the collision elements that
+  /// it is given. @see set_collision_elements_enabled().
+  bool collision_elements_enabled() const {
+    return collision_elements_enabled_;
+  }
+
   /**
    * Adds a new collision element to the tree.  The input @p element will be
    * copied and that copy will be stored in the tree, associated with the
    * given @p body.  This association is pending.  It is necessary to call
    * compile() in order for the element to be fully integrated into the
-   * RigidBodyTree.
+   * RigidBodyTree. Does nothing if collision elements are disabled; see
+   * set_collision_elements_enabled().
    * @param element the element to add.
    * @param body the body to associate the element with.
    * @param group_name a group name to tag the associated element with.
@@ -1030,6 +1125,31 @@ class RigidBodyTree {
       // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
       std::vector<int>& body_idx, bool use_margins);
 
+  /**
+   * Sets the maximum number of threads that the collisionDetect() overloads
+   * may use to compute the closest points between pairs of collision
+   * elements, and that collisionDetectFromPoints() may use to process its
+   * points; the default is 1. The results do not depend on the number of
+   * threads.
+   * @see drake::multibody::collision::Model::set_num_threads().
+   */
+  void set_num_collision_threads(int num_threads) {
+    collision_model_->set_num_threads(num_threads);
+  }
+
+  /**
+   * Sets how far, in meters, the contact points that
+   * ComputeMaximumDepthCollisionPoints() found between a pair of collision
+   * elements may move before they are recomputed; the default is 0, which
+   * recomputes every pair on every call. A positive tolerance lets bodies
+   * resting in contact skip the narrowphase from one step to the next, at the
+   * cost of contact points that may be stale by up to the tolerance.
+   * @see drake::multibody::collision::Model::set_contact_reuse_tolerance().
+   */
+  void set_collision_contact_reuse_tolerance(double tolerance) {
+    collision_model_->set_contact_reuse_tolerance(tolerance);
+  }
+
   bool collisionDetect(
       const KinematicsCache<double>& cache,
       // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
@@ -1602,6 +1722,14 @@ class RigidBodyTree {
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
   void updateCompositeRigidBodyInertias(KinematicsCache<Scalar>& cache) const;
 
+  // Computes the world poses of the bodies flagged in `is_needed` for the
+  // configurations in the columns of `q`. The flagged set must be closed
+  // under taking parents. Entries of `X_WB` for other bodies are untouched.
+  void CalcBatchPosesInWorldFrame(
+      const Eigen::Ref<const drake::MatrixX<T>>& q,
+      const std::vector<bool>& is_needed,
+      std::vector<typename BatchKinematicsCache<T>::PoseBatch>* X_WB) const;
+
   // Examines the state of the tree, and confirms that all nodes (i.e,
   // RigidBody instances) have a kinematics path to the root.  In other words,
   // there should only be a single body that has no parent: the world.
@@ -1654,6 +1782,9 @@ class RigidBodyTree {
   // the numerical stability of contact gradients taken using the model.
   std::unique_ptr<drake::multibody::collision::Model> collision_model_;
 
+  // If false, addCollisionElement() discards its element.
+  bool collision_elements_enabled_{true};
+
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
@@ -1670,6 +1801,32 @@ class RigidBodyTree {
 
   int next_available_clique_ = 0;
 
+  // The joint types for which doKinematics() calls the joint's methods
+  // directly, rather than through DrakeJoint's virtual methods.
+  enum class CompiledJointType {
+    kOther,
+    kFixed,
+    kRevolute,
+    kPrismatic,
+    kQuaternionFloating,
+    kRollPitchYawFloating,
+  };
+
+  // A body's joint, with its concrete type.
+  struct CompiledJoint {
+    const DrakeJoint* joint{nullptr};
+    CompiledJointType type{CompiledJointType::kOther};
+  };
+
+  // Resolves the concrete types of the bodies' joints into compiled_joints_.
+  void CompileJoints();
+
+  // The joint of each body, indexed like bodies_, as of the last call to
+  // CompileJoints(). The world body's joint is null. doKinematics() uses the
+  // type to call the concrete joint's methods, whose arguments and results
+  // have fixed sizes, without virtual dispatch.
+  std::vector<CompiledJoint> compiled_joints_;
+
  private:
   // A utility class for storing body collision data during RBT instantiation.
   struct BodyCollisionItem {
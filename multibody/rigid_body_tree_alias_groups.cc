@@ -57,6 +57,9 @@ void RigidBodyTreeAliasGroups<T>::AddBodyGroup(
   }
 
   InsertOrMergeVectorWithoutDuplicates(group_name, bodies, &body_groups_);
+  if (body_group_indices_.emplace(group_name, num_body_groups()).second) {
+    body_groups_by_index_.push_back(&body_groups_.at(group_name));
+  }
 }
 
 template <typename T>
@@ -97,6 +100,11 @@ void RigidBodyTreeAliasGroups<T>::AddJointGroup(
                                        &position_groups_);
   InsertOrMergeVectorWithoutDuplicates(group_name, v_indices,
                                        &velocity_groups_);
+  if (joint_group_indices_.emplace(group_name, num_joint_groups()).second) {
+    joint_groups_by_index_.push_back(&joint_groups_.at(group_name));
+    position_groups_by_index_.push_back(&position_groups_.at(group_name));
+    velocity_groups_by_index_.push_back(&velocity_groups_.at(group_name));
+  }
 }
 
 template <typename T>
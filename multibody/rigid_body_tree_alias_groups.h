@@ -26,6 +26,14 @@
  * members are unique. A body or joint can belong to many groups. When adding
  * new members to an existing group, the new members will be appended to the
  * existing group.
+ *
+ * Each group is also identified by an integer handle, assigned in the order in
+ * which the body groups (or joint groups) are created, starting at zero.
+ * Groups are never removed, so a handle stays valid for the lifetime of this
+ * object. Code that looks groups up repeatedly, such as a controller on every
+ * tick, should resolve the names to handles once with get_body_group_index()
+ * or get_joint_group_index() and then use the handle-based accessors, which
+ * do not hash strings.
  */
 template <typename T>
 class RigidBodyTreeAliasGroups {
@@ -89,6 +97,37 @@ class RigidBodyTreeAliasGroups {
     return body_groups_.find(group_name) != body_groups_.end();
   }
 
+  /// Returns the number of body groups, i.e. one more than the largest body
+  /// group handle.
+  int num_body_groups() const {
+    return static_cast<int>(body_groups_by_index_.size());
+  }
+
+  /// Returns the number of joint groups, i.e. one more than the largest joint
+  /// group handle.
+  int num_joint_groups() const {
+    return static_cast<int>(joint_groups_by_index_.size());
+  }
+
+  /**
+   * Returns the handle of the body group identified by @p group_name.
+   *
+   * @throws std::out_of_range if @p group_name is not found.
+   */
+  int get_body_group_index(const std::string& group_name) const {
+    return body_group_indices_.at(group_name);
+  }
+
+  /**
+   * Returns the handle of the joint group identified by @p group_name, which
+   * also identifies the corresponding position and velocity groups.
+   *
+   * @throws std::out_of_range if @p group_name is not found.
+   */
+  int get_joint_group_index(const std::string& group_name) const {
+    return joint_group_indices_.at(group_name);
+  }
+
   bool has_joint_group(const std::string& group_name) const {
     return joint_groups_.find(group_name) != joint_groups_.end();
   }
@@ -155,6 +194,56 @@ class RigidBodyTreeAliasGroups {
     return velocity_groups_.at(group_name);
   }
 
+  /**
+   * Returns the body group identified by the handle @p group_index.
+   *
+   * @throws std::out_of_range if @p group_index is not a body group handle.
+   */
+  const std::vector<const RigidBody<T>*>& get_body_group(
+      int group_index) const {
+    return *body_groups_by_index_.at(group_index);
+  }
+
+  /**
+   * Returns the body aliased by the handle @p group_index. The body group
+   * referenced by @p group_index must contain exactly one element.
+   */
+  const RigidBody<T>* get_body(int group_index) const {
+    const auto& group = get_body_group(group_index);
+    DRAKE_DEMAND(group.size() == 1);
+    return group.front();
+  }
+
+  /**
+   * Returns the joint group identified by the handle @p group_index.
+   *
+   * @throws std::out_of_range if @p group_index is not a joint group handle.
+   */
+  const std::vector<const DrakeJoint*>& get_joint_group(
+      int group_index) const {
+    return *joint_groups_by_index_.at(group_index);
+  }
+
+  /**
+   * Returns the generalized position indices associated with the joint group
+   * identified by the handle @p group_index.
+   *
+   * @throws std::out_of_range if @p group_index is not a joint group handle.
+   */
+  const std::vector<int>& get_position_group(int group_index) const {
+    return *position_groups_by_index_.at(group_index);
+  }
+
+  /**
+   * Returns the generalized velocity indices associated with the joint group
+   * identified by the handle @p group_index.
+   *
+   * @throws std::out_of_range if @p group_index is not a joint group handle.
+   */
+  const std::vector<int>& get_velocity_group(int group_index) const {
+    return *velocity_groups_by_index_.at(group_index);
+  }
+
   const std::unordered_map<std::string, std::vector<const RigidBody<T>*>>&
   get_body_groups() const {
     return body_groups_;
@@ -186,4 +275,13 @@ class RigidBodyTreeAliasGroups {
 
   std::unordered_map<std::string, std::vector<int>> position_groups_;
   std::unordered_map<std::string, std::vector<int>> velocity_groups_;
+
+  // The handles of the groups, and the groups indexed by handle. The latter
+  // point into the maps above, whose elements never move.
+  std::unordered_map<std::string, int> body_group_indices_;
+  std::unordered_map<std::string, int> joint_group_indices_;
+  std::vector<const std::vector<const RigidBody<T>*>*> body_groups_by_index_;
+  std::vector<const std::vector<const DrakeJoint*>*> joint_groups_by_index_;
+  std::vector<const std::vector<int>*> position_groups_by_index_;
+  std::vector<const std::vector<int>*> velocity_groups_by_index_;
 };
@@ -1,14 +1,25 @@
 #include "drake/multibody/shapes/geometry.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <spruce.hh>
 #include <tiny_obj_loader.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/hash.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
 
 using std::ifstream;
@@ -217,6 +228,228 @@ ostream& operator<<(ostream& out, const Capsule& cc) {
   return out;
 }
 
+namespace {
+
+// The parts of an OBJ file that Mesh uses, as read by tinyobjloader.
+struct ObjContents {
+  // The size of the file, which guards against hash collisions.
+  uint64_t file_size{};
+  // The x, y and z coordinates of each vertex, unscaled.
+  std::vector<double> vertices;
+  // The number of faces in each shape of the file.
+  std::vector<int> shape_num_faces;
+  // The number of vertices of each face of every shape.
+  std::vector<int> face_sizes;
+  // The (0-based) vertex indices of each face of every shape.
+  std::vector<int> face_indices;
+};
+
+// The parsed OBJ files of this process, keyed by the hash of the file
+// contents, and the directory of their binary copies on disk.
+struct ObjContentsCache {
+  std::mutex mutex;
+  std::string directory;
+  std::unordered_map<size_t, std::shared_ptr<const ObjContents>> contents;
+};
+
+ObjContentsCache& GetObjContentsCache() {
+  static drake::never_destroyed<ObjContentsCache> cache;
+  return cache.access();
+}
+
+// Identifies the binary copies written by WriteObjContentsCopy(); the version is
+// increased whenever their layout changes.
+const char kObjContentsMagic[8] = {'D', 'R', 'K', 'O', 'B', 'J', '\0', '\0'};
+const uint32_t kObjContentsVersion = 1;
+
+string ObjContentsPath(const string& directory, size_t hash) {
+  std::ostringstream path;
+  path << directory << "/" << std::hex << std::setw(16) << std::setfill('0')
+       << hash << ".obj.bin";
+  return path.str();
+}
+
+template <typename Value>
+void WriteArray(const std::vector<Value>& values, std::ostream* out) {
+  const uint64_t size = values.size();
+  out->write(reinterpret_cast<const char*>(&size), sizeof(size));
+  out->write(reinterpret_cast<const char*>(values.data()),
+             size * sizeof(Value));
+}
+
+template <typename Value>
+bool ReadArray(std::istream* in, uint64_t max_size,
+               std::vector<Value>* values) {
+  uint64_t size{};
+  if (!in->read(reinterpret_cast<char*>(&size), sizeof(size)) ||
+      size > max_size / sizeof(Value)) {
+    return false;
+  }
+  values->resize(size);
+  return static_cast<bool>(in->read(reinterpret_cast<char*>(values->data()),
+                                    size * sizeof(Value)));
+}
+
+// Writes the binary copy of @p contents to @p path.  It is written to a
+// temporary file which is then renamed, so that other processes never see a
+// partial copy.  Failures are only logged; the copy is merely an
+// optimization.
+void WriteObjContentsCopy(const ObjContents& contents, const string& path) {
+  const string temporary_path = path + "." + std::to_string(::getpid());
+  {
+    std::ofstream out(temporary_path, std::ios::binary);
+    out.write(kObjContentsMagic, sizeof(kObjContentsMagic));
+    out.write(reinterpret_cast<const char*>(&kObjContentsVersion),
+              sizeof(kObjContentsVersion));
+    out.write(reinterpret_cast<const char*>(&contents.file_size),
+              sizeof(contents.file_size));
+    WriteArray(contents.vertices, &out);
+    WriteArray(contents.shape_num_faces, &out);
+    WriteArray(contents.face_sizes, &out);
+    WriteArray(contents.face_indices, &out);
+    if (!out) {
+      drake::log()->warn("Unable to write the mesh cache file '{}'.",
+                         temporary_path);
+      std::remove(temporary_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+    drake::log()->warn("Unable to write the mesh cache file '{}'.", path);
+    std::remove(temporary_path.c_str());
+  }
+}
+
+// Reads the binary copy at @p path of an OBJ file of @p file_size bytes.
+// Returns nullptr if there is no copy, or if it is unusable.
+std::shared_ptr<const ObjContents> ReadObjContentsCopy(const string& path,
+                                                       uint64_t file_size) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) {
+    return nullptr;
+  }
+  const uint64_t size = static_cast<uint64_t>(in.tellg());
+  in.seekg(0);
+  char magic[sizeof(kObjContentsMagic)];
+  uint32_t version{};
+  auto contents = std::make_shared<ObjContents>();
+  if (!in.read(magic, sizeof(magic)) ||
+      !std::equal(magic, magic + sizeof(magic), kObjContentsMagic) ||
+      !in.read(reinterpret_cast<char*>(&version), sizeof(version)) ||
+      version != kObjContentsVersion ||
+      !in.read(reinterpret_cast<char*>(&contents->file_size),
+               sizeof(contents->file_size)) ||
+      contents->file_size != file_size ||
+      !ReadArray(&in, size, &contents->vertices) ||
+      !ReadArray(&in, size, &contents->shape_num_faces) ||
+      !ReadArray(&in, size, &contents->face_sizes) ||
+      !ReadArray(&in, size, &contents->face_indices) ||
+      static_cast<uint64_t>(in.tellg()) != size) {
+    drake::log()->warn("Ignoring the invalid mesh cache file '{}'.", path);
+    return nullptr;
+  }
+  return contents;
+}
+
+// Parses the OBJ file @p obj_file_name with tinyobjloader.
+std::shared_ptr<const ObjContents> ParseObjFile(const string& obj_file_name,
+                                                uint64_t file_size) {
+  string path;
+  const size_t idx = obj_file_name.rfind('/');
+  if (idx != string::npos) {
+    path = obj_file_name.substr(0, idx + 1);
+  }
+
+  tinyobj::attrib_t attrib;
+  std::vector<tinyobj::shape_t> shapes;
+  std::vector<tinyobj::material_t> materials;
+  std::string err;
+
+  // Would be nice to hand off triangulation of non-triangular faces
+  // to tinyobjloader, however tinyobjloader does no checking that
+  // the triangulation is in fact correct.
+  bool do_tinyobj_triangulation = false;
+  bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
+      obj_file_name.c_str(), path.c_str(), do_tinyobj_triangulation);
+
+  // Use the boolean return value and the error string to determine
+  // if we should proceeed.
+  if (!ret || !err.empty()) {
+    throw std::runtime_error("Error parsing file \""
+        + obj_file_name + "\" : " + err);
+  }
+
+  auto contents = std::make_shared<ObjContents>();
+  contents->file_size = file_size;
+  contents->vertices.assign(attrib.vertices.begin(), attrib.vertices.end());
+  for (const auto& one_shape : shapes) {
+    const tinyobj::mesh_t& mesh = one_shape.mesh;
+    contents->shape_num_faces.push_back(
+        static_cast<int>(mesh.num_face_vertices.size()));
+    for (const auto num_face_vertices : mesh.num_face_vertices) {
+      contents->face_sizes.push_back(num_face_vertices);
+    }
+    for (const tinyobj::index_t& index : mesh.indices) {
+      contents->face_indices.push_back(index.vertex_index);
+    }
+  }
+  return contents;
+}
+
+// Returns the contents of the OBJ file @p obj_file_name.  Each distinct file
+// is parsed once per process, and, if a cache directory is set, once per
+// cache directory.
+std::shared_ptr<const ObjContents> ReadObjContents(
+    const string& obj_file_name) {
+  ifstream file(obj_file_name, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Error opening file \"" + obj_file_name + "\".");
+  }
+  const string bytes{std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>()};
+  drake::DefaultHasher hasher;
+  drake::hash_append(hasher, bytes);
+  const size_t hash = static_cast<size_t>(hasher);
+  const uint64_t file_size = bytes.size();
+
+  ObjContentsCache& cache = GetObjContentsCache();
+  string directory;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto iter = cache.contents.find(hash);
+    if (iter != cache.contents.end() &&
+        iter->second->file_size == file_size) {
+      return iter->second;
+    }
+    directory = cache.directory;
+  }
+
+  std::shared_ptr<const ObjContents> contents;
+  if (!directory.empty()) {
+    const string path = ObjContentsPath(directory, hash);
+    contents = ReadObjContentsCopy(path, file_size);
+    if (!contents) {
+      contents = ParseObjFile(obj_file_name, file_size);
+      WriteObjContentsCopy(*contents, path);
+    }
+  } else {
+    contents = ParseObjFile(obj_file_name, file_size);
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.contents[hash] = contents;
+  return contents;
+}
+
+}  // namespace
+
+void SetMeshCacheDirectory(const string& directory) {
+  ObjContentsCache& cache = GetObjContentsCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.directory = directory;
+  cache.contents.clear();
+}
+
 const double Mesh::kCosThreshold = std::cos(30.0 / 180.0 * M_PI);
 
 Mesh::Mesh(const string& uri, const string& resolved_filename)
@@ -235,39 +468,13 @@ Mesh::Mesh(const string& uri, const string& resolved_filename)
 }
 
 bool Mesh::extractMeshVertices(Matrix3Xd& vertex_coordinates) const {
-  string obj_file_name = FindFileWithObjExtension();
-  ifstream file(obj_file_name);
-  if (!file) {
-    throw std::runtime_error("Error opening file \"" + obj_file_name + "\".");
-  }
-
-  string line;
-  // Count the number of vertices and resize vertex_coordinates.
-  int num_vertices = 0;
-  while (getline(file, line)) {
-    istringstream iss(line);
-    string type;
-    if (iss >> type && type == "v") {
-      ++num_vertices;
-    }
-  }
+  const std::shared_ptr<const ObjContents> contents =
+      ReadObjContents(FindFileWithObjExtension());
+  const int num_vertices = static_cast<int>(contents->vertices.size() / 3);
   vertex_coordinates.resize(3, num_vertices);
-
-  file.clear();
-  file.seekg(0, file.beg);
-
-  double d;
-  int j = 0;
-  while (getline(file, line)) {
-    istringstream iss(line);
-    string type;
-    if (iss >> type && type == "v") {
-      int i = 0;
-      while (iss >> d) {
-        vertex_coordinates(i, j) = d * scale_(i);
-        i++;
-      }
-      ++j;
+  for (int j = 0; j < num_vertices; ++j) {
+    for (int i = 0; i < 3; ++i) {
+      vertex_coordinates(i, j) = contents->vertices[3 * j + i] * scale_(i);
     }
   }
   return true;
@@ -300,43 +507,16 @@ string Mesh::FindFileWithObjExtension() const {
 void Mesh::LoadObjFile(PointsVector* vertices, TrianglesVector* triangles,
                        TriangulatePolicy triangulate) const {
   string obj_file_name = FindFileWithObjExtension();
-  ifstream file(obj_file_name);
-  if (!file) {
-    throw std::runtime_error("Error opening file \"" + obj_file_name + "\".");
-  }
-
-  string path;
-  const size_t idx = obj_file_name.rfind('/');
-  if (idx != string::npos) {
-    path = obj_file_name.substr(0, idx + 1);
-  }
-
-  tinyobj::attrib_t attrib;
-  std::vector<tinyobj::shape_t> shapes;
-  std::vector<tinyobj::material_t> materials;
-  std::string err;
-
-  // Would be nice to hand off triangulation of non-triangular faces
-  // to tinyobjloader, however tinyobjloader does no checking that
-  // the triangulation is in fact correct.
-  bool do_tinyobj_triangulation = false;
-  bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
-      obj_file_name.c_str(), path.c_str(), do_tinyobj_triangulation);
-
-  // Use the boolean return value and the error string to determine
-  // if we should proceeed.
-  if (!ret || !err.empty()) {
-    throw std::runtime_error("Error parsing file \""
-        + obj_file_name + "\" : " + err);
-  }
+  const std::shared_ptr<const ObjContents> contents =
+      ReadObjContents(obj_file_name);
 
   // Store the vertices.
   for (int index = 0;
-       index < static_cast<int>(attrib.vertices.size());
+       index < static_cast<int>(contents->vertices.size());
        index += 3) {
-    vertices->push_back(Vector3d(attrib.vertices[index] * scale_[0],
-                                 attrib.vertices[index + 1] * scale_[1],
-                                 attrib.vertices[index + 2] * scale_[2]));
+    vertices->push_back(Vector3d(contents->vertices[index] * scale_[0],
+                                 contents->vertices[index + 1] * scale_[1],
+                                 contents->vertices[index + 2] * scale_[2]));
   }
 
   // Counter for triangles added to compensate for non-triangular faces.
@@ -346,20 +526,17 @@ void Mesh::LoadObjFile(PointsVector* vertices, TrianglesVector* triangles,
   int maximum_index = 0;
 
   // Iterate over the shapes.
-  for (const auto& one_shape : shapes) {
-    const tinyobj::mesh_t& mesh = one_shape.mesh;
-    int index_offset = 0;
-
+  int shape_face_offset = 0;
+  int index_offset = 0;
+  for (const int num_shape_faces : contents->shape_num_faces) {
     // For each face in the shape.
-    for (int face = 0;
-         face < static_cast<int>(mesh.num_face_vertices.size());
-         ++face) {
-      const int vert_count = mesh.num_face_vertices[face];
+    for (int face = 0; face < num_shape_faces; ++face) {
+      const int vert_count = contents->face_sizes[shape_face_offset + face];
 
       std::vector<int> indices;
       for (int vert = 0; vert < vert_count; ++vert) {
         // Store the vertex index.
-        int vertex_index = mesh.indices[index_offset + vert].vertex_index;
+        int vertex_index = contents->face_indices[index_offset + vert];
         maximum_index = std::max(maximum_index, vertex_index);
         indices.push_back(vertex_index);
       }
@@ -438,6 +615,7 @@ void Mesh::LoadObjFile(PointsVector* vertices, TrianglesVector* triangles,
 
       index_offset += vert_count;
     }
+    shape_face_offset += num_shape_faces;
   }
 
   // Verifies that the maximum index referenced when defining faces does not
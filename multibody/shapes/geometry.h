@@ -291,6 +291,18 @@ class Mesh : public Geometry {
   std::string FindFileWithObjExtension() const;
 };
 
+/** Sets the directory in which Mesh keeps a binary copy of each OBJ file that
+it parses, so that later processes loading the same file skip the parsing.
+The copies are named by a hash of the contents of the OBJ file, so a file
+that changes is parsed again.  An empty @p directory, the default, disables
+the copies.
+
+Whether or not the directory is set, each distinct OBJ file is parsed at most
+once per process; the parsed contents are kept until the directory is next
+set.
+*/
+void SetMeshCacheDirectory(const std::string& directory);
+
 class MeshPoints : public Geometry {
  public:
   explicit MeshPoints(const Eigen::Matrix3Xd& points);
@@ -0,0 +1,126 @@
+/* clang-format off to disable clang-format-includes */
+#include "drake/multibody/shapes/geometry.h"
+/* clang-format on */
+
+#include <dirent.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+
+using drake::FindResourceOrThrow;
+
+namespace DrakeShapes {
+namespace {
+
+const char* kUri = "";  // No specific URI is required for these tests.
+
+// Returns the paths of the mesh cache files in @p directory.
+std::vector<std::string> ListCacheFiles(const std::string& directory) {
+  std::vector<std::string> paths;
+  DIR* dir = opendir(directory.c_str());
+  EXPECT_NE(dir, nullptr);
+  while (const dirent* entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if (name.size() > 8 && name.substr(name.size() - 8) == ".obj.bin") {
+      paths.push_back(directory + "/" + name);
+    }
+  }
+  closedir(dir);
+  return paths;
+}
+
+class MeshCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Each test gets a directory of its own.
+    std::string pattern = drake::temp_directory() + "/mesh_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(&pattern[0]), nullptr);
+    directory_ = pattern;
+    SetMeshCacheDirectory(directory_);
+  }
+
+  void TearDown() override { SetMeshCacheDirectory(""); }
+
+  void Load(PointsVector* vertices, TrianglesVector* triangles) const {
+    mesh_.LoadObjFile(vertices, triangles, Mesh::TriangulatePolicy::kTry);
+  }
+
+  std::string directory_;
+  const Mesh mesh_{kUri, FindResourceOrThrow(
+      "drake/multibody/shapes/test/tri_cube.obj")};
+};
+
+// The first load writes a copy of the parsed file, which later loads read.
+TEST_F(MeshCacheTest, CopyIsWrittenAndRead) {
+  PointsVector vertices;
+  TrianglesVector triangles;
+  Load(&vertices, &triangles);
+  ASSERT_EQ(vertices.size(), 8u);
+  ASSERT_EQ(triangles.size(), 12u);
+  const std::vector<std::string> paths = ListCacheFiles(directory_);
+  ASSERT_EQ(paths.size(), 1u);
+
+  // Overwrite the x coordinate of the first vertex in the copy, which
+  // follows the magic number, version, file size and vertex count.
+  {
+    std::fstream copy(paths[0],
+                      std::ios::in | std::ios::out | std::ios::binary);
+    copy.seekp(8 + 4 + 8 + 8);
+    const double x = 42;
+    copy.write(reinterpret_cast<const char*>(&x), sizeof(x));
+  }
+
+  // Setting the directory discards what this process has parsed, so the
+  // modified copy is read.
+  SetMeshCacheDirectory(directory_);
+  PointsVector cached_vertices;
+  TrianglesVector cached_triangles;
+  Load(&cached_vertices, &cached_triangles);
+  EXPECT_EQ(cached_triangles, triangles);
+  ASSERT_EQ(cached_vertices.size(), vertices.size());
+  EXPECT_EQ(cached_vertices[0].x(), 42);
+  for (int i = 1; i < static_cast<int>(vertices.size()); ++i) {
+    EXPECT_EQ(cached_vertices[i], vertices[i]);
+  }
+
+  // getPoints() uses the same contents.
+  Eigen::Matrix3Xd points;
+  mesh_.getPoints(points);
+  ASSERT_EQ(points.cols(), 8);
+  EXPECT_EQ(points(0, 0), 42);
+}
+
+// A truncated copy is ignored, and replaced by a new one.
+TEST_F(MeshCacheTest, InvalidCopyIsReplaced) {
+  PointsVector vertices;
+  TrianglesVector triangles;
+  Load(&vertices, &triangles);
+  const std::vector<std::string> paths = ListCacheFiles(directory_);
+  ASSERT_EQ(paths.size(), 1u);
+  std::ofstream(paths[0], std::ios::trunc | std::ios::binary) << "DRKOBJ";
+
+  SetMeshCacheDirectory(directory_);
+  PointsVector reparsed_vertices;
+  TrianglesVector reparsed_triangles;
+  Load(&reparsed_vertices, &reparsed_triangles);
+  EXPECT_EQ(reparsed_vertices, vertices);
+  EXPECT_EQ(reparsed_triangles, triangles);
+
+  // The replacement is read back.
+  SetMeshCacheDirectory(directory_);
+  PointsVector cached_vertices;
+  TrianglesVector cached_triangles;
+  Load(&cached_vertices, &cached_triangles);
+  EXPECT_EQ(cached_vertices, vertices);
+  EXPECT_EQ(cached_triangles, triangles);
+}
+
+}  // namespace
+}  // namespace DrakeShapes
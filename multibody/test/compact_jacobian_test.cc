@@ -0,0 +1,69 @@
+#include "drake/multibody/compact_jacobian.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace {
+
+const double kTolerance = 1e-14;
+const int kNumVelocities = 7;
+
+class CompactJacobianTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    compact_.J = Matrix6X<double>::Random(6, 3);
+    compact_.indices = {1, 4, 5};
+    dense_ = compact_.ToDense(kNumVelocities);
+  }
+
+  CompactJacobian<double> compact_;
+  Matrix6X<double> dense_;
+};
+
+TEST_F(CompactJacobianTest, ToDense) {
+  for (int k = 0; k < 3; ++k) {
+    EXPECT_TRUE(CompareMatrices(dense_.col(compact_.indices[k]),
+                                compact_.J.col(k)));
+  }
+  for (int i : {0, 2, 3, 6}) {
+    EXPECT_TRUE(CompareMatrices(dense_.col(i), Vector6<double>::Zero()));
+  }
+}
+
+TEST_F(CompactJacobianTest, Multiply) {
+  const VectorX<double> v = VectorX<double>::Random(kNumVelocities);
+  EXPECT_TRUE(CompareMatrices(compact_.Multiply(v), dense_ * v, kTolerance));
+}
+
+TEST_F(CompactJacobianTest, AddTransposeMultiply) {
+  const Vector6<double> F = Vector6<double>::Random();
+  const VectorX<double> initial = VectorX<double>::Random(kNumVelocities);
+  VectorX<double> generalized_force = initial;
+  compact_.AddTransposeMultiply(F, &generalized_force);
+  EXPECT_TRUE(CompareMatrices(generalized_force,
+                              initial + dense_.transpose() * F, kTolerance));
+}
+
+TEST_F(CompactJacobianTest, AddTransposeWeightedProduct) {
+  const Matrix6<double> W = Matrix6<double>::Random();
+  const MatrixX<double> initial =
+      MatrixX<double>::Random(kNumVelocities, kNumVelocities);
+  MatrixX<double> H = initial;
+  compact_.AddTransposeWeightedProduct(W, &H);
+  EXPECT_TRUE(CompareMatrices(H, initial + dense_.transpose() * W * dense_,
+                              kTolerance));
+}
+
+TEST_F(CompactJacobianTest, Empty) {
+  CompactJacobian<double> empty;
+  EXPECT_TRUE(CompareMatrices(empty.ToDense(kNumVelocities),
+                              Matrix6X<double>::Zero(6, kNumVelocities)));
+  EXPECT_TRUE(CompareMatrices(
+      empty.Multiply(VectorX<double>::Ones(kNumVelocities)),
+      Vector6<double>::Zero()));
+}
+
+}  // namespace
+}  // namespace drake
@@ -216,6 +216,30 @@ TEST_F(RBTCollisionCliqueTest, ComputeContactPointsWithCliques) {
       solution_[bodyB].body_frame, tolerance_));
 }
 
+// Confirms that a tree whose collision elements are disabled has no collision
+// geometry, and finds no collisions.
+GTEST_TEST(RBTCollisionElementsDisabledTest, NoCollisionGeometry) {
+  RigidBodyTree<double> tree;
+  EXPECT_TRUE(tree.collision_elements_enabled());
+  tree.set_collision_elements_enabled(false);
+  EXPECT_FALSE(tree.collision_elements_enabled());
+  parsers::sdf::AddModelInstancesFromSdfFileToWorld(
+      FindResourceOrThrow(
+          "drake/multibody/test/rigid_body_tree/"
+          "small_sphere_on_large_box.sdf"),
+      multibody::joints::kQuaternion, &tree);
+
+  const RigidBody<double>* small_sphere = tree.FindBody("small_sphere");
+  EXPECT_EQ(small_sphere->get_collision_element_ids().size(), 0u);
+  EXPECT_EQ(tree.FindBody("large_box")->get_collision_element_ids().size(),
+            0u);
+
+  const VectorXd q = tree.getZeroConfiguration();
+  KinematicsCache<double> kinsol =
+      tree.doKinematics(q, VectorXd::Zero(tree.get_num_velocities()));
+  EXPECT_EQ(tree.ComputeMaximumDepthCollisionPoints(kinsol, false).size(), 0u);
+}
+
 }  // namespace
 }  // namespace rigid_body_tree
 }  // namespace test
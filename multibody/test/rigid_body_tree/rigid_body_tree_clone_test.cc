@@ -5,6 +5,7 @@
 #include <cmath>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -12,6 +13,7 @@
 #include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/parsers/parser_common.h"
 #include "drake/multibody/parsers/sdf_parser.h"
 #include "drake/multibody/parsers/urdf_parser.h"
 #include "drake/multibody/rigid_body_plant/rigid_body_plant.h"
@@ -31,6 +33,7 @@ namespace drake {
 using multibody::test::rigid_body_tree::CompareToClone;
 using parsers::ModelInstanceIdTable;
 using parsers::sdf::AddModelInstancesFromSdfFileToWorld;
+using parsers::urdf::AddModelInstanceFromUrdfFile;
 using parsers::urdf::AddModelInstanceFromUrdfFileWithRpyJointToWorld;
 using parsers::urdf::AddModelInstanceFromUrdfFileToWorld;
 
@@ -87,6 +90,62 @@ TEST_F(RigidBodyTreeCloneTest, CloneValkyrie) {
   EXPECT_TRUE(CompareToClone(*tree_));
 }
 
+// Tests that RigidBodyTree::AddModelInstanceCopy() adds the same model
+// instances as parsing the model for each of them.
+TEST_F(RigidBodyTreeCloneTest, AddModelInstanceCopy) {
+  const std::string filename = FindResourceOrThrow(
+      "drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  RigidBodyTree<double> prototype;
+  const ModelInstanceIdTable table = AddModelInstanceFromUrdfFile(
+      filename, multibody::joints::kFixed, nullptr /* weld_to_frame */,
+      false /* do_compile */, &prototype);
+  ASSERT_EQ(table.size(), 1u);
+
+  RigidBodyTree<double> copies;
+  for (int i = 0; i < 2; ++i) {
+    auto weld_to_frame = std::make_shared<RigidBodyFrame<double>>(
+        "world", nullptr, Eigen::Vector3d(i, 0, 0), Eigen::Vector3d::Zero());
+    const ModelInstanceIdTable parsed = AddModelInstanceFromUrdfFile(
+        filename, multibody::joints::kQuaternion, weld_to_frame, tree_.get());
+    std::vector<int> body_indices;
+    EXPECT_EQ(copies.AddModelInstanceCopy(
+                  prototype, table.begin()->second, &body_indices),
+              parsed.begin()->second);
+    parsers::AddFloatingJoint(multibody::joints::kQuaternion, body_indices,
+                              weld_to_frame, nullptr /* pose_map */, &copies);
+    copies.compile();
+  }
+
+  ASSERT_EQ(copies.get_num_bodies(), tree_->get_num_bodies());
+  ASSERT_EQ(copies.get_num_positions(), tree_->get_num_positions());
+  ASSERT_EQ(copies.get_num_velocities(), tree_->get_num_velocities());
+  EXPECT_EQ(copies.get_frames().size(), tree_->get_frames().size());
+  EXPECT_EQ(copies.get_num_actuators(), tree_->get_num_actuators());
+  EXPECT_EQ(copies.loops.size(), tree_->loops.size());
+  EXPECT_TRUE(CompareMatrices(copies.B, tree_->B));
+  for (int i = 0; i < tree_->get_num_bodies(); ++i) {
+    const RigidBody<double>& expected = tree_->get_body(i);
+    const RigidBody<double>& body = copies.get_body(i);
+    EXPECT_EQ(body.get_name(), expected.get_name());
+    EXPECT_EQ(body.get_model_instance_id(), expected.get_model_instance_id());
+    EXPECT_EQ(body.get_num_collision_elements(),
+              expected.get_num_collision_elements());
+    EXPECT_EQ(body.get_visual_elements().size(),
+              expected.get_visual_elements().size());
+  }
+
+  const VectorX<double> q =
+      VectorX<double>::LinSpaced(tree_->get_num_positions(), -0.5, 0.5);
+  KinematicsCache<double> expected_cache = tree_->doKinematics(q);
+  KinematicsCache<double> cache = copies.doKinematics(q);
+  for (int i = 0; i < tree_->get_num_bodies(); ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        copies.CalcBodyPoseInWorldFrame(cache, copies.get_body(i)).matrix(),
+        tree_->CalcBodyPoseInWorldFrame(expected_cache, tree_->get_body(i))
+            .matrix()));
+  }
+}
+
 class TestRbtCloneDiagram : public Diagram<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TestRbtCloneDiagram);
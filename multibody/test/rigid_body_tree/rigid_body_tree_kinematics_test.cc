@@ -77,6 +77,115 @@ TEST_F(RigidBodyTreeKinematicsTests, TestDoKinematicWithBadCache2) {
   EXPECT_THROW(tree_->doKinematics(cache), std::runtime_error);
 }
 
+// Tests that RigidBodyTree::doBatchKinematics() and the batched
+// CalcBodyPosesInWorldFrame() match doKinematics() for every sample.
+TEST_F(RigidBodyTreeKinematicsTests, BatchKinematicsMatchesDoKinematics) {
+  const std::string filename = FindResourceOrThrow(
+      "drake/multibody/test/rigid_body_tree/two_dof_robot.urdf");
+  parsers::urdf::AddModelInstanceFromUrdfFileWithRpyJointToWorld(filename,
+                                                                 tree_.get());
+  const int num_samples = 7;
+  const Eigen::MatrixXd q =
+      Eigen::MatrixXd::Random(tree_->get_num_positions(), num_samples);
+
+  const BatchKinematicsCache<double> batch_cache = tree_->doBatchKinematics(q);
+  ASSERT_EQ(batch_cache.get_num_bodies(), tree_->get_num_bodies());
+  ASSERT_EQ(batch_cache.get_num_samples(), num_samples);
+
+  const int last_body = tree_->get_num_bodies() - 1;
+  const std::vector<int> chosen_bodies{last_body, 1};
+  const std::vector<BatchKinematicsCache<double>::PoseBatch> chosen_poses =
+      tree_->CalcBodyPosesInWorldFrame(q, chosen_bodies);
+  ASSERT_EQ(chosen_poses.size(), chosen_bodies.size());
+
+  const double kTolerance = 1e-14;
+  for (int k = 0; k < num_samples; ++k) {
+    const KinematicsCache<double> cache = tree_->doKinematics(
+        VectorXd(q.col(k)));
+    for (int i = 0; i < tree_->get_num_bodies(); ++i) {
+      const Isometry3<double> X_WB =
+          tree_->CalcBodyPoseInWorldFrame(cache, tree_->get_body(i));
+      EXPECT_TRUE(CompareMatrices(batch_cache.get_pose_in_world(i, k).matrix(),
+                                  X_WB.matrix(), kTolerance));
+    }
+    for (size_t j = 0; j < chosen_bodies.size(); ++j) {
+      const Isometry3<double> X_WB = tree_->CalcBodyPoseInWorldFrame(
+          cache, tree_->get_body(chosen_bodies[j]));
+      EXPECT_TRUE(CompareMatrices(
+          BatchKinematicsCache<double>::GetPose(chosen_poses[j], k).matrix(),
+          X_WB.matrix(), kTolerance));
+    }
+  }
+}
+
+// Tests that the batched kinematics reject mismatched inputs.
+TEST_F(RigidBodyTreeKinematicsTests, BatchKinematicsBadInputs) {
+  const std::string filename = FindResourceOrThrow(
+      "drake/multibody/test/rigid_body_tree/two_dof_robot.urdf");
+  parsers::urdf::AddModelInstanceFromUrdfFileWithRpyJointToWorld(filename,
+                                                                 tree_.get());
+  const Eigen::MatrixXd q =
+      Eigen::MatrixXd::Zero(tree_->get_num_positions(), 3);
+  const Eigen::MatrixXd bad_q =
+      Eigen::MatrixXd::Zero(tree_->get_num_positions() + 1, 3);
+  EXPECT_THROW(tree_->doBatchKinematics(bad_q), std::runtime_error);
+
+  BatchKinematicsCache<double> cache = tree_->CreateBatchKinematicsCache(2);
+  EXPECT_THROW(tree_->doBatchKinematics(q, &cache), std::runtime_error);
+
+  EXPECT_THROW(
+      tree_->CalcBodyPosesInWorldFrame(q, {tree_->get_num_bodies()}),
+      std::runtime_error);
+}
+
+// Tests that doKinematics() computes the same kinematics whether it calls the
+// concrete joints' methods, as it does for the joints that the tree was
+// compiled with, or DrakeJoint's virtual methods, as it does for joints that
+// have been replaced since.
+TEST_F(RigidBodyTreeKinematicsTests, StaticAndVirtualJointDispatchMatch) {
+  const std::string filename = FindResourceOrThrow(
+      "drake/multibody/test/rigid_body_tree/two_dof_robot.urdf");
+  for (const auto floating_base_type :
+       {multibody::joints::kRollPitchYaw, multibody::joints::kQuaternion}) {
+    tree_ = std::make_unique<RigidBodyTree<double>>();
+    parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+        filename, floating_base_type, tree_.get());
+    VectorXd q = tree_->getZeroConfiguration() +
+        VectorXd::Random(tree_->get_num_positions());
+    if (floating_base_type == multibody::joints::kQuaternion) {
+      q.segment<4>(3).normalize();
+    }
+    const VectorXd v = VectorXd::Random(tree_->get_num_velocities());
+    const KinematicsCache<double> expected = tree_->doKinematics(q, v);
+
+    for (int i = 1; i < tree_->get_num_bodies(); ++i) {
+      RigidBody<double>* body = tree_->get_mutable_body(i);
+      body->setJoint(body->getJoint().Clone());
+    }
+    const KinematicsCache<double> cache = tree_->doKinematics(q, v);
+
+    const double kTolerance = 1e-13;
+    for (int i = 0; i < tree_->get_num_bodies(); ++i) {
+      const auto& expected_element = expected.get_element(i);
+      const auto& element = cache.get_element(i);
+      EXPECT_TRUE(CompareMatrices(element.transform_to_world.matrix(),
+                                  expected_element.transform_to_world.matrix(),
+                                  kTolerance));
+      EXPECT_TRUE(CompareMatrices(element.motion_subspace_in_world,
+                                  expected_element.motion_subspace_in_world,
+                                  kTolerance));
+      EXPECT_TRUE(CompareMatrices(element.v_to_qdot,
+                                  expected_element.v_to_qdot, kTolerance));
+      EXPECT_TRUE(CompareMatrices(element.twist_in_world,
+                                  expected_element.twist_in_world,
+                                  kTolerance));
+      EXPECT_TRUE(CompareMatrices(
+          element.motion_subspace_in_world_dot_times_v,
+          expected_element.motion_subspace_in_world_dot_times_v, kTolerance));
+    }
+  }
+}
+
 class AcrobotTests : public ::testing::Test {
  protected:
   void SetUp() {
@@ -364,6 +473,22 @@ class RBTDifferentialKinematicsHelperTest : public ::testing::Test {
                                          drake::MatrixCompareType::absolute));
     }
 
+    // The compact Jacobian holds the nonzero columns of J, and its products
+    // match those of J.
+    CompactJacobian<double> J_compact =
+        robot_->CalcFrameSpatialVelocityCompactJacobianInWorldFrame(
+            *cache_, *body_ptr_, X_BF_, use_qdot);
+    EXPECT_TRUE(drake::CompareMatrices(J_compact.ToDense(J.cols()), J, 0,
+                                       drake::MatrixCompareType::absolute));
+    const VectorX<double> u = VectorX<double>::LinSpaced(J.cols(), -1, 1);
+    EXPECT_TRUE(drake::CompareMatrices(J_compact.Multiply(u), J * u, tol_,
+                                       drake::MatrixCompareType::absolute));
+    const Vector6<double> F = Vector6<double>::LinSpaced(1, 6);
+    VectorX<double> JtF = VectorX<double>::Zero(J.cols());
+    J_compact.AddTransposeMultiply(F, &JtF);
+    EXPECT_TRUE(drake::CompareMatrices(JtF, J.transpose() * F, tol_,
+                                       drake::MatrixCompareType::absolute));
+
     Isometry3<double> X_WF =
         robot_->CalcFramePoseInWorldFrame(*cache_, *frame_ptr_);
     KinematicPath kinematic_path = robot_->findKinematicPath(
@@ -96,6 +96,49 @@ void TestFullConfig(multibody::joints::FloatingBaseType type) {
   EXPECT_EQ(robot->get_velocity_name(v_indices.back()), "joint1dot");
 }
 
+GTEST_TEST(RigidBodyTreeAliasGroupsTest, GroupHandles) {
+  std::string urdf = FindResourceOrThrow(
+      "drake/multibody/test/rigid_body_tree/two_dof_robot.urdf");
+  std::string config = FindResourceOrThrow(
+      "drake/multibody/test/test.alias_groups");
+
+  auto robot = std::make_unique<RigidBodyTree<double>>();
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      urdf, multibody::joints::kRollPitchYaw, robot.get());
+
+  RigidBodyTreeAliasGroups<double> alias(robot.get());
+  alias.LoadFromFile(config);
+  EXPECT_EQ(alias.num_body_groups(), 3);
+  EXPECT_EQ(alias.num_joint_groups(), 2);
+
+  for (const auto& group : alias.get_body_groups()) {
+    const int index = alias.get_body_group_index(group.first);
+    EXPECT_EQ(&alias.get_body_group(index), &group.second);
+  }
+  for (const auto& group : alias.get_joint_groups()) {
+    const int index = alias.get_joint_group_index(group.first);
+    EXPECT_EQ(&alias.get_joint_group(index), &group.second);
+    EXPECT_EQ(&alias.get_position_group(index),
+              &alias.get_position_group(group.first));
+    EXPECT_EQ(&alias.get_velocity_group(index),
+              &alias.get_velocity_group(group.first));
+  }
+
+  const int world = alias.get_body_group_index("b_group3");
+  EXPECT_EQ(alias.get_body(world)->get_name(), "world");
+
+  // Adding to an existing group keeps its handle.
+  const int num_body_groups = alias.num_body_groups();
+  alias.AddBodyGroup("b_group3", {&robot->get_body(1)});
+  EXPECT_EQ(alias.num_body_groups(), num_body_groups);
+  EXPECT_EQ(alias.get_body_group(world).size(), 2u);
+
+  EXPECT_THROW(alias.get_body_group_index("b_non_existant_group"),
+               std::out_of_range);
+  EXPECT_THROW(alias.get_joint_group(alias.num_joint_groups()),
+               std::out_of_range);
+}
+
 GTEST_TEST(RigidBodyTreeParsingTest, TestFull) {
   TestFullConfig(multibody::joints::kRollPitchYaw);
   TestFullConfig(multibody::joints::kQuaternion);
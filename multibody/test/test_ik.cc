@@ -1,5 +1,6 @@
 #include <cstdlib>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -175,5 +176,91 @@ GTEST_TEST(testIK, iiwaIKInfeasible) {
   // EXPECT_GT(ineasible_constraint.size(), 0);
 }
 
+// Returns an iiwa model, together with the constraints of a reachable end
+// effector position that the caller keeps alive.
+std::unique_ptr<RigidBodyTree<double>> MakeIiwaWithPositionConstraint(
+    const Vector3d& pos_end,
+    std::unique_ptr<WorldPositionConstraint>* wpc) {
+  auto model = std::make_unique<RigidBodyTree<double>>();
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      drake::FindResourceOrThrow(
+          "drake/manipulation/models/iiwa_description/urdf/"
+          "iiwa14_primitive_collision.urdf"),
+      drake::multibody::joints::kFixed, model.get());
+  const Vector2d tspan(0, 1);
+  const double pos_tol = 0.01;
+  *wpc = std::make_unique<WorldPositionConstraint>(
+      model.get(), model->FindBodyIndex("iiwa_link_7"), Vector3d::Zero(),
+      pos_end - Vector3d::Constant(pos_tol),
+      pos_end + Vector3d::Constant(pos_tol), tspan);
+  return model;
+}
+
+GTEST_TEST(testIK, iiwaIKMultiStart) {
+  std::unique_ptr<WorldPositionConstraint> wpc;
+  auto model = MakeIiwaWithPositionConstraint(Vector3d(0.58, 0, 0.77), &wpc);
+  const std::vector<const RigidBodyConstraint*> constraint_array{wpc.get()};
+  const IKoptions ikoptions(model.get());
+  const VectorXd q0 = model->getZeroConfiguration();
+
+  std::default_random_engine generator(1234);
+  Eigen::MatrixXd q_seeds(model->get_num_positions(), 5);
+  for (int i = 0; i < q_seeds.cols(); ++i) {
+    q_seeds.col(i) = model->getRandomConfiguration(generator);
+  }
+
+  const IKMultiStartResults serial = inverseKinMultiStart(
+      model.get(), q_seeds, q0, constraint_array, ikoptions, 1);
+  EXPECT_EQ(serial.info, 1);
+  EXPECT_EQ(serial.num_seeds_solved, serial.seed_index + 1);
+
+  // The result does not depend on the number of threads.
+  const IKMultiStartResults parallel = inverseKinMultiStart(
+      model.get(), q_seeds, q0, constraint_array, ikoptions, 3);
+  EXPECT_EQ(parallel.seed_index, serial.seed_index);
+  EXPECT_EQ(parallel.info, serial.info);
+  EXPECT_TRUE(CompareMatrices(parallel.q_sol, serial.q_sol, 1e-12,
+                              MatrixCompareType::absolute));
+
+  // It matches the solution found from that seed alone.
+  VectorXd q_sol = VectorXd::Zero(model->get_num_positions());
+  int info = 0;
+  std::vector<std::string> infeasible_constraint;
+  const VectorXd q_seed = q_seeds.col(serial.seed_index);
+  inverseKin(model.get(), q_seed, q0, constraint_array.size(),
+             constraint_array.data(), ikoptions, &q_sol, &info,
+             &infeasible_constraint);
+  EXPECT_EQ(info, serial.info);
+  EXPECT_TRUE(CompareMatrices(q_sol, serial.q_sol, 1e-12,
+                              MatrixCompareType::absolute));
+}
+
+GTEST_TEST(testIK, iiwaIKMultiStartInfeasible) {
+  std::unique_ptr<WorldPositionConstraint> wpc;
+  auto model = MakeIiwaWithPositionConstraint(Vector3d(10.0, 0, 1.0), &wpc);
+  const std::vector<const RigidBodyConstraint*> constraint_array{wpc.get()};
+  const IKoptions ikoptions(model.get());
+  const VectorXd q0 = model->getZeroConfiguration();
+  const Eigen::MatrixXd q_seeds = q0.replicate(1, 3);
+
+  // With no successful seed, every seed is solved and the first one is
+  // reported.
+  const IKMultiStartResults results = inverseKinMultiStart(
+      model.get(), q_seeds, q0, constraint_array, ikoptions, 2);
+  EXPECT_EQ(results.seed_index, 0);
+  EXPECT_EQ(results.num_seeds_solved, 3);
+  EXPECT_NE(results.info, 1);
+
+  // Past the time budget, only the first seed is solved.
+  const IKMultiStartResults timed_out = inverseKinMultiStart(
+      model.get(), q_seeds, q0, constraint_array, ikoptions, 1, 0.0);
+  EXPECT_EQ(timed_out.seed_index, 0);
+  EXPECT_EQ(timed_out.num_seeds_solved, 1);
+
+  EXPECT_THROW(inverseKinMultiStart(model.get(), Eigen::MatrixXd(7, 0), q0,
+                                    constraint_array, ikoptions, 1),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace drake
@@ -1,5 +1,6 @@
 #include <cstdlib>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -84,5 +85,65 @@ WorldCoMConstraint com_kc_final(tree.get(), com_lb, com_ub, tspan_end);
   delete[] info;
 }
 
+GTEST_TEST(testIKpointwise, threadedIKpointwise) {
+  auto tree = std::make_unique<RigidBodyTree<double>>();
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      FindResourceOrThrow(
+          "drake/examples/atlas/urdf/atlas_minimal_contact.urdf"),
+      multibody::joints::kRollPitchYaw, tree.get());
+
+  const int nT = 5;
+  const double t[nT] = {0.0, 0.25, 0.5, 0.75, 1.0};
+  MatrixXd q0(tree->get_num_positions(), nT);
+  for (int i = 0; i < nT; i++) {
+    q0.col(i) = tree->getZeroConfiguration();
+    q0(3, i) = 0.8;
+  }
+  const Vector3d com_lb(0, 0, 0.9);
+  const Vector3d com_ub(0, 0, 1.0);
+  const Vector2d tspan_end(0.6, 1);
+  WorldCoMConstraint com_kc_final(tree.get(), com_lb, com_ub, tspan_end);
+  const std::vector<const RigidBodyConstraint*> constraint_array{
+      &com_kc_final};
+
+  // Returns the solutions found with the given options.
+  auto solve = [&](const IKoptions& ikoptions, std::vector<int>* info) {
+    MatrixXd q_sol(tree->get_num_positions(), nT);
+    info->assign(nT, 0);
+    std::vector<std::string> infeasible_constraint;
+    inverseKinPointwise(tree.get(), nT, t, q0, q0, constraint_array.size(),
+                        constraint_array.data(), ikoptions, &q_sol,
+                        info->data(), &infeasible_constraint);
+    return q_sol;
+  };
+
+  // The samples solved on several threads match those solved serially.
+  IKoptions ikoptions(tree.get());
+  std::vector<int> serial_info;
+  const MatrixXd serial = solve(ikoptions, &serial_info);
+  ikoptions.setNumThreads(3);
+  EXPECT_EQ(ikoptions.getNumThreads(), 3);
+  std::vector<int> threaded_info;
+  const MatrixXd threaded = solve(ikoptions, &threaded_info);
+  EXPECT_EQ(threaded_info, serial_info);
+  EXPECT_TRUE(CompareMatrices(threaded, serial, 1e-12,
+                              MatrixCompareType::absolute));
+  for (int i = 0; i < nT; i++) {
+    EXPECT_EQ(serial_info[i], 1);
+  }
+
+  // With sequential seeds, the samples are solved serially whatever the
+  // number of threads.
+  ikoptions.setSequentialSeedFlag(true);
+  std::vector<int> sequential_info;
+  const MatrixXd sequential = solve(ikoptions, &sequential_info);
+  ikoptions.setNumThreads(1);
+  std::vector<int> sequential_serial_info;
+  const MatrixXd sequential_serial = solve(ikoptions, &sequential_serial_info);
+  EXPECT_EQ(sequential_info, sequential_serial_info);
+  EXPECT_TRUE(CompareMatrices(sequential, sequential_serial, 1e-12,
+                              MatrixCompareType::absolute));
+}
+
 }  // namespace
 }  // namespace drake
@@ -110,4 +110,25 @@ GTEST_TEST(testIKtraj, testIKtraj) {
                  constraint_array.size(), constraint_array.data(), ikoptions,
                  &q_sol, &qdot_sol, &qddot_sol, &info, &infeasible_constraint);
   EXPECT_EQ(info, 1);
+
+  // Spreading the inbetween samples over several threads gives the same
+  // constraint values, and so the same solution.
+  ikoptions.setNumThreads(3);
+  MatrixXd q_sol_threaded(model->get_num_positions(), nT);
+  inverseKinTraj(model.get(), nT, t.data(), qdot0, q0, q0,
+                 constraint_array.size(), constraint_array.data(), ikoptions,
+                 &q_sol_threaded, &qdot_sol, &qddot_sol, &info,
+                 &infeasible_constraint);
+  EXPECT_EQ(info, 1);
+  EXPECT_TRUE(q_sol_threaded.isApprox(q_sol));
+
+  // Warm start from the solved trajectory.
+  ikoptions.setqdSeed(qdot_sol.col(0), qdot_sol.col(nT - 1));
+  MatrixXd q_sol_warm(model->get_num_positions(), nT);
+  inverseKinTraj(model.get(), nT, t.data(), qdot0, q_sol, q0,
+                 constraint_array.size(), constraint_array.data(), ikoptions,
+                 &q_sol_warm, &qdot_sol, &qddot_sol, &info,
+                 &infeasible_constraint);
+  EXPECT_EQ(info, 1);
+  EXPECT_TRUE(q_sol_warm.isApprox(q_sol, 1e-4));
 }
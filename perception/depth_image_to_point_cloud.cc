@@ -0,0 +1,148 @@
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+#include "drake/common/drake_assert.h"
+#include "drake/systems/rendering/pose_vector.h"
+
+using Eigen::ArrayXf;
+using Eigen::Isometry3f;
+
+using drake::systems::sensors::CameraInfo;
+using drake::systems::sensors::ImageDepth32F;
+using drake::systems::sensors::InvalidDepth;
+
+namespace drake {
+namespace perception {
+
+namespace {
+
+// A row of a matrix of points, as an array.
+using RowMap = Eigen::Map<ArrayXf, Eigen::Unaligned, Eigen::InnerStride<>>;
+
+// The valid depths are strictly between these.
+const float kTooClose = InvalidDepth::kTooClose;
+const float kTooFar = InvalidDepth::kTooFar;
+
+}  // namespace
+
+DepthImageToPointCloud::DepthImageToPointCloud(const CameraInfo& camera_info,
+                                               bool skip_invalid)
+    : camera_info_(camera_info.width(), camera_info.height(),
+                   camera_info.focal_x(), camera_info.focal_y(),
+                   camera_info.center_x(), camera_info.center_y()),
+      skip_invalid_(skip_invalid) {
+  depth_image_input_port_index_ =
+      DeclareAbstractInputPort(systems::Value<ImageDepth32F>(ImageDepth32F(
+                                   camera_info.width(), camera_info.height())))
+          .get_index();
+  camera_pose_input_port_index_ =
+      DeclareVectorInputPort(systems::rendering::PoseVector<double>())
+          .get_index();
+  point_cloud_output_port_index_ =
+      DeclareAbstractOutputPort(PointCloud(0),
+                                &DepthImageToPointCloud::CalcPointCloud)
+          .get_index();
+}
+
+const systems::InputPortDescriptor<double>&
+DepthImageToPointCloud::get_depth_image_input_port() const {
+  return get_input_port(depth_image_input_port_index_);
+}
+
+const systems::InputPortDescriptor<double>&
+DepthImageToPointCloud::get_camera_pose_input_port() const {
+  return get_input_port(camera_pose_input_port_index_);
+}
+
+const systems::OutputPort<double>&
+DepthImageToPointCloud::get_point_cloud_output_port() const {
+  return get_output_port(point_cloud_output_port_index_);
+}
+
+void DepthImageToPointCloud::CalcPointCloud(
+    const systems::Context<double>& context, PointCloud* cloud) const {
+  const systems::AbstractValue* depth_image =
+      EvalAbstractInput(context, depth_image_input_port_index_);
+  DRAKE_DEMAND(depth_image != nullptr);
+  const auto* const X_PC =
+      EvalVectorInput<systems::rendering::PoseVector>(
+          context, camera_pose_input_port_index_);
+  if (X_PC != nullptr) {
+    const Isometry3f X_PC_float = X_PC->get_isometry().cast<float>();
+    Convert(depth_image->GetValue<ImageDepth32F>(), camera_info_, &X_PC_float,
+            skip_invalid_, cloud);
+  } else {
+    Convert(depth_image->GetValue<ImageDepth32F>(), camera_info_, nullptr,
+            skip_invalid_, cloud);
+  }
+}
+
+void DepthImageToPointCloud::Convert(const ImageDepth32F& depth_image,
+                                     const CameraInfo& camera_info,
+                                     const Isometry3f* X_PC,
+                                     bool skip_invalid, PointCloud* cloud) {
+  DRAKE_DEMAND(cloud != nullptr);
+  DRAKE_DEMAND(depth_image.width() == camera_info.width());
+  DRAKE_DEMAND(depth_image.height() == camera_info.height());
+  cloud->RequireFields(pc_flags::kXYZs);
+
+  const int width = depth_image.width();
+  const int height = depth_image.height();
+  const Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic,
+                                       Eigen::RowMajor>>
+      depths(depth_image.at(0, 0), height, width);
+
+  // The x coordinate of a point is its depth times a factor that only depends
+  // on its column, and likewise for y and rows.
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const ArrayXf x_factors =
+      (ArrayXf::LinSpaced(width, 0.f, width - 1.f) - cx) * fx_inv;
+
+  int num_points = width * height;
+  if (skip_invalid) {
+    num_points =
+        ((depths.array() > kTooClose) && (depths.array() < kTooFar)).count();
+  }
+  if (cloud->size() != num_points) cloud->resize(num_points);
+  Eigen::Ref<Matrix3X<float>> xyzs = cloud->mutable_xyzs();
+
+  ArrayXf z(width);
+  ArrayXf x(width);
+  ArrayXf y(width);
+  int point = 0;
+  for (int v = 0; v < height; ++v) {
+    z = depths.row(v).transpose().array();
+    const float y_factor = (v - cy) * fy_inv;
+    x = z * x_factors;
+    y = z * y_factor;
+    if (skip_invalid) {
+      for (int u = 0; u < width; ++u) {
+        if (z[u] > kTooClose && z[u] < kTooFar) {
+          xyzs(0, point) = x[u];
+          xyzs(1, point) = y[u];
+          xyzs(2, point) = z[u];
+          ++point;
+        }
+      }
+    } else {
+      const auto valid = (z > kTooClose) && (z < kTooFar);
+      constexpr float kNaN = PointCloud::kDefaultValue;
+      float* const column = xyzs.col(point).data();
+      const Eigen::InnerStride<> stride(xyzs.outerStride());
+      RowMap(column + 0, width, stride) = valid.select(x, kNaN);
+      RowMap(column + 1, width, stride) = valid.select(y, kNaN);
+      RowMap(column + 2, width, stride) = valid.select(z, kNaN);
+      point += width;
+    }
+  }
+  DRAKE_DEMAND(point == num_points);
+
+  if (X_PC != nullptr) {
+    xyzs = (X_PC->linear() * xyzs).colwise() + X_PC->translation();
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
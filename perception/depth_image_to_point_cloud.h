@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+
+/// Converts a depth image from a pinhole camera, such as the depth output of
+/// systems::sensors::RgbdCamera, to a PointCloud.
+///
+/// Pixel `(u, v)` with depth `z` becomes the point
+/// `(z (u - center_x) / focal_x, z (v - center_y) / focal_y, z)` in the
+/// camera frame `C`, where the intrinsics are those of the
+/// systems::sensors::CameraInfo. It is stored at index `v * width + u` of
+/// the cloud, unless invalid pixels are skipped, in which case the valid
+/// points are stored contiguously in the same order. A depth is invalid if it
+/// is not strictly between systems::sensors::InvalidDepth::kTooClose and
+/// systems::sensors::InvalidDepth::kTooFar (e.g., NaN); when invalid pixels
+/// are not skipped, their points are PointCloud::kDefaultValue.
+///
+/// The points are optionally transformed to another frame `P` by `X_PC`.
+///
+/// This system has two input ports:
+///  - The depth image, as an abstract-valued systems::sensors::ImageDepth32F.
+///  - The optional pose `X_PC` of the camera in the frame of the output, as a
+///    systems::rendering::PoseVector. If it is not connected, the points are
+///    expressed in the camera frame.
+///
+/// and one output port, with the abstract-valued PointCloud. The output
+/// cloud is reused from one calculation to the next, so that its storage is
+/// only reallocated when its number of points changes.
+///
+/// @ingroup sensor_systems
+class DepthImageToPointCloud final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DepthImageToPointCloud)
+
+  /// A %DepthImageToPointCloud constructor.
+  ///
+  /// @param camera_info The intrinsics of the camera that produced the depth
+  /// images. They are copied.
+  /// @param skip_invalid If true, invalid pixels are left out of the output
+  /// cloud; otherwise the output cloud has one point per pixel.
+  explicit DepthImageToPointCloud(
+      const systems::sensors::CameraInfo& camera_info,
+      bool skip_invalid = true);
+
+  /// Returns the abstract-valued input port with the depth image.
+  const systems::InputPortDescriptor<double>& get_depth_image_input_port()
+      const;
+
+  /// Returns the vector-valued input port with the optional `X_PC`.
+  const systems::InputPortDescriptor<double>& get_camera_pose_input_port()
+      const;
+
+  /// Returns the abstract-valued output port with the PointCloud.
+  const systems::OutputPort<double>& get_point_cloud_output_port() const;
+
+  /// Converts @p depth_image to points in @p cloud, as described in the class
+  /// documentation. @p cloud is only resized if its size is not the required
+  /// number of points.
+  ///
+  /// @param depth_image The depth image, whose size must match
+  /// @p camera_info.
+  /// @param camera_info The intrinsics of the camera.
+  /// @param X_PC The pose of the camera in the frame of the points, or
+  /// nullptr to express the points in the camera frame.
+  /// @param skip_invalid Whether to leave the invalid pixels out.
+  /// @param cloud The output cloud, which must have XYZs.
+  /// @throws std::runtime_error if @p cloud has no XYZs.
+  static void Convert(const systems::sensors::ImageDepth32F& depth_image,
+                      const systems::sensors::CameraInfo& camera_info,
+                      const Eigen::Isometry3f* X_PC, bool skip_invalid,
+                      PointCloud* cloud);
+
+ private:
+  void CalcPointCloud(const systems::Context<double>& context,
+                      PointCloud* cloud) const;
+
+  const systems::sensors::CameraInfo camera_info_;
+  const bool skip_invalid_;
+  int depth_image_input_port_index_{};
+  int camera_pose_input_port_index_{};
+  int point_cloud_output_port_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
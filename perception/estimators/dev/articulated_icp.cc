@@ -1,5 +1,9 @@
 #include "drake/perception/estimators/dev/articulated_icp.h"
 
+#include <algorithm>
+
+#include "drake/common/parallel_for.h"
+
 using std::vector;
 using Eigen::VectorXd;
 using Eigen::MatrixXd;
@@ -9,6 +13,21 @@ namespace drake {
 namespace perception {
 namespace estimators {
 
+namespace {
+
+// The maximum number of points whose errors and Jacobians are formed at once.
+const int kMaxBlockSize = 256;
+
+// A contiguous range of the correspondences of one body.
+struct CorrespondenceBlock {
+  BodyIndex body_index{};
+  const vector<PointCorrespondence>* correspondences{};
+  int start{};
+  int size{};
+};
+
+}  // namespace
+
 ArticulatedBodyInfluence IsBodyCorrespondenceInfluential(const Scene& scene,
                                                          BodyIndex) {
   ArticulatedBodyInfluence out;
@@ -84,14 +103,13 @@ void ArticulatedIcpErrorNormCost::Reset() {
 
 void ArticulatedIcpErrorNormCost::Add(const SceneState&,
                                       const ArticulatedIcpErrorSet& error_set) {
-  // Get error squared.
-  for (int i = 0; i < error_set.size(); ++i) {
-    auto&& e = error_set.error(i);
-    auto&& Je = error_set.J_error(i);
-    cost_ += e.dot(e);
-    J_cost_ += 2 * e.transpose() * Je;
-    ++num_points_;
-  }
+  // Get error squared, with the errors stacked as one (3 * size()) vector.
+  const int num_points = error_set.size();
+  const Eigen::Map<const VectorXd> e(error_set.errors().data(),
+                                     3 * num_points);
+  cost_ += e.squaredNorm();
+  J_cost_.noalias() += 2 * e.transpose() * error_set.J_errors();
+  num_points_ += num_points;
 }
 
 void ArticulatedIcpErrorNormCost::Finalize() {
@@ -114,16 +132,18 @@ void ArticulatedIcpLinearizedNormCost::Add(
     const SceneState& scene_state, const ArticulatedIcpErrorSet& error_set) {
   DRAKE_ASSERT(!finalized_);
   const VectorXd& q0 = scene_state.q();
-  for (int i = 0; i < error_set.size(); ++i) {
-    auto&& e = error_set.error(i);
-    auto&& Je = error_set.J_error(i);
-    Eigen::Vector3d k = e - Je * q0;
-    Q_ += 2 * Je.transpose() * Je;
-    b_ += 2 * Je.transpose() * k;
-    c_ += k.dot(k);
-    cost_ += e.dot(e);
-    num_points_ += 1;
-  }
+  // Accumulate the normal equations of all points at once, with the errors
+  // stacked as one (3 * size()) vector.
+  const int num_points = error_set.size();
+  const Eigen::Map<const VectorXd> e(error_set.errors().data(),
+                                     3 * num_points);
+  const MatrixXd& J = error_set.J_errors();
+  const VectorXd k = e - J * q0;
+  Q_.noalias() += 2 * J.transpose() * J;
+  b_.noalias() += 2 * J.transpose() * k;
+  c_ += k.squaredNorm();
+  cost_ += e.squaredNorm();
+  num_points_ += num_points;
 }
 
 void ArticulatedIcpLinearizedNormCost::UpdateCost(
@@ -183,20 +203,40 @@ void ComputeCorrespondences(const SceneState& scene_state,
 
 void ComputeCost(const SceneState& scene_state,
                  const ArticulatedPointCorrespondences& correspondence,
-                 ArticulatedIcpErrorCost* cost) {
-  cost->Reset();
-  ArticulatedIcpErrorSet error_set(
-      scene_state.scene().tree().get_num_positions());
+                 ArticulatedIcpErrorCost* cost, int num_threads) {
+  DRAKE_DEMAND(cost != nullptr);
+  DRAKE_DEMAND(num_threads >= 1);
+  vector<CorrespondenceBlock> blocks;
   for (const auto& pair : correspondence) {
-    const BodyIndex body_index = pair.first;
-    const vector<PointCorrespondence>& body_correspondence = pair.second;
-    ArticulatedIcpBodyPoints body_pts(body_index, body_correspondence.size());
-    for (const auto& pc_W : body_correspondence) {
-      body_pts.Add(pc_W.meas_point, pc_W.model_point);
+    const int num_points = pair.second.size();
+    for (int start = 0; start < num_points; start += kMaxBlockSize) {
+      blocks.push_back({pair.first, &pair.second, start,
+                        std::min(kMaxBlockSize, num_points - start)});
+    }
+  }
+
+  cost->Reset();
+  // Up to `num_threads` blocks are formed at once, and then added in order.
+  const int num_blocks = blocks.size();
+  vector<ArticulatedIcpErrorSet> error_sets(
+      std::min(num_threads, std::max(num_blocks, 1)),
+      ArticulatedIcpErrorSet(scene_state.scene().tree().get_num_positions()));
+  const int num_slots = error_sets.size();
+  for (int first = 0; first < num_blocks; first += num_slots) {
+    const int num_formed = std::min(num_slots, num_blocks - first);
+    ParallelFor(num_formed, num_threads, [&](int slot) {
+      const CorrespondenceBlock& block = blocks[first + slot];
+      ArticulatedIcpBodyPoints body_pts(block.body_index, block.size);
+      for (int i = block.start; i < block.start + block.size; ++i) {
+        const PointCorrespondence& pc_W = (*block.correspondences)[i];
+        body_pts.Add(pc_W.meas_point, pc_W.model_point);
+      }
+      body_pts.Finalize();
+      body_pts.ComputeError(scene_state, &error_sets[slot]);
+    });
+    for (int slot = 0; slot < num_formed; ++slot) {
+      cost->Add(scene_state, error_sets[slot]);
     }
-    body_pts.Finalize();
-    body_pts.ComputeError(scene_state, &error_set);
-    cost->Add(scene_state, error_set);
   }
   cost->Finalize();
 }
@@ -41,6 +41,10 @@ class ArticulatedIcpErrorSet {
   }
   Eigen::Ref<Eigen::Matrix3Xd> errors() { return errors_; }
   Eigen::Ref<Eigen::MatrixXd> J_errors() { return J_errors_; }
+  /** All errors, one per column. */
+  const Eigen::Matrix3Xd& errors() const { return errors_; }
+  /** All Jacobians, stacked as (3 * size()) x num_var. */
+  const Eigen::MatrixXd& J_errors() const { return J_errors_; }
 
  private:
   Eigen::Matrix3Xd errors_;
@@ -295,6 +299,8 @@ void ComputeBodyCorrespondenceInfluences(const Scene& scene,
 /**
  * Compute point-to-point correspondences from a measured point cloud and a
  * given scene.
+ * The points are queried on up to the number of threads set by
+ * RigidBodyTree::set_num_collision_threads().
  */
 void ComputeCorrespondences(const SceneState& scene_state,
                             const ArticulatedBodyInfluences& influences,
@@ -303,10 +309,15 @@ void ComputeCorrespondences(const SceneState& scene_state,
 
 /**
  * Compute cost for a given set of correspondences.
+ * The errors and their Jacobians are formed in blocks of a bounded number of
+ * points, and each block is added to `cost` before it is discarded, so the
+ * memory used does not grow with the size of the point cloud.
+ * @param num_threads Maximum number of threads used to form the blocks. The
+ * blocks are added to `cost` in the same order regardless.
  */
 void ComputeCost(const SceneState& scene_state,
                  const ArticulatedPointCorrespondences& correspondence,
-                 ArticulatedIcpErrorCost* cost);
+                 ArticulatedIcpErrorCost* cost, int num_threads = 1);
 
 }  // namespace estimators
 }  // namespace perception
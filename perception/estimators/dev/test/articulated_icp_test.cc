@@ -204,6 +204,11 @@ TEST_P(ArticulatedIcpTest, PositiveReturnsIncreasingCost) {
     ArticulatedIcpLinearizedNormCost lin_cost(scene_.get());
     ComputeCost(scene_state, correspondence, &lin_cost);
     EXPECT_EQ(cost.cost(), lin_cost.cost());
+    // Ensure that the blocks are added in the same order with more threads.
+    ArticulatedIcpErrorNormCost threaded_cost(scene_.get());
+    ComputeCost(scene_state, correspondence, &threaded_cost, 3);
+    EXPECT_EQ(cost.cost(), threaded_cost.cost());
+    EXPECT_EQ(cost.J_cost(), threaded_cost.J_cost());
 
     // Translate the object 10cm along the x-axis after each iteration.
     q(0) += 0.1;
@@ -0,0 +1,255 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+
+namespace {
+
+// The maximum number of points in a leaf.
+constexpr int kLeafSize = 8;
+
+// The number of queries per task of the batched queries.
+constexpr int kQueriesPerTask = 64;
+
+}  // namespace
+
+PointCloudKdTree::PointCloudKdTree(
+    const Eigen::Ref<const Matrix3X<float>>& xyzs) {
+  Init(xyzs);
+}
+
+PointCloudKdTree::PointCloudKdTree(const PointCloud& cloud) {
+  cloud.RequireFields(pc_flags::kXYZs);
+  Init(cloud.xyzs());
+}
+
+void PointCloudKdTree::Init(const Eigen::Ref<const Matrix3X<float>>& xyzs) {
+  std::vector<int> finite_indices;
+  finite_indices.reserve(xyzs.cols());
+  for (int i = 0; i < xyzs.cols(); ++i) {
+    if (xyzs.col(i).allFinite()) finite_indices.push_back(i);
+  }
+  const int num_finite = static_cast<int>(finite_indices.size());
+  Matrix3X<float> finite_points(3, num_finite);
+  for (int i = 0; i < num_finite; ++i) {
+    finite_points.col(i) = xyzs.col(finite_indices[i]);
+  }
+
+  std::vector<int> order(num_finite);
+  std::iota(order.begin(), order.end(), 0);
+  nodes_.reserve(2 * (num_finite / kLeafSize + 1));
+  if (num_finite > 0) Build(finite_points, &order, 0, num_finite);
+
+  points_.resize(3, num_finite);
+  original_indices_.resize(num_finite);
+  for (int i = 0; i < num_finite; ++i) {
+    points_.col(i) = finite_points.col(order[i]);
+    original_indices_[i] = finite_indices[order[i]];
+  }
+}
+
+int PointCloudKdTree::Build(const Matrix3X<float>& points,
+                            std::vector<int>* order, int begin, int end) {
+  const int node_index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_[node_index].begin = begin;
+  nodes_[node_index].end = end;
+  if (end - begin <= kLeafSize) return node_index;
+
+  Vector3f lower = points.col((*order)[begin]);
+  Vector3f upper = lower;
+  for (int i = begin + 1; i < end; ++i) {
+    lower = lower.cwiseMin(points.col((*order)[i]));
+    upper = upper.cwiseMax(points.col((*order)[i]));
+  }
+  int axis{};
+  if ((upper - lower).maxCoeff(&axis) == 0) {
+    // The points coincide, so there is nothing to split.
+    return node_index;
+  }
+
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(order->begin() + begin, order->begin() + middle,
+                   order->begin() + end, [&points, axis](int a, int b) {
+                     return points(axis, a) < points(axis, b);
+                   });
+  nodes_[node_index].axis = axis;
+  nodes_[node_index].split = points(axis, (*order)[middle]);
+  Build(points, order, begin, middle);
+  const int second_child = Build(points, order, middle, end);
+  nodes_[node_index].second_child = second_child;
+  return node_index;
+}
+
+void PointCloudKdTree::SearchNearest(int node_index, const Vector3f& query,
+                                     int k,
+                                     std::vector<Neighbor>* heap) const {
+  const Node& node = nodes_[node_index];
+  if (node.axis < 0) {
+    for (int i = node.begin; i < node.end; ++i) {
+      const float squared_distance = (points_.col(i) - query).squaredNorm();
+      if (static_cast<int>(heap->size()) < k) {
+        heap->emplace_back(squared_distance, i);
+        std::push_heap(heap->begin(), heap->end());
+      } else if (squared_distance < heap->front().first) {
+        std::pop_heap(heap->begin(), heap->end());
+        heap->back() = Neighbor(squared_distance, i);
+        std::push_heap(heap->begin(), heap->end());
+      }
+    }
+    return;
+  }
+
+  // Descends into the side of the query first, then into the other side if
+  // it may hold a closer point than the current k-th nearest.
+  const float offset = query[node.axis] - node.split;
+  const int near_child = offset <= 0 ? node_index + 1 : node.second_child;
+  const int far_child = offset <= 0 ? node.second_child : node_index + 1;
+  SearchNearest(near_child, query, k, heap);
+  if (static_cast<int>(heap->size()) < k ||
+      offset * offset < heap->front().first) {
+    SearchNearest(far_child, query, k, heap);
+  }
+}
+
+void PointCloudKdTree::SearchRadius(int node_index, const Vector3f& query,
+                                    float squared_radius,
+                                    std::vector<Neighbor>* neighbors) const {
+  const Node& node = nodes_[node_index];
+  if (node.axis < 0) {
+    for (int i = node.begin; i < node.end; ++i) {
+      const float squared_distance = (points_.col(i) - query).squaredNorm();
+      if (squared_distance <= squared_radius) {
+        neighbors->emplace_back(squared_distance, i);
+      }
+    }
+    return;
+  }
+
+  const float offset = query[node.axis] - node.split;
+  if (offset <= 0 || offset * offset <= squared_radius) {
+    SearchRadius(node_index + 1, query, squared_radius, neighbors);
+  }
+  if (offset >= 0 || offset * offset <= squared_radius) {
+    SearchRadius(node.second_child, query, squared_radius, neighbors);
+  }
+}
+
+void PointCloudKdTree::FindNearestImpl(
+    const Vector3f& query, int k, std::vector<Neighbor>* neighbors) const {
+  DRAKE_DEMAND(k > 0);
+  neighbors->clear();
+  if (nodes_.empty()) return;
+  SearchNearest(0, query, k, neighbors);
+  std::sort_heap(neighbors->begin(), neighbors->end());
+}
+
+void PointCloudKdTree::FindWithinRadiusImpl(
+    const Vector3f& query, float radius,
+    std::vector<Neighbor>* neighbors) const {
+  DRAKE_DEMAND(radius >= 0);
+  neighbors->clear();
+  if (nodes_.empty()) return;
+  SearchRadius(0, query, radius * radius, neighbors);
+  std::sort(neighbors->begin(), neighbors->end());
+}
+
+void PointCloudKdTree::FindNearest(
+    const Vector3f& query, int k, std::vector<int>* indices,
+    std::vector<float>* squared_distances) const {
+  DRAKE_DEMAND(indices != nullptr);
+  std::vector<Neighbor> neighbors;
+  FindNearestImpl(query, k, &neighbors);
+  indices->resize(neighbors.size());
+  if (squared_distances != nullptr) {
+    squared_distances->resize(neighbors.size());
+  }
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    (*indices)[i] = original_indices_[neighbors[i].second];
+    if (squared_distances != nullptr) {
+      (*squared_distances)[i] = neighbors[i].first;
+    }
+  }
+}
+
+void PointCloudKdTree::FindWithinRadius(
+    const Vector3f& query, float radius, std::vector<int>* indices,
+    std::vector<float>* squared_distances) const {
+  DRAKE_DEMAND(indices != nullptr);
+  std::vector<Neighbor> neighbors;
+  FindWithinRadiusImpl(query, radius, &neighbors);
+  indices->resize(neighbors.size());
+  if (squared_distances != nullptr) {
+    squared_distances->resize(neighbors.size());
+  }
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    (*indices)[i] = original_indices_[neighbors[i].second];
+    if (squared_distances != nullptr) {
+      (*squared_distances)[i] = neighbors[i].first;
+    }
+  }
+}
+
+void PointCloudKdTree::FindNearest(
+    const Eigen::Ref<const Matrix3X<float>>& queries, int k,
+    Eigen::MatrixXi* indices, Eigen::MatrixXf* squared_distances,
+    int num_threads) const {
+  DRAKE_DEMAND(k > 0);
+  DRAKE_DEMAND(indices != nullptr);
+  const int num_queries = static_cast<int>(queries.cols());
+  indices->setConstant(k, num_queries, -1);
+  if (squared_distances != nullptr) {
+    squared_distances->setConstant(k, num_queries,
+                                   std::numeric_limits<float>::infinity());
+  }
+
+  const int num_tasks = (num_queries + kQueriesPerTask - 1) / kQueriesPerTask;
+  ParallelFor(num_tasks, num_threads, [&](int task) {
+    std::vector<Neighbor> neighbors;
+    neighbors.reserve(k);
+    const int end = std::min(num_queries, (task + 1) * kQueriesPerTask);
+    for (int j = task * kQueriesPerTask; j < end; ++j) {
+      FindNearestImpl(queries.col(j), k, &neighbors);
+      for (size_t i = 0; i < neighbors.size(); ++i) {
+        (*indices)(i, j) = original_indices_[neighbors[i].second];
+        if (squared_distances != nullptr) {
+          (*squared_distances)(i, j) = neighbors[i].first;
+        }
+      }
+    }
+  });
+}
+
+void PointCloudKdTree::FindWithinRadius(
+    const Eigen::Ref<const Matrix3X<float>>& queries, float radius,
+    std::vector<std::vector<int>>* indices,
+    std::vector<std::vector<float>>* squared_distances,
+    int num_threads) const {
+  DRAKE_DEMAND(indices != nullptr);
+  const int num_queries = static_cast<int>(queries.cols());
+  indices->resize(num_queries);
+  if (squared_distances != nullptr) squared_distances->resize(num_queries);
+
+  const int num_tasks = (num_queries + kQueriesPerTask - 1) / kQueriesPerTask;
+  ParallelFor(num_tasks, num_threads, [&](int task) {
+    const int end = std::min(num_queries, (task + 1) * kQueriesPerTask);
+    for (int j = task * kQueriesPerTask; j < end; ++j) {
+      FindWithinRadius(queries.col(j), radius, &(*indices)[j],
+                       squared_distances != nullptr ?
+                           &(*squared_distances)[j] : nullptr);
+    }
+  });
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// A KD-tree over the XYZs of a PointCloud, for nearest-neighbor and radius
+/// queries.
+///
+/// The tree keeps its own copy of the points, reordered so that the points of
+/// each leaf are contiguous, so it stays valid if the cloud it was built from
+/// changes or is destroyed. Points with a non-finite coordinate are left out.
+/// Every query reports points by their index in the original cloud.
+///
+/// Each node splits its points at the median along the axis on which they
+/// have the largest extent, until at most a few points remain; building the
+/// tree takes O(n log n) time. Queries are const and may be run concurrently;
+/// the batched overloads spread their queries over several threads.
+class PointCloudKdTree {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudKdTree)
+
+  /// Builds a tree over the columns of @p xyzs.
+  explicit PointCloudKdTree(const Eigen::Ref<const Matrix3X<float>>& xyzs);
+
+  /// Builds a tree over the XYZs of @p cloud.
+  /// @throws std::runtime_error if @p cloud has no XYZs.
+  explicit PointCloudKdTree(const PointCloud& cloud);
+
+  /// Returns the number of points in the tree, which excludes the non-finite
+  /// points.
+  int num_points() const { return static_cast<int>(points_.cols()); }
+
+  /// Finds the (at most) @p k points nearest to @p query, by increasing
+  /// distance.
+  ///
+  /// @param query The query point.
+  /// @param k The number of neighbors to find; must be positive.
+  /// @param indices The indices of the neighbors in the original cloud.
+  /// @param squared_distances The squared distances from @p query to the
+  /// neighbors. May be nullptr.
+  void FindNearest(const Eigen::Vector3f& query, int k,
+                   std::vector<int>* indices,
+                   std::vector<float>* squared_distances) const;
+
+  /// Finds the points within @p radius of @p query (inclusive), by increasing
+  /// distance. The arguments are as for FindNearest(), with @p radius
+  /// non-negative.
+  void FindWithinRadius(const Eigen::Vector3f& query, float radius,
+                        std::vector<int>* indices,
+                        std::vector<float>* squared_distances) const;
+
+  /// Finds the @p k points nearest to each column of @p queries.
+  ///
+  /// @param queries The query points.
+  /// @param k The number of neighbors to find; must be positive.
+  /// @param indices A `k x queries.cols()` matrix whose column `j` holds the
+  /// indices in the original cloud of the neighbors of query `j`, by
+  /// increasing distance. If the tree has fewer than @p k points, the
+  /// missing entries are -1.
+  /// @param squared_distances The matching squared distances, with infinity
+  /// for the missing entries. May be nullptr.
+  /// @param num_threads The maximum number of threads to use; must be
+  /// positive.
+  void FindNearest(const Eigen::Ref<const Matrix3X<float>>& queries, int k,
+                   Eigen::MatrixXi* indices,
+                   Eigen::MatrixXf* squared_distances,
+                   int num_threads = 1) const;
+
+  /// Finds the points within @p radius of each column of @p queries. Entry
+  /// `j` of @p indices and @p squared_distances holds the result of the
+  /// single-query FindWithinRadius() for query `j`. @p squared_distances may
+  /// be nullptr. @p num_threads is as for the batched FindNearest().
+  void FindWithinRadius(const Eigen::Ref<const Matrix3X<float>>& queries,
+                        float radius, std::vector<std::vector<int>>* indices,
+                        std::vector<std::vector<float>>* squared_distances,
+                        int num_threads = 1) const;
+
+ private:
+  // A node of the tree. The nodes are stored in depth-first order, so the
+  // first child of an internal node immediately follows it.
+  struct Node {
+    // The range of the node's points in points_.
+    int begin{};
+    int end{};
+    // The splitting axis, or -1 for a leaf.
+    int axis{-1};
+    // The points of the first child have coordinates at most split along
+    // axis, and those of the second child at least split.
+    float split{};
+    int second_child{};
+  };
+
+  // A (squared distance, position in points_) pair.
+  using Neighbor = std::pair<float, int>;
+
+  // Builds the subtree over order[begin, end), which are columns of points,
+  // reordering them, and returns the subtree's root.
+  int Build(const Matrix3X<float>& points, std::vector<int>* order, int begin,
+            int end);
+  void Init(const Eigen::Ref<const Matrix3X<float>>& xyzs);
+  void SearchNearest(int node_index, const Eigen::Vector3f& query, int k,
+                     std::vector<Neighbor>* heap) const;
+  void SearchRadius(int node_index, const Eigen::Vector3f& query,
+                    float squared_radius,
+                    std::vector<Neighbor>* neighbors) const;
+  void FindNearestImpl(const Eigen::Vector3f& query, int k,
+                       std::vector<Neighbor>* neighbors) const;
+  void FindWithinRadiusImpl(const Eigen::Vector3f& query, float radius,
+                            std::vector<Neighbor>* neighbors) const;
+
+  Matrix3X<float> points_;
+  // The index in the original cloud of each column of points_.
+  std::vector<int> original_indices_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace perception
+}  // namespace drake
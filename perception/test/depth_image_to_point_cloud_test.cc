@@ -0,0 +1,116 @@
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/rendering/pose_vector.h"
+
+using Eigen::Isometry3f;
+using Eigen::Matrix3Xf;
+using Eigen::Vector3f;
+
+using drake::systems::sensors::CameraInfo;
+using drake::systems::sensors::ImageDepth32F;
+using drake::systems::sensors::InvalidDepth;
+
+namespace drake {
+namespace perception {
+namespace {
+
+constexpr int kWidth = 3;
+constexpr int kHeight = 2;
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+class DepthImageToPointCloudTest : public ::testing::Test {
+ protected:
+  DepthImageToPointCloudTest()
+      : camera_info_(kWidth, kHeight, 2, 4, 1, 0.5),
+        depth_image_(kWidth, kHeight) {
+    // One of each kind of invalid depth, in the middle of the image.
+    const float depths[kHeight][kWidth] = {
+        {1, InvalidDepth::kTooClose, 2}, {3, InvalidDepth::kTooFar, kNaN}};
+    for (int v = 0; v < kHeight; ++v) {
+      for (int u = 0; u < kWidth; ++u) {
+        *depth_image_.at(u, v) = depths[v][u];
+      }
+    }
+  }
+
+  // Returns the point of the valid pixel (u, v) in the camera frame.
+  Vector3f Point(int u, int v) const {
+    const float z = *depth_image_.at(u, v);
+    return Vector3f(z * (u - 1) / 2, z * (v - 0.5f) / 4, z);
+  }
+
+  const CameraInfo camera_info_;
+  ImageDepth32F depth_image_;
+};
+
+TEST_F(DepthImageToPointCloudTest, ConvertAll) {
+  PointCloud cloud(0);
+  DepthImageToPointCloud::Convert(depth_image_, camera_info_, nullptr, false,
+                                  &cloud);
+  ASSERT_EQ(cloud.size(), kWidth * kHeight);
+  EXPECT_TRUE(CompareMatrices(cloud.xyz(0), Point(0, 0)));
+  EXPECT_TRUE(CompareMatrices(cloud.xyz(2), Point(2, 0)));
+  EXPECT_TRUE(CompareMatrices(cloud.xyz(3), Point(0, 1)));
+  for (int i : {1, 4, 5}) {
+    EXPECT_TRUE(cloud.xyz(i).array().isNaN().all());
+  }
+}
+
+TEST_F(DepthImageToPointCloudTest, SkipInvalid) {
+  Isometry3f X_PC = Isometry3f::Identity();
+  X_PC.linear() = Eigen::AngleAxisf(0.5, Vector3f(1, 2, 3).normalized())
+                      .toRotationMatrix();
+  X_PC.translation() = Vector3f(1, -2, 3);
+
+  // The cloud is shrunk to the valid points, which stay in order.
+  PointCloud cloud(10);
+  DepthImageToPointCloud::Convert(depth_image_, camera_info_, &X_PC, true,
+                                  &cloud);
+  Matrix3Xf expected(3, 3);
+  expected << Point(0, 0), Point(2, 0), Point(0, 1);
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), X_PC * expected, 1e-6));
+}
+
+TEST_F(DepthImageToPointCloudTest, MissingXyzs) {
+  PointCloud cloud(0, pc_flags::DescriptorType(1, "foo"));
+  EXPECT_THROW(DepthImageToPointCloud::Convert(depth_image_, camera_info_,
+                                               nullptr, true, &cloud),
+               std::runtime_error);
+}
+
+TEST_F(DepthImageToPointCloudTest, System) {
+  const DepthImageToPointCloud dut(camera_info_);
+  auto context = dut.CreateDefaultContext();
+  auto output = dut.get_point_cloud_output_port().Allocate(*context);
+  context->FixInputPort(
+      dut.get_depth_image_input_port().get_index(),
+      std::make_unique<systems::Value<ImageDepth32F>>(depth_image_));
+
+  // Without a camera pose, the points are in the camera frame.
+  dut.get_point_cloud_output_port().Calc(*context, output.get());
+  Matrix3Xf expected(3, 3);
+  expected << Point(0, 0), Point(2, 0), Point(0, 1);
+  EXPECT_TRUE(CompareMatrices(output->GetValue<PointCloud>().xyzs(),
+                              expected));
+
+  auto X_PC = std::make_unique<systems::rendering::PoseVector<double>>();
+  X_PC->set_translation(Eigen::Translation3d(1, 2, 3));
+  context->FixInputPort(dut.get_camera_pose_input_port().get_index(),
+                        std::move(X_PC));
+  dut.get_point_cloud_output_port().Calc(*context, output.get());
+  expected.colwise() += Vector3f(1, 2, 3);
+  EXPECT_TRUE(CompareMatrices(output->GetValue<PointCloud>().xyzs(),
+                              expected, 1e-6));
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
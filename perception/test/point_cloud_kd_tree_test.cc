@@ -0,0 +1,113 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Eigen::Matrix3Xf;
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Returns the indices of the columns of points by increasing distance from
+// query, by brute force, skipping the non-finite columns.
+std::vector<int> SortByDistance(const Matrix3Xf& points,
+                                const Vector3f& query) {
+  std::vector<int> order;
+  for (int i = 0; i < points.cols(); ++i) {
+    if (points.col(i).allFinite()) order.push_back(i);
+  }
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return (points.col(a) - query).squaredNorm() <
+           (points.col(b) - query).squaredNorm();
+  });
+  return order;
+}
+
+class PointCloudKdTreeTest : public ::testing::Test {
+ protected:
+  PointCloudKdTreeTest()
+      : points_(Matrix3Xf::Random(3, 500)),
+        queries_(Matrix3Xf::Random(3, 100)) {
+    points_.col(7).setConstant(std::numeric_limits<float>::quiet_NaN());
+  }
+
+  Matrix3Xf points_;
+  Matrix3Xf queries_;
+};
+
+TEST_F(PointCloudKdTreeTest, FindNearest) {
+  const PointCloudKdTree dut(points_);
+  EXPECT_EQ(dut.num_points(), 499);
+
+  constexpr int kK = 5;
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  dut.FindNearest(queries_, kK, &indices, &squared_distances, 4);
+  ASSERT_EQ(indices.rows(), kK);
+  ASSERT_EQ(indices.cols(), queries_.cols());
+  for (int j = 0; j < queries_.cols(); ++j) {
+    const std::vector<int> expected = SortByDistance(points_, queries_.col(j));
+    std::vector<int> single_indices;
+    std::vector<float> single_squared_distances;
+    dut.FindNearest(queries_.col(j), kK, &single_indices,
+                    &single_squared_distances);
+    for (int i = 0; i < kK; ++i) {
+      EXPECT_EQ(indices(i, j), expected[i]);
+      EXPECT_EQ(single_indices[i], expected[i]);
+      EXPECT_FLOAT_EQ(squared_distances(i, j),
+                      (points_.col(expected[i]) - queries_.col(j))
+                          .squaredNorm());
+      EXPECT_EQ(single_squared_distances[i], squared_distances(i, j));
+    }
+  }
+}
+
+TEST_F(PointCloudKdTreeTest, FindWithinRadius) {
+  PointCloud cloud(points_.cols());
+  cloud.mutable_xyzs() = points_;
+  const PointCloudKdTree dut(cloud);
+
+  constexpr float kRadius = 0.2;
+  std::vector<std::vector<int>> indices;
+  std::vector<std::vector<float>> squared_distances;
+  dut.FindWithinRadius(queries_, kRadius, &indices, &squared_distances, 3);
+  ASSERT_EQ(indices.size(), queries_.cols());
+  for (int j = 0; j < queries_.cols(); ++j) {
+    std::vector<int> expected = SortByDistance(points_, queries_.col(j));
+    expected.erase(
+        std::find_if(expected.begin(), expected.end(), [&](int i) {
+          return (points_.col(i) - queries_.col(j)).squaredNorm() >
+                 kRadius * kRadius;
+        }),
+        expected.end());
+    EXPECT_EQ(indices[j], expected);
+    ASSERT_EQ(squared_distances[j].size(), expected.size());
+    EXPECT_TRUE(std::is_sorted(squared_distances[j].begin(),
+                               squared_distances[j].end()));
+  }
+}
+
+GTEST_TEST(PointCloudKdTreeSmallTest, FewerPointsThanNeighbors) {
+  Matrix3Xf points(3, 2);
+  points << 0, 1, 0, 0, 0, 0;
+  const PointCloudKdTree dut(points);
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  dut.FindNearest(Vector3f(0.9, 0, 0), 3, &indices, &squared_distances);
+  EXPECT_EQ(indices, Eigen::Vector3i(1, 0, -1));
+  EXPECT_EQ(squared_distances(2, 0), std::numeric_limits<float>::infinity());
+
+  const PointCloudKdTree empty(Matrix3Xf(3, 0));
+  std::vector<int> single_indices{1, 2};
+  empty.FindNearest(Vector3f::Zero(), 1, &single_indices, nullptr);
+  EXPECT_TRUE(single_indices.empty());
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
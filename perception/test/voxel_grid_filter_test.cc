@@ -0,0 +1,57 @@
+#include "drake/perception/voxel_grid_filter.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+using Eigen::Matrix3Xf;
+using Eigen::MatrixXf;
+
+namespace drake {
+namespace perception {
+namespace {
+
+GTEST_TEST(VoxelGridFilterTest, Filter) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  PointCloud input(6, pc_flags::kXYZs | pc_flags::DescriptorType(1, "foo"));
+  input.mutable_xyzs() <<
+      0.1, 0.3, -0.1, 0.5, kNaN, 0.2,
+      0.1, 0.3, -0.1, 0.5, 0.0, 0.1,
+      0.1, 0.3, -0.1, 0.5, 0.0, 0.1;
+  input.mutable_descriptors() << 1, 2, 3, 4, 5, 6;
+
+  // Points 0, 1 and 5 share a voxel, which comes first; the voxels of
+  // points 2 and 3 follow, and point 4 is dropped.
+  VoxelGridFilter dut(0.4);
+  EXPECT_EQ(dut.voxel_size(), 0.4f);
+  PointCloud output(0, input.fields());
+  dut.Filter(input, &output);
+  Matrix3Xf expected_xyzs(3, 3);
+  expected_xyzs <<
+      0.2, -0.1, 0.5,
+      1 / 6.f, -0.1, 0.5,
+      1 / 6.f, -0.1, 0.5;
+  MatrixXf expected_descriptors(1, 3);
+  expected_descriptors << 3, 3, 4;
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), expected_xyzs, 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.descriptors(), expected_descriptors,
+                              1e-6));
+
+  // The filter may be reused, and the output needs only the input's fields.
+  PointCloud xyzs_only(2);
+  xyzs_only.mutable_xyzs() << 0, 1, 0, 0, 0, 0;
+  PointCloud larger_output(0, input.fields());
+  dut.Filter(xyzs_only, &larger_output);
+  EXPECT_EQ(larger_output.size(), 2);
+  EXPECT_TRUE(CompareMatrices(larger_output.xyzs(), xyzs_only.xyzs()));
+
+  // The output must have the input's fields.
+  PointCloud too_few_fields(0);
+  EXPECT_THROW(dut.Filter(input, &too_few_fields), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
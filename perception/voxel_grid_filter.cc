@@ -0,0 +1,73 @@
+#include "drake/perception/voxel_grid_filter.h"
+
+#include <cmath>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace perception {
+
+size_t VoxelGridFilter::VoxelHash::operator()(
+    const Eigen::Vector3i& key) const {
+  // The usual spatial hash of Teschner et al., "Optimized Spatial Hashing for
+  // Collision Detection of Deformable Objects" (2003).
+  return static_cast<size_t>(
+      (static_cast<uint64_t>(key.x()) * 73856093) ^
+      (static_cast<uint64_t>(key.y()) * 19349663) ^
+      (static_cast<uint64_t>(key.z()) * 83492791));
+}
+
+VoxelGridFilter::VoxelGridFilter(float voxel_size) : voxel_size_(voxel_size) {
+  DRAKE_DEMAND(voxel_size > 0);
+}
+
+void VoxelGridFilter::Filter(const PointCloud& input, PointCloud* output) {
+  DRAKE_DEMAND(output != nullptr);
+  DRAKE_DEMAND(output != &input);
+  input.RequireFields(pc_flags::kXYZs);
+  output->RequireFields(input.fields());
+  const bool has_descriptors = input.has_descriptors();
+
+  // Assigns each point to a voxel.
+  const Eigen::Ref<const Matrix3X<float>> xyzs = input.xyzs();
+  const float inv_voxel_size = 1 / voxel_size_;
+  voxels_.clear();
+  point_voxels_.resize(input.size());
+  for (int i = 0; i < input.size(); ++i) {
+    const auto xyz = xyzs.col(i);
+    if (!xyz.allFinite()) {
+      point_voxels_[i] = -1;
+      continue;
+    }
+    const Eigen::Vector3i key =
+        (xyz * inv_voxel_size).array().floor().cast<int>();
+    const auto inserted =
+        voxels_.emplace(key, static_cast<int>(voxels_.size()));
+    point_voxels_[i] = inserted.first->second;
+  }
+
+  // Averages the points of each voxel.
+  const int num_voxels = static_cast<int>(voxels_.size());
+  output->resize(num_voxels);
+  counts_.assign(num_voxels, 0);
+  Eigen::Ref<Matrix3X<float>> out_xyzs = output->mutable_xyzs();
+  out_xyzs.setZero();
+  if (has_descriptors) output->mutable_descriptors().setZero();
+  for (int i = 0; i < input.size(); ++i) {
+    const int voxel = point_voxels_[i];
+    if (voxel < 0) continue;
+    ++counts_[voxel];
+    out_xyzs.col(voxel) += xyzs.col(i);
+    if (has_descriptors) {
+      output->mutable_descriptors().col(voxel) += input.descriptors().col(i);
+    }
+  }
+  for (int voxel = 0; voxel < num_voxels; ++voxel) {
+    const float inv_count = 1.f / counts_[voxel];
+    out_xyzs.col(voxel) *= inv_count;
+    if (has_descriptors) output->mutable_descriptors().col(voxel) *= inv_count;
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
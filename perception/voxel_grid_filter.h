@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// Downsamples a PointCloud by replacing the points in each cell of a regular
+/// grid of cubic voxels by their centroid.
+///
+/// The voxels are found by hashing the cell coordinates of each point, so
+/// filtering takes time linear in the number of points, however sparse they
+/// are. Descriptors, if any, are averaged along with the XYZs. Points with a
+/// non-finite coordinate are dropped. The output points are in the order in
+/// which their voxels are first encountered in the input.
+///
+/// A filter keeps its hash table and accumulators between calls, so that
+/// filtering a stream of clouds of similar sizes does not allocate memory.
+class VoxelGridFilter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VoxelGridFilter)
+
+  /// Constructs a filter with voxels of side @p voxel_size, which must be
+  /// positive.
+  explicit VoxelGridFilter(float voxel_size);
+
+  /// Returns the side of the voxels.
+  float voxel_size() const { return voxel_size_; }
+
+  /// Downsamples @p input into @p output, which must have at least the
+  /// fields of @p input. @p output is resized to the number of occupied
+  /// voxels, and fields that @p input lacks are left default initialized.
+  /// @throws std::runtime_error if @p input has no XYZs, or if @p output
+  /// lacks a field of @p input.
+  void Filter(const PointCloud& input, PointCloud* output);
+
+ private:
+  struct VoxelHash {
+    size_t operator()(const Eigen::Vector3i& key) const;
+  };
+
+  struct VoxelEqual {
+    bool operator()(const Eigen::Vector3i& a, const Eigen::Vector3i& b) const {
+      return a == b;
+    }
+  };
+
+  const float voxel_size_;
+  // Maps the coordinates of each occupied voxel to its output index.
+  std::unordered_map<Eigen::Vector3i, int, VoxelHash, VoxelEqual> voxels_;
+  // The output index of each input point, or -1 if it was dropped.
+  std::vector<int> point_voxels_;
+  std::vector<int> counts_;
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -9,6 +10,8 @@
 
 namespace drake {
 namespace solvers {
+class MathematicalProgram;
+
 /**
  * A binding on constraint type C is a mapping of the decision
  * variables onto the inputs of C.  This allows the constraint to operate
@@ -41,7 +44,9 @@ class Binding {
   Binding(const Binding<U>& b,
           typename std::enable_if<std::is_convertible<
               std::shared_ptr<U>, std::shared_ptr<C>>::value>::type* = nullptr)
-      : Binding(b.evaluator(), b.variables()) {}
+      : Binding(b.evaluator(), b.variables()) {
+    decision_variable_indices_ = b.decision_variable_indices();
+  }
 
   DRAKE_DEPRECATED("Please use evaluator() instead of constraint()")
   const std::shared_ptr<C>& constraint() const { return evaluator_; }
@@ -61,6 +66,18 @@ class Binding {
     return false;
   }
 
+  /**
+   * Returns the indices of variables() among the decision variables of the
+   * MathematicalProgram that this binding was added to. They are cached when
+   * the binding is added, so that solvers need no lookup per variable. Empty
+   * if the binding has not been added to a program.
+   * @see MathematicalProgram::FindDecisionVariableIndices(), which validates
+   * the cached indices against a given program.
+   */
+  const std::vector<int>& decision_variable_indices() const {
+    return decision_variable_indices_;
+  }
+
   size_t GetNumElements() const {
     // TODO(ggould-tri) assumes that no index appears more than once in the
     // view, which is nowhere asserted (but seems assumed elsewhere).
@@ -68,8 +85,11 @@ class Binding {
   }
 
  private:
+  friend class MathematicalProgram;
+
   std::shared_ptr<C> evaluator_;
   VectorXDecisionVariable vars_;
+  std::vector<int> decision_variable_indices_;
 };
 
 namespace internal {
@@ -1,12 +1,19 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
@@ -51,10 +58,10 @@ std::unique_ptr<MathematicalProgramSolverInterface> MakeSolver(
 }  // namespace
 
 MixedIntegerBranchAndBoundNode::MixedIntegerBranchAndBoundNode(
-    const MathematicalProgram& prog,
+    std::shared_ptr<const MathematicalProgram> prog,
     const std::list<symbolic::Variable>& binary_variables,
     const SolverId& solver_id)
-    : prog_{prog.Clone()},
+    : prog_{std::move(prog)},
       left_child_{nullptr},
       right_child_{nullptr},
       parent_{nullptr},
@@ -62,12 +69,11 @@ MixedIntegerBranchAndBoundNode::MixedIntegerBranchAndBoundNode(
       fixed_binary_value_{-1},
       remaining_binary_variables_{binary_variables},
       solution_result_{SolutionResult::kUnknownError},
+      optimal_cost_{std::numeric_limits<double>::quiet_NaN()},
       optimal_solution_is_integral_{OptimalSolutionIsIntegral::kUnknown},
       solver_id_{solver_id} {
   // Check if there are still binary variables.
   DRAKE_ASSERT(!MathProgHasBinaryVariables(*prog_));
-  // Set Gurobi DualReductions to 0, to differentiate infeasible from unbounded.
-  prog_->SetSolverOption(GurobiSolver::id(), "DualReductions", 0);
 }
 
 bool MixedIntegerBranchAndBoundNode::IsRoot() const {
@@ -222,12 +228,13 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   for (int i = 0; i < binary_variables.rows(); ++i) {
     binary_variables_list.push_back(binary_variables(i));
   }
+  // Set Gurobi DualReductions to 0, to differentiate infeasible from unbounded.
+  new_prog.SetSolverOption(GurobiSolver::id(), "DualReductions", 0);
+  // All the nodes share this program, and only store the binary variables they
+  // fix.
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
-      new_prog, binary_variables_list, solver_id);
-  node->solution_result_ = SolveProgramWithSolver(node->prog_.get(), solver_id);
-  if (node->solution_result_ == SolutionResult::kSolutionFound) {
-    node->CheckOptimalSolutionIsIntegral();
-  }
+      new_prog.Clone(), binary_variables_list, solver_id);
+  node->SolveProgram(nullptr);
   return std::make_pair(std::unique_ptr<MixedIntegerBranchAndBoundNode>(node),
                         map_old_vars_to_new_vars);
 }
@@ -239,7 +246,7 @@ void MixedIntegerBranchAndBoundNode::CheckOptimalSolutionIsIntegral() {
     throw std::runtime_error("The program does not have an optimal solution.");
   }
   for (const auto& var : remaining_binary_variables_) {
-    const double binary_var_val{prog_->GetSolution(var)};
+    const double binary_var_val{GetSolution(var)};
     if (std::isnan(binary_var_val)) {
       throw std::runtime_error(
           "The solution contains NAN, either the problem is not solved "
@@ -288,10 +295,9 @@ bool IsVariableInList(const std::list<symbolic::Variable>& variable_list,
 
 void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
     const symbolic::Variable& binary_variable, bool binary_value) {
-  // Add constraint y == 0 or y == 1.
-  prog_->AddBoundingBoxConstraint(static_cast<double>(binary_value),
-                                  static_cast<double>(binary_value),
-                                  binary_variable);
+  // Record the constraint y == 0 or y == 1, which is added to the program
+  // only when it is constructed.
+  fixed_binary_variables_.emplace_back(binary_variable, binary_value);
   // Remove binary_variable from remaining_binary_variables_
   bool found_binary_variable = false;
   for (auto it = remaining_binary_variables_.begin();
@@ -313,26 +319,81 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
-    const symbolic::Variable& binary_variable) {
-  left_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
-  right_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
-  left_child_->FixBinaryVariable(binary_variable, 0);
-  right_child_->FixBinaryVariable(binary_variable, 1);
-  left_child_->parent_ = this;
-  right_child_->parent_ = this;
-  left_child_->solution_result_ =
-      SolveProgramWithSolver(left_child_->prog_.get(), left_child_->solver_id_);
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      right_child_->prog_.get(), right_child_->solver_id_);
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
+std::unique_ptr<MathematicalProgram>
+MixedIntegerBranchAndBoundNode::ConstructProgram() const {
+  std::unique_ptr<MathematicalProgram> prog = prog_->Clone();
+  for (const auto& fixed_binary_variable : fixed_binary_variables_) {
+    const double value = fixed_binary_variable.second;
+    prog->AddBoundingBoxConstraint(value, value, fixed_binary_variable.first);
+  }
+  return prog;
+}
+
+void MixedIntegerBranchAndBoundNode::SolveProgram(
+    const MixedIntegerBranchAndBoundNode* parent) {
+  std::unique_ptr<MathematicalProgram> prog = ConstructProgram();
+  // Warm-start from the solution of the parent node, which satisfies all the
+  // constraints in this node except the newly fixed binary variable.
+  if (parent != nullptr &&
+      parent->solution_result_ == SolutionResult::kSolutionFound) {
+    prog->SetInitialGuessForAllVariables(parent->solution_);
+  }
+  solution_result_ = SolveProgramWithSolver(prog.get(), solver_id_);
+  optimal_cost_ = prog->GetOptimalCost();
+  solution_ = prog->GetSolution(prog->decision_variables());
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+double MixedIntegerBranchAndBoundNode::GetSolution(
+    const symbolic::Variable& var) const {
+  return solution_(prog_->FindDecisionVariableIndex(var));
+}
+
+Eigen::VectorXd MixedIntegerBranchAndBoundNode::GetSolution(
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) const {
+  Eigen::VectorXd values(vars.rows());
+  for (int i = 0; i < vars.rows(); ++i) {
+    values(i) = GetSolution(vars(i));
   }
+  return values;
+}
+
+std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+          std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+MixedIntegerBranchAndBoundNode::ConstructChildren(
+    const symbolic::Variable& binary_variable) const {
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> left_child(
+      new MixedIntegerBranchAndBoundNode(prog_, remaining_binary_variables_,
+                                         solver_id_));
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> right_child(
+      new MixedIntegerBranchAndBoundNode(prog_, remaining_binary_variables_,
+                                         solver_id_));
+  for (MixedIntegerBranchAndBoundNode* child :
+       {left_child.get(), right_child.get()}) {
+    child->fixed_binary_variables_ = fixed_binary_variables_;
+  }
+  left_child->FixBinaryVariable(binary_variable, 0);
+  right_child->FixBinaryVariable(binary_variable, 1);
+  left_child->SolveProgram(this);
+  right_child->SolveProgram(this);
+  return std::make_pair(std::move(left_child), std::move(right_child));
+}
+
+void MixedIntegerBranchAndBoundNode::AttachChildren(
+    std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+              std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+        children) {
+  left_child_ = std::move(children.first);
+  right_child_ = std::move(children.second);
+  left_child_->parent_ = this;
+  right_child_->parent_ = this;
+}
+
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  AttachChildren(ConstructChildren(binary_variable));
 }
 
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
@@ -345,13 +406,11 @@ MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
   std::tie(root_, map_old_vars_to_new_vars_) =
       MixedIntegerBranchAndBoundNode::ConstructRootNode(prog, solver_id);
   if (root_->solution_result() == SolutionResult::kSolutionFound) {
-    best_lower_bound_ = root_->prog()->GetOptimalCost();
+    best_lower_bound_ = root_->optimal_cost();
     // If an integral solution is found, then update the best solutions,
     // together with the best upper bound.
     if (root_->optimal_solution_is_integral()) {
-      UpdateIntegralSolution(
-          root_->prog()->GetSolution(root_->prog()->decision_variables()),
-          root_->prog()->GetOptimalCost());
+      UpdateIntegralSolution(root_->solution(), root_->optimal_cost());
     }
   }
 }
@@ -380,20 +439,26 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
-    // found, then every leaf node is fathomed, the branch-and-bound process
-    // should terminate.
-    // TODO(hongkai.dai) We might need to have a function that picks the
-    // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
-    if (HasConverged()) {
+  if (num_threads_ > 1) {
+    if (SolveInParallel()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+  } else {
+    MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+    while (branching_node) {
+      // Found a branching node, branch on this node. If no branching node is
+      // found, then every leaf node is fathomed, the branch-and-bound process
+      // should terminate.
+      // TODO(hongkai.dai) We might need to have a function that picks the
+      // branching node together with the branching variable simultaneously.
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_node);
+      BranchAndUpdate(branching_node, *branching_variable);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_node = PickBranchingNode();
+    }
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -517,8 +582,8 @@ MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
     MixedIntegerBranchAndBoundNode* right_min_lower_bound_node =
         PickMinLowerBoundNodeInSubTree(bnb, *(sub_tree_root.right_child()));
     if (left_min_lower_bound_node && right_min_lower_bound_node) {
-      return left_min_lower_bound_node->prog()->GetOptimalCost() <
-                     right_min_lower_bound_node->prog()->GetOptimalCost()
+      return left_min_lower_bound_node->optimal_cost() <
+                     right_min_lower_bound_node->optimal_cost()
                  ? left_min_lower_bound_node
                  : right_min_lower_bound_node;
     } else if (left_min_lower_bound_node) {
@@ -557,25 +622,31 @@ MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
   }
 }
 
+// Returns the lower bound of the optimal cost in a leaf node.
+double LeafNodeLowerBound(const MixedIntegerBranchAndBound& bnb,
+                          const MixedIntegerBranchAndBoundNode& leaf_node) {
+  if (bnb.IsLeafNodeFathomed(leaf_node)) {
+    switch (leaf_node.solution_result()) {
+      case SolutionResult::kSolutionFound:
+        return leaf_node.optimal_cost();
+      case SolutionResult::kUnbounded:
+        return -std::numeric_limits<double>::infinity();
+      case SolutionResult::kInfeasibleConstraints:
+        return std::numeric_limits<double>::infinity();
+      default:
+        throw std::runtime_error(
+            "Cannot obtain the best lower bound for this fathomed leaf "
+            "node.");
+    }
+  }
+  return leaf_node.optimal_cost();
+}
+
 double BestLowerBoundInSubTree(
     const MixedIntegerBranchAndBound& bnb,
     const MixedIntegerBranchAndBoundNode& sub_tree_root) {
   if (sub_tree_root.IsLeaf()) {
-    if (bnb.IsLeafNodeFathomed(sub_tree_root)) {
-      switch (sub_tree_root.solution_result()) {
-        case SolutionResult::kSolutionFound:
-          return sub_tree_root.prog()->GetOptimalCost();
-        case SolutionResult::kUnbounded:
-          return -std::numeric_limits<double>::infinity();
-        case SolutionResult::kInfeasibleConstraints:
-          return std::numeric_limits<double>::infinity();
-        default:
-          throw std::runtime_error(
-              "Cannot obtain the best lower bound for this fathomed leaf "
-              "node.");
-      }
-    }
-    return sub_tree_root.prog()->GetOptimalCost();
+    return LeafNodeLowerBound(bnb, sub_tree_root);
   } else {
     const double left_best_lower_bound =
         BestLowerBoundInSubTree(bnb, *(sub_tree_root.left_child()));
@@ -606,7 +677,7 @@ const symbolic::Variable* PickMostOrLeastAmbivalentAsBranchingVariable(
     double value = sign * std::numeric_limits<double>::infinity();
     const symbolic::Variable* return_var{nullptr};
     for (const auto& var : node.remaining_binary_variables()) {
-      const double var_value = node.prog()->GetSolution(var);
+      const double var_value = node.GetSolution(var);
       const double var_value_to_half = std::abs(var_value - 0.5);
       if (sign * var_value_to_half < sign * value) {
         value = var_value_to_half;
@@ -663,7 +734,7 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
   if (leaf_node.solution_result() == SolutionResult::kInfeasibleConstraints) {
     return true;
   }
-  if (leaf_node.prog()->GetOptimalCost() > best_upper_bound_) {
+  if (leaf_node.optimal_cost() > best_upper_bound_) {
     return true;
   }
   if (leaf_node.solution_result() == SolutionResult::kSolutionFound &&
@@ -690,10 +761,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   for (auto& child : {node->left_child(), node->right_child()}) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
-      const double child_node_optimal_cost = child->prog()->GetOptimalCost();
-      const Eigen::VectorXd x_sol =
-          child->prog()->GetSolution(child->prog()->decision_variables());
-      UpdateIntegralSolution(x_sol, child_node_optimal_cost);
+      UpdateIntegralSolution(child->solution(), child->optimal_cost());
     }
     if (search_integral_solution_by_rounding_) {
       SearchIntegralSolutionByRounding(*child);
@@ -741,38 +809,233 @@ bool MixedIntegerBranchAndBound::HasConverged() const {
   return false;
 }
 
+namespace {
+// Creates a new program same as the one in `node`, but with the remaining
+// binary variables fixed to the binary value closest to their solution in
+// `node`, and solves it for the continuous variables. If this optimization
+// problem is feasible, then its optimal solution is a feasible solution to the
+// MIP, whose cost is an upper bound of the MIP optimal cost. Returns true and
+// sets `solution` and `cost` if the optimal solution is found.
+bool SolveRoundedProgram(const MixedIntegerBranchAndBoundNode& node,
+                         Eigen::VectorXd* solution, double* cost) {
+  auto new_prog = node.ConstructProgram();
+  // Go through each remaining binary variables, and constrain them to either
+  // 0 or 1 by rounding the solution to the integer.
+  for (const auto& remaining_binary_variable :
+       node.remaining_binary_variables()) {
+    // Notice that roundoff_integer_val is of type double here. This is
+    // because AddBoundingBoxConstraint(...) requires bounds of type double.
+    const double roundoff_integer_val =
+        std::round(node.GetSolution(remaining_binary_variable));
+    new_prog->AddBoundingBoxConstraint(roundoff_integer_val,
+                                       roundoff_integer_val,
+                                       remaining_binary_variable);
+  }
+  const SolutionResult result =
+      SolveProgramWithSolver(new_prog.get(), node.solver_id());
+  if (result == SolutionResult::kSolutionFound) {
+    *solution = new_prog->GetSolution(new_prog->decision_variables());
+    *cost = new_prog->GetOptimalCost();
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
 void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
     const MixedIntegerBranchAndBoundNode& node) {
   // Only searches integral solution by rounding, if the optimization program
   // in this node has an optimal solution, and that solution is non-integral.
   if (node.solution_result() == SolutionResult::kSolutionFound &&
       !node.optimal_solution_is_integral()) {
-    // Create a new program that fix the remaining binary variables to either 0
-    // or 1, and solve for the continuous variables. If this optimization
-    // problem is feasible, then the optimal solution is a feasible
-    // solution to the MIP, and we get an upper bound on the MIP optimal cost.
-    auto new_prog = node.prog()->Clone();
-    // Go through each remaining binary variables, and constrain them to either
-    // 0 or 1 by rounding the solution to the integer.
-    for (const auto& remaining_binary_variable :
-         node.remaining_binary_variables()) {
-      // Notice that roundoff_integer_val is of type double here. This is
-      // because AddBoundingBoxConstraint(...) requires bounds of type double.
-      const double roundoff_integer_val =
-          std::round(node.prog()->GetSolution(remaining_binary_variable));
-      new_prog->AddBoundingBoxConstraint(roundoff_integer_val,
-                                         roundoff_integer_val,
-                                         remaining_binary_variable);
-    }
-    const SolutionResult result =
-        SolveProgramWithSolver(new_prog.get(), node.solver_id());
-    if (result == SolutionResult::kSolutionFound) {
+    Eigen::VectorXd solution;
+    double cost;
+    if (SolveRoundedProgram(node, &solution, &cost)) {
       // Found integral solution.
-      UpdateIntegralSolution(
-          new_prog->GetSolution(new_prog->decision_variables()),
-          new_prog->GetOptimalCost());
+      UpdateIntegralSolution(solution, cost);
     }
   }
 }
+
+void MixedIntegerBranchAndBound::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::runtime_error(
+        "MixedIntegerBranchAndBound::set_num_threads(): the number of threads "
+        "must be positive, got " +
+        std::to_string(num_threads) + ".");
+  }
+  num_threads_ = num_threads;
+}
+
+namespace {
+// Orders the nodes in a std::priority_queue, such that the node with the
+// smallest optimal cost is on the top.
+struct GreaterOptimalCost {
+  bool operator()(const MixedIntegerBranchAndBoundNode* node1,
+                  const MixedIntegerBranchAndBoundNode* node2) const {
+    return node1->optimal_cost() > node2->optimal_cost();
+  }
+};
+
+// Calls `func` on each leaf node in the subtree.
+template <typename Func>
+void ForEachLeafNodeInSubTree(MixedIntegerBranchAndBoundNode* sub_tree_root,
+                              const Func& func) {
+  if (sub_tree_root->IsLeaf()) {
+    func(sub_tree_root);
+  } else {
+    ForEachLeafNodeInSubTree(sub_tree_root->mutable_left_child(), func);
+    ForEachLeafNodeInSubTree(sub_tree_root->mutable_right_child(), func);
+  }
+}
+}  // namespace
+
+bool MixedIntegerBranchAndBound::SolveInParallel() {
+  // The nodes share the evaluators of their costs and constraints. The dense
+  // matrix of a linear constraint is computed the first time it is requested,
+  // so request it now, before the threads start solving programs concurrently.
+  for (const auto& binding : root_->prog()->linear_constraints()) {
+    binding.evaluator()->A();
+  }
+  for (const auto& binding : root_->prog()->linear_equality_constraints()) {
+    binding.evaluator()->A();
+  }
+
+  // All the following variables, the tree structure, the bounds and the
+  // solutions are guarded by `mutex`. The optimization programs of the
+  // children of a node are solved without holding the lock.
+  std::mutex mutex;
+  std::condition_variable condition;
+  // The un-fathomed leaf nodes which are not being branched by a thread.
+  std::priority_queue<MixedIntegerBranchAndBoundNode*,
+                      std::vector<MixedIntegerBranchAndBoundNode*>,
+                      GreaterOptimalCost>
+      open_nodes;
+  // The optimal costs of the nodes being branched by a thread.
+  std::multiset<double> branching_costs;
+  // The smallest lower bound of the fathomed leaf nodes.
+  double fathomed_lower_bound = std::numeric_limits<double>::infinity();
+  bool converged = false;
+  std::exception_ptr error;
+
+  // Either queues a leaf node for branching, or accounts for its lower bound
+  // if it is fathomed.
+  const auto add_leaf_node = [&](MixedIntegerBranchAndBoundNode* leaf_node) {
+    if (IsLeafNodeFathomed(*leaf_node)) {
+      fathomed_lower_bound = std::min(fathomed_lower_bound,
+                                      LeafNodeLowerBound(*this, *leaf_node));
+    } else {
+      open_nodes.push(leaf_node);
+    }
+  };
+  ForEachLeafNodeInSubTree(root_.get(), add_leaf_node);
+
+  // The best lower bound is the smallest among the lower bounds of all the
+  // leaf nodes, where the children of a node being branched are bounded by
+  // the optimal cost of that node.
+  const auto update_best_lower_bound = [&]() {
+    best_lower_bound_ = fathomed_lower_bound;
+    if (!open_nodes.empty()) {
+      best_lower_bound_ = std::min(best_lower_bound_,
+                                   open_nodes.top()->optimal_cost());
+    }
+    if (!branching_costs.empty()) {
+      best_lower_bound_ = std::min(best_lower_bound_, *branching_costs.begin());
+    }
+  };
+
+  const auto worker = [&](int) {
+    std::unique_lock<std::mutex> lock(mutex);
+    try {
+      while (true) {
+        condition.wait(lock, [&]() {
+          return converged || error || !open_nodes.empty() ||
+                 branching_costs.empty();
+        });
+        if (converged || error || open_nodes.empty()) {
+          // Either the branch-and-bound has terminated, or every leaf node is
+          // fathomed.
+          condition.notify_all();
+          return;
+        }
+        MixedIntegerBranchAndBoundNode* node = open_nodes.top();
+        open_nodes.pop();
+        // The best upper bound might have decreased since this node was
+        // queued.
+        if (IsLeafNodeFathomed(*node)) {
+          add_leaf_node(node);
+          continue;
+        }
+        const auto branching_cost =
+            branching_costs.insert(node->optimal_cost());
+        // The user-defined function is called while holding the lock.
+        const symbolic::Variable* branching_variable =
+            variable_selection_method_ == VariableSelectionMethod::kUserDefined
+                ? PickBranchingVariable(*node)
+                : nullptr;
+
+        lock.unlock();
+        if (branching_variable == nullptr) {
+          branching_variable = PickBranchingVariable(*node);
+        }
+        auto children = node->ConstructChildren(*branching_variable);
+        // Searches for the integral solutions by rounding before taking the
+        // lock again, since this solves an optimization program per child.
+        std::vector<std::pair<Eigen::VectorXd, double>> rounded_solutions;
+        if (search_integral_solution_by_rounding_) {
+          for (const auto* child :
+               {children.first.get(), children.second.get()}) {
+            Eigen::VectorXd solution;
+            double cost;
+            if (child->solution_result() == SolutionResult::kSolutionFound &&
+                !child->optimal_solution_is_integral() &&
+                SolveRoundedProgram(*child, &solution, &cost)) {
+              rounded_solutions.emplace_back(solution, cost);
+            }
+          }
+        }
+        lock.lock();
+
+        branching_costs.erase(branching_cost);
+        node->AttachChildren(std::move(children));
+        for (auto* child : {node->mutable_left_child(),
+                            node->mutable_right_child()}) {
+          if (child->solution_result() == SolutionResult::kSolutionFound &&
+              child->optimal_solution_is_integral()) {
+            UpdateIntegralSolution(child->solution(), child->optimal_cost());
+          }
+        }
+        for (const auto& rounded_solution : rounded_solutions) {
+          UpdateIntegralSolution(rounded_solution.first,
+                                 rounded_solution.second);
+        }
+        for (auto* child : {node->mutable_left_child(),
+                            node->mutable_right_child()}) {
+          NodeCallback(*child);
+          add_leaf_node(child);
+        }
+        update_best_lower_bound();
+        converged = HasConverged();
+        condition.notify_all();
+      }
+    } catch (...) {
+      if (!lock.owns_lock()) {
+        lock.lock();
+      }
+      if (!error) {
+        error = std::current_exception();
+      }
+      condition.notify_all();
+    }
+  };
+  ParallelFor(num_threads_, num_threads_, worker);
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (!converged) {
+    update_best_lower_bound();
+  }
+  return converged;
+}
 }  // namespace solvers
 }  // namespace drake
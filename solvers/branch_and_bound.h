@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 
@@ -91,10 +92,33 @@ class MixedIntegerBranchAndBoundNode {
   bool IsLeaf() const { return !left_child_ && !right_child_; }
 
   /**
-   * Getter for the mathematical program.
+   * Getter for the mathematical program of the root node, in which all the
+   * binary variables are relaxed to 0 ≤ z ≤ 1. This program is shared by all
+   * the nodes in the tree, and it contains neither the constraints fixing the
+   * binary variables in this node, nor the solution of this node. Use
+   * ConstructProgram() to get the program of this node, and GetSolution() and
+   * optimal_cost() to get its solution.
    */
   const MathematicalProgram* prog() const { return prog_.get(); }
 
+  /**
+   * Constructs the optimization program in this node, namely the program of
+   * the root node prog(), together with the constraints z = b_fixed on the
+   * binary variables fixed in this node. Each node only stores the list of its
+   * fixed binary variables, and constructs the program when it is solved.
+   */
+  std::unique_ptr<MathematicalProgram> ConstructProgram() const;
+
+  /**
+   * Getter for the list of binary variables fixed in this node, together with
+   * their values, from the one fixed in the child of the root node to the one
+   * fixed in this node.
+   */
+  const std::vector<std::pair<symbolic::Variable, int>>&
+  fixed_binary_variables() const {
+    return fixed_binary_variables_;
+  }
+
   /** Getter for the left child. */
   const MixedIntegerBranchAndBoundNode* left_child() const {
     return left_child_.get();
@@ -145,6 +169,28 @@ class MixedIntegerBranchAndBoundNode {
   /** Getter for the solution result when solving the optimization program. */
   SolutionResult solution_result() const { return solution_result_; }
 
+  /** Getter for the optimal cost of the optimization program in this node. */
+  double optimal_cost() const { return optimal_cost_; }
+
+  /**
+   * Getter for the solution of the optimization program in this node, ordered
+   * as prog()->decision_variables().
+   */
+  const Eigen::VectorXd& solution() const { return solution_; }
+
+  /**
+   * Gets the solution of a decision variable in this node.
+   * @pre `var` is a decision variable in prog().
+   */
+  double GetSolution(const symbolic::Variable& var) const;
+
+  /**
+   * Gets the solution of some decision variables in this node.
+   * @pre `vars` are decision variables in prog().
+   */
+  Eigen::VectorXd GetSolution(
+      const Eigen::Ref<const VectorXDecisionVariable>& vars) const;
+
   /**
    * Getter for optimal_solution_is_integral.
    * @pre The optimization problem is solved successfully.
@@ -156,6 +202,8 @@ class MixedIntegerBranchAndBoundNode {
   const SolverId& solver_id() const { return solver_id_; }
 
  private:
+  friend class MixedIntegerBranchAndBound;
+
   /**
    * If the solution to a binary variable is either less than integral_tol or
    * larger than 1 - integral_tol, then we regard the solution to be binary.
@@ -166,24 +214,44 @@ class MixedIntegerBranchAndBoundNode {
   }
 
  private:
-  // Constructs an empty node. Clone the input mathematical program to this
-  // node. The child and the parent nodes are all nullptr.
-  // @param prog The optimization program whose binary variable constraints are
-  // all relaxed to 0 ≤ z ≤ 1.
+  // Constructs an empty node, which shares the input mathematical program. The
+  // child and the parent nodes are all nullptr.
+  // @param prog The optimization program of the root node, whose binary
+  // variable constraints are all relaxed to 0 ≤ z ≤ 1.
   // @param binary_variables The list of binary variables in the mixed-integer
   // problem.
   MixedIntegerBranchAndBoundNode(
-      const MathematicalProgram& prog,
+      std::shared_ptr<const MathematicalProgram> prog,
       const std::list<symbolic::Variable>& binary_variables,
       const SolverId& solver_id);
 
-  // Fix a binary variable to a binary value. Add a constraint z = 0 or z = 1 to
-  // the optimization program. Remove this binary variable from the
+  // Fix a binary variable to a binary value. Add it to the list of fixed
+  // binary variables, so that ConstructProgram() adds the constraint z = 0 or
+  // z = 1 to the optimization program. Remove this binary variable from the
   // remaining_binary_variables_ list; set the binary_var_ and
   // binary_var_value_.
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the two child nodes that Branch(binary_variable) would create, and
+  // solves their optimization programs, without attaching them to this node.
+  // This only reads this node, so that MixedIntegerBranchAndBound can solve the
+  // children of different nodes concurrently and attach them afterwards.
+  std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+            std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+  ConstructChildren(const symbolic::Variable& binary_variable) const;
+
+  // Constructs and solves the optimization program in this node, and stores
+  // its solution. If `parent` is not null and has a solution, the solver is
+  // warm-started from it.
+  void SolveProgram(const MixedIntegerBranchAndBoundNode* parent);
+
+  // Makes `children` (left, right) the child nodes of this node.
+  void AttachChildren(
+      std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+                std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+          children);
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -199,8 +267,8 @@ class MixedIntegerBranchAndBoundNode {
     /// constraints yet.
   };
 
-  // Stores the optimization program in this node.
-  std::unique_ptr<MathematicalProgram> prog_;
+  // The optimization program of the root node, shared by all the nodes.
+  std::shared_ptr<const MathematicalProgram> prog_;
   std::unique_ptr<MixedIntegerBranchAndBoundNode> left_child_;
   std::unique_ptr<MixedIntegerBranchAndBoundNode> right_child_;
   MixedIntegerBranchAndBoundNode* parent_;
@@ -214,6 +282,11 @@ class MixedIntegerBranchAndBoundNode {
   // node.
   int fixed_binary_value_;
 
+  // All the binary variables fixed in this node, and their values. This is the
+  // difference between the program in this node and prog_, so each node only
+  // stores O(depth) constraints.
+  std::vector<std::pair<symbolic::Variable, int>> fixed_binary_variables_;
+
   // The variables that were binary in the original mixed-integer optimization
   // problem, but whose value has not been fixed to either 0 or 1 yet.
   std::list<symbolic::Variable> remaining_binary_variables_;
@@ -221,6 +294,10 @@ class MixedIntegerBranchAndBoundNode {
   // The solution result of the optimization program.
   SolutionResult solution_result_;
 
+  // The optimal cost and the solution of the optimization program.
+  double optimal_cost_;
+  Eigen::VectorXd solution_;
+
   // Whether the optimal solution in this node satisfies all integral
   // constraints.
   OptimalSolutionIsIntegral optimal_solution_is_integral_;
@@ -550,6 +627,27 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Sets the number of threads used by Solve(). With more than one thread, the
+   * un-fathomed leaf nodes are kept in a queue shared by all the threads, and
+   * each thread repeatedly takes the node with the smallest optimal cost out of
+   * the queue, picks its branching variable, and solves the optimization
+   * programs of its two children, each of which has its own program. So the
+   * node selection method is always NodeSelectionMethod::kMinLowerBound, and
+   * the one set by SetNodeSelectionMethod() is ignored. The best upper and
+   * lower bounds and the integral solutions are shared by all the threads. The
+   * user-defined functions to pick a branching variable and the node callback
+   * are called by one thread at a time. Different nodes may be explored
+   * depending on the order in which the threads finish, but the optimal cost
+   * agrees with a single-threaded Solve() up to the gap tolerances. By default,
+   * a single thread is used.
+   * @throws std::runtime_error if `num_threads` is less than one.
+   */
+  void set_num_threads(int num_threads);
+
+  /** Getter for the number of threads used by Solve(). */
+  int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -584,6 +682,15 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branches on the un-fathomed leaf nodes of the tree on num_threads_ threads,
+   * taking the node with the smallest optimal cost first, until the
+   * branch-and-bound converges or every leaf node is fathomed. Updates the best
+   * lower and upper bounds and the solutions as Solve() does.
+   * @retval converged True if the branch-and-bound has converged.
+   */
+  bool SolveInParallel();
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -675,6 +782,9 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  // The number of threads used by Solve().
+  int num_threads_{1};
 };
 }  // namespace solvers
 }  // namespace drake
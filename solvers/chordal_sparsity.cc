@@ -0,0 +1,300 @@
+#include "drake/solvers/chordal_sparsity.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace drake {
+namespace solvers {
+using symbolic::Expression;
+using symbolic::Monomial;
+using symbolic::Polynomial;
+using symbolic::Variable;
+using symbolic::Variables;
+
+namespace {
+// Returns true if 2α is in the bounding box of the Newton polytope of p, and
+// within the range of total degrees of p, where xᵅ is the monomial m.
+bool SatisfiesNewtonPolytopeBounds(const Polynomial& p, const Monomial& m) {
+  const Polynomial::MapType& map = p.monomial_to_coefficient_map();
+  if (map.empty()) {
+    return false;
+  }
+  const Variables indeterminates = p.indeterminates();
+  if (!m.GetVariables().IsSubsetOf(indeterminates)) {
+    return false;
+  }
+  int min_total_degree = std::numeric_limits<int>::max();
+  int max_total_degree = 0;
+  for (const auto& pair : map) {
+    min_total_degree = std::min(min_total_degree, pair.first.total_degree());
+    max_total_degree = std::max(max_total_degree, pair.first.total_degree());
+  }
+  if (2 * m.total_degree() < min_total_degree ||
+      2 * m.total_degree() > max_total_degree) {
+    return false;
+  }
+  for (const Variable& v : indeterminates) {
+    int min_degree = std::numeric_limits<int>::max();
+    int max_degree = 0;
+    for (const auto& pair : map) {
+      min_degree = std::min(min_degree, pair.first.degree(v));
+      max_degree = std::max(max_degree, pair.first.degree(v));
+    }
+    if (2 * m.degree(v) < min_degree || 2 * m.degree(v) > max_degree) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Removes, from each of the monomial bases of the Gram blocks in a
+// decomposition p = ∑ₖ mₖᵀQₖmₖ, the monomials m whose square is neither a
+// monomial of p, nor the product of two distinct monomials in a same basis.
+// The diagonal entries of the Gram blocks for m then sum to zero, hence all
+// of them are zero, and so are their rows.
+void RemoveDiagonallyInconsistentMonomials(
+    const Polynomial& p, std::vector<std::vector<Monomial>>* bases) {
+  const Polynomial::MapType& map = p.monomial_to_coefficient_map();
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    std::unordered_set<Monomial> cross_products;
+    for (const std::vector<Monomial>& basis : *bases) {
+      for (int i = 0; i < static_cast<int>(basis.size()); ++i) {
+        for (int j = i + 1; j < static_cast<int>(basis.size()); ++j) {
+          cross_products.insert(basis[i] * basis[j]);
+        }
+      }
+    }
+    for (std::vector<Monomial>& basis : *bases) {
+      const auto end = std::remove_if(
+          basis.begin(), basis.end(), [&](const Monomial& m) {
+            const Monomial square = m * m;
+            return map.count(square) == 0 && cross_products.count(square) == 0;
+          });
+      if (end != basis.end()) {
+        basis.erase(end, basis.end());
+        changed = true;
+      }
+    }
+  }
+}
+
+VectorX<Monomial> ToEigenVector(const std::vector<Monomial>& monomials) {
+  VectorX<Monomial> result(monomials.size());
+  for (int i = 0; i < static_cast<int>(monomials.size()); ++i) {
+    result(i) = monomials[i];
+  }
+  return result;
+}
+}  // namespace
+
+std::vector<std::vector<int>> ChordalCliques(
+    const std::vector<std::set<int>>& adjacency) {
+  const int num_nodes = static_cast<int>(adjacency.size());
+  for (int i = 0; i < num_nodes; ++i) {
+    for (int j : adjacency[i]) {
+      DRAKE_DEMAND(j >= 0 && j < num_nodes && j != i);
+      DRAKE_DEMAND(adjacency[j].count(i) > 0);
+    }
+  }
+  // Eliminates the nodes one at a time, always picking the node with the
+  // fewest remaining neighbours. Eliminating a node connects all its remaining
+  // neighbours (these are the fill-in edges of the chordal extension), and the
+  // node together with these neighbours forms a clique of the extension.
+  std::vector<std::set<int>> graph = adjacency;
+  std::vector<bool> eliminated(num_nodes, false);
+  std::vector<std::set<int>> candidates;
+  candidates.reserve(num_nodes);
+  for (int step = 0; step < num_nodes; ++step) {
+    int v = -1;
+    for (int i = 0; i < num_nodes; ++i) {
+      if (!eliminated[i] && (v < 0 || graph[i].size() < graph[v].size())) {
+        v = i;
+      }
+    }
+    std::set<int> clique = graph[v];
+    clique.insert(v);
+    for (int a : graph[v]) {
+      for (int b : graph[v]) {
+        if (a != b) graph[a].insert(b);
+      }
+      graph[a].erase(v);
+    }
+    graph[v].clear();
+    eliminated[v] = true;
+    candidates.push_back(std::move(clique));
+  }
+  // Every maximal clique of the extension is one of the candidates, so we
+  // keep the candidates not contained in another one.
+  std::vector<std::vector<int>> cliques;
+  for (int i = 0; i < static_cast<int>(candidates.size()); ++i) {
+    bool maximal = true;
+    for (int j = 0; j < static_cast<int>(candidates.size()) && maximal; ++j) {
+      if (j == i || candidates[j].size() < candidates[i].size() ||
+          (candidates[j].size() == candidates[i].size() && j > i)) {
+        continue;
+      }
+      maximal = !std::includes(candidates[j].begin(), candidates[j].end(),
+                               candidates[i].begin(), candidates[i].end());
+    }
+    if (maximal) {
+      cliques.emplace_back(candidates[i].begin(), candidates[i].end());
+    }
+  }
+  return cliques;
+}
+
+std::vector<Variables> CorrelativeSparsityCliques(const Polynomial& p) {
+  const Variables indeterminates = p.indeterminates();
+  const std::vector<Variable> variables(indeterminates.begin(),
+                                        indeterminates.end());
+  std::unordered_map<Variable::Id, int> variable_index;
+  for (int i = 0; i < static_cast<int>(variables.size()); ++i) {
+    variable_index.emplace(variables[i].get_id(), i);
+  }
+  std::vector<std::set<int>> adjacency(variables.size());
+  for (const auto& pair : p.monomial_to_coefficient_map()) {
+    for (const auto& power_i : pair.first.get_powers()) {
+      for (const auto& power_j : pair.first.get_powers()) {
+        const int i = variable_index.at(power_i.first.get_id());
+        const int j = variable_index.at(power_j.first.get_id());
+        if (i != j) adjacency[i].insert(j);
+      }
+    }
+  }
+  std::vector<Variables> cliques;
+  for (const std::vector<int>& clique : ChordalCliques(adjacency)) {
+    Variables clique_variables;
+    for (int i : clique) {
+      clique_variables.insert(variables[i]);
+    }
+    cliques.push_back(clique_variables);
+  }
+  return cliques;
+}
+
+VectorX<Monomial> ReduceSosMonomialBasis(
+    const Polynomial& p,
+    const Eigen::Ref<const VectorX<Monomial>>& monomial_basis) {
+  std::vector<std::vector<Monomial>> bases(1);
+  for (int i = 0; i < monomial_basis.rows(); ++i) {
+    if (SatisfiesNewtonPolytopeBounds(p, monomial_basis(i))) {
+      bases[0].push_back(monomial_basis(i));
+    }
+  }
+  RemoveDiagonallyInconsistentMonomials(p, &bases);
+  return ToEigenVector(bases[0]);
+}
+
+std::pair<std::vector<Binding<PositiveSemidefiniteConstraint>>,
+          Binding<LinearEqualityConstraint>>
+AddSparseSosConstraint(MathematicalProgram* prog, const Polynomial& p) {
+  DRAKE_DEMAND(prog != nullptr);
+  const VectorX<Monomial> full_basis =
+      symbolic::MonomialBasis(p.indeterminates(), p.TotalDegree() / 2);
+  std::vector<Monomial> candidates;
+  for (int i = 0; i < full_basis.rows(); ++i) {
+    if (SatisfiesNewtonPolytopeBounds(p, full_basis(i))) {
+      candidates.push_back(full_basis(i));
+    }
+  }
+  // Each Gram block only contains the monomials over one clique of correlated
+  // indeterminates.
+  std::vector<std::vector<Monomial>> bases;
+  const std::vector<Variables> cliques = CorrelativeSparsityCliques(p);
+  if (cliques.empty()) {
+    // p is a constant.
+    bases.push_back(candidates);
+  }
+  for (const Variables& clique : cliques) {
+    bases.emplace_back();
+    for (const Monomial& m : candidates) {
+      if (m.GetVariables().IsSubsetOf(clique)) {
+        bases.back().push_back(m);
+      }
+    }
+  }
+  RemoveDiagonallyInconsistentMonomials(p, &bases);
+
+  std::vector<Binding<PositiveSemidefiniteConstraint>> psd_bindings;
+  Polynomial sos_poly;
+  for (const std::vector<Monomial>& basis : bases) {
+    if (basis.empty()) continue;
+    const auto pair = prog->NewSosPolynomial(ToEigenVector(basis));
+    sos_poly += pair.first;
+    psd_bindings.push_back(pair.second);
+  }
+  const auto leq_binding = prog->AddLinearEqualityConstraint(sos_poly == p);
+  return std::make_pair(psd_bindings, leq_binding);
+}
+
+std::pair<std::vector<Binding<PositiveSemidefiniteConstraint>>,
+          Binding<LinearEqualityConstraint>>
+AddChordalLinearMatrixInequalityConstraint(
+    MathematicalProgram* prog,
+    const std::vector<Eigen::Ref<const Eigen::MatrixXd>>& F,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  DRAKE_DEMAND(prog != nullptr);
+  DRAKE_DEMAND(static_cast<int>(F.size()) == vars.rows() + 1);
+  const int n = F[0].rows();
+  // The aggregate sparsity pattern of F.
+  std::vector<std::set<int>> adjacency(n);
+  for (const auto& Fi : F) {
+    DRAKE_DEMAND(Fi.rows() == n && Fi.cols() == n);
+    for (int j = 0; j < n; ++j) {
+      for (int i = j + 1; i < n; ++i) {
+        if (Fi(i, j) != 0 || Fi(j, i) != 0) {
+          adjacency[i].insert(j);
+          adjacency[j].insert(i);
+        }
+      }
+    }
+  }
+
+  // Adds a PSD matrix Sₖ per clique, and accumulates ∑ₖ Eₖᵀ Sₖ Eₖ in S_sum.
+  std::vector<Binding<PositiveSemidefiniteConstraint>> psd_bindings;
+  MatrixX<Expression> S_sum = MatrixX<Expression>::Zero(n, n);
+  Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> in_pattern =
+      Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>::Constant(n, n,
+                                                                    false);
+  for (const std::vector<int>& clique : ChordalCliques(adjacency)) {
+    const int clique_size = static_cast<int>(clique.size());
+    const MatrixXDecisionVariable S =
+        prog->NewSymmetricContinuousVariables(clique_size, "S");
+    psd_bindings.push_back(prog->AddPositiveSemidefiniteConstraint(S));
+    for (int a = 0; a < clique_size; ++a) {
+      for (int b = 0; b < clique_size; ++b) {
+        S_sum(clique[a], clique[b]) += S(a, b);
+        in_pattern(clique[a], clique[b]) = true;
+      }
+    }
+  }
+
+  // Matches the lower triangular entries of F within the chordal pattern.
+  // The entries out of the pattern are zero in every F[i].
+  std::vector<Expression> residuals;
+  for (int j = 0; j < n; ++j) {
+    for (int i = j; i < n; ++i) {
+      if (!in_pattern(i, j)) continue;
+      Expression F_ij{F[0](i, j)};
+      for (int k = 0; k < vars.rows(); ++k) {
+        if (F[k + 1](i, j) != 0) {
+          F_ij += F[k + 1](i, j) * vars(k);
+        }
+      }
+      residuals.push_back(F_ij - S_sum(i, j));
+    }
+  }
+  VectorX<Expression> residual_vector(residuals.size());
+  for (int i = 0; i < static_cast<int>(residuals.size()); ++i) {
+    residual_vector(i) = residuals[i];
+  }
+  const auto leq_binding = prog->AddLinearEqualityConstraint(
+      residual_vector, Eigen::VectorXd::Zero(residual_vector.rows()));
+  return std::make_pair(psd_bindings, leq_binding);
+}
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "drake/common/symbolic.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Computes a chordal extension of an undirected graph, by eliminating its
+ * nodes in a greedy minimum-degree order, and returns the maximal cliques of
+ * that extension. Every edge of the graph joins two nodes of a common clique,
+ * and every node belongs to at least one clique.
+ * @param adjacency adjacency[i] is the set of neighbours of node i. It must be
+ * symmetric, and must not contain self loops.
+ * @return The maximal cliques, each sorted in increasing order.
+ */
+std::vector<std::vector<int>> ChordalCliques(
+    const std::vector<std::set<int>>& adjacency);
+
+/**
+ * Returns the groups of indeterminates of @p p that may be kept apart in a
+ * sums-of-squares decomposition of @p p. Two indeterminates are correlated if
+ * they appear together in a monomial of @p p. The groups are the maximal
+ * cliques of a chordal extension of this correlative sparsity graph, see
+ * ChordalCliques().
+ */
+std::vector<symbolic::Variables> CorrelativeSparsityCliques(
+    const symbolic::Polynomial& p);
+
+/**
+ * Removes from @p monomial_basis the monomials that cannot appear in any
+ * sums-of-squares decomposition `p = mᵀQm` of @p p:
+ *  - A monomial xᵅ can only appear if 2α lies in the Newton polytope of p.
+ *    This is checked on the bounding box of the Newton polytope, and on the
+ *    range of its total degrees.
+ *  - If x²ᵅ is not a monomial of p, and is not the product of two distinct
+ *    monomials of the basis, then the diagonal entry of Q for xᵅ must be zero,
+ *    hence so is its whole row, and xᵅ can be dropped. This is repeated until
+ *    no more monomial is dropped.
+ * The order of the remaining monomials is kept.
+ */
+VectorX<symbolic::Monomial> ReduceSosMonomialBasis(
+    const symbolic::Polynomial& p,
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis);
+
+/**
+ * Adds the constraints that the polynomial @p p is a sums-of-squares, by
+ * exploiting its sparsity. Instead of a single Gram matrix over the full
+ * monomial basis, as with MathematicalProgram::AddSosConstraint(), p is
+ * decomposed as
+ * <pre>
+ *   p = ∑ₖ mₖᵀQₖmₖ,  Qₖ ⪰ 0
+ * </pre>
+ * where each mₖ only contains the indeterminates of one of the
+ * CorrelativeSparsityCliques() of p, and is reduced with
+ * ReduceSosMonomialBasis(). This leads to several small PSD constraints in
+ * place of a large one, which solvers handle much faster.
+ * Note that for a polynomial with a nontrivial correlative sparsity, this is a
+ * (tighter) restriction of the dense SOS constraint.
+ * @return A pair of
+ *  - the PSD constraints on the Gram matrices Qₖ;
+ *  - the linear equality constraint matching the coefficients of p.
+ */
+std::pair<std::vector<Binding<PositiveSemidefiniteConstraint>>,
+          Binding<LinearEqualityConstraint>>
+AddSparseSosConstraint(MathematicalProgram* prog,
+                       const symbolic::Polynomial& p);
+
+/**
+ * Adds the linear matrix inequality constraint
+ * <pre>
+ *   F[0] + ∑ᵢ F[i + 1] vars(i) ⪰ 0
+ * </pre>
+ * by its chordal decomposition. The aggregate sparsity pattern of the
+ * matrices F is extended to a chordal pattern with cliques Cₖ (see
+ * ChordalCliques()), and the constraint is replaced by
+ * <pre>
+ *   F[0] + ∑ᵢ F[i + 1] vars(i) = ∑ₖ Eₖᵀ Sₖ Eₖ,  Sₖ ⪰ 0
+ * </pre>
+ * where Eₖ selects the rows in Cₖ. This is equivalent to the original
+ * constraint, but has one small PSD constraint per clique in place of a large
+ * one.
+ * @return A pair of
+ *  - the PSD constraints on the new matrices Sₖ;
+ *  - the linear equality constraint between F and the matrices Sₖ.
+ */
+std::pair<std::vector<Binding<PositiveSemidefiniteConstraint>>,
+          Binding<LinearEqualityConstraint>>
+AddChordalLinearMatrixInequalityConstraint(
+    MathematicalProgram* prog,
+    const std::vector<Eigen::Ref<const Eigen::MatrixXd>>& F,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars);
+}  // namespace solvers
+}  // namespace drake
@@ -1,8 +1,12 @@
 #include "drake/solvers/constraint.h"
 
+#include <algorithm>
 #include <cmath>
+#include <string>
 #include <unordered_map>
+#include <utility>
 
+#include "drake/common/symbolic_sparse_jacobian.h"
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/symbolic_extraction.h"
 
@@ -11,6 +15,32 @@ using std::abs;
 namespace drake {
 namespace solvers {
 
+void Constraint::SetGradientSparsityPattern(
+    std::vector<std::pair<int, int>> gradient_sparsity_pattern) {
+  if (num_vars() == Eigen::Dynamic) {
+    throw std::runtime_error(
+        "Constraint::SetGradientSparsityPattern(): the number of variables "
+        "must be known.");
+  }
+  for (const auto& entry : gradient_sparsity_pattern) {
+    if (entry.first < 0 || entry.first >= num_constraints() ||
+        entry.second < 0 || entry.second >= num_vars()) {
+      throw std::runtime_error(
+          "Constraint::SetGradientSparsityPattern(): entry (" +
+          std::to_string(entry.first) + ", " + std::to_string(entry.second) +
+          ") is outside of the " + std::to_string(num_constraints()) + " x " +
+          std::to_string(num_vars()) + " gradient.");
+    }
+  }
+  std::sort(gradient_sparsity_pattern.begin(),
+            gradient_sparsity_pattern.end());
+  gradient_sparsity_pattern.erase(
+      std::unique(gradient_sparsity_pattern.begin(),
+                  gradient_sparsity_pattern.end()),
+      gradient_sparsity_pattern.end());
+  gradient_sparsity_pattern_ = std::move(gradient_sparsity_pattern);
+}
+
 void QuadraticConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
                                  Eigen::VectorXd &y) const {
   y.resize(num_constraints());
@@ -24,6 +54,13 @@ void QuadraticConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
       b_.cast<AutoDiffXd>().transpose() * x;
 }
 
+void QuadraticConstraint::DoEvalBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& X, Eigen::MatrixXd* Y) const {
+  const Eigen::MatrixXd QX = Q_ * X;
+  *Y = .5 * (X.array() * QX.array()).colwise().sum().matrix() +
+       b_.transpose() * X;
+}
+
 void LorentzConeConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::VectorXd &y) const {
   Eigen::VectorXd z = A_ * x + b_;
@@ -40,6 +77,15 @@ void LorentzConeConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
   y(1) = pow(z(0), 2) - z.tail(z.size() - 1).squaredNorm();
 }
 
+void LorentzConeConstraint::DoEvalBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& X, Eigen::MatrixXd* Y) const {
+  const Eigen::MatrixXd Z = (A_ * X).colwise() + b_;
+  Y->resize(num_constraints(), X.cols());
+  Y->row(0) = Z.row(0);
+  Y->row(1) = Z.row(0).array().square().matrix() -
+              Z.bottomRows(Z.rows() - 1).colwise().squaredNorm();
+}
+
 void RotatedLorentzConeConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::VectorXd &y) const {
   Eigen::VectorXd z = A_ * x + b_;
@@ -58,6 +104,30 @@ void RotatedLorentzConeConstraint::DoEval(
   y(2) = z(0) * z(1) - z.tail(z.size() - 2).squaredNorm();
 }
 
+void RotatedLorentzConeConstraint::DoEvalBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& X, Eigen::MatrixXd* Y) const {
+  const Eigen::MatrixXd Z = (A_ * X).colwise() + b_;
+  Y->resize(num_constraints(), X.cols());
+  Y->topRows(2) = Z.topRows(2);
+  Y->row(2) = Z.row(0).cwiseProduct(Z.row(1)) -
+              Z.bottomRows(Z.rows() - 2).colwise().squaredNorm();
+}
+
+namespace {
+// Computes y = A * x, with A a sparse matrix, for any scalar type of x.
+template <typename DerivedX, typename ScalarY>
+void SparseMatrixTimesVector(const Eigen::SparseMatrix<double>& A,
+                             const Eigen::MatrixBase<DerivedX>& x,
+                             VectorX<ScalarY>* y) {
+  y->setZero(A.rows());
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      (*y)(it.row()) += it.value() * x(j);
+    }
+  }
+}
+}  // namespace
+
 void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
                               Eigen::VectorXd &y) const {
   y.resize(num_constraints());
@@ -65,8 +135,33 @@ void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
 }
 void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
                               AutoDiffVecXd &y) const {
-  y.resize(num_constraints());
-  y = A_.cast<AutoDiffXd>() * x;
+  SparseMatrixTimesVector(A_, x, &y);
+}
+
+void LinearConstraint::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                                   Eigen::MatrixXd* Y) const {
+  *Y = A_ * X;
+}
+
+void LinearConstraint::CheckNewCoefficientsDimensions(int A_rows, int A_cols,
+                                                      int lb_rows, int lb_cols,
+                                                      int ub_rows,
+                                                      int ub_cols) const {
+  if (A_rows != lb_rows || lb_rows != ub_rows || lb_cols != 1 ||
+      ub_cols != 1) {
+    throw std::runtime_error("New constraints have invalid dimensions");
+  }
+
+  if (A_cols != A_.cols()) {
+    throw std::runtime_error("Can't change the number of decision variables");
+  }
+}
+
+Eigen::SparseMatrix<double> BoundingBoxConstraint::MakeSparseIdentity(
+    int size) {
+  Eigen::SparseMatrix<double> identity(size, size);
+  identity.setIdentity();
+  return identity;
 }
 
 void BoundingBoxConstraint::DoEval(
@@ -80,6 +175,11 @@ void BoundingBoxConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
   y = x;
 }
 
+void BoundingBoxConstraint::DoEvalBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& X, Eigen::MatrixXd* Y) const {
+  *Y = X;
+}
+
 void LinearComplementarityConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::VectorXd &y) const {
   y.resize(num_constraints());
@@ -182,7 +282,7 @@ ExpressionConstraint::ExpressionConstraint(
                                                       &map_var_to_index_);
   }
 
-  derivatives_ = symbolic::Jacobian(expressions_, vars_);
+  derivatives_ = symbolic::SparseJacobian(expressions_, vars_);
 
   // Setup the environment.
   for (int i = 0; i < vars_.size(); i++) {
@@ -215,21 +315,27 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
   }
 
+  // Evaluate the structurally nonzero entries of ∂f/∂x.
+  Eigen::MatrixXd dydx = Eigen::MatrixXd::Zero(num_constraints(), x.size());
+  for (int k = 0; k < derivatives_.outerSize(); k++) {
+    for (Eigen::SparseMatrix<symbolic::Expression>::InnerIterator it(
+             derivatives_, k);
+         it; ++it) {
+      dydx(it.row(), k) = it.value().Evaluate(environment_);
+    }
+  }
+
   // Evaluate value and derivatives into the output, y.
   // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
   y.resize(num_constraints());
-  Eigen::VectorXd dyidx(x.size());
   for (int i = 0; i < num_constraints(); i++) {
     y[i].value() = expressions_[i].Evaluate(environment_);
-    for (int k = 0; k < x.size(); k++) {
-      dyidx[k] = derivatives_(i, k).Evaluate(environment_);
-    }
 
     y[i].derivatives().resize(x(0).derivatives().size());
     for (int j = 0; j < x(0).derivatives().size(); j++) {
       y[i].derivatives()[j] = 0.0;
       for (int k = 0; k < x.size(); k++) {
-        y[i].derivatives()[j] += dyidx[k] * x(k).derivatives()[j];
+        y[i].derivatives()[j] += dydx(i, k) * x(k).derivatives()[j];
       }
     }
   }
@@ -15,6 +15,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -104,7 +105,29 @@ class Constraint : public EvaluatorBase {
   /** Number of rows in the output constraint. */
   int num_constraints() const { return num_outputs(); }
 
+  /**
+   * Returns the entries of the `num_constraints` x `num_vars` gradient of this
+   * constraint that may be nonzero, as (row, column) pairs sorted by row and
+   * then by column, or nullopt if any entry may be nonzero. Solvers report only
+   * these entries as the nonzero structure of the constraint Jacobian.
+   * @see SetGradientSparsityPattern()
+   */
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity_pattern()
+      const {
+    return gradient_sparsity_pattern_;
+  }
+
  protected:
+  /**
+   * Declares that only the given (row, column) entries of the gradient of this
+   * constraint may be nonzero; every other entry must be zero for any value of
+   * the variables. Duplicated entries are ignored.
+   * @throws std::runtime_error if `num_vars` is Eigen::Dynamic, or if an entry
+   * lies outside of the `num_constraints` x `num_vars` gradient.
+   */
+  void SetGradientSparsityPattern(
+      std::vector<std::pair<int, int>> gradient_sparsity_pattern);
+
   /** Updates the lower bound.
    * @note if the users want to expose this method in a sub-class, do
    * using Constraint::set_bounds, as in LinearConstraint.
@@ -170,6 +193,7 @@ class Constraint : public EvaluatorBase {
 
   Eigen::VectorXd lower_bound_;
   Eigen::VectorXd upper_bound_;
+  optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
 };
 
 /**
@@ -244,6 +268,9 @@ class QuadraticConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
   Eigen::MatrixXd Q_;
   Eigen::VectorXd b_;
 };
@@ -302,6 +329,9 @@ class LorentzConeConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
   const Eigen::MatrixXd A_;
   const Eigen::VectorXd b_;
 };
@@ -354,6 +384,9 @@ class RotatedLorentzConeConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
   const Eigen::MatrixXd A_;
   const Eigen::VectorXd b_;
 };
@@ -399,6 +432,10 @@ class EvaluatorConstraint : public Constraint {
               AutoDiffVecXd& y) const override {
     evaluator_->Eval(x, y);
   }
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override {
+    evaluator_->EvalBatch(X, Y);
+  }
 
   std::shared_ptr<EvaluatorType> evaluator_;
 };
@@ -447,6 +484,9 @@ class PolynomialConstraint : public EvaluatorConstraint<PolynomialEvaluator> {
 
 /**
  * Implements a constraint of the form @f lb <= Ax <= ub @f
+ *
+ * The matrix A is stored as a sparse matrix. Solvers that accept sparse data
+ * should use get_sparse_A(), which does not allocate memory, instead of A().
  */
 class LinearConstraint : public Constraint {
  public:
@@ -456,20 +496,42 @@ class LinearConstraint : public Constraint {
   LinearConstraint(const Eigen::MatrixBase<DerivedA>& a,
                    const Eigen::MatrixBase<DerivedLB>& lb,
                    const Eigen::MatrixBase<DerivedUB>& ub)
-      : Constraint(a.rows(), a.cols(), lb, ub), A_(a) {
+      : Constraint(a.rows(), a.cols(), lb, ub), A_(a.sparseView()) {
     DRAKE_ASSERT(a.rows() == lb.rows());
   }
 
+  /**
+   * Constructs the constraint lb <= A * x <= ub from the sparse matrix A,
+   * without ever creating a dense copy of A.
+   */
+  LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+      : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
+    DRAKE_ASSERT(A.rows() == lb.rows());
+    A_.makeCompressed();
+  }
+
   ~LinearConstraint() override {}
 
-  virtual Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return A_.sparseView();
-  }
+  /** Returns a copy of the sparse matrix A. Prefer get_sparse_A(). */
+  virtual Eigen::SparseMatrix<double> GetSparseMatrix() const { return A_; }
+
+  /** Getter for the sparse matrix A, in compressed column-major form. */
+  const Eigen::SparseMatrix<double>& get_sparse_A() const { return A_; }
+
+  /**
+   * Getter for A as a dense matrix. The dense matrix is computed from the
+   * sparse matrix the first time this method is called after A changes, and
+   * stored until A changes again.
+   */
   virtual const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& A()
       const {
-    return A_;
+    if (!A_dense_is_valid_) {
+      A_dense_ = A_;
+      A_dense_is_valid_ = true;
+    }
+    return A_dense_;
   }
 
   /**
@@ -486,17 +548,23 @@ class LinearConstraint : public Constraint {
   void UpdateCoefficients(const Eigen::MatrixBase<DerivedA>& new_A,
                           const Eigen::MatrixBase<DerivedL>& new_lb,
                           const Eigen::MatrixBase<DerivedU>& new_ub) {
-    if (new_A.rows() != new_lb.rows() || new_lb.rows() != new_ub.rows() ||
-        new_lb.cols() != 1 || new_ub.cols() != 1) {
-      throw std::runtime_error("New constraints have invalid dimensions");
-    }
-
-    if (new_A.cols() != A_.cols()) {
-      throw std::runtime_error("Can't change the number of decision variables");
-    }
+    CheckNewCoefficientsDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                                   new_lb.cols(), new_ub.rows(),
+                                   new_ub.cols());
+    set_A(new_A.sparseView());
+    set_bounds(new_lb, new_ub);
+  }
 
-    A_ = new_A;
-    set_num_outputs(A_.rows());
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix new_A.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_A,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_ub) {
+    CheckNewCoefficientsDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                                   new_lb.cols(), new_ub.rows(),
+                                   new_ub.cols());
+    set_A(new_A);
     set_bounds(new_lb, new_ub);
   }
 
@@ -505,13 +573,37 @@ class LinearConstraint : public Constraint {
   using Constraint::set_bounds;
 
  protected:
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
-
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd& y) const override;
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
+
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
+ private:
+  // Throws std::runtime_error if the new A, lb and ub do not have consistent
+  // dimensions or if A does not have num_vars() columns.
+  void CheckNewCoefficientsDimensions(int A_rows, int A_cols, int lb_rows,
+                                      int lb_cols, int ub_rows,
+                                      int ub_cols) const;
+
+  // Sets A_ to new_A and invalidates the dense copy of A.
+  template <typename DerivedA>
+  void set_A(const DerivedA& new_A) {
+    A_ = new_A;
+    A_.makeCompressed();
+    A_dense_is_valid_ = false;
+    A_dense_.resize(0, 0);
+    set_num_outputs(A_.rows());
+  }
+
+  Eigen::SparseMatrix<double> A_;
+
+  // Dense copy of A_, only computed when requested through A().
+  mutable Eigen::MatrixXd A_dense_;
+  mutable bool A_dense_is_valid_{false};
 };
 
 /**
@@ -530,6 +622,14 @@ class LinearEqualityConstraint : public LinearConstraint {
                            double beq)
       : LinearEqualityConstraint(a, Vector1d(beq)) {}
 
+  /**
+   * Constructs the constraint Aeq * x = beq from the sparse matrix Aeq,
+   * without ever creating a dense copy of Aeq.
+   */
+  LinearEqualityConstraint(const Eigen::SparseMatrix<double>& Aeq,
+                           const Eigen::Ref<const Eigen::VectorXd>& beq)
+      : LinearConstraint(Aeq, beq, beq) {}
+
   ~LinearEqualityConstraint() override {}
 
   /*
@@ -545,6 +645,14 @@ class LinearEqualityConstraint : public LinearConstraint {
     LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
   }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix Aeq.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& Aeq,
+                          const Eigen::Ref<const Eigen::VectorXd>& beq) {
+    LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
+  }
+
  private:
   /**
    * The user should not call this function. Call UpdateCoefficients(Aeq, beq)
@@ -576,8 +684,7 @@ class BoundingBoxConstraint : public LinearConstraint {
   template <typename DerivedLB, typename DerivedUB>
   BoundingBoxConstraint(const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub)
-      : LinearConstraint(Eigen::MatrixXd::Identity(lb.rows(), lb.rows()), lb,
-                         ub) {}
+      : LinearConstraint(MakeSparseIdentity(lb.rows()), lb, ub) {}
 
   ~BoundingBoxConstraint() override {}
 
@@ -587,6 +694,12 @@ class BoundingBoxConstraint : public LinearConstraint {
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
+
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
+ private:
+  static Eigen::SparseMatrix<double> MakeSparseIdentity(int size);
 };
 
 /**
@@ -788,7 +901,9 @@ class LinearMatrixInequalityConstraint : public Constraint {
  * vector of symbolic Expression.  Expression::Evaluate is called on every
  * constraint evaluation.
  *
- * Uses symbolic::Jacobian to provide the gradients to the AutoDiff method.
+ * Uses symbolic::SparseJacobian to provide the gradients to the AutoDiff
+ * method, so that only the structurally nonzero entries of the gradients are
+ * evaluated.
  */
 class ExpressionConstraint : public Constraint {
  public:
@@ -815,7 +930,7 @@ class ExpressionConstraint : public Constraint {
 
  private:
   VectorX<symbolic::Expression> expressions_{0};
-  MatrixX<symbolic::Expression> derivatives_{0, 0};
+  Eigen::SparseMatrix<symbolic::Expression> derivatives_;
 
   // map_var_to_index_[vars_(i).get_id()] = i.
   VectorXDecisionVariable vars_{0};
@@ -21,6 +21,12 @@ void LinearCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   y(0) = a_.cast<AutoDiffXd>().dot(x) + b_;
 }
 
+void LinearCost::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                             Eigen::MatrixXd* Y) const {
+  *Y = a_.transpose() * X;
+  Y->array() += b_;
+}
+
 void QuadraticCost::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                            Eigen::VectorXd& y) const {
   y.resize(1);
@@ -36,6 +42,14 @@ void QuadraticCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   y(0) += c_;
 }
 
+void QuadraticCost::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                                Eigen::MatrixXd* Y) const {
+  const MatrixXd QX = Q_ * X;
+  *Y = .5 * (X.array() * QX.array()).colwise().sum().matrix() +
+       b_.transpose() * X;
+  Y->array() += c_;
+}
+
 shared_ptr<QuadraticCost> MakeQuadraticErrorCost(
     const Eigen::Ref<const MatrixXd>& Q,
     const Eigen::Ref<const VectorXd>& x_desired) {
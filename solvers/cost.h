@@ -83,6 +83,9 @@ class LinearCost : public Cost {
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
  private:
   Eigen::VectorXd a_;
   double b_{};
@@ -150,6 +153,9 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override;
+
   Eigen::MatrixXd Q_;
   Eigen::VectorXd b_;
   double c_{};
@@ -194,6 +200,10 @@ class EvaluatorCost : public Cost {
               AutoDiffVecXd& y) const override {
     evaluator_->Eval(x, y);
   }
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                   Eigen::MatrixXd* Y) const override {
+    evaluator_->EvalBatch(X, Y);
+  }
 
  private:
   std::shared_ptr<EvaluatorType> evaluator_;
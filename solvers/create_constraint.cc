@@ -28,10 +28,11 @@ using symbolic::Polynomial;
 using symbolic::Variable;
 using symbolic::Variables;
 
+using internal::DecomposeAffineExpressions;
 using internal::DecomposeLinearExpression;
 using internal::DecomposeQuadraticPolynomial;
-using internal::ExtractAndAppendVariablesFromExpression;
 using internal::ExtractVariablesFromExpression;
+using internal::IsAffineExpression;
 using internal::SymbolicError;
 
 
@@ -44,12 +45,7 @@ Binding<Constraint> ParseConstraint(
   bool is_linear = true;
   // Check that all elements are linear.
   for (int i = 0; i < v.size(); ++i) {
-    if (!v(i).is_polynomial()) {
-      is_linear = false;
-      break;
-    }
-    const Polynomial p{v(i)};
-    if (p.TotalDegree() > 1) {
+    if (!IsAffineExpression(v(i))) {
       is_linear = false;
       break;
     }
@@ -63,26 +59,32 @@ Binding<Constraint> ParseConstraint(
     return ParseLinearEqualityConstraint(v, lb);
   }
 
-  // Setup map_var_to_index and var_vec.
-  // such that map_var_to_index[var(i)] = i
-  unordered_map<Variable::Id, int> map_var_to_index;
-  VectorXDecisionVariable vars(0);
-  for (int i = 0; i < v.size(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
+  // Decompose v as A * vars + constant_terms, with a sparse A.
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant_terms;
+  VectorXDecisionVariable vars;
+  DecomposeAffineExpressions(v, &A, &constant_terms, &vars);
+  // The number of variables with a nonzero coefficient in each row, and the
+  // variable and coefficient of the last one.
+  std::vector<int> num_row_variables(v.size(), 0);
+  VectorXDecisionVariable bounding_box_x(v.size());
+  Eigen::VectorXd x_coeffs(v.size());
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      ++num_row_variables[it.row()];
+      bounding_box_x(it.row()) = vars(j);
+      x_coeffs(it.row()) = it.value();
+    }
   }
 
-  // Construct A, new_lb, new_ub. map_var_to_index is used here.
-  Eigen::MatrixXd A{Eigen::MatrixXd::Zero(v.size(), vars.size())};
   Eigen::VectorXd new_lb{v.size()};
   Eigen::VectorXd new_ub{v.size()};
   // We will determine if lb <= v <= ub is a bounding box constraint, namely
   // x_lb <= x <= x_ub.
   bool is_v_bounding_box = true;
   for (int i = 0; i < v.size(); ++i) {
-    double constant_term = 0;
-    int num_vi_variables = DecomposeLinearExpression(v(i), map_var_to_index,
-                                                     A.row(i), &constant_term);
-    if (num_vi_variables == 0 &&
+    const double constant_term = constant_terms(i);
+    if (num_row_variables[i] == 0 &&
         !(lb(i) <= constant_term && constant_term <= ub(i))) {
       // Unsatisfiable constraint with no variables, such as 1 <= 0 <= 2
       throw SymbolicError(v(i), lb(i), ub(i),
@@ -94,7 +96,7 @@ Binding<Constraint> ParseConstraint(
       new_ub(i) = ub(i) - constant_term;
       DRAKE_DEMAND(!std::isnan(new_lb(i)));
       DRAKE_DEMAND(!std::isnan(new_ub(i)));
-      if (num_vi_variables != 1) {
+      if (num_row_variables[i] != 1) {
         is_v_bounding_box = false;
       }
     }
@@ -102,17 +104,9 @@ Binding<Constraint> ParseConstraint(
   if (is_v_bounding_box) {
     // If every lb(i) <= v(i) <= ub(i) is a bounding box constraint, then
     // formulate a bounding box constraint x_lb <= x <= x_ub
-    VectorXDecisionVariable bounding_box_x(v.size());
     for (int i = 0; i < v.size(); ++i) {
       // v(i) is in the form of c * x
-      double x_coeff = 0;
-      for (const auto& x : v(i).GetVariables()) {
-        const double coeff = A(i, map_var_to_index[x.get_id()]);
-        if (coeff != 0) {
-          x_coeff += coeff;
-          bounding_box_x(i) = x;
-        }
-      }
+      const double x_coeff = x_coeffs(i);
       if (x_coeff > 0) {
         new_lb(i) /= x_coeff;
         new_ub(i) /= x_coeff;
@@ -388,19 +382,11 @@ Binding<LinearEqualityConstraint> DoParseLinearEqualityConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& b) {
   DRAKE_DEMAND(v.rows() == b.rows());
-  VectorXDecisionVariable vars(0);
-  unordered_map<Variable::Id, int> map_var_to_index;
-  for (int i = 0; i < v.rows(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
-  }
-  // TODO(hongkai.dai): use sparse matrix.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(v.rows(), vars.rows());
-  Eigen::VectorXd beq = Eigen::VectorXd::Zero(v.rows());
-  for (int i = 0; i < v.rows(); ++i) {
-    double constant_term(0);
-    DecomposeLinearExpression(v(i), map_var_to_index, A.row(i), &constant_term);
-    beq(i) = b(i) - constant_term;
-  }
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant_terms;
+  VectorXDecisionVariable vars;
+  DecomposeAffineExpressions(v, &A, &constant_terms, &vars);
+  const Eigen::VectorXd beq = b - constant_terms;
   return CreateBinding(make_shared<LinearEqualityConstraint>(A, beq), vars);
 }
 
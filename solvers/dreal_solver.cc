@@ -6,6 +6,10 @@
 #include <set>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 
 namespace drake {
 namespace solvers {
@@ -16,6 +20,7 @@ using std::pair;
 using std::runtime_error;
 using std::set;
 using std::unordered_map;
+using std::vector;
 
 namespace {
 
@@ -386,6 +391,36 @@ optional<DrealSolver::IntervalBox> DrealSolver::CheckSatisfiability(
   }
 }
 
+vector<optional<DrealSolver::IntervalBox>> DrealSolver::CheckSatisfiability(
+    const vector<symbolic::Formula>& formulas, const double delta,
+    const int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  // Maps each formula to the first formula that is structurally equal to it.
+  unordered_map<symbolic::Formula, int> unique_index;
+  vector<const symbolic::Formula*> unique_formulas;
+  vector<int> index_of(formulas.size());
+  for (size_t i = 0; i < formulas.size(); ++i) {
+    const auto insert_result =
+        unique_index.emplace(formulas[i], unique_formulas.size());
+    if (insert_result.second) {
+      unique_formulas.push_back(&formulas[i]);
+    }
+    index_of[i] = insert_result.first->second;
+  }
+
+  vector<optional<IntervalBox>> unique_results(unique_formulas.size());
+  ParallelFor(unique_formulas.size(), num_threads, [&](const int i) {
+    unique_results[i] = CheckSatisfiability(*unique_formulas[i], delta);
+  });
+
+  vector<optional<IntervalBox>> results;
+  results.reserve(formulas.size());
+  for (const int index : index_of) {
+    results.push_back(unique_results[index]);
+  }
+  return results;
+}
+
 optional<DrealSolver::IntervalBox> DrealSolver::Minimize(
     const symbolic::Expression& objective, const symbolic::Formula& constraint,
     const double delta) {
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <dreal/dreal.h>
 
@@ -44,6 +45,18 @@ class DrealSolver : public MathematicalProgramSolverInterface {
   static optional<IntervalBox> CheckSatisfiability(const symbolic::Formula& f,
                                                    double delta);
 
+  /// Checks the satisfiability of each of @p formulas with a given precision
+  /// @p delta, as CheckSatisfiability(f, delta) does. The formulas are checked
+  /// in separate dReal contexts, on up to @p num_threads threads. Formulas that
+  /// are structurally equal (see symbolic::Formula::EqualTo) are checked only
+  /// once.
+  ///
+  /// @returns the result for each formula, in the order of @p formulas.
+  /// @throws std::runtime_error if @p num_threads is not positive.
+  static std::vector<optional<IntervalBox>> CheckSatisfiability(
+      const std::vector<symbolic::Formula>& formulas, double delta,
+      int num_threads = 1);
+
   /// Finds a solution to minimize @p objective function while satisfying a
   /// given @p constraint using @p delta.
   ///
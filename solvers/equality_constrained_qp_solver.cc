@@ -130,10 +130,7 @@ SolutionResult EqualityConstrainedQPSolver::Solve(
     constant_term += binding.evaluator()->c();
     int num_v_variables = binding.variables().rows();
 
-    std::vector<size_t> v_index(num_v_variables);
-    for (int i = 0; i < num_v_variables; ++i) {
-      v_index[i] = prog.FindDecisionVariableIndex(binding.variables()(i));
-    }
+    const std::vector<int> v_index = prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < num_v_variables; ++i) {
       for (int j = 0; j < num_v_variables; ++j) {
         G(v_index[i], v_index[j]) += Q(i, j);
@@ -145,10 +142,10 @@ SolutionResult EqualityConstrainedQPSolver::Solve(
     const auto& a = binding.evaluator()->a();
     constant_term += binding.evaluator()->b();
     int num_v_variables = binding.variables().rows();
+    const std::vector<int> v_index = prog.FindDecisionVariableIndices(binding);
 
     for (int i = 0; i < num_v_variables; ++i) {
-      auto v_index_i = prog.FindDecisionVariableIndex(binding.variables()(i));
-      c(v_index_i) += a(i);
+      c(v_index[i]) += a(i);
     }
   }
 
@@ -164,10 +161,10 @@ SolutionResult EqualityConstrainedQPSolver::Solve(
       size_t n = bc->A().rows();
 
       int num_v_variables = binding.variables().rows();
+      const std::vector<int> v_index =
+          prog.FindDecisionVariableIndices(binding);
       for (int i = 0; i < num_v_variables; ++i) {
-        A.block(constraint_index,
-                prog.FindDecisionVariableIndex(binding.variables()(i)), n, 1) =
-            bc->A().col(i);
+        A.block(constraint_index, v_index[i], n, 1) = bc->A().col(i);
       }
 
       b.segment(constraint_index, n) =
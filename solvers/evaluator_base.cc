@@ -8,6 +8,16 @@ using Eigen::VectorXd;
 namespace drake {
 namespace solvers {
 
+void EvaluatorBase::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                                Eigen::MatrixXd* Y) const {
+  Y->resize(num_outputs(), X.cols());
+  Eigen::VectorXd y(num_outputs());
+  for (int j = 0; j < X.cols(); ++j) {
+    DoEval(X.col(j), y);
+    Y->col(j) = y;
+  }
+}
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
                                  Eigen::VectorXd &y) const {
   double_evaluation_point_temp_.clear();
@@ -60,6 +60,22 @@ class EvaluatorBase {
     DoEval(x, y);
   }
 
+  /**
+   * Evaluates the expression at several points at once, with a scalar type of
+   * double. This is equivalent to calling Eval() on each column of @p X, but
+   * evaluators with a closed form (e.g. linear or quadratic ones) evaluate
+   * the whole batch with a few matrix products.
+   * @param X A `num_vars` x N matrix, one point per column.
+   * @param[out] Y A `num_outputs` x N matrix, whose column j is the value of
+   * the expression at `X.col(j)`.
+   */
+  void EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                 Eigen::MatrixXd* Y) const {
+    DRAKE_DEMAND(Y != nullptr);
+    DRAKE_ASSERT(X.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DoEvalBatch(X, Y);
+  }
+
   /**
    * Set a human-friendly description for the evaluator.
    */
@@ -84,6 +100,14 @@ class EvaluatorBase {
    */
   int num_outputs() const { return num_outputs_; }
 
+  /**
+   * Returns true if Eval() may be called concurrently from multiple threads on
+   * this evaluator. Solvers can then evaluate several bindings of this
+   * evaluator in parallel. By default evaluators are not considered thread
+   * safe, since many of them use mutable scratch storage.
+   */
+  virtual bool is_thread_safe() const { return false; }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -121,6 +145,18 @@ class EvaluatorBase {
                       // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
                       AutoDiffVecXd& y) const = 0;
 
+  /**
+   * Implements batched evaluation for scalar type double. The default
+   * implementation calls DoEval() once per column of @p X; override it when
+   * the batch can be evaluated more efficiently as a whole.
+   * @param X Input matrix, one point per column.
+   * @param Y Output matrix.
+   * @pre X must be of size `num_vars` x N, and Y must not be null.
+   * @post Y will be of size `num_outputs` x N.
+   */
+  virtual void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                           Eigen::MatrixXd* Y) const;
+
   // Setter for the number of outputs.
   // This method is only meant to be called, if the sub-class structure permits
   // to change the number of outputs. One example is LinearConstraint in
@@ -6,14 +6,14 @@
 #include <Eigen/Dense>
 
 int fastQPThatTakesQinv(
-  std::vector<Eigen::MatrixXd*> QinvblkDiag, const Eigen::VectorXd& f,
+  const std::vector<Eigen::MatrixXd*>& QinvblkDiag, const Eigen::VectorXd& f,
   const Eigen::MatrixXd& Aeq, const Eigen::VectorXd& beq,
   const Eigen::MatrixXd& Ain, const Eigen::VectorXd& bin,
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
   std::set<int>& active, Eigen::VectorXd& x);
 
 int fastQP(
-  std::vector<Eigen::MatrixXd*> QblkDiag, const Eigen::VectorXd& f,
+  const std::vector<Eigen::MatrixXd*>& QblkDiag, const Eigen::VectorXd& f,
   const Eigen::MatrixXd& Aeq, const Eigen::VectorXd& beq,
   const Eigen::MatrixXd& Ain, const Eigen::VectorXd& bin,
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
@@ -15,7 +15,7 @@
   }
 
 GRBmodel* gurobiQP(
-  GRBenv* env, std::vector<Eigen::MatrixXd*> QblkDiag,
+  GRBenv* env, const std::vector<Eigen::MatrixXd*>& QblkDiag,
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
   Eigen::VectorXd& f,
   const Eigen::MatrixXd& Aeq, const Eigen::VectorXd& beq,
@@ -34,7 +34,7 @@ GRBmodel* gurobiQP(
 // std::set<int>& active, Eigen::VectorXd& x);
 
 GRBmodel* gurobiActiveSetQP(
-  GRBenv* env, std::vector<Eigen::MatrixXd*> QblkDiag,
+  GRBenv* env, const std::vector<Eigen::MatrixXd*>& QblkDiag,
   // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
   Eigen::VectorXd& f,
   const Eigen::MatrixXd& Aeq, const Eigen::VectorXd& beq,
@@ -1,9 +1,12 @@
 #include "drake/solvers/gurobi_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -201,34 +204,38 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
  * @return error as an integer. The full set of error values are
  * described here :
  * https://www.gurobi.com/documentation/7.5/refman/error_codes.html
- *
- * TODO(hongkai.dai): Use a sparse matrix A.
  */
-template <typename DerivedA, typename DerivedLB, typename DerivedUB>
+template <typename DerivedLB, typename DerivedUB>
 int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::MatrixBase<DerivedA>& A,
+                        const Eigen::SparseMatrix<double>& A,
                         const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub,
                         const Eigen::Ref<const VectorXDecisionVariable>& vars,
                         bool is_equality, double sparseness_threshold) {
-  for (int i = 0; i < A.rows(); i++) {
-    int nonzero_coeff_count = 0;
-    std::vector<int> nonzero_var_index(A.cols(), 0);
-    std::vector<double> nonzero_coeff(A.cols(), 0.0);
-
-    for (int j = 0; j < A.cols(); j++) {
-      if (std::abs(A(i, j)) > sparseness_threshold) {
-        nonzero_coeff[nonzero_coeff_count] = A(i, j);
-        nonzero_var_index[nonzero_coeff_count++] =
-            prog.FindDecisionVariableIndex(vars(j));
+  // Gurobi adds the constraints row by row, so we traverse A by rows.
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
+  const std::vector<int> var_indices = prog.FindDecisionVariableIndices(vars);
+  std::vector<int> nonzero_var_index;
+  std::vector<double> nonzero_coeff;
+  for (int i = 0; i < A_row_major.rows(); i++) {
+    nonzero_var_index.clear();
+    nonzero_coeff.clear();
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+             A_row_major, i);
+         it; ++it) {
+      if (std::abs(it.value()) > sparseness_threshold) {
+        nonzero_coeff.push_back(it.value());
+        nonzero_var_index.push_back(var_indices[it.col()]);
       }
     }
+    const int nonzero_coeff_count = static_cast<int>(nonzero_coeff.size());
     // The sense of the constraint could be ==, <= or >=
     int error = 0;
     if (is_equality) {
       // Adds equality constraint.
-      error = GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_EQUAL, lb(i), nullptr);
+      error = GRBaddconstr(model, nonzero_coeff_count,
+                           nonzero_var_index.data(), nonzero_coeff.data(),
+                           GRB_EQUAL, lb(i), nullptr);
       DRAKE_ASSERT(!error);
       if (error) return error;
     } else {
@@ -236,16 +243,16 @@ int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
         if (!std::isinf(lb(i))) {
           // Adds A.row(i)*x >= lb(i).
           error = GRBaddconstr(model, nonzero_coeff_count,
-                               &nonzero_var_index[0], &nonzero_coeff[0],
+                               nonzero_var_index.data(), nonzero_coeff.data(),
                                GRB_GREATER_EQUAL, lb(i), nullptr);
           DRAKE_ASSERT(!error);
           if (error) return error;
         }
         if (!std::isinf(ub(i))) {
           // Adds A.row(i)*x <= ub(i).
-          error =
-              GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_LESS_EQUAL, ub(i), nullptr);
+          error = GRBaddconstr(model, nonzero_coeff_count,
+                               nonzero_var_index.data(), nonzero_coeff.data(),
+                               GRB_LESS_EQUAL, ub(i), nullptr);
           DRAKE_ASSERT(!error);
           if (error) return error;
         }
@@ -303,8 +310,10 @@ int AddSecondOrderConeConstraints(
                                 0);  // Records the indices of [x;z(i)],
                                      // Namely the variables in the i'th
                                      // row of z - A*x = b
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < num_x; ++i) {
-      xz_indices[i] = prog.FindDecisionVariableIndex(binding.variables()(i));
+      xz_indices[i] = x_indices[i];
     }
     Eigen::RowVectorXd coeff_i(num_x + 1);  // Records the coefficients of the
                                             // i'th row in z - A*x = b
@@ -405,12 +414,8 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
 
     // constraint_variable_index[i] is the index of the i'th decision variable
     // binding.GetFlattendSolution(i).
-    std::vector<int> constraint_variable_index(constraint_variable_dimension);
-
-    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      constraint_variable_index[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-    }
+    const std::vector<int> constraint_variable_index =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int i = 0; i < Q.rows(); i++) {
       const double Qii = 0.5 * Q(i, i);
@@ -440,10 +445,12 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
     const auto& constraint = binding.evaluator();
     const auto& a = constraint->a();
     constant_cost += constraint->b();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      b_nonzero_coefs.push_back(Eigen::Triplet<double>(
-          prog.FindDecisionVariableIndex(binding.variables()(i)), 0, a(i)));
+      b_nonzero_coefs.push_back(
+          Eigen::Triplet<double>(var_indices[i], 0, a(i)));
     }
   }
 
@@ -502,7 +509,7 @@ int ProcessLinearConstraints(GRBmodel* model, MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), true,
         sparseness_threshold);
     if (error) {
@@ -514,7 +521,7 @@ int ProcessLinearConstraints(GRBmodel* model, MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), false,
         sparseness_threshold);
     if (error) {
@@ -602,14 +609,86 @@ void AddSecondOrderConeVariables(
 }
 }  // anonymous namespace
 
+/*
+ * Implements RAII for a Gurobi environment, and its license checkout.
+ */
+class GurobiSolver::License {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(License)
+
+  License() { GRBloadenv(&env_, nullptr); }
+
+  ~License() {
+    GRBfreeenv(env_);
+    env_ = nullptr;  // Fail-fast if accidentally used after destruction.
+  }
+
+  GRBenv* env() const { return env_; }
+
+ private:
+  GRBenv* env_{nullptr};
+};
+
+std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireLicense() {
+  // Gurobi environments are not thread safe, hence each thread keeps its own.
+  // The environment is freed once the last shared_ptr to it is released.
+  thread_local std::weak_ptr<License> thread_license;
+  std::shared_ptr<License> license = thread_license.lock();
+  if (!license) {
+    license = std::make_shared<License>();
+    thread_license = license;
+  }
+  return license;
+}
+
+class GurobiSolver::Session {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Session)
+
+  // A persistent session owns its environment, since the solver owning it
+  // may be used on different threads. Otherwise the session shares the
+  // environment of the calling thread, if any, see AcquireLicense().
+  explicit Session(bool persistent)
+      : license_(persistent ? std::make_shared<License>()
+                            : AcquireLicense()) {}
+
+  GRBenv* env() const { return license_->env(); }
+
+  // The decision variable values of the last successful solve, empty if none.
+  const Eigen::VectorXd& last_solution() const { return last_solution_; }
+  void set_last_solution(const Eigen::VectorXd& x) { last_solution_ = x; }
+
+ private:
+  std::shared_ptr<License> license_;
+  Eigen::VectorXd last_solution_;
+};
+
+GurobiSolver::GurobiSolver() = default;
+
+GurobiSolver::~GurobiSolver() = default;
+
+void GurobiSolver::set_persistent_session(bool persistent_session) {
+  persistent_session_ = persistent_session;
+  if (!persistent_session_) session_.reset();
+}
+
 bool GurobiSolver::available() const { return true; }
 
 SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
   // We only process quadratic costs and linear / bounding box
   // constraints.
 
-  GRBenv* env = nullptr;
-  GRBloadenv(&env, nullptr);
+  const auto setup_start = std::chrono::steady_clock::now();
+
+  // In the persistent session mode the environment outlives this call.
+  // Otherwise local_session releases it before returning, unless the calling
+  // thread holds it through AcquireLicense().
+  std::unique_ptr<Session> local_session;
+  if (!persistent_session_ || !session_) {
+    local_session = std::make_unique<Session>(persistent_session_);
+  }
+  Session* session = local_session ? local_session.get() : session_.get();
+  GRBenv* env = session->env();
 
   DRAKE_ASSERT(prog.generic_costs().empty());
   DRAKE_ASSERT(prog.generic_constraints().empty());
@@ -660,9 +739,11 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
     const auto& constraint = binding.evaluator();
     const Eigen::VectorXd& lower_bound = constraint->lower_bound();
     const Eigen::VectorXd& upper_bound = constraint->upper_bound();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const int idx = prog.FindDecisionVariableIndex(binding.variables()(k));
+      const int idx = var_indices[k];
       xlow[idx] = std::max(lower_bound(k), xlow[idx]);
       xupp[idx] = std::min(upper_bound(k), xupp[idx]);
     }
@@ -737,10 +818,18 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
     DRAKE_DEMAND(!error);
   }
 
+  // Variables without an initial guess start from the previous solution when
+  // it is available.
+  const bool has_last_solution =
+      session->last_solution().size() == prog.num_vars();
   for (int i = 0; i < static_cast<int>(prog.num_vars()); ++i) {
     if (!std::isnan(prog.initial_guess()(i))) {
       error = GRBsetdblattrelement(model, "Start", i, prog.initial_guess()(i));
       DRAKE_DEMAND(!error);
+    } else if (has_last_solution) {
+      error = GRBsetdblattrelement(model, "Start", i,
+                                   session->last_solution()(i));
+      DRAKE_DEMAND(!error);
     }
   }
 
@@ -763,7 +852,9 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
     GRBsetcallbackfunc(model, &gurobi_callback, &callback_info);
   }
 
+  const auto solve_start = std::chrono::steady_clock::now();
   error = GRBoptimize(model);
+  const auto solve_end = std::chrono::steady_clock::now();
 
   SolutionResult solution_result = SolutionResult::kUnknownError;
 
@@ -771,6 +862,29 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
   // TODO(naveenoid) : Properly handle Gurobi specific error.
   // message.
   SolverResult& solver_result = callback_info.solver_result;
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  int num_nonzeros = 0;
+  int num_q_nonzeros = 0;
+  int num_qc_nonzeros = 0;
+  if (!GRBgetintattr(model, GRB_INT_ATTR_NUMNZS, &num_nonzeros) &&
+      !GRBgetintattr(model, GRB_INT_ATTR_NUMQNZS, &num_q_nonzeros) &&
+      !GRBgetintattr(model, GRB_INT_ATTR_NUMQCNZS, &num_qc_nonzeros)) {
+    statistics.num_nonzeros = num_nonzeros + num_q_nonzeros + num_qc_nonzeros;
+  }
+  if (!error) {
+    // Gurobi counts the simplex and the barrier iterations separately.
+    double num_simplex_iterations = 0;
+    int num_barrier_iterations = 0;
+    GRBgetdblattr(model, GRB_DBL_ATTR_ITERCOUNT, &num_simplex_iterations);
+    GRBgetintattr(model, GRB_INT_ATTR_BARITERCOUNT, &num_barrier_iterations);
+    statistics.num_iterations =
+        static_cast<int>(num_simplex_iterations) + num_barrier_iterations;
+  }
+  solver_result.set_statistics(statistics);
   if (error) {
     solution_result = SolutionResult::kInvalidInput;
     drake::log()->info("Gurobi returns code {}, with message \"{}\".\n", error,
@@ -818,6 +932,7 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
       SetProgramSolutionVector(is_new_variable, solver_sol_vector,
                                &prog_sol_vector);
       solver_result.set_decision_variable_values(prog_sol_vector);
+      session->set_last_solution(prog_sol_vector);
 
       // Obtain optimal cost.
       double optimal_cost = std::numeric_limits<double>::quiet_NaN();
@@ -844,7 +959,9 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
   prog.SetSolverResult(solver_result);
 
   GRBfreemodel(model);
-  GRBfreeenv(env);
+  if (persistent_session_ && local_session) {
+    session_ = std::move(local_session);
+  }
 
   return solution_result;
 }
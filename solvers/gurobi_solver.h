@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 
 #include "drake/common/autodiff.h"
@@ -15,8 +16,8 @@ class GurobiSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GurobiSolver)
 
-  GurobiSolver() = default;
-  ~GurobiSolver() override = default;
+  GurobiSolver();
+  ~GurobiSolver() override;
 
   // This solver is implemented in various pieces depending on if
   // Gurobi was available during compilation.
@@ -110,11 +111,53 @@ class GurobiSolver : public MathematicalProgramSolverInterface {
   /// @return same as MathematicalProgramSolverInterface::solver_id()
   static SolverId id();
 
+  /// Enables or disables the persistent session mode. By default, every call
+  /// to Solve() loads a new Gurobi environment, which includes checking out a
+  /// license. When this mode is enabled, the environment is kept after Solve()
+  /// returns and reused by the following calls. Additionally, the solution of
+  /// the previous call is used as the start point for the decision variables
+  /// whose initial guess is not set, provided the program has the same number
+  /// of decision variables. Disabling this mode releases the environment.
+  /// @note The session is stored within this solver, and therefore calls to
+  /// Solve() must not be made concurrently from different threads.
+  void set_persistent_session(bool persistent_session);
+
+  /// Returns `true` if the persistent session mode is enabled.
+  /// @see set_persistent_session().
+  bool persistent_session() const { return persistent_session_; }
+
+  /// This type contains a valid Gurobi environment, and is only to be used
+  /// from AcquireLicense().
+  class License;
+
+  /// Acquires a Gurobi environment, including its license checkout, for the
+  /// calling thread. While any shared_ptr returned by this function on a
+  /// thread is alive, the calls to Solve() on that thread from any
+  /// GurobiSolver reuse its environment instead of loading a new one (unless
+  /// the solver is in the persistent session mode, which keeps its own).
+  /// Gurobi environments must not be used concurrently, so each thread
+  /// acquires an environment of its own.
+  /// Call this when solving many programs in sequence, e.g. in
+  /// branch-and-bound or model predictive control, where loading an
+  /// environment for every solve is costly.
+  /// @return A shared pointer to an environment that stays valid as long as
+  /// any shared_ptr returned by this function on this thread is alive. If
+  /// Gurobi is not available in your build, this returns a null (empty)
+  /// shared_ptr.
+  static std::shared_ptr<License> AcquireLicense();
+
  private:
+  // Holds the Gurobi environment and the last solution. Defined in the
+  // translation unit.
+  class Session;
+
   // Callbacks and generic user data to pass through,
   // or NULL if no callback has been supplied.
   MipNodeCallbackFunction mip_node_callback_;
   MipSolCallbackFunction mip_sol_callback_;
+
+  bool persistent_session_{false};
+  mutable std::unique_ptr<Session> session_;
 };
 
 }  // end namespace solvers
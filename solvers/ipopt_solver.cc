@@ -1,12 +1,14 @@
 #include "drake/solvers/ipopt_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <limits>
 #include <memory>
 #include <vector>
 
 #include <IpIpoptApplication.hpp>
+#include <IpIpoptData.hpp>
 #include <IpTNLP.hpp>
 
 #include "drake/common/drake_assert.h"
@@ -39,11 +41,17 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
   return c.num_constraints();
 }
 
-/// @param[out] num_grad number of gradients
+/// @param[out] num_grad number of gradients, i.e., the number of entries of
+/// the gradient sparsity pattern of @p c if it has one, or all of the entries
+/// of its gradient otherwise.
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -59,17 +67,25 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
 /// @return the number of row/column pairs filled in.
-size_t GetGradientMatrix(
-    const MathematicalProgram& prog, const Constraint& c,
-    const Eigen::Ref<const VectorXDecisionVariable>& variables,
-    Index constraint_idx, Index* iRow, Index* jCol) {
+size_t GetGradientMatrix(const Constraint& c,
+                         const std::vector<int>& variable_indices,
+                         Index constraint_idx, Index* iRow, Index* jCol) {
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern()) {
+    for (const auto& entry : *c.gradient_sparsity_pattern()) {
+      iRow[grad_index] = constraint_idx + entry.first;
+      jCol[grad_index] = variable_indices[entry.second];
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
-    for (int j = 0; j < variables.rows(); ++j) {
+    for (int variable_index : variable_indices) {
       iRow[grad_index] = constraint_idx + i;
-      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
+      jCol[grad_index] = variable_index;
       grad_index++;
     }
   }
@@ -91,9 +107,8 @@ Eigen::VectorXd MakeEigenVector(Index n, const Number* x) {
 /// GetGradientMatrix.
 ///
 /// @return number of gradient entries populated.
-size_t EvaluateConstraint(const MathematicalProgram& prog,
-                          const Eigen::VectorXd& xvec, const Constraint& c,
-                          const VectorXDecisionVariable& variables,
+size_t EvaluateConstraint(const Eigen::VectorXd& xvec, const Constraint& c,
+                          const std::vector<int>& variable_indices,
                           Number* result, Number* grad) {
   // For constraints which don't use all of the variables in the X
   // input, extract a subset into the AutoDiffVecXd this_x to evaluate
@@ -102,10 +117,10 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   // the correct geometry (e.g. the constraint uses all decision
   // variables in the same order they appear in xvec), but this is not
   // currently done).
-  int num_v_variables = variables.rows();
+  int num_v_variables = variable_indices.size();
   Eigen::VectorXd this_x(num_v_variables);
   for (int i = 0; i < num_v_variables; ++i) {
-    this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
+    this_x(i) = xvec(variable_indices[i]);
   }
 
   AutoDiffVecXd ty(c.num_constraints());
@@ -121,8 +136,15 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   // gradient array.
   size_t grad_idx = 0;
 
+  if (c.gradient_sparsity_pattern()) {
+    for (const auto& entry : *c.gradient_sparsity_pattern()) {
+      grad[grad_idx++] = ty(entry.first).derivatives()(entry.second);
+    }
+    return grad_idx;
+  }
+
   for (int i = 0; i < c.num_constraints(); i++) {
-    for (int j = 0; j < variables.rows(); j++) {
+    for (int j = 0; j < num_v_variables; j++) {
       grad[grad_idx++] = ty(i).derivatives()(j);
     }
   }
@@ -204,6 +226,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     }
 
     constraint_cache_.reset(new ResultCache(n, m, nnz_jac_g));
+    num_nonzeros_ = nnz_jac_g;
 
     nnz_h_lag = 0;
     index_style = C_STYLE;
@@ -224,9 +247,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
       const auto& c = binding.evaluator();
       const auto& lower_bound = c->lower_bound();
       const auto& upper_bound = c->upper_bound();
+      const std::vector<int> var_indices =
+          problem_->FindDecisionVariableIndices(binding);
       for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-        const int idx =
-            problem_->FindDecisionVariableIndex(binding.variables()(k));
+        const int idx = var_indices[k];
         x_l[idx] = std::max(lower_bound(k), x_l[idx]);
         x_u[idx] = std::min(upper_bound(k), x_u[idx]);
       }
@@ -332,31 +356,36 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
                                   // GetGradientMatrix.
       for (const auto& c : problem_->generic_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
+            GetGradientMatrix(*(c.evaluator()),
+                              problem_->FindDecisionVariableIndices(c),
                               constraint_idx, iRow + grad_idx, jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->lorentz_cone_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
+            GetGradientMatrix(*(c.evaluator()),
+                              problem_->FindDecisionVariableIndices(c),
                               constraint_idx, iRow + grad_idx, jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
+            GetGradientMatrix(*(c.evaluator()),
+                              problem_->FindDecisionVariableIndices(c),
                               constraint_idx, iRow + grad_idx, jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->linear_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
+            GetGradientMatrix(*(c.evaluator()),
+                              problem_->FindDecisionVariableIndices(c),
                               constraint_idx, iRow + grad_idx, jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->linear_equality_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
+            GetGradientMatrix(*(c.evaluator()),
+                              problem_->FindDecisionVariableIndices(c),
                               constraint_idx, iRow + grad_idx, jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
@@ -384,9 +413,14 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
                                  const Number* g, const Number* lambda,
                                  Number obj_value, const IpoptData* ip_data,
                                  IpoptCalculatedQuantities* ip_cq) {
-    unused(z_L, z_U, m, g, lambda, ip_data, ip_cq);
+    unused(z_L, z_U, m, g, lambda, ip_cq);
 
-    SolverResult solver_result(IpoptSolver::id());
+    solver_result_.emplace(IpoptSolver::id());
+    SolverResult& solver_result = *solver_result_;
+    SolverStatistics statistics;
+    if (ip_data) statistics.num_iterations = ip_data->iter_count();
+    statistics.num_nonzeros = num_nonzeros_;
+    solver_result.set_statistics(statistics);
 
     switch (status) {
       case Ipopt::SUCCESS: {
@@ -422,11 +456,14 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     }
     solver_result.set_decision_variable_values(solution.cast<double>());
     solver_result.set_optimal_cost(obj_value);
-    problem_->SetSolverResult(solver_result);
   }
 
   SolutionResult result() const { return result_; }
 
+  // The result of the solve, to be passed to the program once the solve
+  // completes; empty if IPOPT did not finalize the solution.
+  optional<SolverResult>& solver_result() { return solver_result_; }
+
  private:
   void EvaluateCosts(Index n, const Number* x) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
@@ -440,10 +477,11 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
 
     for (auto const& binding : problem_->GetAllCosts()) {
       int num_v_variables = binding.GetNumElements();
+      const std::vector<int> var_indices =
+          problem_->FindDecisionVariableIndices(binding);
       this_x.resize(num_v_variables);
       for (int i = 0; i < num_v_variables; ++i) {
-        this_x(i) =
-            xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
+        this_x(i) = xvec(var_indices[i]);
       }
 
       binding.evaluator()->Eval(math::initializeAutoDiff(this_x), ty);
@@ -451,8 +489,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
       cost_cache_->result[0] += ty(0).value();
 
       for (int j = 0; j < num_v_variables; ++j) {
-        const size_t vj_index =
-            problem_->FindDecisionVariableIndex(binding.variables()(j));
+        const int vj_index = var_indices[j];
         cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
       }
     }
@@ -466,28 +503,33 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* grad = constraint_cache_->grad.data();
 
     for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+      grad += EvaluateConstraint(xvec, (*c.evaluator()),
+                                 problem_->FindDecisionVariableIndices(c),
+                                 result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+      grad += EvaluateConstraint(xvec, (*c.evaluator()),
+                                 problem_->FindDecisionVariableIndices(c),
+                                 result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+      grad += EvaluateConstraint(xvec, (*c.evaluator()),
+                                 problem_->FindDecisionVariableIndices(c),
+                                 result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+      grad += EvaluateConstraint(xvec, (*c.evaluator()),
+                                 problem_->FindDecisionVariableIndices(c),
+                                 result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+      grad += EvaluateConstraint(xvec, (*c.evaluator()),
+                                 problem_->FindDecisionVariableIndices(c),
+                                 result, grad);
       result += c.evaluator()->num_constraints();
     }
   }
@@ -496,6 +538,8 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   SolutionResult result_;
+  Index num_nonzeros_{0};
+  optional<SolverResult> solver_result_;
 };
 
 }  // namespace
@@ -504,6 +548,7 @@ bool IpoptSolver::available() const { return true; }
 
 SolutionResult IpoptSolver::Solve(MathematicalProgram& prog) const {
   DRAKE_ASSERT(prog.linear_complementarity_constraints().empty());
+  const auto setup_start = std::chrono::steady_clock::now();
 
   Ipopt::SmartPtr<Ipopt::IpoptApplication> app = IpoptApplicationFactory();
   app->RethrowNonIpoptException(true);
@@ -538,7 +583,20 @@ SolutionResult IpoptSolver::Solve(MathematicalProgram& prog) const {
   }
 
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp = new IpoptSolver_NLP(&prog);
+  const auto solve_start = std::chrono::steady_clock::now();
   status = app->OptimizeTNLP(nlp);
+  const auto solve_end = std::chrono::steady_clock::now();
+
+  if (nlp->solver_result()) {
+    SolverResult& solver_result = *nlp->solver_result();
+    SolverStatistics statistics = solver_result.statistics();
+    statistics.setup_time =
+        std::chrono::duration<double>(solve_start - setup_start).count();
+    statistics.solve_time =
+        std::chrono::duration<double>(solve_end - solve_start).count();
+    solver_result.set_statistics(statistics);
+    prog.SetSolverResult(solver_result);
+  }
 
   return nlp->result();
 }
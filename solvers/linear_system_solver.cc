@@ -35,9 +35,10 @@ SolutionResult LinearSystemSolver::Solve(MathematicalProgram& prog) const {
   for (auto const& binding : prog.linear_equality_constraints()) {
     auto const& c = binding.evaluator();
     size_t n = c->A().rows();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      size_t variable_index =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
+      size_t variable_index = var_indices[i];
       Aeq.block(constraint_index, variable_index, n, 1) = c->A().col(i);
     }
     beq.segment(constraint_index, n) =
@@ -18,6 +18,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
+#include "drake/common/trace.h"
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -113,6 +114,37 @@ AttributesSet kSnoptCapabilities =
 bool is_satisfied(AttributesSet required, AttributesSet available) {
   return ((required & ~available) == kNoCapabilities);
 }
+
+// Builds the sparse matrix A and the variables vars, such that row i of
+// A * vars is the sum of the terms in row i. The variables are in the order of
+// their first appearance in the terms.
+void BuildSparseLinearConstraint(const std::vector<LinearTerm>& terms,
+                                 int num_rows, Eigen::SparseMatrix<double>* A,
+                                 VectorXDecisionVariable* vars) {
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  std::vector<Variable> var_vec;
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(terms.size());
+  for (const LinearTerm& term : terms) {
+    if (term.row < 0 || term.row >= num_rows) {
+      throw std::runtime_error(fmt::format(
+          "The row {} of the term {} * {} is not within [0, {}).", term.row,
+          term.coefficient, term.variable.get_name(), num_rows));
+    }
+    const auto it =
+        map_var_to_index.emplace(term.variable.get_id(), var_vec.size());
+    if (it.second) {
+      var_vec.push_back(term.variable);
+    }
+    A_triplets.emplace_back(term.row, it.first->second, term.coefficient);
+  }
+  A->resize(num_rows, var_vec.size());
+  A->setFromTriplets(A_triplets.begin(), A_triplets.end());
+  vars->resize(var_vec.size());
+  for (int i = 0; i < static_cast<int>(var_vec.size()); ++i) {
+    (*vars)(i) = var_vec[i];
+  }
+}
 }  // namespace
 
 constexpr double MathematicalProgram::kGlobalInfeasibleCost;
@@ -138,11 +170,16 @@ std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
   // The constructor of MathematicalProgram will construct each solver. It
   // also sets x_values_ and x_initial_guess_ to default values.
   auto new_prog = std::make_unique<MathematicalProgram>();
-  // Add variables and indeterminates
-  // AddDecisionVariables and AddIndeterminates also set
-  // decision_variable_index_ and indeterminate_index_ properly.
-  new_prog->AddDecisionVariables(decision_variables_);
-  new_prog->AddIndeterminates(indeterminates_);
+  // Copy the variables and indeterminates together with their indices. This
+  // program already checked them when they were added, so there is no need to
+  // add them one by one again, which is expensive for the large programs
+  // cloned at each node of a branch-and-bound.
+  new_prog->decision_variables_ = decision_variables_;
+  new_prog->decision_variable_index_ = decision_variable_index_;
+  new_prog->indeterminates_ = indeterminates_;
+  new_prog->indeterminates_index_ = indeterminates_index_;
+  new_prog->x_values_ = Eigen::VectorXd::Constant(
+      num_vars(), numeric_limits<double>::quiet_NaN());
   // Add costs
   new_prog->generic_costs_ = generic_costs_;
   new_prog->quadratic_costs_ = quadratic_costs_;
@@ -236,21 +273,45 @@ symbolic::Polynomial MathematicalProgram::NewFreePolynomial(
   return p;
 }
 
+namespace {
+// Returns the polynomial p = mᵀQm, where m is the monomial basis and Q the
+// Gram matrix.
+symbolic::Polynomial ComputePolynomialFromMonomialBasisAndGramMatrix(
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+    const Eigen::Ref<const MatrixXDecisionVariable>& Q) {
+  // Since Q is symmetric, p = ∑ᵢ Q(i, i) mᵢ² + ∑ᵢ<ⱼ 2 Q(i, j) mᵢ mⱼ. Each
+  // product of monomials is computed once, and the coefficients are collected
+  // directly, rather than through polynomial arithmetic on Q, which treats
+  // every Q(i, j) as a polynomial of its own. Each Q(i, j) is a decision
+  // variable, not an indeterminate, of p.
+  const int n = monomial_basis.size();
+  symbolic::Polynomial::MapType monomial_to_coefficient_map;
+  monomial_to_coefficient_map.reserve(n * (n + 1) / 2);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      const symbolic::Expression coeff =
+          i == j ? symbolic::Expression{Q(i, i)} : 2 * Q(i, j);
+      const symbolic::Monomial m_ij{monomial_basis(i) * monomial_basis(j)};
+      auto it = monomial_to_coefficient_map.find(m_ij);
+      if (it == monomial_to_coefficient_map.end()) {
+        monomial_to_coefficient_map.emplace(m_ij, coeff);
+      } else {
+        it->second += coeff;
+      }
+    }
+  }
+  return symbolic::Polynomial{std::move(monomial_to_coefficient_map)};
+}
+}  // namespace
+
 std::pair<symbolic::Polynomial, Binding<PositiveSemidefiniteConstraint>>
 MathematicalProgram::NewSosPolynomial(
     const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis) {
   const MatrixXDecisionVariable Q{
       NewSymmetricContinuousVariables(monomial_basis.size())};
   const auto psd_binding = AddPositiveSemidefiniteConstraint(Q);
-  // Constructs a coefficient matrix of Polynomials Q_poly from Q. In the
-  // process, we make sure that each Q_poly(i, j) is treated as a decision
-  // variable, not an indeterminate.
-  const drake::MatrixX<symbolic::Polynomial> Q_poly{
-      Q.unaryExpr([](const Variable& q_i_j) {
-        return symbolic::Polynomial{q_i_j /* coeff */, {} /* Monomial */};
-      })};
-  // p = mᵀ * Q_poly * m.
-  const symbolic::Polynomial p{monomial_basis.dot(Q_poly * monomial_basis)};
+  const symbolic::Polynomial p{
+      ComputePolynomialFromMonomialBasisAndGramMatrix(monomial_basis, Q)};
   return make_pair(p, psd_binding);
 }
 
@@ -263,6 +324,43 @@ MathematicalProgram::NewSosPolynomial(const Variables& indeterminates,
   return NewSosPolynomial(x);
 }
 
+pair<symbolic::Polynomial, MatrixXDecisionVariable>
+MathematicalProgram::NewNonnegativePolynomial(
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+    NonnegativePolynomial type) {
+  const MatrixXDecisionVariable Q{
+      NewSymmetricContinuousVariables(monomial_basis.size())};
+  switch (type) {
+    case NonnegativePolynomial::kSos: {
+      AddPositiveSemidefiniteConstraint(Q);
+      break;
+    }
+    case NonnegativePolynomial::kSdsos: {
+      AddScaledDiagonallyDominantMatrixConstraint(
+          Q.cast<symbolic::Expression>());
+      break;
+    }
+    case NonnegativePolynomial::kDsos: {
+      AddPositiveDiagonallyDominantMatrixConstraint(
+          Q.cast<symbolic::Expression>());
+      break;
+    }
+  }
+  const symbolic::Polynomial p{
+      ComputePolynomialFromMonomialBasisAndGramMatrix(monomial_basis, Q)};
+  return make_pair(p, Q);
+}
+
+pair<symbolic::Polynomial, MatrixXDecisionVariable>
+MathematicalProgram::NewNonnegativePolynomial(const Variables& indeterminates,
+                                              const int degree,
+                                              NonnegativePolynomial type) {
+  DRAKE_DEMAND(degree > 0 && degree % 2 == 0);
+  const drake::VectorX<symbolic::Monomial> x{
+      MonomialBasis(indeterminates, degree / 2)};
+  return NewNonnegativePolynomial(x, type);
+}
+
 MatrixXIndeterminate MathematicalProgram::NewIndeterminates(
     int rows, int cols, const vector<string>& names) {
   MatrixXIndeterminate indeterminates_matrix(rows, cols);
@@ -333,18 +431,18 @@ Binding<Cost> MathematicalProgram::AddCost(const Binding<Cost>& binding) {
   } else if (dynamic_cast<LinearCost*>(cost)) {
     return AddCost(internal::BindingDynamicCast<LinearCost>(binding));
   } else {
-    CheckBinding(binding);
+    const auto indexed_binding = CheckAndIndexBinding(binding);
     required_capabilities_ |= kGenericCost;
-    generic_costs_.push_back(binding);
+    generic_costs_.push_back(indexed_binding);
     return generic_costs_.back();
   }
 }
 
 Binding<LinearCost> MathematicalProgram::AddCost(
     const Binding<LinearCost>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   required_capabilities_ |= kLinearCost;
-  linear_costs_.push_back(binding);
+  linear_costs_.push_back(indexed_binding);
   return linear_costs_.back();
 }
 
@@ -360,13 +458,13 @@ Binding<LinearCost> MathematicalProgram::AddLinearCost(
 
 Binding<QuadraticCost> MathematicalProgram::AddCost(
     const Binding<QuadraticCost>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   required_capabilities_ |= kQuadraticCost;
   DRAKE_ASSERT(binding.evaluator()->Q().rows() ==
                    static_cast<int>(binding.GetNumElements()) &&
                binding.evaluator()->b().rows() ==
                    static_cast<int>(binding.GetNumElements()));
-  quadratic_costs_.push_back(binding);
+  quadratic_costs_.push_back(indexed_binding);
   return quadratic_costs_.back();
 }
 
@@ -437,9 +535,9 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
     return AddConstraint(
         internal::BindingDynamicCast<LinearConstraint>(binding));
   } else {
-    CheckBinding(binding);
+    const auto indexed_binding = CheckAndIndexBinding(binding);
     required_capabilities_ |= kGenericConstraint;
-    generic_constraints_.push_back(binding);
+    generic_constraints_.push_back(indexed_binding);
     return generic_constraints_.back();
   }
 }
@@ -525,11 +623,11 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
   } else {
     // TODO(eric.cousineau): This is a good assertion... But seems out of place,
     // possibly redundant w.r.t. the binding infrastructure.
-    DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+    DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                  static_cast<int>(binding.GetNumElements()));
-    CheckBinding(binding);
+    const auto indexed_binding = CheckAndIndexBinding(binding);
     required_capabilities_ |= kLinearConstraint;
-    linear_constraints_.push_back(binding);
+    linear_constraints_.push_back(indexed_binding);
     return linear_constraints_.back();
   }
 }
@@ -542,13 +640,32 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
   return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
 }
 
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
+}
+
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const std::vector<LinearTerm>& terms,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub) {
+  DRAKE_DEMAND(lb.rows() == ub.rows());
+  Eigen::SparseMatrix<double> A;
+  VectorXDecisionVariable vars;
+  BuildSparseLinearConstraint(terms, lb.rows(), &A, &vars);
+  return AddLinearConstraint(A, lb, ub, vars);
+}
+
 Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearEqualityConstraint>& binding) {
-  DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+  DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                static_cast<int>(binding.GetNumElements()));
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   required_capabilities_ |= kLinearEqualityConstraint;
-  linear_equality_constraints_.push_back(binding);
+  linear_equality_constraints_.push_back(indexed_binding);
   return linear_equality_constraints_.back();
 }
 
@@ -576,21 +693,39 @@ MathematicalProgram::AddLinearEqualityConstraint(
   return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
 }
 
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
+}
+
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const std::vector<LinearTerm>& terms,
+    const Eigen::Ref<const Eigen::VectorXd>& beq) {
+  Eigen::SparseMatrix<double> Aeq;
+  VectorXDecisionVariable vars;
+  BuildSparseLinearConstraint(terms, beq.rows(), &Aeq, &vars);
+  return AddLinearEqualityConstraint(Aeq, beq, vars);
+}
+
 Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
     const Binding<BoundingBoxConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   DRAKE_ASSERT(binding.evaluator()->num_outputs() ==
                static_cast<int>(binding.GetNumElements()));
   required_capabilities_ |= kLinearConstraint;
-  bbox_constraints_.push_back(binding);
+  bbox_constraints_.push_back(indexed_binding);
   return bbox_constraints_.back();
 }
 
 Binding<LorentzConeConstraint> MathematicalProgram::AddConstraint(
     const Binding<LorentzConeConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   required_capabilities_ |= kLorentzConeConstraint;
-  lorentz_cone_constraint_.push_back(binding);
+  lorentz_cone_constraint_.push_back(indexed_binding);
   return lorentz_cone_constraint_.back();
 }
 
@@ -617,9 +752,9 @@ Binding<LorentzConeConstraint> MathematicalProgram::AddLorentzConeConstraint(
 
 Binding<RotatedLorentzConeConstraint> MathematicalProgram::AddConstraint(
     const Binding<RotatedLorentzConeConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   required_capabilities_ |= kRotatedLorentzConeConstraint;
-  rotated_lorentz_cone_constraint_.push_back(binding);
+  rotated_lorentz_cone_constraint_.push_back(indexed_binding);
   return rotated_lorentz_cone_constraint_.back();
 }
 
@@ -663,11 +798,11 @@ Binding<BoundingBoxConstraint> MathematicalProgram::AddBoundingBoxConstraint(
 
 Binding<LinearComplementarityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearComplementarityConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
 
   required_capabilities_ |= kLinearComplementarityConstraint;
 
-  linear_complementarity_constraints_.push_back(binding);
+  linear_complementarity_constraints_.push_back(indexed_binding);
   return linear_complementarity_constraints_.back();
 }
 
@@ -693,12 +828,12 @@ Binding<Constraint> MathematicalProgram::AddPolynomialConstraint(
 
 Binding<PositiveSemidefiniteConstraint> MathematicalProgram::AddConstraint(
     const Binding<PositiveSemidefiniteConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   DRAKE_ASSERT(math::IsSymmetric(Eigen::Map<const MatrixXDecisionVariable>(
       binding.variables().data(), binding.evaluator()->matrix_rows(),
       binding.evaluator()->matrix_rows())));
   required_capabilities_ |= kPositiveSemidefiniteConstraint;
-  positive_semidefinite_constraint_.push_back(binding);
+  positive_semidefinite_constraint_.push_back(indexed_binding);
   return positive_semidefinite_constraint_.back();
 }
 
@@ -727,14 +862,81 @@ MathematicalProgram::AddPositiveSemidefiniteConstraint(
 
 Binding<LinearMatrixInequalityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearMatrixInequalityConstraint>& binding) {
-  CheckBinding(binding);
+  const auto indexed_binding = CheckAndIndexBinding(binding);
   DRAKE_ASSERT(static_cast<int>(binding.evaluator()->F().size()) ==
                static_cast<int>(binding.GetNumElements()) + 1);
   required_capabilities_ |= kPositiveSemidefiniteConstraint;
-  linear_matrix_inequality_constraint_.push_back(binding);
+  linear_matrix_inequality_constraint_.push_back(indexed_binding);
   return linear_matrix_inequality_constraint_.back();
 }
 
+MatrixX<symbolic::Expression>
+MathematicalProgram::AddPositiveDiagonallyDominantMatrixConstraint(
+    const Eigen::Ref<const MatrixX<symbolic::Expression>>& X) {
+  DRAKE_DEMAND(X.rows() == X.cols());
+  const int n = X.rows();
+  const int num_slack = n * (n - 1) / 2;
+  const VectorXDecisionVariable y = NewContinuousVariables(num_slack, "y");
+  MatrixX<symbolic::Expression> Y(n, n);
+  // v ≥ 0 collects -Y(i, j) ≤ X(i, j) ≤ Y(i, j) for i > j, followed by
+  // X(i, i) ≥ ∑ⱼ≠ᵢ Y(i, j).
+  VectorX<symbolic::Expression> v(2 * num_slack + n);
+  int slack_count = 0;
+  int v_count = 0;
+  for (int j = 0; j < n; ++j) {
+    Y(j, j) = X(j, j);
+    for (int i = j + 1; i < n; ++i) {
+      Y(i, j) = y(slack_count);
+      Y(j, i) = y(slack_count);
+      ++slack_count;
+      v(v_count++) = Y(i, j) - X(i, j);
+      v(v_count++) = Y(i, j) + X(i, j);
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    symbolic::Expression diagonal_margin = X(i, i);
+    for (int j = 0; j < n; ++j) {
+      if (j != i) diagonal_margin -= Y(i, j);
+    }
+    v(v_count++) = diagonal_margin;
+  }
+  AddLinearConstraint(
+      v, Eigen::VectorXd::Zero(v.rows()),
+      Eigen::VectorXd::Constant(v.rows(),
+                                std::numeric_limits<double>::infinity()));
+  return Y;
+}
+
+std::vector<std::vector<Matrix2<symbolic::Expression>>>
+MathematicalProgram::AddScaledDiagonallyDominantMatrixConstraint(
+    const Eigen::Ref<const MatrixX<symbolic::Expression>>& X) {
+  DRAKE_DEMAND(X.rows() == X.cols());
+  const int n = X.rows();
+  std::vector<std::vector<Matrix2<symbolic::Expression>>> M(
+      n, std::vector<Matrix2<symbolic::Expression>>(n));
+  if (n == 1) {
+    AddLinearConstraint(X(0, 0), 0, std::numeric_limits<double>::infinity());
+    return M;
+  }
+  // The sum of the diagonal entries of all Mⁱʲ, on each row.
+  VectorX<symbolic::Expression> diagonal_sum =
+      VectorX<symbolic::Expression>::Zero(n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      const auto m = NewContinuousVariables<2>("m");
+      M[i][j] << m(0), X(j, i), X(j, i), m(1);
+      // [m₀ x; x m₁] is PSD iff m₀ ≥ 0, m₁ ≥ 0 and m₀m₁ ≥ x².
+      AddRotatedLorentzConeConstraint(
+          Vector3<symbolic::Expression>(m(0), m(1), X(j, i)));
+      diagonal_sum(i) += m(0);
+      diagonal_sum(j) += m(1);
+    }
+  }
+  AddLinearEqualityConstraint(X.diagonal() - diagonal_sum,
+                              Eigen::VectorXd::Zero(n));
+  return M;
+}
+
 Binding<LinearMatrixInequalityConstraint>
 MathematicalProgram::AddLinearMatrixInequalityConstraint(
     const vector<Eigen::Ref<const Eigen::MatrixXd>>& F,
@@ -781,6 +983,23 @@ MathematicalProgram::AddSosConstraint(const symbolic::Expression& e) {
       symbolic::Polynomial{e, symbolic::Variables{indeterminates_}});
 }
 
+pair<MatrixXDecisionVariable, Binding<LinearEqualityConstraint>>
+MathematicalProgram::AddNonnegativePolynomialConstraint(
+    const symbolic::Polynomial& p,
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+    NonnegativePolynomial type) {
+  const auto pair = NewNonnegativePolynomial(monomial_basis, type);
+  const auto leq_binding = AddLinearEqualityConstraint(pair.first == p);
+  return make_pair(pair.second, leq_binding);
+}
+
+pair<MatrixXDecisionVariable, Binding<LinearEqualityConstraint>>
+MathematicalProgram::AddNonnegativePolynomialConstraint(
+    const symbolic::Polynomial& p, NonnegativePolynomial type) {
+  return AddNonnegativePolynomialConstraint(
+      p, MonomialBasis(p.indeterminates(), p.TotalDegree() / 2), type);
+}
+
 double MathematicalProgram::GetSolution(const Variable& var) const {
   return x_values_[FindDecisionVariableIndex(var)];
 }
@@ -799,6 +1018,7 @@ void MathematicalProgram::SetInitialGuess(
 // implemented in mathematical_program_api.cc instead of this file.
 
 SolutionResult MathematicalProgram::Solve() {
+  DRAKE_TRACE_SCOPE("MathematicalProgram::Solve");
   // This implementation is simply copypasta for now; in the future we will
   // want to tweak the order of preference of solvers based on the types of
   // constraints present.
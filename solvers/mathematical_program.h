@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
@@ -292,6 +293,20 @@ struct assert_if_is_constraint {
 };
 }  // namespace detail
 
+/**
+ * The term `coefficient * variable` in the row @p row of a linear constraint.
+ * A list of such terms describes a sparse linear constraint without any
+ * symbolic::Expression, see
+ * MathematicalProgram::AddLinearConstraint(const std::vector<LinearTerm>&,
+ * const Eigen::Ref<const Eigen::VectorXd>&,
+ * const Eigen::Ref<const Eigen::VectorXd>&).
+ */
+struct LinearTerm {
+  int row{};
+  symbolic::Variable variable;
+  double coefficient{};
+};
+
 /**
  * MathematicalProgram stores the decision variables, the constraints and costs
  * of an optimization problem. The user can solve the problem by calling Solve()
@@ -568,6 +583,31 @@ class MathematicalProgram {
       const symbolic::Variables& indeterminates, int degree,
       const std::string& coeff_name = "a");
 
+  /**
+   * Types of the certificates of nonnegativity of a polynomial p = mᵀQm, from
+   * the most to the least expressive. Each one restricts the Gram matrix Q to
+   * a cone that is a subset of the previous one:
+   *  - kSos: Q is positive semidefinite, a semidefinite constraint.
+   *  - kSdsos: Q is scaled diagonally dominant, which is imposed with rotated
+   *    Lorentz cone constraints, see
+   *    AddScaledDiagonallyDominantMatrixConstraint().
+   *  - kDsos: Q is diagonally dominant with a nonnegative diagonal, which is
+   *    imposed with linear constraints, see
+   *    AddPositiveDiagonallyDominantMatrixConstraint().
+   *
+   * DSOS and SDSOS polynomials only need an LP or SOCP solver, and scale to
+   * much larger programs than SOS polynomials, at the cost of conservatism.
+   * For more details, please refer to
+   *   DSOS and SDSOS Optimization: More Tractable Alternatives to Sum of
+   *   Squares and Semidefinite Optimization
+   *   by A. A. Ahmadi and A. Majumdar, 2017.
+   */
+  enum class NonnegativePolynomial {
+    kSos,
+    kSdsos,
+    kDsos,
+  };
+
   /** Returns a pair of a SOS polynomial p = mᵀQm and a PSD constraint for
    * a new coefficients matrix Q, where m is the @p monomial basis.
    * For example, `NewSosPolynomial(Vector2<Monomial>{x,y})` returns a
@@ -594,6 +634,30 @@ class MathematicalProgram {
   std::pair<symbolic::Polynomial, Binding<PositiveSemidefiniteConstraint>>
   NewSosPolynomial(const symbolic::Variables& indeterminates, int degree);
 
+  /**
+   * Returns a pair of a polynomial p = mᵀQm and its new symmetric Gram matrix
+   * Q, where m is the @p monomial_basis, and adds the constraints certifying
+   * that p is nonnegative as described by @p type. With
+   * NonnegativePolynomial::kSos, this is the same as NewSosPolynomial().
+   */
+  std::pair<symbolic::Polynomial, MatrixXDecisionVariable>
+  NewNonnegativePolynomial(
+      const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+      NonnegativePolynomial type);
+
+  /**
+   * Returns a pair of a polynomial p = m(x)ᵀQm(x) of degree @p degree and its
+   * new symmetric Gram matrix Q, where m(x) is the result of calling
+   * `MonomialBasis(indeterminates, degree/2)`, and adds the constraints
+   * certifying that p is nonnegative as described by @p type.
+   *
+   * @throws std::runtime_error if @p degree is not a positive even integer.
+   * @see MonomialBasis.
+   */
+  std::pair<symbolic::Polynomial, MatrixXDecisionVariable>
+  NewNonnegativePolynomial(const symbolic::Variables& indeterminates,
+                           int degree, NonnegativePolynomial type);
+
 
   /**
    * Adds indeterminates, appending them to an internal vector of any
@@ -1143,6 +1207,35 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear constraints lb ≤ A * vars ≤ ub, with a sparse matrix A,
+   * referencing potentially a subset of the decision variables. A is stored
+   * without ever being converted to a dense matrix.
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
+  /**
+   * Adds the linear constraints lb(i) ≤ ∑ coefficient * variable ≤ ub(i),
+   * where the sum is over the @p terms whose row is i. The terms of a same
+   * row and variable add up. This builds the sparse constraint matrix
+   * directly from the terms, without any symbolic::Expression, which is much
+   * faster than the symbolic overloads for programs with many constraints.
+   * @param terms The nonzero terms of the constraints, in any order.
+   * @param lb The lower bounds, one per row.
+   * @param ub The upper bounds, one per row.
+   * @throws std::runtime_error if the row of a term is not within
+   * [0, lb.rows()), or if a variable is not a decision variable of this
+   * program.
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const std::vector<LinearTerm>& terms,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1409,6 +1502,27 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear equality constraints Aeq * vars = beq, with a sparse matrix
+   * Aeq, referencing potentially a subset of the decision variables. Aeq is
+   * stored without ever being converted to a dense matrix.
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
+  /**
+   * Adds the linear equality constraints ∑ coefficient * variable = beq(i),
+   * where the sum is over the @p terms whose row is i, without any
+   * symbolic::Expression. See AddLinearConstraint(const
+   * std::vector<LinearTerm>&, const Eigen::Ref<const Eigen::VectorXd>&, const
+   * Eigen::Ref<const Eigen::VectorXd>&) for the details.
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const std::vector<LinearTerm>& terms,
+      const Eigen::Ref<const Eigen::VectorXd>& beq);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
@@ -1975,6 +2089,44 @@ class MathematicalProgram {
     return AddPositiveSemidefiniteConstraint(M);
   }
 
+  /**
+   * Adds the constraint that the symmetric matrix @p X is diagonally dominant
+   * with a nonnegative diagonal, namely
+   * <pre>
+   *   X(i, i) ≥ ∑ⱼ≠ᵢ |X(i, j)|  ∀ i
+   * </pre>
+   * This is a sufficient condition for X to be positive semidefinite, which
+   * only needs linear constraints: we add the slack variables Y(i, j) =
+   * Y(j, i) for i ≠ j, with
+   * <pre>
+   *   -Y(i, j) ≤ X(i, j) ≤ Y(i, j)
+   *   X(i, i) ≥ ∑ⱼ≠ᵢ Y(i, j)
+   * </pre>
+   * @param X A symmetric matrix of linear expressions. Only its lower
+   * triangular part is used.
+   * @return Y The symmetric matrix of the slack variables, with Y(i, i) set to
+   * X(i, i).
+   */
+  MatrixX<symbolic::Expression> AddPositiveDiagonallyDominantMatrixConstraint(
+      const Eigen::Ref<const MatrixX<symbolic::Expression>>& X);
+
+  /**
+   * Adds the constraint that the symmetric matrix @p X is scaled diagonally
+   * dominant, namely X = ∑ᵢ<ⱼ Mⁱʲ, where Mⁱʲ is zero except for its entries
+   * in the rows and columns i and j, which form a 2 x 2 positive semidefinite
+   * matrix. This is a sufficient condition for X to be positive semidefinite,
+   * which only needs second-order cone constraints: the PSD condition on each
+   * 2 x 2 block is imposed as a rotated Lorentz cone constraint.
+   * @param X A symmetric matrix of linear expressions. Only its lower
+   * triangular part is used.
+   * @return M M[i][j] for i < j is the 2 x 2 block of Mⁱʲ in the rows and
+   * columns (i, j). Its off-diagonal entries are X(j, i). M[i][j] is empty for
+   * i ≥ j.
+   */
+  std::vector<std::vector<Matrix2<symbolic::Expression>>>
+  AddScaledDiagonallyDominantMatrixConstraint(
+      const Eigen::Ref<const MatrixX<symbolic::Expression>>& X);
+
   /**
    * Adds a linear matrix inequality constraint to the program.
    */
@@ -2051,6 +2203,31 @@ class MathematicalProgram {
             Binding<LinearEqualityConstraint>>
   AddSosConstraint(const symbolic::Expression& e);
 
+  /**
+   * Adds constraints that a given polynomial @p p is nonnegative, by
+   * decomposing it into `mᵀQm`, where m is the @p monomial_basis, and Q
+   * satisfies the constraints described by @p type. With
+   * NonnegativePolynomial::kSdsos or NonnegativePolynomial::kDsos, the
+   * program needs no semidefinite constraint.
+   * It returns a pair of
+   *  - The Gram matrix Q.
+   *  - The coefficients matching conditions in linear equality constraint.
+   */
+  std::pair<MatrixXDecisionVariable, Binding<LinearEqualityConstraint>>
+  AddNonnegativePolynomialConstraint(
+      const symbolic::Polynomial& p,
+      const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+      NonnegativePolynomial type);
+
+  /**
+   * Adds constraints that a given polynomial @p p is nonnegative, as in the
+   * overload above, where m is the monomial basis of all indeterminates of
+   * @p p with degree equal to half the TotalDegree of @p p.
+   */
+  std::pair<MatrixXDecisionVariable, Binding<LinearEqualityConstraint>>
+  AddNonnegativePolynomialConstraint(const symbolic::Polynomial& p,
+                                     NonnegativePolynomial type);
+
   // template <typename FunctionType>
   // void AddCost(std::function..);
   // void AddLinearCost(const Eigen::MatrixBase<Derived>& c, const vector<const
@@ -2226,6 +2403,14 @@ class MathematicalProgram {
    */
   double GetLowerBoundCost() const { return lower_bound_cost_; }
 
+  /**
+   * Returns the statistics, such as the setup and solve times, reported by the
+   * last solver for the last solve. See SolverStatistics.
+   */
+  const SolverStatistics& GetSolverStatistics() const {
+    return solver_statistics_;
+  }
+
   /**
    * Getter for all generic costs.
    */
@@ -2372,6 +2557,32 @@ class MathematicalProgram {
   std::vector<int> FindDecisionVariableIndices(
       const Eigen::Ref<const VectorXDecisionVariable>& vars) const;
 
+  /**
+   * Returns the indices of the decision variables of @p binding, as
+   * FindDecisionVariableIndices(binding.variables()). For a binding added to
+   * this program, such as those returned by linear_constraints(), this reuses
+   * the indices cached when the binding was added, which only costs a
+   * comparison per variable instead of a hash table lookup.
+   * @throws std::runtime_error if a variable of @p binding is not a decision
+   * variable of this program.
+   */
+  template <typename C>
+  std::vector<int> FindDecisionVariableIndices(
+      const Binding<C>& binding) const {
+    const std::vector<int>& cached = binding.decision_variable_indices();
+    const VectorXDecisionVariable& vars = binding.variables();
+    bool is_cache_valid = static_cast<int>(cached.size()) == vars.rows();
+    for (int i = 0; i < vars.rows() && is_cache_valid; ++i) {
+      is_cache_valid = cached[i] >= 0 && cached[i] < num_vars() &&
+                       decision_variables_(cached[i]).get_id() ==
+                           vars(i).get_id();
+    }
+    if (is_cache_valid) {
+      return cached;
+    }
+    return FindDecisionVariableIndices(vars);
+  }
+
   /** Gets the number of indeterminates in the optimization program */
   int num_indeterminates() const { return indeterminates_.rows(); }
 
@@ -2435,14 +2646,72 @@ class MathematicalProgram {
     }
     VectorX<Scalar> binding_x(binding.GetNumElements());
     VectorX<Scalar> binding_y(binding.evaluator()->num_outputs());
+    const std::vector<int> indices = FindDecisionVariableIndices(binding);
     for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      binding_x(i) =
-          prog_var_vals(FindDecisionVariableIndex(binding.variables()(i)));
+      binding_x(i) = prog_var_vals(indices[i]);
     }
     binding.evaluator()->Eval(binding_x, binding_y);
     return binding_y;
   }
 
+  /**
+   * Evaluates the evaluator in @p binding at several values of the decision
+   * variables at once, using EvaluatorBase::EvalBatch().
+   * @param binding A Binding whose variables are decision variables in this
+   * program.
+   * @param prog_var_vals A `num_vars()` x N matrix, whose column j contains
+   * the values of all decision variables in this program at the j'th point.
+   * @return A `num_outputs` x N matrix, whose column j is the value of the
+   * binding at the j'th point.
+   * @throws std::logic_error if the number of rows does not match.
+   */
+  template <typename C>
+  Eigen::MatrixXd EvalBindingAtPoints(
+      const Binding<C>& binding,
+      const Eigen::Ref<const Eigen::MatrixXd>& prog_var_vals) const {
+    if (prog_var_vals.rows() != num_vars()) {
+      std::ostringstream oss;
+      oss << "The input binding variable is not in the right size. Expects "
+          << num_vars() << " rows, but it actually has " << prog_var_vals.rows()
+          << " rows.\n";
+      throw std::logic_error(oss.str());
+    }
+    Eigen::MatrixXd binding_X(binding.GetNumElements(), prog_var_vals.cols());
+    const std::vector<int> indices = FindDecisionVariableIndices(binding);
+    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
+      binding_X.row(i) = prog_var_vals.row(indices[i]);
+    }
+    Eigen::MatrixXd binding_Y;
+    binding.evaluator()->EvalBatch(binding_X, &binding_Y);
+    return binding_Y;
+  }
+
+  /**
+   * Evaluates each binding in @p bindings at several values of the decision
+   * variables at once. The outputs of the bindings are stacked in the order
+   * they appear in @p bindings.
+   * @see EvalBindingAtPoints(), which describes @p prog_var_vals.
+   * @return A matrix with N columns, whose rows are the outputs of all of
+   * @p bindings.
+   */
+  template <typename C>
+  Eigen::MatrixXd EvalBindingsAtPoints(
+      const std::vector<Binding<C>>& bindings,
+      const Eigen::Ref<const Eigen::MatrixXd>& prog_var_vals) const {
+    int num_outputs = 0;
+    for (const auto& binding : bindings) {
+      num_outputs += binding.evaluator()->num_outputs();
+    }
+    Eigen::MatrixXd Y(num_outputs, prog_var_vals.cols());
+    int row = 0;
+    for (const auto& binding : bindings) {
+      const int rows = binding.evaluator()->num_outputs();
+      Y.middleRows(row, rows) = EvalBindingAtPoints(binding, prog_var_vals);
+      row += rows;
+    }
+    return Y;
+  }
+
   /**
    * Evaluates the evaluator in @p binding at the solution value.
    * @return The value of @p binding at the solution value.
@@ -2537,6 +2806,7 @@ class MathematicalProgram {
   // The lower bound of the objective found by the solver, during the
   // optimization process.
   double lower_bound_cost_{};
+  SolverStatistics solver_statistics_;
   std::map<SolverId, std::map<std::string, double>> solver_options_double_;
   std::map<SolverId, std::map<std::string, int>> solver_options_int_;
   std::map<SolverId, std::map<std::string, std::string>> solver_options_str_;
@@ -2684,18 +2954,33 @@ class MathematicalProgram {
   }
 
   /*
-   * Ensure a binding is valid *before* adding it to the program.
+   * Ensure a binding is valid *before* adding it to the program, and returns
+   * a copy of it with the indices of its variables cached, see
+   * Binding::decision_variable_indices().
    * @pre The binding has not yet been registered.
    * @pre The decision variables have been registered.
    * @throws std::runtime_error if the binding is invalid.
    */
   template <typename C>
-  void CheckBinding(const Binding<C>& binding) const {
+  Binding<C> CheckAndIndexBinding(const Binding<C>& binding) const {
     // TODO(eric.cousineau): In addition to identifiers, hash bindings by
     // their constraints and their variables, to prevent duplicates.
     // TODO(eric.cousineau): Once bindings have identifiers (perhaps
     // retrofitting `description`), ensure that they have unique names.
-    CheckIsDecisionVariable(binding.variables());
+    Binding<C> indexed_binding = binding;
+    const VectorXDecisionVariable& vars = binding.variables();
+    indexed_binding.decision_variable_indices_.resize(vars.rows());
+    for (int i = 0; i < vars.rows(); ++i) {
+      const auto it = decision_variable_index_.find(vars(i).get_id());
+      if (it == decision_variable_index_.end()) {
+        std::ostringstream oss;
+        oss << vars(i)
+            << " is not a decision variable of the mathematical program.\n";
+        throw std::runtime_error(oss.str());
+      }
+      indexed_binding.decision_variable_indices_[i] = it->second;
+    }
+    return indexed_binding;
   }
 
   // Adds a constraint represented by a set of symbolic formulas to the
@@ -75,6 +75,7 @@ void MathematicalProgram::SetSolverResult(const SolverResult& solver_result) {
   } else {
     lower_bound_cost_ = optimal_cost_;
   }
+  solver_statistics_ = solver_result.statistics();
 }
 
 }  // namespace solvers
@@ -29,6 +29,35 @@ enum SolutionResult {
 std::string to_string(SolutionResult solution_result);
 std::ostream& operator<<(std::ostream& os, SolutionResult solution_result);
 
+/**
+ * Statistics of a single solve, as reported by the solver. Every field is
+ * empty if the solver does not report it.
+ */
+struct SolverStatistics {
+  /**
+   * The wall-clock time, in seconds, spent before invoking the native solver,
+   * e.g. translating the program into the solver's own format and acquiring
+   * the solver's environment or license.
+   * For the nonlinear solvers (IPOPT, NLopt, SNOPT), which evaluate the costs
+   * and constraints of the program while optimizing, that evaluation is
+   * counted in solve_time instead.
+   */
+  optional<double> setup_time;
+  /** The wall-clock time, in seconds, spent in the native solver. */
+  optional<double> solve_time;
+  /**
+   * The number of iterations of the native solver, e.g. the barrier or
+   * simplex iterations of Gurobi, or the interior-point iterations of Mosek.
+   */
+  optional<int> num_iterations;
+  /**
+   * The number of structurally nonzero entries the native solver is given,
+   * in its constraint matrix (or constraint Jacobian) and, if it takes one,
+   * in the matrix of its quadratic cost.
+   */
+  optional<int> num_nonzeros;
+};
+
 /**
  * This class is used by implementations of the class
  * MathematicalProgramSolverInterface to report their results to the
@@ -85,11 +114,22 @@ class SolverResult {
     return optimal_cost_lower_bound_;
   }
 
+  /**
+   * Sets the statistics of the solve. Eventually this will be passed to
+   * MathematicalProgram, when calling MathematicalProgram::SetSolverResult(...);
+   */
+  void set_statistics(const SolverStatistics& statistics) {
+    statistics_ = statistics;
+  }
+
+  const SolverStatistics& statistics() const { return statistics_; }
+
  private:
   SolverId solver_id_;
   optional<Eigen::VectorXd> decision_variable_values_{nullopt};
   optional<double> optimal_cost_{nullopt};
   optional<double> optimal_cost_lower_bound_{nullopt};
+  SolverStatistics statistics_;
 };
 
 /// Interface used by implementations of individual solvers.
@@ -7,6 +7,7 @@
 #include <limits>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include <Eigen/LU>
@@ -71,6 +72,64 @@ VectorX<double> LinearSolve(
   return M.partialPivLu().solve(b);
 }
 
+// The factorization used for the basis matrices of Lemke's Algorithm, chosen
+// as in LinearSolve() above.
+template <typename T>
+struct LemkeBasisDecomposition {
+  using type = Eigen::HouseholderQR<MatrixX<T>>;
+};
+
+template <>
+struct LemkeBasisDecomposition<double> {
+  using type = Eigen::PartialPivLU<MatrixX<double>>;
+};
+
+// Factorization of the basis matrix B of Lemke's Algorithm that is updated,
+// rather than recomputed, when a pivot replaces a column of B. The updates use
+// the product form of the inverse: after k pivots, B = B₀E₁⋯Eₖ, where B₀ is
+// the last basis matrix that was factored explicitly and each "eta" matrix Eᵢ
+// is the identity matrix with a single column replaced. B is factored again
+// after kMaxUpdates pivots, which bounds both the cost of a solve and the
+// accumulation of roundoff error in the updates.
+template <typename T>
+class LemkeBasisFactorization {
+ public:
+  static constexpr int kMaxUpdates = 50;
+
+  void Factor(const MatrixX<T>& B) {
+    decomposition_.compute(B);
+    etas_.clear();
+  }
+
+  // Returns B⁻¹b.
+  VectorX<T> Solve(const VectorX<T>& b) const {
+    VectorX<T> x = decomposition_.solve(b);
+    for (const auto& eta : etas_) {
+      const int r = eta.first;
+      const VectorX<T>& d = eta.second;
+      const T x_r = x(r) / d(r);
+      x -= x_r * d;
+      x(r) = x_r;
+    }
+    return x;
+  }
+
+  // Accounts for column r of B having been replaced, where d = B⁻¹a was
+  // computed using Solve() for the new column a, before the replacement. The
+  // updated basis matrix B is used only if the factorization is recomputed.
+  void Update(const MatrixX<T>& B, int r, const VectorX<T>& d) {
+    if (static_cast<int>(etas_.size()) >= kMaxUpdates) {
+      Factor(B);
+    } else {
+      etas_.emplace_back(r, d);
+    }
+  }
+
+ private:
+  typename LemkeBasisDecomposition<T>::type decomposition_;
+  std::vector<std::pair<int, VectorX<T>>> etas_;
+};
+
 // Utility function for copying part of a matrix (designated by the indices
 // in rows and cols) from in to a target matrix, out. This template approach
 // allows selecting parts of both sparse and dense matrices for input; only
@@ -148,6 +207,15 @@ void MobyLCPSolver<T>::ClearIndexVectors() const {
   j_.clear();
 }
 
+template <typename T>
+void MobyLCPSolver<T>::GetZBasis(unsigned n, std::vector<int>* basis) const {
+  basis->clear();
+  for (const unsigned i : bas_) {
+    if (i < n) basis->push_back(i);
+  }
+  std::sort(basis->begin(), basis->end());
+}
+
 template <>
 SolutionResult MobyLCPSolver<Eigen::AutoDiffScalar<drake::Vector1d>>::Solve(
   // NOLINTNEXTLINE(*)  Don't lint old, non-style-compliant code below.
@@ -228,10 +296,10 @@ SolutionResult MobyLCPSolver<T>::Solve(MathematicalProgram& prog) const {
       prog.SetSolverResult(solver_result);
       return SolutionResult::kUnknownError;
     }
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < binding.evaluator()->num_vars(); ++i) {
-      const int variable_index =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      x_sol(variable_index) = constraint_solution(i);
+      x_sol(var_indices[i]) = constraint_solution(i);
     }
     solver_result.set_optimal_cost(0.0);
   }
@@ -618,12 +686,28 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
                                      const VectorX<T>& q, VectorX<T>* z,
                                      const T& piv_tol,
                                      const T& zero_tol) const {
+  // Lemke's algorithm doesn't seem to like warmstarting, so the standard
+  // initial basis is always used here.
+  return SolveLcpLemke(M, q, z, std::vector<int>(), nullptr, piv_tol,
+                       zero_tol);
+}
+
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
+                                     const VectorX<T>& q, VectorX<T>* z,
+                                     const std::vector<int>& initial_basis,
+                                     std::vector<int>* final_basis,
+                                     const T& piv_tol,
+                                     const T& zero_tol) const {
   using std::max;
 
   // Variables that will be reused multiple times, thus hopefully allowing
   // Eigen to keep from freeing/reallocating memory repeatedly.
-  VectorX<T> result, dj, dl, x, xj, Be, u, z0;
+  VectorX<T> result, dj, dl, x, xj, Be, u;
   MatrixX<T> Bl, t1, t2;
+  LemkeBasisFactorization<T> factorization;
+
+  if (final_basis) final_basis->clear();
 
   if (log_enabled_) {
     Log() << "MobyLCPSolver::SolveLcpLemke() entered" << std::endl;
@@ -637,6 +721,16 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   if (M.rows() != n || M.cols() != n)
     throw std::logic_error("M's dimensions do not match that of q.");
 
+  std::vector<bool> in_initial_basis(n, false);
+  for (const int i : initial_basis) {
+    if (i < 0 || i >= static_cast<int>(n) || in_initial_basis[i]) {
+      throw std::logic_error(
+          "The initial basis contains an index that is out of range or "
+          "repeated.");
+    }
+    in_initial_basis[i] = true;
+  }
+
   // update the pivots
   pivots_ = 0;
 
@@ -657,15 +751,6 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     return true;
   }
 
-  // Lemke's algorithm doesn't seem to like warmstarting
-  //
-  // TODO(sammy-tri) this is not present in the sparse solver, and it
-  // causes subtle dead code below.
-  z->fill(0);
-
-  // copy z to z0
-  z0 = *z;
-
   ClearIndexVectors();
 
   // initialize variables
@@ -682,16 +767,11 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   std::vector<unsigned>::iterator iiter;
 
   // determine initial basis
-  if (z0.size() != n) {
-    // setup the nonbasic indices
-    for (unsigned i = 0; i < n; i++) nonbas_.push_back(i);
-  } else {
-    for (unsigned i = 0; i < n; i++) {
-      if (z0[i] > 0) {
-        bas_.push_back(i);
-      } else {
-        nonbas_.push_back(i);
-      }
+  for (unsigned i = 0; i < n; i++) {
+    if (in_initial_basis[i]) {
+      bas_.push_back(i);
+    } else {
+      nonbas_.push_back(i);
     }
   }
 
@@ -716,14 +796,28 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     Bl.block(0, t1.cols(), t2.rows(), t2.cols()) = t2;
 
     // Solve B*x = -q.
-    x = LinearSolve(Bl, q);
-  } else {
+    factorization.Factor(Bl);
+    x = factorization.Solve(-q);
+
+    // Fall back to the standard initial basis if the basis matrix is
+    // singular (the negated comparison also catches NaN values).
+    const T residual = (Bl * x + q).template lpNorm<Eigen::Infinity>();
+    if (!(residual <= mod_zero_tol *
+          max(T(1), q.template lpNorm<Eigen::Infinity>()))) {
+      Log() << "-- initial basis is singular; using basis of -1" << std::endl;
+      bas_.clear();
+      nonbas_.clear();
+      for (unsigned i = 0; i < n; i++) nonbas_.push_back(i);
+    }
+  }
+  if (bas_.empty()) {
     Log() << "-- using basis of -1 (no warmstarting)" << std::endl;
 
     // use standard initial basis
     Bl.resize(n, n);
     Bl.setIdentity();
     Bl *= -1;
+    factorization.Factor(Bl);
     x = q;
   }
 
@@ -731,6 +825,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   if (x.minCoeff() >= 0.0) {
     Log() << " -- initial basis provides a solution!" << std::endl;
     FinishLemkeSolution(M, q, x, z);
+    if (final_basis) GetZBasis(n, final_basis);
     Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
     return true;
   }
@@ -767,6 +862,8 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   x += u;
   x[lvindex] = tval;
   Bl.col(lvindex) = Be;
+  // Be = -B*u was computed before u was scaled by tval, so B⁻¹Be = -u / tval.
+  factorization.Update(Bl, lvindex, -u / tval);
   Log() << "  new q: " << x << std::endl;
 
   // main iterations begin here
@@ -784,6 +881,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     if (leaving == t) {
       Log() << "-- solved LCP successfully!" << std::endl;
       FinishLemkeSolution(M, q, x, z);
+      if (final_basis) GetZBasis(n, final_basis);
       Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
       return true;
     } else if (leaving < n) {
@@ -798,7 +896,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     dl = Be;
 
     // See comments above on the possibility of this solve failing.
-    dl = LinearSolve(Bl, dl.eval());
+    dl = factorization.Solve(dl);
 
     // ** find new leaving variable
     j_.clear();
@@ -896,11 +994,12 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     leaving = *iiter;
 
     // ** perform pivot
+    Bl.col(lvindex) = Be;
+    factorization.Update(Bl, lvindex, dl);
     const T ratio = x[lvindex] / dl[lvindex];
     dl *= ratio;
     x -= dl;
     x[lvindex] = ratio;
-    Bl.col(lvindex) = Be;
     *iiter = entering;
     Log() << " -- pivoting: leaving index=" << lvindex
           << "  entering index=" << entering << std::endl;
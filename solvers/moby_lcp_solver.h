@@ -204,7 +204,9 @@ class MobyLCPSolver : public MathematicalProgramSolverInterface {
   ///                solution. **This warmstarting is generally not
   ///                recommended**: it has a predisposition to lead to a failing
   ///                pivoting sequence. If the solver fails (returns `false`),
-  ///                `z` will be set to the zero vector.
+  ///                `z` will be set to the zero vector. To warmstart from a
+  ///                known basis instead, use the overload that accepts an
+  ///                initial basis.
   /// @param[in] zero_tol The tolerance for testing against zero. If the
   ///            tolerance is negative (default) the solver will determine a
   ///            generally reasonable tolerance.
@@ -228,6 +230,43 @@ class MobyLCPSolver : public MathematicalProgramSolverInterface {
                      VectorX<T>* z, const T& piv_tol = T(-1),
                      const T& zero_tol = T(-1)) const;
 
+  /// Lemke's Algorithm, as in SolveLcpLemke() above, but starting from a
+  /// caller-provided basis. This is intended for sequences of closely related
+  /// LCPs (e.g., contact problems over successive time steps), for which the
+  /// basis at the solution of one problem is typically a very good (if not
+  /// exactly correct) starting basis for the next one.
+  ///
+  /// The factorization of the basis matrix is reused across pivots: each pivot
+  /// updates it in product form rather than refactoring the basis matrix from
+  /// scratch, and the basis matrix is refactored only periodically.
+  /// @param[in] M the LCP matrix.
+  /// @param[in] q the LCP vector.
+  /// @param[out] z the solution to the LCP on return (if the solver
+  ///             succeeds). If the solver fails (returns `false`), `z` will be
+  ///             set to the zero vector.
+  /// @param[in] initial_basis the indices of the elements of z that are basic
+  ///            (i.e., expected to be positive at the solution); the
+  ///            complementary elements of w are basic for all other indices.
+  ///            An empty basis yields the standard (cold) start. If the basis
+  ///            matrix for @p initial_basis is singular, the solver falls back
+  ///            to the standard start.
+  /// @param[out] final_basis if non-null, the indices of the elements of z
+  ///             that are basic on return, in increasing order, suitable for
+  ///             passing as @p initial_basis to a subsequent solve. Set to the
+  ///             empty basis if the solver fails.
+  /// @param[in] piv_tol see SolveLcpLemke().
+  /// @param[in] zero_tol see SolveLcpLemke().
+  /// @returns `true` if the solver **believes** it has computed a solution;
+  ///          see SolveLcpLemke().
+  /// @throws std::logic_error if M is not square, the dimensions of M do not
+  ///         match the length of q, or @p initial_basis contains an index
+  ///         that is out of range or repeated.
+  bool SolveLcpLemke(const MatrixX<T>& M, const VectorX<T>& q,
+                     VectorX<T>* z, const std::vector<int>& initial_basis,
+                     std::vector<int>* final_basis = nullptr,
+                     const T& piv_tol = T(-1),
+                     const T& zero_tol = T(-1)) const;
+
   /// Lemke's Algorithm for solving LCPs in the matrix class E, which contains
   /// all strictly semimonotone matrices, all P-matrices, and all strictly
   /// copositive matrices. Lemke's Algorithm is described in [Cottle 1992],
@@ -282,6 +321,10 @@ class MobyLCPSolver : public MathematicalProgramSolverInterface {
  private:
   void ClearIndexVectors() const;
 
+  // Gets the indices of the z variables (of the LCP of dimension n) that are
+  // in the current basis, in increasing order.
+  void GetZBasis(unsigned n, std::vector<int>* basis) const;
+
   template <typename MatrixType, typename Scalar>
   void FinishLemkeSolution(const MatrixType& M, const VectorX<Scalar>& q,
                            const VectorX<Scalar>& x, VectorX<Scalar>* z) const;
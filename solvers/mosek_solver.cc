@@ -1,6 +1,7 @@
 #include "drake/solvers/mosek_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <list>
@@ -25,7 +26,11 @@ MSKrescodee AddLinearConstraintsFromBindings(
     bool is_equality_constraint, const MathematicalProgram& prog) {
   for (const auto& binding : constraint_list) {
     auto constraint = binding.evaluator();
-    const Eigen::MatrixXd& A = constraint->A();
+    // Mosek adds the constraints row by row, so we traverse A by rows.
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> A =
+        constraint->get_sparse_A();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     const Eigen::VectorXd& lb = constraint->lower_bound();
     const Eigen::VectorXd& ub = constraint->upper_bound();
     MSKint32t constraint_idx = 0;
@@ -67,14 +72,12 @@ MSKrescodee AddLinearConstraintsFromBindings(
       }
       std::vector<MSKint32t> A_nonzero_col_idx;
       std::vector<double> A_nonzero_val;
-      A_nonzero_col_idx.reserve(A.cols());
-      A_nonzero_val.reserve(A.cols());
-
-      for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-        if (std::abs(A(i, k)) > Eigen::NumTraits<double>::epsilon()) {
-          A_nonzero_col_idx.push_back(
-              prog.FindDecisionVariableIndex(binding.variables()(k)));
-          A_nonzero_val.push_back(A(i, k));
+      for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(A,
+                                                                           i);
+           it; ++it) {
+        if (std::abs(it.value()) > Eigen::NumTraits<double>::epsilon()) {
+          A_nonzero_col_idx.push_back(var_indices[it.col()]);
+          A_nonzero_val.push_back(it.value());
         }
       }
 
@@ -113,9 +116,11 @@ MSKrescodee AddBoundingBoxConstraints(const MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
     const Eigen::VectorXd& lower_bound = constraint->lower_bound();
     const Eigen::VectorXd& upper_bound = constraint->upper_bound();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      size_t x_idx = prog.FindDecisionVariableIndex(binding.variables()(i));
+      size_t x_idx = var_indices[i];
       x_lb[x_idx] = std::max(x_lb[x_idx], lower_bound[i]);
       x_ub[x_idx] = std::min(x_ub[x_idx], upper_bound[i]);
     }
@@ -167,12 +172,10 @@ MSKrescodee AddSecondOrderConeConstraints(
   bool is_rotated_cone = std::is_same<C, RotatedLorentzConeConstraint>::value;
   MSKrescodee rescode = MSK_RES_OK;
   for (auto const& binding : second_order_cone_constraints) {
-    std::vector<MSKint32t> cone_var_indices(binding.GetNumElements());
-
-    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      cone_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-    }
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
+    const std::vector<MSKint32t> cone_var_indices(var_indices.begin(),
+                                                  var_indices.end());
 
     const auto& A = binding.evaluator()->A();
     const auto& b = binding.evaluator()->b();
@@ -393,6 +396,8 @@ MSKrescodee AddLinearMatrixInequalityConstraint(const MathematicalProgram& prog,
     }
 
     int rows = binding.evaluator()->matrix_rows();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     AddBarVariable(rows, task);
 
@@ -418,8 +423,7 @@ MSKrescodee AddLinearMatrixInequalityConstraint(const MathematicalProgram& prog,
         A_row.reserve(binding.GetNumElements());
 
         for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-          A_row.coeffRef(prog.FindDecisionVariableIndex(
-              binding.variables()(k))) += (*F_it)(i, j);
+          A_row.coeffRef(var_indices[k]) += (*F_it)(i, j);
           ++F_it;
         }
 
@@ -453,11 +457,8 @@ MSKrescodee AddCosts(const MathematicalProgram& prog, MSKtask_t* task) {
     const auto& Q = constraint->Q();
     const auto& b = constraint->b();
     constant_cost += constraint->c();
-    std::vector<int> var_indices(Q.rows());
-
-    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      var_indices[i] = prog.FindDecisionVariableIndex(binding.variables()(i));
-    }
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int i = 0; i < Q.rows(); ++i) {
       int var_index_i = var_indices[i];
@@ -486,10 +487,12 @@ MSKrescodee AddCosts(const MathematicalProgram& prog, MSKtask_t* task) {
   for (const auto& binding : prog.linear_costs()) {
     const auto& c = binding.evaluator()->a();
     constant_cost += binding.evaluator()->b();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
       if (std::abs(c(i)) > Eigen::NumTraits<double>::epsilon()) {
-        linear_term_triplets.push_back(Eigen::Triplet<double>(
-            prog.FindDecisionVariableIndex(binding.variables()(i)), 0, c(i)));
+        linear_term_triplets.push_back(
+            Eigen::Triplet<double>(var_indices[i], 0, c(i)));
       }
     }
   }
@@ -632,6 +635,7 @@ std::shared_ptr<MosekSolver::License> MosekSolver::AcquireLicense() {
 bool MosekSolver::available() const { return true; }
 
 SolutionResult MosekSolver::Solve(MathematicalProgram& prog) const {
+  const auto setup_start = std::chrono::steady_clock::now();
   const int num_vars = prog.num_vars();
   MSKtask_t task = nullptr;
   MSKrescodee rescode;
@@ -699,11 +703,13 @@ SolutionResult MosekSolver::Solve(MathematicalProgram& prog) const {
 
   SolutionResult result = SolutionResult::kUnknownError;
   // Run optimizer.
+  const auto solve_start = std::chrono::steady_clock::now();
   if (rescode == MSK_RES_OK) {
     // TODO(hongkai.dai@tri.global): add trmcode to the returned struct.
     MSKrescodee trmcode;  // termination code
     rescode = MSK_optimizetrm(task, &trmcode);
   }
+  const auto solve_end = std::chrono::steady_clock::now();
 
   // Determines the solution type.
   // TODO(hongkai.dai@tri.global) : add the integer solution type. And test
@@ -722,6 +728,34 @@ SolutionResult MosekSolver::Solve(MathematicalProgram& prog) const {
   }
 
   SolverResult solver_result(id());
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  if (task) {
+    MSKint32t num_a_nonzeros = 0;
+    MSKint64t num_q_nonzeros = 0;
+    if (MSK_getnumanz(task, &num_a_nonzeros) == MSK_RES_OK &&
+        MSK_getnumqobjnz(task, &num_q_nonzeros) == MSK_RES_OK) {
+      statistics.num_nonzeros =
+          num_a_nonzeros + static_cast<int>(num_q_nonzeros);
+    }
+  }
+  if (rescode == MSK_RES_OK) {
+    // Mosek counts the interior-point and the simplex iterations separately.
+    MSKint32t num_intpnt_iterations = 0;
+    MSKint32t num_primal_simplex_iterations = 0;
+    MSKint32t num_dual_simplex_iterations = 0;
+    MSK_getintinf(task, MSK_IINF_INTPNT_ITER, &num_intpnt_iterations);
+    MSK_getintinf(task, MSK_IINF_SIM_PRIMAL_ITER,
+                  &num_primal_simplex_iterations);
+    MSK_getintinf(task, MSK_IINF_SIM_DUAL_ITER, &num_dual_simplex_iterations);
+    statistics.num_iterations = num_intpnt_iterations +
+                                num_primal_simplex_iterations +
+                                num_dual_simplex_iterations;
+  }
+  solver_result.set_statistics(statistics);
   // TODO(hongkai.dai@tri.global) : Add MOSEK paramaters.
   // Mosek parameter are added by enum, not by string.
   if (rescode == MSK_RES_OK) {
@@ -1,6 +1,7 @@
 #include "drake/solvers/nlopt_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include <list>
 #include <set>
@@ -28,16 +29,15 @@ Eigen::VectorXd MakeEigenVector(const std::vector<double>& x) {
   return xvec;
 }
 
-AutoDiffVecXd MakeInputAutoDiffVec(const MathematicalProgram& prog,
-                                   const Eigen::VectorXd& xvec,
-                                   const VectorXDecisionVariable& vars) {
-  const int num_vars = vars.rows();
+AutoDiffVecXd MakeInputAutoDiffVec(const Eigen::VectorXd& xvec,
+                                   const std::vector<int>& var_indices) {
+  const int num_vars = var_indices.size();
 
   auto tx = math::initializeAutoDiff(xvec);
   AutoDiffVecXd this_x(num_vars);
 
   for (int i = 0; i < num_vars; ++i) {
-    this_x(i) = tx(prog.FindDecisionVariableIndex(vars(i)));
+    this_x(i) = tx(var_indices[i]);
   }
 
   return this_x;
@@ -67,9 +67,11 @@ double EvaluateCosts(const std::vector<double>& x, std::vector<double>& grad,
 
   for (auto const& binding : prog->GetAllCosts()) {
     int num_vars = binding.GetNumElements();
+    const std::vector<int> var_indices =
+        prog->FindDecisionVariableIndices(binding);
     this_x.resize(num_vars);
     for (int i = 0; i < num_vars; ++i) {
-      this_x(i) = tx(prog->FindDecisionVariableIndex(binding.variables()(i)));
+      this_x(i) = tx(var_indices[i]);
     }
 
     binding.evaluator()->Eval(this_x, ty);
@@ -77,8 +79,7 @@ double EvaluateCosts(const std::vector<double>& x, std::vector<double>& grad,
     cost += ty(0).value();
     if (!grad.empty()) {
       for (int j = 0; j < num_vars; ++j) {
-        size_t vj_index =
-            prog->FindDecisionVariableIndex(binding.variables()(j));
+        const int vj_index = var_indices[j];
         grad[vj_index] += ty(0).derivatives()(vj_index);
       }
     }
@@ -91,17 +92,15 @@ double EvaluateCosts(const std::vector<double>& x, std::vector<double>& grad,
 /// which take only a single pointer argument.
 struct WrappedConstraint {
   WrappedConstraint(const Constraint* constraint_in,
-                    const VectorXDecisionVariable* vars_in,
-                    const MathematicalProgram* prog_in)
+                    const std::vector<int>& var_indices_in)
       : constraint(constraint_in),
-        vars(vars_in),
-        prog(prog_in),
+        var_indices(var_indices_in),
         force_bounds(false),
         force_upper(false) {}
 
   const Constraint* constraint;
-  const VectorXDecisionVariable* vars;
-  const MathematicalProgram* prog;
+  /// The indices of the constrained variables among the decision variables.
+  std::vector<int> var_indices;
   bool force_bounds;  ///< force usage of only upper or lower bounds
   bool force_upper;   ///< Only used if force_bounds is set.  Selects
                       ///< which bounds are being tested (lower bound
@@ -173,8 +172,7 @@ void EvaluateVectorConstraint(unsigned m, double* result, unsigned n,
   DRAKE_ASSERT(wrapped->active_constraints.size() == m);
 
   AutoDiffVecXd ty(num_constraints);
-  AutoDiffVecXd this_x =
-      MakeInputAutoDiffVec(*(wrapped->prog), xvec, *(wrapped->vars));
+  AutoDiffVecXd this_x = MakeInputAutoDiffVec(xvec, wrapped->var_indices);
   c->Eval(this_x, ty);
 
   const Eigen::VectorXd& lower_bound = c->lower_bound();
@@ -204,12 +202,7 @@ void EvaluateVectorConstraint(unsigned m, double* result, unsigned n,
 
   if (grad) {
     result_idx = 0;
-    const int num_v_variable = wrapped->vars->rows();
-    std::vector<size_t> v_index(num_v_variable);
-    for (int i = 0; i < num_v_variable; ++i) {
-      v_index[i] =
-          wrapped->prog->FindDecisionVariableIndex((*wrapped->vars)(i));
-    }
+    const std::vector<int>& v_index = wrapped->var_indices;
     for (int i = 0; i < num_constraints; i++) {
       if (!wrapped->active_constraints.count(i)) {
         continue;
@@ -220,8 +213,7 @@ void EvaluateVectorConstraint(unsigned m, double* result, unsigned n,
       } else if (wrapped->force_bounds && !wrapped->force_upper) {
         grad_sign = -1;
       }
-      DRAKE_ASSERT(wrapped->vars->cols() == 1);
-      for (int j = 0; j < wrapped->vars->rows(); ++j) {
+      for (int j = 0; j < static_cast<int>(v_index.size()); ++j) {
         grad[(result_idx * n) + v_index[j]] =
             ty(i).derivatives()(v_index[j]) * grad_sign;
       }
@@ -239,14 +231,14 @@ void WrapConstraint(const MathematicalProgram& prog, const Binding<C>& binding,
   // Version of the wrapped constraint which refers only to equality
   // constraints (if any), and will be used with
   // add_equality_mconstraint.
-  WrappedConstraint wrapped_eq(binding.evaluator().get(), &binding.variables(),
-                               &prog);
+  const std::vector<int> var_indices =
+      prog.FindDecisionVariableIndices(binding);
+  WrappedConstraint wrapped_eq(binding.evaluator().get(), var_indices);
 
   // Version of the wrapped constraint which refers only to inequality
   // constraints (if any), and will be used with
   // add_equality_mconstraint.
-  WrappedConstraint wrapped_in(binding.evaluator().get(), &binding.variables(),
-                               &prog);
+  WrappedConstraint wrapped_in(binding.evaluator().get(), var_indices);
 
   bool is_pure_inequality = true;
   const Eigen::VectorXd& lower_bound = binding.evaluator()->lower_bound();
@@ -319,6 +311,7 @@ bool IsVectorOfConstraintsSatisfiedAtSolution(
 bool NloptSolver::available() const { return true; }
 
 SolutionResult NloptSolver::Solve(MathematicalProgram& prog) const {
+  const auto setup_start = std::chrono::steady_clock::now();
   const int nx = prog.num_vars();
 
   // Load the algo to use and the size.
@@ -342,8 +335,10 @@ SolutionResult NloptSolver::Solve(MathematicalProgram& prog) const {
     const auto& lower_bound = c->lower_bound();
     const auto& upper_bound = c->upper_bound();
 
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const size_t idx = prog.FindDecisionVariableIndex(binding.variables()(k));
+      const size_t idx = var_indices[k];
       xlow[idx] = std::max(lower_bound(k), xlow[idx]);
       xupp[idx] = std::min(upper_bound(k), xupp[idx]);
       if (x[idx] < xlow[idx]) {
@@ -400,6 +395,7 @@ SolutionResult NloptSolver::Solve(MathematicalProgram& prog) const {
   double minf = 0;
   const double kUnboundedTol = -1E30;
   SolverResult solver_result(id());
+  const auto solve_start = std::chrono::steady_clock::now();
   try {
     const nlopt::result nlopt_result = opt.optimize(x, minf);
     if (nlopt_result == nlopt::SUCCESS ||
@@ -478,6 +474,16 @@ SolutionResult NloptSolver::Solve(MathematicalProgram& prog) const {
     result = SolutionResult::kUnknownError;
   }
 
+  const auto solve_end = std::chrono::steady_clock::now();
+
+  // NLopt reports neither its iterations nor, since it works with dense
+  // gradients, any nonzeros.
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  solver_result.set_statistics(statistics);
   solver_result.set_optimal_cost(minf);
   prog.SetSolverResult(solver_result);
   return result;
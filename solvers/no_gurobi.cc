@@ -7,6 +7,20 @@
 namespace drake {
 namespace solvers {
 
+class GurobiSolver::Session {};
+
+std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireLicense() {
+  return std::shared_ptr<GurobiSolver::License>();
+}
+
+GurobiSolver::GurobiSolver() = default;
+
+GurobiSolver::~GurobiSolver() = default;
+
+void GurobiSolver::set_persistent_session(bool persistent_session) {
+  persistent_session_ = persistent_session;
+}
+
 bool GurobiSolver::available() const {
   return false;
 }
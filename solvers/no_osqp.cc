@@ -9,6 +9,16 @@
 namespace drake {
 namespace solvers {
 
+class OsqpSolver::Workspace {};
+
+OsqpSolver::OsqpSolver() = default;
+
+OsqpSolver::~OsqpSolver() = default;
+
+void OsqpSolver::set_persistent_workspace(bool persistent_workspace) {
+  persistent_workspace_ = persistent_workspace;
+}
+
 bool OsqpSolver::available() const { return false; }
 
 SolutionResult OsqpSolver::Solve(MathematicalProgram&) const {
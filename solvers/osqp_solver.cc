@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -22,7 +26,8 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
     const VectorXDecisionVariable& x = quadratic_cost.variables();
     // x_indices are the indices of the variables x (the variables bound with
     // this quadratic cost) in the program decision variables.
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(quadratic_cost);
 
     // Add quadratic_cost.Q to the Hessian P.
     const std::vector<Eigen::Triplet<double>> Qi_triplets =
@@ -53,11 +58,12 @@ void ParseLinearCosts(const MathematicalProgram& prog, std::vector<c_float>* q,
 
   // Loop over the linear costs stored inside prog.
   for (const auto& linear_cost : prog.linear_costs()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(linear_cost);
     for (int i = 0; i < static_cast<int>(linear_cost.GetNumElements()); ++i) {
       // Append the linear cost term to q.
       if (linear_cost.evaluator()->a()(i) != 0) {
-        const int x_index =
-            prog.FindDecisionVariableIndex(linear_cost.variables()(i));
+        const int x_index = x_indices[i];
         q->at(x_index) += linear_cost.evaluator()->a()(i);
       }
     }
@@ -88,9 +94,9 @@ void ParseLinearConstraints(const MathematicalProgram& prog,
   // Loop over the linear constraints, stack them to get l, u and A.
   for (const auto& constraint : linear_constraints) {
     const std::vector<int> x_indices =
-        prog.FindDecisionVariableIndices(constraint.variables());
+        prog.FindDecisionVariableIndices(constraint);
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
     // Append constraint.A to osqp A.
     for (const auto& Ai_triplet : Ai_triplets) {
       A_triplets->emplace_back(*num_A_rows + Ai_triplet.row(),
@@ -114,12 +120,12 @@ void ParseBoundingBoxConstraints(
     std::vector<c_float>* u, int* num_A_rows) {
   // Loop over the linear constraints, stack them to get l, u and A.
   for (const auto& constraint : prog.bounding_box_constraints()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(constraint);
     // Append constraint.A to osqp A.
     for (int i = 0; i < static_cast<int>(constraint.GetNumElements()); ++i) {
-      A_triplets->emplace_back(
-          *num_A_rows + i,
-          prog.FindDecisionVariableIndex(constraint.variables()(i)),
-          static_cast<c_float>(1));
+      A_triplets->emplace_back(*num_A_rows + i, x_indices[i],
+                               static_cast<c_float>(1));
     }
     const int num_Ai_rows = constraint.evaluator()->num_constraints();
     l->reserve(l->size() + num_Ai_rows);
@@ -197,11 +203,135 @@ void SetOsqpSolverSettings(MathematicalProgram* prog, OSQPSettings* settings) {
                        &(settings->polish_refine_iter));
   SetOsqpSolverSetting(options_int, "verbose", &(settings->verbose));
 }
+
+// Returns true if the two compressed sparse matrices have the same size and
+// the same sparsity pattern.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& mat,
+                             const std::vector<c_int>& outer_indices,
+                             const std::vector<c_int>& inner_indices) {
+  if (static_cast<int>(outer_indices.size()) != mat.cols() + 1 ||
+      static_cast<int>(inner_indices.size()) != mat.nonZeros()) {
+    return false;
+  }
+  for (int i = 0; i < mat.cols() + 1; ++i) {
+    if (outer_indices[i] != *(mat.outerIndexPtr() + i)) return false;
+  }
+  for (int i = 0; i < mat.nonZeros(); ++i) {
+    if (inner_indices[i] != *(mat.innerIndexPtr() + i)) return false;
+  }
+  return true;
+}
 }  // namespace
 
+class OsqpSolver::Workspace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  // Sets up a new OSQP workspace for the problem
+  // min 0.5 xᵀPx + qᵀx
+  // s.t l ≤ Ax ≤ u
+  // where P only contains the upper triangular part of the Hessian.
+  // settings_double and settings_int are the solver options used to populate
+  // settings, which are stored to detect changes in the options.
+  Workspace(const Eigen::SparseMatrix<c_float>& P, std::vector<c_float>* q,
+            const Eigen::SparseMatrix<c_float>& A, std::vector<c_float>* l,
+            std::vector<c_float>* u, OSQPSettings* settings,
+            const std::map<std::string, double>& settings_double,
+            const std::map<std::string, int>& settings_int)
+      : settings_double_(settings_double), settings_int_(settings_int) {
+    StoreSparsityPattern(P, &P_outer_indices_, &P_inner_indices_);
+    StoreSparsityPattern(A, &A_outer_indices_, &A_inner_indices_);
+
+    OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    data->n = P.cols();
+    data->m = A.rows();
+    data->P = EigenSparseToCSC(P);
+    data->q = q->data();
+    data->A = EigenSparseToCSC(A);
+    data->l = l->data();
+    data->u = u->data();
+
+    work_ = osqp_setup(data, settings);
+
+    // OSQP keeps its own copies of the problem data, so we can release ours.
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+  }
+
+  ~Workspace() {
+    if (work_) osqp_cleanup(work_);
+  }
+
+  OSQPWorkspace* work() const { return work_; }
+
+  // Returns true if a problem with data P and A and solver options
+  // settings_double and settings_int can be solved by updating this workspace.
+  bool CanUpdate(const Eigen::SparseMatrix<c_float>& P,
+                 const Eigen::SparseMatrix<c_float>& A,
+                 const std::map<std::string, double>& settings_double,
+                 const std::map<std::string, int>& settings_int) const {
+    return work_ != nullptr && A.rows() == work_->data->m &&
+           HaveSameSparsityPattern(P, P_outer_indices_, P_inner_indices_) &&
+           HaveSameSparsityPattern(A, A_outer_indices_, A_inner_indices_) &&
+           settings_double == settings_double_ && settings_int == settings_int_;
+  }
+
+  // Updates the numerical values of the problem data.
+  // @pre CanUpdate() returns true for P and A.
+  // @returns the OSQP exit flag, zero on success.
+  c_int Update(Eigen::SparseMatrix<c_float>* P, std::vector<c_float>* q,
+               Eigen::SparseMatrix<c_float>* A, std::vector<c_float>* l,
+               std::vector<c_float>* u) {
+    c_int exitflag = osqp_update_lin_cost(work_, q->data());
+    if (!exitflag) exitflag = osqp_update_bounds(work_, l->data(), u->data());
+    // Passing nullptr as the indices updates all the non-zero entries.
+    if (!exitflag) {
+      exitflag =
+          osqp_update_P_A(work_, P->valuePtr(), nullptr, P->nonZeros(),
+                          A->valuePtr(), nullptr, A->nonZeros());
+    }
+    return exitflag;
+  }
+
+ private:
+  static void StoreSparsityPattern(const Eigen::SparseMatrix<c_float>& mat,
+                                   std::vector<c_int>* outer_indices,
+                                   std::vector<c_int>* inner_indices) {
+    outer_indices->assign(mat.outerIndexPtr(),
+                          mat.outerIndexPtr() + mat.cols() + 1);
+    inner_indices->assign(mat.innerIndexPtr(),
+                          mat.innerIndexPtr() + mat.nonZeros());
+  }
+
+  OSQPWorkspace* work_{nullptr};
+  std::vector<c_int> P_outer_indices_;
+  std::vector<c_int> P_inner_indices_;
+  std::vector<c_int> A_outer_indices_;
+  std::vector<c_int> A_inner_indices_;
+  const std::map<std::string, double> settings_double_;
+  const std::map<std::string, int> settings_int_;
+};
+
+OsqpSolver::OsqpSolver() = default;
+
+OsqpSolver::~OsqpSolver() = default;
+
+void OsqpSolver::set_persistent_workspace(bool persistent_workspace) {
+  persistent_workspace_ = persistent_workspace;
+  if (!persistent_workspace_) workspace_.reset();
+}
+
 bool OsqpSolver::available() const { return true; }
 
 SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
+  const auto setup_start = std::chrono::steady_clock::now();
   // OSQP solves a convex quadratic programming problem
   // min 0.5 xᵀPx + qᵀx
   // s.t l ≤ Ax ≤ u
@@ -215,46 +345,82 @@ SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
   ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
   ParseLinearCosts(prog, &q, &constant_cost_term);
 
+  // OSQP only uses the upper triangular part of P. Extracting it here makes
+  // the sparsity pattern of P match the one stored in the OSQP workspace, so
+  // that the values of P can later be updated in place.
+  Eigen::SparseMatrix<c_float> P_upper =
+      P_sparse.triangularView<Eigen::Upper>();
+  P_upper.makeCompressed();
+
   // Parse the linear constraints.
   Eigen::SparseMatrix<c_float> A_sparse;
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
+  A_sparse.makeCompressed();
+
+  const std::map<std::string, double>& options_double =
+      prog.GetSolverOptionsDouble(id());
+  const std::map<std::string, int>& options_int =
+      prog.GetSolverOptionsInt(id());
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data;  // OSQPData
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-  // Default polish to true, to get an accurate solution.
-  // TODO(hongkai.dai): add a setter so that we can turn off polishing.
-  settings->polish = 1;
-  settings->verbose = 0;
-  SetOsqpSolverSettings(&prog, settings);
-
-  // Setup workspace.
-  // OSQP structures.
-  OSQPWorkspace* work;  // Workspace
-  work = osqp_setup(data, settings);
+  std::unique_ptr<Workspace> local_workspace;
+  Workspace* workspace = nullptr;
+  c_int osqp_exitflag = 0;
+  if (persistent_workspace_ && workspace_ &&
+      workspace_->CanUpdate(P_upper, A_sparse, options_double, options_int)) {
+    // The iterates of the previous solve are kept in the workspace and used
+    // as the starting point of this solve.
+    workspace = workspace_.get();
+    osqp_exitflag = workspace->Update(&P_upper, &q, &A_sparse, &l, &u);
+  } else {
+    // Define Solver settings as default.
+    // Problem settings
+    OSQPSettings* settings =
+        static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    osqp_set_default_settings(settings);
+    // Default polish to true, to get an accurate solution.
+    // TODO(hongkai.dai): add a setter so that we can turn off polishing.
+    settings->polish = 1;
+    settings->verbose = 0;
+    SetOsqpSolverSettings(&prog, settings);
+
+    // Setup workspace.
+    // Release the previous workspace first, so that only one is allocated.
+    workspace_.reset();
+    local_workspace = std::make_unique<Workspace>(
+        P_upper, &q, A_sparse, &l, &u, settings, options_double, options_int);
+    c_free(settings);
+    ++num_workspace_setups_;
+    workspace = local_workspace.get();
+    if (!workspace->work()) osqp_exitflag = 1;
+  }
+
+  // Warm-start the primal iterate from the initial guess, if fully specified.
+  const Eigen::VectorXd& x0 = prog.initial_guess();
+  if (!osqp_exitflag && x0.size() > 0 && !x0.array().isNaN().any()) {
+    std::vector<c_float> x0_osqp(x0.data(), x0.data() + x0.size());
+    osqp_exitflag = osqp_warm_start_x(workspace->work(), x0_osqp.data());
+  }
 
   // Solve Problem.
-  c_int osqp_exitflag = osqp_solve(work);
+  const auto solve_start = std::chrono::steady_clock::now();
+  if (!osqp_exitflag) osqp_exitflag = osqp_solve(workspace->work());
+  const auto solve_end = std::chrono::steady_clock::now();
+  OSQPWorkspace* work = workspace->work();
 
   SolutionResult solution_result;
   SolverResult solver_result(id());
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  statistics.num_nonzeros =
+      static_cast<int>(P_upper.nonZeros() + A_sparse.nonZeros());
+  if (!osqp_exitflag) {
+    statistics.num_iterations = static_cast<int>(work->info->iter);
+  }
+  solver_result.set_statistics(statistics);
   if (osqp_exitflag) {
     solution_result = SolutionResult::kInvalidInput;
   } else {
@@ -289,18 +455,14 @@ SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
     }
   }
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Keep the workspace for the next solve in the persistent workspace mode.
+  // Otherwise local_workspace releases it.
+  if (persistent_workspace_ && local_workspace) {
+    workspace_ = std::move(local_workspace);
+  } else if (osqp_exitflag) {
+    // Do not reuse a workspace that failed to update.
+    workspace_.reset();
+  }
 
   prog.SetSolverResult(solver_result);
   return solution_result;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/mathematical_program_solver_interface.h"
 
@@ -10,8 +12,8 @@ class OsqpSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolver)
 
-  OsqpSolver() = default;
-  ~OsqpSolver() override = default;
+  OsqpSolver();
+  ~OsqpSolver() override;
 
   // This solver is implemented in various pieces depending on if Osqp was
   // available during compilation.
@@ -23,6 +25,42 @@ class OsqpSolver : public MathematicalProgramSolverInterface {
 
   /// @return same as MathematicalProgramSolverInterface::solver_id()
   static SolverId id();
+
+  /// Enables or disables the persistent workspace mode. By default, every
+  /// call to Solve() sets up a new OSQP workspace, which includes the
+  /// factorization of the KKT matrix. When this mode is enabled, the OSQP
+  /// workspace is kept after Solve() returns. On the next call, if the program
+  /// has the same number of variables and constraints, the same sparsity
+  /// pattern for the Hessian of the costs and for the linear constraints, and
+  /// the same solver options, only the numerical values of the problem data
+  /// are updated and the solver is warm-started from the primal and dual
+  /// iterates of the previous solve. This is useful for programs solved
+  /// repeatedly with new data, such as in model predictive control.
+  /// Otherwise, a new workspace is set up in place of the old one.
+  /// Disabling this mode releases the workspace.
+  /// In either mode, if the initial guess of the program is set for all its
+  /// decision variables, it is used as the starting primal iterate.
+  /// @note The workspace is stored within this solver, and therefore calls to
+  /// Solve() must not be made concurrently from different threads.
+  void set_persistent_workspace(bool persistent_workspace);
+
+  /// Returns `true` if the persistent workspace mode is enabled.
+  /// @see set_persistent_workspace().
+  bool persistent_workspace() const { return persistent_workspace_; }
+
+  /// Returns the number of times an OSQP workspace has been set up by Solve()
+  /// since this solver was constructed. With the persistent workspace mode
+  /// enabled, this only increases when the structure of the program changes.
+  int num_workspace_setups() const { return num_workspace_setups_; }
+
+ private:
+  // Holds the OSQP workspace along with the data needed to decide whether it
+  // can be reused for a new program. Defined in the translation unit.
+  class Workspace;
+
+  bool persistent_workspace_{false};
+  mutable std::unique_ptr<Workspace> workspace_;
+  mutable int num_workspace_setups_{0};
 };
 }  // namespace solvers
 }  // namespace drake
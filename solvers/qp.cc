@@ -24,7 +24,7 @@ using namespace std;
 // MatrixBase<tB>& f, const MatrixBase<tC>& Aeq, const MatrixBase<tD>& beq,
 // const MatrixBase<tE>& Ain, const MatrixBase<tF>& bin, set<int>& active,
 // MatrixBase<tG>& x)
-int fastQPThatTakesQinv(vector<MatrixXd*> QinvblkDiag, const VectorXd& f,
+int fastQPThatTakesQinv(const vector<MatrixXd*>& QinvblkDiag, const VectorXd& f,
                         const MatrixXd& Aeq, const VectorXd& beq,
                         const MatrixXd& Ain, const VectorXd& bin,
                         // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
@@ -71,7 +71,7 @@ int fastQPThatTakesQinv(vector<MatrixXd*> QinvblkDiag, const VectorXd& f,
   //  for (typename vector< MatrixBase<tA>* >::iterator
   //  iterQinv=QinvblkDiag.begin(); iterQinv!=QinvblkDiag.end(); iterQinv++) {
   //    MatrixBase<tA> *thisQinv = *iterQinv;
-  for (vector<MatrixXd*>::iterator iterQinv = QinvblkDiag.begin();
+  for (vector<MatrixXd*>::const_iterator iterQinv = QinvblkDiag.begin();
        iterQinv != QinvblkDiag.end(); iterQinv++) {
     MatrixXd* thisQinv = *iterQinv;
     int numRow = thisQinv->rows();
@@ -149,7 +149,7 @@ int fastQPThatTakesQinv(vector<MatrixXd*> QinvblkDiag, const VectorXd& f,
 
       if (n_active > 0) {
         startrow = 0;
-        for (vector<MatrixXd*>::iterator iterQinv = QinvblkDiag.begin();
+        for (vector<MatrixXd*>::const_iterator iterQinv = QinvblkDiag.begin();
              iterQinv != QinvblkDiag.end(); iterQinv++) {
           MatrixXd* thisQinv = (*iterQinv);
           d = thisQinv->rows();
@@ -232,8 +232,9 @@ int fastQPThatTakesQinv(vector<MatrixXd*> QinvblkDiag, const VectorXd& f,
 // int fastQP(vector< MatrixBase<tA>* > QblkDiag, const MatrixBase<tB>& f, const
 // MatrixBase<tC>& Aeq, const MatrixBase<tD>& beq, const MatrixBase<tE>& Ain,
 // const MatrixBase<tF>& bin, set<int>& active, MatrixBase<tG>& x)
-int fastQP(vector<MatrixXd*> QblkDiag, const VectorXd& f, const MatrixXd& Aeq,
-           const VectorXd& beq, const MatrixXd& Ain, const VectorXd& bin,
+int fastQP(const vector<MatrixXd*>& QblkDiag, const VectorXd& f,
+           const MatrixXd& Aeq, const VectorXd& beq, const MatrixXd& Ain,
+           const VectorXd& bin,
            // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
            set<int>& active, VectorXd& x) {
   /* min 1/2 * x'QblkDiag'x + f'x s.t A x = b, Ain x <= bin
@@ -262,7 +263,7 @@ int fastQP(vector<MatrixXd*> QblkDiag, const VectorXd& f, const MatrixXd& Aeq,
   // typedef typename vector< MatrixBase<tA> >::iterator Qiterator;
 
   int i = 0;
-  for (vector<MatrixXd*>::iterator iterQ = QblkDiag.begin();
+  for (vector<MatrixXd*>::const_iterator iterQ = QblkDiag.begin();
        iterQ != QblkDiag.end(); iterQ++) {
     MatrixXd* thisQ = *iterQ;
     int numRow = thisQ->rows();
@@ -390,7 +391,7 @@ int myGRBaddconstrs(GRBmodel* model, MatrixBase<DerivedA> const& A,
 // f, const MatrixBase<tB>& Aeq, const MatrixBase<tC>& beq, const
 // MatrixBase<tD>& Ain, const MatrixBase<tE>& bin, VectorXd& lb, VectorXd& ub,
 // set<int>& active, VectorXd& x)
-GRBmodel* gurobiQP(GRBenv* env, vector<MatrixXd*> QblkDiag,
+GRBmodel* gurobiQP(GRBenv* env, const vector<MatrixXd*>& QblkDiag,
                    // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
                    VectorXd& f,
                    const MatrixXd& Aeq, const VectorXd& beq,
@@ -419,7 +420,7 @@ GRBmodel* gurobiQP(GRBenv* env, vector<MatrixXd*> QblkDiag,
       env);
 
   int startrow = 0, d;
-  for (vector<MatrixXd*>::iterator iterQ = QblkDiag.begin();
+  for (vector<MatrixXd*>::const_iterator iterQ = QblkDiag.begin();
        iterQ != QblkDiag.end(); iterQ++) {
     MatrixXd* Q = *iterQ;
 
@@ -497,7 +498,7 @@ GRBmodel* gurobiQP(GRBenv* env, vector<MatrixXd*> QblkDiag,
   return model;
 }
 
-GRBmodel* gurobiActiveSetQP(GRBenv* env, vector<MatrixXd*> QblkDiag,
+GRBmodel* gurobiActiveSetQP(GRBenv* env, const vector<MatrixXd*>& QblkDiag,
                             // TODO(#2274) NOLINTNEXTLINE(runtime/references).
                             VectorXd& f,
                             const MatrixXd& Aeq,
@@ -532,7 +533,7 @@ GRBmodel* gurobiActiveSetQP(GRBenv* env, vector<MatrixXd*> QblkDiag,
       env);
 
   int startrow = 0, d;
-  for (vector<MatrixXd*>::iterator iterQ = QblkDiag.begin();
+  for (vector<MatrixXd*>::const_iterator iterQ = QblkDiag.begin();
        iterQ != QblkDiag.end(); iterQ++) {
     MatrixXd* Q = *iterQ;
 
@@ -7,7 +7,11 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 
+#include "drake/common/never_destroyed.h"
 #include "drake/math/cross_product.h"
 #include "drake/solvers/bilinear_product_util.h"
 
@@ -481,10 +485,10 @@ void ComputeHalfSpaceRelaxationForBoxSphereIntersection(
     prog_normal.AddLinearConstraint(n_var.dot(pt) >= d_var(0));
   }
 
-  // TODO(hongkai.dai): This optimization is expensive, especially if we have
-  // multiple rotation matrices, all relaxed with the same number of binary
-  // variables per half axis, the result `n` and `d` are the same. Should
-  // consider hard-coding the result, to avoid repeated computation.
+  // This optimization is expensive, but its result only depends on the box.
+  // AddRotationMatrixMcCormickEnvelopeMilpConstraints() computes it once for
+  // each number of binary variables per half axis, and reuses the resulting
+  // constraints for all of the rotation matrices.
 
   Vector4<symbolic::Expression> lorentz_cone_vars;
   lorentz_cone_vars << 1, n_var;
@@ -1129,14 +1133,43 @@ void AddCrossProductImpliedOrthantConstraint(
     }
   }
 }
-}  // namespace
 
-AddRotationMatrixMcCormickEnvelopeReturnType
-AddRotationMatrixMcCormickEnvelopeMilpConstraints(
+// For convenience, we also introduce additional expressions to
+// represent the individual sections of the real line
+//   CRpos[k](i,j) = BRpos[k](i,j) if k=N-1, otherwise
+//   CRpos[k](i,j) = BRpos[k](i,j) - BRpos[k+1](i,j)
+void MakeMcCormickIntervalExpressions(
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRpos,
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRneg,
+    std::vector<Matrix3<Expression>>* CRpos,
+    std::vector<Matrix3<Expression>>* CRneg) {
+  const int num_binary_vars_per_half_axis = BRpos.size();
+  CRpos->clear();
+  CRneg->clear();
+  CRpos->reserve(num_binary_vars_per_half_axis);
+  CRneg->reserve(num_binary_vars_per_half_axis);
+  for (int k = 0; k < num_binary_vars_per_half_axis - 1; k++) {
+    CRpos->push_back(BRpos[k] - BRpos[k + 1]);
+    CRneg->push_back(BRneg[k] - BRneg[k + 1]);
+  }
+  CRpos->push_back(
+    BRpos[num_binary_vars_per_half_axis - 1].cast<symbolic::Expression>());
+  CRneg->push_back(
+    BRneg[num_binary_vars_per_half_axis - 1].cast<symbolic::Expression>());
+}
+
+// Adds all of the constraints of
+// AddRotationMatrixMcCormickEnvelopeMilpConstraints() on the newly created
+// variables, except for the roll-pitch-yaw limits. These depend only on
+// num_binary_vars_per_half_axis.
+void AddMcCormickEnvelopeConstraints(
     MathematicalProgram* prog,
     const Eigen::Ref<const MatrixDecisionVariable<3, 3>>& R,
-    int num_binary_vars_per_half_axis, RollPitchYawLimits limits) {
-  DRAKE_DEMAND(num_binary_vars_per_half_axis >= 1);
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRpos,
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRneg,
+    const std::vector<Matrix3<Expression>>& CRpos,
+    const std::vector<Matrix3<Expression>>& CRneg) {
+  const int num_binary_vars_per_half_axis = BRpos.size();
 
   // Use a simple lambda to make the constraints more readable below.
   // Note that
@@ -1146,33 +1179,6 @@ AddRotationMatrixMcCormickEnvelopeMilpConstraints(
     return EnvelopeMinValue(k, num_binary_vars_per_half_axis);
   };
 
-  // Creates binary decision variables which discretize each axis.
-  //   BRpos[k](i,j) = 1 => R(i,j) >= phi(k)
-  //   BRneg[k](i,j) = 1 => R(i,j) <= -phi(k)
-  std::vector<MatrixDecisionVariable<3, 3>> BRpos, BRneg;
-  for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
-    BRpos.push_back(
-        prog->NewBinaryVariables<3, 3>("BRpos" + std::to_string(k)));
-    BRneg.push_back(
-        prog->NewBinaryVariables<3, 3>("BRneg" + std::to_string(k)));
-  }
-
-  // For convenience, we also introduce additional expressions to
-  // represent the individual sections of the real line
-  //   CRpos[k](i,j) = BRpos[k](i,j) if k=N-1, otherwise
-  //   CRpos[k](i,j) = BRpos[k](i,j) - BRpos[k+1](i,j)
-  std::vector<Matrix3<Expression>> CRpos, CRneg;
-  CRpos.reserve(num_binary_vars_per_half_axis);
-  CRneg.reserve(num_binary_vars_per_half_axis);
-  for (int k = 0; k < num_binary_vars_per_half_axis - 1; k++) {
-    CRpos.push_back(BRpos[k] - BRpos[k + 1]);
-    CRneg.push_back(BRneg[k] - BRneg[k + 1]);
-  }
-  CRpos.push_back(
-    BRpos[num_binary_vars_per_half_axis - 1].cast<symbolic::Expression>());
-  CRneg.push_back(
-    BRneg[num_binary_vars_per_half_axis - 1].cast<symbolic::Expression>());
-
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 3; j++) {
       for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
@@ -1217,12 +1223,6 @@ AddRotationMatrixMcCormickEnvelopeMilpConstraints(
   AddNotInSameOrOppositeOrthantConstraint(prog, BRpos[0]);
   AddNotInSameOrOppositeOrthantConstraint(prog, BRpos[0].transpose());
 
-  // Add angle limit constraints.
-  // Bounding box will turn on/off an orthant.  It's sufficient to add the
-  // constraints only to the positive orthant.
-  AddBoundingBoxConstraintsImpliedByRollPitchYawLimitsToBinary(prog, BRpos[0],
-                                                               limits);
-
   // Add constraints to the column and row vectors.
   std::vector<Vector3<Expression>>
       cpos(num_binary_vars_per_half_axis),
@@ -1250,6 +1250,179 @@ AddRotationMatrixMcCormickEnvelopeMilpConstraints(
 
   AddCrossProductImpliedOrthantConstraint(prog, BRpos[0]);
   AddCrossProductImpliedOrthantConstraint(prog, BRpos[0].transpose());
+}
+
+// Stacks R, BRpos[0], ..., BRpos[N-1], BRneg[0], ..., BRneg[N-1], each in
+// column-major order.
+VectorXDecisionVariable StackMcCormickEnvelopeVariables(
+    const Eigen::Ref<const MatrixDecisionVariable<3, 3>>& R,
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRpos,
+    const std::vector<MatrixDecisionVariable<3, 3>>& BRneg) {
+  const int num_binary_vars_per_half_axis = BRpos.size();
+  VectorXDecisionVariable vars(9 * (1 + 2 * num_binary_vars_per_half_axis));
+  int index = 0;
+  auto append = [&vars, &index](
+      const Eigen::Ref<const MatrixDecisionVariable<3, 3>>& M) {
+    for (int j = 0; j < 3; ++j) {
+      for (int i = 0; i < 3; ++i) {
+        vars(index++) = M(i, j);
+      }
+    }
+  };
+  append(R);
+  for (const auto& B : BRpos) append(B);
+  for (const auto& B : BRneg) append(B);
+  return vars;
+}
+
+// The constraints added by AddMcCormickEnvelopeConstraints(), as sparse
+// linear inequality and equality constraints on the variables stacked by
+// StackMcCormickEnvelopeVariables().
+struct McCormickEnvelopeTemplate {
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd lb;
+  Eigen::VectorXd ub;
+  Eigen::SparseMatrix<double> Aeq;
+  Eigen::VectorXd beq;
+};
+
+// Derives the McCormickEnvelopeTemplate by adding the symbolic constraints to
+// a scratch program, and reading back their coefficients.
+McCormickEnvelopeTemplate MakeMcCormickEnvelopeTemplate(
+    int num_binary_vars_per_half_axis) {
+  MathematicalProgram scratch;
+  const MatrixDecisionVariable<3, 3> R =
+      scratch.NewContinuousVariables<3, 3>("R");
+  std::vector<MatrixDecisionVariable<3, 3>> BRpos, BRneg;
+  for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
+    BRpos.push_back(scratch.NewBinaryVariables<3, 3>("BRpos"));
+  }
+  for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
+    BRneg.push_back(scratch.NewBinaryVariables<3, 3>("BRneg"));
+  }
+  std::vector<Matrix3<Expression>> CRpos, CRneg;
+  MakeMcCormickIntervalExpressions(BRpos, BRneg, &CRpos, &CRneg);
+  AddMcCormickEnvelopeConstraints(&scratch, R, BRpos, BRneg, CRpos, CRneg);
+
+  // Maps the index of each variable in the scratch program to its position in
+  // the stacked variables.
+  const VectorXDecisionVariable vars =
+      StackMcCormickEnvelopeVariables(R, BRpos, BRneg);
+  std::vector<int> column(scratch.num_vars());
+  for (int j = 0; j < vars.rows(); ++j) {
+    column[scratch.FindDecisionVariableIndex(vars(j))] = j;
+  }
+
+  // Every constraint above is linear, so it lands in one of the three lists
+  // of linear constraints below.
+  std::vector<Eigen::Triplet<double>> triplets, triplets_eq;
+  std::vector<double> lb, ub, beq;
+  auto append = [&scratch, &column](
+      const Binding<LinearConstraint>& binding,
+      std::vector<Eigen::Triplet<double>>* A_triplets,
+      std::vector<double>* lower, std::vector<double>* upper) {
+    const Eigen::SparseMatrix<double>& A = binding.evaluator()->get_sparse_A();
+    const int row_offset = lower->size();
+    for (int k = 0; k < A.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, k); it; ++it) {
+        A_triplets->emplace_back(
+            row_offset + it.row(),
+            column[scratch.FindDecisionVariableIndex(
+                binding.variables()(it.col()))],
+            it.value());
+      }
+    }
+    for (int i = 0; i < A.rows(); ++i) {
+      lower->push_back(binding.evaluator()->lower_bound()(i));
+      if (upper != nullptr) {
+        upper->push_back(binding.evaluator()->upper_bound()(i));
+      }
+    }
+  };
+  for (const auto& binding : scratch.linear_constraints()) {
+    append(binding, &triplets, &lb, &ub);
+  }
+  for (const auto& binding : scratch.bounding_box_constraints()) {
+    append(binding, &triplets, &lb, &ub);
+  }
+  for (const auto& binding : scratch.linear_equality_constraints()) {
+    append(binding, &triplets_eq, &beq, nullptr);
+  }
+
+  McCormickEnvelopeTemplate result;
+  result.A.resize(lb.size(), vars.rows());
+  result.A.setFromTriplets(triplets.begin(), triplets.end());
+  result.lb = Eigen::Map<const Eigen::VectorXd>(lb.data(), lb.size());
+  result.ub = Eigen::Map<const Eigen::VectorXd>(ub.data(), ub.size());
+  result.Aeq.resize(beq.size(), vars.rows());
+  result.Aeq.setFromTriplets(triplets_eq.begin(), triplets_eq.end());
+  result.beq = Eigen::Map<const Eigen::VectorXd>(beq.data(), beq.size());
+  return result;
+}
+
+// The McCormickEnvelopeTemplate of each num_binary_vars_per_half_axis used so
+// far in this process.
+struct McCormickEnvelopeTemplateCache {
+  std::mutex mutex;
+  std::map<int, std::unique_ptr<const McCormickEnvelopeTemplate>> templates;
+};
+
+const McCormickEnvelopeTemplate& GetMcCormickEnvelopeTemplate(
+    int num_binary_vars_per_half_axis) {
+  static never_destroyed<McCormickEnvelopeTemplateCache> cache;
+  std::lock_guard<std::mutex> lock(cache.access().mutex);
+  std::unique_ptr<const McCormickEnvelopeTemplate>& result =
+      cache.access().templates[num_binary_vars_per_half_axis];
+  if (result == nullptr) {
+    result = std::make_unique<const McCormickEnvelopeTemplate>(
+        MakeMcCormickEnvelopeTemplate(num_binary_vars_per_half_axis));
+  }
+  // The templates are never removed, so the reference remains valid.
+  return *result;
+}
+
+}  // namespace
+
+AddRotationMatrixMcCormickEnvelopeReturnType
+AddRotationMatrixMcCormickEnvelopeMilpConstraints(
+    MathematicalProgram* prog,
+    const Eigen::Ref<const MatrixDecisionVariable<3, 3>>& R,
+    int num_binary_vars_per_half_axis, RollPitchYawLimits limits) {
+  DRAKE_DEMAND(num_binary_vars_per_half_axis >= 1);
+
+  // Creates binary decision variables which discretize each axis.
+  //   BRpos[k](i,j) = 1 => R(i,j) >= phi(k)
+  //   BRneg[k](i,j) = 1 => R(i,j) <= -phi(k)
+  std::vector<MatrixDecisionVariable<3, 3>> BRpos, BRneg;
+  for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
+    BRpos.push_back(
+        prog->NewBinaryVariables<3, 3>("BRpos" + std::to_string(k)));
+    BRneg.push_back(
+        prog->NewBinaryVariables<3, 3>("BRneg" + std::to_string(k)));
+  }
+
+  std::vector<Matrix3<Expression>> CRpos, CRneg;
+  MakeMcCormickIntervalExpressions(BRpos, BRneg, &CRpos, &CRneg);
+
+  // The envelope is the same for every R with the same
+  // num_binary_vars_per_half_axis, so its coefficients are derived once, and
+  // added here in bulk on this R and its binary variables.
+  const McCormickEnvelopeTemplate& envelope =
+      GetMcCormickEnvelopeTemplate(num_binary_vars_per_half_axis);
+  const VectorXDecisionVariable vars =
+      StackMcCormickEnvelopeVariables(R, BRpos, BRneg);
+  prog->AddConstraint(Binding<LinearConstraint>(
+      std::make_shared<LinearConstraint>(envelope.A, envelope.lb, envelope.ub),
+      vars));
+  prog->AddConstraint(Binding<LinearEqualityConstraint>(
+      std::make_shared<LinearEqualityConstraint>(envelope.Aeq, envelope.beq),
+      vars));
+
+  // Add angle limit constraints.
+  // Bounding box will turn on/off an orthant.  It's sufficient to add the
+  // constraints only to the positive orthant.
+  AddBoundingBoxConstraintsImpliedByRollPitchYawLimitsToBinary(prog, BRpos[0],
+                                                               limits);
 
   return make_tuple(CRpos, CRneg, BRpos, BRneg);
 }
@@ -1,5 +1,7 @@
 #include "drake/solvers/scs_solver.h"
 
+#include <chrono>
+
 #include <Eigen/Sparse>
 
 // clang-format off
@@ -169,8 +171,12 @@ void ParseLinearConstraint(const MathematicalProgram& prog,
   for (const auto& linear_constraint : prog.linear_constraints()) {
     const Eigen::VectorXd& ub = linear_constraint.evaluator()->upper_bound();
     const Eigen::VectorXd& lb = linear_constraint.evaluator()->lower_bound();
-    const VectorXDecisionVariable& x = linear_constraint.variables();
-    const Eigen::MatrixXd& Ai = linear_constraint.evaluator()->A();
+    // x_indices[i] is the index of x(i)
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(linear_constraint);
+    // Traverse Ai by rows, since each row is parsed separately.
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> Ai =
+        linear_constraint.evaluator()->get_sparse_A();
     for (int i = 0; i < linear_constraint.evaluator()->num_constraints();
          ++i) {
       const bool is_ub_finite{!std::isinf(ub(i))};
@@ -184,16 +190,18 @@ void ParseLinearConstraint(const MathematicalProgram& prog,
         // matrix A, in the row upper_bound_row_index.
         const int upper_bound_row_index =
             *A_row_count + num_linear_constraint_rows + (is_lb_finite ? 1 : 0);
-        for (int j = 0; j < x.rows(); ++j) {
-          if (Ai(i, j) != 0) {
-            const int xj_index = prog.FindDecisionVariableIndex(x(j));
+        for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+                 Ai, i);
+             it; ++it) {
+          if (it.value() != 0) {
+            const int xj_index = x_indices[it.col()];
             if (is_ub_finite) {
               A_triplets->emplace_back(upper_bound_row_index, xj_index,
-                                       Ai(i, j));
+                                       it.value());
             }
             if (is_lb_finite) {
               A_triplets->emplace_back(lower_bound_row_index, xj_index,
-                                       -Ai(i, j));
+                                       -it.value());
             }
           }
         }
@@ -221,18 +229,17 @@ void ParseLinearEqualityConstraint(
   // A x + s = b. s in zero cone.
   for (const auto& linear_equality_constraint :
        prog.linear_equality_constraints()) {
-    const Eigen::SparseMatrix<double> Ai =
-        linear_equality_constraint.evaluator()->GetSparseMatrix();
-    const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(Ai);
-    A_triplets->reserve(A_triplets->size() + Ai_triplets.size());
-    const solvers::VectorXDecisionVariable& x =
-        linear_equality_constraint.variables();
+    const Eigen::SparseMatrix<double>& Ai =
+        linear_equality_constraint.evaluator()->get_sparse_A();
+    A_triplets->reserve(A_triplets->size() + Ai.nonZeros());
     // x_indices[i] is the index of x(i)
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
-    for (const auto& Ai_triplet : Ai_triplets) {
-      A_triplets->emplace_back(Ai_triplet.row() + *A_row_count,
-                               x_indices[Ai_triplet.col()], Ai_triplet.value());
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(linear_equality_constraint);
+    for (int j = 0; j < Ai.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Ai, j); it; ++it) {
+        A_triplets->emplace_back(it.row() + *A_row_count, x_indices[j],
+                                 it.value());
+      }
     }
     const int num_Ai_rows =
         linear_equality_constraint.evaluator()->num_constraints();
@@ -293,8 +300,8 @@ void ParseSecondOrderConeConstraints(
   // convert this to SCS form, as -Ax + s = b, s in Lorentz cone.
   for (const auto& lorentz_cone_constraint : prog.lorentz_cone_constraints()) {
     // x_indices[i] is the index of x(i)
-    const VectorXDecisionVariable& x = lorentz_cone_constraint.variables();
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(lorentz_cone_constraint);
     const Eigen::SparseMatrix<double> Ai =
         lorentz_cone_constraint.evaluator()->A().sparseView();
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
@@ -314,8 +321,8 @@ void ParseSecondOrderConeConstraints(
 
   for (const auto& rotated_lorentz_cone :
        prog.rotated_lorentz_cone_constraints()) {
-    const VectorXDecisionVariable& x = rotated_lorentz_cone.variables();
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(rotated_lorentz_cone);
     const Eigen::SparseMatrix<double> Ai =
         rotated_lorentz_cone.evaluator()->A().sparseView();
     const Eigen::VectorXd& bi = rotated_lorentz_cone.evaluator()->b();
@@ -397,9 +404,9 @@ void ParsePositiveSemidefiniteConstraint(
     // As explained above, the off-diagonal rows are scaled by √2. Please refer
     // to https://github.com/cvxgrp/scs about the scaling factor √2.
     const std::vector<Eigen::MatrixXd>& F = lmi_constraint.evaluator()->F();
-    const VectorXDecisionVariable& x = lmi_constraint.variables();
     const int F_rows = lmi_constraint.evaluator()->matrix_rows();
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(lmi_constraint);
     int A_cone_row_count = 0;
     b->reserve(b->size() + F_rows * (F_rows + 1) / 2);
     for (int j = 0; j < F_rows; ++j) {
@@ -502,6 +509,7 @@ void SetScsProblemData(int A_row_count, int num_vars,
 bool ScsSolver::available() const { return true; }
 
 SolutionResult ScsSolver::Solve(MathematicalProgram& prog) const {
+  const auto setup_start = std::chrono::steady_clock::now();
   // SCS solves the problem in this form
   // min  cᵀx
   // s.t A x + s = b
@@ -606,10 +614,20 @@ SolutionResult ScsSolver::Solve(MathematicalProgram& prog) const {
   ScsSolution* scs_sol =
       static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
 
+  const auto solve_start = std::chrono::steady_clock::now();
   scs_int scs_status = scs(scs_problem_data, cone, scs_sol, &scs_info);
+  const auto solve_end = std::chrono::steady_clock::now();
 
   SolutionResult solution_result{SolutionResult::kUnknownError};
   SolverResult solver_result(id());
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  statistics.num_iterations = static_cast<int>(scs_info.iter);
+  statistics.num_nonzeros = static_cast<int>(A.nonZeros());
+  solver_result.set_statistics(statistics);
   if (scs_status == SCS_SOLVED || scs_status == SCS_SOLVED_INACCURATE) {
     solution_result = SolutionResult::kSolutionFound;
     solver_result.set_decision_variable_values(
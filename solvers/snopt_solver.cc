@@ -1,15 +1,18 @@
 #include "drake/solvers/snopt_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
@@ -156,8 +159,18 @@ struct SNOPTData : public MathematicalProgram::SolverData {
 struct SnoptUserFunInfo {
   const MathematicalProgram* prog_;
   const std::unordered_set<int>* cost_gradient_indices_;
+  int num_threads_{1};
 };
 
+// The f2c translation of SNOPT keeps some of its working state in static
+// variables, so concurrent solves would interfere with one another; they are
+// serialized on this mutex instead. It is recursive so that the evaluators of
+// a program may themselves solve programs with SNOPT.
+std::recursive_mutex& GetSnoptMutex() {
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
 struct SNOPTRun {
   SNOPTRun(SNOPTData* d, SnoptUserFunInfo const* snopt_userfun_info) : D(*d) {
     // Use the minimum default allocation needed by snInit.  The +1
@@ -244,6 +257,19 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
+// Returns the number of gradient entries of a single nonlinear constraint
+// binding that are reported to SNOPT, i.e., the entries of the gradient
+// sparsity pattern of its constraint if it has one, or all of them otherwise.
+template <typename C>
+int SingleNonlinearConstraintNumGradients(const Binding<C>& binding) {
+  const auto& pattern = binding.evaluator()->gradient_sparsity_pattern();
+  if (pattern) {
+    return static_cast<int>(pattern->size());
+  }
+  return SingleNonlinearConstraintSize(*binding.evaluator()) *
+         binding.GetNumElements();
+}
+
 // Evaluate a single nonlinear constraints. For generic Constraint,
 // LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
 // of the constraint directly. For some other constraint, such as
@@ -267,6 +293,53 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
                     constraint.q().cast<AutoDiffXd>());
 }
 
+// Evaluates the value and gradients of a single nonlinear constraint binding,
+// writing them into F and G starting at `constraint_index` and `grad_index`.
+template <typename C>
+void EvaluateNonlinearConstraintBinding(const MathematicalProgram& prog,
+                                        const Binding<C>& binding,
+                                        const Eigen::VectorXd& xvec,
+                                        snopt::doublereal F[],
+                                        snopt::doublereal G[],
+                                        size_t constraint_index,
+                                        size_t grad_index) {
+  const auto& c = binding.evaluator();
+  int num_constraints = SingleNonlinearConstraintSize(*c);
+
+  int num_v_variables = binding.GetNumElements();
+  const std::vector<int> var_indices =
+      prog.FindDecisionVariableIndices(binding);
+  Eigen::VectorXd this_x(num_v_variables);
+  for (int i = 0; i < num_v_variables; ++i) {
+    this_x(i) = xvec(var_indices[i]);
+  }
+
+  AutoDiffVecXd ty;
+  ty.resize(num_constraints);
+  EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
+
+  for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
+       i++) {
+    F[constraint_index++] = static_cast<snopt::doublereal>(ty(i).value());
+  }
+
+  const auto& pattern = c->gradient_sparsity_pattern();
+  if (pattern) {
+    for (const auto& entry : *pattern) {
+      G[grad_index++] = static_cast<snopt::doublereal>(
+          ty(entry.first).derivatives()(entry.second));
+    }
+    return;
+  }
+
+  for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
+       i++) {
+    for (int j = 0; j < num_v_variables; ++j) {
+      G[grad_index++] = static_cast<snopt::doublereal>(ty(i).derivatives()(j));
+    }
+  }
+}
+
 /*
  * Evaluate the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
@@ -287,34 +360,56 @@ void EvaluateNonlinearConstraints(
     const std::vector<Binding<C>>& constraint_list, snopt::doublereal F[],
     snopt::doublereal G[], size_t* constraint_index, size_t* grad_index,
     const Eigen::VectorXd& xvec) {
-  Eigen::VectorXd this_x;
   for (const auto& binding : constraint_list) {
-    const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
-
-    int num_v_variables = binding.GetNumElements();
-    this_x.resize(num_v_variables);
-    for (int i = 0; i < num_v_variables; ++i) {
-      this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
+    EvaluateNonlinearConstraintBinding(prog, binding, xvec, F, G,
+                                       *constraint_index, *grad_index);
+    *constraint_index += SingleNonlinearConstraintSize(*binding.evaluator());
+    *grad_index += SingleNonlinearConstraintNumGradients(binding);
+  }
+}
 
-    for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
-         i++) {
-      F[(*constraint_index)++] = static_cast<snopt::doublereal>(ty(i).value());
+/*
+ * Same as EvaluateNonlinearConstraints(), but the bindings whose evaluator is
+ * thread safe are evaluated concurrently on up to `num_threads` threads, once
+ * the remaining ones have been evaluated on the calling thread. The offsets of
+ * each binding in F and G are computed beforehand, so that every binding
+ * writes its values and gradients directly to their final location and the
+ * result does not depend on the number of threads.
+ */
+void EvaluateGenericConstraintsInParallel(
+    const MathematicalProgram& prog,
+    const std::vector<Binding<Constraint>>& constraint_list, int num_threads,
+    snopt::doublereal F[], snopt::doublereal G[], size_t* constraint_index,
+    size_t* grad_index, const Eigen::VectorXd& xvec) {
+  const int num_bindings = static_cast<int>(constraint_list.size());
+  std::vector<size_t> constraint_offsets(num_bindings);
+  std::vector<size_t> grad_offsets(num_bindings);
+  std::vector<int> parallel_bindings;
+  std::vector<int> serial_bindings;
+  for (int k = 0; k < num_bindings; ++k) {
+    const auto& binding = constraint_list[k];
+    constraint_offsets[k] = *constraint_index;
+    grad_offsets[k] = *grad_index;
+    *constraint_index += SingleNonlinearConstraintSize(*binding.evaluator());
+    *grad_index += SingleNonlinearConstraintNumGradients(binding);
+    if (binding.evaluator()->is_thread_safe()) {
+      parallel_bindings.push_back(k);
+    } else {
+      serial_bindings.push_back(k);
     }
+  }
 
-    for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
-         i++) {
-      for (int j = 0; j < num_v_variables; ++j) {
-        G[(*grad_index)++] =
-            static_cast<snopt::doublereal>(ty(i).derivatives()(j));
-      }
-    }
+  for (const int k : serial_bindings) {
+    EvaluateNonlinearConstraintBinding(prog, constraint_list[k], xvec, F, G,
+                                       constraint_offsets[k], grad_offsets[k]);
   }
+  ParallelFor(static_cast<int>(parallel_bindings.size()), num_threads,
+              [&](int i) {
+                const int k = parallel_bindings[i];
+                EvaluateNonlinearConstraintBinding(
+                    prog, constraint_list[k], xvec, F, G,
+                    constraint_offsets[k], grad_offsets[k]);
+              });
 }
 
 /*
@@ -326,9 +421,8 @@ std::unordered_set<int> GetCostNonzeroGradientIndices(
   std::unordered_set<int> cost_gradient_indices;
   cost_gradient_indices.reserve(prog.num_vars());
   for (const auto& cost : prog.GetAllCosts()) {
-    for (int i = 0; i < static_cast<int>(cost.GetNumElements()); ++i) {
-      cost_gradient_indices.insert(
-          prog.FindDecisionVariableIndex(cost.variables()(i)));
+    for (int var_index : prog.FindDecisionVariableIndices(cost)) {
+      cost_gradient_indices.insert(var_index);
     }
   }
   return cost_gradient_indices;
@@ -347,9 +441,11 @@ void EvaluateAllCosts(const MathematicalProgram& prog,
     auto const& obj = binding.evaluator();
 
     int num_v_variables = binding.GetNumElements();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     this_x.resize(num_v_variables);
     for (int j = 0; j < num_v_variables; ++j) {
-      this_x(j) = xvec(prog.FindDecisionVariableIndex(binding.variables()(j)));
+      this_x(j) = xvec(var_indices[j]);
     }
 
     obj->Eval(math::initializeAutoDiff(this_x), ty);
@@ -357,7 +453,7 @@ void EvaluateAllCosts(const MathematicalProgram& prog,
     F[0] += static_cast<snopt::doublereal>(ty(0).value());
 
     for (int j = 0; j < num_v_variables; ++j) {
-      size_t vj_index = prog.FindDecisionVariableIndex(binding.variables()(j));
+      const int vj_index = var_indices[j];
       cost_gradient[vj_index] +=
           static_cast<snopt::doublereal>(ty(0).derivatives()(j));
     }
@@ -408,9 +504,16 @@ int snopt_userfun(snopt::integer* Status, snopt::integer* n,
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
-  EvaluateNonlinearConstraints(*current_problem,
-                               current_problem->generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+  if (snopt_userfun_info->num_threads_ > 1) {
+    EvaluateGenericConstraintsInParallel(
+        *current_problem, current_problem->generic_constraints(),
+        snopt_userfun_info->num_threads_, F, G, &constraint_index, &grad_index,
+        xvec);
+  } else {
+    EvaluateNonlinearConstraints(*current_problem,
+                                 current_problem->generic_constraints(), F, G,
+                                 &constraint_index, &grad_index, xvec);
+  }
   EvaluateNonlinearConstraints(*current_problem,
                                current_problem->lorentz_cone_constraints(), F,
                                G, &constraint_index, &grad_index, xvec);
@@ -437,10 +540,8 @@ void UpdateNumNonlinearConstraintsAndGradients(
     const std::vector<Binding<C>>& constraint_list,
     int* num_nonlinear_constraints, int* max_num_gradients) {
   for (auto const& binding : constraint_list) {
-    auto const& c = binding.evaluator();
-    int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
-    *num_nonlinear_constraints += n;
+    *max_num_gradients += SingleNonlinearConstraintNumGradients(binding);
+    *num_nonlinear_constraints += binding.evaluator()->num_constraints();
   }
 }
 
@@ -476,13 +577,22 @@ void UpdateConstraintBoundsAndGradients(
       Fupp[*constraint_index + i] = static_cast<snopt::doublereal>(ub(i));
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
-        iGfun[*grad_index] = *constraint_index + i + 1;  // row order
-        jGvar[*grad_index] =
-            prog.FindDecisionVariableIndex(binding.variables()(j)) + 1;
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
+    if (c->gradient_sparsity_pattern()) {
+      for (const auto& entry : *c->gradient_sparsity_pattern()) {
+        iGfun[*grad_index] = *constraint_index + entry.first + 1;
+        jGvar[*grad_index] = var_indices[entry.second] + 1;
         (*grad_index)++;
       }
+    } else {
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+          iGfun[*grad_index] = *constraint_index + i + 1;  // row order
+          jGvar[*grad_index] = var_indices[j] + 1;
+          (*grad_index)++;
+        }
+      }
     }
 
     (*constraint_index) += n;
@@ -504,10 +614,11 @@ void UpdateConstraintBoundsAndGradients<LinearComplementarityConstraint>(
   for (const auto& binding : constraint_list) {
     Flow[*constraint_index] = 0;
     Fupp[*constraint_index] = 0;
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int j = 0; j < binding.evaluator()->M().rows(); ++j) {
       iGfun[*grad_index] = *constraint_index + 1;
-      jGvar[*grad_index] =
-          prog.FindDecisionVariableIndex(binding.variables()(j)) + 1;
+      jGvar[*grad_index] = var_indices[j] + 1;
       (*grad_index)++;
     }
     ++(*constraint_index);
@@ -573,12 +684,13 @@ void UpdateLinearConstraint(const MathematicalProgram& prog,
 
     const Eigen::SparseMatrix<double> A_constraint = LinearConstraintA(*c);
 
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
       for (Eigen::SparseMatrix<double>::InnerIterator it(A_constraint, k); it;
            ++it) {
-        tripletList->emplace_back(
-            *linear_constraint_index + it.row(),
-            prog.FindDecisionVariableIndex(binding.variables()(k)), it.value());
+        tripletList->emplace_back(*linear_constraint_index + it.row(),
+                                  var_indices[k], it.value());
       }
     }
 
@@ -598,12 +710,15 @@ void UpdateLinearConstraint(const MathematicalProgram& prog,
 bool SnoptSolver::available() const { return true; }
 
 SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
+  const auto setup_start = std::chrono::steady_clock::now();
   auto d = prog.GetSolverData<SNOPTData>();
   const std::unordered_set<int> cost_gradient_indices =
       GetCostNonzeroGradientIndices(prog);
   SnoptUserFunInfo snopt_userfun_info;
   snopt_userfun_info.prog_ = &prog;
   snopt_userfun_info.cost_gradient_indices_ = &cost_gradient_indices;
+  snopt_userfun_info.num_threads_ = num_threads_;
+  std::lock_guard<std::recursive_mutex> lock(GetSnoptMutex());
   SNOPTRun cur(d.get(), &snopt_userfun_info);
 
   snopt::integer nx = prog.num_vars();
@@ -628,9 +743,10 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
     const auto& lb = c->lower_bound();
     const auto& ub = c->upper_bound();
 
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const size_t vk_index =
-          prog.FindDecisionVariableIndex(binding.variables()(k));
+      const size_t vk_index = var_indices[k];
       xlow[vk_index] = std::max<snopt::doublereal>(
           static_cast<snopt::doublereal>(lb(k)), xlow[vk_index]);
       xupp[vk_index] = std::min<snopt::doublereal>(
@@ -642,9 +758,7 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
   // 0 <= x ⊥ Mx + q >= 0
   // we add the bounding box constraint x >= 0
   for (const auto& binding : prog.linear_complementarity_constraints()) {
-    for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const size_t vk_index =
-          prog.FindDecisionVariableIndex(binding.variables()(k));
+    for (int vk_index : prog.FindDecisionVariableIndices(binding)) {
       xlow[vk_index] =
           std::max<snopt::doublereal>(xlow[vk_index], snopt::doublereal(0));
     }
@@ -794,6 +908,7 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
   }
 
   snopt::integer info;
+  const auto solve_start = std::chrono::steady_clock::now();
   snopt::snopta_(
       &Cold, &nF, &nx, &nxname, &nFname, &ObjAdd, &ObjRow, Prob,
       reinterpret_cast<snopt::U_fp>(&snopt_userfun),
@@ -806,7 +921,17 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
       d->cw.data(), &d->lencw, d->iw.data(), &d->leniw, d->rw.data(), &d->lenrw,
       npname, 8 * nxname, 8 * nFname, 8 * d->lencw, 8 * d->lencw);
 
+  const auto solve_end = std::chrono::steady_clock::now();
+
   SolverResult solver_result(id());
+  // The snopta interface does not report the number of iterations.
+  SolverStatistics statistics;
+  statistics.setup_time =
+      std::chrono::duration<double>(solve_start - setup_start).count();
+  statistics.solve_time =
+      std::chrono::duration<double>(solve_end - solve_start).count();
+  statistics.num_nonzeros = static_cast<int>(lenA + lenG);
+  solver_result.set_statistics(statistics);
   solver_result.set_decision_variable_values(
       Eigen::Map<VectorX<snopt::doublereal>>(x, nx).cast<double>());
   solver_result.set_optimal_cost(*F);
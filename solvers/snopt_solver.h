@@ -19,12 +19,34 @@ class SnoptSolver : public MathematicalProgramSolverInterface  {
   // SNOPT was available during compilation.
   bool available() const override;
 
+  /// Solves @p prog. Calls from several threads are serialized, because the
+  /// SNOPT library is not reentrant.
   SolutionResult Solve(MathematicalProgram& prog) const override;
 
   SolverId solver_id() const override;
 
   /// @return same as MathematicalProgramSolverInterface::solver_id()
   static SolverId id();
+
+  /// Sets the number of threads used to evaluate the generic constraints of
+  /// the program, see MathematicalProgram::generic_constraints(). With more
+  /// than one thread, the bindings whose evaluator reports
+  /// EvaluatorBase::is_thread_safe() are evaluated concurrently in each
+  /// callback, and their values and gradients are written directly to their
+  /// rows of the constraint vector and its Jacobian. The other bindings are
+  /// evaluated on the calling thread. The result does not depend on the number
+  /// of threads. This pays off when the program has many expensive bindings,
+  /// e.g., the DirectCollocationConstraint of a trajectory optimization over
+  /// many knot points. By default, a single thread is used.
+  /// @throws std::runtime_error if `num_threads` is less than one.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used to evaluate the generic constraints.
+  /// @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
+ private:
+  int num_threads_{1};
 };
 
 }  // namespace solvers
@@ -2,6 +2,9 @@
 #include "drake/solvers/snopt_solver.h"
 /* clang-format on */
 
+#include <stdexcept>
+#include <string>
+
 #include "drake/common/never_destroyed.h"
 
 namespace drake {
@@ -16,5 +19,14 @@ SolverId SnoptSolver::id() {
   return singleton.access();
 }
 
+void SnoptSolver::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::runtime_error(
+        "SnoptSolver::set_num_threads(): the number of threads must be "
+        "positive, got " + std::to_string(num_threads) + ".");
+  }
+  num_threads_ = num_threads;
+}
+
 }  // namespace solvers
 }  // namespace drake
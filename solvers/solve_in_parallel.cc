@@ -0,0 +1,121 @@
+#include "drake/solvers/solve_in_parallel.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/parallel_for.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/linear_system_solver.h"
+#include "drake/solvers/moby_lcp_solver.h"
+#include "drake/solvers/mosek_solver.h"
+#include "drake/solvers/nlopt_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/solvers/snopt_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+std::unique_ptr<MathematicalProgramSolverInterface> MakeSolver(
+    const SolverId& solver_id) {
+  std::unique_ptr<MathematicalProgramSolverInterface> solver;
+  if (solver_id == GurobiSolver::id()) {
+    auto gurobi_solver = std::make_unique<GurobiSolver>();
+    gurobi_solver->set_persistent_session(true);
+    solver = std::move(gurobi_solver);
+  } else if (solver_id == MosekSolver::id()) {
+    solver = std::make_unique<MosekSolver>();
+  } else if (solver_id == OsqpSolver::id()) {
+    solver = std::make_unique<OsqpSolver>();
+  } else if (solver_id == ScsSolver::id()) {
+    solver = std::make_unique<ScsSolver>();
+  } else if (solver_id == SnoptSolver::id()) {
+    solver = std::make_unique<SnoptSolver>();
+  } else if (solver_id == IpoptSolver::id()) {
+    solver = std::make_unique<IpoptSolver>();
+  } else if (solver_id == NloptSolver::id()) {
+    solver = std::make_unique<NloptSolver>();
+  } else if (solver_id == LinearSystemSolver::id()) {
+    solver = std::make_unique<LinearSystemSolver>();
+  } else if (solver_id == EqualityConstrainedQPSolver::id()) {
+    solver = std::make_unique<EqualityConstrainedQPSolver>();
+  } else if (solver_id == MobyLcpSolverId::id()) {
+    solver = std::make_unique<MobyLCPSolver<double>>();
+  } else {
+    throw std::runtime_error(fmt::format(
+        "SolveInParallel(): unsupported solver {}.", solver_id.name()));
+  }
+  if (!solver->available()) {
+    throw std::runtime_error(fmt::format(
+        "SolveInParallel(): {} is unavailable.", solver_id.name()));
+  }
+  return solver;
+}
+}  // namespace
+
+std::vector<ParallelSolveResult> SolveInParallel(
+    const std::vector<MathematicalProgram*>& progs, const SolverId& solver_id,
+    int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "SolveInParallel(): num_threads must be positive.");
+  }
+  // Fail fast, before any thread starts, if the solver cannot be used.
+  std::vector<std::unique_ptr<MathematicalProgramSolverInterface>> solvers;
+  solvers.push_back(MakeSolver(solver_id));
+
+  // The programs may share evaluators. The dense matrix of a linear
+  // constraint is computed the first time it is requested, so request it now,
+  // before the threads start solving programs concurrently.
+  std::set<const MathematicalProgram*> distinct_progs;
+  for (const MathematicalProgram* prog : progs) {
+    DRAKE_DEMAND(prog != nullptr);
+    DRAKE_DEMAND(distinct_progs.insert(prog).second);
+    for (const auto& binding : prog->linear_constraints()) {
+      binding.evaluator()->A();
+    }
+    for (const auto& binding : prog->linear_equality_constraints()) {
+      binding.evaluator()->A();
+    }
+    for (const auto& binding : prog->bounding_box_constraints()) {
+      binding.evaluator()->A();
+    }
+  }
+
+  // Solvers not in use by any thread. A thread takes one (or creates one if
+  // none is left) for each program, and returns it afterwards, so that at
+  // most `num_threads` solvers are ever created.
+  std::mutex mutex;
+  std::vector<ParallelSolveResult> results(progs.size());
+  ParallelFor(static_cast<int>(progs.size()), num_threads, [&](int i) {
+    std::unique_ptr<MathematicalProgramSolverInterface> solver;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!solvers.empty()) {
+        solver = std::move(solvers.back());
+        solvers.pop_back();
+      }
+    }
+    if (!solver) solver = MakeSolver(solver_id);
+
+    const auto start = std::chrono::steady_clock::now();
+    results[i].solution_result = solver->Solve(*progs[i]);
+    results[i].solve_time = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    solvers.push_back(std::move(solver));
+  });
+  return results;
+}
+
+}  // namespace solvers
+}  // namespace drake
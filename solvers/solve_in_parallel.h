@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/solver_id.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * The outcome of solving one program with SolveInParallel().
+ */
+struct ParallelSolveResult {
+  /** The value returned by the solver's Solve(). */
+  SolutionResult solution_result{SolutionResult::kUnknownError};
+  /** The wall-clock time spent in the solver's Solve(), in seconds. */
+  double solve_time{0};
+};
+
+/**
+ * Solves each of the independent programs in @p progs with the solver
+ * @p solver_id, spreading them over at most @p num_threads threads. As with
+ * MathematicalProgram::Solve(), each program stores its own solution, optimal
+ * cost and solver id, and can be queried after this function returns.
+ *
+ * Every thread keeps a solver instance of its own, which it reuses for all
+ * the programs it solves, so that the setup cost of the solver is paid once
+ * per thread rather than once per program:
+ * - Gurobi solvers use GurobiSolver::set_persistent_session(), hence each
+ *   thread loads one Gurobi environment (and checks out one license). In this
+ *   mode a program with no initial guess starts from the solution of the
+ *   previous program solved on that thread, if the sizes agree.
+ * - Mosek solvers share the process-wide license environment, see
+ *   MosekSolver::AcquireLicense(), and create one task per program.
+ *
+ * The programs may share the evaluators of their costs and constraints, but
+ * must be distinct objects. The solver is given the options stored in each
+ * program, as with a serial solve.
+ *
+ * @param progs The programs to solve. They must be non-null and distinct.
+ * @param solver_id The id of the solver, such as GurobiSolver::id(). The
+ * solver must be available.
+ * @param num_threads The maximum number of threads to use; must be positive.
+ * @return The result of each program, in the order of @p progs.
+ * @throws std::runtime_error if the solver is unknown or unavailable.
+ * @throws std::logic_error if @p num_threads is not positive.
+ */
+std::vector<ParallelSolveResult> SolveInParallel(
+    const std::vector<MathematicalProgram*>& progs, const SolverId& solver_id,
+    int num_threads);
+
+}  // namespace solvers
+}  // namespace drake
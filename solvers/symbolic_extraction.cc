@@ -1,11 +1,13 @@
 #include "drake/solvers/symbolic_extraction.h"
 
+#include <algorithm>
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -24,6 +26,7 @@ using std::pair;
 using std::runtime_error;
 using std::string;
 using std::unordered_map;
+using std::vector;
 
 using symbolic::Expression;
 using symbolic::Formula;
@@ -60,23 +63,138 @@ void ExtractAndAppendVariablesFromExpression(
   }
 }
 
-void DecomposeLinearExpression(const Eigen::Ref<const VectorX<Expression>>& v,
-                               Eigen::MatrixXd* A, Eigen::VectorXd* b,
-                               VectorXDecisionVariable* vars) {
-  // 0. Setup map_var_to_index and var_vec.
-  unordered_map<Variable::Id, int> map_var_to_index;
-  for (int i = 0; i < v.size(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), vars, &map_var_to_index);
+namespace {
+// Appends scale * e to the linear terms and the constant term, by walking the
+// expression tree of e. Returns false, leaving terms and constant_term
+// unchanged, if e is not made of additions, scalings, variables and
+// constants only.
+bool AppendAffineTermsFromExpressionTree(
+    const Expression& e, double scale, vector<pair<Variable, double>>* terms,
+    double* constant_term) {
+  if (is_constant(e)) {
+    *constant_term += scale * get_constant_value(e);
+    return true;
+  }
+  if (is_variable(e)) {
+    terms->emplace_back(get_variable(e), scale);
+    return true;
+  }
+  if (is_multiplication(e)) {
+    // c * b¹ where the base b is affine.
+    const auto& base_to_exponent = get_base_to_exponent_map_in_multiplication(e);
+    if (base_to_exponent.size() != 1 ||
+        !is_constant(base_to_exponent.begin()->second, 1)) {
+      return false;
+    }
+    return AppendAffineTermsFromExpressionTree(
+        base_to_exponent.begin()->first,
+        scale * get_constant_in_multiplication(e), terms, constant_term);
+  }
+  if (is_addition(e)) {
+    const int num_terms = terms->size();
+    const double constant = *constant_term;
+    for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+      if (!AppendAffineTermsFromExpressionTree(p.first, scale * p.second, terms,
+                                               constant_term)) {
+        terms->resize(num_terms);
+        *constant_term = constant;
+        return false;
+      }
+    }
+    *constant_term += scale * get_constant_in_addition(e);
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
+void DecomposeAffineExpression(const Expression& e,
+                               vector<pair<Variable, double>>* terms,
+                               double* constant_term) {
+  if (AppendAffineTermsFromExpressionTree(e, 1, terms, constant_term)) {
+    return;
+  }
+  // Falls back to the polynomial form of e, which covers products such as
+  // (x + 1) * (y + 2) - x * y.
+  if (!e.is_polynomial()) {
+    ostringstream oss;
+    oss << "Expression " << e << "is not a polynomial.\n";
+    throw runtime_error(oss.str());
+  }
+  const symbolic::Polynomial poly{e};
+  for (const auto& p : poly.monomial_to_coefficient_map()) {
+    const auto& p_monomial = p.first;
+    DRAKE_ASSERT(is_constant(p.second));
+    const double p_coeff = symbolic::get_constant_value(p.second);
+    if (p_monomial.total_degree() > 1) {
+      ostringstream oss;
+      oss << "Expression " << e << " is non-linear.";
+      throw runtime_error(oss.str());
+    } else if (p_monomial.total_degree() == 1) {
+      terms->emplace_back(p_monomial.get_powers().begin()->first, p_coeff);
+    } else {
+      *constant_term += p_coeff;
+    }
   }
+}
 
-  // 1. Construct decompose v as
-  // v = A * vars + b
-  *A = Eigen::MatrixXd::Zero(v.rows(), vars->rows());
+bool IsAffineExpression(const Expression& e) {
+  vector<pair<Variable, double>> terms;
+  double constant_term{0};
+  if (AppendAffineTermsFromExpressionTree(e, 1, &terms, &constant_term)) {
+    return true;
+  }
+  return e.is_polynomial() && symbolic::Polynomial{e}.TotalDegree() <= 1;
+}
+
+void DecomposeAffineExpressions(const Eigen::Ref<const VectorX<Expression>>& v,
+                                Eigen::SparseMatrix<double>* A,
+                                Eigen::VectorXd* b,
+                                VectorXDecisionVariable* vars) {
+  // The variables are ordered as in ExtractAndAppendVariablesFromExpression(),
+  // namely by row of first appearance, then by ID within a row.
+  unordered_map<Variable::Id, int> map_var_to_index;
+  vector<Variable> var_vec;
+  vector<Eigen::Triplet<double>> A_triplets;
+  vector<pair<Variable, double>> terms;
   *b = Eigen::VectorXd::Zero(v.rows());
-  for (int i{0}; i < v.size(); ++i) {
-    const Expression& e_i{v(i)};
-    DecomposeLinearExpression(e_i, map_var_to_index, A->row(i), b->data() + i);
+  for (int i = 0; i < v.rows(); ++i) {
+    terms.clear();
+    DecomposeAffineExpression(v(i), &terms, b->data() + i);
+    const int num_vars_before_row = var_vec.size();
+    for (const auto& term : terms) {
+      if (map_var_to_index.emplace(term.first.get_id(), -1).second) {
+        var_vec.push_back(term.first);
+      }
+    }
+    std::sort(var_vec.begin() + num_vars_before_row, var_vec.end(),
+              [](const Variable& v1, const Variable& v2) {
+                return v1.get_id() < v2.get_id();
+              });
+    for (int j = num_vars_before_row; j < static_cast<int>(var_vec.size());
+         ++j) {
+      map_var_to_index[var_vec[j].get_id()] = j;
+    }
+    for (const auto& term : terms) {
+      A_triplets.emplace_back(i, map_var_to_index.at(term.first.get_id()),
+                              term.second);
+    }
   }
+  A->resize(v.rows(), var_vec.size());
+  A->setFromTriplets(A_triplets.begin(), A_triplets.end());
+  A->prune(0.0);
+  vars->resize(var_vec.size());
+  for (int i = 0; i < static_cast<int>(var_vec.size()); ++i) {
+    (*vars)(i) = var_vec[i];
+  }
+}
+
+void DecomposeLinearExpression(const Eigen::Ref<const VectorX<Expression>>& v,
+                               Eigen::MatrixXd* A, Eigen::VectorXd* b,
+                               VectorXDecisionVariable* vars) {
+  Eigen::SparseMatrix<double> A_sparse;
+  DecomposeAffineExpressions(v, &A_sparse, b, vars);
+  *A = A_sparse;
 }
 
 pair<VectorXDecisionVariable, unordered_map<Variable::Id, int>>
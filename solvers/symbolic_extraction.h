@@ -6,6 +6,9 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <Eigen/SparseCore>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -95,6 +98,48 @@ void DecomposeQuadraticPolynomial(
     const std::unordered_map<symbolic::Variable::Id, int>& map_var_to_index,
     Eigen::MatrixXd* Q, Eigen::VectorXd* b, double* c);
 
+/*
+ * Decomposes an affine expression @p e = c0 + c1 * v1 + ... + cn * vn into its
+ * linear terms (vi, ci) and its constant term c0. The common forms of affine
+ * expressions (sums of constants, variables and their scalings) are read off
+ * the expression tree directly, which is much cheaper than converting @p e
+ * into a symbolic::Polynomial. Other forms fall back to that conversion.
+ * @param[in] e The symbolic affine expression.
+ * @param[out] terms The pairs (vi, ci). A variable may appear in several
+ * pairs, in which case its coefficients add up.
+ * @param[out] constant_term c0 in the equation above.
+ * @throws std::runtime_error if @p e is not affine.
+ */
+void DecomposeAffineExpression(
+    const symbolic::Expression& e,
+    std::vector<std::pair<symbolic::Variable, double>>* terms,
+    double* constant_term);
+
+/*
+ * Returns true if @p e is an affine expression of its variables. As
+ * DecomposeAffineExpression(), this only converts @p e into a
+ * symbolic::Polynomial when @p e is not of a common affine form.
+ */
+bool IsAffineExpression(const symbolic::Expression& e);
+
+/*
+ * Given a vector of affine expressions v, decomposes it to
+ * \f$ v = A vars + b \f$
+ * with a sparse matrix A. The cost of this function is linear in the total
+ * number of terms in v, and A is never stored as a dense matrix, hence it is
+ * suited to large batches of sparse constraints.
+ * @param[in] v A vector of affine expressions.
+ * @param[out] A The sparse matrix containing the linear coefficients. The
+ * coefficients that cancel out are not stored.
+ * @param[out] b The vector containing all the constant terms.
+ * @param[out] vars All variables, in the order of their first appearance in v.
+ * @throws std::runtime_error if an element of v is not affine.
+ */
+void DecomposeAffineExpressions(
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
+    Eigen::SparseMatrix<double>* A, Eigen::VectorXd* b,
+    VectorXDecisionVariable* vars);
+
 /*
  * Given a vector of linear expressions v, decompose it to
  * \f$ v = A vars + b \f$
@@ -141,36 +186,20 @@ DecomposeLinearExpression(
     const Eigen::MatrixBase<Derived>& coeffs, double* constant_term) {
   DRAKE_DEMAND(coeffs.rows() == 1);
   DRAKE_DEMAND(coeffs.cols() == static_cast<int>(map_var_to_index.size()));
-  if (!e.is_polynomial()) {
-    std::ostringstream oss;
-    oss << "Expression " << e << "is not a polynomial.\n";
-    throw std::runtime_error(oss.str());
+  std::vector<std::pair<symbolic::Variable, double>> terms;
+  *constant_term = 0;
+  DecomposeAffineExpression(e, &terms, constant_term);
+  // TODO(eric.cousineau): Avoid using const_cast.
+  Eigen::MatrixBase<Derived>& mutable_coeffs =
+      const_cast<Eigen::MatrixBase<Derived>&>(coeffs);
+  mutable_coeffs.setZero();
+  for (const auto& term : terms) {
+    mutable_coeffs(map_var_to_index.at(term.first.get_id())) += term.second;
   }
-  const symbolic::Polynomial poly{e};
   int num_variable = 0;
-  for (const auto& p : poly.monomial_to_coefficient_map()) {
-    const auto& p_monomial = p.first;
-    DRAKE_ASSERT(is_constant(p.second));
-    const double p_coeff = symbolic::get_constant_value(p.second);
-    if (p_monomial.total_degree() > 1) {
-      std::stringstream oss;
-      oss << "Expression " << e << " is non-linear.";
-      throw std::runtime_error(oss.str());
-    } else if (p_monomial.total_degree() == 1) {
-      // Linear coefficient.
-      const auto& p_monomial_powers = p_monomial.get_powers();
-      DRAKE_DEMAND(p_monomial_powers.size() == 1);
-      const symbolic::Variable::Id var_id =
-          p_monomial_powers.begin()->first.get_id();
-      // TODO(eric.cousineau): Avoid using const_cast.
-      const_cast<Eigen::MatrixBase<Derived>&>(coeffs)(
-          map_var_to_index.at(var_id)) = p_coeff;
-      if (p_coeff != 0) {
-        ++num_variable;
-      }
-    } else {
-      // Constant term.
-      *constant_term = p_coeff;
+  for (int i = 0; i < coeffs.cols(); ++i) {
+    if (coeffs(i) != 0) {
+      ++num_variable;
     }
   }
   return num_variable;
@@ -4,8 +4,15 @@
 #include <cmath>
 #include <iostream>  // For LUMPED_SYSTEM_IDENTIFICATION_VERBOSE below.
 #include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/solvers/mathematical_program.h"
 
 using std::pow;
@@ -13,6 +20,145 @@ using std::pow;
 namespace drake {
 namespace solvers {
 
+namespace {
+
+// A monomial compiled for evaluation over many measurements: its coefficient,
+// the index of the parameter it is linear in (or -1 if it has none), and the
+// (index, power) of each of its active variables.
+template <typename T>
+struct CompiledMonomial {
+  T coefficient{};
+  int parameter{-1};
+  std::vector<std::pair<int, int>> active_terms;
+};
+
+template <typename T>
+using CompiledPolynomial = std::vector<CompiledMonomial<T>>;
+
+// Compiles @p polys against the given parameters and active variables into
+// @p compiled.  Returns false if any monomial is nonlinear in the parameters.
+template <typename T, typename VarType>
+bool CompilePolynomials(const VectorXPoly& polys,
+                        const std::vector<VarType>& parameters,
+                        const std::vector<VarType>& active_vars,
+                        std::vector<CompiledPolynomial<T>>* compiled) {
+  std::map<VarType, int> parameter_index;
+  for (int i = 0; i < static_cast<int>(parameters.size()); i++) {
+    parameter_index[parameters[i]] = i;
+  }
+  std::map<VarType, int> active_index;
+  for (int i = 0; i < static_cast<int>(active_vars.size()); i++) {
+    active_index[active_vars[i]] = i;
+  }
+  compiled->clear();
+  for (int i = 0; i < polys.rows(); i++) {
+    CompiledPolynomial<T> poly;
+    for (const auto& monomial : polys[i].GetMonomials()) {
+      CompiledMonomial<T> compiled_monomial;
+      compiled_monomial.coefficient = monomial.coefficient;
+      for (const auto& term : monomial.terms) {
+        const auto parameter = parameter_index.find(term.var);
+        if (parameter != parameter_index.end()) {
+          if (compiled_monomial.parameter >= 0 || term.power != 1) {
+            return false;
+          }
+          compiled_monomial.parameter = parameter->second;
+        } else {
+          compiled_monomial.active_terms.emplace_back(
+              active_index.at(term.var), term.power);
+        }
+      }
+      poly.push_back(std::move(compiled_monomial));
+    }
+    compiled->push_back(std::move(poly));
+  }
+  return true;
+}
+
+// The normal equations AᵀA θ = -Aᵀb of the least-squares problem
+// min |A θ + b|², together with |b|² and the number of rows of A.
+template <typename T>
+struct NormalEquations {
+  explicit NormalEquations(int num_parameters)
+      : AtA(MatrixX<T>::Zero(num_parameters, num_parameters)),
+        Atb(VectorX<T>::Zero(num_parameters)) {}
+
+  NormalEquations& operator+=(const NormalEquations& other) {
+    AtA += other.AtA;
+    Atb += other.Atb;
+    btb += other.btb;
+    num_rows += other.num_rows;
+    return *this;
+  }
+
+  // Only the lower triangle of AtA is accumulated.
+  MatrixX<T> AtA;
+  VectorX<T> Atb;
+  T btb{0};
+  int64_t num_rows{0};
+};
+
+// Adds one row per polynomial, evaluated at @p datum, to @p equations.
+template <typename T, typename VarType, typename PartialEvalType>
+void AccumulateMeasurement(const std::vector<CompiledPolynomial<T>>& compiled,
+                           const std::vector<VarType>& active_vars,
+                           const PartialEvalType& datum,
+                           NormalEquations<T>* equations) {
+  VectorX<T> values(active_vars.size());
+  for (int i = 0; i < static_cast<int>(active_vars.size()); i++) {
+    const auto value = datum.find(active_vars[i]);
+    if (value == datum.end()) {
+      throw std::runtime_error(
+          "EstimateParameters: a measurement misses an active variable");
+    }
+    values(i) = value->second;
+  }
+  VectorX<T> a(equations->Atb.size());
+  for (const CompiledPolynomial<T>& poly : compiled) {
+    a.setZero();
+    T b{0};
+    for (const CompiledMonomial<T>& monomial : poly) {
+      T value = monomial.coefficient;
+      for (const auto& term : monomial.active_terms) {
+        value *= pow(values(term.first), term.second);
+      }
+      if (monomial.parameter < 0) {
+        b += value;
+      } else {
+        a(monomial.parameter) += value;
+      }
+    }
+    equations->AtA.template selfadjointView<Eigen::Lower>().rankUpdate(a);
+    equations->Atb += b * a;
+    equations->btb += b * b;
+    equations->num_rows++;
+  }
+}
+
+// Solves @p equations for the estimates of @p parameters, and returns them
+// with the root-mean-square residual.
+template <typename T, typename VarType>
+std::pair<std::map<VarType, T>, T> SolveNormalEquations(
+    const NormalEquations<T>& equations,
+    const std::vector<VarType>& parameters) {
+  const MatrixX<T> AtA =
+      equations.AtA.template selfadjointView<Eigen::Lower>();
+  const VectorX<T> theta =
+      AtA.completeOrthogonalDecomposition().solve(-equations.Atb);
+  std::map<VarType, T> estimates;
+  for (int i = 0; i < static_cast<int>(parameters.size()); i++) {
+    estimates[parameters[i]] = theta(i);
+  }
+  // |A θ + b|² = θᵀAᵀAθ + 2 θᵀAᵀb + |b|².
+  const T error_squared = std::max(
+      T{0}, theta.dot(AtA * theta) + 2 * theta.dot(equations.Atb) +
+                equations.btb);
+  return std::make_pair(
+      estimates, std::sqrt(error_squared / equations.num_rows));
+}
+
+}  // namespace
+
 template <typename T>
 std::set<typename SystemIdentification<T>::MonomialType>
 SystemIdentification<T>::GetAllCombinationsOfVars(
@@ -242,10 +388,11 @@ template <typename T>
 std::pair<typename SystemIdentification<T>::PartialEvalType, T>
 SystemIdentification<T>::EstimateParameters(
     const VectorXPoly& polys,
-    const std::vector<PartialEvalType>& active_var_values) {
+    const std::vector<PartialEvalType>& active_var_values,
+    int num_threads) {
   DRAKE_ASSERT(active_var_values.size() > 0);
+  DRAKE_DEMAND(num_threads > 0);
   const int num_data = active_var_values.size();
-  const int num_err_terms = num_data * polys.rows();
 
   std::vector<Polynomiald> polys_vec;
   for (int i = 0; i < polys.rows(); i++) {
@@ -253,15 +400,131 @@ SystemIdentification<T>::EstimateParameters(
   }
   const auto var_sets = ClassifyVars(polys_vec, active_var_values);
   const std::set<VarType>& vars_to_estimate_set = std::get<1>(var_sets);
+  const std::set<VarType>& active_vars_set = std::get<2>(var_sets);
 
   std::vector<VarType> vars_to_estimate(vars_to_estimate_set.begin(),
                                         vars_to_estimate_set.end());
+  const std::vector<VarType> active_vars(active_vars_set.begin(),
+                                         active_vars_set.end());
   int num_to_estimate = vars_to_estimate.size();
 
   // Make sure we have as many data points as vars we are estimating, or else
   // our solution will be meaningless.
   DRAKE_ASSERT(num_data >= num_to_estimate);
 
+  // The linear least-squares solution applies only if every parameter appears
+  // linearly and is never given a value by a measurement.
+  std::vector<CompiledPolynomial<T>> compiled;
+  bool linear = CompilePolynomials(polys, vars_to_estimate, active_vars,
+                                   &compiled);
+  for (const PartialEvalType& datum : active_var_values) {
+    if (!linear) break;
+    for (const VarType& var : vars_to_estimate) {
+      if (datum.count(var)) {
+        linear = false;
+        break;
+      }
+    }
+  }
+  if (!linear) {
+    return EstimateParametersByNonlinearProgram(polys, active_var_values,
+                                                vars_to_estimate);
+  }
+
+  // Each thread accumulates the normal equations of one contiguous block of
+  // measurements; the blocks are then summed in order, so that the result
+  // does not depend on scheduling.
+  const int num_blocks = std::min(num_threads, num_data);
+  const int block_size = (num_data + num_blocks - 1) / num_blocks;
+  std::vector<NormalEquations<T>> block_equations(
+      num_blocks, NormalEquations<T>(num_to_estimate));
+  ParallelFor(num_blocks, num_threads, [&](int block) {
+    const int end = std::min((block + 1) * block_size, num_data);
+    for (int i = block * block_size; i < end; i++) {
+      AccumulateMeasurement(compiled, active_vars, active_var_values[i],
+                            &block_equations[block]);
+    }
+  });
+  NormalEquations<T> equations(num_to_estimate);
+  for (const NormalEquations<T>& block : block_equations) {
+    equations += block;
+  }
+  return SolveNormalEquations(equations, vars_to_estimate);
+}
+
+template <typename T>
+std::pair<typename SystemIdentification<T>::PartialEvalType, T>
+SystemIdentification<T>::EstimateParametersFromChunks(
+    const VectorXPoly& polys, const DataChunkSource& next_chunk,
+    int num_threads) {
+  DRAKE_DEMAND(num_threads > 0);
+  std::vector<PartialEvalType> chunk;
+  if (!next_chunk(&chunk) || chunk.empty()) {
+    throw std::runtime_error(
+        "EstimateParametersFromChunks: there are no measurements");
+  }
+
+  // Classifies the variables from the first measurement.
+  std::vector<Polynomiald> polys_vec;
+  for (int i = 0; i < polys.rows(); i++) {
+    polys_vec.push_back(polys[i]);
+  }
+  const auto var_sets = ClassifyVars(polys_vec, {chunk.front()});
+  const std::set<VarType>& vars_to_estimate_set = std::get<1>(var_sets);
+  const std::set<VarType>& active_vars_set = std::get<2>(var_sets);
+  const std::vector<VarType> vars_to_estimate(vars_to_estimate_set.begin(),
+                                              vars_to_estimate_set.end());
+  const std::vector<VarType> active_vars(active_vars_set.begin(),
+                                         active_vars_set.end());
+  const int num_to_estimate = vars_to_estimate.size();
+
+  std::vector<CompiledPolynomial<T>> compiled;
+  if (!CompilePolynomials(polys, vars_to_estimate, active_vars, &compiled)) {
+    throw std::runtime_error(
+        "EstimateParametersFromChunks: a term of the polynomials is nonlinear "
+        "in the parameters");
+  }
+
+  NormalEquations<T> equations(num_to_estimate);
+  do {
+    const int num_data = chunk.size();
+    if (num_data == 0) continue;
+    const int num_blocks = std::min(num_threads, num_data);
+    const int block_size = (num_data + num_blocks - 1) / num_blocks;
+    std::vector<NormalEquations<T>> block_equations(
+        num_blocks, NormalEquations<T>(num_to_estimate));
+    ParallelFor(num_blocks, num_threads, [&](int block) {
+      const int end = std::min((block + 1) * block_size, num_data);
+      for (int i = block * block_size; i < end; i++) {
+        AccumulateMeasurement(compiled, active_vars, chunk[i],
+                              &block_equations[block]);
+      }
+    });
+    for (const NormalEquations<T>& block : block_equations) {
+      equations += block;
+    }
+  } while (next_chunk(&chunk));
+
+  if (equations.num_rows < num_to_estimate) {
+    throw std::runtime_error(
+        "EstimateParametersFromChunks: there are fewer measurements than "
+        "parameters to estimate");
+  }
+  return SolveNormalEquations(equations, vars_to_estimate);
+}
+
+template <typename T>
+std::pair<typename SystemIdentification<T>::PartialEvalType, T>
+SystemIdentification<T>::EstimateParametersByNonlinearProgram(
+    const VectorXPoly& polys,
+    const std::vector<PartialEvalType>& active_var_values,
+    const std::vector<VarType>& vars_to_estimate) {
+  const int num_data = active_var_values.size();
+  const int num_err_terms = num_data * polys.rows();
+  const int num_to_estimate = vars_to_estimate.size();
+  const std::set<VarType> vars_to_estimate_set(vars_to_estimate.begin(),
+                                               vars_to_estimate.end());
+
   // Build up our optimization problem's decision variables.
   MathematicalProgram problem;
   VectorXDecisionVariable parameter_variables =
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -105,10 +106,38 @@ class SystemIdentification {
    *   * estimates is a map of polynomial VarTypes (a, b, ...) to their
    *     estimated values, suitable as input for Polynomial::evaluatePartial.
    *   * error is the root-mean-square error of the estimates.
+   *
+   * When no term of the polynomials is nonlinear in the parameters (as is the
+   * case after lumping), the estimates are the linear least-squares solution.
+   * The polynomials are compiled once for evaluation over the data, and the
+   * normal equations are assembled from the data in parallel by up to
+   * num_threads threads.  Otherwise, a nonlinear program is solved.
    */
   static std::pair<PartialEvalType, CoefficientType> EstimateParameters(
       const VectorXPoly& polys,
-      const std::vector<PartialEvalType>& active_var_values);
+      const std::vector<PartialEvalType>& active_var_values,
+      int num_threads = 1);
+
+  /// A source of measurements for EstimateParametersFromChunks().  Each call
+  /// replaces the contents of its argument with the next chunk of
+  /// measurements, and returns false once there are none left.
+  typedef std::function<bool(std::vector<PartialEvalType>*)> DataChunkSource;
+
+  /** Estimate parameters as EstimateParameters() does, but from measurements
+   * read one chunk at a time (for instance, from a log on disk too large to
+   * fit in memory), so that only one chunk is ever held in memory.
+   *
+   * The parameters are the variables of the polynomials that are missing from
+   * the first measurement; every measurement must give a value for all of the
+   * others.  No term of the polynomials may be nonlinear in the parameters.
+   *
+   * @throws std::runtime_error if there are no measurements, if a measurement
+   * misses an active variable, or if a term is nonlinear in the parameters.
+   */
+  static std::pair<PartialEvalType, CoefficientType>
+  EstimateParametersFromChunks(const VectorXPoly& polys,
+                               const DataChunkSource& next_chunk,
+                               int num_threads = 1);
 
   /** A helper struct to hold System ID results */
   struct SystemIdentificationResult {
@@ -199,6 +228,15 @@ class SystemIdentification {
   static std::pair<CoefficientType, PolyType>
   CanonicalizePolynomial(const PolyType& poly);
 
+  /// Estimate parameters by solving a nonlinear program with an error
+  /// variable for each polynomial at each measurement.  This is the fallback
+  /// of EstimateParameters() when a parameter appears nonlinearly.
+  static std::pair<PartialEvalType, CoefficientType>
+  EstimateParametersByNonlinearProgram(
+      const VectorXPoly& polys,
+      const std::vector<PartialEvalType>& active_var_values,
+      const std::vector<VarType>& vars_to_estimate);
+
   /// Obtain a new variable ID not already in vars_in_use.  The string part of
   /// the variable's name will be prefix.
   static VarType CreateUnusedVar(const std::string& prefix,
@@ -183,9 +183,9 @@ void CheckNodeSolution(const MixedIntegerBranchAndBoundNode& node,
                        double optimal_cost, double tol = 1E-4) {
   const SolutionResult result = node.solution_result();
   EXPECT_EQ(result, SolutionResult::kSolutionFound);
-  EXPECT_TRUE(CompareMatrices(node.prog()->GetSolution(x), x_expected, tol,
+  EXPECT_TRUE(CompareMatrices(node.GetSolution(x), x_expected, tol,
                               MatrixCompareType::absolute));
-  EXPECT_NEAR(node.prog()->GetOptimalCost(), optimal_cost, tol);
+  EXPECT_NEAR(node.optimal_cost(), optimal_cost, tol);
 }
 
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestConstructRoot1) {
@@ -335,6 +335,39 @@ GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch1) {
   EXPECT_THROW(root->Branch(x(3)), std::runtime_error);
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestFixedBinaryVariables) {
+  // The child nodes share the program of the root node, and only store the
+  // binary variables fixed along the path from the root.
+  auto prog = ConstructMathematicalProgram2();
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> root;
+  std::tie(root, std::ignore) =
+      MixedIntegerBranchAndBoundNode::ConstructRootNode(*prog,
+                                                        GurobiSolver::id());
+  VectorDecisionVariable<5> x = root->prog()->decision_variables();
+  EXPECT_TRUE(root->fixed_binary_variables().empty());
+
+  root->Branch(x(0));
+  MixedIntegerBranchAndBoundNode* left = root->mutable_left_child();
+  left->Branch(x(2));
+  const MixedIntegerBranchAndBoundNode* left_right = left->right_child();
+  EXPECT_EQ(left_right->prog(), root->prog());
+  ASSERT_EQ(left_right->fixed_binary_variables().size(), 2);
+  EXPECT_TRUE(left_right->fixed_binary_variables()[0].first.equal_to(x(0)));
+  EXPECT_EQ(left_right->fixed_binary_variables()[0].second, 0);
+  EXPECT_TRUE(left_right->fixed_binary_variables()[1].first.equal_to(x(2)));
+  EXPECT_EQ(left_right->fixed_binary_variables()[1].second, 1);
+
+  // The constructed program has the two fixed binary variables as additional
+  // bounding box constraints.
+  const auto left_right_prog = left_right->ConstructProgram();
+  EXPECT_EQ(left_right_prog->bounding_box_constraints().size(),
+            root->prog()->bounding_box_constraints().size() + 2);
+  if (left_right->solution_result() == SolutionResult::kSolutionFound) {
+    EXPECT_NEAR(left_right->GetSolution(x(0)), 0, 1E-6);
+    EXPECT_NEAR(left_right->GetSolution(x(2)), 1, 1E-6);
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch2) {
   // Test branching on the root node for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -983,6 +1016,59 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (const bool search_by_rounding : {false, true}) {
+      MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+      bnb.set_num_threads(3);
+      EXPECT_EQ(bnb.num_threads(), 3);
+      bnb.SetVariableSelectionMethod(pick_variable);
+      bnb.SetSearchIntegralSolutionByRounding(search_by_rounding);
+      int num_callbacks = 0;
+      bnb.SetUserDefinedNodeCallbackFunction(
+          [&num_callbacks](const MixedIntegerBranchAndBoundNode&,
+                           MixedIntegerBranchAndBound*) { ++num_callbacks; });
+
+      const SolutionResult solution_result = bnb.Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_LE(bnb.best_upper_bound() - bnb.best_lower_bound(),
+                bnb.absolute_gap_tol());
+      // The callback is called on the root and on every child node.
+      EXPECT_GE(num_callbacks, 3);
+    }
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelUnbounded) {
+  auto prog = ConstructMathematicalProgram3();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  bnb.set_num_threads(2);
+  EXPECT_EQ(bnb.Solve(), SolutionResult::kUnbounded);
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelInfeasible) {
+  auto prog = ConstructMathematicalProgram4();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  bnb.set_num_threads(2);
+  EXPECT_EQ(bnb.Solve(), SolutionResult::kInfeasibleConstraints);
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSetNumThreadsError) {
+  auto prog = ConstructMathematicalProgram2();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_EQ(bnb.num_threads(), 1);
+  EXPECT_THROW(bnb.set_num_threads(0), std::runtime_error);
+}
+
 void CheckAllIntegralSolution(
     const MixedIntegerBranchAndBound& bnb,
     const Eigen::Ref<const VectorXDecisionVariable>& x,
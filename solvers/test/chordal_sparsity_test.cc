@@ -0,0 +1,150 @@
+#include "drake/solvers/chordal_sparsity.h"
+
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/solvers/mosek_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using symbolic::Monomial;
+using symbolic::Polynomial;
+using symbolic::Variable;
+using symbolic::Variables;
+
+// Returns the undirected graph with the given edges.
+std::vector<std::set<int>> MakeGraph(
+    int num_nodes, const std::vector<std::pair<int, int>>& edges) {
+  std::vector<std::set<int>> adjacency(num_nodes);
+  for (const auto& edge : edges) {
+    adjacency[edge.first].insert(edge.second);
+    adjacency[edge.second].insert(edge.first);
+  }
+  return adjacency;
+}
+
+std::set<std::vector<int>> ToSet(const std::vector<std::vector<int>>& v) {
+  return std::set<std::vector<int>>(v.begin(), v.end());
+}
+
+GTEST_TEST(ChordalCliquesTest, Graphs) {
+  // A graph without edges.
+  EXPECT_EQ(ToSet(ChordalCliques(MakeGraph(3, {}))),
+            std::set<std::vector<int>>({{0}, {1}, {2}}));
+  // A path, which is already chordal.
+  EXPECT_EQ(ToSet(ChordalCliques(MakeGraph(4, {{0, 1}, {1, 2}, {2, 3}}))),
+            std::set<std::vector<int>>({{0, 1}, {1, 2}, {2, 3}}));
+  // A complete graph.
+  EXPECT_EQ(ToSet(ChordalCliques(MakeGraph(3, {{0, 1}, {1, 2}, {0, 2}}))),
+            std::set<std::vector<int>>({{0, 1, 2}}));
+  // A cycle of length 4 needs one chord, which gives two triangles.
+  const std::vector<std::vector<int>> cycle_cliques =
+      ChordalCliques(MakeGraph(4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}}));
+  ASSERT_EQ(cycle_cliques.size(), 2);
+  for (const auto& clique : cycle_cliques) {
+    EXPECT_EQ(clique.size(), 3);
+  }
+}
+
+class ChordalSparsityTest : public ::testing::Test {
+ protected:
+  void SetUp() override { x_ = prog_.NewIndeterminates<3>("x"); }
+
+  MathematicalProgram prog_;
+  VectorIndeterminate<3> x_;
+};
+
+TEST_F(ChordalSparsityTest, CorrelativeSparsityCliques) {
+  // x₀ and x₂ never appear in a same monomial.
+  const Polynomial p{pow(x_(0), 4) + pow(x_(0) * x_(1), 2) +
+                         pow(x_(1) * x_(2), 2) + pow(x_(2), 4) + 1,
+                     Variables(x_)};
+  const std::vector<Variables> cliques = CorrelativeSparsityCliques(p);
+  ASSERT_EQ(cliques.size(), 2);
+  const std::set<Variables> expected{Variables({x_(0), x_(1)}),
+                                     Variables({x_(1), x_(2)})};
+  EXPECT_EQ(std::set<Variables>(cliques.begin(), cliques.end()), expected);
+}
+
+TEST_F(ChordalSparsityTest, ReduceSosMonomialBasis) {
+  // The Motzkin-like polynomial x⁴y² + x²y⁴ + 1 only needs the monomials
+  // x²y, xy² and 1, out of the 10 monomials of degree at most 3.
+  const Variable& x = x_(0);
+  const Variable& y = x_(1);
+  const Polynomial p{pow(x, 4) * pow(y, 2) + pow(x, 2) * pow(y, 4) + 1,
+                     Variables({x, y})};
+  const VectorX<Monomial> basis =
+      ReduceSosMonomialBasis(p, symbolic::MonomialBasis(Variables({x, y}), 3));
+  const std::unordered_set<Monomial> reduced(basis.data(),
+                                             basis.data() + basis.size());
+  const std::unordered_set<Monomial> expected{
+      Monomial(x, 2) * Monomial(y), Monomial(x) * Monomial(y, 2), Monomial()};
+  EXPECT_EQ(reduced, expected);
+
+  // A monomial over an indeterminate absent from p is always dropped.
+  Vector1<Monomial> other_basis(Monomial(x_(2)));
+  EXPECT_EQ(ReduceSosMonomialBasis(p, other_basis).rows(), 0);
+}
+
+TEST_F(ChordalSparsityTest, AddSparseSosConstraint) {
+  // p = (x₀² - x₁)² + (x₁ - x₂)² + (x₂² - 1)² + c is SOS iff c ≥ 0, and the
+  // first two squares involve x₀ and x₂ separately.
+  const auto c = prog_.NewContinuousVariables<1>("c");
+  const Polynomial p{pow(x_(0) * x_(0) - x_(1), 2) + pow(x_(1) - x_(2), 2) +
+                         pow(x_(2) * x_(2) - 1, 2) + c(0),
+                     Variables(x_)};
+  const auto bindings = AddSparseSosConstraint(&prog_, p);
+  // One Gram block per clique, {x₀, x₁} and {x₁, x₂}, each smaller than the
+  // dense Gram matrix over the 10 monomials of degree at most 2 in x.
+  ASSERT_EQ(bindings.first.size(), 2);
+  for (const auto& psd_binding : bindings.first) {
+    EXPECT_LE(psd_binding.evaluator()->matrix_rows(), 6);
+  }
+
+  prog_.AddLinearCost(c(0));
+  MosekSolver solver;
+  if (solver.available()) {
+    EXPECT_EQ(solver.Solve(prog_), SolutionResult::kSolutionFound);
+    EXPECT_NEAR(prog_.GetSolution(c(0)), 0, 1E-6);
+  }
+}
+
+TEST_F(ChordalSparsityTest, AddChordalLinearMatrixInequalityConstraint) {
+  // F₀ + t I ⪰ 0 with a tridiagonal F₀. The smallest such t is -λₘᵢₙ(F₀).
+  const int n = 5;
+  Eigen::MatrixXd F0 = 2 * Eigen::MatrixXd::Identity(n, n);
+  for (int i = 0; i + 1 < n; ++i) {
+    F0(i, i + 1) = -1.5;
+    F0(i + 1, i) = -1.5;
+  }
+  const Eigen::MatrixXd F1 = Eigen::MatrixXd::Identity(n, n);
+  const auto t = prog_.NewContinuousVariables<1>("t");
+  const auto bindings =
+      AddChordalLinearMatrixInequalityConstraint(&prog_, {F0, F1}, t);
+  // The pattern is a path, hence each edge is a clique of size 2.
+  ASSERT_EQ(bindings.first.size(), n - 1);
+  for (const auto& psd_binding : bindings.first) {
+    EXPECT_EQ(psd_binding.evaluator()->matrix_rows(), 2);
+  }
+  // One equality per diagonal entry and per edge.
+  EXPECT_EQ(bindings.second.evaluator()->num_constraints(), n + n - 1);
+  EXPECT_TRUE(prog_.linear_matrix_inequality_constraints().empty());
+
+  prog_.AddLinearCost(t(0));
+  MosekSolver solver;
+  if (solver.available()) {
+    EXPECT_EQ(solver.Solve(prog_), SolutionResult::kSolutionFound);
+    const double min_eigenvalue =
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(F0).eigenvalues()(0);
+    EXPECT_NEAR(prog_.GetSolution(t(0)), -min_eigenvalue, 1E-6);
+  }
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -1,5 +1,8 @@
 #include "drake/solvers/constraint.h"
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic.h"
@@ -46,6 +49,73 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+GTEST_TEST(testConstraint, testSparseLinearConstraint) {
+  // Constructs and updates a linear constraint from sparse matrices, and checks
+  // that the constraint is the same as the one constructed from the
+  // equivalent dense matrices.
+  Eigen::Matrix<double, 2, 3> A_dense;
+  A_dense << 1, 0, 2,
+             0, 0, -3;
+  const Eigen::SparseMatrix<double> A = A_dense.sparseView();
+  const Eigen::Vector2d lb(-1, -2);
+  const Eigen::Vector2d ub(1, 2);
+  LinearConstraint constraint(A, lb, ub);
+  EXPECT_EQ(constraint.num_constraints(), 2);
+  EXPECT_EQ(constraint.num_vars(), 3);
+  EXPECT_EQ(constraint.get_sparse_A().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), A_dense));
+  EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), lb));
+  EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), ub));
+
+  // The constraint constructed from the dense matrix is stored sparsely.
+  LinearConstraint dense_constraint(A_dense, lb, ub);
+  EXPECT_EQ(dense_constraint.get_sparse_A().nonZeros(), 3);
+
+  // Evaluates the constraint for both double and AutoDiffXd.
+  const Vector3d x(1, 2, 3);
+  VectorXd y;
+  constraint.Eval(x, y);
+  EXPECT_TRUE(CompareMatrices(y, A_dense * x, 1E-15));
+  const AutoDiffVecXd x_autodiff = math::initializeAutoDiff(x);
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(x_autodiff, y_autodiff);
+  EXPECT_TRUE(
+      CompareMatrices(math::autoDiffToValueMatrix(y_autodiff), A_dense * x));
+  EXPECT_TRUE(
+      CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff), A_dense));
+
+  // Updates the matrix, which also invalidates the dense copy of A.
+  Eigen::Matrix<double, 3, 3> A3_dense;
+  A3_dense << 0, 1, 0,
+              4, 0, 0,
+              0, 0, 5;
+  const Eigen::SparseMatrix<double> A3 = A3_dense.sparseView();
+  constraint.UpdateCoefficients(A3, Vector3d::Zero(), Vector3d::Ones());
+  EXPECT_EQ(constraint.num_constraints(), 3);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), A3_dense));
+  constraint.Eval(x, y);
+  EXPECT_TRUE(CompareMatrices(y, A3_dense * x, 1E-15));
+
+  // The number of variables cannot change.
+  const Eigen::SparseMatrix<double> A4(3, 4);
+  EXPECT_THROW(
+      constraint.UpdateCoefficients(A4, Vector3d::Zero(), Vector3d::Ones()),
+      std::runtime_error);
+
+  LinearEqualityConstraint equality_constraint(A, lb);
+  EXPECT_TRUE(CompareMatrices(equality_constraint.A(), A_dense));
+  EXPECT_TRUE(CompareMatrices(equality_constraint.upper_bound(), lb));
+  equality_constraint.UpdateCoefficients(A3, Vector3d(1, 2, 3));
+  EXPECT_TRUE(CompareMatrices(equality_constraint.A(), A3_dense));
+  EXPECT_TRUE(
+      CompareMatrices(equality_constraint.lower_bound(), Vector3d(1, 2, 3)));
+
+  // A bounding box constraint only stores the diagonal.
+  BoundingBoxConstraint bounding_box(lb, ub);
+  EXPECT_EQ(bounding_box.get_sparse_A().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(bounding_box.A(), Matrix2d::Identity()));
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
@@ -358,6 +428,104 @@ GTEST_TEST(testConstraint, testEvaluatorConstraint) {
   EXPECT_EQ(y_expected, y);
 }
 
+// y = [x₀² + x₁, x₁² + x₂], whose gradient has two structural zeros.
+class ChainConstraint : public Constraint {
+ public:
+  explicit ChainConstraint(bool declare_sparsity)
+      : Constraint(2, 3, Vector2d::Constant(1), Vector2d::Constant(1)) {
+    if (declare_sparsity) {
+      // Deliberately out of order and with a duplicate.
+      SetGradientSparsityPattern({{1, 2}, {0, 1}, {1, 1}, {0, 0}, {0, 1}});
+    }
+  }
+
+  void SetPattern(const std::vector<std::pair<int, int>>& pattern) {
+    SetGradientSparsityPattern(pattern);
+  }
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd& y) const override {
+    y.resize(2);
+    y << x(0) * x(0) + x(1), x(1) * x(1) + x(2);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd& y) const override {
+    y.resize(2);
+    y << x(0) * x(0) + x(1), x(1) * x(1) + x(2);
+  }
+};
+
+GTEST_TEST(testConstraint, testGradientSparsityPattern) {
+  EXPECT_FALSE(ChainConstraint(false).gradient_sparsity_pattern());
+
+  ChainConstraint constraint(true);
+  const std::vector<std::pair<int, int>> expected{
+      {0, 0}, {0, 1}, {1, 1}, {1, 2}};
+  ASSERT_TRUE(constraint.gradient_sparsity_pattern());
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(), expected);
+
+  // The entries outside of the pattern are indeed zero.
+  AutoDiffVecXd y;
+  constraint.Eval(math::initializeAutoDiff(Vector3d(1, 2, 3)), y);
+  const MatrixXd dy = math::autoDiffToGradientMatrix(y);
+  EXPECT_EQ(dy(0, 2), 0);
+  EXPECT_EQ(dy(1, 0), 0);
+
+  EXPECT_THROW(constraint.SetPattern({{2, 0}}), std::runtime_error);
+  EXPECT_THROW(constraint.SetPattern({{0, 3}}), std::runtime_error);
+  EXPECT_THROW(constraint.SetPattern({{-1, 0}}), std::runtime_error);
+  // A failed update leaves the pattern untouched.
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(), expected);
+}
+
+// Checks that EvalBatch() agrees with Eval() on each column of X.
+void CheckEvalBatch(const EvaluatorBase& evaluator, const MatrixXd& X) {
+  MatrixXd Y;
+  evaluator.EvalBatch(X, &Y);
+  ASSERT_EQ(Y.rows(), evaluator.num_outputs());
+  ASSERT_EQ(Y.cols(), X.cols());
+  VectorXd y(evaluator.num_outputs());
+  for (int j = 0; j < X.cols(); ++j) {
+    evaluator.Eval(X.col(j), y);
+    EXPECT_TRUE(CompareMatrices(Y.col(j), y, 1E-12,
+                                MatrixCompareType::relative));
+  }
+}
+
+GTEST_TEST(testConstraint, testEvalBatch) {
+  MatrixXd X(3, 5);
+  // clang-format off
+  X << 1, -2, 3, 0.5, 2,
+       0, 1, -1, 4, 3,
+       2, 2, 0.3, -3, 1;
+  // clang-format on
+  Eigen::Matrix3d A;
+  // clang-format off
+  A << 1, 2, 3,
+       -1, 0, 2,
+       0.5, 4, 1;
+  // clang-format on
+  const Vector3d b(0.1, -0.2, 0.3);
+  const Vector3d lb = Vector3d::Constant(-1);
+  const Vector3d ub = Vector3d::Constant(1);
+  CheckEvalBatch(LinearConstraint(A, lb, ub), X);
+  CheckEvalBatch(LinearEqualityConstraint(A, b), X);
+  CheckEvalBatch(BoundingBoxConstraint(lb, ub), X);
+  CheckEvalBatch(QuadraticConstraint(A.transpose() * A, b, 0, 1), X);
+  CheckEvalBatch(LorentzConeConstraint(A, b), X);
+  CheckEvalBatch(RotatedLorentzConeConstraint(A, b), X);
+  // Evaluators without a batched implementation evaluate column by column.
+  CheckEvalBatch(EvaluatorConstraint<>(std::make_shared<SimpleEvaluator>(),
+                                       Vector2d::Constant(-1),
+                                       Vector2d::Constant(1)),
+                 X);
+  CheckEvalBatch(LinearComplementarityConstraint(A, b), X);
+  // An empty batch.
+  CheckEvalBatch(LorentzConeConstraint(A, b), MatrixXd(3, 0));
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -120,6 +120,14 @@ GTEST_TEST(testCost, testLinearCost) {
   auto new_cost = make_shared<LinearCost>(a, b);
   new_cost->Eval(x0, y);
   EXPECT_NEAR(y(0), obj_expected + b, tol);
+
+  // Evaluate at several points at once.
+  Eigen::Matrix2d X;
+  X << x0, -x0;
+  Eigen::MatrixXd Y;
+  new_cost->EvalBatch(X, &Y);
+  EXPECT_TRUE(CompareMatrices(
+      Y, Eigen::RowVector2d(obj_expected + b, -obj_expected + b), tol));
 }
 
 GTEST_TEST(testCost, testQuadraticCost) {
@@ -162,6 +170,14 @@ GTEST_TEST(testCost, testQuadraticCost) {
   auto new_cost = make_shared<QuadraticCost>(Q, b, c);
   new_cost->Eval(x0, y);
   EXPECT_NEAR(y(0), obj_expected + c, tol);
+
+  // Evaluate at several points at once.
+  Eigen::Matrix2d X;
+  X << x0, Eigen::Vector2d::Zero();
+  Eigen::MatrixXd Y;
+  new_cost->EvalBatch(X, &Y);
+  EXPECT_TRUE(
+      CompareMatrices(Y, Eigen::RowVector2d(obj_expected + c, c), tol));
 }
 
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
@@ -1,5 +1,8 @@
 #include "drake/solvers/dreal_solver.h"
 
+#include <stdexcept>
+#include <vector>
+
 #include <Eigen/Core>
 #include <gtest/gtest.h>
 
@@ -165,6 +168,30 @@ TEST_F(DrealSolverTest, CheckSatisfiabilityUnsat) {
   EXPECT_FALSE(result);
 }
 
+// Tests CheckSatisfiability over many formulas, some of which are repeated.
+TEST_F(DrealSolverTest, CheckSatisfiabilityBatch) {
+  const Formula sat{x_ == 4 && y_ == 2 * x_};
+  const Formula unsat{x_ > 1 && x_ < 0};
+  const std::vector<Formula> formulas{sat, unsat, x_ == 4 && y_ == 2 * x_,
+                                      b1_ && !b2_, unsat};
+  for (const int num_threads : {1, 3}) {
+    const auto results =
+        DrealSolver::CheckSatisfiability(formulas, delta_, num_threads);
+    ASSERT_EQ(results.size(), formulas.size());
+    for (int i = 0; i < static_cast<int>(formulas.size()); ++i) {
+      const auto expected =
+          DrealSolver::CheckSatisfiability(formulas[i], delta_);
+      ASSERT_EQ(static_cast<bool>(results[i]), static_cast<bool>(expected));
+      if (expected) {
+        EXPECT_EQ(results[i]->size(), expected->size());
+      }
+    }
+    EXPECT_NEAR(results[2]->at(y_).mid(), 8.0, delta_);
+  }
+  EXPECT_THROW(DrealSolver::CheckSatisfiability(formulas, delta_, 0),
+               std::runtime_error);
+}
+
 TEST_F(DrealSolverTest, CheckSatisfiabilityNonlinear) {
   // Find a model satisfying the following constraints:
   //     x = 4
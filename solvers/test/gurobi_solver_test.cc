@@ -1,5 +1,7 @@
 #include "drake/solvers/gurobi_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -105,6 +107,71 @@ GTEST_TEST(GurobiTest, TestInitialGuess) {
   }
 }
 
+GTEST_TEST(GurobiTest, TestPersistentSession) {
+  GurobiSolver solver;
+  EXPECT_FALSE(solver.persistent_session());
+  solver.set_persistent_session(true);
+  EXPECT_TRUE(solver.persistent_session());
+  if (solver.available()) {
+    // Same problem as in TestInitialGuess, with multiple optimal solutions.
+    MathematicalProgram prog;
+    auto x = prog.NewBinaryVariables<1>("x");
+    prog.SetSolverOption(GurobiSolver::id(), "Presolve", 0);
+    prog.SetSolverOption(GurobiSolver::id(), "Heuristics", 0.0);
+
+    double x_expected0_to_test[] = {0.0, 1.0};
+    for (int i = 0; i < 2; i++) {
+      Eigen::VectorXd x_expected(1);
+      x_expected[0] = x_expected0_to_test[i];
+      prog.SetInitialGuess(x, x_expected);
+      SolutionResult result = solver.Solve(prog);
+      EXPECT_EQ(result, SolutionResult::kSolutionFound);
+
+      // Without an initial guess, the solver starts from the previous
+      // solution.
+      prog.SetInitialGuess(
+          x, Eigen::VectorXd::Constant(
+                 1, std::numeric_limits<double>::quiet_NaN()));
+      result = solver.Solve(prog);
+      EXPECT_EQ(result, SolutionResult::kSolutionFound);
+      EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_expected, 1E-6,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
+GTEST_TEST(GurobiTest, TestLicense) {
+  GurobiSolver solver;
+  if (solver.available()) {
+    auto license = GurobiSolver::AcquireLicense();
+    ASSERT_NE(license, nullptr);
+    // The thread keeps a single environment while the license is held.
+    EXPECT_EQ(GurobiSolver::AcquireLicense(), license);
+
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<1>("x");
+    prog.AddLinearCost(Vector1d(1), x);
+    prog.AddBoundingBoxConstraint(-1, 1, x);
+    EXPECT_FALSE(prog.GetSolverStatistics().setup_time);
+    EXPECT_FALSE(prog.GetSolverStatistics().solve_time);
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+      EXPECT_NEAR(prog.GetSolution(x(0)), -1, 1E-8);
+      const SolverStatistics& statistics = prog.GetSolverStatistics();
+      ASSERT_TRUE(statistics.setup_time);
+      ASSERT_TRUE(statistics.solve_time);
+      EXPECT_GE(*statistics.setup_time, 0);
+      EXPECT_GE(*statistics.solve_time, 0);
+      ASSERT_TRUE(statistics.num_iterations);
+      EXPECT_GE(*statistics.num_iterations, 0);
+      // The bounds are not stored in the constraint matrix.
+      EXPECT_EQ(statistics.num_nonzeros, optional<int>(0));
+    }
+  } else {
+    EXPECT_EQ(GurobiSolver::AcquireLicense(), nullptr);
+  }
+}
+
 namespace TestCallbacks {
 
 struct TestCallbackInfo {
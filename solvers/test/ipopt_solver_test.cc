@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -64,6 +65,55 @@ GTEST_TEST(QPtest, TestUnitBallExample) {
     TestQPonUnitBallExample(solver);
   }
 }
+
+// y = [x₀² + x₁, x₁² + x₂], whose gradient has two structural zeros, which
+// are optionally declared through the gradient sparsity pattern.
+class ChainConstraint : public Constraint {
+ public:
+  explicit ChainConstraint(bool declare_sparsity)
+      : Constraint(2, 3, Eigen::Vector2d::Constant(1),
+                   Eigen::Vector2d::Constant(1)) {
+    if (declare_sparsity) {
+      SetGradientSparsityPattern({{0, 0}, {0, 1}, {1, 1}, {1, 2}});
+    }
+  }
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd& y) const override {
+    y.resize(2);
+    y << x(0) * x(0) + x(1), x(1) * x(1) + x(2);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd& y) const override {
+    y.resize(2);
+    y << x(0) * x(0) + x(1), x(1) * x(1) + x(2);
+  }
+};
+
+// Only the entries in the gradient sparsity pattern are reported to IPOPT, and
+// the solution does not change.
+GTEST_TEST(IpoptSolverTest, GradientSparsityPattern) {
+  IpoptSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  Eigen::VectorXd solutions[2];
+  for (const bool declare_sparsity : {false, true}) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables<3>();
+    prog.AddConstraint(std::make_shared<ChainConstraint>(declare_sparsity), x);
+    prog.AddQuadraticCost(x.cast<symbolic::Expression>().squaredNorm());
+    prog.SetInitialGuess(x, Eigen::Vector3d(0.5, 0.5, 0.5));
+    ASSERT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    const optional<int> num_nonzeros = prog.GetSolverStatistics().num_nonzeros;
+    ASSERT_TRUE(num_nonzeros);
+    EXPECT_EQ(*num_nonzeros, declare_sparsity ? 4 : 6);
+    solutions[declare_sparsity] = prog.GetSolution(x);
+  }
+  EXPECT_TRUE(CompareMatrices(solutions[0], solutions[1], 1E-6));
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
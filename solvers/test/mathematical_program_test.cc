@@ -441,6 +441,34 @@ GTEST_TEST(testAddDecisionVariables, AddVariable2) {
   }
 }
 
+GTEST_TEST(testMathematicalProgram, FindDecisionVariableIndicesFromBinding) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<4>("x");
+  // The binding stored in the program caches the index of each variable.
+  const auto binding = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 2), 0, 1, VectorDecisionVariable<2>(x(3), x(1)));
+  EXPECT_EQ(binding.decision_variable_indices(), std::vector<int>({3, 1}));
+  EXPECT_EQ(prog.FindDecisionVariableIndices(binding),
+            prog.FindDecisionVariableIndices(binding.variables()));
+
+  // A binding that has not been added to the program has no cache.
+  const Binding<LinearConstraint> unindexed(binding.evaluator(),
+                                            x.tail<2>());
+  EXPECT_TRUE(unindexed.decision_variable_indices().empty());
+  EXPECT_EQ(prog.FindDecisionVariableIndices(unindexed),
+            std::vector<int>({2, 3}));
+
+  // The cache is not trusted by another program with different variables.
+  MathematicalProgram other_prog;
+  other_prog.NewContinuousVariables<2>("y");
+  other_prog.AddDecisionVariables(VectorDecisionVariable<2>(x(1), x(3)));
+  EXPECT_EQ(other_prog.FindDecisionVariableIndices(binding),
+            std::vector<int>({3, 2}));
+  MathematicalProgram empty_prog;
+  EXPECT_THROW(empty_prog.FindDecisionVariableIndices(binding),
+               std::runtime_error);
+}
+
 GTEST_TEST(testAddDecisionVariables, AddVariable3) {
   // Test the error inputs.
   MathematicalProgram prog;
@@ -929,6 +957,67 @@ GTEST_TEST(testMathematicalProgram, AddLinearCostSymbolic) {
   CheckAddedSymbolicLinearCost(&prog, x(1) * x(1) + x(0) - x(1) * x(1));
 }
 
+GTEST_TEST(testMathematicalProgram, AddSparseLinearConstraint) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.emplace_back(0, 0, 1);
+  triplets.emplace_back(1, 2, -2);
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  Eigen::Matrix<double, 2, 3> A_dense;
+  A_dense << 1, 0, 0,
+             0, 0, -2;
+
+  const auto binding = prog.AddLinearConstraint(A, Eigen::Vector2d(-1, -2),
+                                                Eigen::Vector2d(1, 2), x);
+  EXPECT_EQ(prog.linear_constraints().size(), 1);
+  EXPECT_EQ(binding.evaluator()->get_sparse_A().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->A(), A_dense));
+
+  const auto eq_binding =
+      prog.AddLinearEqualityConstraint(A, Eigen::Vector2d(1, 2), x);
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1);
+  EXPECT_EQ(eq_binding.evaluator()->get_sparse_A().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(eq_binding.evaluator()->A(), A_dense));
+  EXPECT_TRUE(CompareMatrices(eq_binding.evaluator()->lower_bound(),
+                              Eigen::Vector2d(1, 2)));
+}
+
+GTEST_TEST(testMathematicalProgram, AddLinearConstraintFromTerms) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  // -1 ≤ x₂ - x₀ + 2x₀ ≤ 1, -2 ≤ 3x₁ ≤ 2.
+  const std::vector<LinearTerm> terms{
+      {0, x(2), 1}, {1, x(1), 3}, {0, x(0), -1}, {0, x(0), 2}};
+  const auto binding = prog.AddLinearConstraint(terms, Eigen::Vector2d(-1, -2),
+                                                Eigen::Vector2d(1, 2));
+  EXPECT_EQ(prog.linear_constraints().size(), 1);
+  // The variables are in the order of their first appearance.
+  EXPECT_TRUE(CheckStructuralEquality(
+      binding.variables(), VectorDecisionVariable<3>(x(2), x(1), x(0))));
+  Eigen::Matrix<double, 2, 3> A_expected;
+  A_expected << 1, 0, 1,
+                0, 3, 0;
+  EXPECT_EQ(binding.evaluator()->get_sparse_A().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->A(), A_expected));
+
+  const auto eq_binding =
+      prog.AddLinearEqualityConstraint(terms, Eigen::Vector2d(1, 2));
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1);
+  EXPECT_TRUE(CompareMatrices(eq_binding.evaluator()->A(), A_expected));
+  EXPECT_TRUE(CompareMatrices(eq_binding.evaluator()->lower_bound(),
+                              Eigen::Vector2d(1, 2)));
+
+  // The row of a term is out of range.
+  EXPECT_THROW(prog.AddLinearEqualityConstraint({{2, x(0), 1}},
+                                                Eigen::Vector2d(1, 2)),
+               std::runtime_error);
+  // The variable is not a decision variable of prog.
+  const Variable y("y");
+  EXPECT_THROW(prog.AddLinearEqualityConstraint({{0, y, 1}}, Vector1d(1)),
+               std::runtime_error);
+}
 GTEST_TEST(testMathematicalProgram, AddLinearConstraintSymbolic1) {
   // Add linear constraint: -10 <= 3 - 5*x0 + 10*x2 - 7*y1 <= 10
   MathematicalProgram prog;
@@ -2334,6 +2423,80 @@ GTEST_TEST(testMathematicalProgram, AddPositiveSemidefiniteConstraint) {
   CheckAddedSymbolicPositiveSemidefiniteConstraint(&prog, Y);
 }
 
+GTEST_TEST(testMathematicalProgram,
+           AddPositiveDiagonallyDominantMatrixConstraint) {
+  MathematicalProgram prog;
+  auto X = prog.NewSymmetricContinuousVariables<3>("X");
+  const MatrixX<Expression> Y =
+      prog.AddPositiveDiagonallyDominantMatrixConstraint(
+          X.cast<Expression>());
+  // One slack variable per pair of off-diagonal entries.
+  EXPECT_EQ(prog.num_vars(), 6 + 3);
+  ASSERT_EQ(Y.rows(), 3);
+  ASSERT_EQ(Y.cols(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_PRED2(ExprEqual, Y(i, i), X(i, i) + 0);
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_PRED2(ExprEqual, Y(i, j), Y(j, i));
+    }
+  }
+  // Two rows per pair of off-diagonal entries, and one row per diagonal entry.
+  ASSERT_EQ(prog.linear_constraints().size(), 1);
+  EXPECT_EQ(prog.linear_constraints()[0].evaluator()->num_constraints(), 9);
+  EXPECT_TRUE(prog.positive_semidefinite_constraints().empty());
+}
+
+GTEST_TEST(testMathematicalProgram,
+           AddScaledDiagonallyDominantMatrixConstraint) {
+  MathematicalProgram prog;
+  auto X = prog.NewSymmetricContinuousVariables<3>("X");
+  const auto M =
+      prog.AddScaledDiagonallyDominantMatrixConstraint(X.cast<Expression>());
+  // Two new variables for the diagonal of each 2 x 2 block.
+  EXPECT_EQ(prog.num_vars(), 6 + 6);
+  EXPECT_EQ(prog.rotated_lorentz_cone_constraints().size(), 3);
+  ASSERT_EQ(prog.linear_equality_constraints().size(), 1);
+  EXPECT_EQ(
+      prog.linear_equality_constraints()[0].evaluator()->num_constraints(), 3);
+  EXPECT_TRUE(prog.positive_semidefinite_constraints().empty());
+  ASSERT_EQ(M.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = i + 1; j < 3; ++j) {
+      EXPECT_PRED2(ExprEqual, M[i][j](0, 1), X(j, i) + 0);
+      EXPECT_PRED2(ExprEqual, M[i][j](1, 0), X(j, i) + 0);
+    }
+  }
+
+  // A 1 x 1 matrix only needs a nonnegative diagonal.
+  MathematicalProgram prog1;
+  auto x = prog1.NewContinuousVariables<1>("x");
+  prog1.AddScaledDiagonallyDominantMatrixConstraint(
+      Vector1<Expression>(x(0)));
+  EXPECT_EQ(prog1.num_vars(), 1);
+  EXPECT_TRUE(prog1.rotated_lorentz_cone_constraints().empty());
+  EXPECT_EQ(prog1.linear_constraints().size() +
+                prog1.bounding_box_constraints().size(),
+            1);
+}
+
+GTEST_TEST(testMathematicalProgram, NewNonnegativePolynomial) {
+  using Type = MathematicalProgram::NonnegativePolynomial;
+  for (const Type type : {Type::kSos, Type::kSdsos, Type::kDsos}) {
+    MathematicalProgram prog;
+    const auto x = prog.NewIndeterminates<2>("x");
+    const auto pair =
+        prog.NewNonnegativePolynomial(symbolic::Variables(x), 2, type);
+    // The Gram matrix is over the monomials 1, x₀ and x₁.
+    EXPECT_EQ(pair.second.rows(), 3);
+    EXPECT_EQ(pair.first.TotalDegree(), 2);
+    EXPECT_EQ(prog.positive_semidefinite_constraints().size(),
+              type == Type::kSos ? 1 : 0);
+    EXPECT_EQ(prog.rotated_lorentz_cone_constraints().size(),
+              type == Type::kSdsos ? 3 : 0);
+    EXPECT_EQ(prog.linear_constraints().size(), type == Type::kDsos ? 1 : 0);
+  }
+}
+
 void CheckAddedQuadraticCost(MathematicalProgram* prog,
                              const Eigen::MatrixXd& Q, const Eigen::VectorXd& b,
                              const VectorXDecisionVariable& x) {
@@ -2753,6 +2916,52 @@ GTEST_TEST(testMathematicalProgram, testEvalBinding) {
   EXPECT_THROW(prog.EvalBinding(quadratic_cost_y, x_val), std::runtime_error);
 }
 
+GTEST_TEST(testMathematicalProgram, testEvalBindingsAtPoints) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  auto linear_constraint = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 2), Vector1d(-1), Vector1d(2), x.tail<2>());
+  auto bounding_box = prog.AddBoundingBoxConstraint(-1, 1, x);
+  auto lorentz_cone = prog.AddLorentzConeConstraint(
+      Eigen::Matrix3d::Identity(), Eigen::Vector3d(0.1, 0.2, 0.3), x);
+  auto quadratic_cost = prog.AddQuadraticCost(x(1) * x(1) + x(2));
+
+  Eigen::Matrix<double, 3, 4> X;
+  // clang-format off
+  X << 1, 2, -1, 0,
+       2, 0, 3, 1,
+       3, -1, 0.5, 2;
+  // clang-format on
+  // Each column agrees with EvalBinding at that point.
+  auto check = [&prog, &X](const auto& binding) {
+    const Eigen::MatrixXd Y = prog.EvalBindingAtPoints(binding, X);
+    ASSERT_EQ(Y.cols(), X.cols());
+    for (int j = 0; j < X.cols(); ++j) {
+      EXPECT_TRUE(CompareMatrices(Y.col(j),
+                                  prog.EvalBinding(binding, X.col(j)), 1E-14,
+                                  MatrixCompareType::relative));
+    }
+  };
+  check(linear_constraint);
+  check(bounding_box);
+  check(lorentz_cone);
+  check(quadratic_cost);
+
+  // The outputs of several bindings are stacked.
+  const std::vector<Binding<Constraint>> bindings{linear_constraint,
+                                                  bounding_box, lorentz_cone};
+  const Eigen::MatrixXd Y = prog.EvalBindingsAtPoints(bindings, X);
+  ASSERT_EQ(Y.rows(), 6);
+  EXPECT_TRUE(CompareMatrices(Y.middleRows(1, 3),
+                              prog.EvalBindingAtPoints(bounding_box, X)));
+  EXPECT_TRUE(CompareMatrices(Y.bottomRows(2),
+                              prog.EvalBindingAtPoints(lorentz_cone, X)));
+
+  EXPECT_THROW(prog.EvalBindingAtPoints(linear_constraint,
+                                        Eigen::MatrixXd::Zero(2, 4)),
+               std::logic_error);
+}
+
 GTEST_TEST(testMathematicalProgram, testSetAndGetInitialGuess) {
   MathematicalProgram prog;
   const auto x = prog.NewContinuousVariables<3>();
@@ -2827,6 +3036,18 @@ GTEST_TEST(testMathematicalProgram, testSetSolverResult) {
   EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_val));
   EXPECT_EQ(prog.GetOptimalCost(), cost);
   EXPECT_EQ(prog.GetLowerBoundCost(), lower_bound_cost);
+  EXPECT_FALSE(prog.GetSolverStatistics().solve_time);
+
+  // Sets the statistics.
+  SolverStatistics statistics;
+  statistics.solve_time = 0.5;
+  statistics.num_iterations = 3;
+  solver_result.set_statistics(statistics);
+  prog.SetSolverResult(solver_result);
+  EXPECT_FALSE(prog.GetSolverStatistics().setup_time);
+  EXPECT_EQ(prog.GetSolverStatistics().solve_time, optional<double>(0.5));
+  EXPECT_EQ(prog.GetSolverStatistics().num_iterations, optional<int>(3));
+  EXPECT_FALSE(prog.GetSolverStatistics().num_nonzeros);
 
   // Now create a new solver_result.
   const SolverId dummy_solver_id2("dummy2");
@@ -2839,6 +3060,8 @@ GTEST_TEST(testMathematicalProgram, testSetSolverResult) {
       Eigen::Vector2d::Constant(std::numeric_limits<double>::quiet_NaN())));
   EXPECT_TRUE(std::isnan(prog.GetOptimalCost()));
   EXPECT_TRUE(std::isnan(prog.GetLowerBoundCost()));
+  EXPECT_FALSE(prog.GetSolverStatistics().solve_time);
+  EXPECT_FALSE(prog.GetSolverStatistics().num_iterations);
 }
 
 }  // namespace test
@@ -376,6 +376,99 @@ GTEST_TEST(testMobyLCP, testFailure) {
   // not to fail.
 }
 
+// Verifies that the basis at the solution of one LCP can be used to solve a
+// nearby LCP without further pivoting.
+GTEST_TEST(testMobyLCP, testLemkeInitialBasis) {
+  Eigen::Matrix<double, 4, 4> M;
+  // clang-format off
+  M << 2, 1, 0, 0,
+       1, 2, 1, 0,
+       0, 1, 2, 1,
+       0, 0, 1, 2;
+  // clang-format on
+  Eigen::VectorXd q(4);
+  q << -1, 1, -1, 1;
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+
+  Eigen::VectorXd z;
+  std::vector<int> basis;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z, std::vector<int>(), &basis));
+  EXPECT_GT(l.get_num_pivots(), 0);
+  EXPECT_EQ(basis, std::vector<int>({0, 2}));
+  LinearComplementarityConstraint constraint(M, q);
+  EXPECT_TRUE(constraint.CheckSatisfied(z, epsilon));
+
+  // Perturb q; the solution keeps the same basis.
+  Eigen::VectorXd q_perturbed = q;
+  q_perturbed(0) = -1.1;
+  Eigen::VectorXd z_expected;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_perturbed, &z_expected));
+  Eigen::VectorXd z_warm;
+  std::vector<int> new_basis;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_perturbed, &z_warm, basis, &new_basis));
+  EXPECT_EQ(l.get_num_pivots(), 0);
+  EXPECT_EQ(new_basis, basis);
+  EXPECT_TRUE(CompareMatrices(z_warm, z_expected, epsilon,
+                              MatrixCompareType::absolute));
+
+  // A basis that is not optimal still yields the solution.
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_perturbed, &z_warm, std::vector<int>{1},
+                              &new_basis));
+  EXPECT_EQ(new_basis, basis);
+  EXPECT_TRUE(CompareMatrices(z_warm, z_expected, epsilon,
+                              MatrixCompareType::absolute));
+
+  EXPECT_THROW(l.SolveLcpLemke(M, q, &z, std::vector<int>{4}),
+               std::logic_error);
+  EXPECT_THROW(l.SolveLcpLemke(M, q, &z, std::vector<int>{0, 0}),
+               std::logic_error);
+}
+
+// Verifies that the standard initial basis is used if the basis matrix for
+// the given basis is singular.
+GTEST_TEST(testMobyLCP, testLemkeSingularInitialBasis) {
+  Eigen::MatrixXd M(2, 2);
+  // clang-format off
+  M << 1, 1,
+       1, 1;
+  // clang-format on
+  Eigen::VectorXd q(2);
+  q << -1, -1;
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+
+  Eigen::VectorXd z;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z, std::vector<int>{0, 1}));
+  LinearComplementarityConstraint constraint(M, q);
+  EXPECT_TRUE(constraint.CheckSatisfied(z, epsilon));
+}
+
+// Solves an LCP that requires enough pivots for the basis matrix to be
+// factored again during the solve.
+GTEST_TEST(testMobyLCP, testLemkeManyPivots) {
+  const int n = 100;
+  Eigen::MatrixXd M = Eigen::MatrixXd::Identity(n, n);
+  for (int i = 0; i < n - 1; ++i) {
+    M(i, i + 1) = 0.5;
+    M(i + 1, i) = 0.5;
+  }
+  const Eigen::VectorXd q = -Eigen::VectorXd::LinSpaced(n, 1, 2);
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+
+  Eigen::VectorXd z;
+  std::vector<int> basis;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z, std::vector<int>(), &basis));
+  EXPECT_GT(l.get_num_pivots(), 50);
+  LinearComplementarityConstraint constraint(M, q);
+  EXPECT_TRUE(constraint.CheckSatisfied(z, epsilon));
+
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z, basis));
+  EXPECT_EQ(l.get_num_pivots(), 0);
+  EXPECT_TRUE(constraint.CheckSatisfied(z, epsilon));
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -47,6 +49,29 @@ GTEST_TEST(QPtest, TestUnconstrainedQP) {
   }
 }
 
+GTEST_TEST(QPtest, TestStatistics) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost(2 * Eigen::Matrix2d::Identity(), Eigen::Vector2d::Zero(),
+                        x);
+  prog.AddLinearConstraint(x(0) + x(1) >= 1);
+
+  OsqpSolver solver;
+  if (solver.available()) {
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    const SolverStatistics& statistics = prog.GetSolverStatistics();
+    ASSERT_TRUE(statistics.setup_time);
+    ASSERT_TRUE(statistics.solve_time);
+    EXPECT_GE(*statistics.setup_time, 0);
+    EXPECT_GE(*statistics.solve_time, 0);
+    ASSERT_TRUE(statistics.num_iterations);
+    EXPECT_GT(*statistics.num_iterations, 0);
+    // Two nonzeros in the upper triangle of the Hessian, and two in the
+    // constraint matrix.
+    EXPECT_EQ(statistics.num_nonzeros, optional<int>(4));
+  }
+}
+
 TEST_P(QuadraticProgramTest, TestQP) {
   OsqpSolver solver;
   prob()->RunProblem(&solver);
@@ -127,6 +152,62 @@ GTEST_TEST(LPtest, TestUnbounded) {
     EXPECT_EQ(result, SolutionResult::kDualInfeasible);
   }
 }
+
+GTEST_TEST(QPtest, TestPersistentWorkspace) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+
+  // min x₀² + x₁² + b₀x₀ + b₁x₁
+  // s.t x₀ + x₁ ≥ c
+  auto cost = prog.AddQuadraticCost(2 * Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(1, 1), x);
+  auto constraint = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 1), Vector1d(1),
+      Vector1d(std::numeric_limits<double>::infinity()), x);
+
+  OsqpSolver solver;
+  EXPECT_FALSE(solver.persistent_workspace());
+  solver.set_persistent_workspace(true);
+  EXPECT_TRUE(solver.persistent_workspace());
+  if (solver.available()) {
+    const double tol = 1E-5;
+    SolutionResult result = solver.Solve(prog);
+    EXPECT_EQ(result, SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(0.5, 0.5),
+                                tol, MatrixCompareType::absolute));
+    EXPECT_EQ(solver.num_workspace_setups(), 1);
+
+    // Only the values change, so the workspace is updated instead of set up.
+    cost.evaluator()->UpdateCoefficients(4 * Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(-4, 0));
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(1, 1), Vector1d(3),
+        Vector1d(std::numeric_limits<double>::infinity()));
+    result = solver.Solve(prog);
+    EXPECT_EQ(result, SolutionResult::kSolutionFound);
+    // The solution to min 2x₀² + 2x₁² - 4x₀ s.t x₀ + x₁ ≥ 3.
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(2, 1),
+                                tol, MatrixCompareType::absolute));
+    EXPECT_NEAR(prog.GetOptimalCost(), 2, tol);
+    EXPECT_EQ(solver.num_workspace_setups(), 1);
+
+    // A new constraint changes the structure, so a new workspace is set up.
+    prog.AddLinearConstraint(x(1) >= 1.5);
+    result = solver.Solve(prog);
+    EXPECT_EQ(result, SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1.5, 1.5),
+                                tol, MatrixCompareType::absolute));
+    EXPECT_EQ(solver.num_workspace_setups(), 2);
+
+    // Without the persistent workspace, every solve sets up a workspace.
+    solver.set_persistent_workspace(false);
+    result = solver.Solve(prog);
+    EXPECT_EQ(result, SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1.5, 1.5),
+                                tol, MatrixCompareType::absolute));
+    EXPECT_EQ(solver.num_workspace_setups(), 3);
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
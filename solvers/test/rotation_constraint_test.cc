@@ -223,6 +223,30 @@ GTEST_TEST(RotationConstraint, TestAddStaticSizeNumIntervalsPerHalfAxis) {
       "Incorrect type.");
 }
 
+// The envelopes of two rotation matrices, with the same number of binary
+// variables per half axis, share their coefficients but not their variables.
+GTEST_TEST(RotationConstraint, TestMcCormickEnvelopeReused) {
+  MathematicalProgram prog;
+  auto R1 = NewRotationMatrixVars(&prog);
+  auto R2 = NewRotationMatrixVars(&prog);
+  const int num_linear_constraints = prog.linear_constraints().size();
+  AddRotationMatrixMcCormickEnvelopeMilpConstraints(&prog, R1, 1);
+  AddRotationMatrixMcCormickEnvelopeMilpConstraints(&prog, R2, 1);
+  ASSERT_EQ(static_cast<int>(prog.linear_constraints().size()),
+            num_linear_constraints + 2);
+  const auto& envelope1 = prog.linear_constraints()[num_linear_constraints];
+  const auto& envelope2 =
+      prog.linear_constraints()[num_linear_constraints + 1];
+  EXPECT_TRUE(CompareMatrices(envelope1.evaluator()->A(),
+                              envelope2.evaluator()->A()));
+  EXPECT_TRUE(CompareMatrices(envelope1.evaluator()->lower_bound(),
+                              envelope2.evaluator()->lower_bound()));
+  EXPECT_TRUE(CompareMatrices(envelope1.evaluator()->upper_bound(),
+                              envelope2.evaluator()->upper_bound()));
+  EXPECT_TRUE(envelope1.variables()(0).equal_to(R1(0, 0)));
+  EXPECT_TRUE(envelope2.variables()(0).equal_to(R2(0, 0)));
+}
+
 class TestMcCormick : public ::testing::TestWithParam<std::tuple<bool, int>> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TestMcCormick)
@@ -93,6 +93,13 @@ GTEST_TEST(LinearProgramTest, Test1) {
   if (scs_solver.available()) {
     SolutionResult sol_result = scs_solver.Solve(prog);
     EXPECT_EQ(sol_result, SolutionResult::kInfeasibleConstraints);
+    // The statistics are reported even if the program is infeasible.
+    const SolverStatistics& statistics = prog.GetSolverStatistics();
+    EXPECT_TRUE(statistics.setup_time);
+    EXPECT_TRUE(statistics.solve_time);
+    ASSERT_TRUE(statistics.num_iterations);
+    EXPECT_GT(*statistics.num_iterations, 0);
+    EXPECT_EQ(statistics.num_nonzeros, optional<int>(6));
   }
 }
 
@@ -131,6 +131,60 @@ GTEST_TEST(SnoptTest, TestSparseCost) {
       CompareMatrices(prog.GetSolution(x), Eigen::Vector3d(1, -1, 1), tol));
   EXPECT_NEAR(prog.GetOptimalCost(), -1, tol);
 }
+
+// A QuadraticConstraint that reports to be thread safe, which holds since its
+// evaluation does not use any mutable storage.
+class ThreadSafeQuadraticConstraint : public QuadraticConstraint {
+ public:
+  using QuadraticConstraint::QuadraticConstraint;
+
+  bool is_thread_safe() const override { return true; }
+};
+
+GTEST_TEST(SnoptTest, TestNumThreads) {
+  SnoptSolver solver;
+  EXPECT_EQ(solver.num_threads(), 1);
+  EXPECT_THROW(solver.set_num_threads(0), std::runtime_error);
+
+  // Solve a program
+  // min ∑ᵢ xᵢ(0) + 2xᵢ(1)
+  // s.t xᵢᵀxᵢ = 1 for i = 0, ..., 9
+  // with every constraint but the last one evaluated in parallel.
+  MathematicalProgram prog;
+  const int kNumPoints = 10;
+  const auto x = prog.NewContinuousVariables<2, kNumPoints>();
+  for (int i = 0; i < kNumPoints; ++i) {
+    prog.AddLinearCost(Eigen::Vector2d(1, 2), x.col(i));
+    if (i < kNumPoints - 1) {
+      prog.AddConstraint(std::make_shared<ThreadSafeQuadraticConstraint>(
+                             2 * Eigen::Matrix2d::Identity(),
+                             Eigen::Vector2d::Zero(), 1, 1),
+                         x.col(i));
+    } else {
+      prog.AddConstraint(std::make_shared<QuadraticConstraint>(
+                             2 * Eigen::Matrix2d::Identity(),
+                             Eigen::Vector2d::Zero(), 1, 1),
+                         x.col(i));
+    }
+    prog.SetInitialGuess(x.col(i), Eigen::Vector2d(1 + i, -i));
+  }
+
+  if (solver.available()) {
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    const Eigen::MatrixXd x_serial = prog.GetSolution(x);
+    const Eigen::Vector2d x_expected = -Eigen::Vector2d(1, 2).normalized();
+    for (int i = 0; i < kNumPoints; ++i) {
+      EXPECT_TRUE(CompareMatrices(x_serial.col(i), x_expected, 1E-6));
+    }
+
+    // The values and gradients are the same regardless of the number of
+    // threads, and so are the iterates of the solver.
+    solver.set_num_threads(4);
+    EXPECT_EQ(solver.num_threads(), 4);
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_serial));
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,71 @@
+#include "drake/solvers/solve_in_parallel.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+// Makes the program
+//   min |x - c|²
+//   s.t. x(0) + x(1) + x(2) = 1,
+// whose solution is x = c + (1 - sum(c)) / 3.
+std::unique_ptr<MathematicalProgram> MakeProjectionProgram(
+    const Eigen::Vector3d& c) {
+  auto prog = std::make_unique<MathematicalProgram>();
+  auto x = prog->NewContinuousVariables<3>();
+  prog->AddQuadraticErrorCost(Eigen::Matrix3d::Identity(), c, x);
+  prog->AddLinearEqualityConstraint(Eigen::RowVector3d::Ones(), 1, x);
+  return prog;
+}
+
+GTEST_TEST(SolveInParallelTest, EqualityConstrainedQPs) {
+  const int num_progs = 20;
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  std::vector<MathematicalProgram*> prog_ptrs;
+  std::vector<Eigen::Vector3d> solutions;
+  for (int i = 0; i < num_progs; ++i) {
+    const Eigen::Vector3d c(i, -0.5 * i, 1.0 / (i + 1));
+    progs.push_back(MakeProjectionProgram(c));
+    prog_ptrs.push_back(progs.back().get());
+    solutions.push_back(c + Eigen::Vector3d::Constant((1 - c.sum()) / 3));
+  }
+
+  for (int num_threads : {1, 4}) {
+    const std::vector<ParallelSolveResult> results = SolveInParallel(
+        prog_ptrs, EqualityConstrainedQPSolver::id(), num_threads);
+    ASSERT_EQ(static_cast<int>(results.size()), num_progs);
+    for (int i = 0; i < num_progs; ++i) {
+      EXPECT_EQ(results[i].solution_result, SolutionResult::kSolutionFound);
+      EXPECT_GE(results[i].solve_time, 0);
+      EXPECT_EQ(progs[i]->GetSolverId(), EqualityConstrainedQPSolver::id());
+      EXPECT_TRUE(CompareMatrices(
+          progs[i]->GetSolution(progs[i]->decision_variables()),
+          solutions[i], 1E-12));
+    }
+  }
+
+  // An empty batch.
+  EXPECT_TRUE(SolveInParallel({}, EqualityConstrainedQPSolver::id(), 2)
+                  .empty());
+}
+
+GTEST_TEST(SolveInParallelTest, BadArguments) {
+  auto prog = MakeProjectionProgram(Eigen::Vector3d::Zero());
+  EXPECT_THROW(
+      SolveInParallel({prog.get()}, EqualityConstrainedQPSolver::id(), 0),
+      std::logic_error);
+  EXPECT_THROW(SolveInParallel({prog.get()}, SolverId("unknown"), 1),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -175,6 +175,28 @@ TEST_F(SosConstraintTest, NewSosPolynomialViaMonomialBasis) {
   EXPECT_TRUE(poly.ToExpression().EqualTo(expected_poly.ToExpression()));
 }
 
+// Shows that the minimum of f(x) = x⁴ + x² + 1, which is 1, is certified by
+// all the types of nonnegative polynomials.
+TEST_F(SosConstraintTest, AddNonnegativePolynomialConstraint) {
+  using Type = MathematicalProgram::NonnegativePolynomial;
+  for (const Type type : {Type::kSos, Type::kSdsos, Type::kDsos}) {
+    MathematicalProgram prog;
+    const auto x = prog.NewIndeterminates<1>()(0);
+    const auto c = prog.NewContinuousVariables<1>()(0);
+    prog.AddCost(-c);
+    const auto pair = prog.AddNonnegativePolynomialConstraint(
+        symbolic::Polynomial(pow(x, 4) + pow(x, 2) + 1 - c,
+                             symbolic::Variables{x}),
+        type);
+    EXPECT_EQ(pair.first.rows(), 3);
+    EXPECT_EQ(prog.positive_semidefinite_constraints().empty(),
+              type != Type::kSos);
+    const auto result = prog.Solve();
+    ASSERT_EQ(result, SolutionResult::kSolutionFound);
+    EXPECT_NEAR(prog.GetSolution(c), 1, 1E-6);
+  }
+}
+
 // Shows that f(x) = x² + 2x + 1 is SOS.
 TEST_F(SosConstraintTest, AddSosConstraintUnivariate1) {
   const auto& x = x_(0);
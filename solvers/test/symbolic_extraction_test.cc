@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <limits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -198,6 +200,71 @@ GTEST_TEST(SymbolicExtraction, DecomposeLinearExpression) {
   }
 }
 
+GTEST_TEST(SymbolicExtraction, DecomposeAffineExpression) {
+  const Variable x("x");
+  const Variable y("y");
+
+  // Read off the expression tree, and through the polynomial fallback.
+  for (const Expression& e :
+       {Expression(2 * x - 3 * y + 4), Expression(2 * (x + 1) - 3 * y + 2),
+        Expression((x + 1) * (y + 2) - x * y - 4 * y + 2)}) {
+    std::vector<std::pair<Variable, double>> terms;
+    double c = 0;
+    DecomposeAffineExpression(e, &terms, &c);
+    double x_coeff = 0;
+    double y_coeff = 0;
+    for (const auto& term : terms) {
+      if (term.first.equal_to(x)) {
+        x_coeff += term.second;
+      } else {
+        ASSERT_TRUE(term.first.equal_to(y));
+        y_coeff += term.second;
+      }
+    }
+    EXPECT_EQ(x_coeff, 2);
+    EXPECT_EQ(y_coeff, -3);
+    EXPECT_EQ(c, 4);
+    EXPECT_TRUE(IsAffineExpression(e));
+  }
+
+  std::vector<std::pair<Variable, double>> terms;
+  double c = 0;
+  EXPECT_THROW(DecomposeAffineExpression(x * y, &terms, &c),
+               std::runtime_error);
+  EXPECT_THROW(DecomposeAffineExpression(sin(x), &terms, &c),
+               std::runtime_error);
+  EXPECT_FALSE(IsAffineExpression(x * y));
+  EXPECT_FALSE(IsAffineExpression(sin(x)));
+}
+
+GTEST_TEST(SymbolicExtraction, DecomposeAffineExpressions) {
+  const Variable x("x");
+  const Variable y("y");
+  const Variable z("z");
+
+  VectorXe v(3);
+  v << 2 * z + 1, x - y + z, 3 * y - 3 * y + 2;
+  Eigen::SparseMatrix<double> A;
+  VectorXd b;
+  VectorXDecisionVariable vars;
+  DecomposeAffineExpressions(v, &A, &b, &vars);
+
+  // The variables are ordered by row of first appearance, then by ID.
+  EXPECT_EQ(VectorDecisionVariable<3>(z, x, y), vars);
+  MatrixXd A_expected(3, 3);
+  A_expected <<
+      2, 0, 0,
+      1, 1, -1,
+      0, 0, 0;
+  EXPECT_TRUE(CompareMatrices(A_expected, MatrixXd(A), kTol));
+  EXPECT_EQ(A.nonZeros(), 4);
+  EXPECT_TRUE(CompareMatrices(Vector3d(1, 0, 2), b, kTol));
+
+  v(2) = x * x;
+  EXPECT_THROW(DecomposeAffineExpressions(v, &A, &b, &vars),
+               std::runtime_error);
+}
+
 }  // anonymous namespace
 }  // namespace internal
 }  // namespace solvers
@@ -1,6 +1,7 @@
 #include "drake/solvers/system_identification.h"
 
 #include <random>  // Used only with deterministic seeds!
+#include <vector>
 
 #include <Eigen/Core>
 #include <gtest/gtest.h>
@@ -199,6 +200,72 @@ GTEST_TEST(SystemIdentificationTest, BasicEstimateParameters) {
   }
 }
 
+// Checks that the estimates do not depend on the number of threads, nor on
+// whether the measurements are read in chunks.
+GTEST_TEST(SystemIdentificationTest, ThreadedAndChunkedEstimateParameters) {
+  const Polynomiald x = Polynomiald("x");
+  const auto x_var = x.GetSimpleVariable();
+  const Polynomiald z = Polynomiald("z");
+  const auto z_var = z.GetSimpleVariable();
+  const Polynomiald a = Polynomiald("a");
+  const auto a_var = a.GetSimpleVariable();
+  const Polynomiald b = Polynomiald("b");
+  const auto b_var = b.GetSimpleVariable();
+  const VectorXPoly polys =
+      VectorXPoly::Constant(1, (a * x) + (b * x * x) - z);
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> noise(-0.01, 0.01);
+  std::vector<SID::PartialEvalType> sample_points;
+  for (int i = 0; i < 100; i++) {
+    const double x_value = 0.1 * i;
+    sample_points.push_back(
+        {{x_var, x_value},
+         {z_var, 2 * x_value + 3 * x_value * x_value + noise(generator)}});
+  }
+
+  SID::PartialEvalType serial_params;
+  double serial_error;
+  std::tie(serial_params, serial_error) =
+      SID::EstimateParameters(polys, sample_points);
+  EXPECT_NEAR(serial_params[a_var], 2, 0.05);
+  EXPECT_NEAR(serial_params[b_var], 3, 0.05);
+
+  SID::PartialEvalType threaded_params;
+  double threaded_error;
+  std::tie(threaded_params, threaded_error) =
+      SID::EstimateParameters(polys, sample_points, 3);
+  EXPECT_NEAR(threaded_error, serial_error, 1e-12);
+  for (const auto& var : {a_var, b_var}) {
+    EXPECT_NEAR(threaded_params[var], serial_params[var], 1e-10);
+  }
+
+  // Reads the same measurements in chunks of 7.
+  size_t next = 0;
+  const SID::DataChunkSource next_chunk =
+      [&](std::vector<SID::PartialEvalType>* chunk) {
+        chunk->clear();
+        for (; next < sample_points.size() && chunk->size() < 7; next++) {
+          chunk->push_back(sample_points[next]);
+        }
+        return !chunk->empty();
+      };
+  SID::PartialEvalType chunked_params;
+  double chunked_error;
+  std::tie(chunked_params, chunked_error) =
+      SID::EstimateParametersFromChunks(polys, next_chunk, 2);
+  EXPECT_NEAR(chunked_error, serial_error, 1e-12);
+  for (const auto& var : {a_var, b_var}) {
+    EXPECT_NEAR(chunked_params[var], serial_params[var], 1e-10);
+  }
+
+  // Chunked estimation requires parameters to appear linearly.
+  next = 0;
+  EXPECT_THROW(SID::EstimateParametersFromChunks(
+                   VectorXPoly::Constant(1, (a * a * x) - z), next_chunk),
+               std::runtime_error);
+}
+
 /// Test to check parameter estimation for a basic spring-mass system.
 ///@{
 
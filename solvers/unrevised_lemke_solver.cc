@@ -108,10 +108,10 @@ SolutionResult UnrevisedLemkeSolver<T>::Solve(MathematicalProgram& prog) const {
       prog.SetSolverResult(solver_result);
       return SolutionResult::kUnknownError;
     }
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < binding.evaluator()->num_vars(); ++i) {
-      const int variable_index =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      x_sol(variable_index) = constraint_solution(i);
+      x_sol(var_indices[i]) = constraint_solution(i);
     }
     solver_result.set_optimal_cost(0.0);
   }
@@ -0,0 +1,72 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "drake/common/parallel_for.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+BatchSimulator::BatchSimulator(const System<double>& system, int num_contexts,
+                               double step_size)
+    : system_(system),
+      step_size_(step_size),
+      num_threads_(GetDefaultNumThreads()) {
+  if (num_contexts < 1) {
+    throw std::logic_error("BatchSimulator: num_contexts must be positive.");
+  }
+  if (!(step_size > 0)) {
+    throw std::logic_error("BatchSimulator: step_size must be positive.");
+  }
+  contexts_.resize(num_contexts);
+  integrators_.resize(num_contexts);
+  for (auto& context : contexts_) {
+    context = system_.CreateDefaultContext();
+  }
+  reset_integrators<RungeKutta2Integrator<double>>(step_size_);
+}
+
+void BatchSimulator::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error("BatchSimulator: num_threads must be positive.");
+  }
+  num_threads_ = num_threads;
+}
+
+void BatchSimulator::Initialize() {
+  for (auto& integrator : integrators_) {
+    integrator->set_fixed_step_mode(true);
+    integrator->set_maximum_step_size(step_size_);
+    integrator->Initialize();
+  }
+  initialization_done_ = true;
+}
+
+void BatchSimulator::Step(int num_steps) {
+  if (num_steps < 0) {
+    throw std::logic_error("BatchSimulator: num_steps must be non-negative.");
+  }
+  if (!initialization_done_) Initialize();
+
+  // Each task advances a contiguous block of Contexts through all of the
+  // steps, so that the threading overhead is paid once per call rather than
+  // once per step or per Context, and each thread works on adjacent memory.
+  const int num_tasks = std::min(num_threads_, num_contexts());
+  const int block_size = (num_contexts() + num_tasks - 1) / num_tasks;
+  ParallelFor(num_tasks, num_threads_, [&](int task) {
+    const int begin = task * block_size;
+    const int end = std::min(begin + block_size, num_contexts());
+    for (int i = begin; i < end; ++i) {
+      for (int step = 0; step < num_steps; ++step) {
+        integrators_[i]->IntegrateWithSingleFixedStep(step_size_);
+      }
+    }
+  });
+}
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+/// Advances many Contexts of a single System in lockstep using fixed-step
+/// integration, e.g., to step a batch of identical environments for
+/// reinforcement learning with a single call.
+///
+/// Each Context is paired with its own integrator, and every call to Step()
+/// advances all of the Contexts with the semantics of
+/// IntegratorBase::IntegrateWithSingleFixedStep(): the continuous state and
+/// time of each Context are advanced by exactly get_step_size() per step.
+/// Like IntegrateWithSingleFixedStep(), this does not process any events
+/// (publishes, discrete updates, or unrestricted updates); systems that
+/// require them should be run with a Simulator instead.
+///
+/// The System is shared by all of the Contexts and is never modified; the
+/// Contexts may be advanced concurrently on several threads (see
+/// @ref system_thread_safety "System thread safety"). Since the Contexts are
+/// independent, the results do not depend on the number of threads used.
+///
+/// @code
+///   BatchSimulator batch(*plant, 256 /* num_contexts */, 1e-3 /* dt */);
+///   for (int i = 0; i < batch.num_contexts(); ++i)
+///     batch.get_mutable_context(i).get_mutable_continuous_state_vector()
+///         .SetFromVector(initial_states[i]);
+///   batch.Initialize();
+///   batch.Step(10);  // Advances every Context by 10 steps.
+/// @endcode
+class BatchSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchSimulator)
+
+  /// Constructs the batch, allocating `num_contexts` default Contexts using
+  /// System::CreateDefaultContext(), each advanced by a
+  /// RungeKutta2Integrator. The `system` is aliased, and must outlive this
+  /// object.
+  /// @param system The System to simulate.
+  /// @param num_contexts The number of Contexts; must be positive.
+  /// @param step_size The fixed integration step size; must be positive.
+  /// @throws std::logic_error if `num_contexts` or `step_size` is not
+  ///         positive.
+  BatchSimulator(const System<double>& system, int num_contexts,
+                 double step_size);
+
+  /// Replaces the integrator of each Context with a new one of type `U`,
+  /// constructed as `U(system, args..., context)`. An example usage is:
+  /// @code
+  /// batch.reset_integrators<ExplicitEulerIntegrator<double>>(dt);
+  /// @endcode
+  /// Each integrator is set to fixed step mode with a maximum step size of
+  /// get_step_size(). The batch must be reinitialized after resetting the
+  /// integrators, either explicitly with Initialize() or implicitly by the
+  /// next call to Step().
+  template <class U, typename... Args>
+  void reset_integrators(Args&&... args) {
+    for (size_t i = 0; i < contexts_.size(); ++i) {
+      integrators_[i] = std::make_unique<U>(system_, args...,
+                                            contexts_[i].get());
+    }
+    initialization_done_ = false;
+  }
+
+  /// Prepares the integrators for stepping. Must be called after changing the
+  /// integrators; otherwise it will be called by the first Step().
+  void Initialize();
+
+  /// Advances every Context by `num_steps` fixed steps.
+  /// @throws std::logic_error if `num_steps` is negative.
+  /// @throws std::exception if advancing any Context throws; the first such
+  ///         exception is rethrown once all running threads have finished,
+  ///         at which point the Contexts may have been advanced by differing
+  ///         numbers of steps.
+  void Step(int num_steps = 1);
+
+  /// Returns the number of Contexts in the batch.
+  int num_contexts() const { return static_cast<int>(contexts_.size()); }
+
+  /// Returns the fixed integration step size.
+  double get_step_size() const { return step_size_; }
+
+  /// Sets the maximum number of threads used by Step(). Defaults to
+  /// GetDefaultNumThreads().
+  /// @throws std::logic_error if `num_threads` is not positive.
+  void set_num_threads(int num_threads);
+
+  /// Returns the maximum number of threads used by Step().
+  int get_num_threads() const { return num_threads_; }
+
+  /// Returns the `i`th Context.
+  const Context<double>& get_context(int i) const {
+    return *contexts_.at(i);
+  }
+
+  /// Returns the `i`th Context, which may be modified (e.g., to reset an
+  /// environment) between calls to Step().
+  Context<double>& get_mutable_context(int i) { return *contexts_.at(i); }
+
+  /// Returns the integrator advancing the `i`th Context.
+  const IntegratorBase<double>& get_integrator(int i) const {
+    return *integrators_.at(i);
+  }
+
+ private:
+  const System<double>& system_;
+  const double step_size_{};
+  std::vector<std::unique_ptr<Context<double>>> contexts_;
+  std::vector<std::unique_ptr<IntegratorBase<double>>> integrators_;
+  int num_threads_{1};
+  bool initialization_done_{false};
+};
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -13,6 +13,7 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
@@ -21,13 +22,12 @@ namespace drake {
 namespace systems {
 
 template <class T>
-void ImplicitEulerIntegrator<T>::DoResetStatistics() {
-  num_nr_iterations_ = num_err_est_nr_iterations_ = 0;
+void ImplicitEulerIntegrator<T>::DoResetImplicitIntegratorStatistics() {
+  num_err_est_nr_iterations_ = 0;
   num_err_est_function_evaluations_ = 0;
-  num_jacobian_function_evaluations_ =
-    num_err_est_jacobian_function_evaluations_ = 0;
-  num_jacobian_evaluations_ = num_err_est_jacobian_reforms_ = 0;
-  num_iter_factorizations_ = num_err_est_iter_factorizations_ = 0;
+  num_err_est_jacobian_function_evaluations_ = 0;
+  num_err_est_jacobian_reforms_ = 0;
+  num_err_est_iter_factorizations_ = 0;
 }
 
 template <class T>
@@ -64,342 +64,7 @@ void ImplicitEulerIntegrator<T>::DoInitialize() {
   this->set_accuracy_in_use(working_accuracy);
 
   // Reset the Jacobian matrix (so that recomputation is forced).
-  J_.resize(0, 0);
-}
-
-// Computes the Jacobian of the ordinary differential equations taken with
-// respect to the continuous state (at a point specified by @p state) using
-// automatic differentiation.
-template <>
-MatrixX<AutoDiffXd> ImplicitEulerIntegrator<AutoDiffXd>::
-    ComputeAutoDiffJacobian(const System<AutoDiffXd>&,
-                            const Context<AutoDiffXd>&) {
-        throw std::runtime_error("AutoDiff'd Jacobian not supported from "
-                                     "AutoDiff'd ImplicitEulerIntegrator");
-}
-
-// Computes the Jacobian of the ordinary differential equations taken with
-// respect to the continuous state (at a point specified by @p state) using
-// automatic differentiation.
-// @param system The dynamical system.
-// @param context The context at which to compute the time derivatives.
-// @param state The continuous state at which to compute the time derivatives.
-//              The function can modify this continuous state during the
-//              Jacobian computation.
-// @post The continuous state will be indeterminate on return.
-template <class T>
-MatrixX<T> ImplicitEulerIntegrator<T>::ComputeAutoDiffJacobian(
-    const System<T>& system, const Context<T>& context) {
-  SPDLOG_DEBUG(drake::log(), "  IE Compute Autodiff Jacobian t={}",
-               context.get_time());
-  // Create AutoDiff versions of the state vector.
-  typedef AutoDiffXd Scalar;
-  VectorX<Scalar> a_xtplus = context.get_continuous_state().CopyToVector();
-
-  // Set the size of the derivatives and prepare for Jacobian calculation.
-  const int n_state_dim = a_xtplus.size();
-  for (int i = 0; i < n_state_dim; ++i)
-    a_xtplus[i].derivatives() = VectorX<T>::Unit(n_state_dim, i);
-
-  // Get the system and the context in AutoDiffable format. Inputs must also
-  // be copied to the context used by the AutoDiff'd system (which is
-  // accomplished using FixInputPortsFrom()).
-  // TODO(edrumwri): Investigate means for moving as many of the operations
-  //                 below offline (or with lower frequency than once-per-
-  //                 Jacobian calculation) as is possible. These operations
-  //                 are likely to be expensive.
-  const auto adiff_system = system.ToAutoDiffXd();
-  std::unique_ptr<Context<Scalar>> adiff_context = adiff_system->
-      AllocateContext();
-  adiff_context->SetTimeStateAndParametersFrom(context);
-  adiff_system->FixInputPortsFrom(system, context, adiff_context.get());
-
-  // Set the continuous state in the context.
-  adiff_context->get_mutable_continuous_state().get_mutable_vector().
-      SetFromVector(a_xtplus);
-
-  // Evaluate the derivatives at that state.
-  std::unique_ptr<ContinuousState<Scalar>> derivs =
-      adiff_system->AllocateTimeDerivatives();
-  this->CalcTimeDerivatives(*adiff_system, *adiff_context, derivs.get());
-
-  // Get the Jacobian.
-  auto result = derivs->CopyToVector().eval();
-  return math::autoDiffToGradientMatrix(result);
-}
-
-// Evaluates the ordinary differential equations at the time and state in
-// the system's context (stored by the integrator).
-template <class T>
-VectorX<T> ImplicitEulerIntegrator<T>::CalcTimeDerivativesUsingContext() {
-    this->CalcTimeDerivatives(this->get_context(), derivs_.get());
-    return derivs_->CopyToVector();
-}
-
-// Computes the Jacobian of the ordinary differential equations taken with
-// respect to the continuous state (at a point specified by @p state) using
-// a first-order forward difference (i.e., numerical differentiation).
-// @param system The dynamical system.
-// @param context The context at which to compute the time derivatives.
-// @param state The continuous state at which to compute the time derivatives.
-//              The function can modify this continuous state during the
-//              Jacobian computation.
-// @post The continuous state will be indeterminate on return.
-template <class T>
-MatrixX<T> ImplicitEulerIntegrator<T>::ComputeForwardDiffJacobian(
-    const System<T>&, const Context<T>& context, ContinuousState<T>* state) {
-  using std::abs;
-
-  // Set epsilon to the square root of machine precision.
-  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
-
-  // Get the number of state variables.
-  const int n = state->size();
-
-  // Get the current continuous state.
-  const VectorX<T> xtplus = state->CopyToVector();
-
-  SPDLOG_DEBUG(drake::log(), "  IE Compute Forwarddiff {}-Jacobian t={}",
-               n, context.get_time());
-  SPDLOG_DEBUG(drake::log(), "  computing from state {}", xtplus.transpose());
-
-  // Prevent compiler warnings for context.
-  unused(context);
-
-  // Initialize the Jacobian.
-  MatrixX<T> J(n, n);
-
-  // Evaluate f(t+h,xtplus) for the current state (current xtplus).
-  VectorX<T> f = CalcTimeDerivativesUsingContext();
-
-  // Compute the Jacobian.
-  VectorX<T> xtplus_prime = xtplus;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xtplus| is large, the increment will
-    // be large as well. If |xtplus| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xtplus(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xtplus[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
-      dxi = eps * abs_xi;
-    }
-
-    // Update xtplus', minimizing the effect of roundoff error by ensuring that
-    // x and dx differ by an exactly representable number. See p. 192 of
-    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
-    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xtplus_prime(i) = xtplus(i) + dxi;
-    dxi = xtplus_prime(i) - xtplus(i);
-
-    // Compute f' and set the relevant column of the Jacobian matrix.
-    state->SetFromVector(xtplus_prime);
-    J.col(i) = (CalcTimeDerivativesUsingContext() - f) / dxi;
-
-    // Reset xtplus' to xtplus.
-    xtplus_prime(i) = xtplus(i);
-  }
-
-  return J;
-}
-
-// Computes the Jacobian of the ordinary differential equations taken with
-// respect to the continuous state (at a point specified by @p state) using
-// a second-order central difference (i.e., numerical differentiation).
-// @param system The dynamical system.
-// @param context The context at which to compute the time derivatives.
-// @param state The continuous state at which to compute the time derivatives.
-//              The function can modify this continuous state during the
-//              Jacobian computation.
-// @post The continuous state will be indeterminate on return.
-template <class T>
-MatrixX<T> ImplicitEulerIntegrator<T>::ComputeCentralDiffJacobian(
-    const System<T>&, const Context<T>& context, ContinuousState<T>* state) {
-  using std::abs;
-
-  // Cube root of machine precision (indicated by theory) seems a bit coarse.
-  // Pick power of eps halfway between 6/12 (i.e., 1/2) and 4/12 (i.e., 1/3).
-  const double eps = std::pow(std::numeric_limits<double>::epsilon(), 5.0/12);
-
-  // Get the number of state variables.
-  const int n = state->size();
-
-  SPDLOG_DEBUG(drake::log(), "  IE Compute Centraldiff {}-Jacobian t={}",
-               n, context.get_time());
-
-  // Prevent compiler warnings for context.
-  unused(context);
-
-  // Initialize the Jacobian.
-  MatrixX<T> J(n, n);
-
-  // Get the current continuous state.
-  const VectorX<T> xtplus = state->CopyToVector();
-
-  // Compute the Jacobian.
-  VectorX<T> xtplus_prime = xtplus;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xtplus| is large, the increment will
-    // be large as well. If |xtplus| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xtplus(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xtplus[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
-      dxi = eps * abs_xi;
-    }
-
-    // Update xtplus', minimizing the effect of roundoff error, by ensuring that
-    // x and dx differ by an exactly representable number. See p. 192 of
-    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
-    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xtplus_prime(i) = xtplus(i) + dxi;
-    const T dxi_plus = xtplus_prime(i) - xtplus(i);
-
-    // Compute f(x+dx).
-    state->SetFromVector(xtplus_prime);
-    VectorX<T> fprime_plus = CalcTimeDerivativesUsingContext();
-
-    // Update xtplus' again, minimizing the effect of roundoff error.
-    xtplus_prime(i) = xtplus(i) - dxi;
-    const T dxi_minus = xtplus(i) - xtplus_prime(i);
-
-    // Compute f(x-dx).
-    state->SetFromVector(xtplus_prime);
-    VectorX<T> fprime_minus = CalcTimeDerivativesUsingContext();
-
-    // Set the Jacobian column.
-    J.col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
-
-    // Reset xtplus' to xtplus.
-    xtplus_prime(i) = xtplus(i);
-  }
-
-  return J;
-}
-
-// Factors a dense matrix (the negated iteration matrix) using LU factorization,
-// which should be faster than the QR factorization used in the specialized
-// template method immediately below.
-template <class T>
-void ImplicitEulerIntegrator<T>::Factor(const MatrixX<T>& A) {
-  num_iter_factorizations_++;
-  LU_.compute(A);
-}
-
-// Factors a dense matrix (the negated iteration matrix). This
-// AutoDiff-specialized method is necessary because Eigen's LU factorization,
-// which should be faster than the QR factorization used here, is not currently
-// AutoDiff-able (while the QR factorization *is* AutoDiff-able).
-template <>
-void ImplicitEulerIntegrator<AutoDiffXd>::Factor(
-    const MatrixX<AutoDiffXd>& A) {
-  num_iter_factorizations_++;
-  QR_.compute(A);
-}
-
-// Solves a linear system Ax = b for x using a negated iteration matrix (A)
-// factored using LU decomposition.
-// @sa Factor()
-template <class T>
-VectorX<T> ImplicitEulerIntegrator<T>::Solve(const VectorX<T>& b) const {
-  return LU_.solve(b);
-}
-
-// Solves the linear system Ax = b for x using a negated iteration matrix (A)
-// factored using QR decomposition.
-// @sa Factor()
-template <>
-VectorX<AutoDiffXd> ImplicitEulerIntegrator<AutoDiffXd>::Solve(
-    const VectorX<AutoDiffXd>& b) const {
-  return QR_.solve(b);
-}
-
-// Checks to see whether a Jacobian matrix has "become bad" and needs to be
-// refactorized.
-template <class T>
-bool ImplicitEulerIntegrator<T>::IsBadJacobian(const MatrixX<T>& J) const {
-  return !J.allFinite();
-}
-
-// Computes any necessary matrices for the Newton-Raphson iteration in
-// StepAbstract(). Parameters are identical to those for StepAbstract;
-// @see StepAbstract() for their documentation.
-// @returns `false` if the calling StepAbstract method should indicate failure;
-//          `true` otherwise.
-template <class T>
-bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
-                                              int scale,
-                                              const VectorX<T>& xtplus,
-                                              int trial) {
-  // Compute the initial Jacobian and negated iteration matrices (see
-  // rationale for the negation below) and factor them, if necessary.
-  if (!reuse_ || J_.rows() == 0 || IsBadJacobian(J_)) {
-    // Note that the Jacobian can become bad through a divergent Newton-Raphson
-    // iteration, which causes the state to overflow, which then causes the
-    // Jacobian to overflow. If the state overflows, recomputing the Jacobian
-    // using this bad state will result in another bad Jacobian, eventually
-    // causing DoStep() to return indicating failure (but not before resetting
-    // the continuous state to its previous, good value). DoStep() will then
-    // be called again with a smaller step size and the good state; the
-    // bad Jacobian will then be corrected.
-    J_ = CalcJacobian(tf, xtplus);
-    const int n = xtplus.size();
-    neg_iteration_matrix_ = J_ * (dt / scale) - MatrixX<T>::Identity(n, n);
-    Factor(neg_iteration_matrix_);
-    return true;
-  }
-
-  switch (trial) {
-    case 1:
-      // For the first trial, we do nothing special.
-      return true;
-
-    case 2: {
-      // For the second trial, re-construct and factor the iteration matrix.
-      const int n = xtplus.size();
-      neg_iteration_matrix_ = J_ * (dt / scale) - MatrixX<T>::Identity(n, n);
-      Factor(neg_iteration_matrix_);
-      return true;
-    }
-
-    case 3: {
-      // If the last call to StepAbstract() ended in failure, we know that
-      // the Jacobian matrix is fresh and the iteration matrix has been newly
-      // formed and factored (on Trial #2), so there is nothing more to be
-      // done.
-      if (last_call_failed_) {
-        return false;
-      } else {
-        // Reform the Jacobian matrix and refactor the negation of
-        // the iteration matrix. The idea of using the negation of this matrix
-        // is that an O(n^2) subtraction is not necessary as would
-        // be the case with MatrixX<T>::Identity(n, n) - J * (dt / scale).
-        J_ = CalcJacobian(tf, xtplus);
-        const int n = xtplus.size();
-        neg_iteration_matrix_ = J_ * (dt / scale) -
-            MatrixX<T>::Identity(n, n);
-        Factor(neg_iteration_matrix_);
-      }
-      return true;
-
-      case 4: {
-        // Trial #4 indicates failure.
-        return false;
-      }
-
-      default:
-        DRAKE_ABORT_MSG("Unexpected trial number.");
-    }
-  }
+  this->reset_jacobian();
 }
 
 // Performs the bulk of the stepping computation for both implicit Euler and
@@ -461,8 +126,20 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
   T last_dx_norm = std::numeric_limits<double>::infinity();
 
   // Calculate Jacobian and iteration matrices (and factorizations), as needed.
-  if (!CalcMatrices(tf, dt, scale, *xtplus, trial)) {
-    last_call_failed_ = true;
+  // The iteration matrix is formed using the Runge-Kutta matrix [1] (implicit
+  // Euler) or [1/2] (the implicit trapezoid method, with the f(t,x(t)) term
+  // moved to the residual).
+  const auto compute_and_factor_iteration_matrix =
+      [this, dt, scale](const MatrixX<T>& J,
+          typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+        this->ComputeAndFactorIterationMatrix(
+            J, Eigen::MatrixXd::Constant(1, 1, 1.0), dt / scale,
+            iteration_matrix);
+      };
+  if (!this->MaybeFreshenMatrices(tf, *xtplus, trial,
+                                  compute_and_factor_iteration_matrix,
+                                  &iteration_matrix_)) {
+    this->set_last_call_failed(true);
     return false;
   }
 
@@ -478,13 +155,13 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
   // Do the Newton-Raphson iterations.
   for (int i = 0; i < max_iterations; ++i) {
     // Update the number of Newton-Raphson iterations.
-    num_nr_iterations_++;
+    this->increment_num_newton_raphson_iterations();
 
     // Compute the state update using the equation A*x = -g(), where A is the
     // iteration matrix. Using nA as the negation of the iteration matrix, we
     // instead solve nA*x = g().
     // TODO(edrumwri): Allow caller to provide their own solver.
-    VectorX<T> dx = Solve(goutput);
+    VectorX<T> dx = iteration_matrix_.Solve(goutput);
 
     // Get the infinity norm of the weighted update vector.
     dx_state_->get_mutable_vector().SetFromVector(dx);
@@ -493,47 +170,19 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
     // Update the state vector.
     *xtplus += dx;
 
-    // The check below looks for convergence using machine epsilon. Without
-    // this check, the convergence criteria can be applied when
-    // |dx_norm| ~ 1e-22 (one example taken from practice), which does not
-    // allow the norm to be reduced further. What happens: dx_norm will become
-    // equivalent to last_dx_norm, making theta = 1, and eta = infinity. Thus,
-    // convergence would never be identified.
-    if (dx_norm < 10 * std::numeric_limits<double>::epsilon()) {
+    // Check for Newton-Raphson convergence.
+    const typename ImplicitIntegrator<T>::ConvergenceStatus status =
+        this->CheckNewtonConvergence(i, dx_norm, last_dx_norm);
+    if (status == ImplicitIntegrator<T>::ConvergenceStatus::kConverged) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson converged for h = {}", dt);
       context->get_mutable_continuous_state().SetFromVector(*xtplus);
-      last_call_failed_ = false;
+      this->set_last_call_failed(false);
       return true;
     }
-
-    // Compute the convergence rate and check convergence.
-    // [Hairer, 1996] notes that this convergence strategy should only be
-    // applied after *at least* two iterations (p. 121).
-    if (i >= 1) {
-      const T theta = dx_norm / last_dx_norm;
-      const T eta = theta / (1 - theta);
-      SPDLOG_DEBUG(drake::log(), "Newton-Raphson loop {} theta: {}, eta: {}",
-                   i, theta, eta);
-
-      // Look for divergence.
-      if (theta > 1) {
-        SPDLOG_DEBUG(drake::log(), "Newton-Raphson divergence detected for "
-            "h={}", dt);
-        break;
-      }
-
-      // Look for convergence using Equation 8.10 from [Hairer, 1996].
-      // [Hairer, 1996] determined values of kappa in [0.01, 0.1] work most
-      // efficiently on a number of test problems with *RADAU5* (a fifth order
-      // implicit integrator), p. 121. We select a value halfway in-between.
-      const double kappa = 0.05;
-      const double k_dot_tol = kappa * this->get_accuracy_in_use();
-      if (eta * dx_norm < k_dot_tol) {
-        SPDLOG_DEBUG(drake::log(), "Newton-Raphson converged; η = {}, h = {}",
-                     eta, dt);
-        context->get_mutable_continuous_state().SetFromVector(*xtplus);
-        last_call_failed_ = false;
-        return true;
-      }
+    if (status == ImplicitIntegrator<T>::ConvergenceStatus::kDiverged) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson divergence detected for "
+          "h={}", dt);
+      break;
     }
 
     // Update the norm of the state update.
@@ -548,8 +197,8 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
 
   // If Jacobian and iteration matrix factorizations are not reused, there
   // is nothing else we can try.
-  if (!reuse_) {
-    last_call_failed_ = true;
+  if (!this->get_reuse()) {
+    this->set_last_call_failed(true);
     return false;
   }
 
@@ -577,7 +226,7 @@ bool ImplicitEulerIntegrator<T>::StepImplicitEuler(const T& dt) {
   std::function<VectorX<T>()> g =
       [&xt0, dt, context, this]() {
         return (context->get_continuous_state().CopyToVector() - xt0 -
-            dt*CalcTimeDerivativesUsingContext()).eval();
+            dt*this->CalcTimeDerivativesUsingContext()).eval();
       };
 
   // Use the current state as the candidate value for the next state.
@@ -621,100 +270,43 @@ bool ImplicitEulerIntegrator<T>::StepImplicitTrapezoid(const T& dt,
   std::function<VectorX<T>()> g =
       [&xt0, dt, &dx0, context, this]() {
         return (context->get_continuous_state().CopyToVector() - xt0 -
-            dt/2*(dx0 + CalcTimeDerivativesUsingContext().eval())).eval();
+            dt/2*(dx0 + this->CalcTimeDerivativesUsingContext().eval())).eval();
       };
 
   // Store statistics before calling StepAbstract(). The difference between
   // the modified statistics and the stored statistics will be used to compute
   // the trapezoid method-specific statistics.
-  int stored_num_jacobian_evaluations = num_jacobian_evaluations_;
-  int stored_num_iter_factorizations = num_iter_factorizations_;
+  int64_t stored_num_jacobian_evaluations =
+      this->get_num_jacobian_evaluations();
+  int64_t stored_num_iter_factorizations =
+      this->get_num_iteration_matrix_factorizations();
   int64_t stored_num_function_evaluations =
       this->get_num_derivative_evaluations();
   int64_t stored_num_jacobian_function_evaluations =
-      num_jacobian_function_evaluations_;
-  int stored_num_nr_iterations = num_nr_iterations_;
+      this->get_num_derivative_evaluations_for_jacobian();
+  int64_t stored_num_nr_iterations =
+      this->get_num_newton_raphson_iterations();
 
   // Step.
   bool success = StepAbstract(dt, g, 2, xtplus);
 
   // Move statistics to implicit trapezoid-specific.
   num_err_est_jacobian_reforms_ +=
-      num_jacobian_evaluations_ - stored_num_jacobian_evaluations;
-  num_err_est_iter_factorizations_ += num_iter_factorizations_ -
-      stored_num_iter_factorizations;
+      this->get_num_jacobian_evaluations() - stored_num_jacobian_evaluations;
+  num_err_est_iter_factorizations_ +=
+      this->get_num_iteration_matrix_factorizations() -
+          stored_num_iter_factorizations;
   num_err_est_function_evaluations_ +=
       this->get_num_derivative_evaluations() - stored_num_function_evaluations;
   num_err_est_jacobian_function_evaluations_ +=
-      num_jacobian_function_evaluations_ -
+      this->get_num_derivative_evaluations_for_jacobian() -
           stored_num_jacobian_function_evaluations;
-  num_err_est_nr_iterations_ += num_nr_iterations_ - stored_num_nr_iterations;
+  num_err_est_nr_iterations_ += this->get_num_newton_raphson_iterations() -
+      stored_num_nr_iterations;
 
   return success;
 }
 
-// Compute the partial derivative of the ordinary differential equations with
-// respect to the state variables for a given x(t).
-// @post the context's time and continuous state will be temporarily set during
-//       this call (and then reset to their original values) on return.
-template <class T>
-MatrixX<T> ImplicitEulerIntegrator<T>::CalcJacobian(const T& t,
-                                                    const VectorX<T>& x) {
-  // We change the context but will change it back.
-  Context<T>* context = this->get_mutable_context();
-
-  // Get the current time and state.
-  T t_current = context->get_time();
-  const VectorX<T> x_current = context->get_continuous_state_vector().
-      CopyToVector();
-
-  // Update the time and state.
-  context->set_time(t);
-  context->get_mutable_continuous_state_vector().SetFromVector(x);
-  num_jacobian_evaluations_++;
-
-  // Get the current number of ODE evaluations.
-  int64_t current_ODE_evals = this->get_num_derivative_evaluations();
-
-  // Get a the system.
-  const System<T>& system = this->get_system();
-
-  // Get the mutable continuous state.
-  ContinuousState<T>& continuous_state = context->
-      get_mutable_continuous_state();
-
-  // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-  MatrixX<T> J;
-  switch (jacobian_scheme_) {
-    case JacobianComputationScheme::kForwardDifference:
-      J = ComputeForwardDiffJacobian(system, *context, &continuous_state);
-      break;
-
-    case JacobianComputationScheme::kCentralDifference:
-      J = ComputeCentralDiffJacobian(system, *context, &continuous_state);
-      break;
-
-    case JacobianComputationScheme::kAutomatic:
-      J = ComputeAutoDiffJacobian(system, *context);
-      break;
-
-    default:
-      // Should never get here.
-      DRAKE_ABORT();
-  }
-
-  // Use the new number of ODE evaluations to determine the number of Jacobian
-  // evaluations.
-  num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
-      - current_ODE_evals;
-
-  // Reset the time and state.
-  context->set_time(t_current);
-  continuous_state.SetFromVector(x_current);
-
-  return J;
-}
-
 // Steps both implicit Euler and implicit trapezoid forward by dt, if possible.
 // @param dt the integration step size to attempt.
 // @param [out] xtplus_ie contains the Euler integrator solution on return
@@ -745,7 +337,7 @@ bool ImplicitEulerIntegrator<T>::AttemptStepPaired(const T& dt,
   // point (early on in the integration process) in order to reuse the
   // derivative evaluation, via the cache, from the last integration step (if
   // possible).
-  const VectorX<T> dx0 = CalcTimeDerivativesUsingContext();
+  const VectorX<T> dx0 = this->CalcTimeDerivativesUsingContext();
 
   // Do the Euler step.
   if (!StepImplicitEuler(dt)) {
@@ -844,20 +436,19 @@ bool ImplicitEulerIntegrator<T>::DoStep(const T& dt) {
     // in the algebra when arriving at the final equation is inconsequential).
 
     // Compute the Euler step.
-    this->CalcTimeDerivatives(*context, derivs_.get());
-    xtplus_ie = xt0 + dt*derivs_->CopyToVector();
+    const VectorX<T> dx0 = this->CalcTimeDerivativesUsingContext();
+    xtplus_ie = xt0 + dt*dx0;
 
     // Do one half step.
     context->get_mutable_continuous_state().SetFromVector(
-        xt0 + half_dt*derivs_->CopyToVector());
+        xt0 + half_dt*dx0);
     context->set_time(t0 + half_dt);
 
     // Do another half step.
     const VectorX<T> xtpoint5 = context->get_continuous_state_vector().
         CopyToVector();
-    this->CalcTimeDerivatives(*context, derivs_.get());
     context->get_mutable_continuous_state().SetFromVector(
-        xtpoint5 + half_dt*derivs_->CopyToVector());
+        xtpoint5 + half_dt*this->CalcTimeDerivativesUsingContext());
     context->set_time(t0 + dt);
 
     // Update the error estimation ODE counts.
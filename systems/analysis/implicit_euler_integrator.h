@@ -3,12 +3,10 @@
 #include <limits>
 #include <memory>
 #include <utility>
-
-#include <Eigen/LU>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
-#include "drake/math/autodiff_gradient.h"
-#include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/implicit_integrator.h"
 
 namespace drake {
 namespace systems {
@@ -66,7 +64,10 @@ namespace systems {
  * process, though the complexity to form the Jacobian matrix is still `O(n²)`.
  * For large `n`, the time complexity may be dominated by the `O(n³)` time
  * required to (repeatedly) solve linear systems problems as part of the
- * nonlinear system solution process.
+ * nonlinear system solution process. When the Jacobian matrix is sparse, as is
+ * typical for systems with many weakly coupled state variables, the
+ * JacobianComputationScheme::kColoredForwardDifference scheme reduces both
+ * costs: see set_jacobian_sparsity_pattern().
  *
  * This implementation uses Newton-Raphson (NR) and relies upon the obvious
  * convergence to a solution for `g = 0` where
@@ -82,7 +83,7 @@ namespace systems {
  *                    Equations. John Wiley & Sons, 1991.
  */
 template <class T>
-class ImplicitEulerIntegrator final : public IntegratorBase<T> {
+class ImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImplicitEulerIntegrator)
 
@@ -90,73 +91,7 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
 
   explicit ImplicitEulerIntegrator(const System<T>& system,
                                    Context<T>* context = nullptr)
-      : IntegratorBase<T>(system, context) {
-    derivs_ = system.AllocateTimeDerivatives();
-  }
-
-  /// Selecting the wrong such Jacobian determination scheme will slow (possibly
-  /// critically) the implicit integration process. Automatic differentiation is
-  /// recommended if the System supports it for reasons of both higher
-  /// accuracy and increased speed. Forward differencing (i.e., numerical
-  /// differentiation) exhibits error in the approximation close to √ε, where
-  /// ε is machine epsilon, from n forward dynamics calls (where n is the number
-  /// of state variables). Central differencing yields the most accurate
-  /// numerically differentiated Jacobian matrix, but expends double the
-  /// computational effort for approximately three digits greater accuracy: the
-  /// total error in the central-difference approximation is close to ε^(2/3),
-  /// from 2n forward dynamics calls. See [Nocedal 2004, pp. 167-169].
-  ///
-  /// - [Nocedal 2004] J. Nocedal and S. Wright. Numerical Optimization.
-  ///                  Springer, 2004.
-  enum class JacobianComputationScheme {
-    /// O(h) Forward differencing.
-    kForwardDifference,
-
-    /// O(h²) Central differencing.
-    kCentralDifference,
-
-    /// Automatic differentiation.
-    kAutomatic
-  };
-
-  /// @name Methods for getting and setting the Jacobian scheme.
-  ///
-  /// Methods for getting and setting the scheme used to determine the
-  /// Jacobian matrix necessary for solving the requisite nonlinear system
-  /// if equations.
-  /// @see JacobianComputationScheme
-  /// @{
-
-  /// Sets whether the integrator attempts to reuse Jacobian matrices and
-  /// iteration matrix factorizations (default is `true`). Forming Jacobian
-  /// matrices and factorizing iteration matrices are generally the two most
-  /// expensive operations performed by this integrator. For small systems
-  /// (those with on the order of ten state variables), the additional accuracy
-  /// that using fresh Jacobians and factorizations buys- which can permit
-  /// increased step sizes but should have no effect on solution accuracy- can
-  /// outweigh the small factorization cost.
-  /// @sa get_reuse
-  void set_reuse(bool reuse) { reuse_ = reuse; }
-
-  /// Gets whether the integrator attempts to reuse Jacobian matrices and
-  /// iteration matrix factorizations.
-  /// @sa set_reuse()
-  bool get_reuse() const { return reuse_; }
-
-  /// Sets the Jacobian computation scheme. This function can be safely called
-  /// at any time (i.e., the integrator need not be re-initialized afterward).
-  /// @note Discards any already-computed Jacobian matrices if the scheme
-  ///       changes.
-  void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
-    if (jacobian_scheme_ != scheme)
-      J_.resize(0, 0);
-    jacobian_scheme_ = scheme;
-  }
-
-  JacobianComputationScheme get_jacobian_computation_scheme() const {
-    return jacobian_scheme_;
-  }
-  /// @}
+      : ImplicitIntegrator<T>(system, context) {}
 
   /// The integrator supports error estimation.
   bool supports_error_estimation() const override { return true; }
@@ -164,9 +99,11 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   /// This integrator provides second order error estimates.
   int get_error_estimate_order() const override { return 2; }
 
-  /// @name Cumulative statistics functions.
-  /// The functions return statistics specific to the implicit integration
-  /// process.
+  /// @name Error-estimation statistics functions.
+  /// The functions return statistics specific to the error estimation
+  /// process. The cumulative statistics of ImplicitIntegrator (e.g.,
+  /// get_num_newton_raphson_iterations()) include those of the error
+  /// estimation process.
   /// @{
 
   /// Gets the number of ODE function evaluations
@@ -179,44 +116,6 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
     return num_err_est_function_evaluations_;
   }
 
-  /// Gets the number of ODE function evaluations
-  /// (calls to CalcTimeDerivatives()) *used only for computing
-  /// the Jacobian matrices* since the last call to ResetStatistics(). This
-  /// count includes those derivative calculations necessary for computing
-  /// Jacobian matrices during the error estimation process.
-  int64_t get_num_derivative_evaluations_for_jacobian() const {
-    return num_jacobian_function_evaluations_;
-  }
-
-  /// Gets the number of iterations used in the Newton-Raphson nonlinear systems
-  /// of equation solving process since the last call to ResetStatistics(). This
-  /// count includes those Newton-Raphson iterations used during the error
-  /// estimation process.
-  int64_t get_num_newton_raphson_iterations() const {
-    return num_nr_iterations_;
-  }
-
-  /// Gets the number of Jacobian evaluations (i.e., the number of times
-  /// that the Jacobian matrix was reformed) since the last call to
-  /// ResetStatistics(). This count includes those evaluations necessary
-  /// during the error estimation process.
-  int64_t get_num_jacobian_evaluations() const { return
-        num_jacobian_evaluations_;
-  }
-
-  /// Gets the number of factorizations of the iteration matrix since the last
-  /// call to ResetStatistics(). This count includes those refactorizations
-  /// necessary during the error estimation process.
-  int64_t get_num_iteration_matrix_factorizations() const {
-    return num_iter_factorizations_;
-  }
-
-  /// @}
-
-  /// @name Error-estimation statistics functions.
-  /// The functions return statistics specific to the error estimation
-  /// process.
-  /// @{
   /// Gets the number of ODE function evaluations (calls to
   /// CalcTimeDerivatives()) *used only for computing the Jacobian matrices
   /// needed by the error estimation process* since the last call to
@@ -248,91 +147,30 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   /// @}
 
  private:
-  bool IsBadJacobian(const MatrixX<T>& J) const;
   void DoInitialize() override;
-  void DoResetStatistics() override;
-  void Factor(const MatrixX<T>& A);
-  VectorX<T> Solve(const VectorX<T>& rhs) const;
+  void DoResetImplicitIntegratorStatistics() override;
   bool AttemptStepPaired(const T& dt, VectorX<T>* xtplus_euler,
                          VectorX<T>* xtplus_trap);
   bool StepAbstract(const T& dt,
                     const std::function<VectorX<T>()>& g,
                     int scale,
                     VectorX<T>* xtplus, int trial = 1);
-  bool CalcMatrices(const T& tf, const T& dt, int scale,
-                    const VectorX<T>& xtplus, int trial);
-  MatrixX<T> CalcJacobian(const T& tf, const VectorX<T>& xtplus);
   bool DoStep(const T& dt) override;
   bool StepImplicitEuler(const T& dt);
   bool StepImplicitTrapezoid(const T& dt, const VectorX<T>& dx0,
                              VectorX<T>* xtplus);
-  MatrixX<T> ComputeForwardDiffJacobian(const System<T>&,
-                                        const Context<T>&,
-                                        ContinuousState<T>* state);
-  MatrixX<T> ComputeCentralDiffJacobian(const System<T>&,
-                                        const Context<T>&,
-                                        ContinuousState<T>* state);
-  MatrixX<T> ComputeAutoDiffJacobian(const System<T>& system,
-                                     const Context<T>& context);
-  VectorX<T> CalcTimeDerivativesUsingContext();
-
-  // This is a pre-allocated temporary for use by integration. It stores
-  // the derivatives computed at x(t+h).
-  std::unique_ptr<ContinuousState<T>> derivs_;
-
-  // A simple LU factorization is all that is needed; robustness in the solve
-  // comes naturally as dt << 1. Keeping this data in the class definition
-  // serves to minimize heap allocations and deallocations.
-  Eigen::PartialPivLU<MatrixX<double>> LU_;
-
-  // A QR factorization is necessary for automatic differentiation (current
-  // Eigen requirement).
-  Eigen::HouseholderQR<MatrixX<AutoDiffXd>> QR_;
 
   // Vector used in error estimate calculations.
   VectorX<T> err_est_vec_;
 
-  // The pseudo-inverse of the matrix that converts time derivatives of
-  // generalized coordinates to generalized velocities, multiplied by the
-  // change in the generalized coordinates (used in update check tolerance
-  // calculations).
-  std::unique_ptr<VectorBase<T>> pinvN_ddq_;
-
-  // Vectors used in update check tolerance calculations.
-  VectorX<T> unweighted_delta_;
-  std::unique_ptr<VectorBase<T>> weighted_dq_;
-
   // The continuous state update vector used during Newton-Raphson.
   std::unique_ptr<ContinuousState<T>> dx_state_;
 
-  // The scheme to be used for computing the Jacobian matrix during the
-  // nonlinear system solve process.
-  JacobianComputationScheme jacobian_scheme_{
-      JacobianComputationScheme::kForwardDifference};
-
-  // The last computed Jacobian matrix. Keeping this data in the class
-  // definitions serves to minimize heap allocations and deallocations.
-  MatrixX<T> J_;
-
-  // The last computed *negation* of the "iteration matrix", equivalent to
-  // J_ * (dt / scale) - 1, where scale is either 1.0 or 2.0, depending on
-  // whether the implicit Euler or implicit trapezoid method was used. Keeping
-  // this data in the class definition serves to minimize heap allocations
-  // and deallocations.
-  MatrixX<T> neg_iteration_matrix_;
-
-  // Whether the last call to StepAbstract() was a failure.
-  bool last_call_failed_{false};
-
-  // If set to `false`, Jacobian matrices and iteration matrix factorizations
-  // will not be reused.
-  bool reuse_{true};
-
-  // Various combined statistics.
-  int64_t num_jacobian_evaluations_{0};
-  int64_t num_iter_factorizations_{0};
-  int64_t num_jacobian_function_evaluations_{0};
-  int64_t num_nr_iterations_{0};
+  // The factorization of the last computed *negation* of the "iteration
+  // matrix", equivalent to J * (dt / scale) - 1, where scale is either 1.0 or
+  // 2.0, depending on whether the implicit Euler or implicit trapezoid method
+  // was used.
+  typename ImplicitIntegrator<T>::IterationMatrix iteration_matrix_;
 
   // Implicit trapezoid specific statistics.
   int64_t num_err_est_jacobian_reforms_{0};
@@ -0,0 +1,672 @@
+#pragma once
+
+/// @file
+/// Template method implementations for implicit_integrator.h.
+/// Most users should only include that file, not this one.
+/// For background, see http://drake.mit.edu/cxx_inl.html.
+
+/* clang-format off to disable clang-format-includes */
+#include "drake/systems/analysis/implicit_integrator.h"
+/* clang-format on */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "drake/common/text_logging.h"
+#include "drake/math/autodiff.h"
+
+namespace drake {
+namespace systems {
+
+template <class T>
+void ImplicitIntegrator<T>::DoResetStatistics() {
+  num_nr_iterations_ = 0;
+  num_jacobian_function_evaluations_ = 0;
+  num_jacobian_evaluations_ = 0;
+  num_iter_factorizations_ = 0;
+  DoResetImplicitIntegratorStatistics();
+}
+
+template <class T>
+void ImplicitIntegrator<T>::set_jacobian_sparsity_pattern(
+    const Eigen::SparseMatrix<double>& pattern) {
+  if (pattern.rows() != pattern.cols())
+    throw std::logic_error("The Jacobian sparsity pattern must be square.");
+  jacobian_sparsity_ = pattern;
+  jacobian_sparsity_.makeCompressed();
+  J_.resize(0, 0);
+
+  // Greedily partition the columns into groups such that no two columns in
+  // the same group have a nonzero entry in the same row (i.e., color the
+  // column intersection graph).
+  const int n = jacobian_sparsity_.cols();
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> rows = jacobian_sparsity_;
+  std::vector<int> group_of(n, -1);
+
+  // The groups unavailable to column j are marked with the value j.
+  std::vector<int> unavailable(n, -1);
+  column_groups_.clear();
+  for (int j = 0; j < n; ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(jacobian_sparsity_, j);
+         it; ++it) {
+      for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator
+               jt(rows, it.row()); jt; ++jt) {
+        const int group = group_of[jt.col()];
+        if (group >= 0) unavailable[group] = j;
+      }
+    }
+    int group = 0;
+    while (group < static_cast<int>(column_groups_.size()) &&
+           unavailable[group] == j) {
+      ++group;
+    }
+    if (group == static_cast<int>(column_groups_.size()))
+      column_groups_.emplace_back();
+    column_groups_[group].push_back(j);
+    group_of[j] = group;
+  }
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state (at a point specified by @p state) using
+// automatic differentiation.
+template <>
+MatrixX<AutoDiffXd> ImplicitIntegrator<AutoDiffXd>::
+    ComputeAutoDiffJacobian(const System<AutoDiffXd>&,
+                            const Context<AutoDiffXd>&) {
+        throw std::runtime_error("AutoDiff'd Jacobian not supported from "
+                                     "AutoDiff'd ImplicitIntegrator");
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state (at a point specified by @p state) using
+// automatic differentiation.
+// @param system The dynamical system.
+// @param context The context at which to compute the time derivatives.
+// @param state The continuous state at which to compute the time derivatives.
+//              The function can modify this continuous state during the
+//              Jacobian computation.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+MatrixX<T> ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
+    const System<T>& system, const Context<T>& context) {
+  SPDLOG_DEBUG(drake::log(), "  ImplicitIntegrator Compute Autodiff Jacobian "
+               "t={}", context.get_time());
+  // Create AutoDiff versions of the state vector.
+  typedef AutoDiffXd Scalar;
+  VectorX<Scalar> a_xtplus = context.get_continuous_state().CopyToVector();
+
+  // Set the size of the derivatives and prepare for Jacobian calculation.
+  const int n_state_dim = a_xtplus.size();
+  for (int i = 0; i < n_state_dim; ++i)
+    a_xtplus[i].derivatives() = VectorX<T>::Unit(n_state_dim, i);
+
+  // Get the system and the context in AutoDiffable format. Inputs must also
+  // be copied to the context used by the AutoDiff'd system (which is
+  // accomplished using FixInputPortsFrom()).
+  // The converted system is shared across Jacobian calculations.
+  // TODO(edrumwri): Investigate means for moving as many of the remaining
+  //                 operations below offline (or with lower frequency than
+  //                 once-per-Jacobian calculation) as is possible.
+  const System<Scalar>& adiff_system = system.GetOrCreateAutoDiffXd();
+  std::unique_ptr<Context<Scalar>> adiff_context =
+      adiff_system.AllocateContext();
+  adiff_context->SetTimeStateAndParametersFrom(context);
+  adiff_system.FixInputPortsFrom(system, context, adiff_context.get());
+
+  // Set the continuous state in the context.
+  adiff_context->get_mutable_continuous_state().get_mutable_vector().
+      SetFromVector(a_xtplus);
+
+  // Evaluate the derivatives at that state.
+  std::unique_ptr<ContinuousState<Scalar>> derivs =
+      adiff_system.AllocateTimeDerivatives();
+  this->CalcTimeDerivatives(adiff_system, *adiff_context, derivs.get());
+
+  // Get the Jacobian.
+  auto result = derivs->CopyToVector().eval();
+  return math::autoDiffToGradientMatrix(result);
+}
+
+// Evaluates the ordinary differential equations at the time and state in
+// the system's context (stored by the integrator).
+template <class T>
+VectorX<T> ImplicitIntegrator<T>::CalcTimeDerivativesUsingContext() {
+    this->CalcTimeDerivatives(this->get_context(), derivs_.get());
+    return derivs_->CopyToVector();
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state (at a point specified by @p state) using
+// a first-order forward difference (i.e., numerical differentiation).
+// @param system The dynamical system.
+// @param context The context at which to compute the time derivatives.
+// @param state The continuous state at which to compute the time derivatives.
+//              The function can modify this continuous state during the
+//              Jacobian computation.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+MatrixX<T> ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
+    const System<T>&, const Context<T>& context, ContinuousState<T>* state) {
+  using std::abs;
+
+  // Set epsilon to the square root of machine precision.
+  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+  // Get the number of state variables.
+  const int n = state->size();
+
+  // Get the current continuous state.
+  const VectorX<T> xtplus = state->CopyToVector();
+
+  SPDLOG_DEBUG(drake::log(), "  ImplicitIntegrator Compute Forwarddiff "
+               "{}-Jacobian t={}", n, context.get_time());
+  SPDLOG_DEBUG(drake::log(), "  computing from state {}", xtplus.transpose());
+
+  // Prevent compiler warnings for context.
+  unused(context);
+
+  // Initialize the Jacobian.
+  MatrixX<T> J(n, n);
+
+  // Evaluate f(t+h,xtplus) for the current state (current xtplus).
+  VectorX<T> f = CalcTimeDerivativesUsingContext();
+
+  // Compute the Jacobian.
+  VectorX<T> xtplus_prime = xtplus;
+  for (int i = 0; i < n; ++i) {
+    // Compute a good increment to the dimension using approximately 1/eps
+    // digits of precision. Note that if |xtplus| is large, the increment will
+    // be large as well. If |xtplus| is small, the increment will be no smaller
+    // than eps.
+    const T abs_xi = abs(xtplus(i));
+    T dxi(abs_xi);
+    if (dxi <= 1) {
+      // When |xtplus[i]| is small, increment will be eps.
+      dxi = eps;
+    } else {
+      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
+      dxi = eps * abs_xi;
+    }
+
+    // Update xtplus', minimizing the effect of roundoff error by ensuring that
+    // x and dx differ by an exactly representable number. See p. 192 of
+    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
+    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+    xtplus_prime(i) = xtplus(i) + dxi;
+    dxi = xtplus_prime(i) - xtplus(i);
+
+    // Compute f' and set the relevant column of the Jacobian matrix.
+    state->SetFromVector(xtplus_prime);
+    J.col(i) = (CalcTimeDerivativesUsingContext() - f) / dxi;
+
+    // Reset xtplus' to xtplus.
+    xtplus_prime(i) = xtplus(i);
+  }
+
+  return J;
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state (at a point specified by @p state) using
+// a first-order forward difference that perturbs all columns in each group
+// of structurally orthogonal columns at once. The sparsity pattern is detected
+// from a standard forward difference Jacobian if it has not yet been set.
+// @param system The dynamical system.
+// @param context The context at which to compute the time derivatives.
+// @param state The continuous state at which to compute the time derivatives.
+//              The function can modify this continuous state during the
+//              Jacobian computation.
+// @post The continuous state will be indeterminate on return.
+// @throws std::logic_error if the size of the sparsity pattern does not match
+//         the number of state variables.
+template <class T>
+MatrixX<T> ImplicitIntegrator<T>::ComputeColoredForwardDiffJacobian(
+    const System<T>& system, const Context<T>& context,
+    ContinuousState<T>* state) {
+  using std::abs;
+
+  // Get the number of state variables.
+  const int n = state->size();
+
+  if (jacobian_sparsity_.rows() == 0) {
+    MatrixX<T> J = ComputeForwardDiffJacobian(system, context, state);
+    std::vector<Eigen::Triplet<double>> nonzeros;
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        if (J(i, j) != 0.0) nonzeros.emplace_back(i, j, 1.0);
+      }
+    }
+    Eigen::SparseMatrix<double> pattern(n, n);
+    pattern.setFromTriplets(nonzeros.begin(), nonzeros.end());
+    set_jacobian_sparsity_pattern(pattern);
+    return J;
+  }
+  if (jacobian_sparsity_.rows() != n) {
+    throw std::logic_error("The Jacobian sparsity pattern does not match the "
+                           "number of state variables.");
+  }
+
+  // Set epsilon to the square root of machine precision.
+  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+  // Get the current continuous state.
+  const VectorX<T> xtplus = state->CopyToVector();
+
+  SPDLOG_DEBUG(drake::log(), "  ImplicitIntegrator Compute Colored Forwarddiff "
+               "{}-Jacobian ({} groups) t={}", n, column_groups_.size(),
+               context.get_time());
+
+  // Initialize the Jacobian.
+  MatrixX<T> J = MatrixX<T>::Zero(n, n);
+
+  // Evaluate f(t+h,xtplus) for the current state (current xtplus).
+  const VectorX<T> f = CalcTimeDerivativesUsingContext();
+
+  // Compute the Jacobian, one group of columns at a time.
+  VectorX<T> xtplus_prime = xtplus;
+  VectorX<T> dx(n);
+  for (const std::vector<int>& group : column_groups_) {
+    for (const int j : group) {
+      // Compute the increment as in ComputeForwardDiffJacobian().
+      const T abs_xj = abs(xtplus(j));
+      const T dxj = (abs_xj <= 1) ? T(eps) : T(eps * abs_xj);
+      xtplus_prime(j) = xtplus(j) + dxj;
+      dx(j) = xtplus_prime(j) - xtplus(j);
+    }
+
+    // Compute f' and set the nonzero entries of the columns in the group.
+    state->SetFromVector(xtplus_prime);
+    const VectorX<T> df = CalcTimeDerivativesUsingContext() - f;
+    for (const int j : group) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(jacobian_sparsity_, j);
+           it; ++it) {
+        J(it.row(), j) = df(it.row()) / dx(j);
+      }
+
+      // Reset xtplus' to xtplus.
+      xtplus_prime(j) = xtplus(j);
+    }
+  }
+
+  return J;
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state (at a point specified by @p state) using
+// a second-order central difference (i.e., numerical differentiation).
+// @param system The dynamical system.
+// @param context The context at which to compute the time derivatives.
+// @param state The continuous state at which to compute the time derivatives.
+//              The function can modify this continuous state during the
+//              Jacobian computation.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+MatrixX<T> ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
+    const System<T>&, const Context<T>& context, ContinuousState<T>* state) {
+  using std::abs;
+
+  // Cube root of machine precision (indicated by theory) seems a bit coarse.
+  // Pick power of eps halfway between 6/12 (i.e., 1/2) and 4/12 (i.e., 1/3).
+  const double eps = std::pow(std::numeric_limits<double>::epsilon(), 5.0/12);
+
+  // Get the number of state variables.
+  const int n = state->size();
+
+  SPDLOG_DEBUG(drake::log(), "  ImplicitIntegrator Compute Centraldiff "
+               "{}-Jacobian t={}", n, context.get_time());
+
+  // Prevent compiler warnings for context.
+  unused(context);
+
+  // Initialize the Jacobian.
+  MatrixX<T> J(n, n);
+
+  // Get the current continuous state.
+  const VectorX<T> xtplus = state->CopyToVector();
+
+  // Compute the Jacobian.
+  VectorX<T> xtplus_prime = xtplus;
+  for (int i = 0; i < n; ++i) {
+    // Compute a good increment to the dimension using approximately 1/eps
+    // digits of precision. Note that if |xtplus| is large, the increment will
+    // be large as well. If |xtplus| is small, the increment will be no smaller
+    // than eps.
+    const T abs_xi = abs(xtplus(i));
+    T dxi(abs_xi);
+    if (dxi <= 1) {
+      // When |xtplus[i]| is small, increment will be eps.
+      dxi = eps;
+    } else {
+      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
+      dxi = eps * abs_xi;
+    }
+
+    // Update xtplus', minimizing the effect of roundoff error, by ensuring that
+    // x and dx differ by an exactly representable number. See p. 192 of
+    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
+    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+    xtplus_prime(i) = xtplus(i) + dxi;
+    const T dxi_plus = xtplus_prime(i) - xtplus(i);
+
+    // Compute f(x+dx).
+    state->SetFromVector(xtplus_prime);
+    VectorX<T> fprime_plus = CalcTimeDerivativesUsingContext();
+
+    // Update xtplus' again, minimizing the effect of roundoff error.
+    xtplus_prime(i) = xtplus(i) - dxi;
+    const T dxi_minus = xtplus(i) - xtplus_prime(i);
+
+    // Compute f(x-dx).
+    state->SetFromVector(xtplus_prime);
+    VectorX<T> fprime_minus = CalcTimeDerivativesUsingContext();
+
+    // Set the Jacobian column.
+    J.col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
+
+    // Reset xtplus' to xtplus.
+    xtplus_prime(i) = xtplus(i);
+  }
+
+  return J;
+}
+
+// Factors a dense matrix using LU factorization, which should be faster than
+// the QR factorization used in the specialized template method immediately
+// below.
+template <class T>
+void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
+    const MatrixX<T>& iteration_matrix) {
+  LU_.compute(iteration_matrix);
+  use_sparse_factorization_ = false;
+  matrix_factored_ = true;
+}
+
+// Factors a dense matrix. This AutoDiff-specialized method is necessary
+// because Eigen's LU factorization, which should be faster than the QR
+// factorization used here, is not currently AutoDiff-able (while the QR
+// factorization *is* AutoDiff-able).
+template <>
+void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
+    SetAndFactorIterationMatrix(const MatrixX<AutoDiffXd>& iteration_matrix) {
+  QR_.compute(iteration_matrix);
+  matrix_factored_ = true;
+}
+
+// Factors a sparse matrix using sparse LU factorization, reusing the symbolic
+// analysis if the sparsity pattern has not changed since it was computed.
+template <class T>
+void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
+    const Eigen::SparseMatrix<T>& iteration_matrix) {
+  DRAKE_DEMAND(iteration_matrix.isCompressed());
+  const int* outer = iteration_matrix.outerIndexPtr();
+  const int* inner = iteration_matrix.innerIndexPtr();
+  const int num_outer = iteration_matrix.outerSize() + 1;
+  const int num_inner = iteration_matrix.nonZeros();
+  if (static_cast<int>(analyzed_outer_indices_.size()) != num_outer ||
+      static_cast<int>(analyzed_inner_indices_.size()) != num_inner ||
+      !std::equal(outer, outer + num_outer, analyzed_outer_indices_.begin()) ||
+      !std::equal(inner, inner + num_inner, analyzed_inner_indices_.begin())) {
+    sparse_LU_.analyzePattern(iteration_matrix);
+    analyzed_outer_indices_.assign(outer, outer + num_outer);
+    analyzed_inner_indices_.assign(inner, inner + num_inner);
+  }
+  sparse_LU_.factorize(iteration_matrix);
+  if (sparse_LU_.info() == Eigen::Success) {
+    use_sparse_factorization_ = true;
+    matrix_factored_ = true;
+  } else {
+    SetAndFactorIterationMatrix(MatrixX<T>(iteration_matrix));
+  }
+}
+
+// Factors a sparse matrix. Eigen's sparse LU factorization is not
+// AutoDiff-able, so the matrix is factored densely, as in the specialized
+// method above.
+template <>
+void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
+    SetAndFactorIterationMatrix(
+        const Eigen::SparseMatrix<AutoDiffXd>& iteration_matrix) {
+  SetAndFactorIterationMatrix(MatrixX<AutoDiffXd>(iteration_matrix));
+}
+
+// Solves a linear system Ax = b for x using a matrix (A) factored using
+// (sparse or dense) LU decomposition.
+template <class T>
+VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
+    const VectorX<T>& b) const {
+  if (use_sparse_factorization_)
+    return sparse_LU_.solve(b);
+  return LU_.solve(b);
+}
+
+// Solves the linear system Ax = b for x using a matrix (A) factored using QR
+// decomposition.
+template <>
+VectorX<AutoDiffXd> ImplicitIntegrator<AutoDiffXd>::IterationMatrix::Solve(
+    const VectorX<AutoDiffXd>& b) const {
+  return QR_.solve(b);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeAndFactorIterationMatrix(
+    const MatrixX<T>& J, const Eigen::MatrixXd& A, const T& h,
+    IterationMatrix* iteration_matrix) {
+  DRAKE_DEMAND(A.rows() == A.cols());
+  num_iter_factorizations_++;
+  const int n = J.rows();
+  const int s = A.rows();
+  if (jacobian_scheme_ == JacobianComputationScheme::kColoredForwardDifference
+      && jacobian_sparsity_.rows() == n) {
+    std::vector<Eigen::Triplet<T>> triplets;
+    triplets.reserve(s * s * jacobian_sparsity_.nonZeros() + s * n);
+    for (int q = 0; q < s; ++q) {
+      for (int j = 0; j < n; ++j) {
+        for (int p = 0; p < s; ++p) {
+          if (A(p, q) == 0.0) continue;
+          for (Eigen::SparseMatrix<double>::InnerIterator
+                   it(jacobian_sparsity_, j); it; ++it) {
+            triplets.emplace_back(p * n + it.row(), q * n + j,
+                                  J(it.row(), j) * (A(p, q) * h));
+          }
+        }
+        triplets.emplace_back(q * n + j, q * n + j, T(-1));
+      }
+    }
+    Eigen::SparseMatrix<T> neg_iteration_matrix(s * n, s * n);
+    neg_iteration_matrix.setFromTriplets(triplets.begin(), triplets.end());
+    iteration_matrix->SetAndFactorIterationMatrix(neg_iteration_matrix);
+  } else {
+    MatrixX<T> neg_iteration_matrix = -MatrixX<T>::Identity(s * n, s * n);
+    for (int p = 0; p < s; ++p) {
+      for (int q = 0; q < s; ++q) {
+        if (A(p, q) == 0.0) continue;
+        neg_iteration_matrix.block(p * n, q * n, n, n) += J * (A(p, q) * h);
+      }
+    }
+    iteration_matrix->SetAndFactorIterationMatrix(neg_iteration_matrix);
+  }
+}
+
+// Checks to see whether a Jacobian matrix has "become bad" and needs to be
+// refactorized.
+template <class T>
+bool ImplicitIntegrator<T>::IsBadJacobian(const MatrixX<T>& J) const {
+  return !J.allFinite();
+}
+
+template <class T>
+bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
+    const T& t, const VectorX<T>& xt, int trial,
+    const std::function<void(const MatrixX<T>&, IterationMatrix*)>&
+        compute_and_factor_iteration_matrix,
+    IterationMatrix* iteration_matrix) {
+  // Compute the initial Jacobian and iteration matrices and factor them, if
+  // necessary.
+  if (!reuse_ || J_.rows() == 0 || IsBadJacobian(J_) ||
+      !iteration_matrix->matrix_factored()) {
+    // Note that the Jacobian can become bad through a divergent Newton-Raphson
+    // iteration, which causes the state to overflow, which then causes the
+    // Jacobian to overflow. If the state overflows, recomputing the Jacobian
+    // using this bad state will result in another bad Jacobian, eventually
+    // causing DoStep() to return indicating failure (but not before resetting
+    // the continuous state to its previous, good value). DoStep() will then
+    // be called again with a smaller step size and the good state; the
+    // bad Jacobian will then be corrected.
+    J_ = CalcJacobian(t, xt);
+    compute_and_factor_iteration_matrix(J_, iteration_matrix);
+    return true;
+  }
+
+  switch (trial) {
+    case 1:
+      // For the first trial, we do nothing special.
+      return true;
+
+    case 2: {
+      // For the second trial, re-construct and factor the iteration matrix.
+      compute_and_factor_iteration_matrix(J_, iteration_matrix);
+      return true;
+    }
+
+    case 3: {
+      // If the last call to the nonlinear system solver ended in failure, we
+      // know that the Jacobian matrix is fresh and the iteration matrix has
+      // been newly formed and factored (on Trial #2), so there is nothing more
+      // to be done.
+      if (last_call_failed_) {
+        return false;
+      } else {
+        // Reform the Jacobian matrix and refactor the iteration matrix.
+        J_ = CalcJacobian(t, xt);
+        compute_and_factor_iteration_matrix(J_, iteration_matrix);
+      }
+      return true;
+
+      case 4: {
+        // Trial #4 indicates failure.
+        return false;
+      }
+
+      default:
+        DRAKE_ABORT_MSG("Unexpected trial number.");
+    }
+  }
+}
+
+template <class T>
+typename ImplicitIntegrator<T>::ConvergenceStatus
+ImplicitIntegrator<T>::CheckNewtonConvergence(int iteration, const T& dx_norm,
+                                              const T& last_dx_norm) const {
+  // The check below looks for convergence using machine epsilon. Without
+  // this check, the convergence criteria can be applied when
+  // |dx_norm| ~ 1e-22 (one example taken from practice), which does not
+  // allow the norm to be reduced further. What happens: dx_norm will become
+  // equivalent to last_dx_norm, making theta = 1, and eta = infinity. Thus,
+  // convergence would never be identified.
+  if (dx_norm < 10 * std::numeric_limits<double>::epsilon())
+    return ConvergenceStatus::kConverged;
+
+  // Compute the convergence rate and check convergence.
+  // [Hairer, 1996] notes that this convergence strategy should only be
+  // applied after *at least* two iterations (p. 121).
+  if (iteration >= 1) {
+    const T theta = dx_norm / last_dx_norm;
+    const T eta = theta / (1 - theta);
+    SPDLOG_DEBUG(drake::log(), "Newton-Raphson loop {} theta: {}, eta: {}",
+                 iteration, theta, eta);
+
+    // Look for divergence.
+    if (theta > 1) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson divergence detected");
+      return ConvergenceStatus::kDiverged;
+    }
+
+    // Look for convergence using Equation 8.10 from [Hairer, 1996].
+    // [Hairer, 1996] determined values of kappa in [0.01, 0.1] work most
+    // efficiently on a number of test problems with *RADAU5* (a fifth order
+    // implicit integrator), p. 121. We select a value halfway in-between.
+    const double kappa = 0.05;
+    const double k_dot_tol = kappa * this->get_accuracy_in_use();
+    if (eta * dx_norm < k_dot_tol) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson converged; η = {}", eta);
+      return ConvergenceStatus::kConverged;
+    }
+  }
+
+  return ConvergenceStatus::kNotConverged;
+}
+
+// Compute the partial derivative of the ordinary differential equations with
+// respect to the state variables for a given x(t).
+// @post the context's time and continuous state will be temporarily set during
+//       this call (and then reset to their original values) on return.
+template <class T>
+MatrixX<T> ImplicitIntegrator<T>::CalcJacobian(const T& t,
+                                               const VectorX<T>& x) {
+  // We change the context but will change it back.
+  Context<T>* context = this->get_mutable_context();
+
+  // Get the current time and state.
+  T t_current = context->get_time();
+  const VectorX<T> x_current = context->get_continuous_state_vector().
+      CopyToVector();
+
+  // Update the time and state.
+  context->set_time(t);
+  context->get_mutable_continuous_state_vector().SetFromVector(x);
+  num_jacobian_evaluations_++;
+
+  // Get the current number of ODE evaluations.
+  int64_t current_ODE_evals = this->get_num_derivative_evaluations();
+
+  // Get a the system.
+  const System<T>& system = this->get_system();
+
+  // Get the mutable continuous state.
+  ContinuousState<T>& continuous_state = context->
+      get_mutable_continuous_state();
+
+  // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
+  MatrixX<T> J;
+  switch (jacobian_scheme_) {
+    case JacobianComputationScheme::kForwardDifference:
+      J = ComputeForwardDiffJacobian(system, *context, &continuous_state);
+      break;
+
+    case JacobianComputationScheme::kCentralDifference:
+      J = ComputeCentralDiffJacobian(system, *context, &continuous_state);
+      break;
+
+    case JacobianComputationScheme::kAutomatic:
+      J = ComputeAutoDiffJacobian(system, *context);
+      break;
+
+    case JacobianComputationScheme::kColoredForwardDifference:
+      J = ComputeColoredForwardDiffJacobian(system, *context,
+                                            &continuous_state);
+      break;
+
+    default:
+      // Should never get here.
+      DRAKE_ABORT();
+  }
+
+  // Use the new number of ODE evaluations to determine the number of Jacobian
+  // evaluations.
+  num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
+      - current_ODE_evals;
+
+  // Reset the time and state.
+  context->set_time(t_current);
+  continuous_state.SetFromVector(x_current);
+
+  return J;
+}
+
+}  // namespace systems
+}  // namespace drake
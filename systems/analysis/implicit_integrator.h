@@ -0,0 +1,352 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/systems/analysis/integrator_base.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * An abstract class providing the infrastructure shared by implicit
+ * integrators: forming Jacobian matrices of the ordinary differential
+ * equations, forming and factoring iteration matrices, reusing both across
+ * integration steps, and checking the convergence of the Newton-Raphson
+ * iteration used to solve the nonlinear system of equations of an implicit
+ * step.
+ * @tparam T The vector element type, which must be a valid Eigen scalar.
+ *
+ * This class uses Drake's `-inl.h` pattern.  When seeing linker errors from
+ * this class, please refer to http://drake.mit.edu/cxx_inl.html.
+ *
+ * Instantiated templates for the following kinds of T's are provided:
+ * - double
+ * - AutoDiffXd
+ */
+template <class T>
+class ImplicitIntegrator : public IntegratorBase<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImplicitIntegrator)
+
+  ~ImplicitIntegrator() override = default;
+
+  /// Selecting the wrong such Jacobian determination scheme will slow (possibly
+  /// critically) the implicit integration process. Automatic differentiation is
+  /// recommended if the System supports it for reasons of both higher
+  /// accuracy and increased speed. Forward differencing (i.e., numerical
+  /// differentiation) exhibits error in the approximation close to √ε, where
+  /// ε is machine epsilon, from n forward dynamics calls (where n is the number
+  /// of state variables). Central differencing yields the most accurate
+  /// numerically differentiated Jacobian matrix, but expends double the
+  /// computational effort for approximately three digits greater accuracy: the
+  /// total error in the central-difference approximation is close to ε^(2/3),
+  /// from 2n forward dynamics calls. See [Nocedal 2004, pp. 167-169].
+  ///
+  /// - [Nocedal 2004] J. Nocedal and S. Wright. Numerical Optimization.
+  ///                  Springer, 2004.
+  enum class JacobianComputationScheme {
+    /// O(h) Forward differencing.
+    kForwardDifference,
+
+    /// O(h²) Central differencing.
+    kCentralDifference,
+
+    /// Automatic differentiation.
+    kAutomatic,
+
+    /// O(h) Forward differencing that exploits the sparsity of the Jacobian
+    /// matrix: columns of the Jacobian matrix that share no nonzero rows are
+    /// grouped together, and all columns in a group are computed from a
+    /// single forward dynamics call (so that a tridiagonal Jacobian, for
+    /// example, requires only three forward dynamics calls). The iteration
+    /// matrix is factored using a sparse LU factorization.
+    /// @see set_jacobian_sparsity_pattern()
+    kColoredForwardDifference
+  };
+
+  /// @name Methods for getting and setting the Jacobian scheme.
+  ///
+  /// Methods for getting and setting the scheme used to determine the
+  /// Jacobian matrix necessary for solving the requisite nonlinear system
+  /// if equations.
+  /// @see JacobianComputationScheme
+  /// @{
+
+  /// Sets whether the integrator attempts to reuse Jacobian matrices and
+  /// iteration matrix factorizations (default is `true`). Forming Jacobian
+  /// matrices and factorizing iteration matrices are generally the two most
+  /// expensive operations performed by this integrator. For small systems
+  /// (those with on the order of ten state variables), the additional accuracy
+  /// that using fresh Jacobians and factorizations buys- which can permit
+  /// increased step sizes but should have no effect on solution accuracy- can
+  /// outweigh the small factorization cost.
+  /// @sa get_reuse
+  void set_reuse(bool reuse) { reuse_ = reuse; }
+
+  /// Gets whether the integrator attempts to reuse Jacobian matrices and
+  /// iteration matrix factorizations.
+  /// @sa set_reuse()
+  bool get_reuse() const { return reuse_; }
+
+  /// Sets the Jacobian computation scheme. This function can be safely called
+  /// at any time (i.e., the integrator need not be re-initialized afterward).
+  /// @note Discards any already-computed Jacobian matrices if the scheme
+  ///       changes.
+  void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
+    if (jacobian_scheme_ != scheme)
+      J_.resize(0, 0);
+    jacobian_scheme_ = scheme;
+  }
+
+  JacobianComputationScheme get_jacobian_computation_scheme() const {
+    return jacobian_scheme_;
+  }
+
+  /// Sets the sparsity pattern of the Jacobian matrix used by the
+  /// JacobianComputationScheme::kColoredForwardDifference scheme: the
+  /// structurally nonzero entries of the Jacobian matrix are exactly the
+  /// entries stored in @p pattern (the values of which are ignored). If no
+  /// pattern is set, the pattern is detected from the nonzero entries of the
+  /// first Jacobian matrix computed with that scheme (using standard forward
+  /// differencing); entries that happen to be zero at that state are then
+  /// treated as zero everywhere, so systems for which that might occur should
+  /// set the pattern explicitly.
+  /// @note Discards any already-computed Jacobian matrices.
+  /// @throws std::logic_error if @p pattern is not square.
+  void set_jacobian_sparsity_pattern(
+      const Eigen::SparseMatrix<double>& pattern);
+
+  /// Gets the number of groups into which the columns of the Jacobian matrix
+  /// are partitioned (i.e., the number of forward dynamics calls beyond the
+  /// first needed to form the Jacobian matrix) by the
+  /// JacobianComputationScheme::kColoredForwardDifference scheme, or zero if
+  /// the sparsity pattern has not yet been set or detected.
+  int get_num_jacobian_column_groups() const {
+    return static_cast<int>(column_groups_.size());
+  }
+  /// @}
+
+  /// @name Cumulative statistics functions.
+  /// The functions return statistics specific to the implicit integration
+  /// process.
+  /// @{
+
+  /// Gets the number of ODE function evaluations
+  /// (calls to CalcTimeDerivatives()) *used only for computing
+  /// the Jacobian matrices* since the last call to ResetStatistics().
+  int64_t get_num_derivative_evaluations_for_jacobian() const {
+    return num_jacobian_function_evaluations_;
+  }
+
+  /// Gets the number of iterations used in the Newton-Raphson nonlinear systems
+  /// of equation solving process since the last call to ResetStatistics().
+  int64_t get_num_newton_raphson_iterations() const {
+    return num_nr_iterations_;
+  }
+
+  /// Gets the number of Jacobian evaluations (i.e., the number of times
+  /// that the Jacobian matrix was reformed) since the last call to
+  /// ResetStatistics().
+  int64_t get_num_jacobian_evaluations() const { return
+        num_jacobian_evaluations_;
+  }
+
+  /// Gets the number of factorizations of the iteration matrix since the last
+  /// call to ResetStatistics().
+  int64_t get_num_iteration_matrix_factorizations() const {
+    return num_iter_factorizations_;
+  }
+  /// @}
+
+ protected:
+  /// A factorization of the (negated) iteration matrix of an implicit
+  /// integrator, which is either dense or sparse, and which is used to solve
+  /// the linear systems of the Newton-Raphson iteration.
+  class IterationMatrix {
+   public:
+    /// Factors a dense matrix using LU factorization (or, for AutoDiffXd,
+    /// QR factorization, since Eigen's LU factorization is not currently
+    /// AutoDiff-able).
+    void SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix);
+
+    /// Factors a sparse matrix using sparse LU factorization, reusing the
+    /// symbolic analysis of the previous factorization if the sparsity
+    /// pattern is unchanged. Falls back to dense factorization if the sparse
+    /// factorization fails (and, for AutoDiffXd, always).
+    void SetAndFactorIterationMatrix(
+        const Eigen::SparseMatrix<T>& iteration_matrix);
+
+    /// Solves the linear system Ax = b for x, where A is the last factored
+    /// matrix.
+    VectorX<T> Solve(const VectorX<T>& b) const;
+
+    /// Returns whether a matrix has been factored.
+    bool matrix_factored() const { return matrix_factored_; }
+
+   private:
+    // A simple LU factorization is all that is needed; robustness in the solve
+    // comes naturally as h << 1. Keeping this data in the class definition
+    // serves to minimize heap allocations and deallocations.
+    Eigen::PartialPivLU<MatrixX<double>> LU_;
+
+    // A QR factorization is necessary for automatic differentiation (current
+    // Eigen requirement).
+    Eigen::HouseholderQR<MatrixX<AutoDiffXd>> QR_;
+
+    // The sparse LU factorization, along with the sparsity pattern of the
+    // matrix for which the symbolic analysis was computed.
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> sparse_LU_;
+    std::vector<int> analyzed_outer_indices_;
+    std::vector<int> analyzed_inner_indices_;
+
+    // Whether the last factorization is stored in sparse_LU_ (rather than in
+    // LU_ or QR_).
+    bool use_sparse_factorization_{false};
+
+    bool matrix_factored_{false};
+  };
+
+  /// The status of the Newton-Raphson iteration.
+  /// @see CheckNewtonConvergence()
+  enum class ConvergenceStatus {
+    kDiverged,
+    kConverged,
+    kNotConverged,
+  };
+
+  explicit ImplicitIntegrator(const System<T>& system,
+                              Context<T>* context = nullptr)
+      : IntegratorBase<T>(system, context) {
+    derivs_ = system.AllocateTimeDerivatives();
+  }
+
+  /// Resets the statistics of this class and then calls
+  /// DoResetImplicitIntegratorStatistics().
+  void DoResetStatistics() override;
+
+  /// Derived classes can override this method to reset their own statistics.
+  virtual void DoResetImplicitIntegratorStatistics() {}
+
+  /// Discards any already-computed Jacobian matrix, forcing its recomputation.
+  void reset_jacobian() { J_.resize(0, 0); }
+
+  /// Gets the last computed Jacobian matrix (empty if none has been computed).
+  const MatrixX<T>& get_jacobian() const { return J_; }
+
+  /// Computes, if necessary, the Jacobian matrix and the iteration matrix
+  /// (using @p compute_and_factor_iteration_matrix) and factors the iteration
+  /// matrix for the Newton-Raphson iteration of an implicit step. Uses more
+  /// computationally expensive approaches as @p trial increases (see below).
+  /// @param t the time at which to compute the Jacobian matrix.
+  /// @param xt the state at which to compute the Jacobian matrix.
+  /// @param trial the attempt for the Newton-Raphson iteration (1-4). On the
+  ///        first trial, already computed matrices are reused (if reuse is
+  ///        enabled). On the second trial, the iteration matrix is reformed
+  ///        and factored. On the third trial, the Jacobian matrix is also
+  ///        recomputed, and the fourth trial indicates failure.
+  /// @param compute_and_factor_iteration_matrix a function that computes and
+  ///        factors the iteration matrix from the Jacobian matrix.
+  /// @param[out] iteration_matrix the factored iteration matrix on return.
+  /// @returns `false` if the calling method should indicate failure; `true`
+  ///          otherwise.
+  bool MaybeFreshenMatrices(
+      const T& t, const VectorX<T>& xt, int trial,
+      const std::function<void(const MatrixX<T>& J,
+                               IterationMatrix* iteration_matrix)>&
+          compute_and_factor_iteration_matrix,
+      IterationMatrix* iteration_matrix);
+
+  /// Forms and factors the *negation* of the iteration matrix of an implicit
+  /// Runge-Kutta method with (s×s) Runge-Kutta matrix @p A, i.e., the (sn×sn)
+  /// matrix h (A ⊗ J) - I, where ⊗ denotes the Kronecker product. The idea of
+  /// using the negation of the iteration matrix is that an O(n²) subtraction
+  /// is not necessary as would be the case with I - h (A ⊗ J). With the
+  /// JacobianComputationScheme::kColoredForwardDifference scheme, only the
+  /// structurally nonzero entries are formed, and the matrix is factored as a
+  /// sparse matrix.
+  void ComputeAndFactorIterationMatrix(const MatrixX<T>& J,
+                                       const Eigen::MatrixXd& A, const T& h,
+                                       IterationMatrix* iteration_matrix);
+
+  /// Checks the convergence of the Newton-Raphson iteration using the
+  /// approach of [Hairer, 1996], p. 121.
+  /// @param iteration the index of the iteration, starting from zero.
+  /// @param dx_norm the norm of the state update of the current iteration.
+  /// @param last_dx_norm the norm of the state update of the previous
+  ///        iteration.
+  ///
+  /// - [Hairer, 1996]   E. Hairer and G. Wanner. Solving Ordinary Differential
+  ///                    Equations II (Stiff and Differential-Algebraic
+  ///                    Problems). Springer, 1996.
+  ConvergenceStatus CheckNewtonConvergence(int iteration, const T& dx_norm,
+                                           const T& last_dx_norm) const;
+
+  /// Evaluates the ordinary differential equations at the time and state in
+  /// the system's context (stored by the integrator).
+  VectorX<T> CalcTimeDerivativesUsingContext();
+
+  /// Records whether the last attempt to solve the nonlinear system of an
+  /// implicit step failed. A failed attempt implies that the Jacobian matrix
+  /// is fresh, in which case MaybeFreshenMatrices() does not recompute it.
+  void set_last_call_failed(bool failed) { last_call_failed_ = failed; }
+
+  /// Increments the number of Newton-Raphson iterations.
+  void increment_num_newton_raphson_iterations() { num_nr_iterations_++; }
+
+ private:
+  bool IsBadJacobian(const MatrixX<T>& J) const;
+  MatrixX<T> CalcJacobian(const T& t, const VectorX<T>& x);
+  MatrixX<T> ComputeForwardDiffJacobian(const System<T>&,
+                                        const Context<T>&,
+                                        ContinuousState<T>* state);
+  MatrixX<T> ComputeCentralDiffJacobian(const System<T>&,
+                                        const Context<T>&,
+                                        ContinuousState<T>* state);
+  MatrixX<T> ComputeColoredForwardDiffJacobian(const System<T>&,
+                                               const Context<T>&,
+                                               ContinuousState<T>* state);
+  MatrixX<T> ComputeAutoDiffJacobian(const System<T>& system,
+                                     const Context<T>& context);
+
+  // This is a pre-allocated temporary for use by integration. It stores
+  // the derivatives computed at x(t+h).
+  std::unique_ptr<ContinuousState<T>> derivs_;
+
+  // The scheme to be used for computing the Jacobian matrix during the
+  // nonlinear system solve process.
+  JacobianComputationScheme jacobian_scheme_{
+      JacobianComputationScheme::kForwardDifference};
+
+  // The sparsity pattern of the Jacobian matrix (empty if not yet set or
+  // detected) and the groups of its structurally orthogonal columns, as used
+  // by the kColoredForwardDifference scheme.
+  Eigen::SparseMatrix<double> jacobian_sparsity_;
+  std::vector<std::vector<int>> column_groups_;
+
+  // The last computed Jacobian matrix. Keeping this data in the class
+  // definitions serves to minimize heap allocations and deallocations.
+  MatrixX<T> J_;
+
+  // Whether the last call to the nonlinear system solver was a failure.
+  bool last_call_failed_{false};
+
+  // If set to `false`, Jacobian matrices and iteration matrix factorizations
+  // will not be reused.
+  bool reuse_{true};
+
+  // Various combined statistics.
+  int64_t num_jacobian_evaluations_{0};
+  int64_t num_iter_factorizations_{0};
+  int64_t num_jacobian_function_evaluations_{0};
+  int64_t num_nr_iterations_{0};
+};
+}  // namespace systems
+}  // namespace drake
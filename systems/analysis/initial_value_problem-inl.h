@@ -1,8 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "drake/common/extract_double.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/polynomial.h"
 #include "drake/systems/analysis/initial_value_problem.h"
 #include "drake/systems/analysis/runge_kutta3_integrator-inl.h"
 #include "drake/systems/framework/basic_vector.h"
@@ -130,8 +136,12 @@ InitialValueProblem<T>::InitialValueProblem(
   context_->set_time(default_values_.t0.value());
 
   // Instantiates an explicit RK3 integrator by default.
-  integrator_ = std::make_unique<RungeKutta3Integrator<T>>(
-      *system_, context_.get());
+  integrator_factory_ = [](const System<T>& system) {
+    return std::unique_ptr<IntegratorBase<T>>(
+        std::make_unique<RungeKutta3Integrator<T>>(system));
+  };
+  integrator_ = integrator_factory_(*system_);
+  integrator_->reset_context(context_.get());
 
   // Sets step size and accuracy defaults.
   integrator_->request_initial_step_size_target(
@@ -143,69 +153,86 @@ InitialValueProblem<T>::InitialValueProblem(
 }
 
 template <typename T>
-VectorX<T> InitialValueProblem<T>::Solve(const T& tf,
+typename InitialValueProblem<T>::SpecifiedValues
+InitialValueProblem<T>::GetValuesToSolveWith(
+    const T& tf,
     const typename InitialValueProblem<T>::SpecifiedValues& values) const {
   // Gets specified values to solve with, while checking
   // that all preconditions hold.
-  const T t0 = values.t0.value_or(default_values_.t0.value());
-  if (tf < t0) {
+  SpecifiedValues result;
+  result.t0 = values.t0.value_or(default_values_.t0.value());
+  if (tf < result.t0.value()) {
     throw std::logic_error("Cannot solve IVP for a time tf"
                            " before the initial time t0.");
   }
-  const VectorX<T> x0 = values.x0.value_or(default_values_.x0.value());
-  if (x0.size() != default_values_.x0.value().size()) {
+  result.x0 = values.x0.value_or(default_values_.x0.value());
+  if (result.x0.value().size() != default_values_.x0.value().size()) {
     throw std::logic_error("IVP initial state vector x0 is"
                            " of the wrong dimension.");
   }
-  const VectorX<T> k = values.k.value_or(default_values_.k.value());
-  if (k.size() != default_values_.k.value().size()) {
+  result.k = values.k.value_or(default_values_.k.value());
+  if (result.k.value().size() != default_values_.k.value().size()) {
     throw std::logic_error("IVP parameter vector k is "
                            " of the wrong dimension");
   }
+  return result;
+}
+
+template <typename T>
+void InitialValueProblem<T>::ResetIntegration(
+    const typename InitialValueProblem<T>::SpecifiedValues& values,
+    const IntegratorBase<T>& settings, Context<T>* context,
+    IntegratorBase<T>* integrator) {
+  // Sets context (initial) time.
+  context->set_time(values.t0.value());
+
+  // Sets context (initial) state. This cast is safe because the
+  // ContinuousState<T> of a LeafSystem<T> is flat i.e. it is just
+  // a BasicVector<T>, and the implementation deals with LeafSystem<T>
+  // instances only by design.
+  BasicVector<T>& state_vector = dynamic_cast<BasicVector<T>&>(
+      context->get_mutable_continuous_state_vector());
+  state_vector.set_value(values.x0.value());
+
+  // Sets context parameters.
+  BasicVector<T>& parameter_vector =
+      context->get_mutable_numeric_parameter(0);
+  parameter_vector.set_value(values.k.value());
+
+  // Keeps track of current step size and accuracy settings (regardless
+  // of whether these are actually used by the integrator instance or not).
+  const T max_step_size = settings.get_maximum_step_size();
+  const T initial_step_size = settings.get_initial_step_size_target();
+  const T target_accuracy = settings.get_target_accuracy();
+
+  // Resets the integrator internal state.
+  integrator->Reset();
+
+  // Sets integrator settings again.
+  integrator->set_maximum_step_size(max_step_size);
+  if (integrator->supports_error_estimation()) {
+    // Specifies initial step and accuracy setting only if necessary.
+    integrator->request_initial_step_size_target(initial_step_size);
+    integrator->set_target_accuracy(target_accuracy);
+  }
+}
+
+template <typename T>
+VectorX<T> InitialValueProblem<T>::Solve(const T& tf,
+    const typename InitialValueProblem<T>::SpecifiedValues& values) const {
+  const SpecifiedValues solve_values = GetValuesToSolveWith(tf, values);
   // Performs cache invalidation and re-initializes both
   // integrator and integration context if necessary.
-  if (t0 != current_values_.t0 ||
-      x0 != current_values_.x0 ||
-      k != current_values_.k ||
+  if (solve_values.t0 != current_values_.t0 ||
+      solve_values.x0 != current_values_.x0 ||
+      solve_values.k != current_values_.k ||
       tf < context_->get_time()) {
-    // Sets context (initial) time.
-    context_->set_time(t0);
-
-    // Sets context (initial) state. This cast is safe because the
-    // ContinuousState<T> of a LeafSystem<T> is flat i.e. it is just
-    // a BasicVector<T>, and the implementation deals with LeafSystem<T>
-    // instances only by design.
-    BasicVector<T>& state_vector = dynamic_cast<BasicVector<T>&>(
-        context_->get_mutable_continuous_state_vector());
-    state_vector.set_value(x0);
-
-    // Sets context parameters.
-    BasicVector<T>& parameter_vector =
-        context_->get_mutable_numeric_parameter(0);
-    parameter_vector.set_value(k);
-
-    // Keeps track of current step size and accuracy settings (regardless
-    // of whether these are actually used by the integrator instance or not).
-    const T max_step_size = integrator_->get_maximum_step_size();
-    const T initial_step_size = integrator_->get_initial_step_size_target();
-    const T target_accuracy = integrator_->get_target_accuracy();
-
-    // Resets the integrator internal state.
-    integrator_->Reset();
-
-    // Sets integrator settings again.
-    integrator_->set_maximum_step_size(max_step_size);
-    if (integrator_->supports_error_estimation()) {
-      // Specifies initial step and accuracy setting only if necessary.
-      integrator_->request_initial_step_size_target(initial_step_size);
-      integrator_->set_target_accuracy(target_accuracy);
-    }
+    ResetIntegration(solve_values, *integrator_, context_.get(),
+                     integrator_.get());
 
     // Keeps track of the current initial conditions and parameters
     // for future cache invalidation.
-    current_values_.t0 = t0;
-    current_values_.x0 = x0;
-    current_values_.k = k;
+    current_values_ = solve_values;
   }
 
   // Initializes integrator if necessary.
@@ -226,5 +253,108 @@ VectorX<T> InitialValueProblem<T>::Solve(const T& tf,
   return state_vector.get_value();
 }
 
+template <typename T>
+trajectories::PiecewisePolynomial<T> InitialValueProblem<T>::DenseSolve(
+    const T& tf,
+    const typename InitialValueProblem<T>::SpecifiedValues& values) const {
+  using std::min;
+  const SpecifiedValues solve_values = GetValuesToSolveWith(tf, values);
+  if (tf == solve_values.t0.value()) {
+    throw std::logic_error("Cannot densely solve IVP for a time tf"
+                           " equal to the initial time t0.");
+  }
+  // The trajectory must start at t0, so integration always starts over.
+  ResetIntegration(solve_values, *integrator_, context_.get(),
+                   integrator_.get());
+  current_values_ = solve_values;
+  const bool dense_output_was_enabled =
+      integrator_->get_dense_output_enabled();
+  integrator_->set_dense_output_enabled(true);
+  integrator_->Initialize();
+
+  // Integrates up to the requested time step by step, as
+  // IntegratorBase::IntegrateWithMultipleSteps() does, turning the dense
+  // output of each step into a polynomial of t - tₛ, where tₛ is the time at
+  // the beginning of the step.
+  typedef typename trajectories::PiecewisePolynomial<T>::PolynomialMatrix
+      PolynomialMatrix;
+  std::vector<PolynomialMatrix> polynomials;
+  std::vector<double> breaks{ExtractDoubleOrThrow(solve_values.t0.value())};
+  const T inf = std::numeric_limits<double>::infinity();
+  const int n = static_cast<int>(solve_values.x0.value().size());
+  T t_remaining = tf - context_->get_time();
+  do {
+    integrator_->IntegrateAtMost(
+        inf, inf, min(t_remaining, integrator_->get_maximum_step_size()));
+    t_remaining = tf - context_->get_time();
+    if (!integrator_->has_dense_output()) {
+      continue;
+    }
+    const T h = integrator_->get_dense_output_end_time() -
+                integrator_->get_dense_output_start_time();
+    if (!(h > 0)) {
+      continue;
+    }
+    // Rescales x(tₛ + s h) = Σₖ Cₖ sᵏ into Σₖ (Cₖ / hᵏ) (t - tₛ)ᵏ.
+    MatrixX<T> coefficients = integrator_->get_dense_output_coefficients();
+    T scale(1);
+    for (int k = 1; k < coefficients.cols(); ++k) {
+      scale /= h;
+      coefficients.col(k) *= scale;
+    }
+    PolynomialMatrix polynomial(n, 1);
+    for (int i = 0; i < n; ++i) {
+      polynomial(i) = Polynomial<T>(coefficients.row(i).transpose());
+    }
+    polynomials.push_back(std::move(polynomial));
+    breaks.push_back(
+        ExtractDoubleOrThrow(integrator_->get_dense_output_end_time()));
+  } while (t_remaining > 0);
+
+  integrator_->set_dense_output_enabled(dense_output_was_enabled);
+  return trajectories::PiecewisePolynomial<T>(polynomials, breaks);
+}
+
+template <typename T>
+std::vector<VectorX<T>> InitialValueProblem<T>::SolveBatch(
+    const T& tf,
+    const std::vector<typename InitialValueProblem<T>::SpecifiedValues>&
+        values,
+    int num_threads) const {
+  if (num_threads < 1) {
+    throw std::logic_error("SolveBatch(): num_threads must be positive.");
+  }
+  // Checks all preconditions up front, before any thread starts.
+  const int num_problems = static_cast<int>(values.size());
+  std::vector<SpecifiedValues> solve_values;
+  solve_values.reserve(num_problems);
+  for (const SpecifiedValues& problem_values : values) {
+    solve_values.push_back(GetValuesToSolveWith(tf, problem_values));
+  }
+
+  // Each run solves a contiguous range of the problems with its own context
+  // and integrator, which are only allocated once per run.
+  std::vector<VectorX<T>> results(num_problems);
+  const int num_runs = std::min(num_problems, num_threads);
+  ParallelFor(num_runs, num_threads, [&](int run) {
+    const int begin = run * num_problems / num_runs;
+    const int end = (run + 1) * num_problems / num_runs;
+    std::unique_ptr<Context<T>> context = system_->CreateDefaultContext();
+    std::unique_ptr<IntegratorBase<T>> integrator =
+        integrator_factory_(*system_);
+    integrator->reset_context(context.get());
+    for (int i = begin; i < end; ++i) {
+      ResetIntegration(solve_values[i], *integrator_, context.get(),
+                       integrator.get());
+      integrator->Initialize();
+      integrator->IntegrateWithMultipleSteps(tf - context->get_time());
+      // This cast is safe for the same reason as in Solve().
+      results[i] = dynamic_cast<const BasicVector<T>&>(
+          context->get_continuous_state_vector()).get_value();
+    }
+  });
+  return results;
+}
+
 }  // namespace systems
 }  // namespace drake
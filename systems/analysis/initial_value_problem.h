@@ -1,11 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/parameters.h"
@@ -27,6 +30,11 @@ namespace systems {
 /// kept constant, e.g. if solved for t₁ > t₀ first, solving for t₂ > t₁ will
 /// only require integrating from t₁ onward.
 ///
+/// When the solution is needed at many times, DenseSolve() integrates once and
+/// returns a continuous approximation of 𝐱(t; 𝐤) over the whole interval.
+/// When it is needed for many initial conditions or parameters, SolveBatch()
+/// solves for each of them in parallel.
+///
 /// For further insight into its use, consider the following examples:
 ///
 /// - The momentum 𝐩 of a particle of mass m that is traveling through a
@@ -123,6 +131,53 @@ class InitialValueProblem {
   /// @throw std::logic_error if preconditions are not met.
   VectorX<T> Solve(const T& tf, const SpecifiedValues& values = {}) const;
 
+  /// Solves the IVP on the interval [t₀, @p tf], using the initial time t₀,
+  /// initial state vector 𝐱₀ and parameter vector 𝐤 present in @p values,
+  /// falling back to the ones given on construction if not given, and returns
+  /// the solution as a trajectory that can be evaluated at any time in that
+  /// interval without further integration.
+  ///
+  /// The trajectory has one segment per integration step, each of which is
+  /// the integrator's dense output over that step (see
+  /// IntegratorBase::set_dense_output_enabled()), so that its accuracy is that
+  /// of the integrator in between steps as well.  Afterwards, Solve() for the
+  /// same values and times at or after @p tf continues from @p tf.
+  ///
+  /// @param tf The time to solve the IVP up to.
+  /// @param values The specified values for the IVP.
+  /// @return The IVP solution 𝐱(t; 𝐤) for 𝐱(t₀; 𝐤) = 𝐱₀ and t ∈ [t₀, @p tf],
+  ///         as an n × 1 trajectory.
+  /// @pre Given @p tf must be larger than the specified initial time t₀
+  ///      (either given or default).
+  /// @pre If given, the dimensions of @p values.x0 and @p values.k must match
+  ///      those of the default specified values given on construction.
+  /// @throw std::logic_error if preconditions are not met.
+  trajectories::PiecewisePolynomial<T> DenseSolve(
+      const T& tf, const SpecifiedValues& values = {}) const;
+
+  /// Solves the IVP for time @p tf once for each element of @p values, as
+  /// Solve() would, on up to @p num_threads threads.
+  ///
+  /// Each thread integrates with its own context and its own instance of the
+  /// integrator in use (see reset_integrator()), configured with the same
+  /// maximum step size, initial step size target and target accuracy.  Unlike
+  /// Solve(), no integration is reused from one call to the next, and the
+  /// internal integrator and its statistics are left untouched.
+  ///
+  /// @param tf The time to solve the IVP for.
+  /// @param values The specified values for each IVP to solve.
+  /// @param num_threads The maximum number of threads to use; must be
+  ///                    positive.
+  /// @return The IVP solution 𝐱(@p tf; 𝐤) for each element of @p values, in
+  ///         the same order.
+  /// @pre The preconditions of Solve() hold for each element of @p values.
+  /// @pre The ODE function given on construction may be called concurrently
+  ///      from several threads.
+  /// @throw std::logic_error if preconditions are not met.
+  std::vector<VectorX<T>> SolveBatch(const T& tf,
+                                     const std::vector<SpecifiedValues>& values,
+                                     int num_threads) const;
+
   /// Resets the internal integrator instance by in-place
   /// construction of the given integrator type.
   ///
@@ -131,7 +186,8 @@ class InitialValueProblem {
   ///    ivp.reset_integrator<RungeKutta2Integrator<T>>(max_step);
   /// @endcode
   ///
-  /// @param args The integrator type-specific arguments.
+  /// @param args The integrator type-specific arguments, which are copied
+  ///             so that SolveBatch() can construct further instances.
   /// @return The new integrator instance.
   /// @tparam Integrator The integrator type, which must be an
   ///         IntegratorBase subclass.
@@ -141,8 +197,11 @@ class InitialValueProblem {
   ///          InitialValueProblem::get_mutable_integrator().
   template <typename Integrator, typename... Args>
   Integrator* reset_integrator(Args&&... args) {
-    integrator_ = std::make_unique<Integrator>(
-        *system_, std::forward<Args>(args)...);
+    integrator_factory_ = [args...](const System<T>& system) {
+      return std::unique_ptr<IntegratorBase<T>>(
+          std::make_unique<Integrator>(system, args...));
+    };
+    integrator_ = integrator_factory_(*system_);
     integrator_->reset_context(context_.get());
     return static_cast<Integrator*>(integrator_.get());
   }
@@ -158,6 +217,20 @@ class InitialValueProblem {
   }
 
  private:
+  // Returns @p values with the unspecified ones replaced by their defaults,
+  // after checking them against the preconditions of Solve() for @p tf.
+  SpecifiedValues GetValuesToSolveWith(const T& tf,
+                                       const SpecifiedValues& values) const;
+
+  // Sets the time, state and parameters in @p context to the given (fully
+  // specified) @p values, and resets @p integrator to integrate from there
+  // with the step size and accuracy settings of @p settings, which may be
+  // @p integrator itself.
+  static void ResetIntegration(const SpecifiedValues& values,
+                               const IntegratorBase<T>& settings,
+                               Context<T>* context,
+                               IntegratorBase<T>* integrator);
+
   // IVP values specified by default.
   const SpecifiedValues default_values_;
 
@@ -179,6 +252,9 @@ class InitialValueProblem {
   std::unique_ptr<System<T>> system_;
   // Numerical integrator used for IVP ODE solving.
   std::unique_ptr<IntegratorBase<T>> integrator_;
+  // Makes new instances of the type of integrator_, for SolveBatch().
+  std::function<std::unique_ptr<IntegratorBase<T>>(const System<T>&)>
+      integrator_factory_;
 };
 
 }  // namespace systems
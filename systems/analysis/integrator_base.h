@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -8,6 +9,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/vector_base.h"
@@ -103,6 +105,9 @@ solution, so must be avoided.
 
  * @tparam T The vector element type, which must be a valid Eigen scalar.
  */
+class ContextSerializer;
+template <typename T> class Simulator;
+
 template <class T>
 class IntegratorBase {
  public:
@@ -421,6 +426,9 @@ class IntegratorBase {
     prev_step_size_ = nan();
     ideal_next_step_size_ = nan();
 
+    // Dense output is no longer valid.
+    ClearDenseOutput();
+
     // Call the derived integrator reset routine.
     DoReset();
 
@@ -642,10 +650,15 @@ class IntegratorBase {
     if (!this->get_fixed_step_mode())
       throw std::logic_error("IntegrateWithSingleFixedStep() requires fixed "
                              "stepping.");
+    const T t0 = context_->get_time();
+    VectorX<T> x0;
+    if (dense_output_enabled_)
+      x0 = context_->get_continuous_state().CopyToVector();
     if (!Step(dt)) {
       throw std::runtime_error("Integrator was unable to take a single fixed "
                                    "step of the requested size.");
     }
+    CalcDenseOutput(t0, x0);
 
     UpdateStepStatistics(dt);
   }
@@ -1060,6 +1073,90 @@ class IntegratorBase {
    * @}
    */
 
+  /**
+   * @name         Methods for dense output
+   * @{
+   * When dense output is enabled, the integrator computes a continuous
+   * extension (an interpolant) of the continuous state over each step that it
+   * takes, which can be evaluated at any time within the last step taken
+   * without further integration (e.g., to isolate witness function zeros or
+   * to sample the state at times that do not coincide with step boundaries).
+   * Unless the integrator provides its own extension (see
+   * DoCalcDenseOutput()), the interpolant is the cubic Hermite polynomial
+   * matching the states and time derivatives at both ends of the step, which
+   * costs one additional derivative evaluation per step.
+   */
+
+  /**
+   * Sets whether the integrator computes dense output (default is `false`).
+   * Discards the interpolant of any step already taken.
+   * @sa ClearDenseOutput()
+   */
+  void set_dense_output_enabled(bool enabled) {
+    dense_output_enabled_ = enabled;
+    ClearDenseOutput();
+  }
+
+  /// Gets whether the integrator computes dense output.
+  bool get_dense_output_enabled() const { return dense_output_enabled_; }
+
+  /// Returns whether the interpolant of a step is available, i.e., whether
+  /// dense output is enabled and a step has been taken since it was enabled
+  /// or since the integrator was last reset.
+  bool has_dense_output() const { return dense_output_coefficients_.cols() > 0; }
+
+  /// Gets the time at the beginning of the step over which the dense output
+  /// is defined.
+  /// @pre has_dense_output() is `true`.
+  const T& get_dense_output_start_time() const {
+    DRAKE_DEMAND(has_dense_output());
+    return dense_output_t0_;
+  }
+
+  /// Gets the time at the end of the step over which the dense output is
+  /// defined.
+  /// @pre has_dense_output() is `true`.
+  const T& get_dense_output_end_time() const {
+    DRAKE_DEMAND(has_dense_output());
+    return dense_output_t1_;
+  }
+
+  /// Gets the coefficients of the interpolant of the continuous state over the
+  /// last step taken, as the polynomial `x(t0 + s h) = Σₖ Cₖ sᵏ` for
+  /// `s ∈ [0, 1]`, where `t0` and `t0 + h` are the start and end times of the
+  /// step and `Cₖ` is the k-th column of the returned matrix.
+  /// @pre has_dense_output() is `true`.
+  const MatrixX<T>& get_dense_output_coefficients() const {
+    DRAKE_DEMAND(has_dense_output());
+    return dense_output_coefficients_;
+  }
+
+  /**
+   * Evaluates the interpolant of the continuous state over the last step
+   * taken at time @p t.
+   * @throws std::logic_error if has_dense_output() is `false` or @p t lies
+   *         outside of [get_dense_output_start_time(),
+   *         get_dense_output_end_time()].
+   */
+  VectorX<T> EvaluateDenseOutput(const T& t) const;
+
+  /**
+   * Discards the interpolant of the last step taken. The default interpolant
+   * of a step that starts at the time and continuous state at which the last
+   * step ended reuses the time derivatives computed there, so this method
+   * must be called whenever the time derivative function changes between
+   * steps (e.g., after discrete state updates or changes to input values).
+   */
+  void ClearDenseOutput() {
+    dense_output_coefficients_.resize(0, 0);
+    dense_output_x1_.resize(0);
+    dense_output_xdot1_.resize(0);
+  }
+
+  /**
+   * @}
+   */
+
  protected:
   /// Resets any statistics particular to a specific integrator. The default
   /// implementation of this function does nothing. If your integrator
@@ -1067,6 +1164,23 @@ class IntegratorBase {
   /// reset them there.
   virtual void DoResetStatistics() {}
 
+  /// Derived classes can override this method to provide a continuous
+  /// extension of the step just taken by DoStep() that is cheaper or more
+  /// accurate than the default cubic Hermite interpolant. The extension must
+  /// be expressed as the polynomial `x(t0 + s h) = Σₖ Cₖ sᵏ` for `s ∈ [0, 1]`,
+  /// where `h` is the step size and `Cₖ` is the k-th column of
+  /// @p coefficients. The default implementation requires the time
+  /// derivatives at both ends of the step, reusing those at the end of the
+  /// previous step when possible.
+  /// @param t0 the time at the beginning of the step.
+  /// @param x0 the continuous state at the beginning of the step.
+  /// @param[out] coefficients the polynomial coefficients on return.
+  /// @pre The time and continuous state of the context are those at the end
+  ///      of the step on entry.
+  /// @post The time and continuous state of the context are unchanged.
+  virtual void DoCalcDenseOutput(const T& t0, const VectorX<T>& x0,
+                                 MatrixX<T>* coefficients);
+
   /// Evaluates the derivative function (and updates call statistics).
   /// Subclasses should call this function rather than calling
   /// system.CalcTimeDerivatives() directly.
@@ -1266,6 +1380,12 @@ class IntegratorBase {
   void set_ideal_next_step_size(const T& dt) { ideal_next_step_size_ = dt; }
 
  private:
+  // Restores the step size history used by error control from a checkpoint;
+  // see simulator_checkpoint.h.
+  friend void RestoreSimulatorCheckpoint(const ContextSerializer&,
+                                         const void*, size_t,
+                                         Simulator<double>*);
+
   // Validates that a smaller step size does not fall below the working minimum
   // and throws an exception if desired.
   void ValidateSmallerStepSize(const T& current_step_size,
@@ -1312,6 +1432,18 @@ class IntegratorBase {
     return true;
   }
 
+  // Computes the interpolant of the step accepted over [t0, t], where t is
+  // the time in the context, if dense output is enabled. This is called only
+  // once a step has been accepted (rather than from Step()) so that steps
+  // rejected by error control incur no cost.
+  void CalcDenseOutput(const T& t0, const VectorX<T>& x0) {
+    if (!dense_output_enabled_)
+      return;
+    DoCalcDenseOutput(t0, x0, &dense_output_coefficients_);
+    dense_output_t0_ = t0;
+    dense_output_t1_ = context_->get_time();
+  }
+
   // Reference to the system being simulated.
   const System<T>& system_;
 
@@ -1380,6 +1512,21 @@ class IntegratorBase {
   // Variable for indicating when an integrator has been initialized.
   bool initialization_done_{false};
 
+  // Whether dense output is computed, along with the polynomial coefficients
+  // of the interpolant of the last step (empty if there is none) and the
+  // times at the beginning and end of that step.
+  bool dense_output_enabled_{false};
+  MatrixX<T> dense_output_coefficients_;
+  T dense_output_t0_{nan()};
+  T dense_output_t1_{nan()};
+
+  // The state and time derivatives at the end of the last step, stored so
+  // that the default interpolant of a step starting there can reuse the
+  // derivative evaluation, and a pre-allocated temporary for computing them.
+  VectorX<T> dense_output_x1_;
+  VectorX<T> dense_output_xdot1_;
+  std::unique_ptr<ContinuousState<T>> dense_output_derivs_;
+
   // This a workaround for an apparent bug in clang 3.8 in which
   // defining this as a static constexpr member kNaN failed to instantiate
   // properly for the AutoDiffXd instantiation (worked in gcc and MSVC).
@@ -1392,6 +1539,64 @@ class IntegratorBase {
   T req_initial_step_size_{nan()};  // means "unspecified, use default"
 };
 
+template <class T>
+VectorX<T> IntegratorBase<T>::EvaluateDenseOutput(const T& t) const {
+  if (!has_dense_output())
+    throw std::logic_error("No dense output is available.");
+  if (t < dense_output_t0_ || t > dense_output_t1_) {
+    throw std::logic_error("Dense output evaluated outside of the interval of "
+                           "the last step.");
+  }
+
+  // Evaluate the polynomial using Horner's method.
+  const int degree = dense_output_coefficients_.cols() - 1;
+  const T h = dense_output_t1_ - dense_output_t0_;
+  const T s = (h > 0) ? T((t - dense_output_t0_) / h) : T(0);
+  VectorX<T> x = dense_output_coefficients_.col(degree);
+  for (int k = degree - 1; k >= 0; --k)
+    x = x * s + dense_output_coefficients_.col(k);
+  return x;
+}
+
+template <class T>
+void IntegratorBase<T>::DoCalcDenseOutput(const T& t0, const VectorX<T>& x0,
+                                          MatrixX<T>* coefficients) {
+  Context<T>* context = get_mutable_context();
+  const T t1 = context->get_time();
+  const T h = t1 - t0;
+  const VectorX<T> x1 = context->get_continuous_state().CopyToVector();
+  if (!dense_output_derivs_)
+    dense_output_derivs_ = get_system().AllocateTimeDerivatives();
+
+  // Get the time derivatives at the beginning of the step, reusing those at
+  // the end of the previous step if this step started there.
+  VectorX<T> xdot0;
+  if (dense_output_x1_.size() == x0.size() && dense_output_t1_ == t0 &&
+      dense_output_x1_ == x0) {
+    xdot0 = dense_output_xdot1_;
+  } else {
+    context->set_time(t0);
+    context->get_mutable_continuous_state().SetFromVector(x0);
+    CalcTimeDerivatives(*context, dense_output_derivs_.get());
+    xdot0 = dense_output_derivs_->CopyToVector();
+    context->set_time(t1);
+    context->get_mutable_continuous_state().SetFromVector(x1);
+  }
+
+  // Get the time derivatives at the end of the step.
+  CalcTimeDerivatives(*context, dense_output_derivs_.get());
+  dense_output_x1_ = x1;
+  dense_output_xdot1_ = dense_output_derivs_->CopyToVector();
+  const VectorX<T>& xdot1 = dense_output_xdot1_;
+
+  // Form the cubic Hermite polynomial.
+  coefficients->resize(x0.size(), 4);
+  coefficients->col(0) = x0;
+  coefficients->col(1) = h * xdot0;
+  coefficients->col(2) = 3 * (x1 - x0) - h * (2 * xdot0 + xdot1);
+  coefficients->col(3) = 2 * (x0 - x1) + h * (xdot0 + xdot1);
+}
+
 template <class T>
 bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& dt_max) {
   using std::isnan;
@@ -1409,7 +1614,8 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& dt_max) {
   const T current_time = context.get_time();
   VectorBase<T>& xc =
       get_mutable_context()->get_mutable_continuous_state_vector();
-  xc0_save_ = xc.CopyToVector();
+  xc0_save_.resize(xc.size());
+  xc.CopyToPreSizedVector(xc0_save_);
 
   // Set the step size to attempt.
   T step_size_to_attempt = get_ideal_next_step_size();
@@ -1548,25 +1754,34 @@ T IntegratorBase<T>::CalcStateChangeNorm(
   //                 (i.e., modify the System to provide this value).
   const double characteristic_time = 1.0;
 
+  // The substate changes are copied into the leading entries of a scratch
+  // vector that is large enough for any of them, so that no memory is
+  // allocated once it has been sized.
+  const int scratch_size = std::max({dgq.size(), dgv.size(), dgz.size()});
+  if (unweighted_substate_change_.size() < scratch_size)
+    unweighted_substate_change_.resize(scratch_size);
+  auto dv = unweighted_substate_change_.head(dgv.size());
+  auto dz = unweighted_substate_change_.head(dgz.size());
+  auto dq = unweighted_substate_change_.head(dgq.size());
+
   // Computes the infinity norm of the weighted velocity variables.
-  unweighted_substate_change_ = dgv.CopyToVector();
-  T v_nrm = qbar_v_weight.cwiseProduct(unweighted_substate_change_).
+  dgv.CopyToPreSizedVector(dv);
+  T v_nrm = qbar_v_weight.cwiseProduct(dv).
       template lpNorm<Eigen::Infinity>() * characteristic_time;
 
   // Compute the infinity norm of the weighted auxiliary variables.
-  unweighted_substate_change_ = dgz.CopyToVector();
-  T z_nrm = (z_weight.cwiseProduct(unweighted_substate_change_))
+  dgz.CopyToPreSizedVector(dz);
+  T z_nrm = (z_weight.cwiseProduct(dz))
                 .template lpNorm<Eigen::Infinity>();
 
   // Compute N * Wq * dq = N * Wꝗ * N+ * dq.
-  unweighted_substate_change_ = dgq.CopyToVector();
-  system.MapQDotToVelocity(context, unweighted_substate_change_,
-                           pinvN_dq_change_.get());
-  system.MapVelocityToQDot(
-      context, qbar_v_weight.cwiseProduct(pinvN_dq_change_->CopyToVector()),
-      weighted_q_change_.get());
-  T q_nrm = weighted_q_change_->CopyToVector().
-      template lpNorm<Eigen::Infinity>();
+  dgq.CopyToPreSizedVector(dq);
+  system.MapQDotToVelocity(context, dq, pinvN_dq_change_.get());
+  pinvN_dq_change_->CopyToPreSizedVector(dv);
+  dv = qbar_v_weight.cwiseProduct(dv);
+  system.MapVelocityToQDot(context, dv, weighted_q_change_.get());
+  weighted_q_change_->CopyToPreSizedVector(dq);
+  T q_nrm = dq.template lpNorm<Eigen::Infinity>();
   SPDLOG_DEBUG(drake::log(), "dq norm: {}, dv norm: {}, dz norm: {}",
                q_nrm, v_nrm, z_nrm);
 
@@ -1682,6 +1897,7 @@ std::pair<bool, T> IntegratorBase<T>::CalcAdjustedStepSize(
 template <class T>
 typename IntegratorBase<T>::StepResult IntegratorBase<T>::IntegrateAtMost(
     const T& publish_dt, const T& update_dt, const T& boundary_dt) {
+  DRAKE_TRACE_SCOPE("IntegratorBase::IntegrateAtMost");
 
   if (!IntegratorBase<T>::is_initialized())
     throw std::logic_error("Integrator not initialized.");
@@ -1792,6 +2008,9 @@ typename IntegratorBase<T>::StepResult IntegratorBase<T>::IntegrateAtMost(
 
   // If error control is disabled, call the generic stepper. Otherwise, use
   // the error controlled method.
+  VectorX<T> x0;
+  if (dense_output_enabled_)
+    x0 = context_->get_continuous_state().CopyToVector();
   bool full_step = true;
   if (this->get_fixed_step_mode()) {
     T adjusted_dt = dt;
@@ -1805,6 +2024,7 @@ typename IntegratorBase<T>::StepResult IntegratorBase<T>::IntegrateAtMost(
   } else {
     full_step = StepOnceErrorControlledAtMost(dt);
   }
+  CalcDenseOutput(t0, x0);
 
   // Update generic statistics.
   const T actual_dt = context_->get_time() - t0;
@@ -1,7 +1,14 @@
 #include "drake/systems/analysis/lyapunov.h"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include <Eigen/SparseCore>
+
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -12,32 +19,19 @@ namespace systems {
 namespace analysis {
 
 using Eigen::VectorXd;
-using symbolic::Expression;
-
-namespace {
-
-// Helper because AddLinearConstraint throws if I pass in something trivially
-// true.
-void AddLinearConstraintIfNonTrivial(const symbolic::Formula &f,
-                                     solvers::MathematicalProgram *prog) {
-  if (!symbolic::is_true(f)) {
-    prog->AddLinearConstraint(f);
-  }
-}
-
-}  // end namespace
 
 Eigen::VectorXd SampleBasedLyapunovAnalysis(
     const System<double>& system, const Context<double>& context,
     const std::function<VectorX<AutoDiffXd>(const VectorX<AutoDiffXd>& state)>&
         basis_functions,
     const Eigen::Ref<const Eigen::MatrixXd>& state_samples,
-    const Eigen::Ref<const Eigen::VectorXd>& V_zero_state) {
+    const Eigen::Ref<const Eigen::VectorXd>& V_zero_state, int num_threads) {
   const int state_size = state_samples.rows();
   const int num_samples = state_samples.cols();
   DRAKE_DEMAND(state_size > 0);
   DRAKE_DEMAND(num_samples > 0);
   DRAKE_DEMAND(V_zero_state.rows() == state_size);
+  DRAKE_DEMAND(num_threads > 0);
 
   // TODO(russt): handle discrete state.
   DRAKE_DEMAND(context.has_only_continuous_state());
@@ -71,38 +65,82 @@ Eigen::VectorXd SampleBasedLyapunovAnalysis(
   drake::log()->info("Building mathematical program.");
 
   // V(x₀) = 0.
-  AddLinearConstraintIfNonTrivial(params.dot(phi0) == 0, &prog);
-
-  Eigen::VectorXd state(state_size);
-  VectorX<AutoDiffXd> autodiff_state(state_size);
-  auto my_context = context.Clone();
-  auto& context_state = my_context->get_mutable_continuous_state_vector();
-  auto derivatives = system.AllocateTimeDerivatives();
+  if (!phi0.isZero(0.)) {
+    prog.AddLinearEqualityConstraint(phi0.transpose(), Vector1d{0.}, params);
+  }
 
+  // The values of the basis functions, φ(xᵢ), and of their time derivatives,
+  // φ̇(xᵢ) = ∂φ/∂x f(xᵢ), at each sample (one per column). The samples are
+  // split into one contiguous block per thread, each of which evaluates its
+  // samples with its own Context.
+  Eigen::MatrixXd phi_samples(num_parameters, num_samples);
+  Eigen::MatrixXd phidot_samples(num_parameters, num_samples);
+  const int num_blocks = std::min(num_threads, num_samples);
+  const int block_size = (num_samples + num_blocks - 1) / num_blocks;
+  ParallelFor(num_blocks, num_threads, [&](int block) {
+    VectorX<AutoDiffXd> autodiff_state(state_size);
+    auto my_context = context.Clone();
+    auto& context_state = my_context->get_mutable_continuous_state_vector();
+    auto derivatives = system.AllocateTimeDerivatives();
+
+    const int end = std::min((block + 1) * block_size, num_samples);
+    for (int si = block * block_size; si < end; si++) {
+      math::initializeAutoDiff(state_samples.col(si), autodiff_state,
+                               state_size);
+      const VectorX<AutoDiffXd> phi = basis_functions(autodiff_state);
+      DRAKE_DEMAND(phi.size() == num_parameters);
+      phi_samples.col(si) = math::autoDiffToValueMatrix(phi);
+
+      context_state.SetFromVector(state_samples.col(si));
+      system.CalcTimeDerivatives(*my_context, derivatives.get());
+
+      phidot_samples.col(si) =
+          math::autoDiffToGradientMatrix(phi) * derivatives->CopyToVector();
+    }
+  });
+
+  // The constraints of each sample xᵢ, on the variables [p; s]:
+  //   V(xᵢ) = pᵀφ(xᵢ) ≥ 0,
+  //   V̇(xᵢ) = pᵀφ̇(xᵢ) ≤ 0,
+  //   sᵢ - V̇(xᵢ) ≥ 1,
+  //   sᵢ + V̇(xᵢ) ≥ -1, i.e. sᵢ ≥ |V̇(xᵢ) + 1|.
+  // They are assembled directly into one sparse matrix, so that the program
+  // takes memory linear in the number of samples.
+  const double kInf = std::numeric_limits<double>::infinity();
+  const int num_rows = 4 * num_samples;
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(4 * (num_parameters + 1) * num_samples);
+  Eigen::VectorXd lb(num_rows);
+  Eigen::VectorXd ub(num_rows);
   for (int si = 0; si < num_samples; si++) {
-    state = state_samples.col(si);
-
-    math::initializeAutoDiff(state, autodiff_state, state_size);
-    const VectorX<AutoDiffXd> phi = basis_functions(autodiff_state);
-    const Expression V = params.dot(math::autoDiffToValueMatrix(phi));
-
-    context_state.SetFromVector(state);
-    system.CalcTimeDerivatives(*my_context, derivatives.get());
-
-    const Eigen::VectorXd phidot =
-        math::autoDiffToGradientMatrix(phi) * derivatives->CopyToVector();
-    const Expression Vdot = params.dot(phidot);
-
-    // ∀xᵢ, V(xᵢ) ≥ 0
-    AddLinearConstraintIfNonTrivial(V >= 0., &prog);
+    const int row = 4 * si;
+    const int slack_col = num_parameters + si;
+    for (int pi = 0; pi < num_parameters; pi++) {
+      const double phi = phi_samples(pi, si);
+      const double phidot = phidot_samples(pi, si);
+      if (phi != 0.) triplets.emplace_back(row, pi, phi);
+      if (phidot != 0.) {
+        triplets.emplace_back(row + 1, pi, phidot);
+        triplets.emplace_back(row + 2, pi, -phidot);
+        triplets.emplace_back(row + 3, pi, phidot);
+      }
+    }
+    triplets.emplace_back(row + 2, slack_col, 1.);
+    triplets.emplace_back(row + 3, slack_col, 1.);
+    lb.segment<4>(row) << 0., -kInf, 1., -1.;
+    ub.segment<4>(row) << kInf, 0., kInf, kInf;
+  }
+  // Frees the samples before the matrix is built.
+  phi_samples.resize(0, 0);
+  phidot_samples.resize(0, 0);
 
-    // ∀xᵢ, V̇(xᵢ) = ∂V/∂x f(xᵢ) ≤ 0.
-    AddLinearConstraintIfNonTrivial(Vdot <= 0., &prog);
+  Eigen::SparseMatrix<double> A(num_rows, num_parameters + num_samples);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  triplets = std::vector<Eigen::Triplet<double>>();
 
-    // ∀i, sᵢ ≥ |V̇(xᵢ) + 1|.
-    prog.AddLinearConstraint(slack(si) >= Vdot + 1);
-    prog.AddLinearConstraint(slack(si) >= -(Vdot + 1));
-  }
+  solvers::VectorXDecisionVariable vars(num_parameters + num_samples);
+  vars << params, slack;
+  prog.AddLinearConstraint(A, lb, ub, vars);
 
   drake::log()->info("Solving program.");
   const solvers::SolutionResult result = prog.Solve();
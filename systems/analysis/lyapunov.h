@@ -48,6 +48,12 @@ namespace analysis {
 /// @param V_zero_state is a particular state, x₀, where we impose the
 /// condition: V(x₀) = 0.
 ///
+/// @param num_threads is the number of threads among which the samples are
+/// split for the evaluation of the basis functions and the dynamics.  When
+/// it is greater than one, `basis_functions` must be safe to call
+/// concurrently from several threads, and `system` must be safe to evaluate
+/// concurrently with different Contexts.
+///
 /// @return params the VectorXd of parameters, p, that satisfies the Lyapunov
 /// conditions described above.  The resulting Lyapunov function is
 ///   V(x) = ∑ pᵢ φᵢ(x),
@@ -57,7 +63,8 @@ Eigen::VectorXd SampleBasedLyapunovAnalysis(
     const std::function<VectorX<AutoDiffXd>(const VectorX<AutoDiffXd>& state)>&
         basis_functions,
     const Eigen::Ref<const Eigen::MatrixXd>& state_samples,
-    const Eigen::Ref<const Eigen::VectorXd>& V_zero_state);
+    const Eigen::Ref<const Eigen::VectorXd>& V_zero_state,
+    int num_threads = 1);
 
 }  // namespace analysis
 }  // namespace systems
@@ -0,0 +1,71 @@
+#include "drake/systems/analysis/monte_carlo.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+MonteCarloSimulationRunner::MonteCarloSimulationRunner(
+    const System<double>& system, ContextRandomizer randomizer,
+    ScalarSystemFunction output, double final_time)
+    : system_(system),
+      randomizer_(std::move(randomizer)),
+      output_(std::move(output)),
+      final_time_(final_time),
+      num_threads_(GetDefaultNumThreads()) {
+  if (!randomizer_ || !output_) {
+    throw std::logic_error(
+        "MonteCarloSimulationRunner: randomizer and output functions must be "
+        "non-empty.");
+  }
+}
+
+void MonteCarloSimulationRunner::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "MonteCarloSimulationRunner: num_threads must be positive.");
+  }
+  num_threads_ = num_threads;
+}
+
+double MonteCarloSimulationRunner::RunSample(
+    RandomGenerator::result_type seed) const {
+  RandomGenerator generator(seed);
+  std::unique_ptr<Context<double>> context = system_.CreateDefaultContext();
+  randomizer_(system_, &generator, context.get());
+
+  Simulator<double> simulator(system_, std::move(context));
+  simulator.set_target_realtime_rate(target_realtime_rate_);
+  simulator.Initialize();
+  simulator.StepTo(final_time_);
+  return output_(system_, simulator.get_context());
+}
+
+std::vector<double> MonteCarloSimulationRunner::Run(
+    int num_samples, RandomGenerator* generator) const {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(generator != nullptr);
+
+  // Draw all of the seeds up front, serially, so that the results do not
+  // depend on how the samples are scheduled.
+  std::vector<RandomGenerator::result_type> seeds(num_samples);
+  for (auto& seed : seeds) {
+    seed = (*generator)();
+  }
+
+  std::vector<double> results(num_samples);
+  ParallelFor(num_samples, num_threads_, [this, &seeds, &results](int i) {
+    results[i] = RunSample(seeds[i]);
+  });
+  return results;
+}
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
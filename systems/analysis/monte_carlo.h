@@ -0,0 +1,114 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+/// Function that modifies a freshly-created default Context in place to draw
+/// one random sample. Implementations must draw all of their randomness from
+/// the supplied `generator`.
+typedef std::function<void(const System<double>& system,
+                           RandomGenerator* generator,
+                           Context<double>* context)>
+    ContextRandomizer;
+
+/// Function that reduces the final Context of a simulation to a scalar
+/// output (e.g. a cost, or an indicator of success).
+typedef std::function<double(const System<double>& system,
+                             const Context<double>& context)>
+    ScalarSystemFunction;
+
+/// Runs many randomized simulations of a single System and collects a scalar
+/// output of each.
+///
+/// For each sample, the runner allocates a new Context using
+/// System::CreateDefaultContext(), passes it to the ContextRandomizer, runs a
+/// Simulator<double> on it until `final_time` using Simulator::StepTo(), and
+/// finally evaluates the ScalarSystemFunction on the final Context. The
+/// System is shared by all of the samples and is never modified; samples may
+/// be run concurrently on several threads (see
+/// @ref system_thread_safety "System thread safety"), which requires that the
+/// randomizer and output functions also be safe to call concurrently on
+/// distinct Contexts.
+///
+/// Results are deterministic: each sample `i` is given its own generator,
+/// whose seed is the `i`th value drawn from the generator passed to Run(), so
+/// the returned outputs do not depend on the number of threads used.
+///
+/// @code
+///   MonteCarloSimulationRunner runner(
+///       *diagram,
+///       [](const System<double>& system, RandomGenerator* generator,
+///          Context<double>* context) {
+///         system.SetRandomContext(context, generator);
+///       },
+///       [](const System<double>&, const Context<double>& context) {
+///         return context.get_continuous_state_vector().GetAtIndex(0);
+///       },
+///       10.0 /* final time */);
+///   RandomGenerator generator;
+///   const std::vector<double> outputs = runner.Run(1000, &generator);
+/// @endcode
+class MonteCarloSimulationRunner {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MonteCarloSimulationRunner)
+
+  /// Constructs the runner. The `system` is aliased, and must outlive this
+  /// object.
+  /// @param system The System to simulate.
+  /// @param randomizer Draws a random Context for each sample.
+  /// @param output Maps the final Context of each sample to a scalar.
+  /// @param final_time The time to which each sample is simulated.
+  /// @throws std::logic_error if either function is empty.
+  MonteCarloSimulationRunner(const System<double>& system,
+                             ContextRandomizer randomizer,
+                             ScalarSystemFunction output, double final_time);
+
+  /// Sets the maximum number of threads used by Run(). Defaults to
+  /// GetDefaultNumThreads().
+  /// @throws std::logic_error if `num_threads` is not positive.
+  void set_num_threads(int num_threads);
+
+  /// Returns the maximum number of threads used by Run().
+  int get_num_threads() const { return num_threads_; }
+
+  /// Sets the target rate passed to Simulator::set_target_realtime_rate() for
+  /// each sample. Defaults to zero (as fast as possible).
+  void set_target_realtime_rate(double realtime_rate) {
+    target_realtime_rate_ = realtime_rate;
+  }
+
+  /// Runs `num_samples` randomized simulations and returns one output per
+  /// sample, in sample order.
+  /// @param num_samples The number of samples; must be non-negative.
+  /// @param generator The source of per-sample seeds; advanced by exactly
+  ///                  `num_samples` draws.
+  /// @throws std::exception if any sample throws; the first such exception
+  ///         is rethrown once all running samples have finished.
+  std::vector<double> Run(int num_samples, RandomGenerator* generator) const;
+
+  /// Runs the single sample whose generator is seeded with `seed`. This is
+  /// the same computation performed by Run() for each sample, and may be used
+  /// to reproduce an individual sample.
+  double RunSample(RandomGenerator::result_type seed) const;
+
+ private:
+  const System<double>& system_;
+  const ContextRandomizer randomizer_;
+  const ScalarSystemFunction output_;
+  const double final_time_{};
+  int num_threads_{1};
+  double target_realtime_rate_{0.0};
+};
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,307 @@
+#pragma once
+
+/// @file
+/// Template method implementations for radau5_integrator.h.
+/// Most users should only include that file, not this one.
+/// For background, see http://drake.mit.edu/cxx_inl.html.
+
+/* clang-format off to disable clang-format-includes */
+#include "drake/systems/analysis/radau5_integrator.h"
+/* clang-format on */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace systems {
+
+template <class T>
+Radau5Integrator<T>::Radau5Integrator(const System<T>& system,
+                                      Context<T>* context)
+    : ImplicitIntegrator<T>(system, context) {
+  const double sqrt6 = std::sqrt(6.0);
+  A_ << (88 - 7 * sqrt6) / 360, (296 - 169 * sqrt6) / 1800,
+        (-2 + 3 * sqrt6) / 225,
+        (296 + 169 * sqrt6) / 1800, (88 + 7 * sqrt6) / 360,
+        (-2 - 3 * sqrt6) / 225,
+        (16 - sqrt6) / 36, (16 + sqrt6) / 36, 1.0 / 9;
+  c_ << (4 - sqrt6) / 10, (4 + sqrt6) / 10, 1.0;
+
+  // The coefficients of the embedded error estimate ([Hairer, 1996], p. 123).
+  d_ << -(13 + 7 * sqrt6) / 3, (-13 + 7 * sqrt6) / 3, -1.0 / 3;
+}
+
+template <class T>
+void Radau5Integrator<T>::DoInitialize() {
+  using std::isnan;
+
+  // Allocate storage for changes to state variables during Newton-Raphson.
+  dx_state_ = this->get_system().AllocateTimeDerivatives();
+
+  const double kDefaultAccuracy = 1e-3;  // Good for this particular integrator.
+  const double kLoosestAccuracy = 1e-1;  // Loosest accuracy is quite loose.
+
+  // Set an artificial step size target, if not set already.
+  if (isnan(this->get_initial_step_size_target())) {
+    // Verify that maximum step size has been set.
+    if (isnan(this->get_maximum_step_size()))
+      throw std::logic_error("Neither initial step size target nor maximum "
+                                 "step size has been set!");
+
+    this->request_initial_step_size_target(
+        this->get_maximum_step_size());
+  }
+
+  // Sets the working accuracy to a good value.
+  double working_accuracy = this->get_target_accuracy();
+
+  // If the user asks for accuracy that is looser than the loosest this
+  // integrator can provide, use the integrator's loosest accuracy setting
+  // instead.
+  if (isnan(working_accuracy))
+    working_accuracy = kDefaultAccuracy;
+  else if (working_accuracy > kLoosestAccuracy)
+    working_accuracy = kLoosestAccuracy;
+  this->set_accuracy_in_use(working_accuracy);
+
+  // Reset the Jacobian matrix (so that recomputation is forced).
+  this->reset_jacobian();
+  error_matrix_stale_ = true;
+}
+
+// Evaluates the residual of the nonlinear system of a Radau IIA step, i.e.,
+// G(Z) = Z - h (A ⊗ I) F(Z), where Fᵢ(Z) = f(t0 + cᵢh, x(t0) + Zᵢ).
+// @post The time and state of the system's context (stored by the integrator)
+//       will be indeterminate on return.
+template <class T>
+VectorX<T> Radau5Integrator<T>::CalcResidual(const T& t0, const T& dt,
+                                             const VectorX<T>& xt0,
+                                             const VectorX<T>& Z) {
+  Context<T>* context = this->get_mutable_context();
+  const int n = xt0.size();
+
+  // Evaluate the time derivatives at each stage.
+  VectorX<T> F(3 * n);
+  for (int i = 0; i < 3; ++i) {
+    context->set_time(t0 + c_(i) * dt);
+    context->get_mutable_continuous_state().SetFromVector(
+        xt0 + Z.segment(i * n, n));
+    F.segment(i * n, n) = this->CalcTimeDerivativesUsingContext();
+  }
+
+  // Compute the residual.
+  VectorX<T> G = Z;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j)
+      G.segment(i * n, n) -= (A_(i, j) * dt) * F.segment(j * n, n);
+  }
+
+  return G;
+}
+
+// Solves the nonlinear system of a Radau IIA step using the simplified
+// Newton-Raphson method.
+// @param t0 the time at the beginning of the step.
+// @param dt the integration step size to attempt.
+// @param xt0 the state at the beginning of the step.
+// @param [in,out] Z the starting guess for the stage increments; the stage
+//        increments that solve the nonlinear system on successful return.
+// @param trial the attempt for this approach (1-4). StepRadau() uses more
+//        computationally expensive methods as the trial numbers increase.
+// @returns `true` if the method was successfully able to solve the nonlinear
+//          system for step size @p dt (or `false` otherwise).
+// @post The time and state of the system's context (stored by the integrator)
+//       will be indeterminate on return.
+template <class T>
+bool Radau5Integrator<T>::StepRadau(const T& t0, const T& dt,
+                                    const VectorX<T>& xt0, VectorX<T>* Z,
+                                    int trial) {
+  using std::max;
+
+  // Verify the trial number is valid.
+  DRAKE_ASSERT(trial >= 1 && trial <= 4);
+  const int n = xt0.size();
+  DRAKE_ASSERT(Z && Z->size() == 3 * n);
+
+  SPDLOG_DEBUG(drake::log(), "StepRadau() entered for t={}, h={}, trial={}",
+               t0, dt, trial);
+
+  // Calculate Jacobian and iteration matrices (and factorizations), as needed.
+  const auto compute_and_factor_iteration_matrix =
+      [this, dt](const MatrixX<T>& J,
+          typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+        this->ComputeAndFactorIterationMatrix(J, A_, dt, iteration_matrix);
+        error_matrix_stale_ = true;
+      };
+  if (!this->MaybeFreshenMatrices(t0, xt0, trial,
+                                  compute_and_factor_iteration_matrix,
+                                  &iteration_matrix_)) {
+    this->set_last_call_failed(true);
+    return false;
+  }
+
+  // Initialize the "last" state update norm; this will be used to detect
+  // convergence.
+  T last_dx_norm = std::numeric_limits<double>::infinity();
+
+  // The maximum number of Newton-Raphson iterations to take before declaring
+  // failure ([Hairer, 1996], p. 121).
+  const int max_iterations = 10;
+
+  // Do the Newton-Raphson iterations.
+  for (int i = 0; i < max_iterations; ++i) {
+    // Update the number of Newton-Raphson iterations.
+    this->increment_num_newton_raphson_iterations();
+
+    // Compute the update using the equation A*dZ = -G(Z), where A is the
+    // iteration matrix. Using nA as the negation of the iteration matrix, we
+    // instead solve nA*dZ = G(Z).
+    const VectorX<T> dZ = iteration_matrix_.Solve(
+        CalcResidual(t0, dt, xt0, *Z));
+    *Z += dZ;
+
+    // Get the largest infinity norm of the weighted stage updates.
+    T dx_norm(0);
+    for (int j = 0; j < 3; ++j) {
+      dx_state_->get_mutable_vector().SetFromVector(dZ.segment(j * n, n));
+      dx_norm = max(dx_norm, this->CalcStateChangeNorm(*dx_state_));
+    }
+
+    // Check for Newton-Raphson convergence.
+    const typename ImplicitIntegrator<T>::ConvergenceStatus status =
+        this->CheckNewtonConvergence(i, dx_norm, last_dx_norm);
+    if (status == ImplicitIntegrator<T>::ConvergenceStatus::kConverged) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson converged for h = {}", dt);
+      this->set_last_call_failed(false);
+      return true;
+    }
+    if (status == ImplicitIntegrator<T>::ConvergenceStatus::kDiverged) {
+      SPDLOG_DEBUG(drake::log(), "Newton-Raphson divergence detected for "
+          "h={}", dt);
+      break;
+    }
+
+    // Update the norm of the state update.
+    last_dx_norm = dx_norm;
+  }
+
+  SPDLOG_DEBUG(drake::log(), "StepRadau() convergence failed");
+
+  // If Jacobian and iteration matrix factorizations are not reused, there
+  // is nothing else we can try.
+  if (!this->get_reuse()) {
+    this->set_last_call_failed(true);
+    return false;
+  }
+
+  // Try StepRadau again from the starting guess, freshening Jacobians and
+  // iteration matrix factorizations as helpful.
+  Z->setZero();
+  return StepRadau(t0, dt, xt0, Z, trial + 1);
+}
+
+// Computes the error estimate of [Hairer, 1996], p. 123:
+// err = (I - γ₀h J)⁻¹ (γ₀h f(t0, x(t0)) + γ₀ (d₁Z₁ + d₂Z₂ + d₃Z₃)),
+// which is the difference between the Radau IIA solution and that of an
+// embedded third order method (with one explicit stage), filtered through
+// (I - γ₀h J)⁻¹ to keep it bounded for stiff problems.
+// @param dt the integration step size.
+// @param dx0 the time derivatives at the beginning of the step.
+// @param Z the stage increments of the step.
+template <class T>
+void Radau5Integrator<T>::CalcErrorEstimate(const T& dt,
+                                            const VectorX<T>& dx0,
+                                            const VectorX<T>& Z) {
+  // γ₀ is the real eigenvalue of the Runge-Kutta matrix.
+  const double gamma0 = (6 + std::cbrt(81.0) - std::cbrt(9.0)) / 30;
+  const int n = dx0.size();
+
+  // Refactor the negation of the error estimation matrix, γ₀h J - I, if the
+  // step size or the Jacobian matrix has changed.
+  if (error_matrix_stale_ || error_matrix_dt_ != dt) {
+    this->ComputeAndFactorIterationMatrix(
+        this->get_jacobian(), Eigen::MatrixXd::Constant(1, 1, gamma0), dt,
+        &error_matrix_);
+    error_matrix_dt_ = dt;
+    error_matrix_stale_ = false;
+  }
+
+  VectorX<T> rhs = (gamma0 * dt) * dx0;
+  for (int i = 0; i < 3; ++i)
+    rhs += (gamma0 * d_(i)) * Z.segment(i * n, n);
+  err_est_vec_ = -error_matrix_.Solve(rhs);
+
+  // Update the caller-accessible error estimate.
+  this->get_mutable_error_estimate()->get_mutable_vector().
+      SetFromVector(err_est_vec_);
+}
+
+/// Takes a given step of the requested size, if possible.
+/// @returns `true` if successful and `false` otherwise.
+/// @post the time and continuous state will be advanced only if `true` is
+///       returned.
+template <class T>
+bool Radau5Integrator<T>::DoStep(const T& dt) {
+  // Save the current time and state.
+  Context<T>* context = this->get_mutable_context();
+  const T t0 = context->get_time();
+  const VectorX<T> xt0 = context->get_continuous_state().CopyToVector();
+
+  SPDLOG_DEBUG(drake::log(), "Radau5 DoStep(h={}) t={}", dt, t0);
+
+  // Compute the derivative at xt0. NOTE: the derivative is calculated at this
+  // point (early on in the integration process) in order to reuse the
+  // derivative evaluation, via the cache, from the last integration step (if
+  // possible).
+  const VectorX<T> dx0 = this->CalcTimeDerivativesUsingContext();
+
+  // Solve for the stage increments, starting from zero [Hairer, 1996], p. 120.
+  VectorX<T> Z = VectorX<T>::Zero(3 * xt0.size());
+  if (!StepRadau(t0, dt, xt0, &Z)) {
+    context->set_time(t0);
+    context->get_mutable_continuous_state().SetFromVector(xt0);
+    return false;
+  }
+
+  // The method is stiffly accurate, so the solution is the last stage.
+  context->set_time(t0 + dt);
+  context->get_mutable_continuous_state().SetFromVector(
+      xt0 + Z.tail(xt0.size()));
+
+  CalcErrorEstimate(dt, dx0, Z);
+  Z_ = std::move(Z);
+  return true;
+}
+
+// Computes the coefficients of the collocation polynomial of the last step,
+// u(t0 + s h) = x(t0) + a₁s + a₂s² + a₃s³, from the conditions
+// u(t0 + cᵢh) = x(t0) + Zᵢ.
+template <class T>
+void Radau5Integrator<T>::DoCalcDenseOutput(const T&, const VectorX<T>& x0,
+                                            MatrixX<T>* coefficients) {
+  const int n = x0.size();
+  DRAKE_DEMAND(Z_.size() == 3 * n);
+  Eigen::Matrix3d V;
+  for (int i = 0; i < 3; ++i) {
+    V(i, 0) = c_(i);
+    V(i, 1) = c_(i) * c_(i);
+    V(i, 2) = c_(i) * c_(i) * c_(i);
+  }
+  const Eigen::Matrix3d V_inv = V.inverse();
+
+  coefficients->resize(n, 4);
+  coefficients->col(0) = x0;
+  for (int k = 0; k < 3; ++k) {
+    coefficients->col(k + 1).setZero();
+    for (int i = 0; i < 3; ++i)
+      coefficients->col(k + 1) += V_inv(k, i) * Z_.segment(i * n, n);
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,11 @@
+#include "drake/systems/analysis/radau5_integrator.h"
+#include "drake/systems/analysis/radau5_integrator-inl.h"
+
+#include "drake/common/autodiff.h"
+
+namespace drake {
+namespace systems {
+template class Radau5Integrator<double>;
+template class Radau5Integrator<AutoDiffXd>;
+}  // namespace systems
+}  // namespace drake
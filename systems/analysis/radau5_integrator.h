@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/implicit_integrator.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * A fifth-order, three-stage Radau IIA (fully implicit Runge-Kutta)
+ * integrator with third order error estimation.
+ * @tparam T The vector element type, which must be a valid Eigen scalar.
+ *
+ * This class uses Drake's `-inl.h` pattern.  When seeing linker errors from
+ * this class, please refer to http://drake.mit.edu/cxx_inl.html.
+ *
+ * Instantiated templates for the following kinds of T's are provided:
+ * - double
+ * - AutoDiffXd
+ *
+ * The Butcher tableau for this integrator follows:
+ * <pre>
+ * (4-√6)/10 | (88-7√6)/360     (296-169√6)/1800  (-2+3√6)/225
+ * (4+√6)/10 | (296+169√6)/1800 (88+7√6)/360      (-2-3√6)/225
+ * 1         | (16-√6)/36       (16+√6)/36        1/9
+ * ---------------------------------------------------------------------------
+ *             (16-√6)/36       (16+√6)/36        1/9
+ * </pre>
+ * Since the last row of the Runge-Kutta matrix equals the weights (the method
+ * is "stiffly accurate"), the solution at t+h is the state at the last stage.
+ * Like implicit Euler, the method is L-Stable (see ImplicitEulerIntegrator),
+ * but its order permits much larger steps for a given accuracy on smooth
+ * problems.
+ *
+ * Each step solves the nonlinear system (of `3n` dimensions, where `n` is the
+ * number of state variables) for the stage increments `Z = [Z₁; Z₂; Z₃]`:<pre>
+ * Z - h (A ⊗ I) F(Z) = 0
+ * </pre>
+ * where `Fᵢ(Z) = f(t + cᵢh, x(t) + Zᵢ)`, using simplified Newton-Raphson
+ * iterations with the Jacobian matrix `J` of `f` taken at the beginning of
+ * the step. Jacobian matrices and the factorization of the iteration matrix
+ * `I - h (A ⊗ J)` are reused across steps as described in
+ * ImplicitIntegrator. This implementation factors the `3n × 3n` iteration
+ * matrix directly rather than transforming it into one real and one complex
+ * `n × n` system [Hairer, 1996], trading efficiency for simplicity.
+ *
+ * The dense output of this integrator (see
+ * IntegratorBase::set_dense_output_enabled()) is the collocation polynomial
+ * of the step, i.e., the cubic polynomial through the state at the beginning
+ * of the step and the states at the three stages, which requires no
+ * additional derivative evaluations.
+ *
+ * The error estimate is that of [Hairer, 1996], p. 123, which is the
+ * difference between the Radau IIA solution and that of an embedded third
+ * order method, filtered through `(I - γ₀h J)⁻¹` so that the estimate remains
+ * bounded for stiff problems.
+ *
+ * - [Hairer, 1996]   E. Hairer and G. Wanner. Solving Ordinary Differential
+ *                    Equations II (Stiff and Differential-Algebraic Problems).
+ *                    Springer, 1996.
+ */
+template <class T>
+class Radau5Integrator final : public ImplicitIntegrator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Radau5Integrator)
+
+  ~Radau5Integrator() override = default;
+
+  explicit Radau5Integrator(const System<T>& system,
+                            Context<T>* context = nullptr);
+
+  /// The integrator supports error estimation.
+  bool supports_error_estimation() const override { return true; }
+
+  /// This integrator provides fourth order error estimates (the local error
+  /// of the embedded third order method).
+  int get_error_estimate_order() const override { return 4; }
+
+ private:
+  void DoInitialize() override;
+  bool DoStep(const T& dt) override;
+  void DoCalcDenseOutput(const T& t0, const VectorX<T>& x0,
+                         MatrixX<T>* coefficients) override;
+  bool StepRadau(const T& t0, const T& dt, const VectorX<T>& xt0,
+                 VectorX<T>* Z, int trial = 1);
+  VectorX<T> CalcResidual(const T& t0, const T& dt, const VectorX<T>& xt0,
+                          const VectorX<T>& Z);
+  void CalcErrorEstimate(const T& dt, const VectorX<T>& dx0,
+                         const VectorX<T>& Z);
+
+  // The Runge-Kutta matrix, the stage times (as fractions of the step size),
+  // and the coefficients for the embedded error estimate.
+  Eigen::Matrix3d A_;
+  Eigen::Vector3d c_;
+  Eigen::Vector3d d_;
+
+  // The continuous state update vector used during Newton-Raphson.
+  std::unique_ptr<ContinuousState<T>> dx_state_;
+
+  // The factorization of the *negation* of the iteration matrix,
+  // h (A ⊗ J) - I.
+  typename ImplicitIntegrator<T>::IterationMatrix iteration_matrix_;
+
+  // The factorization of the *negation* of the error estimation matrix,
+  // γ₀h J - I, along with the step size for which it was formed and whether
+  // the Jacobian matrix has changed since.
+  typename ImplicitIntegrator<T>::IterationMatrix error_matrix_;
+  T error_matrix_dt_{0};
+  bool error_matrix_stale_{true};
+
+  // Vector used in error estimate calculations.
+  VectorX<T> err_est_vec_;
+
+  // The stage increments of the last step taken.
+  VectorX<T> Z_;
+};
+}  // namespace systems
+}  // namespace drake
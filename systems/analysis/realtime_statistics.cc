@@ -0,0 +1,57 @@
+#include "drake/systems/analysis/realtime_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace drake {
+namespace systems {
+
+RealtimeStatistics::RealtimeStatistics(double bin_width, int num_bins)
+    : bin_width_(bin_width) {
+  if (!(bin_width > 0) || num_bins < 1) {
+    throw std::logic_error(
+        "RealtimeStatistics: bin_width and num_bins must be positive.");
+  }
+  latency_histogram_.resize(num_bins, 0);
+  jitter_histogram_.resize(num_bins, 0);
+}
+
+int RealtimeStatistics::CalcBin(double value) const {
+  const double bin = std::floor(value / bin_width_);
+  const int last_bin = static_cast<int>(latency_histogram_.size()) - 1;
+  return bin >= last_bin ? last_bin : static_cast<int>(bin);
+}
+
+void RealtimeStatistics::AddEvent(double latency, bool skipped) {
+  latency = std::max(latency, 0.0);
+  ++latency_histogram_[CalcBin(latency)];
+  if (num_events_ > 0) {
+    const double jitter = std::abs(latency - last_latency_);
+    ++jitter_histogram_[CalcBin(jitter)];
+    max_jitter_ = std::max(max_jitter_, jitter);
+  }
+  ++num_events_;
+  if (skipped) ++num_skipped_events_;
+  sum_latency_ += latency;
+  max_latency_ = std::max(max_latency_, latency);
+  last_latency_ = latency;
+}
+
+void RealtimeStatistics::Clear() {
+  std::fill(latency_histogram_.begin(), latency_histogram_.end(), 0);
+  std::fill(jitter_histogram_.begin(), jitter_histogram_.end(), 0);
+  num_events_ = 0;
+  num_skipped_events_ = 0;
+  sum_latency_ = 0.0;
+  max_latency_ = 0.0;
+  max_jitter_ = 0.0;
+  last_latency_ = 0.0;
+}
+
+double RealtimeStatistics::get_mean_latency() const {
+  return num_events_ == 0 ? 0.0 : sum_latency_ / num_events_;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/// Accumulates the latencies with which a Simulator running in real time
+/// (see Simulator::set_target_realtime_rate()) handles its timed events, to
+/// aid in diagnosing missed deadlines.
+///
+/// The *latency* of an event is the real time at which the Simulator began
+/// handling it minus its deadline, which is the real time corresponding to
+/// the simulated time at which the event is due. The *jitter* is the absolute
+/// difference between the latencies of consecutive events. Both are measured
+/// in seconds on a monotonic clock, and are accumulated into histograms of
+/// `num_bins` bins, each `bin_width` seconds wide, starting at zero; the last
+/// bin also counts all larger values. Since events are never handled early,
+/// latencies are non-negative.
+class RealtimeStatistics {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RealtimeStatistics)
+
+  /// Constructs empty statistics with the given histogram geometry.
+  /// @throws std::logic_error if `bin_width` or `num_bins` is not positive.
+  explicit RealtimeStatistics(double bin_width = 1e-4, int num_bins = 100);
+
+  /// Records the handling of an event with the given `latency` in seconds
+  /// (negative latencies are clamped to zero). If `skipped` is `true`, the
+  /// event was late and was not handled.
+  void AddEvent(double latency, bool skipped = false);
+
+  /// Discards all recorded events, keeping the histogram geometry.
+  void Clear();
+
+  /// Returns the number of events recorded (including skipped events).
+  int64_t get_num_events() const { return num_events_; }
+
+  /// Returns the number of events that were skipped because they were late.
+  int64_t get_num_skipped_events() const { return num_skipped_events_; }
+
+  /// Returns the largest latency recorded, or zero if there are no events.
+  double get_max_latency() const { return max_latency_; }
+
+  /// Returns the mean latency, or zero if there are no events.
+  double get_mean_latency() const;
+
+  /// Returns the largest jitter recorded, or zero if there are fewer than two
+  /// events.
+  double get_max_jitter() const { return max_jitter_; }
+
+  /// Returns the width of each histogram bin in seconds.
+  double get_bin_width() const { return bin_width_; }
+
+  /// Returns the latency histogram; entry `i` counts the events whose
+  /// latency lies in `[i w, (i + 1) w)`, where `w` is get_bin_width().
+  const std::vector<int64_t>& get_latency_histogram() const {
+    return latency_histogram_;
+  }
+
+  /// Returns the jitter histogram, binned as get_latency_histogram(). It
+  /// holds one fewer entry in total than there are events.
+  const std::vector<int64_t>& get_jitter_histogram() const {
+    return jitter_histogram_;
+  }
+
+ private:
+  int CalcBin(double value) const;
+
+  double bin_width_{};
+  std::vector<int64_t> latency_histogram_;
+  std::vector<int64_t> jitter_histogram_;
+  int64_t num_events_{0};
+  int64_t num_skipped_events_{0};
+  double sum_latency_{0.0};
+  double max_latency_{0.0};
+  double max_jitter_{0.0};
+  double last_latency_{0.0};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -58,7 +58,9 @@ bool RungeKutta3Integrator<T>::DoStep(const T& dt) {
   // Find the continuous state xc within the Context, just once.
   VectorBase<T>& xc = this->get_mutable_context()
                           ->get_mutable_continuous_state_vector();
-  const VectorX<T> xt0 = xc.CopyToVector();
+  xt0_.resize(xc.size());
+  xc.CopyToPreSizedVector(xt0_);
+  const VectorX<T>& xt0 = xt0_;
 
   // Setup ta and tb.
   T ta = this->get_context().get_time();
@@ -84,6 +84,9 @@ class RungeKutta3Integrator final : public IntegratorBase<T> {
   // Vector used in error estimate calculations.
   VectorX<T> err_est_vec_;
 
+  // The continuous state at the start of a step.
+  VectorX<T> xt0_;
+
   // These are pre-allocated temporaries for use by integration. They store
   // the derivatives computed at various points within the integration
   // interval.
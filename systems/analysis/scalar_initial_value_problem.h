@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
@@ -124,6 +125,56 @@ class ScalarInitialValueProblem {
     return this->vector_ivp_->Solve(tf, ToVectorIVPSpecifiedValues(values))[0];
   }
 
+  /// Solves the IVP on the interval [t₀, @p tf] and returns the solution as a
+  /// 1 × 1 trajectory, as InitialValueProblem::DenseSolve() does.
+  ///
+  /// @param tf The time to solve the IVP up to.
+  /// @param values The specified values for the IVP.
+  /// @return The IVP solution x(t; 𝐤) for x(t₀; 𝐤) = x₀ and t ∈ [t₀, @p tf].
+  /// @pre Given @p tf must be larger than the specified initial time t₀
+  ///      (either given or default).
+  /// @pre If given, the dimension of the parameter vector @p values.k
+  ///      must match that of the parameter vector in the default specified
+  ///      values given on construction.
+  /// @throw std::logic_error if preconditions are not met.
+  trajectories::PiecewisePolynomial<T> DenseSolve(
+      const T& tf, const SpecifiedValues& values = {}) const {
+    return this->vector_ivp_->DenseSolve(tf,
+                                         ToVectorIVPSpecifiedValues(values));
+  }
+
+  /// Solves the IVP for time @p tf once for each element of @p values, on up
+  /// to @p num_threads threads, as InitialValueProblem::SolveBatch() does.
+  ///
+  /// @param tf The time to solve the IVP for.
+  /// @param values The specified values for each IVP to solve.
+  /// @param num_threads The maximum number of threads to use; must be
+  ///                    positive.
+  /// @return The IVP solution x(@p tf; 𝐤) for each element of @p values, in
+  ///         the same order.
+  /// @pre The preconditions of Solve() hold for each element of @p values.
+  /// @pre The ODE function given on construction may be called concurrently
+  ///      from several threads.
+  /// @throw std::logic_error if preconditions are not met.
+  std::vector<T> SolveBatch(const T& tf,
+                            const std::vector<SpecifiedValues>& values,
+                            int num_threads) const {
+    std::vector<typename InitialValueProblem<T>::SpecifiedValues>
+        vector_ivp_values;
+    vector_ivp_values.reserve(values.size());
+    for (const SpecifiedValues& problem_values : values) {
+      vector_ivp_values.push_back(ToVectorIVPSpecifiedValues(problem_values));
+    }
+    const std::vector<VectorX<T>> solutions =
+        this->vector_ivp_->SolveBatch(tf, vector_ivp_values, num_threads);
+    std::vector<T> result;
+    result.reserve(solutions.size());
+    for (const VectorX<T>& solution : solutions) {
+      result.push_back(solution[0]);
+    }
+    return result;
+  }
+
   /// Resets the internal integrator instance by in-place
   /// construction of the given integrator type.
   ///
@@ -1,28 +1,69 @@
 #include "drake/systems/analysis/simulator.h"
 
 #include <chrono>
+#include <fstream>
+#include <functional>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/extract_double.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
 namespace systems {
 
 template <typename T>
-void Simulator<T>::PauseIfTooFast() const {
-  if (target_realtime_rate_ <= 0) return;  // Run at full speed.
+void Simulator<T>::WriteProfileReport() const {
+  const auto diagram = dynamic_cast<const Diagram<T>*>(&system_);
+  if (diagram == nullptr || !diagram->get_profiling_enabled()) return;
+  std::ofstream out(profile_report_path_);
+  if (!out) {
+    throw std::runtime_error("Simulator: unable to open profile report file " +
+                             profile_report_path_ + ".");
+  }
+  diagram->get_profile()->WriteFoldedStacks(&out);
+}
+
+template <typename T>
+typename Simulator<T>::TimePoint Simulator<T>::CalcDesiredRealtime() const {
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
   const double simtime_passed = simtime_now - initial_simtime_;
-  const TimePoint desired_realtime =
-      initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
+  return initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
+}
+
+template <typename T>
+void Simulator<T>::PauseIfTooFast() const {
+  if (target_realtime_rate_ <= 0) return;  // Run at full speed.
+  const TimePoint desired_realtime = CalcDesiredRealtime();
   // TODO(sherm1): Could add some slop to now() and not sleep if
   // we are already close enough. But what is a reasonable value?
   if (desired_realtime > Clock::now())
     std::this_thread::sleep_until(desired_realtime);
 }
 
+template <typename T>
+bool Simulator<T>::CheckTimedEventDeadline() {
+  if (target_realtime_rate_ <= 0) return true;  // No deadlines.
+  const double latency = Duration(Clock::now() - CalcDesiredRealtime()).count();
+  const bool late = latency > late_event_tolerance_;
+  const bool skip = late && late_event_policy_ == LateEventPolicy::kSkip;
+  realtime_statistics_.AddEvent(latency, skip);
+  if (late && late_event_policy_ == LateEventPolicy::kThrow) {
+    std::ostringstream str;
+    str << "Simulator: timed events due at simulated time "
+        << ExtractDoubleOrThrow(get_context().get_time()) << " were reached "
+        << latency << " s late, which exceeds the late event tolerance of "
+        << late_event_tolerance_ << " s.";
+    throw std::runtime_error(str.str());
+  }
+  return !skip;
+}
+
 template <typename T>
 double Simulator<T>::get_actual_realtime_rate() const {
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
@@ -39,11 +80,99 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  realtime_statistics_.Clear();
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
   initial_realtime_ = Clock::now();
 }
 
+template <typename T>
+void Simulator<T>::BuildPeriodicEventSchedule() {
+  // Gathers the leaf systems depth first, in subsystem order.
+  std::vector<const System<T>*> leaves;
+  std::function<void(const System<T>&)> gather_leaves =
+      [&](const System<T>& system) {
+        const auto* diagram = dynamic_cast<const Diagram<T>*>(&system);
+        if (diagram == nullptr) {
+          leaves.push_back(&system);
+          return;
+        }
+        for (const System<T>* subsystem : diagram->GetSystems())
+          gather_leaves(*subsystem);
+      };
+  gather_leaves(system_);
+
+  const auto* root = dynamic_cast<const Diagram<T>*>(&system_);
+  scheduled_periodic_events_.clear();
+  for (const System<T>* leaf : leaves) {
+    CompositeEventCollection<T>* collection =
+        root == nullptr ? timed_events_.get()
+                        : &root->GetMutableSubsystemCompositeEventCollection(
+                              *leaf, timed_events_.get());
+    for (const auto& timing_and_events : leaf->GetPeriodicEvents()) {
+      for (const Event<T>* event : timing_and_events.second) {
+        scheduled_periodic_events_.push_back(
+            {timing_and_events.first, event, collection});
+      }
+    }
+  }
+
+  periodic_event_queue_ = {};
+  periodic_event_queue_time_ = context_->get_time();
+  for (int i = 0; i < static_cast<int>(scheduled_periodic_events_.size());
+       ++i) {
+    periodic_event_queue_.emplace(
+        leaf_system_detail::GetNextSampleTime(
+            scheduled_periodic_events_[i].timing, periodic_event_queue_time_),
+        i);
+  }
+  firing_periodic_events_.reserve(scheduled_periodic_events_.size());
+}
+
+template <typename T>
+T Simulator<T>::CalcNextScheduledUpdateTime(
+    CompositeEventCollection<T>* events) {
+  events->Clear();
+  const T& time = context_->get_time();
+
+  // The queued times are only valid going forward; e.g., restoring a
+  // checkpoint may move the time back.
+  if (time < periodic_event_queue_time_) {
+    BuildPeriodicEventSchedule();
+  }
+
+  // Advances the events that came due since the last call.
+  while (!periodic_event_queue_.empty() &&
+         periodic_event_queue_.top().first <= time) {
+    const int i = periodic_event_queue_.top().second;
+    periodic_event_queue_.pop();
+    periodic_event_queue_.emplace(
+        leaf_system_detail::GetNextSampleTime(
+            scheduled_periodic_events_[i].timing, time),
+        i);
+  }
+  periodic_event_queue_time_ = time;
+  if (periodic_event_queue_.empty())
+    return std::numeric_limits<double>::infinity();
+
+  // Writes out the events that fire next, which remain queued at that time
+  // until it is reached. Ties are popped in increasing index, i.e., in
+  // subsystem order.
+  const T next_time = periodic_event_queue_.top().first;
+  firing_periodic_events_.clear();
+  while (!periodic_event_queue_.empty() &&
+         periodic_event_queue_.top().first == next_time) {
+    firing_periodic_events_.push_back(periodic_event_queue_.top().second);
+    periodic_event_queue_.pop();
+  }
+  for (int i : firing_periodic_events_) {
+    const ScheduledPeriodicEvent& scheduled = scheduled_periodic_events_[i];
+    scheduled.event->add_to_composite(scheduled.collection);
+    periodic_event_queue_.emplace(next_time, i);
+  }
+  return next_time;
+}
+
 template class Simulator<double>;
 template class Simulator<AutoDiffXd>;
 
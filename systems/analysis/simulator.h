@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <chrono>
 #include <limits>
+#include <functional>
 #include <memory>
+#include <queue>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -13,7 +16,9 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace.h"
 #include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/realtime_statistics.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
@@ -22,6 +27,21 @@
 namespace drake {
 namespace systems {
 
+/// The ways in which a Simulator running in real time (see
+/// Simulator::set_target_realtime_rate()) can handle timed events that are
+/// reached later than their deadlines by more than the tolerance set with
+/// Simulator::set_late_event_tolerance().
+enum class LateEventPolicy {
+  /// Handle the late events, then run as fast as possible until the
+  /// simulation has caught up with real time. This is the default.
+  kCatchUp,
+  /// Do not handle the late timed events (witness-triggered events are
+  /// always handled), and continue as for kCatchUp.
+  kSkip,
+  /// Throw a std::runtime_error.
+  kThrow,
+};
+
 /// A forward dynamics solver for hybrid dynamic systems represented by
 /// `System<T>` objects. Starting with an initial Context for a given System,
 /// %Simulator advances time and produces a series of Context values that forms
@@ -64,6 +84,8 @@ namespace systems {
 /// Other instantiations are permitted but take longer to compile.
 // TODO(sherm1) When API stabilizes, should list the methods above in addition
 // to describing them.
+class ContextSerializer;
+
 template <typename T>
 class Simulator {
  public:
@@ -131,8 +153,11 @@ class Simulator {
   ///   run twice as fast as real time, 0.5 for half speed, etc. Zero or
   ///   negative restores the rate to its default of 0, meaning the simulation
   ///   will proceed as fast as possible.
-  // TODO(sherm1): Provide options for issuing a warning or aborting the
-  // simulation if the desired rate cannot be achieved.
+  ///
+  /// While a rate is set, the latency with which each timed event is handled
+  /// relative to its real-time deadline is recorded (see
+  /// get_realtime_statistics()), and events that are handled too late are
+  /// treated as directed by set_late_event_policy().
   void set_target_realtime_rate(double realtime_rate) {
     target_realtime_rate_ = std::max(realtime_rate, 0.);
   }
@@ -165,6 +190,61 @@ class Simulator {
   /// @see set_target_realtime_rate()
   double get_actual_realtime_rate() const;
 
+  /// Sets how timed events (publishes, discrete updates, and unrestricted
+  /// updates) that are reached too late relative to real time are handled.
+  /// This has no effect unless a realtime rate has been set with
+  /// set_target_realtime_rate().
+  void set_late_event_policy(LateEventPolicy policy) {
+    late_event_policy_ = policy;
+  }
+
+  /// Returns the policy for late timed events. The default is
+  /// LateEventPolicy::kCatchUp.
+  LateEventPolicy get_late_event_policy() const { return late_event_policy_; }
+
+  /// Sets the latency in seconds beyond which a timed event is considered
+  /// late by the policy set with set_late_event_policy(). The default is
+  /// zero.
+  /// @throws std::logic_error if `tolerance` is negative.
+  void set_late_event_tolerance(double tolerance) {
+    if (tolerance < 0)
+      throw std::logic_error("Late event tolerance must be non-negative.");
+    late_event_tolerance_ = tolerance;
+  }
+
+  /// Returns the latency beyond which a timed event is considered late.
+  double get_late_event_tolerance() const { return late_event_tolerance_; }
+
+  /// Returns the latencies with which timed events have been handled since
+  /// the last Initialize() or ResetStatistics() call, measured against the
+  /// real time at which each is due given the target realtime rate. Events
+  /// are only recorded while a realtime rate is set.
+  const RealtimeStatistics& get_realtime_statistics() const {
+    return realtime_statistics_;
+  }
+
+  /// Returns a mutable reference to the realtime statistics, e.g., to change
+  /// the geometry of their histograms.
+  RealtimeStatistics& get_mutable_realtime_statistics() {
+    return realtime_statistics_;
+  }
+
+  /// Sets the path of a file to which the profile of the System under
+  /// simulation is written, in the folded stacks format used by flame graph
+  /// tools (see DiagramProfile::WriteFoldedStacks()), at the end of every
+  /// StepTo() call. The file is overwritten each time. Nothing is written
+  /// unless the System is a Diagram whose profiling is enabled (see
+  /// Diagram::set_profiling_enabled()). An empty path (the default) disables
+  /// the report.
+  void set_profile_report_path(const std::string& path) {
+    profile_report_path_ = path;
+  }
+
+  /// Returns the path set with set_profile_report_path().
+  const std::string& get_profile_report_path() const {
+    return profile_report_path_;
+  }
+
   /// Sets whether the simulation should invoke Publish on the System under
   /// simulation during every time step. If enabled, Publish will be invoked
   /// after discrete updates and before continuous integration. Regardless of
@@ -174,6 +254,29 @@ class Simulator {
     publish_every_time_step_ = publish;
   }
 
+  /// Sets whether StepTo() finds the next timed events from a schedule of the
+  /// periodic events of the System, instead of calling
+  /// System::CalcNextUpdateTime() at every step. The schedule is a priority
+  /// queue of the next time of each periodic event of the leaf systems, built
+  /// in Initialize() and advanced as the events come due, so that a step only
+  /// touches the events that fire rather than every subsystem.
+  ///
+  /// Only enable this if every timed event of the System is a periodic event
+  /// declared through LeafSystem::DeclarePeriodicEvent() or its variants,
+  /// since the schedule does not consult overrides of
+  /// System::DoCalcNextUpdateTime(). Simultaneous events of one leaf system
+  /// are dispatched grouped by their period and offset. Disabled by default;
+  /// a change takes effect at the next Initialize().
+  void set_use_periodic_event_schedule(bool use) {
+    use_periodic_event_schedule_ = use;
+  }
+
+  /// Returns whether StepTo() uses a schedule of the periodic events.
+  /// @see set_use_periodic_event_schedule()
+  bool get_use_periodic_event_schedule() const {
+    return use_periodic_event_schedule_;
+  }
+
   /// Sets whether the simulation should invoke Publish in Initialize().
   void set_publish_at_initialization(bool publish) {
     publish_at_initialization_ = publish;
@@ -294,6 +397,12 @@ class Simulator {
   /// working minimum tolerance (see
   /// IntegratorBase::get_working_minimum_step_size());
   ///
+  /// If the integrator computes dense output (see
+  /// IntegratorBase::set_dense_output_enabled()), the states within the
+  /// interval are evaluated from the interpolant of the step taken over the
+  /// interval rather than by repeatedly integrating from its start, and the
+  /// continuous state at the isolated time is that of the interpolant.
+  ///
   /// @returns the isolation window if the Simulator should be isolating
   ///          witness-triggered events in time, or returns empty otherwise
   ///          (indicating that any witness-triggered events should trigger
@@ -309,6 +418,27 @@ class Simulator {
   const System<T>& get_system() const { return system_; }
 
  private:
+  // The checkpoint functions in simulator_checkpoint.h save and restore the
+  // step counters and initialization status.
+  friend void WriteSimulatorCheckpoint(const ContextSerializer&,
+                                       const Simulator<double>&,
+                                       std::vector<uint8_t>*);
+  friend void RestoreSimulatorCheckpoint(const ContextSerializer&,
+                                         const void*, size_t,
+                                         Simulator<double>*);
+
+  // Allocates the per-step events and the event temporaries used by StepTo().
+  void AllocateStepEvents();
+
+  // Gathers the periodic events of the leaf systems of system_, each with the
+  // leaf collection within timed_events_ that it is written to.
+  void BuildPeriodicEventSchedule();
+
+  // Has the same effect as system_.CalcNextUpdateTime(*context_, events),
+  // where @p events is timed_events_, but advances the schedule of periodic
+  // events instead.
+  T CalcNextScheduledUpdateTime(CompositeEventCollection<T>* events);
+
   void HandleUnrestrictedUpdate(
       const EventCollection<UnrestrictedUpdateEvent<T>>& events);
 
@@ -325,7 +455,7 @@ class Simulator {
 
   void IsolateWitnessTriggers(
       const std::vector<const WitnessFunction<T>*>& witnesses,
-      const VectorX<T>& w0,
+      const VectorX<T>& w0, const VectorX<T>& wf,
       const T& t0, const VectorX<T>& x0, const T& tf,
       std::vector<const WitnessFunction<T>*>* triggered_witnesses);
 
@@ -335,10 +465,23 @@ class Simulator {
   using Duration = std::chrono::duration<double>;
   using TimePoint = std::chrono::time_point<Clock, Duration>;
 
+  // Writes the profile of the System to profile_report_path_, if it is a
+  // Diagram with profiling enabled.
+  void WriteProfileReport() const;
+
+  // Returns the real time corresponding to the simulated time in the context,
+  // given the target realtime rate.
+  TimePoint CalcDesiredRealtime() const;
+
   // If the simulated time in the context is ahead of real time, pause long
   // enough to let real time catch up (approximately).
   void PauseIfTooFast() const;
 
+  // Records the latency of the timed events due at the current time and
+  // applies the late event policy. Returns `false` if the events are to be
+  // skipped.
+  bool CheckTimedEventDeadline();
+
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
 
@@ -356,17 +499,33 @@ class Simulator {
   const System<T>& system_;              // Just a reference; not owned.
   std::unique_ptr<Context<T>> context_;  // The trajectory Context.
 
-  // Temporaries used for witness function isolation.
+  // Temporaries used for witness function isolation: the witness values at
+  // the start and end of the step, at the ends of the isolation bracket and
+  // at its latest estimate, and the state at the start of the bracket.
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
   VectorX<T> w0_, wf_;
+  VectorX<T> wa_, wb_, wc_;
+  VectorX<T> xa_;
+
+  // Pre-allocated temporary for the continuous state at the start of a step.
+  VectorX<T> x0_;
 
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{0.};
 
+  // The handling of timed events that are late by more than the tolerance
+  // (seconds) when running in real time, and the latencies recorded.
+  LateEventPolicy late_event_policy_{LateEventPolicy::kCatchUp};
+  double late_event_tolerance_{0.};
+  RealtimeStatistics realtime_statistics_;
+
   bool publish_every_time_step_{true};
 
   bool publish_at_initialization_{true};
 
+  // Where to write the System's profile after StepTo(); empty for nowhere.
+  std::string profile_report_path_;
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
@@ -398,6 +557,12 @@ class Simulator {
   // Initialize().
   std::unique_ptr<CompositeEventCollection<T>> per_step_events_;
 
+  // Pre-allocated temporaries for the events StepTo() handles. These are set
+  // within Initialize() so that stepping does not allocate.
+  std::unique_ptr<CompositeEventCollection<T>> timed_events_;
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+  std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
+
   // Pre-allocated temporaries for updated discrete states.
   std::unique_ptr<DiscreteValues<T>> discrete_updates_;
 
@@ -411,6 +576,26 @@ class Simulator {
   // Mapping of witness functions to pre-allocated events.
   std::unordered_map<const WitnessFunction<T>*, std::unique_ptr<Event<T>>>
       witness_function_events_;
+
+  // A periodic event of a leaf system, and the collection it is written to.
+  struct ScheduledPeriodicEvent {
+    PeriodicEventData timing;
+    const Event<T>* event{};
+    CompositeEventCollection<T>* collection{};
+  };
+
+  // The schedule of periodic events used when use_periodic_event_schedule_
+  // is set: the events, in subsystem order, and a min-queue of the next time
+  // each one fires (after periodic_event_queue_time_) with its index.
+  bool use_periodic_event_schedule_{false};
+  bool has_periodic_event_schedule_{false};
+  std::vector<ScheduledPeriodicEvent> scheduled_periodic_events_;
+  using ScheduleEntry = std::pair<T, int>;
+  std::priority_queue<ScheduleEntry, std::vector<ScheduleEntry>,
+                      std::greater<ScheduleEntry>>
+      periodic_event_queue_;
+  T periodic_event_queue_time_{};
+  std::vector<int> firing_periodic_events_;
 };
 
 template <typename T>
@@ -465,10 +650,7 @@ void Simulator<T>::Initialize() {
   // Do any publishes last.
   HandlePublish(init_events->get_publish_events());
 
-  // Gets all per-step events to be handled.
-  per_step_events_ = system_.AllocateCompositeEventCollection();
-  DRAKE_DEMAND(per_step_events_ != nullptr);
-  system_.GetPerStepEvents(*context_, per_step_events_.get());
+  AllocateStepEvents();
 
   // Restore default values.
   ResetStatistics();
@@ -484,6 +666,25 @@ void Simulator<T>::Initialize() {
   initialization_done_ = true;
 }
 
+template <typename T>
+void Simulator<T>::AllocateStepEvents() {
+  // Gets all per-step events to be handled.
+  per_step_events_ = system_.AllocateCompositeEventCollection();
+  DRAKE_DEMAND(per_step_events_ != nullptr);
+  system_.GetPerStepEvents(*context_, per_step_events_.get());
+
+  // Allocates the temporaries used by StepTo().
+  timed_events_ = system_.AllocateCompositeEventCollection();
+  merged_events_ = system_.AllocateCompositeEventCollection();
+  witnessed_events_ = system_.AllocateCompositeEventCollection();
+  DRAKE_DEMAND(timed_events_ != nullptr);
+  DRAKE_DEMAND(merged_events_ != nullptr);
+  DRAKE_DEMAND(witnessed_events_ != nullptr);
+
+  has_periodic_event_schedule_ = use_periodic_event_schedule_;
+  if (has_periodic_event_schedule_) BuildPeriodicEventSchedule();
+}
+
 // Processes UnrestrictedUpdateEvent events.
 template <typename T>
 void Simulator<T>::HandleUnrestrictedUpdate(
@@ -500,6 +701,9 @@ void Simulator<T>::HandleUnrestrictedUpdate(
 
     // Mark the witness function vector as needing to be redetermined.
     redetermine_active_witnesses_ = true;
+
+    // The time derivatives at the end of the last step are no longer valid.
+    integrator_->ClearDenseOutput();
   }
 }
 
@@ -515,6 +719,9 @@ void Simulator<T>::HandleDiscreteUpdate(
     DiscreteValues<T>& xd = context_->get_mutable_discrete_state();
     xd.CopyFrom(*discrete_updates_);
     ++num_discrete_updates_;
+
+    // The time derivatives at the end of the last step are no longer valid.
+    integrator_->ClearDenseOutput();
   }
 }
 
@@ -548,14 +755,14 @@ void Simulator<T>::StepTo(const T& boundary_time) {
   bool sample_time_hit = false;
 
   // Integrate until desired interval has completed.
-  auto timed_events = system_.AllocateCompositeEventCollection();
-  auto merged_events = system_.AllocateCompositeEventCollection();
-  auto witnessed_events = system_.AllocateCompositeEventCollection();
-  DRAKE_DEMAND(timed_events != nullptr);
-  DRAKE_DEMAND(merged_events != nullptr);
-  DRAKE_DEMAND(witnessed_events != nullptr);
+  CompositeEventCollection<T>* timed_events = timed_events_.get();
+  CompositeEventCollection<T>* merged_events = merged_events_.get();
+  CompositeEventCollection<T>* witnessed_events = witnessed_events_.get();
+  timed_events->Clear();
+  witnessed_events->Clear();
 
   while (context_->get_time() < boundary_time || sample_time_hit) {
+    DRAKE_TRACE_SCOPE("Simulator::Step");
     // Starting a new step on the trajectory.
     const T step_start_time = context_->get_time();
     SPDLOG_TRACE(log(), "Starting a simulation step at {}", step_start_time);
@@ -569,7 +776,8 @@ void Simulator<T>::StepTo(const T& boundary_time) {
 
     // Only merge timed / witnessed events in if the sample time was hit.
     if (sample_time_hit) {
-      merged_events->Merge(*timed_events);
+      if (!timed_events->HasEvents() || CheckTimedEventDeadline())
+        merged_events->Merge(*timed_events);
       merged_events->Merge(*witnessed_events);
     }
 
@@ -593,7 +801,9 @@ void Simulator<T>::StepTo(const T& boundary_time) {
 
     // How far can we go before we have to take a sampling break?
     const T next_sample_time =
-        system_.CalcNextUpdateTime(*context_, timed_events.get());
+        has_periodic_event_schedule_
+            ? CalcNextScheduledUpdateTime(timed_events)
+            : system_.CalcNextUpdateTime(*context_, timed_events);
 
     DRAKE_DEMAND(next_sample_time >= step_start_time);
 
@@ -617,13 +827,15 @@ void Simulator<T>::StepTo(const T& boundary_time) {
                                                next_update_dt,
                                                next_sample_time,
                                                boundary_dt,
-                                               witnessed_events.get());
+                                               witnessed_events);
 
     // Update the number of simulation steps taken.
     ++num_steps_taken_;
 
     // TODO(sherm1) Constraint projection goes here.
   }
+
+  if (!profile_report_path_.empty()) WriteProfileReport();
 }
 
 template <class T>
@@ -691,17 +903,13 @@ optional<T> Simulator<T>::GetCurrentWitnessTimeIsolation() const {
 template <class T>
 void Simulator<T>::IsolateWitnessTriggers(
     const std::vector<const WitnessFunction<T>*>& witnesses,
-    const VectorX<T>& w0,
+    const VectorX<T>& w0, const VectorX<T>& wf,
     const T& t0, const VectorX<T>& x0, const T& tf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses) {
 
   // Verify that the vector of triggered witnesses is non-null.
   DRAKE_DEMAND(triggered_witnesses);
 
-  // TODO(edrumwri): Speed this process using interpolation between states,
-  // more powerful root finding methods, and/or introducing the concept of
-  // a dead band.
-
   // Will need to alter the context repeatedly.
   Context<T>& context = get_mutable_context();
 
@@ -713,62 +921,101 @@ void Simulator<T>::IsolateWitnessTriggers(
   if (!witness_iso_len)
     return;
 
-  // Mini function for integrating the system forward in time from t0.
+  // If the integrator computed the interpolant of the step over [t0, tf],
+  // the state at any time in the interval is obtained from the interpolant
+  // rather than by integrating forward.
+  const bool use_dense_output = integrator_->has_dense_output() &&
+      integrator_->get_dense_output_start_time() == t0 &&
+      integrator_->get_dense_output_end_time() == tf;
+
+  // The isolation brackets the earliest trigger by [a, b]: no witness
+  // triggers over [t0, a], and some witness triggers over [t0, b]. The state
+  // at a is xa_.
+  T a = t0;
+  T b = tf;
+  xa_ = x0;
+
+  // Mini function for integrating the system forward in time from a.
   std::function<void(const T&)> integrate_forward =
-      [&t0, &x0, &context, this](const T& t_des) {
+      [&a, &context, use_dense_output, this](const T& t_des) {
+    if (use_dense_output) {
+      context.set_time(t_des);
+      context.get_mutable_continuous_state().SetFromVector(
+          integrator_->EvaluateDenseOutput(t_des));
+      return;
+    }
     const T inf = std::numeric_limits<double>::infinity();
-    context.set_time(t0);
-    context.get_mutable_continuous_state().SetFromVector(x0);
-    T t_remaining = t_des - t0;
+    context.set_time(a);
+    context.get_mutable_continuous_state().SetFromVector(xa_);
+    T t_remaining = t_des - a;
     while (t_remaining > 0) {
       integrator_->IntegrateAtMost(inf, inf, t_remaining);
       t_remaining = t_des - context.get_time();
     }
   };
 
-  // Loop until the isolation window is sufficiently small.
+  // All the witnesses are isolated together by the Illinois variant of
+  // regula falsi: each iteration evaluates every witness at the earliest of
+  // the zeros of their linear interpolants over [a, b], among the witnesses
+  // that trigger at b. When the same end of the bracket is kept twice in a
+  // row, the witness values at that end are halved, which keeps the
+  // convergence superlinear.
   SPDLOG_DEBUG(drake::log(),
       "Isolating witness functions using isolation window of {} over [{}, {}]",
       witness_iso_len.value(), t0, tf);
-  VectorX<T> wc(witnesses.size());
-  T a = t0;
-  T b = tf;
-  do {
-    // Compute the midpoint and evaluate the witness functions at it.
-    T c = (a + b) / 2;
+  const System<T>& system = get_system();
+  wa_ = w0;
+  wb_ = wf;
+  int last_kept = 0;  // -1 if a was kept by the last iteration, 1 if b was.
+  bool context_at_b = true;
+  while (b - a > witness_iso_len.value()) {
+    T c = b;
+    for (size_t i = 0; i < witnesses.size(); ++i) {
+      if (!witnesses[i]->should_trigger(w0[i], wb_[i]) || wa_[i] == wb_[i])
+        continue;
+      const T c_i = a + (b - a) * wa_[i] / (wa_[i] - wb_[i]);
+      if (c_i < c) c = c_i;
+    }
+    if (!(c > a && c < b)) c = (a + b) / 2;
+
     SPDLOG_DEBUG(drake::log(), "Integrating forward to time {}", c);
     integrate_forward(c);
+    system.CalcWitnessValues(context, witnesses, &wc_);
 
-    // See whether any witness functions trigger.
     bool trigger = false;
-    for (size_t i = 0; i < witnesses.size(); ++i) {
-      wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
-      if (witnesses[i]->should_trigger(w0[i], wc[i]))
-        trigger = true;
-    }
+    for (size_t i = 0; i < witnesses.size() && !trigger; ++i)
+      trigger = witnesses[i]->should_trigger(w0[i], wc_[i]);
 
-    // If no witness function triggered, we can continue integrating forward.
-    if (!trigger) {
-      // NOTE: Since we're always checking that the sign changes over [t0,c],
-      // it's also feasible to replace the two lines below with "a = c" without
-      // violating Simulator's contract to only integrate once over the interval
-      // [a, c], for some c <= b before per-step events are handled (i.e., it's
-      // unacceptable to take two steps of (c - a)/2 without processing per-step
-      // events first). That change would avoid handling unnecessary per-step
-      // events- we know no other events are to be handled between t0 and tf-
-      // but the current logic appears easier to follow.
-      SPDLOG_DEBUG(drake::log(), "No witness functions triggered up to {}", c);
-      triggered_witnesses->clear();
-      return;
-    } else {
+    if (trigger) {
       b = c;
+      wb_ = wc_;
+      if (last_kept == -1) wa_ /= 2;
+      last_kept = -1;
+      context_at_b = true;
+    } else {
+      SPDLOG_DEBUG(drake::log(), "No witness functions triggered up to {}", c);
+      a = c;
+      wa_ = wc_;
+      context.get_continuous_state_vector().CopyToPreSizedVector(xa_);
+      if (last_kept == 1) wb_ /= 2;
+      last_kept = 1;
+      context_at_b = false;
     }
-  } while (b - a > witness_iso_len.value());
+  }
+
+  // Leaves the context at b, with wc_ holding the (unscaled) witness values
+  // there.
+  if (!context_at_b) {
+    integrate_forward(b);
+    system.CalcWitnessValues(context, witnesses, &wc_);
+  } else if (last_kept == 0) {
+    wc_ = wf;
+  }
 
   // Determine the set of triggered witnesses.
   triggered_witnesses->clear();
   for (size_t i = 0; i < witnesses.size(); ++i) {
-    if (witnesses[i]->should_trigger(w0[i], wc[i]))
+    if (witnesses[i]->should_trigger(w0[i], wc_[i]))
       triggered_witnesses->push_back(witnesses[i]);
   }
 }
@@ -796,7 +1043,10 @@ bool Simulator<T>::IntegrateContinuousState(const T& next_publish_dt,
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Get the set of witness functions active at the current state.
   const System<T>& system = get_system();
@@ -808,9 +1058,7 @@ bool Simulator<T>::IntegrateContinuousState(const T& next_publish_dt,
   const auto& witness_functions = *witness_functions_;
 
   // Evaluate the witness functions.
-  w0_.resize(witness_functions.size());
-  for (size_t i = 0; i < witness_functions.size(); ++i)
-      w0_[i] = system.CalcWitnessValue(context, *witness_functions[i]);
+  system.CalcWitnessValues(context, witness_functions, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -821,9 +1069,7 @@ bool Simulator<T>::IntegrateContinuousState(const T& next_publish_dt,
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_.resize(witness_functions.size());
-  for (size_t i =0; i < witness_functions.size(); ++i)
-    wf_[i] = system.CalcWitnessValue(context, *witness_functions[i]);
+  system.CalcWitnessValues(context, witness_functions, &wf_);
 
   // See whether a witness function triggered.
   triggered_witnesses_.clear();
@@ -838,8 +1084,8 @@ bool Simulator<T>::IntegrateContinuousState(const T& next_publish_dt,
   // Triggering requires isolating the witness function time.
   if (witness_triggered) {
     // Isolate the time that the witness function triggered.
-    IsolateWitnessTriggers(witness_functions, w0_, t0, x0, tf,
-                             &triggered_witnesses_);
+    IsolateWitnessTriggers(witness_functions, w0_, wf_, t0, x0, tf,
+                           &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
@@ -0,0 +1,69 @@
+#include "drake/systems/analysis/simulator_checkpoint.h"
+
+#include <stdexcept>
+
+namespace drake {
+namespace systems {
+
+namespace {
+// "DRKSIM01" when read as little-endian bytes.
+constexpr int64_t kCheckpointMagic = 0x31304d49534b5244;
+}  // namespace
+
+void WriteSimulatorCheckpoint(const ContextSerializer& serializer,
+                              const Simulator<double>& simulator,
+                              std::vector<uint8_t>* bytes) {
+  DRAKE_DEMAND(bytes != nullptr);
+  DRAKE_DEMAND(simulator.has_context());
+  SerializationWriter writer(bytes);
+  writer.WriteInt64(kCheckpointMagic);
+  serializer.Serialize(simulator.get_context(), &writer);
+
+  const IntegratorBase<double>& integrator = *simulator.get_integrator();
+  writer.WriteDouble(integrator.get_ideal_next_step_size());
+  writer.WriteDouble(integrator.get_previous_integration_step_size());
+
+  writer.WriteInt64(simulator.num_steps_taken_);
+  writer.WriteInt64(simulator.num_discrete_updates_);
+  writer.WriteInt64(simulator.num_unrestricted_updates_);
+  writer.WriteInt64(simulator.num_publishes_);
+}
+
+void RestoreSimulatorCheckpoint(const ContextSerializer& serializer,
+                                const void* data, size_t size,
+                                Simulator<double>* simulator) {
+  DRAKE_DEMAND(simulator != nullptr);
+  DRAKE_DEMAND(simulator->has_context());
+  SerializationReader reader(data, size);
+  if (reader.ReadInt64() != kCheckpointMagic) {
+    throw std::runtime_error(
+        "RestoreSimulatorCheckpoint(): the data is not a Simulator "
+        "checkpoint.");
+  }
+  serializer.Deserialize(&reader, &simulator->get_mutable_context());
+  const double ideal_next_step_size = reader.ReadDouble();
+  const double prev_step_size = reader.ReadDouble();
+  const int64_t num_steps_taken = reader.ReadInt64();
+  const int64_t num_discrete_updates = reader.ReadInt64();
+  const int64_t num_unrestricted_updates = reader.ReadInt64();
+  const int64_t num_publishes = reader.ReadInt64();
+
+  // Initializing the integrator forgets its step size history, so that is
+  // restored afterwards.
+  IntegratorBase<double>* integrator = simulator->get_mutable_integrator();
+  integrator->Initialize();
+  integrator->ideal_next_step_size_ = ideal_next_step_size;
+  integrator->prev_step_size_ = prev_step_size;
+
+  simulator->AllocateStepEvents();
+  simulator->ResetStatistics();
+  simulator->num_steps_taken_ = num_steps_taken;
+  simulator->num_discrete_updates_ = num_discrete_updates;
+  simulator->num_unrestricted_updates_ = num_unrestricted_updates;
+  simulator->num_publishes_ = num_publishes;
+  simulator->redetermine_active_witnesses_ = true;
+  simulator->initialization_done_ = true;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/context_serialization.h"
+
+namespace drake {
+namespace systems {
+
+/// Appends a checkpoint of @p simulator to @p bytes: the snapshot of its
+/// Context written by @p serializer, the step size history of its integrator,
+/// and its step counters. The @p simulator must have a Context.
+///
+/// Restoring the checkpoint with RestoreSimulatorCheckpoint() lets a long
+/// simulation be resumed after the process that ran it has exited.
+void WriteSimulatorCheckpoint(const ContextSerializer& serializer,
+                              const Simulator<double>& simulator,
+                              std::vector<uint8_t>* bytes);
+
+/// Restores @p simulator from the checkpoint in the @p size bytes at @p data,
+/// which must have been written by WriteSimulatorCheckpoint() for a Simulator
+/// of the same System, and with a @p serializer that registered the same
+/// abstract value types.
+///
+/// Afterwards the %Simulator is initialized and continues the simulation from
+/// where the checkpoint was taken. Unlike Simulator::Initialize(), restoring
+/// neither handles initialization events nor publishes, since the restored
+/// Context already reflects them. The integrator settings (accuracy, step
+/// size limits, and so on) are not part of the checkpoint, and must be set
+/// the same way before restoring for the continuation to match the original
+/// simulation.
+///
+/// @throws std::runtime_error if @p data does not hold a checkpoint that
+///         fits the Context of @p simulator.
+void RestoreSimulatorCheckpoint(const ContextSerializer& serializer,
+                                const void* data, size_t size,
+                                Simulator<double>* simulator);
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,105 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/explicit_euler_integrator.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+// A pendulum with unit length and gravity, with state [θ, θ̇] and dynamics
+// θ̈ = -sin(θ).
+class PendulumSystem : public LeafSystem<double> {
+ public:
+  PendulumSystem() { this->DeclareContinuousState(1, 1, 0); }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    derivatives->get_mutable_vector().SetAtIndex(0, x.GetAtIndex(1));
+    derivatives->get_mutable_vector().SetAtIndex(1,
+                                                 -std::sin(x.GetAtIndex(0)));
+  }
+};
+
+void SetInitialStates(BatchSimulator* batch) {
+  for (int i = 0; i < batch->num_contexts(); ++i) {
+    VectorBase<double>& x =
+        batch->get_mutable_context(i).get_mutable_continuous_state_vector();
+    x.SetAtIndex(0, 0.01 * i);
+    x.SetAtIndex(1, 0.0);
+  }
+}
+
+GTEST_TEST(BatchSimulatorTest, MatchesSingleContextIntegration) {
+  const PendulumSystem system;
+  const int num_contexts = 37;
+  const double dt = 1e-2;
+  const int num_steps = 50;
+  BatchSimulator batch(system, num_contexts, dt);
+  EXPECT_EQ(batch.num_contexts(), num_contexts);
+  EXPECT_EQ(batch.get_step_size(), dt);
+  EXPECT_GE(batch.get_num_threads(), 1);
+  SetInitialStates(&batch);
+  batch.set_num_threads(4);
+  batch.Step(num_steps / 2);
+  batch.Step(num_steps / 2);
+
+  for (int i = 0; i < num_contexts; ++i) {
+    std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+    context->get_mutable_continuous_state_vector().SetFromVector(
+        Eigen::Vector2d(0.01 * i, 0.0));
+    RungeKutta2Integrator<double> integrator(system, dt, context.get());
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+    for (int step = 0; step < num_steps; ++step)
+      integrator.IntegrateWithSingleFixedStep(dt);
+
+    const Context<double>& batch_context = batch.get_context(i);
+    EXPECT_NEAR(batch_context.get_time(), num_steps * dt, 1e-14);
+    EXPECT_EQ(batch_context.get_continuous_state_vector().CopyToVector(),
+              context->get_continuous_state_vector().CopyToVector());
+    EXPECT_EQ(batch.get_integrator(i).get_num_steps_taken(), num_steps);
+  }
+}
+
+GTEST_TEST(BatchSimulatorTest, ResetIntegrators) {
+  const PendulumSystem system;
+  const double dt = 1e-3;
+  BatchSimulator batch(system, 3, dt);
+  batch.reset_integrators<ExplicitEulerIntegrator<double>>(dt);
+  SetInitialStates(&batch);
+  batch.Step();
+
+  // A single explicit Euler step gives θ̇ = -dt sin(θ₀).
+  for (int i = 0; i < batch.num_contexts(); ++i) {
+    EXPECT_NE(dynamic_cast<const ExplicitEulerIntegrator<double>*>(
+                  &batch.get_integrator(i)), nullptr);
+    EXPECT_NEAR(
+        batch.get_context(i).get_continuous_state_vector().GetAtIndex(1),
+        -dt * std::sin(0.01 * i), 1e-15);
+  }
+}
+
+GTEST_TEST(BatchSimulatorTest, Errors) {
+  const PendulumSystem system;
+  EXPECT_THROW(BatchSimulator(system, 0, 1e-3), std::logic_error);
+  EXPECT_THROW(BatchSimulator(system, 1, 0.0), std::logic_error);
+  BatchSimulator batch(system, 2, 1e-3);
+  EXPECT_THROW(batch.set_num_threads(0), std::logic_error);
+  EXPECT_THROW(batch.Step(-1), std::logic_error);
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -1,7 +1,11 @@
 #include "drake/systems/analysis/implicit_euler_integrator.h"
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/systems/analysis/test_utilities/discontinuous_spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/robertson_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_damper_system.h"
@@ -113,6 +117,104 @@ GTEST_TEST(ImplicitEulerIntegratorTest, Robertson) {
   EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
 }
 
+/// Stiff linear system dx/dt = Ax with a tridiagonal matrix A, for testing
+/// the sparse Jacobian computation scheme.
+class TridiagonalLinearSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TridiagonalLinearSystem)
+
+  explicit TridiagonalLinearSystem(int n) : A_(n, n) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; ++i) {
+      triplets.emplace_back(i, i, -2e3);
+      if (i > 0) triplets.emplace_back(i, i - 1, 1e3);
+      if (i < n - 1) triplets.emplace_back(i, i + 1, 1e3);
+    }
+    A_.setFromTriplets(triplets.begin(), triplets.end());
+    this->DeclareContinuousState(n);
+  }
+
+  const Eigen::SparseMatrix<double>& A() const { return A_; }
+
+ protected:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const Eigen::VectorXd x = context.get_continuous_state().CopyToVector();
+    derivatives->SetFromVector(A_ * x);
+  }
+
+ private:
+  Eigen::SparseMatrix<double> A_;
+};
+
+// Integrates the tridiagonal system with the colored forward difference
+// scheme and with the standard forward difference scheme, and verifies that
+// the solutions match while the colored scheme uses only three derivative
+// evaluations (plus one at the unperturbed state) per Jacobian.
+GTEST_TEST(ImplicitEulerIntegratorTest, ColoredForwardDifference) {
+  typedef ImplicitEulerIntegrator<double>::JacobianComputationScheme Scheme;
+  const int n = 30;
+  TridiagonalLinearSystem system(n);
+  const Eigen::VectorXd x0 = Eigen::VectorXd::LinSpaced(n, -1.0, 1.0);
+  const double t_final = 0.1;
+
+  const auto integrate = [&](Scheme scheme, bool set_pattern,
+                             Eigen::VectorXd* x_final) {
+    std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+    context->get_mutable_continuous_state().SetFromVector(x0);
+    auto integrator = std::make_unique<ImplicitEulerIntegrator<double>>(
+        system, context.get());
+    integrator->set_maximum_step_size(1e-2);
+    integrator->set_target_accuracy(1e-4);
+    integrator->set_jacobian_computation_scheme(scheme);
+    if (set_pattern) integrator->set_jacobian_sparsity_pattern(system.A());
+    integrator->Initialize();
+    integrator->IntegrateWithMultipleSteps(t_final);
+    *x_final = context->get_continuous_state().CopyToVector();
+    return integrator;
+  };
+
+  Eigen::VectorXd x_dense, x_colored, x_detected;
+  integrate(Scheme::kForwardDifference, false, &x_dense);
+  const auto colored = integrate(Scheme::kColoredForwardDifference, true,
+                                 &x_colored);
+  EXPECT_TRUE(CompareMatrices(x_colored, x_dense, 1e-8,
+                              MatrixCompareType::absolute));
+  EXPECT_EQ(colored->get_num_jacobian_column_groups(), 3);
+  EXPECT_GT(colored->get_num_jacobian_evaluations(), 0);
+  EXPECT_EQ(colored->get_num_derivative_evaluations_for_jacobian(),
+            4 * colored->get_num_jacobian_evaluations());
+  EXPECT_GT(colored->get_num_iteration_matrix_factorizations(), 0);
+
+  // The sparsity pattern is detected from the first Jacobian matrix if it is
+  // not set.
+  const auto detected = integrate(Scheme::kColoredForwardDifference, false,
+                                  &x_detected);
+  EXPECT_EQ(detected->get_num_jacobian_column_groups(), 3);
+  EXPECT_TRUE(CompareMatrices(x_detected, x_dense, 1e-8,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies that invalid sparsity patterns are rejected.
+GTEST_TEST(ImplicitEulerIntegratorTest, BadSparsityPattern) {
+  TridiagonalLinearSystem system(4);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  ImplicitEulerIntegrator<double> integrator(system, context.get());
+  EXPECT_THROW(integrator.set_jacobian_sparsity_pattern(
+                   Eigen::SparseMatrix<double>(4, 3)),
+               std::logic_error);
+
+  integrator.set_jacobian_computation_scheme(
+      ImplicitEulerIntegrator<double>::JacobianComputationScheme::
+      kColoredForwardDifference);
+  integrator.set_jacobian_sparsity_pattern(Eigen::SparseMatrix<double>(3, 3));
+  integrator.set_maximum_step_size(1e-2);
+  integrator.Initialize();
+  EXPECT_THROW(integrator.IntegrateWithSingleFixedStep(1e-2),
+               std::logic_error);
+}
+
 class ImplicitIntegratorTest : public ::testing::TestWithParam<bool> {
  public:
   ImplicitIntegratorTest() {
@@ -1,5 +1,8 @@
 #include "drake/systems/analysis/initial_value_problem.h"
 
+#include <cmath>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -358,6 +361,97 @@ INSTANTIATE_TEST_CASE_P(IncreasingAccuracyInitialValueProblemTests,
                         InitialValueProblemAccuracyTest,
                         ::testing::Values(1e-1, 1e-2, 1e-3, 1e-4, 1e-5));
 
+// Checks that the dense solution matches both the closed form solution and
+// Solve() in between integration steps.
+GTEST_TEST(InitialValueProblemTest, DenseSolve) {
+  const double kAccuracy = 1e-6;
+  const InitialValueProblem<double>::SpecifiedValues kDefaultValues(
+      0.0, VectorX<double>::Zero(2), VectorX<double>::Constant(2, 1.0));
+  // The generic ODE d𝐱/dt = -𝐱 + 𝐤, whose solution is
+  // 𝐱(t; 𝐤) = 𝐤 + (𝐱₀ - 𝐤) * e^(-(t - t₀)).
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        unused(t);
+        return -x + k;
+      }, kDefaultValues);
+  ivp.get_mutable_integrator()->set_target_accuracy(1e-7);
+
+  InitialValueProblem<double>::SpecifiedValues values;
+  values.t0 = 0.5;
+  values.x0 = (VectorX<double>(2) << 2.0, -1.0).finished();
+  values.k = (VectorX<double>(2) << 1.0, 3.0).finished();
+  const double kFinalTime = 2.5;
+  const trajectories::PiecewisePolynomial<double> solution =
+      ivp.DenseSolve(kFinalTime, values);
+  EXPECT_EQ(solution.rows(), 2);
+  EXPECT_EQ(solution.cols(), 1);
+  EXPECT_EQ(solution.start_time(), values.t0.value());
+  EXPECT_EQ(solution.end_time(), kFinalTime);
+  EXPECT_GT(solution.get_number_of_segments(), 1);
+  for (double t = values.t0.value(); t <= kFinalTime; t += 0.0625) {
+    const VectorX<double> exact_solution =
+        values.k.value() + (values.x0.value() - values.k.value()) *
+                               std::exp(-(t - values.t0.value()));
+    EXPECT_TRUE(CompareMatrices(solution.value(t), exact_solution, kAccuracy))
+        << "at t = " << t;
+  }
+  // The dense output setting of the integrator is left as it was.
+  EXPECT_FALSE(ivp.get_integrator()->get_dense_output_enabled());
+
+  // Solving afterwards continues from the end of the dense solution, rather
+  // than integrating from t₀ again.
+  const int64_t num_steps = ivp.get_integrator()->get_num_steps_taken();
+  EXPECT_TRUE(CompareMatrices(ivp.Solve(kFinalTime, values),
+                              solution.value(kFinalTime), 1e-14));
+  EXPECT_LE(ivp.get_integrator()->get_num_steps_taken(), num_steps + 1);
+
+  EXPECT_THROW(ivp.DenseSolve(values.t0.value(), values), std::logic_error);
+}
+
+// Checks that batched solutions match serial ones, for any number of threads.
+GTEST_TEST(InitialValueProblemTest, SolveBatch) {
+  const InitialValueProblem<double>::SpecifiedValues kDefaultValues(
+      0.0, VectorX<double>::Zero(2), VectorX<double>::Constant(2, 1.0));
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        return -x + k * std::cos(t);
+      }, kDefaultValues);
+  ivp.reset_integrator<RungeKutta2Integrator<double>>(0.01);
+
+  std::vector<InitialValueProblem<double>::SpecifiedValues> values(13);
+  for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+    values[i].k = VectorX<double>::Constant(2, 0.25 * i).eval();
+    if (i % 3 == 0) {
+      values[i].x0 = VectorX<double>::Constant(2, -1.0 * i).eval();
+    }
+  }
+  const double kFinalTime = 1.5;
+  std::vector<VectorX<double>> expected_solutions;
+  for (const auto& problem_values : values) {
+    expected_solutions.push_back(ivp.Solve(kFinalTime, problem_values));
+  }
+  const int64_t num_steps = ivp.get_integrator()->get_num_steps_taken();
+
+  for (const int num_threads : {1, 2, 4, 32}) {
+    const std::vector<VectorX<double>> solutions =
+        ivp.SolveBatch(kFinalTime, values, num_threads);
+    ASSERT_EQ(solutions.size(), values.size());
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+      EXPECT_TRUE(CompareMatrices(solutions[i], expected_solutions[i]))
+          << "for problem " << i << " on " << num_threads << " threads";
+    }
+  }
+  // The internal integrator is left untouched.
+  EXPECT_EQ(ivp.get_integrator()->get_num_steps_taken(), num_steps);
+
+  EXPECT_TRUE(ivp.SolveBatch(kFinalTime, {}, 4).empty());
+  EXPECT_THROW(ivp.SolveBatch(kFinalTime, values, 0), std::logic_error);
+  values[5].t0 = kFinalTime + 1.0;
+  EXPECT_THROW(ivp.SolveBatch(kFinalTime, values, 4), std::logic_error);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
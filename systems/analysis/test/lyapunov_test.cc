@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/examples/pendulum/pendulum_plant.h"
 #include "drake/systems/framework/vector_system.h"
 
@@ -89,6 +90,11 @@ GTEST_TEST(LyapunovTest, PendulumSampleBasedLyapunov) {
   Eigen::VectorXd params = SampleBasedLyapunovAnalysis(
       pendulum, *context, &pendulum_bases<AutoDiffXd>, x_samples, x_zero);
 
+  // Splitting the samples among threads gives the same program.
+  const Eigen::VectorXd threaded_params = SampleBasedLyapunovAnalysis(
+      pendulum, *context, &pendulum_bases<AutoDiffXd>, x_samples, x_zero, 3);
+  EXPECT_TRUE(CompareMatrices(threaded_params, params, 1e-6));
+
   // Zero the small coefficients, for textual display.
   for (int i = 0; i < params.size(); i++) {
     if (fabs(params(i)) < 1e-4) {
@@ -0,0 +1,99 @@
+#include "drake/systems/analysis/monte_carlo.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+// A scalar system with dynamics ẋ = -x.
+class DecaySystem : public LeafSystem<double> {
+ public:
+  DecaySystem() { this->DeclareContinuousState(1); }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const double x = context.get_continuous_state_vector().GetAtIndex(0);
+    derivatives->get_mutable_vector().SetAtIndex(0, -x);
+  }
+};
+
+void RandomizeInitialState(const System<double>&, RandomGenerator* generator,
+                           Context<double>* context) {
+  std::uniform_real_distribution<double> distribution(1.0, 2.0);
+  context->get_mutable_continuous_state_vector().SetAtIndex(
+      0, distribution(*generator));
+}
+
+double FinalState(const System<double>&, const Context<double>& context) {
+  return context.get_continuous_state_vector().GetAtIndex(0);
+}
+
+GTEST_TEST(MonteCarloSimulationRunnerTest, Basic) {
+  const DecaySystem system;
+  const double final_time = 1.0;
+  MonteCarloSimulationRunner runner(system, &RandomizeInitialState,
+                                    &FinalState, final_time);
+  EXPECT_GE(runner.get_num_threads(), 1);
+
+  const int num_samples = 20;
+  runner.set_num_threads(1);
+  RandomGenerator serial_generator;
+  const std::vector<double> serial = runner.Run(num_samples, &serial_generator);
+  ASSERT_EQ(static_cast<int>(serial.size()), num_samples);
+
+  // The results are independent of the number of threads.
+  runner.set_num_threads(4);
+  RandomGenerator parallel_generator;
+  const std::vector<double> parallel =
+      runner.Run(num_samples, &parallel_generator);
+  EXPECT_EQ(serial, parallel);
+
+  // Each sample is reproducible from its seed, and matches the closed-form
+  // solution x(t) = x₀ exp(-t) for x₀ ∈ [1, 2].
+  RandomGenerator seed_generator;
+  for (int i = 0; i < num_samples; ++i) {
+    const RandomGenerator::result_type seed = seed_generator();
+    EXPECT_EQ(runner.RunSample(seed), serial[i]);
+
+    RandomGenerator generator(seed);
+    std::uniform_real_distribution<double> distribution(1.0, 2.0);
+    const double x0 = distribution(generator);
+    EXPECT_NEAR(serial[i], x0 * std::exp(-final_time), 1e-3);
+  }
+}
+
+GTEST_TEST(MonteCarloSimulationRunnerTest, Errors) {
+  const DecaySystem system;
+  EXPECT_THROW(MonteCarloSimulationRunner(system, nullptr, &FinalState, 1.0),
+               std::logic_error);
+  MonteCarloSimulationRunner runner(system, &RandomizeInitialState,
+                                    &FinalState, 1.0);
+  EXPECT_THROW(runner.set_num_threads(0), std::logic_error);
+
+  // Exceptions thrown while running a sample are propagated.
+  MonteCarloSimulationRunner throwing_runner(
+      system, &RandomizeInitialState,
+      [](const System<double>&, const Context<double>&) -> double {
+        throw std::runtime_error("failed sample");
+      },
+      1.0);
+  throwing_runner.set_num_threads(2);
+  RandomGenerator generator;
+  EXPECT_THROW(throwing_runner.Run(4, &generator), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
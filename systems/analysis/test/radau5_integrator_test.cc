@@ -0,0 +1,290 @@
+#include "drake/systems/analysis/radau5_integrator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/analysis/implicit_euler_integrator.h"
+#include "drake/systems/analysis/test_utilities/robertson_system.h"
+#include "drake/systems/plants/spring_mass_system/spring_mass_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+typedef Radau5Integrator<double>::JacobianComputationScheme Scheme;
+
+// Tests the integrator on Robertson's stiff chemical reaction problem.
+GTEST_TEST(Radau5IntegratorTest, Robertson) {
+  analysis::test::RobertsonSystem<double> robertson;
+  std::unique_ptr<Context<double>> context = robertson.CreateDefaultContext();
+
+  // Set the initial conditions for Robertson's system.
+  VectorBase<double>& state = context->get_mutable_continuous_state().
+                                get_mutable_vector();
+  state.SetAtIndex(0, 1);
+  state.SetAtIndex(1, 0);
+  state.SetAtIndex(2, 0);
+
+  const double t_final = robertson.get_end_time();
+  const double tol = 5e-5;
+
+  // Create the integrator; see the corresponding implicit Euler test for the
+  // rationale behind the small initial step size.
+  Radau5Integrator<double> integrator(robertson, context.get());
+  integrator.set_maximum_step_size(10000000.0);
+  integrator.set_throw_on_minimum_step_size_violation(false);
+  integrator.set_target_accuracy(tol);
+  integrator.request_initial_step_size_target(1e-4);
+
+  // Integrate the system
+  integrator.Initialize();
+  integrator.IntegrateWithMultipleSteps(t_final);
+
+  // Verify the solution.
+  const Eigen::Vector3d sol = robertson.GetSolution(t_final);
+  EXPECT_NEAR(state.GetAtIndex(0), sol(0), tol);
+  EXPECT_NEAR(state.GetAtIndex(1), sol(1), tol);
+  EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
+}
+
+class Radau5IntegratorTest : public ::testing::TestWithParam<bool> {
+ public:
+  Radau5IntegratorTest()
+      : spring_mass_(kSpringK, kMass, false /* no forcing */),
+        context_(spring_mass_.CreateDefaultContext()) {}
+
+ protected:
+  // Sets the initial condition of the spring-mass system (at t = 0).
+  void SetInitialCondition(double x0, double v0) {
+    context_->set_time(0.0);
+    spring_mass_.set_position(context_.get(), x0);
+    spring_mass_.set_velocity(context_.get(), v0);
+  }
+
+  double get_position() const {
+    return context_->get_continuous_state().get_vector().GetAtIndex(0);
+  }
+
+  static constexpr double kSpringK = 300.0;  // N/m
+  static constexpr double kMass = 2.0;       // kg
+  SpringMassSystem<double> spring_mass_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// Integrates an undamped spring-mass system with error control and checks the
+// solution accuracy for each Jacobian computation scheme.
+TEST_P(Radau5IntegratorTest, SpringMassStep) {
+  const double x0 = 0.1, v0 = 0.01, t_final = 1.0;
+  double x_final_true, v_final_true;
+  spring_mass_.GetClosedFormSolution(x0, v0, t_final, &x_final_true,
+                                     &v_final_true);
+
+  Radau5Integrator<double> integrator(spring_mass_, context_.get());
+  integrator.set_maximum_step_size(0.1);
+  integrator.set_target_accuracy(1e-6);
+  integrator.set_requested_minimum_step_size(1e-6);
+  integrator.set_reuse(GetParam());
+  integrator.Initialize();
+
+  for (Scheme scheme : {Scheme::kForwardDifference, Scheme::kCentralDifference,
+                        Scheme::kAutomatic}) {
+    integrator.set_jacobian_computation_scheme(scheme);
+    integrator.ResetStatistics();
+    SetInitialCondition(x0, v0);
+    integrator.IntegrateWithMultipleSteps(t_final);
+    EXPECT_NEAR(context_->get_time(), t_final,
+                1e2 * std::numeric_limits<double>::epsilon());
+    EXPECT_NEAR(get_position(), x_final_true, 1e-5);
+    EXPECT_GT(integrator.get_num_newton_raphson_iterations(), 0);
+    EXPECT_GT(integrator.get_num_jacobian_evaluations(), 0);
+    EXPECT_GT(integrator.get_num_iteration_matrix_factorizations(), 0);
+    EXPECT_GT(integrator.get_num_derivative_evaluations_for_jacobian(), 0);
+  }
+}
+
+// Checks the error estimate on single fixed steps of the spring-mass system:
+// the true error must be bounded by the estimate, and the estimate must
+// decrease as the fourth power of the step size.
+TEST_P(Radau5IntegratorTest, ErrorEstimation) {
+  Radau5Integrator<double> integrator(spring_mass_, context_.get());
+  integrator.set_maximum_step_size(0.1);
+  integrator.set_fixed_step_mode(true);
+  integrator.set_reuse(GetParam());
+  integrator.set_jacobian_computation_scheme(Scheme::kAutomatic);
+  integrator.Initialize();
+
+  const double x0 = 0.1, v0 = 1.0;
+  double last_est_err = 0.0;
+  for (const double dt : {1e-1, 5e-2, 2.5e-2}) {
+    SetInitialCondition(x0, v0);
+    integrator.IntegrateWithSingleFixedStep(dt);
+    const double est_err = std::abs(
+        integrator.get_error_estimate()->CopyToVector()[0]);
+
+    double x_final_true, v_final_true;
+    spring_mass_.GetClosedFormSolution(x0, v0, dt, &x_final_true,
+                                       &v_final_true);
+    EXPECT_LE(std::abs(get_position() - x_final_true), est_err);
+
+    // Halving the step size reduces the estimate by roughly a factor of 16.
+    if (last_est_err > 0) {
+      EXPECT_GT(last_est_err / est_err, 8.0);
+      EXPECT_LT(last_est_err / est_err, 32.0);
+    }
+    last_est_err = est_err;
+  }
+}
+
+// Verifies that the higher order of the method permits taking far fewer
+// steps than implicit Euler for the same accuracy.
+TEST_P(Radau5IntegratorTest, FewerStepsThanImplicitEuler) {
+  const double x0 = 0.1, v0 = 0.01, t_final = 1.0;
+  const double accuracy = 1e-4;
+  double x_final_true, v_final_true;
+  spring_mass_.GetClosedFormSolution(x0, v0, t_final, &x_final_true,
+                                     &v_final_true);
+
+  ImplicitEulerIntegrator<double> euler(spring_mass_, context_.get());
+  euler.set_maximum_step_size(0.1);
+  euler.set_target_accuracy(accuracy);
+  euler.set_reuse(GetParam());
+  euler.Initialize();
+  SetInitialCondition(x0, v0);
+  euler.IntegrateWithMultipleSteps(t_final);
+  const double euler_error = std::abs(get_position() - x_final_true);
+
+  Radau5Integrator<double> radau(spring_mass_, context_.get());
+  radau.set_maximum_step_size(0.1);
+  radau.set_target_accuracy(accuracy);
+  radau.set_reuse(GetParam());
+  radau.Initialize();
+  SetInitialCondition(x0, v0);
+  radau.IntegrateWithMultipleSteps(t_final);
+  const double radau_error = std::abs(get_position() - x_final_true);
+
+  EXPECT_LE(radau_error, euler_error);
+  EXPECT_LT(5 * radau.get_num_steps_taken(), euler.get_num_steps_taken());
+}
+
+// Verifies that the dense output (the collocation polynomial) is accurate
+// within each step and requires no additional derivative evaluations.
+TEST_P(Radau5IntegratorTest, DenseOutput) {
+  const double x0 = 0.1, v0 = 1.0, t_final = 0.5, t_chunk = 0.05;
+  Radau5Integrator<double> integrator(spring_mass_, context_.get());
+  integrator.set_maximum_step_size(0.1);
+  integrator.set_target_accuracy(1e-6);
+  integrator.set_reuse(GetParam());
+  integrator.Initialize();
+  SetInitialCondition(x0, v0);
+  while (context_->get_time() < t_final) {
+    integrator.IntegrateWithMultipleSteps(
+        std::min(t_chunk, t_final - context_->get_time()));
+  }
+  const int64_t evals = integrator.get_num_derivative_evaluations();
+
+  // Integrate again with dense output, checking the interpolant of the last
+  // step within each chunk.
+  integrator.Reset();
+  integrator.set_maximum_step_size(0.1);
+  integrator.set_target_accuracy(1e-6);
+  integrator.set_dense_output_enabled(true);
+  integrator.Initialize();
+  SetInitialCondition(x0, v0);
+  double max_error = 0.0;
+  while (context_->get_time() < t_final) {
+    integrator.IntegrateWithMultipleSteps(
+        std::min(t_chunk, t_final - context_->get_time()));
+    ASSERT_TRUE(integrator.has_dense_output());
+    EXPECT_EQ(integrator.get_dense_output_end_time(), context_->get_time());
+    EXPECT_NEAR(integrator.EvaluateDenseOutput(context_->get_time())[0],
+                get_position(), 1e-14);
+    const double t_mid = (integrator.get_dense_output_start_time() +
+        integrator.get_dense_output_end_time()) / 2;
+    double x_true, v_true;
+    spring_mass_.GetClosedFormSolution(x0, v0, t_mid, &x_true, &v_true);
+    max_error = std::max(max_error,
+        std::abs(integrator.EvaluateDenseOutput(t_mid)[0] - x_true));
+  }
+  EXPECT_LT(max_error, 1e-5);
+  EXPECT_EQ(integrator.get_num_derivative_evaluations(), evals);
+}
+
+INSTANTIATE_TEST_CASE_P(test, Radau5IntegratorTest,
+    ::testing::Values(true, false));
+
+/// Stiff linear system dx/dt = Ax with a tridiagonal matrix A, for testing
+/// the sparse Jacobian computation scheme.
+class TridiagonalLinearSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TridiagonalLinearSystem)
+
+  explicit TridiagonalLinearSystem(int n) : A_(n, n) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; ++i) {
+      triplets.emplace_back(i, i, -2e3);
+      if (i > 0) triplets.emplace_back(i, i - 1, 1e3);
+      if (i < n - 1) triplets.emplace_back(i, i + 1, 1e3);
+    }
+    A_.setFromTriplets(triplets.begin(), triplets.end());
+    this->DeclareContinuousState(n);
+  }
+
+  const Eigen::SparseMatrix<double>& A() const { return A_; }
+
+ protected:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const Eigen::VectorXd x = context.get_continuous_state().CopyToVector();
+    derivatives->SetFromVector(A_ * x);
+  }
+
+ private:
+  Eigen::SparseMatrix<double> A_;
+};
+
+// Verifies that the colored forward difference scheme (and the sparse
+// factorization of the 3n × 3n iteration matrix) yields the same solution as
+// the standard forward difference scheme.
+GTEST_TEST(Radau5IntegratorTest, ColoredForwardDifference) {
+  const int n = 30;
+  TridiagonalLinearSystem system(n);
+  const Eigen::VectorXd x0 = Eigen::VectorXd::LinSpaced(n, -1.0, 1.0);
+  const double t_final = 0.1;
+
+  const auto integrate = [&](Scheme scheme, Eigen::VectorXd* x_final) {
+    std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+    context->get_mutable_continuous_state().SetFromVector(x0);
+    auto integrator = std::make_unique<Radau5Integrator<double>>(
+        system, context.get());
+    integrator->set_maximum_step_size(1e-2);
+    integrator->set_target_accuracy(1e-6);
+    integrator->set_jacobian_computation_scheme(scheme);
+    if (scheme == Scheme::kColoredForwardDifference)
+      integrator->set_jacobian_sparsity_pattern(system.A());
+    integrator->Initialize();
+    integrator->IntegrateWithMultipleSteps(t_final);
+    *x_final = context->get_continuous_state().CopyToVector();
+    return integrator;
+  };
+
+  Eigen::VectorXd x_dense, x_colored;
+  integrate(Scheme::kForwardDifference, &x_dense);
+  const auto colored = integrate(Scheme::kColoredForwardDifference,
+                                 &x_colored);
+  EXPECT_TRUE(CompareMatrices(x_colored, x_dense, 1e-8,
+                              MatrixCompareType::absolute));
+  EXPECT_EQ(colored->get_num_jacobian_column_groups(), 3);
+  EXPECT_EQ(colored->get_num_derivative_evaluations_for_jacobian(),
+            4 * colored->get_num_jacobian_evaluations());
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
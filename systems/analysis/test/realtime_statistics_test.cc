@@ -0,0 +1,57 @@
+#include "drake/systems/analysis/realtime_statistics.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace systems {
+namespace {
+
+GTEST_TEST(RealtimeStatisticsTest, Histograms) {
+  RealtimeStatistics statistics(1e-3, 4);
+  EXPECT_EQ(statistics.get_bin_width(), 1e-3);
+  EXPECT_EQ(statistics.get_num_events(), 0);
+  EXPECT_EQ(statistics.get_mean_latency(), 0.0);
+
+  // Latencies land in bins 0, 2, 0 (clamped from negative), and 3 (overflow).
+  statistics.AddEvent(0.5e-3);
+  statistics.AddEvent(2.5e-3, true /* skipped */);
+  statistics.AddEvent(-1.0);
+  statistics.AddEvent(10e-3);
+  EXPECT_EQ(statistics.get_num_events(), 4);
+  EXPECT_EQ(statistics.get_num_skipped_events(), 1);
+  EXPECT_EQ(statistics.get_latency_histogram(),
+            std::vector<int64_t>({2, 0, 1, 1}));
+  EXPECT_DOUBLE_EQ(statistics.get_max_latency(), 10e-3);
+  EXPECT_DOUBLE_EQ(statistics.get_mean_latency(), 13e-3 / 4);
+
+  // The jitters are 2e-3, 2.5e-3, and 10e-3.
+  EXPECT_EQ(statistics.get_jitter_histogram(),
+            std::vector<int64_t>({0, 0, 2, 1}));
+  EXPECT_DOUBLE_EQ(statistics.get_max_jitter(), 10e-3);
+
+  statistics.Clear();
+  EXPECT_EQ(statistics.get_num_events(), 0);
+  EXPECT_EQ(statistics.get_num_skipped_events(), 0);
+  EXPECT_EQ(statistics.get_max_latency(), 0.0);
+  EXPECT_EQ(statistics.get_latency_histogram(),
+            std::vector<int64_t>({0, 0, 0, 0}));
+  EXPECT_EQ(statistics.get_jitter_histogram(),
+            std::vector<int64_t>({0, 0, 0, 0}));
+
+  // The first event after clearing contributes no jitter.
+  statistics.AddEvent(3e-3);
+  EXPECT_EQ(statistics.get_jitter_histogram(),
+            std::vector<int64_t>({0, 0, 0, 0}));
+}
+
+GTEST_TEST(RealtimeStatisticsTest, Errors) {
+  EXPECT_THROW(RealtimeStatistics(0.0, 10), std::logic_error);
+  EXPECT_THROW(RealtimeStatistics(1e-3, 0), std::logic_error);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
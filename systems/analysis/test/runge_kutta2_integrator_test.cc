@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/systems/analysis/test_utilities/my_spring_mass_system.h"
 
 namespace drake {
@@ -120,6 +121,68 @@ GTEST_TEST(IntegratorTest, SpringMassStep) {
   EXPECT_GT(integrator.get_num_derivative_evaluations(), 0);
 }
 
+// Verifies that the dense output interpolates the states at the ends of each
+// step, approximates the solution within the step, and costs one additional
+// derivative evaluation per step.
+GTEST_TEST(IntegratorTest, DenseOutput) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;      // kg
+  SpringMassSystem<double> spring_mass(spring_k, mass, 0.);
+  auto context = spring_mass.CreateDefaultContext();
+
+  const double dt = 1.0/1024;
+  const double inf = std::numeric_limits<double>::infinity();
+  RungeKutta2Integrator<double> integrator(spring_mass, dt, context.get());
+  const double initial_position = 0.1;
+  const double initial_velocity = 0.01;
+  spring_mass.set_position(context.get(), initial_position);
+  spring_mass.set_velocity(context.get(), initial_velocity);
+  integrator.Initialize();
+
+  // No dense output is available until enabled and a step is taken.
+  EXPECT_FALSE(integrator.get_dense_output_enabled());
+  integrator.IntegrateAtMost(inf, inf, dt);
+  EXPECT_FALSE(integrator.has_dense_output());
+  EXPECT_THROW(integrator.EvaluateDenseOutput(0.0), std::logic_error);
+  integrator.set_dense_output_enabled(true);
+  EXPECT_FALSE(integrator.has_dense_output());
+
+  const int kNumSteps = 10;
+  for (int i = 0; i < kNumSteps; ++i) {
+    const double t0 = context->get_time();
+    const Eigen::VectorXd x0 =
+        context->get_continuous_state_vector().CopyToVector();
+    const int64_t evals = integrator.get_num_derivative_evaluations();
+    integrator.IntegrateAtMost(inf, inf, dt);
+
+    // The explicit midpoint method takes two derivative evaluations per step;
+    // the interpolant requires one more (and one more still for the first
+    // step, since there is no previous step to reuse the derivatives from).
+    EXPECT_EQ(integrator.get_num_derivative_evaluations() - evals,
+              (i == 0) ? 4 : 3);
+
+    ASSERT_TRUE(integrator.has_dense_output());
+    EXPECT_EQ(integrator.get_dense_output_start_time(), t0);
+    EXPECT_EQ(integrator.get_dense_output_end_time(), context->get_time());
+    const double tol = 10 * std::numeric_limits<double>::epsilon();
+    EXPECT_TRUE(CompareMatrices(integrator.EvaluateDenseOutput(t0), x0, tol));
+    EXPECT_TRUE(CompareMatrices(
+        integrator.EvaluateDenseOutput(context->get_time()),
+        context->get_continuous_state_vector().CopyToVector(), tol));
+
+    // Compare against the true solution from (t0, x0) at the midpoint.
+    double x_true, v_true;
+    spring_mass.GetClosedFormSolution(x0[0], x0[1], dt / 2, &x_true, &v_true);
+    const Eigen::VectorXd x_mid =
+        integrator.EvaluateDenseOutput(t0 + dt / 2);
+    EXPECT_NEAR(x_mid[0], x_true, 1e-6);
+    EXPECT_NEAR(x_mid[1], v_true, 1e-5);
+  }
+
+  EXPECT_THROW(integrator.EvaluateDenseOutput(context->get_time() + dt),
+               std::logic_error);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
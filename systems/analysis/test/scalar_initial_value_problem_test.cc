@@ -1,5 +1,8 @@
 #include "drake/systems/analysis/scalar_initial_value_problem.h"
 
+#include <cmath>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/unused.h"
@@ -311,6 +314,41 @@ INSTANTIATE_TEST_CASE_P(IncreasingAccuracyScalarInitialValueProblemTests,
                         ScalarInitialValueProblemAccuracyTest,
                         ::testing::Values(1e-1, 1e-2, 1e-3, 1e-4, 1e-5));
 
+// Checks the dense and batched solutions of dN/dt = r * N and N(t₀; r) = N₀
+// against the closed form solution N(t; r) = N₀ * e^(r * (t - t₀)).
+GTEST_TEST(ScalarInitialValueProblemTest, DenseAndBatchSolve) {
+  const double kAccuracy = 1e-6;
+  const ScalarInitialValueProblem<double>::SpecifiedValues kDefaultValues(
+      0.0, 10.0, VectorX<double>::Constant(1, 0.1));
+  ScalarInitialValueProblem<double> population_growth_ivp(
+      [](const double& t, const double& n,
+         const VectorX<double>& k) -> double {
+        unused(t);
+        return k[0] * n;
+      }, kDefaultValues);
+  population_growth_ivp.get_mutable_integrator()->set_target_accuracy(1e-8);
+
+  const double kFinalTime = 1.0;
+  const trajectories::PiecewisePolynomial<double> solution =
+      population_growth_ivp.DenseSolve(kFinalTime);
+  EXPECT_EQ(solution.rows(), 1);
+  for (double t = 0.0; t <= kFinalTime; t += 0.05) {
+    EXPECT_NEAR(solution.value(t)(0), 10.0 * std::exp(0.1 * t), kAccuracy);
+  }
+
+  std::vector<ScalarInitialValueProblem<double>::SpecifiedValues> values(10);
+  for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+    values[i].k = VectorX<double>::Constant(1, 0.1 * (i + 1)).eval();
+  }
+  const std::vector<double> solutions =
+      population_growth_ivp.SolveBatch(kFinalTime, values, 3);
+  ASSERT_EQ(solutions.size(), values.size());
+  for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+    EXPECT_NEAR(solutions[i], 10.0 * std::exp(0.1 * (i + 1) * kFinalTime),
+                kAccuracy);
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,98 @@
+// Checks that, once it has been initialized and has taken its first steps, a
+// Simulator stepping a Diagram of primitive systems does not allocate heap
+// memory. Counting calls to malloc() relies on interposing it, which is only
+// supported with glibc; elsewhere, the simulation is run but not checked.
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+
+#ifdef __GLIBC__
+namespace {
+std::atomic<bool> g_count_mallocs{false};
+std::atomic<long> g_num_mallocs{0};
+}  // namespace
+
+extern "C" void* __libc_malloc(size_t size);
+
+// Counts the calls to malloc(), including those from operator new and from
+// Eigen's aligned allocations, while counting is enabled.
+extern "C" void* malloc(size_t size) {
+  if (g_count_mallocs.load(std::memory_order_relaxed)) {
+    g_num_mallocs.fetch_add(1, std::memory_order_relaxed);
+  }
+  return __libc_malloc(size);
+}
+#endif
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Builds the Diagram of ẋ = c - x from an Integrator, a Gain, an Adder, and a
+// ConstantVectorSource.
+std::unique_ptr<Diagram<double>> MakeFirstOrderLag() {
+  DiagramBuilder<double> builder;
+  auto integrator = builder.AddSystem<Integrator<double>>(2);
+  auto gain = builder.AddSystem<Gain<double>>(-1.0, 2);
+  auto adder = builder.AddSystem<Adder<double>>(2, 2);
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::Vector2d(1.0, 2.0));
+  builder.Connect(integrator->get_output_port(), gain->get_input_port());
+  builder.Connect(gain->get_output_port(), adder->get_input_port(0));
+  builder.Connect(source->get_output_port(), adder->get_input_port(1));
+  builder.Connect(adder->get_output_port(), integrator->get_input_port());
+  return builder.Build();
+}
+
+GTEST_TEST(SimulatorAllocationTest, SteadyStateStepToDoesNotAllocate) {
+  const auto diagram = MakeFirstOrderLag();
+  Simulator<double> simulator(*diagram);
+  IntegratorBase<double>* integrator =
+      simulator.reset_integrator<RungeKutta3Integrator<double>>(
+          *diagram, &simulator.get_mutable_context());
+  integrator->set_maximum_step_size(0.1);
+  integrator->set_target_accuracy(1e-6);
+
+  // The first steps size the Simulator's and the integrator's temporaries.
+  simulator.StepTo(1.0);
+  const int64_t num_steps = simulator.get_num_steps_taken();
+
+#ifdef __GLIBC__
+  g_num_mallocs = 0;
+  g_count_mallocs = true;
+#endif
+  simulator.StepTo(2.0);
+#ifdef __GLIBC__
+  g_count_mallocs = false;
+#endif
+
+  // The steps are error controlled, and several were taken.
+  EXPECT_GT(simulator.get_num_steps_taken(), num_steps + 1);
+  const double expected_x0 = 1.0 - std::exp(-2.0);
+  EXPECT_NEAR(simulator.get_context().get_continuous_state_vector()
+                  .GetAtIndex(0), expected_x0, 1e-5);
+
+  // With assertions armed, the output ports validate the type of every value
+  // they compute by allocating one to compare with, so only builds with
+  // assertions disarmed are expected to be allocation free.
+#if defined(__GLIBC__) && defined(DRAKE_ASSERT_IS_DISARMED)
+  EXPECT_EQ(g_num_mallocs, 0);
+#endif
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
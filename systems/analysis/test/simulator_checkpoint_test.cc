@@ -0,0 +1,65 @@
+#include "drake/systems/analysis/simulator_checkpoint.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/test_utilities/my_spring_mass_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Tests that a simulation resumed from a checkpoint follows the same
+// trajectory as the one that wrote the checkpoint.
+GTEST_TEST(SimulatorCheckpointTest, ResumeMatchesOriginal) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 30.);
+  ContextSerializer serializer;
+
+  Simulator<double> original(spring_mass);
+  spring_mass.set_position(&original.get_mutable_context(), 0.1);
+  spring_mass.set_velocity(&original.get_mutable_context(), 0.2);
+  original.get_mutable_integrator()->set_target_accuracy(1e-6);
+  original.Initialize();
+  original.StepTo(1.0);
+
+  std::vector<uint8_t> checkpoint;
+  WriteSimulatorCheckpoint(serializer, original, &checkpoint);
+  original.StepTo(2.0);
+
+  Simulator<double> resumed(spring_mass);
+  resumed.get_mutable_integrator()->set_target_accuracy(1e-6);
+  RestoreSimulatorCheckpoint(serializer, checkpoint.data(), checkpoint.size(),
+                             &resumed);
+  EXPECT_EQ(resumed.get_context().get_time(), 1.0);
+  resumed.StepTo(2.0);
+
+  EXPECT_EQ(resumed.get_context().get_time(), 2.0);
+  EXPECT_EQ(resumed.get_context().get_continuous_state_vector().CopyToVector(),
+            original.get_context().get_continuous_state_vector()
+                .CopyToVector());
+  EXPECT_EQ(resumed.get_num_steps_taken(), original.get_num_steps_taken());
+  EXPECT_EQ(resumed.get_num_discrete_updates(),
+            original.get_num_discrete_updates());
+  EXPECT_EQ(resumed.get_num_publishes(), original.get_num_publishes());
+  EXPECT_EQ(resumed.get_integrator()->get_ideal_next_step_size(),
+            original.get_integrator()->get_ideal_next_step_size());
+}
+
+GTEST_TEST(SimulatorCheckpointTest, RejectsOtherData) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  ContextSerializer serializer;
+  Simulator<double> simulator(spring_mass);
+
+  // A bare Context snapshot is not a checkpoint.
+  std::vector<uint8_t> snapshot;
+  serializer.Serialize(simulator.get_context(), &snapshot);
+  EXPECT_THROW(RestoreSimulatorCheckpoint(serializer, snapshot.data(),
+                                          snapshot.size(), &simulator),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
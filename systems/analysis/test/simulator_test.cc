@@ -1,15 +1,23 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <chrono>
 #include <cmath>
 #include <complex>
+#include <fstream>
 #include <functional>
+#include <iterator>
 #include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/explicit_euler_integrator.h"
@@ -86,6 +94,24 @@ class ExampleDiagram : public Diagram<double> {
   StatelessDiagram* stateless_diag_ = nullptr;
 };
 
+// Tests that the profile of a Diagram is written after StepTo() when a report
+// path is set.
+GTEST_TEST(SimulatorTest, ProfileReport) {
+  ExampleDiagram system(1.0);
+  system.set_profiling_enabled(true);
+  Simulator<double> simulator(system);
+  const std::string path = temp_directory() + "/simulator_profile.folded";
+  simulator.set_profile_report_path(path);
+  EXPECT_EQ(simulator.get_profile_report_path(), path);
+  simulator.StepTo(0.5);
+
+  std::ifstream in(path);
+  ASSERT_TRUE(in.good());
+  const std::string report((std::istreambuf_iterator<char>(in)),
+                           std::istreambuf_iterator<char>());
+  EXPECT_NE(report.find("stateless_diagram:witness "), std::string::npos);
+}
+
 // Tests that simulation only takes a single step when there is no continuous
 // state, regardless of the integrator maximum step size (and no discrete state
 // or events).
@@ -384,8 +410,9 @@ GTEST_TEST(SimulatorTest, FixedStepIncreasingIsolationAccuracy) {
     context.set_time(publish_time);
     double new_eval = witness.front()->CalcWitnessValue(context);
 
-    // Verify that the new evaluation is closer to zero than the old one.
-    EXPECT_LT(new_eval, eval);
+    // Verify that the new evaluation is no farther from zero than the old one.
+    // (Regula falsi isolates the zero of this linear witness exactly.)
+    EXPECT_LE(std::abs(new_eval), std::abs(eval));
     eval = new_eval;
 
     // Increase the accuracy.
@@ -394,6 +421,39 @@ GTEST_TEST(SimulatorTest, FixedStepIncreasingIsolationAccuracy) {
   }
 }
 
+// Tests that witness function isolation using the integrator's dense output
+// locates the zero of the witness function as accurately as re-integration
+// does, without taking any integration steps to do so. The logistic function
+// with k = α = ν = 1 and x(0) = -1 has the solution x(t) = 1 - 2exp(-t²/2),
+// which crosses zero at t = √(2 ln 2).
+GTEST_TEST(SimulatorTest, DenseOutputIsolation) {
+  const double t_zero = std::sqrt(2 * std::log(2.0));
+  const double accuracy = 1e-6;
+  int64_t num_steps_taken[2];
+  for (bool dense_output : {false, true}) {
+    LogisticSystem system(1, 1, 1);
+    double publish_time = 0;
+    system.set_publish_callback([&](const Context<double>& context) {
+      publish_time = context.get_time();
+    });
+
+    Simulator<double> simulator(system);
+    InitVariableStepIntegratorForWitnessTesting(&simulator);
+    IntegratorBase<double>* integrator = simulator.get_mutable_integrator();
+    integrator->set_maximum_step_size(0.5);
+    integrator->set_target_accuracy(accuracy);
+    integrator->set_dense_output_enabled(dense_output);
+    Context<double>& context = simulator.get_mutable_context();
+    context.get_mutable_continuous_state()[0] = -1;
+    context.set_accuracy(accuracy);
+    simulator.StepTo(2);
+
+    EXPECT_NEAR(publish_time, t_zero, 1e-4);
+    num_steps_taken[dense_output] = integrator->get_num_steps_taken();
+  }
+  EXPECT_LT(num_steps_taken[true], num_steps_taken[false]);
+}
+
 // Tests ability of simulation to identify the witness function triggering
 // over an interval *where both witness functions change sign from the beginning
 // to the end of the interval.
@@ -1176,6 +1236,106 @@ GTEST_TEST(SimulatorTest, DiscreteUpdateAndPublish) {
   EXPECT_EQ(200 + 1, num_publishes);
 }
 
+// Tests that the schedule of periodic events dispatches the same events, at
+// the same times, as System::CalcNextUpdateTime() does, for a Diagram of
+// several DiscreteSystems, also after the time is moved back.
+GTEST_TEST(SimulatorTest, PeriodicEventSchedule) {
+  const int kNumSystems = 3;
+  std::map<bool, std::vector<std::pair<int, int>>> counts;
+  std::map<bool, int64_t> num_steps;
+  for (bool use_schedule : {false, true}) {
+    DiagramBuilder<double> builder;
+    std::vector<std::pair<int, int>>& system_counts = counts[use_schedule];
+    system_counts.assign(kNumSystems, {0, 0});
+    for (int i = 0; i < kNumSystems; ++i) {
+      auto system = builder.AddSystem<DiscreteSystem>();
+      system->set_name("system" + std::to_string(i));
+      system->set_update_callback([&system_counts, i, system](
+          const Context<double>& context) {
+        EXPECT_TRUE(CheckSampleTime(context, system->update_period()));
+        ++system_counts[i].first;
+      });
+      system->set_publish_callback([&system_counts, i](
+          const Context<double>&) { ++system_counts[i].second; });
+    }
+    auto diagram = builder.Build();
+
+    Simulator<double> simulator(*diagram);
+    simulator.set_publish_every_time_step(false);
+    simulator.set_use_periodic_event_schedule(use_schedule);
+    EXPECT_EQ(simulator.get_use_periodic_event_schedule(), use_schedule);
+    simulator.StepTo(0.25);
+    // Moving the time back rebuilds the schedule.
+    simulator.get_mutable_context().set_time(0.2);
+    simulator.StepTo(0.5);
+    num_steps[use_schedule] = simulator.get_num_steps_taken();
+  }
+  EXPECT_EQ(counts[true], counts[false]);
+  EXPECT_EQ(num_steps[true], num_steps[false]);
+  // 500 + 50 updates, and 200 + 20 publishes plus one at initialization.
+  EXPECT_EQ(counts[true][0], std::make_pair(550, 221));
+}
+
+// Tests that the latencies of the timed events of the DiscreteSystem are
+// recorded when the Simulator runs in real time. Over 0.05 s, the system has
+// 50 updates and 20 publishes, 10 of which coincide with updates.
+GTEST_TEST(SimulatorTest, RealtimeStatistics) {
+  DiscreteSystem system;
+  Simulator<double> simulator(system);
+  simulator.set_publish_every_time_step(false);
+  EXPECT_EQ(simulator.get_late_event_policy(), LateEventPolicy::kCatchUp);
+  EXPECT_EQ(simulator.get_late_event_tolerance(), 0.0);
+  EXPECT_THROW(simulator.set_late_event_tolerance(-1.0), std::logic_error);
+
+  // No statistics are recorded without a target realtime rate.
+  simulator.StepTo(0.01);
+  EXPECT_EQ(simulator.get_realtime_statistics().get_num_events(), 0);
+
+  simulator.set_target_realtime_rate(1.0);
+  simulator.get_mutable_context().set_time(0.);
+  simulator.Initialize();
+  simulator.StepTo(0.05);
+  const RealtimeStatistics& statistics = simulator.get_realtime_statistics();
+  EXPECT_EQ(statistics.get_num_events(), 60);
+  EXPECT_EQ(statistics.get_num_skipped_events(), 0);
+  int64_t num_binned = 0;
+  for (int64_t count : statistics.get_latency_histogram()) num_binned += count;
+  EXPECT_EQ(num_binned, 60);
+  EXPECT_GE(statistics.get_max_latency(), statistics.get_mean_latency());
+}
+
+// Tests the handling of late timed events when each discrete update of the
+// DiscreteSystem takes three times longer than its period in real time.
+GTEST_TEST(SimulatorTest, LateEventPolicy) {
+  DiscreteSystem system;
+  int num_disc_updates = 0;
+  system.set_update_callback([&](const Context<double>&) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    num_disc_updates++;
+  });
+
+  Simulator<double> simulator(system);
+  simulator.set_publish_every_time_step(false);
+  simulator.set_target_realtime_rate(1.0);
+  simulator.set_late_event_tolerance(1e-3);
+
+  // Late events are skipped, but still recorded.
+  simulator.set_late_event_policy(LateEventPolicy::kSkip);
+  simulator.Initialize();
+  simulator.StepTo(0.05);
+  const RealtimeStatistics& statistics = simulator.get_realtime_statistics();
+  EXPECT_EQ(statistics.get_num_events(), 60);
+  EXPECT_GT(statistics.get_num_skipped_events(), 0);
+  EXPECT_GT(statistics.get_max_latency(), 1e-3);
+  EXPECT_LT(num_disc_updates, 50);
+
+  // Late events abort the simulation.
+  simulator.set_late_event_policy(LateEventPolicy::kThrow);
+  simulator.get_mutable_context().set_time(0.);
+  simulator.Initialize();
+  EXPECT_THROW(simulator.StepTo(0.05), std::runtime_error);
+}
+
 // Tests that the order of events in a simulator time step is first update
 // discrete state, then publish, then integrate.
 GTEST_TEST(SimulatorTest, UpdateThenPublishThenIntegrate) {
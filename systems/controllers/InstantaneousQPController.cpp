@@ -1,6 +1,7 @@
 #include "drake/systems/controllers/InstantaneousQPController.h"
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
@@ -643,6 +644,11 @@ int InstantaneousQPController::setupAndSolveQP(
   // documentation can be found there.
   // Note: argument `debug` MAY be set to NULL, which signals that no debug
   // information is requested.
+  // The matrices of the QP are members of this class, which are only
+  // reallocated when the size of the QP changes, e.g. when the number of
+  // active contact points does.
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start_time = Clock::now();
 
   double dt = 0.0;
   if (controller_state.t_prev != 0.0) {
@@ -722,7 +728,6 @@ int InstantaneousQPController::setupAndSolveQP(
 
   DRAKE_ASSERT(nu + 6 == nq);
 
-  std::vector<DesiredBodyAcceleration> desired_body_accelerations;
   desired_body_accelerations.resize(qp_input.num_tracked_bodies);
   Vector6d body_v_des, body_vdot_des;
   Vector6d body_vdot;
@@ -802,9 +807,29 @@ int InstantaneousQPController::setupAndSolveQP(
 
   MatrixXd R_DQyD_ls = R_ls + D_ls.transpose() * Qy * D_ls;
 
+  const Clock::time_point kinematics_start_time = Clock::now();
   cache.initialize(robot_state.q, robot_state.qd);
   robot->doKinematics(cache, true);
 
+  // The Jacobian of each tracked body, which is needed by its acceleration
+  // bounds, and by its equality constraints or costs.
+  body_J.resize(desired_body_accelerations.size());
+  body_Jdotv.resize(desired_body_accelerations.size());
+  for (size_t i = 0; i < desired_body_accelerations.size(); i++) {
+    Matrix<double, 6, Dynamic> Jb_compact = robot->geometricJacobian(
+        cache, 0, desired_body_accelerations[i].body_or_frame_id0,
+        desired_body_accelerations[i].body_or_frame_id0, true);
+    body_J[i] = robot->compactToFull<Matrix<double, 6, Dynamic>>(
+        Jb_compact, desired_body_accelerations[i].body_path.joint_path, true);
+    body_Jdotv[i] = robot->geometricJacobianDotTimesV(
+        cache, 0, desired_body_accelerations[i].body_or_frame_id0,
+        desired_body_accelerations[i].body_or_frame_id0);
+
+    if (qp_input.body_motion_data[i].in_floating_base_nullspace) {
+      body_J[i].block(0, 0, 6, 6).setZero();
+    }
+  }
+
   //---------------------------------------------------------------------
 
   int num_active_contact_pts = 0;
@@ -851,9 +876,6 @@ int InstantaneousQPController::setupAndSolveQP(
   J_xy = J.topRows(2);
   Jdotv_xy = Jdotv.head<2>();
 
-  MatrixXd Jcom;
-  VectorXd Jcomdotv;
-
   if (x0.size() == 6) {
     Jcom = J;
     Jcomdotv = Jdotv;
@@ -864,8 +886,6 @@ int InstantaneousQPController::setupAndSolveQP(
 
   Vector3d xcomdot = J * robot_state.qd;
 
-  MatrixXd B, JB, Jp, normals;
-  VectorXd Jpdotv;
   std::vector<double> adjusted_mus(active_supports.size());
   for (size_t i = 0; i < active_supports.size(); ++i) {
     int body_id = active_supports[i].body_idx;
@@ -883,6 +903,9 @@ int InstantaneousQPController::setupAndSolveQP(
       contactConstraintsBV(*robot, cache, num_active_contact_pts, adjusted_mus,
                            active_supports, B, JB, Jp, Jpdotv, normals);
   int neps = nc * dim;
+  const double kinematics_time =
+      std::chrono::duration<double>(Clock::now() - kinematics_start_time)
+          .count();
 
   if (params.use_center_of_mass_observer &&
       foot_force_torque_measurements.size() > 0) {
@@ -891,8 +914,8 @@ int InstantaneousQPController::setupAndSolveQP(
                                   xcomdot);
   }
 
-  VectorXd x_bar, xlimp;
-  MatrixXd D_float(6, JB.cols()), D_act(nu, JB.cols());
+  D_float.resize(6, JB.cols());
+  D_act.resize(nu, JB.cols());
   if (nc > 0) {
     if (x0.size() == 6) {
       // x, y, z com
@@ -908,6 +931,8 @@ int InstantaneousQPController::setupAndSolveQP(
 
     D_float = JB.topRows(6);
     D_act = JB.bottomRows(nu);
+  } else {
+    x_bar.resize(0);
   }
 
   int nf = nc * nd;  // number of contact force variables
@@ -925,7 +950,7 @@ int InstantaneousQPController::setupAndSolveQP(
   //  min: ybar*Qy*ybar + ubar*R*ubar + (2*S*xbar + s1)*(A*x + B*u) +
   //    w_qdd*quad(qddot_ref - qdd) + w_eps*quad(epsilon) +
   //    w_grf*quad(beta) + quad(kdot_des - (A*qdd + Adot*qd))
-  VectorXd f(nparams);
+  f.resize(nparams);
   {
     if (nc > 0) {
       // NOTE: moved Hqp calcs below, because I compute the inverse directly for
@@ -950,12 +975,12 @@ int InstantaneousQPController::setupAndSolveQP(
       f.head(nq) = -pid_out.qddot_des;
     }
   }
-  f.tail(nf + neps) = VectorXd::Zero(nf + neps);
+  f.tail(nf + neps).setZero();
 
   int neq = 6 + neps + 6 * n_body_accel_eq_constraints +
             qp_input.whole_body_data.num_constrained_dofs;
-  MatrixXd Aeq = MatrixXd::Zero(neq, nparams);
-  VectorXd beq = VectorXd::Zero(neq);
+  Aeq.setZero(neq, nparams);
+  beq.setZero(neq);
 
   // constrained floating base dynamics
   //  H_float*qdd - J_float'*lambda - Dbar_float*beta = -C_float
@@ -969,18 +994,14 @@ int InstantaneousQPController::setupAndSolveQP(
   if (nc > 0) {
     // relative acceleration constraint
     Aeq.block(6, 0, neps, nq) = Jp;
-    Aeq.block(6, nq, neps, nf) =
-        MatrixXd::Zero(neps, nf);  // note: obvious sparsity here
-    Aeq.block(6, nq + nf, neps, neps) =
-        MatrixXd::Identity(neps, neps);  // note: obvious sparsity here
+    // note: obvious sparsity here
+    Aeq.block(6, nq + nf, neps, neps).setIdentity();
     beq.segment(6, neps) = -Jpdotv - params.Kp_accel * Jp * robot_state.qd;
   }
 
   // add in body spatial equality constraints
   // VectorXd body_vdot;
   int equality_ind = 6 + neps;
-  MatrixXd Jb(6, nq);
-  Vector6d Jbdotv;
   for (size_t i = 0; i < desired_body_accelerations.size(); i++) {
     if (desired_body_accelerations[i].weight <
         0) {  // negative implies constraint
@@ -988,20 +1009,8 @@ int InstantaneousQPController::setupAndSolveQP(
           desired_body_accelerations[i].body_or_frame_id0);
       if (desired_body_accelerations[i].control_pose_when_in_contact ||
           !inSupport(active_supports, body_id0)) {
-        Matrix<double, 6, Dynamic> Jb_compact = robot->geometricJacobian(
-            cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-            desired_body_accelerations[i].body_or_frame_id0, true);
-        Jb = robot->compactToFull<Matrix<double, 6, Dynamic>>(
-            Jb_compact, desired_body_accelerations[i].body_path.joint_path,
-            true);
-        Jbdotv = robot->geometricJacobianDotTimesV(
-            cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-            desired_body_accelerations[i].body_or_frame_id0);
-
-        if (qp_input.body_motion_data[i].in_floating_base_nullspace) {
-          Jb.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-          // Jbdot.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-        }
+        const Matrix<double, 6, Dynamic>& Jb = body_J[i];
+        const Vector6d& Jbdotv = body_Jdotv[i];
         for (int j = 0; j < 6; j++) {
           if (!std::isnan(desired_body_accelerations[i].body_vdot(j))) {
             Aeq.block(equality_ind, 0, 1, nq) = Jb.row(j);
@@ -1022,9 +1031,8 @@ int InstantaneousQPController::setupAndSolveQP(
   }
 
   int n_ineq = 2 * nu + 2 * 6 * desired_body_accelerations.size();
-  MatrixXd Ain =
-      MatrixXd::Zero(n_ineq, nparams);  // note: obvious sparsity here
-  VectorXd bin = VectorXd::Zero(n_ineq);
+  Ain.setZero(n_ineq, nparams);  // note: obvious sparsity here
+  bin.setZero(n_ineq);
 
   auto B_act = robot->B.bottomRows(robot->B.cols());
 
@@ -1040,19 +1048,8 @@ int InstantaneousQPController::setupAndSolveQP(
 
   int constraint_start_index = 2 * nu;
   for (size_t i = 0; i < desired_body_accelerations.size(); i++) {
-    Matrix<double, 6, Dynamic> Jb_compact = robot->geometricJacobian(
-        cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-        desired_body_accelerations[i].body_or_frame_id0, true);
-    Jb = robot->compactToFull<Matrix<double, 6, Dynamic>>(
-        Jb_compact, desired_body_accelerations[i].body_path.joint_path, true);
-    Jbdotv = robot->geometricJacobianDotTimesV(
-        cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-        desired_body_accelerations[i].body_or_frame_id0);
-
-    if (qp_input.body_motion_data[i].in_floating_base_nullspace) {
-      Jb.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-      // Jbdot.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-    }
+    const Matrix<double, 6, Dynamic>& Jb = body_J[i];
+    const Vector6d& Jbdotv = body_Jdotv[i];
     Ain.block(constraint_start_index, 0, 6, robot->get_num_positions()) = Jb;
     bin.segment(constraint_start_index, 6) =
         -Jbdotv + desired_body_accelerations[i].accel_bounds.max;
@@ -1075,19 +1072,18 @@ int InstantaneousQPController::setupAndSolveQP(
   int info = -1;
 
   // set obj, lb, up
-  VectorXd lb(nparams), ub(nparams);
+  lb.resize(nparams);
+  ub.resize(nparams);
   lb.head(nq) = qdd_lb;
   ub.head(nq) = qdd_ub;
-  lb.segment(nq, nf) = VectorXd::Zero(nf);
-  ub.segment(nq, nf) = 1e3 * VectorXd::Ones(nf);
-  lb.tail(neps) = -params.slack_limit * VectorXd::Ones(neps);
-  ub.tail(neps) = params.slack_limit * VectorXd::Ones(neps);
+  lb.segment(nq, nf).setZero();
+  ub.segment(nq, nf).setConstant(1e3);
+  lb.tail(neps).setConstant(-params.slack_limit);
+  ub.tail(neps).setConstant(params.slack_limit);
 
-  VectorXd alpha(nparams);
+  alpha.resize(nparams);
 
-  MatrixXd Qnfdiag(nf, 1), Qneps(neps, 1);
-  std::vector<MatrixXd*> QBlkDiag(
-      nc > 0 ? 3 : 1);  // nq, nf, neps   // this one is for gurobi
+  QBlkDiag.resize(nc > 0 ? 3 : 1);  // nq, nf, neps   // this one is for gurobi
 
   VectorXd w = (w_qdd.array() + REG).matrix();
 
@@ -1097,6 +1093,7 @@ int InstantaneousQPController::setupAndSolveQP(
   }
   controller_state.num_active_contact_pts = nc;
 
+  Clock::time_point solve_start_time;
 #ifdef USE_MATRIX_INVERSION_LEMMA
   double max_body_accel_weight = -numeric_limits<double>::infinity();
   for (int i = 0; i < desired_body_accelerations.size(); i++) {
@@ -1139,8 +1136,8 @@ int InstantaneousQPController::setupAndSolveQP(
     }
 #endif
 
-    Qnfdiag = MatrixXd::Constant(nf, 1, 1 / REG);
-    Qneps = MatrixXd::Constant(neps, 1, 1 / (.001 + REG));
+    Qnfdiag.setConstant(nf, 1, 1 / REG);
+    Qneps.setConstant(neps, 1, 1 / (.001 + REG));
 
     QBlkDiag[0] = &Hqp;
     if (nc > 0) {
@@ -1149,11 +1146,12 @@ int InstantaneousQPController::setupAndSolveQP(
                              // Q(nparams-neps:end, nparams-neps:end)=eye(neps)
     }
 
-    MatrixXd Ain_lb_ub(n_ineq + 2 * nparams, nparams);
-    VectorXd bin_lb_ub(n_ineq + 2 * nparams);
-    Ain_lb_ub << Ain,  // note: obvious sparsity here
-        -MatrixXd::Identity(nparams, nparams),
-        MatrixXd::Identity(nparams, nparams);
+    Ain_lb_ub.resize(n_ineq + 2 * nparams, nparams);
+    bin_lb_ub.resize(n_ineq + 2 * nparams);
+    Ain_lb_ub.topRows(n_ineq) = Ain;  // note: obvious sparsity here
+    Ain_lb_ub.middleRows(n_ineq, nparams) =
+        -MatrixXd::Identity(nparams, nparams);
+    Ain_lb_ub.bottomRows(nparams).setIdentity();
     bin_lb_ub << bin, -lb, ub;
 
     for (std::set<int>::iterator it = controller_state.active.begin();
@@ -1164,6 +1162,7 @@ int InstantaneousQPController::setupAndSolveQP(
       }
     }
 
+    solve_start_time = Clock::now();
     info = fastQPThatTakesQinv(QBlkDiag, f, Aeq, beq, Ain_lb_ub, bin_lb_ub,
                                controller_state.active, alpha);
 
@@ -1189,20 +1188,8 @@ int InstantaneousQPController::setupAndSolveQP(
             desired_body_accelerations[i].body_or_frame_id0);
         if (desired_body_accelerations[i].control_pose_when_in_contact ||
             !inSupport(active_supports, body_id0)) {
-          Matrix<double, 6, Dynamic> Jb_compact = robot->geometricJacobian(
-              cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-              desired_body_accelerations[i].body_or_frame_id0, true);
-          Jb = robot->compactToFull<Matrix<double, 6, Dynamic>>(
-              Jb_compact, desired_body_accelerations[i].body_path.joint_path,
-              true);
-          Jbdotv = robot->geometricJacobianDotTimesV(
-              cache, 0, desired_body_accelerations[i].body_or_frame_id0,
-              desired_body_accelerations[i].body_or_frame_id0);
-
-          if (qp_input.body_motion_data[i].in_floating_base_nullspace) {
-            Jb.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-            // Jbdot.block(0, 0, 6, 6) = MatrixXd::Zero(6, 6);
-          }
+          const Matrix<double, 6, Dynamic>& Jb = body_J[i];
+          const Vector6d& Jbdotv = body_Jdotv[i];
           for (int j = 0; j < 6; j++) {
             if (!std::isnan(desired_body_accelerations[i].body_vdot[j])) {
               Hqp += desired_body_accelerations[i].weight *
@@ -1219,8 +1206,8 @@ int InstantaneousQPController::setupAndSolveQP(
       }
     }
 
-    Qnfdiag = MatrixXd::Constant(nf, 1, params.w_grf + REG);
-    Qneps = MatrixXd::Constant(neps, 1, params.w_slack + REG);
+    Qnfdiag.setConstant(nf, 1, params.w_grf + REG);
+    Qneps.setConstant(neps, 1, params.w_slack + REG);
 
     QBlkDiag[0] = &Hqp;
     if (nc > 0) {
@@ -1229,11 +1216,12 @@ int InstantaneousQPController::setupAndSolveQP(
                              // Q(nparams-neps:end, nparams-neps:end)=eye(neps)
     }
 
-    MatrixXd Ain_lb_ub(n_ineq + 2 * nparams, nparams);
-    VectorXd bin_lb_ub(n_ineq + 2 * nparams);
-    Ain_lb_ub << Ain,  // note: obvious sparsity here
-        -MatrixXd::Identity(nparams, nparams),
-        MatrixXd::Identity(nparams, nparams);
+    Ain_lb_ub.resize(n_ineq + 2 * nparams, nparams);
+    bin_lb_ub.resize(n_ineq + 2 * nparams);
+    Ain_lb_ub.topRows(n_ineq) = Ain;  // note: obvious sparsity here
+    Ain_lb_ub.middleRows(n_ineq, nparams) =
+        -MatrixXd::Identity(nparams, nparams);
+    Ain_lb_ub.bottomRows(nparams).setIdentity();
     bin_lb_ub << bin, -lb, ub;
 
     for (std::set<int>::iterator it = controller_state.active.begin();
@@ -1244,6 +1232,7 @@ int InstantaneousQPController::setupAndSolveQP(
       }
     }
 
+    solve_start_time = Clock::now();
     if (use_fast_qp > 0) {  // set up and call fastqp
       info = fastQP(QBlkDiag, f, Aeq, beq, Ain_lb_ub, bin_lb_ub,
                     controller_state.active, alpha);
@@ -1272,6 +1261,7 @@ int InstantaneousQPController::setupAndSolveQP(
 #ifdef USE_MATRIX_INVERSION_LEMMA
   }
 #endif
+  const Clock::time_point solve_end_time = Clock::now();
 
   //----------------------------------------------------------------------
   // Solve for inputs ----------------------------------------------------
@@ -1306,6 +1296,13 @@ int InstantaneousQPController::setupAndSolveQP(
   // Remember t for next time around
   controller_state.t_prev = robot_state.t;
 
+  qp_output.timing.kinematics = kinematics_time;
+  qp_output.timing.setup =
+      std::chrono::duration<double>(solve_start_time - start_time).count() -
+      kinematics_time;
+  qp_output.timing.solve =
+      std::chrono::duration<double>(solve_end_time - solve_start_time).count();
+
   // If a debug pointer was passed in, fill it with useful data
   if (debug) {
     debug->active_supports.resize(active_supports.size());
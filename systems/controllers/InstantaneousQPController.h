@@ -4,6 +4,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_stl_types.h"
@@ -96,6 +97,31 @@ class InstantaneousQPController {
   Eigen::VectorXd qdd_lb;
   Eigen::VectorXd qdd_ub;
 
+  // Per-update data of the QP, kept here so that it is only reallocated
+  // when the size of the QP changes.
+  Eigen::MatrixXd Jcom;
+  Eigen::VectorXd Jcomdotv;
+  Eigen::MatrixXd B, JB, Jp, normals;
+  Eigen::VectorXd Jpdotv;
+  Eigen::VectorXd xlimp, x_bar;
+  Eigen::MatrixXd D_float, D_act;
+  Eigen::VectorXd f;
+  Eigen::MatrixXd Aeq;
+  Eigen::VectorXd beq;
+  Eigen::MatrixXd Ain;
+  Eigen::VectorXd bin;
+  Eigen::VectorXd lb, ub;
+  Eigen::VectorXd alpha;
+  Eigen::MatrixXd Qnfdiag, Qneps;
+  std::vector<Eigen::MatrixXd*> QBlkDiag;
+  Eigen::MatrixXd Ain_lb_ub;
+  Eigen::VectorXd bin_lb_ub;
+  drake::eigen_aligned_std_vector<DesiredBodyAcceleration>
+      desired_body_accelerations;
+  // Jacobian and Jacobian dot times v of each of desired_body_accelerations.
+  std::vector<Eigen::Matrix<double, 6, Eigen::Dynamic>> body_J;
+  drake::eigen_aligned_std_vector<Vector6d> body_Jdotv;
+
   // momentum controller-specific
   Eigen::MatrixXd Ag;      // centroidal momentum matrix
   Vector6d Agdot_times_v;  // centroidal momentum velocity-dependent bias
@@ -305,11 +305,22 @@ struct DesiredBodyAcceleration {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+// Wall clock time spent in each phase of one controller update, in seconds.
+struct QPControllerTiming {
+  // Kinematics, dynamics and contact Jacobians of the robot.
+  double kinematics{0};
+  // Everything else that builds the QP.
+  double setup{0};
+  // The QP solver(s).
+  double solve{0};
+};
+
 struct QPControllerOutput {
   Eigen::VectorXd q_ref;
   Eigen::VectorXd qd_ref;
   Eigen::VectorXd qdd;
   Eigen::VectorXd u;
+  QPControllerTiming timing;
 };
 
 struct QPControllerDebugData {
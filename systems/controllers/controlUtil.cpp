@@ -3,6 +3,7 @@
 #include <limits>
 #include <utility>
 
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/expmap.h"
 #include "drake/math/quaternion.h"
@@ -432,10 +433,13 @@ void evaluateXYZExpmapCubicSpline(
     Vector6d& xyzdot_angular_vel,
     // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
     Vector6d& xyzddot_angular_accel) {
-  Vector6d xyzexp = spline.value(t);
-  auto derivative = spline.derivative();
-  Vector6d xyzexpdot = derivative.value(t);
-  Vector6d xyzexpddot = derivative.derivative().value(t);
+  // Evaluates the spline and its derivatives from one packed copy of its
+  // coefficients, instead of building its derivative PiecewisePolynomials.
+  const drake::trajectories::PiecewisePolynomialEvaluator packed_spline(spline);
+  Vector6d xyzexp, xyzexpdot, xyzexpddot;
+  packed_spline.EvalInto(t, 0, xyzexp);
+  packed_spline.EvalInto(t, 1, xyzexpdot);
+  packed_spline.EvalInto(t, 2, xyzexpddot);
 
   // translational part
   body_pose_des.translation() = xyzexp.head<3>();
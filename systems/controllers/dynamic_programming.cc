@@ -1,9 +1,14 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/wrap_to.h"
 #include "drake/solvers/mathematical_program.h"
@@ -19,6 +24,27 @@ DynamicProgrammingOptions::PeriodicBoundaryCondition::PeriodicBoundaryCondition(
   DRAKE_DEMAND(low_in < high_in);
 }
 
+namespace {
+
+// Returns a Simulator of @p prototype's System for @p context, whose default
+// integrator has the accuracy settings of @p prototype's integrator.
+std::unique_ptr<Simulator<double>> MakeThreadSimulator(
+    const Simulator<double>& prototype,
+    std::unique_ptr<Context<double>> context) {
+  auto result = std::make_unique<Simulator<double>>(prototype.get_system(),
+                                                    std::move(context));
+  const IntegratorBase<double>* settings = prototype.get_integrator();
+  IntegratorBase<double>* integrator = result->get_mutable_integrator();
+  if (!std::isnan(settings->get_target_accuracy())) {
+    integrator->set_target_accuracy(settings->get_target_accuracy());
+  }
+  integrator->set_maximum_step_size(settings->get_maximum_step_size());
+  integrator->set_fixed_step_mode(settings->get_fixed_step_mode());
+  return result;
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<BarycentricMeshSystem<double>>, Eigen::RowVectorXd>
 FittedValueIteration(
     Simulator<double>* simulator,
@@ -34,7 +60,7 @@ FittedValueIteration(
   DRAKE_DEMAND(input_size > 0);
 
   const auto& system = simulator->get_system();
-  auto& context = simulator->get_mutable_context();
+  const auto& context = simulator->get_context();
 
   math::BarycentricMesh<double> state_mesh(state_grid);
   math::BarycentricMesh<double> input_mesh(input_grid);
@@ -66,34 +92,66 @@ FittedValueIteration(
   // where Tind[input](:,state) is a list of non-zero indexes into the
   // state_mesh, and T[input](:,state) is the associated list of coefficients.
   // cost[input](j) is the cost of taking action input from state mesh index j.
+  // They are computed once, so that each value iteration update below only
+  // reads them.
   std::vector<Eigen::MatrixXi> Tind(num_inputs);
   std::vector<Eigen::MatrixXd> T(num_inputs);
   std::vector<Eigen::RowVectorXd> cost(num_inputs);
-
-  drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
   for (int input = 0; input < num_inputs; input++) {
     Tind[input].resize(num_state_indices, num_states);
     T[input].resize(num_state_indices, num_states);
     cost[input].resize(num_states);
+  }
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    context.FixInputPort(0, input_vec);
+  // The Simulator of each thread; a single thread uses the given one.
+  const int num_threads = options.num_threads;
+  DRAKE_DEMAND(num_threads > 0);
+  std::vector<std::unique_ptr<Simulator<double>>> owned_simulators;
+  std::vector<Simulator<double>*> simulators{simulator};
+  if (num_threads > 1) {
+    simulators.clear();
+    for (int i = 0; i < num_threads; ++i) {
+      owned_simulators.push_back(
+          options.simulator_factory
+              ? options.simulator_factory(system, context.Clone())
+              : MakeThreadSimulator(*simulator, context.Clone()));
+      DRAKE_DEMAND(owned_simulators.back() != nullptr);
+      simulators.push_back(owned_simulators.back().get());
+    }
+  }
 
-    for (int state = 0; state < num_states; state++) {
-      context.set_time(0.0);
+  drake::log()->info("Computing transition and cost matrices.");
+  // The (input, state) samples are handed out in input-major order, so that
+  // each thread rarely has to fix a new input.
+  std::atomic<int> next_sample(0);
+  ParallelFor(num_threads, num_threads, [&](int thread) {
+    Simulator<double>& thread_simulator = *simulators[thread];
+    auto& thread_context = thread_simulator.get_mutable_context();
+    auto& sim_state = thread_context.get_mutable_continuous_state_vector();
+
+    Eigen::VectorXd input_vec(input_mesh.get_input_size());
+    Eigen::VectorXd state_vec(state_mesh.get_input_size());
+
+    Eigen::VectorXi Tind_tmp(num_state_indices);
+    Eigen::VectorXd T_tmp(num_state_indices);
+
+    int fixed_input = -1;
+    for (int sample = next_sample++; sample < num_inputs * num_states;
+         sample = next_sample++) {
+      const int input = sample / num_states;
+      const int state = sample % num_states;
+      if (input != fixed_input) {
+        input_mesh.get_mesh_point(input, &input_vec);
+        thread_context.FixInputPort(0, input_vec);
+        fixed_input = input;
+      }
+
+      thread_context.set_time(0.0);
       sim_state.SetFromVector(state_mesh.get_mesh_point(state));
 
-      cost[input](state) = timestep * cost_function(context);
+      cost[input](state) = timestep * cost_function(thread_context);
 
-      simulator->StepTo(timestep);
+      thread_simulator.StepTo(timestep);
       state_vec = sim_state.CopyToVector();
 
       for (const auto& b : options.periodic_boundary_conditions) {
@@ -105,7 +163,7 @@ FittedValueIteration(
       Tind[input].col(state) = Tind_tmp;
       T[input].col(state) = T_tmp;
     }
-  }
+  });
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
@@ -113,30 +171,38 @@ FittedValueIteration(
   Eigen::RowVectorXd Jnext(num_states);
   Eigen::MatrixXd Pi(input_mesh.get_input_size(), num_states);
 
+  // Each value iteration update splits the states into one contiguous block
+  // per thread.
+  const int num_blocks = std::min(num_threads, num_states);
+  const int block_size = (num_states + num_blocks - 1) / num_blocks;
+
   drake::log()->info("Running value iteration.");
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
+    ParallelFor(num_blocks, num_threads, [&](int block) {
+      const int end = std::min((block + 1) * block_size, num_states);
+      for (int state = block * block_size; state < end; state++) {
+        Jnext(state) = std::numeric_limits<double>::infinity();
+
+        int best_input = 0;
+        for (int input = 0; input < num_inputs; input++) {
+          // Q(x,u) = g(x,u) + γ J(f(x,u)).
+          double Q = cost[input](state);
+          for (int index = 0; index < num_state_indices; index++) {
+            Q += options.discount_factor * T[input](index, state) *
+                 J(Tind[input](index, state));
+          }
+          // Cost-to-go: J = minᵤ Q(x,u).
+          // Policy:  π(x) = argminᵤ Q(x,u).
+          if (Q < Jnext(state)) {
+            Jnext(state) = Q;
+            best_input = input;
+          }
         }
+        Pi.col(state) = input_mesh.get_mesh_point(best_input);
       }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
+    });
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
     J = Jnext;
     iteration++;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <set>
@@ -48,6 +49,24 @@ struct DynamicProgrammingOptions {
       int iteration, const math::BarycentricMesh<double>& state_mesh,
       const Eigen::RowVectorXd& cost_to_go, const Eigen::MatrixXd& policy)>
       visualization_callback{nullptr};
+
+  /// The number of threads used to simulate the transitions from the mesh
+  /// points and to compute the value iteration updates (see
+  /// FittedValueIteration).  With more than one thread, each thread simulates
+  /// with a Simulator of its own, made by `simulator_factory`, instead of the
+  /// Simulator that is passed in; the results are then the same for any
+  /// number of threads.  The cost function must be safe to call concurrently
+  /// from several threads with different Contexts.
+  int num_threads{1};
+
+  /// When num_threads > 1, this makes the Simulator of each thread from the
+  /// System of the Simulator that is passed in and a clone of its Context.
+  /// If not callable, each thread uses a Simulator with the default
+  /// integrator, which is given the target accuracy, maximum step size and
+  /// fixed step mode of the integrator of the Simulator that is passed in.
+  std::function<std::unique_ptr<Simulator<double>>(
+      const System<double>& system, std::unique_ptr<Context<double>> context)>
+      simulator_factory{nullptr};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
@@ -65,7 +84,9 @@ struct DynamicProgrammingOptions {
 /// a Context for that system, which may contain non-default Parameters, etc.
 /// The @p simulator is run for @p timestep seconds from every point on the mesh
 /// in order to approximate the dynamics; all of the simulation parameters
-/// (integrator, etc) are relevant during that evaluation.
+/// (integrator, etc) are relevant during that evaluation.  When
+/// `options.num_threads > 1`, copies made by `options.simulator_factory` are
+/// run instead.
 ///
 /// @param cost_function is the continuous-time instantaneous cost.  This
 /// implementation of the discrete-time formulation above uses the approximation
@@ -3,16 +3,14 @@
 #include <memory>
 #include <utility>
 
+#include <Eigen/Cholesky>
+
 #include "drake/common/eigen_types.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using solvers::VectorXDecisionVariable;
-using trajectory_optimization::DirectTranscription;
-
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -66,49 +64,48 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    state_ref_ =
+        base_context_->get_discrete_state().get_vector().CopyToVector();
+    input_ref_ = model_->EvalEigenVectorInput(*base_context_, 0);
+    K_ = CalcFirstStepGain();
   }
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
+  DRAKE_DEMAND(linear_model_ != nullptr);
+
   const Eigen::VectorBlock<const VectorX<T>> current_state =
       this->EvalEigenVectorInput(context, state_input_index_);
 
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
-
-  const VectorX<T> input_ref = model_->EvalEigenVectorInput(*base_context_, 0);
-
-  control->SetFromVector(current_input + input_ref);
+  control->SetFromVector(input_ref_ - K_ * (current_state - state_ref_));
 
   // TODO(jadecastro) Implement the time-varying case.
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
-  DRAKE_DEMAND(linear_model_ != nullptr);
-
+Eigen::MatrixXd LinearModelPredictiveController<T>::CalcFirstStepGain() const {
   const int kNumSampleTimes =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
-
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
-
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
-
-  const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
-
-  DRAKE_DEMAND(prog.Solve() == solvers::SolutionResult::kSolutionFound);
-
-  return prog.GetInputSamples().col(0);
+  DRAKE_DEMAND(kNumSampleTimes > 1);
+
+  const Eigen::MatrixXd& A = linear_model_->A();
+  const Eigen::MatrixXd& B = linear_model_->B();
+
+  // The running cost is applied to the first N - 1 samples only, so the
+  // cost-to-go of the last sample is zero.  The common factor of time_period_
+  // in the cost does not change the minimizer, and is left out.
+  Eigen::MatrixXd S = Eigen::MatrixXd::Zero(num_states_, num_states_);
+  Eigen::MatrixXd K(num_inputs_, num_states_);
+  for (int i = kNumSampleTimes - 2; i >= 0; --i) {
+    const Eigen::MatrixXd BtS = B.transpose() * S;
+    K = (R_ + BtS * B).llt().solve(BtS * A);
+    S = Q_ + A.transpose() * S * (A - B * K);
+    // Symmetrize, so that round-off does not accumulate over long horizons.
+    S = (0.5 * (S + S.transpose())).eval();
+  }
+  return K;
 }
 
 template class LinearModelPredictiveController<double>;
@@ -23,9 +23,13 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// Without inequality constraints, the QP is the finite-horizon LQR problem of
+/// the linearized model, whose solution is linear in the state error.  The
+/// constructor therefore solves it once, by the backward Riccati recursion
+/// over the N samples of the horizon (O(N) time, with memory independent of
+/// N), and every control update only evaluates u(k) = ud - K (x(k) - xd).
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 /// - double
@@ -78,10 +82,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Returns the gain K of the optimal first input, u(0) = -K x(0), of the
+  // finite-horizon LQR problem of the linear model, by the backward Riccati
+  // recursion of the dynamic programming cost-to-go.
+  Eigen::MatrixXd CalcFirstStepGain() const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -101,6 +105,12 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The reference state and input of base_context_, and the feedback gain on
+  // the state error, which are only set when linear_model_ is.
+  Eigen::VectorXd state_ref_;
+  Eigen::VectorXd input_ref_;
+  Eigen::MatrixXd K_;
 };
 
 }  // namespace controllers
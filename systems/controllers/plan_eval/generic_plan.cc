@@ -84,11 +84,8 @@ void GenericPlan<T>::UpdateQpInput(
         traj.get_pose(interp_time), traj.get_velocity(interp_time),
         traj.get_acceleration(interp_time), kp, kd);
 
-    Isometry3<T> pose = robot_status.get_robot().CalcBodyPoseInWorldFrame(
-        robot_status.get_cache(), *body);
-    Vector6<T> velocity =
-        robot_status.get_robot().CalcBodySpatialVelocityInWorldFrame(
-            robot_status.get_cache(), *body);
+    const Isometry3<T>& pose = robot_status.get_body_pose(*body);
+    const Vector6<T>& velocity = robot_status.get_body_velocity(*body);
     qp_input->mutable_desired_body_motions()
         .at(body->get_name())
         .mutable_values() = tracker.ComputeTargetAcceleration(pose, velocity);
@@ -25,8 +25,7 @@ void ManipulatorMoveEndEffectorPlan<T>::InitializeGenericPlanDerived(
                                 robot_status.get_time() + 1};
   const RigidBody<T>* ee_body =
       alias_groups.get_body(kEndEffectorAliasGroupName);
-  Isometry3<T> ee_pose = robot_status.get_robot().CalcBodyPoseInWorldFrame(
-      robot_status.get_cache(), *ee_body);
+  const Isometry3<T>& ee_pose = robot_status.get_body_pose(*ee_body);
 
   manipulation::PiecewiseCartesianTrajectory<T> ee_traj =
       manipulation::PiecewiseCartesianTrajectory<
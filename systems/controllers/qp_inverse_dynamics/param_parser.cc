@@ -282,16 +282,24 @@ std::unordered_map<std::string, ContactInformation>
 ParamSet::MakeContactInformation(
     const std::string& group_name,
     const RigidBodyTreeAliasGroups<double>& alias_groups) const {
+  if (!alias_groups.has_body_group(group_name)) {
+    return {};
+  }
+  return MakeContactInformation(alias_groups.get_body_group_index(group_name),
+                                alias_groups);
+}
+
+std::unordered_map<std::string, ContactInformation>
+ParamSet::MakeContactInformation(
+    int group_index,
+    const RigidBodyTreeAliasGroups<double>& alias_groups) const {
   std::unordered_map<std::string, ContactInformation> contacts;
-  if (alias_groups.has_body_group(group_name)) {
-    const std::vector<const RigidBody<double>*>& bodies =
-        alias_groups.get_body_group(group_name);
-
-    for (const RigidBody<double>* body : bodies) {
-      const ContactParam& param = FindParam(body->get_name(), contact_params_);
-      contacts.emplace(body->get_name(),
-                       MakeContactInformationFromParam(*body, param));
-    }
+  const std::vector<const RigidBody<double>*>& bodies =
+      alias_groups.get_body_group(group_index);
+  for (const RigidBody<double>* body : bodies) {
+    const ContactParam& param = FindParam(body->get_name(), contact_params_);
+    contacts.emplace(body->get_name(),
+                     MakeContactInformationFromParam(*body, param));
   }
 
   return contacts;
@@ -301,16 +309,25 @@ std::unordered_map<std::string, DesiredBodyMotion>
 ParamSet::MakeDesiredBodyMotion(
     const std::string& group_name,
     const RigidBodyTreeAliasGroups<double>& alias_groups) const {
+  if (!alias_groups.has_body_group(group_name)) {
+    return {};
+  }
+  return MakeDesiredBodyMotion(alias_groups.get_body_group_index(group_name),
+                               alias_groups);
+}
+
+std::unordered_map<std::string, DesiredBodyMotion>
+ParamSet::MakeDesiredBodyMotion(
+    int group_index,
+    const RigidBodyTreeAliasGroups<double>& alias_groups) const {
   std::unordered_map<std::string, DesiredBodyMotion> motions;
-  if (alias_groups.has_body_group(group_name)) {
-    const std::vector<const RigidBody<double>*>& bodies =
-        alias_groups.get_body_group(group_name);
-    for (const RigidBody<double>* body : bodies) {
-      const DesiredMotionParam& param =
-          FindParam(body->get_name(), body_motion_params_);
-      motions.emplace(body->get_name(),
-                      MakeDesiredBodyMotionFromParam(*body, param));
-    }
+  const std::vector<const RigidBody<double>*>& bodies =
+      alias_groups.get_body_group(group_index);
+  for (const RigidBody<double>* body : bodies) {
+    const DesiredMotionParam& param =
+        FindParam(body->get_name(), body_motion_params_);
+    motions.emplace(body->get_name(),
+                    MakeDesiredBodyMotionFromParam(*body, param));
   }
 
   return motions;
@@ -371,26 +388,33 @@ void ParamSet::LookupDesiredBodyMotionGains(
     const RigidBodyTreeAliasGroups<double>& alias_group,
     std::vector<Vector6<double>>* kp, std::vector<Vector6<double>>* kd) const {
   if (alias_group.has_body_group(group_name)) {
-    const std::vector<const RigidBody<double>*> bodies =
-        alias_group.get_body_group(group_name);
-    int ctr = 0;
-    kp->resize(bodies.size());
-    kd->resize(bodies.size());
-    for (const RigidBody<double>* body : bodies) {
-      const DesiredMotionParam& param =
-          FindParam(body->get_name(), body_motion_params_);
-      DRAKE_DEMAND(param.kp.size() == 6);
-      DRAKE_DEMAND(param.kd.size() == 6);
-      (*kp)[ctr] = param.kp;
-      (*kd)[ctr] = param.kd;
-      ctr++;
-    }
+    LookupDesiredBodyMotionGains(alias_group.get_body_group_index(group_name),
+                                 alias_group, kp, kd);
   } else {
     kp->clear();
     kd->clear();
   }
 }
 
+void ParamSet::LookupDesiredBodyMotionGains(
+    int group_index, const RigidBodyTreeAliasGroups<double>& alias_group,
+    std::vector<Vector6<double>>* kp, std::vector<Vector6<double>>* kd) const {
+  const std::vector<const RigidBody<double>*>& bodies =
+      alias_group.get_body_group(group_index);
+  int ctr = 0;
+  kp->resize(bodies.size());
+  kd->resize(bodies.size());
+  for (const RigidBody<double>* body : bodies) {
+    const DesiredMotionParam& param =
+        FindParam(body->get_name(), body_motion_params_);
+    DRAKE_DEMAND(param.kp.size() == 6);
+    DRAKE_DEMAND(param.kd.size() == 6);
+    (*kp)[ctr] = param.kp;
+    (*kd)[ctr] = param.kd;
+    ctr++;
+  }
+}
+
 void ParamSet::LookupDesiredBodyMotionGains(const RigidBody<double>& body,
                                             Vector6<double>* kp,
                                             Vector6<double>* kd) const {
@@ -426,6 +450,27 @@ QpInput ParamSet::MakeQpInput(
     const std::vector<std::string>& contact_body_groups,
     const std::vector<std::string>& tracked_body_groups,
     const RigidBodyTreeAliasGroups<double>& alias_group) const {
+  // Resolves the group names to handles, skipping unknown groups, which
+  // contribute nothing.
+  auto to_indices = [&alias_group](const std::vector<std::string>& names) {
+    std::vector<int> indices;
+    indices.reserve(names.size());
+    for (const std::string& name : names) {
+      if (alias_group.has_body_group(name)) {
+        indices.push_back(alias_group.get_body_group_index(name));
+      }
+    }
+    return indices;
+  };
+  return MakeQpInputFromGroupIndices(to_indices(contact_body_groups),
+                                     to_indices(tracked_body_groups),
+                                     alias_group);
+}
+
+QpInput ParamSet::MakeQpInputFromGroupIndices(
+    const std::vector<int>& contact_body_groups,
+    const std::vector<int>& tracked_body_groups,
+    const RigidBodyTreeAliasGroups<double>& alias_group) const {
   QpInput qp_input(GetDofNames(alias_group.get_tree()));
 
   // Inserts all contacts.
@@ -180,6 +180,18 @@ class ParamSet {
       const std::string& group_name,
       const RigidBodyTreeAliasGroups<double>& alias_group) const;
 
+  /**
+   * Same as MakeContactInformation(const std::string&, const
+   * RigidBodyTreeAliasGroups<double>&), but with the body group identified by
+   * its handle @p group_index in @p alias_group, which saves the name lookup.
+   *
+   * @throws std::out_of_range if @p group_index is not a body group handle of
+   * @p alias_group.
+   */
+  std::unordered_map<std::string, ContactInformation> MakeContactInformation(
+      int group_index,
+      const RigidBodyTreeAliasGroups<double>& alias_group) const;
+
   /**
    * Returns a map from body names to DesiredBodyMotions, where the body names
    * belongs to the body group specified by @p group_name in @p alias_group.
@@ -199,6 +211,18 @@ class ParamSet {
       const std::string& group_name,
       const RigidBodyTreeAliasGroups<double>& alias_group) const;
 
+  /**
+   * Same as MakeDesiredBodyMotion(const std::string&, const
+   * RigidBodyTreeAliasGroups<double>&), but with the body group identified by
+   * its handle @p group_index in @p alias_group, which saves the name lookup.
+   *
+   * @throws std::out_of_range if @p group_index is not a body group handle of
+   * @p alias_group.
+   */
+  std::unordered_map<std::string, DesiredBodyMotion> MakeDesiredBodyMotion(
+      int group_index,
+      const RigidBodyTreeAliasGroups<double>& alias_group) const;
+
   /**
    * Returns a single ContactInformation for @p body. If @p body has no
    * corresponding ContactParam, a ContactInformation constructed with the
@@ -237,6 +261,19 @@ class ParamSet {
       const RigidBodyTreeAliasGroups<double>& alias_group,
       std::vector<Vector6<double>>* kp, std::vector<Vector6<double>>* kd) const;
 
+  /**
+   * Same as LookupDesiredBodyMotionGains(const std::string&, const
+   * RigidBodyTreeAliasGroups<double>&, std::vector<Vector6<double>>*,
+   * std::vector<Vector6<double>>*), but with the body group identified by its
+   * handle @p group_index in @p alias_group, which saves the name lookup.
+   *
+   * @throws std::out_of_range if @p group_index is not a body group handle of
+   * @p alias_group.
+   */
+  void LookupDesiredBodyMotionGains(
+      int group_index, const RigidBodyTreeAliasGroups<double>& alias_group,
+      std::vector<Vector6<double>>* kp, std::vector<Vector6<double>>* kd) const;
+
   /**
    * Finds the kp and kd gains for @p body. If it has no corresponding
    * DesiredMotionParam, the kp and kd will be set to the values in the default
@@ -307,6 +344,24 @@ class ParamSet {
       const std::vector<std::string>& tracked_body_groups,
       const RigidBodyTreeAliasGroups<double>& alias_group) const;
 
+  /**
+   * Same as MakeQpInput(const std::vector<std::string>&, const
+   * std::vector<std::string>&, const RigidBodyTreeAliasGroups<double>&), but
+   * with the body groups identified by their handles in @p alias_group, which
+   * saves the name lookups. Controllers that make a QpInput on every tick
+   * should resolve the group names to handles once, with
+   * RigidBodyTreeAliasGroups::get_body_group_index(), and call this. (This is
+   * not an overload of MakeQpInput(), so that braced lists of group names
+   * remain unambiguous.)
+   *
+   * @throws std::out_of_range if any element of @p contact_body_groups or
+   * @p tracked_body_groups is not a body group handle of @p alias_group.
+   */
+  QpInput MakeQpInputFromGroupIndices(
+      const std::vector<int>& contact_body_groups,
+      const std::vector<int>& tracked_body_groups,
+      const RigidBodyTreeAliasGroups<double>& alias_group) const;
+
   /**
    * Returns a QpInput for the given contacts and tracked bodies using the
    * parameters held by this instance. Note that this function only sets the
@@ -1,5 +1,7 @@
 #include "drake/systems/controllers/qp_inverse_dynamics/qp_inverse_dynamics.h"
 
+#include <string>
+
 #include "drake/common/text_logging.h"
 
 namespace drake {
@@ -67,6 +69,19 @@ QpInverseDynamics::QpInverseDynamics() {
   }
 }
 
+void QpInverseDynamics::set_cache_workspaces(bool flag) {
+  cache_workspaces_ = flag;
+  if (cache_workspaces_) return;
+  // Only keep the workspace in use.
+  for (auto it = workspaces_.begin(); it != workspaces_.end();) {
+    if (it->first == ws_key_) {
+      ++it;
+    } else {
+      it = workspaces_.erase(it);
+    }
+  }
+}
+
 bool QpInverseDynamics::HasFloatingBase(
     const RigidBodyTree<double>& robot) const {
   if (robot.get_num_bodies() < 2) return false;
@@ -142,19 +157,35 @@ void QpInverseDynamics::ResizeQP(const RigidBodyTree<double>& robot,
     }
   }
 
-  // Structure of the QP remains the same, no need to make a new
-  // MathematicalProgram.
-  if (num_contact_body == num_contact_body_ && num_vd == num_vd_ &&
-      num_basis == num_basis_ && num_point_force == num_point_force_ &&
-      num_torque == num_torque_ && num_variable == num_variable_ &&
-      num_body_motion_as_cost == num_body_motion_as_cost_ &&
-      num_body_motion_as_eq == num_body_motion_as_eq_ &&
-      num_dof_motion_as_cost == num_dof_motion_as_cost_ &&
-      num_dof_motion_as_eq == num_dof_motion_as_eq_ &&
-      num_dof_motion_as_eq == num_dof_motion_as_eq_ &&
-      num_dof_motion_as_cost == num_dof_motion_as_cost_ &&
-      num_contact_as_cost == num_contact_as_cost_ &&
-      num_contact_as_eq == num_contact_as_eq_) {
+  // The structure of the QP is fully described by the dimensions above, and
+  // by the contacts and desired body motions in the order they are iterated.
+  // The latter determines which cost and constraint terms correspond to each
+  // contact and body motion.
+  std::string key = std::to_string(num_vd) + "," + std::to_string(num_torque) +
+                    "," + std::to_string(HasFloatingBase(robot)) + "," +
+                    std::to_string(num_dof_motion_as_cost) +
+                    std::to_string(num_dof_motion_as_eq) +
+                    std::to_string(num_cen_mom_dot_as_cost) +
+                    std::to_string(num_cen_mom_dot_as_eq) + ";";
+  for (const auto& contact_pair : all_contacts) {
+    const ContactInformation& contact = contact_pair.second;
+    key += contact_pair.first + "," +
+           std::to_string(contact.num_contact_points()) + "," +
+           std::to_string(contact.num_basis()) + "," +
+           std::to_string(contact.acceleration_constraint_type() ==
+                          ConstraintType::Soft) + ";";
+  }
+  for (const auto& pair : all_body_motions) {
+    const DesiredBodyMotion& body_motion = pair.second;
+    key += pair.first + "," +
+           std::to_string(!body_motion.GetConstraintTypeIndices(
+               ConstraintType::Soft).empty()) +
+           std::to_string(!body_motion.GetConstraintTypeIndices(
+               ConstraintType::Hard).empty()) + ";";
+  }
+
+  // Structure of the QP remains the same, no need to switch workspaces.
+  if (ws_ != nullptr && key == ws_key_) {
     return;
   }
 
@@ -173,12 +204,6 @@ void QpInverseDynamics::ResizeQP(const RigidBodyTree<double>& robot,
   num_contact_as_cost_ = num_contact_as_cost;
   num_contact_as_eq_ = num_contact_as_eq;
 
-  // The order of insertion is important, the rest of the program assumes this
-  // layout.
-  prog_.reset(new solvers::MathematicalProgram());
-  vd_ = prog_->NewContinuousVariables(num_vd_, "vd");
-  basis_ = prog_->NewContinuousVariables(num_basis_, "basis");
-
   if (HasFloatingBase(robot)) {
     num_dynamics_equations_ = 6;
     has_floating_base_ = true;
@@ -196,6 +221,35 @@ void QpInverseDynamics::ResizeQP(const RigidBodyTree<double>& robot,
   dynamics_linear_.resize(num_dynamics_equations_, num_variable_);
   tmp_vd_vec_.resize(num_vd_);
   tmp_vd_mat_.resize(num_vd_, num_vd_);
+  basis_reg_mat_ = MatrixX<double>::Identity(num_basis_, num_basis_);
+  basis_reg_vec_ = VectorX<double>::Zero(num_basis_);
+  body_Jdv_.resize(all_body_motions.size());
+  body_J_.resize(all_body_motions.size());
+
+  // Reuse a previously built workspace if possible. Otherwise, build a new one
+  // and, unless caching workspaces, release the old one.
+  auto it = workspaces_.find(key);
+  if (it == workspaces_.end()) {
+    if (!cache_workspaces_) workspaces_.clear();
+    it = workspaces_.emplace(key, MakeWorkspace(input)).first;
+  }
+  ws_ = it->second.get();
+  ws_key_ = key;
+}
+
+std::unique_ptr<QpInverseDynamics::QpWorkspace>
+QpInverseDynamics::MakeWorkspace(const QpInput& input) const {
+  const std::unordered_map<std::string, ContactInformation>& all_contacts =
+      input.contact_information();
+  const std::unordered_map<std::string, DesiredBodyMotion>& all_body_motions =
+      input.desired_body_motions();
+  auto ws = std::make_unique<QpWorkspace>();
+
+  // The order of insertion is important, the rest of the program assumes this
+  // layout.
+  ws->prog = std::make_unique<solvers::MathematicalProgram>();
+  ws->vd = ws->prog->NewContinuousVariables(num_vd_, "vd");
+  ws->basis = ws->prog->NewContinuousVariables(num_basis_, "basis");
 
   // Allocate equality constraints.
   // Note that unless explicitly documented, all the matrices and vectors for
@@ -204,40 +258,46 @@ void QpInverseDynamics::ResizeQP(const RigidBodyTree<double>& robot,
 
   // Dynamics
   if (num_dynamics_equations_ > 0) {
-    eq_dynamics_ =
-        prog_
+    ws->eq_dynamics =
+        ws->prog
             ->AddLinearEqualityConstraint(
                 MatrixX<double>::Zero(num_dynamics_equations_, num_variable_),
-                VectorX<double>::Zero(num_dynamics_equations_), {vd_, basis_})
+                VectorX<double>::Zero(num_dynamics_equations_),
+                {ws->vd, ws->basis})
             .evaluator()
             .get();
 
-    eq_dynamics_->set_description("dynamics eq");
+    ws->eq_dynamics->set_description("dynamics eq");
   } else {
-    eq_dynamics_ = nullptr;
+    ws->eq_dynamics = nullptr;
   }
 
   // Contact constraints, 3 rows per contact point
-  eq_contacts_.resize(num_contact_as_eq_);
-  cost_contacts_.resize(num_contact_as_cost_);
+  ws->eq_contacts.resize(num_contact_as_eq_);
+  ws->cost_contacts.resize(num_contact_as_cost_);
   int cost_ctr = 0, eq_ctr = 0;
   for (const auto& contact_pair : all_contacts) {
     const ContactInformation& contact = contact_pair.second;
     if (contact.acceleration_constraint_type() == ConstraintType::Soft) {
-      cost_contacts_[cost_ctr++] =
-          prog_->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, vd_)
+      ws->cost_contacts[cost_ctr] =
+          ws->prog->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
               .evaluator()
               .get();
+      ws->cost_contacts[cost_ctr++]->set_description(contact.body_name() +
+                                                     " contact cost");
     } else {
       // Either hard or soft because contact constraint can't be skipped.
-      eq_contacts_[eq_ctr++] =
-          prog_
+      ws->eq_contacts[eq_ctr] =
+          ws->prog
               ->AddLinearEqualityConstraint(
                   MatrixX<double>::Zero(3 * contact.num_contact_points(),
                                         num_vd_),
-                  VectorX<double>::Zero(3 * contact.num_contact_points()), vd_)
+                  VectorX<double>::Zero(3 * contact.num_contact_points()),
+                  ws->vd)
               .evaluator()
               .get();
+      ws->eq_contacts[eq_ctr++]->set_description(contact.body_name() +
+                                                 " contact eq");
     }
   }
 
@@ -245,107 +305,118 @@ void QpInverseDynamics::ResizeQP(const RigidBodyTree<double>& robot,
   // Contact force scalar (Beta), which is constant and does not depend on the
   // robot configuration.
   if (num_basis_) {
-    ineq_contact_wrench_ =
-        prog_
+    ws->ineq_contact_wrench =
+        ws->prog
             ->AddLinearConstraint(
                 MatrixX<double>::Identity(num_basis_, num_basis_),
                 VectorX<double>::Zero(num_basis_),
                 VectorX<double>::Constant(num_basis_,
                                           kUpperBoundForContactBasis),
-                basis_)
+                ws->basis)
             .evaluator()
             .get();
-    ineq_contact_wrench_->set_description("contact force basis ineq");
+    ws->ineq_contact_wrench->set_description("contact force basis ineq");
   } else {
-    ineq_contact_wrench_ = nullptr;
+    ws->ineq_contact_wrench = nullptr;
   }
   // Torque limit
   if (num_torque_) {
-    ineq_torque_limit_ =
-        prog_
+    ws->ineq_torque_limit =
+        ws->prog
             ->AddLinearConstraint(
                 MatrixX<double>::Zero(num_torque_, num_variable_),
                 VectorX<double>::Zero(num_torque_),
-                VectorX<double>::Zero(num_torque_), {vd_, basis_})
+                VectorX<double>::Zero(num_torque_), {ws->vd, ws->basis})
             .evaluator()
             .get();
-    ineq_torque_limit_->set_description("torque limit ineq");
+    ws->ineq_torque_limit->set_description("torque limit ineq");
   } else {
-    ineq_torque_limit_ = nullptr;
+    ws->ineq_torque_limit = nullptr;
   }
 
   // Set up cost / eq constraints for centroidal momentum change.
   if (num_cen_mom_dot_as_cost_) {
-    cost_cen_mom_dot_ = prog_->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, vd_)
-                            .evaluator()
-                            .get();
-    cost_cen_mom_dot_->set_description("centroidal momentum change cost");
+    ws->cost_cen_mom_dot =
+        ws->prog->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
+            .evaluator()
+            .get();
+    ws->cost_cen_mom_dot->set_description("centroidal momentum change cost");
   } else {
-    cost_cen_mom_dot_ = nullptr;
+    ws->cost_cen_mom_dot = nullptr;
   }
   if (num_cen_mom_dot_as_eq_) {
     // Dimension doesn't matter for equality constraints,
     // will be reset when updating the constraint.
-    eq_cen_mom_dot_ =
-        prog_->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, vd_)
+    ws->eq_cen_mom_dot =
+        ws->prog
+            ->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
             .evaluator()
             .get();
-    eq_cen_mom_dot_->set_description("centroidal momentum change eq");
+    ws->eq_cen_mom_dot->set_description("centroidal momentum change eq");
   } else {
-    eq_cen_mom_dot_ = nullptr;
+    ws->eq_cen_mom_dot = nullptr;
   }
 
   // Set up cost / eq constraints for body motion.
-  body_Jdv_.resize(all_body_motions.size());
-  body_J_.resize(all_body_motions.size());
-  cost_body_motion_.resize(num_body_motion_as_cost_);
-  eq_body_motion_.resize(num_body_motion_as_eq_);
-  for (int i = 0; i < num_body_motion_as_cost_; ++i) {
-    cost_body_motion_[i] =
-        prog_->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, vd_)
-            .evaluator()
-            .get();
-  }
-  for (int i = 0; i < num_body_motion_as_eq_; ++i) {
-    // Dimension doesn't matter for equality constraints,
-    // will be reset when updating the constraint.
-    eq_body_motion_[i] =
-        prog_->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, vd_)
-            .evaluator()
-            .get();
+  ws->cost_body_motion.resize(num_body_motion_as_cost_);
+  ws->eq_body_motion.resize(num_body_motion_as_eq_);
+  cost_ctr = eq_ctr = 0;
+  for (const auto& pair : all_body_motions) {
+    const DesiredBodyMotion& body_motion = pair.second;
+    if (!body_motion.GetConstraintTypeIndices(ConstraintType::Soft).empty()) {
+      ws->cost_body_motion[cost_ctr] =
+          ws->prog->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
+              .evaluator()
+              .get();
+      ws->cost_body_motion[cost_ctr++]->set_description(
+          body_motion.body_name() + " cost");
+    }
+    if (!body_motion.GetConstraintTypeIndices(ConstraintType::Hard).empty()) {
+      // Dimension doesn't matter for equality constraints,
+      // will be reset when updating the constraint.
+      ws->eq_body_motion[eq_ctr] =
+          ws->prog
+              ->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
+              .evaluator()
+              .get();
+      ws->eq_body_motion[eq_ctr++]->set_description(body_motion.body_name() +
+                                                    " eq");
+    }
   }
 
   // Set up cost / eq constraints for dof motion.
   if (num_dof_motion_as_cost_ > 0) {
-    cost_dof_motion_ = prog_->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, vd_)
-                           .evaluator()
-                           .get();
-    cost_dof_motion_->set_description("vd cost");
+    ws->cost_dof_motion =
+        ws->prog->AddQuadraticCost(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
+            .evaluator()
+            .get();
+    ws->cost_dof_motion->set_description("vd cost");
   } else {
-    cost_dof_motion_ = nullptr;
+    ws->cost_dof_motion = nullptr;
   }
   if (num_dof_motion_as_eq_ > 0) {
     // Dimension doesn't matter for equality constraints,
     // will be reset when updating the constraint.
-    eq_dof_motion_ =
-        prog_->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, vd_)
+    ws->eq_dof_motion =
+        ws->prog
+            ->AddLinearEqualityConstraint(tmp_vd_mat_, tmp_vd_vec_, ws->vd)
             .evaluator()
             .get();
-    eq_dof_motion_->set_description("vd eq");
+    ws->eq_dof_motion->set_description("vd eq");
   } else {
-    eq_dof_motion_ = nullptr;
+    ws->eq_dof_motion = nullptr;
   }
 
   // Regularize basis.
-  cost_basis_reg_ =
-      prog_
+  ws->cost_basis_reg =
+      ws->prog
           ->AddQuadraticCost(MatrixX<double>::Identity(num_basis_, num_basis_),
-                             VectorX<double>::Zero(num_basis_), basis_)
+                             VectorX<double>::Zero(num_basis_), ws->basis)
           .evaluator()
           .get();
-  cost_basis_reg_->set_description("basis reg cost");
-  basis_reg_mat_ = MatrixX<double>::Identity(num_basis_, num_basis_);
-  basis_reg_vec_ = VectorX<double>::Zero(num_basis_);
+  ws->cost_basis_reg->set_description("basis reg cost");
+
+  return ws;
 }
 
 int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
@@ -435,12 +506,12 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
   // tau = M_l * vd + h_l - (J^T * basis)_l * Beta
   // tau = torque_linear_ * X + torque_constant_
   for (int i = 0; i < num_vd_; ++i) {
-    torque_linear_.block(0, prog_->FindDecisionVariableIndex(vd_(i)),
+    torque_linear_.block(0, ws_->prog->FindDecisionVariableIndex(ws_->vd(i)),
                          num_torque_, 1) =
         rs.get_M().bottomRows(num_torque_).col(i);
   }
   for (int i = 0; i < num_basis_; ++i) {
-    torque_linear_.block(0, prog_->FindDecisionVariableIndex(basis_(i)),
+    torque_linear_.block(0, ws_->prog->FindDecisionVariableIndex(ws_->basis(i)),
                          num_torque_, 1) = -JB_.bottomRows(num_torque_).col(i);
   }
   torque_constant_ = rs.get_bias_term().tail(num_torque_);
@@ -448,19 +519,21 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
   ////////////////////////////////////////////////////////////////////
   // Equality constraints:
   // Equations of motion part, 6 rows
-  if (eq_dynamics_) {
+  if (ws_->eq_dynamics) {
     for (int i = 0; i < num_vd_; ++i) {
-      dynamics_linear_.block(0, prog_->FindDecisionVariableIndex(vd_(i)),
-                             num_dynamics_equations_, 1) =
+      dynamics_linear_.block(
+          0, ws_->prog->FindDecisionVariableIndex(ws_->vd(i)),
+          num_dynamics_equations_, 1) =
           rs.get_M().block(0, i, num_dynamics_equations_, 1);
     }
     for (int i = 0; i < num_basis_; ++i) {
-      dynamics_linear_.block(0, prog_->FindDecisionVariableIndex(basis_(i)),
-                             num_dynamics_equations_, 1) =
+      dynamics_linear_.block(
+          0, ws_->prog->FindDecisionVariableIndex(ws_->basis(i)),
+          num_dynamics_equations_, 1) =
           -JB_.block(0, i, num_dynamics_equations_, 1);
     }
     dynamics_constant_ = -rs.get_bias_term().head(num_dynamics_equations_);
-    eq_dynamics_->UpdateCoefficients(dynamics_linear_, dynamics_constant_);
+    ws_->eq_dynamics->UpdateCoefficients(dynamics_linear_, dynamics_constant_);
   }
 
   // Contact constraints, 3 rows per contact point
@@ -471,7 +544,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
     int force_dim = 3 * contact.num_contact_points();
     // As cost
     if (contact.acceleration_constraint_type() == ConstraintType::Soft) {
-      cost_contacts_[cost_ctr]->UpdateCoefficients(
+      ws_->cost_contacts[cost_ctr]->UpdateCoefficients(
           contact.weight() *
               stacked_contact_jacobians_.block(rowIdx, 0, force_dim, num_vd_)
                   .transpose() *
@@ -483,16 +556,14 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
                                                               force_dim) +
                contact.Kd() *
                    stacked_contact_velocities_.segment(rowIdx, force_dim)));
-      cost_contacts_[cost_ctr++]->set_description(contact.body_name() +
-                                                  " contact cost");
+      cost_ctr++;
     } else {
-      eq_contacts_[eq_ctr]->UpdateCoefficients(
+      ws_->eq_contacts[eq_ctr]->UpdateCoefficients(
           stacked_contact_jacobians_.block(rowIdx, 0, force_dim, num_vd_),
           -(stacked_contact_jacobians_dot_times_v_.segment(rowIdx, force_dim) +
             contact.Kd() *
                 stacked_contact_velocities_.segment(rowIdx, force_dim)));
-      eq_contacts_[eq_ctr++]->set_description(contact.body_name() +
-                                              " contact eq");
+      eq_ctr++;
     }
     rowIdx += force_dim;
   }
@@ -519,7 +590,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
     inequality_lower_bound_[i] += robot.actuators[i].effort_limit_min_;
     inequality_upper_bound_[i] += robot.actuators[i].effort_limit_max_;
   }
-  ineq_torque_limit_->UpdateCoefficients(
+  ws_->ineq_torque_limit->UpdateCoefficients(
       inequality_linear_, inequality_lower_bound_, inequality_upper_bound_);
 
   ////////////////////////////////////////////////////////////////////
@@ -539,20 +610,17 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
       input.desired_centroidal_momentum_dot().values();
   AddAsCosts(rs.get_centroidal_momentum_matrix(), linear_term,
              input.desired_centroidal_momentum_dot().weights(), row_idx_as_cost,
-             cost_cen_mom_dot_);
+             ws_->cost_cen_mom_dot);
   AddAsConstraints(rs.get_centroidal_momentum_matrix(), -linear_term,
-                   row_idx_as_eq, eq_cen_mom_dot_);
+                   row_idx_as_eq, ws_->eq_cen_mom_dot);
 
   // Body motion
   int body_ctr = 0;
   cost_ctr = eq_ctr = 0;
   for (const auto& pair : input.desired_body_motions()) {
     const DesiredBodyMotion& body_motion_d = pair.second;
-    body_J_[body_ctr] = robot.CalcBodySpatialVelocityJacobianInWorldFrame(
-        cache, body_motion_d.body());
-    body_Jdv_[body_ctr] =
-        robot.CalcBodySpatialVelocityJacobianDotTimesVInWorldFrame(
-            cache, body_motion_d.body());
+    body_J_[body_ctr] = rs.get_body_J(body_motion_d.body());
+    body_Jdv_[body_ctr] = rs.get_body_Jdot_times_v(body_motion_d.body());
     linear_term = body_Jdv_[body_ctr] - body_motion_d.values();
 
     // Find the rows that correspond to cost and equality constraints.
@@ -562,24 +630,20 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
         body_motion_d.GetConstraintTypeIndices(ConstraintType::Hard);
     if (!row_idx_as_cost.empty()) {
       AddAsCosts(body_J_[body_ctr], linear_term, body_motion_d.weights(),
-                 row_idx_as_cost, cost_body_motion_[cost_ctr]);
-      cost_body_motion_[cost_ctr]->set_description(body_motion_d.body_name() +
-                                                   " cost");
+                 row_idx_as_cost, ws_->cost_body_motion[cost_ctr]);
       cost_ctr++;
     }
     if (!row_idx_as_eq.empty()) {
       AddAsConstraints(body_J_[body_ctr], -linear_term, row_idx_as_eq,
-                       eq_body_motion_[eq_ctr]);
-      eq_body_motion_[eq_ctr]->set_description(body_motion_d.body_name() +
-                                               " eq");
+                       ws_->eq_body_motion[eq_ctr]);
       eq_ctr++;
     }
     body_ctr++;
   }
   DRAKE_ASSERT(body_ctr ==
                static_cast<int>(input.desired_body_motions().size()));
-  DRAKE_ASSERT(cost_ctr == static_cast<int>(cost_body_motion_.size()));
-  DRAKE_ASSERT(eq_ctr == static_cast<int>(eq_body_motion_.size()));
+  DRAKE_ASSERT(cost_ctr == static_cast<int>(ws_->cost_body_motion.size()));
+  DRAKE_ASSERT(eq_ctr == static_cast<int>(ws_->eq_body_motion.size()));
 
   // Joint motion
   row_idx_as_cost = input.desired_dof_motions().GetConstraintTypeIndices(
@@ -595,7 +659,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
       tmp_vd_vec_[row_ctr] = input.desired_dof_motions().value(d);
       row_ctr++;
     }
-    eq_dof_motion_->UpdateCoefficients(tmp_vd_mat_.topRows(row_ctr),
+    ws_->eq_dof_motion->UpdateCoefficients(tmp_vd_mat_.topRows(row_ctr),
                                        tmp_vd_vec_.head(row_ctr));
   }
   // Procecss cost terms.
@@ -608,27 +672,37 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
       tmp_vd_mat_(d, d) = weight;
       tmp_vd_vec_[d] = -weight * input.desired_dof_motions().value(d);
     }
-    cost_dof_motion_->UpdateCoefficients(tmp_vd_mat_, tmp_vd_vec_);
+    ws_->cost_dof_motion->UpdateCoefficients(tmp_vd_mat_, tmp_vd_vec_);
   }
 
   // Regularize basis to zero.
-  cost_basis_reg_->UpdateCoefficients(input.w_basis_reg() * basis_reg_mat_,
-                                      basis_reg_vec_);
+  ws_->cost_basis_reg->UpdateCoefficients(
+      input.w_basis_reg() * basis_reg_mat_, basis_reg_vec_);
+
+  ////////////////////////////////////////////////////////////////////
+  // Warm start from the last solution of this workspace, or from the
+  // accelerations of the previous tick if the workspace is new.
+  if (ws_->last_solution.size() == num_variable_) {
+    ws_->prog->SetInitialGuessForAllVariables(ws_->last_solution);
+  } else if (solution_.size() >= num_vd_) {
+    ws_->prog->SetInitialGuess(ws_->vd, solution_.head(num_vd_));
+  }
 
   ////////////////////////////////////////////////////////////////////
   // Call solver.
-  solvers::SolutionResult result = solver_.Solve(*(prog_.get()));
+  solvers::SolutionResult result = solver_.Solve(*(ws_->prog.get()));
   if (result != solvers::SolutionResult::kSolutionFound) {
     drake::log()->warn("Solution not found.");
     return -1;
   }
-  solution_ = prog_->GetSolution(prog_->decision_variables());
+  solution_ = ws_->prog->GetSolution(ws_->prog->decision_variables());
+  ws_->last_solution = solution_;
 
   ////////////////////////////////////////////////////////////////////
   // Examples of inspecting each cost / eq, ineq term
-  auto costs = prog_->quadratic_costs();
-  auto eqs = prog_->linear_equality_constraints();
-  auto ineqs = prog_->linear_constraints();
+  auto costs = ws_->prog->quadratic_costs();
+  auto eqs = ws_->prog->linear_equality_constraints();
+  auto ineqs = ws_->prog->linear_constraints();
 
   output->mutable_costs().resize(costs.size());
   int ctr = 0;
@@ -637,7 +711,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
   // TODO(hongkai.dai): Solve() function in GurobiSolver or MosekSolver
   // should return the cost directly.
   for (auto& cost_b : costs) {
-    tmp_vec = prog_->EvalBindingAtSolution(cost_b);
+    tmp_vec = ws_->prog->EvalBindingAtSolution(cost_b);
     output->mutable_cost(ctr).first = cost_b.evaluator()->get_description();
     output->mutable_cost(ctr).second = tmp_vec(0);
     ctr++;
@@ -645,13 +719,14 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
 
   for (auto& eq_b : eqs) {
     DRAKE_ASSERT(
-        (prog_->EvalBindingAtSolution(eq_b) - eq_b.evaluator()->lower_bound())
+        (ws_->prog->EvalBindingAtSolution(eq_b) -
+         eq_b.evaluator()->lower_bound())
             .isZero(1e-6));
   }
 
   for (auto& ineq_b : ineqs) {
     solvers::LinearConstraint* ineq = ineq_b.evaluator().get();
-    tmp_vec = prog_->EvalBindingAtSolution(ineq_b);
+    tmp_vec = ws_->prog->EvalBindingAtSolution(ineq_b);
     for (int i = 0; i < tmp_vec.size(); ++i) {
       DRAKE_ASSERT(tmp_vec[i] >= ineq->lower_bound()[i] - 1e-6 &&
                    tmp_vec[i] <= ineq->upper_bound()[i] + 1e-6);
@@ -663,7 +738,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
   // Compute resulting contact wrenches.
   int basis_index = 0;
   int point_force_index = 0;
-  const auto& basis_value = prog_->GetSolution(basis_);
+  const auto& basis_value = ws_->prog->GetSolution(ws_->basis);
   point_forces_ = basis_to_force_matrix_ * basis_value;
 
   // Remove old contacts that are not in input anymore.
@@ -679,7 +754,7 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
     output->mutable_resolved_contacts().erase(old_contact);
   }
 
-  const auto& vd_value = prog_->GetSolution(vd_);
+  const auto& vd_value = ws_->prog->GetSolution(ws_->vd);
   for (const auto& contact_pair : input.contact_information()) {
     const ContactInformation& contact = contact_pair.second;
     if (output->mutable_resolved_contacts().find(contact.body_name()) ==
@@ -721,13 +796,9 @@ int QpInverseDynamics::Control(const RobotKinematicState<double>& rs,
     }
 
     // Compute acceleration for contact body.
-    Matrix6X<double> J_body = robot.CalcBodySpatialVelocityJacobianInWorldFrame(
-        cache, resolved_contact.body());
-    Vector6<double> Jdv_body =
-        robot.CalcBodySpatialVelocityJacobianDotTimesVInWorldFrame(
-            cache, resolved_contact.body());
-
-    resolved_contact.mutable_body_acceleration() = J_body * vd_value + Jdv_body;
+    resolved_contact.mutable_body_acceleration() =
+        rs.get_body_J(resolved_contact.body()) * vd_value +
+        rs.get_body_Jdot_times_v(resolved_contact.body());
   }
 
   // Set output accelerations.
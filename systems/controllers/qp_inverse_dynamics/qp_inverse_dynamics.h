@@ -40,9 +40,66 @@ class QpInverseDynamics {
   int Control(const RobotKinematicState<double>& robot_status,
               const QpInput& input, QpOutput* output);
 
+  /**
+   * Enables or disables the reusable-workspace mode. By default, the QP is
+   * rebuilt from scratch every time its structure changes, e.g. when making or
+   * breaking contacts. When this mode is enabled, the QP built for each
+   * structure (the set of contacts and the types of the constraints on the
+   * desired motions) seen so far is kept, and switching back to a previously
+   * seen structure only updates the coefficients of the existing costs and
+   * constraints. In either mode, each QP is warm-started from the solution
+   * of the previous call whenever possible.
+   * Disabling this mode releases all the cached workspaces but the current
+   * one.
+   */
+  void set_cache_workspaces(bool cache_workspaces);
+
+  /**
+   * Returns `true` if the reusable-workspace mode is enabled.
+   * @see set_cache_workspaces().
+   */
+  bool cache_workspaces() const { return cache_workspaces_; }
+
+  /**
+   * Returns the number of QP workspaces currently held. This is at most one
+   * when the reusable-workspace mode is disabled.
+   */
+  int num_workspaces() const { return static_cast<int>(workspaces_.size()); }
+
   static const double kUpperBoundForContactBasis;
 
  private:
+  // A MathematicalProgram with a fixed structure, together with pointers to
+  // its costs and constraints. Control() only updates the coefficients of
+  // these terms.
+  struct QpWorkspace {
+    std::unique_ptr<drake::solvers::MathematicalProgram> prog;
+    drake::solvers::VectorXDecisionVariable basis;
+    drake::solvers::VectorXDecisionVariable vd;
+
+    // pointers to different cost / constraint terms inside prog
+    drake::solvers::LinearEqualityConstraint* eq_dynamics{nullptr};
+    // TODO(siyuan.feng): Switch to cost for contact_constraints
+    std::vector<drake::solvers::LinearEqualityConstraint*> eq_contacts;
+    std::vector<drake::solvers::LinearEqualityConstraint*> eq_body_motion;
+    drake::solvers::LinearEqualityConstraint* eq_dof_motion{nullptr};
+    drake::solvers::LinearEqualityConstraint* eq_cen_mom_dot{nullptr};
+
+    drake::solvers::LinearConstraint* ineq_contact_wrench{nullptr};
+    drake::solvers::LinearConstraint* ineq_torque_limit{nullptr};
+
+    std::vector<drake::solvers::QuadraticCost*> cost_contacts;
+    drake::solvers::QuadraticCost* cost_cen_mom_dot{nullptr};
+    std::vector<drake::solvers::QuadraticCost*> cost_body_motion;
+    drake::solvers::QuadraticCost* cost_dof_motion{nullptr};
+
+    drake::solvers::QuadraticCost* cost_basis_reg{nullptr};
+
+    // Solution from the last successful solve using this workspace, used to
+    // warm-start the next one. Empty if there is none.
+    VectorX<double> last_solution;
+  };
+
   // These are temporary matrices and vectors used by the controller.
   MatrixX<double> tmp_vd_mat_;
   VectorX<double> tmp_vd_vec_;
@@ -113,38 +170,26 @@ class QpInverseDynamics {
   int num_contact_as_cost_{0};
   int num_contact_as_eq_{0};
 
-  // prog_ is only allocated in ResizeQP, Control only updates the appropriate
-  // matrices / vectors.
-  std::unique_ptr<drake::solvers::MathematicalProgram> prog_;
+  // Workspaces are only allocated in ResizeQP, Control only updates the
+  // appropriate matrices / vectors in the current workspace ws_. Workspaces
+  // are keyed by a description of the QP structure, see ResizeQP().
+  std::unordered_map<std::string, std::unique_ptr<QpWorkspace>> workspaces_;
+  QpWorkspace* ws_{nullptr};
+  std::string ws_key_;
+  bool cache_workspaces_{false};
   drake::solvers::GurobiSolver solver_;
-  drake::solvers::VectorXDecisionVariable basis_;
-  drake::solvers::VectorXDecisionVariable vd_;
-
-  // pointers to different cost / constraint terms inside prog_
-  drake::solvers::LinearEqualityConstraint* eq_dynamics_{nullptr};
-  // TODO(siyuan.feng): Switch to cost for contact_constraints
-  std::vector<drake::solvers::LinearEqualityConstraint*> eq_contacts_;
-  std::vector<drake::solvers::LinearEqualityConstraint*> eq_body_motion_;
-  drake::solvers::LinearEqualityConstraint* eq_dof_motion_{nullptr};
-  drake::solvers::LinearEqualityConstraint* eq_cen_mom_dot_{nullptr};
-
-  drake::solvers::LinearConstraint* ineq_contact_wrench_{nullptr};
-  drake::solvers::LinearConstraint* ineq_torque_limit_{nullptr};
-
-  std::vector<drake::solvers::QuadraticCost*> cost_contacts_;
-  drake::solvers::QuadraticCost* cost_cen_mom_dot_{nullptr};
-  std::vector<drake::solvers::QuadraticCost*> cost_body_motion_;
-  drake::solvers::QuadraticCost* cost_dof_motion_{nullptr};
-
-  drake::solvers::QuadraticCost* cost_basis_reg_{nullptr};
-
-  // Resize the QP. This resizes the temporary matrices. It also reinitializes
-  // prog_ to the correct size, so that Control only updates the
-  // matrices and vectors in prog_ instead of making a new one on every call.
-  // Size change typically happens when contact state changes (making / breaking
-  // contacts).
+
+  // Resize the QP. This resizes the temporary matrices. It also selects the
+  // workspace with the correct structure, building a new one if needed, so
+  // that Control only updates the matrices and vectors in its program instead
+  // of making a new one on every call.
+  // Structure change typically happens when contact state changes (making /
+  // breaking contacts).
   void ResizeQP(const RigidBodyTree<double>& robot, const QpInput& input);
 
+  // Builds a new workspace for the current QP dimensions.
+  std::unique_ptr<QpWorkspace> MakeWorkspace(const QpInput& input) const;
+
   template <typename DerivedA, typename DerivedB>
   void AddAsConstraints(const Eigen::MatrixBase<DerivedA>& A,
                         const Eigen::MatrixBase<DerivedB>& b,
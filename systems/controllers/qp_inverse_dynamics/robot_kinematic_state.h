@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/rigid_body_tree.h"
@@ -16,6 +18,14 @@ namespace qp_inverse_dynamics {
  * the inertia matrix, etc. This class serves mainly as a explicit cache to
  * avoid repeated computation. This class can be replaced when System's cache
  * is ready.
+ *
+ * Besides the quantities that are computed in UpdateKinematics(), the pose,
+ * spatial velocity, Jacobian and Jacobian dot times v of individual bodies
+ * are computed on first use, and reused until the next UpdateKinematics().
+ * This lets the plan evaluator and the inverse dynamics controller share
+ * them, while only the ones that are actually needed are computed. Since the
+ * getters for these fill in a cache, a const instance must not be used from
+ * several threads at the same time.
  */
 template <typename T>
 class RobotKinematicState {
@@ -75,6 +85,8 @@ class RobotKinematicState {
     centroidal_momentum_matrix_dot_times_v_ =
         robot_->centroidalMomentumMatrixDotTimesV(cache_);
     centroidal_momentum_ = centroidal_momentum_matrix_ * v;
+
+    body_kinematics_.assign(robot_->get_num_bodies(), BodyKinematics());
   }
 
   T get_time() const { return time_; }
@@ -98,12 +110,88 @@ class RobotKinematicState {
     return centroidal_momentum_matrix_dot_times_v_;
   }
 
+  /**
+   * Returns the pose of @p body in the world frame.
+   */
+  const Isometry3<T>& get_body_pose(const RigidBody<T>& body) const {
+    BodyKinematics& kinematics = get_body_kinematics(body);
+    if (!kinematics.has_pose) {
+      kinematics.pose = robot_->CalcBodyPoseInWorldFrame(cache_, body);
+      kinematics.has_pose = true;
+    }
+    return kinematics.pose;
+  }
+
+  /**
+   * Returns the spatial velocity of @p body in the world frame, expressed in
+   * the world frame.
+   */
+  const Vector6<T>& get_body_velocity(const RigidBody<T>& body) const {
+    BodyKinematics& kinematics = get_body_kinematics(body);
+    if (!kinematics.has_velocity) {
+      kinematics.velocity =
+          robot_->CalcBodySpatialVelocityInWorldFrame(cache_, body);
+      kinematics.has_velocity = true;
+    }
+    return kinematics.velocity;
+  }
+
+  /**
+   * Returns the Jacobian that maps the generalized velocities to the spatial
+   * velocity returned by get_body_velocity().
+   */
+  const Matrix6X<T>& get_body_J(const RigidBody<T>& body) const {
+    BodyKinematics& kinematics = get_body_kinematics(body);
+    if (!kinematics.has_J) {
+      kinematics.J =
+          robot_->CalcBodySpatialVelocityJacobianInWorldFrame(cache_, body);
+      kinematics.has_J = true;
+    }
+    return kinematics.J;
+  }
+
+  /**
+   * Returns the time derivative of get_body_J() times the generalized
+   * velocities.
+   */
+  const Vector6<T>& get_body_Jdot_times_v(const RigidBody<T>& body) const {
+    BodyKinematics& kinematics = get_body_kinematics(body);
+    if (!kinematics.has_Jdot_times_v) {
+      kinematics.Jdot_times_v =
+          robot_->CalcBodySpatialVelocityJacobianDotTimesVInWorldFrame(cache_,
+                                                                       body);
+      kinematics.has_Jdot_times_v = true;
+    }
+    return kinematics.Jdot_times_v;
+  }
+
  protected:
   virtual RobotKinematicState<T>* DoClone() const {
     return new RobotKinematicState<T>(*this);
   }
 
  private:
+  // Lazily computed kinematics of one body, see get_body_pose() etc.
+  struct BodyKinematics {
+    bool has_pose{false};
+    bool has_velocity{false};
+    bool has_J{false};
+    bool has_Jdot_times_v{false};
+    Isometry3<T> pose;
+    Vector6<T> velocity;
+    Matrix6X<T> J;
+    Vector6<T> Jdot_times_v;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  };
+
+  BodyKinematics& get_body_kinematics(const RigidBody<T>& body) const {
+    DRAKE_DEMAND(body.get_body_index() >= 0 &&
+                 body.get_body_index() <
+                     static_cast<int>(body_kinematics_.size()));
+    return body_kinematics_[body.get_body_index()];
+  }
+
   const RigidBodyTree<T>* robot_;
   KinematicsCache<T> cache_;
 
@@ -125,6 +213,10 @@ class RobotKinematicState {
   // [angular; linear] = centroidal_momentum_matrix_ * v
   Matrix6X<T> centroidal_momentum_matrix_;
   Vector6<T> centroidal_momentum_matrix_dot_times_v_;
+
+  // Indexed by body index. Cleared by UpdateKinematics().
+  mutable std::vector<BodyKinematics, Eigen::aligned_allocator<BodyKinematics>>
+      body_kinematics_;
 };
 
 }  // namespace qp_inverse_dynamics
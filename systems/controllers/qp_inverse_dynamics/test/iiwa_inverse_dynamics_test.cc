@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
@@ -86,6 +88,75 @@ GTEST_TEST(testQPInverseDynamicsController, testForIiwa) {
                                      1e-9, drake::MatrixCompareType::absolute));
 }
 
+// Alternates between two QPs with different structures, with the
+// reusable-workspace mode on and off, and verifies both modes produce the
+// same results and hold the expected number of workspaces.
+GTEST_TEST(testQPInverseDynamicsController, testWorkspaceCacheForIiwa) {
+  std::string urdf = FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/urdf/"
+      "iiwa14_polytope_collision.urdf");
+  std::string alias_groups_config = FindResourceOrThrow(
+      "drake/systems/controllers/qp_inverse_dynamics/test/"
+      "iiwa.alias_groups");
+  std::string controller_config = FindResourceOrThrow(
+      "drake/systems/controllers/qp_inverse_dynamics/test/"
+      "iiwa.id_controller_config");
+
+  RigidBodyTree<double> robot;
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      urdf, multibody::joints::kFixed, &robot);
+
+  RigidBodyTreeAliasGroups<double> alias_groups(&robot);
+  alias_groups.LoadFromFile(alias_groups_config);
+
+  ParamSet paramset;
+  paramset.LoadFromFile(controller_config, alias_groups);
+
+  RobotKinematicState<double> robot_status(&robot);
+  VectorX<double> q = VectorX<double>::Zero(robot.get_num_positions());
+  VectorX<double> v = VectorX<double>::Zero(robot.get_num_velocities());
+  v[1] += 1;
+  robot_status.UpdateKinematics(0, q, v);
+
+  // Tracks the desired accelerations as costs in `soft_input`, and
+  // additionally constrains the first joint's acceleration in `hard_input`.
+  std::vector<std::string> contact_group_names = {};
+  std::vector<std::string> tracked_body_names = {};
+  QpInput soft_input = paramset.MakeQpInput(
+      contact_group_names, tracked_body_names, alias_groups);
+  soft_input.mutable_desired_dof_motions().mutable_values() =
+      VectorX<double>::LinSpaced(robot.get_num_velocities(), -1, 1);
+  QpInput hard_input = soft_input;
+  hard_input.mutable_desired_dof_motions().SetConstraintType(
+      {0}, ConstraintType::Hard);
+
+  QpInverseDynamics cached;
+  cached.set_cache_workspaces(true);
+  EXPECT_TRUE(cached.cache_workspaces());
+  QpInverseDynamics uncached;
+  EXPECT_FALSE(uncached.cache_workspaces());
+
+  QpOutput cached_output(GetDofNames(robot));
+  QpOutput uncached_output(GetDofNames(robot));
+  for (int i = 0; i < 4; ++i) {
+    const QpInput& input = (i % 2 == 0) ? soft_input : hard_input;
+    EXPECT_EQ(cached.Control(robot_status, input, &cached_output), 0);
+    EXPECT_EQ(uncached.Control(robot_status, input, &uncached_output), 0);
+    EXPECT_TRUE(drake::CompareMatrices(cached_output.vd(), uncached_output.vd(),
+                                       1e-9,
+                                       drake::MatrixCompareType::absolute));
+    EXPECT_TRUE(drake::CompareMatrices(
+        cached_output.dof_torques(), uncached_output.dof_torques(), 1e-9,
+        drake::MatrixCompareType::absolute));
+    EXPECT_EQ(cached.num_workspaces(), std::min(i + 1, 2));
+    EXPECT_EQ(uncached.num_workspaces(), 1);
+  }
+
+  // Disabling the mode only keeps the workspace in use.
+  cached.set_cache_workspaces(false);
+  EXPECT_EQ(cached.num_workspaces(), 1);
+}
+
 }  // namespace
 }  // namespace qp_inverse_dynamics
 }  // namespace controllers
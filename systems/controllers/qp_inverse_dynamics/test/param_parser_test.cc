@@ -391,6 +391,24 @@ TEST_F(ParamParserTests, MakeQpInputFromRigidBodyPtr) {
   EXPECT_EQ(qp_input, expected);
 }
 
+// Tests MakeQpInputFromGroupIndices.
+TEST_F(ParamParserTests, MakeQpInputFromGroupIndices) {
+  QpInput expected =
+      paramset_.MakeQpInput({"pelvis"},               /* contact groups */
+                            {"pelvis", "right_foot"}, /* tracked body groups */
+                            *rbt_alias_);
+
+  const int pelvis = rbt_alias_->get_body_group_index("pelvis");
+  const int r_foot = rbt_alias_->get_body_group_index("right_foot");
+  QpInput qp_input = paramset_.MakeQpInputFromGroupIndices(
+      {pelvis}, {pelvis, r_foot}, *rbt_alias_);
+
+  EXPECT_EQ(qp_input, expected);
+  EXPECT_THROW(paramset_.MakeQpInputFromGroupIndices(
+                   {rbt_alias_->num_body_groups()}, {}, *rbt_alias_),
+               std::out_of_range);
+}
+
 }  // namespace
 }  // namespace qp_inverse_dynamics
 }  // namespace controllers
@@ -0,0 +1,73 @@
+#include "drake/systems/controllers/qp_inverse_dynamics/robot_kinematic_state.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace qp_inverse_dynamics {
+namespace {
+
+// Checks that the per body kinematics of `robot_status` match the ones
+// computed directly from its KinematicsCache.
+void CheckBodyKinematics(const RobotKinematicState<double>& robot_status) {
+  const RigidBodyTree<double>& robot = robot_status.get_robot();
+  const KinematicsCache<double>& cache = robot_status.get_cache();
+  for (const auto& body : robot.get_bodies()) {
+    // Queries twice, to check both the computed and the cached values.
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          robot_status.get_body_pose(*body).matrix(),
+          robot.CalcBodyPoseInWorldFrame(cache, *body).matrix()));
+      EXPECT_TRUE(CompareMatrices(
+          robot_status.get_body_velocity(*body),
+          robot.CalcBodySpatialVelocityInWorldFrame(cache, *body)));
+      EXPECT_TRUE(CompareMatrices(
+          robot_status.get_body_J(*body),
+          robot.CalcBodySpatialVelocityJacobianInWorldFrame(cache, *body)));
+      EXPECT_TRUE(CompareMatrices(
+          robot_status.get_body_Jdot_times_v(*body),
+          robot.CalcBodySpatialVelocityJacobianDotTimesVInWorldFrame(cache,
+                                                                     *body)));
+    }
+  }
+}
+
+GTEST_TEST(RobotKinematicStateTest, BodyKinematics) {
+  RigidBodyTree<double> robot;
+  parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+      FindResourceOrThrow("drake/manipulation/models/iiwa_description/urdf/"
+                          "iiwa14_polytope_collision.urdf"),
+      multibody::joints::kQuaternion, &robot);
+
+  RobotKinematicState<double> robot_status(&robot);
+  CheckBodyKinematics(robot_status);
+
+  // The cached values are recomputed after each update.
+  VectorX<double> q = robot.getZeroConfiguration();
+  q.tail(7) = VectorX<double>::LinSpaced(7, -1, 1);
+  const VectorX<double> v =
+      VectorX<double>::LinSpaced(robot.get_num_velocities(), 2, -0.5);
+  robot_status.UpdateKinematics(0.1, q, v);
+  CheckBodyKinematics(robot_status);
+
+  // Clones get their own copy of the cached values.
+  std::unique_ptr<RobotKinematicState<double>> clone = robot_status.Clone();
+  robot_status.UpdateKinematics(0.2, robot.getZeroConfiguration(),
+                                VectorX<double>::Zero(v.size()));
+  CheckBodyKinematics(*clone);
+  CheckBodyKinematics(robot_status);
+}
+
+}  // namespace
+}  // namespace qp_inverse_dynamics
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
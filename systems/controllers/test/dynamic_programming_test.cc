@@ -201,6 +201,67 @@ GTEST_TEST(FittedValueIteration, DoubleIntegrator) {
   }
 }
 
+// The double integrator problem above, on a coarser mesh, gives the same
+// cost-to-go with several threads as with one.
+GTEST_TEST(FittedValueIteration, Threads) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  LinearSystem<double> sys(A, B, Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d::Zero());
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.EvalVectorInput(context, 0)->GetAtIndex(0);
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -2.; x <= 2.; x += .4) {
+    state_grid[0].insert(x);
+  }
+  for (double xdot = -3.; xdot <= 3.; xdot += .4) {
+    state_grid[1].insert(xdot);
+  }
+  math::BarycentricMesh<double>::MeshGrid input_grid(1);
+  for (double u = -4.; u <= 4.; u += 1.) {
+    input_grid[0].insert(u);
+  }
+  const double timestep = .05;
+
+  // The mesh does not contain the origin, so the costs are discounted in order
+  // for the cost-to-go to be finite.
+  DynamicProgrammingOptions options;
+  options.discount_factor = .95;
+
+  Simulator<double> simulator(sys);
+  std::unique_ptr<BarycentricMeshSystem<double>> policy;
+  Eigen::RowVectorXd J_expected;
+  std::tie(policy, J_expected) = FittedValueIteration(
+      &simulator, cost_function, state_grid, input_grid, timestep, options);
+
+  int num_simulators_made = 0;
+  options.num_threads = 3;
+  options.simulator_factory = [&num_simulators_made](
+      const System<double>& system, std::unique_ptr<Context<double>> context) {
+    ++num_simulators_made;
+    return std::make_unique<Simulator<double>>(system, std::move(context));
+  };
+  Simulator<double> unused_simulator(sys);
+  Eigen::RowVectorXd J;
+  std::tie(policy, J) = FittedValueIteration(
+      &unused_simulator, cost_function, state_grid, input_grid, timestep,
+      options);
+  EXPECT_EQ(num_simulators_made, 3);
+  EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-12));
+
+  // The default factory copies the settings of the given integrator.
+  options.simulator_factory = nullptr;
+  std::tie(policy, J) = FittedValueIteration(
+      &simulator, cost_function, state_grid, input_grid, timestep, options);
+  EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-12));
+}
+
 // Minimum-time problem for the single integrator (which has a trivial solution,
 // that can be achieved exactly on a mesh when timestep=1).
 // ẋ = u,  u ∈ {-1,0,1}.
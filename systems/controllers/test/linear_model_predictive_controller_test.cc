@@ -8,6 +8,7 @@
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -81,6 +82,54 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+// Over a short horizon, the control differs from the infinite-horizon one, and
+// matches the first input of the full QP over the horizon.
+GTEST_TEST(TestMpcShortHorizon, TestAgainstDirectTranscription) {
+  const double kTimeStep = 0.1;
+  const double kTimeHorizon = 0.4;
+
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, 0.1, 0, 1;
+  B << 0.005, 0.1;
+  const auto C = Eigen::Matrix<double, 2, 2>::Identity();
+  const auto D = Eigen::Matrix<double, 2, 1>::Zero();
+  Eigen::Matrix2d Q;
+  Q << 2, 0.5, 0.5, 1;
+  const Vector1d R = Vector1d::Constant(0.1);
+
+  // Regulate about a nonzero equilibrium state.
+  const Eigen::Vector2d x_ref(0.5, 0.);
+  const Eigen::Vector2d x0(1., -2.);
+
+  auto system = std::make_unique<LinearSystem<double>>(A, B, C, D, kTimeStep);
+  std::unique_ptr<Context<double>> system_context =
+      system->CreateDefaultContext();
+  system_context->FixInputPort(0, Vector1d::Zero());
+  system_context->get_mutable_discrete_state(0).SetFromVector(x_ref);
+
+  // The QP over the horizon, in the coordinates of the linearization.
+  trajectory_optimization::DirectTranscription prog(
+      system.get(), *system_context,
+      static_cast<int>(kTimeHorizon / kTimeStep + 0.5));
+  prog.AddRunningCost(prog.state().transpose() * Q * prog.state() +
+                      prog.input().transpose() * R * prog.input());
+  prog.AddLinearConstraint(prog.initial_state() == x0 - x_ref);
+  ASSERT_EQ(prog.Solve(), solvers::SolutionResult::kSolutionFound);
+  const Eigen::VectorXd expected = prog.GetInputSamples().col(0);
+
+  LinearModelPredictiveController<double> dut(
+      std::move(system), std::move(system_context), Q, R, kTimeStep,
+      kTimeHorizon);
+  auto context = dut.CreateDefaultContext();
+  context->FixInputPort(0, x0);
+  std::unique_ptr<SystemOutput<double>> output = dut.AllocateOutput(*context);
+  dut.CalcOutput(*context, output.get());
+
+  EXPECT_TRUE(CompareMatrices(expected, output->get_vector_data(0)->get_value(),
+                              1e-8));
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
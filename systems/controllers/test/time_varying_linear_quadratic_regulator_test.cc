@@ -0,0 +1,112 @@
+#include "drake/systems/controllers/time_varying_linear_quadratic_regulator.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/controllers/linear_quadratic_regulator.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+using trajectories::PiecewisePolynomial;
+
+// Returns a trajectory that holds `value` over [0, duration], in `num_segments`
+// segments.
+PiecewisePolynomial<double> MakeConstant(const Eigen::MatrixXd& value,
+                                         double duration, int num_segments) {
+  std::vector<double> breaks;
+  std::vector<Eigen::MatrixXd> knots;
+  for (int i = 0; i <= num_segments; ++i) {
+    breaks.push_back(duration * i / num_segments);
+    knots.push_back(value);
+  }
+  return PiecewisePolynomial<double>::FirstOrderHold(breaks, knots);
+}
+
+class TimeVaryingLqrTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // A double integrator.
+    A_ << 0, 1, 0, 0;
+    B_ << 0, 1;
+    Q_ << 1, 0, 0, 1;
+    R_ << 1;
+  }
+
+  Eigen::Matrix2d A_;
+  Eigen::Vector2d B_;
+  Eigen::Matrix2d Q_;
+  Eigen::Matrix<double, 1, 1> R_;
+};
+
+// Over a long horizon, the solution for a time-invariant system far from the
+// final time approaches the infinite-horizon LQR.
+TEST_F(TimeVaryingLqrTest, ConvergesToInfiniteHorizon) {
+  const double kDuration = 20.0;
+  const LinearQuadraticRegulatorResult lqr =
+      LinearQuadraticRegulator(A_, B_, Q_, R_);
+
+  TimeVaryingLinearQuadraticRegulatorOptions options;
+  options.integration_accuracy = 1e-8;
+  const TimeVaryingLinearQuadraticRegulatorResult result =
+      TimeVaryingLinearQuadraticRegulator(MakeConstant(A_, kDuration, 10),
+                                          MakeConstant(B_, kDuration, 10), Q_,
+                                          R_, options);
+  EXPECT_TRUE(CompareMatrices(result.S.value(0.0), lqr.S, 1e-4));
+  EXPECT_TRUE(CompareMatrices(result.K.value(0.0), lqr.K, 1e-4));
+  // With the default options, S(tf) = Qf = 0.
+  EXPECT_TRUE(CompareMatrices(result.S.value(kDuration),
+                              Eigen::Matrix2d::Zero(), 1e-12));
+
+  // If the final cost is the infinite-horizon cost-to-go, S stays there.
+  options.Qf = lqr.S;
+  const TimeVaryingLinearQuadraticRegulatorResult stationary =
+      TimeVaryingLinearQuadraticRegulator(MakeConstant(A_, kDuration, 10),
+                                          MakeConstant(B_, kDuration, 10), Q_,
+                                          R_, options);
+  for (double t : {0.0, 7.3, kDuration}) {
+    EXPECT_TRUE(CompareMatrices(stationary.S.value(t), lqr.S, 1e-6));
+  }
+}
+
+// Linearizing a linear system along a trajectory gives the same solution as
+// passing its matrices, on one or several threads.
+TEST_F(TimeVaryingLqrTest, LinearizesSystemAlongTrajectory) {
+  const double kDuration = 3.0;
+  const LinearSystem<double> system(A_, B_, Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d::Zero());
+  auto context = system.CreateDefaultContext();
+  const PiecewisePolynomial<double> x0 =
+      MakeConstant(Eigen::Vector2d(1.0, 0.0), kDuration, 5);
+  const PiecewisePolynomial<double> u0 =
+      MakeConstant(Eigen::Matrix<double, 1, 1>::Zero(), kDuration, 5);
+
+  TimeVaryingLinearQuadraticRegulatorOptions options;
+  options.Qf = Eigen::Matrix2d::Identity();
+  const TimeVaryingLinearQuadraticRegulatorResult expected =
+      TimeVaryingLinearQuadraticRegulator(MakeConstant(A_, kDuration, 5),
+                                          MakeConstant(B_, kDuration, 5), Q_,
+                                          R_, options);
+  for (int num_threads : {1, 3}) {
+    options.num_threads = num_threads;
+    const TimeVaryingLinearQuadraticRegulatorResult result =
+        TimeVaryingLinearQuadraticRegulator(system, *context, x0, u0, Q_, R_,
+                                            options);
+    for (double t : {0.0, 1.1, 2.5}) {
+      EXPECT_TRUE(CompareMatrices(result.S.value(t), expected.S.value(t),
+                                  1e-10));
+      EXPECT_TRUE(CompareMatrices(result.K.value(t), expected.K.value(t),
+                                  1e-10));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -253,6 +253,37 @@ TEST_F(ZMPPlannerTest, TestOptimalControl) {
   }
 }
 
+// Replanning with a planner that has planned before, which reuses the
+// time-invariant terms and the matrix exponentials, must give the same plan
+// as a new planner.
+TEST_F(ZMPPlannerTest, TestReplan) {
+  const Eigen::Vector4d x0(0.1, 0, 0, 0.1);
+  std::vector<double> time = {0, 1, 2, 3, 4, 5};
+  std::vector<Eigen::MatrixXd> zmp_knots(time.size());
+  zmp_knots[0] = Eigen::Vector2d(0, 0);
+  zmp_knots[1] = Eigen::Vector2d(0.2, -0.1);
+  zmp_knots[2] = Eigen::Vector2d(0.4, 0.1);
+  zmp_knots[3] = Eigen::Vector2d(0.6, -0.1);
+  zmp_knots[4] = Eigen::Vector2d(0.8, 0.1);
+  zmp_knots[5] = Eigen::Vector2d(0.8, 0.1);
+  const PiecewisePolynomial<double> zmp_d =
+      PiecewisePolynomial<double>::FirstOrderHold(time, zmp_knots);
+
+  for (const double height : {1.0, 0.8}) {
+    zmp_planner_.Plan(zmp_d, x0, height);
+    ZMPPlanner new_planner;
+    new_planner.Plan(zmp_d, x0, height);
+    for (double t = zmp_d.start_time(); t <= zmp_d.end_time(); t += 0.1) {
+      EXPECT_TRUE(CompareMatrices(zmp_planner_.get_nominal_com(t),
+                                  new_planner.get_nominal_com(t), 1e-12,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(zmp_planner_.get_Vx(t),
+                                  new_planner.get_Vx(t), 1e-12,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace controllers
 }  // namespace systems
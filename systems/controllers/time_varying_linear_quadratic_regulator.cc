@@ -0,0 +1,166 @@
+#include "drake/systems/controllers/time_varying_linear_quadratic_regulator.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/is_approx_equal_abstol.h"
+#include "drake/systems/analysis/initial_value_problem.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+using trajectories::PiecewisePolynomial;
+
+namespace {
+
+// Returns `samples_per_segment` evenly spaced times in each segment between
+// consecutive `breaks`, followed by the last break.
+std::vector<double> MakeSampleTimes(const std::vector<double>& breaks,
+                                    int samples_per_segment) {
+  DRAKE_THROW_UNLESS(samples_per_segment > 0);
+  std::vector<double> times;
+  times.reserve((breaks.size() - 1) * samples_per_segment + 1);
+  for (size_t i = 0; i + 1 < breaks.size(); ++i) {
+    const double dt = (breaks[i + 1] - breaks[i]) / samples_per_segment;
+    for (int j = 0; j < samples_per_segment; ++j) {
+      times.push_back(breaks[i] + j * dt);
+    }
+  }
+  times.push_back(breaks.back());
+  return times;
+}
+
+// Integrates the Riccati differential equation backward from the end of
+// `times`, and records S at each of `times`.
+TimeVaryingLinearQuadraticRegulatorResult SolveRiccatiDifferentialEquation(
+    const PiecewisePolynomial<double>& A, const PiecewisePolynomial<double>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const TimeVaryingLinearQuadraticRegulatorOptions& options,
+    const std::vector<double>& times) {
+  const int n = A.rows(), m = B.cols();
+  DRAKE_DEMAND(n > 0 && m > 0);
+  DRAKE_DEMAND(A.cols() == n && B.rows() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  const Eigen::MatrixXd Qf =
+      options.Qf.size() == 0 ? Eigen::MatrixXd::Zero(n, n) : options.Qf;
+  DRAKE_DEMAND(Qf.rows() == n && Qf.cols() == n);
+
+  const Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+
+  // Integrates in reversed time τ = tf - t, so that the final condition
+  // S(tf) = Qf becomes an initial condition:
+  //   dS/dτ = Q + SA + A'S - SBR⁻¹B'S.
+  const double tf = times.back();
+  auto riccati = [&](const double& tau, const Eigen::VectorXd& s,
+                     const Eigen::VectorXd&) -> Eigen::VectorXd {
+    const double t = tf - tau;
+    const Eigen::Map<const Eigen::MatrixXd> S_raw(s.data(), n, n);
+    const Eigen::MatrixXd S = 0.5 * (S_raw + S_raw.transpose());
+    const Eigen::MatrixXd A_t = A.value(t);
+    const Eigen::MatrixXd SB = S * B.value(t);
+    const Eigen::MatrixXd dS_dtau = Q + S * A_t + A_t.transpose() * S -
+                                    SB * R_cholesky.solve(SB.transpose());
+    return Eigen::Map<const Eigen::VectorXd>(dS_dtau.data(), n * n);
+  };
+  InitialValueProblem<double> ivp(
+      riccati, InitialValueProblem<double>::SpecifiedValues(
+                   0.0, Eigen::Map<const Eigen::VectorXd>(Qf.data(), n * n),
+                   Eigen::VectorXd(0)));
+  ivp.get_mutable_integrator()->set_target_accuracy(
+      options.integration_accuracy);
+
+  // The samples are solved for in increasing τ, so each solve continues the
+  // integration from the previous one.
+  const int num_samples = static_cast<int>(times.size());
+  std::vector<Eigen::MatrixXd> S(num_samples), Sdot(num_samples),
+      K(num_samples);
+  for (int i = num_samples - 1; i >= 0; --i) {
+    const double tau = tf - times[i];
+    const Eigen::VectorXd s = ivp.Solve(tau);
+    const Eigen::Map<const Eigen::MatrixXd> S_raw(s.data(), n, n);
+    S[i] = 0.5 * (S_raw + S_raw.transpose());
+    const Eigen::VectorXd ds_dtau = riccati(tau, s, Eigen::VectorXd(0));
+    Sdot[i] = -Eigen::Map<const Eigen::MatrixXd>(ds_dtau.data(), n, n);
+    K[i] = R_cholesky.solve(B.value(times[i]).transpose() * S[i]);
+  }
+
+  TimeVaryingLinearQuadraticRegulatorResult result;
+  result.S = PiecewisePolynomial<double>::Cubic(times, S, Sdot);
+  result.K = PiecewisePolynomial<double>::FirstOrderHold(times, K);
+  return result;
+}
+
+}  // namespace
+
+TimeVaryingLinearQuadraticRegulatorResult TimeVaryingLinearQuadraticRegulator(
+    const PiecewisePolynomial<double>& A, const PiecewisePolynomial<double>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const TimeVaryingLinearQuadraticRegulatorOptions& options) {
+  DRAKE_DEMAND(A.start_time() == B.start_time() &&
+               A.end_time() == B.end_time());
+  return SolveRiccatiDifferentialEquation(
+      A, B, Q, R, options,
+      MakeSampleTimes(A.get_segment_times(), options.samples_per_segment));
+}
+
+TimeVaryingLinearQuadraticRegulatorResult TimeVaryingLinearQuadraticRegulator(
+    const System<double>& system, const Context<double>& context,
+    const PiecewisePolynomial<double>& x0,
+    const PiecewisePolynomial<double>& u0,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const TimeVaryingLinearQuadraticRegulatorOptions& options) {
+  DRAKE_THROW_UNLESS(context.has_only_continuous_state());
+  DRAKE_THROW_UNLESS(system.get_num_input_ports() > 0);
+  DRAKE_DEMAND(x0.start_time() == u0.start_time() &&
+               x0.end_time() == u0.end_time());
+  const std::vector<double> times =
+      MakeSampleTimes(x0.get_segment_times(), options.samples_per_segment);
+  const int num_samples = static_cast<int>(times.size());
+
+  // Sets up one context per sample.
+  std::vector<std::unique_ptr<Context<double>>> owned_contexts(num_samples);
+  std::vector<const Context<double>*> contexts(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    owned_contexts[i] = context.Clone();
+    owned_contexts[i]->set_time(times[i]);
+    owned_contexts[i]->get_mutable_continuous_state_vector().SetFromVector(
+        x0.value(times[i]));
+    owned_contexts[i]->FixInputPort(0, u0.value(times[i]));
+    contexts[i] = owned_contexts[i].get();
+  }
+
+  const Linearizer linearizer(system, 0, kNoOutput);
+  const int num_states = x0.rows();
+  std::vector<int> state_columns(num_states), input_columns(u0.rows());
+  for (int i = 0; i < num_states; ++i) state_columns[i] = i;
+  for (int i = 0; i < u0.rows(); ++i) input_columns[i] = i;
+  const std::vector<Linearization> linearizations =
+      linearizer.CalcLinearizations(contexts, state_columns, input_columns,
+                                    options.num_threads);
+
+  std::vector<Eigen::MatrixXd> A(num_samples), B(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    A[i] = linearizations[i].A;
+    B[i] = linearizations[i].B;
+  }
+  return SolveRiccatiDifferentialEquation(
+      PiecewisePolynomial<double>::FirstOrderHold(times, A),
+      PiecewisePolynomial<double>::FirstOrderHold(times, B), Q, R, options,
+      times);
+}
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
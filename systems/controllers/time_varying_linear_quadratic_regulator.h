@@ -0,0 +1,105 @@
+#pragma once
+
+#include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+/// Options for TimeVaryingLinearQuadraticRegulator().
+struct TimeVaryingLinearQuadraticRegulatorOptions {
+  /// The final cost x'(tf) Qf x(tf), of size num_states x num_states. An empty
+  /// matrix (the default) stands for zero.
+  Eigen::MatrixXd Qf;
+
+  /// The number of samples taken in each segment of the nominal trajectory.
+  /// The system is linearized at each sample, and the solution is recorded at
+  /// each sample; both are interpolated in between.
+  int samples_per_segment{4};
+
+  /// The accuracy, in the relative tolerance sense, of the error-controlled
+  /// integration of the Riccati differential equation.
+  double integration_accuracy{1e-6};
+
+  /// The maximum number of threads used to linearize the system along the
+  /// trajectory.
+  int num_threads{1};
+};
+
+struct TimeVaryingLinearQuadraticRegulatorResult {
+  /// The optimal feedback gain K(t); the optimal control is
+  /// u(t) = u0(t) - K(t) (x(t) - x0(t)).
+  trajectories::PiecewisePolynomial<double> K;
+  /// The quadratic cost-to-go S(t); J = (x - x0)' S(t) (x - x0).
+  trajectories::PiecewisePolynomial<double> S;
+};
+
+/// Computes the finite-horizon, time-varying linear quadratic regulator for
+/// the problem:
+///
+///   @f[ \dot{x} = A(t)x + B(t)u @f]
+///   @f[ \min_u x'(t_f)Q_fx(t_f) + \int_{t_0}^{t_f} x'Qx + u'Ru dt @f]
+///
+/// by integrating the Riccati differential equation
+///
+///   @f[ -\dot{S} = Q + SA + A'S - SBR^{-1}B'S, \quad S(t_f) = Q_f @f]
+///
+/// backward in time with an error-controlled integrator. The solution is
+/// recorded at `options.samples_per_segment` evenly spaced samples in each
+/// segment of @p A; S(t) is a cubic Hermite interpolant of them, and
+/// K(t) = R⁻¹B'(t)S(t) is interpolated linearly. K(t) is suitable as the
+/// feedback matrix of a PiecewisePolynomialLinearSystem.
+///
+/// @param A The state-space dynamics matrix, of size num_states x num_states.
+/// @param B The state-space input matrix, of size num_states x num_inputs, over
+/// the same time interval as @p A.
+/// @param Q A symmetric positive semi-definite cost matrix of size num_states x
+/// num_states.
+/// @param R A symmetric positive definite cost matrix of size num_inputs x
+/// num_inputs.
+///
+/// @throws std::runtime_error if R is not positive definite.
+/// @ingroup control_systems
+TimeVaryingLinearQuadraticRegulatorResult TimeVaryingLinearQuadraticRegulator(
+    const trajectories::PiecewisePolynomial<double>& A,
+    const trajectories::PiecewisePolynomial<double>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const TimeVaryingLinearQuadraticRegulatorOptions& options =
+        TimeVaryingLinearQuadraticRegulatorOptions());
+
+/// Linearizes the continuous-time @p system along the nominal trajectory
+/// (@p x0, @p u0), and computes the time-varying LQR that stabilizes it, as
+/// above, in the coordinates (x - x0(t), u - u0(t)). The linearizations at the
+/// samples of the trajectory are computed on up to `options.num_threads`
+/// threads, with a single scalar conversion of @p system.
+///
+/// @param system The System to be controlled. Its first input port is the
+/// control input.
+/// @param context Provides the parameters of @p system, and the values of its
+/// other input ports. Its time, state and control input are ignored.
+/// @param x0 The nominal state trajectory.
+/// @param u0 The nominal input trajectory, over the same time interval as
+/// @p x0.
+/// @param Q A symmetric positive semi-definite cost matrix of size num_states x
+/// num_states.
+/// @param R A symmetric positive definite cost matrix of size num_inputs x
+/// num_inputs.
+///
+/// @throws std::runtime_error if R is not positive definite.
+/// @throws std::runtime_error if @p system does not have only continuous state.
+/// @ingroup control_systems
+TimeVaryingLinearQuadraticRegulatorResult TimeVaryingLinearQuadraticRegulator(
+    const System<double>& system, const Context<double>& context,
+    const trajectories::PiecewisePolynomial<double>& x0,
+    const trajectories::PiecewisePolynomial<double>& u0,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const TimeVaryingLinearQuadraticRegulatorOptions& options =
+        TimeVaryingLinearQuadraticRegulatorOptions());
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
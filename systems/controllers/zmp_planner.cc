@@ -1,5 +1,7 @@
 #include "drake/systems/controllers/zmp_planner.h"
 
+#include <map>
+#include <utility>
 #include <vector>
 
 #include <unsupported/Eigen/MatrixFunctions>
@@ -40,27 +42,11 @@ bool ZMPPlanner::CheckStationaryEndPoint(
   return true;
 }
 
-void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
-                      const Eigen::Vector4d& x0, double height, double gravity,
-                      const Eigen::Matrix2d& Qy, const Eigen::Matrix2d& R) {
-  // Warn the caller if the last point is not stationary. The math is still
-  // correct, and this is an allowable (but dangerous) use case.
-  // If the user use the policy / nominal trajectory past the end point, the
-  // system diverges exponentially fast.
-  if (!CheckStationaryEndPoint(zmp_d)) {
-    drake::log()->warn("ZMPPlanner: The desired zmp trajectory does not end "
-        "in a stationary condition.");
-  }
-
-  int n_segments = zmp_d.get_number_of_segments();
-  int zmp_d_degree = zmp_d.getSegmentPolynomialDegree(0);
-  DRAKE_DEMAND(zmp_d_degree >= 0);
-  DRAKE_DEMAND(zmp_d.rows() == 2 && zmp_d.cols() == 1);
-  DRAKE_DEMAND(height > 0);
-  DRAKE_DEMAND(gravity > 0);
-
-  zmp_d_ = zmp_d;
-
+void ZMPPlanner::ComputeTimeInvariantTerms(double height, double gravity,
+                                           const Eigen::Matrix2d& Qy,
+                                           const Eigen::Matrix2d& R) {
+  height_ = height;
+  gravity_ = gravity;
   Qy_ = Qy;
   R_ = R;
 
@@ -85,19 +71,83 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
   S1_ = lqr_result.S;
   K_ = -lqr_result.K;
 
-  // Computes the time varying linear and constant term in the value function
-  // and linear policy. Also known as the backward pass.
+  // The time-invariant terms of the backward pass.
   Eigen::Matrix<double, 2, 4> NB = (N.transpose() + B_.transpose() * S1_);
   // Eq. 23, 24 in [1].
   Eigen::Matrix<double, 4, 4> A2 =
       NB.transpose() * R1i * B_.transpose() - A_.transpose();
   Eigen::Matrix<double, 4, 2> B2 =
       2 * (C_.transpose() - NB.transpose() * R1i * D_) * Qy_;
-  Eigen::Matrix<double, 4, 4> A2i = A2.inverse();
 
   NB_ = NB;
   A2_ = A2;
   B2_ = B2;
+  A2i_ = A2.inverse();
+
+  // Eq. 35, 36 in [1].
+  Az_.block<4, 4>(0, 0) = A_ + B_ * K_;
+  Az_.block<4, 4>(0, 4) = -0.5 * B_ * R1i * B_.transpose();
+  Az_.block<4, 4>(4, 0).setZero();
+  Az_.block<4, 4>(4, 4) = A2;
+  Azi_ = Az_.inverse();
+  Bz_.block<4, 2>(0, 0) = B_ * R1i * D_ * Qy_;
+  Bz_.block<4, 2>(4, 0) = B2;
+
+  // The cached matrix exponentials depend on A2 and Az.
+  exponentials_.clear();
+}
+
+void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
+                      const Eigen::Vector4d& x0, double height, double gravity,
+                      const Eigen::Matrix2d& Qy, const Eigen::Matrix2d& R) {
+  // Warn the caller if the last point is not stationary. The math is still
+  // correct, and this is an allowable (but dangerous) use case.
+  // If the user use the policy / nominal trajectory past the end point, the
+  // system diverges exponentially fast.
+  if (!CheckStationaryEndPoint(zmp_d)) {
+    drake::log()->warn("ZMPPlanner: The desired zmp trajectory does not end "
+        "in a stationary condition.");
+  }
+
+  int n_segments = zmp_d.get_number_of_segments();
+  int zmp_d_degree = zmp_d.getSegmentPolynomialDegree(0);
+  DRAKE_DEMAND(zmp_d_degree >= 0);
+  DRAKE_DEMAND(zmp_d.rows() == 2 && zmp_d.cols() == 1);
+  DRAKE_DEMAND(height > 0);
+  DRAKE_DEMAND(gravity > 0);
+
+  zmp_d_ = zmp_d;
+
+  // The LQR solution and the other time-invariant terms only depend on the
+  // parameters, so they are reused when replanning with the same parameters.
+  if (!planned_ || height != height_ || gravity != gravity_ || Qy != Qy_ ||
+      R != R_) {
+    ComputeTimeInvariantTerms(height, gravity, Qy, R);
+  }
+  const Eigen::Matrix<double, 2, 2>& R1i = R1i_;
+  const Eigen::Matrix<double, 4, 4>& A2 = A2_;
+  const Eigen::Matrix<double, 4, 2>& B2 = B2_;
+  const Eigen::Matrix<double, 4, 4>& A2i = A2i_;
+
+  // The matrix exponentials of the segments, reused from the previous plan
+  // for the segments of the same duration (e.g., when replanning after
+  // appending segments to the previous desired ZMP trajectory).
+  std::map<double, SegmentExponentials> exponentials;
+  for (int t = 0; t < n_segments; t++) {
+    const double dt = zmp_d.duration(t);
+    if (exponentials.count(dt) > 0) continue;
+    auto cached = exponentials_.find(dt);
+    if (cached != exponentials_.end()) {
+      exponentials.insert(*cached);
+    } else {
+      Eigen::Matrix4d A2exp = A2 * dt;
+      A2exp = A2exp.exp();
+      Eigen::Matrix<double, 8, 8> Az_exp = Az_ * dt;
+      Az_exp = Az_exp.exp();
+      exponentials.emplace(dt, SegmentExponentials{A2exp.inverse(), Az_exp});
+    }
+  }
+  exponentials_ = std::move(exponentials);
 
   // Last desired ZMP.
   Eigen::Vector2d zmp_tf = zmp_d.value(zmp_d.end_time());
@@ -119,6 +169,8 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
   Eigen::VectorXd delta_time_vec(zmp_d_degree + 1);
   delta_time_vec[0] = 1;
 
+  // Computes the time varying linear and constant term in the value function
+  // and linear policy. Also known as the backward pass.
   // Algorithm 1 in [1] to solve for parameters of s2 and k2.
   for (int t = n_segments - 1; t >= 0; t--) {
     c[t].setZero();
@@ -148,13 +200,11 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
     }
 
     double dt = zmp_d.duration(t);
-    Eigen::Matrix4d A2exp = A2 * dt;
-    A2exp = A2exp.exp();
     for (int i = 0; i < zmp_d_degree + 1; i++)
       delta_time_vec[i] = std::pow(dt, i);
     tmp4 = tmp4 - beta[t] * delta_time_vec;
 
-    alpha.col(t) = A2exp.inverse() * tmp4;
+    alpha.col(t) = exponentials_.at(dt).A2_exp_inverse * tmp4;
 
     beta_poly[t].resize(4, 1);
     for (int n = 0; n < 4; n++) {
@@ -178,16 +228,9 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
                                                    A2, alpha, gamma_traj);
 
   // Computes the nominal CoM trajectory. Also known as the forward pass.
-  // Eq. 35, 36 in [1].
-  Eigen::Matrix<double, 8, 8> Az, Azi;
-  Eigen::Matrix<double, 8, 2> Bz;
-  Az.block<4, 4>(0, 0) = A_ + B_ * K_;
-  Az.block<4, 4>(0, 4) = -0.5 * B_ * R1i * B_.transpose();
-  Az.block<4, 4>(4, 0).setZero();
-  Az.block<4, 4>(4, 4) = A2;
-  Azi = Az.inverse();
-  Bz.block<4, 2>(0, 0) = B_ * R1i * D_ * Qy_;
-  Bz.block<4, 2>(4, 0) = B2;
+  const Eigen::Matrix<double, 8, 8>& Az = Az_;
+  const Eigen::Matrix<double, 8, 8>& Azi = Azi_;
+  const Eigen::Matrix<double, 8, 2>& Bz = Bz_;
 
   Eigen::MatrixXd a(8, n_segments);
   a.bottomRows<4>() = alpha;
@@ -197,7 +240,6 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
   std::vector<Eigen::MatrixXd> b(n_segments,
                                  Eigen::MatrixXd(4, zmp_d_degree + 1));
   Eigen::Matrix<double, 8, 1> tmp81;
-  Eigen::Matrix<double, 8, 8> Az_exp;
   Eigen::Matrix<double, 4, 8> I48;
   I48.block<4, 4>(0, 0).setIdentity();
   I48.block<4, 4>(0, 4).setZero();
@@ -220,11 +262,9 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
 
     a.block<4, 1>(0, t) = x - b[t].col(0);
 
-    Az_exp = Az * dt;
-    Az_exp = Az_exp.exp();
     for (int i = 0; i < zmp_d_degree + 1; i++)
       delta_time_vec[i] = std::pow(dt, i);
-    x = I48 * Az_exp * a.col(t) + b[t] * delta_time_vec;
+    x = I48 * exponentials_.at(dt).Az_exp * a.col(t) + b[t] * delta_time_vec;
 
     b[t].block<2, 1>(0, 0) += zmp_tf;  // Map CoM position back to world frame.
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/exponential_plus_piecewise_polynomial.h"
@@ -79,6 +81,12 @@ class ZMPPlanner {
    *
    * None of the other public methods should be called until Plan is called.
    *
+   * Plan may be called again to replan, e.g., after appending footsteps to
+   * `zmp_d`. The LQR solution and the other terms that only depend on
+   * `height`, `gravity`, `Qy` and `R` are reused if these are unchanged, as
+   * are the matrix exponentials of the segments of `zmp_d` whose durations
+   * occurred in the previous plan.
+   *
    * It is allowed to pass in a `zmp_d` with a non-stationary end point, but
    * the user should treat the result with caution, since the resulting nominal
    * CoM trajectory diverges exponentially fast past the end point.
@@ -282,6 +290,12 @@ class ZMPPlanner {
   bool CheckStationaryEndPoint(
       const trajectories::PiecewisePolynomial<double>& zmp_d) const;
 
+  // Computes the dynamics matrices, the LQR solution, and the other terms
+  // that do not depend on the desired ZMP trajectory.
+  void ComputeTimeInvariantTerms(double height, double gravity,
+                                 const Eigen::Matrix2d& Qy,
+                                 const Eigen::Matrix2d& R);
+
   // Used to test whether the last point of the desired ZMP trajectory is
   // stationary or not in CheckStationaryEndPoint. This number is currently
   // arbitrarily chosen.
@@ -313,6 +327,24 @@ class ZMPPlanner {
   Eigen::Matrix<double, 2, 2> R1i_;
   Eigen::Matrix<double, 4, 4> A2_;
   Eigen::Matrix<double, 4, 2> B2_;
+  Eigen::Matrix<double, 4, 4> A2i_;
+
+  // The dynamics of the forward pass.
+  Eigen::Matrix<double, 8, 8> Az_;
+  Eigen::Matrix<double, 8, 8> Azi_;
+  Eigen::Matrix<double, 8, 2> Bz_;
+
+  // The parameters of the time-invariant terms above.
+  double height_{};
+  double gravity_{};
+
+  // inverse(exp(A2 * dt)) and exp(Az * dt) for the segment durations dt of
+  // the desired ZMP trajectory.
+  struct SegmentExponentials {
+    Eigen::Matrix<double, 4, 4> A2_exp_inverse;
+    Eigen::Matrix<double, 8, 8> Az_exp;
+  };
+  std::map<double, SegmentExponentials> exponentials_;
 
   // One step cost function:
   // L = (y - y_d)^T * Qy * (y - y_d)^T + u^T * R * u.
@@ -12,10 +12,12 @@ AbstractValues::~AbstractValues() {}
 AbstractValues::AbstractValues() {}
 
 AbstractValues::AbstractValues(
-    std::vector<std::unique_ptr<AbstractValue>>&& data)
-    : owned_data_(std::move(data)) {
-  for (auto& datum : owned_data_) {
+    std::vector<std::unique_ptr<AbstractValue>>&& data) {
+  data_.reserve(data.size());
+  owned_data_.reserve(data.size());
+  for (auto& datum : data) {
     data_.push_back(datum.get());
+    owned_data_.push_back(std::move(datum));
   }
 }
 
@@ -39,14 +41,18 @@ const AbstractValue& AbstractValues::get_value(int index) const {
 AbstractValue& AbstractValues::get_mutable_value(int index) {
   DRAKE_ASSERT(index >= 0 && index < size());
   DRAKE_ASSERT(data_[index] != nullptr);
+  if (!owned_data_.empty() && owned_data_[index].use_count() > 1) {
+    // The value is shared with a copy-on-write clone; take a private copy.
+    owned_data_[index] = data_[index]->Clone();
+    data_[index] = owned_data_[index].get();
+  }
   return *data_[index];
 }
 
 void AbstractValues::CopyFrom(const AbstractValues& other) {
   DRAKE_ASSERT(size() == other.size());
   for (int i = 0; i < size(); i++) {
-    DRAKE_ASSERT(data_[i] != nullptr);
-    data_[i]->SetFrom(other.get_value(i));
+    get_mutable_value(i).SetFrom(other.get_value(i));
   }
 }
 
@@ -59,5 +65,20 @@ std::unique_ptr<AbstractValues> AbstractValues::Clone() const {
   return std::make_unique<AbstractValues>(std::move(cloned_data));
 }
 
+std::unique_ptr<AbstractValues> AbstractValues::CloneCopyOnWrite() const {
+  auto clone = std::make_unique<AbstractValues>();
+  clone->data_.reserve(data_.size());
+  clone->owned_data_.reserve(data_.size());
+  for (int i = 0; i < size(); ++i) {
+    if (owned_data_.empty()) {
+      clone->owned_data_.push_back(data_[i]->Clone());
+    } else {
+      clone->owned_data_.push_back(owned_data_[i]);
+    }
+    clone->data_.push_back(clone->owned_data_.back().get());
+  }
+  return clone;
+}
+
 }  // namespace systems
 }  // namespace drake
@@ -14,6 +14,12 @@ namespace systems {
 /// It may or may not own the underlying data, and therefore is suitable
 /// for both leaf Systems and diagrams.
 ///
+/// The owned values of an AbstractValues made by CloneCopyOnWrite() are
+/// shared with the original until they are first accessed for writing with
+/// get_mutable_value() (or CopyFrom()), at which point the writer takes a
+/// private clone of the value. References returned by get_mutable_value()
+/// are therefore only valid until this AbstractValues is next cloned.
+///
 /// @tparam T A mathematical type compatible with Eigen's Scalar.
 class AbstractValues {
  public:
@@ -55,14 +61,20 @@ class AbstractValues {
   /// cloned had ownership of its data or not.
   std::unique_ptr<AbstractValues> Clone() const;
 
+  /// Returns a copy of this AbstractValues that owns its values, but shares
+  /// them with this AbstractValues until either accesses them for writing.
+  /// Unowned values can't be shared, since whatever owns them may write to
+  /// them directly; they are deep copied as Clone() does.
+  std::unique_ptr<AbstractValues> CloneCopyOnWrite() const;
+
  private:
   // Pointers to the data. If the data is owned, these pointers are equal to
   // the pointers in owned_data_.
   std::vector<AbstractValue*> data_;
-  // Owned pointers to the data. The only purpose of these pointers is to
-  // maintain ownership. They may be populated at construction time, and are
-  // never accessed thereafter.
-  std::vector<std::unique_ptr<AbstractValue>> owned_data_;
+  // Owned pointers to the data, which are either empty or parallel to data_.
+  // They maintain ownership, which is shared with copy-on-write clones until
+  // a value is first accessed for writing.
+  std::vector<std::shared_ptr<AbstractValue>> owned_data_;
 };
 
 }  // namespace systems
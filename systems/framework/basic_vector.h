@@ -20,6 +20,12 @@ namespace systems {
 /// BasicVector is a semantics-free wrapper around an Eigen vector that
 /// satisfies VectorBase. Once constructed, its size is fixed.
 ///
+/// A BasicVector made by CloneCopyOnWrite() shares its values with the
+/// original until either of them is first mutated, at which point the mutated
+/// one takes a private copy. Every mutating method, including the non-const
+/// GetAtIndex() and get_mutable_value(), triggers that copy, so references
+/// they return are only valid until the vector is next cloned.
+///
 /// @tparam T The vector element type, which must be a valid Eigen scalar.
 template <typename T>
 class BasicVector : public VectorBase<T> {
@@ -32,10 +38,12 @@ class BasicVector : public VectorBase<T> {
   /// Initializes with the given @p size using the drake::dummy_value<T>, which
   /// is NaN when T = double.
   explicit BasicVector(int size)
-      : values_(VectorX<T>::Constant(size, dummy_value<T>::get())) {}
+      : values_(std::make_shared<VectorX<T>>(
+            VectorX<T>::Constant(size, dummy_value<T>::get()))) {}
 
   /// Constructs a BasicVector with the specified @p data.
-  explicit BasicVector(const VectorX<T>& data) : values_(data) {}
+  explicit BasicVector(const VectorX<T>& data)
+      : values_(std::make_shared<VectorX<T>>(data)) {}
 
   /// Constructs a BasicVector whose elements are the elements of @p data.
   static std::unique_ptr<BasicVector<T>> Make(
@@ -59,60 +67,74 @@ class BasicVector : public VectorBase<T> {
     return std::move(data);
   }
 
-  int size() const override { return static_cast<int>(values_.rows()); }
+  int size() const override { return static_cast<int>(values_->rows()); }
 
   /// Sets the vector to the given value. After a.set_value(b.get_value()), a
   /// must be identical to b.
   /// Throws std::out_of_range if the new value has different dimensions.
   void set_value(const Eigen::Ref<const VectorX<T>>& value) {
-    if (value.rows() != values_.rows()) {
+    if (value.rows() != values_->rows()) {
       throw std::out_of_range(
-          "Cannot set a BasicVector of size " + std::to_string(values_.rows()) +
+          "Cannot set a BasicVector of size " + std::to_string(size()) +
           " with a value of size " + std::to_string(value.rows()));
     }
-    values_ = value;
+    if (values_.use_count() > 1) {
+      // The old values are all overwritten, so there is nothing to copy.
+      values_ = std::make_shared<VectorX<T>>(value);
+    } else {
+      *values_ = value;
+    }
   }
 
   /// Returns the entire vector as a const Eigen::VectorBlock.
   Eigen::VectorBlock<const VectorX<T>> get_value() const {
-    return values_.head(values_.rows());
+    const VectorX<T>& values = *values_;
+    return values.head(values.rows());
   }
 
   /// Returns the entire vector as a mutable Eigen::VectorBlock, which allows
   /// mutation of the values, but does not allow resizing the vector itself.
   Eigen::VectorBlock<VectorX<T>> get_mutable_value() {
-    return values_.head(values_.rows());
+    VectorX<T>& values = mutable_values();
+    return values.head(values.rows());
   }
 
   const T& GetAtIndex(int index) const override {
     DRAKE_THROW_UNLESS(index < size());
-    return values_[index];
+    return (*values_)[index];
   }
 
   T& GetAtIndex(int index) override {
     DRAKE_THROW_UNLESS(index < size());
-    return values_[index];
+    return mutable_values()[index];
   }
 
   void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) override {
     set_value(value);
   }
 
-  VectorX<T> CopyToVector() const override { return values_; }
+  VectorX<T> CopyToVector() const override { return *values_; }
+
+  void CopyToPreSizedVector(Eigen::Ref<VectorX<T>> vec) const override {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination must be the same size.");
+    }
+    vec = *values_;
+  }
 
   void ScaleAndAddToVector(const T& scale,
                            Eigen::Ref<VectorX<T>> vec) const override {
     if (vec.rows() != size()) {
       throw std::out_of_range("Addends must be the same size.");
     }
-    vec += scale * values_;
+    vec += scale * *values_;
   }
 
-  void SetZero() override { values_.setZero(); }
+  void SetZero() override { mutable_values().setZero(); }
 
   /// Computes the infinity norm for this vector.
   T NormInf() const override {
-    return values_.template lpNorm<Eigen::Infinity>();
+    return values_->template lpNorm<Eigen::Infinity>();
   }
 
   /// Copies the entire vector to a new BasicVector, with the same concrete
@@ -126,6 +148,15 @@ class BasicVector : public VectorBase<T> {
     return clone;
   }
 
+  /// Returns a clone with the same concrete implementation type that shares
+  /// the values of this vector until either vector is mutated.
+  std::unique_ptr<BasicVector<T>> CloneCopyOnWrite() const {
+    auto clone = std::unique_ptr<BasicVector<T>>(DoClone());
+    DRAKE_DEMAND(clone->size() == size());
+    clone->values_ = values_;
+    return clone;
+  }
+
  protected:
   /// Returns a new BasicVector containing a copy of the entire vector.
   /// Caller must take ownership, and may rely on the NVI wrapper to initialize
@@ -164,12 +195,23 @@ class BasicVector : public VectorBase<T> {
   void DoPlusEqScaled(
       const std::initializer_list<std::pair<T, const VectorBase<T>&>>& rhs_scal)
       override {
+    VectorX<T>& values = mutable_values();
     for (const auto& operand : rhs_scal)
-      operand.second.ScaleAndAddToVector(operand.first, values_);
+      operand.second.ScaleAndAddToVector(operand.first, values);
+  }
+
+  // Returns the values for writing, first taking a private copy of them if
+  // they are shared with a copy-on-write clone.
+  VectorX<T>& mutable_values() {
+    if (values_.use_count() > 1) {
+      values_ = std::make_shared<VectorX<T>>(*values_);
+    }
+    return *values_;
   }
 
-  // The column vector of T values.
-  VectorX<T> values_;
+  // The column vector of T values, possibly shared with copy-on-write clones.
+  // Never null.
+  std::shared_ptr<VectorX<T>> values_;
   // N.B. Do not add more member fields without considering the effect on
   // subclasses.  Derived class's Clone() methods currently assume that the
   // BasicVector(const VectorX<T>&) constructor is all that is needed.
@@ -116,6 +116,21 @@ void Cache::SetAllEntriesOutOfDate() {
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::EnableStatistics() {
+  for (auto& entry : store_)
+    if (entry) entry->enable_statistics();
+}
+
+void Cache::DisableStatistics() {
+  for (auto& entry : store_)
+    if (entry) entry->disable_statistics();
+}
+
+void Cache::ResetStatistics() {
+  for (auto& entry : store_)
+    if (entry) entry->reset_statistics();
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -410,6 +410,51 @@ class CacheEntryValue {
   bool is_cache_entry_disabled() const {
     return (flags_ & kCacheEntryIsDisabled) != 0;
   }
+
+  /** (Debugging) Starts counting cache hits and misses for this cache entry
+  value. A _hit_ is an `Eval()` that returns the stored value without
+  recomputing it; a _miss_ is an `Eval()` that invokes `Calc()`. Counting is
+  off by default so that `Eval()` pays only for a single predictable branch.
+  Enabling statistics does not reset the counts; see reset_statistics(). */
+  void enable_statistics() { collect_statistics_ = true; }
+
+  /** (Debugging) Stops counting cache hits and misses for this cache entry
+  value. The counts accumulated so far are retained. */
+  void disable_statistics() { collect_statistics_ = false; }
+
+  /** (Debugging) Returns `true` if hit and miss counts are being recorded. */
+  bool is_collecting_statistics() const { return collect_statistics_; }
+
+  /** (Debugging) Sets the hit and miss counts back to zero. */
+  void reset_statistics() {
+    num_hits_ = 0;
+    num_misses_ = 0;
+  }
+
+  /** (Debugging) Returns the number of `Eval()` calls that reused the stored
+  value while statistics were enabled. */
+  int64_t num_hits() const { return num_hits_; }
+
+  /** (Debugging) Returns the number of `Eval()` calls that had to recompute
+  the value while statistics were enabled. */
+  int64_t num_misses() const { return num_misses_; }
+
+  /** (Debugging) Returns the fraction of recorded `Eval()` calls that were
+  hits, or zero if none have been recorded. */
+  double hit_ratio() const {
+    const int64_t total = num_hits_ + num_misses_;
+    return total == 0 ? 0.0 : static_cast<double>(num_hits_) / total;
+  }
+
+  /** (Internal use only) Records a cache hit if statistics are enabled. */
+  void note_hit() {
+    if (collect_statistics_) ++num_hits_;
+  }
+
+  /** (Internal use only) Records a cache miss if statistics are enabled. */
+  void note_miss() {
+    if (collect_statistics_) ++num_misses_;
+  }
   //@}
 
 #ifndef DRAKE_DOXYGEN_CXX
@@ -578,6 +623,11 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Opt-in hit/miss statistics; see enable_statistics().
+  bool collect_statistics_{false};
+  int64_t num_hits_{0};
+  int64_t num_misses_{0};
 };
 
 //==============================================================================
@@ -674,6 +724,18 @@ class Cache {
   normal caching behavior resumes. */
   void SetAllEntriesOutOfDate();
 
+  /** (Debugging) Enables hit/miss statistics for all the entries in this
+  %Cache. See CacheEntryValue::enable_statistics(). */
+  void EnableStatistics();
+
+  /** (Debugging) Disables hit/miss statistics for all the entries in this
+  %Cache. See CacheEntryValue::disable_statistics(). */
+  void DisableStatistics();
+
+  /** (Debugging) Zeroes the hit/miss statistics of all the entries in this
+  %Cache. See CacheEntryValue::reset_statistics(). */
+  void ResetStatistics();
+
  private:
   // So ContextBase and no one else can copy a Cache.
   friend class ContextBase;
@@ -138,8 +138,12 @@ class CacheEntry {
   // Keep this method as small as possible to encourage inlining; it gets
   // called *a lot*.
   const AbstractValue& EvalAbstract(const ContextBase& context) const {
-    const CacheEntryValue& cache_value = get_cache_entry_value(context);
-    if (cache_value.needs_recomputation()) UpdateValue(context);
+    CacheEntryValue& cache_value = get_mutable_cache_entry_value(context);
+    if (cache_value.needs_recomputation()) {
+      UpdateValue(context);
+    } else {
+      cache_value.note_hit();
+    }
     return cache_value.get_abstract_value();
   }
 
@@ -257,6 +261,7 @@ class CacheEntry {
     // We can get a mutable cache entry value from a const context.
     CacheEntryValue& mutable_cache_value =
         get_mutable_cache_entry_value(context);
+    mutable_cache_value.note_miss();
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
     Calc(context, &value);
@@ -411,6 +411,23 @@ class Context {
     return std::unique_ptr<Context<T>>(DoClone());
   }
 
+  /// Returns a copy-on-write clone of this Context. The clone is equivalent
+  /// to one made by Clone(), but the storage of its numeric state and
+  /// parameters (see BasicVector::CloneCopyOnWrite()), and of the abstract
+  /// state and parameters of a Context that is not a subcontext of a Diagram
+  /// (see AbstractValues::CloneCopyOnWrite()), is shared with this Context
+  /// until either Context first writes to it. This makes cloning cheap when
+  /// the clone, or this Context, only modifies part of its state, as in
+  /// branching rollouts that are started from a common state.
+  ///
+  /// A copy-on-write clone and its source must not be used concurrently from
+  /// different threads; use Clone() to give each thread its own Context.
+  /// Mutable references into the state or parameters of either Context are
+  /// invalidated by cloning.
+  std::unique_ptr<Context<T>> CloneCopyOnWrite() const {
+    return std::unique_ptr<Context<T>>(DoCloneCopyOnWrite());
+  }
+
   /// Returns a deep copy of this Context's State.
   std::unique_ptr<State<T>> CloneState() const {
     return std::unique_ptr<State<T>>(DoCloneState());
@@ -426,6 +443,14 @@ class Context {
     get_mutable_parameters().SetFrom(source.get_parameters());
   }
 
+  /// Initializes this context's parameters from the real values in
+  /// @p source, regardless of this context's scalar type, e.g., to bring
+  /// parameter changes over to a context of System::GetOrCreateAutoDiffXd().
+  /// Requires a constructor T(double).
+  void SetParametersFrom(const Context<double>& source) {
+    get_mutable_parameters().SetFrom(source.get_parameters());
+  }
+
   /// Declares that @p parent is the context of the enclosing Diagram. The
   /// enclosing Diagram context is needed to evaluate inputs recursively.
   /// Aborts if the parent has already been set to something else.
@@ -469,6 +494,15 @@ class Context {
   /// Contains the return-type-covariant implementation of CloneState().
   virtual State<T>* DoCloneState() const = 0;
 
+  /// Contains the return-type-covariant implementation of
+  /// CloneCopyOnWrite(). The default implementation makes a deep copy with
+  /// DoClone().
+  virtual Context<T>* DoCloneCopyOnWrite() const { return DoClone(); }
+
+  /// Returns the context of the enclosing Diagram, or nullptr if this
+  /// Context is not a subcontext. See set_parent().
+  const Context<T>* get_parent() const { return parent_; }
+
   /// Returns a const reference to current time and step information.
   const StepInfo<T>& get_step_info() const { return step_info_; }
 
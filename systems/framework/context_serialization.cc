@@ -0,0 +1,342 @@
+#include "drake/systems/framework/context_serialization.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/systems/framework/basic_vector.h"
+#include "drake/systems/framework/input_port_descriptor.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// Identifies a Context snapshot; it also reads back differently on a host of
+// the other byte order.
+constexpr int64_t kSnapshotMagic = 0x31305854434b5244;  // "DRKCTX01"
+constexpr int64_t kSnapshotVersion = 1;
+
+// Tags of the values fixed on input ports.
+constexpr int64_t kInputNotFixed = 0;
+constexpr int64_t kInputVector = 1;
+constexpr int64_t kInputAbstract = 2;
+
+[[noreturn]] void ThrowMismatch(const std::string& what, int64_t expected,
+                                int64_t actual) {
+  throw std::runtime_error(
+      "ContextSerializer: the snapshot has " + std::to_string(actual) + " " +
+      what + " but the Context has " + std::to_string(expected) + ".");
+}
+
+void ReadVectorInto(SerializationReader* reader, const std::string& what,
+                    VectorBase<double>* vector) {
+  const Eigen::Map<const VectorX<double>> value = reader->ReadVector();
+  if (value.size() != vector->size()) {
+    ThrowMismatch("elements of " + what, vector->size(), value.size());
+  }
+  vector->SetFromVector(value);
+}
+
+void ReadCount(SerializationReader* reader, const std::string& what,
+               int expected) {
+  const int64_t count = reader->ReadInt64();
+  if (count != expected) ThrowMismatch(what, expected, count);
+}
+
+// Returns a descriptor that is sufficient to read the value fixed on input
+// port @p index of a Context that is not a subcontext.
+InputPortDescriptor<double> MakeInputDescriptor(int index) {
+  return InputPortDescriptor<double>(nullptr, InputPortIndex(index),
+                                     kAbstractValued, 0, nullopt);
+}
+
+}  // namespace
+
+SerializationWriter::SerializationWriter(std::vector<uint8_t>* bytes)
+    : bytes_(bytes), start_(bytes->size()) {}
+
+void SerializationWriter::WriteInt64(int64_t value) {
+  Append(&value, sizeof(value));
+}
+
+void SerializationWriter::WriteDouble(double value) {
+  Append(&value, sizeof(value));
+}
+
+void SerializationWriter::WriteString(const std::string& value) {
+  WriteBytes(value.data(), static_cast<int64_t>(value.size()));
+}
+
+void SerializationWriter::WriteVector(
+    const Eigen::Ref<const VectorX<double>>& value) {
+  WriteInt64(value.size());
+  for (int i = 0; i < value.size(); ++i) {
+    WriteDouble(value[i]);
+  }
+}
+
+void SerializationWriter::WriteBytes(const void* data, int64_t size) {
+  DRAKE_DEMAND(size >= 0);
+  WriteInt64(size);
+  Append(data, static_cast<size_t>(size));
+  Pad();
+}
+
+void SerializationWriter::Append(const void* data, size_t size) {
+  const uint8_t* const begin = static_cast<const uint8_t*>(data);
+  bytes_->insert(bytes_->end(), begin, begin + size);
+}
+
+void SerializationWriter::Pad() {
+  // Every other write is a multiple of eight bytes, so padding the byte
+  // blocks keeps all values aligned relative to where writing began.
+  while ((bytes_->size() - start_) % 8 != 0) {
+    bytes_->push_back(0);
+  }
+}
+
+SerializationReader::SerializationReader(const void* data, size_t size)
+    : data_(static_cast<const uint8_t*>(data)), size_(size) {
+  DRAKE_DEMAND(data != nullptr || size == 0);
+}
+
+int64_t SerializationReader::ReadInt64() {
+  int64_t value;
+  std::memcpy(&value, Consume(sizeof(value)), sizeof(value));
+  return value;
+}
+
+double SerializationReader::ReadDouble() {
+  double value;
+  std::memcpy(&value, Consume(sizeof(value)), sizeof(value));
+  return value;
+}
+
+std::string SerializationReader::ReadString() {
+  int64_t size{};
+  const uint8_t* data = ReadBytes(&size);
+  return std::string(reinterpret_cast<const char*>(data),
+                     static_cast<size_t>(size));
+}
+
+Eigen::Map<const VectorX<double>> SerializationReader::ReadVector() {
+  const int64_t size = ReadInt64();
+  if (size < 0 || static_cast<uint64_t>(size) > remaining() / sizeof(double)) {
+    throw std::runtime_error(
+        "SerializationReader: invalid vector size " + std::to_string(size));
+  }
+  const uint8_t* data = Consume(size * sizeof(double));
+  return Eigen::Map<const VectorX<double>>(
+      reinterpret_cast<const double*>(data), size);
+}
+
+const uint8_t* SerializationReader::ReadBytes(int64_t* size) {
+  DRAKE_DEMAND(size != nullptr);
+  *size = ReadInt64();
+  if (*size < 0 || static_cast<uint64_t>(*size) > remaining()) {
+    throw std::runtime_error(
+        "SerializationReader: invalid byte count " + std::to_string(*size));
+  }
+  const uint8_t* data = Consume(static_cast<size_t>(*size));
+  SkipPadding();
+  return data;
+}
+
+const uint8_t* SerializationReader::Consume(size_t size) {
+  if (size > remaining()) {
+    throw std::runtime_error(
+        "SerializationReader: read past the end of the buffer.");
+  }
+  const uint8_t* result = data_ + offset_;
+  offset_ += size;
+  return result;
+}
+
+void SerializationReader::SkipPadding() {
+  const size_t padding = (8 - offset_ % 8) % 8;
+  Consume(std::min(padding, remaining()));
+}
+
+ContextSerializer::ContextSerializer() {
+  RegisterAbstractValueType<int>();
+  RegisterAbstractValueType<bool>();
+  RegisterAbstractValueType<double>();
+  RegisterAbstractValueType<std::string>();
+}
+
+void ContextSerializer::Serialize(const Context<double>& context,
+                                  std::vector<uint8_t>* bytes) const {
+  SerializationWriter writer(bytes);
+  Serialize(context, &writer);
+}
+
+void ContextSerializer::Serialize(const Context<double>& context,
+                                  SerializationWriter* writer) const {
+  DRAKE_DEMAND(writer != nullptr);
+  writer->WriteInt64(kSnapshotMagic);
+  writer->WriteInt64(kSnapshotVersion);
+  writer->WriteDouble(context.get_time());
+
+  // State.
+  writer->WriteVector(context.get_continuous_state_vector().CopyToVector());
+  const DiscreteValues<double>& xd = context.get_discrete_state();
+  writer->WriteInt64(xd.num_groups());
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    writer->WriteVector(xd.get_vector(i).get_value());
+  }
+  const AbstractValues& xa = context.get_abstract_state();
+  writer->WriteInt64(xa.size());
+  for (int i = 0; i < xa.size(); ++i) {
+    WriteAbstractValue(xa.get_value(i), writer);
+  }
+
+  // Parameters.
+  const Parameters<double>& parameters = context.get_parameters();
+  writer->WriteInt64(parameters.num_numeric_parameters());
+  for (int i = 0; i < parameters.num_numeric_parameters(); ++i) {
+    writer->WriteVector(parameters.get_numeric_parameter(i).get_value());
+  }
+  writer->WriteInt64(parameters.num_abstract_parameters());
+  for (int i = 0; i < parameters.num_abstract_parameters(); ++i) {
+    WriteAbstractValue(parameters.get_abstract_parameter(i), writer);
+  }
+
+  // Fixed inputs.
+  writer->WriteInt64(context.get_num_input_ports());
+  for (int i = 0; i < context.get_num_input_ports(); ++i) {
+    const AbstractValue* value =
+        context.EvalAbstractInput(nullptr, MakeInputDescriptor(i));
+    if (value == nullptr) {
+      writer->WriteInt64(kInputNotFixed);
+    } else if (auto vector =
+                   dynamic_cast<const Value<BasicVector<double>>*>(value)) {
+      writer->WriteInt64(kInputVector);
+      writer->WriteVector(vector->get_value().get_value());
+    } else {
+      writer->WriteInt64(kInputAbstract);
+      WriteAbstractValue(*value, writer);
+    }
+  }
+}
+
+void ContextSerializer::Deserialize(const void* data, size_t size,
+                                    Context<double>* context) const {
+  SerializationReader reader(data, size);
+  Deserialize(&reader, context);
+}
+
+void ContextSerializer::Deserialize(SerializationReader* reader,
+                                    Context<double>* context) const {
+  DRAKE_DEMAND(reader != nullptr);
+  DRAKE_DEMAND(context != nullptr);
+  if (reader->ReadInt64() != kSnapshotMagic) {
+    throw std::runtime_error(
+        "ContextSerializer: the data is not a Context snapshot written on a "
+        "host of this byte order.");
+  }
+  const int64_t version = reader->ReadInt64();
+  if (version != kSnapshotVersion) {
+    throw std::runtime_error(
+        "ContextSerializer: unsupported snapshot version " +
+        std::to_string(version));
+  }
+  context->set_time(reader->ReadDouble());
+
+  // State.
+  ReadVectorInto(reader, "continuous state",
+                 &context->get_mutable_continuous_state_vector());
+  DiscreteValues<double>& xd = context->get_mutable_discrete_state();
+  ReadCount(reader, "discrete state groups", xd.num_groups());
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    ReadVectorInto(reader, "discrete state group " + std::to_string(i),
+                   &xd.get_mutable_vector(i));
+  }
+  AbstractValues& xa = context->get_mutable_abstract_state();
+  ReadCount(reader, "abstract states", xa.size());
+  for (int i = 0; i < xa.size(); ++i) {
+    ReadAbstractValue(reader, &xa.get_mutable_value(i));
+  }
+
+  // Parameters.
+  Parameters<double>& parameters = context->get_mutable_parameters();
+  ReadCount(reader, "numeric parameters", parameters.num_numeric_parameters());
+  for (int i = 0; i < parameters.num_numeric_parameters(); ++i) {
+    ReadVectorInto(reader, "numeric parameter " + std::to_string(i),
+                   &parameters.get_mutable_numeric_parameter(i));
+  }
+  ReadCount(reader, "abstract parameters",
+            parameters.num_abstract_parameters());
+  for (int i = 0; i < parameters.num_abstract_parameters(); ++i) {
+    ReadAbstractValue(reader, &parameters.get_mutable_abstract_parameter(i));
+  }
+
+  // Fixed inputs.
+  ReadCount(reader, "input ports", context->get_num_input_ports());
+  for (int i = 0; i < context->get_num_input_ports(); ++i) {
+    const int64_t tag = reader->ReadInt64();
+    if (tag == kInputVector) {
+      context->FixInputPort(i, VectorX<double>(reader->ReadVector()));
+    } else if (tag == kInputAbstract) {
+      context->FixInputPort(i, ReadNewAbstractValue(reader));
+    } else if (tag != kInputNotFixed) {
+      throw std::runtime_error(
+          "ContextSerializer: invalid tag for input port " +
+          std::to_string(i));
+    }
+  }
+}
+
+const ContextSerializer::AbstractValueCodec&
+ContextSerializer::GetCodecOrThrow(const std::string& type) const {
+  const auto it = codecs_.find(type);
+  if (it == codecs_.end()) {
+    throw std::runtime_error(
+        "ContextSerializer: no serialization is registered for abstract "
+        "values of type " + type + ".");
+  }
+  return it->second;
+}
+
+void ContextSerializer::WriteAbstractValue(
+    const AbstractValue& value, SerializationWriter* writer) const {
+  const std::string type = value.GetNiceTypeName();
+  const AbstractValueCodec& codec = GetCodecOrThrow(type);
+  writer->WriteString(type);
+  // Length-prefix the value so that its encoding is self-delimiting.
+  std::vector<uint8_t> encoded;
+  SerializationWriter value_writer(&encoded);
+  codec.serialize(value, &value_writer);
+  writer->WriteBytes(encoded.data(), static_cast<int64_t>(encoded.size()));
+}
+
+void ContextSerializer::ReadAbstractValue(SerializationReader* reader,
+                                          AbstractValue* value) const {
+  const std::string type = reader->ReadString();
+  if (type != value->GetNiceTypeName()) {
+    throw std::runtime_error(
+        "ContextSerializer: the snapshot has an abstract value of type " +
+        type + " where the Context has one of type " +
+        value->GetNiceTypeName() + ".");
+  }
+  int64_t size{};
+  const uint8_t* data = reader->ReadBytes(&size);
+  SerializationReader value_reader(data, static_cast<size_t>(size));
+  GetCodecOrThrow(type).deserialize(&value_reader, value);
+}
+
+std::unique_ptr<AbstractValue> ContextSerializer::ReadNewAbstractValue(
+    SerializationReader* reader) const {
+  const std::string type = reader->ReadString();
+  const AbstractValueCodec& codec = GetCodecOrThrow(type);
+  std::unique_ptr<AbstractValue> value = codec.create();
+  int64_t size{};
+  const uint8_t* data = reader->ReadBytes(&size);
+  SerializationReader value_reader(data, static_cast<size_t>(size));
+  codec.deserialize(&value_reader, value.get());
+  return value;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/value.h"
+
+namespace drake {
+namespace systems {
+
+/// Appends the binary encoding of scalars, vectors and strings to a byte
+/// buffer. Values are written in the native byte order of the host. Every
+/// value begins at an offset that is a multiple of eight bytes from where the
+/// writer began appending, so that vectors of doubles can be read in place
+/// from a buffer that is mapped from a file.
+class SerializationWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SerializationWriter)
+
+  /// Constructs a writer that appends to @p bytes, which must be non-null and
+  /// remain valid for the lifetime of this writer.
+  explicit SerializationWriter(std::vector<uint8_t>* bytes);
+
+  void WriteInt64(int64_t value);
+  void WriteDouble(double value);
+  void WriteString(const std::string& value);
+  void WriteVector(const Eigen::Ref<const VectorX<double>>& value);
+
+  /// Writes @p size bytes from @p data, preceded by their count and followed
+  /// by padding up to the next multiple of eight bytes.
+  void WriteBytes(const void* data, int64_t size);
+
+ private:
+  void Append(const void* data, size_t size);
+  void Pad();
+
+  std::vector<uint8_t>* const bytes_;
+  const size_t start_;
+};
+
+/// Reads the encoding written by a SerializationWriter from a byte buffer
+/// that it does not own.
+///
+/// Every read throws std::runtime_error if it would run past the end of the
+/// buffer.
+class SerializationReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SerializationReader)
+
+  /// Constructs a reader of the @p size bytes at @p data, which must remain
+  /// valid for the lifetime of this reader. For vectors to be readable in
+  /// place, @p data must be aligned to eight bytes.
+  SerializationReader(const void* data, size_t size);
+
+  int64_t ReadInt64();
+  double ReadDouble();
+  std::string ReadString();
+
+  /// Returns a view of the next vector in the buffer, without copying it.
+  Eigen::Map<const VectorX<double>> ReadVector();
+
+  /// Returns the next block of bytes written by WriteBytes(), and sets
+  /// @p size to its length.
+  const uint8_t* ReadBytes(int64_t* size);
+
+  /// Returns the number of bytes that have not been read yet.
+  size_t remaining() const { return size_ - offset_; }
+
+ private:
+  const uint8_t* Consume(size_t size);
+  void SkipPadding();
+
+  const uint8_t* const data_;
+  const size_t size_;
+  size_t offset_{0};
+};
+
+/// Describes how a Value<V> held in a Context is serialized by a
+/// ContextSerializer. It is undefined for every type; a type opts into
+/// serialization by specializing it with two static functions:
+///
+/// @code
+/// template <>
+/// struct ValueSerializationTraits<MyType> {
+///   static void Serialize(const MyType& value, SerializationWriter* writer);
+///   static void Deserialize(SerializationReader* reader, MyType* value);
+/// };
+/// @endcode
+///
+/// Specializations are provided for `int`, `double`, `bool` and
+/// `std::string`.
+template <typename V>
+struct ValueSerializationTraits;
+
+/// Serializes a Context<double> into a compact binary snapshot, and restores
+/// a Context from one, e.g., to checkpoint a long simulation.
+///
+/// A snapshot records the time, the continuous, discrete and abstract state,
+/// the numeric and abstract parameters, and the values fixed on the input
+/// ports of the Context. It does not record the structure of the System. A
+/// snapshot can only be restored into a Context of the System that produced
+/// it (typically a fresh one from System::CreateDefaultContext()), and a
+/// mismatch in the number or sizes of the values is reported by throwing
+/// std::runtime_error.
+///
+/// Abstract values are serialized by the ValueSerializationTraits of their
+/// type, which must be registered with RegisterAbstractValueType(); trying
+/// to serialize any other abstract value throws std::runtime_error. Values
+/// are identified by their type name, so a snapshot must be restored by a
+/// serializer that registered the same types.
+///
+/// The snapshot is laid out so that it can be restored directly from a
+/// memory-mapped file; see SerializationWriter.
+class ContextSerializer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextSerializer)
+
+  /// Constructs a serializer with the value types for which
+  /// ValueSerializationTraits are specialized in this file registered.
+  ContextSerializer();
+
+  /// Registers the abstract value type Value<V>, which is then serialized
+  /// with ValueSerializationTraits<V>. V must be default constructible.
+  template <typename V>
+  void RegisterAbstractValueType() {
+    AbstractValueCodec codec;
+    codec.create = []() { return std::make_unique<Value<V>>(); };
+    codec.serialize = [](const AbstractValue& value,
+                         SerializationWriter* writer) {
+      ValueSerializationTraits<V>::Serialize(value.GetValue<V>(), writer);
+    };
+    codec.deserialize = [](SerializationReader* reader, AbstractValue* value) {
+      ValueSerializationTraits<V>::Deserialize(
+          reader, &value->GetMutableValue<V>());
+    };
+    codecs_[NiceTypeName::Get<V>()] = std::move(codec);
+  }
+
+  /// Appends the snapshot of @p context to @p bytes. The @p context must not
+  /// be a subcontext of a Diagram.
+  void Serialize(const Context<double>& context,
+                 std::vector<uint8_t>* bytes) const;
+
+  /// Writes the snapshot of @p context with @p writer; see Serialize().
+  void Serialize(const Context<double>& context,
+                 SerializationWriter* writer) const;
+
+  /// Restores @p context from the snapshot in the @p size bytes at @p data.
+  /// Input ports that were fixed in the snapshot are fixed again; the others
+  /// are left as they are.
+  void Deserialize(const void* data, size_t size,
+                   Context<double>* context) const;
+
+  /// Restores @p context from the snapshot read by @p reader; see
+  /// Deserialize().
+  void Deserialize(SerializationReader* reader,
+                   Context<double>* context) const;
+
+ private:
+  struct AbstractValueCodec {
+    std::function<std::unique_ptr<AbstractValue>()> create;
+    std::function<void(const AbstractValue&, SerializationWriter*)> serialize;
+    std::function<void(SerializationReader*, AbstractValue*)> deserialize;
+  };
+
+  const AbstractValueCodec& GetCodecOrThrow(const std::string& type) const;
+  void WriteAbstractValue(const AbstractValue& value,
+                          SerializationWriter* writer) const;
+  void ReadAbstractValue(SerializationReader* reader,
+                         AbstractValue* value) const;
+  std::unique_ptr<AbstractValue> ReadNewAbstractValue(
+      SerializationReader* reader) const;
+
+  std::map<std::string, AbstractValueCodec> codecs_;
+};
+
+#ifndef DRAKE_DOXYGEN_CXX
+template <>
+struct ValueSerializationTraits<int> {
+  static void Serialize(const int& value, SerializationWriter* writer) {
+    writer->WriteInt64(value);
+  }
+  static void Deserialize(SerializationReader* reader, int* value) {
+    *value = static_cast<int>(reader->ReadInt64());
+  }
+};
+
+template <>
+struct ValueSerializationTraits<bool> {
+  static void Serialize(const bool& value, SerializationWriter* writer) {
+    writer->WriteInt64(value ? 1 : 0);
+  }
+  static void Deserialize(SerializationReader* reader, bool* value) {
+    *value = (reader->ReadInt64() != 0);
+  }
+};
+
+template <>
+struct ValueSerializationTraits<double> {
+  static void Serialize(const double& value, SerializationWriter* writer) {
+    writer->WriteDouble(value);
+  }
+  static void Deserialize(SerializationReader* reader, double* value) {
+    *value = reader->ReadDouble();
+  }
+};
+
+template <>
+struct ValueSerializationTraits<std::string> {
+  static void Serialize(const std::string& value,
+                        SerializationWriter* writer) {
+    writer->WriteString(value);
+  }
+  static void Deserialize(SerializationReader* reader, std::string* value) {
+    *value = reader->ReadString();
+  }
+};
+#endif  // DRAKE_DOXYGEN_CXX
+
+}  // namespace systems
+}  // namespace drake
@@ -8,16 +8,20 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/number_traits.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
+#include "drake/systems/framework/diagram_profile.h"
 #include "drake/systems/framework/discrete_values.h"
 #include "drake/systems/framework/event.h"
 #include "drake/systems/framework/state.h"
@@ -64,6 +68,7 @@ class DiagramOutputPort : public OutputPort<T> {
                     const OutputPort<T>* source_output_port)
       : OutputPort<T>(diagram, source_output_port->get_data_type(),
                       source_output_port->size()),
+        diagram_(diagram),
         source_output_port_(source_output_port),
         subsystem_index_(
             diagram.GetSystemIndexOrAbort(&source_output_port->get_system())) {}
@@ -89,6 +94,9 @@ class DiagramOutputPort : public OutputPort<T> {
   void DoCalc(
       const Context<T>& context, AbstractValue* value) const final {
     const Context<T>& subcontext = get_subcontext(context);
+    DiagramProfile::Scope scope(diagram_.profile_.get(),
+                                source_output_port_->get_system().get_name(),
+                                DiagramProfile::Category::kOutput);
     return source_output_port_->Calc(subcontext, value);
   }
 
@@ -105,6 +113,7 @@ class DiagramOutputPort : public OutputPort<T> {
     return diagram_context->GetSubsystemContext(subsystem_index_);
   }
 
+  const Diagram<T>& diagram_;
   const OutputPort<T>* const source_output_port_;
   const SubsystemIndex subsystem_index_;
 };
@@ -254,6 +263,63 @@ class Diagram : public System<T>,
     return result;
   }
 
+  /// Enables or disables timing of the computations performed by each
+  /// subsystem, which are accumulated into a DiagramProfile. Subsystems that
+  /// are themselves Diagrams share the profile of this Diagram, so that their
+  /// calls nest within the calls made to them. Disabling profiling discards
+  /// the accumulated timings.
+  void set_profiling_enabled(bool enabled) {
+    if (enabled == get_profiling_enabled()) return;
+    SetProfile(enabled ? std::make_shared<DiagramProfile>() : nullptr);
+  }
+
+  /// Returns whether profiling is enabled.
+  bool get_profiling_enabled() const { return profile_ != nullptr; }
+
+  /// Returns the profile accumulated while profiling has been enabled, or
+  /// nullptr if it is disabled.
+  const DiagramProfile* get_profile() const { return profile_.get(); }
+
+  /// Returns the mutable profile (e.g., to clear it), or nullptr if
+  /// profiling is disabled.
+  DiagramProfile* get_mutable_profile() { return profile_.get(); }
+
+  /// Sets the maximum number of threads used to evaluate the subsystems of
+  /// this Diagram when computing its time derivatives. The default is 1,
+  /// which evaluates every subsystem in turn on the calling thread.
+  ///
+  /// With more than one thread, the subsystem output ports that feed other
+  /// subsystems are first evaluated level by level: a port belongs to the
+  /// lowest level above those of every port it depends on through a
+  /// direct-feedthrough input, so the ports of one level are independent and
+  /// are evaluated concurrently. The subsystem inputs are then frozen at these
+  /// values, and the time derivatives of all subsystems are evaluated
+  /// concurrently. Subsystems that are Diagrams are evaluated as a whole,
+  /// using their own number of evaluation threads.
+  ///
+  /// Each subsystem is only ever evaluated by one thread at a time, in its own
+  /// subcontext, so every subsystem that obeys the
+  /// @ref system_thread_safety "thread safety" rules of System may be
+  /// evaluated in parallel. While profiling is enabled the subsystems are
+  /// evaluated serially, because a DiagramProfile is not thread-safe.
+  ///
+  /// @throws std::logic_error if @p num_threads is not positive.
+  void set_num_evaluation_threads(int num_threads) {
+    if (num_threads < 1) {
+      throw std::logic_error(
+          "Diagram::set_num_evaluation_threads(): num_threads must be "
+          "positive.");
+    }
+    num_evaluation_threads_ = num_threads;
+    if (num_threads > 1 && evaluation_levels_.empty()) {
+      ComputeEvaluationLevels();
+    }
+  }
+
+  /// Returns the maximum number of threads used to evaluate the subsystems of
+  /// this Diagram; see set_num_evaluation_threads().
+  int get_num_evaluation_threads() const { return num_evaluation_threads_; }
+
   std::multimap<int, int> GetDirectFeedthroughs() const final {
     std::multimap<int, int> pairs;
     for (InputPortIndex u(0); u < this->get_num_input_ports(); ++u) {
@@ -501,6 +567,7 @@ class Diagram : public System<T>,
 
   void DoCalcTimeDerivatives(const Context<T>& context,
                              ContinuousState<T>* derivatives) const override {
+    DRAKE_TRACE_SCOPE("Diagram::CalcTimeDerivatives");
     auto diagram_context = dynamic_cast<const DiagramContext<T>*>(&context);
     DRAKE_DEMAND(diagram_context != nullptr);
 
@@ -510,11 +577,27 @@ class Diagram : public System<T>,
     const int n = diagram_derivatives->get_num_substates();
     DRAKE_DEMAND(num_subsystems() == n);
 
+    if (evaluates_in_parallel()) {
+      // Evaluate the subsystem outputs once, then the derivatives of every
+      // subsystem concurrently against those frozen values.
+      FrozenSubsystemInputs frozen(*this, *diagram_context);
+      ParallelFor(n, num_evaluation_threads_, [&](int index) {
+        const SubsystemIndex i(index);
+        registered_systems_[i]->CalcTimeDerivatives(
+            diagram_context->GetSubsystemContext(i),
+            &diagram_derivatives->get_mutable_substate(i));
+      });
+      return;
+    }
+
     // Evaluate the derivatives of each constituent system.
     for (SubsystemIndex i(0); i < n; ++i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       ContinuousState<T>& subderivatives =
           diagram_derivatives->get_mutable_substate(i);
+      DiagramProfile::Scope scope(profile_.get(),
+                                  registered_systems_[i]->get_name(),
+                                  DiagramProfile::Category::kTimeDerivatives);
       registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
     }
   }
@@ -731,6 +814,8 @@ class Diagram : public System<T>,
     DRAKE_DEMAND(context != nullptr);
     auto diagram_context = dynamic_cast<const DiagramContext<T>*>(context);
     DRAKE_DEMAND(diagram_context != nullptr);
+    // The values of all upstream output ports have already been evaluated.
+    if (diagram_context->get_subsystem_inputs_frozen()) return;
     const InputPortLocator id{descriptor.get_system(), descriptor.get_index()};
 
     // Find if this input port is exported.
@@ -796,9 +881,31 @@ class Diagram : public System<T>,
                        const WitnessFunction<T>& witness_func) const final {
     const System<T>& system = witness_func.get_system();
     const Context<T>& subcontext = GetSubsystemContext(system, context);
+    DiagramProfile::Scope scope(profile_.get(), system.get_name(),
+                                DiagramProfile::Category::kWitness);
     return witness_func.CalcWitnessValue(subcontext);
   }
 
+  /// Evaluates @p witnesses in runs of the same subsystem, which is how
+  /// DoGetWitnessFunctions() orders them, looking up the subcontext once per
+  /// run. Aborts if a subsystem is not part of this Diagram.
+  void DoCalcWitnessValues(
+      const Context<T>& context,
+      const std::vector<const WitnessFunction<T>*>& witnesses,
+      VectorX<T>* values) const final {
+    size_t i = 0;
+    while (i < witnesses.size()) {
+      const System<T>& system = witnesses[i]->get_system();
+      const Context<T>& subcontext = GetSubsystemContext(system, context);
+      DiagramProfile::Scope scope(profile_.get(), system.get_name(),
+                                  DiagramProfile::Category::kWitness);
+      for (; i < witnesses.size() && &witnesses[i]->get_system() == &system;
+           ++i) {
+        (*values)[i] = witnesses[i]->CalcWitnessValue(subcontext);
+      }
+    }
+  }
+
   /// For the subsystem associated with `witness_func`, gets its mutable
   /// sub composite event collection from `events`, and passes it to
   /// `witness_func`'s AddEventToCollection method. This method also modifies
@@ -1164,6 +1271,9 @@ class Diagram : public System<T>,
 
       if (subinfo.HasEvents()) {
         const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+        DiagramProfile::Scope scope(profile_.get(),
+                                    registered_systems_[i]->get_name(),
+                                    DiagramProfile::Category::kPublish);
         registered_systems_[i]->Publish(subcontext, subinfo);
       }
     }
@@ -1205,6 +1315,9 @@ class Diagram : public System<T>,
             diagram_discrete->get_mutable_subdiscrete(i);
         DRAKE_DEMAND(subdiscrete != nullptr);
 
+        DiagramProfile::Scope scope(profile_.get(),
+                                    registered_systems_[i]->get_name(),
+                                    DiagramProfile::Category::kDiscreteUpdate);
         registered_systems_[i]->CalcDiscreteVariableUpdates(subcontext, subinfo,
                                                             subdiscrete);
       }
@@ -1238,6 +1351,9 @@ class Diagram : public System<T>,
         const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
         State<T>& substate = diagram_state->get_mutable_substate(i);
 
+        DiagramProfile::Scope scope(
+            profile_.get(), registered_systems_[i]->get_name(),
+            DiagramProfile::Category::kUnrestrictedUpdate);
         registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subinfo,
             &substate);
       }
@@ -1385,27 +1501,26 @@ class Diagram : public System<T>,
 
     *time = std::numeric_limits<T1>::infinity();
 
-    // Iterate over the subsystems, and harvest the most imminent updates.
-    std::vector<T1> times(num_subsystems());
+    // Iterate over the subsystems, and harvest the most imminent updates. The
+    // event collections of the subsystems whose next update time is bigger
+    // than *time are cleared as soon as that is known, so that no temporary
+    // storage is needed.
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
       const Context<T1>& subcontext = diagram_context->GetSubsystemContext(i);
       CompositeEventCollection<T1>& subinfo =
           info->get_mutable_subevent_collection(i);
       const T1 sub_time =
           registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-      times[i] = sub_time;
 
       if (sub_time < *time) {
+        // All the subsystems considered so far update later.
+        for (SubsystemIndex j(0); j < i; ++j)
+          info->get_mutable_subevent_collection(j).Clear();
         *time = sub_time;
+      } else if (sub_time > *time) {
+        subinfo.Clear();
       }
     }
-
-    // For all the subsystems whose next update time is bigger than *time,
-    // clear their event collections.
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-      if (times[i] > *time)
-        info->get_mutable_subevent_collection(i).Clear();
-    }
   }
 
   std::map<PeriodicEventData, std::vector<const Event<T>*>,
@@ -1496,6 +1611,7 @@ class Diagram : public System<T>,
 
     // Generate a map from the System pointer to its index in the registered
     // order.
+    system_index_map_.reserve(num_subsystems());
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
       system_index_map_[registered_systems_[i].get()] = i;
       registered_systems_[i]->set_parent(this);
@@ -1596,9 +1712,130 @@ class Diagram : public System<T>,
     const Context<T>& subsystem_context = context.GetSubsystemContext(i);
     SystemOutput<T>* subsystem_output = context.GetSubsystemOutput(i);
     AbstractValue* port_output = subsystem_output->GetMutableData(port_index);
+    DiagramProfile::Scope scope(profile_.get(), system->get_name(),
+                                DiagramProfile::Category::kOutput);
     port.Calc(subsystem_context, port_output);
   }
 
+  // The output ports of one subsystem that belong to the same evaluation
+  // level; see set_num_evaluation_threads().
+  struct EvaluationTask {
+    SubsystemIndex subsystem;
+    std::vector<OutputPortIndex> ports;
+  };
+
+  // Whether the subsystems are to be evaluated concurrently.
+  bool evaluates_in_parallel() const {
+    return num_evaluation_threads_ > 1 && profile_ == nullptr;
+  }
+
+  // Groups the subsystem output ports that are connected to subsystem inputs
+  // into evaluation_levels_. The level of a port is one more than the highest
+  // level of the upstream ports feeding the inputs on which it has a direct
+  // feedthrough, or zero if there are none. DiagramBuilder has already
+  // rejected algebraic loops, so the recursion terminates.
+  void ComputeEvaluationLevels() {
+    std::vector<std::multimap<int, int>> feedthroughs;
+    feedthroughs.reserve(registered_systems_.size());
+    for (const auto& system : registered_systems_) {
+      feedthroughs.push_back(system->GetDirectFeedthroughs());
+    }
+
+    std::map<OutputPortLocator, int> levels;
+    std::function<int(const OutputPortLocator&)> level_of =
+        [&](const OutputPortLocator& id) {
+          const auto known = levels.find(id);
+          if (known != levels.end()) return known->second;
+          int level = 0;
+          const System<T>* const system = id.first;
+          const SubsystemIndex i = GetSystemIndexOrAbort(system);
+          for (const auto& pair : feedthroughs[i]) {
+            if (pair.second != id.second) continue;
+            const auto upstream =
+                connection_map_.find(InputPortLocator{system, pair.first});
+            if (upstream == connection_map_.end()) continue;
+            level = std::max(level, level_of(upstream->second) + 1);
+          }
+          levels[id] = level;
+          return level;
+        };
+    for (const auto& connection : connection_map_) {
+      level_of(connection.second);
+    }
+
+    // Within a level, gather the ports of each subsystem into a single task
+    // so that no subsystem is ever evaluated by two threads at once.
+    evaluation_levels_.clear();
+    for (const auto& entry : levels) {
+      const int level = entry.second;
+      if (level >= static_cast<int>(evaluation_levels_.size())) {
+        evaluation_levels_.resize(level + 1);
+      }
+      const SubsystemIndex i = GetSystemIndexOrAbort(entry.first.first);
+      std::vector<EvaluationTask>& tasks = evaluation_levels_[level];
+      // The ports of a subsystem are adjacent in `levels`, so only the last
+      // task of the level can be the one of subsystem i.
+      if (tasks.empty() || tasks.back().subsystem != i) {
+        tasks.push_back(EvaluationTask{i, {}});
+      }
+      tasks.back().ports.push_back(OutputPortIndex(entry.first.second));
+    }
+  }
+
+  // Evaluates every subsystem output port that is connected to a subsystem
+  // input, concurrently within each evaluation level, and freezes the
+  // subsystem inputs of the context at these values for the lifetime of this
+  // object. The inputs of this Diagram are evaluated first, so that frozen
+  // subsystem inputs never need to consult the enclosing Diagram.
+  class FrozenSubsystemInputs {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FrozenSubsystemInputs)
+
+    FrozenSubsystemInputs(const Diagram<T>& diagram,
+                          const DiagramContext<T>& context)
+        : context_(context),
+          was_frozen_(context.get_subsystem_inputs_frozen()) {
+      if (was_frozen_) return;
+      for (int i = 0; i < diagram.get_num_input_ports(); ++i) {
+        diagram.EvalInputPort(context, i);
+      }
+      context.set_subsystem_inputs_frozen(true);
+      try {
+        for (const auto& tasks : diagram.evaluation_levels_) {
+          ParallelFor(static_cast<int>(tasks.size()),
+                      diagram.num_evaluation_threads_, [&](int t) {
+            const EvaluationTask& task = tasks[t];
+            const System<T>* const system =
+                diagram.registered_systems_[task.subsystem].get();
+            for (const OutputPortIndex port : task.ports) {
+              diagram.EvaluateOutputPort(context, {system, port});
+            }
+          });
+        }
+      } catch (...) {
+        context.set_subsystem_inputs_frozen(false);
+        throw;
+      }
+    }
+
+    ~FrozenSubsystemInputs() {
+      context_.set_subsystem_inputs_frozen(was_frozen_);
+    }
+
+   private:
+    const DiagramContext<T>& context_;
+    const bool was_frozen_;
+  };
+
+  // Sets the profile of this Diagram and of all subsystems that are Diagrams.
+  void SetProfile(std::shared_ptr<DiagramProfile> profile) {
+    profile_ = profile;
+    for (const auto& system : registered_systems_) {
+      auto subdiagram = dynamic_cast<Diagram<T>*>(system.get());
+      if (subdiagram) subdiagram->SetProfile(profile);
+    }
+  }
+
   // Converts an InputPortLocator to a DiagramContext::InputPortIdentifier.
   // The DiagramContext::InputPortIdentifier contains the index of the System in
   // the diagram, instead of an actual pointer to the System.
@@ -1698,17 +1935,33 @@ class Diagram : public System<T>,
   std::vector<std::unique_ptr<System<T>>> registered_systems_;
 
   // Map to quickly satisify "What is the subsytem index of the child system?"
-  std::map<const System<T>*, SubsystemIndex> system_index_map_;
+  // It is consulted for every connection when allocating a Context, so it is
+  // hashed rather than ordered.
+  std::unordered_map<const System<T>*, SubsystemIndex> system_index_map_;
 
   // The ordered inputs and outputs of this Diagram. Index by InputPortIndex
   // and OutputPortIndex.
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // The timings of subsystem computations, or nullptr if profiling is
+  // disabled. Shared with the subsystems that are Diagrams.
+  std::shared_ptr<DiagramProfile> profile_;
+
+  // The maximum number of threads used to evaluate the subsystems.
+  int num_evaluation_threads_{1};
+
+  // The connected subsystem output ports, grouped by evaluation level and
+  // then by subsystem. Computed when parallel evaluation is first enabled.
+  std::vector<std::vector<EvaluationTask>> evaluation_levels_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
 
+  // The exported output ports time their computations in profile_.
+  friend class internal::DiagramOutputPort<T>;
+
   // For any T1 & T2, Diagram<T1> considers Diagram<T2> a friend, so that
   // Diagram can provide transmogrification methods across scalar types.
   // See Diagram<T>::ConvertScalarType.
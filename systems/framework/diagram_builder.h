@@ -6,6 +6,7 @@
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -203,7 +204,8 @@ class DiagramBuilder {
   using OutputPortLocator = typename Diagram<T>::OutputPortLocator;
 
   // This generic port identifier is used only for cycle detection below
-  // because the algorithm treats both input & output ports as nodes.
+  // because the algorithm treats both input & output ports as nodes. Output
+  // port i is encoded as -(i + 1), to be distinguished from input port i.
   using PortIdentifier = std::pair<const System<T>*, int>;
 
   // Throws if the given input port (belonging to a child subsystem) has
@@ -220,128 +222,146 @@ class DiagramBuilder {
     DRAKE_THROW_UNLESS(systems_.find(system) != systems_.end());
   }
 
-  // Helper method to do the algebraic loop test. It recursively performs the
-  // depth-first search on the graph to find cycles.
-  static bool HasCycleRecurse(
-      const PortIdentifier& n,
-      const std::map<PortIdentifier, std::set<PortIdentifier>>& edges,
-      std::set<PortIdentifier>* visited,
-      std::vector<PortIdentifier>* stack) {
-    DRAKE_ASSERT(visited->count(n) == 0);
-    visited->insert(n);
-
-    auto edge_iter = edges.find(n);
-    if (edge_iter != edges.end()) {
-      DRAKE_ASSERT(std::find(stack->begin(), stack->end(), n) == stack->end());
-      stack->push_back(n);
-      for (const auto& target : edge_iter->second) {
-        if (visited->count(target) == 0 &&
-            HasCycleRecurse(target, edges, visited, stack)) {
-          return true;
-        } else if (std::find(stack->begin(), stack->end(), target) !=
-                   stack->end()) {
-          return true;
-        }
-      }
-      stack->pop_back();
-    }
-    return false;
-  }
-
   // Evaluates the graph of port dependencies -- including *connections* between
   // output ports and input ports and direct feedthrough connections between
   // input ports and output ports. If an algebraic loop is detected, throws
-  // a std::logic_error.
+  // a std::runtime_error.
+  //
+  // O(P + E) in the number P of ports of the subsystems and the number E of
+  // connections and direct feedthroughs, so that diagrams with tens of
+  // thousands of subsystems are still checked quickly.
   void ThrowIfAlgebraicLoopsExist() const {
     // Each port in the diagram is a node in a graph.
     // An edge exists from node u to node v if:
     //  1. output u is connected to input v (via Connect(u, v) method), or
     //  2. a direct feedthrough from input u to output v is reported.
-    // A depth-first search of the graph should produce a forest of valid trees
-    // if there are no algebraic loops. Otherwise, at least one link moving
-    // *up* the tree will exist.
-
-    // Build the graph.
-    // Generally, the nodes of the graph would be the set of all defined ports
-    // (input and output) of each subsystem. However, we only need to
-    // consider the input/output ports that have a diagram level output-to-input
-    // connection (ports that are not connected in this manner cannot contribute
-    // to an algebraic loop).
-
-    // Track *all* of the nodes involved in a diagram-level connection as
-    // described above.
-    std::set<PortIdentifier> nodes;
-    // A map from node u, to the set of edges { (u, v_i) }. In normal cases,
-    // not every node in `nodes` will serve as a key in `edges` (as that is a
-    // necessary condition for there to be no algebraic loop).
-    std::map<PortIdentifier, std::set<PortIdentifier>> edges;
-
-    // In order to store PortIdentifiers for both input and output ports in the
-    // same set, I need to encode the ports. The identifier for the first input
-    // port and output port look identical (same system pointer, same port
-    // id 0). So, to distinguish them, I'll modify the output ports to use the
-    // negative half of the int space. The function below provides a utility for
-    // encoding an output port id.
-    auto output_to_key = [](int port_id) { return -(port_id + 1); };
-
-    // Populate the node set from the connections (and define the edges implied
-    // by those connections).
+    // A depth-first search of the graph reaches a node that is still on the
+    // search stack if and only if there is an algebraic loop.
+
+    // Number the ports densely: the nodes of the output ports of a system are
+    // followed by those of its input ports, and the systems follow each other
+    // in the order in which they were registered.
+    std::unordered_map<const System<T>*, int> first_node;
+    first_node.reserve(registered_systems_.size());
+    std::vector<PortIdentifier> ports;
+    for (const auto& system : registered_systems_) {
+      first_node[system.get()] = static_cast<int>(ports.size());
+      for (int i = 0; i < system->get_num_output_ports(); ++i) {
+        ports.emplace_back(system.get(), -(i + 1));
+      }
+      for (int i = 0; i < system->get_num_input_ports(); ++i) {
+        ports.emplace_back(system.get(), i);
+      }
+    }
+    auto output_node = [&first_node](const System<T>* system, int index) {
+      return first_node.at(system) + index;
+    };
+    auto input_node = [&first_node](const System<T>* system, int index) {
+      return first_node.at(system) + system->get_num_output_ports() + index;
+    };
+    const int num_nodes = static_cast<int>(ports.size());
+
+    // Collect the edges implied by the connections. Only the ports that have
+    // a diagram-level connection can contribute to an algebraic loop.
+    std::vector<std::pair<int, int>> edges;
+    std::vector<bool> connected(num_nodes, false);
     for (const auto& connection : connection_map_) {
-      // Dependency graph is a mapping from the destination of the connection
-      // to what it *depends on* (the source).
-      const PortIdentifier src(connection.second.first,
-                               connection.second.second);
-      const PortIdentifier dest(connection.first.first,
-                                connection.first.second);
-      PortIdentifier encoded_src{src.first, output_to_key(src.second)};
-      nodes.insert(encoded_src);
-      nodes.insert(dest);
-      edges[encoded_src].insert(dest);
+      const int src = output_node(connection.second.first,
+                                  connection.second.second);
+      const int dest = input_node(connection.first.first,
+                                  connection.first.second);
+      connected[src] = true;
+      connected[dest] = true;
+      edges.emplace_back(src, dest);
     }
 
-    // Populate more edges based on direct feedthrough.
+    // Add more edges based on direct feedthrough, only on port pairs where
+    // *both* ports are connected to other ports at the diagram level.
     for (const auto& system : registered_systems_) {
       for (const auto& pair : system->GetDirectFeedthroughs()) {
-        PortIdentifier src_port{system.get(), pair.first};
-        PortIdentifier dest_port{system.get(), output_to_key(pair.second)};
-        if (nodes.count(src_port) > 0 && nodes.count(dest_port) > 0) {
-          // Track direct feedthrough only on port pairs where *both* ports are
-          // connected to other ports at the diagram level.
-          edges[src_port].insert(dest_port);
+        const int src = input_node(system.get(), pair.first);
+        const int dest = output_node(system.get(), pair.second);
+        if (connected[src] && connected[dest]) {
+          edges.emplace_back(src, dest);
         }
       }
     }
 
-    // Evaluate the graph for cycles.
-    std::set<PortIdentifier> visited;
-    std::vector<PortIdentifier> stack;
-    for (const auto& node : nodes) {
-      if (visited.count(node) == 0) {
-        if (HasCycleRecurse(node, edges, &visited, &stack)) {
-          std::stringstream ss;
-
-          auto port_to_stream = [&ss](const auto& id) {
-            ss << "  " << id.first->get_name() << ":";
-            if (id.second < 0)
-              ss << "Out(";
-            else
-              ss << "In(";
-            ss << (id.second >= 0 ? id.second : -id.second - 1) << ")";
-          };
-
-          ss << "Algebraic loop detected in DiagramBuilder:\n";
-          for (size_t i = 0; i < stack.size() - 1; ++i) {
-            port_to_stream(stack[i]);
-            ss << " depends on\n";
-          }
-          port_to_stream(stack.back());
-
-          throw std::runtime_error(ss.str());
+    // Store the adjacency lists contiguously: the targets of the edges from
+    // node u are targets[offsets[u]] to targets[offsets[u + 1] - 1].
+    std::vector<int> offsets(num_nodes + 1, 0);
+    for (const auto& edge : edges) {
+      ++offsets[edge.first + 1];
+    }
+    for (int u = 0; u < num_nodes; ++u) {
+      offsets[u + 1] += offsets[u];
+    }
+    std::vector<int> targets(edges.size());
+    {
+      std::vector<int> next(offsets.begin(), offsets.end() - 1);
+      for (const auto& edge : edges) {
+        targets[next[edge.first]++] = edge.second;
+      }
+    }
+
+    // Evaluate the graph for cycles with an iterative depth-first search, so
+    // that long chains of systems cannot overflow the call stack. Each entry
+    // of `stack` is a node and the position of the next edge to follow.
+    enum : char { kUnvisited, kOnStack, kDone };
+    std::vector<char> state(num_nodes, kUnvisited);
+    std::vector<std::pair<int, int>> stack;
+    for (int root = 0; root < num_nodes; ++root) {
+      if (!connected[root] || state[root] != kUnvisited) continue;
+      state[root] = kOnStack;
+      stack.emplace_back(root, offsets[root]);
+      while (!stack.empty()) {
+        const int u = stack.back().first;
+        int& edge = stack.back().second;
+        if (edge == offsets[u + 1]) {
+          state[u] = kDone;
+          stack.pop_back();
+          continue;
+        }
+        const int v = targets[edge++];
+        if (state[v] == kUnvisited) {
+          state[v] = kOnStack;
+          stack.emplace_back(v, offsets[v]);
+        } else if (state[v] == kOnStack) {
+          ThrowAlgebraicLoop(ports, stack, v);
         }
       }
     }
   }
 
+  // Throws the error for the algebraic loop formed by the nodes of @p stack
+  // from node @p first_node to the top, where @p ports is the port of each
+  // node, as found by ThrowIfAlgebraicLoopsExist().
+  [[noreturn]] static void ThrowAlgebraicLoop(
+      const std::vector<PortIdentifier>& ports,
+      const std::vector<std::pair<int, int>>& stack, int first_node) {
+    std::stringstream ss;
+
+    auto port_to_stream = [&ss](const PortIdentifier& id) {
+      ss << "  " << id.first->get_name() << ":";
+      if (id.second < 0)
+        ss << "Out(";
+      else
+        ss << "In(";
+      ss << (id.second >= 0 ? id.second : -id.second - 1) << ")";
+    };
+
+    ss << "Algebraic loop detected in DiagramBuilder:\n";
+    size_t i = 0;
+    while (stack[i].first != first_node) ++i;
+    for (; i < stack.size() - 1; ++i) {
+      port_to_stream(ports[stack[i].first]);
+      ss << " depends on\n";
+    }
+    port_to_stream(ports[stack.back().first]);
+
+    throw std::runtime_error(ss.str());
+  }
+
   // TODO(russt): Implement AddRandomSources method to wire up all dangling
   // random input ports with a compatible RandomSource system.
 
@@ -383,6 +403,7 @@ class DiagramBuilder {
   std::vector<std::unique_ptr<System<T>>> registered_systems_;
 
   friend int AddRandomInputs(double, systems::DiagramBuilder<double>*);
+  friend int FuseLinearPrimitives(systems::DiagramBuilder<double>*);
 };
 
 }  // namespace systems
@@ -243,6 +243,26 @@ class DiagramContext : public Context<T> {
     return outputs_[index].get();
   }
 
+  /// Returns whether the subsystem inputs of this context are frozen, i.e.,
+  /// whether the values of the subsystem outputs they are connected to, and
+  /// of the Diagram's own inputs, have already been evaluated and must not be
+  /// recomputed when a subsystem evaluates its inputs. A Diagram freezes the
+  /// inputs while it evaluates its subsystems concurrently (see
+  /// Diagram::set_num_evaluation_threads()).
+  ///
+  /// This is a framework implementation detail. User code should not call
+  /// this function.
+  bool get_subsystem_inputs_frozen() const { return subsystem_inputs_frozen_; }
+
+  /// Sets whether the subsystem inputs of this context are frozen; see
+  /// get_subsystem_inputs_frozen().
+  ///
+  /// This is a framework implementation detail. User code should not call
+  /// this function.
+  void set_subsystem_inputs_frozen(bool frozen) const {
+    subsystem_inputs_frozen_ = frozen;
+  }
+
   /// Returns the context structure for a given constituent system @p index.
   /// Aborts if @p index is out of bounds, or if no system has been added to the
   /// DiagramContext at that index.
@@ -298,6 +318,47 @@ class DiagramContext : public Context<T> {
  protected:
   /// The caller owns the returned memory.
   DiagramContext<T>* DoClone() const override {
+    return DoCloneImpl(false /* copy_on_write */);
+  }
+
+  /// The caller owns the returned memory.
+  DiagramContext<T>* DoCloneCopyOnWrite() const override {
+    return DoCloneImpl(true /* copy_on_write */);
+  }
+
+  /// The caller owns the returned memory.
+  State<T>* DoCloneState() const override {
+    DiagramState<T>* clone = new DiagramState<T>(num_subcontexts());
+
+    for (SubsystemIndex i(0); i < num_subcontexts(); i++) {
+      Context<T>* context = contexts_[i].get();
+      clone->set_and_own_substate(i, context->CloneState());
+    }
+
+    clone->Finalize();
+    return clone;
+  }
+
+  /// Returns the input port at the given @p index, which of course belongs
+  /// to the subsystem whose input was exposed at that index.
+  const InputPortValue* GetInputPortValue(int index) const override {
+    DRAKE_ASSERT(index >= 0 && index < get_num_input_ports());
+    const InputPortIdentifier& id = input_ids_[index];
+    const SubsystemIndex system_index = id.first;
+    const InputPortIndex port_index = id.second;
+    return Context<T>::GetInputPortValue(GetSubsystemContext(system_index),
+                                         port_index);
+  }
+
+ private:
+  int num_subcontexts() const {
+    DRAKE_ASSERT(contexts_.size() == outputs_.size());
+    return static_cast<int>(contexts_.size());
+  }
+
+  // Makes a clone of this context, whose subcontexts are made with
+  // Context::CloneCopyOnWrite() if @p copy_on_write is true.
+  DiagramContext<T>* DoCloneImpl(bool copy_on_write) const {
     DRAKE_ASSERT(contexts_.size() == outputs_.size());
     DiagramContext<T>* clone = new DiagramContext(num_subcontexts());
 
@@ -307,7 +368,10 @@ class DiagramContext : public Context<T> {
       DRAKE_DEMAND(outputs_[i] != nullptr);
       // When a leaf context is cloned, it will clone the data that currently
       // appears on each of its input ports into a FreestandingInputPortValue.
-      clone->AddSystem(i, contexts_[i]->Clone(), outputs_[i]->Clone());
+      clone->AddSystem(i,
+                       copy_on_write ? contexts_[i]->CloneCopyOnWrite()
+                                     : contexts_[i]->Clone(),
+                       outputs_[i]->Clone());
     }
 
     // Build a superstate over the subsystem contexts.
@@ -338,36 +402,6 @@ class DiagramContext : public Context<T> {
     return clone;
   }
 
-  /// The caller owns the returned memory.
-  State<T>* DoCloneState() const override {
-    DiagramState<T>* clone = new DiagramState<T>(num_subcontexts());
-
-    for (SubsystemIndex i(0); i < num_subcontexts(); i++) {
-      Context<T>* context = contexts_[i].get();
-      clone->set_and_own_substate(i, context->CloneState());
-    }
-
-    clone->Finalize();
-    return clone;
-  }
-
-  /// Returns the input port at the given @p index, which of course belongs
-  /// to the subsystem whose input was exposed at that index.
-  const InputPortValue* GetInputPortValue(int index) const override {
-    DRAKE_ASSERT(index >= 0 && index < get_num_input_ports());
-    const InputPortIdentifier& id = input_ids_[index];
-    const SubsystemIndex system_index = id.first;
-    const InputPortIndex port_index = id.second;
-    return Context<T>::GetInputPortValue(GetSubsystemContext(system_index),
-                                         port_index);
-  }
-
- private:
-  int num_subcontexts() const {
-    DRAKE_ASSERT(contexts_.size() == outputs_.size());
-    return static_cast<int>(contexts_.size());
-  }
-
   void SetInputPortValue(int index,
                          std::unique_ptr<InputPortValue> port) final {
     DRAKE_DEMAND(index >= 0 && index < get_num_input_ports());
@@ -396,6 +430,9 @@ class DiagramContext : public Context<T> {
 
   // The parameters of the Diagram, which includes all subsystem parameters.
   std::unique_ptr<Parameters<T>> parameters_;
+
+  // Whether the subsystem inputs are frozen; not copied by clones.
+  mutable bool subsystem_inputs_frozen_{false};
 };
 
 }  // namespace systems
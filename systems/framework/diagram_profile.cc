@@ -0,0 +1,91 @@
+#include "drake/systems/framework/diagram_profile.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+
+const char* DiagramProfile::GetCategoryName(Category category) {
+  switch (category) {
+    case Category::kTimeDerivatives: return "time_derivatives";
+    case Category::kOutput: return "output";
+    case Category::kDiscreteUpdate: return "discrete_update";
+    case Category::kUnrestrictedUpdate: return "unrestricted_update";
+    case Category::kPublish: return "publish";
+    case Category::kWitness: return "witness";
+  }
+  DRAKE_ABORT();
+}
+
+void DiagramProfile::Begin(const std::string& system_name,
+                           Category category) {
+  auto entry = entries_.emplace(std::make_pair(system_name, category),
+                                Entry{}).first;
+  entry->second.system_name = system_name;
+  entry->second.category = category;
+
+  ActiveCall call;
+  call.entry = entry;
+  if (!active_calls_.empty()) call.stack = active_calls_.back().stack + ";";
+  call.stack += system_name + ":" + GetCategoryName(category);
+  active_calls_.push_back(std::move(call));
+  // Start the clock last, so that the bookkeeping above is not attributed to
+  // the call.
+  active_calls_.back().start = Clock::now();
+}
+
+void DiagramProfile::End() {
+  DRAKE_DEMAND(!active_calls_.empty());
+  const ActiveCall& call = active_calls_.back();
+  const double elapsed =
+      std::chrono::duration<double>(Clock::now() - call.start).count();
+  const double self_time = std::max(elapsed - call.nested_time, 0.0);
+
+  Entry& entry = call.entry->second;
+  ++entry.num_calls;
+  entry.self_time += self_time;
+  stack_self_times_[call.stack] += self_time;
+
+  // Recursive calls to the same subsystem and category are only counted once
+  // in the total time.
+  bool is_recursive = false;
+  for (size_t i = 0; i + 1 < active_calls_.size(); ++i) {
+    if (active_calls_[i].entry == call.entry) is_recursive = true;
+  }
+  if (!is_recursive) entry.total_time += elapsed;
+
+  active_calls_.pop_back();
+  if (!active_calls_.empty()) active_calls_.back().nested_time += elapsed;
+}
+
+std::vector<DiagramProfile::Entry> DiagramProfile::GetEntries() const {
+  std::vector<Entry> result;
+  result.reserve(entries_.size());
+  for (const auto& item : entries_) {
+    if (item.second.num_calls > 0) result.push_back(item.second);
+  }
+  std::stable_sort(result.begin(), result.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.self_time > b.self_time;
+                   });
+  return result;
+}
+
+void DiagramProfile::Clear() {
+  DRAKE_DEMAND(active_calls_.empty());
+  entries_.clear();
+  stack_self_times_.clear();
+}
+
+void DiagramProfile::WriteFoldedStacks(std::ostream* out) const {
+  DRAKE_DEMAND(out != nullptr);
+  for (const auto& item : stack_self_times_) {
+    *out << item.first << " " << std::llround(item.second * 1e6) << "\n";
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
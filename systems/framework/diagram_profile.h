@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/// Accumulates the time spent in each subsystem of a Diagram whose profiling
+/// has been enabled (see Diagram::set_profiling_enabled()).
+///
+/// Each timed call is attributed to the name of the subsystem (see
+/// System::get_name()) and to the kind of computation performed. Since calls
+/// nest (e.g., computing the time derivatives of a subsystem evaluates the
+/// output ports of the subsystems feeding its inputs), both the *total* time
+/// of the calls and their *self* time, which excludes the time spent in
+/// nested timed calls, are recorded. The self times of each distinct stack of
+/// nested calls can be written in the "folded stacks" format consumed by
+/// flame graph tools (see WriteFoldedStacks()).
+///
+/// A %DiagramProfile is not thread-safe; a Diagram being profiled must not be
+/// evaluated concurrently from several threads.
+class DiagramProfile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DiagramProfile)
+
+  /// The kinds of computation that are timed.
+  enum class Category {
+    kTimeDerivatives,
+    kOutput,
+    kDiscreteUpdate,
+    kUnrestrictedUpdate,
+    kPublish,
+    kWitness,
+  };
+
+  /// The accumulated timings of the calls of one category made to one
+  /// subsystem. Times are in seconds.
+  struct Entry {
+    std::string system_name;
+    Category category{};
+    int64_t num_calls{0};
+    double total_time{0.0};
+    double self_time{0.0};
+  };
+
+  /// Times a single call for as long as it is in scope.
+  class Scope {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Scope)
+
+    /// Begins timing a call of the given `category` to the subsystem named
+    /// `system_name`, if `profile` is non-null.
+    Scope(DiagramProfile* profile, const std::string& system_name,
+          Category category)
+        : profile_(profile) {
+      if (profile_) profile_->Begin(system_name, category);
+    }
+
+    ~Scope() {
+      if (profile_) profile_->End();
+    }
+
+   private:
+    DiagramProfile* const profile_;
+  };
+
+  DiagramProfile() = default;
+
+  /// Returns the accumulated timings, one per subsystem and category that has
+  /// been called, in decreasing order of self time.
+  std::vector<Entry> GetEntries() const;
+
+  /// Discards all accumulated timings.
+  /// @pre No call is being timed.
+  void Clear();
+
+  /// Writes one line per distinct stack of nested calls, of the form
+  /// `frame;frame;...;frame value`, where each frame is `name:category` and
+  /// the value is the total self time of the innermost call in microseconds.
+  void WriteFoldedStacks(std::ostream* out) const;
+
+  /// Returns a human-readable name for @p category.
+  static const char* GetCategoryName(Category category);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // A call being timed, along with the time spent in the calls nested within
+  // it so far.
+  struct ActiveCall {
+    std::map<std::pair<std::string, Category>, Entry>::iterator entry;
+    std::string stack;
+    Clock::time_point start;
+    double nested_time{0.0};
+  };
+
+  void Begin(const std::string& system_name, Category category);
+  void End();
+
+  std::map<std::pair<std::string, Category>, Entry> entries_;
+  std::map<std::string, double> stack_self_times_;
+  std::vector<ActiveCall> active_calls_;
+};
+
+}  // namespace systems
+}  // namespace drake
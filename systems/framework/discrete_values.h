@@ -152,6 +152,18 @@ class DiscreteValues {
     return std::make_unique<DiscreteValues>(std::move(cloned_data));
   }
 
+  /// Returns a copy of this DiscreteValues that owns its vectors, made with
+  /// BasicVector::CloneCopyOnWrite(), so that their values are shared with
+  /// the vectors of this DiscreteValues until either is mutated.
+  std::unique_ptr<DiscreteValues> CloneCopyOnWrite() const {
+    std::vector<std::unique_ptr<BasicVector<T>>> cloned_data;
+    cloned_data.reserve(data_.size());
+    for (const BasicVector<T>* datum : data_) {
+      cloned_data.push_back(datum->CloneCopyOnWrite());
+    }
+    return std::make_unique<DiscreteValues>(std::move(cloned_data));
+  }
+
  private:
   // Pointers to the data comprising the values. If the data is owned, these
   // pointers are equal to the pointers in owned_data_.
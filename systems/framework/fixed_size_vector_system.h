@@ -0,0 +1,187 @@
+#pragma once
+
+#include <utility>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/unused.h"
+#include "drake/systems/framework/vector_system.h"
+
+namespace drake {
+namespace systems {
+
+/// A VectorSystem whose state, input and output sizes are known at compile
+/// time.  Subclasses implement their dynamics in terms of fixed-size %Eigen
+/// maps, so that the compiler can unroll and vectorize the arithmetic of small
+/// systems (pendulums, acrobots, quadrotors, ...) instead of going through the
+/// dynamically sized kernels that VectorX<T> requires.
+///
+/// The constructor declares the input port of size `NU` and the output port of
+/// size `NY`, when non-zero.  As with VectorSystem, subclasses may declare
+/// either continuous or discrete state, but not both; whichever they declare
+/// must have size `NX`.
+///
+/// The values still live in the Context's BasicVector storage; this class only
+/// changes the type through which subclasses see them.  Maps onto that storage
+/// are unaligned, which costs nothing for the sizes this class is meant for.
+///
+/// @tparam T The vector element type, which must be a valid Eigen scalar.
+/// @tparam NX The size of the state.
+/// @tparam NU The size of the sole input port, or zero for none.
+/// @tparam NY The size of the sole output port, or zero for none.
+template <typename T, int NX, int NU, int NY>
+class FixedSizeVectorSystem : public VectorSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FixedSizeVectorSystem)
+
+  static_assert(NX >= 0 && NU >= 0 && NY >= 0,
+                "FixedSizeVectorSystem sizes must be non-negative");
+
+  static constexpr int kNumStates = NX;
+  static constexpr int kNumInputs = NU;
+  static constexpr int kNumOutputs = NY;
+
+  using StateVector = Eigen::Matrix<T, NX, 1>;
+  using InputVector = Eigen::Matrix<T, NU, 1>;
+  using OutputVector = Eigen::Matrix<T, NY, 1>;
+
+  ~FixedSizeVectorSystem() override = default;
+
+ protected:
+  /// Creates a system with an input port of size `NU` and an output port of
+  /// size `NY`, when those are non-zero.  Does *not* declare scalar-type
+  /// conversion support; see the VectorSystem constructors for details.
+  FixedSizeVectorSystem()
+      : FixedSizeVectorSystem(SystemScalarConverter{}) {}
+
+  /// Creates a system with an input port of size `NU` and an output port of
+  /// size `NY`, when those are non-zero, with scalar-type conversion support
+  /// given by @p converter.  See the VectorSystem constructors for details.
+  explicit FixedSizeVectorSystem(SystemScalarConverter converter)
+      : VectorSystem<T>(std::move(converter), NU, NY) {}
+
+  /// Provides a convenience method for %FixedSizeVectorSystem subclasses.
+  /// This method performs the same logical operation as
+  /// VectorSystem::DoCalcVectorOutput but provides fixed-size maps to
+  /// represent the input, state, and output.  Subclasses with outputs should
+  /// override this method, and not the base class method (which is `final`).
+  ///
+  /// The @p input is all zeros when this System is declared to be
+  /// non-direct-feedthrough, since evaluating it could otherwise create a
+  /// computational loop.
+  ///
+  /// By default, this function does nothing if `NY` is zero, and throws an
+  /// exception otherwise.
+  virtual void DoCalcFixedSizeOutput(
+      const Context<T>& context,
+      const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<OutputVector>* output) const {
+    unused(context, input, state, output);
+    DRAKE_THROW_UNLESS(NY == 0);
+  }
+
+  /// Provides a convenience method for %FixedSizeVectorSystem subclasses.
+  /// This method performs the same logical operation as
+  /// VectorSystem::DoCalcVectorTimeDerivatives but provides fixed-size maps to
+  /// represent the input, continuous state, and derivatives.  Subclasses with
+  /// continuous state should override this method, and not the base class
+  /// method (which is `final`).
+  ///
+  /// By default, this function does nothing if `NX` is zero, and throws an
+  /// exception otherwise.
+  virtual void DoCalcFixedSizeTimeDerivatives(
+      const Context<T>& context,
+      const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<StateVector>* derivatives) const {
+    unused(context, input, state, derivatives);
+    DRAKE_THROW_UNLESS(NX == 0);
+  }
+
+  /// Provides a convenience method for %FixedSizeVectorSystem subclasses.
+  /// This method performs the same logical operation as
+  /// VectorSystem::DoCalcVectorDiscreteVariableUpdates but provides fixed-size
+  /// maps to represent the input, discrete state, and discrete updates.
+  /// Subclasses with discrete state should override this method, and not the
+  /// base class method (which is `final`).
+  ///
+  /// By default, this function does nothing if `NX` is zero, and throws an
+  /// exception otherwise.
+  virtual void DoCalcFixedSizeDiscreteVariableUpdates(
+      const Context<T>& context,
+      const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<StateVector>* next_state) const {
+    unused(context, input, state, next_state);
+    DRAKE_THROW_UNLESS(NX == 0);
+  }
+
+ private:
+  // Maps @p input, or zeros when VectorSystem withheld it.
+  static Eigen::Map<const InputVector> MapInput(
+      const Eigen::VectorBlock<const VectorX<T>>& input) {
+    if (input.size() == 0 && NU > 0) {
+      static const never_destroyed<InputVector> zeros(InputVector::Zero());
+      return Eigen::Map<const InputVector>(zeros.access().data());
+    }
+    DRAKE_ASSERT(input.size() == NU);
+    return Eigen::Map<const InputVector>(input.data());
+  }
+
+  // Maps @p state, which must have size NX.
+  static Eigen::Map<const StateVector> MapState(
+      const Eigen::VectorBlock<const VectorX<T>>& state) {
+    DRAKE_THROW_UNLESS(state.size() == NX);
+    return Eigen::Map<const StateVector>(state.data());
+  }
+
+  void DoCalcVectorOutput(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* output) const final {
+    DRAKE_ASSERT(output->size() == NY);
+    Eigen::Map<OutputVector> output_map(output->data());
+    DoCalcFixedSizeOutput(context, MapInput(input), MapState(state),
+                          &output_map);
+  }
+
+  void DoCalcVectorTimeDerivatives(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* derivatives) const final {
+    DRAKE_ASSERT(derivatives->size() == NX);
+    Eigen::Map<StateVector> derivatives_map(derivatives->data());
+    DoCalcFixedSizeTimeDerivatives(context, MapInput(input), MapState(state),
+                                   &derivatives_map);
+  }
+
+  void DoCalcVectorDiscreteVariableUpdates(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* next_state) const final {
+    DRAKE_ASSERT(next_state->size() == NX);
+    Eigen::Map<StateVector> next_state_map(next_state->data());
+    DoCalcFixedSizeDiscreteVariableUpdates(context, MapInput(input),
+                                           MapState(state), &next_state_map);
+  }
+};
+
+template <typename T, int NX, int NU, int NY>
+constexpr int FixedSizeVectorSystem<T, NX, NU, NY>::kNumStates;
+
+template <typename T, int NX, int NU, int NY>
+constexpr int FixedSizeVectorSystem<T, NX, NU, NY>::kNumInputs;
+
+template <typename T, int NX, int NU, int NY>
+constexpr int FixedSizeVectorSystem<T, NX, NU, NY>::kNumOutputs;
+
+}  // namespace systems
+}  // namespace drake
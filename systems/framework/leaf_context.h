@@ -84,13 +84,53 @@ class LeafContext : public Context<T> {
  protected:
   /// The caller owns the returned memory.
   Context<T>* DoClone() const override {
-    LeafContext<T>* clone = new LeafContext<T>();
+    return DoCloneImpl(false /* copy_on_write */);
+  }
+
+  /// The caller owns the returned memory.
+  Context<T>* DoCloneCopyOnWrite() const override {
+    return DoCloneImpl(true /* copy_on_write */);
+  }
 
-    // Make a deep copy of the state.
-    clone->state_ = this->CloneState();
+  /// The caller owns the returned memory.
+  State<T>* DoCloneState() const override {
+    return DoCloneStateImpl(false /* copy_on_write */);
+  }
 
-    // Make deep copies of the parameters.
-    clone->set_parameters(parameters_->Clone());
+  const InputPortValue* GetInputPortValue(int index) const override {
+    DRAKE_ASSERT(index >= 0 && index < get_num_input_ports());
+    return input_values_[index].get();
+  }
+
+ private:
+  void SetInputPortValue(int index,
+                         std::unique_ptr<InputPortValue> port) final {
+    DRAKE_DEMAND(index >= 0 && index < get_num_input_ports());
+    input_values_[index] = std::move(port);
+  }
+
+  // Makes a clone of this context. With @p copy_on_write, the clone shares
+  // the storage of numeric values, and, unless this is a subcontext, of
+  // abstract values. The abstract values of a subcontext can't be shared,
+  // because the DiagramContext that owns it holds pointers to them and writes
+  // through those pointers without copying.
+  LeafContext<T>* DoCloneImpl(bool copy_on_write) const {
+    LeafContext<T>* clone = new LeafContext<T>();
+
+    // Make a copy of the state.
+    clone->state_.reset(DoCloneStateImpl(copy_on_write));
+
+    // Make copies of the parameters.
+    if (copy_on_write) {
+      auto parameters = std::make_unique<Parameters<T>>();
+      parameters->set_numeric_parameters(
+          parameters_->get_numeric_parameters().CloneCopyOnWrite());
+      parameters->set_abstract_parameters(
+          CloneAbstractValues(parameters_->get_abstract_parameters()));
+      clone->set_parameters(std::move(parameters));
+    } else {
+      clone->set_parameters(parameters_->Clone());
+    }
 
     // Make deep copies of the inputs into FreestandingInputPortValues.
     // TODO(david-german-tri): Preserve version numbers as well.
@@ -109,11 +149,13 @@ class LeafContext : public Context<T> {
     return clone;
   }
 
-  /// The caller owns the returned memory.
-  State<T>* DoCloneState() const override {
+  // Makes a copy of the state, sharing storage as DoCloneImpl() describes
+  // if @p copy_on_write is true.
+  State<T>* DoCloneStateImpl(bool copy_on_write) const {
     State<T>* clone = new State<T>();
 
-    // Make a deep copy of the continuous state using BasicVector::Clone().
+    // Copy the continuous state using BasicVector::Clone() or
+    // BasicVector::CloneCopyOnWrite().
     const ContinuousState<T>& xc = this->get_continuous_state();
     const int num_q = xc.get_generalized_position().size();
     const int num_v = xc.get_generalized_velocity().size();
@@ -121,25 +163,30 @@ class LeafContext : public Context<T> {
     const BasicVector<T>& xc_vector =
         dynamic_cast<const BasicVector<T>&>(xc.get_vector());
     clone->set_continuous_state(std::make_unique<ContinuousState<T>>(
-        xc_vector.Clone(), num_q, num_v, num_z));
-
-    // Make deep copies of the discrete and abstract states.
-    clone->set_discrete_state(get_state().get_discrete_state().Clone());
-    clone->set_abstract_state(get_state().get_abstract_state().Clone());
+        copy_on_write ? xc_vector.CloneCopyOnWrite() : xc_vector.Clone(),
+        num_q, num_v, num_z));
+
+    // Copy the discrete and abstract states.
+    const State<T>& state = get_state();
+    if (copy_on_write) {
+      clone->set_discrete_state(
+          state.get_discrete_state().CloneCopyOnWrite());
+      clone->set_abstract_state(
+          CloneAbstractValues(state.get_abstract_state()));
+    } else {
+      clone->set_discrete_state(state.get_discrete_state().Clone());
+      clone->set_abstract_state(state.get_abstract_state().Clone());
+    }
 
     return clone;
   }
 
-  const InputPortValue* GetInputPortValue(int index) const override {
-    DRAKE_ASSERT(index >= 0 && index < get_num_input_ports());
-    return input_values_[index].get();
-  }
-
- private:
-  void SetInputPortValue(int index,
-                         std::unique_ptr<InputPortValue> port) final {
-    DRAKE_DEMAND(index >= 0 && index < get_num_input_ports());
-    input_values_[index] = std::move(port);
+  // Returns a copy-on-write clone of @p values, or a deep copy if this is a
+  // subcontext; see DoCloneImpl().
+  std::unique_ptr<AbstractValues> CloneAbstractValues(
+      const AbstractValues& values) const {
+    return this->get_parent() == nullptr ? values.CloneCopyOnWrite()
+                                         : values.Clone();
   }
 
   // The external inputs to the System.
@@ -7,6 +7,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/vector_base.h"
 
 namespace drake {
@@ -28,6 +29,7 @@ class Subvector : public VectorBase<T> {
   ///               valid for the lifetime of this object.
   Subvector(VectorBase<T>* vector, int first_element, int num_elements)
       : vector_(vector),
+        basic_vector_(dynamic_cast<BasicVector<T>*>(vector)),
         first_element_(first_element),
         num_elements_(num_elements) {
     if (vector_ == nullptr) {
@@ -47,7 +49,10 @@ class Subvector : public VectorBase<T> {
 
   const T& GetAtIndex(int index) const override {
     DRAKE_THROW_UNLESS(index < size());
-    return vector_->GetAtIndex(first_element_ + index);
+    // Reads must not go through the mutable accessor, which would make a
+    // copy-on-write BasicVector take a private copy of its values.
+    const VectorBase<T>& vector = *vector_;
+    return vector.GetAtIndex(first_element_ + index);
   }
 
   T& GetAtIndex(int index) override {
@@ -55,8 +60,93 @@ class Subvector : public VectorBase<T> {
     return vector_->GetAtIndex(first_element_ + index);
   }
 
+  // When the sliced vector is a BasicVector, i.e., when this is a view into
+  // contiguous storage such as the continuous state of a leaf system, the
+  // bulk operations below are performed on a segment of its Eigen values.
+  // Otherwise, they fall back to the element-wise defaults.
+
+  void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) override {
+    if (basic_vector_ == nullptr) {
+      VectorBase<T>::SetFromVector(value);
+      return;
+    }
+    DRAKE_THROW_UNLESS(value.rows() == size());
+    mutable_segment() = value;
+  }
+
+  void SetZero() override {
+    if (basic_vector_ == nullptr) {
+      VectorBase<T>::SetZero();
+      return;
+    }
+    mutable_segment().setZero();
+  }
+
+  VectorX<T> CopyToVector() const override {
+    if (basic_vector_ == nullptr) {
+      return VectorBase<T>::CopyToVector();
+    }
+    return segment();
+  }
+
+  void CopyToPreSizedVector(Eigen::Ref<VectorX<T>> vec) const override {
+    if (basic_vector_ == nullptr) {
+      VectorBase<T>::CopyToPreSizedVector(vec);
+      return;
+    }
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination must be the same size.");
+    }
+    vec = segment();
+  }
+
+  void ScaleAndAddToVector(const T& scale,
+                           Eigen::Ref<VectorX<T>> vec) const override {
+    if (basic_vector_ == nullptr) {
+      VectorBase<T>::ScaleAndAddToVector(scale, vec);
+      return;
+    }
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Addends must be the same size.");
+    }
+    vec += scale * segment();
+  }
+
+  T NormInf() const override {
+    if (basic_vector_ == nullptr || size() == 0) {
+      return VectorBase<T>::NormInf();
+    }
+    return segment().template lpNorm<Eigen::Infinity>();
+  }
+
  private:
+  void DoPlusEqScaled(const std::initializer_list<
+                      std::pair<T, const VectorBase<T>&>>& rhs_scale) override {
+    if (basic_vector_ == nullptr) {
+      VectorBase<T>::DoPlusEqScaled(rhs_scale);
+      return;
+    }
+    auto values = mutable_segment();
+    for (const auto& operand : rhs_scale) {
+      operand.second.ScaleAndAddToVector(operand.first, values);
+    }
+  }
+
+  // The viewed elements of basic_vector_, for reading.
+  auto segment() const {
+    const BasicVector<T>& vector = *basic_vector_;
+    return vector.get_value().segment(first_element_, num_elements_);
+  }
+
+  // The viewed elements of basic_vector_, for writing.
+  auto mutable_segment() {
+    return basic_vector_->get_mutable_value().segment(first_element_,
+                                                      num_elements_);
+  }
+
   VectorBase<T>* vector_{nullptr};
+  // The same as vector_ if it is a BasicVector, or nullptr otherwise.
+  BasicVector<T>* basic_vector_{nullptr};
   int first_element_{0};
   int num_elements_{0};
 };
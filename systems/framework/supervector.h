@@ -9,6 +9,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/framework/vector_base.h"
 
 namespace drake {
@@ -42,7 +43,9 @@ class Supervector : public VectorBase<T> {
 
   const T& GetAtIndex(int index) const override {
     const auto target = GetSubvectorAndOffset(index);
-    return target.first->GetAtIndex(target.second);
+    // Reads must not go through the mutable accessor; see Subvector.
+    const VectorBase<T>& subvector = *target.first;
+    return subvector.GetAtIndex(target.second);
   }
 
   T& GetAtIndex(int index) override {
@@ -50,7 +53,91 @@ class Supervector : public VectorBase<T> {
     return target.first->GetAtIndex(target.second);
   }
 
+  // The bulk operations below are delegated to the constituent vectors, one
+  // contiguous segment at a time, rather than performing a binary search and
+  // two virtual calls per element. This is what integrators use on the
+  // continuous state of a Diagram.
+
+  void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) override {
+    DRAKE_THROW_UNLESS(value.rows() == size());
+    int start = 0;
+    for (VectorBase<T>* vec : vectors_) {
+      vec->SetFromVector(value.segment(start, vec->size()));
+      start += vec->size();
+    }
+  }
+
+  void SetZero() override {
+    for (VectorBase<T>* vec : vectors_) {
+      vec->SetZero();
+    }
+  }
+
+  VectorX<T> CopyToVector() const override {
+    VectorX<T> result(size());
+    CopyToPreSizedVector(result);
+    return result;
+  }
+
+  void CopyToPreSizedVector(Eigen::Ref<VectorX<T>> vec) const override {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination must be the same size.");
+    }
+    int start = 0;
+    for (const VectorBase<T>* subvector : vectors_) {
+      subvector->CopyToPreSizedVector(vec.segment(start, subvector->size()));
+      start += subvector->size();
+    }
+  }
+
+  void ScaleAndAddToVector(const T& scale,
+                           Eigen::Ref<VectorX<T>> vec) const override {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Addends must be the same size.");
+    }
+    int start = 0;
+    for (const VectorBase<T>* subvector : vectors_) {
+      subvector->ScaleAndAddToVector(scale,
+                                     vec.segment(start, subvector->size()));
+      start += subvector->size();
+    }
+  }
+
+  T NormInf() const override {
+    using std::max;
+    T norm(0);
+    for (const VectorBase<T>* subvector : vectors_) {
+      if (subvector->size() > 0) {
+        norm = max(norm, subvector->NormInf());
+      }
+    }
+    return norm;
+  }
+
  private:
+  // When every addend is a Supervector partitioned like this one, e.g., the
+  // time derivatives of the continuous state of the same Diagram, adds them
+  // in one constituent vector at a time. Otherwise, falls back to the
+  // element-wise default.
+  void DoPlusEqScaled(const std::initializer_list<
+                      std::pair<T, const VectorBase<T>&>>& rhs_scale) override {
+    for (const auto& operand : rhs_scale) {
+      const auto* other = dynamic_cast<const Supervector<T>*>(&operand.second);
+      if (other == nullptr || other->lookup_table_ != lookup_table_) {
+        VectorBase<T>::DoPlusEqScaled(rhs_scale);
+        return;
+      }
+    }
+    for (const auto& operand : rhs_scale) {
+      const auto& other = static_cast<const Supervector<T>&>(operand.second);
+      for (size_t i = 0; i < vectors_.size(); ++i) {
+        if (vectors_[i]->size() > 0) {
+          vectors_[i]->PlusEqScaled(operand.first, *other.vectors_[i]);
+        }
+      }
+    }
+  }
+
   // Given an index into the supervector, returns the subvector that
   // contains that index, and its offset within the subvector. This operation
   // is O(log(N)) in the number of subvectors. Throws std::out_of_range for
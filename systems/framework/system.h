@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -72,6 +73,22 @@ typedef std::mt19937 RandomGenerator;
 /// A superclass template for systems that receive input, maintain state, and
 /// produce output of a given mathematical type T.
 ///
+/// @anchor system_thread_safety
+/// <h3>Thread safety</h3>
+///
+/// A fully-constructed %System holds no computational state of its own; all
+/// such state lives in a Context. Consequently, the `const` methods of a
+/// %System that take a Context (allocation, `Eval` and `Calc` methods, event
+/// dispatch, `SetDefaultContext()`, `SetRandomContext()`, ...) may be invoked
+/// concurrently from several threads provided that each thread uses its _own_
+/// Context (and its own output, derivatives, or event-collection objects). A
+/// single Context must never be used by more than one thread at a time, since
+/// even `const` access may update its cache. Non-`const` %System methods, such
+/// as the port and state declarations used during construction, are not
+/// thread safe. Authors of derived classes must preserve this guarantee: do
+/// not keep `mutable` scratch storage in a %System; put it in the Context (for
+/// example in a cache entry) instead.
+///
 /// @tparam T The vector element type, which must be a valid Eigen scalar.
 template <typename T>
 class System {
@@ -359,23 +376,24 @@ class System {
   /// appropriate subsystem evaluate the source output port.
   //@{
 
-  /// Returns a reference to the cached value of the conservative power. If
-  /// necessary the cache will be updated first using CalcConservativePower().
+  /// Returns the value of the conservative power, as computed by
+  /// CalcConservativePower(). The value is returned by value rather than by
+  /// reference so that no state is shared between Contexts; see
+  /// @ref system_thread_safety "Thread safety".
   /// @see CalcConservativePower()
-  const T& EvalConservativePower(const Context<T>& context) const {
-    // TODO(sherm1) Replace with an actual cache entry.
-    fake_cache_conservative_power_ = CalcConservativePower(context);
-    return fake_cache_conservative_power_;
+  T EvalConservativePower(const Context<T>& context) const {
+    // TODO(sherm1) Return a reference to an actual cache entry in `context`.
+    return CalcConservativePower(context);
   }
 
-  /// Returns a reference to the cached value of the non-conservative power. If
-  /// necessary the cache will be updated first using
-  /// CalcNonConservativePower().
+  /// Returns the value of the non-conservative power, as computed by
+  /// CalcNonConservativePower(). The value is returned by value rather than by
+  /// reference so that no state is shared between Contexts; see
+  /// @ref system_thread_safety "Thread safety".
   /// @see CalcNonConservativePower()
-  const T& EvalNonConservativePower(const Context<T>& context) const {
-    // TODO(sherm1) Replace with an actual cache entry.
-    fake_cache_nonconservative_power_ = CalcNonConservativePower(context);
-    return fake_cache_nonconservative_power_;
+  T EvalNonConservativePower(const Context<T>& context) const {
+    // TODO(sherm1) Return a reference to an actual cache entry in `context`.
+    return CalcNonConservativePower(context);
   }
 
   /// Causes the vector-valued input port with the given `port_index` to become
@@ -942,7 +960,7 @@ class System {
   /// will have a default name automatically assigned.  Systems created through
   /// transmogrification have by default an identical name to the system they
   /// were created from.
-  std::string get_name() const { return name_; }
+  const std::string& get_name() const { return name_; }
 
   /// Returns a name for this %System based on a stringification of its type
   /// name and memory address.  This is intended for use in diagnostic output
@@ -1223,6 +1241,20 @@ class System {
   std::unique_ptr<System<AutoDiffXd>> ToAutoDiffXdMaybe() const {
     return system_scalar_converter_.Convert<AutoDiffXd, T>(*this);
   }
+
+  /// Returns a System converted exactly like ToAutoDiffXd(), but converts only
+  /// on the first call, and keeps the result for the lifetime of this System.
+  /// Callers that would otherwise convert over and over (e.g., linearization
+  /// or trajectory optimization) thus share one converted twin. The twin has
+  /// its own Contexts; use Context::SetTimeStateAndParametersFrom() or
+  /// Context::SetParametersFrom() to bring values over from a Context of this
+  /// System. This method is safe to call concurrently.
+  /// @throw exception if this System does not support autodiff
+  const System<AutoDiffXd>& GetOrCreateAutoDiffXd() const {
+    std::call_once(autodiff_twin_flag_,
+                   [this]() { autodiff_twin_ = ToAutoDiffXd(); });
+    return *autodiff_twin_;
+  }
   //@}
 
   //----------------------------------------------------------------------------
@@ -1284,6 +1316,16 @@ class System {
   std::unique_ptr<System<symbolic::Expression>> ToSymbolicMaybe() const {
     return system_scalar_converter_.Convert<symbolic::Expression, T>(*this);
   }
+
+  /// Returns a System converted exactly like ToSymbolic(), but converts only
+  /// on the first call, and keeps the result for the lifetime of this System.
+  /// @see GetOrCreateAutoDiffXd()
+  /// @throw exception if this System does not support symbolic
+  const System<symbolic::Expression>& GetOrCreateSymbolic() const {
+    std::call_once(symbolic_twin_flag_,
+                   [this]() { symbolic_twin_ = ToSymbolic(); });
+    return *symbolic_twin_;
+  }
   //@}
 
   //----------------------------------------------------------------------------
@@ -1359,6 +1401,20 @@ class System {
     return DoCalcWitnessValue(context, witness_func);
   }
 
+  /// Evaluates each of @p witnesses at the given context into the same entry
+  /// of @p values, which is resized as needed. This gives the same values as
+  /// CalcWitnessValue() does one at a time, but lets a Diagram find the
+  /// subcontext of a subsystem once for all of its witness functions.
+  void CalcWitnessValues(
+      const Context<T>& context,
+      const std::vector<const WitnessFunction<T>*>& witnesses,
+      VectorX<T>* values) const {
+    DRAKE_DEMAND(values != nullptr);
+    DRAKE_ASSERT_VOID(CheckValidContext(context));
+    values->resize(witnesses.size());
+    DoCalcWitnessValues(context, witnesses, values);
+  }
+
   /// Add `event` to `events` due to a witness function triggering. `events`
   /// should be allocated with this system's AllocateCompositeEventCollection.
   /// Neither `event` nor `events` can be nullptr. Additionally, `event` must
@@ -1388,6 +1444,17 @@ class System {
       const Context<T>& context,
       const WitnessFunction<T>& witness_func) const = 0;
 
+  /// Derived classes can override this method to evaluate several witness
+  /// functions at once. On entry, @p values has the size of @p witnesses. The
+  /// default implementation calls DoCalcWitnessValue() for each of them.
+  virtual void DoCalcWitnessValues(
+      const Context<T>& context,
+      const std::vector<const WitnessFunction<T>*>& witnesses,
+      VectorX<T>* values) const {
+    for (size_t i = 0; i < witnesses.size(); ++i)
+      (*values)[i] = DoCalcWitnessValue(context, *witnesses[i]);
+  }
+
   /// Derived classes can override this method to provide witness functions
   /// active for the given state. The default implementation does nothing. On
   /// entry to this function, the context will have already been validated and
@@ -1899,12 +1966,13 @@ class System {
   // Functions to convert this system to use alternative scalar types.
   SystemScalarConverter system_scalar_converter_;
 
-  // TODO(sherm1) Replace these fake cache entries with real cache asap.
-  // These are temporaries and hence uninitialized.
-  mutable T fake_cache_pe_;
-  mutable T fake_cache_ke_;
-  mutable T fake_cache_conservative_power_;
-  mutable T fake_cache_nonconservative_power_;
+  // The converted twins of GetOrCreateAutoDiffXd() and GetOrCreateSymbolic(),
+  // created on first use.
+  mutable std::once_flag autodiff_twin_flag_;
+  mutable std::unique_ptr<System<AutoDiffXd>> autodiff_twin_;
+  mutable std::once_flag symbolic_twin_flag_;
+  mutable std::unique_ptr<System<symbolic::Expression>> symbolic_twin_;
+
 };
 
 }  // namespace systems
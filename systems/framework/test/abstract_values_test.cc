@@ -48,6 +48,29 @@ TEST_F(AbstractStateTest, Clone) {
   EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
 }
 
+// Tests that a copy-on-write clone shares owned values until either copy
+// accesses them for writing, and deep copies unowned values.
+TEST_F(AbstractStateTest, CloneCopyOnWrite) {
+  AbstractValues xa(std::move(data_));
+  std::unique_ptr<AbstractValues> clone = xa.CloneCopyOnWrite();
+  EXPECT_EQ(&xa.get_value(0), &clone->get_value(0));
+  EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
+
+  clone->get_mutable_value(0).SetValue<int>(1000);
+  EXPECT_NE(&xa.get_value(0), &clone->get_value(0));
+  EXPECT_EQ(1000, UnpackIntValue(clone->get_value(0)));
+  EXPECT_EQ(42, UnpackIntValue(xa.get_value(0)));
+
+  xa.get_mutable_value(1).SetValue<int>(2000);
+  EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
+  EXPECT_EQ(2000, UnpackIntValue(xa.get_value(1)));
+
+  AbstractValues unowned(std::vector<AbstractValue*>{&xa.get_mutable_value(0)});
+  std::unique_ptr<AbstractValues> unowned_clone = unowned.CloneCopyOnWrite();
+  EXPECT_NE(&unowned.get_value(0), &unowned_clone->get_value(0));
+  EXPECT_EQ(42, UnpackIntValue(unowned_clone->get_value(0)));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -108,6 +108,48 @@ GTEST_TEST(BasicVectorTest, Clone) {
   EXPECT_EQ(expected, clone->get_value());
 }
 
+// Tests that a copy-on-write clone shares its values with the original until
+// either is mutated, and that mutations are then not visible to the other.
+GTEST_TEST(BasicVectorTest, CloneCopyOnWrite) {
+  BasicVector<double> vec(2);
+  vec.get_mutable_value() << 1, 2;
+
+  std::unique_ptr<BasicVector<double>> clone = vec.CloneCopyOnWrite();
+  EXPECT_EQ(&clone->GetAtIndex(0), &vec.get_value()[0]);
+  EXPECT_EQ(vec.get_value(), clone->get_value());
+
+  clone->SetAtIndex(0, 3);
+  EXPECT_NE(&clone->get_value()[0], &vec.get_value()[0]);
+  EXPECT_EQ(Eigen::Vector2d(3, 2), clone->get_value());
+  EXPECT_EQ(Eigen::Vector2d(1, 2), vec.get_value());
+
+  // Mutating the original leaves a second clone intact.
+  std::unique_ptr<BasicVector<double>> clone2 = vec.CloneCopyOnWrite();
+  vec.set_value(Eigen::Vector2d(5, 6));
+  vec.SetZero();
+  EXPECT_EQ(Eigen::Vector2d(1, 2), clone2->get_value());
+  EXPECT_EQ(Eigen::Vector2d(0, 0), vec.get_value());
+}
+
+// Tests that a BasicVector can be copied into a pre-sized vector, and only
+// into one of the same size.
+GTEST_TEST(BasicVectorTest, CopyToPreSizedVector) {
+  auto vec = BasicVector<double>::Make(1.0, 2.0, 3.0);
+  Eigen::VectorXd destination(3);
+  vec->CopyToPreSizedVector(destination);
+  EXPECT_EQ(destination, vec->get_value());
+
+  // The default implementation, used by other vector types, agrees.
+  destination.setZero();
+  vec->VectorBase<double>::CopyToPreSizedVector(destination);
+  EXPECT_EQ(destination, vec->get_value());
+
+  Eigen::VectorXd wrong_size(2);
+  EXPECT_THROW(vec->CopyToPreSizedVector(wrong_size), std::out_of_range);
+  EXPECT_THROW(vec->VectorBase<double>::CopyToPreSizedVector(wrong_size),
+               std::out_of_range);
+}
+
 // Tests that an error is thrown when the BasicVector is set from a vector
 // of a different size.
 GTEST_TEST(BasicVectorTest, ReinitializeInvalid) {
@@ -0,0 +1,226 @@
+// Measures the cost of the caching and dependency-tracking machinery on
+// synthetic systems of configurable size. Run with --help for options.
+//
+// Two kinds of synthetic models are used:
+//  - A SystemBase whose cache entries form a complete tree of the given depth
+//    and fan-out, rooted at the time tracker. This isolates the cost of
+//    DependencyTracker::NoteValueChange() invalidation sweeps and of
+//    CacheEntry::Eval() hits and misses.
+//  - A Diagram of nested Diagrams of the same depth and fan-out, whose leaves
+//    are trivial LeafSystems. This is used to measure Context cloning.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/systems/framework/context_base.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/framework/system_base.h"
+
+DEFINE_int32(depth, 4, "Depth of the synthetic dependency tree and Diagram.");
+DEFINE_int32(fan_out, 4, "Number of children of each non-leaf node.");
+DEFINE_int32(iterations, 1000, "Number of timed repetitions of each test.");
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+class BenchmarkContextBase final : public ContextBase {
+ public:
+  BenchmarkContextBase() = default;
+  BenchmarkContextBase(const BenchmarkContextBase&) = default;
+
+ private:
+  std::unique_ptr<ContextBase> DoCloneWithoutPointers() const final {
+    return std::unique_ptr<ContextBase>(new BenchmarkContextBase(*this));
+  }
+};
+
+// A SystemBase with cache entries arranged as a complete tree. Entry 0 depends
+// on time; every other entry depends on its parent entry.
+class TreeOfCacheEntries final : public SystemBase {
+ public:
+  TreeOfCacheEntries(int depth, int fan_out) {
+    set_name("tree_of_cache_entries");
+    auto alloc = [](const ContextBase&) {
+      return AbstractValue::Make<double>(0.0);
+    };
+    auto calc = [](const ContextBase&, AbstractValue* result) {
+      result->SetValue(1.0);
+    };
+    std::vector<const CacheEntry*> level{
+        &DeclareCacheEntry("root", alloc, calc, {time_ticket()})};
+    for (int d = 1; d <= depth; ++d) {
+      std::vector<const CacheEntry*> next_level;
+      for (const CacheEntry* parent : level) {
+        for (int i = 0; i < fan_out; ++i) {
+          next_level.push_back(&DeclareCacheEntry("node", alloc, calc,
+                                                  {parent->ticket()}));
+        }
+      }
+      level = std::move(next_level);
+    }
+    leaves_ = std::move(level);
+  }
+
+  const std::vector<const CacheEntry*>& leaves() const { return leaves_; }
+
+  const CacheEntry& entry(int i) const {
+    return get_cache_entry(CacheIndex(i));
+  }
+
+ private:
+  std::unique_ptr<ContextBase> DoMakeContext() const final {
+    return std::make_unique<BenchmarkContextBase>();
+  }
+
+  void DoCheckValidContext(const ContextBase&) const final {}
+
+  std::vector<const CacheEntry*> leaves_;
+};
+
+// A trivial leaf with a little state of each kind, so that cloning its
+// Context does representative work.
+class TrivialLeaf final : public LeafSystem<double> {
+ public:
+  TrivialLeaf() {
+    this->DeclareContinuousState(2);
+    this->DeclareDiscreteState(2);
+    this->DeclareNumericParameter(BasicVector<double>(2));
+    this->DeclareInputPort(kVectorValued, 2);
+  }
+};
+
+std::unique_ptr<System<double>> MakeNestedDiagram(int depth, int fan_out) {
+  if (depth == 0) return std::make_unique<TrivialLeaf>();
+  DiagramBuilder<double> builder;
+  for (int i = 0; i < fan_out; ++i) {
+    builder.AddSystem(MakeNestedDiagram(depth - 1, fan_out));
+  }
+  return builder.Build();
+}
+
+void RunCacheBenchmarks(int depth, int fan_out, int iterations) {
+  const TreeOfCacheEntries system(depth, fan_out);
+  std::unique_ptr<ContextBase> context = system.AllocateContext();
+  context->get_mutable_cache().EnableStatistics();
+  const DependencyTracker& time_tracker =
+      context->get_tracker(system.time_ticket());
+  const int num_entries = system.num_cache_entries();
+
+  auto eval_all = [&]() {
+    double sum = 0;
+    for (int i = 0; i < num_entries; ++i) {
+      sum += system.entry(i).Eval<double>(*context);
+    }
+    return sum;
+  };
+
+  // Invalidation sweeps followed by full recomputation (all misses).
+  double sweep_seconds = 0;
+  double miss_seconds = 0;
+  int64_t change_event = 0;
+  for (int k = 0; k < iterations; ++k) {
+    const Clock::time_point sweep_start = Clock::now();
+    time_tracker.NoteValueChange(++change_event);
+    sweep_seconds += SecondsSince(sweep_start);
+
+    const Clock::time_point miss_start = Clock::now();
+    DRAKE_DEMAND(eval_all() == num_entries);
+    miss_seconds += SecondsSince(miss_start);
+  }
+
+  // Repeated evaluation of up-to-date entries (all hits).
+  const Clock::time_point hit_start = Clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    DRAKE_DEMAND(eval_all() == num_entries);
+  }
+  const double hit_seconds = SecondsSince(hit_start);
+
+  int64_t hits = 0, misses = 0;
+  for (int i = 0; i < num_entries; ++i) {
+    const CacheEntryValue& value =
+        system.entry(i).get_cache_entry_value(*context);
+    hits += value.num_hits();
+    misses += value.num_misses();
+  }
+
+  const Clock::time_point clone_start = Clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    std::unique_ptr<ContextBase> clone = context->Clone();
+    DRAKE_DEMAND(clone != nullptr);
+  }
+  const double clone_seconds = SecondsSince(clone_start);
+
+  const double evals = static_cast<double>(iterations) * num_entries;
+  std::cout << "Cache entry tree: depth " << depth << ", fan-out " << fan_out
+            << ", " << num_entries << " entries\n";
+  std::cout << "  invalidation sweep:   " << sweep_seconds / iterations * 1e6
+            << " us/sweep\n";
+  std::cout << "  Eval miss latency:    " << miss_seconds / evals * 1e9
+            << " ns/eval\n";
+  std::cout << "  Eval hit latency:     " << hit_seconds / evals * 1e9
+            << " ns/eval\n";
+  std::cout << "  context clone:        " << clone_seconds / iterations * 1e6
+            << " us/clone\n";
+  std::cout << "  hit ratio:            "
+            << static_cast<double>(hits) / (hits + misses) << " (" << hits
+            << " hits, " << misses << " misses)\n";
+}
+
+void RunDiagramBenchmarks(int depth, int fan_out, int iterations) {
+  std::unique_ptr<System<double>> diagram = MakeNestedDiagram(depth, fan_out);
+  const Clock::time_point create_start = Clock::now();
+  std::unique_ptr<Context<double>> context = diagram->CreateDefaultContext();
+  const double create_seconds = SecondsSince(create_start);
+
+  const Clock::time_point clone_start = Clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    std::unique_ptr<Context<double>> clone = context->Clone();
+    DRAKE_DEMAND(clone != nullptr);
+  }
+  const double clone_seconds = SecondsSince(clone_start);
+
+  std::cout << "Nested Diagram: depth " << depth << ", fan-out " << fan_out
+            << ", " << std::lround(std::pow(fan_out, depth))
+            << " leaf systems\n";
+  std::cout << "  CreateDefaultContext: " << create_seconds * 1e6 << " us\n";
+  std::cout << "  context clone:        " << clone_seconds / iterations * 1e6
+            << " us/clone\n";
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_depth >= 0);
+  DRAKE_DEMAND(FLAGS_fan_out >= 1);
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+  RunCacheBenchmarks(FLAGS_depth, FLAGS_fan_out, FLAGS_iterations);
+  RunDiagramBenchmarks(FLAGS_depth, FLAGS_fan_out, FLAGS_iterations);
+  return 0;
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Benchmarks cache invalidation, Eval() and Context cloning on synthetic "
+      "systems of configurable depth and fan-out.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::systems::do_main();
+}
@@ -379,6 +379,50 @@ TEST_F(CacheEntryTest, InvalidateAllWorks) {
   EXPECT_TRUE(vector_entry().is_out_of_date(context_));
 }
 
+// Hit and miss counts are only recorded when statistics are enabled, and
+// survive copying the Context.
+TEST_F(CacheEntryTest, StatisticsWork) {
+  CacheEntryValue& int_val = entry1().get_mutable_cache_entry_value(context_);
+  EXPECT_FALSE(int_val.is_collecting_statistics());
+
+  // Everything starts out up to date; without statistics nothing is counted.
+  EXPECT_EQ(entry1().Eval<int>(context_), 1);
+  EXPECT_EQ(int_val.num_hits(), 0);
+  EXPECT_EQ(int_val.num_misses(), 0);
+  EXPECT_EQ(int_val.hit_ratio(), 0.0);
+
+  context_.get_mutable_cache().EnableStatistics();
+  EXPECT_TRUE(int_val.is_collecting_statistics());
+  EXPECT_EQ(entry1().Eval<int>(context_), 1);  // Hit.
+  EXPECT_EQ(entry1().Eval<int>(context_), 1);  // Hit.
+  invalidate(index1_);
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);  // Miss.
+  EXPECT_EQ(int_val.num_hits(), 2);
+  EXPECT_EQ(int_val.num_misses(), 1);
+  EXPECT_DOUBLE_EQ(int_val.hit_ratio(), 2.0 / 3.0);
+
+  // Disabling caching forces misses.
+  int_val.disable_caching();
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);
+  EXPECT_EQ(int_val.num_misses(), 2);
+  int_val.enable_caching();
+
+  // Counts are copied along with the Context.
+  std::unique_ptr<ContextBase> clone = context_.Clone();
+  const CacheEntryValue& clone_val = entry1().get_cache_entry_value(*clone);
+  EXPECT_TRUE(clone_val.is_collecting_statistics());
+  EXPECT_EQ(clone_val.num_hits(), 2);
+  EXPECT_EQ(clone_val.num_misses(), 2);
+
+  // Disabling stops counting but keeps the counts; resetting zeroes them.
+  context_.get_mutable_cache().DisableStatistics();
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);
+  EXPECT_EQ(int_val.num_hits(), 2);
+  context_.get_mutable_cache().ResetStatistics();
+  EXPECT_EQ(int_val.num_hits(), 0);
+  EXPECT_EQ(int_val.num_misses(), 0);
+}
+
 // Make sure the debugging routine to disable the cache works, and is
 // independent of the out_of_date flags.
 TEST_F(CacheEntryTest, DisableCacheWorks) {
@@ -0,0 +1,192 @@
+#include "drake/systems/framework/context_serialization.h"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/framework/input_port_descriptor.h"
+#include "drake/systems/framework/leaf_context.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// An abstract value type that opts into serialization.
+struct Waypoint {
+  std::string name;
+  double x{};
+};
+
+}  // namespace
+
+template <>
+struct ValueSerializationTraits<Waypoint> {
+  static void Serialize(const Waypoint& value, SerializationWriter* writer) {
+    writer->WriteString(value.name);
+    writer->WriteDouble(value.x);
+  }
+  static void Deserialize(SerializationReader* reader, Waypoint* value) {
+    value->name = reader->ReadString();
+    value->x = reader->ReadDouble();
+  }
+};
+
+namespace {
+
+// An abstract value type that does not opt into serialization.
+struct Opaque {
+  int secret{};
+};
+
+// Returns a context with two continuous states, two discrete state groups,
+// an int and a string abstract state, a numeric parameter, a Waypoint
+// parameter, and three input ports.
+std::unique_ptr<LeafContext<double>> MakeContext() {
+  auto context = std::make_unique<LeafContext<double>>();
+  context->set_continuous_state(std::make_unique<ContinuousState<double>>(
+      BasicVector<double>::Make({0.0, 0.0}), 1, 1, 0));
+
+  std::vector<std::unique_ptr<BasicVector<double>>> xd;
+  xd.push_back(BasicVector<double>::Make({0.0}));
+  xd.push_back(BasicVector<double>::Make({0.0, 0.0, 0.0}));
+  context->set_discrete_state(
+      std::make_unique<DiscreteValues<double>>(std::move(xd)));
+
+  std::vector<std::unique_ptr<AbstractValue>> xa;
+  xa.push_back(std::make_unique<Value<int>>(0));
+  xa.push_back(std::make_unique<Value<std::string>>());
+  context->set_abstract_state(
+      std::make_unique<AbstractValues>(std::move(xa)));
+
+  std::vector<std::unique_ptr<BasicVector<double>>> numeric;
+  numeric.push_back(BasicVector<double>::Make({0.0, 0.0}));
+  std::vector<std::unique_ptr<AbstractValue>> abstract;
+  abstract.push_back(std::make_unique<Value<Waypoint>>());
+  context->set_parameters(std::make_unique<Parameters<double>>(
+      std::move(numeric), std::move(abstract)));
+
+  context->SetNumInputPorts(3);
+  return context;
+}
+
+const AbstractValue* ReadInput(const Context<double>& context, int index) {
+  InputPortDescriptor<double> descriptor(nullptr, InputPortIndex(index),
+                                         kAbstractValued, 0, nullopt);
+  return context.EvalAbstractInput(nullptr, descriptor);
+}
+
+class ContextSerializationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    serializer_.RegisterAbstractValueType<Waypoint>();
+
+    source_ = MakeContext();
+    source_->set_time(12.5);
+    source_->get_mutable_continuous_state_vector().SetFromVector(
+        Eigen::Vector2d(1.0, 2.0));
+    source_->get_mutable_discrete_state(0).SetAtIndex(0, 3.0);
+    source_->get_mutable_discrete_state(1).SetFromVector(
+        Eigen::Vector3d(4.0, 5.0, 6.0));
+    source_->get_mutable_abstract_state<int>(0) = 7;
+    source_->get_mutable_abstract_state<std::string>(1) = "eight";
+    source_->get_mutable_numeric_parameter(0).SetFromVector(
+        Eigen::Vector2d(9.0, 10.0));
+    source_->get_mutable_parameters()
+        .get_mutable_abstract_parameter<Waypoint>(0) = Waypoint{"home", 11.0};
+    source_->FixInputPort(0, Eigen::Vector2d(12.0, 13.0));
+    source_->FixInputPort(2, std::make_unique<Value<std::string>>("fourteen"));
+  }
+
+  ContextSerializer serializer_;
+  std::unique_ptr<LeafContext<double>> source_;
+};
+
+TEST_F(ContextSerializationTest, RoundTrip) {
+  std::vector<uint8_t> bytes;
+  serializer_.Serialize(*source_, &bytes);
+  EXPECT_EQ(bytes.size() % 8, 0);
+
+  auto restored = MakeContext();
+  serializer_.Deserialize(bytes.data(), bytes.size(), restored.get());
+
+  EXPECT_EQ(restored->get_time(), 12.5);
+  EXPECT_EQ(restored->get_continuous_state_vector().CopyToVector(),
+            Eigen::Vector2d(1.0, 2.0));
+  EXPECT_EQ(restored->get_discrete_state(0).GetAtIndex(0), 3.0);
+  EXPECT_EQ(restored->get_discrete_state(1).get_value(),
+            Eigen::Vector3d(4.0, 5.0, 6.0));
+  EXPECT_EQ(restored->get_abstract_state<int>(0), 7);
+  EXPECT_EQ(restored->get_abstract_state<std::string>(1), "eight");
+  EXPECT_EQ(restored->get_numeric_parameter(0).get_value(),
+            Eigen::Vector2d(9.0, 10.0));
+  const Waypoint& waypoint =
+      restored->get_parameters().get_abstract_parameter<Waypoint>(0);
+  EXPECT_EQ(waypoint.name, "home");
+  EXPECT_EQ(waypoint.x, 11.0);
+
+  ASSERT_NE(ReadInput(*restored, 0), nullptr);
+  EXPECT_EQ(ReadInput(*restored, 0)
+                ->GetValue<BasicVector<double>>().get_value(),
+            Eigen::Vector2d(12.0, 13.0));
+  EXPECT_EQ(ReadInput(*restored, 1), nullptr);
+  ASSERT_NE(ReadInput(*restored, 2), nullptr);
+  EXPECT_EQ(ReadInput(*restored, 2)->GetValue<std::string>(), "fourteen");
+}
+
+// Tests that a snapshot can be appended to a buffer that already holds data
+// and read back from there.
+TEST_F(ContextSerializationTest, AppendedSnapshot) {
+  std::vector<uint8_t> bytes(3, 0xff);
+  serializer_.Serialize(*source_, &bytes);
+
+  // Copy the snapshot to an aligned buffer, as a memory mapping would be.
+  std::vector<double> aligned((bytes.size() - 3 + 7) / 8);
+  std::memcpy(aligned.data(), bytes.data() + 3, bytes.size() - 3);
+  auto restored = MakeContext();
+  serializer_.Deserialize(aligned.data(), bytes.size() - 3, restored.get());
+  EXPECT_EQ(restored->get_abstract_state<std::string>(1), "eight");
+}
+
+TEST_F(ContextSerializationTest, Mismatch) {
+  std::vector<uint8_t> bytes;
+  serializer_.Serialize(*source_, &bytes);
+
+  // A context with a different number of continuous states.
+  auto other = MakeContext();
+  other->set_continuous_state(std::make_unique<ContinuousState<double>>(
+      BasicVector<double>::Make({0.0, 0.0, 0.0}), 1, 1, 1));
+  EXPECT_THROW(serializer_.Deserialize(bytes.data(), bytes.size(), other.get()),
+               std::runtime_error);
+
+  // A truncated snapshot.
+  auto restored = MakeContext();
+  EXPECT_THROW(
+      serializer_.Deserialize(bytes.data(), bytes.size() / 2, restored.get()),
+      std::runtime_error);
+
+  // Something other than a snapshot.
+  const std::vector<uint8_t> garbage(64, 0x5a);
+  EXPECT_THROW(
+      serializer_.Deserialize(garbage.data(), garbage.size(), restored.get()),
+      std::runtime_error);
+
+  // A serializer that doesn't know about Waypoint.
+  ContextSerializer plain;
+  EXPECT_THROW(plain.Deserialize(bytes.data(), bytes.size(), restored.get()),
+               std::runtime_error);
+}
+
+TEST_F(ContextSerializationTest, UnregisteredType) {
+  source_->FixInputPort(1, std::make_unique<Value<Opaque>>());
+  std::vector<uint8_t> bytes;
+  EXPECT_THROW(serializer_.Serialize(*source_, &bytes), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
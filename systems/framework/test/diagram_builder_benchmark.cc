@@ -0,0 +1,131 @@
+// Measures the cost of building a flat Diagram with many subsystems, and of
+// allocating and cloning its Context. Run with --help for options.
+//
+// The synthetic model resembles a traffic simulation: each lane is a chain of
+// cars, where every car follows the position of the car ahead of it, and the
+// leading car of each lane follows an input of the Diagram.
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/text_logging_gflags.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+DEFINE_int32(num_lanes, 100, "Number of independent chains of cars.");
+DEFINE_int32(cars_per_lane, 100, "Number of cars in each chain.");
+DEFINE_int32(iterations, 10, "Number of timed repetitions of each test.");
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// A car with a position and a velocity, which reports its position and
+// accelerates towards the position of the car ahead.
+class Car final : public LeafSystem<double> {
+ public:
+  Car() {
+    this->DeclareContinuousState(1, 1, 0);
+    this->DeclareInputPort(kVectorValued, 1);
+    this->DeclareVectorOutputPort(BasicVector<double>(1), &Car::CalcPosition);
+  }
+
+ private:
+  void CalcPosition(const Context<double>& context,
+                    BasicVector<double>* position) const {
+    position->SetAtIndex(0,
+                         context.get_continuous_state_vector().GetAtIndex(0));
+  }
+
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    const double leader = this->EvalVectorInput(context, 0)->GetAtIndex(0);
+    derivatives->get_mutable_vector().SetAtIndex(0, x.GetAtIndex(1));
+    derivatives->get_mutable_vector().SetAtIndex(
+        1, leader - x.GetAtIndex(0) - x.GetAtIndex(1));
+  }
+};
+
+std::unique_ptr<Diagram<double>> MakeTraffic(int num_lanes,
+                                             int cars_per_lane) {
+  DiagramBuilder<double> builder;
+  for (int lane = 0; lane < num_lanes; ++lane) {
+    const Car* leader = nullptr;
+    for (int i = 0; i < cars_per_lane; ++i) {
+      auto car = builder.AddSystem<Car>();
+      car->set_name("car_" + std::to_string(lane) + "_" + std::to_string(i));
+      if (leader == nullptr) {
+        builder.ExportInput(car->get_input_port(0));
+      } else {
+        builder.Connect(leader->get_output_port(0), car->get_input_port(0));
+      }
+      leader = car;
+    }
+    builder.ExportOutput(leader->get_output_port(0));
+  }
+  return builder.Build();
+}
+
+int do_main() {
+  DRAKE_DEMAND(FLAGS_num_lanes >= 1);
+  DRAKE_DEMAND(FLAGS_cars_per_lane >= 1);
+  DRAKE_DEMAND(FLAGS_iterations >= 1);
+
+  double build_seconds = 0;
+  double create_seconds = 0;
+  double clone_seconds = 0;
+  for (int k = 0; k < FLAGS_iterations; ++k) {
+    const Clock::time_point build_start = Clock::now();
+    const std::unique_ptr<Diagram<double>> diagram =
+        MakeTraffic(FLAGS_num_lanes, FLAGS_cars_per_lane);
+    build_seconds += SecondsSince(build_start);
+
+    const Clock::time_point create_start = Clock::now();
+    const std::unique_ptr<Context<double>> context =
+        diagram->CreateDefaultContext();
+    create_seconds += SecondsSince(create_start);
+
+    const Clock::time_point clone_start = Clock::now();
+    const std::unique_ptr<Context<double>> clone = context->Clone();
+    DRAKE_DEMAND(clone != nullptr);
+    clone_seconds += SecondsSince(clone_start);
+  }
+
+  std::cout << "Traffic Diagram: " << FLAGS_num_lanes << " lanes of "
+            << FLAGS_cars_per_lane << " cars, "
+            << FLAGS_num_lanes * FLAGS_cars_per_lane << " subsystems\n";
+  std::cout << "  add systems + Build:  "
+            << build_seconds / FLAGS_iterations * 1e3 << " ms\n";
+  std::cout << "  CreateDefaultContext: "
+            << create_seconds / FLAGS_iterations * 1e3 << " ms\n";
+  std::cout << "  context clone:        "
+            << clone_seconds / FLAGS_iterations * 1e3 << " ms\n";
+  return 0;
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Benchmarks DiagramBuilder::Build() and Context allocation on a flat "
+      "Diagram with a configurable number of subsystems.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::logging::HandleSpdlogGflags();
+  return drake::systems::do_main();
+}
@@ -287,6 +287,27 @@ TEST_F(DiagramContextTest, Clone) {
   }
 }
 
+// Tests that a copy-on-write clone of a DiagramContext is equivalent to a
+// deep copy, and that writes through either context, including through the
+// diagram-level state, stay private to it.
+TEST_F(DiagramContextTest, CloneCopyOnWrite) {
+  AttachInputPorts();
+
+  std::unique_ptr<Context<double>> clone = context_->CloneCopyOnWrite();
+  ASSERT_NE(dynamic_cast<DiagramContext<double>*>(clone.get()), nullptr);
+  EXPECT_EQ(kTime, clone->get_time());
+  VerifyClonedState(clone->get_state());
+  VerifyClonedParameters(clone->get_parameters());
+
+  clone->get_mutable_continuous_state_vector().SetAtIndex(0, 1024.0);
+  EXPECT_EQ(1024.0, clone->get_continuous_state()[0]);
+  EXPECT_EQ(42.0, context_->get_continuous_state()[0]);
+
+  context_->get_mutable_continuous_state_vector().SetAtIndex(1, 2048.0);
+  EXPECT_EQ(2048.0, context_->get_continuous_state()[1]);
+  EXPECT_EQ(43.0, clone->get_continuous_state()[1]);
+}
+
 TEST_F(DiagramContextTest, CloneState) {
   std::unique_ptr<State<double>> state = context_->CloneState();
   // Verify that the state was copied.
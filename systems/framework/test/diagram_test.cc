@@ -474,6 +474,12 @@ TEST_F(DiagramTest, Witness) {
   // Stateless function always returns the ClockWitness.
   ASSERT_EQ(wf.size(), 1);
   EXPECT_LT(diagram_->CalcWitnessValue(*context_, *wf.front()), 0);
+
+  // The batched evaluation gives the same values.
+  VectorX<double> values;
+  diagram_->CalcWitnessValues(*context_, wf, &values);
+  ASSERT_EQ(values.size(), 1);
+  EXPECT_EQ(values[0], diagram_->CalcWitnessValue(*context_, *wf.front()));
 }
 
 // Tests that the diagram exports the correct topology.
@@ -597,6 +603,36 @@ TEST_F(DiagramTest, CalcTimeDerivatives) {
   EXPECT_EQ(27, integrator1_xcdot.get_vector().GetAtIndex(2));
 }
 
+// Tests that evaluating the subsystems concurrently produces the same time
+// derivatives as evaluating them serially.
+TEST_F(DiagramTest, CalcTimeDerivativesInParallel) {
+  AttachInputs();
+  EXPECT_EQ(diagram_->get_num_evaluation_threads(), 1);
+  EXPECT_THROW(diagram_->set_num_evaluation_threads(0), std::logic_error);
+
+  std::unique_ptr<ContinuousState<double>> serial =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, serial.get());
+
+  diagram_->set_num_evaluation_threads(4);
+  EXPECT_EQ(diagram_->get_num_evaluation_threads(), 4);
+  std::unique_ptr<ContinuousState<double>> parallel =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, parallel.get());
+  EXPECT_EQ(parallel->CopyToVector(), serial->CopyToVector());
+
+  // The subsystem inputs are no longer frozen once the derivatives are done,
+  // so the outputs follow later changes to the inputs.
+  auto diagram_context = dynamic_cast<DiagramContext<double>*>(context_.get());
+  ASSERT_NE(diagram_context, nullptr);
+  EXPECT_FALSE(diagram_context->get_subsystem_inputs_frozen());
+  context_->FixInputPort(0, BasicVector<double>::Make({0, 0, 0}));
+  diagram_->CalcTimeDerivatives(*context_, parallel.get());
+  const ContinuousState<double>& integrator0_xcdot =
+      diagram_->GetSubsystemDerivatives(*parallel, integrator0());
+  EXPECT_EQ(8, integrator0_xcdot.get_vector().GetAtIndex(0));
+}
+
 // Tests the AllocateInput logic.
 TEST_F(DiagramTest, AllocateInputs) {
   auto context = diagram_->CreateDefaultContext();
@@ -841,6 +877,65 @@ TEST_F(DiagramOfDiagramsTest, Graphviz) {
   EXPECT_NE(std::string::npos, dot.find("_" + id0 + "_y0 -> _" + id1 + "_u0"));
 }
 
+// Tests that the computations of every subsystem are timed when profiling is
+// enabled, including those within subdiagrams, and that calls nest.
+TEST_F(DiagramOfDiagramsTest, Profiling) {
+  EXPECT_FALSE(diagram_->get_profiling_enabled());
+  EXPECT_EQ(diagram_->get_profile(), nullptr);
+  diagram_->set_profiling_enabled(true);
+  EXPECT_TRUE(subdiagram0_->get_profiling_enabled());
+  ASSERT_NE(diagram_->get_profile(), nullptr);
+  EXPECT_EQ(subdiagram1_->get_profile(), diagram_->get_profile());
+
+  std::unique_ptr<ContinuousState<double>> derivatives =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+  diagram_->CalcOutput(*context_, output_.get());
+
+  int64_t num_integrator_calls = 0;
+  for (const DiagramProfile::Entry& entry :
+       diagram_->get_profile()->GetEntries()) {
+    EXPECT_GE(entry.total_time, entry.self_time);
+    EXPECT_GE(entry.self_time, 0.0);
+    if (entry.system_name == "integrator0" &&
+        entry.category == DiagramProfile::Category::kTimeDerivatives) {
+      num_integrator_calls = entry.num_calls;
+    }
+  }
+  // Both subdiagrams contain a subsystem named integrator0.
+  EXPECT_EQ(num_integrator_calls, 2);
+
+  // The derivatives of integrator0 in subdiagram0 depend on the output of
+  // adder0, which is computed while they are.
+  std::stringstream folded;
+  diagram_->get_profile()->WriteFoldedStacks(&folded);
+  EXPECT_NE(folded.str().find(
+                "subdiagram0:time_derivatives;integrator0:time_derivatives;"
+                "adder0:output "),
+            std::string::npos);
+
+  diagram_->get_mutable_profile()->Clear();
+  EXPECT_TRUE(diagram_->get_profile()->GetEntries().empty());
+  diagram_->set_profiling_enabled(false);
+  EXPECT_FALSE(subdiagram0_->get_profiling_enabled());
+}
+
+// Tests that subdiagrams are evaluated correctly when both they and the
+// enclosing diagram evaluate their subsystems concurrently.
+TEST_F(DiagramOfDiagramsTest, CalcTimeDerivativesInParallel) {
+  std::unique_ptr<ContinuousState<double>> serial =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, serial.get());
+
+  diagram_->set_num_evaluation_threads(2);
+  subdiagram0_->set_num_evaluation_threads(2);
+  subdiagram1_->set_num_evaluation_threads(2);
+  std::unique_ptr<ContinuousState<double>> parallel =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, parallel.get());
+  EXPECT_EQ(parallel->CopyToVector(), serial->CopyToVector());
+}
+
 // Tests that a diagram composed of diagrams can be evaluated.
 TEST_F(DiagramOfDiagramsTest, EvalOutput) {
   diagram_->CalcOutput(*context_, output_.get());
@@ -0,0 +1,168 @@
+#include "drake/systems/framework/fixed_size_vector_system.h"
+
+#include <memory>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A damped pendulum with a torque input, which outputs its angle.  The
+// dynamics are θ̈ = u − sin(θ) − b θ̇.
+template <typename T>
+class Pendulum final : public FixedSizeVectorSystem<T, 2, 1, 1> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Pendulum)
+
+  using Base = FixedSizeVectorSystem<T, 2, 1, 1>;
+
+  explicit Pendulum(double damping)
+      : Base(SystemTypeTag<systems::Pendulum>{}), damping_(damping) {
+    this->DeclareContinuousState(2);
+  }
+
+  template <typename U>
+  explicit Pendulum(const Pendulum<U>& other) : Pendulum(other.damping()) {}
+
+  double damping() const { return damping_; }
+
+ private:
+  // The output is the angle only, which does not depend on the input.
+  optional<bool> DoHasDirectFeedthrough(int, int) const final { return false; }
+
+  void DoCalcFixedSizeOutput(
+      const Context<T>&,
+      const Eigen::Map<const typename Base::InputVector>&,
+      const Eigen::Map<const typename Base::StateVector>& state,
+      Eigen::Map<typename Base::OutputVector>* output) const final {
+    (*output)(0) = state(0);
+  }
+
+  void DoCalcFixedSizeTimeDerivatives(
+      const Context<T>&,
+      const Eigen::Map<const typename Base::InputVector>& input,
+      const Eigen::Map<const typename Base::StateVector>& state,
+      Eigen::Map<typename Base::StateVector>* derivatives) const final {
+    using std::sin;
+    (*derivatives)(0) = state(1);
+    (*derivatives)(1) = input(0) - sin(state(0)) - damping_ * state(1);
+  }
+
+  const double damping_;
+};
+
+// x[n+1] = A x[n] + B u[n], y[n] = x[n] + u[n].
+class DiscreteSystem final : public FixedSizeVectorSystem<double, 2, 2, 2> {
+ public:
+  DiscreteSystem() {
+    this->DeclareDiscreteState(2);
+    this->DeclarePeriodicDiscreteUpdate(0.1);
+  }
+
+ private:
+  void DoCalcFixedSizeOutput(const Context<double>&,
+                             const Eigen::Map<const InputVector>& input,
+                             const Eigen::Map<const StateVector>& state,
+                             Eigen::Map<OutputVector>* output) const final {
+    *output = state + input;
+  }
+
+  void DoCalcFixedSizeDiscreteVariableUpdates(
+      const Context<double>&, const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<StateVector>* next_state) const final {
+    const Eigen::Matrix2d A = (Eigen::Matrix2d() << 1., 0.1, 0., 1.).finished();
+    *next_state = A * state + 2. * input;
+  }
+};
+
+// Declares state but does not override the dynamics.
+class ForgetfulSystem final : public FixedSizeVectorSystem<double, 1, 0, 0> {
+ public:
+  ForgetfulSystem() { this->DeclareContinuousState(1); }
+};
+
+GTEST_TEST(FixedSizeVectorSystemTest, Sizes) {
+  using Base = FixedSizeVectorSystem<double, 2, 1, 1>;
+  EXPECT_EQ(Base::kNumStates, 2);
+  EXPECT_EQ(Base::kNumInputs, 1);
+  EXPECT_EQ(Base::kNumOutputs, 1);
+
+  const Pendulum<double> dut(0.5);
+  EXPECT_EQ(dut.get_input_port().size(), 1);
+  EXPECT_EQ(dut.get_output_port().size(), 1);
+  EXPECT_EQ(dut.CreateDefaultContext()->get_continuous_state().size(), 2);
+  EXPECT_FALSE(dut.HasAnyDirectFeedthrough());
+}
+
+GTEST_TEST(FixedSizeVectorSystemTest, ContinuousDynamics) {
+  const Pendulum<double> dut(0.5);
+  auto context = dut.CreateDefaultContext();
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Eigen::Vector2d(0.3, -1.2));
+  context->FixInputPort(0, Eigen::VectorXd::Constant(1, 0.7));
+
+  auto derivatives = dut.AllocateTimeDerivatives();
+  dut.CalcTimeDerivatives(*context, derivatives.get());
+  EXPECT_TRUE(CompareMatrices(
+      derivatives->CopyToVector(),
+      Eigen::Vector2d(-1.2, 0.7 - std::sin(0.3) + 0.5 * 1.2), 1e-15));
+
+  auto output = dut.AllocateOutput(*context);
+  dut.CalcOutput(*context, output.get());
+  EXPECT_EQ(output->get_vector_data(0)->GetAtIndex(0), 0.3);
+}
+
+GTEST_TEST(FixedSizeVectorSystemTest, AutoDiff) {
+  const Pendulum<double> dut(0.5);
+  const std::unique_ptr<System<AutoDiffXd>> autodiff_dut = dut.ToAutoDiffXd();
+  auto context = autodiff_dut->CreateDefaultContext();
+  const AutoDiffXd theta(0.3, Eigen::Vector2d(1., 0.));
+  const AutoDiffXd theta_dot(-1.2, Eigen::Vector2d(0., 1.));
+  context->get_mutable_continuous_state_vector().SetAtIndex(0, theta);
+  context->get_mutable_continuous_state_vector().SetAtIndex(1, theta_dot);
+  context->FixInputPort(0, VectorX<AutoDiffXd>::Constant(1, AutoDiffXd(0.)));
+
+  auto derivatives = autodiff_dut->AllocateTimeDerivatives();
+  autodiff_dut->CalcTimeDerivatives(*context, derivatives.get());
+  const AutoDiffXd theta_ddot = derivatives->get_vector().GetAtIndex(1);
+  EXPECT_TRUE(CompareMatrices(theta_ddot.derivatives(),
+                              Eigen::Vector2d(-std::cos(0.3), -0.5), 1e-15));
+}
+
+GTEST_TEST(FixedSizeVectorSystemTest, DiscreteDynamics) {
+  const DiscreteSystem dut;
+  EXPECT_TRUE(dut.HasAnyDirectFeedthrough());
+  auto context = dut.CreateDefaultContext();
+  context->get_mutable_discrete_state(0).SetFromVector(
+      Eigen::Vector2d(1., 2.));
+  context->FixInputPort(0, Eigen::Vector2d(-1., 3.));
+
+  auto update = dut.AllocateDiscreteVariables();
+  dut.CalcDiscreteVariableUpdates(*context, update.get());
+  EXPECT_TRUE(CompareMatrices(update->get_vector(0).CopyToVector(),
+                              Eigen::Vector2d(1.2 - 2., 2. + 6.), 1e-15));
+
+  auto output = dut.AllocateOutput(*context);
+  dut.CalcOutput(*context, output.get());
+  EXPECT_TRUE(CompareMatrices(output->get_vector_data(0)->CopyToVector(),
+                              Eigen::Vector2d(0., 5.)));
+}
+
+GTEST_TEST(FixedSizeVectorSystemTest, MissingOverrideThrows) {
+  const ForgetfulSystem dut;
+  auto context = dut.CreateDefaultContext();
+  auto derivatives = dut.AllocateTimeDerivatives();
+  EXPECT_THROW(dut.CalcTimeDerivatives(*context, derivatives.get()),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
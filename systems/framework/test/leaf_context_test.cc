@@ -315,6 +315,36 @@ TEST_F(LeafContextTest, Clone) {
   EXPECT_EQ(1.0, context_.get_numeric_parameter(0).GetAtIndex(0));
 }
 
+// Tests that a copy-on-write clone shares the numeric and owned abstract
+// values of the original until either context writes to them.
+TEST_F(LeafContextTest, CloneCopyOnWrite) {
+  std::unique_ptr<Context<double>> clone = context_.CloneCopyOnWrite();
+  EXPECT_EQ(kTime, clone->get_time());
+  VerifyClonedState(clone->get_state());
+  const Context<double>& const_clone = *clone;
+  EXPECT_EQ(&const_clone.get_continuous_state_vector().GetAtIndex(0),
+            &context_.get_continuous_state_vector().GetAtIndex(0));
+  EXPECT_EQ(&const_clone.get_abstract_parameter(0),
+            &context_.get_abstract_parameter(0));
+
+  // Writes to the clone do not affect the original.
+  clone->get_mutable_continuous_state()[0] = 81.0;
+  EXPECT_EQ(1.0, context_.get_continuous_state_vector().GetAtIndex(0));
+  clone->get_mutable_discrete_state(1)[0] = 243.0;
+  EXPECT_EQ(256.0, context_.get_discrete_state(1).GetAtIndex(0));
+  clone->get_mutable_abstract_state<int>(0) = 729;
+  EXPECT_EQ(42, context_.get_abstract_state<int>(0));
+
+  // Nor do writes to the original affect the clone.
+  context_.get_mutable_numeric_parameter(0)[0] = 76.0;
+  EXPECT_EQ(1.0, clone->get_numeric_parameter(0).GetAtIndex(0));
+  context_.get_mutable_abstract_parameter(0);
+  EXPECT_NE(&const_clone.get_abstract_parameter(0),
+            &context_.get_abstract_parameter(0));
+  context_.get_mutable_discrete_state(0)[0] = 2.0;
+  EXPECT_EQ(128.0, clone->get_discrete_state(0).GetAtIndex(0));
+}
+
 // Tests that a LeafContext can provide a clone of its State.
 TEST_F(LeafContextTest, CloneState) {
   std::unique_ptr<State<double>> clone = context_.CloneState();
@@ -395,6 +425,13 @@ TEST_F(LeafContextTest, SetTimeStateAndParametersFrom) {
   context_.set_accuracy(accuracy);
   target.SetTimeStateAndParametersFrom(context_);
   EXPECT_EQ(target.get_accuracy(), accuracy);
+
+  // Parameters alone can be brought over, too.
+  context_.get_mutable_numeric_parameter(0).SetAtIndex(1, 7.0);
+  context_.set_time(kTime + 1);
+  target.SetParametersFrom(context_);
+  EXPECT_EQ(7.0, target.get_numeric_parameter(0).GetAtIndex(1).value());
+  EXPECT_EQ(kTime, target.get_time());
 }
 
 // Verifies that accuracy is set properly.
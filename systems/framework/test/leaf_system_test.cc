@@ -1292,6 +1292,11 @@ GTEST_TEST(LeafSystemScalarConverterTest, AutoDiffYes) {
   ASSERT_NE(maybe, nullptr);
   EXPECT_EQ(maybe->get_name(), "special_name");
 
+  // Instance method that converts once, and then returns the same twin.
+  const System<AutoDiffXd>& twin = dut.GetOrCreateAutoDiffXd();
+  EXPECT_EQ(twin.get_name(), "special_name");
+  EXPECT_EQ(&dut.GetOrCreateAutoDiffXd(), &twin);
+
   // Spot check the specific converter object.
   EXPECT_TRUE((
       dut.get_system_scalar_converter().IsConvertible<AutoDiffXd, double>()));
@@ -1312,6 +1317,9 @@ GTEST_TEST(LeafSystemScalarConverterTest, AutoDiffNo) {
 
   // Instance method that reports failures via nullptr.
   EXPECT_EQ(dut.ToAutoDiffXdMaybe(), nullptr);
+
+  // Instance method that keeps the converted twin.
+  EXPECT_THROW(dut.GetOrCreateAutoDiffXd(), std::exception);
 }
 
 // Sanity check the default implementation of ToSymbolic, for cases that
@@ -1333,6 +1341,11 @@ GTEST_TEST(LeafSystemScalarConverterTest, SymbolicYes) {
   auto maybe = dut.ToSymbolicMaybe();
   ASSERT_NE(maybe, nullptr);
   EXPECT_EQ(maybe->get_name(), "special_name");
+
+  // Instance method that converts once, and then returns the same twin.
+  const System<symbolic::Expression>& twin = dut.GetOrCreateSymbolic();
+  EXPECT_EQ(twin.get_name(), "special_name");
+  EXPECT_EQ(&dut.GetOrCreateSymbolic(), &twin);
 }
 
 // Sanity check the default implementation of ToSymbolic, for cases that
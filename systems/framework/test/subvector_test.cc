@@ -50,6 +50,22 @@ TEST_F(SubvectorTest, Copy) {
   EXPECT_EQ(expected, subvec.CopyToVector());
 }
 
+// Tests that const reads do not make a copy-on-write BasicVector take a
+// private copy of its values, while writes do.
+TEST_F(SubvectorTest, CopyOnWrite) {
+  const auto& basic = dynamic_cast<const BasicVector<double>&>(*vector_);
+  std::unique_ptr<BasicVector<double>> clone = basic.CloneCopyOnWrite();
+  Subvector<double> subvec(clone.get(), 1, kSubVectorLength);
+  const Subvector<double>& const_subvec = subvec;
+  EXPECT_EQ(2, const_subvec.GetAtIndex(0));
+  EXPECT_EQ(&clone->get_value()[0], &basic.get_value()[0]);
+
+  subvec.SetAtIndex(0, 5);
+  EXPECT_NE(&clone->get_value()[0], &basic.get_value()[0]);
+  EXPECT_EQ(2, basic.GetAtIndex(1));
+  EXPECT_EQ(5, clone->GetAtIndex(1));
+}
+
 // Tests that writes to the subvector pass through to the sliced vector.
 TEST_F(SubvectorTest, Mutation) {
   Subvector<double> subvec(vector_.get(), 1, kSubVectorLength);
@@ -111,6 +127,25 @@ TEST_F(SubvectorTest, ScaleAndAddToVector) {
   EXPECT_EQ(expected, target);
 }
 
+// Tests the bulk operations on a Subvector of a vector that is not a
+// BasicVector, which cannot use contiguous storage.
+TEST_F(SubvectorTest, BulkOperationsOnNonContiguousVector) {
+  Subvector<double> outer(vector_.get(), 1, 3);
+  Subvector<double> subvec(&outer, 1, kSubVectorLength);
+  EXPECT_EQ(Eigen::Vector2d(3, 4), subvec.CopyToVector());
+  EXPECT_EQ(4, subvec.NormInf());
+
+  subvec.SetFromVector(Eigen::Vector2d(-5, 6));
+  EXPECT_EQ(-5, vector_->GetAtIndex(2));
+  subvec.PlusEqScaled(2, *BasicVector<double>::Make({1, 1}));
+  Eigen::Vector2d copy;
+  subvec.CopyToPreSizedVector(copy);
+  EXPECT_EQ(Eigen::Vector2d(-3, 8), copy);
+
+  subvec.SetZero();
+  EXPECT_EQ(Eigen::Vector4d(1, 2, 0, 0), vector_->CopyToVector());
+}
+
 // TODO(david-german-tri): Once GMock is available in the Drake build, add a
 // test case demonstrating that the += operator on Subvector calls
 // ScaleAndAddToVector on the addend.
@@ -65,6 +65,51 @@ TEST_F(SupervectorTest, ArrayOperator) {
   EXPECT_EQ(8, (*supervector_)[8]);
 }
 
+// Tests the bulk operations, which are delegated to the constituent vectors.
+TEST_F(SupervectorTest, BulkOperations) {
+  Eigen::VectorXd expected(kLength);
+  expected << 0, 1, 2, 3, 4, 5, 6, 7, 8;
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  Eigen::VectorXd copy = Eigen::VectorXd::Constant(kLength, 1.);
+  supervector_->ScaleAndAddToVector(2., copy);
+  EXPECT_EQ(copy, 2. * expected + Eigen::VectorXd::Constant(kLength, 1.));
+  EXPECT_THROW(supervector_->ScaleAndAddToVector(2., expected.head(3)),
+               std::out_of_range);
+
+  supervector_->SetFromVector(-expected);
+  EXPECT_EQ(-6, vec4_->GetAtIndex(0));
+  EXPECT_EQ(8, supervector_->NormInf());
+  supervector_->CopyToPreSizedVector(copy);
+  EXPECT_EQ(copy, -expected);
+  EXPECT_THROW(supervector_->CopyToPreSizedVector(copy.head(3)),
+               std::out_of_range);
+
+  supervector_->SetZero();
+  EXPECT_EQ(supervector_->CopyToVector(), Eigen::VectorXd::Zero(kLength));
+  EXPECT_EQ(0, supervector_->NormInf());
+}
+
+// Tests PlusEqScaled, both with addends partitioned like the Supervector and
+// with others.
+TEST_F(SupervectorTest, PlusEqScaled) {
+  auto other1 = BasicVector<double>::Make({1, 1, 1, 1});
+  auto other2 = BasicVector<double>::Make({1, 1});
+  auto other3 = BasicVector<double>::Make({});
+  auto other4 = BasicVector<double>::Make({1, 1, 1});
+  const Supervector<double> other(std::vector<VectorBase<double>*>{
+      other1.get(), other2.get(), other3.get(), other4.get()});
+  const Eigen::VectorXd expected = supervector_->CopyToVector();
+
+  supervector_->PlusEqScaled({{2., other}, {-1., other}});
+  EXPECT_EQ(supervector_->CopyToVector(),
+            expected + Eigen::VectorXd::Ones(kLength));
+
+  const BasicVector<double> flat(Eigen::VectorXd::Ones(kLength));
+  supervector_->PlusEqScaled(-1., flat);
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+}
+
 TEST_F(SupervectorTest, OutOfRange) {
   EXPECT_THROW(supervector_->GetAtIndex(-1), std::out_of_range);
   EXPECT_THROW(supervector_->GetAtIndex(10), std::out_of_range);
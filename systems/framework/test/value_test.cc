@@ -204,6 +204,9 @@ TYPED_TEST(TypedValueTest, Mutation) {
   EXPECT_EQ(9, erased.GetValue<T>());
   erased.SetFromOrThrow(Value<T>(10));
   EXPECT_EQ(10, erased.GetValue<T>());
+  T eleven{11};
+  value.set_value(std::move(eleven));
+  EXPECT_EQ(11, erased.GetValue<T>());
 }
 
 TYPED_TEST(TypedValueTest, BadCast) {
@@ -255,6 +258,16 @@ class Point : public PrintInterface {
 };
 
 // Tests that classes can be erased in an AbstractValue.
+// set_value() moves from an rvalue, so it reuses the storage of the argument.
+GTEST_TEST(ValueTest, MoveSetValue) {
+  std::vector<double> data(100, 1.0);
+  const double* const buffer = data.data();
+  Value<std::vector<double>> value;
+  value.set_value(std::move(data));
+  EXPECT_EQ(value.get_value().size(), 100);
+  EXPECT_EQ(value.get_value().data(), buffer);
+}
+
 GTEST_TEST(ValueTest, ClassType) {
   Point point(1, 2);
   Value<Point> value(point);
@@ -41,6 +41,9 @@ struct ValueTraitsImpl<T, true> {
     DRAKE_DEMAND(other.get() != nullptr);
     return *other;
   }
+  static void move_assign(Storage* storage, T&& other) {
+    *storage = std::move(other);
+  }
   static const T& access(const Storage& storage) { return storage; }
   // NOLINTNEXTLINE(runtime/references)
   static T& access(Storage& storage) { return storage; }
@@ -75,6 +78,17 @@ struct ValueTraitsImpl<T, false> {
     DRAKE_DEMAND(other.get() != nullptr);
     return Storage{std::move(other)};
   }
+  // Moves other into a new T when T is move-constructible, instead of
+  // cloning it.
+  static void move_assign(Storage* storage, T&& other) {
+    move_assign(storage, std::move(other), std::is_move_constructible<T>{});
+  }
+  static void move_assign(Storage* storage, T&& other, std::true_type) {
+    *storage = std::make_unique<T>(std::move(other));
+  }
+  static void move_assign(Storage* storage, T&& other, std::false_type) {
+    *storage = to_storage(other);
+  }
   static const T& access(const Storage& storage) { return *storage; }
   // NOLINTNEXTLINE(runtime/references)
   static T& access(Storage& storage) { return *storage; }
@@ -108,7 +122,9 @@ class AbstractValue {
   /// Returns a copy of this AbstractValue.
   virtual std::unique_ptr<AbstractValue> Clone() const = 0;
 
-  /// Copies or clones the value in @p other to this value.
+  /// Copies or clones the value in @p other to this value. Copyable values
+  /// are copy-assigned in place, so they reuse any storage they own (e.g., the
+  /// capacity of a std::vector).
   /// In Debug builds, if the types don't match, an std::logic_error will be
   /// thrown with a helpful error message. In Release builds, this is not
   /// guaranteed.
@@ -355,6 +371,10 @@ class Value : public AbstractValue {
   /// Replaces the stored value with a new one.
   void set_value(const T& v) { value_ = Traits::to_storage(v); }
 
+  /// Replaces the stored value with a new one, by moving from @p v when T is
+  /// movable, instead of copying or cloning it.
+  void set_value(T&& v) { Traits::move_assign(&value_, std::move(v)); }
+
  private:
   using Traits = value_detail::ValueTraits<T>;
   typename Traits::Storage value_;
@@ -103,6 +103,18 @@ class VectorBase {
     return vec;
   }
 
+  /// Copies the entire state to a pre-sized vector with no semantics.
+  ///
+  /// Implementations should ensure this operation is O(N) in the size of the
+  /// value and allocates no memory.
+  /// @throws std::out_of_range if @p vec is not the same size as this vector.
+  virtual void CopyToPreSizedVector(Eigen::Ref<VectorX<T>> vec) const {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination must be the same size.");
+    }
+    for (int i = 0; i < size(); ++i) vec[i] = GetAtIndex(i);
+  }
+
   /// Adds a scaled version of this vector to Eigen vector @p vec, which
   /// must be the same size.
   ///
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -212,7 +213,7 @@ class VectorSystem : public LeafSystem<T> {
     // create a computational loop.
     static const never_destroyed<VectorX<T>> empty_vector(0);
     Eigen::VectorBlock<const VectorX<T>> input_block =
-        this->HasAnyDirectFeedthrough() ? EvalVectorInput(context) :
+        HasAnyDirectFeedthroughLatched() ? EvalVectorInput(context) :
         empty_vector.access().segment(0, 0);
 
     // Obtain the block form of xc or xd.
@@ -289,6 +290,24 @@ class VectorSystem : public LeafSystem<T> {
     unused(context, input, state);
     DRAKE_THROW_UNLESS(next_state->size() == 0);
   }
+
+ private:
+  // Returns HasAnyDirectFeedthrough(), which is latch-initialized the first
+  // time it is needed because answering it may require a symbolic form of
+  // this system, which is much too expensive to create on every output
+  // evaluation. Concurrent first calls merely compute the same answer twice.
+  bool HasAnyDirectFeedthroughLatched() const {
+    int latched = has_any_direct_feedthrough_.load(std::memory_order_relaxed);
+    if (latched < 0) {
+      latched = this->HasAnyDirectFeedthrough() ? 1 : 0;
+      has_any_direct_feedthrough_.store(latched, std::memory_order_relaxed);
+    }
+    return latched == 1;
+  }
+
+  // Negative until HasAnyDirectFeedthroughLatched() is first called, then 1
+  // if there is any direct feedthrough and 0 otherwise.
+  mutable std::atomic<int> has_any_direct_feedthrough_{-1};
 };
 
 }  // namespace systems
@@ -74,7 +74,9 @@ class LcmAndVectorBaseTranslator {
    * @param[in] vector_base The object to convert into an LCM message.
    *
    * @param[out] lcm_message_bytes The LCM message bytes.
-   * This pointer must not be `nullptr`.
+   * This pointer must not be `nullptr`. Implementations must resize it to fit
+   * the message, discarding any previous contents, so that callers can reuse
+   * the same buffer for every message.
    */
   virtual void Serialize(double time,
       const VectorBase<double>& vector_base,
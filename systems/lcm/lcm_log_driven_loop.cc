@@ -0,0 +1,61 @@
+#include "drake/systems/lcm/lcm_log_driven_loop.h"
+
+#include <cmath>
+#include <limits>
+
+namespace drake {
+namespace systems {
+namespace lcm {
+
+namespace {
+// How long after receiving a message an LcmSubscriberSystem processes it.
+// TODO(siyuan): should be zero once #5725 is resolved.
+constexpr double kMessageProcessingDelay = 0.0001;
+}  // namespace
+
+LcmLogDrivenLoop::LcmLogDrivenLoop(const System<double>& system,
+                                   std::unique_ptr<Context<double>> context,
+                                   drake::lcm::DrakeLcmLog* log)
+    : log_(log),
+      stepper_(
+          std::make_unique<Simulator<double>>(system, std::move(context))) {
+  DRAKE_DEMAND(log != nullptr);
+  DRAKE_DEMAND(!log->is_write());
+
+  log_->set_skip_unsubscribed_channels(true);
+
+  // Disables simulator's publish on its internal time step.
+  stepper_->set_publish_every_time_step(false);
+  stepper_->set_target_realtime_rate(0);
+  stepper_->Initialize();
+}
+
+void LcmLogDrivenLoop::RunToSecondsAssumingInitialized(double stop_time) {
+  double last_msg_time = -std::numeric_limits<double>::infinity();
+  while (true) {
+    const double msg_time = log_->GetNextMessageTime();
+    if (std::isinf(msg_time) || msg_time > stop_time) break;
+
+    if (msg_time > stepper_->get_context().get_time()) {
+      stepper_->StepTo(msg_time);
+    }
+
+    // Dispatches all the messages that occur at the exact same time.
+    while (log_->GetNextMessageTime() == msg_time) {
+      log_->DispatchMessageAndAdvanceLog(msg_time);
+    }
+    last_msg_time = msg_time;
+  }
+
+  // Lets the subscribers process the last messages.
+  const double end_time = std::isinf(stop_time)
+                              ? last_msg_time + kMessageProcessingDelay
+                              : stop_time;
+  if (end_time > stepper_->get_context().get_time()) {
+    stepper_->StepTo(end_time);
+  }
+}
+
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
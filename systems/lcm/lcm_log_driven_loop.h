@@ -0,0 +1,97 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/lcm/drake_lcm_log.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace systems {
+namespace lcm {
+
+/**
+ * This class implements a loop that replays an LCM log through a System, as
+ * fast as the System can process it. It is the offline counterpart of
+ * LcmDrivenLoop: rather than blocking on messages from live LCM, it takes
+ * them from a drake::lcm::DrakeLcmLog, in the log's timestamp order, and
+ * slaves the context time to the log's timestamps. The main loop
+ * conceptually is:
+ * <pre>
+ * while (log.next_message_time <= stop_time) {
+ *   simulator.StepTo(log.next_message_time);
+ *   dispatch every message with that time to its subscribers;
+ * }
+ * simulator.StepTo(stop_time);
+ * </pre>
+ *
+ * The LcmSubscriberSystem(s) in @p system must have been constructed with
+ * the log as their drake::lcm::DrakeLcmInterface. Only the channels that
+ * are subscribed to are visited (see
+ * drake::lcm::DrakeLcmLog::set_skip_unsubscribed_channels()), and the log
+ * file is read ahead of playback in the background, so that replay does not
+ * wait on the disk.
+ *
+ * Nothing here depends on wall-clock time or on other threads, so replaying
+ * a log gives the same results every time. Each loop owns all of its state,
+ * so many logs can be replayed concurrently, one loop per thread.
+ *
+ * A subscriber processes its messages in an update event shortly after they
+ * are dispatched. When several messages on the same channel may arrive
+ * closer together than that, construct the subscriber with
+ * LcmMessageQueuePolicy::kKeepAll so that none of them is superseded before
+ * it is processed.
+ */
+class LcmLogDrivenLoop {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmLogDrivenLoop)
+
+  /**
+   * Constructor.
+   * @param system Const reference to the handler system. Its life span must be
+   * longer than `this`.
+   * @param context Unique pointer to a context allocated for @p system. Can be
+   * nullptr, in which case a context will be allocated internally.
+   * @param log Pointer to a log opened for reading. Its life span must be
+   * longer than `this`. @p log cannot be nullptr, otherwise aborts.
+   */
+  LcmLogDrivenLoop(const System<double>& system,
+                   std::unique_ptr<Context<double>> context,
+                   drake::lcm::DrakeLcmLog* log);
+
+  /**
+   * Dispatches the logged messages up to and including @p stop_time, each
+   * once the context has been advanced to its time, then advances the
+   * context to @p stop_time. With the default @p stop_time, the
+   * whole log is replayed and the context is left just after the last
+   * message, once its subscribers have processed it. Messages earlier than
+   * the context's time are dispatched without stepping back in time.
+   */
+  void RunToSecondsAssumingInitialized(
+      double stop_time = std::numeric_limits<double>::infinity());
+
+  /**
+   * Returns a mutable reference to the context.
+   */
+  Context<double>& get_mutable_context() {
+    return stepper_->get_mutable_context();
+  }
+
+  /**
+   * Returns a mutable reference to the simulator that steps the system, e.g.,
+   * to change its integrator.
+   */
+  Simulator<double>& get_mutable_simulator() { return *stepper_; }
+
+ private:
+  // The log being replayed.
+  drake::lcm::DrakeLcmLog* const log_;
+
+  // Reusing the simulator to manage event handling and state progression.
+  std::unique_ptr<Simulator<double>> stepper_;
+};
+
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
@@ -15,6 +15,10 @@ namespace lcm {
  * This is useful when a simulated Diagram contains LcmSubscriberSystem(s)
  * whose outputs should be determined by logged data and when the log's cursor
  * should advance automatically during simulation.
+ *
+ * To play back only part of a log, call DrakeLcmLog::SeekToTime() before
+ * simulating, and start the simulation at a time earlier than the next
+ * message's.
  */
 class LcmLogPlaybackSystem : public LeafSystem<double> {
  public:
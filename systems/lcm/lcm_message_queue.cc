@@ -0,0 +1,80 @@
+#include "drake/systems/lcm/lcm_message_queue.h"
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+namespace lcm {
+
+LcmMessageQueue::LcmMessageQueue(LcmMessageQueuePolicy policy, int capacity)
+    : policy_(policy) {
+  if (policy_ == LcmMessageQueuePolicy::kKeepLatest) {
+    slots_.resize(3);
+  } else {
+    DRAKE_DEMAND(capacity > 0);
+    slots_.resize(capacity + 1);
+  }
+}
+
+void LcmMessageQueue::Push(const void* data, int size) {
+  const uint8_t* const begin = static_cast<const uint8_t*>(data);
+  const int count = received_count_.load(std::memory_order_relaxed) + 1;
+
+  if (policy_ == LcmMessageQueuePolicy::kKeepLatest) {
+    Message& message = slots_[back_];
+    message.bytes.assign(begin, begin + size);
+    message.count = count;
+    const int previous =
+        middle_.exchange(back_ | kFresh, std::memory_order_acq_rel);
+    if (previous & kFresh) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    back_ = previous & ~kFresh;
+  } else {
+    const int head = head_.load(std::memory_order_relaxed);
+    const int next = Next(head);
+    if (next == tail_.load(std::memory_order_acquire)) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      Message& message = slots_[head];
+      message.bytes.assign(begin, begin + size);
+      message.count = count;
+      head_.store(next, std::memory_order_release);
+    }
+  }
+
+  // Counted last, so that a consumer that sees the new count also finds the
+  // message in the queue.
+  received_count_.store(count, std::memory_order_release);
+}
+
+const LcmMessageQueue::Message* LcmMessageQueue::Front() {
+  if (policy_ == LcmMessageQueuePolicy::kKeepLatest) {
+    if (middle_.load(std::memory_order_acquire) & kFresh) {
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & ~kFresh;
+    }
+    const Message& message = slots_[front_];
+    return (message.count > 0) ? &message : nullptr;
+  }
+  const int tail = tail_.load(std::memory_order_relaxed);
+  if (tail == head_.load(std::memory_order_acquire)) return nullptr;
+  return &slots_[tail];
+}
+
+const LcmMessageQueue::Message* LcmMessageQueue::Back() {
+  if (policy_ == LcmMessageQueuePolicy::kKeepLatest) return Front();
+  const int head = head_.load(std::memory_order_acquire);
+  if (head == tail_.load(std::memory_order_relaxed)) return nullptr;
+  return &slots_[(head == 0) ? slots_.size() - 1 : head - 1];
+}
+
+void LcmMessageQueue::Pop() {
+  if (policy_ == LcmMessageQueuePolicy::kKeepLatest) return;
+  const int tail = tail_.load(std::memory_order_relaxed);
+  if (tail == head_.load(std::memory_order_acquire)) return;
+  tail_.store(Next(tail), std::memory_order_release);
+}
+
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+namespace lcm {
+
+/// Selects which of the messages received by an LcmSubscriberSystem are
+/// processed.
+enum class LcmMessageQueuePolicy {
+  /// Only the most recent message is kept; a message that is superseded
+  /// before it is processed counts as dropped.
+  kKeepLatest,
+  /// Every message is kept, in order of arrival, up to the queue capacity; a
+  /// message that arrives while the queue is full counts as dropped.
+  kKeepAll,
+};
+
+/// A lock-free queue of LCM message bytes that passes messages from a single
+/// producer thread (the LCM receive thread) to a single consumer thread (the
+/// thread that runs the simulation), so that neither ever blocks the other.
+///
+/// The storage for the messages is reused, so once the queue has seen
+/// messages of a given size, pushing and reading them does not allocate.
+class LcmMessageQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmMessageQueue)
+
+  /// A received message and its position in the sequence of messages pushed
+  /// onto the queue, starting from 1.
+  struct Message {
+    std::vector<uint8_t> bytes;
+    int count{0};
+  };
+
+  /// Constructs an empty queue.
+  /// @param capacity The number of messages that a kKeepAll queue can hold;
+  ///                 must be positive. It is ignored by a kKeepLatest queue.
+  LcmMessageQueue(LcmMessageQueuePolicy policy, int capacity);
+
+  LcmMessageQueuePolicy policy() const { return policy_; }
+
+  /// @name Producer
+  /// These may only be called from the producer thread.
+  //@{
+
+  /// Copies the @p size bytes at @p data into the queue, or drops them if a
+  /// kKeepAll queue is full. Either way, the received count is incremented.
+  void Push(const void* data, int size);
+  //@}
+
+  /// @name Consumer
+  /// These may only be called from the consumer thread.
+  //@{
+
+  /// Returns the next message to process: for kKeepLatest, the most recent
+  /// message, which remains available until a newer one arrives; for
+  /// kKeepAll, the oldest message not yet popped. Returns nullptr if there
+  /// is none.
+  const Message* Front();
+
+  /// Returns the most recent message in the queue, or nullptr if there is
+  /// none.
+  const Message* Back();
+
+  /// Discards the message returned by Front(), for kKeepAll. Does nothing
+  /// for kKeepLatest, or if the queue is empty.
+  void Pop();
+  //@}
+
+  /// Returns the number of messages pushed so far. May be called from any
+  /// thread.
+  int received_count() const { return received_count_.load(); }
+
+  /// Returns the number of messages that were dropped without ever being
+  /// returned by Front(). May be called from any thread.
+  int dropped_count() const { return dropped_count_.load(); }
+
+ private:
+  // For kKeepLatest, triple buffering: the producer fills slots_[back_], then
+  // swaps it with the middle slot, whose index is held in middle_ together
+  // with kFresh if the consumer has not taken it yet; the consumer swaps
+  // fresh middle slots with slots_[front_].
+  static constexpr int kFresh = 4;
+
+  // For kKeepAll, a ring in which the producer fills slots_[head_] and the
+  // consumer reads slots_[tail_]; one slot is always left empty, to tell a
+  // full ring from an empty one.
+  int Next(int index) const {
+    return (index + 1 == static_cast<int>(slots_.size())) ? 0 : index + 1;
+  }
+
+  const LcmMessageQueuePolicy policy_;
+  std::vector<Message> slots_;
+
+  // Owned by the producer thread.
+  int back_{0};
+
+  // Owned by the consumer thread.
+  int front_{1};
+
+  std::atomic<int> middle_{2};
+  std::atomic<int> head_{0};
+  std::atomic<int> tail_{0};
+  std::atomic<int> received_count_{0};
+  std::atomic<int> dropped_count_{0};
+};
+
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
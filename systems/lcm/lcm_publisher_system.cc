@@ -87,22 +87,22 @@ void LcmPublisherSystem::DoPublish(const Context<double>& context,
   SPDLOG_TRACE(drake::log(), "Publishing LCM {} message", channel_);
   DRAKE_ASSERT((translator_ != nullptr) != (serializer_.get() != nullptr));
 
-  // Converts the input into LCM message bytes.
-  std::vector<uint8_t> message_bytes;
+  // Converts the input into LCM message bytes, encoding straight from the
+  // input value into the reused buffer.
   if (translator_ != nullptr) {
     const VectorBase<double>* const input_vector =
         this->EvalVectorInput(context, kPortIndex);
     DRAKE_ASSERT(input_vector != nullptr);
-    translator_->Serialize(context.get_time(), *input_vector, &message_bytes);
+    translator_->Serialize(context.get_time(), *input_vector, &message_bytes_);
   } else {
     const AbstractValue* const input_value =
         this->EvalAbstractInput(context, kPortIndex);
     DRAKE_ASSERT(input_value != nullptr);
-    serializer_->Serialize(*input_value, &message_bytes);
+    serializer_->Serialize(*input_value, &message_bytes_);
   }
 
   // Publishes onto the specified LCM channel.
-  lcm_->Publish(channel_, message_bytes.data(), message_bytes.size(),
+  lcm_->Publish(channel_, message_bytes_.data(), message_bytes_.size(),
                 context.get_time());
 }
 
@@ -165,6 +165,11 @@ class LcmPublisherSystem : public LeafSystem<double> {
   // A const pointer to an LCM subsystem. Note that while the pointer is const,
   // the LCM subsystem is not const.
   drake::lcm::DrakeLcmInterface* const lcm_{};
+
+  // The message bytes of the most recent publish. The buffer is reused so
+  // that publishing a message no larger than the previous ones does not
+  // allocate.
+  mutable std::vector<uint8_t> message_bytes_;
 };
 
 }  // namespace lcm
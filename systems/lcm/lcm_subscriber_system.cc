@@ -34,10 +34,12 @@ constexpr int kStateIndexMessageCount = 1;
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel, const LcmAndVectorBaseTranslator* translator,
     std::unique_ptr<SerializerInterface> serializer,
-    drake::lcm::DrakeLcmInterface* lcm)
+    drake::lcm::DrakeLcmInterface* lcm, LcmMessageQueuePolicy queue_policy,
+    int queue_capacity)
     : channel_(channel),
       translator_(translator),
-      serializer_(std::move(serializer)) {
+      serializer_(std::move(serializer)),
+      queue_(queue_policy, queue_capacity) {
   DRAKE_DEMAND((translator_ != nullptr) != (serializer_ != nullptr));
   DRAKE_DEMAND(lcm);
 
@@ -66,13 +68,17 @@ LcmSubscriberSystem::LcmSubscriberSystem(
 
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel, std::unique_ptr<SerializerInterface> serializer,
-    DrakeLcmInterface* lcm)
-    : LcmSubscriberSystem(channel, nullptr, std::move(serializer), lcm) {}
+    DrakeLcmInterface* lcm, LcmMessageQueuePolicy queue_policy,
+    int queue_capacity)
+    : LcmSubscriberSystem(channel, nullptr, std::move(serializer), lcm,
+                          queue_policy, queue_capacity) {}
 
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel, const LcmAndVectorBaseTranslator& translator,
-    DrakeLcmInterface* lcm)
-    : LcmSubscriberSystem(channel, &translator, nullptr, lcm) {}
+    DrakeLcmInterface* lcm, LcmMessageQueuePolicy queue_policy,
+    int queue_capacity)
+    : LcmSubscriberSystem(channel, &translator, nullptr, lcm, queue_policy,
+                          queue_capacity) {}
 
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel,
@@ -85,12 +91,26 @@ LcmSubscriberSystem::~LcmSubscriberSystem() {}
 
 void LcmSubscriberSystem::SetDefaultState(const Context<double>&,
                                           State<double>* state) const {
+  // Starts from an empty message. When only the latest message matters, the
+  // default state already holds it, as if it had just been processed; when
+  // every message matters, they are all left to be processed by updates.
+  const bool process_latest =
+      queue_.policy() == LcmMessageQueuePolicy::kKeepLatest;
   if (translator_ != nullptr) {
     DRAKE_DEMAND(serializer_ == nullptr);
-    ProcessMessageAndStoreToDiscreteState(&state->get_mutable_discrete_state());
+    DiscreteValues<double>& discrete_state = state->get_mutable_discrete_state();
+    discrete_state.get_mutable_vector(kStateIndexMessage)
+        .SetFrom(*AllocateTranslatorOutputValue());
+    discrete_state.get_mutable_vector(kStateIndexMessageCount).SetAtIndex(0, 0);
+    if (process_latest) ProcessMessageAndStoreToDiscreteState(&discrete_state);
   } else {
     DRAKE_DEMAND(translator_ == nullptr);
-    ProcessMessageAndStoreToAbstractState(&state->get_mutable_abstract_state());
+    AbstractValues& abstract_state = state->get_mutable_abstract_state();
+    abstract_state.get_mutable_value(kStateIndexMessage)
+        .SetFrom(*AllocateSerializerOutputValue());
+    abstract_state.get_mutable_value(kStateIndexMessageCount)
+        .GetMutableValue<int>() = 0;
+    if (process_latest) ProcessMessageAndStoreToAbstractState(&abstract_state);
   }
 }
 
@@ -103,14 +123,15 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToDiscreteState(
   DRAKE_ASSERT(translator_ != nullptr);
   DRAKE_ASSERT(serializer_ == nullptr);
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  const LcmMessageQueue::Message* const message = queue_.Front();
+  if (message != nullptr) {
     translator_->Deserialize(
-        received_message_.data(), received_message_.size(),
+        message->bytes.data(), message->bytes.size(),
         &discrete_state->get_mutable_vector(kStateIndexMessage));
+    discrete_state->get_mutable_vector(kStateIndexMessageCount)
+        .SetAtIndex(0, message->count);
+    queue_.Pop();
   }
-  discrete_state->get_mutable_vector(kStateIndexMessageCount)
-      .SetAtIndex(0, received_message_count_);
 }
 
 void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
@@ -118,14 +139,15 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
   DRAKE_ASSERT(translator_ == nullptr);
   DRAKE_ASSERT(serializer_ != nullptr);
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  const LcmMessageQueue::Message* const message = queue_.Front();
+  if (message != nullptr) {
     serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
+        message->bytes.data(), message->bytes.size(),
         &abstract_state->get_mutable_value(kStateIndexMessage));
+    abstract_state->get_mutable_value(kStateIndexMessageCount)
+        .GetMutableValue<int>() = message->count;
+    queue_.Pop();
   }
-  abstract_state->get_mutable_value(kStateIndexMessageCount)
-      .GetMutableValue<int>() = received_message_count_;
 }
 
 int LcmSubscriberSystem::GetMessageCount(const Context<double>& context) const {
@@ -152,12 +174,9 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
   DRAKE_THROW_UNLESS(std::isinf(*time));
 
   // Do nothing unless we have a new message.
-  const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
-  if (last_message_count == received_message_count) {
+  const LcmMessageQueue::Message* const next_message = queue_.Front();
+  if (next_message == nullptr ||
+      next_message->count == GetMessageCount(context)) {
     return;
   }
 
@@ -255,45 +274,45 @@ void LcmSubscriberSystem::CalcSerializerOutputValue(
 void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   SPDLOG_TRACE(drake::log(), "Receiving LCM {} message", channel_);
 
-  const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
-  const uint8_t* const rbuf_end = rbuf_begin + size;
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
-  received_message_count_++;
+  queue_.Push(buffer, size);
+
+  // Taking the mutex, however briefly, ensures that a WaitForMessage() that
+  // has just found no new message is already waiting when we notify it.
+  { std::lock_guard<std::mutex> lock(received_message_mutex_); }
   received_message_condition_variable_.notify_all();
 }
 
 int LcmSubscriberSystem::WaitForMessage(
     int old_message_count, AbstractValue* message) const {
-  // The message buffer and counter are updated in HandleMessage(), which is
+  // The message queue and counter are updated in HandleMessage(), which is
   // a callback function invoked by a different thread owned by the
-  // drake::lcm::DrakeLcmInterface instance passed to the constructor. Thus,
-  // for thread safety, these need to be properly protected by a mutex.
+  // drake::lcm::DrakeLcmInterface instance passed to the constructor. The
+  // mutex is only needed to sleep until it is called.
   std::unique_lock<std::mutex> lock(received_message_mutex_);
 
   // This while loop is necessary to guard for spurious wakeup:
   // https://en.wikipedia.org/wiki/Spurious_wakeup
-  while (old_message_count >= received_message_count_) {
-    // When wait returns, lock is atomically acquired. So it's thread safe to
-    // read received_message_count_.
+  while (old_message_count >= queue_.received_count()) {
     received_message_condition_variable_.wait(lock);
   }
-  int new_message_count = received_message_count_;
+  lock.unlock();
+
+  const int new_message_count = queue_.received_count();
   if (message) {
-      DRAKE_ASSERT(translator_ == nullptr);
-      DRAKE_ASSERT(serializer_ != nullptr);
+    DRAKE_ASSERT(translator_ == nullptr);
+    DRAKE_ASSERT(serializer_ != nullptr);
+    const LcmMessageQueue::Message* const newest = queue_.Back();
+    if (newest != nullptr) {
       serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+          newest->bytes.data(), newest->bytes.size(), message);
+    }
   }
-  lock.unlock();
 
   return new_message_count;
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
-  return received_message_count_;
+  return queue_.received_count();
 }
 
 const LcmAndVectorBaseTranslator& LcmSubscriberSystem::get_translator() const {
@@ -14,6 +14,7 @@
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/lcm/lcm_and_vector_base_translator.h"
+#include "drake/systems/lcm/lcm_message_queue.h"
 #include "drake/systems/lcm/lcm_translator_dictionary.h"
 #include "drake/systems/lcm/serializer.h"
 
@@ -37,6 +38,15 @@ namespace lcm {
  * operations are taken care of by the Simulator. On the other hand, the user
  * needs to manually replicate this process without the Simulator.
  *
+ * Received messages are passed from the LCM receive thread to the thread that
+ * processes them through a lock-free LcmMessageQueue, so a high message rate
+ * never blocks the simulation. By default only the most recent message is
+ * processed; with LcmMessageQueuePolicy::kKeepAll, every message is processed
+ * in turn, one per update. Messages that are never processed are counted by
+ * GetDroppedMessageCount(). The queue has a single consumer, so all the
+ * methods that process messages, including WaitForMessage(), must be called
+ * from one thread.
+ *
  * If LCM service in use is a drake::lcm::DrakeLcmLog (not live operation),
  * then see drake::systems::lcm::LcmLogPlaybackSystem for a helper to advance
  * the log cursor in concert with the simulation.
@@ -47,6 +57,10 @@ class LcmSubscriberSystem : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmSubscriberSystem)
 
+  /// The default number of messages held by a LcmMessageQueuePolicy::kKeepAll
+  /// subscriber.
+  static constexpr int kDefaultQueueCapacity = 64;
+
   /**
    * Factory method that returns a subscriber System that provides
    * Value<LcmMessage> message objects on its sole abstract-valued output port.
@@ -59,9 +73,12 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    */
   template <typename LcmMessage>
   static std::unique_ptr<LcmSubscriberSystem> Make(
-      const std::string& channel, drake::lcm::DrakeLcmInterface* lcm) {
+      const std::string& channel, drake::lcm::DrakeLcmInterface* lcm,
+      LcmMessageQueuePolicy queue_policy = LcmMessageQueuePolicy::kKeepLatest,
+      int queue_capacity = kDefaultQueueCapacity) {
     return std::make_unique<LcmSubscriberSystem>(
-        channel, std::make_unique<Serializer<LcmMessage>>(), lcm);
+        channel, std::make_unique<Serializer<LcmMessage>>(), lcm,
+        queue_policy, queue_capacity);
   }
 
   /**
@@ -75,10 +92,18 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    * and LCM message objects.
    *
    * @param lcm A non-null pointer to the LCM subsystem to subscribe on.
+   *
+   * @param queue_policy Which of the received messages are processed.
+   *
+   * @param queue_capacity The number of messages that are held until they
+   * are processed, for LcmMessageQueuePolicy::kKeepAll.
    */
-  LcmSubscriberSystem(const std::string& channel,
-                      std::unique_ptr<SerializerInterface> serializer,
-                      drake::lcm::DrakeLcmInterface* lcm);
+  LcmSubscriberSystem(
+      const std::string& channel,
+      std::unique_ptr<SerializerInterface> serializer,
+      drake::lcm::DrakeLcmInterface* lcm,
+      LcmMessageQueuePolicy queue_policy = LcmMessageQueuePolicy::kKeepLatest,
+      int queue_capacity = kDefaultQueueCapacity);
 
   /**
    * Constructor that returns a subscriber System that provides vector data on
@@ -93,10 +118,18 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    * object.
    *
    * @param lcm A non-null pointer to the LCM subsystem to subscribe on.
+   *
+   * @param queue_policy Which of the received messages are processed.
+   *
+   * @param queue_capacity The number of messages that are held until they
+   * are processed, for LcmMessageQueuePolicy::kKeepAll.
    */
-  LcmSubscriberSystem(const std::string& channel,
-                      const LcmAndVectorBaseTranslator& translator,
-                      drake::lcm::DrakeLcmInterface* lcm);
+  LcmSubscriberSystem(
+      const std::string& channel,
+      const LcmAndVectorBaseTranslator& translator,
+      drake::lcm::DrakeLcmInterface* lcm,
+      LcmMessageQueuePolicy queue_policy = LcmMessageQueuePolicy::kKeepLatest,
+      int queue_capacity = kDefaultQueueCapacity);
 
   /**
    * Constructor that returns a subscriber System that provides vector data on
@@ -167,6 +200,17 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    */
   int GetMessageCount(const Context<double>& context) const;
 
+  /**
+   * Returns the number of received messages that were dropped without being
+   * processed: superseded by a newer message under
+   * LcmMessageQueuePolicy::kKeepLatest, or arriving to a full queue under
+   * LcmMessageQueuePolicy::kKeepAll.
+   */
+  int GetDroppedMessageCount() const { return queue_.dropped_count(); }
+
+  /// Returns the policy that selects which received messages are processed.
+  LcmMessageQueuePolicy get_queue_policy() const { return queue_.policy(); }
+
  protected:
   void DoCalcNextUpdateTime(const Context<double>& context,
                             systems::CompositeEventCollection<double>* events,
@@ -199,7 +243,8 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   LcmSubscriberSystem(const std::string& channel,
                       const LcmAndVectorBaseTranslator* translator,
                       std::unique_ptr<SerializerInterface> serializer,
-                      drake::lcm::DrakeLcmInterface* lcm);
+                      drake::lcm::DrakeLcmInterface* lcm,
+                      LcmMessageQueuePolicy queue_policy, int queue_capacity);
 
   void ProcessMessageAndStoreToDiscreteState(
       DiscreteValues<double>* discrete_state) const;
@@ -233,17 +278,13 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // Will be non-null iff our output port is abstract-valued.
   const std::unique_ptr<SerializerInterface> serializer_;
 
-  // The mutex that guards received_message_ and received_message_count_.
-  mutable std::mutex received_message_mutex_;
+  // The messages passed from the LCM receive thread, which also counts them.
+  mutable LcmMessageQueue queue_;
 
-  // A condition variable that's signaled every time the handler is called.
+  // A mutex and condition variable that are only used to let
+  // WaitForMessage() sleep until the handler is called.
+  mutable std::mutex received_message_mutex_;
   mutable std::condition_variable received_message_condition_variable_;
-
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
-
-  // A message counter that's incremented every time the handler is called.
-  int received_message_count_{0};
 };
 
 }  // namespace lcm
@@ -40,6 +40,9 @@ class SerializerInterface {
 
   /**
    * Translates a drake::systems::AbstractValue object into LCM message bytes.
+   * The @p message_bytes are resized to fit the message, discarding any
+   * previous contents, so that callers can reuse the same buffer for every
+   * message.
    */
   virtual void Serialize(const AbstractValue& abstract_value,
                          std::vector<uint8_t>* message_bytes) const = 0;
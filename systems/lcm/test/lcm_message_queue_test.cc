@@ -0,0 +1,119 @@
+#include "drake/systems/lcm/lcm_message_queue.h"
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace systems {
+namespace lcm {
+namespace {
+
+void PushByte(uint8_t byte, LcmMessageQueue* queue) {
+  queue->Push(&byte, 1);
+}
+
+GTEST_TEST(LcmMessageQueueTest, KeepLatest) {
+  LcmMessageQueue dut(LcmMessageQueuePolicy::kKeepLatest, 1);
+  EXPECT_EQ(dut.Front(), nullptr);
+  EXPECT_EQ(dut.Back(), nullptr);
+
+  PushByte(10, &dut);
+  PushByte(11, &dut);
+  EXPECT_EQ(dut.received_count(), 2);
+  EXPECT_EQ(dut.dropped_count(), 1);
+
+  // The latest message stays available after it is popped.
+  for (int i = 0; i < 2; ++i) {
+    const LcmMessageQueue::Message* message = dut.Front();
+    ASSERT_NE(message, nullptr);
+    EXPECT_EQ(message->bytes, std::vector<uint8_t>({11}));
+    EXPECT_EQ(message->count, 2);
+    EXPECT_EQ(dut.Back(), message);
+    dut.Pop();
+  }
+
+  // A message that has been seen once is not dropped when superseded.
+  PushByte(12, &dut);
+  EXPECT_EQ(dut.dropped_count(), 1);
+  EXPECT_EQ(dut.Front()->count, 3);
+}
+
+GTEST_TEST(LcmMessageQueueTest, KeepAll) {
+  LcmMessageQueue dut(LcmMessageQueuePolicy::kKeepAll, 2);
+  EXPECT_EQ(dut.Front(), nullptr);
+  EXPECT_EQ(dut.Back(), nullptr);
+
+  // The third message overflows the queue.
+  PushByte(10, &dut);
+  PushByte(11, &dut);
+  PushByte(12, &dut);
+  EXPECT_EQ(dut.received_count(), 3);
+  EXPECT_EQ(dut.dropped_count(), 1);
+  EXPECT_EQ(dut.Back()->count, 2);
+
+  EXPECT_EQ(dut.Front()->bytes, std::vector<uint8_t>({10}));
+  EXPECT_EQ(dut.Front()->count, 1);
+  dut.Pop();
+
+  // Popping makes room, and the ring wraps around.
+  PushByte(13, &dut);
+  EXPECT_EQ(dut.Back()->count, 4);
+  EXPECT_EQ(dut.Front()->bytes, std::vector<uint8_t>({11}));
+  dut.Pop();
+  EXPECT_EQ(dut.Front()->bytes, std::vector<uint8_t>({13}));
+  dut.Pop();
+  EXPECT_EQ(dut.Front(), nullptr);
+
+  // Popping an empty queue does nothing.
+  dut.Pop();
+  EXPECT_EQ(dut.Front(), nullptr);
+  EXPECT_EQ(dut.dropped_count(), 1);
+}
+
+// Checks that messages cross between threads intact and in order.
+GTEST_TEST(LcmMessageQueueTest, Threads) {
+  const int kNumMessages = 10000;
+  for (const auto policy : {LcmMessageQueuePolicy::kKeepLatest,
+                            LcmMessageQueuePolicy::kKeepAll}) {
+    LcmMessageQueue dut(policy, 16);
+    std::atomic<bool> done{false};
+    std::thread producer([&dut, &done]() {
+      for (int i = 1; i <= kNumMessages; ++i) {
+        const std::vector<uint8_t> bytes(1 + i % 7, static_cast<uint8_t>(i));
+        dut.Push(bytes.data(), bytes.size());
+      }
+      done = true;
+    });
+
+    // The last message may itself be dropped, so this keeps going until the
+    // producer is done and the queue has nothing new.
+    int num_processed = 0;
+    int last_count = 0;
+    while (true) {
+      const bool producer_done = done.load();
+      const LcmMessageQueue::Message* message = dut.Front();
+      if (message == nullptr || message->count == last_count) {
+        if (producer_done) break;
+        continue;
+      }
+      ASSERT_GT(message->count, last_count);
+      const std::vector<uint8_t> expected(
+          1 + message->count % 7, static_cast<uint8_t>(message->count));
+      ASSERT_EQ(message->bytes, expected);
+      last_count = message->count;
+      ++num_processed;
+      dut.Pop();
+    }
+    producer.join();
+
+    EXPECT_EQ(dut.received_count(), kNumMessages);
+    EXPECT_EQ(num_processed + dut.dropped_count(), kNumMessages);
+  }
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
@@ -151,6 +151,19 @@ GTEST_TEST(LcmPublisherSystemTest, SerializerTest) {
   drake::lcmt_drake_signal received_message{};
   received_message.decode(bytes.data(), 0, bytes.size());
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(received_message, sample_data));
+
+  // Verifies that a smaller message published from the same (reused) buffer
+  // carries only its own bytes.
+  const lcmt_drake_signal smaller_data{1, { 3.0, }, { "z", }, 23456};
+  context->FixInputPort(kPortNumber,
+                        make_unique<Value<lcmt_drake_signal>>(smaller_data));
+  dut->Publish(*context.get());
+  const auto& smaller_bytes = lcm.get_last_published_message(channel_name);
+  EXPECT_EQ(static_cast<int>(smaller_bytes.size()),
+            smaller_data.getEncodedSize());
+  drake::lcmt_drake_signal smaller_message{};
+  smaller_message.decode(smaller_bytes.data(), 0, smaller_bytes.size());
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(smaller_message, smaller_data));
 }
 
 // Tests that the published LCM message has the expected timestamps.
@@ -1,6 +1,7 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
 #include <array>
+#include <cmath>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -208,6 +209,47 @@ GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
       future_message.get(), sample_data.value));
 }
 
+// Tests that a kKeepAll subscriber processes every message, in order, and
+// counts the ones that overflow its queue as dropped.
+GTEST_TEST(LcmSubscriberSystemTest, KeepAllTest) {
+  drake::lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "channel_name";
+  const int capacity = 3;
+
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(
+      channel_name, &lcm, LcmMessageQueuePolicy::kKeepAll, capacity);
+  EXPECT_EQ(dut->get_queue_policy(), LcmMessageQueuePolicy::kKeepAll);
+
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput(*context);
+
+  // Publishes one more message than the queue can hold.
+  SampleData sample_data;
+  for (int i = 0; i < capacity + 1; ++i) {
+    lcmt_drake_signal message = sample_data.value;
+    message.timestamp = i;
+    const int num_bytes = message.getEncodedSize();
+    std::vector<uint8_t> buffer(num_bytes);
+    message.encode(buffer.data(), 0, num_bytes);
+    lcm.InduceSubscriberCallback(channel_name, buffer.data(), num_bytes);
+  }
+  EXPECT_EQ(dut->GetInternalMessageCount(), capacity + 1);
+  EXPECT_EQ(dut->GetDroppedMessageCount(), 1);
+
+  // Each update processes the next message in the queue.
+  for (int i = 0; i < capacity; ++i) {
+    EvalOutputHelper(*dut, context.get(), output.get());
+    const auto& value = output->get_data(0)->GetValue<lcmt_drake_signal>();
+    EXPECT_EQ(value.timestamp, i);
+    EXPECT_EQ(dut->GetMessageCount(*context), i + 1);
+  }
+
+  // Once the queue is empty, no more updates are scheduled.
+  auto events = dut->AllocateCompositeEventCollection();
+  EXPECT_TRUE(std::isinf(dut->CalcNextUpdateTime(*context, events.get())));
+  EXPECT_FALSE(events->HasEvents());
+}
+
 // A lcmt_drake_signal translator that preserves coordinate names.
 class CustomDrakeSignalTranslator : public LcmAndVectorBaseTranslator {
  public:
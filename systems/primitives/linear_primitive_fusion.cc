@@ -0,0 +1,344 @@
+#include "drake/systems/primitives/linear_primitive_fusion.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_optional.h"
+#include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/affine_system.h"
+#include "drake/systems/primitives/demultiplexer.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/matrix_gain.h"
+#include "drake/systems/primitives/multiplexer.h"
+#include "drake/systems/primitives/pass_through.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+typedef Diagram<double>::InputPortLocator InputPortLocator;
+typedef Diagram<double>::OutputPortLocator OutputPortLocator;
+
+// The map y = D u + y0 of a stateless linear primitive, where u stacks all of
+// its input ports and y all of its output ports.
+struct AffineMap {
+  Eigen::MatrixXd D;
+  Eigen::VectorXd y0;
+};
+
+// Returns the map of @p system if it is one of the primitives that
+// FuseLinearPrimitives() knows about, or nullopt otherwise.
+optional<AffineMap> GetAffineMap(const System<double>& system) {
+  int num_inputs = 0;
+  for (int i = 0; i < system.get_num_input_ports(); ++i) {
+    if (system.get_input_port(i).get_data_type() != kVectorValued) {
+      return nullopt;
+    }
+    num_inputs += system.get_input_port(i).size();
+  }
+  int num_outputs = 0;
+  for (int i = 0; i < system.get_num_output_ports(); ++i) {
+    if (system.get_output_port(i).get_data_type() != kVectorValued) {
+      return nullopt;
+    }
+    num_outputs += system.get_output_port(i).size();
+  }
+  if (num_inputs == 0 || num_outputs == 0) {
+    return nullopt;
+  }
+
+  AffineMap map{Eigen::MatrixXd::Zero(num_outputs, num_inputs),
+                Eigen::VectorXd::Zero(num_outputs)};
+  if (const auto* gain = dynamic_cast<const Gain<double>*>(&system)) {
+    map.D = gain->get_gain_vector().asDiagonal();
+  } else if (const auto* affine =
+                 dynamic_cast<const AffineSystem<double>*>(&system)) {
+    if (affine->num_states() != 0) {
+      return nullopt;
+    }
+    map.D = affine->D();
+    map.y0 = affine->y0();
+  } else if (typeid(system) == typeid(Adder<double>)) {
+    for (int i = 0; i < num_inputs; i += num_outputs) {
+      map.D.middleCols(i, num_outputs).setIdentity();
+    }
+  } else if (typeid(system) == typeid(PassThrough<double>) ||
+             typeid(system) == typeid(Multiplexer<double>) ||
+             typeid(system) == typeid(Demultiplexer<double>)) {
+    // These only copy (or rearrange the ports of) their input.
+    if (num_inputs != num_outputs) {
+      return nullopt;
+    }
+    map.D.setIdentity();
+  } else {
+    return nullopt;
+  }
+  return map;
+}
+
+// Returns true iff the value of @p port is a BasicVector<double>, rather than
+// a subclass of it that a consumer of the port might rely on.
+bool HasPlainVectorValue(const OutputPort<double>& port) {
+  const auto context = port.get_system().CreateDefaultContext();
+  const std::unique_ptr<AbstractValue> value = port.Allocate(*context);
+  const BasicVector<double>& vector = value->GetValue<BasicVector<double>>();
+  return typeid(vector) == typeid(BasicVector<double>);
+}
+
+// The signal of a port within a group, as an affine function M u + c of the
+// sole input u of the group.
+struct Signal {
+  Eigen::MatrixXd M;
+  Eigen::VectorXd c;
+};
+
+}  // namespace
+
+int FuseLinearPrimitives(DiagramBuilder<double>* builder) {
+  DRAKE_DEMAND(builder != nullptr);
+
+  // Find the primitives and group those connected to each other, with a
+  // union-find over their indices.
+  std::vector<const System<double>*> candidates;
+  std::map<const System<double>*, int> candidate_index;
+  std::vector<AffineMap> maps;
+  for (const auto& system : builder->registered_systems_) {
+    optional<AffineMap> map = GetAffineMap(*system);
+    if (map) {
+      candidate_index[system.get()] = static_cast<int>(candidates.size());
+      candidates.push_back(system.get());
+      maps.push_back(std::move(*map));
+    }
+  }
+  std::vector<int> parent(candidates.size());
+  for (int i = 0; i < static_cast<int>(parent.size()); ++i) {
+    parent[i] = i;
+  }
+  auto find_root = [&parent](int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  for (const auto& connection : builder->connection_map_) {
+    const auto dest = candidate_index.find(connection.first.first);
+    const auto src = candidate_index.find(connection.second.first);
+    if (dest != candidate_index.end() && src != candidate_index.end()) {
+      parent[find_root(dest->second)] = find_root(src->second);
+    }
+  }
+  // The groups, each in the order in which its systems were registered.
+  std::map<int, std::vector<int>> groups;
+  for (int i = 0; i < static_cast<int>(candidates.size()); ++i) {
+    groups[find_root(i)].push_back(i);
+  }
+
+  int num_fused = 0;
+  for (const auto& group_entry : groups) {
+    const std::vector<int>& group = group_entry.second;
+    if (group.size() < 2) {
+      continue;
+    }
+    const int root = group_entry.first;
+    auto in_group = [&](const System<double>* system) {
+      const auto it = candidate_index.find(system);
+      return it != candidate_index.end() && find_root(it->second) == root;
+    };
+
+    // Find the sole source of the group, which is either an output port of
+    // another system or an exported input port of the diagram.
+    optional<OutputPortLocator> source_port;
+    optional<int> source_export;
+    bool fusable = true;
+    for (const int k : group) {
+      const System<double>* system = candidates[k];
+      for (InputPortIndex i(0); i < system->get_num_input_ports(); ++i) {
+        const InputPortLocator id{system, i};
+        const auto connection = builder->connection_map_.find(id);
+        if (connection != builder->connection_map_.end()) {
+          if (in_group(connection->second.first)) {
+            continue;
+          }
+          if (source_export ||
+              (source_port && *source_port != connection->second)) {
+            fusable = false;
+          }
+          source_port = connection->second;
+        } else if (builder->diagram_input_set_.count(id) > 0) {
+          if (source_port || source_export) {
+            fusable = false;
+          }
+          const auto& ids = builder->input_port_ids_;
+          source_export = static_cast<int>(
+              std::find(ids.begin(), ids.end(), id) - ids.begin());
+        } else {
+          // Unwired inputs are left for Build() to deal with.
+          fusable = false;
+        }
+      }
+    }
+    if (!fusable || !(source_port || source_export)) {
+      continue;
+    }
+
+    // Find the sole output port of the group that is consumed outside of it.
+    optional<OutputPortLocator> sink;
+    for (const auto& connection : builder->connection_map_) {
+      if (in_group(connection.second.first) &&
+          !in_group(connection.first.first)) {
+        if (sink && *sink != connection.second) {
+          fusable = false;
+        }
+        sink = connection.second;
+      }
+    }
+    for (const auto& id : builder->output_port_ids_) {
+      if (in_group(id.first)) {
+        if (sink && *sink != id) {
+          fusable = false;
+        }
+        sink = id;
+      }
+    }
+    if (!fusable || !sink ||
+        !HasPlainVectorValue(sink->first->get_output_port(sink->second))) {
+      continue;
+    }
+
+    // Compute the signal of every output port of the group, visiting the
+    // systems in topological order. A system is ready once all of its inputs
+    // fed from within the group are known.
+    const int num_group_inputs =
+        source_port
+            ? source_port->first->get_output_port(source_port->second).size()
+            : builder->input_port_ids_[*source_export]
+                  .first->get_input_port(
+                      builder->input_port_ids_[*source_export].second)
+                  .size();
+    std::map<OutputPortLocator, Signal> signals;
+    std::set<int> pending(group.begin(), group.end());
+    bool progress = true;
+    while (!pending.empty() && progress) {
+      progress = false;
+      for (auto it = pending.begin(); it != pending.end();) {
+        const System<double>* system = candidates[*it];
+        const AffineMap& map = maps[*it];
+        const int num_inputs = static_cast<int>(map.D.cols());
+        Signal u{Eigen::MatrixXd(num_inputs, num_group_inputs),
+                 Eigen::VectorXd(num_inputs)};
+        bool ready = true;
+        int row = 0;
+        for (InputPortIndex i(0); i < system->get_num_input_ports(); ++i) {
+          const int size = system->get_input_port(i).size();
+          const auto connection =
+              builder->connection_map_.find(InputPortLocator{system, i});
+          if (connection != builder->connection_map_.end() &&
+              in_group(connection->second.first)) {
+            const auto signal = signals.find(connection->second);
+            if (signal == signals.end()) {
+              ready = false;
+              break;
+            }
+            u.M.middleRows(row, size) = signal->second.M;
+            u.c.segment(row, size) = signal->second.c;
+          } else {
+            u.M.middleRows(row, size).setIdentity();
+            u.c.segment(row, size).setZero();
+          }
+          row += size;
+        }
+        if (!ready) {
+          ++it;
+          continue;
+        }
+        const Eigen::MatrixXd M = map.D * u.M;
+        const Eigen::VectorXd c = map.D * u.c + map.y0;
+        row = 0;
+        for (OutputPortIndex i(0); i < system->get_num_output_ports(); ++i) {
+          const int size = system->get_output_port(i).size();
+          signals[OutputPortLocator{system, i}] =
+              Signal{M.middleRows(row, size), c.segment(row, size)};
+          row += size;
+        }
+        it = pending.erase(it);
+        progress = true;
+      }
+    }
+    if (!pending.empty()) {
+      // An algebraic loop, which Build() reports.
+      continue;
+    }
+
+    // Make the fused system, named after the owner of the group's output.
+    const Signal& output = signals.at(*sink);
+    std::unique_ptr<System<double>> fused;
+    if (output.c.isZero(0.)) {
+      fused = std::make_unique<MatrixGain<double>>(output.M);
+    } else {
+      fused = std::make_unique<AffineSystem<double>>(
+          Eigen::MatrixXd::Zero(0, 0),                // A
+          Eigen::MatrixXd::Zero(0, num_group_inputs),  // B
+          Eigen::VectorXd::Zero(0),                   // f0
+          Eigen::MatrixXd::Zero(output.c.size(), 0),  // C
+          output.M,                                   // D
+          output.c);                                  // y0
+    }
+    fused->set_name(sink->first->get_name());
+    const System<double>* fused_system = fused.get();
+    const InputPortLocator fused_input{fused_system, InputPortIndex(0)};
+    const OutputPortLocator fused_output{fused_system, OutputPortIndex(0)};
+
+    // Rewire the group's connections to the fused system.
+    for (auto it = builder->connection_map_.begin();
+         it != builder->connection_map_.end();) {
+      if (in_group(it->first.first)) {
+        it = builder->connection_map_.erase(it);
+      } else {
+        if (it->second == *sink) {
+          it->second = fused_output;
+        }
+        ++it;
+      }
+    }
+    if (source_port) {
+      builder->connection_map_[fused_input] = *source_port;
+    } else {
+      InputPortLocator& id = builder->input_port_ids_[*source_export];
+      builder->diagram_input_set_.erase(id);
+      id = fused_input;
+      builder->diagram_input_set_.insert(id);
+    }
+    for (auto& id : builder->output_port_ids_) {
+      if (id == *sink) {
+        id = fused_output;
+      }
+    }
+
+    // Replace the group with the fused system.
+    auto& systems = builder->registered_systems_;
+    for (const int k : group) {
+      builder->systems_.erase(candidates[k]);
+    }
+    systems.erase(std::remove_if(systems.begin(), systems.end(),
+                                 [&](const std::unique_ptr<System<double>>& s) {
+                                   return in_group(s.get());
+                                 }),
+                  systems.end());
+    for (const int k : group) {
+      candidate_index.erase(candidates[k]);
+    }
+    builder->AddSystem(std::move(fused));
+    num_fused += static_cast<int>(group.size());
+  }
+  return num_fused;
+}
+
+}  // namespace systems
+}  // namespace drake
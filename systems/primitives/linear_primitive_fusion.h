@@ -0,0 +1,40 @@
+#pragma once
+
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace systems {
+
+/// Replaces each chain of stateless linear primitives in @p builder with a
+/// single system that evaluates the whole chain with one precomputed matrix,
+/// so that a Diagram built afterwards skips the intermediate output port
+/// evaluations and vector copies. Call it right before Build().
+///
+/// The primitives considered are Gain, MatrixGain and any other AffineSystem
+/// without state, vector-valued PassThrough, Adder, Multiplexer and
+/// Demultiplexer. A group of those that are connected to each other is fused
+/// when all of the following hold:
+///  - it contains at least two systems,
+///  - every input port of the group is wired, and all of those fed from
+///    outside of the group are fed by the same output port or by the same
+///    exported input port,
+///  - exactly one output port of the group is consumed outside of it, by
+///    other systems or as an exported output, and its value is a plain
+///    BasicVector,
+///  - it has no algebraic loop.
+///
+/// The group is replaced by a MatrixGain, or an AffineSystem without state if
+/// the group adds a constant offset, named after the system that owned the
+/// group's output port. The exported inputs and outputs of the diagram keep
+/// their indices and sizes, and every connection from or to the group is
+/// redirected to the new system, so the external connectivity is unchanged.
+/// The fused systems are destroyed: pointers to them must not be used
+/// afterwards.
+///
+/// Saturation and the other nonlinear primitives are never fused.
+///
+/// @returns the total number of systems that were fused away.
+int FuseLinearPrimitives(DiagramBuilder<double>* builder);
+
+}  // namespace systems
+}  // namespace drake
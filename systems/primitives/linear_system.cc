@@ -1,14 +1,20 @@
 #include "drake/systems/primitives/linear_system.h"
 
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <Eigen/LU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/symbolic_decompose.h"
 #include "drake/math/autodiff.h"
@@ -83,14 +89,10 @@ unique_ptr<LinearSystem<T>> LinearSystem<T>::MakeLinearSystem(
 
 namespace {
 
-// Helper function allows reuse for both FirstOrderTaylorApproximation and
-// Linearize.
-std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
-    const System<double>& system, const Context<double>& context,
-    int input_port_index, int output_port_index,
-    optional<double> equilibrium_check_tolerance = nullopt) {
-  DRAKE_ASSERT_VOID(system.CheckValidContext(context));
-
+// Confirms that `context` has a structure that the linearization supports, and
+// returns the period of the discrete update, or zero for continuous time.
+double GetLinearizationTimePeriod(const System<double>& system,
+                                  const Context<double>& context) {
   const bool has_only_discrete_states_contained_in_one_group =
       context.has_only_discrete_state() &&
       context.get_num_discrete_state_groups() == 1;
@@ -104,185 +106,300 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     DRAKE_THROW_UNLESS(static_cast<bool>(periodic_data));
     time_period = periodic_data->period_sec();
   }
+  return time_period;
+}
+
+// Returns the values of `values` as AutoDiffXd, with `num_derivatives`
+// derivatives each. The coordinate columns[k] has a unit derivative in slot
+// offset + k; all other derivatives are zero.
+VectorX<AutoDiffXd> SeedAutoDiff(const Eigen::VectorXd& values,
+                                 const std::vector<int>& columns, int offset,
+                                 int num_derivatives) {
+  VectorX<AutoDiffXd> result(values.size());
+  for (int i = 0; i < values.size(); ++i) {
+    result(i).value() = values(i);
+    result(i).derivatives() = Eigen::VectorXd::Zero(num_derivatives);
+  }
+  for (size_t k = 0; k < columns.size(); ++k) {
+    result(columns[k]).derivatives()(offset + k) = 1.0;
+  }
+  return result;
+}
+
+void CheckColumns(const std::vector<int>& columns, int size,
+                  const char* kind) {
+  for (int column : columns) {
+    if (column < 0 || column >= size) {
+      throw std::logic_error(
+          "Linearizer: " + std::string(kind) + " column " +
+          std::to_string(column) + " is out of range [0, " +
+          std::to_string(size) + ").");
+    }
+  }
+}
+
+// Returns the size of the state that the linearization differentiates.
+int GetNumLinearizationStates(const Context<double>& context) {
+  if (context.is_stateless()) return 0;
+  return context.has_only_continuous_state()
+             ? context.get_continuous_state_vector().size()
+             : context.get_discrete_state(0).size();
+}
 
-  // Create an autodiff version of the system.
-  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
-      drake::systems::System<double>::ToAutoDiffXd(system);
+// Returns the first-order Taylor approximation described by `lin`, whose
+// columns must span all of the states and inputs.
+std::unique_ptr<AffineSystem<double>> MakeTaylorApproximation(
+    const Linearization& lin, double time_period) {
+  // Note: No tolerance check needed for the output.  We have defined that the
+  // output for the system produced by Linearize is in the coordinates (y-y0).
+  const Eigen::VectorXd f0 = lin.f0 - lin.A * lin.x0 - lin.B * lin.u0;
+  const Eigen::VectorXd y0 = lin.y0 - lin.C * lin.x0 - lin.D * lin.u0;
+  return std::make_unique<AffineSystem<double>>(lin.A, lin.B, f0, lin.C, lin.D,
+                                                y0, time_period);
+}
+
+std::vector<int> AllColumns(int size) {
+  std::vector<int> columns(size);
+  for (int i = 0; i < size; ++i) columns[i] = i;
+  return columns;
+}
 
-  // Initialize autodiff.
-  std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
-      autodiff_system->CreateDefaultContext();
-  autodiff_context->SetTimeStateAndParametersFrom(context);
+}  // namespace
 
-  const InputPortDescriptor<AutoDiffXd>* input_port = nullptr;
+Linearizer::Linearizer(const System<double>& system, int input_port_index,
+                       int output_port_index)
+    : system_(system),
+      autodiff_system_(system.GetOrCreateAutoDiffXd()) {
   // By default, use the first input / output ports (if they exist).
   if (input_port_index == kUseFirstInputIfItExists) {
     if (system.get_num_input_ports() > 0) {
-      input_port = &(autodiff_system->get_input_port(0));
+      input_port_ = &(autodiff_system_.get_input_port(0));
     }
   } else if (input_port_index >= 0 &&
              input_port_index < system.get_num_input_ports()) {
-    input_port = &(autodiff_system->get_input_port(input_port_index));
+    input_port_ = &(autodiff_system_.get_input_port(input_port_index));
   } else if (input_port_index != kNoInput) {
     DRAKE_ABORT_MSG("Invalid input_port_index specified.");
   }
-  const OutputPort<AutoDiffXd>* output_port = nullptr;
-  // By default, use the first input / output ports (if they exist).
   if (output_port_index == kUseFirstOutputIfItExists) {
     if (system.get_num_output_ports() > 0) {
-      output_port = &(autodiff_system->get_output_port(0));
+      output_port_ = &(autodiff_system_.get_output_port(0));
     }
   } else if (output_port_index >= 0 &&
              output_port_index < system.get_num_output_ports()) {
-    output_port = &(autodiff_system->get_output_port(output_port_index));
+    output_port_ = &(autodiff_system_.get_output_port(output_port_index));
   } else if (output_port_index != kNoOutput) {
     DRAKE_ABORT_MSG("Invalid output_port_index specified.");
   }
+}
+
+Linearizer::~Linearizer() = default;
 
-  const int num_inputs = input_port ? input_port->size() : 0;
-  const int num_outputs = output_port ? output_port->size() : 0;
+int Linearizer::num_inputs() const {
+  return input_port_ ? input_port_->size() : 0;
+}
+
+int Linearizer::num_outputs() const {
+  return output_port_ ? output_port_->size() : 0;
+}
 
-  const Eigen::VectorXd x0 =
+std::unique_ptr<LinearSystem<double>> Linearizer::Linearize(
+    const Context<double>& context, double equilibrium_check_tolerance) const {
+  const double time_period = GetLinearizationTimePeriod(system_, context);
+  const int num_states = GetNumLinearizationStates(context);
+  const Linearization lin = CalcLinearization(
+      context, AllColumns(num_states), AllColumns(num_inputs()));
+
+  const Eigen::VectorXd& xdot0_or_x1 = lin.f0;
+  const bool is_equilibrium =
+      time_period == 0.0
+          ? xdot0_or_x1.isZero(equilibrium_check_tolerance)
+          : (xdot0_or_x1 - lin.x0).isZero(equilibrium_check_tolerance);
+  if (!is_equilibrium) {
+    throw std::runtime_error(
+        "The nominal operating point (x0,u0) is not an equilibrium point "
+        "of the system.  Without additional information, a time-invariant "
+        "linearization of this system is not well defined.");
+  }
+
+  return std::make_unique<LinearSystem<double>>(lin.A, lin.B, lin.C, lin.D,
+                                                time_period);
+}
+
+std::unique_ptr<AffineSystem<double>> Linearizer::FirstOrderTaylorApproximation(
+    const Context<double>& context) const {
+  const double time_period = GetLinearizationTimePeriod(system_, context);
+  const int num_states = GetNumLinearizationStates(context);
+  return MakeTaylorApproximation(
+      CalcLinearization(context, AllColumns(num_states),
+                        AllColumns(num_inputs())),
+      time_period);
+}
+
+std::vector<std::unique_ptr<AffineSystem<double>>>
+Linearizer::FirstOrderTaylorApproximations(
+    const std::vector<const Context<double>*>& contexts,
+    int num_threads) const {
+  std::vector<std::unique_ptr<AffineSystem<double>>> results(contexts.size());
+  ForEachTask(static_cast<int>(contexts.size()), num_threads,
+              [&](int i, int slot) {
+    const Context<double>& context = *contexts[i];
+    const double time_period = GetLinearizationTimePeriod(system_, context);
+    const int num_states = GetNumLinearizationStates(context);
+    results[i] = MakeTaylorApproximation(
+        DoCalcLinearization(context, AllColumns(num_states),
+                            AllColumns(num_inputs()), slot),
+        time_period);
+  });
+  return results;
+}
+
+Linearization Linearizer::CalcLinearization(
+    const Context<double>& context, const std::vector<int>& state_columns,
+    const std::vector<int>& input_columns) const {
+  Linearization result;
+  ForEachTask(1, 1, [&](int, int slot) {
+    result = DoCalcLinearization(context, state_columns, input_columns, slot);
+  });
+  return result;
+}
+
+std::vector<Linearization> Linearizer::CalcLinearizations(
+    const std::vector<const Context<double>*>& contexts,
+    const std::vector<int>& state_columns,
+    const std::vector<int>& input_columns, int num_threads) const {
+  std::vector<Linearization> results(contexts.size());
+  ForEachTask(static_cast<int>(contexts.size()), num_threads,
+              [&](int i, int slot) {
+    results[i] =
+        DoCalcLinearization(*contexts[i], state_columns, input_columns, slot);
+  });
+  return results;
+}
+
+void Linearizer::ForEachTask(
+    int num_tasks, int num_threads,
+    const std::function<void(int, int)>& calc) const {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  const int num_workers = std::max(1, std::min(num_threads, num_tasks));
+  while (static_cast<int>(contexts_.size()) < num_workers) {
+    contexts_.push_back(autodiff_system_.CreateDefaultContext());
+  }
+  // Each worker owns one context, and takes the next task when it is done.
+  std::atomic<int> next_task(0);
+  ParallelFor(num_workers, num_workers, [&](int slot) {
+    for (int i = next_task++; i < num_tasks; i = next_task++) {
+      calc(i, slot);
+    }
+  });
+}
+
+Linearization Linearizer::DoCalcLinearization(
+    const Context<double>& context, const std::vector<int>& state_columns,
+    const std::vector<int>& input_columns, int slot) const {
+  DRAKE_ASSERT_VOID(system_.CheckValidContext(context));
+  GetLinearizationTimePeriod(system_, context);
+
+  Linearization result;
+  result.x0 =
       context.is_stateless()
           ? Eigen::VectorXd::Zero(0)
           : ((context.has_only_continuous_state())
                  ? context.get_continuous_state_vector().CopyToVector()
                  : context.get_discrete_state(0).get_value());
-  const int num_states = x0.size();
+  const int num_states = result.x0.size();
+  const int num_inputs = this->num_inputs();
+  const int num_outputs = this->num_outputs();
+  CheckColumns(state_columns, num_states, "state");
+  CheckColumns(input_columns, num_inputs, "input");
+  const int num_state_columns = static_cast<int>(state_columns.size());
+  const int num_input_columns = static_cast<int>(input_columns.size());
+  const int num_derivatives = num_state_columns + num_input_columns;
+
+  Context<AutoDiffXd>& autodiff_context = *contexts_[slot];
+  autodiff_context.SetTimeStateAndParametersFrom(context);
 
   // Must have some values for all of the inputs.
-  for (int index = 0; index < system.get_num_input_ports(); index++) {
-    Eigen::VectorXd u = system.EvalEigenVectorInput(context, index);
-    autodiff_context->FixInputPort(index, u.cast<AutoDiffXd>());
+  for (int index = 0; index < system_.get_num_input_ports(); index++) {
+    if (input_port_ && index == input_port_->get_index()) continue;
+    Eigen::VectorXd u = system_.EvalEigenVectorInput(context, index);
+    autodiff_context.FixInputPort(index, u.cast<AutoDiffXd>());
   }
 
-  Eigen::VectorXd u0 = Eigen::VectorXd::Zero(num_inputs);
-  if (input_port) {
-    u0 = system.EvalEigenVectorInput(context, input_port->get_index());
-  }
-
-  auto autodiff_args = math::initializeAutoDiffTuple(x0, u0);
-  if (input_port) {
+  result.u0 = Eigen::VectorXd::Zero(num_inputs);
+  if (input_port_) {
+    result.u0 = system_.EvalEigenVectorInput(context, input_port_->get_index());
     auto input_vector = std::make_unique<BasicVector<AutoDiffXd>>(num_inputs);
-    input_vector->SetFromVector(std::get<1>(autodiff_args));
-    autodiff_context->FixInputPort(input_port->get_index(),
-                                   std::move(input_vector));
+    input_vector->SetFromVector(SeedAutoDiff(
+        result.u0, input_columns, num_state_columns, num_derivatives));
+    autodiff_context.FixInputPort(input_port_->get_index(),
+                                  std::move(input_vector));
   }
 
-  Eigen::MatrixXd A(num_states, num_states), B(num_states, num_inputs);
-  Eigen::VectorXd f0(num_states);
+  const VectorX<AutoDiffXd> autodiff_x0 =
+      SeedAutoDiff(result.x0, state_columns, 0, num_derivatives);
   if (num_states > 0) {
-    if (autodiff_context->has_only_continuous_state()) {
-      autodiff_context->get_mutable_continuous_state_vector().SetFromVector(
-          std::get<0>(autodiff_args));
+    VectorX<AutoDiffXd> autodiff_f0;
+    if (autodiff_context.has_only_continuous_state()) {
+      autodiff_context.get_mutable_continuous_state_vector().SetFromVector(
+          autodiff_x0);
       std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_xdot =
-          autodiff_system->AllocateTimeDerivatives();
-      autodiff_system->CalcTimeDerivatives(*autodiff_context,
-                                           autodiff_xdot.get());
-      auto autodiff_xdot_vec = autodiff_xdot->CopyToVector();
-
-      const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_xdot_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
-
-      const Eigen::VectorXd xdot0 =
-          math::autoDiffToValueMatrix(autodiff_xdot_vec);
-
-      if (equilibrium_check_tolerance &&
-          !xdot0.isZero(*equilibrium_check_tolerance)) {
-        throw std::runtime_error(
-            "The nominal operating point (x0,u0) is not an equilibrium point "
-            "of "
-            "the system.  Without additional information, a time-invariant "
-            "linearization of this system is not well defined.");
-      }
-
-      f0 = xdot0 - A * x0 - B * u0;
+          autodiff_system_.AllocateTimeDerivatives();
+      autodiff_system_.CalcTimeDerivatives(autodiff_context,
+                                            autodiff_xdot.get());
+      autodiff_f0 = autodiff_xdot->CopyToVector();
     } else {
-      DRAKE_ASSERT(has_only_discrete_states_contained_in_one_group);
-      auto& autodiff_x0 =
-          autodiff_context->get_mutable_discrete_state().get_mutable_vector();
-      autodiff_x0.SetFromVector(std::get<0>(autodiff_args));
+      autodiff_context.get_mutable_discrete_state().get_mutable_vector()
+          .SetFromVector(autodiff_x0);
       std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_x1 =
-          autodiff_system->AllocateDiscreteVariables();
-      autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
-                                                   autodiff_x1.get());
-      auto autodiff_x1_vec = autodiff_x1->get_vector().CopyToVector();
-
-      const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_x1_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
-
-      const Eigen::VectorXd x1 = math::autoDiffToValueMatrix(autodiff_x1_vec);
-
-      if (equilibrium_check_tolerance &&
-          !(x1 - x0).isZero(*equilibrium_check_tolerance)) {
-        throw std::runtime_error(
-            "The nominal operating point (x0,u0) is not an equilibrium point "
-            "of the system.  Without additional information, a time-invariant "
-            "linearization of this system is not well defined.");
-      }
-
-      f0 = x1 - A * x0 - B * u0;
+          autodiff_system_.AllocateDiscreteVariables();
+      autodiff_system_.CalcDiscreteVariableUpdates(autodiff_context,
+                                                    autodiff_x1.get());
+      autodiff_f0 = autodiff_x1->get_vector().CopyToVector();
     }
+    const Eigen::MatrixXd AB =
+        math::autoDiffToGradientMatrix(autodiff_f0, num_derivatives);
+    result.A = AB.leftCols(num_state_columns);
+    result.B = AB.rightCols(num_input_columns);
+    result.f0 = math::autoDiffToValueMatrix(autodiff_f0);
   } else {
-    DRAKE_ASSERT(num_states == 0);
-    A = Eigen::MatrixXd(0, 0);
-    B = Eigen::MatrixXd(0, num_inputs);
-    f0 = Eigen::VectorXd(0);
+    result.A = Eigen::MatrixXd(0, num_state_columns);
+    result.B = Eigen::MatrixXd(0, num_input_columns);
+    result.f0 = Eigen::VectorXd(0);
   }
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(num_outputs, num_states);
-  Eigen::MatrixXd D = Eigen::MatrixXd::Zero(num_outputs, num_inputs);
-  Eigen::VectorXd y0 = Eigen::VectorXd::Zero(num_outputs);
-
-  if (output_port) {
+  if (output_port_) {
     std::unique_ptr<AbstractValue> autodiff_y0 =
-        output_port->Allocate(*autodiff_context);
-    output_port->Calc(*autodiff_context, autodiff_y0.get());
-
-    auto autodiff_y0_vec =
+        output_port_->Allocate(autodiff_context);
+    output_port_->Calc(autodiff_context, autodiff_y0.get());
+    const VectorX<AutoDiffXd> autodiff_y0_vec =
         autodiff_y0->GetValue<BasicVector<AutoDiffXd>>().CopyToVector();
-
-    const Eigen::MatrixXd CD = math::autoDiffToGradientMatrix(autodiff_y0_vec);
-    C = CD.leftCols(num_states);
-    D = CD.rightCols(num_inputs);
-
-    const Eigen::VectorXd y = math::autoDiffToValueMatrix(autodiff_y0_vec);
-
-    // Note: No tolerance check needed here.  We have defined that the output
-    // for the system produced by Linearize is in the coordinates (y-y0).
-
-    y0 = y - C * x0 - D * u0;
+    const Eigen::MatrixXd CD =
+        math::autoDiffToGradientMatrix(autodiff_y0_vec, num_derivatives);
+    result.C = CD.leftCols(num_state_columns);
+    result.D = CD.rightCols(num_input_columns);
+    result.y0 = math::autoDiffToValueMatrix(autodiff_y0_vec);
+  } else {
+    result.C = Eigen::MatrixXd::Zero(num_outputs, num_state_columns);
+    result.D = Eigen::MatrixXd::Zero(num_outputs, num_input_columns);
+    result.y0 = Eigen::VectorXd::Zero(num_outputs);
   }
-
-  return std::make_unique<AffineSystem<double>>(A, B, f0, C, D, y0,
-                                                time_period);
+  return result;
 }
 
-}  // namespace
-
 std::unique_ptr<LinearSystem<double>> Linearize(
     const System<double>& system, const Context<double>& context,
     int input_port_index, int output_port_index,
     double equilibrium_check_tolerance) {
-  std::unique_ptr<AffineSystem<double>> affine =
-      DoFirstOrderTaylorApproximation(system, context, input_port_index,
-                                      output_port_index,
-                                      equilibrium_check_tolerance);
-
-  return std::make_unique<LinearSystem<double>>(affine->A(), affine->B(),
-                                                affine->C(), affine->D(),
-                                                affine->time_period());
+  return Linearizer(system, input_port_index, output_port_index)
+      .Linearize(context, equilibrium_check_tolerance);
 }
 
 std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     int input_port_index, int output_port_index) {
-  return DoFirstOrderTaylorApproximation(system, context, input_port_index,
-                                         output_port_index);
+  return Linearizer(system, input_port_index, output_port_index)
+      .FirstOrderTaylorApproximation(context);
 }
 
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
@@ -249,6 +251,118 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     int input_port_index = kUseFirstInputIfItExists,
     int output_port_index = kUseFirstOutputIfItExists);
 
+/// The partial derivatives of a System's dynamics and output at one operating
+/// point (x0, u0), as computed by Linearizer::CalcLinearization(). Denote by
+/// f(x, u) either the time derivatives (continuous time) or the next state
+/// (discrete time), and by y(x, u) the output. Then:
+///  - `A` = ∂f/∂x and `C` = ∂y/∂x, restricted to the selected state columns;
+///  - `B` = ∂f/∂u and `D` = ∂y/∂u, restricted to the selected input columns;
+///  - `f0` = f(x0, u0) and `y0` = y(x0, u0).
+///
+/// The operating point itself is reported as `x0` and `u0`; `u0` is empty if
+/// no input port is selected.
+struct Linearization {
+  Eigen::VectorXd x0;
+  Eigen::VectorXd u0;
+  Eigen::MatrixXd A;
+  Eigen::MatrixXd B;
+  Eigen::MatrixXd C;
+  Eigen::MatrixXd D;
+  Eigen::VectorXd f0;
+  Eigen::VectorXd y0;
+};
+
+/// Linearizes one System about many operating points. It evaluates the
+/// AutoDiffXd twin of the system from System::GetOrCreateAutoDiffXd(), which
+/// is converted once and then shared with every other linearization of the
+/// same system, and reuses its AutoDiffXd contexts across calls. The batch
+/// methods spread the operating points across several threads, each with its
+/// own context, as permitted by
+/// @ref system_thread_safety "System thread safety".
+///
+/// The port selection and the supported systems are the same as for
+/// FirstOrderTaylorApproximation(). The referenced @p system must outlive this
+/// object. A %Linearizer is not itself thread safe: do not call its methods
+/// concurrently.
+///
+/// @ingroup primitive_systems
+class Linearizer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Linearizer)
+
+  /// Selects the ports that the linearizations use, on the AutoDiffXd twin of
+  /// @p system (which is converted if this is its first use).
+  /// @param input_port_index A valid input port index for @p system or
+  /// kNoInput or (default) kUseFirstInputIfItExists.
+  /// @param output_port_index A valid output port index for @p system or
+  /// kNoOutput or (default) kUseFirstOutputIfItExists.
+  explicit Linearizer(const System<double>& system,
+                      int input_port_index = kUseFirstInputIfItExists,
+                      int output_port_index = kUseFirstOutputIfItExists);
+
+  ~Linearizer();
+
+  /// Returns the same system as Linearize(system, context, ...).
+  std::unique_ptr<LinearSystem<double>> Linearize(
+      const Context<double>& context,
+      double equilibrium_check_tolerance = 1e-6) const;
+
+  /// Returns the same system as FirstOrderTaylorApproximation(system, context,
+  /// ...).
+  std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
+      const Context<double>& context) const;
+
+  /// Returns FirstOrderTaylorApproximation(*contexts[i]) for each i, computed
+  /// on up to @p num_threads threads.
+  std::vector<std::unique_ptr<AffineSystem<double>>>
+  FirstOrderTaylorApproximations(
+      const std::vector<const Context<double>*>& contexts,
+      int num_threads = 1) const;
+
+  /// Computes the partial derivatives at the operating point defined by
+  /// @p context with respect to the state coordinates @p state_columns and
+  /// the input coordinates @p input_columns only. Derivatives are propagated
+  /// for the selected coordinates alone, so selecting few columns is cheaper
+  /// than a full linearization.
+  /// @throws std::logic_error if a column is out of range.
+  Linearization CalcLinearization(const Context<double>& context,
+                                  const std::vector<int>& state_columns,
+                                  const std::vector<int>& input_columns) const;
+
+  /// Returns CalcLinearization(*contexts[i], state_columns, input_columns) for
+  /// each i, computed on up to @p num_threads threads.
+  std::vector<Linearization> CalcLinearizations(
+      const std::vector<const Context<double>*>& contexts,
+      const std::vector<int>& state_columns,
+      const std::vector<int>& input_columns, int num_threads = 1) const;
+
+  /// Returns the size of the selected input port, or zero if there is none.
+  int num_inputs() const;
+
+  /// Returns the size of the selected output port, or zero if there is none.
+  int num_outputs() const;
+
+ private:
+  // Linearizes about `context` using the AutoDiffXd context at index `slot`.
+  Linearization DoCalcLinearization(const Context<double>& context,
+                                    const std::vector<int>& state_columns,
+                                    const std::vector<int>& input_columns,
+                                    int slot) const;
+
+  // Calls `calc(i, slot)` for each i in [0, num_tasks), on up to
+  // `num_threads` threads; `slot` is the index of the AutoDiffXd context that
+  // the calling thread owns.
+  void ForEachTask(int num_tasks, int num_threads,
+                   const std::function<void(int, int)>& calc) const;
+
+  const System<double>& system_;
+  const System<AutoDiffXd>& autodiff_system_;
+  const InputPortDescriptor<AutoDiffXd>* input_port_{nullptr};
+  const OutputPort<AutoDiffXd>* output_port_{nullptr};
+  // One context per thread, reused across calls.
+  mutable std::vector<std::unique_ptr<Context<AutoDiffXd>>> contexts_;
+};
+
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
 /// @ingroup control_systems
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys);
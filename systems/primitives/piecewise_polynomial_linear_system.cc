@@ -2,5 +2,33 @@
 
 #include "drake/common/default_scalars.h"
 
+namespace drake {
+namespace systems {
+
+template <typename T>
+void PiecewisePolynomialLinearSystem<T>::CalcOutputY(
+    const Context<T>& context, BasicVector<T>* output_vector) const {
+  const double t = ExtractDoubleOrThrow(context.get_time());
+  Eigen::Ref<VectorX<T>> y = output_vector->get_mutable_value();
+  y.setZero();
+
+  if (this->num_states() > 0) {
+    const auto& x = (this->time_period() == 0.)
+        ? dynamic_cast<const BasicVector<T>&>(
+            context.get_continuous_state_vector()).get_value()
+        : context.get_discrete_state().get_vector().get_value();
+    internal::AddTrajectoryProduct<T>(data_.C, t, x, y);
+  }
+
+  if (this->num_inputs() > 0) {
+    const BasicVector<T>* input = this->EvalVectorInput(context, 0);
+    DRAKE_DEMAND(input);
+    internal::AddTrajectoryProduct<T>(data_.D, t, input->get_value(), y);
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     class ::drake::systems::PiecewisePolynomialLinearSystem)
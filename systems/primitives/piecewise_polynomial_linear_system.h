@@ -80,6 +80,11 @@ class PiecewisePolynomialLinearSystem final
                                    data.B.cols(), data.C.rows(), time_period),
         data_(data) {}
 
+  /// Computes @f[ y(t) = C(t) x(t) + D(t) u(t), @f] directly from the trajectories,
+  /// without forming the matrices; for T = double, this does not allocate.
+  void CalcOutputY(const Context<T>& context,
+                   BasicVector<T>* output_vector) const final;
+
  private:
   // Allow different specializations to access each other's private data.
   template <typename>
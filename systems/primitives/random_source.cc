@@ -1,5 +1,7 @@
 #include "drake/systems/primitives/random_source.h"
 
+#include <atomic>
+
 #include "drake/common/never_destroyed.h"
 
 namespace drake {
@@ -8,12 +10,14 @@ namespace systems {
 namespace internal {
 template<typename Generator>
 typename Generator::result_type generate_unique_seed() {
-  static never_destroyed<typename Generator::result_type> seed(
-      Generator::default_seed);
+  // The seed is atomic so that sources may be constructed concurrently.
+  typedef typename Generator::result_type Seed;
+  static never_destroyed<std::atomic<Seed>> seed(Seed{Generator::default_seed});
   return seed.access()++;
 }
 
 template std::mt19937::result_type generate_unique_seed<std::mt19937>();
+template Philox4x32::result_type generate_unique_seed<Philox4x32>();
 
 }  // namespace internal
 
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cmath>
 #include <memory>
 #include <random>
 #include <vector>
 
+#include <Eigen/Dense>
+
 #include "drake/common/drake_copyable.h"
+#include "drake/common/philox4x32.h"
 #include "drake/common/unused.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -17,6 +21,61 @@ namespace internal {
 template <typename Generator = std::mt19937>
 typename Generator::result_type generate_unique_seed();
 
+/// Fills @p values with samples of @p distribution drawn from @p generator.
+/// The generic version draws the samples one at a time; the specializations
+/// below draw them in bulk.
+template <typename Distribution, typename Generator>
+struct BulkSampler {
+  static void Fill(Distribution* distribution, Generator* generator,
+                   Eigen::Ref<Eigen::VectorXd> values) {
+    for (int i = 0; i < values.size(); ++i) {
+      values[i] = (*distribution)(*generator);
+    }
+  }
+};
+
+/// Samples the uniform distribution over [0, 1) with 53 bits of resolution,
+/// from two 32-bit outputs of Philox4x32 per sample.
+template <>
+struct BulkSampler<std::uniform_real_distribution<double>, Philox4x32> {
+  static void Fill(std::uniform_real_distribution<double>*,
+                   Philox4x32* generator, Eigen::Ref<Eigen::VectorXd> values) {
+    const int num_values = static_cast<int>(values.size());
+    std::vector<uint32_t> bits(2 * num_values);
+    generator->Fill(bits.data(), 2 * num_values);
+    for (int i = 0; i < num_values; ++i) {
+      const uint32_t high = bits[2 * i] >> 5;
+      const uint32_t low = bits[2 * i + 1] >> 6;
+      values[i] = (high * 67108864.0 + low) * (1.0 / 9007199254740992.0);
+    }
+  }
+};
+
+/// Samples the standard normal distribution with the Box-Muller transform,
+/// from uniform samples that are generated in bulk. Each pair of uniform
+/// samples gives one value in the first half of @p values, and one in the
+/// second half.
+template <>
+struct BulkSampler<std::normal_distribution<double>, Philox4x32> {
+  static void Fill(std::normal_distribution<double>*, Philox4x32* generator,
+                   Eigen::Ref<Eigen::VectorXd> values) {
+    const int num_values = static_cast<int>(values.size());
+    const int num_pairs = (num_values + 1) / 2;
+    std::vector<uint32_t> bits(2 * num_pairs);
+    generator->Fill(bits.data(), 2 * num_pairs);
+    for (int i = 0; i < num_pairs; ++i) {
+      // u is in (0, 1], so that its logarithm is finite.
+      const double u = (bits[2 * i] + 1.0) * (1.0 / 4294967296.0);
+      const double angle = bits[2 * i + 1] * (2.0 * M_PI / 4294967296.0);
+      const double radius = std::sqrt(-2.0 * std::log(u));
+      values[i] = radius * std::cos(angle);
+      if (num_pairs + i < num_values) {
+        values[num_pairs + i] = radius * std::sin(angle);
+      }
+    }
+  }
+};
+
 /// State for a given random distribution and generator. This owns both the
 /// distribution and the generator.
 template <typename Distribution, typename Generator = std::mt19937>
@@ -30,6 +89,14 @@ class RandomState {
   /// Generate the next random value with the given distribution.
   double GetNextValue() { return distribution_(generator_); }
 
+  /// Fills @p values with the next random values of the given distribution.
+  /// For the Philox4x32 generator, the uniform and normal distributions are
+  /// sampled in bulk, with results that are the same on all platforms.
+  void FillValues(Eigen::Ref<Eigen::VectorXd> values) {
+    BulkSampler<Distribution, Generator>::Fill(&distribution_, &generator_,
+                                               values);
+  }
+
  private:
   // TODO(russt): Obtain consistent results across multiple platforms (#4361).
   Generator generator_;
@@ -46,6 +113,10 @@ class RandomState {
 /// concept.
 ///   http://en.cppreference.com/w/cpp/concept/RandomNumberDistribution
 ///
+/// @tparam Generator A class modeling the c++ UniformRandomBitGenerator
+/// concept. With Philox4x32, the samples are the same on all platforms, and
+/// the uniform and normal samples of all outputs are drawn in bulk.
+///
 /// @note User code should not instantiate this class directly, but
 /// should use systems::UniformRandomSource, systems::GaussianRandomSource, and
 /// systems::ExponentialRandomSource systems instead.
@@ -86,18 +157,17 @@ class RandomSource : public LeafSystem<double> {
   void set_random_seed(Seed seed) { seed_ = seed; }
 
  private:
-  // Computes a random number and stores it in the discrete state.
+  // Computes the random numbers for all outputs at once and stores them in
+  // the discrete state.
   void DoCalcUnrestrictedUpdate(
       const Context<double>&,
       const std::vector<const UnrestrictedUpdateEvent<double>*>&,
       State<double>* state) const override {
     auto& random_state =
         state->template get_mutable_abstract_state<RandomState>(0);
-    auto& updates = state->get_mutable_discrete_state();
-    const int N = updates.size();
-    for (int i = 0; i < N; i++) {
-      updates[i] = random_state.GetNextValue();
-    }
+    random_state.FillValues(
+        state->get_mutable_discrete_state().get_mutable_vector(0)
+            .get_mutable_value());
   }
 
   std::unique_ptr<AbstractValues> AllocateAbstractState() const override {
@@ -108,7 +178,7 @@ class RandomSource : public LeafSystem<double> {
   // Output is the zero-order hold of the discrete state.
   void CopyStateToOutput(const Context<double>& context,
                          BasicVector<double>* output) const {
-    output->SetFromVector(context.get_discrete_state(0).CopyToVector());
+    output->SetFromVector(context.get_discrete_state(0).get_value());
   }
 
   Seed seed_{RandomState::default_seed};
@@ -1,7 +1,11 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <stdexcept>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/extract_double.h"
+#include "drake/systems/primitives/signal_log_file.h"
 
 namespace drake {
 namespace systems {
@@ -15,10 +19,29 @@ SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
   DRAKE_DEMAND(batch_allocation_size_ > 0);
 }
 
+template <typename T>
+SignalLog<T>::~SignalLog() {
+  // Errors can't be reported from here; FlushStream() reports them.
+  if (stream_) {
+    try {
+      WritePendingStreamData();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
 template <typename T>
 void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
-    ++num_samples_;
+  if (stream_) AddStreamData(time, sample);
+
+  if (num_samples_ == 0 || time >= sample_times_(column(num_samples_ - 1))) {
+    if (capacity_ == 0 || num_samples_ < capacity_) {
+      ++num_samples_;
+    } else {
+      // The ring buffer is full, so the oldest sample makes way.
+      start_ = (start_ + 1) % capacity_;
+    }
+  }
 
   // If num_samples exceeds the current allocation, then do a conservative
   // resize (ouch!).
@@ -26,6 +49,7 @@ void SignalLog<T>::AddData(T time, VectorX<T> sample) {
   // single block of contiguous memory on the (first) data access, to avoid the
   // O(n^2) complexity.
   if (num_samples_ > sample_times_.size()) {
+    DRAKE_ASSERT(capacity_ == 0);
     sample_times_.conservativeResize(sample_times_.size() +
         batch_allocation_size_);
     data_.conservativeResize(data_.rows(),
@@ -33,8 +57,78 @@ void SignalLog<T>::AddData(T time, VectorX<T> sample) {
   }
 
   // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  const int64_t index = column(num_samples_ - 1);
+  sample_times_(index) = time;
+  data_.col(index) = sample;
+}
+
+template <typename T>
+void SignalLog<T>::set_ring_buffer_capacity(int capacity) {
+  DRAKE_DEMAND(capacity >= 0);
+  capacity_ = capacity;
+  const int64_t size = (capacity > 0) ? capacity : batch_allocation_size_;
+  sample_times_.resize(size);
+  data_.resize(data_.rows(), size);
+  reset();
+}
+
+template <typename T>
+void SignalLog<T>::Linearize() const {
+  if (start_ == 0) return;
+  // Only a full ring buffer wraps around.
+  DRAKE_ASSERT(num_samples_ == capacity_);
+  const int64_t num_oldest = capacity_ - start_;
+  VectorX<T> times(capacity_);
+  times.head(num_oldest) = sample_times_.tail(num_oldest);
+  times.tail(start_) = sample_times_.head(start_);
+  MatrixX<T> data(data_.rows(), capacity_);
+  data.leftCols(num_oldest) = data_.rightCols(num_oldest);
+  data.rightCols(start_) = data_.leftCols(start_);
+  sample_times_.swap(times);
+  data_.swap(data);
+  start_ = 0;
+}
+
+template <typename T>
+void SignalLog<T>::StreamToFile(const std::string& filename) {
+  if (stream_) WritePendingStreamData();
+  stream_ = std::make_unique<SignalLogFileWriter>(filename, data_.rows());
+  num_pending_ = 0;
+  pending_times_.resize(batch_allocation_size_);
+  pending_data_.resize(data_.rows(), batch_allocation_size_);
+}
+
+template <typename T>
+void SignalLog<T>::FlushStream() {
+  if (!stream_) return;
+  WritePendingStreamData();
+  stream_->Flush();
+}
+
+template <typename T>
+void SignalLog<T>::AddStreamData(const T& time, const VectorX<T>& sample) {
+  // As in the log itself, a sample that goes back in time replaces the
+  // previous one, as long as that one hasn't been written yet.
+  if (num_pending_ > 0 && time < pending_times_(num_pending_ - 1)) {
+    --num_pending_;
+  }
+  pending_times_(num_pending_) = time;
+  pending_data_.col(num_pending_) = sample;
+  if (++num_pending_ == batch_allocation_size_) WritePendingStreamData();
+}
+
+template <typename T>
+void SignalLog<T>::WritePendingStreamData() {
+  if (num_pending_ == 0) return;
+  const auto to_double = [](const T& value) {
+    return ExtractDoubleOrThrow(value);
+  };
+  const Eigen::VectorXd times =
+      pending_times_.head(num_pending_).unaryExpr(to_double);
+  const Eigen::MatrixXd data =
+      pending_data_.leftCols(num_pending_).unaryExpr(to_double);
+  num_pending_ = 0;
+  stream_->Append(times, data);
 }
 
 }  // namespace systems
@@ -1,14 +1,25 @@
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
 namespace drake {
 namespace systems {
 
+class SignalLogFileWriter;
+
 /**
  This class serves as an in-memory cache of time-dependent vector values.
 
+ By default the log keeps every sample, growing its storage as needed. For
+ long runs, the log can instead be limited to the most recent samples with
+ set_ring_buffer_capacity(), and every sample can also be written to a file
+ with StreamToFile(); together they bound the memory used by the log
+ regardless of the length of the run.
+
  @tparam T The vector element type, which must be a valid Eigen scalar.
  */
 template <typename T>
@@ -23,24 +34,55 @@ class SignalLog {
   */
   explicit SignalLog(int input_size, int batch_allocation_size = 1000);
 
+  ~SignalLog();
+
   /** Accesses the logged time stamps. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
+    Linearize();
     return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
   }
 
   /** Accesses the logged data. */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
+    Linearize();
     return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
   }
 
-  /** Reset the logged data. */
+  /** Reset the logged data. Samples that were already passed to the file of
+   StreamToFile() are not affected. */
   void reset() {
     // Resetting num_samples_ is sufficient to have all future writes and
     // reads re-initialized to the beginning of the data.
     num_samples_ = 0;
+    start_ = 0;
   }
 
+  /** Limits the log to the `capacity` most recent samples; once it is full,
+   each new sample replaces the oldest one. The storage for `capacity`
+   samples is allocated here, once. To keep the last `N` seconds of a signal
+   that is logged every `h` seconds, use a capacity of `N / h`. Passing zero
+   restores the default, unbounded log. Clears the log. */
+  void set_ring_buffer_capacity(int capacity);
+
+  /** Returns the capacity set by set_ring_buffer_capacity(), or zero if the
+   log is unbounded. */
+  int get_ring_buffer_capacity() const { return capacity_; }
+
+  /** Also writes every subsequent sample to the columnar binary file
+   `filename`, which can be read with SignalLogFileReader. Samples are
+   gathered into chunks of `batch_allocation_size` samples, and each chunk is
+   written by a background thread; the last, partial chunk is written by
+   FlushStream() or when this log is destroyed. Sample values are converted
+   to double with ExtractDoubleOrThrow().
+   @throws std::runtime_error if the file cannot be opened. */
+  void StreamToFile(const std::string& filename);
+
+  /** Writes every sample passed to the StreamToFile() file so far, and waits
+   for the writes to complete. Does nothing if the log is not streaming.
+   @throws std::runtime_error if any write failed. */
+  void FlushStream();
+
   /** Adds a `sample` to the data set with the associated `time` value.
 
    @param time      The time value for this sample.
@@ -52,12 +94,38 @@ class SignalLog {
   int64_t get_input_size() const { return data_.rows(); }
 
  private:
+  // Returns the column of data_ that holds the i'th oldest sample.
+  int64_t column(int64_t i) const {
+    return (capacity_ == 0) ? i : (start_ + i) % capacity_;
+  }
+
+  // Rotates a wrapped ring buffer so that the oldest sample is in column 0,
+  // as the accessors require.
+  void Linearize() const;
+
+  // Adds a sample to the chunk that is to be written to the stream.
+  void AddStreamData(const T& time, const VectorX<T>& sample);
+
+  // Passes the chunk gathered by AddStreamData() to the stream's writer.
+  void WritePendingStreamData();
+
   const int batch_allocation_size_{1000};
 
-  // Use mutable variables to hold the logged data.
+  // The ring buffer capacity, or zero for an unbounded log.
+  int capacity_{0};
+
+  // Use mutable variables to hold the logged data. In a ring buffer, the
+  // oldest sample is in column start_, and the samples wrap around the end.
   mutable int64_t num_samples_{0};
+  mutable int64_t start_{0};
   mutable VectorX<T> sample_times_;
   mutable MatrixX<T> data_;
+
+  // The StreamToFile() writer, if any, and the chunk not yet passed to it.
+  std::unique_ptr<SignalLogFileWriter> stream_;
+  int64_t num_pending_{0};
+  VectorX<T> pending_times_;
+  MatrixX<T> pending_data_;
 };
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,216 @@
+#include "drake/systems/primitives/signal_log_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// "DRKLOG01" when read as little-endian bytes.
+constexpr int64_t kSignalLogFileMagic = 0x3130474f4c4b5244;
+constexpr size_t kHeaderSize = 2 * sizeof(int64_t);
+
+}  // namespace
+
+SignalLogFileWriter::SignalLogFileWriter(const std::string& filename,
+                                         int input_size)
+    : input_size_(input_size) {
+  DRAKE_DEMAND(input_size > 0);
+  file_ = std::fopen(filename.c_str(), "wb");
+  if (file_ == nullptr) {
+    throw std::runtime_error("SignalLogFileWriter: unable to open " +
+                             filename + ".");
+  }
+  const int64_t header[2] = {kSignalLogFileMagic, input_size};
+  if (std::fwrite(header, sizeof(header), 1, file_) != 1) {
+    std::fclose(file_);
+    throw std::runtime_error("SignalLogFileWriter: unable to write " +
+                             filename + ".");
+  }
+  thread_ = std::thread(&SignalLogFileWriter::Loop, this);
+}
+
+SignalLogFileWriter::~SignalLogFileWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queue_changed_.notify_all();
+  thread_.join();
+  std::fclose(file_);
+}
+
+void SignalLogFileWriter::Append(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    const Eigen::Ref<const Eigen::MatrixXd>& data) {
+  DRAKE_DEMAND(data.rows() == input_size_);
+  DRAKE_DEMAND(data.cols() == times.size());
+  const int64_t num_samples = times.size();
+  if (num_samples == 0) return;
+
+  // Lay the chunk out as it goes to disk: times first, then each channel.
+  std::vector<double> chunk(num_samples * (1 + input_size_));
+  Eigen::Map<Eigen::VectorXd>(chunk.data(), num_samples) = times;
+  Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                           Eigen::RowMajor>>(
+      chunk.data() + num_samples, input_size_, num_samples) = data;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThrowIfFailed();
+    queue_.push_back(std::move(chunk));
+  }
+  queue_changed_.notify_all();
+}
+
+void SignalLogFileWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_changed_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+  if (error_.empty() && std::fflush(file_) != 0) {
+    error_ = "SignalLogFileWriter: unable to flush the file.";
+  }
+  ThrowIfFailed();
+}
+
+void SignalLogFileWriter::ThrowIfFailed() {
+  if (!error_.empty()) throw std::runtime_error(error_);
+}
+
+void SignalLogFileWriter::Loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    queue_changed_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+    if (queue_.empty()) return;
+    std::vector<double> chunk = std::move(queue_.front());
+    queue_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    const int64_t num_samples = chunk.size() / (1 + input_size_);
+    const bool ok =
+        std::fwrite(&num_samples, sizeof(num_samples), 1, file_) == 1 &&
+        std::fwrite(chunk.data(), sizeof(double), chunk.size(), file_) ==
+            chunk.size();
+
+    lock.lock();
+    busy_ = false;
+    if (!ok && error_.empty()) {
+      error_ = "SignalLogFileWriter: unable to write to the file.";
+    }
+    queue_changed_.notify_all();
+  }
+}
+
+SignalLogFileReader::SignalLogFileReader(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("SignalLogFileReader: unable to open " +
+                             filename + ".");
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < kHeaderSize) {
+    ::close(fd);
+    throw std::runtime_error("SignalLogFileReader: " + filename +
+                             " is not a signal log file.");
+  }
+  mapping_size_ = status.st_size;
+  mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    throw std::runtime_error("SignalLogFileReader: unable to map " +
+                             filename + ".");
+  }
+
+  const auto* header = static_cast<const int64_t*>(mapping_);
+  if (header[0] != kSignalLogFileMagic || header[1] <= 0) {
+    ::munmap(mapping_, mapping_size_);
+    throw std::runtime_error("SignalLogFileReader: " + filename +
+                             " is not a signal log file.");
+  }
+  input_size_ = static_cast<int>(header[1]);
+
+  // Index the chunks. A trailing chunk that was cut short, e.g., because the
+  // writing process died, is ignored.
+  const size_t num_words = mapping_size_ / sizeof(int64_t);
+  size_t word = kHeaderSize / sizeof(int64_t);
+  while (word < num_words) {
+    const int64_t num_samples = header[word];
+    const size_t max_samples = (num_words - word - 1) / (1 + input_size_);
+    if (num_samples <= 0 || static_cast<size_t>(num_samples) > max_samples) {
+      break;
+    }
+    chunks_.push_back(Chunk{
+        num_samples, reinterpret_cast<const double*>(header + word + 1)});
+    num_samples_ += num_samples;
+    word += 1 + num_samples * (1 + input_size_);
+  }
+}
+
+SignalLogFileReader::~SignalLogFileReader() {
+  ::munmap(mapping_, mapping_size_);
+}
+
+Eigen::Map<const Eigen::VectorXd> SignalLogFileReader::chunk_sample_times(
+    int chunk) const {
+  DRAKE_DEMAND(chunk >= 0 && chunk < num_chunks());
+  const Chunk& c = chunks_[chunk];
+  return Eigen::Map<const Eigen::VectorXd>(c.times, c.num_samples);
+}
+
+Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                               Eigen::RowMajor>>
+SignalLogFileReader::chunk_data(int chunk) const {
+  DRAKE_DEMAND(chunk >= 0 && chunk < num_chunks());
+  const Chunk& c = chunks_[chunk];
+  return Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                                        Eigen::RowMajor>>(
+      c.times + c.num_samples, input_size_, c.num_samples);
+}
+
+Eigen::VectorXd SignalLogFileReader::ReadSampleTimes() const {
+  Eigen::VectorXd result(num_samples_);
+  int64_t offset = 0;
+  for (int i = 0; i < num_chunks(); ++i) {
+    const auto times = chunk_sample_times(i);
+    result.segment(offset, times.size()) = times;
+    offset += times.size();
+  }
+  return result;
+}
+
+Eigen::VectorXd SignalLogFileReader::ReadChannel(int channel) const {
+  DRAKE_DEMAND(channel >= 0 && channel < input_size_);
+  Eigen::VectorXd result(num_samples_);
+  int64_t offset = 0;
+  for (int i = 0; i < num_chunks(); ++i) {
+    const auto data = chunk_data(i);
+    result.segment(offset, data.cols()) = data.row(channel).transpose();
+    offset += data.cols();
+  }
+  return result;
+}
+
+Eigen::MatrixXd SignalLogFileReader::ReadData() const {
+  Eigen::MatrixXd result(input_size_, num_samples_);
+  int64_t offset = 0;
+  for (int i = 0; i < num_chunks(); ++i) {
+    const auto data = chunk_data(i);
+    result.middleCols(offset, data.cols()) = data;
+    offset += data.cols();
+  }
+  return result;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ Writes logged samples to a columnar binary file from a background thread, so
+ that a long simulation can log more data than fits in memory. A file written
+ by this class is read by SignalLogFileReader.
+
+ The file holds a header followed by a sequence of chunks, one per call to
+ Append(). Each chunk holds its number of samples `n`, then the `n` sample
+ times, then the `n` values of each channel in turn. All values are 8-byte
+ integers or doubles in the native byte order of the host, so every value is
+ aligned when the file is memory mapped.
+
+ Append() only copies the samples and queues them; any error that occurs
+ while writing is reported by the next call to Append() or Flush().
+ */
+class SignalLogFileWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SignalLogFileWriter)
+
+  /** Creates (or truncates) @p filename and writes the file header.
+   @param input_size  The number of channels in each sample.
+   @throws std::runtime_error if the file cannot be opened. */
+  SignalLogFileWriter(const std::string& filename, int input_size);
+
+  /** Writes the queued chunks and closes the file. Errors are ignored; call
+   Flush() first to have them reported. */
+  ~SignalLogFileWriter();
+
+  /** Queues a chunk of samples to be written, where column `i` of @p data is
+   the sample at time `times(i)`. */
+  void Append(const Eigen::Ref<const Eigen::VectorXd>& times,
+              const Eigen::Ref<const Eigen::MatrixXd>& data);
+
+  /** Blocks until every queued chunk has been written to the file.
+   @throws std::runtime_error if any write failed. */
+  void Flush();
+
+  int get_input_size() const { return input_size_; }
+
+ private:
+  void Loop();
+  void ThrowIfFailed();
+
+  const int input_size_;
+  std::FILE* file_{nullptr};
+
+  // Guards the members below it, which are shared with thread_.
+  std::mutex mutex_;
+  std::condition_variable queue_changed_;
+  std::deque<std::vector<double>> queue_;
+  bool busy_{false};
+  bool stop_{false};
+  std::string error_;
+
+  std::thread thread_;
+};
+
+/**
+ Reads a file written by SignalLogFileWriter. The file is memory mapped, so
+ opening it is cheap regardless of its size, and only the parts that are
+ accessed are read from disk.
+ */
+class SignalLogFileReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SignalLogFileReader)
+
+  /** Maps @p filename into memory.
+   @throws std::runtime_error if the file cannot be mapped or is not a signal
+   log file. */
+  explicit SignalLogFileReader(const std::string& filename);
+
+  ~SignalLogFileReader();
+
+  /** Returns the number of channels in each sample. */
+  int get_input_size() const { return input_size_; }
+
+  /** Returns the total number of samples in the file. */
+  int64_t num_samples() const { return num_samples_; }
+
+  /** Returns the number of chunks in the file. */
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  /** Returns the sample times of chunk @p chunk, in place. */
+  Eigen::Map<const Eigen::VectorXd> chunk_sample_times(int chunk) const;
+
+  /** Returns the data of chunk @p chunk in place, with one row per channel
+   and one column per sample. */
+  Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                                 Eigen::RowMajor>>
+  chunk_data(int chunk) const;
+
+  /** Copies the sample times of every chunk into a single vector. */
+  Eigen::VectorXd ReadSampleTimes() const;
+
+  /** Copies the values of channel @p channel from every chunk into a single
+   vector, without touching the other channels. */
+  Eigen::VectorXd ReadChannel(int channel) const;
+
+  /** Copies every sample into a single matrix, as SignalLog::data() would
+   return it. */
+  Eigen::MatrixXd ReadData() const;
+
+ private:
+  struct Chunk {
+    int64_t num_samples{};
+    const double* times{};
+  };
+
+  void* mapping_{nullptr};
+  size_t mapping_size_{0};
+  int input_size_{0};
+  int64_t num_samples_{0};
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -54,6 +55,22 @@ class SignalLogger : public LeafSystem<T> {
 
   void reset() { log_.reset(); }
 
+  /// Limits the log to its most recent samples; see
+  /// SignalLog::set_ring_buffer_capacity().
+  void set_ring_buffer_capacity(int capacity) {
+    log_.set_ring_buffer_capacity(capacity);
+  }
+
+  /// Also writes the logged data to a file as it arrives; see
+  /// SignalLog::StreamToFile().
+  void StreamToFile(const std::string& filename) {
+    log_.StreamToFile(filename);
+  }
+
+  /// Completes the writes to the StreamToFile() file; see
+  /// SignalLog::FlushStream().
+  void FlushStream() { log_.FlushStream(); }
+
   /// Returns the only input port.
   const InputPortDescriptor<T>& get_input_port() const;
 
@@ -0,0 +1,150 @@
+#include "drake/systems/primitives/linear_primitive_fusion.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/affine_system.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/demultiplexer.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/matrix_gain.h"
+#include "drake/systems/primitives/multiplexer.h"
+#include "drake/systems/primitives/pass_through.h"
+#include "drake/systems/primitives/saturation.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Evaluates output port @p index of @p diagram, with @p u on its sole input
+// port if it has one.
+Eigen::VectorXd EvalOutput(const Diagram<double>& diagram,
+                           const Eigen::VectorXd& u, int index = 0) {
+  auto context = diagram.CreateDefaultContext();
+  if (diagram.get_num_input_ports() > 0) {
+    context->FixInputPort(0, u);
+  }
+  auto output = diagram.AllocateOutput(*context);
+  diagram.CalcOutput(*context, output.get());
+  return output->get_vector_data(index)->CopyToVector();
+}
+
+Eigen::Matrix4d MakeMatrix() {
+  Eigen::Matrix4d D;
+  // clang-format off
+  D << 1, 2, 0, -1,
+       0, 1, 3,  0,
+       2, 0, 1,  1,
+      -1, 1, 0,  2;
+  // clang-format on
+  return D;
+}
+
+// u → Gain → MatrixGain → Demultiplexer → Adder → PassThrough → y, with u and
+// y exported.
+std::unique_ptr<Diagram<double>> MakeChain(bool fuse) {
+  DiagramBuilder<double> builder;
+  const auto gain = builder.AddSystem<Gain<double>>(2.0, 4);
+  const auto matrix_gain = builder.AddSystem<MatrixGain<double>>(MakeMatrix());
+  const auto demux = builder.AddSystem<Demultiplexer<double>>(4, 2);
+  const auto adder = builder.AddSystem<Adder<double>>(2, 2);
+  const auto pass_through = builder.AddSystem<PassThrough<double>>(2);
+  pass_through->set_name("output");
+  builder.ExportInput(gain->get_input_port());
+  builder.Connect(*gain, *matrix_gain);
+  builder.Connect(*matrix_gain, *demux);
+  builder.Connect(demux->get_output_port(0), adder->get_input_port(0));
+  builder.Connect(demux->get_output_port(1), adder->get_input_port(1));
+  builder.Connect(*adder, *pass_through);
+  builder.ExportOutput(pass_through->get_output_port());
+  if (fuse) {
+    EXPECT_EQ(FuseLinearPrimitives(&builder), 5);
+  }
+  return builder.Build();
+}
+
+GTEST_TEST(LinearPrimitiveFusionTest, FusesChain) {
+  const auto expected = MakeChain(false);
+  const auto fused = MakeChain(true);
+
+  ASSERT_EQ(fused->GetSystems().size(), 1);
+  const auto* matrix_gain =
+      dynamic_cast<const MatrixGain<double>*>(fused->GetSystems()[0]);
+  ASSERT_NE(matrix_gain, nullptr);
+  EXPECT_EQ(matrix_gain->get_name(), "output");
+  EXPECT_EQ(fused->get_num_input_ports(), 1);
+  EXPECT_EQ(fused->get_input_port(0).size(), 4);
+  EXPECT_EQ(fused->get_num_output_ports(), 1);
+  EXPECT_EQ(fused->get_output_port(0).size(), 2);
+
+  const Eigen::Vector4d u(1., -2., 0.5, 3.);
+  EXPECT_TRUE(CompareMatrices(EvalOutput(*fused, u), EvalOutput(*expected, u),
+                              1e-14));
+}
+
+// source → Multiplexer → AffineSystem → Gain → Saturation → y. The constant
+// offset of the affine system survives the fusion, and the nonlinear
+// Saturation is left alone.
+GTEST_TEST(LinearPrimitiveFusionTest, FusesAffineChainBetweenOtherSystems) {
+  for (const bool fuse : {false, true}) {
+    DiagramBuilder<double> builder;
+    const auto source = builder.AddSystem<ConstantVectorSource<double>>(
+        Eigen::Vector2d(0.3, -0.4));
+    const auto mux = builder.AddSystem<Multiplexer<double>>(2);
+    const auto demux = builder.AddSystem<Demultiplexer<double>>(2, 1);
+    const Eigen::Matrix2d D = MakeMatrix().topLeftCorner<2, 2>();
+    const auto affine = builder.AddSystem<AffineSystem<double>>(
+        Eigen::MatrixXd::Zero(0, 0), Eigen::MatrixXd::Zero(0, 2),
+        Eigen::VectorXd::Zero(0), Eigen::MatrixXd::Zero(2, 0), D,
+        Eigen::Vector2d(1., 2.));
+    const auto gain =
+        builder.AddSystem<Gain<double>>(Eigen::Vector2d(0.5, -3.));
+    const auto saturation = builder.AddSystem<Saturation<double>>(
+        Eigen::Vector2d::Constant(-1.), Eigen::Vector2d::Constant(1.));
+    builder.Connect(*source, *demux);
+    builder.Connect(demux->get_output_port(0), mux->get_input_port(0));
+    builder.Connect(demux->get_output_port(1), mux->get_input_port(1));
+    builder.Connect(*mux, *affine);
+    builder.Connect(*affine, *gain);
+    builder.Connect(gain->get_output_port(), saturation->get_input_port());
+    builder.ExportOutput(saturation->get_output_port());
+    if (fuse) {
+      EXPECT_EQ(FuseLinearPrimitives(&builder), 4);
+    }
+    const auto diagram = builder.Build();
+    if (fuse) {
+      EXPECT_EQ(diagram->GetSystems().size(), 3);
+    }
+    // (0.5, -3) ⊙ (D [0.3, -0.4] + [1, 2]) = [0.25, -4.8], saturated.
+    EXPECT_TRUE(CompareMatrices(EvalOutput(*diagram, Eigen::VectorXd()),
+                                Eigen::Vector2d(0.25, -1.), 1e-14));
+  }
+}
+
+// Groups whose intermediate signals are observed from outside are not fused.
+GTEST_TEST(LinearPrimitiveFusionTest, KeepsObservedIntermediateSignals) {
+  DiagramBuilder<double> builder;
+  const auto gain = builder.AddSystem<Gain<double>>(2.0, 4);
+  const auto matrix_gain = builder.AddSystem<MatrixGain<double>>(MakeMatrix());
+  builder.ExportInput(gain->get_input_port());
+  builder.Connect(*gain, *matrix_gain);
+  builder.ExportOutput(matrix_gain->get_output_port());
+  builder.ExportOutput(gain->get_output_port());
+  EXPECT_EQ(FuseLinearPrimitives(&builder), 0);
+  const auto diagram = builder.Build();
+  EXPECT_EQ(diagram->GetSystems().size(), 2);
+
+  const Eigen::Vector4d u(1., -2., 0.5, 3.);
+  EXPECT_TRUE(CompareMatrices(EvalOutput(*diagram, u, 0),
+                              MakeMatrix() * 2. * u, 1e-14));
+  EXPECT_TRUE(CompareMatrices(EvalOutput(*diagram, u, 1), 2. * u, 1e-14));
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/systems/primitives/linear_system.h"
 
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -697,6 +699,64 @@ GTEST_TEST(LinearizeTest, TestInputOutputPorts) {
   TestMimo(true);
 }
 
+// Tests that a Linearizer reproduces FirstOrderTaylorApproximation() at many
+// operating points, on one or several threads, and that a subset of the
+// columns matches the corresponding columns of the full linearization.
+GTEST_TEST(LinearizerTest, MatchesFirstOrderTaylorApproximation) {
+  examples::pendulum::PendulumPlant<double> pendulum;
+  const int kNumPoints = 7;
+  std::vector<std::unique_ptr<Context<double>>> owned_contexts;
+  std::vector<const Context<double>*> contexts;
+  for (int i = 0; i < kNumPoints; ++i) {
+    auto context = pendulum.CreateDefaultContext();
+    auto input = std::make_unique<examples::pendulum::PendulumInput<double>>();
+    input->set_tau(0.1 * i);
+    context->FixInputPort(0, std::move(input));
+    context->get_mutable_continuous_state_vector().SetFromVector(
+        Eigen::Vector2d(0.4 * i, -0.2 * i));
+    contexts.push_back(context.get());
+    owned_contexts.push_back(std::move(context));
+  }
+
+  const Linearizer linearizer(pendulum);
+  EXPECT_EQ(linearizer.num_inputs(), 1);
+  EXPECT_EQ(linearizer.num_outputs(), 2);
+  const double tol = 1e-12;
+  for (int num_threads : {1, 3}) {
+    const std::vector<std::unique_ptr<AffineSystem<double>>> results =
+        linearizer.FirstOrderTaylorApproximations(contexts, num_threads);
+    ASSERT_EQ(static_cast<int>(results.size()), kNumPoints);
+    for (int i = 0; i < kNumPoints; ++i) {
+      const auto expected =
+          FirstOrderTaylorApproximation(pendulum, *contexts[i]);
+      EXPECT_TRUE(CompareMatrices(results[i]->A(), expected->A(), tol));
+      EXPECT_TRUE(CompareMatrices(results[i]->B(), expected->B(), tol));
+      EXPECT_TRUE(CompareMatrices(results[i]->f0(), expected->f0(), tol));
+      EXPECT_TRUE(CompareMatrices(results[i]->C(), expected->C(), tol));
+      EXPECT_TRUE(CompareMatrices(results[i]->D(), expected->D(), tol));
+      EXPECT_TRUE(CompareMatrices(results[i]->y0(), expected->y0(), tol));
+    }
+  }
+
+  const std::vector<Linearization> partials =
+      linearizer.CalcLinearizations(contexts, {1}, {}, 2);
+  ASSERT_EQ(static_cast<int>(partials.size()), kNumPoints);
+  for (int i = 0; i < kNumPoints; ++i) {
+    const auto expected = FirstOrderTaylorApproximation(pendulum, *contexts[i]);
+    EXPECT_TRUE(CompareMatrices(partials[i].A, expected->A().col(1), tol));
+    EXPECT_EQ(partials[i].B.cols(), 0);
+    EXPECT_TRUE(CompareMatrices(partials[i].C, expected->C().col(1), tol));
+    EXPECT_TRUE(CompareMatrices(
+        partials[i].x0, contexts[i]->get_continuous_state_vector()
+                            .CopyToVector(), tol));
+  }
+
+  EXPECT_THROW(linearizer.CalcLinearization(*contexts[0], {2}, {}),
+               std::logic_error);
+  EXPECT_THROW(linearizer.CalcLinearization(*contexts[0], {}, {-1}),
+               std::logic_error);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -120,6 +120,38 @@ GTEST_TEST(RandomSourceTest, ExponentialWhiteNoise) {
                   std::move(random_source));
 }
 
+GTEST_TEST(RandomSourceTest, PhiloxUniformWhiteNoise) {
+  auto random_source = std::make_unique<internal::RandomSource<
+      std::uniform_real_distribution<double>, Philox4x32>>(3, 0.0025);
+  auto Phi = [](double z) { return z; };
+  CheckStatistics(Phi, 0.0, 1.0, 0.1, 2.0, std::move(random_source));
+}
+
+GTEST_TEST(RandomSourceTest, PhiloxGaussianWhiteNoise) {
+  // An odd number of outputs exercises the unpaired Box-Muller sample.
+  auto random_source = std::make_unique<internal::RandomSource<
+      std::normal_distribution<double>, Philox4x32>>(3, 0.0025);
+  auto Phi = [](double z) { return 0.5 * std::erfc(-z / std::sqrt(2.0)); };
+  CheckStatistics(Phi, -2.0, 2.0, 0.1, 2.0, std::move(random_source));
+}
+
+// The bulk samples depend only on the seed.
+GTEST_TEST(RandomSourceTest, PhiloxReproducible) {
+  typedef internal::RandomState<std::normal_distribution<double>, Philox4x32>
+      RandomState;
+  RandomState state1(7);
+  RandomState state2(7);
+  RandomState state3(8);
+  Eigen::VectorXd values1(5), values2(5), values3(5);
+  for (int i = 0; i < 3; ++i) {
+    state1.FillValues(values1);
+    state2.FillValues(values2);
+    state3.FillValues(values3);
+    EXPECT_TRUE(CompareMatrices(values1, values2));
+    EXPECT_FALSE(CompareMatrices(values1, values3));
+  }
+}
+
 class TestSystem : public LeafSystem<double> {
  public:
   // Make methods available.
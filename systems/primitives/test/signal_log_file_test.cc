@@ -0,0 +1,82 @@
+#include "drake/systems/primitives/signal_log_file.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+GTEST_TEST(SignalLogFileTest, RoundTrip) {
+  const std::string filename = temp_directory() + "/round_trip.log";
+  const Eigen::Vector3d times1(0.0, 0.1, 0.2);
+  Eigen::MatrixXd data1(2, 3);
+  data1 << 1, 2, 3,
+           4, 5, 6;
+  const Eigen::Vector2d times2(0.3, 0.4);
+  Eigen::MatrixXd data2(2, 2);
+  data2 << 7, 8,
+           9, 10;
+  {
+    SignalLogFileWriter writer(filename, 2);
+    writer.Append(times1, data1);
+    writer.Append(times2, data2);
+    writer.Flush();
+  }
+
+  SignalLogFileReader reader(filename);
+  EXPECT_EQ(reader.get_input_size(), 2);
+  EXPECT_EQ(reader.num_samples(), 5);
+  ASSERT_EQ(reader.num_chunks(), 2);
+  EXPECT_EQ(reader.chunk_sample_times(1), times2);
+  EXPECT_EQ(Eigen::MatrixXd(reader.chunk_data(0)), data1);
+
+  Eigen::VectorXd expected_times(5);
+  expected_times << times1, times2;
+  EXPECT_EQ(reader.ReadSampleTimes(), expected_times);
+  Eigen::MatrixXd expected_data(2, 5);
+  expected_data << data1, data2;
+  EXPECT_EQ(reader.ReadData(), expected_data);
+  EXPECT_EQ(reader.ReadChannel(1), expected_data.row(1).transpose());
+}
+
+// Tests that a chunk that was cut short is ignored, so that the log of a
+// process that died while writing can still be read.
+GTEST_TEST(SignalLogFileTest, TruncatedChunk) {
+  const std::string filename = temp_directory() + "/truncated.log";
+  {
+    SignalLogFileWriter writer(filename, 1);
+    writer.Append(Eigen::Vector2d(0.0, 1.0),
+                  Eigen::RowVector2d(2.0, 3.0));
+    writer.Append(Eigen::Vector2d(2.0, 3.0),
+                  Eigen::RowVector2d(4.0, 5.0));
+  }
+  // Drop the last value of the second chunk; the header and each chunk take
+  // 16 and 40 bytes.
+  ASSERT_EQ(::truncate(filename.c_str(), 16 + 40 + 32), 0);
+
+  SignalLogFileReader reader(filename);
+  EXPECT_EQ(reader.num_chunks(), 1);
+  EXPECT_EQ(reader.ReadSampleTimes(), Eigen::Vector2d(0.0, 1.0));
+}
+
+GTEST_TEST(SignalLogFileTest, NotALog) {
+  const std::string filename = temp_directory() + "/not_a.log";
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  std::fputs("this is not a signal log", file);
+  std::fclose(file);
+  EXPECT_THROW(SignalLogFileReader{filename}, std::runtime_error);
+  EXPECT_THROW(SignalLogFileReader{filename + ".missing"}, std::runtime_error);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
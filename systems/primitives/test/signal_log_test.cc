@@ -0,0 +1,95 @@
+#include "drake/systems/primitives/signal_log.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/temp_directory.h"
+#include "drake/systems/primitives/signal_log_file.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+GTEST_TEST(SignalLogTest, Unbounded) {
+  SignalLog<double> log(1, 2);
+  for (int i = 0; i < 5; ++i) log.AddData(i, Vector1d(10 * i));
+  EXPECT_EQ(log.sample_times(), Eigen::VectorXd::LinSpaced(5, 0, 4));
+  EXPECT_EQ(log.data(), Eigen::RowVectorXd::LinSpaced(5, 0, 40));
+
+  // A sample that goes back in time replaces the most recent one.
+  log.AddData(3.5, Vector1d(35));
+  EXPECT_EQ(log.sample_times().size(), 5);
+  EXPECT_EQ(log.sample_times()(4), 3.5);
+  EXPECT_EQ(log.data()(0, 4), 35);
+}
+
+GTEST_TEST(SignalLogTest, RingBuffer) {
+  SignalLog<double> log(2);
+  log.set_ring_buffer_capacity(3);
+  EXPECT_EQ(log.get_ring_buffer_capacity(), 3);
+
+  log.AddData(0, Eigen::Vector2d(0, 0));
+  log.AddData(1, Eigen::Vector2d(1, -1));
+  EXPECT_EQ(log.sample_times(), Eigen::Vector2d(0, 1));
+
+  for (int i = 2; i < 7; ++i) log.AddData(i, Eigen::Vector2d(i, -i));
+  EXPECT_EQ(log.sample_times(), Eigen::Vector3d(4, 5, 6));
+  Eigen::MatrixXd expected(2, 3);
+  expected << 4, 5, 6,
+             -4, -5, -6;
+  EXPECT_EQ(log.data(), expected);
+
+  // Keep logging after the buffer was read.
+  log.AddData(7, Eigen::Vector2d(7, -7));
+  log.AddData(6.5, Eigen::Vector2d(6.5, -6.5));
+  EXPECT_EQ(log.sample_times(), Eigen::Vector3d(5, 6, 6.5));
+
+  log.reset();
+  EXPECT_EQ(log.sample_times().size(), 0);
+  log.AddData(8, Eigen::Vector2d(8, -8));
+  EXPECT_EQ(log.sample_times(), Vector1d(8));
+
+  // Back to an unbounded log.
+  log.set_ring_buffer_capacity(0);
+  for (int i = 0; i < 5; ++i) log.AddData(i, Eigen::Vector2d(i, -i));
+  EXPECT_EQ(log.sample_times().size(), 5);
+}
+
+GTEST_TEST(SignalLogTest, StreamToFile) {
+  const std::string filename = temp_directory() + "/signal_log_test.log";
+  {
+    SignalLog<double> log(1, 4);
+    log.set_ring_buffer_capacity(2);
+    log.StreamToFile(filename);
+    for (int i = 0; i < 10; ++i) log.AddData(i, Vector1d(i * i));
+    log.FlushStream();
+    EXPECT_EQ(log.sample_times(), Eigen::Vector2d(8, 9));
+
+    SignalLogFileReader reader(filename);
+    EXPECT_EQ(reader.num_chunks(), 3);
+    EXPECT_EQ(reader.ReadSampleTimes(), Eigen::VectorXd::LinSpaced(10, 0, 9));
+    EXPECT_EQ(reader.ReadChannel(0),
+              Eigen::VectorXd::LinSpaced(10, 0, 9).array().square().matrix());
+
+    // The remaining samples are written when the log is destroyed.
+    log.AddData(10, Vector1d(100));
+  }
+  SignalLogFileReader reader(filename);
+  EXPECT_EQ(reader.num_samples(), 11);
+}
+
+GTEST_TEST(SignalLogTest, StreamAutoDiff) {
+  const std::string filename = temp_directory() + "/signal_log_autodiff.log";
+  SignalLog<AutoDiffXd> log(1);
+  log.StreamToFile(filename);
+  log.AddData(AutoDiffXd(1.0), Vector1<AutoDiffXd>(AutoDiffXd(2.0)));
+  log.FlushStream();
+  SignalLogFileReader reader(filename);
+  EXPECT_EQ(reader.ReadData(), Vector1d(2.0));
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
 namespace drake {
@@ -42,6 +44,40 @@ inline PiecewisePolynomial<double> MakeZeroedPiecewisePolynomial(
       eigen_vector_zeros(pp.get_number_of_segments() + 1, pp.rows()));
 }
 
+// Sets @p value to the value of the column trajectory @p pp at time @p t,
+// without allocating memory.
+inline void EvalTrajectoryInto(const PiecewisePolynomial<double>& pp, double t,
+                               Eigen::Ref<VectorX<double>> value) {
+  pp.EvalInto(t, value);
+}
+
+// Sets @p value to the value of the column trajectory @p pp at time @p t.
+template <typename T>
+void EvalTrajectoryInto(const PiecewisePolynomial<double>& pp, double t,
+                        Eigen::Ref<VectorX<T>> value) {
+  value = pp.value(t).template cast<T>();
+}
+
+// Adds the product of the matrix trajectory @p pp at time @p t and @p x to
+// @p y. The product is accumulated one entry of the matrix at a time, so that
+// the matrix is never formed.
+template <typename T>
+void AddTrajectoryProduct(const PiecewisePolynomial<double>& pp, double t,
+                          const Eigen::Ref<const VectorX<T>>& x,
+                          Eigen::Ref<VectorX<T>> y) {
+  DRAKE_DEMAND(pp.rows() == y.size() && pp.cols() == x.size());
+  const int segment_index = pp.get_segment_index(t);
+  const double segment_time =
+      std::min(std::max(t, pp.start_time()), pp.end_time()) -
+      pp.start_time(segment_index);
+  for (Eigen::Index col = 0; col < x.size(); ++col) {
+    for (Eigen::Index row = 0; row < y.size(); ++row) {
+      y(row) += pp.getPolynomial(segment_index, row, col)
+                    .EvaluateUnivariate(segment_time) * x(col);
+    }
+  }
+}
+
 }  // namespace internal
 
 /// Stores matrix data necessary to construct an affine time varying system as a
@@ -1,12 +1,31 @@
 #include "drake/systems/primitives/trajectory_source.h"
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
 
 namespace drake {
 namespace systems {
 
+using trajectories::PiecewisePolynomial;
+using trajectories::PiecewisePolynomialEvaluator;
 using trajectories::Trajectory;
 
+namespace {
+
+// Returns an evaluator for @p trajectory if it is a PiecewisePolynomial, or
+// nullptr otherwise.
+std::unique_ptr<PiecewisePolynomialEvaluator> MaybeMakeEvaluator(
+    const Trajectory<double>& trajectory) {
+  const auto* pp = dynamic_cast<const PiecewisePolynomial<double>*>(
+      &trajectory);
+  if (pp == nullptr) {
+    return nullptr;
+  }
+  return std::make_unique<PiecewisePolynomialEvaluator>(*pp);
+}
+
+}  // namespace
+
 template <typename T>
 TrajectorySource<T>::TrajectorySource(const Trajectory<T>& trajectory,
                                       int output_derivative_order,
@@ -15,12 +34,17 @@ TrajectorySource<T>::TrajectorySource(const Trajectory<T>& trajectory,
                                   (1 + output_derivative_order)),
       // Make a copy of the input trajectory.
       trajectory_(trajectory.Clone()),
+      output_derivative_order_(output_derivative_order),
       clamp_derivatives_(zero_derivatives_beyond_limits) {
   // This class does not currently support trajectories which output
   // more complicated matrices.
   DRAKE_DEMAND(trajectory.cols() == 1);
   DRAKE_DEMAND(output_derivative_order >= 0);
 
+  evaluator_ = MaybeMakeEvaluator(*trajectory_);
+  if (evaluator_) {
+    return;
+  }
   for (int i = 0; i < output_derivative_order; i++) {
     if (i == 0)
       derivatives_.push_back(trajectory_->MakeDerivative());
@@ -33,18 +57,27 @@ template <typename T>
 void TrajectorySource<T>::DoCalcVectorOutput(
     const Context<T>& context, Eigen::VectorBlock<VectorX<T>>* output) const {
   int len = trajectory_->rows();
-  output->head(len) = trajectory_->value(context.get_time());
-
   double time = context.get_time();
   bool set_zero = clamp_derivatives_ && (time > trajectory_->end_time() ||
       time < trajectory_->start_time());
 
+  if (evaluator_) {
+    for (int i = 0; i <= output_derivative_order_; ++i) {
+      if (i > 0 && set_zero) {
+        output->segment(len * i, len).setZero();
+      } else {
+        evaluator_->EvalInto(time, i, output->segment(len * i, len));
+      }
+    }
+    return;
+  }
+
+  trajectory_->EvalInto(time, output->head(len));
   for (size_t i = 0; i < derivatives_.size(); ++i) {
     if (set_zero) {
       output->segment(len * (i + 1), len).setZero();
     } else {
-      output->segment(len * (i + 1), len) =
-          derivatives_[i]->value(context.get_time());
+      derivatives_[i]->EvalInto(time, output->segment(len * (i + 1), len));
     }
   }
 }
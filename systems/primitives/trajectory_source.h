@@ -5,6 +5,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/trajectories/piecewise_polynomial_evaluator.h"
 #include "drake/common/trajectories/trajectory.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/single_output_vector_source.h"
@@ -23,6 +24,9 @@ namespace systems {
 ///
 /// They are already available to link against in the containing library.
 /// No other values for T are currently supported.
+///
+/// A PiecewisePolynomial trajectory is evaluated, along with its derivatives,
+/// by a trajectories::PiecewisePolynomialEvaluator.
 /// @ingroup primitive_systems
 template <typename T>
 class TrajectorySource : public SingleOutputVectorSource<T> {
@@ -52,7 +56,10 @@ class TrajectorySource : public SingleOutputVectorSource<T> {
 
  private:
   const std::unique_ptr<trajectories::Trajectory<T>> trajectory_;
+  const int output_derivative_order_;
   const bool clamp_derivatives_;
+  // Set instead of derivatives_ when trajectory_ is a PiecewisePolynomial.
+  std::unique_ptr<trajectories::PiecewisePolynomialEvaluator> evaluator_;
   std::vector<std::unique_ptr<trajectories::Trajectory<T>>> derivatives_;
 };
 
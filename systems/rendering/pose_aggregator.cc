@@ -1,6 +1,8 @@
 #include "drake/systems/rendering/pose_aggregator.h"
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -12,6 +14,17 @@ namespace drake {
 namespace systems {
 namespace rendering {
 
+namespace {
+// Returns true if @p full_name is `prefix::name`, without building the latter.
+bool IsQualifiedName(const std::string& full_name, const std::string& prefix,
+                     const std::string& name) {
+  return full_name.size() == prefix.size() + 2 + name.size() &&
+         full_name.compare(0, prefix.size(), prefix) == 0 &&
+         full_name.compare(prefix.size(), 2, "::") == 0 &&
+         full_name.compare(prefix.size() + 2, name.size(), name) == 0;
+}
+}  // namespace
+
 template <typename T>
 PoseAggregator<T>::PoseAggregator()
     : LeafSystem<T>(SystemTypeTag<rendering::PoseAggregator>{}) {
@@ -62,6 +75,7 @@ const InputPortDescriptor<T>& PoseAggregator<T>::AddBundleInput(
 template <typename T>
 void PoseAggregator<T>::CalcPoseBundle(const Context<T>& context,
                                        PoseBundle<T>* output) const {
+  UpdatePoseBundleSchema(context, output);
   PoseBundle<T>& bundle = *output;
   int pose_index = 0;
 
@@ -75,9 +89,7 @@ void PoseAggregator<T>::CalcPoseBundle(const Context<T>& context,
             this->template EvalVectorInput<PoseVector>(context, port_index);
         DRAKE_ASSERT(value != nullptr);
         DRAKE_ASSERT(pose_index < bundle.get_num_poses());
-        bundle.set_name(pose_index, record.name);
         bundle.set_pose(pose_index, value->get_isometry());
-        bundle.set_model_instance_id(pose_index, record.model_instance_id);
         pose_index++;
         break;
       }
@@ -109,14 +121,10 @@ void PoseAggregator<T>::CalcPoseBundle(const Context<T>& context,
         const PoseBundle<T>* value =
             this->template EvalInputValue<PoseBundle<T>>(context, port_index);
         DRAKE_ASSERT(num_poses == value->get_num_poses());
-        const std::string& bundle_name = record.name;
         for (int j = 0; j < num_poses; ++j) {
           DRAKE_ASSERT(pose_index < bundle.get_num_poses());
           bundle.set_pose(pose_index, value->get_pose(j));
           bundle.set_velocity(pose_index, value->get_velocity(j));
-          bundle.set_name(pose_index, bundle_name + "::" + value->get_name(j));
-          bundle.set_model_instance_id(pose_index,
-                                       value->get_model_instance_id(j));
           pose_index++;
         }
         break;
@@ -126,6 +134,60 @@ void PoseAggregator<T>::CalcPoseBundle(const Context<T>& context,
   }
 }
 
+template <typename T>
+void PoseAggregator<T>::UpdatePoseBundleSchema(const Context<T>& context,
+                                               PoseBundle<T>* output) const {
+  const PoseBundleSchema& current = *output->get_schema();
+  const int num_ports = this->get_num_input_ports();
+
+  // Compares the current schema with the inputs.
+  bool is_current = true;
+  int pose_index = 0;
+  for (int port_index = 0; port_index < num_ports && is_current;
+       ++port_index) {
+    const InputRecord& record = input_records_[port_index];
+    if (record.type == InputRecord::kSinglePose) {
+      is_current =
+          current.names[pose_index] == record.name &&
+          current.model_instance_ids[pose_index] == record.model_instance_id;
+      pose_index++;
+    } else if (record.type == InputRecord::kBundle) {
+      const PoseBundle<T>* value =
+          this->template EvalInputValue<PoseBundle<T>>(context, port_index);
+      const PoseBundleSchema& input = *value->get_schema();
+      for (int j = 0; j < record.num_poses && is_current; ++j) {
+        is_current =
+            IsQualifiedName(current.names[pose_index], record.name,
+                            input.names[j]) &&
+            current.model_instance_ids[pose_index] ==
+                input.model_instance_ids[j];
+        pose_index++;
+      }
+    }
+  }
+  if (is_current) {
+    return;
+  }
+
+  auto schema = std::make_shared<PoseBundleSchema>();
+  for (int port_index = 0; port_index < num_ports; ++port_index) {
+    const InputRecord& record = input_records_[port_index];
+    if (record.type == InputRecord::kSinglePose) {
+      schema->names.push_back(record.name);
+      schema->model_instance_ids.push_back(record.model_instance_id);
+    } else if (record.type == InputRecord::kBundle) {
+      const PoseBundle<T>* value =
+          this->template EvalInputValue<PoseBundle<T>>(context, port_index);
+      const PoseBundleSchema& input = *value->get_schema();
+      for (int j = 0; j < record.num_poses; ++j) {
+        schema->names.push_back(record.name + "::" + input.names[j]);
+        schema->model_instance_ids.push_back(input.model_instance_ids[j]);
+      }
+    }
+  }
+  output->set_schema(std::move(schema));
+}
+
 template <typename T>
 PoseBundle<T> PoseAggregator<T>::MakePoseBundle() const {
   return PoseBundle<T>(this->CountNumPoses());
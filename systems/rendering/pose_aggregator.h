@@ -117,6 +117,12 @@ class PoseAggregator : public LeafSystem<T> {
   void CalcPoseBundle(const Context<T>& context,
                       PoseBundle<T>* output) const;
 
+  // Replaces the names and model instance IDs of @p output by a new schema,
+  // unless they already match the inputs. The names and IDs rarely change, so
+  // the schema of the output is usually kept, and shared with its copies.
+  void UpdatePoseBundleSchema(const Context<T>& context,
+                              PoseBundle<T>* output) const;
+
   // Constructs a PoseBundle of length equal to the concatenation of all inputs.
   // This is the method used by the allocator for the output port.
   PoseBundle<T> MakePoseBundle() const;
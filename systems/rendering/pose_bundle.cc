@@ -1,5 +1,7 @@
 #include "drake/systems/rendering/pose_bundle.h"
 
+#include <utility>
+
 #include <Eigen/Dense>
 
 #include "drake/common/default_scalars.h"
@@ -11,10 +13,13 @@ namespace rendering {
 
 template <typename T>
 PoseBundle<T>::PoseBundle(int num_poses)
-    : poses_(num_poses),
-      velocities_(num_poses),
-      names_(num_poses),
-      ids_(num_poses) {}
+    : poses_(num_poses), velocities_(num_poses) {
+  auto schema = std::make_shared<PoseBundleSchema>();
+  schema->names.resize(num_poses);
+  schema->model_instance_ids.resize(num_poses);
+  schema_ = std::move(schema);
+  schema_is_private_ = true;
+}
 
 template <typename T>
 PoseBundle<T>::~PoseBundle() {}
@@ -51,25 +56,50 @@ void PoseBundle<T>::set_velocity(int index, const FrameVelocity<T>& velocity) {
 template <typename T>
 const std::string& PoseBundle<T>::get_name(int index) const {
   DRAKE_DEMAND(index >= 0 && index < get_num_poses());
-  return names_[index];
+  return schema_->names[index];
 }
 
 template <typename T>
 void PoseBundle<T>::set_name(int index, const std::string& name) {
   DRAKE_DEMAND(index >= 0 && index < get_num_poses());
-  names_[index] = name;
+  if (schema_->names[index] != name) {
+    get_mutable_schema().names[index] = name;
+  }
 }
+
 template <typename T>
 int PoseBundle<T>::get_model_instance_id(int index) const {
   DRAKE_DEMAND(index >= 0 && index < get_num_poses());
-  return ids_[index];
+  return schema_->model_instance_ids[index];
 }
 
 template <typename T>
 void PoseBundle<T>::set_model_instance_id(int index, int id) {
   DRAKE_DEMAND(index >= 0 && index < get_num_poses());
   DRAKE_DEMAND(id >= 0);
-  ids_[index] = id;
+  if (schema_->model_instance_ids[index] != id) {
+    get_mutable_schema().model_instance_ids[index] = id;
+  }
+}
+
+template <typename T>
+void PoseBundle<T>::set_schema(std::shared_ptr<const PoseBundleSchema> schema) {
+  DRAKE_DEMAND(schema != nullptr);
+  DRAKE_DEMAND(static_cast<int>(schema->names.size()) == get_num_poses());
+  DRAKE_DEMAND(static_cast<int>(schema->model_instance_ids.size()) ==
+               get_num_poses());
+  schema_ = std::move(schema);
+  schema_is_private_ = false;
+}
+
+template <typename T>
+PoseBundleSchema& PoseBundle<T>::get_mutable_schema() {
+  if (!schema_is_private_ || schema_.use_count() != 1) {
+    schema_ = std::make_shared<PoseBundleSchema>(*schema_);
+    schema_is_private_ = true;
+  }
+  // This bundle allocated the schema as non-const, and is its only owner.
+  return const_cast<PoseBundleSchema&>(*schema_);
 }
 
 }  // namespace rendering
@@ -19,6 +19,14 @@ namespace rendering {
 // TODO(david-german-tri, SeanCurtis-TRI): Subsume this functionality into
 // GeometrySystem when it becomes available.
 
+/// The names and model instance IDs of the poses of a PoseBundle. Unlike the
+/// poses and velocities, they rarely change from one evaluation to the next,
+/// so copies of a bundle share a single, immutable schema.
+struct PoseBundleSchema {
+  std::vector<std::string> names;
+  std::vector<int> model_instance_ids;
+};
+
 // TODO(david-german-tri): Consider renaming this to FrameKinematicsBundle,
 // since it contains both poses and velocities.
 
@@ -28,6 +36,11 @@ namespace rendering {
 /// name and a model instance ID.  If two poses in the bundle have the same
 /// model instance ID, they must not have the same name.
 ///
+/// The poses and velocities are stored in contiguous arrays, which are the
+/// only data copied with a bundle. The names and IDs are held by a shared
+/// PoseBundleSchema, which set_name() and set_model_instance_id() copy on
+/// write, and only when the value changes.
+///
 /// This class is explicitly instantiated for the following scalar types. No
 /// other scalar types are supported.
 /// - double
@@ -57,11 +70,28 @@ class PoseBundle {
   int get_model_instance_id(int index) const;
   void set_model_instance_id(int index, int id);
 
+  /// Returns the names and model instance IDs of the poses, which may be
+  /// shared with other bundles.
+  const std::shared_ptr<const PoseBundleSchema>& get_schema() const {
+    return schema_;
+  }
+
+  /// Replaces the names and model instance IDs of all the poses at once by
+  /// @p schema, without copying it. @p schema must have one name and one ID
+  /// per pose.
+  void set_schema(std::shared_ptr<const PoseBundleSchema> schema);
+
  private:
+  // Returns the schema, after copying it unless this bundle allocated it and
+  // is its only owner.
+  PoseBundleSchema& get_mutable_schema();
+
   std::vector<Isometry3<T>> poses_;
   std::vector<FrameVelocity<T>> velocities_;
-  std::vector<std::string> names_;
-  std::vector<int> ids_;
+  std::shared_ptr<const PoseBundleSchema> schema_;
+  // True if schema_ was allocated by this class, in which case it is not a
+  // const object, and can be modified when schema_ is its only owner.
+  bool schema_is_private_{false};
 };
 
 }  // namespace rendering
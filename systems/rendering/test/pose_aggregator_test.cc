@@ -204,6 +204,62 @@ TEST_F(PoseAggregatorTest, AddSinglePoseAndVelocityPorts) {
   EXPECT_EQ(FrameVelocity<double>::kSize, velocity_port.size());
 }
 
+// Tests that the output schema is kept across evaluations while the input
+// names are unchanged, and rebuilt when they change.
+TEST_F(PoseAggregatorTest, SchemaIsReused) {
+  PoseBundle<double> generic_input(2);
+  generic_input.set_name(0, "Sherlock");
+  generic_input.set_name(1, "Mycroft");
+  context_->FixInputPort(0, AbstractValue::Make(generic_input));
+  context_->FixInputPort(1, std::make_unique<PoseVector<double>>());
+  context_->FixInputPort(2, std::make_unique<FrameVelocity<double>>());
+  context_->FixInputPort(3, std::make_unique<PoseVector<double>>());
+
+  aggregator_.CalcOutput(*context_, output_.get());
+  const PoseBundle<double>& bundle =
+      output_->get_data(0)->GetValueOrThrow<PoseBundle<double>>();
+  const PoseBundleSchema* schema = bundle.get_schema().get();
+  aggregator_.CalcOutput(*context_, output_.get());
+  EXPECT_EQ(schema, bundle.get_schema().get());
+
+  generic_input.set_name(1, "Moriarty");
+  context_->FixInputPort(0, AbstractValue::Make(generic_input));
+  aggregator_.CalcOutput(*context_, output_.get());
+  EXPECT_EQ("bundle::Moriarty", bundle.get_name(1));
+  EXPECT_EQ("single_xv", bundle.get_name(2));
+}
+
+// Tests that copies of a PoseBundle share the schema until one of them
+// changes a name or an ID.
+GTEST_TEST(PoseBundleTest, SchemaCopyOnWrite) {
+  PoseBundle<double> original(2);
+  original.set_name(0, "Sherlock");
+  original.set_model_instance_id(1, 13);
+  PoseBundle<double> copy = original;
+  EXPECT_EQ(original.get_schema(), copy.get_schema());
+
+  // Setting the same values does not copy.
+  copy.set_name(0, "Sherlock");
+  copy.set_model_instance_id(1, 13);
+  EXPECT_EQ(original.get_schema(), copy.get_schema());
+
+  copy.set_name(1, "Mycroft");
+  EXPECT_NE(original.get_schema(), copy.get_schema());
+  EXPECT_EQ("", original.get_name(1));
+  EXPECT_EQ("Mycroft", copy.get_name(1));
+  EXPECT_EQ(13, copy.get_model_instance_id(1));
+
+  auto schema = std::make_shared<PoseBundleSchema>();
+  schema->names = {"a", "b"};
+  schema->model_instance_ids = {1, 2};
+  original.set_schema(schema);
+  EXPECT_EQ("b", original.get_name(1));
+  // A schema set from outside is never modified in place.
+  original.set_name(1, "c");
+  EXPECT_EQ("b", schema->names[1]);
+  EXPECT_EQ("c", original.get_name(1));
+}
+
 // Tests that PoseBundle supports Symbolic form.
 GTEST_TEST(PoseBundleTest, Symbolic) {
   PoseBundle<symbolic::Expression> dut{1};
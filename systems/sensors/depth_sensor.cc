@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/rendering/pose_vector.h"
@@ -32,7 +33,8 @@ namespace sensors {
 DepthSensor::DepthSensor(const std::string& name,
                          const RigidBodyTree<double>& tree,
                          const RigidBodyFrame<double>& frame,
-                         const DepthSensorSpecification& specification)
+                         const DepthSensorSpecification& specification,
+                         RaycastBackend backend)
     : name_(name), tree_(tree), frame_(frame), specification_(specification) {
   DRAKE_DEMAND(specification_.min_yaw() <= specification_.max_yaw() &&
                "min_yaw must be less than or equal to max_yaw.");
@@ -67,6 +69,9 @@ DepthSensor::DepthSensor(const std::string& name,
                               &DepthSensor::CalcPoseOutput)
           .get_index();
   PrecomputeRaycastEndpoints();
+  if (backend == RaycastBackend::kBvh) {
+    bvh_ = make_unique<RaycastBvh>(tree_);
+  }
 }
 
 void DepthSensor::PrecomputeRaycastEndpoints() {
@@ -158,11 +163,17 @@ void DepthSensor::CalcDepthOutput(
 
   VectorX<double> distances(get_num_depth_readings());
 
-  // TODO(liang.fok) Remove the need for const_cast once GeometrySystem is
-  // ready. See:
-  // https://github.com/RobotLocomotion/drake/issues/4592#issuecomment-269491752
-  const_cast<RigidBodyTree<double>&>(tree_).collisionRaycast(
-      kinematics_cache, origin, raycast_endpoints_world, distances);
+  if (bvh_) {
+    bvh_->Refit(kinematics_cache);
+    bvh_->CastRays(origin, raycast_endpoints_world, &distances,
+                   GetDefaultNumThreads());
+  } else {
+    // TODO(liang.fok) Remove the need for const_cast once GeometrySystem is
+    // ready. See:
+    // https://github.com/RobotLocomotion/drake/issues/4592#issuecomment-269491752
+    const_cast<RigidBodyTree<double>&>(tree_).collisionRaycast(
+        kinematics_cache, origin, raycast_endpoints_world, distances);
+  }
 
   ApplyLimits(&distances);
 
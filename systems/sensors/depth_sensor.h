@@ -14,6 +14,7 @@
 #include "drake/systems/rendering/pose_vector.h"
 #include "drake/systems/sensors/depth_sensor_output.h"
 #include "drake/systems/sensors/depth_sensor_specification.h"
+#include "drake/systems/sensors/raycast_bvh.h"
 
 namespace drake {
 namespace systems {
@@ -98,6 +99,17 @@ class DepthSensor : public systems::LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DepthSensor)
 
+  /// The ways in which a %DepthSensor can cast its rays.
+  enum class RaycastBackend {
+    /// RigidBodyTree::collisionRaycast(), which casts one ray at a time with
+    /// the tree's collision model.
+    kCollisionModel,
+    /// A RaycastBvh over the tree's collision elements, which casts packets
+    /// of rays on all available cores. It is much faster for sensors with
+    /// many rays; see RaycastBvh for how its geometry differs.
+    kBvh,
+  };
+
   /// A %DepthSensor constructor.
   ///
   /// @param[in] name The name of the depth sensor. This can be any value, but
@@ -112,9 +124,14 @@ class DepthSensor : public systems::LeafSystem<double> {
   ///
   /// @param[in] specification The specifications of this sensor.
   ///
+  /// @param[in] backend How the rays are cast. With RaycastBackend::kBvh, the
+  /// collision elements of @p tree are gathered here, so they must all have
+  /// been added already.
+  ///
   DepthSensor(const std::string& name, const RigidBodyTree<double>& tree,
               const RigidBodyFrame<double>& frame,
-              const DepthSensorSpecification& specification);
+              const DepthSensorSpecification& specification,
+              RaycastBackend backend = RaycastBackend::kCollisionModel);
 
   /// Returns the RigidBodyTree that this sensor is sensing.
   const RigidBodyTree<double>& get_tree() const { return tree_; }
@@ -126,6 +143,11 @@ class DepthSensor : public systems::LeafSystem<double> {
   /// Returns this sensor's specification.
   const DepthSensorSpecification& get_specification() { return specification_; }
 
+  /// Returns how this sensor casts its rays.
+  RaycastBackend get_raycast_backend() const {
+    return bvh_ ? RaycastBackend::kBvh : RaycastBackend::kCollisionModel;
+  }
+
   /// Returns the number of pixel rows in the resulting depth sensor output.
   /// This is equal to parameter DepthSensorSpecification::num_pitch_values
   /// that's passed into the constructor.
@@ -194,6 +216,12 @@ class DepthSensor : public systems::LeafSystem<double> {
   // range were achieved. This is cached to avoid repeated allocation and
   // computation.
   Eigen::Matrix3Xd raycast_endpoints_;
+
+  // The ray caster for RaycastBackend::kBvh, or nullptr. It is refit to the
+  // tree's configuration whenever the depth output is calculated. Like the
+  // tree's collision model, it is shared by all contexts, so the outputs of
+  // different contexts must not be calculated concurrently.
+  mutable std::unique_ptr<RaycastBvh> bvh_;
 };
 
 }  // namespace sensors
@@ -67,14 +67,17 @@ void DepthSensorToLcmPointCloudMessage::CalcPointCloudMessage(
   bot_core::pointcloud_t& message = *output;
   message.frame_id = std::string(RigidBodyTreeConstants::kWorldName);
   message.n_points = point_cloud_S.cols();
-  message.points.clear();
+  // Overwrites the points of the previous message in place, so that their
+  // storage is reused from one message to the next.
+  message.points.resize(point_cloud_S.cols());
+  const Eigen::Isometry3d X_WS_isometry = X_WS->get_isometry();
   for (int i = 0; i < point_cloud_S.cols(); ++i) {
-    const auto& point_S = point_cloud_S.col(i);
-    Eigen::Vector3d point_W = X_WS->get_isometry() * point_S;
-    message.points.push_back(std::vector<float>{
-        static_cast<float>(point_W(0)),
-        static_cast<float>(point_W(1)),
-        static_cast<float>(point_W(2))});
+    const Eigen::Vector3d point_W = X_WS_isometry * point_cloud_S.col(i);
+    std::vector<float>& point = message.points[i];
+    point.resize(3);
+    point[0] = static_cast<float>(point_W(0));
+    point[1] = static_cast<float>(point_W(1));
+    point[2] = static_cast<float>(point_W(2));
   }
   message.n_channels = 0;
 }
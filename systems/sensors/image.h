@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/systems/sensors/pixel_types.h"
 
@@ -45,12 +49,101 @@ using ImageGrey8U = Image<PixelType::kGrey8U>;
 /// symbolic::Expression.
 using ImageExpr = Image<PixelType::kExpr>;
 
+namespace internal {
+
+/// A pool of the pixel buffers of released images. Images take their buffers
+/// from it, so that a pipeline which repeatedly produces images of the same
+/// size, e.g. a camera rendering at a fixed rate, stops allocating once the
+/// pool holds enough buffers. At most kMaxPooledBuffers are kept per channel
+/// type; further released buffers are freed.
+template <typename T>
+class ImageBufferPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageBufferPool)
+
+  using Buffer = std::vector<T>;
+
+  static constexpr int kMaxPooledBuffers = 64;
+
+  /// Returns a buffer of @p size elements, whose values are unspecified. The
+  /// buffer returns to the pool when its last reference is released.
+  static std::shared_ptr<Buffer> Acquire(int size) {
+    std::unique_ptr<Buffer> buffer;
+    {
+      Storage& storage = get_storage();
+      std::lock_guard<std::mutex> lock(storage.mutex);
+      auto& buffers = storage.buffers;
+      for (auto it = buffers.rbegin(); it != buffers.rend(); ++it) {
+        if (static_cast<int>((*it)->size()) == size) {
+          buffer = std::move(*it);
+          *it = std::move(buffers.back());
+          buffers.pop_back();
+          break;
+        }
+      }
+    }
+    if (!buffer) {
+      buffer = std::make_unique<Buffer>(size);
+    }
+    return std::shared_ptr<Buffer>(buffer.release(), &Release);
+  }
+
+  /// Returns the number of buffers currently held by the pool.
+  static int num_pooled() {
+    Storage& storage = get_storage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    return static_cast<int>(storage.buffers.size());
+  }
+
+  /// Frees the buffers currently held by the pool.
+  static void Clear() {
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    Storage& storage = get_storage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    buffers.swap(storage.buffers);
+  }
+
+ private:
+  struct Storage {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+  };
+
+  static Storage& get_storage() {
+    static never_destroyed<Storage> storage;
+    return storage.access();
+  }
+
+  static void Release(Buffer* released) {
+    std::unique_ptr<Buffer> buffer(released);
+    Storage& storage = get_storage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    if (static_cast<int>(storage.buffers.size()) < kMaxPooledBuffers) {
+      storage.buffers.push_back(std::move(buffer));
+    }
+  }
+};
+
+template <typename T>
+constexpr int ImageBufferPool<T>::kMaxPooledBuffers;
+
+}  // namespace internal
+
 /// Simple data format for Image. For the complex calculation with the image,
 /// consider converting this to other libaries' Matrix data format, i.e.,
 /// MatrixX in Eigen, Mat in OpenCV, and so on.
 ///
 /// The origin of image coordinate system is on the left-upper corner.
 ///
+/// Copies of an image share its pixel buffer, which is reference-counted, so
+/// that images can be passed between systems (e.g., through the output ports
+/// of a camera) without copying their pixels. An image copies its pixels into
+/// a buffer of its own only when they are accessed through the non-const
+/// at() while the buffer is shared (copy on write). Consequently, a pointer
+/// returned by the non-const at() must not be written through after the image
+/// has been copied. The buffers are recycled through an
+/// internal::ImageBufferPool.
+///
 /// @tparam kPixelType The pixel type enum that denotes the pixel format and the
 /// data type of a channel.
 template <PixelType kPixelType>
@@ -88,9 +181,10 @@ class Image {
   /// @param initial_value A value set to all the channels in all the pixels
   Image(int width, int height, T initial_value)
       : width_(width), height_(height),
-        data_(width * height * kNumChannels, initial_value) {
+        data_(Pool::Acquire(width * height * kNumChannels)) {
     DRAKE_ASSERT(width > 0);
     DRAKE_ASSERT(height > 0);
+    std::fill(data_->begin(), data_->end(), initial_value);
   }
 
   /// Constructs a zero-sized image.
@@ -109,13 +203,19 @@ class Image {
   /// Changes the sizes of the width and height for the image.  The values for
   /// them should be greater than zero.  (To resize to zero, assign a default-
   /// constructed Image into this; do not use this method.)  All the values in
-  /// the pixels become zero after resize.
+  /// the pixels become zero after resize.  If the pixel buffer is shared with
+  /// copies of this image, this image takes a new buffer instead of copying it.
   void resize(int width, int height) {
     DRAKE_ASSERT(width > 0);
     DRAKE_ASSERT(height > 0);
 
-    data_.resize(width * height * kNumChannels);
-    std::fill(data_.begin(), data_.end(), 0);
+    const int new_size = width * height * kNumChannels;
+    if (data_ && data_.use_count() == 1) {
+      data_->resize(new_size);
+    } else {
+      data_ = Pool::Acquire(new_size);
+    }
+    std::fill(data_->begin(), data_->end(), 0);
     width_ = width;
     height_ = height;
   }
@@ -130,10 +230,13 @@ class Image {
   /// uint8_t green = image.at(x, y)[1];
   /// uint8_t blue  = image.at(x, y)[2];
   /// uint8_t alpha = image.at(x, y)[3];
+  ///
+  /// If the pixel buffer is shared with copies of this image, the pixels are
+  /// first copied into a buffer owned by this image alone.
   T* at(int x, int y) {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    return mutable_data() + (x + y * width_) * kNumChannels;
   }
 
   /// Const version of at() method.  See the document for the non-const version
@@ -141,13 +244,25 @@ class Image {
   const T* at(int x, int y) const {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    return data_->data() + (x + y * width_) * kNumChannels;
   }
 
  private:
+  using Pool = internal::ImageBufferPool<T>;
+
+  // Returns the pixels, after copying them if the buffer is shared.
+  T* mutable_data() {
+    if (data_.use_count() > 1) {
+      std::shared_ptr<std::vector<T>> copy = Pool::Acquire(size());
+      std::copy(data_->begin(), data_->end(), copy->begin());
+      data_ = std::move(copy);
+    }
+    return data_->data();
+  }
+
   reset_after_move<int> width_;
   reset_after_move<int> height_;
-  std::vector<T> data_;
+  std::shared_ptr<std::vector<T>> data_;
 };
 
 /// Set of constants used to represent invalid depth values.
@@ -1,5 +1,7 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,6 +10,7 @@
 #include "robotlocomotion/image_array_t.hpp"
 #include "robotlocomotion/image_t.hpp"
 
+#include "drake/common/parallel_for.h"
 #include "drake/systems/sensors/image.h"
 
 using std::string;
@@ -28,18 +31,19 @@ void Compress(const Image<kPixelType>& image, image_t* msg) {
   const int source_size = image.width() * image.height() * image.kPixelSize;
   // The destination buf_size must be slightly larger than the source size.
   // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
+  // Compress straight into the message, whose data keeps its capacity from
+  // one frame to the next.
+  uLongf buf_size = source_size * 1.001 + 12;
+  msg->data.resize(buf_size);
 
   auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
+      &msg->data[0], &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
       source_size, Z_BEST_SPEED);
 
   DRAKE_DEMAND(compress_status == Z_OK);
 
   msg->data.resize(buf_size);
   msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
 }
 
 template <PixelType kPixelType>
@@ -124,7 +128,6 @@ void ImageToLcmImageArrayT::CalcImageArray(
   msg->header.utime = static_cast<int64_t>(context.get_time() * kSecToMillisec);
   msg->header.frame_name.clear();
   msg->num_images = 0;
-  msg->images.clear();
 
   const AbstractValue* color_image_value =
       this->EvalAbstractInput(context, color_image_input_port_index_);
@@ -135,46 +138,60 @@ void ImageToLcmImageArrayT::CalcImageArray(
   const AbstractValue* label_image_value =
       this->EvalAbstractInput(context, label_image_input_port_index_);
 
+  // Packs the images into the elements of msg->images that are left from the
+  // previous message, so that their buffers are reused rather than
+  // reallocated on every frame.
+  msg->images.resize((color_image_value ? 1 : 0) +
+                     (depth_image_value ? 1 : 0) +
+                     (label_image_value ? 1 : 0));
+
+  // Each image is packed by its own task, which writes only its own element
+  // of msg->images.
+  std::vector<std::function<void()>> tasks;
+
   if (color_image_value) {
     const ImageRgba8U& color_image =
         color_image_value->GetValue<ImageRgba8U>();
-
-    image_t color_image_msg;
-    PackImageToLcmImageT(color_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_RGBA,
-                         image_t::CHANNEL_TYPE_UINT8, color_frame_name_,
-                         &color_image_msg,
-                         do_compress_);
-    msg->images.push_back(color_image_msg);
-    msg->num_images++;
+    image_t* image_msg = &msg->images[msg->num_images++];
+    tasks.push_back([this, &color_image, msg, image_msg]() {
+      PackImageToLcmImageT(color_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_RGBA,
+                           image_t::CHANNEL_TYPE_UINT8, color_frame_name_,
+                           image_msg, do_compress_);
+    });
   }
 
   if (depth_image_value) {
     const ImageDepth32F& depth_image =
         depth_image_value->GetValue<ImageDepth32F>();
-    image_t depth_image_msg;
-    PackImageToLcmImageT(depth_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_DEPTH,
-                         image_t::CHANNEL_TYPE_FLOAT32, depth_frame_name_,
-                         &depth_image_msg,
-                         do_compress_);
-    msg->images.push_back(depth_image_msg);
-    msg->num_images++;
+    image_t* image_msg = &msg->images[msg->num_images++];
+    tasks.push_back([this, &depth_image, msg, image_msg]() {
+      PackImageToLcmImageT(depth_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_DEPTH,
+                           image_t::CHANNEL_TYPE_FLOAT32, depth_frame_name_,
+                           image_msg, do_compress_);
+    });
   }
 
   if (label_image_value) {
     const ImageLabel16I& label_image =
         label_image_value->GetValue<ImageLabel16I>();
-
-    image_t label_image_msg;
-    PackImageToLcmImageT(label_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_LABEL,
-                         image_t::CHANNEL_TYPE_INT16, label_frame_name_,
-                         &label_image_msg,
-                         do_compress_);
-    msg->images.push_back(label_image_msg);
-    msg->num_images++;
+    image_t* image_msg = &msg->images[msg->num_images++];
+    tasks.push_back([this, &label_image, msg, image_msg]() {
+      PackImageToLcmImageT(label_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_LABEL,
+                           image_t::CHANNEL_TYPE_INT16, label_frame_name_,
+                           image_msg, do_compress_);
+    });
   }
+
+  // Compression dominates the cost of a message, so the images are
+  // compressed concurrently; copying them uncompressed is not worth a thread.
+  const int num_tasks = static_cast<int>(tasks.size());
+  const int num_threads =
+      do_compress_ ? std::min(num_tasks, GetDefaultNumThreads()) : 1;
+  ParallelFor(num_tasks, std::max(num_threads, 1),
+              [&tasks](int i) { tasks[i](); });
 }
 
 }  // namespace sensors
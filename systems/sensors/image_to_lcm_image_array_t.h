@@ -31,8 +31,10 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// @param color_frame_name The frame name used for color image.
   /// @param depth_frame_name The frame name used for depth image.
   /// @param label_frame_name The frame name used for label image.
-  /// @param do_compress When true, zlib compression will be performed. The
-  /// default is false.
+  /// @param do_compress When true, zlib compression will be performed, with
+  /// the images compressed concurrently on separate threads. When false, the
+  /// images are copied uncompressed, which is cheapest for consumers on the
+  /// same host. The default is false.
   ImageToLcmImageArrayT(const std::string& color_frame_name,
                         const std::string& depth_frame_name,
                         const std::string& label_frame_name,
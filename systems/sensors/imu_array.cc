@@ -0,0 +1,134 @@
+#include "drake/systems/sensors/imu_array.h"
+
+#include <unordered_map>
+
+#include "drake/multibody/compact_jacobian.h"
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+ImuArray::ImuArray(const std::string& name,
+                   const std::vector<RigidBodyFrame<double>>& frames,
+                   const RigidBodyTree<double>& tree, bool include_gravity)
+    : name_(name),
+      frames_(frames),
+      tree_(tree),
+      include_gravity_(include_gravity) {
+  this->set_name(name_);
+
+  std::unordered_map<const RigidBody<double>*, int> body_index;
+  for (const RigidBodyFrame<double>& frame : frames_) {
+    const RigidBody<double>* body = &frame.get_rigid_body();
+    const auto inserted =
+        body_index.emplace(body, static_cast<int>(bodies_.size()));
+    if (inserted.second) {
+      bodies_.push_back(body);
+    }
+    imu_body_index_.push_back(inserted.first->second);
+  }
+
+  plant_state_input_port_index_ =
+      DeclareInputPort(kVectorValued,
+                       tree_.get_num_positions() + tree_.get_num_velocities())
+          .get_index();
+  plant_state_derivative_input_port_index_ =
+      DeclareInputPort(kVectorValued,
+                       tree_.get_num_positions() + tree_.get_num_velocities())
+          .get_index();
+  acceleration_output_port_index_ =
+      DeclareVectorOutputPort(BasicVector<double>(3 * num_imus()),
+                              &ImuArray::CalcAccelerationOutput)
+          .get_index();
+  angular_velocity_output_port_index_ =
+      DeclareVectorOutputPort(BasicVector<double>(3 * num_imus()),
+                              &ImuArray::CalcAngularVelocityOutput)
+          .get_index();
+}
+
+KinematicsCache<double> ImuArray::CalcKinematics(
+    const Context<double>& context, bool compute_JdotV) const {
+  const VectorXd x =
+      this->EvalEigenVectorInput(context, plant_state_input_port_index_);
+  KinematicsCache<double> cache = tree_.CreateKinematicsCache();
+  cache.initialize(x.head(tree_.get_num_positions()),
+                   x.tail(tree_.get_num_velocities()));
+  tree_.doKinematics(cache, compute_JdotV);
+  return cache;
+}
+
+std::vector<ImuArray::BodyKinematics> ImuArray::CalcBodyKinematics(
+    const KinematicsCache<double>& cache, const VectorXd* vdot) const {
+  std::vector<BodyKinematics> result(bodies_.size());
+  for (int i = 0; i < static_cast<int>(bodies_.size()); ++i) {
+    const RigidBody<double>& body = *bodies_[i];
+    BodyKinematics& kinematics = result[i];
+    kinematics.X_WB = tree_.CalcBodyPoseInWorldFrame(cache, body);
+    kinematics.V_WB = tree_.CalcBodySpatialVelocityInWorldFrame(cache, body);
+    if (vdot != nullptr) {
+      // A_WB = Jdot_WB * v + J_WB * vdot, where J_WB only has columns for the
+      // joints between the world and the body.
+      const CompactJacobian<double> J_WB =
+          tree_.CalcFrameSpatialVelocityCompactJacobianInWorldFrame(
+              cache, body, Isometry3<double>::Identity());
+      kinematics.A_WB =
+          tree_.CalcBodySpatialVelocityJacobianDotTimesVInWorldFrame(cache,
+                                                                     body) +
+          J_WB.Multiply(*vdot);
+    }
+  }
+  return result;
+}
+
+void ImuArray::CalcAccelerationOutput(
+    const Context<double>& context, BasicVector<double>* output_vector) const {
+  const KinematicsCache<double> cache =
+      CalcKinematics(context, true /* compute_JdotV */);
+  const VectorXd xdot = this->EvalEigenVectorInput(
+      context, plant_state_derivative_input_port_index_);
+  const VectorXd vdot = xdot.tail(tree_.get_num_velocities());
+  const std::vector<BodyKinematics> bodies = CalcBodyKinematics(cache, &vdot);
+  const Vector3d gravity_W = tree_.a_grav.tail<3>();
+
+  auto output = output_vector->get_mutable_value();
+  for (int i = 0; i < num_imus(); ++i) {
+    const BodyKinematics& body = bodies[imu_body_index_[i]];
+    const Isometry3<double>& X_BF = frames_[i].get_transform_to_body();
+    // Shifts the acceleration of the body origin Bo to the IMU origin Fo:
+    // a_WFo = a_WBo + α_WB × p_BoFo + ω_WB × (ω_WB × p_BoFo).
+    const Vector3d p_BoFo_W = body.X_WB.linear() * X_BF.translation();
+    const Vector3d w_WB_W = body.V_WB.head<3>();
+    Vector3d a_WFo_W = body.A_WB.tail<3>() +
+                       body.A_WB.head<3>().cross(p_BoFo_W) +
+                       w_WB_W.cross(w_WB_W.cross(p_BoFo_W));
+    if (include_gravity_) {
+      a_WFo_W += gravity_W;
+    }
+    const Matrix3<double> R_WF = body.X_WB.linear() * X_BF.linear();
+    output.segment<3>(3 * i) = R_WF.transpose() * a_WFo_W;
+  }
+}
+
+void ImuArray::CalcAngularVelocityOutput(
+    const Context<double>& context, BasicVector<double>* output_vector) const {
+  const KinematicsCache<double> cache =
+      CalcKinematics(context, false /* compute_JdotV */);
+  const std::vector<BodyKinematics> bodies =
+      CalcBodyKinematics(cache, nullptr);
+
+  auto output = output_vector->get_mutable_value();
+  for (int i = 0; i < num_imus(); ++i) {
+    const BodyKinematics& body = bodies[imu_body_index_[i]];
+    const Matrix3<double> R_WF =
+        body.X_WB.linear() * frames_[i].get_transform_to_body().linear();
+    // The IMU frame F rotates with the body B, so ω_WF = ω_WB.
+    output.segment<3>(3 * i) = R_WF.transpose() * body.V_WB.head<3>();
+  }
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/kinematics_cache.h"
+#include "drake/multibody/rigid_body_frame.h"
+#include "drake/multibody/rigid_body_tree.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A set of simulated ideal inertial measurement units (IMUs), each of which
+/// combines an Accelerometer and a Gyroscope attached to the same frame of a
+/// RigidBodyPlant.
+///
+/// For each IMU frame `F`, this system computes the same linear acceleration
+/// `a_WFo_F` as an Accelerometer attached to `F` (including gravity if
+/// requested) and the same angular velocity `ω_WF_F` as a Gyroscope attached
+/// to `F`. Rather than evaluating the kinematics once per sensor, each output
+/// evaluates them once for all IMUs. The spatial velocity and acceleration of
+/// each body that carries an IMU are computed once, and then shifted to each
+/// of its IMU frames.
+///
+/// <B>%System Input Ports:</B>
+///
+///  - get_plant_state_input_port(): Contains the state (i.e., position and
+///    velocity) vector, `x`, of the RigidBodyPlant being sensed.
+///
+///  - get_plant_state_derivative_input_port(): Contains the derivative of the
+///    state vector, `xdot`, of the RigidBodyPlant being sensed. Only the
+///    acceleration output depends on it.
+///
+/// <B>%System Output Ports:</B>
+///
+///  - get_acceleration_output_port(): A vector of size `3 n`, where `n` is the
+///    number of IMUs, whose elements `3 i` to `3 i + 2` are the linear
+///    acceleration sensed by the i-th IMU, expressed in its frame.
+///
+///  - get_angular_velocity_output_port(): A vector of size `3 n` whose
+///    elements `3 i` to `3 i + 2` are the angular velocity sensed by the i-th
+///    IMU, expressed in its frame.
+///
+/// Since each output holds the readings of all IMUs, sensor noise for all of
+/// them can be modeled with a single RandomSource and Adder per output.
+///
+/// @ingroup sensor_systems
+///
+class ImuArray : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImuArray);
+
+  /// A constructor that initializes an ImuArray.
+  ///
+  /// @param[in] name The name of the IMU array. This can be any value.
+  ///
+  /// @param[in] frames The frames to which the IMUs are attached, one per IMU.
+  /// They need not be in @p tree, but must reference bodies in @p tree.
+  ///
+  /// @param[in] tree The RigidBodyTree that belongs to the RigidBodyPlant being
+  /// sensed by this sensor. This parameter's lifespan must exceed that of this
+  /// class's instance.
+  ///
+  /// @param[in] include_gravity Whether to include the acceleration due to
+  /// gravity in the acceleration readings. See Accelerometer.
+  ///
+  ImuArray(const std::string& name,
+           const std::vector<RigidBodyFrame<double>>& frames,
+           const RigidBodyTree<double>& tree, bool include_gravity = true);
+
+  /// Returns the number of IMUs in this array.
+  int num_imus() const { return static_cast<int>(frames_.size()); }
+
+  /// Returns whether gravity is included in the acceleration readings.
+  bool get_include_gravity() const { return include_gravity_; }
+
+  /// Returns the RigidBodyTree that this sensor is sensing.
+  const RigidBodyTree<double>& get_tree() const { return tree_; }
+
+  /// Returns the frame of the IMU with index @p imu_index.
+  const RigidBodyFrame<double>& get_frame(int imu_index) const {
+    return frames_.at(imu_index);
+  }
+
+  /// Returns a descriptor of the input port that should contain the generalized
+  /// position and velocity vector of the RigidBodyPlant that this sensor is
+  /// sensing.
+  const InputPortDescriptor<double>& get_plant_state_input_port() const {
+    return System<double>::get_input_port(plant_state_input_port_index_);
+  }
+
+  /// Returns a descriptor of the input port that should contain the derivative
+  /// of the generalized position and velocity vector of the RigidBodyPlant that
+  /// this sensor is sensing.
+  const InputPortDescriptor<double>& get_plant_state_derivative_input_port()
+      const {
+    return System<double>::get_input_port(
+        plant_state_derivative_input_port_index_);
+  }
+
+  /// Returns the output port containing the sensed linear accelerations.
+  const OutputPort<double>& get_acceleration_output_port() const {
+    return System<double>::get_output_port(acceleration_output_port_index_);
+  }
+
+  /// Returns the output port containing the sensed angular velocities.
+  const OutputPort<double>& get_angular_velocity_output_port() const {
+    return System<double>::get_output_port(
+        angular_velocity_output_port_index_);
+  }
+
+ private:
+  // The kinematics of one of the bodies that carry IMUs.
+  struct BodyKinematics {
+    Isometry3<double> X_WB;
+    // Spatial velocity and acceleration of the body frame B in the world
+    // frame W, expressed in W.
+    Vector6<double> V_WB;
+    Vector6<double> A_WB;
+  };
+
+  // Computes the kinematics for the plant state in `context`, including the
+  // terms needed for Jdot * v if `compute_JdotV` is true.
+  KinematicsCache<double> CalcKinematics(const Context<double>& context,
+                                         bool compute_JdotV) const;
+
+  // Computes the pose and spatial velocity of each body that carries an IMU,
+  // and their spatial acceleration if `vdot` is not nullptr.
+  std::vector<BodyKinematics> CalcBodyKinematics(
+      const KinematicsCache<double>& cache,
+      const VectorX<double>* vdot) const;
+
+  void CalcAccelerationOutput(const Context<double>& context,
+                              BasicVector<double>* output_vector) const;
+
+  void CalcAngularVelocityOutput(const Context<double>& context,
+                                 BasicVector<double>* output_vector) const;
+
+  const std::string name_;
+  const std::vector<RigidBodyFrame<double>> frames_;
+  const RigidBodyTree<double>& tree_;
+  const bool include_gravity_{true};
+
+  // The distinct bodies that carry IMUs, and the index within them of the
+  // body of each IMU.
+  std::vector<const RigidBody<double>*> bodies_;
+  std::vector<int> imu_body_index_;
+
+  int plant_state_input_port_index_{};
+  int plant_state_derivative_input_port_index_{};
+  int acceleration_output_port_index_{};
+  int angular_velocity_output_port_index_{};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
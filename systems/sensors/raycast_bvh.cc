@@ -0,0 +1,475 @@
+#include "drake/systems/sensors/raycast_bvh.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+#include "drake/multibody/collision/element.h"
+
+using Eigen::Matrix3Xd;
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using Eigen::Vector3i;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+namespace {
+
+// The most items that a leaf of a hierarchy holds.
+constexpr int kMaxLeafItems = 4;
+
+// The number of packets that a thread traces at a time.
+constexpr int kPacketsPerTask = 16;
+
+// The deepest that a hierarchy can get. Leaves are split at the median, so a
+// hierarchy is only about log2(num_items) deep.
+constexpr int kMaxDepth = 64;
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// The parameters `t` along a ray for which it is inside of a convex shape.
+// The interval is empty if `lower > upper`.
+struct Interval {
+  double lower{-kInfinity};
+  double upper{kInfinity};
+
+  void Intersect(double a, double b) {
+    lower = std::max(lower, std::min(a, b));
+    upper = std::min(upper, std::max(a, b));
+  }
+};
+
+// Restricts @p interval to where the ray `p + t d` is between the planes
+// `x = -h` and `x = h`.
+void IntersectSlab(double p, double d, double h, Interval* interval) {
+  if (d == 0) {
+    if (std::abs(p) > h) *interval = Interval{kInfinity, -kInfinity};
+    return;
+  }
+  interval->Intersect((-h - p) / d, (h - p) / d);
+}
+
+// Returns the interval for which the ray `p + t d` is inside of the sphere of
+// radius @p r centered at @p c.
+Interval IntersectSphere(const Vector3d& p, const Vector3d& d,
+                         const Vector3d& c, double r) {
+  const Vector3d pc = p - c;
+  const double a = d.squaredNorm();
+  const double b = pc.dot(d);
+  const double discriminant = b * b - a * (pc.squaredNorm() - r * r);
+  if (discriminant < 0) return Interval{kInfinity, -kInfinity};
+  const double s = std::sqrt(discriminant);
+  return Interval{(-b - s) / a, (-b + s) / a};
+}
+
+// Returns the interval for which the ray `p + t d` is inside of the cylinder
+// of radius @p r and half length @p h along the z axis.
+Interval IntersectCylinder(const Vector3d& p, const Vector3d& d, double r,
+                           double h) {
+  Interval interval;
+  IntersectSlab(p.z(), d.z(), h, &interval);
+  const double a = d.x() * d.x() + d.y() * d.y();
+  const double c = p.x() * p.x() + p.y() * p.y() - r * r;
+  if (a == 0) {
+    if (c > 0) return Interval{kInfinity, -kInfinity};
+    return interval;
+  }
+  const double b = p.x() * d.x() + p.y() * d.y();
+  const double discriminant = b * b - a * c;
+  if (discriminant < 0) return Interval{kInfinity, -kInfinity};
+  const double s = std::sqrt(discriminant);
+  interval.Intersect((-b - s) / a, (-b + s) / a);
+  return interval;
+}
+
+// Lowers @p t to the parameter at which the ray enters @p interval, if that
+// is in `[0, *t)`. A ray that starts inside enters at zero.
+void UpdateHit(const Interval& interval, double* t) {
+  if (interval.lower > interval.upper || interval.upper < 0) return;
+  *t = std::min(*t, std::max(interval.lower, 0.0));
+}
+
+// Lowers @p t to the parameter at which the ray `p + t d` hits the triangle
+// (@p a, @p b, @p c), if that is in `[0, *t)`. This is the Moller-Trumbore
+// algorithm.
+void UpdateTriangleHit(const Vector3d& p, const Vector3d& d,
+                       const Vector3d& a, const Vector3d& b,
+                       const Vector3d& c, double* t) {
+  const Vector3d ab = b - a;
+  const Vector3d ac = c - a;
+  const Vector3d q = d.cross(ac);
+  const double det = ab.dot(q);
+  if (det == 0) return;
+  const double inv_det = 1 / det;
+  const Vector3d ap = p - a;
+  const double u = ap.dot(q) * inv_det;
+  if (u < 0 || u > 1) return;
+  const Vector3d r = ap.cross(ab);
+  const double v = d.dot(r) * inv_det;
+  if (v < 0 || u + v > 1) return;
+  const double t_hit = ac.dot(r) * inv_det;
+  if (t_hit >= 0 && t_hit < *t) *t = t_hit;
+}
+
+}  // namespace
+
+// Up to kPacketSize rays `origin + t * direction[i]` that share an origin,
+// with `t` in `[0, t[i]]`. Lanes beyond `size` are inactive and have a
+// negative `t`, so that they never hit anything.
+struct RaycastBvh::Packet {
+  using Lanes = Eigen::Array<double, kPacketSize, 1>;
+
+  // Returns true if any of the rays passes through @p bounds.
+  bool Hits(const Bounds& bounds) const {
+    Lanes lower = Lanes::Zero();
+    Lanes upper = t;
+    for (int axis = 0; axis < 3; ++axis) {
+      const Lanes t0 =
+          (bounds.lower[axis] - origin[axis]) * inv_direction[axis];
+      const Lanes t1 =
+          (bounds.upper[axis] - origin[axis]) * inv_direction[axis];
+      lower = lower.max(t0.min(t1));
+      upper = upper.min(t0.max(t1));
+    }
+    return (lower <= upper).any();
+  }
+
+  Vector3d direction_of(int lane) const {
+    return Vector3d(direction[0][lane], direction[1][lane],
+                    direction[2][lane]);
+  }
+
+  // Sets the directions, and their reciprocals for the bounds tests. Zero
+  // components are nudged so that the reciprocals stay finite.
+  void set_direction_of(int lane, const Vector3d& d) {
+    for (int axis = 0; axis < 3; ++axis) {
+      direction[axis][lane] = d[axis];
+      const double nudged = (d[axis] == 0) ? 1e-300 : d[axis];
+      inv_direction[axis][lane] = 1 / nudged;
+    }
+  }
+
+  int size{0};
+  Vector3d origin;
+  Lanes direction[3];
+  Lanes inv_direction[3];
+  Lanes t;
+};
+
+void RaycastBvh::Bounds::Include(const Vector3d& point) {
+  lower = lower.cwiseMin(point);
+  upper = upper.cwiseMax(point);
+}
+
+void RaycastBvh::Bounds::Include(const Bounds& other) {
+  lower = lower.cwiseMin(other.lower);
+  upper = upper.cwiseMax(other.upper);
+}
+
+RaycastBvh::RaycastBvh(const RigidBodyTree<double>& tree) {
+  for (int i = 0; i < tree.get_num_bodies(); ++i) {
+    for (const auto& id : tree.get_body(i).get_collision_element_ids()) {
+      const drake::multibody::collision::Element* element =
+          tree.FindCollisionElement(id);
+      DRAKE_DEMAND(element != nullptr);
+      AddElement(i, element->getGeometry(), element->getLocalTransform());
+    }
+  }
+  element_bounds_.resize(elements_.size());
+}
+
+void RaycastBvh::AddElement(int body_index,
+                            const DrakeShapes::Geometry& geometry,
+                            const Eigen::Isometry3d& X_BG) {
+  Element element;
+  element.body_index = body_index;
+  element.shape = geometry.getShape();
+  element.R_BG = X_BG.linear();
+  element.p_BG = X_BG.translation();
+  switch (element.shape) {
+    case DrakeShapes::BOX: {
+      const auto& box = static_cast<const DrakeShapes::Box&>(geometry);
+      element.half_size = box.size / 2;
+      break;
+    }
+    case DrakeShapes::SPHERE: {
+      const auto& sphere = static_cast<const DrakeShapes::Sphere&>(geometry);
+      element.half_size = Vector3d::Constant(sphere.radius);
+      break;
+    }
+    case DrakeShapes::CYLINDER: {
+      const auto& cylinder =
+          static_cast<const DrakeShapes::Cylinder&>(geometry);
+      element.half_size =
+          Vector3d(cylinder.radius, cylinder.radius, cylinder.length / 2);
+      break;
+    }
+    case DrakeShapes::CAPSULE: {
+      const auto& capsule = static_cast<const DrakeShapes::Capsule&>(geometry);
+      element.half_size =
+          Vector3d(capsule.radius, capsule.radius, capsule.length / 2);
+      break;
+    }
+    case DrakeShapes::MESH: {
+      const auto& mesh_geometry =
+          static_cast<const DrakeShapes::Mesh&>(geometry);
+      Mesh mesh;
+      mesh_geometry.LoadObjFile(&mesh.vertices, &mesh.triangles,
+                                DrakeShapes::Mesh::TriangulatePolicy::kTry);
+      std::vector<Bounds> triangle_bounds(mesh.triangles.size());
+      for (size_t j = 0; j < mesh.triangles.size(); ++j) {
+        for (int k = 0; k < 3; ++k) {
+          triangle_bounds[j].Include(mesh.vertices[mesh.triangles[j][k]]);
+        }
+        element.local_bounds.Include(triangle_bounds[j]);
+      }
+      if (mesh.triangles.empty()) return;
+      Build(triangle_bounds, &mesh.hierarchy);
+      element.mesh = static_cast<int>(meshes_.size());
+      meshes_.push_back(std::move(mesh));
+      break;
+    }
+    default: {
+      drake::log()->warn("RaycastBvh ignores {} collision elements.",
+                         DrakeShapes::ShapeToString(element.shape));
+      return;
+    }
+  }
+  if (element.mesh < 0) {
+    Vector3d extent = element.half_size;
+    if (element.shape == DrakeShapes::CAPSULE) extent.z() += extent.x();
+    element.local_bounds.lower = -extent;
+    element.local_bounds.upper = extent;
+  }
+  elements_.push_back(element);
+}
+
+void RaycastBvh::Build(const std::vector<Bounds>& item_bounds,
+                       Hierarchy* hierarchy) {
+  hierarchy->nodes.clear();
+  hierarchy->items.resize(item_bounds.size());
+  for (size_t i = 0; i < item_bounds.size(); ++i) {
+    hierarchy->items[i] = static_cast<int>(i);
+  }
+  if (item_bounds.empty()) return;
+  BuildNode(item_bounds, 0, static_cast<int>(item_bounds.size()), hierarchy);
+}
+
+void RaycastBvh::BuildNode(const std::vector<Bounds>& item_bounds, int begin,
+                           int end, Hierarchy* hierarchy) {
+  const int index = static_cast<int>(hierarchy->nodes.size());
+  hierarchy->nodes.emplace_back();
+  std::vector<int>& items = hierarchy->items;
+  Bounds bounds;
+  Bounds centers;
+  for (int i = begin; i < end; ++i) {
+    const Bounds& item = item_bounds[items[i]];
+    bounds.Include(item);
+    centers.Include(Vector3d((item.lower + item.upper) / 2));
+  }
+  hierarchy->nodes[index].bounds = bounds;
+  if (end - begin <= kMaxLeafItems) {
+    hierarchy->nodes[index].first_item = begin;
+    hierarchy->nodes[index].num_items = end - begin;
+    return;
+  }
+
+  // Splits the items at the median of their centers along the axis in which
+  // the centers are most spread out.
+  int axis = 0;
+  (centers.upper - centers.lower).maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(items.begin() + begin, items.begin() + middle,
+                   items.begin() + end, [&item_bounds, axis](int a, int b) {
+                     return item_bounds[a].lower[axis] +
+                                item_bounds[a].upper[axis] <
+                            item_bounds[b].lower[axis] +
+                                item_bounds[b].upper[axis];
+                   });
+  BuildNode(item_bounds, begin, middle, hierarchy);
+  hierarchy->nodes[index].second_child =
+      static_cast<int>(hierarchy->nodes.size());
+  BuildNode(item_bounds, middle, end, hierarchy);
+}
+
+void RaycastBvh::Refit(const KinematicsCache<double>& cache) {
+  for (size_t i = 0; i < elements_.size(); ++i) {
+    Element& element = elements_[i];
+    const Eigen::Isometry3d& X_WB =
+        cache.get_element(element.body_index).transform_to_world;
+    element.R_WG = X_WB.linear() * element.R_BG;
+    element.p_WG = X_WB * element.p_BG;
+
+    // The world bounds of the local bounds' box.
+    const Bounds& local = element.local_bounds;
+    const Vector3d center =
+        element.R_WG * ((local.lower + local.upper) / 2) + element.p_WG;
+    const Vector3d extent =
+        element.R_WG.cwiseAbs() * ((local.upper - local.lower) / 2);
+    element_bounds_[i].lower = center - extent;
+    element_bounds_[i].upper = center + extent;
+  }
+
+  if (hierarchy_.nodes.empty()) {
+    Build(element_bounds_, &hierarchy_);
+    return;
+  }
+
+  // Children come after their parents, so a reverse sweep refits each node
+  // after its children.
+  for (int i = static_cast<int>(hierarchy_.nodes.size()) - 1; i >= 0; --i) {
+    Node& node = hierarchy_.nodes[i];
+    node.bounds = Bounds();
+    if (node.second_child < 0) {
+      for (int j = 0; j < node.num_items; ++j) {
+        node.bounds.Include(
+            element_bounds_[hierarchy_.items[node.first_item + j]]);
+      }
+    } else {
+      node.bounds.Include(hierarchy_.nodes[i + 1].bounds);
+      node.bounds.Include(hierarchy_.nodes[node.second_child].bounds);
+    }
+  }
+}
+
+void RaycastBvh::CastRays(const Vector3d& origin,
+                          const Matrix3Xd& ray_endpoints, VectorXd* distances,
+                          int num_threads) const {
+  DRAKE_DEMAND(distances != nullptr);
+  DRAKE_DEMAND(elements_.empty() || !hierarchy_.nodes.empty());
+  const int num_rays = static_cast<int>(ray_endpoints.cols());
+  distances->resize(num_rays);
+  const int num_packets = (num_rays + kPacketSize - 1) / kPacketSize;
+  const int num_tasks = (num_packets + kPacketsPerTask - 1) / kPacketsPerTask;
+
+  ParallelFor(num_tasks, num_threads, [&](int task) {
+    const int end_ray = std::min(num_rays, (task + 1) * kPacketsPerTask *
+                                               kPacketSize);
+    for (int first_ray = task * kPacketsPerTask * kPacketSize;
+         first_ray < end_ray; first_ray += kPacketSize) {
+      Packet packet;
+      packet.size = std::min(kPacketSize, num_rays - first_ray);
+      packet.origin = origin;
+      packet.t.setConstant(-1);
+      for (int lane = 0; lane < kPacketSize; ++lane) {
+        // Inactive lanes repeat the last ray, so that they do not widen the
+        // packet.
+        const int ray = first_ray + std::min(lane, packet.size - 1);
+        packet.set_direction_of(lane, ray_endpoints.col(ray) - origin);
+        if (lane < packet.size) packet.t[lane] = 1;
+      }
+
+      CastPacket(&packet);
+
+      for (int lane = 0; lane < packet.size; ++lane) {
+        (*distances)[first_ray + lane] =
+            (packet.t[lane] < 1)
+                ? packet.t[lane] * packet.direction_of(lane).norm()
+                : -1;
+      }
+    }
+  });
+}
+
+template <typename LeafFunction>
+void RaycastBvh::Traverse(const Hierarchy& hierarchy, Packet* packet,
+                          const LeafFunction& intersect_item) {
+  if (hierarchy.nodes.empty()) return;
+  int stack[kMaxDepth];
+  int stack_size = 0;
+  int index = 0;
+  while (true) {
+    const Node& node = hierarchy.nodes[index];
+    if (packet->Hits(node.bounds)) {
+      if (node.second_child >= 0) {
+        DRAKE_ASSERT(stack_size < kMaxDepth);
+        stack[stack_size++] = node.second_child;
+        ++index;
+        continue;
+      }
+      for (int i = 0; i < node.num_items; ++i) {
+        intersect_item(hierarchy.items[node.first_item + i]);
+      }
+    }
+    if (stack_size == 0) return;
+    index = stack[--stack_size];
+  }
+}
+
+void RaycastBvh::CastPacket(Packet* packet) const {
+  Traverse(hierarchy_, packet, [this, packet](int item) {
+    IntersectElement(elements_[item], packet);
+  });
+}
+
+void RaycastBvh::IntersectElement(const Element& element,
+                                  Packet* packet) const {
+  // Expresses the packet in the element's geometry frame. Rotations keep the
+  // ray parameters, so hits found here apply to the world rays as well.
+  Packet local;
+  local.size = packet->size;
+  local.origin = element.R_WG.transpose() * (packet->origin - element.p_WG);
+  local.t = packet->t;
+  for (int lane = 0; lane < kPacketSize; ++lane) {
+    local.set_direction_of(
+        lane, element.R_WG.transpose() * packet->direction_of(lane));
+  }
+
+  const Vector3d& p = local.origin;
+  const Vector3d& h = element.half_size;
+  if (element.mesh >= 0) {
+    const Mesh& mesh = meshes_[element.mesh];
+    Traverse(mesh.hierarchy, &local, [&mesh, &local, &p](int item) {
+      const Vector3i& triangle = mesh.triangles[item];
+      for (int lane = 0; lane < local.size; ++lane) {
+        UpdateTriangleHit(p, local.direction_of(lane),
+                          mesh.vertices[triangle[0]],
+                          mesh.vertices[triangle[1]],
+                          mesh.vertices[triangle[2]], &local.t[lane]);
+      }
+    });
+  } else {
+    for (int lane = 0; lane < local.size; ++lane) {
+      const Vector3d d = local.direction_of(lane);
+      double* t = &local.t[lane];
+      switch (element.shape) {
+        case DrakeShapes::BOX: {
+          Interval interval;
+          for (int axis = 0; axis < 3; ++axis) {
+            IntersectSlab(p[axis], d[axis], h[axis], &interval);
+          }
+          UpdateHit(interval, t);
+          break;
+        }
+        case DrakeShapes::SPHERE: {
+          UpdateHit(IntersectSphere(p, d, Vector3d::Zero(), h.x()), t);
+          break;
+        }
+        case DrakeShapes::CYLINDER: {
+          UpdateHit(IntersectCylinder(p, d, h.x(), h.z()), t);
+          break;
+        }
+        case DrakeShapes::CAPSULE: {
+          // A capsule is the union of a cylinder and two spheres, so it is
+          // entered where the first of them is.
+          UpdateHit(IntersectCylinder(p, d, h.x(), h.z()), t);
+          UpdateHit(IntersectSphere(p, d, Vector3d(0, 0, h.z()), h.x()), t);
+          UpdateHit(IntersectSphere(p, d, Vector3d(0, 0, -h.z()), h.x()), t);
+          break;
+        }
+        default:
+          DRAKE_ABORT();
+      }
+    }
+  }
+  packet->t = local.t;
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/kinematics_cache.h"
+#include "drake/multibody/rigid_body_tree.h"
+#include "drake/multibody/shapes/geometry.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A ray caster over the collision geometry of a RigidBodyTree that is meant
+/// for sensors that cast many rays from one point, such as DepthSensor.
+///
+/// The collision elements are gathered once, at construction, and arranged in
+/// a bounding volume hierarchy (BVH). Each time the tree moves, Refit() only
+/// updates the bounds of the hierarchy; its structure is built the first time
+/// and kept afterwards, so that the per-step cost is linear in the number of
+/// elements. The triangles of each mesh have a hierarchy of their own, in the
+/// mesh's frame, which never changes.
+///
+/// CastRays() traces the rays in packets of kPacketSize neighboring rays that
+/// descend the hierarchy together. The bounds of each node are tested against
+/// the whole packet at once, in a form that the compiler vectorizes, and the
+/// packets are spread across threads.
+///
+/// Boxes, spheres, cylinders and capsules are intersected exactly. Meshes are
+/// intersected as the triangles of their obj files; note that the collision
+/// model instead uses the convex hull of meshes that are not anchored.
+/// MeshPoints elements are ignored. Collision margins are not applied.
+class RaycastBvh {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RaycastBvh)
+
+  /// The number of rays that traverse the hierarchy together.
+  static constexpr int kPacketSize = 8;
+
+  /// Gathers the collision elements of @p tree, which must be compiled.
+  explicit RaycastBvh(const RigidBodyTree<double>& tree);
+
+  /// Returns the number of collision elements that rays can hit.
+  int num_elements() const { return static_cast<int>(elements_.size()); }
+
+  /// Updates the poses of the collision elements and the bounds of the
+  /// hierarchy from @p cache.
+  void Refit(const KinematicsCache<double>& cache);
+
+  /// Casts a ray from @p origin to each column of @p ray_endpoints, all in the
+  /// world frame, against the poses of the last call to Refit(). On return,
+  /// `(*distances)[i]` is the distance from @p origin to the first hit along
+  /// the i-th ray, or -1 if the ray does not hit anything before its
+  /// endpoint, as for RigidBodyTree::collisionRaycast(). An @p origin inside
+  /// of an element gives a distance of zero.
+  ///
+  /// @param num_threads The maximum number of threads to use.
+  void CastRays(const Eigen::Vector3d& origin,
+                const Eigen::Matrix3Xd& ray_endpoints,
+                Eigen::VectorXd* distances, int num_threads) const;
+
+ private:
+  struct Bounds {
+    void Include(const Eigen::Vector3d& point);
+    void Include(const Bounds& other);
+    Eigen::Vector3d lower{Eigen::Vector3d::Constant(
+        std::numeric_limits<double>::infinity())};
+    Eigen::Vector3d upper{Eigen::Vector3d::Constant(
+        -std::numeric_limits<double>::infinity())};
+  };
+
+  // A node of a hierarchy, stored in depth-first order: the first child of an
+  // inner node is the next node, and `second_child` is the other one. A leaf
+  // holds the items `[first_item, first_item + num_items)` of the hierarchy's
+  // item order.
+  struct Node {
+    Bounds bounds;
+    int second_child{-1};
+    int first_item{0};
+    int num_items{0};
+  };
+
+  struct Hierarchy {
+    std::vector<Node> nodes;
+    std::vector<int> items;
+  };
+
+  struct Element {
+    int body_index{};
+    DrakeShapes::Shape shape{};
+    // The pose of the geometry in its body and in the world. These are kept
+    // as rotations and translations, which need no special alignment.
+    Eigen::Matrix3d R_BG;
+    Eigen::Vector3d p_BG;
+    Eigen::Matrix3d R_WG;
+    Eigen::Vector3d p_WG;
+    // Half the size of a box, or the radius and half the length of a cylinder
+    // or capsule (along the geometry's z axis), or the radius of a sphere.
+    Eigen::Vector3d half_size;
+    // The bounds of the element in its geometry frame.
+    Bounds local_bounds;
+    // The index into meshes_ for a mesh, or -1.
+    int mesh{-1};
+  };
+
+  struct Mesh {
+    std::vector<Eigen::Vector3d> vertices;
+    std::vector<Eigen::Vector3i> triangles;
+    Hierarchy hierarchy;
+  };
+
+  struct Packet;
+
+  static void Build(const std::vector<Bounds>& item_bounds,
+                    Hierarchy* hierarchy);
+  static void BuildNode(const std::vector<Bounds>& item_bounds, int begin,
+                        int end, Hierarchy* hierarchy);
+  template <typename LeafFunction>
+  static void Traverse(const Hierarchy& hierarchy, Packet* packet,
+                       const LeafFunction& intersect_item);
+
+  void AddElement(int body_index, const DrakeShapes::Geometry& geometry,
+                  const Eigen::Isometry3d& X_BG);
+  void CastPacket(Packet* packet) const;
+  void IntersectElement(const Element& element, Packet* packet) const;
+
+  std::vector<Element> elements_;
+  std::vector<Mesh> meshes_;
+  std::vector<Bounds> element_bounds_;
+  Hierarchy hierarchy_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -182,10 +182,15 @@ void RgbdCamera::OutputPoseVector(
   pose_vector->set_rotation(quat);
 }
 
-void RgbdCamera::UpdateModelPoses(
-    const BasicVector<double>& input_vector) const {
-  const Eigen::VectorXd q =
-      input_vector.CopyToVector().head(tree_.get_num_positions());
+Eigen::VectorXd RgbdCamera::GetPositions(
+    const Context<double>& context) const {
+  const BasicVector<double>* input_vector =
+      this->EvalVectorInput(context, state_input_port_->get_index());
+  return input_vector->get_value().head(tree_.get_num_positions());
+}
+
+void RgbdCamera::UpdateModelPoses(const Eigen::VectorXd& q) const {
+  if (posed_q_ && *posed_q_ == q) return;
   KinematicsCache<double> cache = tree_.doKinematics(q);
 
   if (!camera_fixed_) {
@@ -210,33 +215,49 @@ void RgbdCamera::UpdateModelPoses(
                                   RgbdRenderer::VisualIndex(i));
     }
   }
+  posed_q_ = q;
+}
+
+template <typename ImageType, typename RenderFunction>
+void RgbdCamera::OutputCachedImage(const Eigen::VectorXd& q,
+                                   RenderFunction render,
+                                   CachedImage<ImageType>* cache,
+                                   ImageType* image) const {
+  if (!cache->q || *cache->q != q) {
+    UpdateModelPoses(q);
+    // The previously rendered image may still be shared with the output
+    // values; resizing gives the cache a buffer of its own, so that rendering
+    // does not first copy the stale pixels.
+    cache->image.resize(image->width(), image->height());
+    render(&cache->image);
+    cache->q = q;
+  }
+  // Shares the cached pixels rather than copying them.
+  *image = cache->image;
 }
 
 void RgbdCamera::OutputColorImage(const Context<double>& context,
                                   ImageRgba8U* color_image) const {
-  const BasicVector<double>* input_vector =
-      this->EvalVectorInput(context, state_input_port_->get_index());
-
-  UpdateModelPoses(*input_vector);
-  renderer_->RenderColorImage(color_image);
+  OutputCachedImage(
+      GetPositions(context),
+      [this](ImageRgba8U* image) { renderer_->RenderColorImage(image); },
+      &color_cache_, color_image);
 }
 
 void RgbdCamera::OutputDepthImage(const Context<double>& context,
                                   ImageDepth32F* depth_image) const {
-  const BasicVector<double>* input_vector =
-      this->EvalVectorInput(context, state_input_port_->get_index());
-
-  UpdateModelPoses(*input_vector);
-  renderer_->RenderDepthImage(depth_image);
+  OutputCachedImage(
+      GetPositions(context),
+      [this](ImageDepth32F* image) { renderer_->RenderDepthImage(image); },
+      &depth_cache_, depth_image);
 }
 
 void RgbdCamera::OutputLabelImage(const Context<double>& context,
                                   ImageLabel16I* label_image) const {
-  const BasicVector<double>* input_vector =
-      this->EvalVectorInput(context, state_input_port_->get_index());
-
-  UpdateModelPoses(*input_vector);
-  renderer_->RenderLabelImage(label_image);
+  OutputCachedImage(
+      GetPositions(context),
+      [this](ImageLabel16I* image) { renderer_->RenderLabelImage(image); },
+      &label_cache_, label_image);
 }
 
 RgbdCameraDiscrete::RgbdCameraDiscrete(
@@ -232,8 +232,31 @@ class RgbdCamera final : public LeafSystem<double> {
 
   // TODO(sherm1) This should be the calculator for a cache entry containing
   // the VTK update that must be valid before outputting any image info. For
-  // now it has to be repeated before each image output port calculation.
-  void UpdateModelPoses(const BasicVector<double>& input_vector) const;
+  // now it has to be repeated before each image output port calculation, but
+  // does nothing if the renderer is already posed at @p q.
+  void UpdateModelPoses(const Eigen::VectorXd& q) const;
+
+  // Returns the positions of the RigidBodyTree in @p context, which are all
+  // that the rendered images depend on.
+  Eigen::VectorXd GetPositions(const Context<double>& context) const;
+
+  // An image rendered at the positions `q`. Until the framework caches output
+  // port values, this lets an image be output again without rendering it
+  // when nothing visible has moved since it was rendered, e.g., when a robot
+  // is idle.
+  // TODO(sherm1) Replace with output port caching.
+  template <typename ImageType>
+  struct CachedImage {
+    optional<Eigen::VectorXd> q;
+    ImageType image;
+  };
+
+  // Outputs the cached image if it was rendered at @p q; otherwise, calls
+  // @p render to render it and caches the result.
+  template <typename ImageType, typename RenderFunction>
+  void OutputCachedImage(const Eigen::VectorXd& q, RenderFunction render,
+                         CachedImage<ImageType>* cache,
+                         ImageType* image) const;
 
   const InputPortDescriptor<double>* state_input_port_{};
   const OutputPort<double>* color_image_port_{};
@@ -263,6 +286,12 @@ class RgbdCamera final : public LeafSystem<double> {
          Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()))};
 
   std::unique_ptr<RgbdRenderer> renderer_;
+
+  // The positions at which the renderer's scene was last posed.
+  mutable optional<Eigen::VectorXd> posed_q_;
+  mutable CachedImage<ImageRgba8U> color_cache_;
+  mutable CachedImage<ImageDepth32F> depth_cache_;
+  mutable CachedImage<ImageLabel16I> label_cache_;
 };
 
 /**
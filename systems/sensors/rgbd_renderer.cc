@@ -44,6 +44,58 @@ void RgbdRenderer::RenderLabelImage(ImageLabel16I* label_image_out) const {
   ImplRenderLabelImage(label_image_out);
 }
 
+void RgbdRenderer::RenderImages(ImageRgba8U* color_image_out,
+                                ImageDepth32F* depth_image_out,
+                                ImageLabel16I* label_image_out) const {
+  ImplRenderImages(color_image_out, depth_image_out, label_image_out);
+}
+
+namespace {
+// Resizes @p images, if not null, to hold @p size images of the configured
+// dimensions, reusing the images it already holds.
+template <typename ImageType>
+void ResizeImages(const RenderingConfig& config, int size,
+                  std::vector<ImageType>* images) {
+  if (images == nullptr) return;
+  images->resize(size, ImageType(config.width, config.height));
+  for (ImageType& image : *images) {
+    if (image.width() != config.width || image.height() != config.height) {
+      image.resize(config.width, config.height);
+    }
+  }
+}
+
+template <typename ImageType>
+ImageType* GetImage(int index, std::vector<ImageType>* images) {
+  return (images == nullptr) ? nullptr : &(*images)[index];
+}
+}  // namespace
+
+void RgbdRenderer::RenderViewpoints(
+    const std::vector<Eigen::Isometry3d>& X_WC_list,
+    std::vector<ImageRgba8U>* color_images_out,
+    std::vector<ImageDepth32F>* depth_images_out,
+    std::vector<ImageLabel16I>* label_images_out) const {
+  const int size = static_cast<int>(X_WC_list.size());
+  ResizeImages(config_, size, color_images_out);
+  ResizeImages(config_, size, depth_images_out);
+  ResizeImages(config_, size, label_images_out);
+  for (int i = 0; i < size; ++i) {
+    ImplUpdateViewpoint(X_WC_list[i]);
+    ImplRenderImages(GetImage(i, color_images_out),
+                     GetImage(i, depth_images_out),
+                     GetImage(i, label_images_out));
+  }
+}
+
+void RgbdRenderer::ImplRenderImages(ImageRgba8U* color_image_out,
+                                    ImageDepth32F* depth_image_out,
+                                    ImageLabel16I* label_image_out) const {
+  if (color_image_out) ImplRenderColorImage(color_image_out);
+  if (depth_image_out) ImplRenderDepthImage(depth_image_out);
+  if (label_image_out) ImplRenderLabelImage(label_image_out);
+}
+
 const RenderingConfig& RgbdRenderer::config() const { return config_; }
 
 const ColorPalette& RgbdRenderer::color_palette() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -146,6 +147,38 @@ class RgbdRenderer {
   /// @param label_image_out The rendered label image.
   void RenderLabelImage(ImageLabel16I* label_image_out) const;
 
+  /// Renders and outputs any combination of the color, depth and label images
+  /// at once, which can be faster than rendering them one by one. The images
+  /// whose pointer is null are not rendered.
+  ///
+  /// @param color_image_out The rendered color image, or nullptr.
+  ///
+  /// @param depth_image_out The rendered depth image, or nullptr.
+  ///
+  /// @param label_image_out The rendered label image, or nullptr.
+  void RenderImages(ImageRgba8U* color_image_out,
+                    ImageDepth32F* depth_image_out,
+                    ImageLabel16I* label_image_out) const;
+
+  /// Renders the images seen from several viewpoints of the same scene, as if
+  /// by calling UpdateViewpoint() and RenderImages() for each of them in
+  /// turn. The renderer's viewpoint is left at the last one.
+  ///
+  /// @param X_WC_list The poses of the viewpoints in the world coordinate
+  /// system.
+  ///
+  /// @param color_images_out The rendered color images, one per viewpoint,
+  /// or nullptr. The vector is resized to the number of viewpoints; the
+  /// images already in it are reused.
+  ///
+  /// @param depth_images_out The rendered depth images, as above.
+  ///
+  /// @param label_images_out The rendered label images, as above.
+  void RenderViewpoints(const std::vector<Eigen::Isometry3d>& X_WC_list,
+                        std::vector<ImageRgba8U>* color_images_out,
+                        std::vector<ImageDepth32F>* depth_images_out,
+                        std::vector<ImageLabel16I>* label_images_out) const;
+
   /// Returns the configuration object of this renderer.
   const RenderingConfig& config() const;
 
@@ -169,6 +202,11 @@ class RgbdRenderer {
 
   virtual void ImplRenderLabelImage(ImageLabel16I* label_image_out) const = 0;
 
+  // The default implementation renders the requested images one by one.
+  virtual void ImplRenderImages(ImageRgba8U* color_image_out,
+                                ImageDepth32F* depth_image_out,
+                                ImageLabel16I* label_image_out) const;
+
   /// The common configuration needed by all implementations of this interface.
   RenderingConfig config_;
 
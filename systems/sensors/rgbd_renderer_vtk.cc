@@ -4,7 +4,11 @@
 #include <fstream>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -26,6 +30,7 @@
 #include <vtkProperty.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
+#include <vtkRenderingOpenGLConfigure.h>
 #include <vtkShaderProgram.h>
 #include <vtkSmartPointer.h>
 #include <vtkSphereSource.h>
@@ -35,6 +40,7 @@
 #include <vtkWindowToImageFilter.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/scoped_singleton.h"
 #include "drake/systems/sensors/depth_shaders.h"
 #include "drake/systems/sensors/vtk_util.h"
 
@@ -69,7 +75,10 @@ enum ImageType {
 
 struct RenderingPipeline {
   vtkNew<vtkRenderer> renderer;
-  vtkNew<vtkRenderWindow> window;
+  // Either owned by this pipeline alone, when the images are shown in
+  // windows, or shared with the other renderers' pipelines through
+  // SharedRenderWindows.
+  vtkSmartPointer<vtkRenderWindow> window;
   vtkNew<vtkWindowToImageFilter> filter;
   vtkNew<vtkImageExport> exporter;
 };
@@ -83,6 +92,42 @@ struct ModuleInitVtkRenderingOpenGL2 {
   }
 };
 
+// The offscreen render windows shared by all of the RgbdRendererVTK instances
+// in the process, one per image type and image size, so that any number of
+// cameras render through three OpenGL contexts rather than three apiece.
+// Every renderer added to a shared window has drawing turned off except while
+// its own pipeline is being rendered and read back, which happens with
+// mutex() held.
+class SharedRenderWindows {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedRenderWindows)
+
+  SharedRenderWindows() = default;
+
+  // Returns the window for images of @p type and the given size, creating it
+  // on first use. Must be called with mutex() held.
+  vtkSmartPointer<vtkRenderWindow> GetWindow(ImageType type, int width,
+                                             int height) {
+    auto& window = windows_[std::make_tuple(type, width, height)];
+    if (!window) {
+      // vtkRenderWindow's object factory makes a vtkEGLRenderWindow when VTK
+      // is built with EGL, which needs no X display.
+      window = vtkSmartPointer<vtkRenderWindow>::New();
+      window->SetOffScreenRendering(1);
+      window->SetSize(width, height);
+      if (type == ImageType::kLabel) window->SetMultiSamples(0);
+    }
+    return window;
+  }
+
+  std::mutex& mutex() const { return mutex_; }
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::tuple<ImageType, int, int>,
+           vtkSmartPointer<vtkRenderWindow>> windows_;
+};
+
 std::string RemoveFileExtension(const std::string& filepath) {
   const size_t last_dot = filepath.find_last_of(".");
   if (last_dot == std::string::npos) {
@@ -91,14 +136,20 @@ std::string RemoveFileExtension(const std::string& filepath) {
   return filepath.substr(0, last_dot);
 }
 
-// Updates VTK rendering related objects including vtkRenderWindow,
-// vtkWindowToImageFilter and vtkImageExporter, so that VTK reflects
-// vtkActors' pose update for rendering.
-void PerformVTKUpdate(const std::unique_ptr<RenderingPipeline>& p) {
+// Renders the scene of @p p into its vtkRenderWindow, so that it reflects
+// vtkActors' pose update.
+void RenderPipeline(const std::unique_ptr<RenderingPipeline>& p) {
   p->window->Render();
+}
+
+// Updates vtkWindowToImageFilter and vtkImageExporter, which reads the
+// rendered image back from the vtkRenderWindow, and exports it to @p out.
+void ReadBackPipeline(const std::unique_ptr<RenderingPipeline>& p,
+                      void* out) {
   p->filter->Modified();
   p->filter->Update();
   p->exporter->Update();
+  p->exporter->Export(out);
 }
 
 void SetModelTransformMatrixToVtkCamera(
@@ -165,7 +216,7 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
 
   Impl(RgbdRendererVTK* parent, const Eigen::Isometry3d& X_WC);
-  ~Impl() {}
+  ~Impl();
 
   void ImplAddFlatTerrain();
 
@@ -183,11 +234,20 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
 
   void ImplRenderLabelImage(ImageLabel16I* label_image_out) const;
 
+  void ImplRenderImages(ImageRgba8U* color_image_out,
+                        ImageDepth32F* depth_image_out,
+                        ImageLabel16I* label_image_out) const;
+
  private:
   float CheckRangeAndConvertToMeters(float shader_output) const;
 
   RgbdRendererVTK* parent_ = nullptr;
 
+  // Preallocated buffers for the color-encoded depth and label images that
+  // are read back from VTK before being decoded.
+  mutable ImageRgba8U depth_buffer_;
+  mutable ImageRgba8U label_buffer_;
+
   vtkNew<vtkActor> terrain_actor_;
   vtkNew<vtkActor> terrain_depth_actor_;
   // Use ImageType to access to this array. We assume pipelines_'s indices to be
@@ -201,6 +261,10 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
   std::map<int, std::array<ActorCollection, 3>> id_object_maps_;
 
   vtkNew<ShaderCallback> uniform_setting_callback_;
+
+  // Null when the images are shown in windows, in which case each pipeline
+  // owns its window.
+  std::shared_ptr<SharedRenderWindows> shared_windows_;
 };
 
 float RgbdRendererVTK::Impl::CheckRangeAndConvertToMeters(
@@ -288,64 +352,95 @@ void RgbdRendererVTK::Impl::ImplUpdateViewpoint(
 
 void RgbdRendererVTK::Impl::ImplRenderColorImage(
     ImageRgba8U* color_image_out) const {
-  // TODO(sherm1) Should evaluate VTK cache entry.
-  PerformVTKUpdate(pipelines_[ImageType::kColor]);
-  pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
+  ImplRenderImages(color_image_out, nullptr, nullptr);
 }
 
 void RgbdRendererVTK::Impl::ImplRenderDepthImage(
     ImageDepth32F* depth_image_out) const {
-  const int width = parent_->config().width;
-  const int height = parent_->config().height;
-  ImageRgba8U image(width, height);
+  ImplRenderImages(nullptr, depth_image_out, nullptr);
+}
 
+void RgbdRendererVTK::Impl::ImplRenderLabelImage(
+    ImageLabel16I* label_image_out) const {
+  ImplRenderImages(nullptr, nullptr, label_image_out);
+}
+
+void RgbdRendererVTK::Impl::ImplRenderImages(
+    ImageRgba8U* color_image_out, ImageDepth32F* depth_image_out,
+    ImageLabel16I* label_image_out) const {
   // TODO(sherm1) Should evaluate VTK cache entry.
-  PerformVTKUpdate(pipelines_[ImageType::kDepth]);
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
-
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      if (image.at(u, v)[0] == 255u &&
-          image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] = InvalidDepth::kTooFar;
-      } else {
-        // Decoding three channel color values to a float value. For the detail,
-        // see depth_shaders.h.
-        float shader_value =
-            image.at(u, v)[0] +
-            image.at(u, v)[1] / 255. +
-            image.at(u, v)[2] / (255. * 255.);
-
-        // Dividing by 255 so that the range gets to be [0, 1].
-        shader_value /= 255.f;
-        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] =
-            CheckRangeAndConvertToMeters(shader_value);
-      }
+  std::unique_lock<std::mutex> lock;
+  if (shared_windows_) {
+    lock = std::unique_lock<std::mutex>(shared_windows_->mutex());
+    if (color_image_out) pipelines_[ImageType::kColor]->renderer->DrawOn();
+    if (depth_image_out) pipelines_[ImageType::kDepth]->renderer->DrawOn();
+    if (label_image_out) pipelines_[ImageType::kLabel]->renderer->DrawOn();
+  }
+
+  // All the passes are rendered before any of them is read back, so that the
+  // GPU works through them back to back instead of idling during each
+  // readback.
+  if (color_image_out) RenderPipeline(pipelines_[ImageType::kColor]);
+  if (depth_image_out) RenderPipeline(pipelines_[ImageType::kDepth]);
+  if (label_image_out) RenderPipeline(pipelines_[ImageType::kLabel]);
+
+  if (color_image_out) {
+    ReadBackPipeline(pipelines_[ImageType::kColor], color_image_out->at(0, 0));
+  }
+  if (depth_image_out) {
+    ReadBackPipeline(pipelines_[ImageType::kDepth], depth_buffer_.at(0, 0));
+  }
+  if (label_image_out) {
+    ReadBackPipeline(pipelines_[ImageType::kLabel], label_buffer_.at(0, 0));
+  }
+
+  if (shared_windows_) {
+    for (auto& pipeline : pipelines_) {
+      pipeline->renderer->DrawOff();
     }
+    lock.unlock();
   }
-}
 
-void RgbdRendererVTK::Impl::ImplRenderLabelImage(
-    ImageLabel16I* label_image_out) const {
   const int width = parent_->config().width;
   const int height = parent_->config().height;
-  ImageRgba8U image(width, height);
+  if (depth_image_out) {
+    const ImageRgba8U& image = depth_buffer_;
+    for (int v = 0; v < height; ++v) {
+      for (int u = 0; u < width; ++u) {
+        if (image.at(u, v)[0] == 255u &&
+            image.at(u, v)[1] == 255u &&
+            image.at(u, v)[2] == 255u) {
+          depth_image_out->at(u, v)[0] = InvalidDepth::kTooFar;
+        } else {
+          // Decoding three channel color values to a float value. For the
+          // detail, see depth_shaders.h.
+          float shader_value =
+              image.at(u, v)[0] +
+              image.at(u, v)[1] / 255. +
+              image.at(u, v)[2] / (255. * 255.);
+
+          // Dividing by 255 so that the range gets to be [0, 1].
+          shader_value /= 255.f;
+          // TODO(kunimatsu-tri) Calculate this in a vertex shader.
+          depth_image_out->at(u, v)[0] =
+              CheckRangeAndConvertToMeters(shader_value);
+        }
+      }
+    }
+  }
 
-  // TODO(sherm1) Should evaluate VTK cache entry.
-  PerformVTKUpdate(pipelines_[ImageType::kLabel]);
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
-
-  ColorI color;
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      // Converting an RGB color to an object instance ID.
-      label_image_out->at(u, v)[0] =
-          static_cast<int16_t>(parent_->color_palette().LookUpId(color));
+  if (label_image_out) {
+    const ImageRgba8U& image = label_buffer_;
+    ColorI color;
+    for (int v = 0; v < height; ++v) {
+      for (int u = 0; u < width; ++u) {
+        color.r = image.at(u, v)[0];
+        color.g = image.at(u, v)[1];
+        color.b = image.at(u, v)[2];
+        // Converting an RGB color to an object instance ID.
+        label_image_out->at(u, v)[0] =
+            static_cast<int16_t>(parent_->color_palette().LookUpId(color));
+      }
     }
   }
 }
@@ -353,20 +448,40 @@ void RgbdRendererVTK::Impl::ImplRenderLabelImage(
 RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
                             const Eigen::Isometry3d& X_WC)
     : parent_(parent),
+      depth_buffer_(parent->config().width, parent->config().height),
+      label_buffer_(parent->config().width, parent->config().height),
       pipelines_{{
           std::make_unique<RenderingPipeline>(),
           std::make_unique<RenderingPipeline>(),
           std::make_unique<RenderingPipeline>()}} {
+  const int width = parent_->config().width;
+  const int height = parent_->config().height;
+  std::unique_lock<std::mutex> lock;
   if (parent_->config().show_window) {
+    if (RgbdRendererVTK::IsHeadless()) {
+      throw std::logic_error(
+          "RgbdRendererVTK: show_window was requested, but VTK renders "
+          "headless through EGL and cannot show windows.");
+    }
+    for (auto& pipeline : pipelines_) {
+      pipeline->window = vtkSmartPointer<vtkRenderWindow>::New();
+      pipeline->window->SetSize(width, height);
+    }
     pipelines_[ImageType::kColor]->window->SetWindowName("Color Image");
     pipelines_[ImageType::kLabel]->window->SetWindowName("Label Image");
     // Always setting off to depth window since displaying the colors which
     // encode floats as depth values doesn't provide useful information to
     // users.
     pipelines_[ImageType::kDepth]->window->SetOffScreenRendering(1);
+    pipelines_[ImageType::kLabel]->window->SetMultiSamples(0);
   } else {
-    for (auto& pipeline : pipelines_) {
-      pipeline->window->SetOffScreenRendering(1);
+    shared_windows_ = GetScopedSingleton<SharedRenderWindows>();
+    lock = std::unique_lock<std::mutex>(shared_windows_->mutex());
+    for (int i = 0; i < static_cast<int>(pipelines_.size()); ++i) {
+      pipelines_[i]->window = shared_windows_->GetWindow(
+          static_cast<ImageType>(i), width, height);
+      // Only drawn while this renderer's own images are being rendered.
+      pipelines_[i]->renderer->DrawOff();
     }
   }
 
@@ -374,8 +489,6 @@ RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
       ColorPalette::Normalize(parent_->color_palette().get_sky_color());
   const vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
-  pipelines_[ImageType::kLabel]->window->SetMultiSamples(0);
-
   for (auto& pipeline : pipelines_) {
     pipeline->renderer->SetBackground(sky_color.r, sky_color.g, sky_color.b);
     auto camera = pipeline->renderer->GetActiveCamera();
@@ -383,10 +496,8 @@ RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
     camera->SetClippingRange(kClippingPlaneNear, kClippingPlaneFar);
     SetModelTransformMatrixToVtkCamera(camera, vtk_X_WC);
 
-    pipeline->window->SetSize(parent_->config().width,
-                              parent_->config().height);
     pipeline->window->AddRenderer(pipeline->renderer.GetPointer());
-    pipeline->filter->SetInput(pipeline->window.GetPointer());
+    pipeline->filter->SetInput(pipeline->window);
 #if VTK_MAJOR_VERSION == 8 && VTK_MINOR_VERSION == 0
     pipeline->filter->SetMagnification(1);
 #else
@@ -419,6 +530,17 @@ RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
       static_cast<float>(parent_->config().z_far));
 }
 
+RgbdRendererVTK::Impl::~Impl() {
+  if (shared_windows_) {
+    // Releases this renderer's graphics resources from the shared windows,
+    // which outlive it.
+    std::lock_guard<std::mutex> lock(shared_windows_->mutex());
+    for (auto& pipeline : pipelines_) {
+      pipeline->window->RemoveRenderer(pipeline->renderer.GetPointer());
+    }
+  }
+}
+
 optional<RgbdRenderer::VisualIndex> RgbdRendererVTK::Impl::ImplRegisterVisual(
     const DrakeShapes::VisualElement& visual, int body_id) {
   std::array<vtkNew<vtkActor>, 3> actors;
@@ -577,6 +699,14 @@ RgbdRendererVTK::RgbdRendererVTK(const RenderingConfig& config,
 
 RgbdRendererVTK::~RgbdRendererVTK() {}
 
+bool RgbdRendererVTK::IsHeadless() {
+#ifdef VTK_OPENGL_HAS_EGL
+  return true;
+#else
+  return false;
+#endif
+}
+
 optional<RgbdRenderer::VisualIndex> RgbdRendererVTK::ImplRegisterVisual(
     const DrakeShapes::VisualElement& visual, int body_id) {
   return impl_->ImplRegisterVisual(visual, body_id);
@@ -608,6 +738,12 @@ void RgbdRendererVTK::ImplRenderLabelImage(
   impl_->ImplRenderLabelImage(label_image_out);
 }
 
+void RgbdRendererVTK::ImplRenderImages(ImageRgba8U* color_image_out,
+                                       ImageDepth32F* depth_image_out,
+                                       ImageLabel16I* label_image_out) const {
+  impl_->ImplRenderImages(color_image_out, depth_image_out, label_image_out);
+}
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
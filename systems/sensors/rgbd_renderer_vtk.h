@@ -9,16 +9,28 @@ namespace systems {
 namespace sensors {
 
 /// An RgbdRenderer implementation using VTK.
+///
+/// Unless `show_window` is set, all the instances in a process render
+/// offscreen through a small set of shared render windows, one per image type
+/// and image size, so that adding cameras does not add OpenGL contexts. When
+/// VTK is built with EGL (see IsHeadless()), those windows need no X display.
+/// Rendering through the shared windows is serialized across instances.
 class RgbdRendererVTK final : public RgbdRenderer {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RgbdRendererVTK)
 
+  /// @throws std::logic_error if `config.show_window` is true and
+  /// IsHeadless() is true.
   RgbdRendererVTK(
       const RenderingConfig& config,
       const Eigen::Isometry3d& X_WC = Eigen::Isometry3d::Identity());
 
   ~RgbdRendererVTK();
 
+  /// Returns true iff VTK renders offscreen through EGL, in which case no X
+  /// display is needed and `show_window` is not supported.
+  static bool IsHeadless();
+
  private:
   void ImplAddFlatTerrain() override;
 
@@ -36,6 +48,10 @@ class RgbdRendererVTK final : public RgbdRenderer {
 
   void ImplRenderLabelImage(ImageLabel16I* label_image_out) const override;
 
+  void ImplRenderImages(ImageRgba8U* color_image_out,
+                        ImageDepth32F* depth_image_out,
+                        ImageLabel16I* label_image_out) const override;
+
   class Impl;
   std::unique_ptr<Impl> impl_;
 };
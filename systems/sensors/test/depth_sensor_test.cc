@@ -137,7 +137,9 @@ const double kBoxWidth{0.1};
 // depth measurements.
 std::pair<VectorX<double>, Matrix3Xd> DoBoxOcclusionTest(
     const char* const name, const DepthSensorSpecification& specification,
-    const Vector3d& box_xyz) {
+    const Vector3d& box_xyz,
+    DepthSensor::RaycastBackend backend =
+        DepthSensor::RaycastBackend::kCollisionModel) {
   RigidBodyTree<double> tree;
 
   // Adds a box to the world at the specified location.
@@ -165,7 +167,8 @@ std::pair<VectorX<double>, Matrix3Xd> DoBoxOcclusionTest(
   tree.addFrame(frame);
   tree.compile();
 
-  DepthSensor dut(name, tree, *frame, specification);
+  DepthSensor dut(name, tree, *frame, specification, backend);
+  EXPECT_EQ(dut.get_raycast_backend(), backend);
 
   unique_ptr<Context<double>> context = dut.CreateDefaultContext();
   unique_ptr<SystemOutput<double>> output = dut.AllocateOutput(*context);
@@ -303,6 +306,24 @@ GTEST_TEST(TestDepthSensor, TestTooClose) {
   EXPECT_EQ(point_cloud.cols(), 0);
 }
 
+// Tests that both raycast backends sense a box in the sensor's surrounding
+// X,Y,Z volume at the same distances.
+GTEST_TEST(TestDepthSensor, BvhBackendTest) {
+  DepthSensorSpecification specification;
+  DepthSensorSpecification::set_xyz_spherical_spec(&specification);
+
+  const Vector3d box_xyz(0.3, 0.2, 0.1);
+  const VectorX<double> expected = DoBoxOcclusionTest(
+      "foo depth sensor", specification, box_xyz).first;
+  const VectorX<double> depth_measurements = DoBoxOcclusionTest(
+      "foo depth sensor", specification, box_xyz,
+      DepthSensor::RaycastBackend::kBvh).first;
+
+  EXPECT_GT((expected.array() <= specification.max_range()).count(), 0);
+  EXPECT_TRUE(CompareMatrices(depth_measurements, expected, 1e-8,
+                              MatrixCompareType::absolute));
+}
+
 // Tests that DepthSensorSpecification is copyable.
 GTEST_TEST(TestDepthSensor, TestDepthSensorSpecIsCopyable) {
   DepthSensorSpecification original_spec;
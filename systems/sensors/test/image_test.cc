@@ -171,6 +171,66 @@ GTEST_TEST(TestImage, ResizeTest) {
   EXPECT_EQ(dut.size(), kWidthResized * kHeightResized * kNumChannels);
 }
 
+// Copies share the pixels until one of them is accessed through the
+// non-const at().
+GTEST_TEST(TestImage, CopyOnWriteTest) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  const ImageRgba8U& const_image = image;
+  ImageRgba8U dut(image);
+  const ImageRgba8U& const_dut = dut;
+  EXPECT_EQ(const_dut.at(0, 0), const_image.at(0, 0));
+
+  dut.at(1, 2)[3] = 7;
+  EXPECT_NE(const_dut.at(0, 0), const_image.at(0, 0));
+  EXPECT_EQ(const_dut.at(1, 2)[3], 7);
+  EXPECT_EQ(const_image.at(1, 2)[3], kInitialValue);
+  EXPECT_EQ(const_dut.at(kWidth - 1, kHeight - 1)[0], kInitialValue);
+
+  // An image that owns its pixels alone writes them in place.
+  const uint8_t* const pixels = const_dut.at(0, 0);
+  dut.at(0, 0)[0] = 8;
+  EXPECT_EQ(const_dut.at(0, 0), pixels);
+
+  // Assigning an image shares its pixels too.
+  ImageRgba8U dut2;
+  dut2 = dut;
+  const ImageRgba8U& const_dut2 = dut2;
+  EXPECT_EQ(const_dut2.at(0, 0), pixels);
+
+  // Resizing a shared image gives it new, zeroed pixels.
+  dut2.resize(kWidth, kHeight);
+  EXPECT_NE(const_dut2.at(0, 0), pixels);
+  EXPECT_EQ(const_dut2.at(0, 0)[0], 0);
+  EXPECT_EQ(const_dut.at(0, 0)[0], 8);
+}
+
+// The buffers of released images are reused by new images of the same size.
+GTEST_TEST(TestImage, BufferPoolTest) {
+  using Pool = internal::ImageBufferPool<float>;
+  Pool::Clear();
+  const float* pixels{};
+  {
+    ImageDepth32F image(kWidth, kHeight, 1.f);
+    const ImageDepth32F copy(image);
+    pixels = copy.at(0, 0);
+    EXPECT_EQ(Pool::num_pooled(), 0);
+  }
+  EXPECT_EQ(Pool::num_pooled(), 1);
+
+  // An image of another size does not take the buffer.
+  ImageDepth32F small(kWidth / 2, kHeight / 2);
+  EXPECT_EQ(Pool::num_pooled(), 1);
+
+  // An image of the same size does, and initializes its pixels.
+  ImageDepth32F image(kWidth, kHeight, 2.f);
+  EXPECT_EQ(Pool::num_pooled(), 0);
+  const ImageDepth32F& const_image = image;
+  EXPECT_EQ(const_image.at(0, 0), pixels);
+  EXPECT_EQ(const_image.at(kWidth - 1, kHeight - 1)[0], 2.f);
+
+  Pool::Clear();
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -126,6 +126,48 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// Tests that a message computed into an output that holds a previous, larger
+// message carries only the new images.
+GTEST_TEST(ImageToLcmImageArrayT, ReusedOutputTest) {
+  for (const bool do_compress : {false, true}) {
+    ImageToLcmImageArrayT dut(
+        kColorFrameName, kDepthFrameName, kLabelFrameName, do_compress);
+    std::unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+    context->FixInputPort(
+        dut.color_image_input_port().get_index(),
+        std::make_unique<Value<ImageRgba8U>>(
+            ImageRgba8U(kImageWidth, kImageHeight)));
+    context->FixInputPort(
+        dut.depth_image_input_port().get_index(),
+        std::make_unique<Value<ImageDepth32F>>(
+            ImageDepth32F(kImageWidth, kImageHeight)));
+    auto output = dut.AllocateOutput(*context);
+    dut.CalcOutput(*context, output.get());
+
+    // Recomputes with a smaller color image and no depth image.
+    context = dut.CreateDefaultContext();
+    context->FixInputPort(
+        dut.color_image_input_port().get_index(),
+        std::make_unique<Value<ImageRgba8U>>(ImageRgba8U(2, 3)));
+    dut.CalcOutput(*context, output.get());
+
+    const auto& message = output->get_data(
+        dut.image_array_t_msg_output_port().get_index())->GetValue<
+          robotlocomotion::image_array_t>();
+    ASSERT_EQ(message.num_images, 1);
+    ASSERT_EQ(message.images.size(), 1);
+    const image_t& image = message.images[0];
+    EXPECT_EQ(image.width, 2);
+    EXPECT_EQ(image.height, 3);
+    EXPECT_EQ(image.pixel_format, image_t::PIXEL_FORMAT_RGBA);
+    EXPECT_EQ(image.data.size(), image.size);
+    if (!do_compress) {
+      const int expected_size = 2 * 3 * ImageRgba8U::kPixelSize;
+      EXPECT_EQ(image.size, expected_size);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
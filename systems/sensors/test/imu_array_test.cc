@@ -0,0 +1,99 @@
+#include "drake/systems/sensors/imu_array.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+#include "drake/multibody/rigid_body_tree.h"
+#include "drake/systems/sensors/accelerometer.h"
+#include "drake/systems/sensors/gyroscope.h"
+
+using Eigen::VectorXd;
+
+using std::make_unique;
+using std::unique_ptr;
+
+namespace drake {
+
+using parsers::urdf::AddModelInstanceFromUrdfFileToWorld;
+
+namespace systems {
+namespace sensors {
+namespace {
+
+// Returns the vector output of `system` at `port_index`, with its input ports
+// fixed to `inputs`.
+VectorXd CalcOutput(const System<double>& system, int port_index,
+                    const std::vector<VectorXd>& inputs) {
+  unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  for (int i = 0; i < context->get_num_input_ports(); ++i) {
+    context->FixInputPort(i, make_unique<BasicVector<double>>(inputs[i]));
+  }
+  unique_ptr<SystemOutput<double>> output = system.AllocateOutput(*context);
+  system.CalcOutput(*context, output.get());
+  return output->get_vector_data(port_index)->CopyToVector();
+}
+
+// Compares the readings of an ImuArray against those of an Accelerometer and
+// a Gyroscope attached to each of its frames, on a floating acrobot in a
+// generic state.
+GTEST_TEST(ImuArrayTest, MatchesIndividualSensors) {
+  RigidBodyTree<double> tree;
+  AddModelInstanceFromUrdfFileToWorld(
+      FindResourceOrThrow("drake/examples/acrobot/Acrobot.urdf"),
+      multibody::joints::kRollPitchYaw, &tree);
+  RigidBody<double>* upper_link = tree.FindBody("upper_link");
+  RigidBody<double>* lower_link = tree.FindBody("lower_link");
+
+  Isometry3<double> X_BF(AngleAxis<double>(0.3, Vector3<double>(1, 2, 3)
+                                                    .normalized()));
+  X_BF.translation() << 0.1, -0.2, 0.4;
+  // Two of the frames are on the same body.
+  const std::vector<RigidBodyFrame<double>> frames{
+      RigidBodyFrame<double>("upper", upper_link, X_BF),
+      RigidBodyFrame<double>("lower", lower_link,
+                             Isometry3<double>::Identity()),
+      RigidBodyFrame<double>("lower_offset", lower_link, X_BF.inverse())};
+
+  const int num_states = tree.get_num_positions() + tree.get_num_velocities();
+  const VectorXd x = VectorXd::LinSpaced(num_states, -1.0, 1.5);
+  const VectorXd xdot = VectorXd::LinSpaced(num_states, 2.0, -0.7);
+
+  for (bool include_gravity : {false, true}) {
+    const ImuArray dut("imus", frames, tree, include_gravity);
+    ASSERT_EQ(dut.num_imus(), 3);
+    const VectorXd accelerations = CalcOutput(
+        dut, dut.get_acceleration_output_port().get_index(), {x, xdot});
+    const VectorXd angular_velocities = CalcOutput(
+        dut, dut.get_angular_velocity_output_port().get_index(), {x, xdot});
+    ASSERT_EQ(accelerations.size(), 9);
+    ASSERT_EQ(angular_velocities.size(), 9);
+
+    for (int i = 0; i < dut.num_imus(); ++i) {
+      const Accelerometer accelerometer("accelerometer", frames[i], tree,
+                                        include_gravity);
+      EXPECT_TRUE(CompareMatrices(
+          accelerations.segment<3>(3 * i),
+          CalcOutput(accelerometer,
+                     accelerometer.get_output_port().get_index(),
+                     {x, xdot}),
+          1e-10, MatrixCompareType::relative));
+
+      const Gyroscope gyroscope("gyroscope", frames[i], tree);
+      EXPECT_TRUE(CompareMatrices(
+          angular_velocities.segment<3>(3 * i),
+          CalcOutput(gyroscope, gyroscope.get_output_port().get_index(), {x}),
+          1e-10, MatrixCompareType::relative));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
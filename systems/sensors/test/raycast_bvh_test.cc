@@ -0,0 +1,149 @@
+#include "drake/systems/sensors/raycast_bvh.h"
+
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/joints/prismatic_joint.h"
+
+using Eigen::Isometry3d;
+using Eigen::Matrix3Xd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using drake::multibody::collision::Element;
+
+void AddShape(const DrakeShapes::Geometry& geometry, const Vector3d& position,
+              RigidBody<double>* body, RigidBodyTree<double>* tree) {
+  Isometry3d X_BG = Isometry3d::Identity();
+  X_BG.translation() = position;
+  tree->addCollisionElement(Element(geometry, X_BG, body), *body, "default");
+}
+
+class RaycastBvhTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Anchored shapes, each 1.5 m away from the origin along one axis.
+    RigidBody<double>& world = tree_.world();
+    AddShape(DrakeShapes::Box(Vector3d(1, 1, 1)), Vector3d(2, 0, 0), &world,
+             &tree_);
+    AddShape(DrakeShapes::Sphere(0.5), Vector3d(0, 2, 0), &world, &tree_);
+    AddShape(DrakeShapes::Cylinder(0.5, 2), Vector3d(0, -2, 0), &world,
+             &tree_);
+    AddShape(DrakeShapes::Capsule(0.5, 1), Vector3d(0, 0, 2.5), &world,
+             &tree_);
+
+    // A sphere that slides along the x axis, 1.5 m below the origin.
+    auto body = std::make_unique<RigidBody<double>>();
+    body->set_name("slider");
+    // Bodies without inertia would be welded to their parents.
+    body->set_spatial_inertia(SquareTwistMatrix<double>::Identity());
+    body->add_joint(&world, std::make_unique<PrismaticJoint>(
+                                "slider", Isometry3d::Identity(),
+                                Vector3d::UnitX()));
+    RigidBody<double>* slider = tree_.add_rigid_body(std::move(body));
+    AddShape(DrakeShapes::Sphere(0.5), Vector3d(0, 0, -2), slider, &tree_);
+    tree_.compile();
+  }
+
+  // Casts rays 3 m long from the origin along each of @p directions.
+  VectorXd Cast(const RaycastBvh& dut, const Matrix3Xd& directions,
+                int num_threads = 1) {
+    VectorXd distances;
+    dut.CastRays(Vector3d::Zero(), 3 * directions, &distances, num_threads);
+    return distances;
+  }
+
+  void Refit(double slider_position, RaycastBvh* dut) {
+    const VectorXd q = VectorXd::Constant(1, slider_position);
+    dut->Refit(tree_.doKinematics(q));
+  }
+
+  RigidBodyTree<double> tree_;
+};
+
+TEST_F(RaycastBvhTest, Shapes) {
+  RaycastBvh dut(tree_);
+  EXPECT_EQ(dut.num_elements(), 5);
+  Refit(0, &dut);
+
+  Matrix3Xd directions(3, 7);
+  directions.col(0) = Vector3d::UnitX();
+  directions.col(1) = Vector3d::UnitY();
+  directions.col(2) = -Vector3d::UnitY();
+  directions.col(3) = Vector3d::UnitZ();
+  directions.col(4) = -Vector3d::UnitZ();
+  directions.col(5) = -Vector3d::UnitX();
+  // Off the capsule's axis, through its lower cap, i.e., the sphere of radius
+  // 0.5 around (0, 0, 2).
+  directions.col(6) = Vector3d(0.24, 0, 1).normalized();
+  const double u_z = directions(2, 6);
+  VectorXd expected(7);
+  expected << 1.5, 1.5, 1.5, 1.5, 1.5, -1,
+      2 * u_z - std::sqrt(4 * u_z * u_z - 3.75);
+  EXPECT_TRUE(CompareMatrices(Cast(dut, directions), expected, 1e-12));
+
+  // Hits beyond the end of the rays do not count.
+  VectorXd distances;
+  dut.CastRays(Vector3d::Zero(), directions, &distances, 1);
+  EXPECT_TRUE(CompareMatrices(distances, VectorXd::Constant(7, -1), 0));
+
+  // An origin inside of a shape gives a distance of zero.
+  dut.CastRays(Vector3d(2, 0, 0), Matrix3Xd(directions.col(0)), &distances,
+               1);
+  EXPECT_EQ(distances[0], 0);
+}
+
+TEST_F(RaycastBvhTest, Refit) {
+  RaycastBvh dut(tree_);
+  const Matrix3Xd down = -Vector3d::UnitZ();
+  const Matrix3Xd diagonal = Vector3d(1, 0, -1).normalized();
+
+  Refit(0, &dut);
+  EXPECT_NEAR(Cast(dut, down)[0], 1.5, 1e-12);
+  EXPECT_EQ(Cast(dut, diagonal)[0], -1);
+
+  // Once the slider moves under the diagonal ray, only that ray hits it.
+  Refit(2, &dut);
+  EXPECT_EQ(Cast(dut, down)[0], -1);
+  EXPECT_NEAR(Cast(dut, diagonal)[0], 2 * std::sqrt(2) - 0.5, 1e-12);
+}
+
+// Rays in every direction give the same distances however many threads trace
+// them, and however the rays fall into packets.
+TEST_F(RaycastBvhTest, Threads) {
+  RaycastBvh dut(tree_);
+  Refit(0.3, &dut);
+
+  const int kNumPitch = 37;
+  const int kNumYaw = 71;
+  Matrix3Xd directions(3, kNumPitch * kNumYaw);
+  for (int i = 0; i < kNumPitch; ++i) {
+    const double pitch = -M_PI_2 + i * M_PI / (kNumPitch - 1);
+    for (int j = 0; j < kNumYaw; ++j) {
+      const double yaw = j * 2 * M_PI / kNumYaw;
+      directions.col(i * kNumYaw + j) =
+          Vector3d(cos(pitch) * cos(yaw), cos(pitch) * sin(yaw), sin(pitch));
+    }
+  }
+
+  const VectorXd expected = Cast(dut, directions, 1);
+  EXPECT_GT((expected.array() > 0).count(), 0);
+  EXPECT_TRUE(CompareMatrices(Cast(dut, directions, 4), expected, 0));
+  for (int i = 0; i < directions.cols(); i += 13) {
+    EXPECT_EQ(Cast(dut, directions.col(i))[0], expected[i]);
+  }
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -218,10 +218,10 @@ class RgbdCameraDiagramTest : public ::testing::Test {
   }
 
   std::unique_ptr<systems::SystemOutput<double>> output_;
+  std::unique_ptr<systems::Context<double>> context_;
 
  private:
   std::unique_ptr<RgbdCameraDiagram> diagram_;
-  std::unique_ptr<systems::Context<double>> context_;
 };
 
 
@@ -263,6 +263,34 @@ TEST_F(RgbdCameraDiagramTest, MovableCameraOutputTest) {
                               actual.matrix(), kTolerance));
 }
 
+// Verifies that the images follow the camera when it moves, and return to
+// the same values when it moves back, which exercises the cached images.
+TEST_F(RgbdCameraDiagramTest, MovableCameraCacheTest) {
+  // RgbdCamera is looking straight down 1m above the link.
+  const Eigen::Isometry3d X_WB = Eigen::Translation3d(0., 0., 1.) *
+      Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY());
+  Init("nothing.sdf", X_WB);
+
+  const auto get_depth = [this]() {
+    Verify();
+    return output_->get_data(1)->GetValue<ImageDepth32F>().at(0, 0)[0];
+  };
+  const float initial_depth = get_depth();
+  EXPECT_EQ(get_depth(), initial_depth);
+
+  // Raises the link, which carries the camera, by 0.5m; the state's third
+  // entry is the z position of the link's floating base.
+  VectorBase<double>& state =
+      context_->get_mutable_continuous_state_vector();
+  const double z = state.GetAtIndex(2);
+  state.SetAtIndex(2, z + 0.5);
+  const double kDepthTolerance = 1e-3;
+  EXPECT_NEAR(get_depth(), initial_depth + 0.5, kDepthTolerance);
+
+  state.SetAtIndex(2, z);
+  EXPECT_EQ(get_depth(), initial_depth);
+}
+
 class DepthImageToPointCloudConversionTest : public ::testing::Test {
  public:
   static constexpr float kFocal = 500.f;
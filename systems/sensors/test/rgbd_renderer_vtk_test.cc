@@ -1,5 +1,8 @@
 #include "drake/systems/sensors/rgbd_renderer_vtk.h"
 
+#include <array>
+#include <vector>
+
 #include "drake/systems/sensors/test/rgbd_renderer_test_util.h"
 
 namespace drake {
@@ -71,6 +74,73 @@ TEST_F(RgbdRendererVTKTest, TerrainTest) {
   }
 }
 
+// Renders all the images at once, and from several viewpoints at once.
+TEST_F(RgbdRendererVTKTest, RenderImagesTest) {
+  Init(X_WC_, true);
+  const auto& kTerrain = renderer_->color_palette().get_terrain_color();
+
+  X_WC_.translation().z() = 2.f;
+  renderer_->UpdateViewpoint(X_WC_);
+  renderer_->RenderImages(&color_, &depth_, &label_);
+  VerifyUniformColor(kTerrain, 255u);
+  VerifyUniformLabel(Label::kFlatTerrain);
+  VerifyUniformDepth(2.f);
+
+  // Only the requested images are rendered.
+  depth_.at(0, 0)[0] = 0.f;
+  renderer_->RenderImages(nullptr, nullptr, &label_);
+  EXPECT_EQ(depth_.at(0, 0)[0], 0.f);
+  VerifyUniformLabel(Label::kFlatTerrain);
+
+  const std::array<float, 2> depths{{2.f, 4.9999f}};
+  std::vector<Isometry3d> X_WC_list;
+  for (float depth : depths) {
+    X_WC_.translation().z() = depth;
+    X_WC_list.push_back(X_WC_);
+  }
+  std::vector<ImageRgba8U> color_images;
+  std::vector<ImageDepth32F> depth_images;
+  renderer_->RenderViewpoints(X_WC_list, &color_images, &depth_images,
+                              nullptr);
+  ASSERT_EQ(color_images.size(), depths.size());
+  ASSERT_EQ(depth_images.size(), depths.size());
+  for (size_t i = 0; i < depths.size(); ++i) {
+    color_ = color_images[i];
+    depth_ = depth_images[i];
+    VerifyUniformColor(kTerrain, 255u);
+    VerifyUniformDepth(depths[i]);
+  }
+}
+
+// Renderers of the same size share their render windows, but each one still
+// renders only its own scene from its own viewpoint.
+TEST_F(RgbdRendererVTKTest, SharedWindowsTest) {
+  Init(X_WC_, true);
+  const auto& kTerrain = renderer_->color_palette().get_terrain_color();
+
+  // A second renderer with no terrain, i.e. only sky.
+  RgbdRendererVTK other(
+      RenderingConfig{kWidth, kHeight, kFovY, kZNear, kZFar, kShowWindow},
+      X_WC_);
+  ImageRgba8U other_color(kWidth, kHeight);
+  ImageLabel16I other_label(kWidth, kHeight);
+
+  for (auto depth : std::array<float, 2>({{2.f, 4.9999f}})) {
+    X_WC_.translation().z() = depth;
+    renderer_->UpdateViewpoint(X_WC_);
+    Render();
+    other.RenderImages(&other_color, nullptr, &other_label);
+    VerifyUniformColor(kTerrain, 255u);
+    VerifyUniformLabel(Label::kFlatTerrain);
+    VerifyUniformDepth(depth);
+
+    color_ = other_color;
+    label_ = other_label;
+    VerifyUniformColor(renderer_->color_palette().get_sky_color(), 0u);
+    VerifyUniformLabel(Label::kNoBody);
+  }
+}
+
 TEST_F(RgbdRendererVTKTest, HorizonTest) {
   // Camera at the origin, pointing in a direction parallel to the ground.
   Isometry3d X_WC =
@@ -1,5 +1,6 @@
 #include "drake/systems/trajectory_optimization/direct_collocation.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
@@ -20,48 +21,66 @@ using solvers::VectorXDecisionVariable;
 
 DirectCollocationConstraint::DirectCollocationConstraint(
     const System<double>& system, const Context<double>& context)
-    : DirectCollocationConstraint(
-          system, context, context.get_continuous_state().size(),
-          (context.get_num_input_ports() > 0 ? system.get_input_port(0).size()
-                                             : 0)) {}
+    : DirectCollocationConstraint(std::make_shared<const DynamicsContextPool>(
+          System<double>::ToAutoDiffXd(system), context)) {}
 
 DirectCollocationConstraint::DirectCollocationConstraint(
-    const System<double>& system, const Context<double>& context,
-    int num_states, int num_inputs)
+    std::shared_ptr<const DynamicsContextPool> pool)
+    : DirectCollocationConstraint(pool,
+                                  pool->context().get_continuous_state().size(),
+                                  pool->num_inputs()) {}
+
+DirectCollocationConstraint::DirectCollocationConstraint(
+    std::shared_ptr<const DynamicsContextPool> pool, int num_states,
+    int num_inputs)
     : Constraint(num_states, 1 + (2 * num_states) + (2 * num_inputs),
                  Eigen::VectorXd::Zero(num_states),
                  Eigen::VectorXd::Zero(num_states)),
-      system_(System<double>::ToAutoDiffXd(system)),
-      context_(system_->CreateDefaultContext()),
-      // Don't allocate the input port until we're past the point
-      // where we might throw.
-      derivatives_(system_->AllocateTimeDerivatives()),
+      pool_(std::move(pool)),
       num_states_(num_states),
       num_inputs_(num_inputs) {
-  DRAKE_THROW_UNLESS(system_->get_num_input_ports() <= 1);
-  DRAKE_THROW_UNLESS(context.has_only_continuous_state());
+  DRAKE_THROW_UNLESS(pool_->context().has_only_continuous_state());
 
   // TODO(russt): Add support for time-varying dynamics OR check for
   // time-invariance.
-
-  context_->SetTimeStateAndParametersFrom(context);
-
-  if (context.get_num_input_ports() > 0) {
-    // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
-        0, system_->AllocateInputVector(system_->get_input_port(0)));
-  }
 }
 
-void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
-                                           const AutoDiffVecXd& input,
-                                           AutoDiffVecXd* xdot) const {
-  if (context_->get_num_input_ports() > 0) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
+void DirectCollocationConstraint::dynamics(
+    const AutoDiffVecXd& state, const AutoDiffVecXd& input,
+    int num_derivatives, DynamicsContextPool::Workspace* workspace,
+    AutoDiffVecXd* xdot) const {
+  // The derivatives of `state` and `input` are typically taken with respect
+  // to all the variables of the constraint, i.e., 1 + 2 * num_states +
+  // 2 * num_inputs of them. Rather than propagating that many derivatives
+  // through the system, we differentiate the dynamics with respect to
+  // (state, input) only and apply the chain rule afterwards, which roughly
+  // halves the size of the derivatives carried through CalcTimeDerivatives().
+  Eigen::VectorXd state_input(num_states_ + num_inputs_);
+  state_input << math::autoDiffToValueMatrix(state),
+      math::autoDiffToValueMatrix(input);
+  const AutoDiffVecXd local_state_input =
+      math::initializeAutoDiff(state_input);
+
+  Context<AutoDiffXd>& context = *workspace->context;
+  if (context.get_num_input_ports() > 0) {
+    workspace->input_port_value->GetMutableVectorData<AutoDiffXd>()
+        ->SetFromVector(local_state_input.tail(num_inputs_));
   }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  context.get_mutable_continuous_state().SetFromVector(
+      local_state_input.head(num_states_));
+  pool_->system().CalcTimeDerivatives(context, workspace->derivatives.get());
+  const AutoDiffVecXd local_xdot = workspace->derivatives->CopyToVector();
+
+  Eigen::MatrixXd dstate_input(num_states_ + num_inputs_, num_derivatives);
+  dstate_input << math::autoDiffToGradientMatrix(state, num_derivatives),
+      math::autoDiffToGradientMatrix(input, num_derivatives);
+  const Eigen::MatrixXd dxdot =
+      math::autoDiffToGradientMatrix(local_xdot,
+                                     num_states_ + num_inputs_) *
+      dstate_input;
+  xdot->resize(num_states_);
+  math::initializeAutoDiffGivenGradientMatrix(
+      math::autoDiffToValueMatrix(local_xdot), dxdot, *xdot);
 }
 
 void DirectCollocationConstraint::DoEval(
@@ -92,20 +111,26 @@ void DirectCollocationConstraint::DoEval(
   // TODO(sam.creasey): Use caching (when it arrives) to avoid recomputing
   // the dynamics.  Currently the dynamics evaluated here as {u1,x1} are
   // recomputed in the next constraint as {u0,x0}.
+  int num_derivatives = 0;
+  for (int i = 0; i < x.size(); ++i) {
+    num_derivatives =
+        std::max(num_derivatives, static_cast<int>(x(i).derivatives().size()));
+  }
+
+  const DynamicsContextPool::Lease workspace = pool_->Acquire();
+
   AutoDiffVecXd xdot0;
-  dynamics(x0, u0, &xdot0);
-  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
+  dynamics(x0, u0, num_derivatives, workspace.get(), &xdot0);
 
   AutoDiffVecXd xdot1;
-  dynamics(x1, u1, &xdot1);
-  const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
+  dynamics(x1, u1, num_derivatives, workspace.get(), &xdot1);
 
   // Cubic interpolation to get xcol and xdotcol.
   const AutoDiffVecXd xcol = 0.5 * (x0 + x1) + h / 8 * (xdot0 - xdot1);
   const AutoDiffVecXd xdotcol = -1.5 * (x0 - x1) / h - .25 * (xdot0 + xdot1);
 
   AutoDiffVecXd g;
-  dynamics(xcol, 0.5 * (u0 + u1), &g);
+  dynamics(xcol, 0.5 * (u0 + u1), num_derivatives, workspace.get(), &g);
   y = xdotcol - g;
 }
 
@@ -147,9 +172,12 @@ DirectCollocation::DirectCollocation(const System<double>* system,
         0, system_->AllocateInputVector(system_->get_input_port(0)));
   }
 
-  // Add the dynamic constraints.
-  auto constraint = std::make_shared<DirectCollocationConstraint>(
-      *system, context);
+  // Add the dynamic constraints, which all evaluate the dynamics with the
+  // Contexts of a single pool.
+  auto pool = std::make_shared<const DynamicsContextPool>(
+      System<double>::ToAutoDiffXd(*system), context);
+  set_dynamics_context_pool(pool);
+  auto constraint = std::make_shared<DirectCollocationConstraint>(pool);
 
   DRAKE_ASSERT(static_cast<int>(constraint->num_constraints()) == num_states());
 
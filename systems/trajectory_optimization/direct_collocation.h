@@ -79,7 +79,11 @@ class DirectCollocation : public MultipleShooting {
 /// Note that the DirectCollocation implementation allocates only ONE of
 /// these constraints, but binds that constraint multiple times (with
 /// different decision variables, along the trajectory).
-
+///
+/// Eval() may be called concurrently from multiple threads. Each concurrent
+/// evaluation uses its own Context of the (AutoDiffXd) system, taken from a
+/// DynamicsContextPool, which allows the solvers to evaluate the bindings of
+/// the constraint in parallel.
 class DirectCollocationConstraint : public solvers::Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectCollocationConstraint)
@@ -88,11 +92,22 @@ class DirectCollocationConstraint : public solvers::Constraint {
   DirectCollocationConstraint(const System<double>& system,
                               const Context<double>& context);
 
+  /// Constructs the constraint for the system of @p pool, evaluating the
+  /// dynamics with the Contexts of @p pool, which may be shared with other
+  /// constraints. The Context of @p pool must have only continuous state.
+  explicit DirectCollocationConstraint(
+      std::shared_ptr<const DynamicsContextPool> pool);
+
   ~DirectCollocationConstraint() override = default;
 
   int num_states() const { return num_states_; }
   int num_inputs() const { return num_inputs_; }
 
+  bool is_thread_safe() const override { return true; }
+
+  /// Returns the pool of Contexts used to evaluate the dynamics.
+  const DynamicsContextPool& context_pool() const { return *pool_; }
+
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd& y) const override;
@@ -101,17 +116,16 @@ class DirectCollocationConstraint : public solvers::Constraint {
               AutoDiffVecXd& y) const override;
 
  private:
-  DirectCollocationConstraint(const System<double>& system,
-                              const Context<double>& context, int num_states,
-                              int num_inputs);
+  DirectCollocationConstraint(std::shared_ptr<const DynamicsContextPool> pool,
+                              int num_states, int num_inputs);
 
+  // Evaluates the dynamics at (state, input), where the derivatives of both
+  // are taken with respect to `num_derivatives` variables.
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
+                int num_derivatives, DynamicsContextPool::Workspace* workspace,
                 AutoDiffVecXd* xdot) const;
 
-  std::unique_ptr<System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  FreestandingInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  const std::shared_ptr<const DynamicsContextPool> pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
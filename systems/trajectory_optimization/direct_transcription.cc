@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -20,42 +21,51 @@ using trajectories::PiecewisePolynomial;
 
 namespace {
 
+// Evaluates the dynamics with the Contexts of a DynamicsContextPool, so that
+// the bindings of all the DiscreteTimeSystemConstraints sharing that pool can
+// be evaluated concurrently.
 class DiscreteTimeSystemConstraint : public solvers::Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DiscreteTimeSystemConstraint)
 
   // @param evaluation_time  The time along the trajectory at which this
   // constraint is evaluated.
-  DiscreteTimeSystemConstraint(const System<AutoDiffXd>& system,
-                               Context<AutoDiffXd>* context,
-                               DiscreteValues<AutoDiffXd>* discrete_state,
-                               FreestandingInputPortValue* input_port_value,
+  DiscreteTimeSystemConstraint(std::shared_ptr<const DynamicsContextPool> pool,
                                int num_states, int num_inputs,
                                double evaluation_time)
       : Constraint(num_states, num_inputs + 2 * num_states,
                    Eigen::VectorXd::Zero(num_states),
                    Eigen::VectorXd::Zero(num_states)),
-        system_(system),
-        context_(context),
-        input_port_value_(input_port_value),
-        discrete_state_(discrete_state),
+        pool_(std::move(pool)),
         num_states_(num_states),
         num_inputs_(num_inputs),
         evaluation_time_(evaluation_time) {
     DRAKE_DEMAND(evaluation_time >= 0.0);
-    DRAKE_DEMAND(context_->has_only_discrete_state());
-    DRAKE_DEMAND(context_ != nullptr);
-    DRAKE_DEMAND(discrete_state_ != nullptr);
-    DRAKE_DEMAND(context_->get_num_input_ports() == 0 ||
-                 input_port_value_ != nullptr);
+    DRAKE_DEMAND(pool_ != nullptr);
+    DRAKE_DEMAND(pool_->context().has_only_discrete_state());
+    DRAKE_DEMAND(pool_->num_inputs() == num_inputs_);
 
     // Makes sure the autodiff vector is properly initialized.
     evaluation_time_.derivatives().resize(2 * num_states_ + num_inputs_);
     evaluation_time_.derivatives().setZero();
+
+    // Row i depends on all of the input and the state, but only on the i'th
+    // element of the next state.
+    std::vector<std::pair<int, int>> pattern;
+    pattern.reserve(num_states_ * (num_inputs_ + num_states_ + 1));
+    for (int i = 0; i < num_states_; ++i) {
+      for (int j = 0; j < num_inputs_ + num_states_; ++j) {
+        pattern.emplace_back(i, j);
+      }
+      pattern.emplace_back(i, num_inputs_ + num_states_ + i);
+    }
+    SetGradientSparsityPattern(std::move(pattern));
   }
 
   ~DiscreteTimeSystemConstraint() override = default;
 
+  bool is_thread_safe() const override { return true; }
+
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd& y) const override {
@@ -75,22 +85,22 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
     const auto state = x.segment(num_inputs_, num_states_);
     const auto next_state = x.tail(num_states_);
 
-    context_->set_time(evaluation_time_);
-    if (context_->get_num_input_ports() > 0) {
-      input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
-          input);
+    const DynamicsContextPool::Lease workspace = pool_->Acquire();
+    Context<AutoDiffXd>& context = *workspace->context;
+    context.set_time(evaluation_time_);
+    if (context.get_num_input_ports() > 0) {
+      workspace->input_port_value->GetMutableVectorData<AutoDiffXd>()
+          ->SetFromVector(input);
     }
-    context_->get_mutable_discrete_state(0).SetFromVector(state);
+    context.get_mutable_discrete_state(0).SetFromVector(state);
 
-    system_.CalcDiscreteVariableUpdates(*context_, discrete_state_);
-    y = next_state - discrete_state_->get_vector(0).CopyToVector();
+    pool_->system().CalcDiscreteVariableUpdates(
+        context, workspace->discrete_state.get());
+    y = next_state - workspace->discrete_state->get_vector(0).CopyToVector();
   }
 
  private:
-  const System<AutoDiffXd>& system_;
-  Context<AutoDiffXd>* const context_;
-  FreestandingInputPortValue* const input_port_value_;
-  DiscreteValues<AutoDiffXd>* const discrete_state_;
+  const std::shared_ptr<const DynamicsContextPool> pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
@@ -251,18 +261,13 @@ bool DirectTranscription::AddSymbolicDynamicConstraints(
 
 void DirectTranscription::AddAutodiffDynamicConstraints(
     const System<double>* system, const Context<double>& context) {
-  system_ = system->ToAutoDiffXd();
-  DRAKE_DEMAND(system_ != nullptr);
-  context_ = system_->CreateDefaultContext();
-  discrete_state_ = system_->AllocateDiscreteVariables();
-
-  context_->SetTimeStateAndParametersFrom(context);
-
-  if (context_->get_num_input_ports() > 0) {
-    // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
-        0, system_->AllocateInputVector(system_->get_input_port(0)));
-  }
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system = system->ToAutoDiffXd();
+  DRAKE_DEMAND(autodiff_system != nullptr);
+  // All the dynamic constraints evaluate the dynamics with the Contexts of a
+  // single pool.
+  auto pool = std::make_shared<const DynamicsContextPool>(
+      std::move(autodiff_system), context);
+  set_dynamics_context_pool(pool);
 
   // For N-1 timesteps, add a constraint which depends on the knot
   // value along with the state and input vectors at that knot and the
@@ -270,8 +275,7 @@ void DirectTranscription::AddAutodiffDynamicConstraints(
   for (int i = 0; i < N() - 1; i++) {
     // Add the dynamic constraints.
     auto constraint = std::make_shared<DiscreteTimeSystemConstraint>(
-        *system_, context_.get(), discrete_state_.get(), input_port_value_,
-        num_states(), num_inputs(), i * fixed_timestep());
+        pool, num_states(), num_inputs(), i * fixed_timestep());
 
     AddConstraint(constraint, {input(i), state(i), state(i + 1)});
   }
@@ -118,15 +118,6 @@ class DirectTranscription : public MultipleShooting {
   void ValidateSystem(const System<double>& system,
                       const Context<double>& context);
 
-  // AutoDiff versions of the System components (for the constraints).
-  // These values are allocated iff the dynamic constraints are allocated
-  // as DiscreteTimeSystemConstraints, otherwise they are nullptr.
-  std::unique_ptr<const System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  std::unique_ptr<DiscreteValues<AutoDiffXd>> discrete_state_;
-  FreestandingInputPortValue* input_port_value_{
-      nullptr};  // Owned by the context.
-
   const bool discrete_time_system_{false};
 };
 
@@ -0,0 +1,88 @@
+#include "drake/systems/trajectory_optimization/dynamics_context_pool.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+
+namespace {
+
+int GetNumInputs(const System<AutoDiffXd>* system) {
+  DRAKE_THROW_UNLESS(system != nullptr);
+  DRAKE_THROW_UNLESS(system->get_num_input_ports() <= 1);
+  return system->get_num_input_ports() > 0 ? system->get_input_port(0).size()
+                                           : 0;
+}
+
+}  // namespace
+
+DynamicsContextPool::Lease::Lease(const DynamicsContextPool* pool,
+                                  std::unique_ptr<Workspace> workspace)
+    : pool_(pool), workspace_(std::move(workspace)) {}
+
+DynamicsContextPool::Lease::~Lease() {
+  // A moved-from lease has nothing to return.
+  if (workspace_ != nullptr) {
+    pool_->Release(std::move(workspace_));
+  }
+}
+
+DynamicsContextPool::DynamicsContextPool(
+    std::unique_ptr<const System<AutoDiffXd>> system,
+    const Context<double>& context)
+    : system_(std::move(system)),
+      context_(context.Clone()),
+      num_inputs_(GetNumInputs(system_.get())) {
+  // Allocate the first workspace eagerly, so that serial evaluations do not
+  // pay for it.
+  Release(AllocateWorkspace());
+  num_workspaces_ = 1;
+}
+
+DynamicsContextPool::~DynamicsContextPool() {}
+
+DynamicsContextPool::Lease DynamicsContextPool::Acquire() const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!available_.empty()) {
+      std::unique_ptr<Workspace> workspace = std::move(available_.back());
+      available_.pop_back();
+      return Lease(this, std::move(workspace));
+    }
+    ++num_workspaces_;
+  }
+  // Allocate outside of the lock, so that other threads are not held up.
+  return Lease(this, AllocateWorkspace());
+}
+
+int DynamicsContextPool::num_workspaces() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_workspaces_;
+}
+
+std::unique_ptr<DynamicsContextPool::Workspace>
+DynamicsContextPool::AllocateWorkspace() const {
+  auto workspace = std::make_unique<Workspace>();
+  workspace->context = system_->CreateDefaultContext();
+  workspace->context->SetTimeStateAndParametersFrom(*context_);
+  if (workspace->context->get_num_input_ports() > 0) {
+    // Allocate the input port and keep an alias around.
+    workspace->input_port_value = &workspace->context->FixInputPort(
+        0, system_->AllocateInputVector(system_->get_input_port(0)));
+  }
+  workspace->derivatives = system_->AllocateTimeDerivatives();
+  workspace->discrete_state = system_->AllocateDiscreteVariables();
+  return workspace;
+}
+
+void DynamicsContextPool::Release(std::unique_ptr<Workspace> workspace) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  available_.push_back(std::move(workspace));
+}
+
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
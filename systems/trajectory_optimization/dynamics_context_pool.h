@@ -0,0 +1,114 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+
+/// A pool of Contexts of an AutoDiffXd System, together with the storage
+/// needed to evaluate its dynamics, shared by all the dynamic constraints of a
+/// MultipleShooting transcription.
+///
+/// Each evaluation of a dynamic constraint acquires a Workspace from the pool
+/// for its own exclusive use and returns it afterwards. A new Workspace is
+/// allocated only when all the existing ones are in use, so the pool grows to
+/// the maximum number of concurrent evaluations, e.g., the number of threads a
+/// solver evaluates the constraints with, and no further. This is what allows
+/// the constraints that use a pool to report EvaluatorBase::is_thread_safe().
+class DynamicsContextPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicsContextPool)
+
+  /// The storage needed to evaluate the dynamics of the system once.
+  struct Workspace {
+    /// A Context of the system, whose time, state and parameters are
+    /// initialized from the Context given at construction.
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    /// The value fixed to input port 0 of `context`, or nullptr if the system
+    /// has no inputs. Owned by `context`.
+    FreestandingInputPortValue* input_port_value{nullptr};
+    /// Storage for the time derivatives of the continuous state.
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+    /// Storage for the update of the discrete state.
+    std::unique_ptr<DiscreteValues<AutoDiffXd>> discrete_state;
+  };
+
+  /// Grants exclusive use of a Workspace until destroyed, at which point the
+  /// Workspace is returned to the pool it came from.
+  class Lease {
+   public:
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+    Lease(Lease&& other) = default;
+    ~Lease();
+
+    Workspace* operator->() const { return workspace_.get(); }
+    Workspace* get() const { return workspace_.get(); }
+
+   private:
+    friend class DynamicsContextPool;
+
+    Lease(const DynamicsContextPool* pool,
+          std::unique_ptr<Workspace> workspace);
+
+    const DynamicsContextPool* pool_{nullptr};
+    std::unique_ptr<Workspace> workspace_;
+  };
+
+  /// Constructs a pool of Contexts of @p system.
+  ///
+  /// @param system The AutoDiffXd system whose dynamics are evaluated. It must
+  ///    have at most one input port.
+  /// @param context Describes the parameters of the system. It is cloned, so
+  ///    changes to it after construction have no effect on the pool.
+  /// @throws std::runtime_error if @p system is null or has more than one
+  ///    input port.
+  DynamicsContextPool(std::unique_ptr<const System<AutoDiffXd>> system,
+                      const Context<double>& context);
+
+  ~DynamicsContextPool();
+
+  /// Returns the system whose dynamics are evaluated.
+  const System<AutoDiffXd>& system() const { return *system_; }
+
+  /// Returns the copy of the Context given at construction.
+  const Context<double>& context() const { return *context_; }
+
+  /// Returns the size of input port 0 of the system, or zero if it has none.
+  int num_inputs() const { return num_inputs_; }
+
+  /// Takes a Workspace out of the pool, or allocates a new one if they are all
+  /// in use. This method may be called concurrently from multiple threads.
+  Lease Acquire() const;
+
+  /// Returns the number of Workspaces allocated so far, i.e., the largest
+  /// number of concurrent evaluations seen by the pool. There is always at
+  /// least one.
+  int num_workspaces() const;
+
+ private:
+  std::unique_ptr<Workspace> AllocateWorkspace() const;
+
+  void Release(std::unique_ptr<Workspace> workspace) const;
+
+  const std::unique_ptr<const System<AutoDiffXd>> system_;
+  const std::unique_ptr<Context<double>> context_;
+  const int num_inputs_{0};
+
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<Workspace>> available_;
+  mutable int num_workspaces_{0};
+};
+
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
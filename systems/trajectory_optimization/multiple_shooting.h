@@ -13,6 +13,7 @@
 #include "drake/solvers/mathematical_program.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
+#include "drake/systems/trajectory_optimization/dynamics_context_pool.h"
 
 namespace drake {
 namespace systems {
@@ -34,6 +35,14 @@ namespace trajectory_optimization {
 /// This class assumes that there are a fixed number (N) time steps/samples, and
 /// that the trajectory is discretized into timesteps h (N-1 of these), state x
 /// (N of these), and control input u (N of these).
+///
+/// Subclasses that impose the dynamics through generic (nonlinear)
+/// constraints should evaluate them with the Contexts of a single
+/// DynamicsContextPool, registered with set_dynamics_context_pool(). All the
+/// bindings of those constraints are then thread safe, so that a solver
+/// configured to do so, e.g., with SnoptSolver::set_num_threads(), evaluates
+/// them in parallel every time it asks for the constraint values and
+/// gradients.
 class MultipleShooting : public solvers::MathematicalProgram {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultipleShooting)
@@ -233,6 +242,13 @@ class MultipleShooting : public solvers::MathematicalProgram {
     return fixed_timestep_;
   }
 
+  /// Returns the pool of Contexts used to evaluate the dynamic constraints, or
+  /// nullptr if the dynamics are not imposed through generic constraints
+  /// (e.g., because they are linear).
+  const DynamicsContextPool* dynamics_context_pool() const {
+    return dynamics_context_pool_.get();
+  }
+
  protected:
   /// Constructs a MultipleShooting instance with fixed sample times.
   ///
@@ -280,6 +296,12 @@ class MultipleShooting : public solvers::MathematicalProgram {
 
   const solvers::VectorXDecisionVariable& x_vars() const { return x_vars_; }
 
+  /// Registers the pool of Contexts shared by the dynamic constraints.
+  void set_dynamics_context_pool(
+      std::shared_ptr<const DynamicsContextPool> pool) {
+    dynamics_context_pool_ = std::move(pool);
+  }
+
  private:
   virtual void DoAddRunningCost(const symbolic::Expression& g) = 0;
 
@@ -305,6 +327,8 @@ class MultipleShooting : public solvers::MathematicalProgram {
   const solvers::VectorDecisionVariable<1> placeholder_t_var_;
   const solvers::VectorXDecisionVariable placeholder_x_vars_;
   const solvers::VectorXDecisionVariable placeholder_u_vars_;
+
+  std::shared_ptr<const DynamicsContextPool> dynamics_context_pool_;
 };
 
 }  // namespace trajectory_optimization
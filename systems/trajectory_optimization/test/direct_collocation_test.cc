@@ -2,12 +2,14 @@
 
 #include <cmath>
 #include <cstddef>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/systems/primitives/linear_system.h"
 
@@ -267,6 +269,83 @@ GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   EXPECT_TRUE(val.isZero());
 }
 
+// Checks the gradient of the collocation constraint against finite
+// differences, including for derivatives taken with respect to more variables
+// than the inputs of the constraint.
+GTEST_TEST(DirectCollocationTest, TestCollocationConstraintGradient) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const DirectCollocationConstraint constraint(*system, *context);
+
+  Eigen::VectorXd x_value(constraint.num_vars());
+  x_value << 0.1, 6, 7, 8, 9, 10, 11, 12, 13;
+  const int kNumExtraDerivatives = 2;
+  const AutoDiffVecXd x = math::initializeAutoDiff(
+      x_value, x_value.size() + kNumExtraDerivatives, kNumExtraDerivatives);
+  AutoDiffVecXd y;
+  constraint.Eval(x, y);
+  const Eigen::MatrixXd dy = math::autoDiffToGradientMatrix(y);
+  ASSERT_EQ(dy.cols(), x_value.size() + kNumExtraDerivatives);
+  EXPECT_TRUE(dy.leftCols(kNumExtraDerivatives).isZero());
+
+  const double kDelta = 1e-6;
+  for (int j = 0; j < x_value.size(); ++j) {
+    Eigen::VectorXd x_plus = x_value;
+    Eigen::VectorXd x_minus = x_value;
+    x_plus(j) += kDelta;
+    x_minus(j) -= kDelta;
+    Eigen::VectorXd y_plus, y_minus;
+    constraint.Eval(x_plus, y_plus);
+    constraint.Eval(x_minus, y_minus);
+    EXPECT_TRUE(CompareMatrices(dy.col(kNumExtraDerivatives + j),
+                                (y_plus - y_minus) / (2 * kDelta), 1e-5));
+  }
+}
+
+// Evaluates the collocation constraint concurrently from several threads and
+// checks that the values and gradients match those of serial evaluations.
+GTEST_TEST(DirectCollocationTest, ConcurrentEvaluation) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const DirectCollocationConstraint constraint(*system, *context);
+  EXPECT_TRUE(constraint.is_thread_safe());
+
+  const int kNumThreads = 4;
+  const int kNumEvaluations = 50;
+  std::vector<AutoDiffVecXd> x(kNumThreads * kNumEvaluations);
+  std::vector<AutoDiffVecXd> y_expected(x.size());
+  for (int i = 0; i < static_cast<int>(x.size()); ++i) {
+    Eigen::VectorXd x_value(constraint.num_vars());
+    for (int j = 0; j < x_value.size(); ++j) {
+      x_value(j) = std::sin(1.0 + i + 3.0 * j);
+    }
+    x_value(0) = 0.1 + 0.01 * i;
+    x[i] = math::initializeAutoDiff(x_value);
+    constraint.Eval(x[i], y_expected[i]);
+  }
+
+  std::vector<AutoDiffVecXd> y(x.size());
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&constraint, &x, &y, t]() {
+      for (int i = t; i < static_cast<int>(x.size()); i += kNumThreads) {
+        constraint.Eval(x[i], y[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < static_cast<int>(x.size()); ++i) {
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y[i]),
+                                math::autoDiffToValueMatrix(y_expected[i])));
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y[i]),
+                                math::autoDiffToGradientMatrix(y_expected[i])));
+  }
+  EXPECT_LE(constraint.context_pool().num_workspaces(), kNumThreads);
+}
+
 }  // anonymous namespace
 }  // namespace trajectory_optimization
 }  // namespace systems
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -334,6 +335,58 @@ GTEST_TEST(DirectTranscriptionTest, LinearSystemWParamsTest) {
   }
 }
 
+// Evaluates the autodiff dynamic constraints concurrently from several
+// threads, and checks that they match serial evaluations and share a single
+// pool of Contexts.
+GTEST_TEST(DirectTranscriptionTest, ConcurrentEvaluation) {
+  const double kTimeStep = 1.0;
+  CubicPolynomialSystem<double> system(kTimeStep);
+
+  const auto context = system.CreateDefaultContext();
+  const int kNumSampleTimes = 21;
+  DirectTranscription prog(&system, *context, kNumSampleTimes);
+  ASSERT_NE(prog.dynamics_context_pool(), nullptr);
+  EXPECT_EQ(prog.dynamics_context_pool()->num_workspaces(), 1);
+
+  prog.SetInitialGuessForAllVariables(
+      Eigen::VectorXd::LinSpaced(prog.num_vars(), -1, 1));
+  const std::vector<solvers::Binding<solvers::Constraint>>&
+      dynamic_constraints = prog.generic_constraints();
+  ASSERT_EQ(dynamic_constraints.size(), kNumSampleTimes - 1);
+  std::vector<Eigen::VectorXd> y_expected;
+  for (const auto& binding : dynamic_constraints) {
+    EXPECT_TRUE(binding.evaluator()->is_thread_safe());
+    y_expected.push_back(prog.EvalBindingAtInitialGuess(binding));
+  }
+
+  const int kNumThreads = 4;
+  const int kNumRepetitions = 20;
+  std::vector<std::vector<Eigen::VectorXd>> y(
+      kNumThreads, std::vector<Eigen::VectorXd>(dynamic_constraints.size()));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&prog, &dynamic_constraints, &y, t]() {
+      for (int k = 0; k < kNumRepetitions; ++k) {
+        for (int i = 0; i < static_cast<int>(dynamic_constraints.size());
+             ++i) {
+          y[t][i] = prog.EvalBindingAtInitialGuess(dynamic_constraints[i]);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kNumThreads; ++t) {
+    for (int i = 0; i < static_cast<int>(dynamic_constraints.size()); ++i) {
+      EXPECT_TRUE(CompareMatrices(y[t][i], y_expected[i]));
+    }
+  }
+  EXPECT_GE(prog.dynamics_context_pool()->num_workspaces(), 1);
+  EXPECT_LE(prog.dynamics_context_pool()->num_workspaces(), kNumThreads);
+}
+
 // TODO(russt): Add tests for ReconstructTrajectory methods once their output is
 // non-trivial.
 
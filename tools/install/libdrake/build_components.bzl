@@ -8,6 +8,7 @@
 # any new external dependencies to :external_licenses.
 LIBDRAKE_COMPONENTS = [
     "//automotive/maliput/api:api",
+    "//automotive/maliput/base:simple_rulebook",
     "//automotive/maliput/dragway:dragway",
     "//automotive/maliput/monolane:builder",
     "//automotive/maliput/monolane:lanes",
@@ -53,7 +54,9 @@
     "//common/proto:matlab_rpc",
     "//common/proto:protobuf",
     "//common/trajectories:piecewise_polynomial",
+    "//common/trajectories:piecewise_polynomial_evaluator",
     "//common/trajectories:piecewise_quaternion",
+    "//common/trajectories:piecewise_quaternion_evaluator",
     "//common/trajectories:piecewise_trajectory",
     "//common/trajectories:trajectory",
     "//common:autodiff",
@@ -74,6 +77,8 @@
     "//common:is_less_than_comparable",
     "//common:nice_type_name",
     "//common:number_traits",
+    "//common:parallel_for",
+    "//common:philox4x32",
     "//common:polynomial",
     "//common:reset_after_move",
     "//common:reset_on_copy",
@@ -84,9 +89,12 @@
     "//common:symbolic_decompose",
     "//common:temp_directory",
     "//common:text_logging_gflags_h",
+    "//common:trace",
     "//common:type_safe_index",
     "//common:unused",
     "//geometry/query_results:penetration_as_point_pair",
+    "//geometry/query_results:signed_distance_pair",
+    "//geometry/query_results:time_of_impact",
     "//geometry:frame_kinematics",
     "//geometry:geometry_context",
     "//geometry:geometry_frame",
@@ -132,6 +140,7 @@
     "//math:gradient",
     "//math:gray_code",
     "//math:jacobian",
+    "//math:lyapunov_equation",
     "//math:matrix_util",
     "//math:orthonormal_basis",
     "//math:quadratic_form",
@@ -158,6 +167,7 @@
     "//multibody/multibody_tree/math:spatial_velocity",
     "//multibody/multibody_tree/multibody_plant:multibody_plant",
     "//multibody/multibody_tree:articulated_body_inertia",
+    "//multibody/multibody_tree:mass_matrix_factorization",
     "//multibody/multibody_tree:multibody_tree",
     "//multibody/multibody_tree:multibody_tree_context",
     "//multibody/multibody_tree:multibody_tree_element",
@@ -181,6 +191,7 @@
     "//multibody/rigid_body_plant:rigid_body_plant_bridge",
     "//multibody/shapes:shapes",
     "//multibody:approximate_ik",
+    "//multibody:batch_kinematics_cache",
     "//multibody:global_inverse_kinematics",
     "//multibody:inverse_kinematics",
     "//multibody:kinematics_cache",
@@ -200,6 +211,7 @@
     "//solvers:bilinear_product_util",
     "//solvers:binding",
     "//solvers:branch_and_bound",
+    "//solvers:chordal_sparsity",
     "//solvers:constraint",
     "//solvers:cost",
     "//solvers:create_constraint",
@@ -226,6 +238,7 @@
     "//solvers:rotation_constraint",
     "//solvers:scs_solver",
     "//solvers:snopt_solver",
+    "//solvers:solve_in_parallel",
     "//solvers:solver_id",
     "//solvers:solver_type",
     "//solvers:solver_type_converter",
@@ -236,6 +249,7 @@
     "//systems/analysis:implicit_euler_integrator",
     "//systems/analysis:integrator_base",
     "//systems/analysis:lyapunov",
+    "//systems/analysis:monte_carlo",
     "//systems/analysis:runge_kutta2_integrator",
     "//systems/analysis:runge_kutta3_integrator",
     "//systems/analysis:semi_explicit_euler_integrator",
@@ -264,6 +278,7 @@
     "//systems/controllers:setpoint",
     "//systems/controllers:side",
     "//systems/controllers:state_feedback_controller_interface",
+    "//systems/controllers:time_varying_linear_quadratic_regulator",
     "//systems/controllers:zmp_planner",
     "//systems/controllers:zmp_util",
     "//systems/estimators:kalman_filter",
@@ -347,6 +362,7 @@
     "//systems/sensors:gyroscope",
     "//systems/sensors:image",
     "//systems/sensors:image_to_lcm_image_array_t",
+    "//systems/sensors:imu_array",
     "//systems/sensors:optitrack_encoder",
     "//systems/sensors:optitrack_sender",
     "//systems/sensors:rgbd_camera",
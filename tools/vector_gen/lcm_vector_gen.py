@@ -121,7 +121,7 @@ def generate_indices_names_accessor_impl(cc, caller_context, fields):
 DEFAULT_CTOR_ZEROS = """
   /// Default constructor.  Sets all rows to zero.
   %(camel)s() : systems::BasicVector<T>(K::kNumCoordinates) {
-    this->SetFromVector(VectorX<T>::Zero(K::kNumCoordinates));
+    this->get_mutable_value().setZero();
   }
 """
 # A second variant of a default constructor (field-by-field setting).
@@ -196,10 +196,14 @@ ACCESSOR_FIELD_DOC_UNITS = """
 ACCESSOR_FIELD_DOC_RANGE = """
   /// @note @c %(field)s has a limited domain of [%(min_doc)s, %(max_doc)s].
 """
+# The accessors index the storage directly at the compile-time offsets, rather
+# than through the virtual, bounds-checked GetAtIndex, so that they inline.
 ACCESSOR_FIELD_METHODS = """
-  const T& %(field)s() const { return this->GetAtIndex(K::%(kname)s); }
+  const T& %(field)s() const {
+    return this->get_value().coeffRef(K::%(kname)s);
+  }
   void set_%(field)s(const T& %(field)s) {
-    this->SetAtIndex(K::%(kname)s, %(field)s);
+    this->get_mutable_value()[K::%(kname)s] = %(field)s;
   }
 """
 ACCESSOR_END = """
@@ -59,18 +59,20 @@ class Sample : public systems::BasicVector<T> {
   /// Some coordinate
   /// @note @c x is expressed in units of m/s.
   /// @note @c x has a limited domain of [0.0, +Inf].
-  const T& x() const { return this->GetAtIndex(K::kX); }
-  void set_x(const T& x) { this->SetAtIndex(K::kX, x); }
+  const T& x() const { return this->get_value().coeffRef(K::kX); }
+  void set_x(const T& x) { this->get_mutable_value()[K::kX] = x; }
   /// A very long documentation string that will certainly flow across multiple
   /// lines of C++
-  const T& two_word() const { return this->GetAtIndex(K::kTwoWord); }
+  const T& two_word() const { return this->get_value().coeffRef(K::kTwoWord); }
   void set_two_word(const T& two_word) {
-    this->SetAtIndex(K::kTwoWord, two_word);
+    this->get_mutable_value()[K::kTwoWord] = two_word;
   }
   /// A signed, normalized value
   /// @note @c absone has a limited domain of [-1.0, 1.0].
-  const T& absone() const { return this->GetAtIndex(K::kAbsone); }
-  void set_absone(const T& absone) { this->SetAtIndex(K::kAbsone, absone); }
+  const T& absone() const { return this->get_value().coeffRef(K::kAbsone); }
+  void set_absone(const T& absone) {
+    this->get_mutable_value()[K::kAbsone] = absone;
+  }
   //@}
 
   /// See SampleIndices::GetCoordinateNames().